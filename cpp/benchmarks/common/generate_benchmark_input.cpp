@@ -18,8 +18,11 @@
 #include "random_distribution_factory.hpp"
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/hashing.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/unary.hpp>
 #include <cudf/utilities/bit.hpp>
 
 #include <cudf_test/column_utilities.hpp>
@@ -29,9 +32,13 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <algorithm>
 #include <future>
 #include <memory>
+#include <numeric>
 #include <random>
+#include <set>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -84,13 +91,10 @@ size_t avg_element_size<cudf::string_view>(data_profile const& profile)
 }
 
 template <>
-size_t avg_element_size<cudf::list_view>(data_profile const& profile)
-{
-  auto const dist_params       = profile.get_distribution_params<cudf::list_view>();
-  auto const single_level_mean = get_distribution_mean(dist_params.length_params);
-  auto const element_size      = cudf::size_of(cudf::data_type{dist_params.element_type});
-  return element_size * pow(single_level_mean, dist_params.max_depth);
-}
+size_t avg_element_size<cudf::list_view>(data_profile const& profile);
+
+template <>
+size_t avg_element_size<cudf::struct_view>(data_profile const& profile);
 
 struct avg_element_size_fn {
   template <typename T>
@@ -105,6 +109,27 @@ size_t avg_element_bytes(data_profile const& profile, cudf::type_id tid)
   return cudf::type_dispatcher(cudf::data_type(tid), avg_element_size_fn{}, profile);
 }
 
+template <>
+size_t avg_element_size<cudf::list_view>(data_profile const& profile)
+{
+  auto const dist_params       = profile.get_distribution_params<cudf::list_view>();
+  auto const single_level_mean = get_distribution_mean(dist_params.length_params);
+  auto const element_size      = avg_element_bytes(profile, dist_params.element_type);
+  return element_size * pow(single_level_mean, dist_params.max_depth);
+}
+
+template <>
+size_t avg_element_size<cudf::struct_view>(data_profile const& profile)
+{
+  auto const dist_params = profile.get_distribution_params<cudf::struct_view>();
+  auto const level_size  = std::accumulate(
+    dist_params.leaf_types.begin(),
+    dist_params.leaf_types.end(),
+    size_t{0},
+    [&](size_t size, cudf::type_id tid) { return size + avg_element_bytes(profile, tid); });
+  return level_size * dist_params.max_depth;
+}
+
 /**
  * @brief Functor that computes a random column element with the given data profile.
  *
@@ -226,6 +251,48 @@ auto create_run_length_dist(cudf::size_type avg_run_len)
   return std::gamma_distribution<float>{alpha, avg_run_len / alpha};
 }
 
+/**
+ * @brief Picks the index of the sample of each row, among `cardinality` samples.
+ *
+ * The samples are picked uniformly, or with a Zipf distribution of the exponent of the profile.
+ * With an exact cardinality, the first `cardinality` picks are a permutation of all samples.
+ */
+class sample_index_fn {
+  std::uniform_int_distribution<cudf::size_type> uniform_dist;
+  std::discrete_distribution<cudf::size_type> zipf_dist;
+  std::vector<cudf::size_type> permutation;
+  bool const is_zipf;
+  size_t num_picks = 0;
+
+ public:
+  sample_index_fn(data_profile const& profile, cudf::size_type cardinality, std::mt19937& engine)
+    : uniform_dist{0, std::max(cardinality - 1, 0)},
+      is_zipf{profile.get_zipf_exponent() > 0 and cardinality > 0}
+  {
+    if (is_zipf) {
+      std::vector<double> weights(cardinality);
+      for (cudf::size_type k = 0; k < cardinality; ++k) {
+        weights[k] = 1. / std::pow(k + 1., profile.get_zipf_exponent());
+      }
+      zipf_dist = std::discrete_distribution<cudf::size_type>(weights.begin(), weights.end());
+    }
+    if (profile.is_cardinality_exact()) {
+      permutation.resize(cardinality);
+      std::iota(permutation.begin(), permutation.end(), 0);
+      std::shuffle(permutation.begin(), permutation.end(), engine);
+    }
+  }
+
+  cudf::size_type operator()(std::mt19937& engine)
+  {
+    if (num_picks < permutation.size()) { return permutation[num_picks++]; }
+    return is_zipf ? zipf_dist(engine) : uniform_dist(engine);
+  }
+};
+
+// Number of times a duplicate sample is regenerated when the cardinality is exact
+constexpr int max_unique_attempts = 16;
+
 // identity mapping, except for bools
 template <typename T, typename Enable = void>
 struct stored_as {
@@ -260,15 +327,27 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
   auto value_dist = random_value_fn<T>{profile.get_distribution_params<T>()};
 
   auto const cardinality = std::min(num_rows, profile.get_cardinality());
+  auto const exact       = profile.is_cardinality_exact();
   std::vector<stored_Type> samples(cardinality);
   std::vector<cudf::bitmask_type> samples_null_mask(null_mask_size(cardinality), ~0);
+  std::set<stored_Type> sample_values;
+  bool has_null_sample = false;
   for (cudf::size_type si = 0; si < cardinality; ++si) {
-    set_element_at(
-      (stored_Type)value_dist(engine), valid_dist(engine), samples, samples_null_mask, si);
+    auto const valid = valid_dist(engine) or (exact and has_null_sample);
+    auto value       = (stored_Type)value_dist(engine);
+    if (exact and valid) {
+      for (int attempt = 1;
+           attempt < max_unique_attempts and not sample_values.insert(value).second;
+           ++attempt) {
+        value = (stored_Type)value_dist(engine);
+      }
+    }
+    has_null_sample |= not valid;
+    set_element_at(value, valid, samples, samples_null_mask, si);
   }
 
   // Distribution for picking elements from the array of samples
-  std::uniform_int_distribution<cudf::size_type> sample_dist{0, cardinality - 1};
+  sample_index_fn sample_dist{profile, cardinality, engine};
   auto const avg_run_len = profile.get_avg_run_length();
   auto run_len_dist      = create_run_length_dist(avg_run_len);
   std::vector<stored_Type> data(num_rows);
@@ -389,16 +468,29 @@ std::unique_ptr<cudf::column> create_random_column<cudf::string_view>(data_profi
 
   auto const avg_string_len = avg_element_size<cudf::string_view>(profile);
   auto const cardinality    = std::min(profile.get_cardinality(), num_rows);
+  auto const exact          = profile.is_cardinality_exact();
   string_column_data samples(cardinality, cardinality * avg_string_len);
+  std::set<std::string> sample_strings;
+  bool has_null_sample = false;
   for (cudf::size_type si = 0; si < cardinality; ++si) {
-    append_string(char_dist, valid_dist(engine), len_dist(engine), samples);
+    auto const valid = valid_dist(engine) or (exact and has_null_sample);
+    for (int attempt = 1;; ++attempt) {
+      append_string(char_dist, valid, len_dist(engine), samples);
+      if (not exact or not valid or attempt == max_unique_attempts) { break; }
+      auto const begin = samples.chars.begin() + samples.offsets[si];
+      if (sample_strings.emplace(begin, samples.chars.end()).second) { break; }
+      // regenerate the duplicate sample
+      samples.chars.resize(samples.offsets[si]);
+      samples.offsets.pop_back();
+    }
+    has_null_sample |= not valid;
   }
 
   auto const avg_run_len = profile.get_avg_run_length();
   auto run_len_dist      = create_run_length_dist(avg_run_len);
 
   string_column_data out_col(num_rows, num_rows * avg_string_len);
-  std::uniform_int_distribution<cudf::size_type> sample_dist{0, cardinality - 1};
+  sample_index_fn sample_dist{profile, cardinality, engine};
   for (cudf::size_type row = 0; row < num_rows; ++row) {
     if (cardinality == 0) {
       append_string(char_dist, valid_dist(engine), len_dist(engine), out_col);
@@ -431,10 +523,7 @@ std::unique_ptr<cudf::column> create_random_column<cudf::dictionary32>(data_prof
 template <>
 std::unique_ptr<cudf::column> create_random_column<cudf::struct_view>(data_profile const& profile,
                                                                       std::mt19937& engine,
-                                                                      cudf::size_type num_rows)
-{
-  CUDF_FAIL("not implemented yet");
-}
+                                                                      cudf::size_type num_rows);
 
 /**
  * @brief Functor to dispatch create_random_column calls.
@@ -470,6 +559,8 @@ std::unique_ptr<cudf::column> create_random_column<cudf::list_view>(data_profile
   auto const dist_params       = profile.get_distribution_params<cudf::list_view>();
   auto const single_level_mean = get_distribution_mean(dist_params.length_params);
   auto const num_elements      = num_rows * pow(single_level_mean, dist_params.max_depth);
+  CUDF_EXPECTS(dist_params.element_type != cudf::type_id::LIST,
+               "List nesting is set with the maximal depth");
 
   auto leaf_column = cudf::type_dispatcher(
     cudf::data_type(dist_params.element_type), create_rand_col_fn{}, profile, engine, num_elements);
@@ -511,6 +602,59 @@ std::unique_ptr<cudf::column> create_random_column<cudf::list_view>(data_profile
   return list_column;  // return the top-level column
 }
 
+/**
+ * @brief Creates a struct column with random content.
+ *
+ * The data profile determines the types of the leaf columns of each level, and the number of
+ * nested levels.
+ *
+ * @param profile Parameters for the random generator
+ * @param engine Pseudo-random engine
+ * @param num_rows Size of the output column
+ *
+ * @return Column filled with random structs
+ */
+template <>
+std::unique_ptr<cudf::column> create_random_column<cudf::struct_view>(data_profile const& profile,
+                                                                      std::mt19937& engine,
+                                                                      cudf::size_type num_rows)
+{
+  auto const dist_params = profile.get_distribution_params<cudf::struct_view>();
+  auto valid_dist        = std::bernoulli_distribution{1. - profile.get_null_frequency()};
+  auto const has_leaf    = [&](cudf::type_id type) {
+    return std::find(dist_params.leaf_types.begin(), dist_params.leaf_types.end(), type) !=
+           dist_params.leaf_types.end();
+  };
+  CUDF_EXPECTS(not has_leaf(cudf::type_id::STRUCT), "Struct nesting is set with the maximal depth");
+  CUDF_EXPECTS(not has_leaf(cudf::type_id::LIST) or
+                 profile.get_distribution_params<cudf::list_view>().element_type !=
+                   cudf::type_id::STRUCT,
+               "Structs of lists cannot hold lists of structs");
+
+  // Generate the struct column bottom-up
+  std::unique_ptr<cudf::column> struct_column;
+  for (int lvl = 0; lvl < dist_params.max_depth; ++lvl) {
+    std::vector<std::unique_ptr<cudf::column>> children;
+    for (auto const tid : dist_params.leaf_types) {
+      children.push_back(cudf::type_dispatcher(
+        cudf::data_type(tid), create_rand_col_fn{}, profile, engine, num_rows));
+    }
+    if (struct_column) { children.push_back(std::move(struct_column)); }
+
+    std::vector<cudf::bitmask_type> null_mask(null_mask_size(num_rows), ~0);
+    for (cudf::size_type row = 0; row < num_rows; ++row) {
+      if (!valid_dist(engine)) cudf::clear_bit_unsafe(null_mask.data(), row);
+    }
+    struct_column = cudf::make_structs_column(
+      num_rows,
+      std::move(children),
+      cudf::UNKNOWN_NULL_COUNT,
+      rmm::device_buffer(
+        null_mask.data(), null_mask.size() * sizeof(cudf::bitmask_type), rmm::cuda_stream_default));
+  }
+  return struct_column;  // return the top-level column
+}
+
 using columns_vector = std::vector<std::unique_ptr<cudf::column>>;
 
 /**
@@ -609,6 +753,34 @@ std::unique_ptr<cudf::table> create_random_table(std::vector<cudf::type_id> cons
   return std::make_unique<cudf::table>(std::move(output_columns));
 }
 
+std::unique_ptr<cudf::column> create_correlated_column(cudf::column_view const& source,
+                                                       cudf::type_id dtype_id,
+                                                       double correlation,
+                                                       data_profile const& profile,
+                                                       unsigned seed)
+{
+  auto const type = cudf::data_type{dtype_id};
+  CUDF_EXPECTS(cudf::is_numeric(type), "Correlated columns must be numeric");
+  CUDF_EXPECTS(correlation >= 0 and correlation <= 1, "Correlation must be in [0, 1]");
+
+  // Equal values of the source have equal hashes, and thus equal derived values
+  auto const hashes =
+    cudf::hash(cudf::table_view{{source}}, cudf::hash_id::HASH_MURMUR3, {}, seed);
+  auto const derived = cudf::cast(hashes->view(), type);
+
+  auto const random = create_random_table({dtype_id}, 1, row_count{source.size()}, profile, seed);
+
+  data_profile mask_profile;
+  mask_profile.set_bool_probability(correlation);
+  mask_profile.set_null_frequency(0);
+  mask_profile.set_cardinality(0);
+  mask_profile.set_avg_run_length(1);
+  auto const mask =
+    create_random_table({cudf::type_id::BOOL8}, 1, row_count{source.size()}, mask_profile, seed);
+
+  return cudf::copy_if_else(derived->view(), random->get_column(0), mask->get_column(0));
+}
+
 std::vector<cudf::type_id> get_type_or_group(int32_t id)
 {
   // identity transformation when passing a concrete type_id
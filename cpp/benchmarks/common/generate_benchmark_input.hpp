@@ -166,6 +166,9 @@ struct distribution_params<T,
 /**
  * @brief Lists are parameterized by the distribution of their length, maximal nesting level, and
  * the element type.
+ *
+ * The element type can be a struct type, whose leaf columns are then generated with the struct
+ * parameters, as long as they do not include lists.
  */
 template <typename T>
 struct distribution_params<T, typename std::enable_if_t<std::is_same<T, cudf::list_view>::value>> {
@@ -174,6 +177,21 @@ struct distribution_params<T, typename std::enable_if_t<std::is_same<T, cudf::li
   cudf::size_type max_depth;
 };
 
+/**
+ * @brief Structs are parameterized by the types of the leaf columns of each level and the number of
+ * nested levels.
+ *
+ * Each level holds one column of each leaf type, and all levels but the bottom one also hold the
+ * struct column of the level below. The leaf types can include a list type, whose columns are then
+ * generated with the list parameters, as long as their element type is not a struct.
+ */
+template <typename T>
+struct distribution_params<T,
+                           typename std::enable_if_t<std::is_same<T, cudf::struct_view>::value>> {
+  std::vector<cudf::type_id> leaf_types;
+  cudf::size_type max_depth;
+};
+
 // Present for compilation only. To be implemented once reader/writers support the fixed width type.
 template <typename T>
 struct distribution_params<T, typename std::enable_if_t<cudf::is_fixed_point<T>()>> {
@@ -217,11 +235,15 @@ class data_profile {
   distribution_params<cudf::string_view> string_dist_desc{{distribution_id::NORMAL, 0, 32}};
   distribution_params<cudf::list_view> list_dist_desc{
     cudf::type_id::INT32, {distribution_id::GEOMETRIC, 0, 100}, 2};
+  distribution_params<cudf::struct_view> struct_dist_desc{
+    {cudf::type_id::INT32, cudf::type_id::FLOAT32, cudf::type_id::STRING}, 2};
 
   double bool_probability        = 0.5;
   double null_frequency          = 0.01;
   cudf::size_type cardinality    = 2000;
   cudf::size_type avg_run_length = 4;
+  double zipf_exponent           = 0.;
+  bool exact_cardinality         = false;
 
  public:
   template <typename T,
@@ -284,6 +306,12 @@ class data_profile {
     return list_dist_desc;
   }
 
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::struct_view>::value>* = nullptr>
+  distribution_params<T> get_distribution_params() const
+  {
+    return struct_dist_desc;
+  }
+
   template <typename T, typename std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
   distribution_params<T> get_distribution_params() const
   {
@@ -294,6 +322,8 @@ class data_profile {
   auto get_null_frequency() const { return null_frequency; };
   auto get_cardinality() const { return cardinality; };
   auto get_avg_run_length() const { return avg_run_length; };
+  auto get_zipf_exponent() const { return zipf_exponent; };
+  auto is_cardinality_exact() const { return exact_cardinality; };
 
   // Users should pass integral values for bounds when setting the parameters for types that have
   // discrete distributions (integers, strings, lists). Otherwise the call with have no effect.
@@ -340,8 +370,23 @@ class data_profile {
   void set_cardinality(cudf::size_type c) { cardinality = c; }
   void set_avg_run_length(cudf::size_type avg_rl) { avg_run_length = avg_rl; }
 
+  // The rows pick their value among the `cardinality` samples uniformly with an exponent of zero,
+  // and with a Zipf distribution otherwise: the k-th most frequent sample is picked with a
+  // probability proportional to 1 / k^exponent. Has no effect with a cardinality of zero.
+  void set_zipf_exponent(double exponent) { zipf_exponent = exponent; }
+  // With an exact cardinality, the samples are distinct, with at most one null sample, and each
+  // sample is used by one of the first `cardinality` runs of rows. The values of numeric types of
+  // fewer distinct values than the cardinality, like booleans, are still repeated.
+  void set_exact_cardinality(bool exact) { exact_cardinality = exact; }
+
   void set_list_depth(cudf::size_type max_depth) { list_dist_desc.max_depth = max_depth; }
   void set_list_type(cudf::type_id type) { list_dist_desc.element_type = type; }
+
+  void set_struct_depth(cudf::size_type max_depth) { struct_dist_desc.max_depth = max_depth; }
+  void set_struct_types(std::vector<cudf::type_id> const& types)
+  {
+    struct_dist_desc.leaf_types = types;
+  }
 };
 
 /**
@@ -395,3 +440,24 @@ std::unique_ptr<cudf::table> create_random_table(std::vector<cudf::type_id> cons
                                                  row_count num_rows,
                                                  data_profile const& data_params = data_profile{},
                                                  unsigned seed                   = 1);
+
+/**
+ * @brief Deterministically generates a numeric column correlated with the `source` column.
+ *
+ * Each row holds, with probability `correlation`, a value computed from the value of the same row
+ * of `source`, and a random value of the given profile otherwise. The rows of equal values in
+ * `source` then mostly hold equal values, like the attributes of a key.
+ *
+ * @param source Column the output is correlated with
+ * @param dtype_id Type of the output column, must be numeric
+ * @param correlation Probability of a row to depend on `source`, in [0, 1]
+ * @param data_params optional, set of data parameters describing the data profile of the random
+ * values
+ * @param seed optional, seed for the pseudo-random engine
+ */
+std::unique_ptr<cudf::column> create_correlated_column(
+  cudf::column_view const& source,
+  cudf::type_id dtype_id,
+  double correlation,
+  data_profile const& data_params = data_profile{},
+  unsigned seed                   = 1);
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_device.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class Shuffle : public cudf::benchmark {
+};
+
+namespace {
+/**
+ * @brief How each rank packs its rows into one buffer per destination rank.
+ */
+enum class pack_method : int32_t {
+  CONTIGUOUS_SPLIT,  ///< `hash_partition`, then `contiguous_split` at the partition offsets
+  PACK,              ///< `hash_partition`, then `pack` of each slice of the partitioned table
+  FUSED              ///< `hash_partition_and_pack`
+};
+
+void set_device(int device) { CUDA_TRY(cudaSetDevice(device)); }
+
+void synchronize_devices(int num_devices)
+{
+  for (int d = 0; d < num_devices; ++d) {
+    set_device(d);
+    CUDA_TRY(cudaDeviceSynchronize());
+  }
+  set_device(0);
+}
+
+/**
+ * @brief Enables the access of each device to the memory of the others, where it is supported.
+ *
+ * The copies between devices without peer access are staged through the host.
+ */
+void enable_peer_access(int num_devices)
+{
+  for (int d = 0; d < num_devices; ++d) {
+    set_device(d);
+    for (int peer = 0; peer < num_devices; ++peer) {
+      int can_access = 0;
+      CUDA_TRY(cudaDeviceCanAccessPeer(&can_access, d, peer));
+      if (peer == d or can_access == 0) { continue; }
+      auto const status = cudaDeviceEnablePeerAccess(peer, 0);
+      CUDF_EXPECTS(status == cudaSuccess or status == cudaErrorPeerAccessAlreadyEnabled,
+                   "Failed to enable the peer access between devices");
+      // clears the error of an access that was already enabled
+      cudaGetLastError();
+    }
+  }
+  set_device(0);
+}
+
+/**
+ * @brief Returns one packed buffer per destination rank, with the rows of `input` which hash to
+ * that rank.
+ */
+std::vector<cudf::packed_columns> partition_and_pack(cudf::table_view const& input,
+                                                     int num_ranks,
+                                                     pack_method method)
+{
+  std::vector<cudf::packed_columns> packed;
+  if (method == pack_method::FUSED) {
+    for (auto& part : cudf::hash_partition_and_pack(input, {0}, num_ranks)) {
+      packed.push_back(std::move(part.data));
+    }
+    return packed;
+  }
+
+  auto const partitioned = cudf::hash_partition(input, {0}, num_ranks);
+  // the offsets start with the first partition, which begins at row 0
+  auto const splits = std::vector<cudf::size_type>(partitioned.second.begin() + 1,
+                                                   partitioned.second.end());
+  if (method == pack_method::CONTIGUOUS_SPLIT) {
+    for (auto& part : cudf::contiguous_split(partitioned.first->view(), splits)) {
+      packed.push_back(std::move(part.data));
+    }
+  } else {
+    for (auto const& part : cudf::split(partitioned.first->view(), splits)) {
+      packed.push_back(cudf::pack(part));
+    }
+  }
+  return packed;
+}
+
+/**
+ * @brief A packed partition received by a rank: the host metadata of the sender, and the device
+ * data on the device of the receiver.
+ */
+struct received_partition {
+  cudf::packed_columns::metadata const* metadata;
+  uint8_t const* gpu_data;
+  std::unique_ptr<rmm::device_buffer> peer_copy;  ///< Owns `gpu_data` if it was copied
+};
+}  // namespace
+
+/**
+ * @brief Benchmarks an all-to-all shuffle of a table between `num_ranks` ranks, spread over
+ * `num_devices` devices.
+ *
+ * Rank `r` holds its own input table on device `r % num_devices`. Each iteration runs the whole
+ * round trip: every rank hash partitions and packs its table into one buffer per rank, each buffer
+ * is copied to the device of its destination rank, and every rank unpacks and concatenates the
+ * buffers it receives. The buffers exchanged between ranks of the same device are not copied.
+ *
+ * The throughput is reported against the size of the packed buffers of all ranks, and the bytes
+ * copied between devices are reported as the `peer_bytes` counter.
+ */
+void BM_shuffle(benchmark::State& state)
+{
+  auto const num_ranks      = static_cast<int>(state.range(0));
+  auto const bytes_per_rank = static_cast<size_t>(state.range(1));
+  auto const num_devices    = static_cast<int>(state.range(2));
+  auto const method         = static_cast<pack_method>(state.range(3));
+
+  int available_devices = 0;
+  CUDA_TRY(cudaGetDeviceCount(&available_devices));
+  if (available_devices < num_devices) {
+    state.SkipWithError("Not enough devices");
+    return;
+  }
+  auto const device_of = [num_devices](int rank) { return rank % num_devices; };
+
+  // device 0 uses the pool of the fixture
+  std::vector<std::shared_ptr<rmm::mr::device_memory_resource>> pools;
+  for (int d = 1; d < num_devices; ++d) {
+    set_device(d);
+    pools.push_back(cudf::make_pool());
+    rmm::mr::set_per_device_resource(rmm::cuda_device_id{d}, pools.back().get());
+  }
+  enable_peer_access(num_devices);
+
+  std::vector<std::unique_ptr<cudf::table>> inputs;
+  for (int r = 0; r < num_ranks; ++r) {
+    set_device(device_of(r));
+    inputs.push_back(create_random_table(
+      {cudf::type_id::INT64, cudf::type_id::FLOAT64, cudf::type_id::INT32, cudf::type_id::STRING},
+      4,
+      table_size_bytes{bytes_per_rank},
+      data_profile{},
+      r));
+  }
+  synchronize_devices(num_devices);
+
+  size_t shuffled_bytes = 0;
+  size_t peer_bytes     = 0;
+  for (auto _ : state) {
+    // sent[r][p] is the buffer sent by rank r to rank p
+    std::vector<std::vector<cudf::packed_columns>> sent(num_ranks);
+    std::vector<std::vector<received_partition>> received(num_ranks);
+    std::vector<std::unique_ptr<cudf::table>> outputs(num_ranks);
+    {
+      cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+      shuffled_bytes = 0;
+      peer_bytes     = 0;
+
+      for (int r = 0; r < num_ranks; ++r) {
+        set_device(device_of(r));
+        sent[r] = partition_and_pack(inputs[r]->view(), num_ranks, method);
+      }
+      // the copies wait for the buffers on the devices of the senders
+      synchronize_devices(num_devices);
+
+      for (int p = 0; p < num_ranks; ++p) {
+        set_device(device_of(p));
+        for (int r = 0; r < num_ranks; ++r) {
+          auto const& packed = sent[r][p];
+          auto const size    = packed.gpu_data->size();
+          auto const data    = static_cast<uint8_t const*>(packed.gpu_data->data());
+          shuffled_bytes += size;
+          if (device_of(r) == device_of(p)) {
+            received[p].push_back({packed.metadata_.get(), data, nullptr});
+            continue;
+          }
+          auto copy = std::make_unique<rmm::device_buffer>(size, rmm::cuda_stream_default);
+          CUDA_TRY(cudaMemcpyPeerAsync(
+            copy->data(), device_of(p), data, device_of(r), size, rmm::cuda_stream_default));
+          peer_bytes += size;
+          auto const copy_data = static_cast<uint8_t const*>(copy->data());
+          received[p].push_back({packed.metadata_.get(), copy_data, std::move(copy)});
+        }
+      }
+
+      for (int p = 0; p < num_ranks; ++p) {
+        set_device(device_of(p));
+        std::vector<cudf::table_view> views;
+        for (auto const& part : received[p]) {
+          views.push_back(cudf::unpack(part.metadata->data(), part.gpu_data));
+        }
+        outputs[p] = cudf::concatenate(views);
+      }
+      synchronize_devices(num_devices);
+    }
+
+    // each buffer is freed on the device it was allocated on
+    for (int r = 0; r < num_ranks; ++r) {
+      set_device(device_of(r));
+      outputs[r].reset();
+      received[r].clear();
+      sent[r].clear();
+    }
+    set_device(0);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(shuffled_bytes) * state.iterations());
+  state.counters["peer_bytes"] = static_cast<double>(peer_bytes);
+
+  for (int r = 0; r < num_ranks; ++r) {
+    set_device(device_of(r));
+    inputs[r].reset();
+  }
+  for (int d = 1; d < num_devices; ++d) {
+    set_device(d);
+    rmm::mr::set_per_device_resource(rmm::cuda_device_id{d}, nullptr);
+    pools[d - 1].reset();
+  }
+  set_device(0);
+}
+
+/**
+ * @brief Registers the numbers of ranks, bytes per rank and devices, with at least one rank per
+ * device.
+ */
+void shuffle_arguments(benchmark::internal::Benchmark* b, pack_method method)
+{
+  for (int64_t num_ranks : {2, 4, 8}) {
+    for (int64_t bytes_per_rank : {64 << 20, 256 << 20}) {
+      for (int64_t num_devices = 1; num_devices <= num_ranks; num_devices *= 2) {
+        b->Args({num_ranks, bytes_per_rank, num_devices, static_cast<int64_t>(method)});
+      }
+    }
+  }
+}
+
+#define SHUFFLE_BENCHMARK_DEFINE(name, method)                                 \
+  BENCHMARK_DEFINE_F(Shuffle, name)                                            \
+  (::benchmark::State & state) { BM_shuffle(state); }                          \
+  BENCHMARK_REGISTER_F(Shuffle, name)                                          \
+    ->Apply([](auto b) { shuffle_arguments(b, method); })                      \
+    ->Unit(benchmark::kMillisecond)                                            \
+    ->UseManualTime();
+
+SHUFFLE_BENCHMARK_DEFINE(contiguous_split, pack_method::CONTIGUOUS_SPLIT)
+SHUFFLE_BENCHMARK_DEFINE(pack, pack_method::PACK)
+SHUFFLE_BENCHMARK_DEFINE(fused, pack_method::FUSED)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <cudf/utilities/metrics.hpp>
 #include <rmm/mr/device/cuda_memory_resource.hpp>
 #include <rmm/mr/device/owning_wrapper.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -44,6 +45,11 @@ inline auto make_pool()
  * and finalize it, respectively. These methods are called automatically by
  * Google Benchmark
  *
+ * The allocations from the pool are tracked, and TearDown reports the peak of
+ * the memory allocated during the benchmark, including its inputs, and the
+ * number of allocations as the `peak_memory_bytes` and `num_allocations`
+ * counters.
+ *
  * Example:
  *
  * template <class T>
@@ -67,14 +73,16 @@ class benchmark : public ::benchmark::Fixture {
  public:
   virtual void SetUp(const ::benchmark::State& state)
   {
-    mr = make_pool();
-    rmm::mr::set_current_device_resource(mr.get());  // set default resource to pool
+    mr       = make_pool();
+    stats_mr = std::make_unique<metrics_resource_adaptor>(mr.get());
+    rmm::mr::set_current_device_resource(stats_mr.get());  // set default resource to pool
   }
 
   virtual void TearDown(const ::benchmark::State& state)
   {
     // reset default resource to the initial resource
     rmm::mr::set_current_device_resource(nullptr);
+    stats_mr.reset();
     mr.reset();
   }
 
@@ -82,10 +90,13 @@ class benchmark : public ::benchmark::Fixture {
   virtual void SetUp(::benchmark::State& st) { SetUp(const_cast<const ::benchmark::State&>(st)); }
   virtual void TearDown(::benchmark::State& st)
   {
+    st.counters["peak_memory_bytes"] = static_cast<double>(stats_mr->peak_bytes());
+    st.counters["num_allocations"]   = static_cast<double>(stats_mr->num_allocations());
     TearDown(const_cast<const ::benchmark::State&>(st));
   }
 
   std::shared_ptr<rmm::mr::device_memory_resource> mr;
+  std::unique_ptr<metrics_resource_adaptor> stats_mr;  ///< Tracks the allocations from `mr`
 };
 
 }  // namespace cudf
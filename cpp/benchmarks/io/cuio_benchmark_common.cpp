@@ -16,6 +16,7 @@
 
 #include <benchmarks/io/cuio_benchmark_common.hpp>
 
+#include <fstream>
 #include <numeric>
 #include <string>
 
@@ -60,6 +61,18 @@ cudf_io::sink_info cuio_source_sink_pair::make_sink_info()
   }
 }
 
+size_t cuio_source_sink_pair::size()
+{
+  switch (type) {
+    case io_type::FILEPATH: {
+      std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+      return static_cast<size_t>(file.tellg());
+    }
+    case io_type::HOST_BUFFER: return buffer.size();
+    default: CUDF_FAIL("invalid output type");
+  }
+}
+
 std::vector<cudf::type_id> dtypes_for_column_selection(std::vector<cudf::type_id> const& data_types,
                                                        column_selection col_sel)
 {
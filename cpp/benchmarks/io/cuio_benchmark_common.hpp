@@ -64,6 +64,13 @@ class cuio_source_sink_pair {
    */
   cudf::io::sink_info make_sink_info();
 
+  /**
+   * @brief Returns the size of the data written to the sink.
+   *
+   * Only valid for the file and host buffer types.
+   */
+  size_t size();
+
  private:
   static temp_directory const tmpdir;
 
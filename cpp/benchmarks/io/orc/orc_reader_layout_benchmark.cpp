@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/io/orc.hpp>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+// the file inputs are read through cuFile when run with LIBCUDF_CUFILE_POLICY=GDS
+
+constexpr size_t data_size            = 256 << 20;
+constexpr cudf::size_type num_cols    = 16;
+constexpr cudf::size_type num_stripes = 8;
+
+namespace cudf_io = cudf::io;
+
+class OrcReadLayout : public cudf::benchmark {
+};
+
+/**
+ * @brief Benchmarks the read of a subset of the columns and stripes of a file, for a given column
+ * type, cardinality and compression.
+ *
+ * The writer picks the dictionary encoding for the columns of low cardinality. The throughput is
+ * reported against the size of the file, and the size of the file is reported as the
+ * `encoded_file_size` counter.
+ */
+void BM_orc_read_layout(benchmark::State& state)
+{
+  auto const data_types             = get_type_or_group(state.range(0));
+  cudf::size_type const cardinality = state.range(1);
+  auto const compression            = static_cast<cudf_io::compression_type>(state.range(2));
+  auto const cols_to_read_pct       = state.range(3);
+  auto const stripes_to_read_pct    = state.range(4);
+  auto const source_type            = static_cast<io_type>(state.range(5));
+
+  data_profile table_data_profile;
+  table_data_profile.set_cardinality(cardinality);
+  auto const tbl =
+    create_random_table(data_types, num_cols, table_size_bytes{data_size}, table_data_profile);
+  auto const view = tbl->view();
+
+  cudf_io::table_metadata_with_nullability metadata;
+  for (cudf::size_type c = 0; c < num_cols; ++c) {
+    metadata.column_names.push_back("col" + std::to_string(c));
+    metadata.column_nullable.push_back(view.column(c).nullable());
+  }
+
+  // Each write of the chunked writer is written as one stripe
+  cuio_source_sink_pair source_sink(source_type);
+  {
+    cudf_io::chunked_orc_writer_options write_opts =
+      cudf_io::chunked_orc_writer_options::builder(source_sink.make_sink_info())
+        .metadata(&metadata)
+        .compression(compression);
+    cudf_io::orc_chunked_writer writer(write_opts);
+    auto const rows_per_stripe = cudf::util::div_rounding_up_safe(view.num_rows(), num_stripes);
+    for (cudf::size_type s = 0; s < num_stripes; ++s) {
+      auto const begin = std::min(s * rows_per_stripe, view.num_rows());
+      auto const end   = std::min(begin + rows_per_stripe, view.num_rows());
+      writer.write(cudf::slice(view, {begin, end})[0]);
+    }
+    writer.close();
+  }
+  auto const file_size = source_sink.size();
+
+  std::vector<cudf::size_type> stripes(num_stripes * stripes_to_read_pct / 100);
+  std::iota(stripes.begin(), stripes.end(), 0);
+  auto const& col_names = metadata.column_names;
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(source_sink.make_source_info())
+      .columns({col_names.begin(), col_names.begin() + num_cols * cols_to_read_pct / 100})
+      .stripes(stripes);
+
+  for (auto _ : state) {
+    cuda_event_timer const raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_orc(read_opts);
+  }
+
+  state.SetBytesProcessed(file_size * state.iterations());
+  state.counters["encoded_file_size"] = file_size;
+}
+
+#define ORC_RD_BM_LAYOUT_DEFINE(name, type_or_group, src_type)        \
+  BENCHMARK_DEFINE_F(OrcReadLayout, name)                             \
+  (::benchmark::State & state) { BM_orc_read_layout(state); }         \
+  BENCHMARK_REGISTER_F(OrcReadLayout, name)                           \
+    ->ArgsProduct({{int32_t(type_or_group)},                          \
+                   {0, 1000},                                         \
+                   {int32_t(cudf_io::compression_type::NONE),         \
+                    int32_t(cudf_io::compression_type::SNAPPY),       \
+                    int32_t(cudf_io::compression_type::LZ4)},         \
+                   {25, 100},                                         \
+                   {25, 100},                                         \
+                   {src_type}})                                       \
+    ->Unit(benchmark::kMillisecond)                                   \
+    ->UseManualTime();
+
+RD_BENCHMARK_DEFINE_ALL_SOURCES(ORC_RD_BM_LAYOUT_DEFINE, integral, type_group_id::INTEGRAL);
+RD_BENCHMARK_DEFINE_ALL_SOURCES(ORC_RD_BM_LAYOUT_DEFINE, floats, type_group_id::FLOATING_POINT);
+RD_BENCHMARK_DEFINE_ALL_SOURCES(ORC_RD_BM_LAYOUT_DEFINE, strings, cudf::type_id::STRING);
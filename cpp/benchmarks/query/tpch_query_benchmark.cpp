@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/ast/transform.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/metrics.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::io;
+
+class Query : public cudf::benchmark {
+};
+
+namespace {
+// Dates are stored as days since 1992-01-01; TPC-H dates span seven years
+constexpr int32_t max_date = 7 * 365;
+
+/**
+ * @brief Generates a column of `num_rows` values uniformly distributed in [`lower`, `upper`].
+ */
+template <typename T>
+std::unique_ptr<cudf::column> make_uniform_column(cudf::size_type num_rows,
+                                                  T lower,
+                                                  T upper,
+                                                  unsigned seed)
+{
+  auto const type = cudf::type_to_id<T>();
+  data_profile profile;
+  profile.set_distribution_params(type, distribution_id::UNIFORM, lower, upper);
+  profile.set_null_frequency(0);
+  profile.set_cardinality(0);
+  profile.set_avg_run_length(1);
+  auto const table = create_random_table({type}, 1, row_count{num_rows}, profile, seed);
+  return std::move(table->release()[0]);
+}
+
+/**
+ * @brief Generates the `lineitem` table: orderkey, quantity, extendedprice, discount, shipdate.
+ *
+ * The order keys reference the `orders` table generated by `make_orders`.
+ */
+std::unique_ptr<cudf::table> make_lineitem(cudf::size_type num_rows, cudf::size_type num_orders)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 0, num_orders - 1, 1));
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 1, 50, 2));
+  columns.push_back(make_uniform_column<double>(num_rows, 900., 105000., 3));
+  columns.push_back(make_uniform_column<double>(num_rows, 0., 0.1, 4));
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 0, max_date, 5));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+/**
+ * @brief Generates the `orders` table: orderkey, orderdate, shippriority.
+ */
+std::unique_ptr<cudf::table> make_orders(cudf::size_type num_rows)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(cudf::sequence(num_rows, cudf::numeric_scalar<int32_t>(0)));
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 0, max_date, 6));
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 0, 4, 7));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+std::vector<char> write_to_buffer(cudf::table_view const& table)
+{
+  std::vector<char> buffer;
+  cudf_io::parquet_writer_options opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&buffer}, table);
+  cudf_io::write_parquet(opts);
+  return buffer;
+}
+
+std::unique_ptr<cudf::table> read_from_buffer(std::vector<char> const& buffer)
+{
+  cudf_io::parquet_reader_options opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{buffer.data(), buffer.size()});
+  return cudf_io::read_parquet(opts).tbl;
+}
+
+/**
+ * @brief Returns the rows of `table` for which `predicate` is true.
+ */
+std::unique_ptr<cudf::table> filter(cudf::table_view const& table,
+                                    cudf::ast::expression const& predicate)
+{
+  auto const mask = cudf::ast::compute_column(table, predicate);
+  return cudf::apply_boolean_mask(table, mask->view());
+}
+
+/**
+ * @brief Sums `values` grouped by `keys`, and returns the keys and the sums sorted by descending
+ * sum.
+ */
+std::unique_ptr<cudf::table> sum_sorted_by_sum(cudf::table_view const& keys,
+                                               cudf::column_view const& values)
+{
+  cudf::groupby::groupby gb(keys);
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  auto result = gb.aggregate(requests);
+
+  auto columns = result.first->release();
+  columns.push_back(std::move(result.second[0].results[0]));
+  auto const grouped = cudf::table(std::move(columns));
+  auto const sums    = grouped.view().select({grouped.num_columns() - 1});
+  return cudf::sort_by_key(grouped.view(), sums, {cudf::order::DESCENDING});
+}
+
+/**
+ * @brief Runs a query similar to TPC-H Q3: the 10 orders of largest revenue of the lineitems
+ * shipped after a date, for the orders placed before that date.
+ *
+ * scan lineitem, orders -> filter both -> join on orderkey -> revenue = price * (1 - discount)
+ * -> group by orderkey, orderdate, shippriority -> sort by revenue -> limit 10
+ */
+std::unique_ptr<cudf::table> run_q3(cudf::table_view const& lineitem,
+                                    cudf::table_view const& orders)
+{
+  auto date_value = cudf::numeric_scalar<int32_t>(max_date / 2);
+  auto one_value  = cudf::numeric_scalar<double>(1.);
+  auto const date = cudf::ast::literal(date_value);
+  auto const one  = cudf::ast::literal(one_value);
+
+  using cudf::ast::ast_operator;
+  auto const l_shipdate  = cudf::ast::column_reference(4);
+  auto const shipped     = cudf::ast::expression(ast_operator::GREATER, l_shipdate, date);
+  auto const o_orderdate = cudf::ast::column_reference(1);
+  auto const ordered     = cudf::ast::expression(ast_operator::LESS, o_orderdate, date);
+  auto const filtered_lineitem = filter(lineitem, shipped);
+  auto const filtered_orders   = filter(orders, ordered);
+
+  // lineitem columns, followed by the orders columns
+  auto const joined =
+    cudf::inner_join(filtered_lineitem->view(), filtered_orders->view(), {0}, {0});
+
+  auto const price        = cudf::ast::column_reference(2);
+  auto const discount     = cudf::ast::column_reference(3);
+  auto const net_ratio    = cudf::ast::expression(ast_operator::SUB, one, discount);
+  auto const revenue_expr = cudf::ast::expression(ast_operator::MUL, price, net_ratio);
+  auto const revenue      = cudf::ast::compute_column(joined->view(), revenue_expr);
+
+  auto const sorted = sum_sorted_by_sum(joined->view().select({0, 6, 7}), revenue->view());
+  auto const limit  = std::min(sorted->num_rows(), 10);
+  return std::make_unique<cudf::table>(cudf::slice(sorted->view(), {0, limit})[0]);
+}
+
+/**
+ * @brief Runs a query similar to TPC-H Q1: the total price of the lineitems shipped before a date,
+ * by quantity, sorted by total price.
+ *
+ * scan lineitem -> filter -> group by quantity -> sort by price
+ */
+std::unique_ptr<cudf::table> run_q1(cudf::table_view const& lineitem)
+{
+  auto date_value = cudf::numeric_scalar<int32_t>(max_date - 90);
+  auto const date = cudf::ast::literal(date_value);
+
+  auto const l_shipdate = cudf::ast::column_reference(4);
+  auto const shipped =
+    cudf::ast::expression(cudf::ast::ast_operator::LESS_EQUAL, l_shipdate, date);
+  auto const filtered = filter(lineitem, shipped);
+  return sum_sorted_by_sum(filtered->view().select({1}), filtered->view().column(2));
+}
+
+enum class query_id : int32_t { Q1, Q3 };
+}  // namespace
+
+/**
+ * @brief Runs a whole query per iteration, and reports its throughput in input rows and bytes,
+ * and the largest peak of the device memory allocated by a single iteration.
+ *
+ * With `scan` set, the tables are read from Parquet files in host memory by every iteration.
+ */
+void BM_query(benchmark::State& state, cudf::metrics_resource_adaptor& tracking_mr)
+{
+  auto const query                   = static_cast<query_id>(state.range(0));
+  cudf::size_type const num_lineitem = state.range(1);
+  bool const scan                    = state.range(2) != 0;
+  auto const num_orders              = std::max(num_lineitem / 4, 1);
+
+  auto const lineitem      = make_lineitem(num_lineitem, num_orders);
+  auto const orders        = make_orders(num_orders);
+  auto const lineitem_file = scan ? write_to_buffer(lineitem->view()) : std::vector<char>{};
+  auto const orders_file   = scan ? write_to_buffer(orders->view()) : std::vector<char>{};
+
+  std::size_t peak_memory = 0;
+  for (auto _ : state) {
+    // the peak restarts at each iteration, and is restored for the peak of the whole benchmark
+    auto const allocated_at_start = tracking_mr.allocated_bytes();
+    auto const previous_peak      = tracking_mr.reset_peak(allocated_at_start);
+    {
+      cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+
+      auto const scanned_lineitem = scan ? read_from_buffer(lineitem_file) : nullptr;
+      auto const scanned_orders =
+        scan and query == query_id::Q3 ? read_from_buffer(orders_file) : nullptr;
+      auto const lineitem_view = scan ? scanned_lineitem->view() : lineitem->view();
+      auto const orders_view   = scanned_orders ? scanned_orders->view() : orders->view();
+
+      auto const result =
+        query == query_id::Q3 ? run_q3(lineitem_view, orders_view) : run_q1(lineitem_view);
+    }
+    peak_memory = std::max(peak_memory, tracking_mr.peak_bytes() - allocated_at_start);
+    tracking_mr.update_peak(previous_peak);
+  }
+
+  auto const is_q3          = query == query_id::Q3;
+  int64_t const input_rows  = num_lineitem + (is_q3 ? num_orders : 0);
+  int64_t const input_bytes = num_lineitem * (3 * sizeof(int32_t) + 2 * sizeof(double)) +
+                              (is_q3 ? num_orders * 3 * sizeof(int32_t) : 0);
+  state.SetItemsProcessed(state.iterations() * input_rows);
+  state.SetBytesProcessed(state.iterations() * input_bytes);
+  state.counters["iteration_peak_memory_bytes"] = static_cast<double>(peak_memory);
+}
+
+#define QUERY_BENCHMARK_DEFINE(name, query)                                \
+  BENCHMARK_DEFINE_F(Query, name)                                          \
+  (::benchmark::State & state) { BM_query(state, *stats_mr); }             \
+  BENCHMARK_REGISTER_F(Query, name)                                        \
+    ->ArgsProduct({{int32_t(query)}, {1'000'000, 10'000'000}, {0, 1}})     \
+    ->Unit(benchmark::kMillisecond)                                        \
+    ->UseManualTime();
+
+QUERY_BENCHMARK_DEFINE(tpch_q1, query_id::Q1)
+QUERY_BENCHMARK_DEFINE(tpch_q3, query_id::Q3)
@@ -79,7 +79,18 @@ class aggregation {
     LEAD,            ///< window function, accesses row at specified offset following current row
     LAG,             ///< window function, accesses row at specified offset preceding current row
     PTX,             ///< PTX  UDF based reduction
-    CUDA             ///< CUDA UDF based reduction
+    CUDA,            ///< CUDA UDF based reduction
+    M2,              ///< sum of squared differences from the mean
+    MERGE_M2,        ///< merge partial results of count, mean and M2
+    APPROX_NUNIQUE,  ///< estimate the number of unique elements
+    TDIGEST,         ///< create a t-digest of the values
+    MERGE_TDIGEST,   ///< merge t-digests
+    TOP_K,           ///< collect the k largest or smallest values into a list
+    RANK,            ///< rank of the value within its group, with gaps after ties
+    DENSE_RANK,      ///< rank of the value within its group, without gaps after ties
+    PERCENT_RANK,    ///< relative rank of the value within its group, in [0, 1]
+    NUNIQUE_SKETCH,  ///< create a HyperLogLog sketch of the unique elements
+    MERGE_NUNIQUE    ///< estimate the number of unique elements from merged sketches
   };
 
   aggregation(aggregation::Kind a) : kind{a} {}
@@ -151,6 +162,25 @@ std::unique_ptr<aggregation> make_variance_aggregation(size_type ddof = 1);
  */
 std::unique_ptr<aggregation> make_std_aggregation(size_type ddof = 1);
 
+/**
+ * @brief Factory to create a M2 aggregation
+ *
+ * `M2` computes the sum of squared differences from the mean of the valid values. Together with
+ * the COUNT_VALID and MEAN of the same values, it is the partial result of a variance that can
+ * be merged with others by a MERGE_M2 aggregation, e.g. for a distributed groupby.
+ */
+std::unique_ptr<aggregation> make_m2_aggregation();
+
+/**
+ * @brief Factory to create a MERGE_M2 aggregation
+ *
+ * `MERGE_M2` merges partial results of variances. Its values are a structs column whose three
+ * children are the INT32 COUNT_VALID, FLOAT64 MEAN and FLOAT64 M2 of subsets of the values of
+ * every group. The result is a structs column of the same layout, holding the count, mean and M2
+ * of all the values of every group, from which the variance is `M2 / (count - ddof)`.
+ */
+std::unique_ptr<aggregation> make_merge_m2_aggregation();
+
 /// Factory to create a MEDIAN aggregation
 std::unique_ptr<aggregation> make_median_aggregation();
 
@@ -163,6 +193,35 @@ std::unique_ptr<aggregation> make_median_aggregation();
 std::unique_ptr<aggregation> make_quantile_aggregation(std::vector<double> const& q,
                                                        interpolation i = interpolation::LINEAR);
 
+/**
+ * @brief Factory to create a TDIGEST aggregation
+ *
+ * `TDIGEST` summarizes the valid numeric values of every group in a t-digest, a compact sketch of
+ * their distribution from which `cudf::percentile_approx` estimates percentiles without sorting
+ * all the values again. Digests of subsets of the values can be merged with a MERGE_TDIGEST
+ * aggregation, e.g. for a distributed groupby.
+ *
+ * A digest is a list of centroids, each a struct of a FLOAT64 `mean` and a FLOAT64 `weight`, the
+ * number of values it summarizes, ordered by mean. The first and last centroids of a non-empty
+ * digest hold the minimum and maximum values only. The centroids near the tails are smaller than
+ * the ones near the median so that extreme percentiles are more accurate.
+ *
+ * @param max_centroids The maximum number of centroids of a digest, at least 3, trading memory
+ * for accuracy
+ */
+std::unique_ptr<aggregation> make_tdigest_aggregation(int max_centroids = 1000);
+
+/**
+ * @brief Factory to create a MERGE_TDIGEST aggregation
+ *
+ * `MERGE_TDIGEST` merges the t-digests of a column of digests created by TDIGEST or
+ * MERGE_TDIGEST aggregations into a digest of the same layout for every group. Null digests are
+ * ignored.
+ *
+ * @param max_centroids The maximum number of centroids of a merged digest
+ */
+std::unique_ptr<aggregation> make_merge_tdigest_aggregation(int max_centroids = 1000);
+
 /**
  * @brief Factory to create an `argmax` aggregation
  *
@@ -186,6 +245,46 @@ std::unique_ptr<aggregation> make_argmin_aggregation();
 std::unique_ptr<aggregation> make_nunique_aggregation(
   null_policy null_handling = null_policy::EXCLUDE);
 
+/**
+ * @brief Factory to create an `approx_nunique` aggregation
+ *
+ * `approx_nunique` estimates the number of unique elements with a HyperLogLog sketch, without
+ * sorting the elements or inserting them in a hash set. The sketch of every group holds
+ * `2^precision` bytes, and the relative standard error of the estimate is about
+ * `1.04 / sqrt(2^precision)`, e.g. 1.6% for the default precision of 12.
+ *
+ * @param null_handling Indicates if null values will be counted.
+ * @param precision The number of bits of the hash of an element that index the sketch, in
+ * `[4, 18]`
+ */
+std::unique_ptr<aggregation> make_approx_nunique_aggregation(
+  null_policy null_handling = null_policy::EXCLUDE, int32_t precision = 12);
+
+/**
+ * @brief Factory to create a NUNIQUE_SKETCH aggregation
+ *
+ * `NUNIQUE_SKETCH` builds the HyperLogLog sketch from which `approx_nunique` estimates the number
+ * of unique elements of every group: a list of `2^precision` UINT8 registers. Unlike the
+ * estimates, the sketches of subsets of the elements can be merged with a MERGE_NUNIQUE
+ * aggregation, e.g. for a distributed groupby.
+ *
+ * @param null_handling Indicates if null values will be counted.
+ * @param precision The number of bits of the hash of an element that index the sketch, in
+ * `[4, 18]`
+ */
+std::unique_ptr<aggregation> make_nunique_sketch_aggregation(
+  null_policy null_handling = null_policy::EXCLUDE, int32_t precision = 12);
+
+/**
+ * @brief Factory to create a MERGE_NUNIQUE aggregation
+ *
+ * `MERGE_NUNIQUE` merges the sketches of a column of sketches created by NUNIQUE_SKETCH
+ * aggregations, by the elementwise maximum of their registers, and returns the INT64 estimate of
+ * the number of unique elements of every group from the merged sketch. The sketches must all have
+ * the same precision. Null sketches are ignored.
+ */
+std::unique_ptr<aggregation> make_merge_nunique_aggregation();
+
 /**
  * @brief Factory to create a `nth_element` aggregation
  *
@@ -205,6 +304,46 @@ std::unique_ptr<aggregation> make_nth_element_aggregation(
 /// Factory to create a ROW_NUMBER aggregation
 std::unique_ptr<aggregation> make_row_number_aggregation();
 
+/**
+ * @brief Factory to create a RANK aggregation
+ *
+ * `RANK` is a groupby scan returning the 1-based rank of every row within its group, where equal
+ * rows share the rank of the first of them and the next distinct row is ranked by its position,
+ * as the SQL window function `RANK()`:
+ * @code{.pseudo}
+ * values of a group: {3, 5, 5, 6, 6, 6, 9}
+ * RANK:              {1, 2, 2, 4, 4, 4, 7}
+ * DENSE_RANK:        {1, 2, 2, 3, 3, 3, 4}
+ * PERCENT_RANK:      {0, 1/6, 1/6, 1/2, 1/2, 1/2, 1}
+ * @endcode
+ *
+ * The values of every group must be sorted, e.g. by sorting the table on the keys and then on the
+ * values and passing `sorted::YES` to the groupby: the ranks are computed in one pass over the
+ * groups, without sorting the values. Nulls are equal to each other.
+ */
+std::unique_ptr<aggregation> make_rank_aggregation();
+
+/**
+ * @brief Factory to create a DENSE_RANK aggregation
+ *
+ * `DENSE_RANK` is the groupby scan of `RANK` where every distinct value of a group is ranked
+ * after the previous one, without gaps after ties, as the SQL window function `DENSE_RANK()`.
+ *
+ * The values of every group must be sorted, as for `make_rank_aggregation()`.
+ */
+std::unique_ptr<aggregation> make_dense_rank_aggregation();
+
+/**
+ * @brief Factory to create a PERCENT_RANK aggregation
+ *
+ * `PERCENT_RANK` is the groupby scan returning `(rank - 1) / (group_size - 1)` as a double for
+ * every row, where `rank` is the result of `RANK`, or 0 for groups of a single row, as the SQL
+ * window function `PERCENT_RANK()`.
+ *
+ * The values of every group must be sorted, as for `make_rank_aggregation()`.
+ */
+std::unique_ptr<aggregation> make_percent_rank_aggregation();
+
 /**
  * @brief Factory to create a COLLECT_LIST aggregation
  *
@@ -218,6 +357,21 @@ std::unique_ptr<aggregation> make_row_number_aggregation();
 std::unique_ptr<aggregation> make_collect_list_aggregation(
   null_policy null_handling = null_policy::INCLUDE);
 
+/**
+ * @brief Factory to create a TOP_K aggregation
+ *
+ * `TOP_K` returns a list column of the `k` largest valid elements of every group, from the
+ * largest, or of the `k` smallest ones, from the smallest, for `order::ASCENDING`. Groups of
+ * fewer than `k` valid elements return all of them. Equal elements are selected in the order of
+ * their rows. Only candidates of every group are sorted, not all of its elements.
+ *
+ * @param k The number of elements to select from every group
+ * @param column_order `order::DESCENDING` for the largest elements, `order::ASCENDING` for the
+ * smallest
+ */
+std::unique_ptr<aggregation> make_top_k_aggregation(size_type k,
+                                                    order column_order = order::DESCENDING);
+
 /**
  * @brief Factory to create a COLLECT_SET aggregation
  *
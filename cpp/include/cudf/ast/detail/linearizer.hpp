@@ -22,6 +22,10 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
 namespace cudf {
 namespace ast {
 
@@ -69,8 +73,8 @@ struct alignas(8) device_data_reference {
 
   inline bool operator==(const device_data_reference& rhs) const
   {
-    return std::tie(data_index, reference_type, table_source) ==
-           std::tie(rhs.data_index, rhs.reference_type, rhs.table_source);
+    return std::tie(data_index, data_type, reference_type, table_source) ==
+           std::tie(rhs.data_index, rhs.data_type, rhs.reference_type, rhs.table_source);
   }
 };
 
@@ -100,6 +104,9 @@ class node {
  * the nodes and constructing vectors of information that are later used by the device for
  * evaluating the abstract syntax tree as a "linear" list of operators whose input dependencies are
  * resolved into intermediate data storage in shared memory.
+ *
+ * A node referenced several times, by several expressions or several times in one expression, is
+ * evaluated once: its result is kept in its intermediate storage location until its last use.
  */
 class linearizer {
   friend class literal;
@@ -113,9 +120,32 @@ class linearizer {
    * @param table The table used for evaluating the abstract syntax tree.
    */
   linearizer(detail::node const& expr, cudf::table_view table)
-    : _table(table), _node_count(0), _intermediate_counter()
+    : _table(table), _right_table(table), _node_count(0), _intermediate_counter()
   {
-    expr.accept(*this);
+    linearize({expr});
+  }
+
+  /**
+   * @brief Construct a new linearizer object for several expressions evaluated together
+   *
+   * The result of the expression `i` is stored in the output column `i`.
+   *
+   * @param exprs The roots of the abstract syntax trees.
+   * @param table The table used for evaluating the abstract syntax trees.
+   */
+  linearizer(std::vector<std::reference_wrapper<expression const>> const& exprs,
+             cudf::table_view table);
+
+  /**
+   * @brief Construct a new linearizer object for an expression over two tables
+   *
+   * @param left The left table used for evaluating the abstract syntax tree.
+   * @param right The right table used for evaluating the abstract syntax tree.
+   */
+  linearizer(detail::node const& expr, cudf::table_view left, cudf::table_view right)
+    : _table(left), _right_table(right), _node_count(0), _intermediate_counter()
+  {
+    linearize({expr});
   }
 
   /**
@@ -125,6 +155,14 @@ class linearizer {
    */
   cudf::data_type root_data_type() const;
 
+  /**
+   * @brief Get the data types of the roots of the abstract syntax trees, in the order of their
+   * output columns.
+   *
+   * @return std::vector<cudf::data_type>
+   */
+  std::vector<cudf::data_type> const& root_data_types() const { return _root_data_types; }
+
   /**
    * @brief Get the maximum number of intermediates stored by the abstract syntax tree.
    *
@@ -219,14 +257,21 @@ class linearizer {
   };
 
  private:
+  void linearize(std::vector<std::reference_wrapper<const node>> const& roots);
   std::vector<cudf::size_type> visit_operands(
     std::vector<std::reference_wrapper<const node>> operands);
   cudf::size_type add_data_reference(detail::device_data_reference data_ref);
+  void release_operand(node const& operand, cudf::size_type data_reference_index);
 
   // State information about the "linearized" GPU execution plan
   cudf::table_view _table;
+  cudf::table_view _right_table;
   cudf::size_type _node_count;
+  cudf::size_type _output_index{0};
   intermediate_counter _intermediate_counter;
+  std::unordered_map<node const*, cudf::size_type> _remaining_uses;
+  std::unordered_map<node const*, cudf::size_type> _visited_expressions;
+  std::vector<cudf::data_type> _root_data_types;
   std::vector<detail::device_data_reference> _data_references;
   std::vector<ast_operator> _operators;
   std::vector<cudf::size_type> _operator_source_indices;
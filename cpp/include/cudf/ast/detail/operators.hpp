@@ -114,6 +114,12 @@ CUDA_HOST_DEVICE_CALLABLE constexpr void ast_operator_dispatcher(ast_operator op
     case ast_operator::LOGICAL_OR:
       f.template operator()<ast_operator::LOGICAL_OR>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::NULL_LOGICAL_AND:
+      f.template operator()<ast_operator::NULL_LOGICAL_AND>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::NULL_LOGICAL_OR:
+      f.template operator()<ast_operator::NULL_LOGICAL_OR>(std::forward<Ts>(args)...);
+      break;
     case ast_operator::IDENTITY:
       f.template operator()<ast_operator::IDENTITY>(std::forward<Ts>(args)...);
       break;
@@ -183,6 +189,9 @@ CUDA_HOST_DEVICE_CALLABLE constexpr void ast_operator_dispatcher(ast_operator op
     case ast_operator::NOT:
       f.template operator()<ast_operator::NOT>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::IS_NULL:
+      f.template operator()<ast_operator::IS_NULL>(std::forward<Ts>(args)...);
+      break;
     default:
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Invalid operator.");
@@ -493,6 +502,40 @@ struct operator_functor<ast_operator::LOGICAL_OR> {
   }
 };
 
+/**
+ * @brief Kleene AND of two operands.
+ *
+ * This is the value of the operation for valid operands. The `row_evaluator` combines the
+ * validity of the operands itself.
+ */
+template <>
+struct operator_functor<ast_operator::NULL_LOGICAL_AND> {
+  static constexpr auto arity{2};
+
+  template <typename LHS, typename RHS>
+  CUDA_DEVICE_CALLABLE auto operator()(LHS lhs, RHS rhs) -> decltype(lhs && rhs)
+  {
+    return lhs && rhs;
+  }
+};
+
+/**
+ * @brief Kleene OR of two operands.
+ *
+ * This is the value of the operation for valid operands. The `row_evaluator` combines the
+ * validity of the operands itself.
+ */
+template <>
+struct operator_functor<ast_operator::NULL_LOGICAL_OR> {
+  static constexpr auto arity{2};
+
+  template <typename LHS, typename RHS>
+  CUDA_DEVICE_CALLABLE auto operator()(LHS lhs, RHS rhs) -> decltype(lhs || rhs)
+  {
+    return lhs || rhs;
+  }
+};
+
 template <>
 struct operator_functor<ast_operator::IDENTITY> {
   static constexpr auto arity{1};
@@ -753,6 +796,23 @@ struct operator_functor<ast_operator::NOT> {
   }
 };
 
+/**
+ * @brief Null check of an operand.
+ *
+ * This is the value of the operation for a valid operand. The `row_evaluator` returns true for
+ * a null operand instead.
+ */
+template <>
+struct operator_functor<ast_operator::IS_NULL> {
+  static constexpr auto arity{1};
+
+  template <typename InputT>
+  CUDA_DEVICE_CALLABLE bool operator()(InputT input)
+  {
+    return false;
+  }
+};
+
 #if 0
 /**
  * @brief Functor used to double-type-dispatch binary operators.
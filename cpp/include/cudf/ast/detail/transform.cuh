@@ -18,6 +18,7 @@
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/linearizer.hpp>
 #include <cudf/ast/operators.hpp>
+#include <cudf/ast/transform.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/utilities/assert.cuh>
@@ -52,21 +53,26 @@ struct row_output {
    * types. Intermediates must be of fixed width less than or equal to sizeof(std::int64_t). This
    * requirement on intermediates is enforced by the linearizer.
    *
+   * The validity is only assigned if the evaluator tracks nulls.
+   *
    * @tparam Element Type of result element.
    * @param device_data_reference Data reference to resolve.
    * @param row_index Row index of data column.
    * @param result Value to assign to output.
+   * @param valid Validity to assign to output.
    */
   template <typename Element, CUDF_ENABLE_IF(is_rep_layout_compatible<Element>())>
   __device__ void resolve_output(detail::device_data_reference device_data_reference,
                                  cudf::size_type row_index,
-                                 Element result) const;
+                                 Element result,
+                                 bool valid) const;
   // Definition below after row_evaluator is a complete type
 
   template <typename Element, CUDF_ENABLE_IF(not is_rep_layout_compatible<Element>())>
   __device__ void resolve_output(detail::device_data_reference device_data_reference,
                                  cudf::size_type row_index,
-                                 Element result) const
+                                 Element result,
+                                 bool valid) const
   {
     cudf_assert(false && "Invalid type in resolve_output.");
   }
@@ -84,11 +90,16 @@ struct unary_row_output : public row_output {
     std::enable_if_t<detail::is_valid_unary_op<detail::operator_functor<op>, Input>>* = nullptr>
   __device__ void operator()(cudf::size_type row_index,
                              Input input,
+                             bool input_valid,
                              detail::device_data_reference output) const
   {
     using OperatorFunctor = detail::operator_functor<op>;
     using Out             = cuda::std::invoke_result_t<OperatorFunctor, Input>;
-    resolve_output<Out>(output, row_index, OperatorFunctor{}(input));
+    if constexpr (op == ast_operator::IS_NULL) {
+      resolve_output<Out>(output, row_index, !input_valid, true);
+    } else {
+      resolve_output<Out>(output, row_index, OperatorFunctor{}(input), input_valid);
+    }
   }
 
   template <
@@ -96,6 +107,7 @@ struct unary_row_output : public row_output {
     std::enable_if_t<!detail::is_valid_unary_op<detail::operator_functor<op>, Input>>* = nullptr>
   __device__ void operator()(cudf::size_type row_index,
                              Input input,
+                             bool input_valid,
                              detail::device_data_reference output) const
   {
     cudf_assert(false && "Invalid unary dispatch operator for the provided input.");
@@ -112,11 +124,25 @@ struct binary_row_output : public row_output {
   __device__ void operator()(cudf::size_type row_index,
                              LHS lhs,
                              RHS rhs,
+                             bool lhs_valid,
+                             bool rhs_valid,
                              detail::device_data_reference output) const
   {
     using OperatorFunctor = detail::operator_functor<op>;
     using Out             = cuda::std::invoke_result_t<OperatorFunctor, LHS, RHS>;
-    resolve_output<Out>(output, row_index, OperatorFunctor{}(lhs, rhs));
+    if constexpr (op == ast_operator::NULL_LOGICAL_AND || op == ast_operator::NULL_LOGICAL_OR) {
+      // A valid false operand decides the result of AND and a valid true operand that of OR,
+      // otherwise the result is null if either operand is null
+      auto constexpr deciding_value = op == ast_operator::NULL_LOGICAL_OR;
+      auto const is_decided         = (lhs_valid && static_cast<bool>(lhs) == deciding_value) ||
+                                      (rhs_valid && static_cast<bool>(rhs) == deciding_value);
+      resolve_output<Out>(output,
+                          row_index,
+                          is_decided ? deciding_value : OperatorFunctor{}(lhs, rhs),
+                          is_decided || (lhs_valid && rhs_valid));
+    } else {
+      resolve_output<Out>(output, row_index, OperatorFunctor{}(lhs, rhs), lhs_valid && rhs_valid);
+    }
   }
 
   template <ast_operator op,
@@ -125,6 +151,8 @@ struct binary_row_output : public row_output {
   __device__ void operator()(cudf::size_type row_index,
                              LHS lhs,
                              RHS rhs,
+                             bool lhs_valid,
+                             bool rhs_valid,
                              detail::device_data_reference output) const
   {
     cudf_assert(false && "Invalid binary dispatch operator for the provided input.");
@@ -134,9 +162,20 @@ struct binary_row_output : public row_output {
 /**
  * @brief An expression evaluator owned by a single thread operating on rows of a table.
  *
- * This class is designed for n-ary transform evaluation. Currently this class assumes that there's
- * only one relevant "row index" in its methods, which corresponds to a row in a single input table
- * and the same row index in an output column.
+ * This class is designed for n-ary transform evaluation. The "row index" in its methods
+ * corresponds to a row in the input table and the same row index in the output column.
+ *
+ * An evaluator can also operate on the rows of two tables, e.g. to evaluate a join condition. Then
+ * the row index in its methods corresponds to a row in the left table, column references to the
+ * right table are resolved at a fixed row of the right table, and the result is stored in a single
+ * output value rather than in an output column. The result of the evaluation of a single table can
+ * also be stored in a single output value, e.g. to evaluate a filter predicate.
+ *
+ * An evaluator given storage for the validity of the intermediates tracks nulls: the result of an
+ * operator is null if any operand is null, except for `IS_NULL`, which is never null, and for
+ * `NULL_LOGICAL_AND` and `NULL_LOGICAL_OR`, which follow Kleene logic. The nulls are set in the
+ * null masks of the output columns, which must be initialized to all valid. Otherwise nulls are
+ * ignored, and the values of null elements are used as they are.
  */
 struct row_evaluator {
   friend struct row_output;
@@ -153,16 +192,84 @@ struct row_evaluator {
    * @param literals Array of literal values used for evaluation.
    * @param thread_intermediate_storage Pointer to this thread's portion of shared memory for
    * storing intermediates.
-   * @param output_column The output column where results are stored.
+   * @param output_columns The output columns where results are stored, indexed by the data index
+   * of the output data references.
+   * @param thread_intermediate_validity Pointer to this thread's portion of shared memory for
+   * storing the validity of intermediates, or nullptr if nulls are not tracked.
    */
   __device__ row_evaluator(table_device_view const& table,
                            const cudf::detail::fixed_width_scalar_device_view_base* literals,
                            std::int64_t* thread_intermediate_storage,
-                           mutable_column_device_view* output_column)
+                           mutable_column_device_view* output_columns,
+                           bool* thread_intermediate_validity = nullptr)
     : table(table),
+      right_table(nullptr),
+      right_row_index(0),
       literals(literals),
       thread_intermediate_storage(thread_intermediate_storage),
-      output_column(output_column)
+      thread_intermediate_validity(thread_intermediate_validity),
+      output_columns(output_columns),
+      output_value(nullptr),
+      output_validity(nullptr)
+  {
+  }
+
+  /**
+   * @brief Construct a row evaluator storing the result in a single output value.
+   *
+   * @param table The table device view used for evaluation.
+   * @param literals Array of literal values used for evaluation.
+   * @param thread_intermediate_storage Pointer to this thread's portion of shared memory for
+   * storing intermediates.
+   * @param output_value Storage for the result of the expression.
+   * @param thread_intermediate_validity Pointer to this thread's portion of shared memory for
+   * storing the validity of intermediates, or nullptr if nulls are not tracked.
+   * @param output_validity Storage for the validity of the result if nulls are tracked.
+   */
+  __device__ row_evaluator(table_device_view const& table,
+                           const cudf::detail::fixed_width_scalar_device_view_base* literals,
+                           std::int64_t* thread_intermediate_storage,
+                           std::int64_t* output_value,
+                           bool* thread_intermediate_validity = nullptr,
+                           bool* output_validity              = nullptr)
+    : table(table),
+      right_table(nullptr),
+      right_row_index(0),
+      literals(literals),
+      thread_intermediate_storage(thread_intermediate_storage),
+      thread_intermediate_validity(thread_intermediate_validity),
+      output_columns(nullptr),
+      output_value(output_value),
+      output_validity(output_validity)
+  {
+  }
+
+  /**
+   * @brief Construct a row evaluator operating on the rows of two tables.
+   *
+   * @param left_table The left table device view used for evaluation.
+   * @param right_table The right table device view used for evaluation.
+   * @param right_row_index Row index of the right table at which its columns are resolved.
+   * @param literals Array of literal values used for evaluation.
+   * @param thread_intermediate_storage Pointer to this thread's portion of shared memory for
+   * storing intermediates.
+   * @param output_value Storage for the result of the expression.
+   */
+  __device__ row_evaluator(table_device_view const& left_table,
+                           table_device_view const& right_table,
+                           cudf::size_type right_row_index,
+                           const cudf::detail::fixed_width_scalar_device_view_base* literals,
+                           std::int64_t* thread_intermediate_storage,
+                           std::int64_t* output_value)
+    : table(left_table),
+      right_table(&right_table),
+      right_row_index(right_row_index),
+      literals(literals),
+      thread_intermediate_storage(thread_intermediate_storage),
+      thread_intermediate_validity(nullptr),
+      output_columns(nullptr),
+      output_value(output_value),
+      output_validity(nullptr)
   {
   }
 
@@ -185,6 +292,9 @@ struct row_evaluator {
     auto const data_index = device_data_reference.data_index;
     auto const ref_type   = device_data_reference.reference_type;
     if (ref_type == detail::device_data_reference_type::COLUMN) {
+      if (right_table != nullptr && device_data_reference.table_source == table_reference::RIGHT) {
+        return right_table->column(data_index).element<Element>(right_row_index);
+      }
       return table.column(data_index).element<Element>(row_index);
     } else if (ref_type == detail::device_data_reference_type::LITERAL) {
       return literals[data_index].value<Element>();
@@ -207,6 +317,31 @@ struct row_evaluator {
     return {};
   }
 
+  /**
+   * @brief Resolves the validity of an input data reference.
+   *
+   * @param device_data_reference Data reference to resolve.
+   * @param row_index Row index of data column.
+   * @return true if the input is valid or if nulls are not tracked
+   */
+  __device__ bool resolve_input_validity(detail::device_data_reference device_data_reference,
+                                         cudf::size_type row_index) const
+  {
+    if (thread_intermediate_validity == nullptr) { return true; }
+    auto const data_index = device_data_reference.data_index;
+    auto const ref_type   = device_data_reference.reference_type;
+    if (ref_type == detail::device_data_reference_type::COLUMN) {
+      if (right_table != nullptr && device_data_reference.table_source == table_reference::RIGHT) {
+        return right_table->column(data_index).is_valid(right_row_index);
+      }
+      return table.column(data_index).is_valid(row_index);
+    } else if (ref_type == detail::device_data_reference_type::LITERAL) {
+      return literals[data_index].is_valid();
+    } else {  // Assumes ref_type == detail::device_data_reference_type::INTERMEDIATE
+      return thread_intermediate_validity[data_index];
+    }
+  }
+
   /**
    * @brief Callable to perform a unary operation.
    *
@@ -223,7 +358,9 @@ struct row_evaluator {
                              ast_operator op) const
   {
     auto const typed_input = resolve_input<Input>(input, row_index);
-    ast_operator_dispatcher(op, unary_row_output<Input>(*this), row_index, typed_input, output);
+    auto const input_valid = resolve_input_validity(input, row_index);
+    ast_operator_dispatcher(
+      op, unary_row_output<Input>(*this), row_index, typed_input, input_valid, output);
   }
 
   /**
@@ -246,8 +383,16 @@ struct row_evaluator {
   {
     auto const typed_lhs = resolve_input<LHS>(lhs, row_index);
     auto const typed_rhs = resolve_input<RHS>(rhs, row_index);
-    ast_operator_dispatcher(
-      op, binary_row_output<LHS, RHS>(*this), row_index, typed_lhs, typed_rhs, output);
+    auto const lhs_valid = resolve_input_validity(lhs, row_index);
+    auto const rhs_valid = resolve_input_validity(rhs, row_index);
+    ast_operator_dispatcher(op,
+                            binary_row_output<LHS, RHS>(*this),
+                            row_index,
+                            typed_lhs,
+                            typed_rhs,
+                            lhs_valid,
+                            rhs_valid,
+                            output);
   }
 
   template <typename OperatorFunctor,
@@ -264,25 +409,40 @@ struct row_evaluator {
 
  private:
   table_device_view const& table;
+  table_device_view const* right_table;  // Null if the evaluator operates on a single table
+  cudf::size_type right_row_index;
   const cudf::detail::fixed_width_scalar_device_view_base* literals;
   std::int64_t* thread_intermediate_storage;
-  mutable_column_device_view* output_column;
+  bool* thread_intermediate_validity;  // Null if the evaluator does not track nulls
+  mutable_column_device_view* output_columns;
+  std::int64_t* output_value;  // Used instead of `output_columns` for a single result
+  bool* output_validity;       // The validity of `output_value` if nulls are tracked
 };
 
 template <typename Element, std::enable_if_t<is_rep_layout_compatible<Element>()>*>
 __device__ void row_output::resolve_output(detail::device_data_reference device_data_reference,
                                            cudf::size_type row_index,
-                                           Element result) const
+                                           Element result,
+                                           bool valid) const
 {
-  auto const ref_type = device_data_reference.reference_type;
-  if (ref_type == detail::device_data_reference_type::COLUMN) {
-    evaluator.output_column->element<Element>(row_index) = result;
+  auto const ref_type    = device_data_reference.reference_type;
+  auto const track_nulls = evaluator.thread_intermediate_validity != nullptr;
+  if (ref_type == detail::device_data_reference_type::COLUMN && evaluator.output_value != nullptr) {
+    memcpy(evaluator.output_value, &result, sizeof(Element));
+    if (track_nulls) { *evaluator.output_validity = valid; }
+  } else if (ref_type == detail::device_data_reference_type::COLUMN) {
+    auto& output_column = evaluator.output_columns[device_data_reference.data_index];
+    output_column.element<Element>(row_index) = result;
+    if (track_nulls && !valid) { output_column.set_null(row_index); }
   } else {  // Assumes ref_type == detail::device_data_reference_type::INTERMEDIATE
     // Using memcpy instead of reinterpret_cast<Element*> for safe type aliasing.
     // Using a temporary variable ensures that the compiler knows the result is aligned.
     std::int64_t tmp;
     memcpy(&tmp, &result, sizeof(Element));
     evaluator.thread_intermediate_storage[device_data_reference.data_index] = tmp;
+    if (track_nulls) {
+      evaluator.thread_intermediate_validity[device_data_reference.data_index] = valid;
+    }
   }
 }
 
@@ -390,6 +550,52 @@ std::unique_ptr<column> compute_column(
   expression const& expr,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::ast::compute_column(table_view const, expression const&, evaluation_mode,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream Stream on which to perform the computation.
+ */
+std::unique_ptr<column> compute_column(
+  table_view const table,
+  expression const& expr,
+  evaluation_mode mode,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::ast::compute_columns
+ *
+ * @param stream Stream on which to perform the computation.
+ */
+std::unique_ptr<table> compute_columns(
+  table_view const table,
+  std::vector<std::reference_wrapper<expression const>> const& exprs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::ast::compute_mask
+ *
+ * @param stream Stream on which to perform the computation.
+ */
+std::pair<std::unique_ptr<rmm::device_buffer>, cudf::size_type> compute_mask(
+  table_view const& table,
+  expression const& predicate,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::ast::filter
+ *
+ * @param stream Stream on which to perform the computation.
+ */
+std::unique_ptr<table> filter(
+  table_view const& table,
+  expression const& predicate,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 }  // namespace detail
 
 }  // namespace ast
@@ -90,7 +90,6 @@ class literal : public detail::node {
    */
   cudf::data_type get_data_type() const { return get_value().type(); }
 
- private:
   /**
    * @brief Get the value object.
    *
@@ -98,6 +97,8 @@ class literal : public detail::node {
    */
   cudf::detail::fixed_width_scalar_device_view_base get_value() const { return value; }
 
+ private:
+
   /**
    * @brief Accepts a visitor class.
    *
@@ -24,27 +24,31 @@ namespace ast {
  */
 enum class ast_operator {
   // Binary operators
-  ADD,            ///< operator +
-  SUB,            ///< operator -
-  MUL,            ///< operator *
-  DIV,            ///< operator / using common type of lhs and rhs
-  TRUE_DIV,       ///< operator / after promoting type to floating point
-  FLOOR_DIV,      ///< operator / after promoting to 64 bit floating point and then
-                  ///< flooring the result
-  MOD,            ///< operator %
-  PYMOD,          ///< operator % but following python's sign rules for negatives
-  POW,            ///< lhs ^ rhs
-  EQUAL,          ///< operator ==
-  NOT_EQUAL,      ///< operator !=
-  LESS,           ///< operator <
-  GREATER,        ///< operator >
-  LESS_EQUAL,     ///< operator <=
-  GREATER_EQUAL,  ///< operator >=
-  BITWISE_AND,    ///< operator &
-  BITWISE_OR,     ///< operator |
-  BITWISE_XOR,    ///< operator ^
-  LOGICAL_AND,    ///< operator &&
-  LOGICAL_OR,     ///< operator ||
+  ADD,               ///< operator +
+  SUB,               ///< operator -
+  MUL,               ///< operator *
+  DIV,               ///< operator / using common type of lhs and rhs
+  TRUE_DIV,          ///< operator / after promoting type to floating point
+  FLOOR_DIV,         ///< operator / after promoting to 64 bit floating point and then
+                     ///< flooring the result
+  MOD,               ///< operator %
+  PYMOD,             ///< operator % but following python's sign rules for negatives
+  POW,               ///< lhs ^ rhs
+  EQUAL,             ///< operator ==
+  NOT_EQUAL,         ///< operator !=
+  LESS,              ///< operator <
+  GREATER,           ///< operator >
+  LESS_EQUAL,        ///< operator <=
+  GREATER_EQUAL,     ///< operator >=
+  BITWISE_AND,       ///< operator &
+  BITWISE_OR,        ///< operator |
+  BITWISE_XOR,       ///< operator ^
+  LOGICAL_AND,       ///< operator &&
+  LOGICAL_OR,        ///< operator ||
+  NULL_LOGICAL_AND,  ///< operator && with Kleene logic: null if one operand is null and the
+                     ///< other is not false
+  NULL_LOGICAL_OR,   ///< operator || with Kleene logic: null if one operand is null and the
+                     ///< other is not true
   // Unary operators
   IDENTITY,    ///< Identity function
   SIN,         ///< Trigonometric sine
@@ -68,7 +72,8 @@ enum class ast_operator {
   ABS,         ///< Absolute value
   RINT,        ///< Rounds the floating-point argument arg to an integer value
   BIT_INVERT,  ///< Bitwise Not (~)
-  NOT          ///< Logical Not (!)
+  NOT,         ///< Logical Not (!)
+  IS_NULL      ///< Check if operand is null, the result is never null
 };
 
 }  // namespace ast
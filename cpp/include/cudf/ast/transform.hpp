@@ -16,18 +16,39 @@
 #pragma once
 
 #include <cudf/ast/linearizer.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <rmm/device_buffer.hpp>
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace cudf {
 
 namespace ast {
 
+/**
+ * @brief How an expression tree is evaluated by compute_column.
+ */
+enum class evaluation_mode {
+  INTERPRETED,  ///< Evaluate the linearized expression with a generic interpreter kernel
+  JIT           ///< Evaluate a kernel compiled for the expression when it is available
+};
+
 /**
  * @brief Compute a new column by evaluating an expression tree on a table.
  *
  * This evaluates an expression over a table to produce a new column. Also called an n-ary
  * transform.
  *
+ * Nulls propagate: the result of an operator is null if any of its operands is null. The
+ * exceptions are `IS_NULL`, which is never null, and `NULL_LOGICAL_AND` and `NULL_LOGICAL_OR`,
+ * which follow Kleene logic, so that for example `false NULL_LOGICAL_AND null` is false. The
+ * output column has a null mask only if the table or a literal of the expression has nulls.
+ *
  * @param table The table used for expression evaluation.
  * @param expr The root of the expression tree.
  * @param mr Device memory resource.
@@ -38,6 +59,94 @@ std::unique_ptr<column> compute_column(
   expression const& expr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute a new column by evaluating an expression tree on a table.
+ *
+ * With `evaluation_mode::JIT`, CUDA source is generated from the linearized expression and
+ * compiled through the JIT kernel cache, keyed by the shape and types of the expression. The
+ * compilation runs in the background, and the expression is interpreted until its kernel is
+ * compiled, so only repeated evaluations of an expression use the compiled kernel. Expressions
+ * of types that the generated code does not support, like timestamps, and expressions with null
+ * inputs are always interpreted.
+ *
+ * Both modes produce the same values and nulls.
+ *
+ * @param table The table used for expression evaluation.
+ * @param expr The root of the expression tree.
+ * @param mode How the expression is evaluated.
+ * @param mr Device memory resource.
+ * @return std::unique_ptr<column> Output column.
+ */
+std::unique_ptr<column> compute_column(
+  table_view const table,
+  expression const& expr,
+  evaluation_mode mode,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compute several new columns by evaluating expression trees on a table.
+ *
+ * The expressions are evaluated together in a single pass over the table, and column `i` of the
+ * result is the result of `exprs[i]`, as computed by compute_column. An expression node shared by
+ * several expressions, or used several times in one expression, is only evaluated once per row.
+ * Nodes are shared by referencing the same `expression` object, e.g. the `a * b` node of both
+ * `a * b + c` and `a * b > d`.
+ *
+ * @throw cudf::logic_error if `exprs` is empty.
+ *
+ * @param table The table used for expression evaluation.
+ * @param exprs The roots of the expression trees.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return The table of the output columns.
+ */
+std::unique_ptr<table> compute_columns(
+  table_view const table,
+  std::vector<std::reference_wrapper<expression const>> const& exprs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Evaluates a boolean expression on the rows of a table into a bitmask.
+ *
+ * Bit `i` of the result is set if `predicate` is true for row `i`, and unset if it is false or
+ * null, per the null rules of compute_column. The predicate is evaluated in a single pass that
+ * writes the bitmask directly, so no boolean column is materialized. The bitmask can be given to
+ * the overloads of `cudf::apply_boolean_mask()`, `cudf::copy_if_else()` and
+ * `cudf::boolean_mask_scatter()` that take a bitmask.
+ *
+ * @throw cudf::logic_error if the predicate does not produce BOOL8 values.
+ *
+ * @param table The table to evaluate the predicate on.
+ * @param predicate The root of the expression tree of the predicate.
+ * @param mr Device memory resource used to allocate the returned bitmask.
+ * @return A pair of the bitmask and of the number of its unset bits, as returned by
+ * `cudf::bools_to_mask()`
+ */
+std::pair<std::unique_ptr<rmm::device_buffer>, size_type> compute_mask(
+  table_view const& table,
+  expression const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters a table by a boolean expression evaluated on its rows.
+ *
+ * Returns the rows of `table` for which `predicate` is true, in their order. A row for which the
+ * predicate is null, per the null rules of compute_column, is not returned.
+ *
+ * The predicate is evaluated in a single pass that records the selected rows in a bitmask, as by
+ * compute_mask, and the selected rows are then copied, so no boolean column is materialized.
+ *
+ * @throw cudf::logic_error if the predicate does not produce BOOL8 values.
+ *
+ * @param table The table to evaluate the predicate on and to filter.
+ * @param predicate The root of the expression tree of the predicate.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return The rows of `table` that satisfy the predicate.
+ */
+std::unique_ptr<table> filter(
+  table_view const& table,
+  expression const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace ast
 
 }  // namespace cudf
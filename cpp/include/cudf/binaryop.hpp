@@ -85,6 +85,9 @@ enum class binary_operator : int32_t {
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands
  *
+ * A dictionary column is compared with a scalar of its keys type through its indices, without
+ * decoding it, and only supports the comparison operators.
+ *
  * @param lhs         The left operand scalar
  * @param rhs         The right operand column
  * @param output_type The desired data type of the output column
@@ -110,6 +113,9 @@ std::unique_ptr<column> binary_operation(
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands
  *
+ * A dictionary column is compared with a scalar of its keys type through its indices, without
+ * decoding it, and only supports the comparison operators.
+ *
  * @param lhs         The left operand column
  * @param rhs         The right operand scalar
  * @param output_type The desired data type of the output column
@@ -133,6 +139,9 @@ std::unique_ptr<column> binary_operation(
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands
  *
+ * Dictionary columns are compared through their indices, after matching their keys if they
+ * differ, and only support the comparison operators.
+ *
  * @param lhs         The left operand column
  * @param rhs         The right operand column
  * @param output_type The desired data type of the output column
@@ -149,6 +158,87 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Performs a binary operation between a column and a scalar, writing the results into a
+ * preallocated column.
+ *
+ * The output contains the result of `op(lhs[i], rhs)` for all `0 <= i < lhs.size()`, and the
+ * validity of `binary_operation(lhs, rhs, op, output.type())`. `output` may be `lhs` itself, so
+ * that the operation is applied in place without allocating a column, when the result has the
+ * type of `lhs`. Otherwise it must not overlap `lhs`.
+ *
+ * Only columns of non-`fixed_point` fixed-width types are supported.
+ *
+ * @param lhs         The left operand column
+ * @param rhs         The right operand scalar
+ * @param output      The preallocated column of the result, of the desired data type. The null
+ *                    mask of a nullable `output` is overwritten, and requires an `output` without
+ *                    offset.
+ * @throw cudf::logic_error if @p output is not of the size of @p lhs
+ * @throw cudf::logic_error if the operands or @p output are not of supported types
+ * @throw cudf::logic_error if @p output is not nullable and @p lhs has nulls or @p rhs is invalid
+ * @throw cudf::logic_error if @p output overlaps @p lhs without viewing the same elements, or
+ *                          shares its null mask for a null-dependent operator
+ */
+void binary_operation(column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output);
+
+/**
+ * @brief Performs a binary operation between a scalar and a column, writing the results into a
+ * preallocated column.
+ *
+ * The output contains the result of `op(lhs, rhs[i])` for all `0 <= i < rhs.size()`, and the
+ * validity of `binary_operation(lhs, rhs, op, output.type())`. `output` may be `rhs` itself, so
+ * that the operation is applied in place without allocating a column, when the result has the
+ * type of `rhs`. Otherwise it must not overlap `rhs`.
+ *
+ * Only columns of non-`fixed_point` fixed-width types are supported.
+ *
+ * @param lhs         The left operand scalar
+ * @param rhs         The right operand column
+ * @param output      The preallocated column of the result, of the desired data type. The null
+ *                    mask of a nullable `output` is overwritten, and requires an `output` without
+ *                    offset.
+ * @throw cudf::logic_error if @p output is not of the size of @p rhs
+ * @throw cudf::logic_error if the operands or @p output are not of supported types
+ * @throw cudf::logic_error if @p output is not nullable and @p rhs has nulls or @p lhs is invalid
+ * @throw cudf::logic_error if @p output overlaps @p rhs without viewing the same elements, or
+ *                          shares its null mask for a null-dependent operator
+ */
+void binary_operation(scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output);
+
+/**
+ * @brief Performs a binary operation between two columns, writing the results into a
+ * preallocated column.
+ *
+ * The output contains the result of `op(lhs[i], rhs[i])` for all `0 <= i < lhs.size()`, and the
+ * validity of `binary_operation(lhs, rhs, op, output.type())`. `output` may be either operand, so
+ * that the operation is applied in place without allocating a column, when the result has the
+ * type of that operand. Otherwise it must not overlap the operands.
+ *
+ * Only columns of non-`fixed_point` fixed-width types are supported.
+ *
+ * @param lhs         The left operand column
+ * @param rhs         The right operand column
+ * @param output      The preallocated column of the result, of the desired data type. The null
+ *                    mask of a nullable `output` is overwritten, and requires an `output` without
+ *                    offset.
+ * @throw cudf::logic_error if @p lhs, @p rhs and @p output are different sizes
+ * @throw cudf::logic_error if the operands or @p output are not of supported types
+ * @throw cudf::logic_error if @p output is not nullable and an operand has nulls
+ * @throw cudf::logic_error if @p output overlaps an operand without viewing the same elements, or
+ *                          shares its null mask for a null-dependent operator
+ */
+void binary_operation(column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output);
+
 /**
  * @brief Performs a binary operation between two columns using a
  * user-defined PTX function.
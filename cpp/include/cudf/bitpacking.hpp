@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cudf {
+/**
+ * @addtogroup column_classes
+ * @{
+ * @file
+ * @brief Frame-of-reference, bit-packed encoding of integer columns in device memory
+ */
+
+/**
+ * @brief An integer column held in device memory in a frame-of-reference, bit-packed encoding.
+ *
+ * Each row is stored as its difference to the minimum valid value of the column, the reference,
+ * using the number of bits needed by the largest difference. A column of values in a range of
+ * `2^n` thus takes `n` bits per row, whatever the width of its type. Rows are packed back to back
+ * in 64-bit words; the null mask is kept as is, and null rows are stored as the reference.
+ *
+ * A `bitpacked_column` is created by `cudf::bitpack()` and decoded by `cudf::decode()`. Minimum
+ * and maximum reductions, sums and comparisons with a scalar are computed from the encoded form,
+ * without decoding the column.
+ */
+class bitpacked_column {
+ public:
+  bitpacked_column(bitpacked_column const&) = delete;
+  bitpacked_column& operator=(bitpacked_column const&) = delete;
+
+  /**
+   * @brief Constructs a column from its encoded data, as produced by `cudf::bitpack()`.
+   *
+   * @param type The type of the decoded column
+   * @param size The number of rows
+   * @param bit_width The number of bits of each row, in `[0, 64]`
+   * @param reference The minimum valid value, converted to `uint64_t`
+   * @param range The difference between the maximum and minimum valid values, as unsigned
+   * @param data The packed rows
+   * @param null_mask The null mask of the decoded column, or an empty buffer
+   * @param null_count The number of null rows
+   */
+  bitpacked_column(data_type type,
+                   size_type size,
+                   int bit_width,
+                   uint64_t reference,
+                   uint64_t range,
+                   rmm::device_buffer&& data,
+                   rmm::device_buffer&& null_mask,
+                   size_type null_count);
+
+  /**
+   * @brief Returns the type of the decoded column.
+   */
+  data_type type() const noexcept { return _type; }
+
+  /**
+   * @brief Returns the number of rows.
+   */
+  size_type size() const noexcept { return _size; }
+
+  /**
+   * @brief Returns the number of null rows.
+   */
+  size_type null_count() const noexcept { return _null_count; }
+
+  /**
+   * @brief Returns whether the column has a null mask.
+   */
+  bool nullable() const noexcept { return _null_mask.size() > 0; }
+
+  /**
+   * @brief Returns the number of bits of each row.
+   */
+  int bit_width() const noexcept { return _bit_width; }
+
+  /**
+   * @brief Returns the minimum valid value, converted to `uint64_t`, or 0 if all rows are null.
+   */
+  uint64_t reference() const noexcept { return _reference; }
+
+  /**
+   * @brief Returns the difference between the maximum and minimum valid values, as unsigned.
+   */
+  uint64_t range() const noexcept { return _range; }
+
+  /**
+   * @brief Returns the packed rows, in 64-bit words.
+   */
+  uint64_t const* data() const noexcept { return static_cast<uint64_t const*>(_data.data()); }
+
+  /**
+   * @brief Returns the null mask, or `nullptr` if the column is not nullable.
+   */
+  bitmask_type const* null_mask() const noexcept
+  {
+    return nullable() ? static_cast<bitmask_type const*>(_null_mask.data()) : nullptr;
+  }
+
+  /**
+   * @brief Returns the number of bytes of device memory held by the column.
+   */
+  std::size_t encoded_size() const noexcept { return _data.size() + _null_mask.size(); }
+
+ private:
+  data_type _type;
+  size_type _size;
+  int _bit_width;
+  uint64_t _reference;
+  uint64_t _range;
+  rmm::device_buffer _data;
+  rmm::device_buffer _null_mask;
+  size_type _null_count;
+};
+
+/**
+ * @brief Encodes an integer column in a frame-of-reference, bit-packed encoding.
+ *
+ * Timestamp, duration and fixed-point columns can be encoded through a `cudf::bit_cast()` of them
+ * to the integer type of their representation.
+ *
+ * @throw cudf::logic_error if the type of `input` is not an integer type other than BOOL8
+ *
+ * @param input The column to encode
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The encoded column
+ */
+std::unique_ptr<bitpacked_column> bitpack(
+  column_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Decodes a bit-packed column.
+ *
+ * @param input The column to decode
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The decoded column
+ */
+std::unique_ptr<column> decode(
+  bitpacked_column const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Decodes the rows of a bit-packed column given by a gather map.
+ *
+ * Row `i` of the result is row `gather_map[i]` of `input`. Only these rows are read.
+ *
+ * @throw cudf::logic_error if `gather_map` is not of type INT32 or has nulls
+ *
+ * @param input The column to decode rows of
+ * @param gather_map The indices of the rows to decode, in `[0, input.size())`; the behavior is
+ * undefined for other indices
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The decoded rows
+ */
+std::unique_ptr<column> decode(
+  bitpacked_column const& input,
+  column_view const& gather_map,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the reduction of a bit-packed column, without decoding it.
+ *
+ * The result is the one of `cudf::reduce()` of the decoded column. The minimum and the maximum
+ * are known from the encoding; the sum adds the stored differences, in 64-bit integers.
+ *
+ * @throw cudf::logic_error if `agg` is not a sum, a minimum or a maximum
+ * @throw cudf::logic_error if `output_dtype` is not an integer type other than BOOL8
+ *
+ * @param input The column to reduce
+ * @param agg The reduction
+ * @param output_dtype The type of the result
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return The reduction, invalid if all rows of `input` are null
+ */
+std::unique_ptr<scalar> reduce(
+  bitpacked_column const& input,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compares the rows of a bit-packed column with a scalar, without decoding the column.
+ *
+ * The result is the one of `cudf::binary_operation()` of the decoded column and `rhs`, to a BOOL8
+ * column, and can be given to `cudf::apply_boolean_mask()` to filter the rows of a table. The
+ * scalar is converted to a difference to the reference of `lhs`, which is compared with the
+ * stored differences; when it is out of the range of the column, the result is the same for all
+ * rows and no row is read.
+ *
+ * @throw cudf::logic_error if `op` is not EQUAL, NOT_EQUAL, LESS, GREATER, LESS_EQUAL or
+ * GREATER_EQUAL
+ * @throw cudf::logic_error if the type of `rhs` is not the type of `lhs`
+ *
+ * @param lhs The column to compare
+ * @param rhs The scalar to compare with
+ * @param op The comparison
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The BOOL8 results of the comparisons, null where `lhs` is null or if `rhs` is invalid
+ */
+std::unique_ptr<column> binary_operation(
+  bitpacked_column const& lhs,
+  scalar const& rhs,
+  binary_operator op,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -420,10 +420,14 @@ std::unique_ptr<column> make_strings_column(
  *
  * The columns and mask are moved into the resulting strings column.
  *
+ * @throws cudf::logic_error if the offsets column is not INT32 or INT64
+ * @throws cudf::logic_error if INT64 offsets exceed the size_type range
+ *
  * @param[in] num_strings The number of strings the column represents.
  * @param[in] offsets_column The column of offset values for this column. The number of elements is
  *  one more than the total number of strings so the `offset[last] - offset[0]` is the total number
- *  of bytes in the strings vector.
+ *  of bytes in the strings vector. INT64 offsets, such as those of Arrow large strings, are
+ *  converted to the INT32 offsets of strings columns.
  * @param[in] chars_column The column of char bytes for all the strings for this column. Individual
  *  strings are identified by the offsets and the nullmask.
  * @param[in] null_count The number of null string entries.
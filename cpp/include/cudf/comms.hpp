@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace cudf {
+namespace comms {
+/**
+ * @addtogroup reorder_partition
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Point-to-point transport of device memory between the ranks of a group of processes or
+ * GPUs.
+ *
+ * libcudf doesn't depend on a transport library: applications implement this interface over the
+ * one they use, e.g. NCCL with `ncclSend`/`ncclRecv` between `ncclGroupStart` and `ncclGroupEnd`,
+ * or UCX with tagged messages.
+ *
+ * The `send` and `recv` calls between `group_start` and `group_end` are posted together, and must
+ * not wait for each other: they complete by the time `group_end` returns, or later in the order
+ * of the stream they were posted on. The messages between two ranks are received in the order
+ * they were sent.
+ */
+class communicator {
+ public:
+  virtual ~communicator() = default;
+
+  /**
+   * @brief Returns the rank of this process in the group, in `[0, size())`.
+   */
+  [[nodiscard]] virtual int rank() const = 0;
+
+  /**
+   * @brief Returns the number of ranks of the group.
+   */
+  [[nodiscard]] virtual int size() const = 0;
+
+  /**
+   * @brief Starts a group of `send` and `recv` calls.
+   */
+  virtual void group_start() = 0;
+
+  /**
+   * @brief Completes the `send` and `recv` calls of the group.
+   */
+  virtual void group_end() = 0;
+
+  /**
+   * @brief Posts the sending of `size` bytes of device memory to the rank `peer`.
+   *
+   * @param data The device memory to send, which must not be modified until the send completes
+   * @param size The number of bytes to send
+   * @param peer The rank receiving the message
+   * @param stream CUDA stream on which the send is ordered
+   */
+  virtual void send(void const* data, std::size_t size, int peer, rmm::cuda_stream_view stream) = 0;
+
+  /**
+   * @brief Posts the receiving of `size` bytes of device memory from the rank `peer`.
+   *
+   * @param data The device memory receiving the message
+   * @param size The number of bytes to receive, which is the size of the message sent by `peer`
+   * @param peer The rank sending the message
+   * @param stream CUDA stream on which the receive is ordered
+   */
+  virtual void recv(void* data, std::size_t size, int peer, rmm::cuda_stream_view stream) = 0;
+};
+
+/**
+ * @brief Exchanges the partitions of a table between all the ranks of a communicator, so that
+ * every rank receives the partition of its rank from every rank.
+ *
+ * Every rank of `comm` must call this function with tables of the same schema. The partitions of
+ * `input` are packed like `contiguous_split`, and the packed partitions are sent to their ranks
+ * and received directly into the device buffers returned, which `cudf::unpack` turns back into
+ * tables. The partition of the calling rank is not sent.
+ *
+ * @code{.pseudo}
+ * auto [partitioned, offsets] = cudf::hash_partition(input, key_columns, comm.size());
+ * auto received = cudf::comms::all_to_all(comm, partitioned->view(), offsets);
+ * // `cudf::unpack(received[i])` has the rows of `input` on rank `i` hashed to this rank
+ * @endcode
+ *
+ * @throw cudf::logic_error if `input` has no columns
+ * @throw cudf::logic_error if `partition_offsets` is not empty and its size is not `comm.size()`
+ * @throw cudf::logic_error if `partition_offsets` is empty and `input` has rows
+ *
+ * @param comm The communicator of the ranks exchanging partitions
+ * @param input The partitioned table, whose partition `i` is sent to the rank `i`
+ * @param partition_offsets The offset of the first row of each partition, as returned by
+ * `hash_partition`, or none if `input` has no rows
+ * @param stream CUDA stream used for device memory operations, kernel launches and transfers
+ * @param mr Device memory resource used to allocate the device memory of the returned partitions
+ *
+ * @return The packed partitions received from each rank, in the order of the ranks
+ */
+std::vector<packed_columns> all_to_all(
+  communicator& comm,
+  table_view const& input,
+  std::vector<size_type> const& partition_offsets,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace comms
+}  // namespace cudf
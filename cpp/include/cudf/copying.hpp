@@ -18,8 +18,11 @@
 
 #include <cudf/column/column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/chunked_table_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <memory>
 #include <vector>
@@ -72,6 +75,7 @@ enum class out_of_bounds_policy : bool {
  * use `DONT_CHECK` when they are certain that the gather_map contains only valid indices for
  * better performance. If `policy` is set to `DONT_CHECK` and there are out-of-bounds indices
  * in the gather map, the behavior is undefined. Defaults to `DONT_CHECK`.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
  * @return std::unique_ptr<table> Result of the gather
  */
@@ -79,6 +83,38 @@ std::unique_ptr<table> gather(
   table_view const& source_table,
   column_view const& gather_map,
   out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Gathers the specified rows (including null values) of a chunked table, without
+ * concatenating its chunks.
+ *
+ * @ingroup copy_gather
+ *
+ * The result is the same as gathering the rows of the concatenated chunks of `source_table`, but
+ * only the gathered rows are copied, which saves the copy of the whole table when the chunks are
+ * only concatenated to gather some of their rows.
+ *
+ * A negative value `i` in the `gather_map` is interpreted as `i+n`, where `n` is the number of
+ * rows of all the chunks of `source_table`.
+ *
+ * @throws cudf::logic_error if gather_map contains null values.
+ *
+ * @param[in] source_table The input chunks whose rows will be gathered
+ * @param[in] gather_map View into a non-nullable column of integral indices that maps the rows of
+ * all the chunks to rows in the destination columns.
+ * @param[in] bounds_policy Policy to apply to account for possible out-of-bounds indices, as in
+ * `gather` of a `table_view`
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return std::unique_ptr<table> Result of the gather
+ */
+std::unique_ptr<table> gather(
+  chunked_table_view const& source_table,
+  column_view const& gather_map,
+  out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -115,6 +151,7 @@ std::unique_ptr<table> gather(
  * are to be scattered
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory.
  * @return Result of scattering values from source to target
  */
@@ -123,6 +160,7 @@ std::unique_ptr<table> scatter(
   column_view const& scatter_map,
   table_view const& target,
   bool check_bounds                   = false,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -155,6 +193,7 @@ std::unique_ptr<table> scatter(
  * are to be scattered
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory.
  * @return Result of scattering values from source to target
  */
@@ -163,6 +202,7 @@ std::unique_ptr<table> scatter(
   column_view const& indices,
   table_view const& target,
   bool check_bounds                   = false,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -188,6 +228,7 @@ std::unique_ptr<column> empty_like(column_view const& input);
  *
  * @param[in] input Immutable view of input column to emulate
  * @param[in] mask_alloc Optional, Policy for allocating null mask. Defaults to RETAIN.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  * @return A column with sufficient uninitialized capacity to hold the same
  * number of elements as `input` of the same type as `input.type()`
@@ -195,6 +236,7 @@ std::unique_ptr<column> empty_like(column_view const& input);
 std::unique_ptr<column> allocate_like(
   column_view const& input,
   mask_allocation_policy mask_alloc   = mask_allocation_policy::RETAIN,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -204,6 +246,7 @@ std::unique_ptr<column> allocate_like(
  * @param[in] input Immutable view of input column to emulate
  * @param[in] size The desired number of elements that the new column should have capacity for
  * @param[in] mask_alloc Optional, Policy for allocating null mask. Defaults to RETAIN.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  * @return A column with sufficient uninitialized capacity to hold the specified number of elements
  * as `input` of the same type as `input.type()`
@@ -212,6 +255,7 @@ std::unique_ptr<column> allocate_like(
   column_view const& input,
   size_type size,
   mask_allocation_policy mask_alloc   = mask_allocation_policy::RETAIN,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -256,12 +300,14 @@ std::unique_ptr<table> empty_like(table_view const& input_table);
  * @param source_end The index of the last element in the source range
  * (exclusive)
  * @param target_begin The starting index of the target range (inclusive)
+ * @param stream CUDA stream used for device memory operations and kernel launches
  */
 void copy_range_in_place(column_view const& source,
                          mutable_column_view& target,
                          size_type source_begin,
                          size_type source_end,
-                         size_type target_begin);
+                         size_type target_begin,
+                         rmm::cuda_stream_view stream = cudf::get_default_stream());
 
 /**
  * @brief Copies a range of elements out-of-place from one column to another.
@@ -289,6 +335,7 @@ void copy_range_in_place(column_view const& source,
  * @param source_end The index of the last element in the source range
  * (exclusive)
  * @param target_begin The starting index of the target range (inclusive)
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @return std::unique_ptr<column> The result target column
  */
@@ -298,6 +345,7 @@ std::unique_ptr<column> copy_range(
   size_type source_begin,
   size_type source_end,
   size_type target_begin,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -329,6 +377,7 @@ std::unique_ptr<column> copy_range(
  * @param input      Column to be shifted.
  * @param offset     The offset by which to shift the input.
  * @param fill_value Fill value for indeterminable outputs.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr         Device memory resource used to allocate the returned result's device memory
  *
  * @throw cudf::logic_error if @p input dtype is not fixed-with.
@@ -338,6 +387,7 @@ std::unique_ptr<column> shift(
   column_view const& input,
   size_type offset,
   scalar const& fill_value,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -559,6 +609,7 @@ struct packed_table {
  *
  * @param input View of a table to split
  * @param splits A vector of indices where the view will be split
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned result's device memory
  * @return The set of requested views of `input` indicated by the `splits` and the viewed memory
  * buffer.
@@ -566,8 +617,58 @@ struct packed_table {
 std::vector<packed_table> contiguous_split(
   cudf::table_view const& input,
   std::vector<size_type> const& splits,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the number of bytes of device memory that `contiguous_split_into` copies each
+ * partition of `input` to.
+ *
+ * @ingroup copy_split
+ *
+ * @throws cudf::logic_error under the same conditions as `contiguous_split`.
+ *
+ * @param input View of a table to split
+ * @param splits A vector of indices where the view will be split
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The number of bytes of each of the `splits.size() + 1` partitions, or none if `input`
+ * has no columns
+ */
+std::vector<std::size_t> contiguous_split_sizes(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Performs a `contiguous_split` of `input` into caller-supplied device buffers.
+ *
+ * @ingroup copy_split
+ *
+ * Partition `i` is copied to `buffers[i]`, which must hold at least the number of bytes returned
+ * by `contiguous_split_sizes` for it, so that the partitions can be sent from their buffers, such
+ * as buffers registered with a communication library, without another copy. All the partitions
+ * are copied together. The returned metadata of each partition describes its columns as an array
+ * of fixed-size, 8-byte aligned records, and `cudf::unpack` rebuilds the `table_view` of the
+ * partition from the metadata and any copy of its buffer.
+ *
+ * @throws cudf::logic_error under the same conditions as `contiguous_split`.
+ * @throws cudf::logic_error if `buffers.size() != splits.size() + 1`.
+ * @throws cudf::logic_error if a buffer is smaller than its partition.
+ * @throws cudf::logic_error if a buffer is not aligned to 64 bytes.
+ *
+ * @param input View of a table to split
+ * @param splits A vector of indices where the view will be split
+ * @param buffers The device buffer of each partition
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The metadata of each partition, to `unpack` with its buffer, or none if `input` has no
+ * columns
+ */
+std::vector<packed_columns::metadata> contiguous_split_into(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  std::vector<device_span<uint8_t>> const& buffers,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /**
  * @brief Deep-copy a `table_view` into a serialized contiguous memory format
  *
@@ -576,11 +677,13 @@ std::vector<packed_table> contiguous_split(
  * `cudf::unpack` to deserialize.
  *
  * @param input View of the table to pack
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Optional, The resource to use for all returned device allocations
  * @return packed_columns A struct containing the serialized metadata and data in contiguous host
  *         and device memory respectively
  */
 packed_columns pack(cudf::table_view const& input,
+                    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -650,6 +753,7 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
  * @param[in] rhs right-hand column_view
  * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
  * boolean for each element. Null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  *
  * @returns new column with the selected elements
@@ -658,6 +762,7 @@ std::unique_ptr<column> copy_if_else(
   column_view const& lhs,
   column_view const& rhs,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -674,6 +779,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] rhs right-hand column_view
  * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
  * boolean for each element. Null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  *
  * @returns new column with the selected elements
@@ -682,6 +788,7 @@ std::unique_ptr<column> copy_if_else(
   scalar const& lhs,
   column_view const& rhs,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -698,6 +805,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] rhs right-hand scalar
  * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
  * boolean for each element. Null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  *
  * @returns new column with the selected elements
@@ -706,6 +814,7 @@ std::unique_ptr<column> copy_if_else(
   column_view const& lhs,
   scalar const& rhs,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -720,14 +829,150 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] rhs right-hand scalar
  * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
  * boolean for each element. null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns new column with the selected elements
+ */
+std::unique_ptr<column> copy_if_else(
+  scalar const& lhs,
+  scalar const& rhs,
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief   Returns a new column, where each element is selected from either @p lhs or
+ *          @p rhs based on the value of the corresponding bit in @p boolean_mask
+ *
+ * Selects each element i in the output column from either @p rhs or @p lhs using the following
+ * rule: `output[i] = bit_is_set(boolean_mask, i) ? lhs[i] : rhs[i]`
+ *
+ * `boolean_mask` holds one bit per row instead of the byte of a BOOL8 column, like the masks
+ * returned by `cudf::bools_to_mask()` and `cudf::ast::compute_mask()`.
+ *
+ * @throws cudf::logic_error if lhs and rhs are not of the same type
+ * @throws cudf::logic_error if lhs and rhs are not of the same length
+ * @param[in] lhs left-hand column_view
+ * @param[in] rhs right-hand column_view
+ * @param[in] boolean_mask bitmask of at least `lhs.size()` bits representing "left (set) / right
+ * (unset)" for each element, or `nullptr` if the columns are empty
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns new column with the selected elements
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
+  column_view const& rhs,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief   Returns a new column, where each element is selected from either @p lhs or
+ *          @p rhs based on the value of the corresponding bit in @p boolean_mask
+ *
+ * Selects each element i in the output column from either @p rhs or @p lhs using the following
+ * rule: `output[i] = bit_is_set(boolean_mask, i) ? lhs : rhs[i]`
+ *
+ * @throws cudf::logic_error if lhs and rhs are not of the same type
+ * @param[in] lhs left-hand scalar
+ * @param[in] rhs right-hand column_view
+ * @param[in] boolean_mask bitmask of at least `rhs.size()` bits representing "left (set) / right
+ * (unset)" for each element, or `nullptr` if `rhs` is empty
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  *
  * @returns new column with the selected elements
  */
 std::unique_ptr<column> copy_if_else(
   scalar const& lhs,
+  column_view const& rhs,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief   Returns a new column, where each element is selected from either @p lhs or
+ *          @p rhs based on the value of the corresponding bit in @p boolean_mask
+ *
+ * Selects each element i in the output column from either @p rhs or @p lhs using the following
+ * rule: `output[i] = bit_is_set(boolean_mask, i) ? lhs[i] : rhs`
+ *
+ * @throws cudf::logic_error if lhs and rhs are not of the same type
+ * @param[in] lhs left-hand column_view
+ * @param[in] rhs right-hand scalar
+ * @param[in] boolean_mask bitmask of at least `lhs.size()` bits representing "left (set) / right
+ * (unset)" for each element, or `nullptr` if `lhs` is empty
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns new column with the selected elements
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
   scalar const& rhs,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief   Returns a new table, where each row is selected from either @p lhs or
+ *          @p rhs based on the value of the corresponding element in @p boolean_mask
+ *
+ * Selects each row i of every column j of the output table using the following rule:
+ * `output[j][i] = (boolean_mask.valid(i) and boolean_mask[i]) ? lhs[j][i] : rhs[j][i]`
+ *
+ * The result is that of `copy_if_else()` on every pair of columns, but the mask is evaluated once
+ * for the whole table and all the fixed-width columns are selected together, which is much faster
+ * than one call per column for wide tables.
+ *
+ * @throws cudf::logic_error if lhs and rhs do not have the same number of columns
+ * @throws cudf::logic_error if any column of lhs is not of the type of the same column of rhs
+ * @throws cudf::logic_error if lhs and rhs are not of the same number of rows
+ * @throws cudf::logic_error if boolean mask is not of type bool
+ * @throws cudf::logic_error if boolean mask is not of the same length as lhs and rhs
+ * @param[in] lhs left-hand table_view
+ * @param[in] rhs right-hand table_view
+ * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
+ * boolean for each row. Null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns new table with the selected rows
+ */
+std::unique_ptr<table> copy_if_else(
+  table_view const& lhs,
+  table_view const& rhs,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief   Returns a new table, where each row is selected from either @p lhs or
+ *          @p rhs based on the value of the corresponding bit in @p boolean_mask
+ *
+ * Selects each row i of every column j of the output table using the following rule:
+ * `output[j][i] = bit_is_set(boolean_mask, i) ? lhs[j][i] : rhs[j][i]`
+ *
+ * @throws cudf::logic_error if lhs and rhs do not have the same number of columns
+ * @throws cudf::logic_error if any column of lhs is not of the type of the same column of rhs
+ * @throws cudf::logic_error if lhs and rhs are not of the same number of rows
+ * @param[in] lhs left-hand table_view
+ * @param[in] rhs right-hand table_view
+ * @param[in] boolean_mask bitmask of at least `lhs.num_rows()` bits representing "left (set) /
+ * right (unset)" for each row, or `nullptr` if the tables have no rows
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns new table with the selected rows
+ */
+std::unique_ptr<table> copy_if_else(
+  table_view const& lhs,
+  table_view const& rhs,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -762,6 +1007,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] input table_view (set of dense columns) to scatter
  * @param[in] target table_view to modify with scattered values from `input`
  * @param[in] boolean_mask column_view which acts as boolean mask.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate device memory of the returned table.
  *
  * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`.
@@ -770,6 +1016,7 @@ std::unique_ptr<table> boolean_mask_scatter(
   table_view const& input,
   table_view const& target,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -799,6 +1046,7 @@ std::unique_ptr<table> boolean_mask_scatter(
  * @param[in] input scalars to scatter
  * @param[in] target table_view to modify with scattered values from `input`
  * @param[in] boolean_mask column_view which acts as boolean mask.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate device memory of the returned table.
  *
  * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`.
@@ -807,6 +1055,65 @@ std::unique_ptr<table> boolean_mask_scatter(
   std::vector<std::reference_wrapper<const scalar>> const& input,
   table_view const& target,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Scatters rows from the input table to rows of the output corresponding
+ * to set bits in a bitmask.
+ *
+ * @ingroup copy_scatter
+ *
+ * The `i`th row of `input` will be written to the output table at the location of the `i`th set
+ * bit of `boolean_mask`, as by `boolean_mask_scatter()` with a BOOL8 mask. The mask is
+ * bit-packed, as produced by `cudf::bools_to_mask()` or `cudf::ast::compute_mask()`.
+ *
+ * @throw  cudf::logic_error if input.num_columns() != target.num_columns()
+ * @throws cudf::logic_error if any `i`th input_column type != `i`th target_column type
+ * @throws cudf::logic_error if number of set bits in `boolean_mask` > input.num_rows()
+ *
+ * @param[in] input table_view (set of dense columns) to scatter
+ * @param[in] target table_view to modify with scattered values from `input`
+ * @param[in] boolean_mask bitmask of at least `target.num_rows()` bits, or `nullptr` if `target`
+ * has no rows
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`.
+ */
+std::unique_ptr<table> boolean_mask_scatter(
+  table_view const& input,
+  table_view const& target,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Scatters scalar values to rows of the output corresponding
+ * to set bits in a bitmask.
+ *
+ * @ingroup copy_scatter
+ *
+ * The `i`th scalar in `input` will be written to all columns of the output table at the location
+ * of each set bit of `boolean_mask`, as by `boolean_mask_scatter()` with a BOOL8 mask.
+ *
+ * @throw  cudf::logic_error if input.size() != target.num_columns()
+ * @throws cudf::logic_error if any `i`th input_scalar type != `i`th target_column type
+ *
+ * @param[in] input scalars to scatter
+ * @param[in] target table_view to modify with scattered values from `input`
+ * @param[in] boolean_mask bitmask of at least `target.num_rows()` bits, or `nullptr` if `target`
+ * has no rows
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`.
+ */
+std::unique_ptr<table> boolean_mask_scatter(
+  std::vector<std::reference_wrapper<const scalar>> const& input,
+  table_view const& target,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -819,12 +1126,14 @@ std::unique_ptr<table> boolean_mask_scatter(
  *
  * @param input Column view to get the element from
  * @param index Index into `input` to get the element at
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned scalar's device memory.
  * @return std::unique_ptr<scalar> Scalar containing the single value
  */
 std::unique_ptr<scalar> get_element(
   column_view const& input,
   size_type index,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -858,16 +1167,142 @@ enum class sample_with_replacement : bool {
  * @param n non-negative number of samples expected from `input`.
  * @param replacement Allow or disallow sampling of the same row more than once.
  * @param seed Seed value to initiate random number generator.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return std::unique_ptr<table> Table containing samples from `input`
+ */
+std::unique_ptr<table> sample(
+  table_view const& input,
+  size_type const n,
+  sample_with_replacement replacement = sample_with_replacement::FALSE,
+  int64_t const seed                  = 0,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Gather `n` samples from given `input` randomly, each row being sampled with a
+ * probability proportional to its weight.
+ *
+ * With replacement, every sample is row `i` with probability `weights[i] / sum(weights)`.
+ * Without replacement, the samples are drawn one after the other among the rows not sampled yet,
+ * with probabilities proportional to their weights, by keeping the rows of the `n` largest keys
+ * `u^(1 / weights[i])` of uniform random numbers `u` (Efraimidis and Spirakis). Rows of weight 0
+ * are never sampled.
+ *
+ * @throws cudf::logic_error if `n` < 0.
+ * @throws cudf::logic_error if `weights` doesn't have one value per row of `input`.
+ * @throws cudf::logic_error if `weights` is not of a floating point type, or has nulls.
+ * @throws cudf::logic_error if `weights` has negative or NaN values.
+ * @throws cudf::logic_error if `n` > 0 and all the weights are 0.
+ * @throws cudf::logic_error if `n` > the number of rows of nonzero weight and `replacement` ==
+ * FALSE.
+ *
+ * @param input View of a table to sample.
+ * @param weights The non-negative weight of each row of `input`.
+ * @param n non-negative number of samples expected from `input`.
+ * @param replacement Allow or disallow sampling of the same row more than once.
+ * @param seed Seed value to initiate random number generator.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  *
  * @return std::unique_ptr<table> Table containing samples from `input`
  */
 std::unique_ptr<table> sample(
   table_view const& input,
+  column_view const& weights,
   size_type const n,
   sample_with_replacement replacement = sample_with_replacement::FALSE,
   int64_t const seed                  = 0,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Keeps a sample without replacement of at most `capacity` rows of all the batches of
+ * rows added to it, in device memory, without keeping the batches themselves.
+ *
+ * The sample is uniform if no weights are given, else weighted, rows added without weights having
+ * weight 1. Every row is assigned the random key of weighted sampling without replacement when its
+ * batch is added, and the sample keeps the rows of the `capacity` largest keys (algorithm A-Res
+ * of Efraimidis and Spirakis). The keys only depend on the seed and on the position of the rows
+ * among all the rows added, so the sample is the one the weighted `sample` without replacement
+ * draws from the concatenation of the batches with the same seed, in the same order.
+ *
+ * Only the rows of a batch whose keys exceed the smallest key of a full sample are candidates to
+ * replace its rows, so adding a batch costs little more than drawing its keys once most of the
+ * rows have been seen.
+ *
+ * @code{.pseudo}
+ * reservoir_sampler sampler(1000);
+ * for (auto const& batch : batches) { sampler.add(batch); }
+ * // sampler.view() is a uniform sample of 1000 rows of all the batches
+ * @endcode
+ */
+class reservoir_sampler {
+ public:
+  /**
+   * @brief Constructs a sampler keeping at most `capacity` rows.
+   *
+   * @throws cudf::logic_error if `capacity` < 0.
+   *
+   * @param capacity The maximum number of rows of the sample
+   * @param seed Seed value to initiate random number generator
+   * @param mr Device memory resource used to allocate the device memory of the sample
+   */
+  explicit reservoir_sampler(
+    size_type capacity,
+    int64_t seed                        = 0,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Adds the rows of a batch, each of weight 1, to the rows sampled.
+   *
+   * @throws cudf::logic_error if `batch` doesn't have the column types of the previous batches.
+   *
+   * @param batch The rows to add
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add(table_view const& batch, rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Adds the rows of a batch, with their weights, to the rows sampled.
+   *
+   * @throws cudf::logic_error if `batch` doesn't have the column types of the previous batches.
+   * @throws cudf::logic_error if `weights` doesn't have one value per row of `batch`.
+   * @throws cudf::logic_error if `weights` is not of a floating point type, or has nulls.
+   * @throws cudf::logic_error if `weights` has negative or NaN values.
+   *
+   * @param batch The rows to add
+   * @param weights The non-negative weight of each row of `batch`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add(table_view const& batch,
+           column_view const& weights,
+           rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns the rows sampled so far, which are all the rows of nonzero weight added while
+   * there are at most `capacity` of them. The view is invalidated by the next `add`.
+   *
+   * The sample has no columns if no batch was added.
+   */
+  [[nodiscard]] table_view view() const;
+
+  /**
+   * @brief Returns the number of rows of all the batches added.
+   */
+  [[nodiscard]] int64_t num_rows_seen() const { return _num_rows_seen; }
+
+ private:
+  void add(table_view const& batch, column_view const* weights, rmm::cuda_stream_view stream);
+
+  size_type _capacity;
+  int64_t _seed;
+  rmm::mr::device_memory_resource* _mr;
+  int64_t _num_rows_seen{0};
+  std::unique_ptr<table> _sample;  ///< Sampled rows, in decreasing order of keys
+  std::unique_ptr<column> _keys;   ///< FLOAT64 keys of the sampled rows
+};
+
 /** @} */
 }  // namespace cudf
@@ -19,6 +19,8 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -124,6 +126,45 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Components of a date time that can be extracted by `extract_fields()`.
+ */
+enum class datetime_component {
+  YEAR,     ///< Year, as `extract_year()`
+  MONTH,    ///< Month of the year in [1, 12], as `extract_month()`
+  DAY,      ///< Day of the month in [1, 31], as `extract_day()`
+  WEEKDAY,  ///< ISO day of the week in [1, 7], Monday being 1, as `extract_weekday()`
+  HOUR,     ///< Hour of the day in [0, 23], as `extract_hour()`
+  MINUTE,   ///< Minute of the hour in [0, 59], as `extract_minute()`
+  SECOND,   ///< Second of the minute in [0, 59], as `extract_second()`
+};
+
+/**
+ * @brief  Extracts several components from any date time type and returns a table of int16_t
+ * columns, one per requested component, in the order of `components`.
+ *
+ * Each timestamp is decomposed into its date and its time of day once, and all components are
+ * written by the same kernel, instead of once per component by the `extract_*` functions. Each
+ * output column has the null mask of `column`.
+ *
+ * @code{.pseudo}
+ * Example:
+ * column = [1991-01-01 10:20:30, 2003-06-30 17:27:01]
+ * r = extract_fields(column, {YEAR, MONTH, HOUR})
+ * r is [[1991, 2003], [1, 6], [10, 17]]
+ * @endcode
+ *
+ * @param[in] column cudf::column_view of the input datetime values
+ * @param[in] components The components to extract; a component may be requested more than once
+ *
+ * @returns cudf::table of the extracted int16_t components
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::table> extract_fields(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
@@ -189,6 +230,40 @@ std::unique_ptr<cudf::column> add_calendrical_months(
   cudf::column_view const& timestamps,
   cudf::column_view const& months,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Converts timestamps from the local time of a timezone to the local time of another
+ * timezone, and returns a timestamp column of the same type as the input `timestamps` column.
+ *
+ * Timezones are given by their standard names, such as "America/New_York", and their offsets to
+ * UTC at each time are read from the system's TZif files, like those of the ORC reader. "UTC" or
+ * an empty name stands for UTC. The transition times of a timezone are copied to device memory
+ * once, then cached for the following calls, and the offset of each timestamp is found by a
+ * binary search in them.
+ *
+ * A local time that occurs twice, or not at all, around a transition of `from_timezone` is
+ * converted with the offset of either side of the transition. A null row is null in the result.
+ *
+ * @code{.pseudo}
+ * Example:
+ * timestamps = [2021-01-01 12:00:00, 2021-07-01 12:00:00]
+ * r = convert_timezone(timestamps, "UTC", "America/New_York")
+ * r is [2021-01-01 07:00:00, 2021-07-01 08:00:00]
+ * @endcode
+ *
+ * @param[in] timestamps cudf::column_view of timestamp type, of a resolution of seconds or finer.
+ * @param[in] from_timezone The timezone of the local times of `timestamps`.
+ * @param[in] to_timezone The timezone of the local times of the result.
+ *
+ * @returns cudf::column of timestamp type containing the converted timestamps.
+ * @throw cudf::logic_error if `timestamps` datatype is not a TIMESTAMP or is TIMESTAMP_DAYS.
+ * @throw cudf::logic_error if the TZif file of a timezone cannot be read.
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& timestamps,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 /** @} */  // end of group
 }  // namespace datetime
 }  // namespace cudf
@@ -107,6 +107,16 @@ struct update_target_element {
   }
 };
 
+/**
+ * @brief Indicates whether the hash-based aggregations can update a `fixed_point` target of type
+ * `T` with the device atomics, which only exist for storage types of up to 8 bytes.
+ */
+template <typename T>
+constexpr bool is_atomic_fixed_point()
+{
+  return is_fixed_point<T>() && sizeof(device_storage_type_t<T>) <= sizeof(int64_t);
+}
+
 template <typename Source, bool target_has_nulls, bool source_has_nulls>
 struct update_target_element<
   Source,
@@ -134,7 +144,7 @@ struct update_target_element<Source,
                              aggregation::MIN,
                              target_has_nulls,
                              source_has_nulls,
-                             std::enable_if_t<is_fixed_point<Source>()>> {
+                             std::enable_if_t<is_atomic_fixed_point<Source>()>> {
   __device__ void operator()(mutable_column_device_view target,
                              size_type target_index,
                              column_device_view source,
@@ -180,7 +190,7 @@ struct update_target_element<Source,
                              aggregation::MAX,
                              target_has_nulls,
                              source_has_nulls,
-                             std::enable_if_t<is_fixed_point<Source>()>> {
+                             std::enable_if_t<is_atomic_fixed_point<Source>()>> {
   __device__ void operator()(mutable_column_device_view target,
                              size_type target_index,
                              column_device_view source,
@@ -226,7 +236,7 @@ struct update_target_element<Source,
                              aggregation::SUM,
                              target_has_nulls,
                              source_has_nulls,
-                             std::enable_if_t<is_fixed_point<Source>()>> {
+                             std::enable_if_t<is_atomic_fixed_point<Source>()>> {
   __device__ void operator()(mutable_column_device_view target,
                              size_type target_index,
                              column_device_view source,
@@ -34,17 +34,25 @@ class var_aggregation;
 class std_aggregation;
 class min_aggregation;
 class max_aggregation;
+class nunique_aggregation;
+class approx_nunique_aggregation;
+class collect_list_aggregation;
+class collect_set_aggregation;
 
 // Visitor pattern
 class aggregation_finalizer {  // Declares the interface for the finalizer
  public:
   // Declare overloads for each kind of a agg to dispatch
-  virtual void visit(aggregation const& agg)      = 0;
-  virtual void visit(min_aggregation const& agg)  = 0;
-  virtual void visit(max_aggregation const& agg)  = 0;
-  virtual void visit(mean_aggregation const& agg) = 0;
-  virtual void visit(var_aggregation const& agg)  = 0;
-  virtual void visit(std_aggregation const& agg)  = 0;
+  virtual void visit(aggregation const& agg)                = 0;
+  virtual void visit(min_aggregation const& agg)            = 0;
+  virtual void visit(max_aggregation const& agg)            = 0;
+  virtual void visit(mean_aggregation const& agg)           = 0;
+  virtual void visit(var_aggregation const& agg)            = 0;
+  virtual void visit(std_aggregation const& agg)            = 0;
+  virtual void visit(nunique_aggregation const& agg)        = 0;
+  virtual void visit(approx_nunique_aggregation const& agg) = 0;
+  virtual void visit(collect_list_aggregation const& agg)   = 0;
+  virtual void visit(collect_set_aggregation const& agg)    = 0;
 };
 
 /**
@@ -244,6 +252,12 @@ struct nunique_aggregation final : derived_aggregation<nunique_aggregation> {
   }
   null_policy _null_handling;  ///< include or exclude nulls
 
+  std::vector<aggregation::Kind> get_simple_aggregations(data_type col_type) const override
+  {
+    return {};
+  }
+  void finalize(aggregation_finalizer& finalizer) override { finalizer.visit(*this); }
+
  protected:
   friend class derived_aggregation<nunique_aggregation>;
 
@@ -255,6 +269,39 @@ struct nunique_aggregation final : derived_aggregation<nunique_aggregation> {
   size_t hash_impl() const { return std::hash<int>{}(static_cast<int>(_null_handling)); }
 };
 
+/**
+ * @brief Derived class for specifying an APPROX_NUNIQUE or NUNIQUE_SKETCH aggregation
+ */
+struct approx_nunique_aggregation final : derived_aggregation<approx_nunique_aggregation> {
+  approx_nunique_aggregation(aggregation::Kind type, null_policy null_handling, int32_t precision)
+    : derived_aggregation{type}, _null_handling{null_handling}, _precision{precision}
+  {
+    CUDF_EXPECTS(type == aggregation::APPROX_NUNIQUE or type == aggregation::NUNIQUE_SKETCH,
+                 "approx_nunique_aggregation can accept only APPROX_NUNIQUE, NUNIQUE_SKETCH");
+  }
+  null_policy _null_handling;  ///< include or exclude nulls
+  int32_t _precision;          ///< log2 of the number of registers of a sketch
+
+  std::vector<aggregation::Kind> get_simple_aggregations(data_type col_type) const override
+  {
+    return {};
+  }
+  void finalize(aggregation_finalizer& finalizer) override { finalizer.visit(*this); }
+
+ protected:
+  friend class derived_aggregation<approx_nunique_aggregation>;
+
+  bool operator==(approx_nunique_aggregation const& other) const
+  {
+    return _null_handling == other._null_handling and _precision == other._precision;
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<int>{}(static_cast<int>(_null_handling)) ^ std::hash<int32_t>{}(_precision);
+  }
+};
+
 /**
  * @brief Derived class for specifying a nth element aggregation
  */
@@ -280,6 +327,56 @@ struct nth_element_aggregation final : derived_aggregation<nth_element_aggregati
   }
 };
 
+/**
+ * @brief Derived class for specifying a TDIGEST or MERGE_TDIGEST aggregation
+ */
+struct tdigest_aggregation final : derived_aggregation<tdigest_aggregation> {
+  tdigest_aggregation(aggregation::Kind type, int max_centroids)
+    : derived_aggregation{type}, _max_centroids{max_centroids}
+  {
+    CUDF_EXPECTS(type == aggregation::TDIGEST or type == aggregation::MERGE_TDIGEST,
+                 "tdigest_aggregation can accept only TDIGEST, MERGE_TDIGEST");
+    CUDF_EXPECTS(max_centroids > 2, "A t-digest must have at least three centroids");
+  }
+  int _max_centroids;  ///< maximum number of centroids of a digest
+
+ protected:
+  friend class derived_aggregation<tdigest_aggregation>;
+
+  bool operator==(tdigest_aggregation const& other) const
+  {
+    return _max_centroids == other._max_centroids;
+  }
+
+  size_t hash_impl() const { return std::hash<int>{}(_max_centroids); }
+};
+
+/**
+ * @brief Derived class for specifying a TOP_K aggregation
+ */
+struct top_k_aggregation final : derived_aggregation<top_k_aggregation> {
+  top_k_aggregation(size_type k, order column_order)
+    : derived_aggregation{TOP_K}, _k{k}, _order{column_order}
+  {
+    CUDF_EXPECTS(k > 0, "TOP_K requires a positive k");
+  }
+  size_type _k;  ///< number of values to select
+  order _order;  ///< DESCENDING for the largest values, ASCENDING for the smallest
+
+ protected:
+  friend class derived_aggregation<top_k_aggregation>;
+
+  bool operator==(top_k_aggregation const& other) const
+  {
+    return _k == other._k and _order == other._order;
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<size_type>{}(_k) ^ std::hash<int>{}(static_cast<int>(_order));
+  }
+};
+
 /**
  * @brief Derived class for specifying a custom aggregation
  * specified in udf
@@ -322,17 +419,23 @@ struct udf_aggregation final : derived_aggregation<udf_aggregation> {
 /**
  * @brief Derived aggregation class for specifying COLLECT_LIST aggregation
  */
-struct collect_list_aggregation final : derived_aggregation<nunique_aggregation> {
+struct collect_list_aggregation final : derived_aggregation<collect_list_aggregation> {
   explicit collect_list_aggregation(null_policy null_handling = null_policy::INCLUDE)
     : derived_aggregation{COLLECT_LIST}, _null_handling{null_handling}
   {
   }
   null_policy _null_handling;  ///< include or exclude nulls
 
+  std::vector<aggregation::Kind> get_simple_aggregations(data_type col_type) const override
+  {
+    return {};
+  }
+  void finalize(aggregation_finalizer& finalizer) override { finalizer.visit(*this); }
+
  protected:
-  friend class derived_aggregation<nunique_aggregation>;
+  friend class derived_aggregation<collect_list_aggregation>;
 
-  bool operator==(nunique_aggregation const& other) const
+  bool operator==(collect_list_aggregation const& other) const
   {
     return _null_handling == other._null_handling;
   }
@@ -358,6 +461,12 @@ struct collect_set_aggregation final : derived_aggregation<collect_set_aggregati
   nan_equality _nans_equal;    ///< whether to consider NaNs as equal value (applicable only to
                                ///< floating point types)
 
+  std::vector<aggregation::Kind> get_simple_aggregations(data_type col_type) const override
+  {
+    return {};
+  }
+  void finalize(aggregation_finalizer& finalizer) override { finalizer.visit(*this); }
+
  protected:
   friend class derived_aggregation<collect_set_aggregation>;
 
@@ -469,13 +578,15 @@ struct target_type_impl<
   using type = int64_t;
 };
 
-// Summing fixed_point numbers, always use the decimal64 accumulator
+// Summing fixed_point numbers, use the decimal64 accumulator unless the source is decimal128
 template <typename Source, aggregation::Kind k>
 struct target_type_impl<
   Source,
   k,
   std::enable_if_t<cudf::is_fixed_point<Source>() && (k == aggregation::SUM)>> {
-  using type = numeric::decimal64;
+  using type = std::conditional_t<std::is_same<Source, numeric::decimal128>::value,
+                                  numeric::decimal128,
+                                  numeric::decimal64>;
 };
 
 // Summing/Multiplying float/doubles, use same type accumulator
@@ -506,6 +617,23 @@ struct target_type_impl<SourceType, aggregation::STD> {
   using type = double;
 };
 
+// Always use `double` for M2 of arithmetic types
+template <typename Source, aggregation::Kind k>
+struct target_type_impl<
+  Source,
+  k,
+  std::enable_if_t<std::is_arithmetic<Source>::value && (k == aggregation::M2)>> {
+  using type = double;
+};
+
+// MERGE_M2 merges structs of count, mean and M2 into structs of the same layout
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_M2,
+                        std::enable_if_t<std::is_same<Source, cudf::struct_view>::value>> {
+  using type = cudf::struct_view;
+};
+
 // Always use `double` for quantile
 template <typename Source>
 struct target_type_impl<Source, aggregation::QUANTILE> {
@@ -536,6 +664,43 @@ struct target_type_impl<Source, aggregation::NUNIQUE> {
   using type = cudf::size_type;
 };
 
+// Always use int64_t for the estimates of APPROX_NUNIQUE
+template <typename Source>
+struct target_type_impl<Source, aggregation::APPROX_NUNIQUE> {
+  using type = int64_t;
+};
+
+// A HyperLogLog sketch is a list of UINT8 registers
+template <typename Source>
+struct target_type_impl<Source, aggregation::NUNIQUE_SKETCH> {
+  using type = cudf::list_view;
+};
+
+// MERGE_NUNIQUE estimates int64_t counts from lists of registers
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_NUNIQUE,
+                        std::enable_if_t<std::is_same<Source, cudf::list_view>::value>> {
+  using type = int64_t;
+};
+
+// A t-digest of arithmetic values is a list of centroids
+template <typename Source, aggregation::Kind k>
+struct target_type_impl<
+  Source,
+  k,
+  std::enable_if_t<std::is_arithmetic<Source>::value && (k == aggregation::TDIGEST)>> {
+  using type = cudf::list_view;
+};
+
+// MERGE_TDIGEST merges lists of centroids into lists of centroids
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_TDIGEST,
+                        std::enable_if_t<std::is_same<Source, cudf::list_view>::value>> {
+  using type = cudf::list_view;
+};
+
 // Always use Source for NTH_ELEMENT
 template <typename Source>
 struct target_type_impl<Source, aggregation::NTH_ELEMENT> {
@@ -548,12 +713,42 @@ struct target_type_impl<Source, aggregation::ROW_NUMBER> {
   using type = cudf::size_type;
 };
 
+// RANK and DENSE_RANK rank equality comparable values with size_type
+template <typename Source, aggregation::Kind k>
+struct target_type_impl<
+  Source,
+  k,
+  std::enable_if_t<cudf::is_equality_comparable<Source, Source>() &&
+                   !std::is_same<Source, cudf::dictionary32>::value &&
+                   (k == aggregation::RANK || k == aggregation::DENSE_RANK)>> {
+  using type = cudf::size_type;
+};
+
+// Always use `double` for PERCENT_RANK of equality comparable values
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::PERCENT_RANK,
+                        std::enable_if_t<cudf::is_equality_comparable<Source, Source>() &&
+                                         !std::is_same<Source, cudf::dictionary32>::value>> {
+  using type = double;
+};
+
 // Always use list for COLLECT_LIST
 template <typename Source>
 struct target_type_impl<Source, aggregation::COLLECT_LIST> {
   using type = cudf::list_view;
 };
 
+// TOP_K collects comparable values into a list
+template <typename Source>
+struct target_type_impl<
+  Source,
+  aggregation::TOP_K,
+  std::enable_if_t<cudf::is_relationally_comparable<Source, Source>() &&
+                   !std::is_same<Source, cudf::dictionary32>::value>> {
+  using type = cudf::list_view;
+};
+
 // Always use list for COLLECT_SET
 template <typename Source>
 struct target_type_impl<Source, aggregation::COLLECT_SET> {
@@ -665,6 +860,28 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::LEAD>(std::forward<Ts>(args)...);
     case aggregation::LAG:
       return f.template operator()<aggregation::LAG>(std::forward<Ts>(args)...);
+    case aggregation::M2:
+      return f.template operator()<aggregation::M2>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_M2:
+      return f.template operator()<aggregation::MERGE_M2>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_NUNIQUE:
+      return f.template operator()<aggregation::APPROX_NUNIQUE>(std::forward<Ts>(args)...);
+    case aggregation::TDIGEST:
+      return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_TDIGEST:
+      return f.template operator()<aggregation::MERGE_TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::TOP_K:
+      return f.template operator()<aggregation::TOP_K>(std::forward<Ts>(args)...);
+    case aggregation::RANK:
+      return f.template operator()<aggregation::RANK>(std::forward<Ts>(args)...);
+    case aggregation::DENSE_RANK:
+      return f.template operator()<aggregation::DENSE_RANK>(std::forward<Ts>(args)...);
+    case aggregation::PERCENT_RANK:
+      return f.template operator()<aggregation::PERCENT_RANK>(std::forward<Ts>(args)...);
+    case aggregation::NUNIQUE_SKETCH:
+      return f.template operator()<aggregation::NUNIQUE_SKETCH>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_NUNIQUE:
+      return f.template operator()<aggregation::MERGE_NUNIQUE>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
@@ -64,6 +64,42 @@ std::unique_ptr<column> binary_operation(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::binary_operation(column_view const&, scalar const&, binary_operator,
+ * mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::binary_operation(scalar const&, column_view const&, binary_operator,
+ * mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::binary_operation(column_view const&, column_view const&, binary_operator,
+ * mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::binary_operation(column_view const&, column_view const&,
  * std::string const&, data_type, rmm::mr::device_memory_resource *)
@@ -75,6 +75,17 @@ std::vector<column_view> slice(column_view const& input,
                                std::vector<size_type> const& indices,
                                rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @copydoc cudf::slice(table_view const&,std::vector<size_type> const&)
+ *
+ * The null counts of the slices of all the columns are computed with a single kernel launch.
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<table_view> slice(table_view const& input,
+                              std::vector<size_type> const& indices,
+                              rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::shift(column_view const&,size_type,scalar const&,
  * rmm::mr::device_memory_resource*)
@@ -140,6 +151,27 @@ std::vector<packed_table> contiguous_split(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::contiguous_split_sizes
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::vector<std::size_t> contiguous_split_sizes(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::contiguous_split_into
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::vector<packed_columns::metadata> contiguous_split_into(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  std::vector<device_span<uint8_t>> const& buffers,
+  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::pack
  *
@@ -214,6 +246,61 @@ std::unique_ptr<column> copy_if_else(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::copy_if_else( column_view const&, column_view const&,
+ * bitmask_type const*, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
+  column_view const& rhs,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::copy_if_else( scalar const&, column_view const&,
+ * bitmask_type const*, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> copy_if_else(
+  scalar const& lhs,
+  column_view const& rhs,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::copy_if_else( column_view const&, scalar const&,
+ * bitmask_type const*, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> copy_if_else(
+  column_view const& lhs,
+  scalar const& rhs,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::copy_if_else( table_view const&, table_view const&,
+ * column_view const&, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<table> copy_if_else(
+  table_view const& lhs,
+  table_view const& rhs,
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::copy_if_else( table_view const&, table_view const&,
+ * bitmask_type const*, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<table> copy_if_else(
+  table_view const& lhs,
+  table_view const& rhs,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::sample
  *
@@ -227,6 +314,19 @@ std::unique_ptr<table> sample(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::sample(table_view const&, column_view const&, size_type const,
+ * sample_with_replacement, int64_t const, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<table> sample(
+  table_view const& input,
+  column_view const& weights,
+  size_type const n,
+  sample_with_replacement replacement = sample_with_replacement::FALSE,
+  int64_t const seed                  = 0,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::get_element
  *
@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
@@ -28,6 +29,8 @@
 
 #include <cub/cub.cuh>
 
+#include <thrust/iterator/constant_iterator.h>
+
 #include <cuda_runtime.h>
 
 #include <memory>
@@ -188,6 +191,36 @@ void copy_range(SourceValueIterator source_value_begin,
   CHECK_CUDA(stream.value());
 }
 
+/**
+ * @brief Internal API to write the result of an elementwise operation on @p input into a
+ * caller-provided column.
+ *
+ * Row `i` of @p target is set to *(@p values + i), with the validity of row `i` of @p input.
+ * @p target may view the same elements as @p input when the operation reads row `i` only from the
+ * thread that writes it, which `cudf::detail::expects_elementwise_output` checks.
+ *
+ * @tparam SourceValueIterator Iterator for retrieving the values of the result
+ * @param values Start of the values of the result
+ * @param input The operand whose null mask is the null mask of the result
+ * @param target The column to write into, of the size of @p input and nullable if @p input has
+ * nulls
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename SourceValueIterator>
+void copy_elementwise_result(SourceValueIterator values,
+                             column_view const& input,
+                             mutable_column_view& target,
+                             rmm::cuda_stream_view stream = rmm::cuda_stream_default)
+{
+  if (target.is_empty()) { return; }
+  if (input.has_nulls()) {
+    auto const d_input = column_device_view::create(input, stream);
+    copy_range(values, make_validity_iterator(*d_input), target, 0, target.size(), stream);
+  } else {
+    copy_range(values, thrust::make_constant_iterator(true), target, 0, target.size(), stream);
+  }
+}
+
 /**
  * @copydoc cudf::copy_range_in_place
  * @param stream CUDA stream used for device memory operations and kernel launches.
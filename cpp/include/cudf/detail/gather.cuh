@@ -20,6 +20,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
@@ -606,6 +607,126 @@ void gather_bitmask(table_view const& source,
   }
 }
 
+/**
+ * @brief The source and target data of a column gathered by `gather_fixed_width_columns`.
+ */
+struct fixed_width_gather_column {
+  void const* source;      ///< Data of the source column, from its first row
+  void* target;            ///< Data of the target column
+  size_type element_size;  ///< Size in bytes of an element, 1, 2, 4 or 8
+};
+
+/**
+ * @brief Indicates whether the data of a column of type `T` is gathered by
+ * `gather_fixed_width_columns`.
+ */
+struct is_batch_gatherable_fn {
+  template <typename T>
+  constexpr bool operator()() const noexcept
+  {
+    return is_rep_layout_compatible<T>() and sizeof(T) <= sizeof(int64_t);
+  }
+};
+
+// Minimum number of fixed-width columns of a table gathered by a single kernel
+constexpr std::size_t MIN_BATCHED_GATHER_COLUMNS = 2;
+
+template <typename T>
+__device__ void gather_element(fixed_width_gather_column const& column,
+                               size_type source_row,
+                               size_type target_row)
+{
+  static_cast<T*>(column.target)[target_row] = static_cast<T const*>(column.source)[source_row];
+}
+
+/**
+ * @brief Gathers the data of all the `columns`, a column per `blockIdx.y`.
+ */
+template <typename MapIterator>
+__global__ void gather_fixed_width_columns_kernel(fixed_width_gather_column const* columns,
+                                                  size_type num_columns,
+                                                  MapIterator gather_map,
+                                                  size_type num_rows,
+                                                  size_type source_size,
+                                                  bool nullify_out_of_bounds)
+{
+  using map_type       = typename std::iterator_traits<MapIterator>::value_type;
+  auto in_bounds       = bounds_checker<map_type>{0, source_size};
+  for (size_type c = blockIdx.y; c < num_columns; c += gridDim.y) {
+    auto const column = columns[c];
+    for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < num_rows;
+         row += blockDim.x * gridDim.x) {
+      map_type const source_row = gather_map[row];
+      if (nullify_out_of_bounds and not in_bounds(source_row)) { continue; }
+      switch (column.element_size) {
+        case 1: gather_element<uint8_t>(column, source_row, row); break;
+        case 2: gather_element<uint16_t>(column, source_row, row); break;
+        case 4: gather_element<uint32_t>(column, source_row, row); break;
+        default: gather_element<uint64_t>(column, source_row, row);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Gathers the data of fixed-width columns with a single kernel, instead of a kernel per
+ * column.
+ *
+ * The null masks of the gathered columns are not allocated.
+ *
+ * @param source_columns Columns whose data is gathered, for which `is_batch_gatherable_fn` is true
+ * @param gather_map_begin Beginning of iterator range of integral values representing the gather
+ * map
+ * @param gather_map_end End of iterator range of integral values representing the gather map
+ * @param nullify_out_of_bounds Skip the values in `gather_map` that are out of bounds
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The gathered columns
+ */
+template <typename MapIterator>
+std::vector<std::unique_ptr<column>> gather_fixed_width_columns(
+  table_view const& source_columns,
+  MapIterator gather_map_begin,
+  MapIterator gather_map_end,
+  bool nullify_out_of_bounds,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = cudf::distance(gather_map_begin, gather_map_end);
+  std::vector<std::unique_ptr<column>> targets;
+  std::vector<fixed_width_gather_column> columns;
+  for (auto const& source : source_columns) {
+    targets.push_back(
+      allocate_like(source, num_rows, cudf::mask_allocation_policy::NEVER, stream, mr));
+    auto const element_size = static_cast<size_type>(size_of(source.type()));
+    columns.push_back({source.head<uint8_t>() + source.offset() * element_size,
+                       targets.back()->mutable_view().head(),
+                       element_size});
+  }
+  if (num_rows == 0) { return targets; }
+
+  auto const d_columns = make_device_uvector_async(columns, stream);
+
+  // The rows of a column are gathered by a few blocks of a grid-stride loop, so that the blocks
+  // of all the columns fit in a launch
+  constexpr size_type block_size     = 256;
+  constexpr size_type max_row_blocks = 1024;
+  constexpr size_type max_grid_dim_y = 65535;
+  auto const num_columns             = source_columns.num_columns();
+  dim3 const grid(std::min(util::div_rounding_up_safe(num_rows, block_size), max_row_blocks),
+                  std::min(num_columns, max_grid_dim_y));
+  gather_fixed_width_columns_kernel<<<grid, block_size, 0, stream.value()>>>(
+    d_columns.data(),
+    num_columns,
+    gather_map_begin,
+    num_rows,
+    source_columns.num_rows(),
+    nullify_out_of_bounds);
+  CHECK_CUDA(stream.value());
+
+  return targets;
+}
+
 /**
  * @brief Gathers the specified rows of a set of columns according to a gather map.
  *
@@ -643,21 +764,43 @@ std::unique_ptr<table> gather(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  std::vector<std::unique_ptr<column>> destination_columns;
+  std::vector<std::unique_ptr<column>> destination_columns(source_table.num_columns());
+  auto const nullify_out_of_bounds = bounds_policy == out_of_bounds_policy::NULLIFY;
+
+  // The data of the fixed-width columns of wide tables is gathered by a single kernel
+  std::vector<size_type> batched_columns;
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if (cudf::type_dispatcher<dispatch_storage_type>(source_table.column(i).type(),
+                                                     is_batch_gatherable_fn{})) {
+      batched_columns.push_back(i);
+    }
+  }
+  if (batched_columns.size() >= MIN_BATCHED_GATHER_COLUMNS) {
+    auto batched = gather_fixed_width_columns(source_table.select(batched_columns),
+                                              gather_map_begin,
+                                              gather_map_end,
+                                              nullify_out_of_bounds,
+                                              stream,
+                                              mr);
+    for (std::size_t i = 0; i < batched_columns.size(); ++i) {
+      destination_columns[batched_columns[i]] = std::move(batched[i]);
+    }
+  }
 
   // TODO: Could be beneficial to use streams internally here
 
-  for (auto const& source_column : source_table) {
-    // The data gather for n columns will be put on the first n streams
-    destination_columns.push_back(
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if (destination_columns[i]) { continue; }
+    auto const& source_column = source_table.column(i);
+    destination_columns[i] =
       cudf::type_dispatcher<dispatch_storage_type>(source_column.type(),
                                                    column_gatherer{},
                                                    source_column,
                                                    gather_map_begin,
                                                    gather_map_end,
-                                                   bounds_policy == out_of_bounds_policy::NULLIFY,
+                                                   nullify_out_of_bounds,
                                                    stream,
-                                                   mr));
+                                                   mr);
   }
 
   auto const nullable = bounds_policy == out_of_bounds_policy::NULLIFY ||
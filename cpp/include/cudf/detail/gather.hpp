@@ -67,5 +67,21 @@ std::unique_ptr<table> gather(
   negative_index_policy neg_indices,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::gather(chunked_table_view const&,column_view const&,out_of_bounds_policy,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param[in] negative_index_policy Interpret each negative index `i` in the
+ * gathermap as the positive index `i+num_source_rows`.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> gather(
+  chunked_table_view const& source_table,
+  column_view const& gather_map,
+  out_of_bounds_policy bounds_policy,
+  negative_index_policy neg_indices,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 }  // namespace detail
 }  // namespace cudf
@@ -31,19 +31,27 @@ namespace hash {
  * @brief Indicates if a set of aggregation requests can be satisfied with a
  * hash-based groupby implementation.
  *
+ * If `result_determinism` is `determinism::DETERMINISTIC`, the requests whose results would
+ * depend on the order of the atomic updates of the hash-based groupby cannot be satisfied.
+ *
  * @param keys The table of keys
  * @param requests The set of columns to aggregate and the aggregations to
  * perform
+ * @param result_determinism Whether the results must be the same from run to run
  * @return true A hash-based groupby can be used
  * @return false A hash-based groupby cannot be used
  */
-bool can_use_hash_groupby(table_view const& keys, host_span<aggregation_request const> requests);
+bool can_use_hash_groupby(table_view const& keys,
+                          host_span<aggregation_request const> requests,
+                          determinism result_determinism = determinism::NONDETERMINISTIC);
 
 // Hash-based groupby
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   host_span<aggregation_request const> requests,
   null_policy include_null_keys,
+  std::vector<case_sensitivity> const& key_case,
+  uint32_t const* row_hashes,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr);
 }  // namespace hash
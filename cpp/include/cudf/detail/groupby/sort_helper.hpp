@@ -20,10 +20,13 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace groupby {
 namespace detail {
@@ -57,14 +60,19 @@ struct sort_groupby_helper {
    * @param include_null_keys Include rows in keys with nulls
    * @param keys_pre_sorted Indicate if the keys are already sorted. Enables
    *                        optimizations to help skip re-sorting keys.
+   * @param key_case Indicates whether the strings of each column of `keys` are sorted and
+   *                 compared regardless of the case of their ASCII letters. If empty, all
+   *                 columns are case-sensitive.
    */
   sort_groupby_helper(table_view const& keys,
-                      null_policy include_null_keys = null_policy::EXCLUDE,
-                      sorted keys_pre_sorted        = sorted::NO)
+                      null_policy include_null_keys                 = null_policy::EXCLUDE,
+                      sorted keys_pre_sorted                        = sorted::NO,
+                      std::vector<case_sensitivity> const& key_case = {})
     : _keys(keys),
       _num_keys(-1),
       _keys_pre_sorted(keys_pre_sorted),
-      _include_null_keys(include_null_keys)
+      _include_null_keys(include_null_keys),
+      _key_case(key_case)
   {
     if (keys_pre_sorted == sorted::YES and include_null_keys == null_policy::EXCLUDE and
         has_nulls(keys)) {
@@ -72,6 +80,24 @@ struct sort_groupby_helper {
     }
   };
 
+  /**
+   * @brief Construct a new helper object from keys that are already grouped
+   *
+   * The rows of every group in `keys` must be contiguous, and `group_offsets` must hold the first
+   * row of every group followed by the end of the last group. The groups are used as given, so
+   * the keys are neither sorted nor compared. Rows past the end of the last group are discarded.
+   *
+   * @throw cudf::logic_error if `group_offsets` is empty, doesn't start at 0 or ends past the last
+   * row of `keys`
+   *
+   * @param keys table to group by, grouped
+   * @param group_offsets Offsets of the groups in `keys`, of size `num_groups + 1`
+   * @param stream CUDA stream used to copy the group offsets
+   */
+  sort_groupby_helper(table_view const& keys,
+                      device_span<size_type const> group_offsets,
+                      rmm::cuda_stream_view stream);
+
   ~sort_groupby_helper()                          = default;
   sort_groupby_helper(sort_groupby_helper const&) = delete;
   sort_groupby_helper& operator=(sort_groupby_helper const&) = delete;
@@ -230,6 +256,8 @@ struct sort_groupby_helper {
   size_type _num_keys;      ///< Number of effective rows in _keys (adjusted for _include_null_keys)
   sorted _keys_pre_sorted;  ///< Whether _keys are pre-sorted
   null_policy _include_null_keys;  ///< Whether to use rows with nulls in _keys for grouping
+  std::vector<case_sensitivity> _key_case;  ///< Whether the strings of each column of _keys
+                                            ///< are case-insensitive
 };
 
 }  // namespace sort
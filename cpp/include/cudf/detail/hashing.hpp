@@ -46,6 +46,27 @@ std::unique_ptr<column> md5_hash(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the SHA-1 or SHA-256 hash of each row, depending on `hash_state_type`, as a
+ * lowercase hexadecimal string.
+ *
+ * The hashed message of a row is the concatenation of the bytes of its valid elements from left to
+ * right, struct columns being hashed as their leaf columns.
+ *
+ * @throws cudf::logic_error if a leaf column is neither a string nor a fixed width column
+ *
+ * @param input The table of columns to hash
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A strings column of the hashes of the rows of `input`
+ */
+template <typename hash_state_type>
+std::unique_ptr<column> sha_hash(
+  table_view const& input,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 template <template <typename> class hash_function>
 std::unique_ptr<column> serial_murmur_hash3_32(
   table_view const& input,
@@ -53,5 +74,57 @@ std::unique_ptr<column> serial_murmur_hash3_32(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the Spark-compatible xxHash64 of each row, chaining the hashes of the elements
+ * of a row from left to right starting from `seed`.
+ *
+ * Null elements leave the hash of a row unchanged and struct columns are hashed as their leaf
+ * columns.
+ *
+ * @param input The table of columns to hash
+ * @param seed The hash of a row without valid elements
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns An INT64 column of the hashes of the rows of `input`
+ */
+std::unique_ptr<column> xxhash_64(
+  table_view const& input,
+  uint64_t seed                       = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the 128-bit MurmurHash3_x64_128 of each row, chaining the hashes of the
+ * elements of a row from left to right starting from both halves equal to `seed`.
+ *
+ * Null elements leave the hash of a row unchanged and struct columns are hashed as their leaf
+ * columns.
+ *
+ * @param input The table of columns to hash
+ * @param seed The seed of both 64-bit halves of the hash
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A STRUCT column of two UINT64 columns, the halves `h1` and `h2` of the hashes
+ */
+std::unique_ptr<column> murmur_hash3_x64_128(
+  table_view const& input,
+  uint32_t seed                       = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Checks that `row_hashes` can be used as the precomputed hash values of `num_rows` rows,
+ * e.g. the result of `cudf::hash` with `hash_id::HASH_MURMUR3`.
+ *
+ * @throws cudf::logic_error if `row_hashes` is not an INT32 or UINT32 column of `num_rows`
+ * elements without nulls
+ *
+ * @param row_hashes The hash value of every row
+ * @param num_rows The number of hashed rows
+ */
+void expects_row_hashes(column_view const& row_hashes, size_type num_rows);
+
 }  // namespace detail
 }  // namespace cudf
@@ -46,6 +46,18 @@ DLManagedTensor* to_dlpack(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::to_dlpack(table_view const&, DLManagedTensor*, scalar const&)
+ *
+ * @param null_replacement Value copied for the null elements, or nullptr if the columns must have
+ * no nulls
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void to_dlpack(table_view const& input,
+               DLManagedTensor* output,
+               scalar const* null_replacement,
+               rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 // Creating arrow as per given type_id and buffer arguments
 template <typename... Ts>
 std::shared_ptr<arrow::Array> to_arrow_array(cudf::type_id id, Ts&&... args)
@@ -116,5 +128,31 @@ std::unique_ptr<table> from_arrow(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::to_arrow_device(table_view const&)
+ *
+ * @param stream CUDA stream on which the `sync_event` of the result is recorded.
+ */
+unique_device_array_t to_arrow_device(table_view const& input,
+                                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::to_arrow_device(std::unique_ptr<table>&&)
+ *
+ * @param stream CUDA stream on which the `sync_event` of the result is recorded.
+ */
+unique_device_array_t to_arrow_device(std::unique_ptr<table>&& input,
+                                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::from_arrow_device
+ *
+ * @param stream CUDA stream that waits for the `sync_event` of `input` and is used for device
+ * memory operations.
+ */
+unique_table_view_t from_arrow_device(ArrowSchema const* schema,
+                                      ArrowDeviceArray* input,
+                                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace detail
 }  // namespace cudf
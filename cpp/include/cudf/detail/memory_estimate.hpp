@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/memory_estimate.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+/**
+ * @copydoc cudf::estimate_gather_memory
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+memory_estimate estimate_gather_memory(table_view const& source_table,
+                                       column_view const& gather_map,
+                                       out_of_bounds_policy bounds_policy,
+                                       rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::estimate_sort_memory
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+memory_estimate estimate_sort_memory(table_view const& input,
+                                     rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::estimate_inner_join_memory(table_view const&, table_view const&, null_equality)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+memory_estimate estimate_inner_join_memory(table_view const& left_keys,
+                                           table_view const& right_keys,
+                                           null_equality compare_nulls,
+                                           rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::estimate_inner_join_memory(table_view const&, table_view const&,
+ * std::vector<size_type> const&, std::vector<size_type> const&, null_equality)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+memory_estimate estimate_inner_join_memory(table_view const& left,
+                                           table_view const& right,
+                                           std::vector<size_type> const& left_on,
+                                           std::vector<size_type> const& right_on,
+                                           null_equality compare_nulls,
+                                           rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+}  // namespace detail
+}  // namespace cudf
@@ -19,6 +19,8 @@
 #include <cudf/table/row_operators.cuh>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/device_uvector.hpp>
+
 namespace cudf {
 namespace detail {
 /**
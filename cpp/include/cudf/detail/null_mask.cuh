@@ -22,26 +22,44 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+
+#include <cub/block/block_reduce.cuh>
+
+#include <utility>
 
 namespace cudf {
 namespace detail {
 /**
  * @brief Computes the merger of an array of bitmasks using a binary operator
  *
+ * The number of set bits of the merged words is counted while they are written, so that the null
+ * count of the result doesn't require another pass over it.
+ *
+ * @tparam block_size Number of threads in each thread block
  * @param op The binary operator used to combine the bitmasks
  * @param destination The bitmask to write result into
  * @param source Array of source mask pointers. All masks must be of same size
  * @param source_begin_bits Array of offsets into corresponding @p source masks.
  *                          Must be same size as source array
  * @param source_size_bits Number of bits in each mask in @p source
+ * @param count_ptr Pointer to the counter of the set bits in the first @p source_size_bits bits of
+ * @p destination
  */
-template <typename Binop>
+template <int block_size, typename Binop>
 __global__ void offset_bitmask_binop(Binop op,
                                      device_span<bitmask_type> destination,
                                      device_span<bitmask_type const *> source,
                                      device_span<size_type const> source_begin_bits,
-                                     size_type source_size_bits)
+                                     size_type source_size_bits,
+                                     size_type *count_ptr)
 {
+  constexpr auto const word_size{detail::size_in_bits<bitmask_type>()};
+  auto const last_bit_index      = source_size_bits - 1;
+  auto const last_word_index     = cudf::word_index(last_bit_index);
+  size_type const num_slack_bits = word_size - intra_word_index(last_bit_index) - 1;
+  size_type thread_count{0};
+
   for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
        destination_word_index < destination.size();
        destination_word_index += blockDim.x * gridDim.x) {
@@ -61,17 +79,35 @@ __global__ void offset_bitmask_binop(Binop op,
     }
 
     destination[destination_word_index] = destination_word;
+
+    // The bits past the last bit of the last word are not counted
+    if (destination_word_index == last_word_index and num_slack_bits > 0) {
+      destination_word &= ~set_most_significant_bits(num_slack_bits);
+    }
+    if (destination_word_index <= last_word_index) { thread_count += __popc(destination_word); }
   }
+
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type block_count = BlockReduce(temp_storage).Sum(thread_count);
+
+  if (threadIdx.x == 0) { atomicAdd(count_ptr, block_count); }
 }
 
 /**
- * @copydoc bitmask_binop(Binop op, host_span<bitmask_type const *> const, host_span<size_type>
- * const, size_type, rmm::mr::device_memory_resource *)
+ * @brief Computes the merger of the specified bitmasks using the binary operator provided, and
+ * the null count of the merged bitmask
  *
+ * @param op The binary operator used to combine the bitmasks
+ * @param masks The list of data pointers of the bitmasks to be merged
+ * @param masks_begin_bits The bit offsets from which each mask is to be merged
+ * @param mask_size_bits The number of bits to be merged in each mask
  * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return A pair of the merged bitmask and the number of unset bits in it
  */
 template <typename Binop>
-rmm::device_buffer bitmask_binop(
+std::pair<rmm::device_buffer, size_type> bitmask_binop(
   Binop op,
   host_span<bitmask_type const *> masks,
   host_span<size_type const> masks_begin_bits,
@@ -80,17 +116,17 @@ rmm::device_buffer bitmask_binop(
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource())
 {
   auto dest_mask = rmm::device_buffer{bitmask_allocation_size_bytes(mask_size_bits), stream, mr};
+  auto null_count =
+    inplace_bitmask_binop(op,
+                          device_span<bitmask_type>(static_cast<bitmask_type *>(dest_mask.data()),
+                                                    num_bitmask_words(mask_size_bits)),
+                          masks,
+                          masks_begin_bits,
+                          mask_size_bits,
+                          stream,
+                          mr);
 
-  inplace_bitmask_binop(op,
-                        device_span<bitmask_type>(static_cast<bitmask_type *>(dest_mask.data()),
-                                                  num_bitmask_words(mask_size_bits)),
-                        masks,
-                        masks_begin_bits,
-                        mask_size_bits,
-                        stream,
-                        mr);
-
-  return dest_mask;
+  return std::make_pair(std::move(dest_mask), null_count);
 }
 
 /**
@@ -103,11 +139,11 @@ rmm::device_buffer bitmask_binop(
  * @param masks_begin_bits The bit offsets from which each mask is to be merged
  * @param mask_size_bits The number of bits to be ANDed in each mask
  * @param stream CUDA stream used for device memory operations and kernel launches
- * @param mr Device memory resource used to allocate the returned device_buffer
- * @return rmm::device_buffer Output bitmask
+ * @param mr Device memory resource used to allocate temporary device memory
+ * @return The number of unset bits in the first `mask_size_bits` bits of `dest_mask`
  */
 template <typename Binop>
-void inplace_bitmask_binop(
+size_type inplace_bitmask_binop(
   Binop op,
   device_span<bitmask_type> dest_mask,
   host_span<bitmask_type const *> masks,
@@ -134,11 +170,14 @@ void inplace_bitmask_binop(
                            cudaMemcpyHostToDevice,
                            stream.value()));
 
-  cudf::detail::grid_1d config(dest_mask.size(), 256);
-  offset_bitmask_binop<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-    op, dest_mask, d_masks, d_begin_bits, mask_size_bits);
+  rmm::device_scalar<size_type> d_count{0, stream, mr};
+  constexpr size_type block_size{256};
+  cudf::detail::grid_1d config(dest_mask.size(), block_size);
+  offset_bitmask_binop<block_size>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+      op, dest_mask, d_masks, d_begin_bits, mask_size_bits, d_count.data());
   CHECK_CUDA(stream.value());
-  stream.synchronize();
+  return mask_size_bits - d_count.value(stream);
 }
 
 }  // namespace detail
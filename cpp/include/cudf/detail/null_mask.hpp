@@ -20,6 +20,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -65,6 +66,31 @@ std::vector<size_type> segmented_count_unset_bits(bitmask_type const *bitmask,
                                                   host_span<size_type const> indices,
                                                   rmm::cuda_stream_view stream);
 
+/**
+ * @brief Given a set of bitmasks, counts the number of unset (0) bits of every bitmask in every
+ * range `[indices[2*i], indices[2*i+1])`, with a single kernel launch.
+ *
+ * The ranges of bitmask `m` are shifted by `mask_offsets[m]`, so that the ranges of the rows of
+ * sliced columns may be passed with the null masks and offsets of the columns. A null bitmask has
+ * no unset bits.
+ *
+ * @throws cudf::logic_error if `masks.size() != mask_offsets.size()`
+ * @throws cudf::logic_error if `indices.size() % 2 != 0`
+ * @throws cudf::logic_error if `indices[2*i] < 0 or indices[2*i] > indices[(2*i)+1]`
+ *
+ * @param[in] masks Bitmasks whose bits are counted
+ * @param[in] mask_offsets Bit index of the first row of each bitmask
+ * @param[in] indices An even number of indices specifying the beginning and ending of the ranges
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return The number of unset bits of range `r` of bitmask `m` at index
+ * `m * (indices.size() / 2) + r`
+ */
+std::vector<size_type> batched_segmented_count_unset_bits(
+  host_span<bitmask_type const *const> masks,
+  host_span<size_type const> mask_offsets,
+  host_span<size_type const> indices,
+  rmm::cuda_stream_view stream);
+
 /**
  * @copydoc cudf::copy_bitmask(bitmask_type const*, size_type, size_type,
  *rmm::mr::device_memory_resource*)
@@ -89,12 +115,16 @@ rmm::device_buffer copy_bitmask(
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc bitmask_and(host_span<bitmask_type const *> const, host_span<size_type> const,
- * size_type, rmm::mr::device_memory_resource *)
+ * @brief Performs a bitwise AND of the specified bitmasks
  *
+ * @param masks The list of data pointers of the bitmasks to be ANDed
+ * @param masks_begin_bits The bit offsets from which each mask is to be ANDed
+ * @param mask_size_bits The number of bits to be ANDed in each mask
  * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return A pair of the resulting bitmask and the number of unset bits in it
  */
-rmm::device_buffer bitmask_and(
+std::pair<rmm::device_buffer, size_type> bitmask_and(
   host_span<bitmask_type const *> masks,
   host_span<size_type const> masks_begin_bits,
   size_type mask_size_bits,
@@ -105,8 +135,10 @@ rmm::device_buffer bitmask_and(
  * @copydoc cudf::bitmask_and
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return A pair of the resulting bitmask and its null count, which is computed while the bitmask
+ * is written
  */
-rmm::device_buffer bitmask_and(
+std::pair<rmm::device_buffer, size_type> bitmask_and(
   table_view const &view,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
@@ -115,8 +147,10 @@ rmm::device_buffer bitmask_and(
  * @copydoc cudf::bitmask_or
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return A pair of the resulting bitmask and its null count, which is computed while the bitmask
+ * is written
  */
-rmm::device_buffer bitmask_or(
+std::pair<rmm::device_buffer, size_type> bitmask_or(
   table_view const &view,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
@@ -130,10 +164,10 @@ rmm::device_buffer bitmask_or(
  * @param masks_begin_bits The bit offsets from which each mask is to be ANDed
  * @param mask_size_bits The number of bits to be ANDed in each mask
  * @param stream CUDA stream used for device memory operations and kernel launches
- * @param mr Device memory resource used to allocate the returned device_buffer
- * @return rmm::device_buffer Output bitmask
+ * @param mr Device memory resource used to allocate temporary device memory
+ * @return The number of unset bits in the first `mask_size_bits` bits of `dest_mask`
  */
-void inplace_bitmask_and(
+size_type inplace_bitmask_and(
   device_span<bitmask_type> dest_mask,
   host_span<bitmask_type const *> masks,
   host_span<size_type const> masks_begin_bits,
@@ -18,6 +18,8 @@
 
 #include "nvtx3.hpp"
 
+#include <cudf/detail/utilities/metrics.hpp>
+
 namespace cudf {
 /**
  * @brief Tag type for libcudf's NVTX domain.
@@ -38,7 +40,8 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. The call is also recorded in the metrics registry when
+ * `cudf::metrics_enabled()`.
  *
  * Example:
  * ```
@@ -48,4 +51,6 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * }
  * ```
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                  \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain); \
+  cudf::detail::metrics_scope const cudf_metrics_scope_ { __func__ }
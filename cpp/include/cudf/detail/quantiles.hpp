@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/quantiles.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -35,6 +36,21 @@ std::unique_ptr<column> quantile(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/** @copydoc cudf::quantile(table_view const&,std::vector<double> const&,interpolation,
+ * cudf::sorted,std::vector<null_order> const&,bool,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> quantile(
+  table_view const& input,
+  std::vector<double> const& q,
+  interpolation interp                           = interpolation::LINEAR,
+  cudf::sorted is_input_sorted                   = sorted::NO,
+  std::vector<null_order> const& null_precedence = {},
+  bool exact                                     = true,
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /** @copydoc cudf::quantiles()
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
@@ -49,5 +65,53 @@ std::unique_ptr<table> quantiles(
   rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/** @copydoc cudf::percentile_approx()
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> percentile_approx(
+  lists_column_view const& input,
+  column_view const& percentiles,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Creates a t-digest of the valid values of every group.
+ *
+ * @param values Numeric values, sorted within every group
+ * @param group_labels The group of every value, or empty if all values are in a single group
+ * @param num_groups The number of groups
+ * @param max_centroids The maximum number of centroids of a digest
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of `num_groups` digests of structs of FLOAT64 mean and weight
+ */
+std::unique_ptr<column> group_tdigest(
+  column_view const& values,
+  device_span<size_type const> group_labels,
+  size_type num_groups,
+  int max_centroids,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Merges the t-digests of every group into a single t-digest.
+ *
+ * @param digests Lists column of digests created by `group_tdigest()` or `group_merge_tdigest()`
+ * @param group_labels The group of every digest, or empty if all digests are in a single group
+ * @param num_groups The number of groups
+ * @param max_centroids The maximum number of centroids of a merged digest
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of `num_groups` merged digests
+ */
+std::unique_ptr<column> group_merge_tdigest(
+  column_view const& digests,
+  device_span<size_type const> group_labels,
+  size_type num_groups,
+  int max_centroids,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
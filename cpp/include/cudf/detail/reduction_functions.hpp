@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace cudf {
 namespace reduction {
 /**
@@ -254,5 +258,44 @@ std::unique_ptr<scalar> nth_element(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Indicates whether `fused_reduce` computes the reduction of a column of type
+ * `input_dtype` by `agg` into a scalar of type `output_dtype`.
+ *
+ * `sum`, `min`, `max`, `any`, `all`, `sum_of_squares`, `mean`, `var` and `std` of non-boolean
+ * numeric columns are supported, with the output types accepted by their single reductions.
+ *
+ * @param input_dtype data type of the input column
+ * @param agg aggregation of the reduction
+ * @param output_dtype data type of the result of the reduction
+ * @return true if `fused_reduce` supports the reduction
+ */
+bool is_fused_reduction(data_type const input_dtype,
+                        aggregation const& agg,
+                        data_type const output_dtype);
+
+/**
+ * @brief Computes several reductions of the elements in input column in a single pass
+ *
+ * The elements of the column are read once for all reductions, and the results are those of
+ * the single reductions, except that the sums of `FLOAT32` columns are accumulated in double
+ * precision. If all elements in input column are null, the output scalars are null.
+ *
+ * @throw cudf::logic_error if `is_fused_reduction` is false for any of the reductions
+ *
+ * @param col input column to reduce
+ * @param aggs aggregations of the reductions
+ * @param output_dtypes data types of the results of the reductions
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @return One scalar per aggregation
+ */
+std::vector<std::unique_ptr<scalar>> fused_reduce(
+  column_view const& col,
+  std::vector<aggregation const*> const& aggs,
+  std::vector<data_type> const& output_dtypes,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace reduction
 }  // namespace cudf
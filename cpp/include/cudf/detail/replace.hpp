@@ -21,6 +21,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -48,6 +49,26 @@ std::unique_ptr<column> replace_nulls(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::replace_nulls(column_view const&, column_view const&, mutable_column_view&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void replace_nulls(column_view const& input,
+                   column_view const& replacement,
+                   mutable_column_view& output,
+                   rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::replace_nulls(column_view const&, scalar const&, mutable_column_view&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void replace_nulls(column_view const& input,
+                   scalar const& replacement,
+                   mutable_column_view& output,
+                   rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::replace_nulls(column_view const&, replace_policy const&,
  * rmm::mr::device_memory_resource*)
@@ -60,6 +81,18 @@ std::unique_ptr<column> replace_nulls(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::replace_nulls(table_view const&, std::vector<null_replacement> const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<null_replacement> const& replacements,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::replace_nans(column_view const&, column_view const&,
  * rmm::mr::device_memory_resource*)
@@ -21,6 +21,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <utility>
 
 namespace cudf {
 namespace detail {
@@ -34,5 +35,28 @@ std::unique_ptr<table> tile(
   size_type count,
   rmm::cuda_stream_view               = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::melt
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<table> melt(
+  table_view const& id_columns,
+  table_view const& value_columns,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::pivot
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> pivot(
+  table_view const& index,
+  column_view const& columns,
+  column_view const& values,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 }  // namespace detail
 }  // namespace cudf
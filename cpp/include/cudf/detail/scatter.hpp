@@ -141,5 +141,29 @@ std::unique_ptr<table> boolean_mask_scatter(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::boolean_mask_scatter(table_view const&, table_view const&,
+ *                                     bitmask_type const*, rmm::cuda_stream_view,
+ *                                     rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<table> boolean_mask_scatter(
+  table_view const& source,
+  table_view const& target,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::boolean_mask_scatter(std::vector<std::reference_wrapper<const scalar>> const&,
+ *                                     table_view const&, bitmask_type const*,
+ *                                     rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<table> boolean_mask_scatter(
+  std::vector<std::reference_wrapper<const scalar>> const& source,
+  table_view const& target,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -37,6 +37,7 @@ std::unique_ptr<column> lower_bound(
   table_view const& values,
   std::vector<order> const& column_order,
   std::vector<null_order> const& null_precedence,
+  sorted values_sorted                = sorted::NO,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
@@ -50,6 +51,7 @@ std::unique_ptr<column> upper_bound(
   table_view const& values,
   std::vector<order> const& column_order,
   std::vector<null_order> const& null_precedence,
+  sorted values_sorted                = sorted::NO,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
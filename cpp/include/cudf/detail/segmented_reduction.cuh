@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cub/device/device_segmented_reduce.cuh>
+
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace cudf {
+namespace reduction {
+namespace detail {
+/**
+ * @brief Compute the specified simple reduction over each of the segments of the input range of
+ * elements.
+ *
+ * The segment `i` is the range `[d_in + d_offset_begin[i], d_in + d_offset_begin[i + 1])`, and
+ * the reduction of an empty segment is `identity`.
+ *
+ * @param[in] d_in           the begin iterator of the elements
+ * @param[in] d_offset_begin the begin iterator of the segment offsets
+ * @param[in] d_offset_end   the end iterator of the segment offsets
+ * @param[out] d_out         the begin iterator of the reductions of the segments
+ * @param[in] binary_op      the reduction operator
+ * @param[in] identity       the identity value of the reduction operator
+ * @param[in] stream         CUDA stream used for device memory operations and kernel launches.
+ *
+ * @tparam InputIterator    the input column iterator
+ * @tparam OffsetIterator   the offset iterator
+ * @tparam OutputIterator   the output iterator
+ * @tparam BinaryOp         the device binary operator
+ * @tparam OutputType       the output type of reduction
+ */
+template <typename InputIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename BinaryOp,
+          typename OutputType = typename thrust::iterator_value<OutputIterator>::type>
+void segmented_reduce(InputIterator d_in,
+                      OffsetIterator d_offset_begin,
+                      OffsetIterator d_offset_end,
+                      OutputIterator d_out,
+                      BinaryOp binary_op,
+                      OutputType identity,
+                      rmm::cuda_stream_view stream)
+{
+  auto const num_segments =
+    static_cast<size_type>(thrust::distance(d_offset_begin, d_offset_end)) - 1;
+
+  // Allocate temporary storage
+  size_t temp_storage_bytes = 0;
+  cub::DeviceSegmentedReduce::Reduce(nullptr,
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     d_offset_begin,
+                                     d_offset_begin + 1,
+                                     binary_op,
+                                     identity,
+                                     stream.value());
+  auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+
+  // Run reduction
+  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     d_offset_begin,
+                                     d_offset_begin + 1,
+                                     binary_op,
+                                     identity,
+                                     stream.value());
+}
+
+}  // namespace detail
+}  // namespace reduction
+}  // namespace cudf
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace reduction {
+/**
+ * @brief Computes the sum of the elements of each segment of the input column
+ *
+ * If a segment has no valid elements, or has a null element when nulls are included, its sum is
+ * null.
+ *
+ * @throw cudf::logic_error if input column type is not numeric
+ * @throw cudf::logic_error if `output_dtype` is not numeric
+ *
+ * @param col input column to compute the sums of
+ * @param offsets offsets of the segments of `col`
+ * @param output_dtype data type of return type and typecast elements of input column
+ * @param null_handling whether the nulls are skipped or make the sum of their segment null
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Sums of the segments as a column of type `output_dtype`.
+ */
+std::unique_ptr<column> segmented_sum(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the minimum of the elements of each segment of the input column
+ *
+ * If a segment has no valid elements, or has a null element when nulls are included, its minimum
+ * is null.
+ *
+ * @throw cudf::logic_error if input column type is not fixed-width
+ * @throw cudf::logic_error if input column type is not `output_dtype`
+ *
+ * @param col input column to compute the minimums of
+ * @param offsets offsets of the segments of `col`
+ * @param output_dtype data type of return type, which must be the type of the input column
+ * @param null_handling whether the nulls are skipped or make the minimum of their segment null
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Minimums of the segments as a column of type `output_dtype`.
+ */
+std::unique_ptr<column> segmented_min(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the maximum of the elements of each segment of the input column
+ *
+ * If a segment has no valid elements, or has a null element when nulls are included, its maximum
+ * is null.
+ *
+ * @throw cudf::logic_error if input column type is not fixed-width
+ * @throw cudf::logic_error if input column type is not `output_dtype`
+ *
+ * @param col input column to compute the maximums of
+ * @param offsets offsets of the segments of `col`
+ * @param output_dtype data type of return type, which must be the type of the input column
+ * @param null_handling whether the nulls are skipped or make the maximum of their segment null
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Maximums of the segments as a column of type `output_dtype`.
+ */
+std::unique_ptr<column> segmented_max(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes whether any element of each segment of the input column is true when
+ * typecasted to bool
+ *
+ * If a segment has no valid elements, or has a null element when nulls are included, its result
+ * is null.
+ *
+ * @throw cudf::logic_error if input column type is not numeric
+ * @throw cudf::logic_error if `output_dtype` is not `BOOL8`
+ *
+ * @param col input column to compute any of
+ * @param offsets offsets of the segments of `col`
+ * @param output_dtype data type of return type, which must be `BOOL8`
+ * @param null_handling whether the nulls are skipped or make the result of their segment null
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return `BOOL8` column of the results of the segments
+ */
+std::unique_ptr<column> segmented_any(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes whether all elements of each segment of the input column are true when
+ * typecasted to bool
+ *
+ * If a segment has no valid elements, or has a null element when nulls are included, its result
+ * is null.
+ *
+ * @throw cudf::logic_error if input column type is not numeric
+ * @throw cudf::logic_error if `output_dtype` is not `BOOL8`
+ *
+ * @param col input column to compute all of
+ * @param offsets offsets of the segments of `col`
+ * @param output_dtype data type of return type, which must be `BOOL8`
+ * @param null_handling whether the nulls are skipped or make the result of their segment null
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return `BOOL8` column of the results of the segments
+ */
+std::unique_ptr<column> segmented_all(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the mean of the elements of each segment of the input column
+ *
+ * If a segment has no valid elements, or has a null element when nulls are included, its mean is
+ * null.
+ *
+ * @throw cudf::logic_error if input column type is not numeric
+ * @throw cudf::logic_error if `output_dtype` is not floating point
+ *
+ * @param col input column to compute the means of
+ * @param offsets offsets of the segments of `col`
+ * @param output_dtype data type of return type, which must be floating point
+ * @param null_handling whether the nulls are skipped or make the mean of their segment null
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Means of the segments as a column of type `output_dtype`.
+ */
+std::unique_ptr<column> segmented_mean(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace reduction
+}  // namespace cudf
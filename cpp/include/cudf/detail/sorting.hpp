@@ -50,6 +50,28 @@ std::unique_ptr<column> stable_sorted_order(
   rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::sorted_order(table_view,std::vector<order> const&,std::vector<null_order> const&,std::vector<case_sensitivity> const&,rmm::cuda_stream_view,rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> sorted_order(
+  table_view input,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  std::vector<case_sensitivity> const& key_case,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::stable_sorted_order(table_view,std::vector<order> const&,std::vector<null_order> const&,std::vector<case_sensitivity> const&,rmm::cuda_stream_view,rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> stable_sorted_order(
+  table_view input,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  std::vector<case_sensitivity> const& key_case,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::sort_by_key
  *
@@ -63,6 +85,19 @@ std::unique_ptr<table> sort_by_key(
   rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::top_k
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::segmented_sorted_order
  *
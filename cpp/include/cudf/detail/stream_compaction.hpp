@@ -19,6 +19,7 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -51,7 +52,8 @@ std::unique_ptr<table> drop_nans(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::apply_boolean_mask
+ * @copydoc cudf::apply_boolean_mask(table_view const&, column_view const&,
+ *                                   rmm::mr::device_memory_resource*)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -61,6 +63,18 @@ std::unique_ptr<table> apply_boolean_mask(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::apply_boolean_mask(table_view const&, bitmask_type const*,
+ *                                   rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> apply_boolean_mask(
+  table_view const& input,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::drop_duplicates
  *
@@ -75,6 +89,19 @@ std::unique_ptr<table> drop_duplicates(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::distinct
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  duplicate_keep_option keep          = duplicate_keep_option::KEEP_FIRST,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::distinct_count(column_view const&, null_policy, nan_policy)
  *
@@ -94,5 +121,90 @@ cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal    = null_equality::EQUAL,
                                rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Estimates the number of distinct values of every group of `values` with HyperLogLog.
+ *
+ * Every group has `2^precision` one-byte registers, which every row of the group updates with
+ * the 64-bit hash of its value. The relative standard error of the estimates is about
+ * `1.04 / sqrt(2^precision)`. Small cardinalities, for which the raw estimate is biased, are
+ * estimated by linear counting of the empty registers.
+ *
+ * @throw cudf::logic_error if `precision` is not in `[4, 18]`
+ * @throw cudf::logic_error if `values` is of a nested type
+ *
+ * @param values The values to count the distinct values of
+ * @param group_indices The group in `[0, num_groups)` of every row of `values`, or a negative
+ * index for rows in no group. If empty, all the rows are in a single group.
+ * @param num_groups The number of groups
+ * @param null_handling If `INCLUDE`, nulls are counted as a distinct value, else they are skipped
+ * @param precision The number of bits of the hash that index the registers of a group
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return INT64 column of the estimates of the groups
+ */
+std::unique_ptr<column> approx_distinct_count(
+  column_view const& values,
+  device_span<size_type const> group_indices,
+  size_type num_groups,
+  null_policy null_handling,
+  int32_t precision,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Builds the HyperLogLog sketch of the distinct values of every group of `values`.
+ *
+ * The sketch of a group is the list of its `2^precision` UINT8 registers, updated as in
+ * `approx_distinct_count`. Sketches of subsets of the values of a group can be merged into the
+ * estimate of its distinct count by `merge_approx_distinct_count`.
+ *
+ * @throw cudf::logic_error if `precision` is not in `[4, 18]`
+ * @throw cudf::logic_error if `values` is of a nested type
+ *
+ * @param values The values to sketch the distinct values of
+ * @param group_indices The group in `[0, num_groups)` of every row of `values`, or a negative
+ * index for rows in no group. If empty, all the rows are in a single group.
+ * @param num_groups The number of groups
+ * @param null_handling If `INCLUDE`, nulls are counted as a distinct value, else they are skipped
+ * @param precision The number of bits of the hash that index the registers of a group
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return LIST<UINT8> column of the sketches of the groups
+ */
+std::unique_ptr<column> approx_distinct_count_sketch(
+  column_view const& values,
+  device_span<size_type const> group_indices,
+  size_type num_groups,
+  null_policy null_handling,
+  int32_t precision,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Estimates the number of distinct values of every group from HyperLogLog sketches.
+ *
+ * The registers of the sketches of a group are merged by their elementwise maximum, which is
+ * the sketch of the union of their values, and the distinct count is estimated from the merged
+ * registers. Null sketches are ignored, and groups without any valid sketch are estimated at 0.
+ *
+ * @throw cudf::logic_error if `sketches` is not a LIST<UINT8> column
+ * @throw cudf::logic_error if the valid sketches don't all have the same number of registers, a
+ * power of 2 in `[2^4, 2^18]`
+ *
+ * @param sketches Sketches created by `approx_distinct_count_sketch`
+ * @param group_indices The group in `[0, num_groups)` of every sketch, or a negative index for
+ * sketches in no group. If empty, all the sketches are in a single group.
+ * @param num_groups The number of groups
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return INT64 column of the estimates of the groups
+ */
+std::unique_ptr<column> merge_approx_distinct_count(
+  column_view const& sketches,
+  device_span<size_type const> group_indices,
+  size_type num_groups,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -61,7 +61,8 @@ std::unique_ptr<column> true_if(
 }
 
 /**
- * @copydoc cudf::unary_operation
+ * @copydoc cudf::unary_operation(column_view const&, unary_operator,
+ * rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -72,7 +73,17 @@ std::unique_ptr<cudf::column> unary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::cast
+ * @copydoc cudf::unary_operation(column_view const&, unary_operator, mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void unary_operation(cudf::column_view const& input,
+                     cudf::unary_operator op,
+                     cudf::mutable_column_view& output,
+                     rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::cast(column_view const&, data_type, rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -82,6 +93,15 @@ std::unique_ptr<column> cast(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::cast(column_view const&, mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void cast(column_view const& input,
+          mutable_column_view& output,
+          rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::is_nan
  *
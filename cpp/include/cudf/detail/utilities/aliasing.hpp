@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <climits>
+#include <cstdint>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns whether the byte ranges `[a, a + a_size)` and `[b, b + b_size)` overlap.
+ */
+inline bool memory_overlaps(void const* a, std::size_t a_size, void const* b, std::size_t b_size)
+{
+  auto const a_begin = reinterpret_cast<std::uintptr_t>(a);
+  auto const b_begin = reinterpret_cast<std::uintptr_t>(b);
+  return a_begin < b_begin + b_size and b_begin < a_begin + a_size;
+}
+
+/**
+ * @brief Returns whether the fixed-width column `output` can be written elementwise from `input`.
+ *
+ * The elementwise operations write row `i` of the output only after reading row `i` of their
+ * inputs, in the same thread. The output can thus view the same elements as an input when the
+ * elements have the same width, as when an operation is applied in place, but must not overlap
+ * them otherwise. Likewise, the null masks must not overlap unless `mask_may_alias` is true and
+ * the views start at the same bit of the same mask.
+ *
+ * @param input Fixed-width column read elementwise
+ * @param output Fixed-width column written elementwise
+ * @param mask_may_alias Whether the operation supports an output null mask that is the null mask
+ * of `input`
+ * @return true if writing `output` does not overwrite rows of `input` before they are read
+ */
+inline bool is_elementwise_alias_safe(column_view const& input,
+                                      mutable_column_view const& output,
+                                      bool mask_may_alias = true)
+{
+  if (input.is_empty() or output.is_empty()) { return true; }
+
+  auto const input_width  = size_of(input.type());
+  auto const output_width = size_of(output.type());
+  auto const input_data   = input.head<char>() + input.offset() * input_width;
+  auto const output_data  = output.head<char>() + output.offset() * output_width;
+  auto const same_data    = input_data == output_data and input_width == output_width;
+  if (not same_data and memory_overlaps(input_data,
+                                        input.size() * input_width,
+                                        output_data,
+                                        output.size() * output_width)) {
+    return false;
+  }
+
+  if (not input.nullable() or not output.nullable()) { return true; }
+  if (mask_may_alias and input.null_mask() == output.null_mask() and
+      input.offset() == output.offset()) {
+    return true;
+  }
+
+  // Each view reads or writes the words of its mask that hold the bits of its rows
+  constexpr size_type word_bits = sizeof(bitmask_type) * CHAR_BIT;
+  auto mask_words               = [](auto const& view) {
+    auto const first_word = view.offset() / word_bits;
+    auto const last_word  = (view.offset() + view.size() - 1) / word_bits;
+    return std::make_pair(view.null_mask() + first_word,
+                          (last_word - first_word + 1) * sizeof(bitmask_type));
+  };
+  auto const input_words  = mask_words(input);
+  auto const output_words = mask_words(output);
+  return not memory_overlaps(
+    input_words.first, input_words.second, output_words.first, output_words.second);
+}
+
+/**
+ * @brief Throws if `output` cannot receive the elementwise result of an operation on `input`.
+ *
+ * @throw cudf::logic_error if `output` does not have the size of `input`
+ * @throw cudf::logic_error if `input` has nulls but `output` is not nullable
+ * @throw cudf::logic_error if writing `output` could overwrite rows of `input` before they are
+ * read, see `is_elementwise_alias_safe()`
+ *
+ * @param input Fixed-width column read elementwise
+ * @param output Fixed-width column written elementwise
+ */
+inline void expects_elementwise_output(column_view const& input, mutable_column_view const& output)
+{
+  CUDF_EXPECTS(input.size() == output.size(), "Output size must match the input size");
+  CUDF_EXPECTS(output.nullable() or not input.has_nulls(),
+               "Output must be nullable if the input has nulls");
+  CUDF_EXPECTS(is_elementwise_alias_safe(input, output),
+               "Output overlaps the input without viewing the same elements");
+}
+
+}  // namespace detail
+}  // namespace cudf
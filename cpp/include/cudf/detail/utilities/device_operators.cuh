@@ -28,6 +28,8 @@
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
+#include <cuda/std/limits>
+
 #include <type_traits>
 
 namespace cudf {
@@ -98,7 +100,12 @@ struct DeviceMin {
                               !cudf::is_dictionary<T>() && !cudf::is_fixed_point<T>()>* = nullptr>
   static constexpr T identity()
   {
-    return std::numeric_limits<T>::max();
+    // `std::numeric_limits` is not specialized for `__int128_t` outside of GNU extensions
+    if constexpr (std::is_same<T, __int128_t>::value) {
+      return cuda::std::numeric_limits<T>::max();
+    } else {
+      return std::numeric_limits<T>::max();
+    }
   }
 
   template <typename T, typename std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
@@ -137,7 +144,11 @@ struct DeviceMax {
                               !cudf::is_dictionary<T>() && !cudf::is_fixed_point<T>()>* = nullptr>
   static constexpr T identity()
   {
-    return std::numeric_limits<T>::lowest();
+    if constexpr (std::is_same<T, __int128_t>::value) {
+      return cuda::std::numeric_limits<T>::lowest();
+    } else {
+      return std::numeric_limits<T>::lowest();
+    }
   }
 
   template <typename T, typename std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
@@ -219,4 +230,13 @@ struct DeviceLeadLag {
   explicit CUDA_HOST_DEVICE_CALLABLE DeviceLeadLag(size_type offset_) : row_offset(offset_) {}
 };
 
+/**
+ * @brief Operator for calculating Variance/Std window functions.
+ */
+struct DeviceStdVar {
+  const size_type ddof;
+
+  explicit CUDA_HOST_DEVICE_CALLABLE DeviceStdVar(size_type ddof_) : ddof(ddof_) {}
+};
+
 }  // namespace cudf
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Host staging memory and device memory for the descriptors of column and table device
+ * views.
+ *
+ * The memory comes from a process-wide cache of blocks, so that creating a device view for each
+ * call of an operation does not allocate device memory nor pageable staging memory. A block goes
+ * back to the cache when its storage is destroyed, and is reused once the work enqueued on the
+ * storage's stream at that time has completed. The host and device memory of a block are aligned
+ * to 256 bytes, so a descriptor has the same offset in both.
+ *
+ * The device memory of a block is allocated from the current device memory resource, and a block
+ * is only reused while that resource is current. The idle blocks are bounded by a total number of
+ * bytes, see `set_device_view_storage_cache_limit`; they must be flushed with
+ * `flush_device_view_storage_cache` before a resource that allocated them is destroyed.
+ */
+class device_view_storage {
+ public:
+  /**
+   * @brief Acquires storage of at least `size` bytes for device views used on `stream`.
+   *
+   * @param size Number of bytes of the descriptors
+   * @param stream CUDA stream on which the descriptors are copied and used
+   */
+  device_view_storage(std::size_t size, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the memory to the cache, to be reused after the work on the stream completes.
+   */
+  ~device_view_storage();
+
+  device_view_storage(device_view_storage const&) = delete;
+  device_view_storage& operator=(device_view_storage const&) = delete;
+
+  /**
+   * @brief Returns the pinned host memory in which the descriptors are built.
+   */
+  void* host_data() const noexcept;
+
+  /**
+   * @brief Returns the device memory to which the descriptors are copied.
+   */
+  void* device_data() const noexcept;
+
+  /**
+   * @brief Copies `size` bytes at `offset` from the host memory to the device memory, and waits
+   * for the copy so that the device views can be used on any stream.
+   */
+  void copy_to_device(std::size_t offset, std::size_t size) const;
+
+  struct block;
+
+ private:
+  block* _block;
+  rmm::cuda_stream_view _stream;
+};
+
+/**
+ * @brief Sets the maximum number of bytes of idle device view storage kept for reuse, and frees
+ * the idle blocks beyond it.
+ *
+ * The limit applies to the device memory of the blocks of all devices; each block also holds the
+ * same number of bytes of pinned host memory. A limit of 0 disables the cache.
+ *
+ * @param bytes Maximum number of bytes of the idle blocks
+ * @return The previous limit
+ */
+std::size_t set_device_view_storage_cache_limit(std::size_t bytes);
+
+/**
+ * @brief Frees all the idle blocks of device view storage.
+ *
+ * Waits for the work that used them on their last stream to complete.
+ */
+void flush_device_view_storage_cache();
+
+}  // namespace detail
+}  // namespace cudf
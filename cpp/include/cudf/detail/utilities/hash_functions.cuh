@@ -23,6 +23,8 @@
 #include <cudf/types.hpp>
 #include <hash/hash_constants.hpp>
 
+#include <cstring>
+
 using hash_value_type = uint32_t;
 
 namespace cudf {
@@ -110,6 +112,167 @@ void CUDA_DEVICE_CALLABLE md5_process(TKey const& key, md5_intermediate_data* ha
   }
 }
 
+/**
+ * @brief Loads the big-endian 32-bit word at `data`, which need not be aligned
+ */
+uint32_t CUDA_DEVICE_CALLABLE load_big_endian(uint8_t const* data)
+{
+  uint32_t word;
+  std::memcpy(&word, data, 4);
+  return __byte_perm(word, 0, 0x0123);
+}
+
+uint32_t CUDA_DEVICE_CALLABLE rotate_right(uint32_t x, int r) { return __funnelshift_r(x, x, r); }
+
+/**
+ * @brief Core SHA-1 algorithm implementation. Processes a single 512-bit chunk,
+ * updating the hash value so far. Does not zero out the buffer contents.
+ */
+void CUDA_DEVICE_CALLABLE sha_hash_step(sha1_intermediate_data* hash_state)
+{
+  // The message schedule is kept as a ring of the last 16 words
+  uint32_t W[16];
+  for (int i = 0; i < 16; i++) {
+    W[i] = load_big_endian(hash_state->buffer + i * 4);
+  }
+
+  uint32_t A = hash_state->hash_value[0];
+  uint32_t B = hash_state->hash_value[1];
+  uint32_t C = hash_state->hash_value[2];
+  uint32_t D = hash_state->hash_value[3];
+  uint32_t E = hash_state->hash_value[4];
+
+  for (int j = 0; j < 80; j++) {
+    if (j >= 16) {
+      auto const w = W[(j + 13) & 15] ^ W[(j + 8) & 15] ^ W[(j + 2) & 15] ^ W[j & 15];
+      W[j & 15]    = __funnelshift_l(w, w, 1);
+    }
+    uint32_t F;
+    uint32_t K;
+    switch (j / 20) {
+      case 0:
+        F = (B & C) | ((~B) & D);
+        K = 0x5a827999;
+        break;
+      case 1:
+        F = B ^ C ^ D;
+        K = 0x6ed9eba1;
+        break;
+      case 2:
+        F = (B & C) | (B & D) | (C & D);
+        K = 0x8f1bbcdc;
+        break;
+      case 3:
+        F = B ^ C ^ D;
+        K = 0xca62c1d6;
+        break;
+    }
+
+    uint32_t const T = __funnelshift_l(A, A, 5) + F + E + K + W[j & 15];
+    E                = D;
+    D                = C;
+    C                = __funnelshift_l(B, B, 30);
+    B                = A;
+    A                = T;
+  }
+
+  hash_state->hash_value[0] += A;
+  hash_state->hash_value[1] += B;
+  hash_state->hash_value[2] += C;
+  hash_state->hash_value[3] += D;
+  hash_state->hash_value[4] += E;
+
+  hash_state->buffer_length = 0;
+}
+
+/**
+ * @brief Core SHA-256 algorithm implementation. Processes a single 512-bit chunk,
+ * updating the hash value so far. Does not zero out the buffer contents.
+ */
+void CUDA_DEVICE_CALLABLE sha_hash_step(sha256_intermediate_data* hash_state)
+{
+  // The message schedule is kept as a ring of the last 16 words
+  uint32_t W[16];
+  for (int i = 0; i < 16; i++) {
+    W[i] = load_big_endian(hash_state->buffer + i * 4);
+  }
+
+  uint32_t A = hash_state->hash_value[0];
+  uint32_t B = hash_state->hash_value[1];
+  uint32_t C = hash_state->hash_value[2];
+  uint32_t D = hash_state->hash_value[3];
+  uint32_t E = hash_state->hash_value[4];
+  uint32_t F = hash_state->hash_value[5];
+  uint32_t G = hash_state->hash_value[6];
+  uint32_t H = hash_state->hash_value[7];
+
+  for (int j = 0; j < 64; j++) {
+    if (j >= 16) {
+      auto const w15 = W[(j + 1) & 15];
+      auto const w2  = W[(j + 14) & 15];
+      auto const s0  = rotate_right(w15, 7) ^ rotate_right(w15, 18) ^ (w15 >> 3);
+      auto const s1  = rotate_right(w2, 17) ^ rotate_right(w2, 19) ^ (w2 >> 10);
+      W[j & 15] += s0 + W[(j + 9) & 15] + s1;
+    }
+
+    auto const S1 = rotate_right(E, 6) ^ rotate_right(E, 11) ^ rotate_right(E, 25);
+    auto const T1 = H + S1 + ((E & F) ^ ((~E) & G)) + sha256_hash_constants[j] + W[j & 15];
+    auto const S0 = rotate_right(A, 2) ^ rotate_right(A, 13) ^ rotate_right(A, 22);
+    auto const T2 = S0 + ((A & B) ^ (A & C) ^ (B & C));
+    H             = G;
+    G             = F;
+    F             = E;
+    E             = D + T1;
+    D             = C;
+    C             = B;
+    B             = A;
+    A             = T1 + T2;
+  }
+
+  hash_state->hash_value[0] += A;
+  hash_state->hash_value[1] += B;
+  hash_state->hash_value[2] += C;
+  hash_state->hash_value[3] += D;
+  hash_state->hash_value[4] += E;
+  hash_state->hash_value[5] += F;
+  hash_state->hash_value[6] += G;
+  hash_state->hash_value[7] += H;
+
+  hash_state->buffer_length = 0;
+}
+
+/**
+ * @brief Appends `len` bytes starting at `data` to the message hashed by `hash_state`
+ */
+template <typename hash_state_type>
+void CUDA_DEVICE_CALLABLE sha_process_bytes(uint8_t const* data,
+                                            uint32_t len,
+                                            hash_state_type* hash_state)
+{
+  hash_state->message_length += len;
+
+  // 64 bytes for the number of bytes processed in a given step
+  constexpr uint32_t sha_chunk_size = 64;
+  if (hash_state->buffer_length + len < sha_chunk_size) {
+    thrust::copy_n(thrust::seq, data, len, hash_state->buffer + hash_state->buffer_length);
+    hash_state->buffer_length += len;
+  } else {
+    uint32_t copylen = sha_chunk_size - hash_state->buffer_length;
+    thrust::copy_n(thrust::seq, data, copylen, hash_state->buffer + hash_state->buffer_length);
+    sha_hash_step(hash_state);
+
+    // Whole chunks are hashed from the buffer so that the buffer never ends up full
+    while (len >= sha_chunk_size + copylen) {
+      thrust::copy_n(thrust::seq, data + copylen, sha_chunk_size, hash_state->buffer);
+      sha_hash_step(hash_state);
+      copylen += sha_chunk_size;
+    }
+
+    thrust::copy_n(thrust::seq, data + copylen, len - copylen, hash_state->buffer);
+    hash_state->buffer_length = len - copylen;
+  }
+}
+
 /**
  * Normalization of floating point NANs and zeros helper
  */
@@ -361,6 +524,99 @@ void CUDA_DEVICE_CALLABLE MD5Hash::operator()<list_view>(column_device_view col,
                         offsets.element<size_type>(row_index + 1),
                         hash_state);
 }
+
+/**
+ * @brief SHA-1 or SHA-256 hash of the concatenated bytes of the elements of a row, depending on
+ * `hash_state_type`.
+ *
+ * Elements are hashed as their bytes in memory, except that both zeros and all NaNs of floating
+ * point values are hashed alike.
+ */
+template <typename hash_state_type>
+struct SHAHash {
+  // Number of hexadecimal characters of a hash
+  static constexpr int digest_size = 2 * sizeof(hash_state_type::hash_value);
+
+  void __device__ finalize(hash_state_type* hash_state, char* result_location) const
+  {
+    auto const full_length = (static_cast<uint64_t>(hash_state->message_length)) << 3;
+    thrust::fill_n(thrust::seq, hash_state->buffer + hash_state->buffer_length, 1, 0x80);
+
+    // 64 bytes for the number of bytes processed in a given step
+    constexpr int sha_chunk_size = 64;
+    // 8 bytes for the total message length, appended to the end of the last chunk processed
+    constexpr int message_length_size = 8;
+    // 1 byte for the end of the message flag
+    constexpr int end_of_message_size = 1;
+    if (hash_state->buffer_length + message_length_size + end_of_message_size <= sha_chunk_size) {
+      thrust::fill_n(
+        thrust::seq,
+        hash_state->buffer + hash_state->buffer_length + 1,
+        (sha_chunk_size - message_length_size - end_of_message_size - hash_state->buffer_length),
+        0x00);
+    } else {
+      thrust::fill_n(thrust::seq,
+                     hash_state->buffer + hash_state->buffer_length + 1,
+                     (sha_chunk_size - end_of_message_size - hash_state->buffer_length),
+                     0x00);
+      sha_hash_step(hash_state);
+
+      thrust::fill_n(thrust::seq, hash_state->buffer, sha_chunk_size - message_length_size, 0x00);
+    }
+
+    // Unlike MD5, SHA appends the message length and reads the hash words in big-endian order
+#pragma unroll
+    for (int i = 0; i < message_length_size; ++i) {
+      hash_state->buffer[sha_chunk_size - message_length_size + i] =
+        static_cast<uint8_t>(full_length >> (8 * (message_length_size - 1 - i)));
+    }
+    sha_hash_step(hash_state);
+
+#pragma unroll
+    for (int i = 0; i < digest_size / 8; ++i) {
+      uint32ToLowercaseHexString(__byte_perm(hash_state->hash_value[i], 0, 0x0123),
+                                 result_location + (8 * i));
+    }
+  }
+
+  template <typename T, std::enable_if_t<is_nested<T>() || is_dictionary<T>()>* = nullptr>
+  void __device__ operator()(column_device_view col,
+                             size_type row_index,
+                             hash_state_type* hash_state) const
+  {
+    cudf_assert(false && "SHA Unsupported non-fixed-width type column");
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, string_view>::value>* = nullptr>
+  void __device__ operator()(column_device_view col,
+                             size_type row_index,
+                             hash_state_type* hash_state) const
+  {
+    string_view key = col.element<string_view>(row_index);
+    sha_process_bytes(reinterpret_cast<uint8_t const*>(key.data()),
+                      static_cast<uint32_t>(key.size_bytes()),
+                      hash_state);
+  }
+
+  template <typename T, std::enable_if_t<is_floating_point<T>()>* = nullptr>
+  void __device__ operator()(column_device_view col,
+                             size_type row_index,
+                             hash_state_type* hash_state) const
+  {
+    auto const key = normalize_nans_and_zeros_helper<T>(col.element<T>(row_index));
+    sha_process_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(T), hash_state);
+  }
+
+  template <typename T,
+            std::enable_if_t<is_fixed_width<T>() && !is_floating_point<T>()>* = nullptr>
+  void __device__ operator()(column_device_view col,
+                             size_type row_index,
+                             hash_state_type* hash_state) const
+  {
+    auto const key = col.element<T>(row_index);
+    sha_process_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(T), hash_state);
+  }
+};
 }  // namespace detail
 }  // namespace cudf
 
@@ -772,6 +1028,450 @@ SparkMurmurHash3_32<double>::operator()(double const& key) const
   return this->compute_floating_point(key);
 }
 
+// xxHash64 implementation from
+// https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+//-----------------------------------------------------------------------------
+// xxHash - Extremely Fast Hash algorithm
+// Copyright (C) 2012-2021 Yann Collet
+// BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+//
+// The hash of a key is the hash of its bytes, so the results match other xxHash64
+// implementations; this is required by file formats that store hashes, such as Parquet bloom
+// filters. The functor is also callable from host code.
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  XXHash_64() = default;
+  constexpr XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const
+  {
+    // Keys of 4 and 8 bytes are hashed from registers rather than byte by byte
+    if (sizeof(Key) == 4) {
+      uint32_t bits;
+      memcpy(&bits, &key, sizeof(bits));
+      return compute_int(bits);
+    }
+    if (sizeof(Key) == 8) {
+      uint64_t bits;
+      memcpy(&bits, &key, sizeof(bits));
+      return compute_long(bits);
+    }
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(Key));
+  }
+
+  /**
+   * @brief Computes the hash of the 4 little-endian bytes of `input`
+   */
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_int(uint32_t input) const
+  {
+    uint64_t h = m_seed + prime5 + 4;
+    h ^= static_cast<uint64_t>(input) * prime1;
+    h = rotl64(h, 23) * prime2 + prime3;
+    return finalize(h);
+  }
+
+  /**
+   * @brief Computes the hash of the 8 little-endian bytes of `input`
+   */
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_long(uint64_t input) const
+  {
+    uint64_t h = m_seed + prime5 + 8;
+    h ^= round(0, input);
+    h = rotl64(h, 27) * prime1 + prime4;
+    return finalize(h);
+  }
+
+  /**
+   * @brief Computes the hash of `len` bytes starting at `data`
+   */
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_bytes(uint8_t const* data, size_t len) const
+  {
+    uint8_t const* const end = data + len;
+    uint64_t h;
+
+    if (len >= 32) {
+      uint64_t v1 = m_seed + prime1 + prime2;
+      uint64_t v2 = m_seed + prime2;
+      uint64_t v3 = m_seed;
+      uint64_t v4 = m_seed - prime1;
+      for (; data + 32 <= end; data += 32) {
+        v1 = round(v1, load<uint64_t>(data));
+        v2 = round(v2, load<uint64_t>(data + 8));
+        v3 = round(v3, load<uint64_t>(data + 16));
+        v4 = round(v4, load<uint64_t>(data + 24));
+      }
+      h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+      h = merge_round(h, v1);
+      h = merge_round(h, v2);
+      h = merge_round(h, v3);
+      h = merge_round(h, v4);
+    } else {
+      h = m_seed + prime5;
+    }
+    h += len;
+
+    for (; data + 8 <= end; data += 8) {
+      h ^= round(0, load<uint64_t>(data));
+      h = rotl64(h, 27) * prime1 + prime4;
+    }
+    if (data + 4 <= end) {
+      h ^= static_cast<uint64_t>(load<uint32_t>(data)) * prime1;
+      h = rotl64(h, 23) * prime2 + prime3;
+      data += 4;
+    }
+    for (; data < end; ++data) {
+      h ^= *data * prime5;
+      h = rotl64(h, 11) * prime1;
+    }
+    return finalize(h);
+  }
+
+ private:
+  static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+  static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+  static constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+  static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+  static constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t rotl64(uint64_t x, int r) const
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t round(uint64_t acc, uint64_t input) const
+  {
+    acc += input * prime2;
+    acc = rotl64(acc, 31);
+    return acc * prime1;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t merge_round(uint64_t acc, uint64_t val) const
+  {
+    acc ^= round(0, val);
+    return acc * prime1 + prime4;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t finalize(uint64_t h) const
+  {
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  // Little-endian load that doesn't require `data` to be aligned
+  template <typename T>
+  CUDA_HOST_DEVICE_CALLABLE T load(uint8_t const* data) const
+  {
+    T v = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+      v |= static_cast<T>(data[i]) << (8 * i);
+    }
+    return v;
+  }
+
+  uint64_t m_seed{0};
+};
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE
+XXHash_64<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+  return compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
+/**
+ * @brief xxHash64 of a value the way Spark's `xxhash64` hashes it.
+ *
+ * Spark widens booleans, bytes and shorts to 4-byte integers and decimals to 8-byte unscaled
+ * values, and hashes both zeros and all NaNs of floating point values alike.
+ */
+template <typename Key>
+struct SparkXXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  SparkXXHash_64() = default;
+  constexpr SparkXXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  result_type CUDA_DEVICE_CALLABLE operator()(Key const& key) const
+  {
+    return XXHash_64<Key>{m_seed}(key);
+  }
+
+  // compute wrapper for floating point types
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  result_type CUDA_DEVICE_CALLABLE compute_floating_point(T const& key) const
+  {
+    if (key == T{0.0}) {
+      return XXHash_64<T>{m_seed}(T{0.0});
+    } else if (isnan(key)) {
+      return XXHash_64<T>{m_seed}(std::numeric_limits<T>::quiet_NaN());
+    } else {
+      return XXHash_64<T>{m_seed}(key);
+    }
+  }
+
+  uint64_t m_seed{cudf::DEFAULT_HASH_SEED};
+};
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE SparkXXHash_64<bool>::operator()(bool const& key) const
+{
+  return XXHash_64<uint32_t>{m_seed}.compute_int(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE SparkXXHash_64<int8_t>::operator()(int8_t const& key) const
+{
+  return XXHash_64<int32_t>{m_seed}(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE SparkXXHash_64<uint8_t>::operator()(uint8_t const& key) const
+{
+  return XXHash_64<int32_t>{m_seed}(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE SparkXXHash_64<int16_t>::operator()(int16_t const& key) const
+{
+  return XXHash_64<int32_t>{m_seed}(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE SparkXXHash_64<uint16_t>::operator()(uint16_t const& key) const
+{
+  return XXHash_64<int32_t>{m_seed}(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+SparkXXHash_64<numeric::decimal32>::operator()(numeric::decimal32 const& key) const
+{
+  return XXHash_64<int64_t>{m_seed}(key.value());
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+SparkXXHash_64<numeric::decimal64>::operator()(numeric::decimal64 const& key) const
+{
+  return XXHash_64<int64_t>{m_seed}(key.value());
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE SparkXXHash_64<float>::operator()(float const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE SparkXXHash_64<double>::operator()(double const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+SparkXXHash_64<cudf::list_view>::operator()(cudf::list_view const& key) const
+{
+  cudf_assert(false && "List column hashing is not supported");
+  return 0;
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+SparkXXHash_64<cudf::struct_view>::operator()(cudf::struct_view const& key) const
+{
+  cudf_assert(false && "Direct hashing of struct_view is not supported");
+  return 0;
+}
+
+/**
+ * @brief The two 64-bit halves of a 128-bit hash value
+ */
+struct hash_value_128 {
+  uint64_t h1;
+  uint64_t h2;
+};
+
+/**
+ * @brief MurmurHash3_x64_128 of a value, from
+ * https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+ *
+ * The two halves of the state start from the halves of the seed, so that the hashes of the
+ * values of a row can be chained. A value hashed with both halves equal to a 32-bit seed has the
+ * same hash as in the reference implementation. Both zeros and all NaNs of floating point values
+ * are hashed alike.
+ */
+template <typename Key>
+struct MurmurHash3_x64_128 {
+  using argument_type = Key;
+  using result_type   = hash_value_128;
+
+  MurmurHash3_x64_128() = default;
+  constexpr MurmurHash3_x64_128(hash_value_128 seed) : m_seed(seed) {}
+
+  result_type CUDA_DEVICE_CALLABLE operator()(Key const& key) const
+  {
+    // Keys of at most 8 bytes only make a tail, which is hashed from a register
+    if (sizeof(Key) <= 8) {
+      uint64_t bits{0};
+      memcpy(&bits, &key, sizeof(Key));
+      return compute_tail(bits, sizeof(Key));
+    }
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(Key));
+  }
+
+  // compute wrapper for floating point types
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  result_type CUDA_DEVICE_CALLABLE compute_floating_point(T const& key) const
+  {
+    if (key == T{0.0}) {
+      return MurmurHash3_x64_128<T>{m_seed}(T{0.0});
+    } else if (isnan(key)) {
+      return MurmurHash3_x64_128<T>{m_seed}(std::numeric_limits<T>::quiet_NaN());
+    } else {
+      return MurmurHash3_x64_128<T>{m_seed}(key);
+    }
+  }
+
+  /**
+   * @brief Computes the hash of `len` bytes starting at `data`
+   */
+  result_type CUDA_DEVICE_CALLABLE compute_bytes(uint8_t const* data, int len) const
+  {
+    int const nblocks = len / 16;
+    uint64_t h1       = m_seed.h1;
+    uint64_t h2       = m_seed.h2;
+
+    //----------
+    // body
+    for (int i = 0; i < nblocks; i++) {
+      uint64_t k1 = load(data + i * 16, 8);
+      uint64_t k2 = load(data + i * 16 + 8, 8);
+
+      h1 ^= mix_k1(k1);
+      h1 = rotl64(h1, 27);
+      h1 += h2;
+      h1 = h1 * 5 + 0x52dce729;
+
+      h2 ^= mix_k2(k2);
+      h2 = rotl64(h2, 31);
+      h2 += h1;
+      h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    //----------
+    // tail
+    auto const tail     = data + nblocks * 16;
+    auto const tail_len = len & 15;
+    if (tail_len > 8) { h2 ^= mix_k2(load(tail + 8, tail_len - 8)); }
+    if (tail_len > 0) { h1 ^= mix_k1(load(tail, tail_len < 8 ? tail_len : 8)); }
+    return finalize(h1, h2, len);
+  }
+
+  /**
+   * @brief Computes the hash of the `len <= 8` little-endian bytes of `tail`
+   */
+  result_type CUDA_DEVICE_CALLABLE compute_tail(uint64_t tail, int len) const
+  {
+    uint64_t h1 = m_seed.h1;
+    if (len > 0) { h1 ^= mix_k1(tail); }
+    return finalize(h1, m_seed.h2, len);
+  }
+
+  hash_value_128 m_seed{cudf::DEFAULT_HASH_SEED, cudf::DEFAULT_HASH_SEED};
+
+ private:
+  static constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+  static constexpr uint64_t c2 = 0x4cf5ad432745937full;
+
+  CUDA_DEVICE_CALLABLE uint64_t rotl64(uint64_t x, int r) const
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  CUDA_DEVICE_CALLABLE uint64_t fmix64(uint64_t k) const
+  {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdull;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ull;
+    k ^= k >> 33;
+    return k;
+  }
+
+  CUDA_DEVICE_CALLABLE uint64_t mix_k1(uint64_t k1) const { return rotl64(k1 * c1, 31) * c2; }
+
+  CUDA_DEVICE_CALLABLE uint64_t mix_k2(uint64_t k2) const { return rotl64(k2 * c2, 33) * c1; }
+
+  CUDA_DEVICE_CALLABLE result_type finalize(uint64_t h1, uint64_t h2, int len) const
+  {
+    h1 ^= len;
+    h2 ^= len;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    h1 += h2;
+    h2 += h1;
+    return {h1, h2};
+  }
+
+  // Little-endian load of `len <= 8` bytes that doesn't require `data` to be aligned
+  CUDA_DEVICE_CALLABLE uint64_t load(uint8_t const* data, int len) const
+  {
+    uint64_t v = 0;
+    for (int i = 0; i < len; ++i) {
+      v |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return v;
+  }
+};
+
+template <>
+hash_value_128 CUDA_DEVICE_CALLABLE
+MurmurHash3_x64_128<float>::operator()(float const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+hash_value_128 CUDA_DEVICE_CALLABLE
+MurmurHash3_x64_128<double>::operator()(double const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+hash_value_128 CUDA_DEVICE_CALLABLE
+MurmurHash3_x64_128<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+  return compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
+template <>
+hash_value_128 CUDA_DEVICE_CALLABLE
+MurmurHash3_x64_128<cudf::list_view>::operator()(cudf::list_view const& key) const
+{
+  cudf_assert(false && "List column hashing is not supported");
+  return {};
+}
+
+template <>
+hash_value_128 CUDA_DEVICE_CALLABLE
+MurmurHash3_x64_128<cudf::struct_view>::operator()(cudf::struct_view const& key) const
+{
+  cudf_assert(false && "Direct hashing of struct_view is not supported");
+  return {};
+}
+
 /**
  * @brief  This hash function simply returns the value that is asked to be hash
  * reinterpreted as the result_type of the functor.
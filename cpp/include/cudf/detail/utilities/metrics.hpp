@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/metrics.hpp>
+
+#include <chrono>
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Records the metrics of a call to a public API in the registry, from its construction to
+ * its destruction.
+ *
+ * Created by `CUDF_FUNC_RANGE()`. The scopes of a host thread are nested, and the bytes and rows
+ * recorded by `record_input` and `record_output` are attributed to the innermost one. The wall time
+ * does not include the kernels that are still running on the device when the scope ends.
+ */
+class metrics_scope {
+ public:
+  /**
+   * @brief Starts recording the metrics of operation `name`, if the metrics are enabled.
+   *
+   * @param name Name of the operation, which must outlive the scope
+   */
+  explicit metrics_scope(char const* name);
+
+  ~metrics_scope();
+
+  metrics_scope(metrics_scope const&) = delete;
+  metrics_scope& operator=(metrics_scope const&) = delete;
+
+  friend void record_input(column_view const& input);
+  friend void record_input(table_view const& input);
+  friend void record_output(column_view const& output);
+  friend void record_output(table_view const& output);
+
+ private:
+  char const* _name;
+  bool _enabled;
+  metrics_scope* _parent{nullptr};
+  metrics_resource_adaptor* _mr{nullptr};  ///< Current device resource, if it tracks allocations
+  std::size_t _allocated_at_start{0};
+  std::size_t _peak_before_start{0};
+  std::chrono::steady_clock::time_point _start{};
+  operation_metrics _metrics{};
+};
+
+/**
+ * @brief Returns the size of the device buffers referenced by `input`, including the whole
+ * children of nested columns and the null masks.
+ */
+std::size_t device_buffer_bytes(column_view const& input);
+
+/**
+ * @brief Records the size and the rows of an input of the innermost `metrics_scope` of the
+ * calling thread.
+ *
+ * Does nothing if the metrics are disabled.
+ *
+ * @param input Input of the operation
+ */
+void record_input(column_view const& input);
+
+/**
+ * @copydoc record_input(column_view const&)
+ */
+void record_input(table_view const& input);
+
+/**
+ * @brief Records the size and the rows of an output of the innermost `metrics_scope` of the
+ * calling thread.
+ *
+ * Does nothing if the metrics are disabled.
+ *
+ * @param output Output of the operation
+ */
+void record_output(column_view const& output);
+
+/**
+ * @copydoc record_output(column_view const&)
+ */
+void record_output(table_view const& output);
+
+}  // namespace detail
+}  // namespace cudf
@@ -71,11 +71,25 @@ std::unique_ptr<column> set_keys(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns true if all the input dictionaries have the same keys.
+ *
+ * The indices of dictionaries with the same keys can be compared, sorted and hashed directly,
+ * without matching their keys first.
+ *
+ * @param input Dictionary columns to check.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return true if all the dictionaries have equal keys columns
+ */
+bool have_matching_keys(std::vector<dictionary_column_view> const& input,
+                        rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @brief Create new dictionaries that have keys merged from the input dictionaries.
  *
  * This will concatenate the keys for each dictionary and then call `set_keys` on each.
- * The result is a vector of new dictionaries with a common set of keys.
+ * The result is a vector of new dictionaries with a common set of keys. Dictionaries that
+ * already have the same keys are copied instead.
  *
  * @param input Dictionary columns to match keys.
  * @param mr Device memory resource used to allocate the returned column's device memory.
@@ -93,8 +107,8 @@ std::vector<std::unique_ptr<column>> match_dictionaries(
  *
  * The result includes a vector of new dictionary columns along with a
  * vector of table_views with corresponding updated column_views.
- * And any column_views in the input tables that are not dictionary type
- * are simply copied.
+ * And any column_views in the input tables that are not dictionary type, or dictionaries
+ * that already have the same keys in all the tables, are simply copied.
  *
  * Merging the dictionary keys also adjusts the indices appropriately in the
  * output dictionary columns.
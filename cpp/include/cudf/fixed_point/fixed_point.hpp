@@ -48,7 +48,8 @@ enum class Radix : int32_t { BASE_2 = 2, BASE_10 = 10 };
 template <typename T>
 constexpr inline auto is_supported_representation_type()
 {
-  return cuda::std::is_same<T, int32_t>::value || cuda::std::is_same<T, int64_t>::value;
+  return cuda::std::is_same<T, int32_t>::value || cuda::std::is_same<T, int64_t>::value ||
+         cuda::std::is_same<T, __int128_t>::value;
 }
 
 template <typename T>
@@ -151,6 +152,32 @@ CUDA_HOST_DEVICE_CALLABLE constexpr T shift(T const& val, scale_type const& scal
     return left_shift<Rep, Rad>(val, scale);
 }
 
+/**
+ * @brief Returns the decimal representation of an integer, including the `__int128_t` integers
+ * that `std::to_string` does not support.
+ *
+ * @tparam T Type of the integer
+ * @param value The integer to convert
+ * @return The decimal representation of `value`
+ */
+template <typename T>
+std::string to_string(T value)
+{
+  if constexpr (cuda::std::is_same<T, __int128_t>::value) {
+    // the magnitude is computed unsigned, as the negation of the minimum value overflows
+    auto magnitude = value < 0 ? -static_cast<__uint128_t>(value) : static_cast<__uint128_t>(value);
+    std::string digits;
+    do {
+      digits.push_back(static_cast<char>('0' + magnitude % 10));
+      magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) { digits.push_back('-'); }
+    return std::string(digits.rbegin(), digits.rend());
+  } else {
+    return std::to_string(value);
+  }
+}
+
 }  // namespace detail
 
 /**
@@ -169,7 +196,7 @@ CUDA_HOST_DEVICE_CALLABLE constexpr T shift(T const& val, scale_type const& scal
  * auto n = decimal32{scaled_integer{1001, 3}}; // n = 1.001
  * ```
  *
- * @tparam Rep The representation type (either `int32_t` or `int64_t`)
+ * @tparam Rep The representation type (either `int32_t`, `int64_t` or `__int128_t`)
  */
 template <typename Rep,
           typename cuda::std::enable_if_t<is_supported_representation_type<Rep>()>* = nullptr>
@@ -185,7 +212,7 @@ struct scaled_integer {
  * Currently, only binary and decimal `fixed_point` numbers are supported.
  * Binary operations can only be performed with other `fixed_point` numbers
  *
- * @tparam Rep The representation type (either `int32_t` or `int64_t`)
+ * @tparam Rep The representation type (either `int32_t`, `int64_t` or `__int128_t`)
  * @tparam Rad The radix/base (either `Radix::BASE_2` or `Radix::BASE_10`)
  */
 template <typename Rep, Radix Rad>
@@ -549,17 +576,19 @@ class fixed_point {
   explicit operator std::string() const
   {
     if (_scale < 0) {
-      auto const av   = std::abs(_value);
-      int64_t const n = std::pow(10, -_scale);
-      int64_t const f = av % n;
+      // the power of ten may not fit in 32 bits, even when the value does
+      using wide_rep  = std::conditional_t<sizeof(Rep) < sizeof(int64_t), int64_t, Rep>;
+      auto const av   = static_cast<wide_rep>(std::abs(_value));
+      auto const n    = detail::ipow<wide_rep, Radix::BASE_10>(-_scale);
+      auto const f    = av % n;
       auto const num_zeros =
-        std::max(0, (-_scale - static_cast<int32_t>(std::to_string(f).size())));
+        std::max(0, (-_scale - static_cast<int32_t>(detail::to_string(f).size())));
       auto const zeros = std::string(num_zeros, '0');
       auto const sign  = _value < 0 ? std::string("-") : std::string();
-      return sign + std::to_string(av / n) + std::string(".") + zeros + std::to_string(av % n);
+      return sign + detail::to_string(av / n) + std::string(".") + zeros + detail::to_string(f);
     } else {
       auto const zeros = std::string(_scale, '0');
-      return std::to_string(_value) + zeros;
+      return detail::to_string(_value) + zeros;
     }
   }
 };
@@ -750,8 +779,9 @@ CUDA_HOST_DEVICE_CALLABLE bool operator>(fixed_point<Rep1, Rad1> const& lhs,
   return lhs.rescaled(scale)._value > rhs.rescaled(scale)._value;
 }
 
-using decimal32 = fixed_point<int32_t, Radix::BASE_10>;
-using decimal64 = fixed_point<int64_t, Radix::BASE_10>;
+using decimal32  = fixed_point<int32_t, Radix::BASE_10>;
+using decimal64  = fixed_point<int64_t, Radix::BASE_10>;
+using decimal128 = fixed_point<__int128_t, Radix::BASE_10>;
 
 /** @} */  // end of group
 }  // namespace numeric
@@ -17,12 +17,15 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -103,12 +106,68 @@ class groupby {
    * @param null_precedence If `keys_are_sorted == YES`, indicates the ordering
    * of null values in each column. Else, ignored. If empty, assumes all columns
    * use `null_order::BEFORE`. Ignored if `keys_are_sorted == false`.
+   * @param result_determinism If `determinism::DETERMINISTIC`, aggregations whose hash-based
+   * results would depend on the order in which the threads run, i.e. `SUM`, `PRODUCT`,
+   * `SUM_OF_SQUARES` and `MEAN` of floating-point values and `VARIANCE` and `STD` of all values,
+   * use the sort-based implementation, whose results are the same from run to run on a device.
+   * @param key_case Indicates whether the strings of each column of `keys`, including the strings
+   * within its nested columns, group regardless of the case of their ASCII letters. The letters
+   * are folded as the keys are hashed and compared, without copying the keys, and the keys of a
+   * group are those of one of its rows. If empty, all columns are case-sensitive.
    */
   explicit groupby(table_view const& keys,
                    null_policy null_handling                      = null_policy::EXCLUDE,
                    sorted keys_are_sorted                         = sorted::NO,
                    std::vector<order> const& column_order         = {},
-                   std::vector<null_order> const& null_precedence = {});
+                   std::vector<null_order> const& null_precedence = {},
+                   determinism result_determinism = determinism::NONDETERMINISTIC,
+                   std::vector<case_sensitivity> const& key_case  = {});
+
+  /**
+   * @brief Construct a groupby object from `keys` that are already grouped
+   *
+   * The rows of every group in `keys` must be contiguous, and `group_offsets` must hold the
+   * offset of the first row of every group followed by the end of the last group, e.g. the
+   * grouped keys and offsets returned by `get_groups()`. The groups are used as given, so the
+   * keys are neither sorted nor compared again, and every aggregation and scan uses the
+   * sort-based implementation. Rows past the end of the last group belong to no group.
+   *
+   * @note This object does *not* maintain the lifetime of `keys`. It is the
+   * user's responsibility to ensure the `groupby` object does not outlive the
+   * data viewed by the `keys` `table_view`. `group_offsets` is copied.
+   *
+   * @throws cudf::logic_error if `group_offsets` is empty, doesn't start at 0 or ends past the
+   * last row of `keys`
+   *
+   * @param keys Table whose rows act as the groupby keys, grouped
+   * @param group_offsets Offsets of the groups in `keys`, of size `num_groups + 1`
+   */
+  groupby(table_view const& keys, device_span<size_type const> group_offsets);
+
+  /**
+   * @brief Construct a groupby object with the specified `keys` and the precomputed hash values
+   * of their rows
+   *
+   * The hash-based aggregations use `row_hashes` instead of hashing the keys, and still compare
+   * the keys to tell the rows of different groups apart. This lets the hash values of the keys,
+   * e.g. computed once with `cudf::hash`, be reused by the operations of a plan that hash the
+   * same keys, like `hash_partition` and `hash_join`. Rows with equal keys must have equal hash
+   * values. The results are the same as those of `groupby(keys, null_handling)`.
+   *
+   * @note This object does *not* maintain the lifetime of `keys` and `row_hashes`. It is the
+   * user's responsibility to ensure the `groupby` object does not outlive the data they view.
+   *
+   * @throws cudf::logic_error if `row_hashes` is not an INT32 or UINT32 column of
+   * `keys.num_rows()` elements without nulls
+   *
+   * @param keys Table whose rows act as the groupby keys
+   * @param row_hashes The hash value of every row of `keys`
+   * @param null_handling Indicates whether rows in `keys` that contain
+   * NULL values should be included
+   */
+  groupby(table_view const& keys,
+          column_view const& row_hashes,
+          null_policy null_handling = null_policy::EXCLUDE);
 
   /**
    * @brief Performs grouped aggregations on the specified values.
@@ -297,6 +356,12 @@ class groupby {
   std::vector<null_order> _null_precedence{};            ///< If keys are sorted,
                                                          ///< indicates null order
                                                          ///< of each column
+  determinism _result_determinism{};                     ///< Whether the results must be
+                                                         ///< the same from run to run
+  std::vector<case_sensitivity> _key_case{};             ///< Whether the strings of each
+                                                         ///< column are case-insensitive
+  column_view _row_hashes{};                             ///< Precomputed hash values of the
+                                                         ///< rows of the keys, if not empty
   std::unique_ptr<detail::sort::sort_groupby_helper>
     _helper;  ///< Helper object
               ///< used by sort based implementation
@@ -329,6 +394,103 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr);
 };
+
+/**
+ * @brief Groups values by keys and computes aggregations on those groups, over a sequence of
+ * batches of keys and values.
+ *
+ * Every call to `update` aggregates a batch and merges the partial results with those of the
+ * previous batches, so only the partial results of the distinct keys seen so far are kept,
+ * however many batches are aggregated. Every aggregation is decomposed into partial results that
+ * can be merged:
+ *
+ * - SUM, PRODUCT, MIN and MAX are merged with themselves.
+ * - COUNT_VALID and COUNT_ALL are merged by adding the counts.
+ * - SUM_OF_SQUARES is merged by adding the sums.
+ * - MEAN is computed from a SUM and a COUNT_VALID.
+ * - VARIANCE and STD are computed from a SUM, a COUNT_VALID and a SUM_OF_SQUARES.
+ *
+ * Example:
+ * ```
+ * aggregations: {{SUM, MEAN}}
+ *
+ * update(keys: {{1, 2, 1}}, values: {{1, 2, 3}})
+ * update(keys: {{2, 3}}, values: {{4, 5}})
+ *
+ * finalize():
+ * keys:  {1, 2, 3}
+ * values:
+ *   SUM:  {4, 6, 5}
+ *   MEAN: {2, 3, 5}
+ * ```
+ */
+class streaming_groupby {
+ public:
+  streaming_groupby()                         = delete;
+  streaming_groupby(streaming_groupby const&) = delete;
+  streaming_groupby(streaming_groupby&&)      = default;
+  streaming_groupby& operator=(streaming_groupby const&) = delete;
+  streaming_groupby& operator=(streaming_groupby&&) = default;
+  ~streaming_groupby();
+
+  /**
+   * @brief Construct a streaming groupby object performing `aggregations` on the columns of the
+   * values of every batch.
+   *
+   * @throws cudf::logic_error if any of `aggregations` is not SUM, PRODUCT, MIN, MAX,
+   * COUNT_VALID, COUNT_ALL, SUM_OF_SQUARES, MEAN, VARIANCE or STD.
+   *
+   * @param aggregations The aggregations to perform on every column of the values of the batches
+   * @param null_handling Indicates whether rows in the keys that contain NULL values should be
+   * included
+   */
+  explicit streaming_groupby(std::vector<std::vector<std::unique_ptr<aggregation>>>&& aggregations,
+                             null_policy null_handling = null_policy::EXCLUDE);
+
+  /**
+   * @brief Aggregates a batch of keys and values, and merges the results with those of the
+   * previous batches.
+   *
+   * Column `i` of `values` is aggregated with the aggregations at index `i` of the aggregations
+   * of this object.
+   *
+   * @throws cudf::logic_error if `values` doesn't have a column for every set of aggregations.
+   * @throws cudf::logic_error if `keys` and `values` have different numbers of rows.
+   * @throws cudf::logic_error if the types of `keys` or `values` are different from those of
+   * the first batch.
+   *
+   * @param keys Table whose rows act as the groupby keys of the batch
+   * @param values Table of the values of the batch
+   */
+  void update(table_view const& keys, table_view const& values);
+
+  /**
+   * @brief Returns the results of the aggregations of all the batches so far.
+   *
+   * More batches may be aggregated after this call.
+   *
+   * @throws cudf::logic_error if no batch was aggregated.
+   *
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and a vector of
+   * aggregation_results for each column of the values, in the same order as the aggregations of
+   * this object.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finalize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::vector<std::vector<std::unique_ptr<aggregation>>>
+    _aggregations;                                       ///< Aggregations of every column
+  null_policy _include_null_keys{null_policy::EXCLUDE};  ///< Include rows in keys with NULLs
+  std::vector<std::vector<aggregation::Kind>>
+    _partial_kinds;                     ///< Partial aggregations of every column
+  std::vector<data_type> _key_types;    ///< Types of the keys of the first batch
+  std::vector<data_type> _value_types;  ///< Types of the values of the first batch
+  std::unique_ptr<table> _keys;         ///< Distinct keys of all the batches so far
+  std::vector<std::unique_ptr<column>>
+    _partial_results;  ///< Partial results of every distinct key, in the order of `_partial_kinds`
+};
 /** @} */
 }  // namespace groupby
 }  // namespace cudf
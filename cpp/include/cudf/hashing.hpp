@@ -29,9 +29,16 @@ namespace cudf {
 /**
  * @brief Computes the hash value of each row in the input set of columns.
  *
+ * `HASH_XXHASH64` returns an INT64 column of the hashes Spark's `xxhash64` computes for `seed`
+ * (42 in Spark). `HASH_MURMUR3_X64_128` returns a STRUCT column of the two UINT64 halves of
+ * the 128-bit hashes. `HASH_MD5`, `HASH_SHA1` and `HASH_SHA256` return a strings column of the
+ * lowercase hexadecimal digests of the concatenated bytes of the valid elements of each row.
+ *
  * @param input The table of columns to hash
+ * @param hash_function The hash function to use
  * @param initial_hash Optional host_span of initial hash values for each column.
  * If this span is empty then each element will be hashed as-is.
+ * @param seed Optional seed value to use for the hash function
  * @param mr Device memory resource used to allocate the returned column's device memory.
  *
  * @returns A column where each row is the hash of a column from the input
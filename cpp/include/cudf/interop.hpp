@@ -17,14 +17,40 @@
 #pragma once
 
 #include <arrow/api.h>
+#include <arrow/c/abi.h>
 #include <cudf/column/column.hpp>
 #include <cudf/detail/transform.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <functional>
+#include <memory>
+
 struct DLManagedTensor;
 
+#ifndef ARROW_C_DEVICE_DATA_INTERFACE
+#define ARROW_C_DEVICE_DATA_INTERFACE
+
+// Device types and device array of the Arrow C Device Data Interface, whose ABI is stable
+typedef int32_t ArrowDeviceType;
+
+#define ARROW_DEVICE_CPU 1
+#define ARROW_DEVICE_CUDA 2
+#define ARROW_DEVICE_CUDA_HOST 3
+#define ARROW_DEVICE_CUDA_MANAGED 13
+
+struct ArrowDeviceArray {
+  struct ArrowArray array;
+  int64_t device_id;
+  ArrowDeviceType device_type;
+  void* sync_event;
+  int64_t reserved[3];
+};
+
+#endif  // ARROW_C_DEVICE_DATA_INTERFACE
+
 namespace cudf {
 /**
  * @addtogroup interop_dlpack
@@ -75,6 +101,58 @@ DLManagedTensor* to_dlpack(
   table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Convert a cudf column into a 1D DLPack DLTensor without copying its data
+ *
+ * The tensor points to the device memory of `input`, which must outlive the tensor and is not
+ * freed by its `deleter`. The column must be numeric and its null count must be zero. If the
+ * column is empty, the result will be nullptr.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the memory allocated for the tensor's shape.
+ *
+ * @throw cudf::logic_error if the data type is not numeric, or if the column has nulls
+ *
+ * @param input Column to view as a DLPack tensor
+ *
+ * @return 1D DLPack tensor referencing the column data, or nullptr
+ */
+DLManagedTensor* to_dlpack_view(column_view const& input);
+
+/**
+ * @brief Copy a cudf table into a pre-allocated DLPack DLTensor
+ *
+ * All columns must have the same numeric data type, which must be the `dtype` of the tensor.
+ * The tensor must be in the device memory of the current device, and have the shape
+ * `{num_rows}` for a single column or `{num_rows, num_columns}`. Its `strides` describe any
+ * layout such as row-major or column-major, and null `strides` are those of a compact row-major
+ * tensor. All columns are copied by a single kernel.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric, or if any of columns
+ * have nulls
+ * @throw cudf::logic_error if the device, shape or data type of the tensor doesn't match
+ *
+ * @param input Table to copy
+ * @param output Tensor into which the columns are copied
+ */
+void to_dlpack(table_view const& input, DLManagedTensor* output);
+
+/**
+ * @brief Copy a cudf table into a pre-allocated DLPack DLTensor, replacing its nulls
+ *
+ * The null elements of the columns are copied as the value of `null_replacement`.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric
+ * @throw cudf::logic_error if `null_replacement` is invalid or of another data type than the
+ * columns
+ * @throw cudf::logic_error if the device, shape or data type of the tensor doesn't match
+ *
+ * @param input Table to copy
+ * @param output Tensor into which the columns are copied
+ * @param null_replacement Value copied for the null elements
+ */
+void to_dlpack(table_view const& input, DLManagedTensor* output, scalar const& null_replacement);
+
 /** @} */  // end of group
 
 /**
@@ -126,5 +204,85 @@ std::unique_ptr<table> from_arrow(
   arrow::Table const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief `ArrowSchema` that is released and deleted when it goes out of scope
+ */
+using unique_schema_t = std::unique_ptr<ArrowSchema, void (*)(ArrowSchema*)>;
+
+/**
+ * @brief `ArrowDeviceArray` that is released and deleted when it goes out of scope
+ */
+using unique_device_array_t = std::unique_ptr<ArrowDeviceArray, void (*)(ArrowDeviceArray*)>;
+
+/**
+ * @brief `table_view` of imported device memory that releases the memory when it is deleted
+ */
+using unique_table_view_t = std::unique_ptr<table_view, std::function<void(table_view*)>>;
+
+/**
+ * @brief Create the `ArrowSchema` of the Arrow device array exported by `to_arrow_device`
+ *
+ * The schema is that of a struct array whose children are the columns of `input`.
+ *
+ * @throws cudf::logic_error if `metadata` is not empty and its size doesn't match with number of
+ * columns.
+ * @throws cudf::logic_error if a column type is not supported by `to_arrow_device`
+ *
+ * @param input table_view whose schema is created
+ * @param metadata Contains hierarchy of names of columns and children, or is empty for unnamed
+ * columns
+ * @return Arrow C schema of `input`
+ */
+unique_schema_t to_arrow_schema(table_view const& input,
+                                std::vector<column_metadata> const& metadata = {});
+
+/**
+ * @brief Export cudf table `input` as an Arrow device array without copying its device memory
+ *
+ * The result is a struct array whose children are the columns of `input`, and whose buffers
+ * point to the device memory of `input`, which must outlive the result. Its `sync_event` is a
+ * pointer to a `cudaEvent_t` recorded on the default stream after the work producing `input`.
+ *
+ * Supported types are the integral and floating point types other than `BOOL8`, timestamps,
+ * durations other than days, strings, lists and structs. The other types are converted by
+ * `to_arrow`.
+ *
+ * @throws cudf::logic_error if a column type is not supported
+ *
+ * @param input table_view to export
+ * @return Arrow device array referencing the device memory of `input`
+ */
+unique_device_array_t to_arrow_device(table_view const& input);
+
+/**
+ * @brief Export cudf table `input` as an Arrow device array without copying its device memory
+ *
+ * The result owns `input`, which is deleted when the array is released.
+ *
+ * @throws cudf::logic_error if a column type is not supported
+ *
+ * @param input table to export
+ * @return Arrow device array owning the device memory of `input`
+ */
+unique_device_array_t to_arrow_device(std::unique_ptr<table>&& input);
+
+/**
+ * @brief Import an Arrow device array as a cudf `table_view` without copying its device memory
+ *
+ * `input` must be a struct array whose children are the columns, in CUDA device or managed memory
+ * of the current device. The ownership of the array is moved to the result, which releases it
+ * when it is deleted, and the release callback of `input` is set to null. If `sync_event` is not
+ * null, the default stream waits for the `cudaEvent_t` it points to.
+ *
+ * @throws cudf::logic_error if the device type or device id is not supported
+ * @throws cudf::logic_error if `schema` is not that of a struct array or has an unsupported
+ * format
+ *
+ * @param schema Arrow C schema of `input`
+ * @param input Arrow device array to import
+ * @return table_view of the device memory of `input`
+ */
+unique_table_view_t from_arrow_device(ArrowSchema const* schema, ArrowDeviceArray* input);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -213,6 +213,247 @@ table_with_metadata read_avro(
   avro_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/** @} */  // end of group
+/**
+ * @addtogroup io_writers
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Builder to build options for `write_avro()`.
+ */
+class avro_writer_options_builder;
+
+/**
+ * @brief Settings to use for `write_avro()`.
+ */
+class avro_writer_options {
+  // Specify the sink to use for writer output
+  sink_info _sink;
+  // Set of columns to output
+  table_view _table;
+  // Compression codec of the data blocks
+  compression_type _compression = compression_type::NONE;
+  // Target size of the data blocks, in bytes before compression
+  size_t _block_size = 64 * 1024;
+  // Name of the record schema
+  std::string _record_name = "topLevelRecord";
+  // Optional associated metadata
+  table_metadata const* _metadata = nullptr;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   */
+  explicit avro_writer_options(sink_info const& sink, table_view const& table)
+    : _sink(sink), _table(table)
+  {
+  }
+
+  friend avro_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit avro_writer_options() = default;
+
+  /**
+   * @brief Create builder to create `avro_writer_options`.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   *
+   * @return Builder to build avro_writer_options.
+   */
+  static avro_writer_options_builder builder(sink_info const& sink, table_view const& table);
+
+  /**
+   * @brief Returns sink used for writer output.
+   */
+  sink_info const& get_sink() const { return _sink; }
+
+  /**
+   * @brief Returns table that would be written to output.
+   */
+  table_view const& get_table() const { return _table; }
+
+  /**
+   * @brief Returns optional associated metadata.
+   */
+  table_metadata const* get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Returns the compression codec of the data blocks.
+   */
+  compression_type get_compression() const { return _compression; }
+
+  /**
+   * @brief Returns the target size of the data blocks, in bytes before compression.
+   */
+  size_t get_block_size() const { return _block_size; }
+
+  /**
+   * @brief Returns the name of the record schema.
+   */
+  std::string const& get_record_name() const { return _record_name; }
+
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata.
+   */
+  void set_metadata(table_metadata const* metadata) { _metadata = metadata; }
+
+  /**
+   * @brief Sets the compression codec of the data blocks.
+   *
+   * @param comp `NONE` for the `null` codec, `SNAPPY` for the `snappy` codec, or `GZIP` for the
+   * `deflate` codec
+   */
+  void set_compression(compression_type comp) { _compression = comp; }
+
+  /**
+   * @brief Sets the target size of the data blocks, in bytes before compression.
+   *
+   * @param size_bytes Target block size; a block is larger if it has a single larger row
+   */
+  void set_block_size(size_t size_bytes) { _block_size = size_bytes; }
+
+  /**
+   * @brief Sets the name of the record schema.
+   *
+   * @param name Record name
+   */
+  void set_record_name(std::string name) { _record_name = std::move(name); }
+};
+
+class avro_writer_options_builder {
+  avro_writer_options options;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit avro_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   */
+  explicit avro_writer_options_builder(sink_info const& sink, table_view const& table)
+    : options{sink, table}
+  {
+  }
+
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata.
+   * @return this for chaining.
+   */
+  avro_writer_options_builder& metadata(table_metadata const* metadata)
+  {
+    options._metadata = metadata;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the compression codec of the data blocks.
+   *
+   * @param comp `NONE` for the `null` codec, `SNAPPY` for the `snappy` codec, or `GZIP` for the
+   * `deflate` codec
+   * @return this for chaining.
+   */
+  avro_writer_options_builder& compression(compression_type comp)
+  {
+    options._compression = comp;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the target size of the data blocks, in bytes before compression.
+   *
+   * @param size_bytes Target block size
+   * @return this for chaining.
+   */
+  avro_writer_options_builder& block_size(size_t size_bytes)
+  {
+    options._block_size = size_bytes;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the name of the record schema.
+   *
+   * @param name Record name
+   * @return this for chaining.
+   */
+  avro_writer_options_builder& record_name(std::string name)
+  {
+    options._record_name = std::move(name);
+    return *this;
+  }
+
+  /**
+   * @brief move `avro_writer_options` member once it's built.
+   */
+  operator avro_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move `avro_writer_options` member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   */
+  avro_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writes a set of columns to an Avro object container file.
+ *
+ * The schema is a record with a field per column, named after the column, or `_<index>` if the
+ * metadata has no column names. Nullable columns are written as unions of `null` and the column
+ * type. The rows are encoded on the device, and the snappy compression of the data blocks runs on
+ * the device too.
+ *
+ * | cudf type                          | Avro type                                 |
+ * | ---------------------------------- | ----------------------------------------- |
+ * | BOOL8                              | boolean                                   |
+ * | INT8, INT16, INT32, UINT8, UINT16  | int                                       |
+ * | INT64, UINT32                      | long                                      |
+ * | FLOAT32 / FLOAT64                  | float / double                            |
+ * | STRING                             | string                                    |
+ * | TIMESTAMP_DAYS                     | int (date)                                |
+ * | TIMESTAMP_SECONDS, _MILLISECONDS   | long (timestamp-millis)                   |
+ * | TIMESTAMP_MICROSECONDS             | long (timestamp-micros)                   |
+ * | TIMESTAMP_NANOSECONDS              | long (timestamp-nanos)                    |
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  cudf::io::sink_info sink_info("dataset.avro");
+ *  auto options = cudf::io::avro_writer_options::builder(sink_info, table->view())
+ *                   .compression(cudf::io::compression_type::SNAPPY);
+ *  cudf::io::write_avro(options);
+ * @endcode
+ *
+ * @throw cudf::logic_error if a column is of an unsupported type
+ * @throw cudf::logic_error if the compression is not `NONE`, `SNAPPY` or `GZIP`
+ *
+ * @param options Settings for controlling writing behavior.
+ * @param mr Device memory resource to use for device memory allocation.
+ */
+void write_avro(avro_writer_options const& options,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
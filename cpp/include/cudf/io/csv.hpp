@@ -21,6 +21,9 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <thrust/optional.h>
+
+#include <array>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -35,6 +38,15 @@ namespace io {
  * @file
  */
 
+/**
+ * @brief State of the CSV row parser at a byte position of the input
+ */
+enum class csv_parser_state : int32_t {
+  NONE    = 0,  ///< Outside of quoted fields and comments
+  QUOTE   = 1,  ///< Within a quoted field
+  COMMENT = 2   ///< Within a comment line
+};
+
 /**
  *@brief Builder to build options for `read_csv()`.
  */
@@ -55,6 +67,10 @@ class csv_reader_options {
   std::size_t _byte_range_offset = 0;
   // Bytes to read; always reads complete rows
   std::size_t _byte_range_size = 0;
+  // Parser state at the byte range offset; NONE if not set, unless inferred from the data
+  thrust::optional<csv_parser_state> _byte_range_start_state;
+  // Whether to infer the parser state at the byte range offset from the data when not set
+  bool _infer_byte_range_start_state = false;
   // Names of all the columns; if empty then names are auto-generated
   std::vector<std::string> _names;
   // If there is no header or names, prepend this to the column ID as the name
@@ -171,6 +187,19 @@ class csv_reader_options {
    */
   std::size_t get_byte_range_size() const { return _byte_range_size; }
 
+  /**
+   * @brief Returns the parser state at the byte range offset, if set.
+   */
+  thrust::optional<csv_parser_state> const& get_byte_range_start_state() const
+  {
+    return _byte_range_start_state;
+  }
+
+  /**
+   * @brief Whether to infer the parser state at the byte range offset when it is not set.
+   */
+  bool is_enabled_infer_byte_range_start_state() const { return _infer_byte_range_start_state; }
+
   /**
    * @brief Returns names of the columns.
    */
@@ -363,6 +392,33 @@ class csv_reader_options {
     _byte_range_size = size;
   }
 
+  /**
+   * @brief Sets the parser state at the byte range offset.
+   *
+   * A byte range reads the records whose preceding line terminator is within
+   * `(offset, offset + size]`, plus the first record when the offset is zero, so that consecutive
+   * ranges read every record exactly once. Whether a line terminator ends a record depends on the
+   * parser state at the offset: a terminator within a quoted field is part of the field. The
+   * states at the range offsets can be computed exactly from the `summarize_csv_byte_range` results
+   * of the preceding ranges. When no state is set, the range starts outside of quotes and comments
+   * (`csv_parser_state::NONE`), unless `enable_infer_byte_range_start_state` is set. The state is
+   * ignored when the offset is zero.
+   *
+   * @param state Parser state at the byte range offset
+   */
+  void set_byte_range_start_state(csv_parser_state state) { _byte_range_start_state = state; }
+
+  /**
+   * @brief Sets whether to infer the parser state at the byte range offset when it is not set.
+   *
+   * The state under which the first records of the range have the most consistent number of
+   * fields is selected. This is a heuristic, unlike the states computed from the
+   * `summarize_csv_byte_range` results.
+   *
+   * @param val Boolean value to enable/disable the inference of the start state
+   */
+  void enable_infer_byte_range_start_state(bool val) { _infer_byte_range_start_state = val; }
+
   /**
    * @brief Sets names of the column.
    *
@@ -686,6 +742,30 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the parser state at the byte range offset.
+   *
+   * @param state Parser state at the byte range offset
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& byte_range_start_state(csv_parser_state state)
+  {
+    options.set_byte_range_start_state(state);
+    return *this;
+  }
+
+  /**
+   * @brief Sets whether to infer the parser state at the byte range offset when it is not set.
+   *
+   * @param val Boolean value to enable/disable the inference of the start state
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& infer_byte_range_start_state(bool val)
+  {
+    options._infer_byte_range_start_state = val;
+    return *this;
+  }
+
   /**
    * @brief Sets names of the column.
    *
@@ -1093,6 +1173,144 @@ table_with_metadata read_csv(
   csv_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Parser state at the end of a CSV byte range and number of records in the range, for each
+ * possible parser state at the start of the range.
+ *
+ * Both arrays are indexed by the start state. Records include header, blank and comment lines.
+ */
+struct csv_byte_range_summary {
+  std::array<csv_parser_state, 3> end_state;  ///< Parser state after the last byte of the range
+  std::array<uint64_t, 3> num_records;        ///< Number of records read by the range
+};
+
+/**
+ * @brief Parser state and global record index at the start of a CSV byte range
+ */
+struct csv_byte_range_start {
+  csv_parser_state parser_state;  ///< Parser state at the byte range offset
+  uint64_t first_record;          ///< Index of the first record of the range in the whole input
+};
+
+/**
+ * @brief Computes the end states and record counts of a CSV byte range for every start state.
+ *
+ * This is the first pass of splitting a large input into byte ranges that are read independently,
+ * for example on multiple GPUs: every range is summarized in parallel, the summaries are combined
+ * with `resolve_csv_byte_range_starts`, and each range is then read with its exact start state.
+ * The pass only scans for line terminators, quotes and comments, so it is much cheaper than
+ * reading the range.
+ *
+ * The following code snippet demonstrates how to read a file in byte ranges:
+ * @code
+ *  std::vector<cudf::io::csv_byte_range_summary> summaries;
+ *  for (size_t offset = 0; offset < file_size; offset += range_size) {
+ *    auto options = cudf::io::csv_reader_options::builder(cudf::io::source_info(filepath))
+ *                     .byte_range_offset(offset)
+ *                     .byte_range_size(range_size)
+ *                     .build();
+ *    summaries.push_back(cudf::io::summarize_csv_byte_range(options));
+ *  }
+ *  auto const starts = cudf::io::resolve_csv_byte_range_starts(summaries);
+ *  ...
+ *  options.set_byte_range_start_state(starts[range_index].parser_state);
+ *  auto result = cudf::io::read_csv(options);
+ * @endcode
+ *
+ * @throws cudf::logic_error if the input is compressed
+ *
+ * @param options Settings for the byte range; only the source, the byte range, and the parsing
+ * characters are used
+ * @return The summary of the byte range
+ */
+csv_byte_range_summary summarize_csv_byte_range(csv_reader_options const& options);
+
+/**
+ * @brief Resolves the start states and first record indices of consecutive CSV byte ranges.
+ *
+ * @param summaries Summaries of consecutive byte ranges, starting at offset zero
+ * @return Start state and first record index of each range
+ */
+std::vector<csv_byte_range_start> resolve_csv_byte_range_starts(
+  std::vector<csv_byte_range_summary> const& summaries);
+
+namespace detail {
+namespace csv {
+class chunked_reader;
+}  // namespace csv
+}  // namespace detail
+
+/**
+ * @brief Chunked CSV reader class to read a dataset in a series of tables of bounded input size.
+ *
+ * The input is split into consecutive byte ranges of `chunk_read_limit` bytes, and each call to
+ * `read_chunk` reads the records of the next range. The parser state is carried from one range to
+ * the next, so quoted fields may contain line terminators. The column names and types are
+ * determined once, from the options and the first chunk, so every chunk has the same schema; types
+ * that are inferred only see the records of the first chunk. The input of the next chunk is read in
+ * the background while the current chunk is decoded.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of 256MB:
+ * @code
+ *  ...
+ *  cudf::io::csv_reader_options options =
+ *  cudf::io::csv_reader_options::builder(cudf::source_info(filepath));
+ *  cudf::io::chunked_csv_reader reader(256 << 20, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_csv_reader() = default;
+
+  /**
+   * @brief Constructor with chunked reader options
+   *
+   * @throws cudf::logic_error if the options select a byte range, skip rows or limit the number
+   * of rows, or if the input is compressed
+   *
+   * @param chunk_read_limit Number of input bytes to read per chunk; 0 reads the whole input as a
+   * single chunk
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_csv_reader(
+    std::size_t chunk_read_limit,
+    csv_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Returns true if there are more chunks to be read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * The first call always returns a table, which is empty if the input has no records.
+   *
+   * @throw cudf::logic_error if there are no more chunks to read
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk();
+
+  // Unique pointer to impl reader class
+  std::unique_ptr<cudf::io::detail::csv::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
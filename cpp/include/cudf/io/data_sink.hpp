@@ -21,6 +21,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -36,6 +37,9 @@ class data_sink {
   /**
    * @brief Create a sink from a file path
    *
+   * Host writes are copied to a ring of buffers that are written to the file in the background,
+   * with direct I/O when the file system supports it, so they return before the data is on disk.
+   *
    * @param[in] filepath Path to the file to use
    */
   static std::unique_ptr<data_sink> create(const std::string& filepath);
@@ -139,6 +143,27 @@ class data_sink {
    */
   virtual void flush() = 0;
 
+  /**
+   * @brief Starts flushing the data written into the sink, without waiting for it to complete
+   *
+   * The sink can be written to while the flush is in progress. Sinks that write in the background
+   * override this function; by default, it flushes the sink before returning.
+   *
+   * @return Future that becomes ready once the data written before the call is flushed, and that
+   * rethrows the error of a failed write
+   */
+  virtual std::future<void> flush_async()
+  {
+    std::promise<void> flushed;
+    try {
+      flush();
+      flushed.set_value();
+    } catch (...) {
+      flushed.set_exception(std::current_exception());
+    }
+    return flushed.get_future();
+  }
+
   /**
    * @brief Returns the total number of bytes written into this sink
    *
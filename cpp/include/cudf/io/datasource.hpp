@@ -66,6 +66,9 @@ class datasource {
   /**
    * @brief Creates a source from a file path.
    *
+   * Paths that start with `http://` are read from the HTTP server with ranged `GET` requests, for
+   * example from an S3-compatible object store with a presigned URL.
+   *
    * @param[in] filepath Path to the file to use
    * @param[in] offset Bytes from the start of the file (the default is zero)
    * @param[in] size Bytes from the offset; use zero for entire file (the default is zero)
@@ -205,6 +208,28 @@ class datasource {
     CUDF_FAIL("datasource classes that support device_read must override it.");
   }
 
+  /**
+   * @brief Whether or not this source supports concurrent reads from multiple threads.
+   *
+   * Readers may prefetch data with concurrent `host_read()`/`device_read()` calls when this
+   * function returns true. Data source implementations that are not thread-safe don't need to
+   * override this function.
+   *
+   * @return bool Whether this source can be read from multiple threads at the same time
+   */
+  virtual bool supports_concurrent_reads() const { return false; }
+
+  /**
+   * @brief Returns the largest gap between two byte ranges that readers should read together,
+   * along with the gap, instead of issuing two reads.
+   *
+   * Sources with a high per-read latency, such as remote object stores, should override this
+   * function. Local sources don't need to, as their reads are cheap enough on their own.
+   *
+   * @return size_t The largest gap in bytes that is worth reading to save a read
+   */
+  virtual size_t max_coalesced_gap() const { return 0; }
+
   /**
    * @brief Returns the size of the data in the source.
    *
@@ -329,6 +354,11 @@ class arrow_io_source : public datasource {
     return result.ValueOrDie();
   }
 
+  /**
+   * @brief `arrow::io::RandomAccessFile::ReadAt` is thread-safe.
+   */
+  bool supports_concurrent_reads() const override { return true; }
+
   /**
    * @brief Returns the size of the data in the `arrow` source.
    */
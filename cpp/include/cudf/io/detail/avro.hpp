@@ -16,7 +16,7 @@
 
 /**
  * @file avro.hpp
- * @brief cuDF-IO reader classes API
+ * @brief cuDF-IO reader and writer classes API
  */
 
 #pragma once
@@ -76,6 +76,45 @@ class reader {
   table_with_metadata read(avro_reader_options const &options,
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
+
+/**
+ * @brief Class to write a set of columns to an Avro object container file.
+ */
+class writer {
+ public:
+  class impl;
+
+ private:
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for output to a sink.
+   *
+   * @param sink The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  writer(std::unique_ptr<cudf::io::data_sink> sink,
+         avro_writer_options const &options,
+         rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~writer();
+
+  /**
+   * @brief Writes the entire dataset.
+   *
+   * @param table Set of columns to output
+   * @param metadata Table metadata and column names
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write(table_view const &table,
+             table_metadata const *metadata = nullptr,
+             rmm::cuda_stream_view stream   = rmm::cuda_stream_default);
+};
 }  // namespace avro
 }  // namespace detail
 }  // namespace io
@@ -28,7 +28,7 @@ namespace csv {
  * @brief Class to read CSV dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
@@ -68,6 +68,69 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Computes the end states and record counts of the byte range for every start state.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The summary of the byte range
+   */
+  csv_byte_range_summary summarize_byte_range(
+    rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+};
+
+/**
+ * @brief Class to read a CSV dataset in a series of chunks of bounded input size.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from an array of file paths
+   *
+   * @param chunk_read_limit Number of input bytes to read per chunk
+   * @param filepaths Paths to the files containing the input dataset
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::string> const &filepaths,
+    csv_reader_options const &options,
+    rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * @param chunk_read_limit Number of input bytes to read per chunk
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+    csv_reader_options const &options,
+    rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns true if there is any data left to be read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
 class writer {
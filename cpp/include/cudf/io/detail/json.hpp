@@ -16,7 +16,7 @@
 
 /**
  * @file json.hpp
- * @brief cuDF-IO reader classes API
+ * @brief cuDF-IO reader and writer classes API
  */
 
 #pragma once
@@ -41,7 +41,7 @@ namespace json {
  * @brief Class to read JSON dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
@@ -83,6 +83,98 @@ class reader {
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read a JSON Lines dataset in a series of chunks of bounded input size.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from an array of file paths
+   *
+   * @param chunk_read_limit Number of input bytes to read per chunk
+   * @param filepaths Paths to the files containing the input dataset
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::string> const &filepaths,
+    json_reader_options const &options,
+    rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * @param chunk_read_limit Number of input bytes to read per chunk
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+    json_reader_options const &options,
+    rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns true if there is any data left to be read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+};
+
+/**
+ * @brief Class to write a set of columns to the JSON Lines format.
+ */
+class writer {
+ public:
+  class impl;
+
+ private:
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for output to a sink.
+   *
+   * @param sink The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  writer(std::unique_ptr<cudf::io::data_sink> sink,
+         json_writer_options const &options,
+         rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~writer();
+
+  /**
+   * @brief Writes the entire dataset.
+   *
+   * @param table Set of columns to output
+   * @param metadata Table metadata and column names
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write(table_view const &table,
+             table_metadata const *metadata = nullptr,
+             rmm::cuda_stream_view stream   = rmm::cuda_stream_default);
+};
+
 }  // namespace json
 }  // namespace detail
 }  // namespace io
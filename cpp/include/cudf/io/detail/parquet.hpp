@@ -21,7 +21,9 @@
 #pragma once
 
 #include <cudf/io/detail/utils.hpp>
+#include <cudf/io/parquet_metadata.hpp>
 #include <cudf/io/types.hpp>
+#include <cudf/memory_estimate.hpp>
 #include <cudf/table/table_view.hpp>
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -36,6 +38,7 @@ namespace io {
 class parquet_reader_options;
 class parquet_writer_options;
 class chunked_parquet_writer_options;
+class parquet_dataset_writer_options;
 
 namespace detail {
 namespace parquet {
@@ -44,7 +47,7 @@ namespace parquet {
  * @brief Class to read Parquet dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
@@ -86,8 +89,86 @@ class reader {
    */
   table_with_metadata read(parquet_reader_options const& options,
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Estimates the device memory used to read the dataset as per given options.
+   *
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Estimate of the device memory used by `read(options)`
+   */
+  memory_estimate estimate_memory(parquet_reader_options const& options,
+                                  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read a Parquet dataset in a series of chunks of bounded output size.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from an array of file paths
+   *
+   * @param chunk_read_limit Limit on the estimated size of each returned table, in bytes
+   * @param filepaths Paths to the files containing the input dataset
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::string> const& filepaths,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * @param chunk_read_limit Limit on the estimated size of each returned table, in bytes
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns true if there is any data left to be read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+};
+
+/**
+ * @brief Reads the file-level metadata of a Parquet dataset.
+ *
+ * @param sources Dataset sources
+ * @param filepaths Paths of the sources, used to look up their footers in `cache`; empty if the
+ * sources are not files
+ * @param cache Cache of the parsed footers; may be null
+ *
+ * @return The metadata of the dataset
+ */
+parquet_metadata read_metadata(std::vector<std::unique_ptr<cudf::io::datasource>> const& sources,
+                               std::vector<std::string> const& filepaths,
+                               metadata_cache* cache);
+
 /**
  * @brief Class to write parquet dataset data into columns.
  */
@@ -161,6 +242,15 @@ class writer {
     const std::vector<std::unique_ptr<std::vector<uint8_t>>>& metadata_list);
 };
 
+/**
+ * @copydoc cudf::io::write_parquet_dataset
+ *
+ * @param stream CUDA stream used to partition the table; each file is encoded on its own stream
+ */
+std::vector<std::string> write_dataset(parquet_dataset_writer_options const& options,
+                                       rmm::mr::device_memory_resource* mr,
+                                       rmm::cuda_stream_view stream);
+
 };  // namespace parquet
 };  // namespace detail
 };  // namespace io
@@ -23,6 +23,8 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -309,6 +311,282 @@ table_with_metadata read_json(
   json_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+namespace detail {
+namespace json {
+class chunked_reader;
+}  // namespace json
+}  // namespace detail
+
+/**
+ * @brief Chunked JSON Lines reader class to read a dataset in a series of tables of bounded input
+ * size.
+ *
+ * The input is split into consecutive byte ranges of `chunk_read_limit` bytes, and each call to
+ * `read_chunk` reads the lines that start in the next range. The column names, the object key to
+ * column mapping and the column types are determined once, from the options and the first chunk,
+ * and are reused for every later chunk, which skips the key collection and type inference passes.
+ * Object keys that are not in the first chunk are ignored. The input of the next chunk is read in
+ * the background while the current chunk is decoded.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of 256MB:
+ * @code
+ *  ...
+ *  cudf::io::json_reader_options options =
+ *  cudf::io::json_reader_options::builder(cudf::source_info(filepath)).lines(true);
+ *  cudf::io::chunked_json_reader reader(256 << 20, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_json_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_json_reader() = default;
+
+  /**
+   * @brief Constructor with chunked reader options
+   *
+   * @throws cudf::logic_error if the options select a byte range, or if the input is compressed
+   *
+   * @param chunk_read_limit Number of input bytes to read per chunk; 0 reads the whole input as a
+   * single chunk
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_json_reader(
+    std::size_t chunk_read_limit,
+    json_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_json_reader();
+
+  /**
+   * @brief Returns true if there are more chunks to be read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @throw cudf::logic_error if there are no more chunks to read
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk();
+
+  // Unique pointer to impl reader class
+  std::unique_ptr<cudf::io::detail::json::chunked_reader> reader;
+};
+
+/** @} */  // end of group
+/**
+ * @addtogroup io_writers
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Builder to build options for `write_json()`.
+ */
+class json_writer_options_builder;
+
+/**
+ * @brief Settings to use for `write_json()`.
+ */
+class json_writer_options {
+  // Specify the sink to use for writer output
+  sink_info _sink;
+  // Set of columns to output
+  table_view _table;
+  // Whether to write the null fields of a row, as `null`, instead of omitting them
+  bool _include_nulls = true;
+  // maximum number of rows to write in each chunk (limits memory use)
+  size_type _rows_per_chunk = std::numeric_limits<size_type>::max();
+  // Optional associated metadata
+  table_metadata const* _metadata = nullptr;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   */
+  explicit json_writer_options(sink_info const& sink, table_view const& table)
+    : _sink(sink), _table(table), _rows_per_chunk(table.num_rows())
+  {
+  }
+
+  friend json_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options() = default;
+
+  /**
+   * @brief Create builder to create `json_writer_options`.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   *
+   * @return Builder to build json_writer_options.
+   */
+  static json_writer_options_builder builder(sink_info const& sink, table_view const& table);
+
+  /**
+   * @brief Returns sink used for writer output.
+   */
+  sink_info const& get_sink() const { return _sink; }
+
+  /**
+   * @brief Returns table that would be written to output.
+   */
+  table_view const& get_table() const { return _table; }
+
+  /**
+   * @brief Returns optional associated metadata.
+   */
+  table_metadata const* get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Whether to write the null fields of a row as `null`, instead of omitting them.
+   */
+  bool is_enabled_include_nulls() const { return _include_nulls; }
+
+  /**
+   * @brief Returns maximum number of rows to process for each file write.
+   */
+  size_type get_rows_per_chunk() const { return _rows_per_chunk; }
+
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata.
+   */
+  void set_metadata(table_metadata const* metadata) { _metadata = metadata; }
+
+  /**
+   * @brief Enables/Disables writing the null fields of a row as `null`.
+   *
+   * @param val Boolean value to enable/disable.
+   */
+  void enable_include_nulls(bool val) { _include_nulls = val; }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk.
+   */
+  void set_rows_per_chunk(size_type val) { _rows_per_chunk = val; }
+};
+
+class json_writer_options_builder {
+  json_writer_options options;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   */
+  explicit json_writer_options_builder(sink_info const& sink, table_view const& table)
+    : options{sink, table}
+  {
+  }
+
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& metadata(table_metadata const* metadata)
+  {
+    options._metadata = metadata;
+    return *this;
+  }
+
+  /**
+   * @brief Enables/Disables writing the null fields of a row as `null`.
+   *
+   * @param val Boolean value to enable/disable.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& include_nulls(bool val)
+  {
+    options._include_nulls = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& rows_per_chunk(size_type val)
+  {
+    options._rows_per_chunk = val;
+    return *this;
+  }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   */
+  operator json_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   */
+  json_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writes a set of columns in the JSON Lines format.
+ *
+ * Each row is written as a JSON object on its own line, with a member per column that is named
+ * after the column, or after its index if the metadata has no column names. The columns are
+ * formatted and the rows assembled on the device, like in `write_csv()`:
+ * - Strings are escaped as JSON strings, and timestamps are written as ISO 8601 strings.
+ * - Booleans are written as `true` or `false`, and durations as their count of ticks.
+ * - NaN and infinite floating-point values, which JSON cannot represent, are written as nulls.
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  cudf::io::sink_info sink_info("dataset.jsonl");
+ *  auto options = cudf::io::json_writer_options::builder(sink_info, table->view());
+ *  cudf::io::write_json(options);
+ * @endcode
+ *
+ * @throw cudf::logic_error if a column is of an unsupported type
+ *
+ * @param options Settings for controlling writing behavior.
+ * @param mr Device memory resource to use for device memory allocation.
+ */
+void write_json(json_writer_options const& options,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file metadata_cache.hpp
+ * @brief cuDF-IO cache of parsed file metadata
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_readers
+ * @{
+ */
+
+/**
+ * @brief Cache of the parsed footers of Parquet and ORC files, shared by the readers that are
+ * given the cache in their options.
+ *
+ * The entries are keyed on the path, the size and the modification time of each file, so a file
+ * that is rewritten is parsed again on its next read. Once the cache holds `capacity()` entries,
+ * the least recently used entry is evicted on each insertion. Only the sources specified as file
+ * paths are cached. All member functions are thread-safe.
+ *
+ * The following code snippet demonstrates how to reuse the footer of a file across reads:
+ * @code
+ *  auto cache   = std::make_shared<cudf::io::metadata_cache>();
+ *  auto options = cudf::io::parquet_reader_options::builder(cudf::io::source_info("data.parquet"))
+ *                   .metadata_cache(cache)
+ *                   .build();
+ *  auto first   = cudf::io::read_parquet(options);
+ *  auto second  = cudf::io::read_parquet(options);  // The footer is not read again
+ * @endcode
+ */
+class metadata_cache {
+ public:
+  /**
+   * @brief Constructor for an empty cache.
+   *
+   * @param capacity Maximum number of cached entries; must be positive
+   */
+  explicit metadata_cache(std::size_t capacity = 1024);
+
+  ~metadata_cache();
+
+  metadata_cache(metadata_cache const &) = delete;
+  metadata_cache &operator=(metadata_cache const &) = delete;
+
+  /**
+   * @brief Returns the maximum number of cached entries.
+   */
+  std::size_t capacity() const;
+
+  /**
+   * @brief Returns the number of cached entries.
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Returns the number of lookups that found their entry in the cache.
+   */
+  std::size_t hits() const;
+
+  /**
+   * @brief Returns the number of lookups that had to parse their entry.
+   */
+  std::size_t misses() const;
+
+  /**
+   * @brief Removes all the entries.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the entry of `key`, calling `parse` to create and insert it if it is not
+   * cached.
+   *
+   * This is how the readers consult the cache. The entries are opaque to other callers. `parse` is
+   * called without holding the lock of the cache, so concurrent misses on different files are
+   * parsed in parallel. An exception thrown by `parse` is propagated and nothing is inserted.
+   *
+   * @param key Key of the entry, which identifies both the file and the format of the entry
+   * @param parse Function returning the parsed entry
+   *
+   * @return The cached or newly parsed entry
+   */
+  std::shared_ptr<void const> get_or_parse(
+    std::string const &key, std::function<std::shared_ptr<void const>()> const &parse);
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
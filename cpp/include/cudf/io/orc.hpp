@@ -17,16 +17,25 @@
 #pragma once
 
 #include <cudf/io/detail/orc.hpp>
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <thrust/optional.h>
+
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+// Forward declaration
+class expression;
+}  // namespace ast
+
 namespace io {
 /**
  * @addtogroup io_readers
@@ -63,6 +72,12 @@ class orc_reader_options {
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
 
+  // Filter used to skip stripes using their column statistics
+  thrust::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // Cache of the parsed file footers, shared with other reads
+  std::shared_ptr<metadata_cache> _metadata_cache;
+
   friend orc_reader_options_builder;
 
   /**
@@ -128,6 +143,19 @@ class orc_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Returns the filter used to skip stripes, if any.
+   */
+  thrust::optional<std::reference_wrapper<ast::expression const>> const& get_filter() const
+  {
+    return _filter;
+  }
+
+  /**
+   * @brief Returns the cache of the parsed file footers, if any.
+   */
+  std::shared_ptr<metadata_cache> const& get_metadata_cache() const { return _metadata_cache; }
+
   // Setters
 
   /**
@@ -191,6 +219,35 @@ class orc_reader_options {
    * @param type Type of timestamp.
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets the filter used to skip stripes.
+   *
+   * Column references in the filter are indices into the columns being read. Stripes whose
+   * column statistics show that no row can satisfy the filter are not read; rows of the remaining
+   * stripes are returned unfiltered. Comparisons between a column and a literal of the same type,
+   * combined with `LOGICAL_AND`/`LOGICAL_OR`, are evaluated against the statistics of integer,
+   * floating-point and date columns; anything else is assumed to match.
+   *
+   * The expression is referenced, not copied, and must outlive the read.
+   *
+   * @param filter AST expression to evaluate against the stripe statistics.
+   */
+  void set_filter(ast::expression const& filter) { _filter = std::cref(filter); }
+
+  /**
+   * @brief Sets the cache of the parsed file footers.
+   *
+   * The postscript, footer and metadata sections of the sources specified as file paths are
+   * looked up in the cache before being read, and are added to it after being parsed. Other
+   * sources are not cached.
+   *
+   * @param cache Cache shared with other reads; null to disable caching.
+   */
+  void set_metadata_cache(std::shared_ptr<metadata_cache> cache)
+  {
+    _metadata_cache = std::move(cache);
+  }
 };
 
 class orc_reader_options_builder {
@@ -295,6 +352,30 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the filter used to skip stripes.
+   *
+   * @param filter AST expression to evaluate against the stripe statistics.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the cache of the parsed file footers.
+   *
+   * @param cache Cache shared with other reads.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& metadata_cache(std::shared_ptr<cudf::io::metadata_cache> cache)
+  {
+    options.set_metadata_cache(std::move(cache));
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -331,6 +412,75 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Chunked ORC reader class to read a dataset in a series of bounded-size tables.
+ *
+ * The intent of the chunked_orc_reader is to allow reading a dataset that does not fit in device
+ * memory as a sequence of tables. Each table holds whole stripes, grouped so that their estimated
+ * decoded size does not exceed `chunk_read_limit`. The file footer, the stripe footers and the
+ * timezone conversion table are parsed once and reused by every chunk.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of at most 1GB:
+ * @code
+ *  ...
+ *  cudf::io::orc_reader_options options =
+ *  cudf::io::orc_reader_options::builder(cudf::source_info(filepath));
+ *  cudf::io::chunked_orc_reader reader(1 << 30, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_orc_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_orc_reader() = default;
+
+  /**
+   * @brief Constructor with chunked reader options
+   *
+   * A chunk always contains at least one stripe, so a single stripe larger than the limit is
+   * returned as its own chunk.
+   *
+   * @param chunk_read_limit Limit on the estimated size of each returned table, in bytes; 0 reads
+   * the whole selection as a single chunk
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_orc_reader(
+    std::size_t chunk_read_limit,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_orc_reader();
+
+  /**
+   * @brief Returns true if there are more chunks to be read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * The first call always returns a table, which is empty if no rows were selected.
+   *
+   * @throw cudf::logic_error if there are no more chunks to read
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk();
+
+  // Unique pointer to impl reader class
+  std::unique_ptr<cudf::io::detail::orc::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -21,8 +21,11 @@
 
 #pragma once
 
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/io/types.hpp>
 
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace cudf {
@@ -60,6 +63,36 @@ struct raw_orc_statistics {
  */
 raw_orc_statistics read_raw_orc_statistics(source_info const& src_info);
 
+/**
+ * @brief Holds the file-level metadata of an ORC file, as read from the tail of the file.
+ *
+ * The `column_names` member contains one element per column of the ORC schema, including the
+ * nested and root columns, and `stripe_num_rows` one element per stripe.
+ */
+struct orc_metadata {
+  uint64_t num_rows = 0;
+  std::vector<uint32_t> stripe_num_rows;
+  std::vector<std::string> column_names;
+};
+
+/**
+ * @brief Reads the file-level metadata of an ORC dataset without reading its data.
+ *
+ * @ingroup io_readers
+ *
+ * The following code snippet demonstrates how to read the metadata of a dataset from a file:
+ * @code
+ *  auto result = cudf::io::read_orc_metadata(cudf::io::source_info("dataset.orc"));
+ * @endcode
+ *
+ * @param src_info Dataset source
+ * @param cache Cache of the parsed file tails, shared with the readers; may be null
+ *
+ * @return The number of rows, the stripes and the column names
+ */
+orc_metadata read_orc_metadata(source_info const& src_info,
+                               std::shared_ptr<metadata_cache> cache = nullptr);
+
 /**
  * @brief Enumerator for types of column statistics that can be included in `column_statistics`.
  *
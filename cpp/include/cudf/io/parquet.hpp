@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/io/detail/parquet.hpp>
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -26,12 +27,19 @@
 
 #include <thrust/optional.h>
 
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+// Forward declaration
+class expression;
+}  // namespace ast
+
 namespace io {
 /**
  * @addtogroup io_readers
@@ -62,6 +70,8 @@ class parquet_reader_options {
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
+  // Whether to return dictionary-encoded string columns as dictionary columns
+  bool _output_dictionary_strings = false;
   // Whether to use PANDAS metadata to load columns
   bool _use_pandas_metadata = true;
   // Cast timestamp columns to a specific type
@@ -71,6 +81,17 @@ class parquet_reader_options {
   // doubles for storage of types unsupported by cudf
   bool _strict_decimal_types = false;
 
+  // Filter used to skip row groups using their column statistics
+  thrust::optional<std::reference_wrapper<ast::expression const>> _filter;
+  // Whether to also remove the rows that don't satisfy the filter
+  bool _filter_rows = false;
+
+  // Whether to collect the time and the bytes of each phase of the read
+  bool _io_statistics = false;
+
+  // Cache of the parsed file footers, shared with other reads
+  std::shared_ptr<metadata_cache> _metadata_cache;
+
   /**
    * @brief Constructor from source info.
    *
@@ -107,6 +128,12 @@ class parquet_reader_options {
    */
   bool is_enabled_convert_strings_to_categories() const { return _convert_strings_to_categories; }
 
+  /**
+   * @brief Returns true/false depending on whether dictionary-encoded string columns should be
+   * returned as dictionary columns or not.
+   */
+  bool is_enabled_output_dictionary_strings() const { return _output_dictionary_strings; }
+
   /**
    * @brief Returns true/false depending whether to use pandas metadata or not while reading.
    */
@@ -143,6 +170,29 @@ class parquet_reader_options {
    */
   bool is_enabled_strict_decimal_types() const { return _strict_decimal_types; }
 
+  /**
+   * @brief Returns the filter used to skip row groups, if any.
+   */
+  thrust::optional<std::reference_wrapper<ast::expression const>> const& get_filter() const
+  {
+    return _filter;
+  }
+
+  /**
+   * @brief Returns true if the rows that don't satisfy the filter are removed from the output.
+   */
+  bool is_enabled_filter_rows() const { return _filter_rows; }
+
+  /**
+   * @brief Returns true if the statistics of the read phases are collected.
+   */
+  bool is_enabled_io_statistics() const { return _io_statistics; }
+
+  /**
+   * @brief Returns the cache of the parsed file footers, if any.
+   */
+  std::shared_ptr<metadata_cache> const& get_metadata_cache() const { return _metadata_cache; }
+
   /**
    * @brief Sets names of the columns to be read.
    *
@@ -171,6 +221,20 @@ class parquet_reader_options {
    */
   void enable_convert_strings_to_categories(bool val) { _convert_strings_to_categories = val; }
 
+  /**
+   * @brief Sets to enable/disable returning dictionary-encoded string columns as dictionary
+   * columns.
+   *
+   * When enabled, every top-level string column whose column chunks are all dictionary-encoded is
+   * returned as a DICTIONARY32 column. Its indices are decoded straight from the data pages and
+   * its keys are the distinct entries of the dictionary pages of all the chunks read, so the
+   * strings are never expanded. The other string columns are returned as STRING columns. This
+   * does not apply to the columns converted to categories.
+   *
+   * @param val Boolean value to enable/disable returning dictionary columns.
+   */
+  void enable_output_dictionary_strings(bool val) { _output_dictionary_strings = val; }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -220,6 +284,57 @@ class parquet_reader_options {
    * cudf will convert unsupported types to double.
    */
   void set_strict_decimal_types(bool val) { _strict_decimal_types = val; }
+
+  /**
+   * @brief Sets the filter used to skip row groups.
+   *
+   * Column references in the filter are indices into the columns being read. Row groups whose
+   * column statistics show that no row can satisfy the filter are not read; rows of the remaining
+   * row groups are returned unfiltered, unless `enable_filter_rows()` is set. Comparisons between
+   * a column and a literal of the same type, combined with `LOGICAL_AND`/`LOGICAL_OR`, are
+   * evaluated against the statistics; anything else is assumed to match.
+   *
+   * The expression is referenced, not copied, and must outlive the read.
+   *
+   * @param filter AST expression to evaluate against the row group statistics.
+   */
+  void set_filter(ast::expression const& filter) { _filter = std::cref(filter); }
+
+  /**
+   * @brief Sets to enable/disable removing the rows that don't satisfy the filter.
+   *
+   * When enabled, the filter is evaluated on the rows of the row groups that are read, and only
+   * the rows for which it is true are returned, as with `cudf::ast::filter`. For schemas without
+   * lists, the columns referenced by the filter are decoded first, and the pages of the other
+   * columns are only decoded if they hold some of the returned rows. Has no effect without a
+   * filter.
+   *
+   * @param val Boolean value to enable/disable filtering the rows.
+   */
+  void enable_filter_rows(bool val) { _filter_rows = val; }
+
+  /**
+   * @brief Enables/disables the collection of the statistics of the read phases.
+   *
+   * When enabled, the result of the read holds the time and the bytes of the read, decompress and
+   * decode phases. Each phase synchronizes the stream to be timed, so the read may be slower.
+   *
+   * @param val Boolean value to enable/disable the statistics.
+   */
+  void enable_io_statistics(bool val) { _io_statistics = val; }
+
+  /**
+   * @brief Sets the cache of the parsed file footers.
+   *
+   * The footers of the sources specified as file paths are looked up in the cache before being
+   * read, and are added to it after being parsed. Other sources are not cached.
+   *
+   * @param cache Cache shared with other reads; null to disable caching.
+   */
+  void set_metadata_cache(std::shared_ptr<metadata_cache> cache)
+  {
+    _metadata_cache = std::move(cache);
+  }
 };
 
 class parquet_reader_options_builder {
@@ -276,6 +391,19 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable returning dictionary-encoded string columns as dictionary
+   * columns.
+   *
+   * @param val Boolean value to enable/disable returning dictionary columns.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& output_dictionary_strings(bool val)
+  {
+    options._output_dictionary_strings = val;
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -336,6 +464,54 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the filter used to skip row groups.
+   *
+   * @param filter AST expression to evaluate against the row group statistics.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
+  /**
+   * @brief Sets to enable/disable removing the rows that don't satisfy the filter.
+   *
+   * @param val Boolean value to enable/disable filtering the rows.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& filter_rows(bool val)
+  {
+    options._filter_rows = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets to enable/disable the collection of the statistics of the read phases.
+   *
+   * @param val Boolean value to enable/disable the statistics.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& io_statistics(bool val)
+  {
+    options._io_statistics = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the cache of the parsed file footers.
+   *
+   * @param cache Cache shared with other reads.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& metadata_cache(std::shared_ptr<cudf::io::metadata_cache> cache)
+  {
+    options.set_metadata_cache(std::move(cache));
+    return *this;
+  }
+
   /**
    * @brief move parquet_reader_options member once it's built.
    */
@@ -372,6 +548,89 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Estimates the device memory used by `read_parquet(options)`, from the file footers only.
+ *
+ * The temporaries are the selected column chunks read to the device and their decompressed pages.
+ * The output size is the uncompressed size of the column chunks, or the size of their values once
+ * decoded to fixed-width types if larger, plus the offsets and null masks of every nesting level.
+ * Strings decoded from dictionary pages may be larger than their column chunks.
+ *
+ * @param options Settings for controlling reading behavior
+ *
+ * @return Estimate of the device memory used by the read
+ */
+memory_estimate estimate_parquet_read_memory(parquet_reader_options const& options);
+
+/**
+ * @brief Chunked parquet reader class to read a dataset in a series of bounded-size tables.
+ *
+ * The intent of the chunked_parquet_reader is to allow reading a dataset that does not fit in
+ * device memory as a sequence of tables. Each table holds whole row groups, grouped so that their
+ * estimated decoded size does not exceed `chunk_read_limit`. The file metadata and the column
+ * selection are parsed once and reused by every chunk.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of at most 1GB:
+ * @code
+ *  ...
+ *  cudf::io::parquet_reader_options options =
+ *  cudf::io::parquet_reader_options::builder(cudf::source_info(filepath));
+ *  cudf::io::chunked_parquet_reader reader(1 << 30, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_parquet_reader() = default;
+
+  /**
+   * @brief Constructor with chunked reader options
+   *
+   * A chunk always contains at least one row group, so a single row group larger than the limit
+   * is returned as its own chunk.
+   *
+   * @param chunk_read_limit Limit on the estimated size of each returned table, in bytes; 0 reads
+   * the whole selection as a single chunk
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_parquet_reader(
+    std::size_t chunk_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Returns true if there are more chunks to be read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * The first call always returns a table, which is empty if no rows were selected.
+   *
+   * @throw cudf::logic_error if there are no more chunks to read
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk();
+
+  // Unique pointer to impl reader class
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -380,6 +639,15 @@ table_with_metadata read_parquet(
  */
 class table_input_metadata;
 
+/**
+ * @brief Encoding of the data pages of a column
+ */
+enum class column_encoding {
+  USE_DEFAULT,  ///< Dictionary encoding for the column chunks where it's smaller than plain
+  DICTIONARY,   ///< Dictionary encoding, whenever the column type supports it
+  PLAIN,        ///< Plain encoding
+};
+
 class column_in_metadata {
   friend table_input_metadata;
   std::string _name = "";
@@ -389,6 +657,8 @@ class column_in_metadata {
   bool _use_int96_timestamp = false;
   // bool _output_as_binary = false;
   thrust::optional<uint8_t> _decimal_precision;
+  column_encoding _encoding = column_encoding::USE_DEFAULT;
+  bool _bloom_filter        = false;
   std::vector<column_in_metadata> children;
 
  public:
@@ -456,6 +726,37 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Set the encoding of this column
+   *
+   * By default, the writer uses dictionary encoding for the column chunks where it's smaller than
+   * plain encoding. Dictionary encoding is only supported for non-boolean, non-nested columns.
+   *
+   * @param encoding The encoding to use for this column
+   * @return this for chaining
+   */
+  column_in_metadata& set_encoding(column_encoding encoding)
+  {
+    _encoding = encoding;
+    return *this;
+  }
+
+  /**
+   * @brief Specifies whether to write a bloom filter for each column chunk of this column
+   *
+   * The bloom filters let readers skip the row groups that don't contain a value. They are only
+   * supported for non-nested columns of integer, floating point, timestamp, duration, fixed-point
+   * and string types.
+   *
+   * @param enabled True = write bloom filters. False = don't write bloom filters
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter(bool enabled)
+  {
+    _bloom_filter = enabled;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -511,6 +812,16 @@ class column_in_metadata {
    */
   uint8_t get_decimal_precision() const { return _decimal_precision.value(); }
 
+  /**
+   * @brief Get the encoding that was set for this column
+   */
+  column_encoding get_encoding() const { return _encoding; }
+
+  /**
+   * @brief Get whether to write bloom filters for this column
+   */
+  bool is_enabled_bloom_filter() const { return _bloom_filter; }
+
   /**
    * @brief Get the number of children of this column
    */
@@ -559,6 +870,8 @@ class parquet_writer_options {
   bool _write_timestamps_as_int96 = false;
   // Column chunks file path to be set in the raw output metadata
   std::string _column_chunks_file_path;
+  // Optional statistics of the write phases
+  io_statistics* _io_statistics = nullptr;
 
   /**
    * @brief Constructor from sink and table.
@@ -633,6 +946,11 @@ class parquet_writer_options {
    */
   std::string get_column_chunks_file_path() const { return _column_chunks_file_path; }
 
+  /**
+   * @brief Returns the statistics updated with the write phases, if any.
+   */
+  io_statistics* get_io_statistics() const { return _io_statistics; }
+
   /**
    * @brief Sets metadata.
    *
@@ -671,6 +989,16 @@ class parquet_writer_options {
   {
     _column_chunks_file_path.assign(file_path);
   }
+
+  /**
+   * @brief Sets the statistics to update with the time and the bytes of the write phases.
+   *
+   * The statistics are accumulated, so they must be zero-initialized before writing, and must
+   * outlive the write. Each phase synchronizes the stream to be timed, so the write may be slower.
+   *
+   * @param statistics Statistics to update, or null not to collect them.
+   */
+  void set_io_statistics(io_statistics* statistics) { _io_statistics = statistics; }
 };
 
 class parquet_writer_options_builder {
@@ -755,6 +1083,18 @@ class parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the statistics to update with the time and the bytes of the write phases.
+   *
+   * @param statistics Statistics to update, or null not to collect them.
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& io_statistics(cudf::io::io_statistics* statistics)
+  {
+    options._io_statistics = statistics;
+    return *this;
+  }
+
   /**
    * @brief move parquet_writer_options member once it's built.
    */
@@ -822,6 +1162,8 @@ class chunked_parquet_writer_options {
   // Parquet writer can write INT96 or TIMESTAMP_MICROS. Defaults to TIMESTAMP_MICROS.
   // If true then overrides any per-column setting in _metadata.
   bool _write_timestamps_as_int96 = false;
+  // Optional statistics of the write phases
+  io_statistics* _io_statistics = nullptr;
 
   /**
    * @brief Constructor from sink.
@@ -865,6 +1207,11 @@ class chunked_parquet_writer_options {
    */
   bool is_enabled_int96_timestamps() const { return _write_timestamps_as_int96; }
 
+  /**
+   * @brief Returns the statistics updated with the write phases, if any.
+   */
+  io_statistics* get_io_statistics() const { return _io_statistics; }
+
   /**
    * @brief Sets metadata.
    *
@@ -894,6 +1241,16 @@ class chunked_parquet_writer_options {
    */
   void enable_int96_timestamps(bool req) { _write_timestamps_as_int96 = req; }
 
+  /**
+   * @brief Sets the statistics to update with the time and the bytes of the write phases.
+   *
+   * The statistics are accumulated, so they must be zero-initialized before writing, and must
+   * outlive the write. Each phase synchronizes the stream to be timed, so the write may be slower.
+   *
+   * @param statistics Statistics to update, or null not to collect them.
+   */
+  void set_io_statistics(io_statistics* statistics) { _io_statistics = statistics; }
+
   /**
    * @brief creates builder to build chunked_parquet_writer_options.
    *
@@ -973,6 +1330,18 @@ class chunked_parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the statistics to update with the time and the bytes of the write phases.
+   *
+   * @param statistics Statistics to update, or null not to collect them.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& io_statistics(cudf::io::io_statistics* statistics)
+  {
+    options._io_statistics = statistics;
+    return *this;
+  }
+
   /**
    * @brief move chunked_parquet_writer_options member once it's built.
    */
@@ -1059,6 +1428,320 @@ class parquet_chunked_writer {
   std::unique_ptr<cudf::io::detail::parquet::writer> writer;
 };
 
+/**
+ * @brief Class to build `parquet_dataset_writer_options`.
+ */
+class parquet_dataset_writer_options_builder;
+
+/**
+ * @brief Settings for `write_parquet_dataset()`.
+ */
+class parquet_dataset_writer_options {
+  // Directory under which the partition directories are created
+  std::string _base_path;
+  // Table to partition and write
+  table_view _table;
+  // Indices of the columns to partition by
+  std::vector<size_type> _partition_cols;
+  // Specify the compression format to use
+  compression_type _compression = compression_type::SNAPPY;
+  // Specify the level of statistics in the output files
+  statistics_freq _stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  // Optional associated metadata, for all the columns of the table
+  table_input_metadata const* _metadata = nullptr;
+  // Whether to write timestamps as INT96
+  bool _write_timestamps_as_int96 = false;
+  // Maximum number of rows in each file
+  size_type _max_rows_per_file = std::numeric_limits<size_type>::max();
+  // Maximum number of files encoded at the same time
+  size_type _max_concurrent_files = 4;
+
+  /**
+   * @brief Constructor from base path, table and partition columns.
+   *
+   * @param base_path Directory under which the partition directories are created.
+   * @param table Table to partition and write.
+   * @param partition_cols Indices of the columns to partition by.
+   */
+  explicit parquet_dataset_writer_options(std::string const& base_path,
+                                          table_view const& table,
+                                          std::vector<size_type> const& partition_cols)
+    : _base_path(base_path), _table(table), _partition_cols(partition_cols)
+  {
+  }
+
+  friend class parquet_dataset_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  parquet_dataset_writer_options() = default;
+
+  /**
+   * @brief Create builder to create `parquet_dataset_writer_options`.
+   *
+   * @param base_path Directory under which the partition directories are created.
+   * @param table Table to partition and write.
+   * @param partition_cols Indices of the columns to partition by.
+   *
+   * @return Builder to build parquet_dataset_writer_options.
+   */
+  static parquet_dataset_writer_options_builder builder(
+    std::string const& base_path,
+    table_view const& table,
+    std::vector<size_type> const& partition_cols);
+
+  /**
+   * @brief Returns the directory under which the partition directories are created.
+   */
+  std::string const& get_base_path() const { return _base_path; }
+
+  /**
+   * @brief Returns table_view.
+   */
+  table_view get_table() const { return _table; }
+
+  /**
+   * @brief Returns the indices of the columns to partition by.
+   */
+  std::vector<size_type> const& get_partition_cols() const { return _partition_cols; }
+
+  /**
+   * @brief Returns compression format used.
+   */
+  compression_type get_compression() const { return _compression; }
+
+  /**
+   * @brief Returns level of statistics requested in the output files.
+   */
+  statistics_freq get_stats_level() const { return _stats_level; }
+
+  /**
+   * @brief Returns associated metadata.
+   */
+  table_input_metadata const* get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Returns `true` if timestamps will be written as INT96
+   */
+  bool is_enabled_int96_timestamps() const { return _write_timestamps_as_int96; }
+
+  /**
+   * @brief Returns the maximum number of rows in each file.
+   */
+  size_type get_max_rows_per_file() const { return _max_rows_per_file; }
+
+  /**
+   * @brief Returns the maximum number of files encoded at the same time.
+   */
+  size_type get_max_concurrent_files() const { return _max_concurrent_files; }
+
+  /**
+   * @brief Sets metadata.
+   *
+   * The metadata describes all the columns of the table, including the partition columns, whose
+   * names are used for the partition directories.
+   *
+   * @param metadata Associated metadata.
+   */
+  void set_metadata(table_input_metadata const* metadata) { _metadata = metadata; }
+
+  /**
+   * @brief Sets the level of statistics.
+   *
+   * @param sf Level of statistics requested in the output files.
+   */
+  void set_stats_level(statistics_freq sf) { _stats_level = sf; }
+
+  /**
+   * @brief Sets compression type.
+   *
+   * @param compression The compression type to use.
+   */
+  void set_compression(compression_type compression) { _compression = compression; }
+
+  /**
+   * @brief Sets timestamp writing preferences. INT96 timestamps will be written
+   * if `true` and TIMESTAMP_MICROS will be written if `false`.
+   *
+   * @param req Boolean value to enable/disable writing of INT96 timestamps
+   */
+  void enable_int96_timestamps(bool req) { _write_timestamps_as_int96 = req; }
+
+  /**
+   * @brief Sets the maximum number of rows in each file.
+   *
+   * The rows of a partition that has more rows are written to several files.
+   *
+   * @param val Maximum number of rows; must be positive.
+   */
+  void set_max_rows_per_file(size_type val)
+  {
+    CUDF_EXPECTS(val > 0, "The maximum number of rows per file must be positive");
+    _max_rows_per_file = val;
+  }
+
+  /**
+   * @brief Sets the maximum number of files encoded at the same time.
+   *
+   * Each file being encoded holds its own device buffers, so the peak memory use of the write
+   * grows with this number.
+   *
+   * @param val Maximum number of files; must be positive.
+   */
+  void set_max_concurrent_files(size_type val)
+  {
+    CUDF_EXPECTS(val > 0, "The maximum number of concurrent files must be positive");
+    _max_concurrent_files = val;
+  }
+};
+
+class parquet_dataset_writer_options_builder {
+  parquet_dataset_writer_options options;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit parquet_dataset_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from base path, table and partition columns.
+   *
+   * @param base_path Directory under which the partition directories are created.
+   * @param table Table to partition and write.
+   * @param partition_cols Indices of the columns to partition by.
+   */
+  explicit parquet_dataset_writer_options_builder(std::string const& base_path,
+                                                  table_view const& table,
+                                                  std::vector<size_type> const& partition_cols)
+    : options(base_path, table, partition_cols)
+  {
+  }
+
+  /**
+   * @brief Sets metadata in parquet_dataset_writer_options.
+   *
+   * @param metadata Associated metadata.
+   * @return this for chaining.
+   */
+  parquet_dataset_writer_options_builder& metadata(table_input_metadata const* metadata)
+  {
+    options._metadata = metadata;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the level of statistics in parquet_dataset_writer_options.
+   *
+   * @param sf Level of statistics requested in the output files.
+   * @return this for chaining.
+   */
+  parquet_dataset_writer_options_builder& stats_level(statistics_freq sf)
+  {
+    options._stats_level = sf;
+    return *this;
+  }
+
+  /**
+   * @brief Sets compression type in parquet_dataset_writer_options.
+   *
+   * @param compression The compression type to use.
+   * @return this for chaining.
+   */
+  parquet_dataset_writer_options_builder& compression(compression_type compression)
+  {
+    options._compression = compression;
+    return *this;
+  }
+
+  /**
+   * @brief Sets whether int96 timestamps are written or not in parquet_dataset_writer_options.
+   *
+   * @param enabled Boolean value to enable/disable int96 timestamps.
+   * @return this for chaining.
+   */
+  parquet_dataset_writer_options_builder& int96_timestamps(bool enabled)
+  {
+    options._write_timestamps_as_int96 = enabled;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum number of rows in each file.
+   *
+   * @param val Maximum number of rows; must be positive.
+   * @return this for chaining.
+   */
+  parquet_dataset_writer_options_builder& max_rows_per_file(size_type val)
+  {
+    options.set_max_rows_per_file(val);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum number of files encoded at the same time.
+   *
+   * @param val Maximum number of files; must be positive.
+   * @return this for chaining.
+   */
+  parquet_dataset_writer_options_builder& max_concurrent_files(size_type val)
+  {
+    options.set_max_concurrent_files(val);
+    return *this;
+  }
+
+  /**
+   * @brief move parquet_dataset_writer_options member once it's built.
+   */
+  operator parquet_dataset_writer_options &&() { return std::move(options); }
+
+  /**
+   * @brief move parquet_dataset_writer_options member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   */
+  parquet_dataset_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writes a table as a Hive-partitioned set of parquet files.
+ *
+ * The rows are grouped on the GPU by the values of the partition columns. The rows of each
+ * distinct combination of values are written under the directory
+ * `<base_path>/<name1>=<value1>/<name2>=<value2>/...`, to files named `part-<N>.parquet` holding
+ * at most `get_max_rows_per_file()` rows each. The partition columns are not written to the
+ * files. Null and empty values are named `__HIVE_DEFAULT_PARTITION__`, and the characters of the
+ * names and values that are not allowed in paths are percent-encoded. The files are encoded
+ * concurrently, each on its own stream.
+ *
+ * The following code snippet demonstrates how to write a table partitioned by its first column:
+ * @code
+ *  auto options =
+ *    cudf::io::parquet_dataset_writer_options::builder("/data/events", table->view(), {0})
+ *      .metadata(&metadata)
+ *      .max_rows_per_file(1000000);
+ *  auto paths = cudf::io::write_parquet_dataset(options);
+ * @endcode
+ *
+ * @throw cudf::logic_error if no partition column is given, if all the columns are partition
+ * columns, or if a partition column is not of a numeric, boolean or string type.
+ *
+ * @param options Settings for controlling writing behavior.
+ * @param mr Device memory resource to use for device memory allocation.
+ *
+ * @return The paths of the written files, relative to the base path, in the order of the sorted
+ * partition values
+ */
+std::vector<std::string> write_parquet_dataset(
+  parquet_dataset_writer_options const& options,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
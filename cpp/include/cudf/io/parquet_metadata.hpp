@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file parquet_metadata.hpp
+ * @brief cuDF-IO freeform API
+ */
+
+#pragma once
+
+#include <cudf/io/metadata_cache.hpp>
+#include <cudf/io/types.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Holds the file-level metadata of a Parquet dataset, as read from the file footers.
+ *
+ * The `row_group_num_rows` member contains one element per row group, in the order of the
+ * sources, and `column_names` one element per top-level column.
+ */
+struct parquet_metadata {
+  size_type num_rows = 0;
+  std::vector<size_type> row_group_num_rows;
+  std::vector<std::string> column_names;
+  std::map<std::string, std::string> key_value_metadata;
+};
+
+/**
+ * @brief Reads the file-level metadata of a Parquet dataset without reading its data.
+ *
+ * @ingroup io_readers
+ *
+ * The following code snippet demonstrates how to read the metadata of a dataset from a file:
+ * @code
+ *  auto result = cudf::io::read_parquet_metadata(cudf::io::source_info("dataset.parquet"));
+ * @endcode
+ *
+ * @throw cudf::logic_error if the sources have different schemas
+ *
+ * @param src_info Dataset source
+ * @param cache Cache of the parsed footers of the files, shared with the readers; may be null
+ *
+ * @return The number of rows, the row groups, the column names and the key-value metadata
+ */
+parquet_metadata read_parquet_metadata(source_info const& src_info,
+                                       std::shared_ptr<metadata_cache> cache = nullptr);
+
+}  // namespace io
+}  // namespace cudf
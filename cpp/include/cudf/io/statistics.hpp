@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file statistics.hpp
+ * @brief cuDF-IO freeform API
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Holds the statistics of a column, computed with the kernels that the writers use for
+ * the file statistics.
+ *
+ * Both tables have the following columns:
+ * - `null_count` (INT32): Number of null rows
+ * - `valid_count` (INT32): Number of non-null rows
+ * - `min` (type of the column): Minimum value, null if every row is null or NaN
+ * - `max` (type of the column): Maximum value, null if every row is null or NaN
+ * - `sum` (FLOAT64 for floating-point columns, INT64 otherwise): Sum of the values, or of the
+ *   string lengths for string columns; null if not computed, which includes the 64-bit integer,
+ *   timestamp and duration columns whose sum could overflow
+ */
+struct column_statistics {
+  std::unique_ptr<table> chunks;  ///< One row per chunk of rows of the column
+  std::unique_ptr<table> total;   ///< One row for the whole column
+};
+
+/**
+ * @brief Computes the statistics of each column of a table, for each chunk of `group_size` rows
+ * and for the whole column.
+ *
+ * @ingroup io_writers
+ *
+ * The statistics of all the chunks of all the columns are gathered in a single kernel launch,
+ * and merged into the statistics of the whole columns in another one.
+ *
+ * The following code snippet demonstrates how to compute the statistics of a table:
+ * @code
+ *  auto stats = cudf::io::compute_statistics(table, 10000);
+ *  auto col0_nulls = stats[0].total->get_column(0);
+ * @endcode
+ *
+ * @throw cudf::logic_error if `group_size` is not positive
+ * @throw cudf::logic_error if a column is not a boolean, signed integer, floating-point,
+ * timestamp, duration or string column
+ *
+ * @param table Table to compute the statistics of
+ * @param group_size Number of rows of each chunk; the last chunk may be smaller
+ * @param mr Device memory resource used to allocate the returned tables' device memory
+ *
+ * @return The statistics of each column
+ */
+std::vector<column_statistics> compute_statistics(
+  table_view const& table,
+  size_type group_size                = 10000,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace io
+}  // namespace cudf
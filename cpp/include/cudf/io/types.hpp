@@ -23,8 +23,12 @@
 
 #include <cudf/types.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -58,7 +62,9 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD,    ///< ZSTD format, using LZ77 + Huffman + finite state entropy coding
+  LZ4      ///< LZ4 format, using LZ77
 };
 
 /**
@@ -88,6 +94,7 @@ enum statistics_freq {
   STATISTICS_NONE     = 0,  //!< No column statistics
   STATISTICS_ROWGROUP = 1,  //!< Per-Rowgroup column statistics
   STATISTICS_PAGE     = 2,  //!< Per-page column statistics
+  STATISTICS_COLUMN   = 3,  //!< Per-rowgroup statistics, plus page-level column and offset indexes
 };
 
 /**
@@ -153,12 +160,79 @@ struct table_metadata_with_nullability : public table_metadata {
   std::vector<bool> column_nullable;  //!< Per-column nullability information.
 };
 
+/**
+ * @brief Phases of reading or writing a file, for which `io_statistics` are collected
+ */
+enum class io_phase : int32_t {
+  READ,        ///< Reading the encoded data from the source
+  DECOMPRESS,  ///< Decompressing the encoded data
+  DECODE,      ///< Decoding the data into columns
+  STATISTICS,  ///< Computing the column statistics written in the file
+  ENCODE,      ///< Encoding the columns
+  COMPRESS,    ///< Compressing the encoded data
+  WRITE,       ///< Writing the encoded data to the sink
+  NUM_PHASES   ///< Number of phases
+};
+
+/**
+ * @brief Time and data size of one phase of reading or writing a file
+ */
+struct io_phase_statistics {
+  int64_t time_ns{0};      ///< Wall time of the phase, including its device work
+  size_t input_bytes{0};   ///< Bytes processed by the phase
+  size_t output_bytes{0};  ///< Bytes produced by the phase
+};
+
+/**
+ * @brief Per-phase statistics of reading or writing a file
+ *
+ * Collecting the statistics synchronizes the stream at the end of every phase, so that the time
+ * of a phase includes its kernels.
+ */
+struct io_statistics {
+  std::array<io_phase_statistics, static_cast<size_t>(io_phase::NUM_PHASES)>
+    phases{};  ///< Statistics of each phase, indexed by `io_phase`
+
+  io_phase_statistics& operator[](io_phase phase) { return phases[static_cast<size_t>(phase)]; }
+
+  io_phase_statistics const& operator[](io_phase phase) const
+  {
+    return phases[static_cast<size_t>(phase)];
+  }
+
+  /**
+   * @brief Returns the ratio of the uncompressed to the compressed size of the data, or 0 if no
+   * data was compressed or decompressed.
+   */
+  double compression_ratio() const
+  {
+    auto const& decompress = (*this)[io_phase::DECOMPRESS];
+    auto const& compress   = (*this)[io_phase::COMPRESS];
+    auto const compressed  = decompress.input_bytes + compress.output_bytes;
+    auto const expanded    = decompress.output_bytes + compress.input_bytes;
+    return compressed == 0 ? 0. : static_cast<double>(expanded) / compressed;
+  }
+
+  /**
+   * @brief Returns the total time of all the phases, in nanoseconds.
+   */
+  int64_t total_time_ns() const
+  {
+    int64_t total = 0;
+    for (auto const& phase : phases) {
+      total += phase.time_ns;
+    }
+    return total;
+  }
+};
+
 /**
  * @brief Table with table metadata used by io readers to return the metadata by value
  */
 struct table_with_metadata {
   std::unique_ptr<table> tbl;
   table_metadata metadata;
+  std::optional<io_statistics> statistics;  //!< Statistics of the read, if they were requested
 };
 
 /**
@@ -2,6 +2,14 @@
 #include <arrow/gpu/cuda_api.h>
 #include <arrow/io/memory.h>
 #include <arrow/ipc/api.h>
+#include <cudf/interop.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+#include <vector>
 
 class CudaMessageReader : arrow::ipc::MessageReader {
  public:
@@ -17,3 +25,77 @@ class CudaMessageReader : arrow::ipc::MessageReader {
   arrow::io::BufferReader* host_schema_reader_ = nullptr;
   std::shared_ptr<arrow::cuda::CudaBufferReader> owned_stream_;
 };
+
+namespace cudf {
+namespace ipc {
+/**
+ * @addtogroup interop_arrow
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Encode the schema message of the Arrow IPC stream of `input` in host memory
+ *
+ * The schema is exchanged once, ahead of the record batch messages returned by
+ * `write_record_batch`.
+ *
+ * @throws cudf::logic_error if `metadata` is not empty and its size doesn't match with number of
+ * columns.
+ * @throws cudf::logic_error if a column type is not supported by `to_arrow_device`
+ *
+ * @param input table_view whose schema is encoded
+ * @param metadata Contains hierarchy of names of columns and children, or is empty for unnamed
+ * columns
+ * @return Encapsulated Arrow IPC schema message
+ */
+std::shared_ptr<arrow::Buffer> write_schema(table_view const& input,
+                                            std::vector<column_metadata> const& metadata = {});
+
+/**
+ * @brief Encode `input` as an Arrow IPC record batch message in device memory
+ *
+ * The message metadata is built on the host from the sizes of the columns, and the message body
+ * is copied from the device memory of the columns without going through host memory, so the
+ * result can be sent as is to another GPU, e.g. over UCX or NCCL. Consecutive messages form the
+ * body of an Arrow IPC stream whose schema is encoded by `write_schema`.
+ *
+ * @throws cudf::logic_error if a column type is not supported by `to_arrow_device`
+ *
+ * @param input table_view to encode
+ * @param mr Device memory resource used to allocate the returned message
+ * @return Encapsulated Arrow IPC record batch message
+ */
+std::unique_ptr<rmm::device_buffer> write_record_batch(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Decode an Arrow IPC schema message in host memory
+ *
+ * @throws cudf::logic_error if `message` is not a valid schema message
+ *
+ * @param message Encapsulated Arrow IPC schema message
+ * @return Schema of the record batches of the stream
+ */
+std::shared_ptr<arrow::Schema> read_schema(arrow::Buffer const& message);
+
+/**
+ * @brief Decode the Arrow IPC record batch messages of a stream in device memory
+ *
+ * The columns of each record batch are views of the message bodies, which are not copied and
+ * must outlive the results.
+ *
+ * @throws cudf::logic_error if the messages are not valid record batch messages of `schema`
+ * @throws cudf::logic_error if a column type is not supported by `from_arrow_device`
+ *
+ * @param schema Schema of the record batches, as returned by `read_schema`
+ * @param messages Consecutive encapsulated Arrow IPC record batch messages in device memory
+ * @return table_view of each record batch
+ */
+std::vector<unique_table_view_t> read_record_batches(std::shared_ptr<arrow::Schema> const& schema,
+                                                     device_span<uint8_t const> messages);
+
+/** @} */  // end of group
+}  // namespace ipc
+}  // namespace cudf
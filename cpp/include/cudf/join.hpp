@@ -16,8 +16,13 @@
 
 #pragma once
 
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -57,6 +62,7 @@ namespace cudf {
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
@@ -68,6 +74,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 inner_join(cudf::table_view const& left_keys,
            cudf::table_view const& right_keys,
            null_equality compare_nulls         = null_equality::EQUAL,
+           rmm::cuda_stream_view stream        = cudf::get_default_stream(),
            rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -102,6 +109,7 @@ inner_join(cudf::table_view const& left_keys,
  * from `left` indicated by `left_on[i]`.
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return Result of joining `left` and `right` tables on the columns
@@ -113,6 +121,7 @@ std::unique_ptr<cudf::table> inner_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -142,6 +151,7 @@ std::unique_ptr<cudf::table> inner_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
@@ -153,6 +163,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 left_join(cudf::table_view const& left_keys,
           cudf::table_view const& right_keys,
           null_equality compare_nulls         = null_equality::EQUAL,
+          rmm::cuda_stream_view stream        = cudf::get_default_stream(),
           rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -195,6 +206,7 @@ left_join(cudf::table_view const& left_keys,
  * from `left` indicated by `left_on[i]`.
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return Result of joining `left` and `right` tables on the columns
@@ -206,6 +218,7 @@ std::unique_ptr<cudf::table> left_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -234,6 +247,7 @@ std::unique_ptr<cudf::table> left_join(
  * @param[in] right The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
@@ -245,6 +259,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 full_join(cudf::table_view const& left_keys,
           cudf::table_view const& right_keys,
           null_equality compare_nulls         = null_equality::EQUAL,
+          rmm::cuda_stream_view stream        = cudf::get_default_stream(),
           rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -287,6 +302,7 @@ full_join(cudf::table_view const& left_keys,
  * from `left` indicated by `left_on[i]`.
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return Result of joining `left` and `right` tables on the columns
@@ -298,8 +314,560 @@ std::unique_ptr<cudf::table> full_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the
+ * specified tables, computed one partition at a time. @see cudf::inner_join().
+ *
+ * Both tables are hash partitioned on their join keys into `num_partitions` partitions, and each
+ * pair of corresponding partitions is joined with a hash table built from that partition only.
+ * This keeps the hash tables small for build tables that are larger than the cache, or too large
+ * to build a hash table from at once. When `spill_to_host` is true, the partitions are kept in
+ * host memory and copied to device memory as they are joined, so that only one pair of partitions
+ * is in device memory at a time.
+ *
+ * The result holds the same pairs of row indices as the result of `inner_join`, in an unspecified
+ * order.
+ *
+ * @throw cudf::logic_error if `num_partitions` is not positive.
+ * @throw cudf::logic_error if the number of columns in `left_keys` and `right_keys` mismatch.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of partitions to split each table into
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param[in] spill_to_host Whether to keep the partitions in host memory until they are joined
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and
+ * `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  bool spill_to_host                  = false,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the
+ * specified tables, computed one partition at a time. @see cudf::left_join().
+ *
+ * Both tables are hash partitioned on their join keys into `num_partitions` partitions, and each
+ * pair of corresponding partitions is joined with a hash table built from that partition only.
+ * This keeps the hash tables small for build tables that are larger than the cache, or too large
+ * to build a hash table from at once. When `spill_to_host` is true, the partitions are kept in
+ * host memory and copied to device memory as they are joined, so that only one pair of partitions
+ * is in device memory at a time.
+ *
+ * The result holds the same pairs of row indices as the result of `left_join`, in an unspecified
+ * order.
+ *
+ * @throw cudf::logic_error if `num_partitions` is not positive.
+ * @throw cudf::logic_error if the number of columns in `left_keys` and `right_keys` mismatch.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of partitions to split each table into
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param[in] spill_to_host Whether to keep the partitions in host memory until they are joined
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and
+ * `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_left_join(cudf::table_view const& left_keys,
+                      cudf::table_view const& right_keys,
+                      size_type num_partitions,
+                      null_equality compare_nulls         = null_equality::EQUAL,
+                      bool spill_to_host                  = false,
+                      rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+                      rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a full join between the
+ * specified tables, computed one partition at a time. @see cudf::full_join().
+ *
+ * Both tables are hash partitioned on their join keys into `num_partitions` partitions, and each
+ * pair of corresponding partitions is joined with a hash table built from that partition only.
+ * This keeps the hash tables small for build tables that are larger than the cache, or too large
+ * to build a hash table from at once. When `spill_to_host` is true, the partitions are kept in
+ * host memory and copied to device memory as they are joined, so that only one pair of partitions
+ * is in device memory at a time.
+ *
+ * The result holds the same pairs of row indices as the result of `full_join`, in an unspecified
+ * order.
+ *
+ * @throw cudf::logic_error if `num_partitions` is not positive.
+ * @throw cudf::logic_error if the number of columns in `left_keys` and `right_keys` mismatch.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of partitions to split each table into
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param[in] spill_to_host Whether to keep the partitions in host memory until they are joined
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a full join between two tables with `left_keys` and
+ * `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_full_join(cudf::table_view const& left_keys,
+                      cudf::table_view const& right_keys,
+                      size_type num_partitions,
+                      null_equality compare_nulls         = null_equality::EQUAL,
+                      bool spill_to_host                  = false,
+                      rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+                      rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an
+ * inner join between two tables that are both sorted on their join keys.
+ *
+ * No hash table is built. The range of equal keys in `right_keys` of every row of `left_keys`
+ * is found with a binary search, so the result is ordered by left row index, then by right row
+ * index, i.e. in the sort order of the join keys.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{1, 1, 2, 2, 3}, {0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in `left_keys` and `right_keys` mismatch.
+ * @throw cudf::logic_error if the column types of `left_keys` and `right_keys` mismatch.
+ *
+ * @param[in] left_keys The left table, sorted on all of its columns
+ * @param[in] right_keys The right table, sorted on all of its columns
+ * @param[in] column_order The sort order of the columns of both tables. If empty, all
+ * columns are sorted in ascending order.
+ * @param[in] null_precedence The order of the null values in the columns of both tables. If
+ * empty, null values are ordered before all other values.
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and
+ * `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a
+ * left join between two tables that are both sorted on their join keys.
+ *
+ * No hash table is built. The range of equal keys in `right_keys` of every row of `left_keys`
+ * is found with a binary search, so the result is ordered by left row index, then by right row
+ * index. The right index of a left row without a match is an unspecified out-of-bounds value.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{0, 1, 1, 2, 2, 3}, {None, 0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in `left_keys` and `right_keys` mismatch.
+ * @throw cudf::logic_error if the column types of `left_keys` and `right_keys` mismatch.
+ *
+ * @param[in] left_keys The left table, sorted on all of its columns
+ * @param[in] right_keys The right table, sorted on all of its columns
+ * @param[in] column_order The sort order of the columns of both tables. If empty, all
+ * columns are sorted in ascending order.
+ * @param[in] null_precedence The order of the null values in the columns of both tables. If
+ * empty, null values are ordered before all other values.
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and
+ * `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Direction of the match of an as-of join.
+ */
+enum class asof_direction {
+  BACKWARD,  ///< Match the right row with the last `on` value not greater than the left one
+  FORWARD,   ///< Match the right row with the first `on` value not less than the left one
+  NEAREST    ///< Match the closest of the backward and forward matches, the backward one on ties
+};
+
+/**
+ * @brief Returns the right row matched by each left row in an as-of join of two tables.
+ *
+ * A left row matches a right row of equal `by` keys whose `on` value is the nearest to its
+ * own in the given direction, e.g. the latest quote at or before each trade of a symbol. Both
+ * tables are sorted on their `by` keys and `on` values, and the matches are found by merging
+ * the sorted left rows with the sorted right rows. Among right rows of equal `by` keys and `on`
+ * value, the backward match is the last one and the forward match the first one.
+ *
+ * Rows with a null `on` value match nothing. The index of a left row without a match is an
+ * unspecified out-of-bounds value, so that the matched right rows can be gathered with
+ * `out_of_bounds_policy::NULLIFY`.
+ *
+ * @code{.pseudo}
+ * Left by: {{"A", "A", "B", "B"}}, left on: {1, 5, 2, 9}
+ * Right by: {{"A", "B", "A", "B"}}, right on: {2, 3, 4, 8}
+ * Backward: {None, 2, None, 3}
+ * Forward: {0, None, 1, None}
+ * Nearest with a tolerance of 1: {0, 2, 1, 3}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in `left_by` and `right_by` mismatch.
+ * @throw cudf::logic_error if the column types of `left_by` and `right_by` mismatch.
+ * @throw cudf::logic_error if the types of `left_on` and `right_on` mismatch.
+ * @throw cudf::logic_error if the `on` columns are not of a numeric type other than BOOL8, a
+ * timestamp type or a duration type.
+ * @throw cudf::logic_error if `tolerance` is valid and not of the type of the difference of two
+ * `on` values: the duration type of a timestamp type, or else the type of the `on` columns.
+ *
+ * @param[in] left_by The equality keys of the left table
+ * @param[in] left_on The ordered key of the left table, of the size of `left_by`
+ * @param[in] right_by The equality keys of the right table
+ * @param[in] right_on The ordered key of the right table, of the size of `right_by`
+ * @param[in] direction The direction of the match
+ * @param[in] tolerance The largest distance between the `on` values of matched rows, or an
+ * invalid scalar for no limit
+ * @param[in] compare_nulls controls whether null `by` key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return The index of the right row matched by each left row
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  cudf::table_view const& left_by,
+  cudf::column_view const& left_on,
+  cudf::table_view const& right_by,
+  cudf::column_view const& right_on,
+  asof_direction direction,
+  scalar const& tolerance,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an
+ * inner join between the specified tables, where a few keys make up a large part of
+ * `right_keys`.
+ *
+ * The keys that make up at least `heavy_hitter_threshold` of a sample of `sample_size` rows of
+ * `right_keys` are heavy hitters. The rows of both tables with a heavy-hitter key are joined by
+ * expanding every left row over the right rows with its key, so the long chains of equal keys
+ * are never walked in the hash table. The remaining rows are joined with a hash join.
+ *
+ * The first returned vector contains the row indices from the left
+ * table that have a match in the right table (in unspecified order).
+ * The corresponding values in the second returned vector are
+ * the matched row indices from the right table.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 1, 3}}
+ * Result: {{1, 1, 1, 2, 2, 2}, {0, 1, 2, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in `left_keys` and `right_keys` mismatch.
+ * @throw cudf::logic_error if `heavy_hitter_threshold` is not in (0, 1].
+ * @throw cudf::logic_error if `sample_size` is not positive.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table, whose keys are sampled for heavy hitters
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param[in] heavy_hitter_threshold The fraction of the sampled rows a key must make up to be a
+ * heavy hitter
+ * @param[in] sample_size The number of rows of `right_keys` sampled for heavy hitters
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and
+ * `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+skewed_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  double heavy_hitter_threshold       = 0.01,
+  size_type sample_size               = 4096,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a
+ * left join between the specified tables, where a few keys make up a large part of
+ * `right_keys`.
+ *
+ * The keys that make up at least `heavy_hitter_threshold` of a sample of `sample_size` rows of
+ * `right_keys` are heavy hitters, and the rows with them are joined by expansion as in
+ * `skewed_inner_join`. The remaining rows are joined with a hash join. The right index of a left
+ * row without a match is an unspecified out-of-bounds value.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 1, 3}}
+ * Result: {{0, 1, 1, 1, 2, 2, 2, 3}, {None, 0, 1, 2, 0, 1, 2, None}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in `left_keys` and `right_keys` mismatch.
+ * @throw cudf::logic_error if `heavy_hitter_threshold` is not in (0, 1].
+ * @throw cudf::logic_error if `sample_size` is not positive.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table, whose keys are sampled for heavy hitters
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param[in] heavy_hitter_threshold The fraction of the sampled rows a key must make up to be a
+ * heavy hitter
+ * @param[in] sample_size The number of rows of `right_keys` sampled for heavy hitters
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and
+ * `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+skewed_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  double heavy_hitter_threshold       = 0.01,
+  size_type sample_size               = 4096,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs
+ * of rows between the specified tables where the predicate evaluates to true.
+ *
+ * The first returned vector contains the row indices from the left
+ * table that have a match in the right table (in unspecified order).
+ * The corresponding values in the second returned vector are
+ * the matched row indices from the right table.
+ *
+ * The predicate is evaluated for every pair of rows in a nested loop, without materializing the
+ * cross product of the tables. A pair of rows for which any column referenced by the predicate
+ * is null does not match.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Expression: Left.Column_0 == Right.Column_0
+ * Result: {{1, 2}, {0, 1}}
+ *
+ * Left: {{0, 1, 2}, {1, 1, 5}}
+ * Right: {{1, 2, 3}, {1, 1, 1}}
+ * Expression: (Left.Column_0 == Right.Column_0) AND (Left.Column_1 == Right.Column_1)
+ * Result: {{1}, {0}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the predicate does not produce a boolean output.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] binary_predicate The condition on which to join, referencing columns of both tables
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a conditional inner join between two tables `left` and `right`.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_inner_join(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& binary_predicate,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs
+ * of rows between the specified tables where the predicate evaluates to true,
+ * or null matches for rows in left that have no match in right.
+ *
+ * The first returned vector contains all the row indices from the left
+ * table (in unspecified order). The corresponding value in the
+ * second returned vector is either (1) the row index of the matched row
+ * from the right table, if there is a match or (2) an unspecified
+ * out-of-bounds value.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Expression: Left.Column_0 == Right.Column_0
+ * Result: {{0, 1, 2}, {None, 0, 1}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the predicate does not produce a boolean output.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] binary_predicate The condition on which to join, referencing columns of both tables
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a conditional left join between two tables `left` and `right`.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_left_join(table_view const& left,
+                      table_view const& right,
+                      ast::expression const& binary_predicate,
+                      rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+                      rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs of
+ * rows between the specified tables where the columns of the equality table
+ * are equal and the predicate evaluates to true on the conditional tables.
+ *
+ * The first returned vector contains the row indices from the left
+ * table that have a match in the right table (in unspecified order).
+ * The corresponding values in the second returned vector are
+ * the matched row indices from the right table.
+ *
+ * A hash table is built on `right_equality` and probed with `left_equality`, and the predicate
+ * is evaluated on each pair of rows with equal keys while probing. The result of the equality
+ * join alone is never materialized. A pair of rows for which any column referenced by the
+ * predicate is null does not match.
+ *
+ * @code{.pseudo}
+ * left_equality: {{0, 1, 2}}
+ * right_equality: {{1, 2, 3}}
+ * left_conditional: {{4, 4, 4}}
+ * right_conditional: {{3, 4, 5}}
+ * Expression: Left.Column_0 > Right.Column_0
+ * Result: {{1}, {0}}
+ * @endcode
+ *
+ * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+ * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+ * match.
+ * @throw cudf::logic_error If the number of rows in right_equality and right_conditional do not
+ * match.
+ * @throw cudf::logic_error If the column types of left_equality and right_equality mismatch.
+ *
+ * @param[in] left_equality The left table used for the equality join
+ * @param[in] right_equality The right table used for the equality join
+ * @param[in] left_conditional The left table used for the conditional join
+ * @param[in] right_conditional The right table used for the conditional join
+ * @param[in] binary_predicate The condition on which to join
+ * @param[in] compare_nulls Whether or not null values join to each other or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a mixed inner join between the four input tables.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_inner_join(table_view const& left_equality,
+                 table_view const& right_equality,
+                 table_view const& left_conditional,
+                 table_view const& right_conditional,
+                 ast::expression const& binary_predicate,
+                 null_equality compare_nulls         = null_equality::EQUAL,
+                 rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+                 rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs of
+ * rows between the specified tables where the columns of the equality table
+ * are equal and the predicate evaluates to true on the conditional tables,
+ * or null matches for rows in left that have no match in right.
+ *
+ * The first returned vector contains all the row indices from the left
+ * table (in unspecified order). The corresponding value in the
+ * second returned vector is either (1) the row index of the matched row
+ * from the right table, if there is a match or (2) an unspecified
+ * out-of-bounds value.
+ *
+ * @code{.pseudo}
+ * left_equality: {{0, 1, 2}}
+ * right_equality: {{1, 2, 3}}
+ * left_conditional: {{4, 4, 4}}
+ * right_conditional: {{3, 4, 5}}
+ * Expression: Left.Column_0 > Right.Column_0
+ * Result: {{0, 1, 2}, {None, 0, None}}
+ * @endcode
+ *
+ * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+ * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+ * match.
+ * @throw cudf::logic_error If the number of rows in right_equality and right_conditional do not
+ * match.
+ * @throw cudf::logic_error If the column types of left_equality and right_equality mismatch.
+ *
+ * @param[in] left_equality The left table used for the equality join
+ * @param[in] right_equality The right table used for the equality join
+ * @param[in] left_conditional The left table used for the conditional join
+ * @param[in] right_conditional The right table used for the conditional join
+ * @param[in] binary_predicate The condition on which to join
+ * @param[in] compare_nulls Whether or not null values join to each other or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a mixed left join between the four input tables.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_left_join(table_view const& left_equality,
+                table_view const& right_equality,
+                table_view const& left_conditional,
+                table_view const& right_conditional,
+                ast::expression const& binary_predicate,
+                null_equality compare_nulls         = null_equality::EQUAL,
+                rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a vector of row indices corresponding to a left semi join
  * between the specified tables.
@@ -321,6 +889,7 @@ std::unique_ptr<cudf::table> full_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A vector `left_indices` that can be used to construct
@@ -331,6 +900,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
   cudf::table_view const& left_keys,
   cudf::table_view const& right_keys,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -367,6 +937,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
  *                             will be compared against the column from `left`
  *                             indicated by `left_on[i]`.
  * @param[in] compare_nulls    Controls whether null join-key values should match or not.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr               Device memory resource used to allocate the returned table's
  *                             device memory
  *
@@ -379,6 +950,7 @@ std::unique_ptr<cudf::table> left_semi_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -400,6 +972,7 @@ std::unique_ptr<cudf::table> left_semi_join(
  * @param[in] right_keys The right table
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
  *
  * @return A column `left_indices` that can be used to construct
@@ -410,6 +983,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
   cudf::table_view const& left_keys,
   cudf::table_view const& right_keys,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -449,6 +1023,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
  *                             will be compared against the column from `left`
  *                             indicated by `left_on[i]`.
  * @param[in] compare_nulls    Controls whether null join-key values should match or not.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr               Device memory resource used to allocate the returned table's
  *                             device memory
  *
@@ -461,6 +1036,7 @@ std::unique_ptr<cudf::table> left_anti_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -481,6 +1057,7 @@ std::unique_ptr<cudf::table> left_anti_join(
  *
  * @param left  The left table
  * @param right The right table
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr    Device memory resource used to allocate the returned table's device memory
  *
  * @return     Result of cross joining `left` and `right` tables
@@ -488,23 +1065,33 @@ std::unique_ptr<cudf::table> left_anti_join(
 std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Filter of probe rows that a `hash_join` tests before probing its hash table.
+ */
+enum class hash_join_filter : bool {
+  NONE,         ///< Every probe row probes the hash table
+  BLOOM_FILTER  ///< Probe rows rejected by a Bloom filter of the build keys skip the hash table
+};
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
  *
  * This class enables the hash join scheme that builds hash table once, and probes as many times as
- * needed (possibly in parallel).
+ * needed (possibly in parallel). The built hash table can be serialized with `pack`, to be probed
+ * by other processes or at a later time without rebuilding it.
  */
 class hash_join {
  public:
   hash_join() = delete;
   ~hash_join();
   hash_join(hash_join const&) = delete;
-  hash_join(hash_join&&)      = delete;
+  hash_join(hash_join&&);
   hash_join& operator=(hash_join const&) = delete;
-  hash_join& operator=(hash_join&&) = delete;
+  hash_join& operator=(hash_join&&);
 
   /**
    * @brief Construct a hash join object for subsequent probe calls.
@@ -518,7 +1105,109 @@ class hash_join {
    */
   hash_join(cudf::table_view const& build,
             null_equality compare_nulls,
-            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Construct a hash join object for subsequent probe calls, which test every probe row
+   * against `filter` before probing the hash table.
+   *
+   * A Bloom filter costs 2 bytes of device memory per build row. It speeds up selective joins, in
+   * which most probe rows match no build row, by rejecting most of those rows with a single load.
+   * The filter is serialized by `pack` along with the hash table.
+   *
+   * @note The `hash_join` object must not outlive the table viewed by `build`, else behavior is
+   * undefined.
+   *
+   * @param build The build table, from which the hash table is built.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param filter The filter of probe rows tested before probing the hash table.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join(cudf::table_view const& build,
+            null_equality compare_nulls,
+            hash_join_filter filter,
+            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Construct a hash join object for subsequent probe calls, whose hash table is built from
+   * precomputed hash values of the build rows instead of hashing them.
+   *
+   * This lets the hash values of the keys, e.g. computed once with `cudf::hash`, be reused by the
+   * operations of a plan that hash the same keys, like `hash_partition` and `groupby`. The keys
+   * are still compared to match the rows. The probe rows must be hashed the same way: the probe
+   * calls without precomputed hash values hash the rows like `cudf::hash` with
+   * `hash_id::HASH_MURMUR3`.
+   *
+   * @note The `hash_join` object must not outlive the table viewed by `build`, else behavior is
+   * undefined.
+   *
+   * @throw cudf::logic_error if `build_hashes` is not an INT32 or UINT32 column of
+   * `build.num_rows()` elements without nulls
+   *
+   * @param build The build table, from which the hash table is built.
+   * @param build_hashes The hash value of every row of `build`
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join(cudf::table_view const& build,
+            column_view const& build_hashes,
+            null_equality compare_nulls,
+            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Construct a hash join object from the result of `pack`, without rebuilding the hash
+   * table.
+   *
+   * No device memory is allocated: the hash join refers to the build table and hash table stored
+   * in `packed`.
+   *
+   * @note The `hash_join` object must not outlive the data of `packed`, else behavior is
+   * undefined.
+   *
+   * @throw cudf::logic_error if `packed` is not a serialized hash join.
+   *
+   * @param packed The serialized hash join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join(packed_columns const& packed,
+            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Construct a hash join object from the metadata and device data of the result of `pack`,
+   * without rebuilding the hash table.
+   *
+   * This allows probing a hash join whose device data is shared from another process, e.g.
+   * through CUDA IPC.
+   *
+   * @note The `hash_join` object must not outlive `metadata` and `gpu_data`, else behavior is
+   * undefined.
+   *
+   * @throw cudf::logic_error if `metadata` is not the metadata of a serialized hash join.
+   *
+   * @param metadata The host-side metadata buffer of the serialized hash join
+   * @param gpu_data The device-side buffer of the serialized hash join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join(uint8_t const* metadata,
+            uint8_t const* gpu_data,
+            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Serializes the build table and the hash table of this hash join.
+   *
+   * The device data holds a copy of the build table followed by a copy of the hash table and of
+   * its Bloom filter, if any, so that it can be stored or shared with other processes as one
+   * buffer. The result can be deserialized with the `hash_join(packed_columns const&)` constructor
+   * on any process that uses the same version of libcudf.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned device memory
+   *
+   * @return The serialized metadata and data in contiguous host and device memory respectively
+   */
+  packed_columns pack(
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
   /**
    * Returns the row indices that can be used to construct the result of performing
@@ -538,7 +1227,7 @@ class hash_join {
             std::unique_ptr<rmm::device_uvector<size_type>>>
   inner_join(cudf::table_view const& probe,
              null_equality compare_nulls         = null_equality::EQUAL,
-             rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+             rmm::cuda_stream_view stream        = cudf::get_default_stream(),
              rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
   /**
@@ -559,7 +1248,7 @@ class hash_join {
             std::unique_ptr<rmm::device_uvector<size_type>>>
   left_join(cudf::table_view const& probe,
             null_equality compare_nulls         = null_equality::EQUAL,
-            rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+            rmm::cuda_stream_view stream        = cudf::get_default_stream(),
             rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
   /**
@@ -580,12 +1269,387 @@ class hash_join {
             std::unique_ptr<rmm::device_uvector<size_type>>>
   full_join(cudf::table_view const& probe,
             null_equality compare_nulls         = null_equality::EQUAL,
-            rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+            rmm::cuda_stream_view stream        = cudf::get_default_stream(),
             rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * Returns the row indices that can be used to construct the result of performing an inner join
+   * between two tables, using precomputed hash values of the probe rows instead of hashing them.
+   * @see cudf::inner_join().
+   *
+   * @throw cudf::logic_error if `probe_hashes` is not an INT32 or UINT32 column of
+   * `probe.num_rows()` elements without nulls
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_hashes The hash value of every row of `probe`, computed like the hash values of
+   * the build rows.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   *
+   * @return A pair of columns [`left_indices`, `right_indices`] that can be used to construct
+   * the result of performing an inner join between two tables with `build` and `probe`
+   * as the the join keys .
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  inner_join(cudf::table_view const& probe,
+             column_view const& probe_hashes,
+             null_equality compare_nulls         = null_equality::EQUAL,
+             rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+             rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * Returns the row indices that can be used to construct the result of performing a left join
+   * between two tables, using precomputed hash values of the probe rows instead of hashing them.
+   * @see cudf::left_join().
+   *
+   * @throw cudf::logic_error if `probe_hashes` is not an INT32 or UINT32 column of
+   * `probe.num_rows()` elements without nulls
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_hashes The hash value of every row of `probe`, computed like the hash values of
+   * the build rows.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   *
+   * @return A pair of columns [`left_indices`, `right_indices`] that can be used to construct
+   * the result of performing a left join between two tables with `build` and `probe`
+   * as the the join keys .
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join(cudf::table_view const& probe,
+            column_view const& probe_hashes,
+            null_equality compare_nulls         = null_equality::EQUAL,
+            rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+            rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * Returns the row indices that can be used to construct the result of performing a full join
+   * between two tables, using precomputed hash values of the probe rows instead of hashing them.
+   * @see cudf::full_join().
+   *
+   * @throw cudf::logic_error if `probe_hashes` is not an INT32 or UINT32 column of
+   * `probe.num_rows()` elements without nulls
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_hashes The hash value of every row of `probe`, computed like the hash values of
+   * the build rows.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   *
+   * @return A pair of columns [`left_indices`, `right_indices`] that can be used to construct
+   * the result of performing a full join between two tables with `build` and `probe`
+   * as the the join keys .
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  full_join(cudf::table_view const& probe,
+            column_view const& probe_hashes,
+            null_equality compare_nulls         = null_equality::EQUAL,
+            rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+            rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * Writes the row indices that can be used to construct the result of performing an
+   * inner join between two tables to caller-provided buffers. @see cudf::inner_join().
+   *
+   * No device memory is allocated for the output, so the buffers can be preallocated with the
+   * exact size returned by `inner_join_size`.
+   *
+   * @throw cudf::logic_error if `left_indices` and `right_indices` have different sizes.
+   * @throw cudf::logic_error if the buffers are too small for the result.
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param left_indices Buffer for the `left_indices` of the result
+   * @param right_indices Buffer for the `right_indices` of the result
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The number of rows written to each of `left_indices` and `right_indices`
+   */
+  std::size_t inner_join(cudf::table_view const& probe,
+                         device_span<size_type> left_indices,
+                         device_span<size_type> right_indices,
+                         null_equality compare_nulls  = null_equality::EQUAL,
+                         rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
+  /**
+   * Writes the row indices that can be used to construct the result of performing a
+   * left join between two tables to caller-provided buffers. @see cudf::left_join().
+   *
+   * No device memory is allocated for the output, so the buffers can be preallocated with the
+   * exact size returned by `left_join_size`.
+   *
+   * @throw cudf::logic_error if `left_indices` and `right_indices` have different sizes.
+   * @throw cudf::logic_error if the buffers are too small for the result.
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param left_indices Buffer for the `left_indices` of the result
+   * @param right_indices Buffer for the `right_indices` of the result
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The number of rows written to each of `left_indices` and `right_indices`
+   */
+  std::size_t left_join(cudf::table_view const& probe,
+                        device_span<size_type> left_indices,
+                        device_span<size_type> right_indices,
+                        null_equality compare_nulls  = null_equality::EQUAL,
+                        rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
+  /**
+   * Writes the row indices that can be used to construct the result of performing a
+   * full join between two tables to caller-provided buffers. @see cudf::full_join().
+   *
+   * No device memory is allocated for the output, so the buffers can be preallocated with the
+   * exact size returned by `full_join_size`.
+   *
+   * @throw cudf::logic_error if `left_indices` and `right_indices` have different sizes.
+   * @throw cudf::logic_error if the buffers are too small for the result.
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param left_indices Buffer for the `left_indices` of the result
+   * @param right_indices Buffer for the `right_indices` of the result
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The number of rows written to each of `left_indices` and `right_indices`
+   */
+  std::size_t full_join(cudf::table_view const& probe,
+                        device_span<size_type> left_indices,
+                        device_span<size_type> right_indices,
+                        null_equality compare_nulls  = null_equality::EQUAL,
+                        rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
+  /**
+   * Returns the exact number of rows in the result of performing an inner join between
+   * two tables, without materializing the result. @see cudf::inner_join().
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The number of rows in the result of `inner_join(probe, compare_nulls)`
+   */
+  std::size_t inner_join_size(cudf::table_view const& probe,
+                              null_equality compare_nulls  = null_equality::EQUAL,
+                              rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
+  /**
+   * Returns the exact number of rows in the result of performing a left join between
+   * two tables, without materializing the result. @see cudf::left_join().
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The number of rows in the result of `left_join(probe, compare_nulls)`
+   */
+  std::size_t left_join_size(cudf::table_view const& probe,
+                             null_equality compare_nulls  = null_equality::EQUAL,
+                             rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
+  /**
+   * Returns the exact number of rows in the result of performing a full join between
+   * two tables, without materializing the result. @see cudf::full_join().
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The number of rows in the result of `full_join(probe, compare_nulls)`
+   */
+  std::size_t full_join_size(cudf::table_view const& probe,
+                             null_equality compare_nulls  = null_equality::EQUAL,
+                             rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
+  /**
+   * @brief Inner join of a probe table returned in chunks of a bounded number of rows, which can
+   * be gathered and processed one at a time.
+   *
+   * The chunks join consecutive ranges of the probe rows, so each chunk holds every output row of
+   * its probe rows. Created by `hash_join::inner_join_chunked`.
+   *
+   * @note The `chunked_inner_join` object must not outlive the `hash_join` object and the table
+   * viewed by `probe` it was created from, else behavior is undefined.
+   */
+  class chunked_inner_join {
+   public:
+    chunked_inner_join(chunked_inner_join const&) = delete;
+    chunked_inner_join(chunked_inner_join&&)      = default;
+    chunked_inner_join& operator=(chunked_inner_join const&) = delete;
+    chunked_inner_join& operator=(chunked_inner_join&&) = default;
+
+    /**
+     * @brief Returns whether any output row remains to be returned by `next`.
+     */
+    [[nodiscard]] bool has_next() const;
+
+    /**
+     * @brief Returns the row indices of the next chunk of the inner join output.
+     *
+     * A chunk has at most `max_rows` rows, unless a single probe row matches more than `max_rows`
+     * build rows, in which case the chunk holds exactly the output rows of that probe row.
+     *
+     * @throw cudf::logic_error if no output row remains
+     *
+     * @param mr Device memory resource used to allocate the returned vectors
+     *
+     * @return A pair of vectors [`left_indices`, `right_indices`] of the next output rows, whose
+     * `left_indices` are indices of rows of the whole probe table
+     */
+    std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+              std::unique_ptr<rmm::device_uvector<size_type>>>
+    next(rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+   private:
+    friend class hash_join;
+
+    chunked_inner_join(hash_join const& join,
+                       cudf::table_view const& probe,
+                       std::size_t max_rows,
+                       null_equality compare_nulls,
+                       rmm::cuda_stream_view stream);
+
+    hash_join const* _join;
+    cudf::table_view _probe;
+    std::size_t _max_rows;
+    null_equality _compare_nulls;
+    rmm::cuda_stream_view _stream;
+    rmm::device_uvector<int64_t> _row_offsets;  ///< Offsets of the output rows of the probe rows
+    size_type _next_row{0};                     ///< First probe row of the next chunk
+    int64_t _next_offset{0};                    ///< First output row of the next chunk
+    int64_t _size{0};                           ///< Number of rows of the whole output
+  };
+
+  /**
+   * Returns the inner join of `probe` in chunks of at most `max_rows` output rows, which probe the
+   * hash table for consecutive ranges of probe rows as they are requested. @see cudf::inner_join().
+   *
+   * The probe rows are first probed once to count their output rows, so that a join whose output
+   * does not fit in device memory can be gathered and processed one chunk at a time.
+   *
+   * @throw cudf::logic_error if `max_rows` is 0
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param max_rows The maximum number of rows of a chunk
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The chunks of the inner join output, whose indices can be used to construct the result
+   * of performing an inner join between two tables with `build` and `probe` as the join keys
+   */
+  chunked_inner_join inner_join_chunked(
+    cudf::table_view const& probe,
+    std::size_t max_rows,
+    null_equality compare_nulls  = null_equality::EQUAL,
+    rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
  private:
   struct hash_join_impl;
-  const std::unique_ptr<const hash_join_impl> impl;
+  std::unique_ptr<const hash_join_impl> impl;
+};
+
+/**
+ * @brief Hash set of the build table of left semi and anti joins, which can be probed by
+ * multiple tables.
+ *
+ * This class enables the hash set to be built once, and reused in subsequent joins. Since only
+ * the existence of a row matters, the set holds each distinct row of the build table once.
+ */
+class hash_semi_join {
+ public:
+  hash_semi_join() = delete;
+  ~hash_semi_join();
+  hash_semi_join(hash_semi_join const&) = delete;
+  hash_semi_join(hash_semi_join&&);
+  hash_semi_join& operator=(hash_semi_join const&) = delete;
+  hash_semi_join& operator=(hash_semi_join&&);
+
+  /**
+   * @brief Construct a hash semi join object for subsequent probe calls.
+   *
+   * @note The `hash_semi_join` object must not outlive the table viewed by `build`, else behavior
+   * is undefined.
+   *
+   * @throw cudf::logic_error if the number of columns in `build` table is 0.
+   *
+   * @param build The build table, from which the hash set is built.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_semi_join(cudf::table_view const& build,
+                 null_equality compare_nulls  = null_equality::EQUAL,
+                 rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Construct a hash semi join object whose build and probe rows match regardless of the
+   * case of the ASCII letters of the strings of some columns.
+   *
+   * The strings of a column whose `key_case` is `case_sensitivity::INSENSITIVE`, including the
+   * strings within its nested columns, are hashed and compared as if their ASCII letters were
+   * lowercase, without copying the build or probe tables.
+   *
+   * @note The `hash_semi_join` object must not outlive the table viewed by `build`, else behavior
+   * is undefined.
+   *
+   * @throw cudf::logic_error if the number of columns in `build` table is 0.
+   * @throw cudf::logic_error if `key_case` is neither empty nor of size `build.num_columns()`.
+   *
+   * @param build The build table, from which the hash set is built.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param key_case The case sensitivity of every column, or empty for all case-sensitive
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_semi_join(cudf::table_view const& build,
+                 null_equality compare_nulls,
+                 std::vector<case_sensitivity> const& key_case,
+                 rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * Returns the row indices of `probe` that can be used to construct the result of performing a
+   * left semi join between the probe table and the build table. @see cudf::left_semi_join().
+   *
+   * @throw cudf::logic_error if the number of columns in `probe` table is 0.
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector's device memory
+   *
+   * @return A vector `left_indices` of the rows of `probe` that have a match in the build table
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * Returns the row indices of `probe` that can be used to construct the result of performing a
+   * left anti join between the probe table and the build table. @see cudf::left_anti_join().
+   *
+   * @throw cudf::logic_error if the number of columns in `probe` table is 0.
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector's device memory
+   *
+   * @return A vector `left_indices` of the rows of `probe` that have no match in the build table
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct hash_semi_join_impl;
+  std::unique_ptr<const hash_semi_join_impl> impl;
 };
 
 /** @} */  // end of group
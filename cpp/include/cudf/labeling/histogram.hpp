@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace cudf {
+
+/**
+ * @addtogroup label_bins
+ * @{
+ * @file
+ * @brief APIs for counting values by bin.
+ */
+
+/**
+ * @brief Counts the elements of `input` in each of `num_bins` bins of the same width between
+ * `lower` and `upper`.
+ *
+ * Bin `i` is `[lower + i * width, lower + (i + 1) * width)`, with `width = (upper - lower) /
+ * num_bins`, except for the last bin, which also includes `upper`. The bin of an element is
+ * computed from its value, and the counts are accumulated in shared memory by each thread block
+ * when the bins fit in it.
+ *
+ * Notes:
+ *   - NULL elements, NaN elements and elements outside `[lower, upper]` are not counted.
+ *   - The result is the one of `cudf::label_bins()` followed by a count of each label, without
+ *     the labels being materialized.
+ *
+ * @throws cudf::logic_error if the type of `input` is not numeric or is BOOL8.
+ * @throws cudf::logic_error if `num_bins` is not positive or `lower >= upper`.
+ *
+ * @param input The elements to count.
+ * @param lower The lower edge of the first bin.
+ * @param upper The upper edge of the last bin.
+ * @param num_bins The number of bins.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return The INT64 counts of the elements of each bin, of size `num_bins`.
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Counts the elements of `input` in each of the bins delimited by `edges`.
+ *
+ * Bin `i` is `[edges[i], edges[i + 1])`, except for the last bin, which also includes its upper
+ * edge, so that there are `edges.size() - 1` bins. The bin of an element is found by a binary
+ * search in the edges.
+ *
+ * Notes:
+ *   - NULL elements, NaN elements and elements outside the range of the edges are not counted.
+ *   - Edges must be provided in monotonically increasing order, otherwise behavior is undefined.
+ *
+ * @throws cudf::logic_error if `input.type() != edges.type()`.
+ * @throws cudf::logic_error if `edges` has nulls or less than two elements.
+ *
+ * @param input The elements to count.
+ * @param edges The edges of the bins.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return The INT64 counts of the elements of each bin, of size `edges.size() - 1`.
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  column_view const& edges,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Counts the elements of `input` of each group of rows of `keys` in each of `num_bins`
+ * bins of the same width between `lower` and `upper`.
+ *
+ * The bins are those of `histogram(input, lower, upper, num_bins)`. Rows with equal keys form a
+ * group, null keys comparing equal, and the counts of all groups are accumulated in one pass
+ * over the rows.
+ *
+ * @throws cudf::logic_error if `keys.num_rows() != input.size()`.
+ * @throws cudf::logic_error for the reasons of `histogram(input, lower, upper, num_bins)`.
+ *
+ * @param keys The keys of the groups.
+ * @param input The elements to count.
+ * @param lower The lower edge of the first bin.
+ * @param upper The upper edge of the last bin.
+ * @param num_bins The number of bins.
+ * @param mr Device memory resource used to allocate the returned table's and column's device
+ * memory.
+ * @return The unique keys, sorted, and a column of lists of the INT64 counts of each bin of each
+ * group, in the order of the keys.
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> grouped_histogram(
+  table_view const& keys,
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Counts the elements of `input` of each group of rows of `keys` in each of the bins
+ * delimited by `edges`.
+ *
+ * The bins are those of `histogram(input, edges)`, and the groups those of
+ * `grouped_histogram(keys, input, lower, upper, num_bins)`.
+ *
+ * @throws cudf::logic_error if `keys.num_rows() != input.size()`.
+ * @throws cudf::logic_error for the reasons of `histogram(input, edges)`.
+ *
+ * @param keys The keys of the groups.
+ * @param input The elements to count.
+ * @param edges The edges of the bins.
+ * @param mr Device memory resource used to allocate the returned table's and column's device
+ * memory.
+ * @return The unique keys, sorted, and a column of lists of the INT64 counts of each bin of each
+ * group, in the order of the keys.
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> grouped_histogram(
+  table_view const& keys,
+  column_view const& input,
+  column_view const& edges,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -74,6 +74,121 @@ std::unique_ptr<column> contains(
   cudf::column_view const& search_keys,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a column of bool values indicating whether the specified scalar
+ * is an element of each row of a list column whose rows are sorted.
+ *
+ * Each list row must be sorted as by `cudf::lists::sort_lists(lists, column_order,
+ * null_precedence)`, and is binary searched instead of scanned. The output is the same as that
+ * of `contains(lists, search_key)`.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_key The scalar key to be looked up in each list row
+ * @param column_order The order of the entries of each list row
+ * @param null_precedence Whether the null entries of each list row are before or after the others
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> BOOL8 column of `n` rows with the result of the lookup
+ */
+std::unique_ptr<column> contains(
+  cudf::lists_column_view const& lists,
+  cudf::scalar const& search_key,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of bool values indicating whether the list rows of the first
+ * column, which are sorted, contain the corresponding values in the second column
+ *
+ * Each list row must be sorted as by `cudf::lists::sort_lists(lists, column_order,
+ * null_precedence)`, and is binary searched instead of scanned. The output is the same as that
+ * of `contains(lists, search_keys)`.
+ *
+ * @throw cudf::logic_error if `search_keys` does not have as many rows as `lists`.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_keys Column of elements to be looked up in each list row
+ * @param column_order The order of the entries of each list row
+ * @param null_precedence Whether the null entries of each list row are before or after the others
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> BOOL8 column of `n` rows with the result of the lookup
+ */
+std::unique_ptr<column> contains(
+  cudf::lists_column_view const& lists,
+  cudf::column_view const& search_keys,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of the positions of the specified scalar in each row of a list column
+ *
+ * Output `column[i]` is the position of the first entry of `lists[i]` equal to `search_key`, or
+ * -1 if there is none. It is null if `search_key` or the list row `lists[i]` is null.
+ *
+ * @code{.pseudo}
+ * lists      = { {1, 2, 3, 2}, {}, NULL, {4, NULL, 2} }
+ * search_key = 2
+ * output     = { 1, -1, NULL, 2 }
+ * @endcode
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_key The scalar key to be looked up in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the result of the lookup
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::scalar const& search_key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of the positions of the values of the second column in the
+ * corresponding list rows of the first column
+ *
+ * Output `column[i]` is the position of the first entry of `lists[i]` equal to `search_keys[i]`,
+ * or -1 if there is none. It is null if `search_keys[i]` or the list row `lists[i]` is null.
+ *
+ * @throw cudf::logic_error if `search_keys` does not have as many rows as `lists`.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_keys Column of elements to be looked up in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the result of the lookup
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::column_view const& search_keys,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of bool values indicating whether the list rows of the first column
+ * contain any of the values of the corresponding list rows of the second column
+ *
+ * Output `column[i]` is set to true if any non-null entry of `search_keys[i]` is an entry of
+ * `lists[i]`, and is null if either list row is null. The null entries never match. The entries
+ * of the long list rows are hashed, so the cost of each row does not grow with the product of
+ * the sizes of its lists.
+ *
+ * @code{.pseudo}
+ * lists       = { {1, 2, 3}, {4, 5}, NULL, {6} }
+ * search_keys = { {7, 3}, {6}, {1}, {} }
+ * output      = { true, false, NULL, false }
+ * @endcode
+ *
+ * @throw cudf::logic_error if `search_keys` does not have as many rows as `lists`.
+ * @throw cudf::logic_error if the entries of the columns have different types, or a nested type.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_keys Lists column of the keys to be looked up in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> BOOL8 column of `n` rows with the result of the lookup
+ */
+std::unique_ptr<column> contains_any(
+  cudf::lists_column_view const& lists,
+  cudf::lists_column_view const& search_keys,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace lists
 }  // namespace cudf
@@ -34,10 +34,8 @@ namespace lists {
  * @throw cudf::logic_error if any row (list element) in the input column is a nested type.
  *
  * Given an `input` lists_column_view, the list elements in the column are copied to an output lists
- * column such that their duplicated entries are dropped out to keep only the unique ones. The
- * order of those entries within each list are not guaranteed to be preserved as in the input. In
- * the current implementation, entries in the output lists are sorted by ascending order (nulls
- * last), but this is not guaranteed in future implementation.
+ * column such that their duplicated entries are dropped out to keep only the unique ones. Each
+ * output list holds the first occurrence of each of its distinct entries, in the input order.
  *
  * @param lists_column The input lists_column_view
  * @param nulls_equal  Flag to specify whether null entries should be considered equal
@@ -47,10 +45,7 @@ namespace lists {
  *
  * @code{.pseudo}
  * lists_column = { {1, 1, 2, 1, 3}, {4}, NULL, {}, {NULL, NULL, NULL, 5, 6, 6, 6, 5} }
- * output = { {1, 2, 3}, {4}, NULL, {}, {5, 6, NULL} }
- *
- * Note that permuting the entries of each list in this output also produces another valid
- * output.
+ * output = { {1, 2, 3}, {4}, NULL, {}, {NULL, 5, 6} }
  * @endcode
  *
  * @return A list column with list elements having unique entries
@@ -20,6 +20,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 
@@ -195,6 +196,111 @@ std::unique_ptr<table> explode_outer_position(
   size_type explode_column_idx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Explodes the elements of several list columns whose lists have the same sizes.
+ *
+ * The list columns are exploded together, as zipped: the `i`th element of the list of each of the
+ * columns in a row goes into the same output row. The corresponding rows for other columns in the
+ * input are duplicated. The gather map of the rows is built once for all the exploded columns,
+ * which is faster than exploding them one after another. Example:
+ * ```
+ * [[5,10,15], [a,b,c], 100],
+ * [[20,25],   [d,e],   200],
+ * returns
+ * [5,         a,       100],
+ * [10,        b,       100],
+ * [15,        c,       100],
+ * [20,        d,       200],
+ * [25,        e,       200],
+ * ```
+ *
+ * Nulls and empty lists propagate as in `explode(input_table, explode_column_idx)`.
+ *
+ * @throw cudf::logic_error if `explode_column_indices` is empty or has repeated indices.
+ * @throw cudf::logic_error if a column to explode is not a list column.
+ * @throw cudf::logic_error if the lists of the columns to explode differ in size in any row.
+ *
+ * @param input_table Table to explode.
+ * @param explode_column_indices Indices of the columns to explode inside the table.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @return A new table with the columns of `explode_column_indices` exploded.
+ */
+std::unique_ptr<table> explode(
+  table_view const& input_table,
+  std::vector<size_type> const& explode_column_indices,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Explodes the elements of several list columns whose lists have the same sizes, and
+ * includes a position column.
+ *
+ * The list columns are exploded together as by `explode(input_table, explode_column_indices)`,
+ * and the position column holds the index of each output row inside the original lists.
+ *
+ * @throw cudf::logic_error if `explode_column_indices` is empty or has repeated indices.
+ * @throw cudf::logic_error if a column to explode is not a list column.
+ * @throw cudf::logic_error if the lists of the columns to explode differ in size in any row.
+ *
+ * @param input_table Table to explode.
+ * @param explode_column_indices Indices of the columns to explode inside the table.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @return A new table with the exploded values and position. The position column is placed
+ *         before the first of the exploded columns.
+ */
+std::unique_ptr<table> explode_position(
+  table_view const& input_table,
+  std::vector<size_type> const& explode_column_indices,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Explodes the elements of several list columns whose lists have the same sizes, retaining
+ * any null entries or empty lists inside.
+ *
+ * The list columns are exploded together as by `explode(input_table, explode_column_indices)`.
+ * Nulls and empty lists propagate as in `explode_outer(input_table, explode_column_idx)`, with a
+ * null entry in each exploded column.
+ *
+ * @throw cudf::logic_error if `explode_column_indices` is empty or has repeated indices.
+ * @throw cudf::logic_error if a column to explode is not a list column.
+ * @throw cudf::logic_error if the lists of the columns to explode differ in size in any row.
+ *
+ * @param input_table Table to explode.
+ * @param explode_column_indices Indices of the columns to explode inside the table.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @return A new table with the columns of `explode_column_indices` exploded.
+ */
+std::unique_ptr<table> explode_outer(
+  table_view const& input_table,
+  std::vector<size_type> const& explode_column_indices,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Explodes the elements of several list columns whose lists have the same sizes, retaining
+ * any null entries or empty lists and includes a position column.
+ *
+ * The list columns are exploded together as by `explode_outer(input_table,
+ * explode_column_indices)`, and the position column is that of `explode_outer_position(input_table,
+ * explode_column_idx)`.
+ *
+ * @throw cudf::logic_error if `explode_column_indices` is empty or has repeated indices.
+ * @throw cudf::logic_error if a column to explode is not a list column.
+ * @throw cudf::logic_error if the lists of the columns to explode differ in size in any row.
+ *
+ * @param input_table Table to explode.
+ * @param explode_column_indices Indices of the columns to explode inside the table.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @return A new table with the exploded values and position. The position column is placed
+ *         before the first of the exploded columns.
+ */
+std::unique_ptr<table> explode_outer_position(
+  table_view const& input_table,
+  std::vector<size_type> const& explode_column_indices,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 }  // namespace cudf
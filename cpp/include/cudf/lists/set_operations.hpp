@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/stream_compaction.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_set_operations
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Create a lists column of the distinct entries found in both lists of each row of `lhs`
+ * and `rhs`
+ *
+ * A row of the output is null if the row of either input is null. The entries of each output list
+ * are in the order of their first occurrence in the list of `lhs`.
+ *
+ * @code{.pseudo}
+ * lhs    = { {1, 2, 2, 3}, {4, 5}, NULL, {} }
+ * rhs    = { {3, 2, 6}, {6}, {1}, {1} }
+ * output = { {2, 3}, {}, NULL, {} }
+ * @endcode
+ *
+ * @throw cudf::logic_error if `lhs` and `rhs` have different sizes or entry types.
+ * @throw cudf::logic_error if the entries are of a nested type.
+ *
+ * @param lhs         The first lists column
+ * @param rhs         The second lists column
+ * @param nulls_equal Flag to specify whether null entries should be considered equal
+ * @param nans_equal  Flag to specify whether NaN entries should be considered as equal value (only
+ * applicable for floating point data column)
+ * @param mr          Device resource used to allocate memory
+ * @return A lists column of the intersections of the rows of `lhs` and `rhs`
+ */
+std::unique_ptr<column> intersect_distinct(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::UNEQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a lists column of the distinct entries found in either list of each row of `lhs`
+ * and `rhs`
+ *
+ * A row of the output is null if the row of either input is null. The entries of each output list
+ * are those of the list of `lhs` in the order of their first occurrence, followed by those only
+ * found in the list of `rhs`.
+ *
+ * @code{.pseudo}
+ * lhs    = { {1, 2, 2, 3}, {4, 5}, NULL, {} }
+ * rhs    = { {3, 2, 6}, {6}, {1}, {1} }
+ * output = { {1, 2, 3, 6}, {4, 5, 6}, NULL, {1} }
+ * @endcode
+ *
+ * @throw cudf::logic_error if `lhs` and `rhs` have different sizes or entry types.
+ * @throw cudf::logic_error if the entries are of a nested type.
+ *
+ * @param lhs         The first lists column
+ * @param rhs         The second lists column
+ * @param nulls_equal Flag to specify whether null entries should be considered equal
+ * @param nans_equal  Flag to specify whether NaN entries should be considered as equal value (only
+ * applicable for floating point data column)
+ * @param mr          Device resource used to allocate memory
+ * @return A lists column of the unions of the rows of `lhs` and `rhs`
+ */
+std::unique_ptr<column> union_distinct(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::UNEQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a lists column of the distinct entries of each row of `lhs` which are not found
+ * in the same row of `rhs`
+ *
+ * A row of the output is null if the row of either input is null. The entries of each output list
+ * are in the order of their first occurrence in the list of `lhs`.
+ *
+ * @code{.pseudo}
+ * lhs    = { {1, 2, 2, 3}, {4, 5}, NULL, {} }
+ * rhs    = { {3, 2, 6}, {6}, {1}, {1} }
+ * output = { {1}, {4, 5}, NULL, {} }
+ * @endcode
+ *
+ * @throw cudf::logic_error if `lhs` and `rhs` have different sizes or entry types.
+ * @throw cudf::logic_error if the entries are of a nested type.
+ *
+ * @param lhs         The first lists column
+ * @param rhs         The second lists column
+ * @param nulls_equal Flag to specify whether null entries should be considered equal
+ * @param nans_equal  Flag to specify whether NaN entries should be considered as equal value (only
+ * applicable for floating point data column)
+ * @param mr          Device resource used to allocate memory
+ * @return A lists column of the differences of the rows of `lhs` and `rhs`
+ */
+std::unique_ptr<column> difference_distinct(
+  lists_column_view const& lhs,
+  lists_column_view const& rhs,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::UNEQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace lists
+}  // namespace cudf
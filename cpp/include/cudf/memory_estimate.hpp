@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup transformation_transform
+ * @{
+ * @file
+ * @brief Estimates of the device memory used by operations, computed before running them
+ */
+
+/**
+ * @brief Device memory used by an operation, in bytes.
+ */
+struct memory_estimate {
+  std::size_t temporary_bytes{0};  ///< Temporary device memory freed before the operation returns
+  std::size_t output_bytes{0};     ///< Device memory of the result of the operation
+
+  /**
+   * @brief Returns the peak device memory of the operation, as if its temporaries and its result
+   * were all allocated at once.
+   */
+  std::size_t total_bytes() const { return temporary_bytes + output_bytes; }
+};
+
+/**
+ * @brief Returns an upper bound on the device memory used by `cudf::gather(source_table,
+ * gather_map, bounds_policy)`.
+ *
+ * The output size is the sum of the `cudf::row_bit_count` of the gathered rows, plus the padding of
+ * the allocations of every column. The temporaries are the gather maps of the children of lists
+ * columns.
+ *
+ * Computing the estimate allocates device memory of the size of the per-row bit counts of
+ * `source_table`.
+ *
+ * @throws cudf::logic_error if gather_map contains null values.
+ *
+ * @param source_table The input columns whose rows would be gathered
+ * @param gather_map View into a non-nullable column of integral indices
+ * @param bounds_policy Policy to apply to account for possible out-of-bounds indices
+ * @return Estimate of the device memory used by the gather
+ */
+memory_estimate estimate_gather_memory(
+  table_view const& source_table,
+  column_view const& gather_map,
+  out_of_bounds_policy bounds_policy = out_of_bounds_policy::DONT_CHECK);
+
+/**
+ * @brief Returns an upper bound on the device memory used by `cudf::sort(input)`.
+ *
+ * The output size is that of gathering every row of `input`. The temporaries are the sorted order
+ * of the rows and the buffers of the sort of the keys, plus those of the gather.
+ *
+ * @param input The table that would be sorted
+ * @return Estimate of the device memory used by the sort
+ */
+memory_estimate estimate_sort_memory(table_view const& input);
+
+/**
+ * @brief Returns an upper bound on the device memory used by `cudf::inner_join(left_keys,
+ * right_keys, compare_nulls)`, which returns the row indices of the matching rows.
+ *
+ * The number of matching rows is computed exactly by building the hash table of the smaller table
+ * and running the size pass of the join, so that computing the estimate uses as much temporary
+ * device memory as the join itself. The temporaries are the hash table and the null mask of the
+ * build table.
+ *
+ * @param left_keys The left table
+ * @param right_keys The right table
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @return Estimate of the device memory used by the join
+ */
+memory_estimate estimate_inner_join_memory(table_view const& left_keys,
+                                           table_view const& right_keys,
+                                           null_equality compare_nulls = null_equality::EQUAL);
+
+/**
+ * @brief Returns an upper bound on the device memory used by `cudf::inner_join(left, right,
+ * left_on, right_on, compare_nulls)`, which returns the joined table.
+ *
+ * The output size assumes that every matching row is as large as the largest row of its table,
+ * as given by `cudf::row_bit_count`. The row indices of the matching rows are temporaries.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param left_on The column indices from `left` to join on
+ * @param right_on The column indices from `right` to join on
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @return Estimate of the device memory used by the join
+ */
+memory_estimate estimate_inner_join_memory(table_view const& left,
+                                           table_view const& right,
+                                           std::vector<size_type> const& left_on,
+                                           std::vector<size_type> const& right_on,
+                                           null_equality compare_nulls = null_equality::EQUAL);
+
+/** @} */  // end of group
+}  // namespace cudf
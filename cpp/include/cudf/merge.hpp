@@ -33,6 +33,9 @@ namespace cudf {
  * Merges sorted tables into one sorted table
  * containing data from all tables.
  *
+ * Rows of equal keys are ordered by input table. More than two tables are merged together in
+ * one pass over their rows, not pairwise.
+ *
  * ```
  * Example 1:
  * input:
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -78,7 +79,12 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
  * the same bin are grouped consecutively in the output table. Returns a vector
  * of row offsets to the start of each partition in the output table.
  *
+ * Up to 1024 partitions, the rows are partitioned with a histogram of the partitions in shared
+ * memory; above, they are first grouped into coarse partitions of consecutive partitions, which
+ * are then partitioned in the same way.
+ *
  * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ * @throw cudf::logic_error if `num_partitions` is larger than 1048576 (`1024 * 1024`)
  *
  * @param input The table to partition
  * @param columns_to_hash Indices of input columns to hash
@@ -99,6 +105,96 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Partitions rows from the input table like `hash_partition`, using precomputed hash
+ * values of the rows instead of hashing them.
+ *
+ * This lets the hash values of the keys, e.g. computed once with `cudf::hash`, be reused by the
+ * operations of a plan that hash the same keys, like `hash_join` and `groupby`. With the result
+ * of `cudf::hash(input.select(columns_to_hash))`, the rows are partitioned like
+ * `hash_partition(input, columns_to_hash, num_partitions)`.
+ *
+ * @throw cudf::logic_error if `row_hashes` is not an INT32 or UINT32 column of
+ * `input.num_rows()` elements without nulls
+ * @throw cudf::logic_error if `num_partitions` is larger than 1048576 (`1024 * 1024`)
+ *
+ * @param input The table to partition
+ * @param row_hashes The hash value of every row of `input`
+ * @param num_partitions The number of partitions to use
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @returns An output table and a vector of row offsets to each partition
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions rows from the input table like `hash_partition`, and packs each partition
+ * into its own contiguous buffer like `contiguous_split`.
+ *
+ * Tables of fixed-width columns are gathered straight into the packed partitions, without
+ * materializing the partitioned table. Other tables are partitioned and then split.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ * @throw cudf::logic_error if `num_partitions` is larger than 1048576 (`1024 * 1024`)
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function Optional hash id that chooses the hash function to use
+ * @param seed Optional seed value to the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned partitions' device memory.
+ *
+ * @returns The packed partitions, which `cudf::unpack` turns back into tables, or none if there
+ * are no partitions or nothing to hash
+ */
+std::vector<packed_table> hash_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  uint32_t seed                       = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions rows of `input` into `num_partitions` ranges of the keys in `key_columns`.
+ *
+ * The `num_partitions - 1` splitters bounding the ranges are picked from a sorted sample of the
+ * keys, and each row goes to the partition of the first splitter that is not less than it in the
+ * order given by `column_order` and `null_precedence`. All the rows of a partition are thus ordered
+ * before the rows of the next partitions, and equal rows are in the same partition. The order of
+ * the rows within each partition is undefined, and the partition sizes are only as balanced as the
+ * sample allows.
+ *
+ * @throw cudf::logic_error if `column_order` or `null_precedence` is not empty and their sizes
+ * don't match the number of key columns
+ *
+ * @param input The table to partition
+ * @param key_columns Indices of the key columns of `input` that the ranges are of
+ * @param num_partitions The number of partitions to use
+ * @param column_order The desired order of each key column, ascending if empty
+ * @param null_precedence The desired order of null compared to other elements of each key column,
+ * nulls before if empty
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @returns An output table and a vector of `num_partitions + 1` row offsets to each partition,
+ * or no offsets if `input` has no rows or there are no partitions
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  size_type num_partitions,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Round-robin partition.
  *
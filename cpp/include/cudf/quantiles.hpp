@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -57,6 +58,42 @@ std::unique_ptr<column> quantile(
   bool exact                          = true,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the same quantiles of every column of a table.
+ *
+ * The output column `i` holds the quantiles `q` of the valid values of the input column `i`,
+ * interpolated as by `quantile`, and is null for a column without valid values. Unsorted
+ * columns of the same numeric or decimal type are sorted together by a single segmented sort of
+ * their concatenation, and the other unsorted columns are sorted one at a time. Sorted columns
+ * are used as they are, without checking their order.
+ *
+ * @param input           Table of the columns from which to compute quantile values.
+ * @param q               Specified quantiles in range [0, 1].
+ * @param interp          Strategy used to select between values adjacent to
+ *                        a specified quantile.
+ * @param is_input_sorted Indicates if every column is sorted in ascending order.
+ * @param null_precedence If the columns are sorted, indicates whether the nulls of each column
+ *                        are before or after its other values. If empty, assumes all columns
+ *                        use `null_order::BEFORE`. Ignored if the columns are not sorted.
+ * @param exact           If true, returns doubles.
+ *                        If false, returns same type as input.
+ * @param mr              Device memory resource used to allocate the returned table's device
+ *                        memory
+ *
+ * @throws cudf::logic_error if `null_precedence` is neither empty nor of one order per column
+ * @throws cudf::logic_error if a column is not numeric
+ *
+ * @returns Table of the quantiles of every column, with nulls for indeterminable values.
+ */
+std::unique_ptr<table> quantile(
+  table_view const& input,
+  std::vector<double> const& q,
+  interpolation interp                           = interpolation::LINEAR,
+  cudf::sorted is_input_sorted                   = sorted::NO,
+  std::vector<null_order> const& null_precedence = {},
+  bool exact                                     = true,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns the rows of the input corresponding to the requested quantiles.
  *
@@ -94,5 +131,35 @@ std::unique_ptr<table> quantiles(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Estimates percentiles from t-digests.
+ *
+ * Every row of `input` is a t-digest created by a TDIGEST or MERGE_TDIGEST aggregation. The
+ * percentiles of a digest are interpolated linearly between the means of its centroids, each
+ * centroid being centered on the cumulative weight of the values it summarizes.
+ *
+ * @code{.pseudo}
+ * values      = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10]
+ * digest      = make_tdigest_aggregation() of values
+ * percentiles = [0, 0.5, 1]
+ * output      = [[1, 5.5, 10]]
+ * @endcode
+ *
+ * @param input       Lists column of t-digests.
+ * @param percentiles FLOAT64 column of the desired percentiles in range [0, 1].
+ * @param mr          Device memory resource used to allocate the returned column's device memory.
+ *
+ * @throws cudf::logic_error if `input` is not a column of lists of structs of FLOAT64 means and
+ * weights
+ * @throws cudf::logic_error if `percentiles` is not a FLOAT64 column without nulls
+ *
+ * @returns LIST of FLOAT64 column with the `percentiles.size()` estimates of every digest, null
+ * for null or empty digests.
+ */
+std::unique_ptr<column> percentile_approx(
+  lists_column_view const& input,
+  column_view const& percentiles,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
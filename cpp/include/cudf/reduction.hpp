@@ -18,6 +18,12 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -69,11 +75,131 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Computes the reduction of the values in all the chunks of a chunked column.
+ *
+ * The result is the one of `reduce` of the concatenated chunks. `sum`, `product`, `min`, `max`,
+ * `any`, `all` and `sum_of_squares` are computed from the reductions of each chunk, without
+ * concatenating them, while the other aggregations reduce the concatenated chunks.
+ *
+ * @throw cudf::logic_error in the cases where `reduce` of a `column_view` throws
+ *
+ * @param col Input chunked column view
+ * @param agg Aggregation operator applied by the reduction
+ * @param output_dtype  The computation and output precision.
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @returns Output scalar with reduce result.
+ */
+std::unique_ptr<scalar> reduce(
+  chunked_column_view const &col,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief A reduction of one column of a table, computed by `reduce` of a table.
+ */
+struct reduction_request {
+  size_type column_index;            ///< Index of the reduced column in the table
+  std::unique_ptr<aggregation> agg;  ///< Aggregation operator applied by the reduction
+  data_type output_dtype;            ///< The computation and output precision
+};
+
+/**
+ * @brief  Computes several reductions of the columns of a table.
+ *
+ * The result of each request is the one of `reduce` of its column, except that the sums of
+ * `FLOAT32` columns are accumulated in double precision. The `sum`, `min`, `max`, `any`, `all`,
+ * `sum_of_squares`, `mean`, `var` and `std` reductions of a non-boolean numeric column are all
+ * computed in a single pass over the column, while the other requests are reduced one at a time.
+ *
+ * @throw cudf::logic_error if the column index of a request is out of the bounds of the table
+ * @throw cudf::logic_error in the cases where `reduce` of a `column_view` throws
+ *
+ * @param table Input table
+ * @param requests The reductions to compute
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns One output scalar per request, in the order of the requests
+ */
+std::vector<std::unique_ptr<scalar>> reduce(
+  table_view const &table,
+  std::vector<reduction_request> const &requests,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Computes the reduction of the values in each segment of a column.
+ *
+ * The segment `i` is the rows `[offsets[i], offsets[i+1])` of `segmented_values`, and the
+ * result column has one row per segment. The rows of a LIST column are reduced by passing its
+ * child column as `segmented_values` and its offsets as `offsets`.
+ *
+ * `sum`, `min`, `max`, `any`, `all` and `mean` are supported. The output types follow those of
+ * `reduce`: `min` and `max` require the type of the input column, `any` and `all` require
+ * `BOOL8`, and `mean` requires a floating point type. Only `min` and `max` support
+ * non-arithmetic (timestamp, duration, decimal) input types.
+ *
+ * If `null_handling` is `null_policy::EXCLUDE`, the null values are skipped and the result of a
+ * segment is null if it has no valid values. If it is `null_policy::INCLUDE`, the result of a
+ * segment is null if it has any null values or is empty.
+ *
+ * This function does not detect overflows in reductions.
+ *
+ * @throw cudf::logic_error if `offsets` is empty
+ * @throw cudf::logic_error if the aggregation is not supported
+ * @throw cudf::logic_error if the input or output type is not supported by the aggregation
+ *
+ * @param segmented_values Input column view
+ * @param offsets Offsets of the segments, in non-decreasing order and within
+ *                `[0, segmented_values.size()]`
+ * @param agg Aggregation operator applied by the reduction
+ * @param output_dtype The computation and output precision
+ * @param null_handling Whether the null values are skipped or make their segment null
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns Output column of the reductions of the segments
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const &segmented_values,
+  device_span<size_type const> offsets,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Computes the inclusive scan of the values in each segment of a column.
+ *
+ * The segment `i` is the rows `[offsets[i], offsets[i+1])` of `segmented_values`, and the scan
+ * restarts at the first row of every segment. The segments must cover all the rows, i.e.
+ * `offsets` starts at 0 and ends at `segmented_values.size()`. This is the scan of `groupby`
+ * for keys whose groups are the segments.
+ *
+ * `sum`, `min` and `max` are supported. The null values are skipped, and the output rows of the
+ * null input rows are null. The output type of `sum` is the type of the `groupby` sum of the
+ * input type, e.g. `INT64` for integral inputs.
+ *
+ * @throw cudf::logic_error if `offsets` is empty
+ * @throw cudf::logic_error if the aggregation or the input type is not supported
+ *
+ * @param segmented_values Input column view
+ * @param offsets Offsets of the segments, in non-decreasing order
+ * @param agg Aggregation operator applied by the scan
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns Output column of the scans of the segments
+ */
+std::unique_ptr<column> segmented_scan(
+  column_view const &segmented_values,
+  device_span<size_type const> offsets,
+  std::unique_ptr<aggregation> const &agg,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
  * The null values are skipped for the operation, and if an input element
  * at `i` is null, then the output element at `i` will also be null.
+ * If the nulls are included, the output elements are null from the first one
+ * whose scanned elements include a null: the null element itself for an
+ * inclusive scan, and the element following it for an exclusive scan.
  *
  * @throws cudf::logic_error if column datatype is not numeric type.
  *
@@ -94,6 +220,31 @@ std::unique_ptr<column> scan(
   null_policy null_handling           = null_policy::EXCLUDE,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Computes the scans of all columns of a table.
+ *
+ * The result column `i` is the one of `scan` of the input column `i`. The `sum`, `min`, `max`
+ * and `product` scans of the arithmetic columns of the same type are computed together in a
+ * single scan over all their rows, while the other columns are scanned one at a time.
+ *
+ * @throws cudf::logic_error in the cases where `scan` of a `column_view` throws
+ *
+ * @param[in] input The table whose columns are scanned
+ * @param[in] agg unique_ptr to aggregation operator applied by the scans
+ * @param[in] inclusive The flag for applying inclusive scans if
+ *            scan_type::INCLUSIVE, exclusive scans if scan_type::EXCLUSIVE.
+ * @param[in] null_handling Exclude null values when computing the results if
+ * null_policy::EXCLUDE. Include nulls if null_policy::INCLUDE.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @returns Table of the scans of the input columns
+ */
+std::unique_ptr<table> scan(
+  table_view const &input,
+  std::unique_ptr<aggregation> const &agg,
+  scan_type inclusive,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Determines the minimum and maximum values of a column.
  *
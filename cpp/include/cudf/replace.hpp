@@ -18,6 +18,7 @@
 
 #include <cudf/types.hpp>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -69,6 +70,54 @@ std::unique_ptr<column> replace_nulls(
   scalar const& replacement,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Replaces all null values in a column with corresponding values of another column,
+ * writing the result into a preallocated column.
+ *
+ * If `input[i]` is NULL, then `output[i]` will contain `replacement[i]`, and `input[i]` otherwise.
+ * `output[i]` is NULL if both are NULL. `output` may be `input` or `replacement` itself, to
+ * replace the nulls in place without allocating a column. Otherwise it must not overlap them.
+ *
+ * Only fixed-width types are supported.
+ *
+ * @throw cudf::logic_error if `input`, `replacement` and `output` are not of the same type and size
+ * @throw cudf::logic_error if `output` is not nullable while `input` and `replacement` have nulls
+ * @throw cudf::logic_error if `output` overlaps `input` or `replacement` without viewing the same
+ * elements
+ *
+ * @param[in] input A column whose null values will be replaced
+ * @param[in] replacement A cudf::column whose values will replace null values in input
+ * @param[in,out] output The preallocated column of the result
+ */
+void replace_nulls(column_view const& input,
+                   column_view const& replacement,
+                   mutable_column_view& output);
+
+/**
+ * @brief Replaces all null values in a column with a scalar, writing the result into a
+ * preallocated column.
+ *
+ * If `input[i]` is NULL, then `output[i]` will contain `replacement`, and `input[i]` otherwise.
+ * `output` may be `input` itself, to replace the nulls in place without allocating a column. Its
+ * null mask, if any, is set to all valid, unless `replacement` is invalid. Otherwise `output` must
+ * not overlap `input`.
+ *
+ * Only fixed-width types are supported.
+ *
+ * @throw cudf::logic_error if `input`, `replacement` and `output` are not of the same type
+ * @throw cudf::logic_error if `output` is not of the size of `input`
+ * @throw cudf::logic_error if `output` is not nullable while `input` has nulls and `replacement` is
+ * invalid
+ * @throw cudf::logic_error if `output` overlaps `input` without viewing the same elements
+ *
+ * @param[in] input A column whose null values will be replaced
+ * @param[in] replacement Scalar used to replace null values in `input`.
+ * @param[in,out] output The preallocated column of the result
+ */
+void replace_nulls(column_view const& input,
+                   scalar const& replacement,
+                   mutable_column_view& output);
+
 /**
  * @brief Replaces all null values in a column with the first non-null value that precedes/follows.
  *
@@ -86,6 +135,65 @@ std::unique_ptr<column> replace_nulls(
   replace_policy const& replace_policy,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The replacement of the null values of a column of a table: either a scalar or a
+ * `replace_policy`.
+ *
+ * A `null_replacement` made from a scalar refers to it, so the scalar must outlive it.
+ */
+class null_replacement {
+ public:
+  /**
+   * @brief Replaces the null values with `value`, like `replace_nulls(column_view const&, scalar
+   * const&)`.
+   */
+  null_replacement(scalar const& value) : _value{&value} {}
+
+  /**
+   * @brief Replaces the null values with the first non-null value preceding or following them,
+   * like `replace_nulls(column_view const&, replace_policy const&)`.
+   */
+  null_replacement(replace_policy policy) : _policy{policy} {}
+
+  /**
+   * @brief Returns the scalar replacing the null values, or `nullptr` if they are replaced
+   * following a `replace_policy`.
+   */
+  [[nodiscard]] scalar const* value() const { return _value; }
+
+  /**
+   * @brief Returns the policy replacing the null values, if `value()` is `nullptr`.
+   */
+  [[nodiscard]] replace_policy policy() const { return _policy; }
+
+ private:
+  scalar const* _value{nullptr};
+  replace_policy _policy{replace_policy::PRECEDING};
+};
+
+/**
+ * @brief Replaces the null values of every column of a table, each with its own scalar or
+ * `replace_policy`.
+ *
+ * Column `i` of the result is `replace_nulls(input.column(i), replacements[i])`. The fixed-width
+ * columns are replaced together: the gather maps of all the columns replaced by a policy are
+ * computed by a single segmented scan, and the values and null masks of all the fixed-width
+ * columns are written by a single kernel, instead of a few kernel launches per column.
+ *
+ * @throw cudf::logic_error if `replacements` doesn't have one replacement per column of `input`
+ * @throw cudf::logic_error if a replacement scalar doesn't have the type of its column
+ *
+ * @param[in] input A table whose null values will be replaced
+ * @param[in] replacements The replacement of the null values of each column of `input`
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns Copy of `input` with the null values of each column replaced by its replacement.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<null_replacement> const& replacements,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Replaces all NaN values in a column with corresponding values from another column
  *
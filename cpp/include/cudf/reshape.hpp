@@ -19,14 +19,16 @@
 #include <cudf/column/column.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+
 #include <memory>
+#include <utility>
 
 namespace cudf {
 /**
  * @addtogroup column_reshape
  * @{
  * @file
- * @brief Column APIs for interleave and tile
+ * @brief Column APIs for interleave, tile, melt and pivot
  */
 
 /**
@@ -97,6 +99,78 @@ std::unique_ptr<column> byte_cast(
   flip_endianness endian_configuration,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Reshapes a table from wide to long format, with one output row per input row and value
+ * column.
+ *
+ * The output has the columns of `id_columns`, then an INT32 column of the indices of the value
+ * columns in `value_columns`, then a column of the values. The rows of the output are those of
+ * the first value column, then those of the second, and so on: row `j * num_rows + i` holds row
+ * `i` of `id_columns`, `j` and row `i` of `value_columns.column(j)`.
+ *
+ * The ids are gathered in one pass with a computed map, and the values are concatenated.
+ *
+ * ```
+ * id_columns    = [[1, 2]]
+ * value_columns = [[10, 20], [30, 40], [50, 60]]
+ * return        = [[1, 2, 1, 2, 1, 2], [0, 0, 1, 1, 2, 2], [10, 20, 30, 40, 50, 60]]
+ * ```
+ *
+ * @throws cudf::logic_error if `value_columns` has no columns.
+ * @throws cudf::logic_error if the columns of `value_columns` are not all of the same type.
+ * @throws cudf::logic_error if `id_columns` has columns and not the number of rows of
+ * `value_columns`.
+ *
+ * @param id_columns Table of the columns to repeat for each value column. May have no columns.
+ * @param value_columns Table of the columns to stack into a single column.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @return The table of the ids, value column indices and values.
+ */
+std::unique_ptr<table> melt(
+  table_view const& id_columns,
+  table_view const& value_columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Reshapes a table from long to wide format, with one output row per unique row of
+ * `index` and one output column of values per unique value of `columns`.
+ *
+ * The unique rows of `index` and the unique values of `columns` are both sorted in ascending
+ * order, with nulls last, and nulls compare equal. Row `i` of output value column `j` holds the
+ * value of the row of `values` whose index is the `i`th unique index row and whose column is the
+ * `j`th unique column value, or a null if there is no such row. If there are several, one of
+ * them is taken, and which one is unspecified.
+ *
+ * A single gather map of all cells of the output is computed, with one pass over the rows, and
+ * each output column is gathered from `values` with its part of the map.
+ *
+ * ```
+ * index   = [[1, 1, 2, 3]]
+ * columns = [b, a, a, b]
+ * values  = [10, 20, 30, 40]
+ * return  = ([[1, 2, 3], [20, 30, null], [10, null, 40]], [a, b])
+ * ```
+ *
+ * @throws cudf::logic_error if `index`, `columns` and `values` do not have the same number of
+ * rows.
+ * @throws cudf::logic_error if the number of output cells exceeds the column size limit.
+ *
+ * @param index Table of the keys of the output rows.
+ * @param columns Column of the keys of the output value columns.
+ * @param values Column of the values to reshape.
+ * @param mr Device memory resource used to allocate the returned table's and column's device
+ * memory.
+ *
+ * @return The table of the unique rows of `index` followed by the value columns, and the column
+ * of the unique values of `columns`, in the order of the value columns.
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> pivot(
+  table_view const& index,
+  column_view const& columns,
+  column_view const& values,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 }  // namespace cudf
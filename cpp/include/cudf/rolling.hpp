@@ -20,6 +20,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -44,6 +45,8 @@ namespace cudf {
  * The returned column for count aggregation always has `INT32` type. All other operators return a
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
+ * `VARIANCE`, `STD`, `MEDIAN` and `QUANTILE` of numeric columns return a `FLOAT64` column, and
+ * a rolling `QUANTILE` computes exactly one quantile.
  *
  * @param[in] input_col The input column
  * @param[in] preceding_window The static rolling window size in the backward direction.
@@ -180,6 +183,8 @@ struct window_bounds {
  * The returned column for `op == COUNT` always has `INT32` type. All other operators return a
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
+ * `VARIANCE`, `STD`, `MEDIAN` and `QUANTILE` of numeric columns return a `FLOAT64` column, and
+ * a rolling `QUANTILE` computes exactly one quantile.
  *
  * @param[in] group_keys The (pre-sorted) grouping columns
  * @param[in] input The input column (to be aggregated)
@@ -334,6 +339,8 @@ std::unique_ptr<column> grouped_rolling_window(
  * The returned column for `op == COUNT` always has `INT32` type. All other operators return a
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
+ * `VARIANCE`, `STD`, `MEDIAN` and `QUANTILE` of numeric columns return a `FLOAT64` column, and
+ * a rolling `QUANTILE` computes exactly one quantile.
  *
  * @param[in] group_keys The (pre-sorted) grouping columns
  * @param[in] timestamp_column The (pre-sorted) timestamps for each row
@@ -436,8 +443,10 @@ std::unique_ptr<column> grouped_time_range_rolling_window(
  *      E.g. For `orderby` column of type `TIMESTAMP_SECONDS`, the intervals may only be
  *      `DURATION_SECONDS`. Durations of higher resolution (e.g. `DURATION_NANOSECONDS`)
  *      or lower (e.g. `DURATION_DAYS`) cannot be used.
- *   2. If the `orderby` column is an integral type (e.g. `INT32`), the `preceding`/`following`
- *      should be the exact same type (`INT32`).
+ *   2. If the `orderby` column is an integral or floating-point type (e.g. `INT32`), the
+ *      `preceding`/`following` should be the exact same type (`INT32`).
+ *   3. If the `orderby` column is a decimal type (e.g. `DECIMAL32`), the `preceding`/`following`
+ *      should be the exact same type, with the same scale as the `orderby` column.
  *
  * @code{.pseudo}
  * Example: Consider an motor-racing statistics dataset, containing the following columns:
@@ -538,6 +547,8 @@ std::unique_ptr<column> grouped_range_rolling_window(
  * The returned column for count aggregation always has INT32 type. All other operators return a
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
+ * `VARIANCE`, `STD`, `MEDIAN` and `QUANTILE` of numeric columns return a `FLOAT64` column, and
+ * a rolling `QUANTILE` computes exactly one quantile.
  *
  * @throws cudf::logic_error if window column type is not INT32
  *
@@ -562,5 +573,63 @@ std::unique_ptr<column> rolling_window(
   std::unique_ptr<aggregation> const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Applies several fixed-size rolling window functions to the values in a column.
+ *
+ * Computes the same results as calling `rolling_window()` once per aggregation. The window
+ * bounds are computed once, and when the input is a non-boolean numeric column and all
+ * aggregations are `SUM`, `MIN`, `MAX`, `COUNT_VALID`, `COUNT_ALL` or `MEAN`, the rows of each
+ * window are read once for all aggregations.
+ *
+ * @param[in] input_col The input column
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregations to compute
+ *
+ * @returns   A nullable output column per aggregation containing the rolling window results,
+ *            in the order of `aggs`
+ */
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Applies several variable-size rolling window functions to the values in a column.
+ *
+ * Computes the same results as calling `rolling_window()` once per aggregation. The window
+ * bounds are computed once, and when the input is a non-boolean numeric column and all
+ * aggregations are `SUM`, `MIN`, `MAX`, `COUNT_VALID`, `COUNT_ALL` or `MEAN`, the rows of each
+ * window are read once for all aggregations.
+ *
+ * @throws cudf::logic_error if window column type is not INT32
+ *
+ * @param[in] input_col The input column
+ * @param[in] preceding_window A non-nullable column of INT32 window sizes in the forward direction.
+ *                             `preceding_window[i]` specifies preceding window size for
+ *                             element `i`.
+ * @param[in] following_window A non-nullable column of INT32 window sizes in the backward
+ *                             direction. `following_window[i]` specifies following window size
+ *                             for element `i`.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregations to compute
+ *
+ * @returns   A nullable output column per aggregation containing the rolling window results,
+ *            in the order of `aggs`
+ */
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
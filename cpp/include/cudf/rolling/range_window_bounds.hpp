@@ -30,6 +30,8 @@ namespace cudf {
  *   1. A fixed-width numeric scalar value. E.g.
  *      a) A `DURATION_DAYS` scalar, for use with a `TIMESTAMP_DAYS` orderby column
  *      b) An `INT32` scalar, for use with an `INT32` orderby column
+ *      c) A `FLOAT64` scalar, for use with a `FLOAT64` orderby column
+ *      d) A `DECIMAL32` scalar, for use with a `DECIMAL32` orderby column of the same scale
  *   2. "unbounded", indicating that the bounds stretch to the first/last
  *      row in the group.
  */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup column_reshape
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Convert a table to rows, each row being a list of the bytes of its values.
+ *
+ * In each row, the values of the fixed-width columns are aligned to their size, and a strings
+ * value is an 8-byte aligned pair of 32-bit integers: the offset of its characters from the
+ * start of the row, then its size in bytes. The validity of the columns follows as one bit per
+ * column, the characters of the strings follow the validity, and the row is padded to a multiple
+ * of 8 bytes. The characters of a null string are empty.
+ *
+ * The rows are split into several lists columns of INT8 so that the bytes of each list column fit
+ * in the 2GB limit of its offsets.
+ *
+ * @throws cudf::logic_error if a column is neither fixed-width nor strings
+ * @throws cudf::logic_error if a row does not fit in the shared memory of a thread block
+ *
+ * @param input Table to convert
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Lists columns of the bytes of consecutive ranges of rows
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Convert rows, each row being a list of the bytes of its values, to a table.
+ *
+ * This is the inverse of `convert_to_rows` for the rows of one of its lists columns.
+ *
+ * @throws cudf::logic_error if `input` is not a lists column of INT8 or UINT8
+ * @throws cudf::logic_error if a type of `schema` is neither fixed-width nor strings
+ * @throws cudf::logic_error if the size of the rows doesn't match `schema`
+ *
+ * @param input Lists column of bytes of the rows
+ * @param schema Types of the columns of the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table of the values of the rows
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
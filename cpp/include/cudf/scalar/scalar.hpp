@@ -27,6 +27,7 @@
 #include <rmm/device_scalar.hpp>
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -67,17 +68,25 @@ class scalar {
   /**
    * @brief Updates the validity of the value
    *
+   * The validity is copied to device memory asynchronously and is also kept on the host, so that
+   * `is_valid()` does not need to synchronize `stream`.
+   *
    * @param is_valid true: set the value to valid. false: set it to null
    * @param stream CUDA stream used for device memory operations.
    */
   void set_valid(bool is_valid, rmm::cuda_stream_view stream = rmm::cuda_stream_default)
   {
     _is_valid.set_value(is_valid, stream);
+    _host_is_valid = is_valid;
   }
 
   /**
    * @brief Indicates whether the scalar contains a valid value
    *
+   * The validity set on the host by the constructor or `set_valid()` is returned without any
+   * device access. Once the validity may have been written in device memory through
+   * `validity_data()`, it is copied from the device, which synchronizes `stream`.
+   *
    * @note Using the value when `is_valid() == false` is undefined behaviour
    *
    * @param stream CUDA stream used for device memory operations.
@@ -86,13 +95,21 @@ class scalar {
    */
   bool is_valid(rmm::cuda_stream_view stream = rmm::cuda_stream_default) const
   {
+    if (_host_is_valid.has_value()) { return *_host_is_valid; }
     return _is_valid.value(stream);
   }
 
   /**
    * @brief Returns a raw pointer to the validity bool in device memory
+   *
+   * As the validity may be written through the returned pointer, the host copy of the validity is
+   * discarded, and later calls to `is_valid()` read it from device memory.
    */
-  bool* validity_data() { return _is_valid.data(); }
+  bool* validity_data()
+  {
+    _host_is_valid.reset();
+    return _is_valid.data();
+  }
 
   /**
    * @brief Returns a const raw pointer to the validity bool in device memory
@@ -101,7 +118,8 @@ class scalar {
 
  protected:
   data_type _type{type_id::EMPTY};       ///< Logical type of value in the scalar
-  rmm::device_scalar<bool> _is_valid{};  ///< Device bool signifying validity
+  rmm::device_scalar<bool> _is_valid{};          ///< Device bool signifying validity
+  mutable std::optional<bool> _host_is_valid{};  ///< Host copy of `_is_valid`, if it is known
 
   scalar() = default;
 
@@ -120,7 +138,7 @@ class scalar {
          bool is_valid                       = false,
          rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
          rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
-    : _type(type), _is_valid(is_valid, stream, mr)
+    : _type(type), _is_valid(is_valid, stream, mr), _host_is_valid(is_valid)
   {
   }
 };
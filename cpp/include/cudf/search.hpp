@@ -20,7 +20,11 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
 #include <vector>
 
 namespace cudf {
@@ -62,6 +66,10 @@ namespace cudf {
  * @param values          Find insert locations for these values
  * @param column_order    Vector of column sort order
  * @param null_precedence Vector of null_precedence enums values
+ * @param values_sorted   Whether @p values is sorted in the order of @p t. Sorted values are
+ *                        merged with @p t instead of searched one by one, unless @p values has
+ *                        too few rows for a merge to be faster. The result is undefined if
+ *                        @p values is not sorted.
  * @param mr              Device memory resource used to allocate the returned column's device
  * memory
  * @return A non-nullable column of cudf::size_type elements containing the insertion points.
@@ -71,6 +79,7 @@ std::unique_ptr<column> lower_bound(
   table_view const& values,
   std::vector<order> const& column_order,
   std::vector<null_order> const& null_precedence,
+  sorted values_sorted                = sorted::NO,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -104,6 +113,10 @@ std::unique_ptr<column> lower_bound(
  * @param values          Find insert locations for these values
  * @param column_order    Vector of column sort order
  * @param null_precedence Vector of null_precedence enums values
+ * @param values_sorted   Whether @p values is sorted in the order of @p t. Sorted values are
+ *                        merged with @p t instead of searched one by one, unless @p values has
+ *                        too few rows for a merge to be faster. The result is undefined if
+ *                        @p values is not sorted.
  * @param mr              Device memory resource used to allocate the returned column's device
  * memory
  * @return A non-nullable column of cudf::size_type elements containing the insertion points.
@@ -113,6 +126,7 @@ std::unique_ptr<column> upper_bound(
   table_view const& values,
   std::vector<order> const& column_order,
   std::vector<null_order> const& null_precedence,
+  sorted values_sorted                = sorted::NO,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -154,6 +168,9 @@ bool contains(column_view const& col, scalar const& value);
  *   result = { false, true, false, true, false }
  * @endcode
  *
+ * The values of @p needles are inserted in a hash set, which each element of @p haystack probes.
+ * Use `cudf::hash_contains` to search several haystacks for the same needles.
+ *
  * @param haystack  A column object
  * @param needles   A column of values to search for in `col`
  * @param mr        Device memory resource used to allocate the returned column's device memory
@@ -166,5 +183,60 @@ std::unique_ptr<column> contains(
   column_view const& needles,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hash set of the values of a needles column, which can be searched for in multiple
+ * haystack columns.
+ *
+ * This class enables the hash set to be built once, and reused by subsequent calls to
+ * `contains()`, as when the same set of values filters several columns. Null needles are not
+ * inserted in the set.
+ */
+class hash_contains {
+ public:
+  hash_contains() = delete;
+  ~hash_contains();
+  hash_contains(hash_contains const&) = delete;
+  hash_contains(hash_contains&&);
+  hash_contains& operator=(hash_contains const&) = delete;
+  hash_contains& operator=(hash_contains&&);
+
+  /**
+   * @brief Construct a hash set of the values of `needles` for subsequent calls to `contains()`.
+   *
+   * @note The `hash_contains` object must not outlive the column viewed by `needles`, else
+   * behavior is undefined.
+   *
+   * @throw cudf::logic_error if `needles` is a list or a struct column.
+   *
+   * @param needles The values to search for.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_contains(column_view const& needles,
+                rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns a column of bool elements identifying for each element of `haystack` if that
+   * element is one of the needles. @see cudf::contains(column_view const&, column_view const&,
+   * rmm::mr::device_memory_resource*)
+   *
+   * @throw cudf::logic_error if the type of `haystack` is not the type of the needles.
+   *
+   * @param haystack The values to search.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   *
+   * @return A column of bool elements of the size and null mask of `haystack`, true where the
+   * element of `haystack` appears in the needles
+   */
+  std::unique_ptr<column> contains(
+    column_view const& haystack,
+    rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct hash_contains_impl;
+  std::unique_ptr<const hash_contains_impl> impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
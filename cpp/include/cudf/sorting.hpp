@@ -17,8 +17,10 @@
 #pragma once
 
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace cudf {
@@ -53,6 +55,7 @@ enum class rank_method {
  * @param null_precedence The desired order of null compared to other elements
  * for each column.  Size must be equal to `input.num_columns()` or empty.
  * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return A non-nullable column of `size_type` elements containing the permuted row indices of
  * `input` if it were sorted
@@ -61,6 +64,7 @@ std::unique_ptr<column> sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -75,8 +79,54 @@ std::unique_ptr<column> stable_sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the row indices that would produce `input` in a lexicographical sorted order,
+ * comparing the strings of some columns regardless of the case of their ASCII letters.
+ *
+ * The strings of a column whose `key_case` is `case_sensitivity::INSENSITIVE`, including the
+ * strings within its nested columns, are ordered as if their ASCII letters were lowercase. They
+ * are not copied: the letters are folded as the strings are compared. Other characters, e.g.
+ * non-ASCII letters, are compared as they are. `key_case` doesn't affect the other columns.
+ *
+ * @throws cudf::logic_error if `key_case` is neither empty nor of size `input.num_columns()`
+ *
+ * @param input The table to sort
+ * @param column_order The desired sort order for each column, or empty for all ascending
+ * @param null_precedence The desired order of null compared to other elements for each column,
+ * or empty for all `null_order::BEFORE`
+ * @param key_case The case sensitivity of each column, or empty for all case-sensitive
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` elements containing the permuted row indices of
+ * `input` if it were sorted
+ */
+std::unique_ptr<column> sorted_order(
+  table_view input,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  std::vector<case_sensitivity> const& key_case,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the row indices that would produce `input` in a stable lexicographical sorted
+ * order, comparing the strings of some columns regardless of the case of their ASCII letters.
+ *
+ * The order of equivalent elements, e.g. of strings differing only by case, is preserved.
+ *
+ * @copydetails cudf::sorted_order(table_view,std::vector<order> const&,std::vector<null_order> const&,std::vector<case_sensitivity> const&,rmm::cuda_stream_view,rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<column> stable_sorted_order(
+  table_view input,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  std::vector<case_sensitivity> const& key_case,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Checks whether the rows of a `table` are sorted in a lexicographical
  *        order.
@@ -90,12 +140,14 @@ std::unique_ptr<column> stable_sorted_order(
  *                              elements for each column. Size must be equal to
  *                              `input.num_columns()` or empty. If empty,
  *                              `null_order::BEFORE` is assumed for all columns.
+ * @param[in] stream            CUDA stream used for device memory operations and kernel launches
  *
  * @returns bool                true if sorted as expected, false if not.
  */
 bool is_sorted(cudf::table_view const& table,
                std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence);
+               std::vector<null_order> const& null_precedence,
+               rmm::cuda_stream_view stream = cudf::get_default_stream());
 
 /**
  * @brief Performs a lexicographic sort of the rows of a table
@@ -108,6 +160,7 @@ bool is_sorted(cudf::table_view const& table,
  * elements for each column in `input`. Size must be equal to
  * `input.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return New table containing the desired sorted order of `input`
  */
@@ -115,6 +168,7 @@ std::unique_ptr<table> sort(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -134,6 +188,7 @@ std::unique_ptr<table> sort(
  * elements for each column in `keys`. Size must be equal to
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return The reordering of `values` determined by the lexicographic order of
  * the rows of `keys`.
@@ -143,6 +198,43 @@ std::unique_ptr<table> sort_by_key(
   table_view const& keys,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the row indices of the first `k` rows of `keys` in a lexicographical sorted
+ * order, without sorting all the rows.
+ *
+ * The result is the first `k` indices of `stable_sorted_order(keys, column_order,
+ * null_precedence)`, or all of them if `keys` has fewer than `k` rows.
+ *
+ * @code{.pseudo}
+ * keys = { [5, 2, 8, 2, 9] }
+ * top_k(keys, 3, {order::DESCENDING}) = [4, 2, 0]
+ * top_k(keys, 3, {order::ASCENDING})  = [1, 3, 0]
+ * @endcode
+ *
+ * @throws cudf::logic_error if `k` is negative.
+ *
+ * @param keys The table that determines the ordering
+ * @param k The number of row indices to return
+ * @param column_order The desired order for each column in `keys`. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` of the indices of the first `k` sorted rows
+ */
+std::unique_ptr<column> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -169,6 +261,7 @@ std::unique_ptr<table> sort_by_key(
  * @param null_precedence The desired order of null compared to other elements
  * for column
  * @param percentage flag to convert ranks to percentage in range (0,1}
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return std::unique_ptr<column> A column of containing the rank of the each
  * element of the column of `input`. The output column type will be `size_type`
@@ -182,6 +275,7 @@ std::unique_ptr<column> rank(
   null_policy null_handling,
   null_order null_precedence,
   bool percentage,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -200,6 +294,7 @@ std::unique_ptr<column> rank(
  * elements for each column in `keys`. Size must be equal to
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource to allocate any returned objects
  * @return sorted order of the segment sorted table .
  *
@@ -209,6 +304,7 @@ std::unique_ptr<column> segmented_sorted_order(
   column_view const& segment_offsets,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -229,6 +325,7 @@ std::unique_ptr<column> segmented_sorted_order(
  * elements for each column in `keys`. Size must be equal to
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource to allocate any returned objects
  * @return table with elements in each segment sorted.
  *
@@ -239,7 +336,88 @@ std::unique_ptr<table> segmented_sort_by_key(
   column_view const& segment_offsets,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Default number of rows of the blocks in which `external_sorter` spills its runs.
+ */
+constexpr size_type DEFAULT_SORT_BLOCK_ROWS = 1 << 20;
+
+/**
+ * @brief Sorts tables larger than device memory, pushed and returned in chunks.
+ *
+ * Every pushed table is sorted on the device into a run, which is spilled in blocks of
+ * `block_rows` rows to pinned host memory or to a file. The runs are then merged back in chunks:
+ * every run has one block loaded at a time, and each chunk holds the loaded rows that precede the
+ * last loaded row of every run that has more blocks, which are returned in sorted order. The
+ * device memory used by the merge is thus about `2 * block_rows` rows per run.
+ *
+ * @code{.pseudo}
+ * external_sorter sorter({0}, {order::ASCENDING});
+ * for (auto const& chunk : input_chunks) { sorter.push(chunk); }
+ * while (auto sorted = sorter.next_chunk()) { ... }
+ * @endcode
+ *
+ * The order of rows with equal keys is unspecified.
+ */
+class external_sorter {
+ public:
+  external_sorter() = delete;
+  ~external_sorter();
+  external_sorter(external_sorter const&) = delete;
+  external_sorter(external_sorter&&);
+  external_sorter& operator=(external_sorter const&) = delete;
+  external_sorter& operator=(external_sorter&&);
+
+  /**
+   * @brief Constructs a sorter of tables by the columns `key_columns`.
+   *
+   * @throws cudf::logic_error if `key_columns` is empty
+   * @throws cudf::logic_error if `column_order` or `null_precedence` is neither empty nor of the
+   * size of `key_columns`
+   * @throws cudf::logic_error if `block_rows` is not positive
+   *
+   * @param key_columns The indices of the key columns of the pushed tables
+   * @param column_order The desired order for each key column. If empty, all columns are sorted
+   * in ascending order.
+   * @param null_precedence The desired order of a null element compared to other elements for
+   * each key column. If empty, all columns will be sorted with `null_order::BEFORE`.
+   * @param spill_path The file to which the runs are spilled, which is overwritten and deleted
+   * with the sorter. If empty, the runs are spilled to pinned host memory.
+   * @param block_rows The number of rows of the blocks in which the runs are spilled
+   */
+  external_sorter(std::vector<size_type> const& key_columns,
+                  std::vector<order> const& column_order         = {},
+                  std::vector<null_order> const& null_precedence = {},
+                  std::string const& spill_path                  = {},
+                  size_type block_rows                           = DEFAULT_SORT_BLOCK_ROWS);
+
+  /**
+   * @brief Sorts `input` into a run, and spills it.
+   *
+   * @throws cudf::logic_error if `next_chunk` was called
+   * @throws cudf::logic_error if the columns of `input` don't match those of the pushed tables
+   *
+   * @param input A table that fits in device memory, along with its sorted copy
+   */
+  void push(table_view const& input);
+
+  /**
+   * @brief Returns the next chunk of sorted rows, or nullptr once all the rows were returned.
+   *
+   * No more tables can be pushed once this function was called.
+   *
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The rows that follow the rows of the previous chunks in sorted order
+   */
+  std::unique_ptr<table> next_chunk(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
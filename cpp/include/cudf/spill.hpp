@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup column_classes
+ * @{
+ * @file
+ * @brief Spilling of the device memory of columns to host memory or to files
+ */
+
+/**
+ * @brief Where a `spill_manager` moves the device memory of the columns it spills.
+ */
+enum class spill_target : int32_t {
+  HOST,  ///< Pinned host memory
+  DISK   ///< Files in a spill directory, written through `cudf::io::data_sink`
+};
+
+class spill_manager;
+
+/**
+ * @brief A column whose device memory its `spill_manager` may spill while it is not accessed.
+ *
+ * Accessing the column brings its device memory back if it was spilled, and keeps it on the device
+ * for as long as the returned `access_guard` lives.
+ */
+class spillable_column {
+ public:
+  /**
+   * @brief Keeps a column on the device while it lives, and gives access to its view.
+   */
+  class access_guard {
+   public:
+    access_guard(access_guard&& other) noexcept;
+    access_guard& operator=(access_guard&&) = delete;
+    access_guard(access_guard const&)       = delete;
+    access_guard& operator=(access_guard const&) = delete;
+    ~access_guard();
+
+    /**
+     * @brief Returns the view of the column, valid while the guard lives.
+     */
+    column_view view() const { return _view; }
+
+   private:
+    friend class spillable_column;
+    access_guard(spillable_column* column, column_view view) : _column{column}, _view{view} {}
+
+    spillable_column* _column;
+    column_view _view;
+  };
+
+  spillable_column(spillable_column const&) = delete;
+  spillable_column& operator=(spillable_column const&) = delete;
+  ~spillable_column();
+
+  /**
+   * @brief Returns a guard keeping the column on the device, first bringing it back if it was
+   * spilled.
+   *
+   * Accessing the column makes it the most recently used column of its priority.
+   *
+   * @throws std::bad_alloc if the column can't be brought back to the device
+   */
+  access_guard access();
+
+  /**
+   * @brief Releases the column, first bringing it back if it was spilled.
+   *
+   * The column is no longer tracked by its spill manager.
+   *
+   * @throws cudf::logic_error if the column is being accessed or was already released
+   */
+  std::unique_ptr<column> release();
+
+  /**
+   * @brief Returns whether the device memory of the column is spilled.
+   */
+  bool is_spilled() const { return _spilled; }
+
+  /**
+   * @brief Returns the number of bytes of the device memory of the column.
+   */
+  std::size_t size() const { return _size; }
+
+  /**
+   * @brief Returns the priority of the column; columns of lower priorities are spilled first.
+   */
+  int priority() const { return _priority; }
+
+ private:
+  friend class spill_manager;
+  struct spilled;
+  struct manager_state;
+
+  spillable_column(std::shared_ptr<manager_state> manager,
+                   std::unique_ptr<column>&& column,
+                   int priority);
+
+  /**
+   * @brief Moves the device memory of the column to the spill target, with `_mutex` locked.
+   */
+  void spill_locked();
+
+  /**
+   * @brief Moves the device memory of the column back, with `_mutex` locked.
+   */
+  void unspill_locked();
+
+  std::shared_ptr<manager_state> _manager;
+  std::mutex _mutex;
+  std::unique_ptr<column> _column;
+  std::unique_ptr<spilled> _spilled_data;
+  std::size_t const _size;
+  int const _priority;
+  std::atomic<bool> _spilled{false};
+  std::atomic<int> _num_guards{0};
+  std::atomic<uint64_t> _last_access{0};
+  std::atomic<bool> _released{false};
+};
+
+/**
+ * @brief A table of spillable columns, accessed and released together.
+ */
+class spillable_table {
+ public:
+  /**
+   * @brief Keeps the columns of a table on the device while it lives, and gives access to its
+   * view.
+   */
+  class access_guard {
+   public:
+    /**
+     * @brief Returns the view of the table, valid while the guard lives.
+     */
+    table_view view() const { return _view; }
+
+   private:
+    friend class spillable_table;
+    explicit access_guard(std::vector<spillable_column::access_guard>&& guards);
+
+    std::vector<spillable_column::access_guard> _guards;
+    table_view _view;
+  };
+
+  /**
+   * @brief Returns a guard keeping the columns on the device, first bringing back those that were
+   * spilled.
+   *
+   * @throws std::bad_alloc if a column can't be brought back to the device
+   */
+  access_guard access();
+
+  /**
+   * @brief Releases the table, first bringing back the columns that were spilled.
+   *
+   * @throws cudf::logic_error if the table is being accessed or was already released
+   */
+  std::unique_ptr<table> release();
+
+  /**
+   * @brief Returns the spillable columns of the table.
+   */
+  std::vector<std::shared_ptr<spillable_column>> const& columns() const { return _columns; }
+
+ private:
+  friend class spill_manager;
+  explicit spillable_table(std::vector<std::shared_ptr<spillable_column>>&& columns)
+    : _columns{std::move(columns)}
+  {
+  }
+
+  std::vector<std::shared_ptr<spillable_column>> _columns;
+};
+
+/**
+ * @brief Tracks spillable columns and spills the device memory of those that are not accessed.
+ *
+ * Columns are spilled by increasing priority, and by least recent access within a priority. A
+ * spilled column is brought back to the device when it is accessed. Spilling releases the device
+ * memory of each buffer once it is copied, without allocating device memory, so that it can free
+ * memory when allocations fail; see `spilling_resource_adaptor`.
+ *
+ * All member functions are thread-safe, and the state of the manager lives as long as its columns.
+ */
+class spill_manager {
+ public:
+  /**
+   * @brief Creates a spill manager.
+   *
+   * @throws cudf::logic_error if `target` is `DISK` and `spill_directory` is empty
+   *
+   * @param target Where the spilled device memory is moved
+   * @param spill_directory Directory of the files of the spilled columns, if `target` is `DISK`
+   */
+  explicit spill_manager(spill_target target                = spill_target::HOST,
+                         std::string const& spill_directory = "");
+
+  /**
+   * @brief Makes a column spillable.
+   *
+   * @param column Column to track
+   * @param priority Priority of the column; columns of lower priorities are spilled first
+   * @return The spillable column
+   */
+  std::shared_ptr<spillable_column> make_spillable(std::unique_ptr<column>&& column,
+                                                   int priority = 0);
+
+  /**
+   * @brief Makes the columns of a table spillable.
+   *
+   * @param table Table to track
+   * @param priority Priority of the columns; columns of lower priorities are spilled first
+   * @return The spillable table
+   */
+  std::unique_ptr<spillable_table> make_spillable(std::unique_ptr<table>&& table,
+                                                  int priority = 0);
+
+  /**
+   * @brief Spills columns that are not accessed until at least `bytes` bytes of device memory are
+   * freed, or no column is left to spill.
+   *
+   * @param bytes Number of bytes of device memory to free
+   * @return Number of bytes of device memory freed
+   */
+  std::size_t spill(std::size_t bytes);
+
+  /**
+   * @brief Returns the number of bytes of device memory of the tracked columns that are not
+   * spilled.
+   */
+  std::size_t device_size() const;
+
+  /**
+   * @brief Returns the number of bytes of device memory of the spilled columns.
+   */
+  std::size_t spilled_size() const;
+
+ private:
+  std::shared_ptr<spillable_column::manager_state> _state;
+};
+
+/**
+ * @brief Device memory resource spilling the columns of a `spill_manager` when allocations from
+ * its upstream resource fail.
+ *
+ * A failed allocation spills columns until enough memory may be freed, then is retried; it throws
+ * once no column is left to spill.
+ */
+class spilling_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Creates an adaptor of `upstream` for the columns of `manager`.
+   *
+   * @param upstream Resource of the allocations, which must outlive the adaptor
+   * @param manager Manager spilling the columns, which must outlive the adaptor
+   */
+  spilling_resource_adaptor(rmm::mr::device_memory_resource* upstream, spill_manager& manager)
+    : _upstream{upstream}, _manager{manager}
+  {
+  }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    _upstream->deallocate(ptr, bytes, stream);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* _upstream;
+  spill_manager& _manager;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
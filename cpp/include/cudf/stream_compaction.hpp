@@ -204,6 +204,26 @@ std::unique_ptr<table> apply_boolean_mask(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Filters `input` using a bitmask as a mask.
+ *
+ * The mask is bit-packed, as produced by `cudf::bools_to_mask()` or `cudf::ast::compute_mask()`,
+ * and takes 8 times less memory than a BOOL8 column. Row `i` of the `input` is copied to the
+ * output if bit `i` of `boolean_mask` is set. This operation is stable: the input order is
+ * preserved.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] boolean_mask The bitmask of at least `input.num_rows()` bits used as a mask to filter
+ * the `input`, or `nullptr` if `input` has no rows
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copy of all rows of @p input passing
+ * the filter defined by @p boolean_mask.
+ */
+std::unique_ptr<table> apply_boolean_mask(
+  table_view const& input,
+  bitmask_type const* boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
@@ -243,6 +263,35 @@ std::unique_ptr<table> drop_duplicates(
   null_order null_precedence          = null_order::BEFORE,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a new table without duplicate rows, with a hash table of the rows of `keys`
+ *
+ * Given an `input` table_view, each row is copied to output table if the corresponding
+ * row of `keys` columns is unique, where the definition of unique depends on the value of @p keep:
+ * - KEEP_FIRST: only the first of a set of duplicate rows is copied
+ * - KEEP_LAST: only the last of a set of duplicate rows is copied
+ * - KEEP_NONE: no duplicate rows are copied
+ *
+ * Unlike `drop_duplicates`, duplicate rows don't need to be sorted next to each other, and the
+ * output rows are in the order of the `input` rows.
+ *
+ * @param[in] input           input table_view to copy only unique rows
+ * @param[in] keys            vector of indices representing key columns from `input`
+ * @param[in] keep            keep first entry, last entry, or no entries if duplicates found
+ * @param[in] nulls_equal     flag to denote nulls are equal if null_equality::EQUAL, nulls are not
+ *                            equal if null_equality::UNEQUAL
+ * @param[in] mr              Device memory resource used to allocate the returned table's device
+ * memory
+ *
+ * @return Table with unique rows as per specified `keep`, in their order in `input`.
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  duplicate_keep_option keep          = duplicate_keep_option::KEEP_FIRST,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Count the unique elements in the column_view
  *
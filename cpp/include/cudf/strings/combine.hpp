@@ -255,6 +255,66 @@ std::unique_ptr<column> concatenate_list_elements(
   string_scalar const& narep          = string_scalar("", false),
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Formats the elements of each row of a table into a string following a pattern.
+ *
+ * The pattern is copied to every output row with each of its placeholders replaced by the
+ * element of a column in that row. A placeholder is `{[index][:spec]}`:
+ *
+ * - `index` is the position of the column in `input`. Without it, the placeholder uses the
+ *   column after the one of the previous placeholder, or the first column.
+ * - `spec` is `[0][width][.precision]`. The element is right-aligned to `width` characters with
+ *   spaces, or with zeros after the sign for numeric elements when `width` starts with `0`.
+ *   `precision` is the number of digits after the decimal point of floating-point elements.
+ *
+ * The literal braces are written `{{` and `}}`.
+ *
+ * The elements are written as follows:
+ * - strings as they are,
+ * - booleans as `true` or `false`,
+ * - integers in base 10,
+ * - floating-point values like `from_floats`, or in fixed notation with `precision` digits
+ *   after the decimal point (the values too large for it are written like `from_floats`),
+ * - `TIMESTAMP_DAYS` as `YYYY-MM-DD` and the other timestamps as `YYYY-MM-DD hh:mm:ss`,
+ *   followed by a fraction of the second for units below seconds.
+ *
+ * Every output row is sized and then written in place, so no intermediate strings column is
+ * created for the converted elements.
+ *
+ * Any row with a null element in a column used by the pattern is null unless `narep` is valid,
+ * in which case `narep` is written in place of the null element.
+ *
+ * @code{.pseudo}
+ * Example:
+ * id    = [7, 42, 1000]
+ * date  = [2021-03-04, 2021-12-25, null]
+ * value = [3.14159, -2.5, 10.0]
+ * r1 = format("{:04}-{}:{:.2}", [id, date, value])
+ * r1 is ['0007-2021-03-04:3.14', '0042-2021-12-25:-2.50', null]
+ * r2 = format("{2:.1}|{0:6}", [id, date, value], "?")
+ * r2 is ['3.1|     7', '-2.5|    42', '10.0|  1000']
+ * @endcode
+ *
+ * @throw cudf::logic_error if the pattern is not valid or a placeholder has no column.
+ * @throw cudf::logic_error if a column used by the pattern is not a strings, boolean, integer,
+ * floating-point or timestamp column.
+ * @throw cudf::logic_error if a precision is given for a column that is not floating-point or is
+ * larger than 18.
+ *
+ * @param pattern Text of every output row, with the placeholders of the elements.
+ * @param input Columns of the elements to format.
+ * @param narep String that should be used in place of any null element of the columns used by
+ *        the pattern. Default of invalid-scalar means any null element produces a null result
+ *        for its row.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column with a formatted string for each row of `input`.
+ */
+std::unique_ptr<column> format(
+  std::string const& pattern,
+  table_view const& input,
+  string_scalar const& narep          = string_scalar("", false),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
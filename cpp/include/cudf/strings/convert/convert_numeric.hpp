@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_convert
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns new numeric columns by parsing each strings column into the corresponding
+ * output type, with null entries where the parsing fails.
+ *
+ * This is the equivalent of calling `is_integer` or `is_float` and then `to_integers`
+ * or `to_floats` on each column, but each string is validated and converted in the same pass
+ * and all the columns are processed together.
+ *
+ * An output row is null if the input row is null or if its string is not a valid value of the
+ * output type:
+ * - An integer type accepts the strings for which `is_integer(strings, output_type)` is true,
+ *   so the value must also fit within the type.
+ * - A float type accepts the strings for which `is_float` is true.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s1 = ['123', '-456', '', 'A', '300']
+ * s2 = ['1.5', 'NaN', '2e3', '-', null]
+ * r = parse_numeric([s1, s2], [INT8, FLOAT64])
+ * r[0] is [123, null, null, null, null]
+ * r[1] is [1.5, NaN, 2000.0, null, null]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `strings` and `output_types` do not have the same size
+ * @throw cudf::logic_error if an output type is not an integer or float type.
+ * @throw cudf::logic_error if the total number of rows exceeds the size_type range.
+ *
+ * @param strings Strings columns to parse.
+ * @param output_types Numeric type of the output column of each strings column.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @return New numeric columns, one per strings column.
+ */
+std::vector<std::unique_ptr<column>> parse_numeric(
+  std::vector<strings_column_view> const& strings,
+  std::vector<data_type> const& output_types,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+
+#include <thrust/extrema.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Returns the lowercase of a byte of an ASCII uppercase letter, else the byte.
+ *
+ * The bytes of the multi-byte UTF-8 characters are all above the ASCII range, so folding every
+ * byte of a string keeps its size and the order of its characters.
+ */
+__device__ inline uint32_t fold_ascii_case(uint8_t byte)
+{
+  return (byte >= 'A' and byte <= 'Z') ? byte + ('a' - 'A') : byte;
+}
+
+/**
+ * @brief Compares two strings as if their ASCII letters were lowercase, like
+ * `string_view::compare`.
+ *
+ * @return Negative if `lhs` precedes `rhs`, positive if it follows it, else 0
+ */
+__device__ inline int case_folded_compare(string_view const& lhs, string_view const& rhs)
+{
+  auto const lhs_bytes = reinterpret_cast<uint8_t const*>(lhs.data());
+  auto const rhs_bytes = reinterpret_cast<uint8_t const*>(rhs.data());
+  auto const size      = thrust::min(lhs.size_bytes(), rhs.size_bytes());
+  for (size_type i = 0; i < size; ++i) {
+    auto const l = fold_ascii_case(lhs_bytes[i]);
+    auto const r = fold_ascii_case(rhs_bytes[i]);
+    if (l != r) { return static_cast<int32_t>(l) - static_cast<int32_t>(r); }
+  }
+  return (lhs.size_bytes() > size) - (rhs.size_bytes() > size);
+}
+
+/**
+ * @brief Returns whether two strings are equal when their ASCII letters are lowercase.
+ */
+__device__ inline bool case_folded_equal(string_view const& lhs, string_view const& rhs)
+{
+  return lhs.size_bytes() == rhs.size_bytes() and case_folded_compare(lhs, rhs) == 0;
+}
+
+/**
+ * @brief Computes the MurmurHash3_32 hash value of a string whose ASCII letters are lowercase,
+ * without copying it.
+ *
+ * The hash value is the one of `MurmurHash3_32<string_view>` for the lowercase string.
+ */
+__device__ inline hash_value_type case_folded_hash(string_view const& key,
+                                                   uint32_t seed = DEFAULT_HASH_SEED)
+{
+  MurmurHash3_32<uint32_t> const murmur{};
+  auto const len        = key.size_bytes();
+  auto const data       = reinterpret_cast<uint8_t const*>(key.data());
+  int const nblocks     = len / 4;
+  hash_value_type h1    = seed;
+  constexpr uint32_t c1 = 0xcc9e2d51;
+  constexpr uint32_t c2 = 0x1b873593;
+  auto mix              = [&](uint32_t k1) {
+    k1 *= c1;
+    k1 = murmur.rotl32(k1, 15);
+    return k1 * c2;
+  };
+
+  //----------
+  // body
+  for (int i = 0; i < nblocks; ++i) {
+    auto const q      = data + i * 4;
+    uint32_t const k1 = fold_ascii_case(q[0]) | (fold_ascii_case(q[1]) << 8) |
+                        (fold_ascii_case(q[2]) << 16) | (fold_ascii_case(q[3]) << 24);
+    h1 ^= mix(k1);
+    h1 = murmur.rotl32(h1, 13);
+    h1 = h1 * 5 + 0xe6546b64;
+  }
+  //----------
+  // tail
+  auto const tail = data + nblocks * 4;
+  uint32_t k1     = 0;
+  switch (len & 3) {
+    case 3: k1 ^= fold_ascii_case(tail[2]) << 16;
+    case 2: k1 ^= fold_ascii_case(tail[1]) << 8;
+    case 1: h1 ^= mix(k1 ^ fold_ascii_case(tail[0]));
+  };
+  //----------
+  // finalization
+  h1 ^= len;
+  return murmur.fmix32(h1);
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
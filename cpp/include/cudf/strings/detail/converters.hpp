@@ -21,6 +21,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -151,6 +153,18 @@ std::unique_ptr<column> from_fixed_point(column_view const& integers,
                                          rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc parse_numeric(std::vector<strings_column_view> const&,std::vector<data_type> const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> parse_numeric(
+  std::vector<strings_column_view> const& strings,
+  std::vector<data_type> const& output_types,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
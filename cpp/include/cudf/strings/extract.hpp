@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 
@@ -55,6 +56,24 @@ std::unique_ptr<table> extract(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a vector of strings columns for each matching group of the given compiled
+ * regex program.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @throws cudf::logic_error if the pattern of `prog` has no groups
+ *
+ * @param strings Strings instance for this operation.
+ * @param prog The regex program with group indicators.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Columns of strings extracted from the input column.
+ */
+std::unique_ptr<table> extract(
+  strings_column_view const& strings,
+  regex_program const& prog,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
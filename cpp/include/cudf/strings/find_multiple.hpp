@@ -54,6 +54,60 @@ std::unique_ptr<column> find_multiple(
   strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a lists column of the indices of the keywords found in each string.
+ *
+ * Output row i holds the indices of the distinct keywords that occur in string i, in ascending
+ * order. The keywords are found by an Aho-Corasick automaton, which scans each string once
+ * whatever the number of keywords.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["the cat","a theme","dog"]
+ * k = ["the","cat","he"]
+ * r = find_keywords(s,k)
+ * r is now [[0,1,2],[0,2],[]]
+ * @endcode
+ *
+ * @throw cudf::logic_error if keywords is empty, or contains nulls or empty strings
+ *
+ * @param strings Strings instance for this operation.
+ * @param keywords Strings to search for in each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of INT32 keyword indices.
+ */
+std::unique_ptr<column> find_keywords(
+  strings_column_view const& strings,
+  strings_column_view const& keywords,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the number of distinct keywords found in each string.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["the cat","a theme","dog"]
+ * k = ["the","cat","he"]
+ * r = count_keywords(s,k)
+ * r is now [3,2,0]
+ * @endcode
+ *
+ * @throw cudf::logic_error if keywords is empty, or contains nulls or empty strings
+ *
+ * @param strings Strings instance for this operation.
+ * @param keywords Strings to search for in each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of keyword counts.
+ */
+std::unique_ptr<column> count_keywords(
+  strings_column_view const& strings,
+  strings_column_view const& keywords,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
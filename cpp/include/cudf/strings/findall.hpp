@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 
@@ -57,6 +58,22 @@ std::unique_ptr<table> findall_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a table of strings columns for each matching occurrence of the
+ * compiled regex program within each string.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @param strings Strings instance for this operation.
+ * @param prog Regex program to match within each string.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table of strings columns.
+ */
+std::unique_ptr<table> findall_re(
+  strings_column_view const& strings,
+  regex_program const& prog,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
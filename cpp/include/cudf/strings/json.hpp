@@ -17,6 +17,9 @@
 
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 
@@ -45,6 +48,27 @@ std::unique_ptr<cudf::column> get_json_object(
   cudf::string_scalar const& json_path,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Apply several JSONPath strings to all rows in an input strings column.
+ *
+ * Returns the same columns as calling `get_json_object` with each JSONPath string. The paths
+ * selecting a single element by name or index at each level, like `$.store.book[0].title`, are
+ * evaluated together, in a single pass over the json strings in which each element they go
+ * through is parsed once. The other paths are evaluated one by one.
+ *
+ * @throws cudf::logic_error if any JSONPath string is invalid or too complex
+ *
+ * @param col The input strings column. Each row must contain a valid json string
+ * @param json_paths The JSONPath strings to be applied to each row
+ * @param mr Resource for allocating device memory.
+ * @return New strings columns containing the retrieved json object strings, one per JSONPath
+ * string
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_objects(
+  cudf::strings_column_view const& col,
+  std::vector<std::string> const& json_paths,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_contains
+ * @{
+ * @file
+ * @brief Compiled regex program reusable by the strings regex APIs
+ */
+
+/**
+ * @brief A regex pattern compiled once and reused by the regex APIs.
+ *
+ * The APIs accepting a `std::string` pattern compile it at every call. A `regex_program` is
+ * compiled when it is created, and the device copy of its instructions is made at its first use
+ * by an API and kept until the `regex_program` is destroyed, so applying the same pattern to
+ * many columns only pays for them once.
+ *
+ * The compiled instructions are also kept in a cache of the most recently used patterns, which
+ * the APIs accepting a `std::string` pattern share.
+ *
+ * A `regex_program` can be used concurrently by several threads.
+ *
+ * @code{.pseudo}
+ * Example:
+ * prog = regex_program::create("\\d+")
+ * for s in batches:
+ *   r = contains_re(s, *prog)
+ * @endcode
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported by this class.
+ */
+struct regex_program {
+  struct regex_program_impl;
+
+  /**
+   * @brief Compiles a regex pattern.
+   *
+   * @throws cudf::logic_error if the pattern is invalid
+   *
+   * @param pattern Regex pattern to compile.
+   * @return The compiled program.
+   */
+  static std::unique_ptr<regex_program> create(std::string const& pattern);
+
+  regex_program()                     = delete;
+  regex_program(regex_program const&) = delete;
+  regex_program& operator=(regex_program const&) = delete;
+  ~regex_program();
+
+  /**
+   * @brief Returns the pattern the program was compiled from.
+   */
+  std::string const& pattern() const noexcept { return _pattern; }
+
+  /**
+   * @brief Returns the number of instructions of the compiled program.
+   */
+  int32_t instructions_count() const;
+
+  /**
+   * @brief Returns the number of capturing groups of the pattern.
+   */
+  int32_t groups_count() const;
+
+  /**
+   * @brief Returns the compiled data used by the implementation of the regex APIs.
+   */
+  regex_program_impl* get_impl() const noexcept { return _impl.get(); }
+
+ private:
+  std::string _pattern;
+  std::unique_ptr<regex_program_impl> _impl;
+
+  explicit regex_program(std::string const& pattern);
+};
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
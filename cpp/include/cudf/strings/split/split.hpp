@@ -232,6 +232,44 @@ std::unique_ptr<column> rsplit_record(
   size_type maxsplit                  = -1,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Splits individual strings elements into a table of the tokens, one token per row,
+ * and of the row of the string each token comes from.
+ *
+ * The tokens are the strings `split_record` produces, in the same order, and the result is
+ * the same as exploding its lists column, without creating the lists column.
+ *
+ * @code{.pseudo}
+ * s = ["a_bc_def", null, "g", "_h"]
+ * t = split_explode(s, "_")
+ * t is a table of a column of rows and a column of strings:
+ *     [ [0, 0, 0, 2, 3, 3],
+ *       ["a", "bc", "def", "g", "", "h"] ]
+ * t = split_explode(s, "_", 1)
+ * t is a table of a column of rows and a column of strings:
+ *     [ [0, 0, 2, 3, 3],
+ *       ["a", "bc_def", "g", "", "h"] ]
+ * @endcode
+ *
+ * A null string element produces no rows.
+ *
+ * @throw cudf:logic_error if `delimiter` is invalid.
+ *
+ * @param strings A column of string elements to be splitted.
+ * @param delimiter The string to identify split points in each string.
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform.
+ *        Default of -1 indicates all possible splits on each string.
+ * @param mr Device memory resource used to allocate the returned result's device memory.
+ * @return Table of a column of the `size_type` row of each token in `strings`, and of a
+ *         strings column of the tokens.
+ */
+std::unique_ptr<table> split_explode(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -21,6 +21,8 @@
 
 #include <thrust/count.h>
 #include <thrust/find.h>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 
 // This file should only include device code logic.
@@ -40,9 +42,24 @@ namespace detail {
 __device__ inline size_type characters_in_string(const char* str, size_type bytes)
 {
   if ((str == 0) || (bytes == 0)) return 0;
-  auto ptr = reinterpret_cast<uint8_t const*>(str);
-  return thrust::count_if(
-    thrust::seq, ptr, ptr + bytes, [](uint8_t chr) { return is_begin_utf8_char(chr); });
+  constexpr auto word_size = static_cast<std::ptrdiff_t>(sizeof(uint32_t));
+  auto ptr                 = reinterpret_cast<uint8_t const*>(str);
+  auto const end           = ptr + bytes;
+  size_type chars          = 0;
+  // count the bytes before the first 4-byte boundary individually
+  while ((ptr < end) && (reinterpret_cast<std::uintptr_t>(ptr) % word_size != 0)) {
+    chars += is_begin_utf8_char(*ptr++);
+  }
+  // then 4 bytes at a time, where only the continuation bytes 10xxxxxx don't begin a character:
+  // only their high bits remain in `word & ~(word << 1) & 0x80808080`
+  for (; end - ptr >= word_size; ptr += word_size) {
+    auto const word = *reinterpret_cast<uint32_t const*>(ptr);
+    chars += static_cast<size_type>(word_size) - __popc(word & ~(word << 1) & 0x80808080u);
+  }
+  while (ptr < end) {
+    chars += is_begin_utf8_char(*ptr++);
+  }
+  return chars;
 }
 
 /**
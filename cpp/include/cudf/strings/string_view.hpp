@@ -320,6 +320,21 @@ class string_view {
   {
   }
 
+  /**
+   * @brief Create instance from existing device char array with a known number of characters.
+   *
+   * The character positions of a string whose length is its number of bytes, such as an ASCII
+   * string, are used as byte positions without decoding the characters.
+   *
+   * @param data Device char array encoded in UTF8.
+   * @param bytes Number of bytes in data array.
+   * @param length Number of characters in data array.
+   */
+  CUDA_HOST_DEVICE_CALLABLE string_view(const char* data, size_type bytes, size_type length)
+    : _data(data), _bytes(bytes), _length(length)
+  {
+  }
+
   string_view(const string_view&) = default;
   string_view(string_view&&)      = default;
   ~string_view()                  = default;
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <vector>
+
+/**
+ * @file
+ * @brief Class definitions for `chunked_column_view` and `chunked_table_view`
+ *
+ * A `chunked_(column|table)_view` is a sequence of `(column|table)_view`s, the chunks, whose rows
+ * are the rows of a single column or table, like the outputs of a chunked reader. The chunks are
+ * not copied, and the operations that accept chunked views only materialize the rows they need.
+ *
+ * A `chunked_(column|table)_view` is non-owning.
+ */
+
+namespace cudf {
+
+/**
+ * @brief A sequence of `column_view`s of the same type, seen as a single column.
+ *
+ * @ingroup column_classes
+ */
+class chunked_column_view {
+ public:
+  using const_iterator = std::vector<column_view>::const_iterator;
+
+  /**
+   * @brief Construct a chunked column from its chunks.
+   *
+   * @throws cudf::logic_error if `chunks` is empty
+   * @throws cudf::logic_error if the chunks are not all of the same type
+   * @throws cudf::logic_error if the total number of rows exceeds the size_type range
+   *
+   * @param chunks The chunks of the column, in order
+   */
+  explicit chunked_column_view(std::vector<column_view> const& chunks);
+
+  /**
+   * @brief Returns the element type of the column
+   */
+  data_type type() const noexcept { return _chunks.front().type(); }
+
+  /**
+   * @brief Returns the number of elements of all the chunks
+   */
+  size_type size() const noexcept { return _offsets.back(); }
+
+  /**
+   * @brief Returns the number of null elements of all the chunks
+   */
+  size_type null_count() const;
+
+  /**
+   * @brief Indicates whether any chunk contains null elements
+   */
+  bool has_nulls() const { return null_count() > 0; }
+
+  /**
+   * @brief Returns the number of chunks
+   */
+  size_type num_chunks() const noexcept { return _chunks.size(); }
+
+  /**
+   * @brief Returns the chunk at `chunk_index`
+   *
+   * @throws std::out_of_range if `chunk_index` is outside [0, num_chunks())
+   */
+  column_view const& chunk(size_type chunk_index) const { return _chunks.at(chunk_index); }
+
+  /**
+   * @brief Returns the `num_chunks() + 1` offsets of the first row of each chunk, followed by
+   * `size()`
+   */
+  std::vector<size_type> const& chunk_offsets() const noexcept { return _offsets; }
+
+  /**
+   * @brief Returns an iterator to the first chunk
+   */
+  const_iterator begin() const noexcept { return _chunks.begin(); }
+
+  /**
+   * @brief Returns an iterator one past the last chunk
+   */
+  const_iterator end() const noexcept { return _chunks.end(); }
+
+ private:
+  std::vector<column_view> _chunks;
+  std::vector<size_type> _offsets;  ///< Offsets of the first row of each chunk, and the size
+};
+
+/**
+ * @brief A sequence of `table_view`s with columns of the same types, seen as a single table.
+ *
+ * @ingroup table_classes
+ */
+class chunked_table_view {
+ public:
+  using const_iterator = std::vector<table_view>::const_iterator;
+
+  /**
+   * @brief Construct a chunked table from its chunks.
+   *
+   * @throws cudf::logic_error if `chunks` is empty
+   * @throws cudf::logic_error if the chunks don't have columns of the same types
+   * @throws cudf::logic_error if the total number of rows exceeds the size_type range
+   *
+   * @param chunks The chunks of the table, in order
+   */
+  explicit chunked_table_view(std::vector<table_view> const& chunks);
+
+  /**
+   * @brief Returns the number of columns
+   */
+  size_type num_columns() const noexcept { return _chunks.front().num_columns(); }
+
+  /**
+   * @brief Returns the number of rows of all the chunks
+   */
+  size_type num_rows() const noexcept { return _offsets.back(); }
+
+  /**
+   * @brief Returns the number of chunks
+   */
+  size_type num_chunks() const noexcept { return _chunks.size(); }
+
+  /**
+   * @brief Returns the chunk at `chunk_index`
+   *
+   * @throws std::out_of_range if `chunk_index` is outside [0, num_chunks())
+   */
+  table_view const& chunk(size_type chunk_index) const { return _chunks.at(chunk_index); }
+
+  /**
+   * @brief Returns the `num_chunks() + 1` offsets of the first row of each chunk, followed by
+   * `num_rows()`
+   */
+  std::vector<size_type> const& chunk_offsets() const noexcept { return _offsets; }
+
+  /**
+   * @brief Returns the chunked view of the column at `column_index`
+   *
+   * @throws std::out_of_range if `column_index` is outside [0, num_columns())
+   */
+  chunked_column_view column(size_type column_index) const;
+
+  /**
+   * @brief Returns an iterator to the first chunk
+   */
+  const_iterator begin() const noexcept { return _chunks.begin(); }
+
+  /**
+   * @brief Returns an iterator one past the last chunk
+   */
+  const_iterator end() const noexcept { return _chunks.end(); }
+
+ private:
+  std::vector<table_view> _chunks;
+  std::vector<size_type> _offsets;  ///< Offsets of the first row of each chunk, and the size
+};
+
+}  // namespace cudf
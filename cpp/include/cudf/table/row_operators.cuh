@@ -19,12 +19,16 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/strings/detail/case_folding.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <thrust/equal.h>
+#include <thrust/extrema.h>
+#include <thrust/pair.h>
 #include <thrust/swap.h>
 #include <thrust/transform_reduce.h>
 
@@ -65,6 +69,24 @@ __device__ weak_ordering compare_elements(Element lhs, Element rhs)
   }
   return weak_ordering::EQUIVALENT;
 }
+
+/**
+ * @brief Returns the range of the rows of the child column that hold the elements of a list.
+ *
+ * The offsets of a lists column are not sliced with their parent, so the offset of the parent is
+ * applied to the row index.
+ *
+ * @param lists The lists column
+ * @param index The index of the list in `lists`
+ * @return The first and one past the last row of the list in the child column of `lists`
+ */
+inline __device__ thrust::pair<size_type, size_type> list_child_range(
+  column_device_view const& lists, size_type index)
+{
+  auto const offsets = lists.child(lists_column_view::offsets_column_index);
+  auto const row     = lists.offset() + index;
+  return {offsets.element<size_type>(row), offsets.element<size_type>(row + 1)};
+}
 }  // namespace detail
 
 /*
@@ -174,11 +196,14 @@ class element_equality_comparator {
    * @param lhs The column containing the first element
    * @param rhs The column containing the second element (may be the same as lhs)
    * @param nulls_are_equal Indicates if two null elements are treated as equivalent
+   * @param fold_case Indicates if strings are compared regardless of the case of their ASCII
+   * letters
    */
   __host__ __device__ element_equality_comparator(column_device_view lhs,
                                                   column_device_view rhs,
-                                                  bool nulls_are_equal = true)
-    : lhs{lhs}, rhs{rhs}, nulls_are_equal{nulls_are_equal}
+                                                  bool nulls_are_equal = true,
+                                                  bool fold_case       = false)
+    : lhs{lhs}, rhs{rhs}, nulls_are_equal{nulls_are_equal}, fold_case{fold_case}
   {
   }
 
@@ -204,12 +229,101 @@ class element_equality_comparator {
       }
     }
 
+    if constexpr (std::is_same_v<Element, string_view>) {
+      if (fold_case) {
+        return strings::detail::case_folded_equal(lhs.element<Element>(lhs_element_index),
+                                                  rhs.element<Element>(rhs_element_index));
+      }
+    }
     return equality_compare(lhs.element<Element>(lhs_element_index),
                             rhs.element<Element>(rhs_element_index));
   }
 
+  /**
+   * @brief Compares the specified struct elements for equality, child by child.
+   *
+   * Two null structs are equal if `nulls_are_equal`, and their children are not compared.
+   *
+   * @param lhs_element_index The index of the first element
+   * @param rhs_element_index The index of the second element
+   */
+  template <typename Element,
+            std::enable_if_t<std::is_same<Element, struct_view>::value>* = nullptr>
+  __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index) const
+    noexcept
+  {
+    if (has_nulls) {
+      bool const lhs_is_null{lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.is_null(rhs_element_index)};
+      if (lhs_is_null and rhs_is_null) {
+        return nulls_are_equal;
+      } else if (lhs_is_null != rhs_is_null) {
+        return false;
+      }
+    }
+
+    // The children of a struct column are not sliced with their parent
+    auto const lhs_child_index = lhs.offset() + lhs_element_index;
+    auto const rhs_child_index = rhs.offset() + rhs_element_index;
+    for (size_type i = 0; i < lhs.num_child_columns(); ++i) {
+      auto const lhs_child = lhs.child(i);
+      auto const rhs_child = rhs.child(i);
+      if (not cudf::type_dispatcher(
+            lhs_child.type(),
+            element_equality_comparator<has_nulls>{
+              lhs_child, rhs_child, nulls_are_equal, fold_case},
+            lhs_child_index,
+            rhs_child_index)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Compares the specified list elements for equality, element by element.
+   *
+   * Two lists are equal if they have the same size and equal elements. Two null lists are equal
+   * if `nulls_are_equal`.
+   *
+   * @param lhs_element_index The index of the first element
+   * @param rhs_element_index The index of the second element
+   */
+  template <typename Element, std::enable_if_t<std::is_same<Element, list_view>::value>* = nullptr>
+  __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index) const
+    noexcept
+  {
+    if (has_nulls) {
+      bool const lhs_is_null{lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.is_null(rhs_element_index)};
+      if (lhs_is_null and rhs_is_null) {
+        return nulls_are_equal;
+      } else if (lhs_is_null != rhs_is_null) {
+        return false;
+      }
+    }
+
+    auto const lhs_range = detail::list_child_range(lhs, lhs_element_index);
+    auto const rhs_range = detail::list_child_range(rhs, rhs_element_index);
+    auto const size      = lhs_range.second - lhs_range.first;
+    if (size != rhs_range.second - rhs_range.first) { return false; }
+
+    auto const lhs_child = lhs.child(lists_column_view::child_column_index);
+    auto const rhs_child = rhs.child(lists_column_view::child_column_index);
+    auto const comparator =
+      element_equality_comparator<has_nulls>{lhs_child, rhs_child, nulls_are_equal, fold_case};
+    for (size_type i = 0; i < size; ++i) {
+      if (not cudf::type_dispatcher(
+            lhs_child.type(), comparator, lhs_range.first + i, rhs_range.first + i)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   template <typename Element,
-            std::enable_if_t<not cudf::is_equality_comparable<Element, Element>()>* = nullptr>
+            std::enable_if_t<not cudf::is_equality_comparable<Element, Element>() and
+                             not cudf::is_nested<Element>()>* = nullptr>
   __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index)
   {
     cudf_assert(false && "Attempted to compare elements of uncomparable types.");
@@ -220,33 +334,50 @@ class element_equality_comparator {
   column_device_view lhs;
   column_device_view rhs;
   bool nulls_are_equal;
+  bool fold_case;
 };
 
 template <bool has_nulls = true>
 class row_equality_comparator {
  public:
-  row_equality_comparator(table_device_view lhs, table_device_view rhs, bool nulls_are_equal = true)
-    : lhs{lhs}, rhs{rhs}, nulls_are_equal{nulls_are_equal}
+  /**
+   * @brief Construct a function object for comparing the rows of two tables for equality.
+   *
+   * @param lhs The first table
+   * @param rhs The second table (may be the same table as `lhs`)
+   * @param nulls_are_equal Indicates if two null elements are treated as equivalent
+   * @param key_case Optional, device array the same length as a row that indicates whether the
+   * strings of each column compare regardless of the case of their ASCII letters. If `nullptr`,
+   * all columns are case-sensitive.
+   */
+  row_equality_comparator(table_device_view lhs,
+                          table_device_view rhs,
+                          bool nulls_are_equal             = true,
+                          case_sensitivity const* key_case = nullptr)
+    : lhs{lhs}, rhs{rhs}, nulls_are_equal{nulls_are_equal}, key_case{key_case}
   {
     CUDF_EXPECTS(lhs.num_columns() == rhs.num_columns(), "Mismatched number of columns.");
   }
 
   __device__ bool operator()(size_type lhs_row_index, size_type rhs_row_index) const noexcept
   {
-    auto equal_elements = [=](column_device_view l, column_device_view r) {
-      return cudf::type_dispatcher(l.type(),
-                                   element_equality_comparator<has_nulls>{l, r, nulls_are_equal},
-                                   lhs_row_index,
-                                   rhs_row_index);
-    };
-
-    return thrust::equal(thrust::seq, lhs.begin(), lhs.end(), rhs.begin(), equal_elements);
+    for (size_type i = 0; i < lhs.num_columns(); ++i) {
+      bool const fold_case  = key_case != nullptr and key_case[i] == case_sensitivity::INSENSITIVE;
+      auto const comparator = element_equality_comparator<has_nulls>{
+        lhs.column(i), rhs.column(i), nulls_are_equal, fold_case};
+      if (not cudf::type_dispatcher(
+            lhs.column(i).type(), comparator, lhs_row_index, rhs_row_index)) {
+        return false;
+      }
+    }
+    return true;
   }
 
  private:
   table_device_view lhs;
   table_device_view rhs;
   bool nulls_are_equal;
+  case_sensitivity const* key_case{};
 };
 
 /**
@@ -267,11 +398,14 @@ class element_relational_comparator {
    * @param rhs The column containing the second element (may be the same as lhs)
    * @param null_precedence Indicates how null values are ordered with other
    * values
+   * @param fold_case Indicates if strings are compared regardless of the case of their ASCII
+   * letters
    */
   __host__ __device__ element_relational_comparator(column_device_view lhs,
                                                     column_device_view rhs,
-                                                    null_order null_precedence)
-    : lhs{lhs}, rhs{rhs}, null_precedence{null_precedence}
+                                                    null_order null_precedence,
+                                                    bool fold_case = false)
+    : lhs{lhs}, rhs{rhs}, null_precedence{null_precedence}, fold_case{fold_case}
   {
   }
 
@@ -299,12 +433,105 @@ class element_relational_comparator {
       }
     }
 
+    if constexpr (std::is_same_v<Element, string_view>) {
+      if (fold_case) {
+        return detail::compare_elements(
+          strings::detail::case_folded_compare(lhs.element<Element>(lhs_element_index),
+                                               rhs.element<Element>(rhs_element_index)),
+          0);
+      }
+    }
     return relational_compare(lhs.element<Element>(lhs_element_index),
                               rhs.element<Element>(rhs_element_index));
   }
 
+  /**
+   * @brief Performs a lexicographic comparison between the children of the specified struct
+   * elements
+   *
+   * A null struct is ordered by `null_precedence`, and the null precedence also applies to the
+   * children of the structs.
+   *
+   * @param lhs_element_index The index of the first element
+   * @param rhs_element_index The index of the second element
+   * @return weak_ordering Indicates the relationship between the elements in
+   * the `lhs` and `rhs` columns.
+   */
   template <typename Element,
-            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>()>* = nullptr>
+            std::enable_if_t<std::is_same<Element, struct_view>::value>* = nullptr>
+  __device__ weak_ordering operator()(size_type lhs_element_index,
+                                      size_type rhs_element_index) const noexcept
+  {
+    if (has_nulls) {
+      bool const lhs_is_null{lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.is_null(rhs_element_index)};
+
+      if (lhs_is_null or rhs_is_null) {  // atleast one is null
+        return null_compare(lhs_is_null, rhs_is_null, null_precedence);
+      }
+    }
+
+    // The children of a struct column are not sliced with their parent
+    auto const lhs_child_index = lhs.offset() + lhs_element_index;
+    auto const rhs_child_index = rhs.offset() + rhs_element_index;
+    for (size_type i = 0; i < lhs.num_child_columns(); ++i) {
+      auto const lhs_child = lhs.child(i);
+      auto const rhs_child = rhs.child(i);
+      auto const state     = cudf::type_dispatcher(
+        lhs_child.type(),
+        element_relational_comparator<has_nulls>{
+          lhs_child, rhs_child, null_precedence, fold_case},
+        lhs_child_index,
+        rhs_child_index);
+      if (state != weak_ordering::EQUIVALENT) { return state; }
+    }
+    return weak_ordering::EQUIVALENT;
+  }
+
+  /**
+   * @brief Performs a lexicographic comparison between the elements of the specified lists
+   *
+   * A list which is a prefix of the other is ordered before it. A null list is ordered by
+   * `null_precedence`, and the null precedence also applies to the elements of the lists.
+   *
+   * @param lhs_element_index The index of the first element
+   * @param rhs_element_index The index of the second element
+   * @return weak_ordering Indicates the relationship between the elements in
+   * the `lhs` and `rhs` columns.
+   */
+  template <typename Element, std::enable_if_t<std::is_same<Element, list_view>::value>* = nullptr>
+  __device__ weak_ordering operator()(size_type lhs_element_index,
+                                      size_type rhs_element_index) const noexcept
+  {
+    if (has_nulls) {
+      bool const lhs_is_null{lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.is_null(rhs_element_index)};
+
+      if (lhs_is_null or rhs_is_null) {  // atleast one is null
+        return null_compare(lhs_is_null, rhs_is_null, null_precedence);
+      }
+    }
+
+    auto const lhs_range = detail::list_child_range(lhs, lhs_element_index);
+    auto const rhs_range = detail::list_child_range(rhs, rhs_element_index);
+    auto const lhs_size  = lhs_range.second - lhs_range.first;
+    auto const rhs_size  = rhs_range.second - rhs_range.first;
+
+    auto const lhs_child = lhs.child(lists_column_view::child_column_index);
+    auto const rhs_child = rhs.child(lists_column_view::child_column_index);
+    auto const comparator =
+      element_relational_comparator<has_nulls>{lhs_child, rhs_child, null_precedence, fold_case};
+    for (size_type i = 0; i < thrust::min(lhs_size, rhs_size); ++i) {
+      auto const state = cudf::type_dispatcher(
+        lhs_child.type(), comparator, lhs_range.first + i, rhs_range.first + i);
+      if (state != weak_ordering::EQUIVALENT) { return state; }
+    }
+    return detail::compare_elements(lhs_size, rhs_size);
+  }
+
+  template <typename Element,
+            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>() and
+                             not cudf::is_nested<Element>()>* = nullptr>
   __device__ weak_ordering operator()(size_type lhs_element_index, size_type rhs_element_index)
   {
     cudf_assert(false && "Attempted to compare elements of uncomparable types.");
@@ -315,6 +542,7 @@ class element_relational_comparator {
   column_device_view lhs;
   column_device_view rhs;
   null_order null_precedence;
+  bool fold_case;
 };
 
 /**
@@ -351,12 +579,20 @@ class row_lexicographic_comparator {
    * and indicates how null values compare to all other for every column. If
    * it is nullptr, then null precedence would be `null_order::BEFORE` for all
    * columns.
+   * @param key_case Optional, device array the same length as a row that indicates whether the
+   * strings of each column compare regardless of the case of their ASCII letters. If `nullptr`,
+   * all columns are case-sensitive.
    */
   row_lexicographic_comparator(table_device_view lhs,
                                table_device_view rhs,
                                order const* column_order         = nullptr,
-                               null_order const* null_precedence = nullptr)
-    : _lhs{lhs}, _rhs{rhs}, _column_order{column_order}, _null_precedence{null_precedence}
+                               null_order const* null_precedence = nullptr,
+                               case_sensitivity const* key_case  = nullptr)
+    : _lhs{lhs},
+      _rhs{rhs},
+      _column_order{column_order},
+      _null_precedence{null_precedence},
+      _key_case{key_case}
   {
     CUDF_EXPECTS(_lhs.num_columns() == _rhs.num_columns(), "Mismatched number of columns.");
     CUDF_EXPECTS(detail::is_relationally_comparable(_lhs, _rhs),
@@ -381,8 +617,10 @@ class row_lexicographic_comparator {
       null_order null_precedence =
         _null_precedence == nullptr ? null_order::BEFORE : _null_precedence[i];
 
-      auto comparator =
-        element_relational_comparator<has_nulls>{_lhs.column(i), _rhs.column(i), null_precedence};
+      bool const fold_case = _key_case != nullptr and _key_case[i] == case_sensitivity::INSENSITIVE;
+
+      auto comparator = element_relational_comparator<has_nulls>{
+        _lhs.column(i), _rhs.column(i), null_precedence, fold_case};
 
       state = cudf::type_dispatcher(_lhs.column(i).type(), comparator, lhs_index, rhs_index);
 
@@ -398,6 +636,7 @@ class row_lexicographic_comparator {
   table_device_view _rhs;
   null_order const* _null_precedence{};
   order const* _column_order{};
+  case_sensitivity const* _key_case{};
 };  // class row_lexicographic_comparator
 
 /**
@@ -409,19 +648,73 @@ class row_lexicographic_comparator {
 template <template <typename> class hash_function, bool has_nulls = true>
 class element_hasher {
  public:
+  element_hasher() = default;
+
+  /**
+   * @brief Constructs a hasher of elements whose strings are hashed regardless of the case of
+   * their ASCII letters if `fold_case`.
+   *
+   * The strings are then hashed with `MurmurHash3_32`, whatever the `hash_function`.
+   */
+  __device__ element_hasher(bool fold_case) : _fold_case{fold_case} {}
+
   template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
   __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
   {
     if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
+    if constexpr (std::is_same_v<T, string_view>) {
+      if (_fold_case) { return strings::detail::case_folded_hash(col.element<T>(row_index)); }
+    }
     return hash_function<T>{}(col.element<T>(row_index));
   }
 
-  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  /**
+   * @brief Combines the hash values of the children of a struct element.
+   */
+  template <typename T, CUDF_ENABLE_IF(std::is_same<T, struct_view>::value)>
+  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
+    // The children of a struct column are not sliced with their parent
+    auto const child_index = col.offset() + row_index;
+    hash_value_type hash{0};
+    for (size_type i = 0; i < col.num_child_columns(); ++i) {
+      auto const child = col.child(i);
+      hash             = hash_function<hash_value_type>{}.hash_combine(
+        hash, cudf::type_dispatcher(child.type(), *this, child, child_index));
+    }
+    return hash;
+  }
+
+  /**
+   * @brief Combines the hash values of the elements of a list element.
+   */
+  template <typename T, CUDF_ENABLE_IF(std::is_same<T, list_view>::value)>
+  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
+    auto const range = detail::list_child_range(col, row_index);
+    auto const child = col.child(lists_column_view::child_column_index);
+    // Starts from the hash of the size of the list
+    auto hash = hash_function<size_type>{}(range.second - range.first);
+    for (auto i = range.first; i < range.second; ++i) {
+      hash = hash_function<hash_value_type>{}.hash_combine(
+        hash, cudf::type_dispatcher(child.type(), *this, child, i));
+    }
+    return hash;
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>() and
+                           not cudf::is_nested<T>())>
   __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
   {
     cudf_assert(false && "Unsupported type in hash.");
     return {};
   }
+
+ private:
+  bool _fold_case{false};
 };
 
 template <template <typename> class hash_function, bool has_nulls = true>
@@ -433,15 +726,62 @@ class element_hasher_with_seed {
     : _seed{seed}, _null_hash(null_hash)
   {
   }
+  __device__ element_hasher_with_seed(uint32_t seed, hash_value_type null_hash, bool fold_case)
+    : _seed{seed}, _null_hash(null_hash), _fold_case{fold_case}
+  {
+  }
 
   template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
   __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
   {
     if (has_nulls && col.is_null(row_index)) { return _null_hash; }
+    if constexpr (std::is_same_v<T, string_view>) {
+      if (_fold_case) {
+        return strings::detail::case_folded_hash(col.element<T>(row_index), _seed);
+      }
+    }
     return hash_function<T>{_seed}(col.element<T>(row_index));
   }
 
-  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  /**
+   * @brief Combines the hash values of the children of a struct element, each hashed with the seed.
+   */
+  template <typename T, CUDF_ENABLE_IF(std::is_same<T, struct_view>::value)>
+  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return _null_hash; }
+    // The children of a struct column are not sliced with their parent
+    auto const child_index = col.offset() + row_index;
+    hash_value_type hash{0};
+    for (size_type i = 0; i < col.num_child_columns(); ++i) {
+      auto const child = col.child(i);
+      hash             = hash_function<hash_value_type>{}.hash_combine(
+        hash, cudf::type_dispatcher(child.type(), *this, child, child_index));
+    }
+    return hash;
+  }
+
+  /**
+   * @brief Combines the hash values of the elements of a list element, each hashed with the seed.
+   */
+  template <typename T, CUDF_ENABLE_IF(std::is_same<T, list_view>::value)>
+  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return _null_hash; }
+    auto const range = detail::list_child_range(col, row_index);
+    auto const child = col.child(lists_column_view::child_column_index);
+    // Starts from the hash of the size of the list
+    auto hash = hash_function<size_type>{_seed}(range.second - range.first);
+    for (auto i = range.first; i < range.second; ++i) {
+      hash = hash_function<hash_value_type>{}.hash_combine(
+        hash, cudf::type_dispatcher(child.type(), *this, child, i));
+    }
+    return hash;
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>() and
+                           not cudf::is_nested<T>())>
   __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
   {
     cudf_assert(false && "Unsupported type in hash.");
@@ -451,6 +791,7 @@ class element_hasher_with_seed {
  private:
   uint32_t _seed{DEFAULT_HASH_SEED};
   hash_value_type _null_hash{std::numeric_limits<hash_value_type>::max()};
+  bool _fold_case{false};
 };
 
 /**
@@ -466,26 +807,63 @@ class row_hasher {
   row_hasher(table_device_view t) : _table{t} {}
   row_hasher(table_device_view t, uint32_t seed) : _table{t}, _seed(seed) {}
 
+  /**
+   * @brief Constructs a hasher of the rows of `t` whose strings are hashed regardless of the case
+   * of their ASCII letters in the columns whose `key_case` is `case_sensitivity::INSENSITIVE`.
+   *
+   * @param t The table whose rows are hashed
+   * @param key_case Device array the same length as a row, or `nullptr` if all columns are
+   * case-sensitive
+   * @param seed The seed of the hash of the first column
+   */
+  row_hasher(table_device_view t,
+             case_sensitivity const* key_case,
+             uint32_t seed = DEFAULT_HASH_SEED)
+    : _table{t}, _seed(seed), _key_case{key_case}
+  {
+  }
+
+  /**
+   * @brief Constructs a hasher that returns precomputed hash values of the rows of `t` instead of
+   * hashing them.
+   *
+   * @param t The table whose rows are hashed
+   * @param row_hashes Device array of the hash value of every row of `t`, or `nullptr` to hash
+   * the rows
+   */
+  row_hasher(table_device_view t, hash_value_type const* row_hashes)
+    : _table{t}, _row_hashes{row_hashes}
+  {
+  }
+
   __device__ auto operator()(size_type row_index) const
   {
+    if (_row_hashes != nullptr) { return _row_hashes[row_index]; }
+
     auto hash_combiner = [](hash_value_type lhs, hash_value_type rhs) {
       return hash_function<hash_value_type>{}.hash_combine(lhs, rhs);
     };
 
+    auto const folds_case = [key_case = _key_case](size_type column_index) {
+      return key_case != nullptr and key_case[column_index] == case_sensitivity::INSENSITIVE;
+    };
+
     // Hash the first column w/ the seed
-    auto const initial_hash =
-      hash_combiner(hash_value_type{0},
-                    type_dispatcher(_table.column(0).type(),
-                                    element_hasher_with_seed<hash_function, has_nulls>{_seed},
-                                    _table.column(0),
-                                    row_index));
+    auto const initial_hash = hash_combiner(
+      hash_value_type{0},
+      type_dispatcher(_table.column(0).type(),
+                      element_hasher_with_seed<hash_function, has_nulls>{
+                        _seed, std::numeric_limits<hash_value_type>::max(), folds_case(0)},
+                      _table.column(0),
+                      row_index));
 
     // Hashes an element in a column
     auto hasher = [=](size_type column_index) {
-      return cudf::type_dispatcher(_table.column(column_index).type(),
-                                   element_hasher<hash_function, has_nulls>{},
-                                   _table.column(column_index),
-                                   row_index);
+      return cudf::type_dispatcher(
+        _table.column(column_index).type(),
+        element_hasher<hash_function, has_nulls>{folds_case(column_index)},
+        _table.column(column_index),
+        row_index);
     };
 
     // Hash each element and combine all the hash values together
@@ -502,6 +880,8 @@ class row_hasher {
  private:
   table_device_view _table;
   uint32_t _seed{DEFAULT_HASH_SEED};
+  case_sensitivity const* _key_case{};
+  hash_value_type const* _row_hashes{};
 };
 
 /**
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/device_view_storage.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
@@ -74,7 +75,7 @@ class table_device_view_base {
  protected:
   table_device_view_base(HostTableView source_view, rmm::cuda_stream_view stream);
 
-  rmm::device_buffer* _descendant_storage{};
+  device_view_storage* _descendant_storage{};
 };
 }  // namespace detail
 
@@ -126,27 +127,22 @@ auto contiguous_copy_column_device_views(HostTableView source_view, rmm::cuda_st
     });
   // pad the allocation for aligning the first pointer
   auto padded_views_size_bytes = views_size_bytes + std::size_t{alignof(ColumnDeviceView) - 1};
-  // A buffer of CPU memory is allocated to hold the ColumnDeviceView
-  // objects. Once filled, the CPU memory is then copied to device memory
-  // and the pointer is set in the d_columns member.
-  std::vector<int8_t> h_buffer(padded_views_size_bytes);
+  // The ColumnDeviceView objects are built in pinned host memory, then copied to device memory
+  // and the pointer is set in the d_columns member. Both memories come from the cache of
+  // descriptor storage, and have the same alignment, so that h_ptr and d_ptr have the same offset.
   // Each ColumnDeviceView instance may have child objects which may
   // require setting some internal device pointers before being copied
   // from CPU to device.
-  // Allocate the device memory to be used in the result.
-  // We need this pointer in order to pass it down when creating the
-  // ColumnDeviceViews so the column can set the pointer(s) for any
-  // of its child objects.
-  // align both h_ptr, d_ptr
-  auto descendant_storage = std::make_unique<rmm::device_buffer>(padded_views_size_bytes, stream);
-  void* h_ptr             = detail::align_ptr_for_type<ColumnDeviceView>(h_buffer.data());
-  void* d_ptr    = detail::align_ptr_for_type<ColumnDeviceView>(descendant_storage->data());
+  auto storage = std::make_unique<detail::device_view_storage>(padded_views_size_bytes, stream);
+  void* h_ptr  = detail::align_ptr_for_type<ColumnDeviceView>(storage->host_data());
+  void* d_ptr  = detail::align_ptr_for_type<ColumnDeviceView>(storage->device_data());
+
   auto d_columns = detail::child_columns_to_device_array<ColumnDeviceView>(
     source_view.begin(), source_view.end(), h_ptr, d_ptr);
 
-  CUDA_TRY(cudaMemcpyAsync(d_ptr, h_ptr, views_size_bytes, cudaMemcpyDefault, stream.value()));
-  stream.synchronize();
-  return std::make_tuple(std::move(descendant_storage), d_columns);
+  storage->copy_to_device(static_cast<char*>(h_ptr) - static_cast<char*>(storage->host_data()),
+                          views_size_bytes);
+  return std::make_tuple(std::move(storage), d_columns);
 }
 
 namespace detail {
@@ -262,6 +262,17 @@ inline bool has_nulls(table_view view)
   return std::any_of(view.begin(), view.end(), [](column_view col) { return col.has_nulls(); });
 }
 
+/**
+ * @brief Checks if any column of the table, or any descendant of a column, has nulls
+ *
+ * The row operators compare the children of the struct columns, so their nulls must be accounted
+ * for as well as the nulls of the parents.
+ *
+ * @param input The table to check
+ * @return Whether the table or any child column has nulls
+ */
+bool has_nested_nulls(table_view const& input);
+
 /**
  * @brief Checks if two `table_view`s have columns of same types
  *
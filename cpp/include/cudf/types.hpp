@@ -162,11 +162,32 @@ enum class null_order : bool {
   BEFORE  ///< NULL values ordered *before* all other values
 };
 
+/**
+ * @brief Indicates whether the strings of a column compare and hash regardless of the case of
+ * their ASCII letters.
+ */
+enum class case_sensitivity : bool {
+  SENSITIVE,   ///< strings compare byte by byte
+  INSENSITIVE  ///< strings compare as if their ASCII letters were lowercase
+};
+
 /**
  * @brief Indicates whether a collection of values is known to be sorted.
  */
 enum class sorted : bool { NO, YES };
 
+/**
+ * @brief Indicates whether the results of an operation must be the same from run to run.
+ *
+ * Floating-point additions are not associative, so the results of operations adding values in
+ * an order decided by the scheduling of the threads, e.g. with atomic operations, can differ
+ * between two runs on the same input.
+ */
+enum class determinism : bool {
+  NONDETERMINISTIC,  ///< results may depend on the order in which threads run
+  DETERMINISTIC      ///< results are the same from run to run
+};
+
 /**
  * @brief Indicates how a collection of values has been ordered.
  */
@@ -230,6 +251,7 @@ enum class type_id : int32_t {
   DECIMAL32,               ///< Fixed-point type with int32_t
   DECIMAL64,               ///< Fixed-point type with int64_t
   STRUCT,                  ///< Struct elements
+  DECIMAL128,              ///< Fixed-point type with __int128_t
   // `NUM_TYPE_IDS` must be last!
   NUM_TYPE_IDS  ///< Total number of type ids
 };
@@ -264,7 +286,7 @@ class data_type {
    */
   explicit data_type(type_id id, int32_t scale) : _id{id}, _fixed_point_scale{scale}
   {
-    assert(id == type_id::DECIMAL32 || id == type_id::DECIMAL64);
+    assert(id == type_id::DECIMAL32 || id == type_id::DECIMAL64 || id == type_id::DECIMAL128);
   }
 
   /**
@@ -332,11 +354,15 @@ std::size_t size_of(data_type t);
  *  @brief Identifies the hash function to be used
  */
 enum class hash_id {
-  HASH_IDENTITY = 0,    ///< Identity hash function that simply returns the key to be hashed
-  HASH_MURMUR3,         ///< Murmur3 hash function
-  HASH_MD5,             ///< MD5 hash function
-  HASH_SERIAL_MURMUR3,  ///< Serial Murmur3 hash function
-  HASH_SPARK_MURMUR3    ///< Spark Murmur3 hash function
+  HASH_IDENTITY = 0,     ///< Identity hash function that simply returns the key to be hashed
+  HASH_MURMUR3,          ///< Murmur3 hash function
+  HASH_MD5,              ///< MD5 hash function
+  HASH_SERIAL_MURMUR3,   ///< Serial Murmur3 hash function
+  HASH_SPARK_MURMUR3,    ///< Spark Murmur3 hash function
+  HASH_XXHASH64,         ///< Spark xxHash64 hash function
+  HASH_MURMUR3_X64_128,  ///< Serial 128-bit Murmur3 hash function
+  HASH_SHA1,             ///< SHA-1 hash function
+  HASH_SHA256            ///< SHA-256 hash function
 };
 
 /**
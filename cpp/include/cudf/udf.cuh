@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/extrema.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+
+#include <cstdint>
+#include <memory>
+
+/**
+ * @file
+ * @brief Transforms and rolling windows of user-defined device functions, compiled with the code
+ * that calls them
+ *
+ * Unlike the PTX and CUDA aggregations and `cudf::transform()`, which compile the function given
+ * as a string when they are first called, these function templates are instantiated for the
+ * function object they are given, so that the function is compiled and optimized with the kernel
+ * that calls it. They are only available to code compiled by nvcc.
+ */
+
+namespace cudf {
+namespace udf {
+namespace detail {
+
+/**
+ * @brief The rows of the window of every row of a column, clamped to the group of the row.
+ *
+ * The window of row `i` is `[i - preceding + 1, i + following]`. Without groups, the column is a
+ * single group.
+ */
+struct window_rows {
+  size_type size;                  ///< The number of rows of the column
+  size_type const* group_offsets;  ///< The offsets of the groups, or `nullptr`
+  size_type const* group_labels;   ///< The group of every row, or `nullptr`
+  size_type preceding;             ///< The rows of the window up to the row, included
+  size_type following;             ///< The rows of the window after the row
+
+  /**
+   * @brief Returns the first row and one past the last row of the window of row `i`.
+   */
+  __device__ thrust::pair<size_type, size_type> operator()(size_type i) const
+  {
+    int64_t group_begin = 0;
+    int64_t group_end   = size;
+    if (group_labels != nullptr) {
+      group_begin = group_offsets[group_labels[i]];
+      group_end   = group_offsets[group_labels[i] + 1];
+    }
+    // The bounds are computed in 64 bits, as unbounded windows are of the largest size_type
+    auto const begin = thrust::min(group_end, thrust::max(group_begin, int64_t{i} - preceding + 1));
+    auto const end   = thrust::min(group_end, thrust::max(group_begin, int64_t{i} + following + 1));
+    return {static_cast<size_type>(begin), static_cast<size_type>(thrust::max(begin, end))};
+  }
+};
+
+/**
+ * @brief Calls the user-defined function on the window of every row of at least `min_periods`
+ * rows.
+ */
+template <typename Out, typename Function>
+struct rolling_udf_fn {
+  column_device_view input;
+  window_rows windows;
+  size_type min_periods;
+  Function f;
+
+  __device__ Out operator()(size_type i) const
+  {
+    auto const window = windows(i);
+    if (window.second - window.first < min_periods) { return Out{}; }
+    return f(input, window.first, window.second);
+  }
+};
+
+/**
+ * @brief Indicates whether the window of a row has at least `min_periods` rows.
+ */
+struct window_has_min_periods {
+  window_rows windows;
+  size_type min_periods;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const window = windows(i);
+    return window.second - window.first >= min_periods;
+  }
+};
+
+template <typename Out, typename In>
+constexpr bool is_supported_udf()
+{
+  return cudf::is_fixed_width<Out>() and not cudf::is_fixed_point<Out>() and
+         cudf::is_fixed_width<In>() and not cudf::is_fixed_point<In>();
+}
+
+/**
+ * @copydoc cudf::udf::transform
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename Out, typename In, typename Function>
+std::unique_ptr<column> transform(column_view const& input,
+                                  Function f,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  static_assert(is_supported_udf<Out, In>(),
+                "The input and output types must be fixed-width types other than fixed-point");
+  CUDF_EXPECTS(input.type().id() == type_to_id<In>(), "Input column type should be In");
+
+  auto output = make_fixed_width_column(data_type{type_to_id<Out>()},
+                                        input.size(),
+                                        cudf::detail::copy_bitmask(input, stream, mr),
+                                        input.null_count(),
+                                        stream,
+                                        mr);
+  if (input.is_empty()) { return output; }
+
+  thrust::transform(rmm::exec_policy(stream),
+                    input.begin<In>(),
+                    input.end<In>(),
+                    output->mutable_view().begin<Out>(),
+                    f);
+  return output;
+}
+
+/**
+ * @brief Computes the user-defined function on the given windows of every row.
+ */
+template <typename Out, typename In, typename Function>
+std::unique_ptr<column> rolling_window(column_view const& input,
+                                       window_rows windows,
+                                       size_type min_periods,
+                                       Function f,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  static_assert(is_supported_udf<Out, In>(),
+                "The input and output types must be fixed-width types other than fixed-point");
+  CUDF_EXPECTS(input.type().id() == type_to_id<In>(), "Input column type should be In");
+  CUDF_EXPECTS(min_periods > 0, "min_periods must be positive");
+
+  if (input.is_empty()) { return make_empty_column(data_type{type_to_id<Out>()}); }
+
+  auto mask = cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                     thrust::make_counting_iterator<size_type>(input.size()),
+                                     window_has_min_periods{windows, min_periods},
+                                     stream,
+                                     mr);
+
+  auto output = make_fixed_width_column(data_type{type_to_id<Out>()},
+                                        input.size(),
+                                        std::move(mask.first),
+                                        mask.second,
+                                        stream,
+                                        mr);
+
+  auto const d_input = column_device_view::create(input, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    output->mutable_view().begin<Out>(),
+                    rolling_udf_fn<Out, Function>{*d_input, windows, min_periods, f});
+  return output;
+}
+
+/**
+ * @copydoc cudf::udf::rolling_window
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename Out, typename In, typename Function>
+std::unique_ptr<column> rolling_window(column_view const& input,
+                                       size_type preceding_window,
+                                       size_type following_window,
+                                       size_type min_periods,
+                                       Function f,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  return rolling_window<Out, In>(
+    input,
+    window_rows{input.size(), nullptr, nullptr, preceding_window, following_window},
+    min_periods,
+    f,
+    stream,
+    mr);
+}
+
+/**
+ * @copydoc cudf::udf::grouped_rolling_window
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename Out, typename In, typename Function>
+std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
+                                               column_view const& input,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               Function f,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(group_keys.num_columns() == 0 or group_keys.num_rows() == input.size(),
+               "Size mismatch between group_keys and input vector.");
+
+  if (group_keys.num_columns() == 0 or input.is_empty()) {
+    return rolling_window<Out, In>(
+      input, preceding_window, following_window, min_periods, f, stream, mr);
+  }
+
+  cudf::groupby::detail::sort::sort_groupby_helper helper{
+    group_keys, null_policy::INCLUDE, sorted::YES};
+  auto const& group_offsets = helper.group_offsets(stream);
+  auto const& group_labels  = helper.group_labels(stream);
+
+  return rolling_window<Out, In>(input,
+                                 window_rows{input.size(),
+                                             group_offsets.data(),
+                                             group_labels.data(),
+                                             preceding_window,
+                                             following_window},
+                                 min_periods,
+                                 f,
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+/**
+ * @addtogroup transformation_transform
+ * @{
+ */
+
+/**
+ * @brief Creates a new column by applying a user-defined device function to every element of an
+ * input column.
+ *
+ * Computes `out[i] = f(in[i])`. The output null mask is the input null mask; `f` is also called
+ * for the null elements, whose results are not used.
+ *
+ * @code{.cpp}
+ * struct celsius_to_fahrenheit {
+ *   __device__ double operator()(float c) const { return c * 1.8 + 32; }
+ * };
+ * auto fahrenheit = cudf::udf::transform<double, float>(celsius, celsius_to_fahrenheit{});
+ * @endcode
+ *
+ * @throw cudf::logic_error if the type of `input` is not `In`
+ *
+ * @tparam Out The type of the output column, a fixed-width type other than fixed-point
+ * @tparam In The type of the input column, a fixed-width type other than fixed-point
+ * @tparam Function A function object callable on the device as `Out f(In)`
+ * @param input The column to transform
+ * @param f The function to apply
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The column of the results of `f` on every element of `input`
+ */
+template <typename Out, typename In, typename Function>
+std::unique_ptr<column> transform(
+  column_view const& input,
+  Function f,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform<Out, In>(input, f, rmm::cuda_stream_default, mr);
+}
+
+/** @} */  // end of group
+
+/**
+ * @addtogroup aggregation_rolling
+ * @{
+ */
+
+/**
+ * @brief Applies a fixed-size rolling window of a user-defined device function to the values in
+ * a column.
+ *
+ * The window of element `i` is made of the elements `[i - preceding_window + 1,
+ * i + following_window]` that are in the column, as for `cudf::rolling_window()`. For every
+ * window of at least `min_periods` elements, null or not, `f(input, begin, end)` is the output
+ * element `i`, where `input` is the device view of the input column and `[begin, end)` are the
+ * rows of the window; the other output elements are null and `f` is not called for them.
+ *
+ * @code{.cpp}
+ * struct window_range {
+ *   __device__ int32_t operator()(cudf::column_device_view const& input,
+ *                                 cudf::size_type begin,
+ *                                 cudf::size_type end) const
+ *   {
+ *     auto const values = input.data<int32_t>();
+ *     auto const minmax = thrust::minmax_element(thrust::seq, values + begin, values + end);
+ *     return *minmax.second - *minmax.first;
+ *   }
+ * };
+ * auto ranges = cudf::udf::rolling_window<int32_t, int32_t>(input, 3, 0, 1, window_range{});
+ * @endcode
+ *
+ * @throw cudf::logic_error if the type of `input` is not `In`
+ * @throw cudf::logic_error if `min_periods` is not positive
+ *
+ * @tparam Out The type of the output column, a fixed-width type other than fixed-point
+ * @tparam In The type of the input column, a fixed-width type other than fixed-point
+ * @tparam Function A function object callable on the device as
+ * `Out f(column_device_view const&, size_type, size_type)`
+ * @param input The input column
+ * @param preceding_window The static rolling window size in the backward direction
+ * @param following_window The static rolling window size in the forward direction
+ * @param min_periods Minimum number of elements in the window required to have a value
+ * @param f The function to apply to every window
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A nullable column of the results of `f` on every window
+ */
+template <typename Out, typename In, typename Function>
+std::unique_ptr<column> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  Function f,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_FUNC_RANGE();
+  return detail::rolling_window<Out, In>(
+    input, preceding_window, following_window, min_periods, f, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @brief Applies a grouping-aware, fixed-size rolling window of a user-defined device function to
+ * the values in a column.
+ *
+ * Like `cudf::udf::rolling_window()`, except that the windows do not cross the boundaries of the
+ * groups of `group_keys`, as for `cudf::grouped_rolling_window()`. The rows must be presorted by
+ * the `group_keys` values.
+ *
+ * @throw cudf::logic_error if `group_keys` has columns and not as many rows as `input`
+ * @throw cudf::logic_error if the type of `input` is not `In`
+ * @throw cudf::logic_error if `min_periods` is not positive
+ *
+ * @tparam Out The type of the output column, a fixed-width type other than fixed-point
+ * @tparam In The type of the input column, a fixed-width type other than fixed-point
+ * @tparam Function A function object callable on the device as
+ * `Out f(column_device_view const&, size_type, size_type)`
+ * @param group_keys The (pre-sorted) grouping columns
+ * @param input The input column
+ * @param preceding_window The static rolling window size in the backward direction
+ * @param following_window The static rolling window size in the forward direction
+ * @param min_periods Minimum number of elements in the window required to have a value
+ * @param f The function to apply to every window
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A nullable column of the results of `f` on every window
+ */
+template <typename Out, typename In, typename Function>
+std::unique_ptr<column> grouped_rolling_window(
+  table_view const& group_keys,
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  Function f,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_FUNC_RANGE();
+  return detail::grouped_rolling_window<Out, In>(group_keys,
+                                                 input,
+                                                 preceding_window,
+                                                 following_window,
+                                                 min_periods,
+                                                 f,
+                                                 rmm::cuda_stream_default,
+                                                 mr);
+}
+
+/** @} */  // end of group
+}  // namespace udf
+}  // namespace cudf
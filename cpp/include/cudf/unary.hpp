@@ -68,6 +68,31 @@ std::unique_ptr<cudf::column> unary_operation(
   cudf::unary_operator op,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Performs unary op on all values in column, writing the results into a preallocated
+ * column.
+ *
+ * `output` receives the values of the result and the null mask of `input`. It may be `input`
+ * itself, so that the operation is applied in place without allocating a column, when the result
+ * has the type of `input`. Otherwise it must not overlap `input`.
+ *
+ * Note: For `decimal32` and `decimal64`, only `ABS`, `CEIL` and `FLOOR` are supported. Dictionary
+ * columns are not supported.
+ *
+ * @throw cudf::logic_error if `output` is not of type `BOOL8` for `NOT`, or of the type of `input`
+ * for the other operations
+ * @throw cudf::logic_error if `output` is not of the size of `input`
+ * @throw cudf::logic_error if `input` has nulls and `output` is not nullable
+ * @throw cudf::logic_error if `output` overlaps `input` without viewing the same elements
+ *
+ * @param input A `column_view` as input
+ * @param op operation to perform
+ * @param output The preallocated column of the result
+ */
+void unary_operation(cudf::column_view const& input,
+                     cudf::unary_operator op,
+                     cudf::mutable_column_view& output);
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements where for every element in `input` `true`
  * indicates the value is null and `false` indicates the value is valid.
@@ -113,6 +138,26 @@ std::unique_ptr<column> cast(
   data_type out_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Casts data from the dtype of `input` to the dtype of `output`, writing the results into
+ * the preallocated `output`.
+ *
+ * `output` receives the cast values and the null mask of `input`. It may view the same memory as
+ * `input` when both types have the same width, to cast in place, as from `INT64` to `FLOAT64`.
+ * Otherwise it must not overlap `input`.
+ *
+ * Supports the fixed-width casts of `cast()`, except between `fixed_point` types.
+ *
+ * @throw cudf::logic_error if the type of `output` is not a supported cast type
+ * @throw cudf::logic_error if `output` is not of the size of `input`
+ * @throw cudf::logic_error if `input` has nulls and `output` is not nullable
+ * @throw cudf::logic_error if `output` overlaps `input` without viewing elements of the same width
+ *
+ * @param input Input column
+ * @param output The preallocated column of the result, of the desired datatype
+ */
+void cast(column_view const& input, mutable_column_view& output);
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements indicating the presence of `NaN` values
  * in a column of floating point values.
@@ -16,8 +16,21 @@
 
 #pragma once
 
+#include <rmm/cuda_stream_view.hpp>
+
 namespace cudf {
 
+/**
+ * @brief Returns the default stream of the public APIs.
+ *
+ * This is the per-thread default stream if libcudf is built with `PER_THREAD_DEFAULT_STREAM`, so
+ * that work submitted from different host threads can run concurrently, and the legacy default
+ * stream otherwise.
+ *
+ * @return The default stream
+ */
+rmm::cuda_stream_view get_default_stream();
+
 /**
  * @brief Check if per-thread default stream is enabled.
  *
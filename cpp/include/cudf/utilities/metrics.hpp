@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+/**
+ * @file
+ * @brief Opt-in registry of the metrics of the calls to the public APIs
+ */
+
+namespace cudf {
+/**
+ * @addtogroup utility_apis
+ * @{
+ */
+
+/**
+ * @brief Metrics accumulated over the calls to one operation.
+ *
+ * Every public API tagged with an NVTX range counts its calls and their wall time. The bytes and
+ * rows are recorded by the operations that compute them, which are otherwise 0.
+ */
+struct operation_metrics {
+  std::size_t calls{0};            ///< Number of calls
+  std::int64_t wall_time_ns{0};    ///< Total host wall time of the calls, in nanoseconds
+  std::size_t input_bytes{0};      ///< Total size of the device buffers of the inputs
+  std::size_t output_bytes{0};     ///< Total size of the device buffers of the outputs
+  std::size_t input_rows{0};       ///< Total number of input rows
+  std::size_t output_rows{0};      ///< Total number of output rows
+  std::size_t peak_temp_bytes{0};  ///< Largest peak of memory allocated during a single call
+};
+
+/**
+ * @brief Enables or disables the recording of the metrics of the public APIs.
+ *
+ * Recording is disabled by default. When disabled, the only cost of the instrumentation is an
+ * atomic load per call.
+ *
+ * @param enable Whether to record the metrics
+ */
+void enable_metrics(bool enable);
+
+/**
+ * @brief Returns whether the metrics of the public APIs are recorded.
+ */
+bool metrics_enabled();
+
+/**
+ * @brief Returns a copy of the metrics recorded so far, indexed by operation name.
+ */
+std::map<std::string, operation_metrics> get_metrics();
+
+/**
+ * @brief Discards all the metrics recorded so far.
+ */
+void reset_metrics();
+
+/**
+ * @brief Returns the recorded metrics as a JSON object indexed by operation name.
+ *
+ * Example:
+ * ```
+ * {"gather": {"calls": 2, "wall_time_ns": 81422, "input_bytes": 4096, ...}}
+ * ```
+ */
+std::string metrics_to_json();
+
+/**
+ * @brief Returns the recorded metrics as counters in the Prometheus text exposition format.
+ *
+ * Each field of `operation_metrics` is a counter named `libcudf_<field>_total`, except
+ * `peak_temp_bytes` which is the gauge `libcudf_peak_temp_bytes`. The metrics are labelled with
+ * the operation name:
+ * ```
+ * libcudf_calls_total{operation="gather"} 2
+ * ```
+ */
+std::string metrics_to_prometheus();
+
+/**
+ * @brief Device memory resource adaptor tracking the memory allocated from its upstream, so that
+ * the metrics registry can record the peak memory allocated during each call.
+ *
+ * The peaks are recorded while the adaptor is the current device resource. Allocations of
+ * concurrent host threads are attributed to every call in progress.
+ */
+class metrics_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Creates an adaptor of `upstream`.
+   *
+   * @param upstream Resource of the allocations, which must outlive the adaptor
+   */
+  explicit metrics_resource_adaptor(rmm::mr::device_memory_resource* upstream)
+    : _upstream{upstream}
+  {
+  }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+  /**
+   * @brief Returns the number of bytes currently allocated through the adaptor.
+   */
+  std::size_t allocated_bytes() const noexcept { return _allocated.load(); }
+
+  /**
+   * @brief Returns the largest number of bytes allocated at once since the last `reset_peak()`.
+   */
+  std::size_t peak_bytes() const noexcept { return _peak.load(); }
+
+  /**
+   * @brief Returns the number of allocations made through the adaptor.
+   */
+  std::size_t num_allocations() const noexcept { return _num_allocations.load(); }
+
+  /**
+   * @brief Sets the peak to `bytes`, and returns the previous peak.
+   *
+   * @param bytes New peak, usually `allocated_bytes()`
+   */
+  std::size_t reset_peak(std::size_t bytes) noexcept { return _peak.exchange(bytes); }
+
+  /**
+   * @brief Raises the peak to `bytes` if it is larger.
+   *
+   * @param bytes Candidate peak
+   */
+  void update_peak(std::size_t bytes) noexcept;
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* _upstream;
+  std::atomic<std::size_t> _allocated{0};
+  std::atomic<std::size_t> _peak{0};
+  std::atomic<std::size_t> _num_allocations{0};
+};
+
+/** @} */  // end of group
+}  // namespace cudf
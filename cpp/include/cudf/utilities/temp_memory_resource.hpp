@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+/**
+ * @file
+ * @brief Device memory resource of the temporary allocations made within the public APIs
+ */
+
+namespace cudf {
+/**
+ * @addtogroup utility_apis
+ * @{
+ */
+
+/**
+ * @brief Returns the resource of the temporary device allocations made within the public APIs.
+ *
+ * The public APIs allocate their results from their `mr` parameter, and their intermediate
+ * results from the temporary resource, so that the scratch memory can come from a dedicated
+ * arena. This is, in order of precedence:
+ * - the resource of the innermost `temp_resource_scope` of the calling thread
+ * - the resource set by `set_current_temp_resource()`
+ * - otherwise, the current device resource
+ *
+ * Temporaries allocated with a default resource argument, such as the scratch memory of thrust
+ * algorithms, still come from the current device resource.
+ */
+rmm::mr::device_memory_resource* get_current_temp_resource();
+
+/**
+ * @brief Sets the resource of the temporary allocations of all the host threads that are not in
+ * a `temp_resource_scope`.
+ *
+ * The resource must outlive its use, including the temporaries of the calls in progress.
+ *
+ * @param mr Resource of the temporary allocations, or `nullptr` to use the current device
+ * resource
+ * @return The previous resource, `nullptr` if it was the current device resource
+ */
+rmm::mr::device_memory_resource* set_current_temp_resource(rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Sets the resource of the temporary allocations of the calling thread during its lifetime.
+ *
+ * The following code snippet sorts a table into the default resource, while its intermediate
+ * results are allocated from a pool, which serves allocations of any size:
+ * @code
+ *  rmm::mr::pool_memory_resource<rmm::mr::cuda_memory_resource> pool{&cuda_mr};
+ *  cudf::temp_resource_scope scratch{&pool};
+ *  auto sorted = cudf::sort_by_key(values, keys);
+ * @endcode
+ */
+class temp_resource_scope {
+ public:
+  /**
+   * @brief Makes `mr` the temporary resource of the calling thread until the scope is destroyed.
+   *
+   * @param mr Resource of the temporary allocations, which must outlive the scope
+   */
+  explicit temp_resource_scope(rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Restores the temporary resource the thread had before the scope.
+   */
+  ~temp_resource_scope();
+
+  temp_resource_scope(temp_resource_scope const&) = delete;
+  temp_resource_scope& operator=(temp_resource_scope const&) = delete;
+
+ private:
+  rmm::mr::device_memory_resource* _previous;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -135,7 +135,7 @@ constexpr inline bool is_equality_comparable()
 template <typename T>
 constexpr inline bool is_numeric()
 {
-  return std::is_integral<T>::value or std::is_floating_point<T>::value;
+  return cuda::std::is_integral<T>::value or std::is_floating_point<T>::value;
 }
 
 struct is_numeric_impl {
@@ -362,7 +362,9 @@ constexpr inline bool is_timestamp(data_type type)
 template <typename T>
 constexpr inline bool is_fixed_point()
 {
-  return std::is_same<numeric::decimal32, T>::value || std::is_same<numeric::decimal64, T>::value;
+  return std::is_same<numeric::decimal32, T>::value ||
+         std::is_same<numeric::decimal64, T>::value ||
+         std::is_same<numeric::decimal128, T>::value;
 }
 
 struct is_fixed_point_impl {
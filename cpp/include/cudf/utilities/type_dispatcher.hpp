@@ -87,6 +87,7 @@ using id_to_type = typename id_to_type_impl<Id>::type;
  *
  * For `decimal32`, the storage type is an `int32_t`.
  * For `decimal64`, the storage type is an `int64_t`.
+ * For `decimal128`, the storage type is an `__int128_t`.
  *
  * Use this "type function" with the `using` type alias:
  * @code
@@ -99,7 +100,8 @@ using id_to_type = typename id_to_type_impl<Id>::type;
 template <typename T>
 using device_storage_type_t =
   std::conditional_t<std::is_same<numeric::decimal32, T>::value, int32_t,
-  std::conditional_t<std::is_same<numeric::decimal64, T>::value, int64_t, T>>;
+  std::conditional_t<std::is_same<numeric::decimal64, T>::value, int64_t,
+  std::conditional_t<std::is_same<numeric::decimal128, T>::value, __int128_t, T>>>;
 // clang-format on
 
 /**
@@ -130,7 +132,9 @@ template <typename T>
 bool type_id_matches_device_storage_type(type_id id)
 {
   return (id == type_id::DECIMAL32 && std::is_same<T, int32_t>::value) ||
-         (id == type_id::DECIMAL64 && std::is_same<T, int64_t>::value) || id == type_to_id<T>();
+         (id == type_id::DECIMAL64 && std::is_same<T, int64_t>::value) ||
+         (id == type_id::DECIMAL128 && std::is_same<T, __int128_t>::value) ||
+         id == type_to_id<T>();
 }
 
 /**
@@ -189,6 +193,7 @@ CUDF_TYPE_MAPPING(cudf::list_view, type_id::LIST);
 CUDF_TYPE_MAPPING(numeric::decimal32, type_id::DECIMAL32);
 CUDF_TYPE_MAPPING(numeric::decimal64, type_id::DECIMAL64);
 CUDF_TYPE_MAPPING(cudf::struct_view, type_id::STRUCT);
+CUDF_TYPE_MAPPING(numeric::decimal128, type_id::DECIMAL128);
 
 /**
  * @brief Use this specialization on `type_dispatcher` whenever you only need to operate on the
@@ -227,6 +232,7 @@ MAP_NUMERIC_SCALAR(uint32_t)
 MAP_NUMERIC_SCALAR(uint64_t)
 MAP_NUMERIC_SCALAR(float)
 MAP_NUMERIC_SCALAR(double)
+MAP_NUMERIC_SCALAR(__int128_t)
 MAP_NUMERIC_SCALAR(bool);
 
 template <>
@@ -253,6 +259,12 @@ struct type_to_scalar_type_impl<numeric::decimal64> {
   using ScalarDeviceType = cudf::fixed_point_scalar_device_view<numeric::decimal64>;
 };
 
+template <>
+struct type_to_scalar_type_impl<numeric::decimal128> {
+  using ScalarType       = cudf::fixed_point_scalar<numeric::decimal128>;
+  using ScalarDeviceType = cudf::fixed_point_scalar_device_view<numeric::decimal128>;
+};
+
 template <>  // TODO: this is a temporary solution for make_pair_iterator
 struct type_to_scalar_type_impl<cudf::dictionary32> {
   using ScalarType       = cudf::numeric_scalar<int32_t>;
@@ -497,6 +509,9 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
     case type_id::STRUCT:
       return f.template operator()<typename IdTypeMap<type_id::STRUCT>::type>(
         std::forward<Ts>(args)...);
+    case type_id::DECIMAL128:
+      return f.template operator()<typename IdTypeMap<type_id::DECIMAL128>::type>(
+        std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported type_id.");
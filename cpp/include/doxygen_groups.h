@@ -149,6 +149,7 @@
  *   @defgroup lists_elements Counting
  *   @defgroup lists_drop_duplicates Filtering
  *   @defgroup lists_sort Sorting
+ *   @defgroup lists_set_operations Set Operations
  * @}
  * @defgroup nvtext_apis NVText
  * @{
@@ -158,6 +159,7 @@
  *   @defgroup nvtext_edit_distance Edit Distance
  *   @defgroup nvtext_tokenize Tokenizing
  *   @defgroup nvtext_replace Replacing
+ *   @defgroup nvtext_minhash MinHashing
  * @}
  * @defgroup utility_apis Utilities
  * @{
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <nvtext/subword_tokenize.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <string>
+
+namespace nvtext {
+
+/**
+ * @addtogroup nvtext_tokenize
+ * @{
+ * @file
+ */
+
+/**
+ * @brief The merge-rank and vocabulary tables for use with the bpe_tokenize function.
+ *
+ * Both tables are sorted by their strings so they can be searched on the device.
+ */
+struct bpe_vocabulary {
+  uint32_t unknown_token_id{};
+  std::unique_ptr<cudf::column> merge_pairs;  // strings "left right", sorted
+  std::unique_ptr<cudf::column> merge_ranks;  // int32, rank of each merge pair
+  std::unique_ptr<cudf::column> tokens;       // strings, sorted
+  std::unique_ptr<cudf::column> token_ids;    // uint32, id of each token
+};
+
+/**
+ * @brief Load the merge pairs and vocabulary files of a BPE model into device memory.
+ *
+ * The merges file has a merge pair per line, the two symbols separated by a space,
+ * from the highest priority merge to the lowest. A first line starting with `#version`
+ * is ignored. The vocabulary file has a token per line and the id of a token is its
+ * line number, starting at 0.
+ *
+ * The object here can be used to call bpe_tokenize without incurring the cost of
+ * loading the same files each time.
+ *
+ * @throw cudf::logic_error if either file could not be opened.
+ * @throw cudf::logic_error if a merges line does not have a space separator.
+ * @throw cudf::logic_error if `unknown_token` is not in the vocabulary.
+ *
+ * @param filename_merges A path to the merges file, like merges.txt of GPT-2 models.
+ * @param filename_vocabulary A path to the vocabulary file.
+ * @param unknown_token The token of the symbols that are not in the vocabulary.
+ * @param mr Memory resource to allocate any returned objects.
+ * @return The merge-rank and vocabulary tables
+ */
+std::unique_ptr<bpe_vocabulary> load_bpe_vocabulary(
+  std::string const& filename_merges,
+  std::string const& filename_vocabulary,
+  std::string const& unknown_token    = "<unk>",
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Creates a byte-pair encoding tokenizer that splits the strings into tokens and
+ *        returns token-ids from the provided vocabulary.
+ *
+ * The strings are split into words by whitespace, and each word starts as a sequence of
+ * its UTF-8 characters. The adjacent pair of symbols with the lowest merge rank is merged
+ * into a single symbol until no adjacent pair is in the merges table. Each final symbol is
+ * then assigned its id in the vocabulary, or `unknown_token_id` if it is not found.
+ *
+ * The text is not normalized, so vocabularies built on byte-to-unicode mapped text, like
+ * those of GPT-2, require the strings to be mapped the same way first.
+ *
+ * The output has the same shape as the output of `subword_tokenize`. Each string is
+ * converted into one or more rows of `max_sequence_length` token-ids, depending on
+ * `do_truncate` and `stride`.
+ *
+ * Each string is tokenized by a single thread and the merges of each word take time
+ * quadratic in its number of characters, so very long words are slow to tokenize.
+ *
+ * @throw cudf::logic_error if `stride > max_sequence_length`
+ * @throw cudf::logic_error if `max_sequence_length * max_rows_tensor` is
+ *        larger than the max value for cudf::size_type
+ *
+ * @param strings The input strings to tokenize.
+ * @param vocabulary The merge-rank and vocabulary tables pre-loaded into this object.
+ * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+ *        for each string.
+ * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+ *        the token-ids from the previous row, unless it is the first string.
+ * @param do_truncate If true, the tokenizer will discard all the token-ids after
+ *        `max_sequence_length` for each input string. If false, it will use a new row
+ *        in the output token-ids to continue generating the output.
+ * @param max_rows_tensor Maximum number of rows for the output token-ids expected
+ *        to be generated by the tokenizer.
+ * @param mr Memory resource to allocate any returned objects.
+ * @return token-ids, attention-mask, and metadata
+ */
+tokenizer_result bpe_tokenize(
+  cudf::strings_column_view const& strings,
+  bpe_vocabulary const& vocabulary,
+  uint32_t max_sequence_length,
+  uint32_t stride,
+  bool do_truncate,
+  uint32_t max_rows_tensor,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
@@ -45,5 +45,14 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc save_vocabulary_file(hashed_vocabulary const&,std::string const&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void save_vocabulary_file(hashed_vocabulary const& vocabulary,
+                          std::string const& filename_hashed_vocabulary,
+                          rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace nvtext
@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <nvtext/tokenize.hpp>
+
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -89,5 +91,26 @@ std::unique_ptr<cudf::column> count_tokens(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc nvtext::load_vocabulary
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<tokenize_vocabulary> load_vocabulary(cudf::strings_column_view const& vocabulary,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc nvtext::tokenize_with_vocabulary
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& strings,
+                                                       tokenize_vocabulary const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 }  // namespace nvtext
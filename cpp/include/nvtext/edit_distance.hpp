@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 //! NVText APIs
 namespace nvtext {
@@ -97,5 +98,91 @@ std::unique_ptr<cudf::column> edit_distance_matrix(
   cudf::strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute the edit distance between individual strings in two strings columns, up to
+ * a maximum distance.
+ *
+ * The `output[i]` is the edit distance between `strings[i]` and `targets[i]` if it is at most
+ * `max_distance`, else `max_distance + 1`. Only the `2 * max_distance + 1` diagonals of the
+ * Levenshtein matrix around the main one are computed and the computation of a pair stops as
+ * soon as its distance is known to exceed `max_distance`, so testing whether strings are
+ * within a few edits of each other costs far less than computing their full edit distance.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "", "world"]
+ * t = ["hallo", "goodbye", "world"]
+ * d = edit_distance(s, t, 2)
+ * d is now [1, 3, 0]
+ * @endcode
+ *
+ * Any null entries for either `strings` or `targets` is ignored and the edit distance
+ * is computed as though the null entry is an empty string.
+ *
+ * The `targets.size()` must equal `strings.size()` unless `targets.size()==1`.
+ * In this case, all `strings` will be computed against the single `targets[0]` string.
+ *
+ * @throw cudf::logic_error if `targets.size() != strings.size()` and
+ *                          if `targets.size() != 1`
+ * @throw cudf::logic_error if `max_distance` is not between 0 and 127
+ *
+ * @param strings Strings column of input strings
+ * @param targets Strings to compute edit distance against `strings`
+ * @param max_distance Largest edit distance to compute
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of the edit distances, capped at `max_distance + 1`.
+ */
+std::unique_ptr<cudf::column> edit_distance(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& targets,
+  cudf::size_type max_distance,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Find all the pairs of strings of two columns within an edit distance of each other.
+ *
+ * The candidate pairs are generated by blocking on the character ngrams of `ngram_width`
+ * characters. Each edit changes at most `ngram_width` ngrams of a string, so two strings
+ * within `max_distance` edits share at least
+ * `max(length) - ngram_width + 1 - max_distance * ngram_width` of their ngrams, counting
+ * repeated ngrams as many times as they appear in both strings. Only the pairs sharing that
+ * many ngrams are candidates, except for the pairs of strings so short that the bound is not
+ * positive, which are all candidates. The edit distance of each candidate is then computed
+ * up to `max_distance` like `edit_distance(strings, targets, max_distance)`.
+ *
+ * No pair within `max_distance` is missed. Larger `ngram_width` values generate fewer
+ * candidates for long strings, but more of the strings are short enough to be compared with
+ * all the short strings of the other column.
+ *
+ * @code{.pseudo}
+ * Example:
+ * l = ["jonathan", "mary", null, "christine"]
+ * r = ["jonatan", "marie", "christina", "johnathan"]
+ * t = edit_distance_join(l, r, 2)
+ * t is now [[0, 0, 1, 3],   // left indices
+ *           [0, 3, 1, 2],   // right indices
+ *           [1, 1, 2, 1]]   // edit distances
+ * @endcode
+ *
+ * Null strings are not paired with any string.
+ *
+ * @throw cudf::logic_error if `max_distance` is not between 0 and 127
+ * @throw cudf::logic_error if `ngram_width < 1`
+ *
+ * @param left Strings column of the left strings
+ * @param right Strings column of the right strings
+ * @param max_distance Largest edit distance of the returned pairs
+ * @param ngram_width Number of characters of the ngrams used to generate the candidate pairs
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Table of three INT32 columns: the left index, the right index and the edit distance
+ *         of each pair, ordered by left index and then right index
+ */
+std::unique_ptr<cudf::table> edit_distance_join(
+  cudf::strings_column_view const& left,
+  cudf::strings_column_view const& right,
+  cudf::size_type max_distance,
+  cudf::size_type ngram_width         = 2,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
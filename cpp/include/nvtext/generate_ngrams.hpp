@@ -90,5 +90,38 @@ std::unique_ptr<cudf::column> generate_character_ngrams(
   cudf::size_type ngrams              = 2,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hashes the ngrams of characters within each string.
+ *
+ * Each ngram is hashed with the MurmurHash3_32 algorithm directly from the bytes of
+ * its string, so the values are the hashes of the strings `generate_character_ngrams`
+ * would return, without building them. The hashes of a row are listed in the order
+ * of their ngrams within the string.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc", "d", null]
+ * h = hash_character_ngrams(s, 2)
+ * h is a lists column [[h("ab"), h("bc")], [], null]
+ * @endcode
+ *
+ * A string with fewer than `ngrams` characters produces an empty list and
+ * a null row produces a null list.
+ *
+ * @throw cudf::logic_error if `ngrams < 2`
+ *
+ * @param strings Strings column to produce ngrams from.
+ * @param ngrams The ngram number to generate.
+ *               Default is 2 = bigram.
+ * @param seed The seed of the hash function.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of UINT32 hash values, one list per row.
+ */
+std::unique_ptr<cudf::column> hash_character_ngrams(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams              = 2,
+  uint32_t seed                       = cudf::DEFAULT_HASH_SEED,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_minhash
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns the minhash signature of each string.
+ *
+ * Hash values are computed from the substrings of `width` characters of each string,
+ * the character ngrams, using the MurmurHash3_32 algorithm with each of the `seeds`.
+ * The signature of a string is the minimum of the ngram hash values of each seed, so
+ * the fraction of matching signature values of two strings estimates the Jaccard
+ * similarity of their sets of ngrams.
+ *
+ * A string with fewer than `width` characters is hashed as a single ngram.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abcde", "bcdea", null]
+ * m = minhash(s, [0, 1], 4)
+ * m is a lists column [[min(h0("abcd"), h0("bcde")), min(h1("abcd"), h1("bcde"))],
+ *                      [min(h0("bcde"), h0("cdea")), min(h1("bcde"), h1("cdea"))],
+ *                      null]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `seeds` is not a UINT32 column without nulls
+ * @throw cudf::logic_error if `seeds` is empty
+ * @throw cudf::logic_error if `width < 2`
+ *
+ * @param strings Strings column to compute the signatures of.
+ * @param seeds Seeds of the hash functions, one signature value per seed.
+ * @param width The number of characters of each ngram.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of UINT32 with `seeds.size()` values per row, null for the null rows.
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::column_view const& seeds,
+  cudf::size_type width               = 4,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the hash value of each band of the minhash signatures.
+ *
+ * Each signature is split into bands of `rows_per_band` consecutive values and each band
+ * is hashed with its position, for locality-sensitive hashing. Two strings are candidate
+ * near-duplicates if a band of each has the same hash value, and since the band position
+ * is part of the hash, candidates can be found by grouping the exploded band values.
+ * Values at the end of a signature not filling a band are ignored.
+ *
+ * @code{.pseudo}
+ * Example:
+ * m = [[1, 2, 3, 4, 5], [1, 2, 7, 8, 5]]
+ * b = minhash_bands(m, 2)
+ * b is [[h([1, 2], 0), h([3, 4], 1)], [h([1, 2], 0), h([7, 8], 1)]]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `signatures` is not a lists column of UINT32 values
+ * @throw cudf::logic_error if `rows_per_band < 1`
+ *
+ * @param signatures Lists column of signatures, as returned by `minhash`.
+ * @param rows_per_band The number of signature values of each band.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of UINT32 with a value per band, null for the null rows.
+ */
+std::unique_ptr<cudf::column> minhash_bands(
+  cudf::lists_column_view const& signatures,
+  cudf::size_type rows_per_band,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
@@ -83,5 +83,45 @@ std::unique_ptr<cudf::column> ngrams_tokenize(
   cudf::string_scalar const& separator = cudf::string_scalar{"_"},
   rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Tokenizes the strings and hashes the ngrams of tokens of each string.
+ *
+ * The tokens and ngrams are identified as in `ngrams_tokenize` and each ngram is
+ * hashed with the MurmurHash3_32 algorithm as the tokens joined with the `separator`,
+ * so the values are the hashes of the strings `ngrams_tokenize` would return, without
+ * building them. Unlike `ngrams_tokenize`, the hashes are returned as one list per
+ * row, in the order of their ngrams within the string.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["a b c", "d", null]
+ * h = hash_ngrams_tokenize(s, 2, " ", "_")
+ * h is a lists column [[h("a_b"), h("b_c")], [], null]
+ * @endcode
+ *
+ * A string with fewer tokens than `ngrams` produces an empty list and
+ * a null row produces a null list.
+ *
+ * @throw cudf::logic_error if `ngrams < 1`
+ *
+ * @param strings Strings column to tokenize and produce ngrams from.
+ * @param ngrams The ngram number to generate.
+ *               Default is 2 = bigram.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param separator The string placed between the tokens of each hashed ngram.
+ *                  Default is "_" character.
+ * @param seed The seed of the hash function.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of UINT32 hash values, one list per row.
+ */
+std::unique_ptr<cudf::column> hash_ngrams_tokenize(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams               = 2,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  cudf::string_scalar const& separator = cudf::string_scalar{"_"},
+  uint32_t seed                        = cudf::DEFAULT_HASH_SEED,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -55,7 +55,7 @@ struct hashed_vocabulary {
  *
  * @param filename_hashed_vocabulary A path to the preprocessed vocab.txt file.
  *        Note that this is the file AFTER python/perfect_hash.py has been used
- *        for preprocessing.
+ *        for preprocessing. This may also be a file created by `save_vocabulary_file`.
  * @param mr Memory resource to allocate any returned objects.
  * @return vocabulary hash-table elements
  */
@@ -63,6 +63,22 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   std::string const& filename_hashed_vocabulary,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Save the hashed vocabulary into a binary file.
+ *
+ * The binary file holds the vocabulary arrays as they are laid out in device memory so that
+ * `load_vocabulary_file` can load it with a single read and without parsing, which is much
+ * faster than loading the text file created by python/perfect_hash.py.
+ *
+ * @throw cudf::logic_error if the vocabulary columns are missing or do not match `num_bins`.
+ * @throw cudf::logic_error if the file could not be written.
+ *
+ * @param vocabulary The hashed vocabulary to save.
+ * @param filename_hashed_vocabulary A path to the binary file to create.
+ */
+void save_vocabulary_file(hashed_vocabulary const& vocabulary,
+                          std::string const& filename_hashed_vocabulary);
+
 /**
  * @brief Result object for the subword_tokenize functions.
  */
@@ -179,5 +195,50 @@ tokenizer_result subword_tokenize(
   uint32_t max_rows_tensor,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Tokenizes the strings into pre-allocated token-ids, attention-mask and metadata columns.
+ *
+ * This produces the same tensor rows as the subword_tokenize functions above but writes them
+ * into the first rows of the provided columns instead of allocating new ones. The columns can be
+ * reused for each batch of rows of a larger strings column, created with `cudf::slice`, so the
+ * output memory stays fixed while the working memory is bounded by the size of a batch.
+ *
+ * The capacity in tensor rows is `tensor_token_ids.size() / max_sequence_length`. The rows after
+ * the returned number of rows are not modified. The row-ids in the metadata are the indices of
+ * the strings within `strings`.
+ *
+ * @throw cudf::logic_error if `stride > max_sequence_length` or `max_sequence_length == 0`
+ * @throw cudf::logic_error if the output columns are not UINT32 columns without a null mask
+ * @throw cudf::logic_error if `tensor_attention_mask` has fewer elements than the capacity
+ *        times `max_sequence_length`, or `tensor_metadata` fewer than the capacity times 3
+ * @throw cudf::logic_error if the strings generate more rows than the capacity
+ *
+ * @param strings The input strings to tokenize.
+ * @param vocabulary_table The vocabulary table pre-loaded into this object.
+ * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+ *        for each string.
+ * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+ *        the token-ids from the previous row, unless it is the first string.
+ * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+ *        input stream to lower-case and strip accents from those characters.
+ *        If false, accented and uppercase characters are not transformed.
+ * @param do_truncate If true, the tokenizer will discard all the token-ids after
+ *        `max_sequence_length` for each input string. If false, it will use a new row
+ *        in the output token-ids to continue generating the output.
+ * @param tensor_token_ids Output token-ids, `max_sequence_length` per tensor row.
+ * @param tensor_attention_mask Output attention-mask, `max_sequence_length` per tensor row.
+ * @param tensor_metadata Output metadata, three elements per tensor row.
+ * @return The number of tensor rows written
+ */
+uint32_t subword_tokenize(cudf::strings_column_view const& strings,
+                          hashed_vocabulary const& vocabulary_table,
+                          uint32_t max_sequence_length,
+                          uint32_t stride,
+                          bool do_lower_case,
+                          bool do_truncate,
+                          cudf::mutable_column_view& tensor_token_ids,
+                          cudf::mutable_column_view& tensor_attention_mask,
+                          cudf::mutable_column_view& tensor_metadata);
+
 /** @} */  // end of group
 }  // namespace nvtext
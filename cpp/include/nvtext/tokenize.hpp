@@ -215,5 +215,66 @@ std::unique_ptr<cudf::column> detokenize(
   cudf::string_scalar const& separator = cudf::string_scalar(" "),
   rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The vocabulary data for use with the tokenize_with_vocabulary function.
+ *
+ * The strings of the vocabulary are placed in `2 x vocabulary.size()` hash bins
+ * and the id of each token is its row in the vocabulary.
+ */
+struct tokenize_vocabulary {
+  std::unique_ptr<cudf::column> vocabulary;   // strings
+  std::unique_ptr<cudf::column> bin_offsets;  // int32, offsets of each bin into bin_rows
+  std::unique_ptr<cudf::column> bin_rows;     // int32, vocabulary rows of each bin
+};
+
+/**
+ * @brief Creates a hashed vocabulary table for use with tokenize_with_vocabulary.
+ *
+ * The object here can be used to call tokenize_with_vocabulary without incurring
+ * the cost of building the same table each time.
+ *
+ * @throw cudf::logic_error if `vocabulary` is empty or contains nulls
+ *
+ * @param vocabulary Strings of the vocabulary, the id of each string is its row.
+ * @param mr Device memory resource used to allocate the returned object's device memory.
+ * @return The vocabulary and its hash bins
+ */
+std::unique_ptr<tokenize_vocabulary> load_vocabulary(
+  cudf::strings_column_view const& vocabulary,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the vocabulary ids of the tokens of each string.
+ *
+ * The strings are tokenized like `tokenize()` using the `delimiter` characters and
+ * the id of each token is looked up in the `vocabulary` without building a column
+ * of the tokens. Tokens that are not found are assigned the `default_id`.
+ * A token found more than once in the vocabulary is assigned its first row.
+ *
+ * @code{.pseudo}
+ * Example:
+ * v = load_vocabulary(["the", "fox", "jumped"])
+ * s = ["the fox jumped over", null, "the dog"]
+ * t = tokenize_with_vocabulary(s, v)
+ * t is now [[0, 1, 2, -1], null, [0, -1]]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `delimiter` is invalid
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary The vocabulary hash table created by load_vocabulary.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param default_id The id of the tokens that are not in the vocabulary.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of INT32 token ids, null for the null rows.
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(
+  cudf::strings_column_view const& strings,
+  tokenize_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  cudf::size_type default_id           = -1,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of tokenize group
 }  // namespace nvtext
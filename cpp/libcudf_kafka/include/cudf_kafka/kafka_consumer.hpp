@@ -18,16 +18,127 @@
 #include <librdkafka/rdkafkacpp.h>
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cudf/io/datasource.hpp>
+#include <cudf/table/table.hpp>
+#include <deque>
+#include <exception>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
 
+class kafka_consumer;
+
+/**
+ * @brief Batch of Kafka messages whose payloads are staged back to back in pinned host memory
+ *
+ * The batch is a datasource of its payloads, each followed by the delimiter of the batch, so that
+ * the CSV and JSON readers read it without further copies on the host and copy it to the device
+ * from pinned memory.
+ *
+ * @ingroup io_datasources
+ */
+class kafka_message_batch : public cudf::io::datasource {
+ public:
+  /**
+   * @brief Returns a buffer with a subset of the staged payloads, without copying them
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   *
+   * @return The data buffer
+   */
+  std::unique_ptr<cudf::io::datasource::buffer> host_read(size_t offset, size_t size) override;
+
+  /**
+   * @brief Reads a selected range into a preallocated buffer.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing host memory
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  /**
+   * @brief Returns the size of the staged payloads and delimiters in bytes
+   */
+  size_t size() const override { return _size; }
+
+  /**
+   * @brief Returns the number of messages of the batch
+   */
+  size_t num_messages() const { return _payload_lengths.size(); }
+
+  /**
+   * @brief Returns the partition of each message
+   */
+  std::vector<int32_t> const &partitions() const { return _partitions; }
+
+  /**
+   * @brief Returns the Kafka offset of each message
+   */
+  std::vector<int64_t> const &message_offsets() const { return _message_offsets; }
+
+  /**
+   * @brief Returns the byte offset of the payload of each message in the staged data
+   */
+  std::vector<size_t> const &payload_offsets() const { return _payload_offsets; }
+
+  /**
+   * @brief Returns the size in bytes of the payload of each message
+   */
+  std::vector<size_t> const &payload_lengths() const { return _payload_lengths; }
+
+  /**
+   * @brief Returns the offset of the next message to consume from each partition of the batch
+   *
+   * Messages that didn't fit in the batch are consumed again from these offsets.
+   */
+  std::map<int, int64_t> const &next_offsets() const { return _next_offsets; }
+
+  /**
+   * @brief Copies the batch to the device as a table
+   *
+   * The table has the partition (INT32), the Kafka offset (INT64), and the payload without
+   * delimiter (STRING) of each message. The staged data are copied to the device at once.
+   *
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   *
+   * @return Table of the messages
+   */
+  std::unique_ptr<cudf::table> to_table(
+    rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource()) const;
+
+  virtual ~kafka_message_batch();
+
+ private:
+  friend class kafka_consumer;
+
+  kafka_message_batch(size_t capacity, std::string const &delimiter);
+
+  uint8_t *_data = nullptr;  // pinned host memory of `_capacity` bytes
+  size_t _capacity;
+  size_t _size = 0;
+  std::string _delimiter;
+
+  std::vector<int32_t> _partitions;
+  std::vector<int64_t> _message_offsets;
+  std::vector<size_t> _payload_offsets;
+  std::vector<size_t> _payload_lengths;
+  std::map<int, int64_t> _next_offsets;
+};
+
 /**
  * @brief libcudf datasource for Apache Kafka
  *
@@ -114,6 +225,31 @@ class kafka_consumer : public cudf::io::datasource {
    */
   void commit_offset(std::string const &topic, int partition, int64_t offset);
 
+  /**
+   * @brief Consumes a batch of messages from partitions of a topic, each partition in its own
+   * thread
+   *
+   * The capacity of the batch is split evenly between the partitions, and the payloads of each
+   * partition are staged in pinned host memory by its thread once its messages are consumed. A
+   * partition stops at the first message that doesn't fit in its share of the batch, at the end of
+   * the partition, or after `batch_timeout`.
+   *
+   * @throws cudf::logic_error on failure to assign the partitions or to consume a message
+   *
+   * @param[in] topic Name of the Kafka topic to consume from
+   * @param[in] start_offsets Offset of the first message to consume from each partition
+   * @param[in] batch_size Capacity of the batch in bytes, including the delimiters
+   * @param[in] batch_timeout Maximum (millisecond) read time allowed
+   * @param[in] delimiter Delimiter staged after each payload, Ex: "\n" for the JSON lines reader
+   *
+   * @return The batch of messages
+   */
+  std::unique_ptr<kafka_message_batch> consume_batch(std::string const &topic,
+                                                     std::map<int, int64_t> const &start_offsets,
+                                                     size_t batch_size,
+                                                     int batch_timeout,
+                                                     std::string const &delimiter = "");
+
   /**
    * @brief Retrieve the watermark offset values for a topic/partition
    *
@@ -201,6 +337,78 @@ class kafka_consumer : public cudf::io::datasource {
   void consume_to_buffer();
 };
 
+/**
+ * @brief Consumes batches of messages in a background thread, ahead of their processing
+ *
+ * The prefetcher calls `kafka_consumer::consume_batch` in a loop, each batch starting from the
+ * next offsets of the previous one, and queues the batches until `next` returns them. Consumption
+ * pauses while the capacity of the queued batches reaches the high-water mark, which bounds the
+ * pinned memory held by the prefetcher. The consumer must not be used otherwise while it is
+ * prefetching.
+ */
+class kafka_batch_prefetcher {
+ public:
+  /**
+   * @brief Starts prefetching batches of messages
+   *
+   * @param[in] consumer Consumer of the messages, which must outlive the prefetcher
+   * @param[in] topic Name of the Kafka topic to consume from
+   * @param[in] start_offsets Offset of the first message to consume from each partition
+   * @param[in] batch_size Capacity of each batch in bytes, including the delimiters
+   * @param[in] batch_timeout Maximum (millisecond) read time allowed for each batch
+   * @param[in] high_water_mark Capacity in bytes of the queued batches at which consumption
+   * pauses, at least one batch being queued
+   * @param[in] delimiter Delimiter staged after each payload
+   */
+  kafka_batch_prefetcher(kafka_consumer &consumer,
+                         std::string const &topic,
+                         std::map<int, int64_t> const &start_offsets,
+                         size_t batch_size,
+                         int batch_timeout,
+                         size_t high_water_mark,
+                         std::string const &delimiter = "");
+
+  /**
+   * @brief Returns the next batch, waiting for it to be consumed if none is queued
+   *
+   * Batches are returned in the order of their offsets, and may be empty if no message arrived
+   * within `batch_timeout`.
+   *
+   * @throws cudf::logic_error if consuming a batch failed
+   *
+   * @return The next batch of messages
+   */
+  std::unique_ptr<kafka_message_batch> next();
+
+  /**
+   * @brief Returns the number of batches consumed and not yet returned by `next`
+   */
+  size_t num_queued();
+
+  /**
+   * @brief Stops prefetching, waiting for the batch being consumed
+   */
+  virtual ~kafka_batch_prefetcher();
+
+ private:
+  void prefetch();
+
+  kafka_consumer &consumer;
+  std::string topic;
+  std::map<int, int64_t> offsets;  // next offset of each partition
+  size_t batch_size;
+  int batch_timeout;
+  size_t max_queued;  // number of batches of the high-water mark
+  std::string delimiter;
+
+  std::mutex mutex;
+  std::condition_variable queue_changed;
+  std::deque<std::unique_ptr<kafka_message_batch>> queue;
+  std::exception_ptr error;
+  bool stopped = false;
+  std::thread worker;
+};
+
 }  // namespace kafka
 }  // namespace external
 }  // namespace io
@@ -15,15 +15,107 @@
  */
 
 #include "cudf_kafka/kafka_consumer.hpp"
+#include <cuda_runtime.h>
 #include <librdkafka/rdkafkacpp.h>
+#include <thrust/pair.h>
 #include <chrono>
+#include <cstring>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/utilities/error.hpp>
 #include <memory>
+#include <numeric>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <thread>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
 
+kafka_message_batch::kafka_message_batch(size_t capacity, std::string const &delimiter)
+  : _capacity(capacity), _delimiter(delimiter)
+{
+  if (_capacity > 0) { CUDA_TRY(cudaMallocHost(&_data, _capacity)); }
+}
+
+kafka_message_batch::~kafka_message_batch()
+{
+  if (_data != nullptr) { cudaFreeHost(_data); }
+}
+
+std::unique_ptr<cudf::io::datasource::buffer> kafka_message_batch::host_read(size_t offset,
+                                                                             size_t size)
+{
+  offset = std::min(offset, _size);
+  size   = std::min(size, _size - offset);
+  return std::make_unique<non_owning_buffer>(_data + offset, size);
+}
+
+size_t kafka_message_batch::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  if (offset > _size) { return 0; }
+  auto const read_size = std::min(size, _size - offset);
+  std::memcpy(dst, _data + offset, read_size);
+  return read_size;
+}
+
+namespace {
+
+/**
+ * @brief Copies a host vector to a new column of `type`.
+ */
+template <typename T>
+std::unique_ptr<cudf::column> make_column(cudf::data_type type,
+                                          std::vector<T> const &values,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource *mr)
+{
+  auto result = cudf::make_fixed_width_column(
+    type, static_cast<cudf::size_type>(values.size()), cudf::mask_state::UNALLOCATED, stream, mr);
+  CUDA_TRY(cudaMemcpyAsync(result->mutable_view().data<T>(),
+                           values.data(),
+                           values.size() * sizeof(T),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  return result;
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::table> kafka_message_batch::to_table(
+  rmm::mr::device_memory_resource *mr) const
+{
+  auto const stream = rmm::cuda_stream_default;
+
+  // the staged data are copied at once, and the payloads gathered without their delimiters
+  rmm::device_buffer d_data(_size, stream);
+  CUDA_TRY(cudaMemcpyAsync(d_data.data(), _data, _size, cudaMemcpyHostToDevice, stream.value()));
+  auto const d_chars = static_cast<char const *>(d_data.data());
+
+  std::vector<thrust::pair<char const *, cudf::size_type>> payloads;
+  for (size_t idx = 0; idx < num_messages(); ++idx) {
+    payloads.emplace_back(d_chars + _payload_offsets[idx],
+                          static_cast<cudf::size_type>(_payload_lengths[idx]));
+  }
+  rmm::device_uvector<thrust::pair<char const *, cudf::size_type>> d_payloads(payloads.size(),
+                                                                              stream);
+  CUDA_TRY(cudaMemcpyAsync(d_payloads.data(),
+                           payloads.data(),
+                           payloads.size() * sizeof(payloads[0]),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(make_column(cudf::data_type{cudf::type_id::INT32}, _partitions, stream, mr));
+  columns.push_back(
+    make_column(cudf::data_type{cudf::type_id::INT64}, _message_offsets, stream, mr));
+  columns.push_back(cudf::make_strings_column(d_payloads, stream, mr));
+  stream.synchronize();
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
 kafka_consumer::kafka_consumer(std::map<std::string, std::string> const &configs)
   : kafka_conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL))
 {
@@ -92,7 +184,7 @@ size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t *dst)
 {
   if (offset > buffer.size()) { return 0; }
   auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  memcpy(dst, buffer.data() + offset, read_size);
   return read_size;
 }
 
@@ -121,7 +213,7 @@ void kafka_consumer::consume_to_buffer()
       consumer->consume((end - std::chrono::steady_clock::now()).count())};
 
     if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char *>(msg->payload()));
+      buffer.append(static_cast<char *>(msg->payload()), msg->len());
       buffer.append(delimiter);
       messages_read++;
     } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
@@ -223,6 +315,111 @@ void kafka_consumer::commit_offset(std::string const &topic, int partition, int6
                "Failed to commit consumer offsets");
 }
 
+std::unique_ptr<kafka_message_batch> kafka_consumer::consume_batch(
+  std::string const &topic,
+  std::map<int, int64_t> const &start_offsets,
+  size_t batch_size,
+  int batch_timeout,
+  std::string const &delimiter)
+{
+  std::unique_ptr<kafka_message_batch> batch{new kafka_message_batch(batch_size, delimiter)};
+  if (start_offsets.empty()) { return batch; }
+
+  std::vector<RdKafka::TopicPartition *> topic_partitions;
+  for (auto const &partition_offset : start_offsets) {
+    topic_partitions.push_back(
+      RdKafka::TopicPartition::create(topic, partition_offset.first, partition_offset.second));
+  }
+  auto const err = consumer->assign(topic_partitions);
+
+  // the messages of each partition are served by its own queue instead of the consumer's
+  std::vector<std::unique_ptr<RdKafka::Queue>> queues;
+  if (err == RdKafka::ErrorCode::ERR_NO_ERROR) {
+    for (auto toppar : topic_partitions) {
+      queues.emplace_back(consumer->get_partition_queue(toppar));
+      if (queues.back()) { queues.back()->forward(nullptr); }
+    }
+  }
+  RdKafka::TopicPartition::destroy(topic_partitions);
+  CUDF_EXPECTS(err == RdKafka::ErrorCode::ERR_NO_ERROR, "Failed to assign Kafka partitions");
+  CUDF_EXPECTS(std::all_of(queues.begin(), queues.end(), [](auto const &queue) { return queue; }),
+               "Failed to get Kafka partition queues");
+
+  auto const num_partitions = start_offsets.size();
+  auto const quota          = batch_size / num_partitions;
+  auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+  std::vector<std::vector<std::unique_ptr<RdKafka::Message>>> messages(num_partitions);
+  std::vector<RdKafka::ErrorCode> errors(num_partitions, RdKafka::ErrorCode::ERR_NO_ERROR);
+
+  // each thread consumes the messages of a partition that fit in its share of the batch
+  auto consume_partition = [&](size_t idx) {
+    size_t used = 0;
+    while (end > std::chrono::steady_clock::now()) {
+      auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        end - std::chrono::steady_clock::now());
+      std::unique_ptr<RdKafka::Message> msg{queues[idx]->consume(remaining.count())};
+      if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
+        auto const size = msg->len() + delimiter.size();
+        if (used + size > quota) { break; }
+        used += size;
+        messages[idx].push_back(std::move(msg));
+      } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+        break;
+      } else if (msg->err() != RdKafka::ErrorCode::ERR__TIMED_OUT) {
+        errors[idx] = msg->err();
+        break;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t idx = 0; idx < num_partitions; ++idx) {
+    threads.emplace_back(consume_partition, idx);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  CUDF_EXPECTS(std::all_of(errors.begin(),
+                           errors.end(),
+                           [](auto err) { return err == RdKafka::ErrorCode::ERR_NO_ERROR; }),
+               "Failed to consume Kafka messages");
+
+  // the payloads are staged in the order of the partitions
+  std::vector<size_t> partition_offsets(num_partitions + 1, 0);
+  auto partition_offset = start_offsets.begin();
+  for (size_t idx = 0; idx < num_partitions; ++idx, ++partition_offset) {
+    size_t size = 0;
+    for (auto const &msg : messages[idx]) {
+      batch->_partitions.push_back(partition_offset->first);
+      batch->_message_offsets.push_back(msg->offset());
+      batch->_payload_offsets.push_back(partition_offsets[idx] + size);
+      batch->_payload_lengths.push_back(msg->len());
+      size += msg->len() + delimiter.size();
+    }
+    partition_offsets[idx + 1] = partition_offsets[idx] + size;
+    batch->_next_offsets[partition_offset->first] =
+      messages[idx].empty() ? partition_offset->second : messages[idx].back()->offset() + 1;
+  }
+  batch->_size = partition_offsets.back();
+
+  // each thread copies the payloads of a partition to its range of the pinned memory
+  auto stage_partition = [&](size_t idx) {
+    auto dst = batch->_data + partition_offsets[idx];
+    for (auto const &msg : messages[idx]) {
+      std::memcpy(dst, msg->payload(), msg->len());
+      std::memcpy(dst + msg->len(), delimiter.data(), delimiter.size());
+      dst += msg->len() + delimiter.size();
+    }
+  };
+  threads.clear();
+  for (size_t idx = 0; idx < num_partitions; ++idx) {
+    threads.emplace_back(stage_partition, idx);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return batch;
+}
+
 void kafka_consumer::unsubscribe()
 {
   CUDF_EXPECTS(RdKafka::ErrorCode::ERR_NO_ERROR == consumer.get()->unassign(),
@@ -236,6 +433,78 @@ void kafka_consumer::close(int timeout)
   kafka_conf.reset(nullptr);
 }
 
+kafka_batch_prefetcher::kafka_batch_prefetcher(kafka_consumer &consumer,
+                                               std::string const &topic,
+                                               std::map<int, int64_t> const &start_offsets,
+                                               size_t batch_size,
+                                               int batch_timeout,
+                                               size_t high_water_mark,
+                                               std::string const &delimiter)
+  : consumer(consumer),
+    topic(topic),
+    offsets(start_offsets),
+    batch_size(batch_size),
+    batch_timeout(batch_timeout),
+    max_queued(std::max<size_t>(batch_size == 0 ? 1 : high_water_mark / batch_size, 1)),
+    delimiter(delimiter)
+{
+  worker = std::thread(&kafka_batch_prefetcher::prefetch, this);
+}
+
+kafka_batch_prefetcher::~kafka_batch_prefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+  }
+  queue_changed.notify_all();
+  worker.join();
+}
+
+void kafka_batch_prefetcher::prefetch()
+{
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      queue_changed.wait(lock, [this] { return stopped || queue.size() < max_queued; });
+      if (stopped) { return; }
+    }
+    // the batch is consumed without the lock, while the previous batches are processed
+    try {
+      auto batch = consumer.consume_batch(topic, offsets, batch_size, batch_timeout, delimiter);
+      offsets    = batch->next_offsets();
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.push_back(std::move(batch));
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      error   = std::current_exception();
+      stopped = true;
+    }
+    queue_changed.notify_all();
+  }
+}
+
+std::unique_ptr<kafka_message_batch> kafka_batch_prefetcher::next()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  queue_changed.wait(lock, [this] { return !queue.empty() || stopped; });
+  if (queue.empty()) {
+    if (error) { std::rethrow_exception(error); }
+    CUDF_FAIL("Kafka batch prefetcher was stopped");
+  }
+  auto batch = std::move(queue.front());
+  queue.pop_front();
+  lock.unlock();
+  queue_changed.notify_all();
+  return batch;
+}
+
+size_t kafka_batch_prefetcher::num_queued()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return queue.size();
+}
+
 }  // namespace kafka
 }  // namespace external
 }  // namespace io
@@ -54,3 +54,34 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
   EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs, "csv-topic", 0, 0, 3, 5000, "\n"),
                cudf::logic_error);
 }
+
+TEST_F(KafkaDatasourceTest, EmptyBatch)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+  kafka_configs.insert({"group.id", "cudf-kafka-test"});
+
+  kafka::kafka_consumer kc(kafka_configs);
+  auto const batch = kc.consume_batch("csv-topic", {}, 1024, 5000, "\n");
+
+  EXPECT_EQ(batch->num_messages(), 0u);
+  EXPECT_EQ(batch->size(), 0u);
+  EXPECT_TRUE(batch->next_offsets().empty());
+  EXPECT_EQ(batch->host_read(0, 16)->size(), 0u);
+}
+
+TEST_F(KafkaDatasourceTest, PrefetchHighWaterMark)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+  kafka_configs.insert({"group.id", "cudf-kafka-test"});
+
+  kafka::kafka_consumer kc(kafka_configs);
+  kafka::kafka_batch_prefetcher prefetcher(kc, "csv-topic", {}, 1024, 100, 2048);
+
+  for (int i = 0; i < 4; ++i) {
+    auto const batch = prefetcher.next();
+    EXPECT_EQ(batch->num_messages(), 0u);
+    EXPECT_LE(prefetcher.num_queued(), 2u);
+  }
+}
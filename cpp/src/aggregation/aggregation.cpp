@@ -88,6 +88,16 @@ std::unique_ptr<aggregation> make_std_aggregation(size_type ddof)
 {
   return std::make_unique<detail::std_aggregation>(ddof);
 };
+/// Factory to create a M2 aggregation
+std::unique_ptr<aggregation> make_m2_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::M2);
+}
+/// Factory to create a MERGE_M2 aggregation
+std::unique_ptr<aggregation> make_merge_m2_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::MERGE_M2);
+}
 /// Factory to create a MEDIAN aggregation
 std::unique_ptr<aggregation> make_median_aggregation()
 {
@@ -100,6 +110,16 @@ std::unique_ptr<aggregation> make_quantile_aggregation(std::vector<double> const
 {
   return std::make_unique<detail::quantile_aggregation>(q, i);
 }
+/// Factory to create a TDIGEST aggregation
+std::unique_ptr<aggregation> make_tdigest_aggregation(int max_centroids)
+{
+  return std::make_unique<detail::tdigest_aggregation>(aggregation::TDIGEST, max_centroids);
+}
+/// Factory to create a MERGE_TDIGEST aggregation
+std::unique_ptr<aggregation> make_merge_tdigest_aggregation(int max_centroids)
+{
+  return std::make_unique<detail::tdigest_aggregation>(aggregation::MERGE_TDIGEST, max_centroids);
+}
 /// Factory to create a ARGMAX aggregation
 std::unique_ptr<aggregation> make_argmax_aggregation()
 {
@@ -115,6 +135,25 @@ std::unique_ptr<aggregation> make_nunique_aggregation(null_policy null_handling)
 {
   return std::make_unique<detail::nunique_aggregation>(null_handling);
 }
+/// Factory to create an APPROX_NUNIQUE aggregation
+std::unique_ptr<aggregation> make_approx_nunique_aggregation(null_policy null_handling,
+                                                             int32_t precision)
+{
+  return std::make_unique<detail::approx_nunique_aggregation>(
+    aggregation::APPROX_NUNIQUE, null_handling, precision);
+}
+/// Factory to create a NUNIQUE_SKETCH aggregation
+std::unique_ptr<aggregation> make_nunique_sketch_aggregation(null_policy null_handling,
+                                                             int32_t precision)
+{
+  return std::make_unique<detail::approx_nunique_aggregation>(
+    aggregation::NUNIQUE_SKETCH, null_handling, precision);
+}
+/// Factory to create a MERGE_NUNIQUE aggregation
+std::unique_ptr<aggregation> make_merge_nunique_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::MERGE_NUNIQUE);
+}
 /// Factory to create a NTH_ELEMENT aggregation
 std::unique_ptr<aggregation> make_nth_element_aggregation(size_type n, null_policy null_handling)
 {
@@ -125,11 +164,31 @@ std::unique_ptr<aggregation> make_row_number_aggregation()
 {
   return std::make_unique<aggregation>(aggregation::ROW_NUMBER);
 }
+/// Factory to create a RANK aggregation
+std::unique_ptr<aggregation> make_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::RANK);
+}
+/// Factory to create a DENSE_RANK aggregation
+std::unique_ptr<aggregation> make_dense_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::DENSE_RANK);
+}
+/// Factory to create a PERCENT_RANK aggregation
+std::unique_ptr<aggregation> make_percent_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::PERCENT_RANK);
+}
 /// Factory to create a COLLECT_LIST aggregation
 std::unique_ptr<aggregation> make_collect_list_aggregation(null_policy null_handling)
 {
   return std::make_unique<detail::collect_list_aggregation>(null_handling);
 }
+/// Factory to create a TOP_K aggregation
+std::unique_ptr<aggregation> make_top_k_aggregation(size_type k, order column_order)
+{
+  return std::make_unique<detail::top_k_aggregation>(k, column_order);
+}
 /// Factory to create a COLLECT_SET aggregation
 std::unique_ptr<aggregation> make_collect_set_aggregation(null_policy null_handling,
                                                           null_equality nulls_equal,
@@ -167,8 +226,9 @@ struct target_type_functor {
   constexpr data_type operator()() const noexcept
   {
     auto const id = type_to_id<target_type_t<Source, k>>();
-    return id == type_id::DECIMAL32 || id == type_id::DECIMAL64 ? data_type{id, type.scale()}
-                                                                : data_type{id};
+    return id == type_id::DECIMAL32 || id == type_id::DECIMAL64 || id == type_id::DECIMAL128
+             ? data_type{id, type.scale()}
+             : data_type{id};
   }
 };
 
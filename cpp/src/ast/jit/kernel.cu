@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cudf/types.hpp>
+
+#include <ast/jit/expression-udf.hpp>
+
+namespace cudf {
+namespace ast {
+namespace jit {
+
+/**
+ * @brief Kernel for evaluating a generated expression on a table to produce a new column.
+ *
+ * The `evaluate_expression` function is generated from the linearized expression and reads
+ * the values of a row from the column and literal pointers in `inputs`.
+ *
+ * @tparam OutType The type of the output column.
+ * @param size The number of rows of the table.
+ * @param out_data The data of the output column.
+ * @param inputs The data of the table columns, followed by the values of the literals.
+ */
+template <typename OutType>
+__global__ void kernel(cudf::size_type size, OutType* out_data, void const* const* inputs)
+{
+  int tid    = threadIdx.x;
+  int blkid  = blockIdx.x;
+  int blksz  = blockDim.x;
+  int gridsz = gridDim.x;
+
+  int start = tid + blkid * blksz;
+  int step  = blksz * gridsz;
+
+  for (cudf::size_type i = start; i < size; i += step) {
+    out_data[i] = static_cast<OutType>(evaluate_expression(i, inputs));
+  }
+}
+
+}  // namespace jit
+}  // namespace ast
+}  // namespace cudf
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ast/jit_expression.hpp>
+
+#include <jit_preprocessed_files/ast/jit/kernel.cu.jit.hpp>
+
+#include <jit/cache.hpp>
+#include <jit/type.hpp>
+
+#include <cudf/ast/detail/linearizer.hpp>
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/operators.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <chrono>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf {
+namespace ast {
+namespace jit {
+namespace {
+
+std::string cast(data_type type, std::string const& value)
+{
+  return "static_cast<" + cudf::jit::get_type_name(type) + ">(" + value + ")";
+}
+
+bool is_unsigned(data_type type)
+{
+  switch (type.id()) {
+    case type_id::BOOL8:
+    case type_id::UINT8:
+    case type_id::UINT16:
+    case type_id::UINT32:
+    case type_id::UINT64: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns the name of a math function for the precision of its return type.
+ */
+std::string math_function(std::string const& name, data_type type)
+{
+  return type.id() == type_id::FLOAT32 ? name + "f" : name;
+}
+
+/**
+ * @brief Returns the CUDA expression of an operator.
+ *
+ * The expressions match the operator functors of the interpreter, which take the operands
+ * by value, so the result has the same type and value. The generated code is only used if no
+ * operand can be null. Math functions are called on operands converted to the return type,
+ * like the `std` overloads of integral types.
+ */
+std::string operator_expression(ast_operator op,
+                                std::vector<std::string> const& operands,
+                                std::vector<data_type> const& types,
+                                data_type output_type)
+{
+  auto const& lhs        = operands.front();
+  auto const& rhs        = operands.back();
+  auto const double_type = data_type{type_id::FLOAT64};
+  auto const is_float =
+    types.front().id() == type_id::FLOAT32 || types.front().id() == type_id::FLOAT64;
+  auto const mod_function = math_function("fmod", types.front());
+  auto const unary_math   = [&](std::string const& name) {
+    return math_function(name, output_type) + "(" + cast(output_type, lhs) + ")";
+  };
+
+  switch (op) {
+    case ast_operator::ADD: return lhs + " + " + rhs;
+    case ast_operator::SUB: return lhs + " - " + rhs;
+    case ast_operator::MUL: return lhs + " * " + rhs;
+    case ast_operator::DIV: return lhs + " / " + rhs;
+    case ast_operator::TRUE_DIV: return cast(double_type, lhs) + " / " + cast(double_type, rhs);
+    case ast_operator::FLOOR_DIV:
+      return "floor(" + cast(double_type, lhs) + " / " + cast(double_type, rhs) + ")";
+    case ast_operator::MOD:
+      return is_float ? mod_function + "(" + lhs + ", " + rhs + ")" : lhs + " % " + rhs;
+    case ast_operator::PYMOD:
+      return is_float ? mod_function + "(" + mod_function + "(" + lhs + ", " + rhs + ") + " + rhs +
+                          ", " + rhs + ")"
+                      : "((" + lhs + " % " + rhs + ") + " + rhs + ") % " + rhs;
+    case ast_operator::POW:
+      return math_function("pow", output_type) + "(" + cast(output_type, lhs) + ", " +
+             cast(output_type, rhs) + ")";
+    case ast_operator::EQUAL: return lhs + " == " + rhs;
+    case ast_operator::NOT_EQUAL: return lhs + " != " + rhs;
+    case ast_operator::LESS: return lhs + " < " + rhs;
+    case ast_operator::GREATER: return lhs + " > " + rhs;
+    case ast_operator::LESS_EQUAL: return lhs + " <= " + rhs;
+    case ast_operator::GREATER_EQUAL: return lhs + " >= " + rhs;
+    case ast_operator::BITWISE_AND: return lhs + " & " + rhs;
+    case ast_operator::BITWISE_OR: return lhs + " | " + rhs;
+    case ast_operator::BITWISE_XOR: return lhs + " ^ " + rhs;
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_AND: return lhs + " && " + rhs;
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_OR: return lhs + " || " + rhs;
+    case ast_operator::IDENTITY: return lhs;
+    case ast_operator::SIN: return unary_math("sin");
+    case ast_operator::COS: return unary_math("cos");
+    case ast_operator::TAN: return unary_math("tan");
+    case ast_operator::ARCSIN: return unary_math("asin");
+    case ast_operator::ARCCOS: return unary_math("acos");
+    case ast_operator::ARCTAN: return unary_math("atan");
+    case ast_operator::SINH: return unary_math("sinh");
+    case ast_operator::COSH: return unary_math("cosh");
+    case ast_operator::TANH: return unary_math("tanh");
+    case ast_operator::ARCSINH: return unary_math("asinh");
+    case ast_operator::ARCCOSH: return unary_math("acosh");
+    case ast_operator::ARCTANH: return unary_math("atanh");
+    case ast_operator::EXP: return unary_math("exp");
+    case ast_operator::LOG: return unary_math("log");
+    case ast_operator::SQRT: return unary_math("sqrt");
+    case ast_operator::CBRT: return unary_math("cbrt");
+    case ast_operator::CEIL: return unary_math("ceil");
+    case ast_operator::FLOOR: return unary_math("floor");
+    case ast_operator::RINT: return unary_math("rint");
+    case ast_operator::ABS:
+      if (is_float) { return unary_math("fabs"); }
+      return is_unsigned(types.front()) ? lhs : "(" + lhs + " < 0 ? -" + lhs + " : " + lhs + ")";
+    case ast_operator::BIT_INVERT: return "~" + lhs;
+    case ast_operator::NOT: return "!" + lhs;
+    case ast_operator::IS_NULL: return "false";
+    default: return {};
+  }
+}
+
+std::string kernel_name(data_type output_type)
+{
+  return jitify2::reflection::Template("cudf::ast::jit::kernel")
+    .instantiate(cudf::jit::get_type_name(output_type));
+}
+
+auto get_kernel(std::string const& name, std::string const& source)
+{
+  return cudf::jit::get_program_cache(*ast_jit_kernel_cu_jit)
+    .get_kernel(name, {}, {{"ast/jit/expression-udf.hpp", source}}, {"-arch=sm_."});
+}
+
+}  // namespace
+
+std::string generate_expression(detail::linearizer const& expr_linearizer,
+                                cudf::size_type num_columns)
+{
+  auto const& data_references         = expr_linearizer.data_references();
+  auto const& operators               = expr_linearizer.operators();
+  auto const& operator_source_indices = expr_linearizer.operator_source_indices();
+
+  // the name and type of the current value of each data reference
+  auto names = std::vector<std::string>(data_references.size());
+  auto types = std::vector<data_type>(data_references.size(), data_type{type_id::EMPTY});
+
+  std::string body;
+  for (std::size_t idx = 0; idx < data_references.size(); ++idx) {
+    auto const& reference = data_references[idx];
+    if (reference.reference_type == detail::device_data_reference_type::INTERMEDIATE ||
+        reference.table_source == table_reference::OUTPUT) {
+      continue;
+    }
+    if (!is_numeric(reference.data_type)) { return {}; }
+    auto const is_column = reference.reference_type == detail::device_data_reference_type::COLUMN;
+    auto const type_name = cudf::jit::get_type_name(reference.data_type);
+    auto const input     = "static_cast<" + type_name + " const*>(inputs[" +
+                       std::to_string(is_column ? reference.data_index
+                                                : num_columns + reference.data_index) +
+                       "])";
+    names[idx] = "r" + std::to_string(idx);
+    types[idx] = reference.data_type;
+    body += "  auto const " + names[idx] + " = " + input + (is_column ? "[row];\n" : "[0];\n");
+  }
+
+  std::size_t source_idx = 0;
+  for (std::size_t op_idx = 0; op_idx < operators.size(); ++op_idx) {
+    auto const op    = operators[op_idx];
+    auto const arity = detail::ast_operator_arity(op);
+    std::vector<std::string> operands;
+    std::vector<data_type> operand_types;
+    for (cudf::size_type operand = 0; operand < arity; ++operand) {
+      auto const reference = operator_source_indices[source_idx++];
+      operands.push_back(names[reference]);
+      operand_types.push_back(types[reference]);
+    }
+    auto const output      = operator_source_indices[source_idx++];
+    auto const output_type = detail::ast_operator_return_type(op, operand_types);
+    if (!is_numeric(output_type)) { return {}; }
+    auto const expression = operator_expression(op, operands, operand_types, output_type);
+    if (expression.empty()) { return {}; }
+    names[output] = "t" + std::to_string(op_idx);
+    types[output] = output_type;
+    body += "  auto const " + names[output] + " = " + cast(output_type, expression) + ";\n";
+  }
+
+  return "#pragma once\n"
+         "__device__ inline auto evaluate_expression(cudf::size_type row,\n"
+         "                                           void const* const* inputs)\n"
+         "{\n" +
+         body + "  return t" + std::to_string(operators.size() - 1) + ";\n}\n";
+}
+
+bool compile_expression(std::string const& source, data_type output_type)
+{
+  static std::mutex kernels_mutex{};
+  static std::unordered_map<std::string, std::shared_future<bool>> kernels{};
+
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  auto const name = kernel_name(output_type);
+  auto const key  = std::to_string(device_id) + "\n" + name + "\n" + source;
+
+  std::lock_guard<std::mutex> kernels_lock(kernels_mutex);
+  auto kernel = kernels.find(key);
+  if (kernel == kernels.end()) {
+    // the compilation runs on its own thread so the callers are not blocked meanwhile
+    auto compiled = std::async(std::launch::async, [device_id, name, source] {
+                      if (cudaSetDevice(device_id) != cudaSuccess) { return false; }
+                      try {
+                        return get_kernel(name, source).ok();
+                      } catch (std::exception const&) {
+                        return false;
+                      }
+                    }).share();
+    kernel = kernels.emplace(key, std::move(compiled)).first;
+  }
+  return kernel->second.wait_for(std::chrono::seconds{0}) == std::future_status::ready &&
+         kernel->second.get();
+}
+
+void launch_expression(std::string const& source,
+                       mutable_column_view output,
+                       void const* const* inputs,
+                       rmm::cuda_stream_view stream)
+{
+  get_kernel(kernel_name(output.type()), source)
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())
+    ->launch(output.size(), cudf::jit::get_data_ptr(output), inputs);
+}
+
+}  // namespace jit
+}  // namespace ast
+}  // namespace cudf
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/detail/linearizer.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <string>
+
+namespace cudf {
+namespace ast {
+namespace jit {
+
+/**
+ * @brief Generates the CUDA source of the `evaluate_expression` function of a linearized
+ * expression.
+ *
+ * The function reads column `i` of a row from `inputs[i]` and literal `j` from
+ * `inputs[num_columns + j]`.
+ *
+ * @param expr_linearizer The linearized expression.
+ * @param num_columns The number of columns of the table the expression is evaluated on.
+ * @return The CUDA source, or an empty string if the expression uses types that are not
+ *         supported by the generated code
+ */
+std::string generate_expression(detail::linearizer const& expr_linearizer,
+                                cudf::size_type num_columns);
+
+/**
+ * @brief Returns true if the kernel of a generated expression is compiled for the current
+ * device.
+ *
+ * The first call for an expression starts compiling its kernel on a separate thread and
+ * returns false, as do the calls made until the compilation is done. The kernels are
+ * compiled through the jitify program cache, so a kernel compiled by an earlier process
+ * is only loaded from the file cache.
+ *
+ * @param source The CUDA source returned by `generate_expression`.
+ * @param output_type The type of the output column.
+ * @return true if the kernel can be launched by `launch_expression`
+ */
+bool compile_expression(std::string const& source, data_type output_type);
+
+/**
+ * @brief Evaluates a compiled expression on each row of a table.
+ *
+ * @param source The CUDA source of a kernel for which `compile_expression` returned true.
+ * @param output The output column, with a row for each row of the table.
+ * @param inputs Device array of the data of the table columns followed by the literals.
+ * @param stream CUDA stream used for the kernel launch.
+ */
+void launch_expression(std::string const& source,
+                       mutable_column_view output,
+                       void const* const* inputs,
+                       rmm::cuda_stream_view stream);
+
+}  // namespace jit
+}  // namespace ast
+}  // namespace cudf
@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <unordered_map>
+#include <vector>
 
 namespace cudf {
 
@@ -56,6 +58,61 @@ device_data_reference::device_data_reference(device_data_reference_type referenc
 {
 }
 
+namespace {
+
+/**
+ * @brief Counts the uses of the expression nodes of a tree.
+ *
+ * The operands of a node are only counted the first time the node is used, since the node is only
+ * evaluated once.
+ */
+void count_uses(node const& root, std::unordered_map<node const*, cudf::size_type>& uses)
+{
+  auto const expr = dynamic_cast<expression const*>(&root);
+  if (expr == nullptr || uses[expr]++ > 0) { return; }
+  for (auto const& operand : expr->get_operands()) {
+    count_uses(operand.get(), uses);
+  }
+}
+
+}  // namespace
+
+linearizer::linearizer(std::vector<std::reference_wrapper<expression const>> const& exprs,
+                       cudf::table_view table)
+  : _table(table), _right_table(table), _node_count(0), _intermediate_counter()
+{
+  linearize(std::vector<std::reference_wrapper<const node>>(exprs.cbegin(), exprs.cend()));
+}
+
+void linearizer::linearize(std::vector<std::reference_wrapper<const node>> const& roots)
+{
+  for (auto const& root : roots) {
+    count_uses(root.get(), _remaining_uses);
+  }
+  for (std::size_t root_index = 0; root_index < roots.size(); ++root_index) {
+    _node_count                 = 0;
+    _output_index               = static_cast<cudf::size_type>(root_index);
+    auto const& root            = roots[root_index].get();
+    auto const root_data_index  = root.accept(*this);
+    auto const root_data_source = data_references()[root_data_index];
+    if (root_data_source.table_source != table_reference::OUTPUT) {
+      // The root is also used by another expression, so its result is in an intermediate and is
+      // copied to the output column
+      auto const output_source =
+        detail::device_data_reference(detail::device_data_reference_type::COLUMN,
+                                      root_data_source.data_type,
+                                      _output_index,
+                                      table_reference::OUTPUT);
+      auto const output = add_data_reference(output_source);
+      _operators.push_back(ast_operator::IDENTITY);
+      _operator_source_indices.push_back(root_data_index);
+      _operator_source_indices.push_back(output);
+      release_operand(root, root_data_index);
+    }
+    _root_data_types.push_back(root_data_source.data_type);
+  }
+}
+
 cudf::size_type linearizer::intermediate_counter::take()
 {
   auto const first_missing = find_first_missing();
@@ -111,7 +168,7 @@ cudf::size_type linearizer::visit(column_reference const& expr)
   // Increment the node index
   _node_count++;
   // Resolve node type
-  auto const data_type = expr.get_data_type(_table);
+  auto const data_type = expr.get_data_type(_table, _right_table);
   // Push data reference
   auto const source = detail::device_data_reference(detail::device_data_reference_type::COLUMN,
                                                     data_type,
@@ -122,10 +179,14 @@ cudf::size_type linearizer::visit(column_reference const& expr)
 
 cudf::size_type linearizer::visit(expression const& expr)
 {
+  // Reuse the result of a node that was already evaluated
+  auto const visited = _visited_expressions.find(&expr);
+  if (visited != _visited_expressions.end()) { return visited->second; }
   // Increment the node index
   auto const node_index = _node_count++;
   // Visit children (operands) of this node
-  auto const operand_data_ref_indices = visit_operands(expr.get_operands());
+  auto const operands                 = expr.get_operands();
+  auto const operand_data_ref_indices = visit_operands(operands);
   // Resolve operand types
   auto data_ref = [this](auto const& index) { return data_references()[index].data_type; };
   auto begin    = thrust::make_transform_iterator(operand_data_ref_indices.cbegin(), data_ref);
@@ -138,27 +199,23 @@ cudf::size_type linearizer::visit(expression const& expr)
     CUDF_FAIL("An AST expression was provided non-matching operand types.");
   }
 
-  // Give back intermediate storage locations that are consumed by this operation
-  std::for_each(
-    operand_data_ref_indices.cbegin(),
-    operand_data_ref_indices.cend(),
-    [this](auto const& data_reference_index) {
-      auto const operand_source = data_references()[data_reference_index];
-      if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
-        auto const intermediate_index = operand_source.data_index;
-        _intermediate_counter.give(intermediate_index);
-      }
-    });
+  // Give back intermediate storage locations that are consumed for the last time by this operation
+  for (std::size_t operand = 0; operand < operands.size(); ++operand) {
+    release_operand(operands[operand].get(), operand_data_ref_indices[operand]);
+  }
   // Resolve node type
   auto const op        = expr.get_operator();
   auto const data_type = cudf::ast::detail::ast_operator_return_type(op, operand_types);
   _operators.push_back(op);
   // Push data reference
   auto const output = [&]() {
-    if (node_index == 0) {
-      // This node is the root. Output should be directed to the output column.
-      return detail::device_data_reference(
-        detail::device_data_reference_type::COLUMN, data_type, 0, table_reference::OUTPUT);
+    if (node_index == 0 && _remaining_uses[&expr] == 1) {
+      // This node is the root and is not used elsewhere. Output should be directed to the output
+      // column.
+      return detail::device_data_reference(detail::device_data_reference_type::COLUMN,
+                                           data_type,
+                                           _output_index,
+                                           table_reference::OUTPUT);
     } else {
       // This node is not the root. Output is an intermediate value.
       // Ensure that the output type is fixed width and fits in the intermediate storage.
@@ -178,6 +235,7 @@ cudf::size_type linearizer::visit(expression const& expr)
                                   operand_data_ref_indices.cbegin(),
                                   operand_data_ref_indices.cend());
   _operator_source_indices.push_back(index);
+  _visited_expressions.emplace(&expr, index);
   return index;
 }
 
@@ -198,6 +256,15 @@ std::vector<cudf::size_type> linearizer::visit_operands(
   return operand_data_reference_indices;
 }
 
+void linearizer::release_operand(node const& operand, cudf::size_type data_reference_index)
+{
+  auto const operand_source = data_references()[data_reference_index];
+  if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE &&
+      --_remaining_uses[&operand] == 0) {
+    _intermediate_counter.give(operand_source.data_index);
+  }
+}
+
 cudf::size_type linearizer::add_data_reference(detail::device_data_reference data_ref)
 {
   // If an equivalent data reference already exists, return its index. Otherwise add this data
@@ -14,45 +14,65 @@
  * limitations under the License.
  */
 
+#include <ast/jit_expression.hpp>
+#include <jit/type.hpp>
+
 #include <cudf/ast/detail/transform.cuh>
 #include <cudf/ast/linearizer.hpp>
 #include <cudf/ast/operators.hpp>
 #include <cudf/ast/transform.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/transform.h>
+
 #include <algorithm>
 #include <functional>
 #include <iterator>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace ast {
 namespace detail {
 
+using literal_device_view = cudf::detail::fixed_width_scalar_device_view_base;
+
 /**
- * @brief Kernel for evaluating an expression on a table to produce a new column.
+ * @brief Kernel for evaluating expressions on a table to produce new columns.
  *
- * This evaluates an expression over a table to produce a new column. Also called an n-ary
+ * This evaluates expressions over a table to produce new columns. Also called an n-ary
  * transform.
  *
  * @tparam block_size
+ * @tparam has_nulls Whether the evaluation tracks nulls. The validity of the intermediates of all
+ * threads is stored in shared memory after the intermediates.
  * @param table The table device view used for evaluation.
  * @param literals Array of literal values used for evaluation.
- * @param output_column The output column where results are stored.
+ * @param output_table The output columns where results are stored.
  * @param data_references Array of data references.
  * @param operators Array of operators to perform.
  * @param operator_source_indices Array of source indices for the operators.
@@ -60,11 +80,11 @@ namespace detail {
  * @param num_intermediates Number of intermediates, used to allocate a portion of shared memory to
  * each thread.
  */
-template <cudf::size_type max_block_size>
+template <cudf::size_type max_block_size, bool has_nulls>
 __launch_bounds__(max_block_size) __global__
   void compute_column_kernel(table_device_view const table,
                              const cudf::detail::fixed_width_scalar_device_view_base* literals,
-                             mutable_column_device_view output_column,
+                             mutable_table_device_view const output_table,
                              const detail::device_data_reference* data_references,
                              const ast_operator* operators,
                              const cudf::size_type* operator_source_indices,
@@ -76,8 +96,15 @@ __launch_bounds__(max_block_size) __global__
   auto const start_idx             = cudf::size_type(threadIdx.x + blockIdx.x * blockDim.x);
   auto const stride                = cudf::size_type(blockDim.x * gridDim.x);
   auto const num_rows              = table.num_rows();
-  auto const evaluator =
-    cudf::ast::detail::row_evaluator(table, literals, thread_intermediate_storage, &output_column);
+  auto thread_intermediate_validity =
+    has_nulls ? reinterpret_cast<bool*>(&intermediate_storage[blockDim.x * num_intermediates]) +
+                  threadIdx.x * num_intermediates
+              : nullptr;
+  auto const evaluator = cudf::ast::detail::row_evaluator(table,
+                                                          literals,
+                                                          thread_intermediate_storage,
+                                                          output_table.begin(),
+                                                          thread_intermediate_validity);
 
   for (cudf::size_type row_index = start_idx; row_index < num_rows; row_index += stride) {
     evaluate_row_expression(
@@ -85,87 +112,408 @@ __launch_bounds__(max_block_size) __global__
   }
 }
 
-std::unique_ptr<column> compute_column(table_view const table,
-                                       expression const& expr,
-                                       rmm::cuda_stream_view stream,
-                                       rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Kernel for evaluating a boolean predicate on a table to select its rows.
+ *
+ * Each warp evaluates 32 consecutive rows at a time and writes the bits of the rows for which the
+ * predicate is valid and true to a word of the `selected` bitmask. The block size must be a
+ * multiple of the warp size.
+ *
+ * @tparam block_size
+ * @tparam has_nulls Whether the evaluation tracks nulls.
+ * @param table The table device view used for evaluation.
+ * @param literals Array of literal values used for evaluation.
+ * @param selected The bitmask of the selected rows.
+ * @param data_references Array of data references.
+ * @param operators Array of operators to perform.
+ * @param operator_source_indices Array of source indices for the operators.
+ * @param num_operators Number of operators.
+ * @param num_intermediates Number of intermediates, used to allocate a portion of shared memory to
+ * each thread.
+ */
+template <cudf::size_type max_block_size, bool has_nulls>
+__launch_bounds__(max_block_size) __global__
+  void filter_kernel(table_device_view const table,
+                     const literal_device_view* literals,
+                     bitmask_type* selected,
+                     const detail::device_data_reference* data_references,
+                     const ast_operator* operators,
+                     const cudf::size_type* operator_source_indices,
+                     cudf::size_type num_operators,
+                     cudf::size_type num_intermediates)
+{
+  extern __shared__ std::int64_t intermediate_storage[];
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * num_intermediates];
+  auto const start_idx             = cudf::size_type(threadIdx.x + blockIdx.x * blockDim.x);
+  auto const stride                = cudf::size_type(blockDim.x * gridDim.x);
+  auto const num_rows              = table.num_rows();
+  auto const lane                  = cudf::size_type(threadIdx.x % cudf::detail::warp_size);
+  auto thread_intermediate_validity =
+    has_nulls ? reinterpret_cast<bool*>(&intermediate_storage[blockDim.x * num_intermediates]) +
+                  threadIdx.x * num_intermediates
+              : nullptr;
+  std::int64_t result  = 0;
+  bool result_valid    = true;
+  auto const evaluator = cudf::ast::detail::row_evaluator(table,
+                                                          literals,
+                                                          thread_intermediate_storage,
+                                                          &result,
+                                                          thread_intermediate_validity,
+                                                          &result_valid);
+
+  // The loop condition is uniform across a warp since its rows are in the same bitmask word
+  for (cudf::size_type row_index = start_idx; row_index - lane < num_rows; row_index += stride) {
+    bool is_selected = false;
+    if (row_index < num_rows) {
+      evaluate_row_expression(
+        evaluator, data_references, operators, operator_source_indices, num_operators, row_index);
+      bool value;
+      memcpy(&value, &result, sizeof(bool));
+      is_selected = value && result_valid;
+    }
+    auto const word = __ballot_sync(0xffffffff, is_selected);
+    if (lane == 0) { selected[word_index(row_index)] = word; }
+  }
+}
+
+/**
+ * @brief A linearized expression copied to device memory.
+ */
+struct device_plan {
+  rmm::device_buffer buffer;
+  const detail::device_data_reference* data_references;
+  const literal_device_view* literals;
+  const ast_operator* operators;
+  const cudf::size_type* operator_source_indices;
+};
+
+/**
+ * @brief Copies the data references, literals, and operators of a linearized expression to device
+ * memory.
+ */
+device_plan make_device_plan(linearizer const& expr_linearizer,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
 {
-  // Linearize the AST
-  auto const expr_linearizer         = linearizer(expr, table);
-  auto const data_references         = expr_linearizer.data_references();
-  auto const literals                = expr_linearizer.literals();
-  auto const operators               = expr_linearizer.operators();
-  auto const num_operators           = cudf::size_type(operators.size());
-  auto const operator_source_indices = expr_linearizer.operator_source_indices();
-  auto const expr_data_type          = expr_linearizer.root_data_type();
-
-  // Create ast_plan and device buffer
   auto plan = ast_plan();
-  plan.add_to_plan(data_references);
-  plan.add_to_plan(literals);
-  plan.add_to_plan(operators);
-  plan.add_to_plan(operator_source_indices);
+  plan.add_to_plan(expr_linearizer.data_references());
+  plan.add_to_plan(expr_linearizer.literals());
+  plan.add_to_plan(expr_linearizer.operators());
+  plan.add_to_plan(expr_linearizer.operator_source_indices());
   auto const host_data_buffer = plan.get_host_data_buffer();
   auto const buffer_offsets   = plan.get_offsets();
   auto const buffer_size      = host_data_buffer.second;
   auto device_data_buffer =
     rmm::device_buffer(host_data_buffer.first.get(), buffer_size, stream, mr);
-  // To reduce overhead, we don't call a stream sync here.
-  // The stream is synced later when the table_device_view is created.
+  // The host buffer is released on return
+  stream.synchronize();
 
   // Create device pointers to components of plan
   auto const device_data_buffer_ptr = static_cast<const char*>(device_data_buffer.data());
   auto const device_data_references = reinterpret_cast<const detail::device_data_reference*>(
     device_data_buffer_ptr + buffer_offsets[0]);
   auto const device_literals =
-    reinterpret_cast<const cudf::detail::fixed_width_scalar_device_view_base*>(
-      device_data_buffer_ptr + buffer_offsets[1]);
+    reinterpret_cast<const literal_device_view*>(device_data_buffer_ptr + buffer_offsets[1]);
   auto const device_operators =
     reinterpret_cast<const ast_operator*>(device_data_buffer_ptr + buffer_offsets[2]);
   auto const device_operator_source_indices =
     reinterpret_cast<const cudf::size_type*>(device_data_buffer_ptr + buffer_offsets[3]);
+  return device_plan{std::move(device_data_buffer),
+                     device_data_references,
+                     device_literals,
+                     device_operators,
+                     device_operator_source_indices};
+}
 
-  // Create table device view
-  auto table_device         = table_device_view::create(table, stream);
-  auto const table_num_rows = table.num_rows();
+/**
+ * @brief Returns true if nulls must be tracked to evaluate an expression on a table.
+ *
+ * Nulls are only tracked if a column of the table or a literal of the expression has nulls.
+ */
+bool expression_has_nulls(table_view const& table,
+                          device_plan const& plan,
+                          cudf::size_type num_literals,
+                          rmm::cuda_stream_view stream)
+{
+  return cudf::has_nulls(table) ||
+         (num_literals > 0 && thrust::any_of(rmm::exec_policy(stream),
+                                             plan.literals,
+                                             plan.literals + num_literals,
+                                             [] __device__(literal_device_view const& literal) {
+                                               return !literal.is_valid();
+                                             }));
+}
 
-  // Prepare output column
-  auto output_column = cudf::make_fixed_width_column(
-    expr_data_type, table_num_rows, mask_state::UNALLOCATED, stream, mr);
-  auto mutable_output_device =
-    cudf::mutable_column_device_view::create(output_column->mutable_view(), stream);
+/**
+ * @brief Returns the shared memory size per thread for the intermediates of an expression.
+ */
+int intermediates_shmem_size(cudf::size_type num_intermediates, bool has_nulls)
+{
+  return static_cast<int>((sizeof(std::int64_t) + (has_nulls ? sizeof(bool) : 0)) *
+                          num_intermediates);
+}
 
-  // Configure kernel parameters
-  auto const num_intermediates     = expr_linearizer.intermediate_count();
-  auto const shmem_size_per_thread = static_cast<int>(sizeof(std::int64_t) * num_intermediates);
+/**
+ * @brief Returns the largest block size up to `max_block_size` for which the intermediates of all
+ * the threads of a block fit in shared memory.
+ */
+int intermediates_block_size(int shmem_size_per_thread, int max_block_size)
+{
   int device_id;
   CUDA_TRY(cudaGetDevice(&device_id));
   int shmem_limit_per_block;
   CUDA_TRY(
     cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
-  auto constexpr MAX_BLOCK_SIZE = 128;
-  auto const block_size =
-    shmem_size_per_thread != 0
-      ? std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / shmem_size_per_thread)
-      : MAX_BLOCK_SIZE;
-  auto const config               = cudf::detail::grid_1d{table_num_rows, block_size};
+  return shmem_size_per_thread != 0
+           ? std::min(max_block_size, shmem_limit_per_block / shmem_size_per_thread)
+           : max_block_size;
+}
+
+/**
+ * @brief Evaluates linearized expressions on a table with the interpreter kernel.
+ *
+ * @param table The table used for evaluation.
+ * @param expr_linearizer The linearized expressions.
+ * @param plan The linearized expressions copied to device memory.
+ * @param has_nulls Whether the evaluation tracks nulls.
+ * @param output The output columns, one per expression.
+ * @param stream Stream on which to perform the computation.
+ */
+void evaluate_expressions(table_view const& table,
+                          linearizer const& expr_linearizer,
+                          device_plan const& plan,
+                          bool has_nulls,
+                          mutable_table_view output,
+                          rmm::cuda_stream_view stream)
+{
+  auto const table_num_rows = table.num_rows();
+  if (table_num_rows == 0) { return; }
+
+  // Create table device views
+  auto const num_operators   = cudf::size_type(expr_linearizer.operators().size());
+  auto table_device          = table_device_view::create(table, stream);
+  auto mutable_output_device = mutable_table_device_view::create(output, stream);
+
+  // Configure kernel parameters
+  auto const num_intermediates     = expr_linearizer.intermediate_count();
+  auto const shmem_size_per_thread = intermediates_shmem_size(num_intermediates, has_nulls);
+  auto constexpr MAX_BLOCK_SIZE    = 128;
+  auto const block_size = intermediates_block_size(shmem_size_per_thread, MAX_BLOCK_SIZE);
+  auto const config     = cudf::detail::grid_1d{table_num_rows, block_size};
   auto const shmem_size_per_block = shmem_size_per_thread * config.num_threads_per_block;
 
   // Execute the kernel
-  cudf::ast::detail::compute_column_kernel<MAX_BLOCK_SIZE>
-    <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-      *table_device,
-      device_literals,
-      *mutable_output_device,
-      device_data_references,
-      device_operators,
-      device_operator_source_indices,
-      num_operators,
-      num_intermediates);
+  auto const kernel = has_nulls ? cudf::ast::detail::compute_column_kernel<MAX_BLOCK_SIZE, true>
+                                : cudf::ast::detail::compute_column_kernel<MAX_BLOCK_SIZE, false>;
+  kernel<<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+    *table_device,
+    plan.literals,
+    *mutable_output_device,
+    plan.data_references,
+    plan.operators,
+    plan.operator_source_indices,
+    num_operators,
+    num_intermediates);
+  CHECK_CUDA(stream.value());
+}
+
+/**
+ * @brief Evaluates an expression with its compiled kernel, if the kernel is available.
+ *
+ * @param table The table used for evaluation.
+ * @param expr_linearizer The linearized expression.
+ * @param literals Device array of the literals of the expression.
+ * @param output The output column.
+ * @param stream Stream on which to perform the computation.
+ * @return true if the output column was computed
+ */
+bool compute_column_jit(table_view const& table,
+                        linearizer const& expr_linearizer,
+                        literal_device_view const* literals,
+                        mutable_column_view output,
+                        rmm::cuda_stream_view stream)
+{
+  auto const num_columns = table.num_columns();
+  auto const source      = jit::generate_expression(expr_linearizer, num_columns);
+  if (source.empty() || !jit::compile_expression(source, output.type())) { return false; }
+
+  // the kernel reads the columns and then the literals from one array of pointers
+  auto const num_literals = static_cast<cudf::size_type>(expr_linearizer.literals().size());
+  auto columns            = std::vector<void const*>(num_columns, nullptr);
+  std::transform(table.begin(), table.end(), columns.begin(), [](column_view const& col) {
+    return is_fixed_width(col.type()) ? cudf::jit::get_data_ptr(col) : nullptr;
+  });
+  auto inputs = rmm::device_uvector<void const*>(num_columns + num_literals, stream);
+  CUDA_TRY(cudaMemcpyAsync(inputs.data(),
+                           columns.data(),
+                           num_columns * sizeof(void const*),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  thrust::transform(rmm::exec_policy(stream),
+                    literals,
+                    literals + num_literals,
+                    inputs.begin() + num_columns,
+                    [] __device__(literal_device_view const& literal) {
+                      return static_cast<void const*>(literal.data<char>());
+                    });
+
+  jit::launch_expression(source, output, inputs.data(), stream);
   CHECK_CUDA(stream.value());
+  return true;
+}
+
+std::unique_ptr<column> compute_column(table_view const table,
+                                       expression const& expr,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  return compute_column(table, expr, evaluation_mode::INTERPRETED, stream, mr);
+}
+
+std::unique_ptr<column> compute_column(table_view const table,
+                                       expression const& expr,
+                                       evaluation_mode mode,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  // Linearize the AST
+  auto const expr_linearizer = linearizer(expr, table);
+  auto const num_literals    = cudf::size_type(expr_linearizer.literals().size());
+  auto const expr_data_type  = expr_linearizer.root_data_type();
+
+  auto const plan      = make_device_plan(expr_linearizer, stream, mr);
+  auto const has_nulls = expression_has_nulls(table, plan, num_literals, stream);
+
+  // Prepare output column
+  auto const table_num_rows = table.num_rows();
+  auto output_column        = cudf::make_fixed_width_column(expr_data_type,
+                                                     table_num_rows,
+                                                     has_nulls ? mask_state::ALL_VALID
+                                                               : mask_state::UNALLOCATED,
+                                                     stream,
+                                                     mr);
+
+  // Use the compiled kernel of the expression once it is available
+  if (mode == evaluation_mode::JIT && !has_nulls && table_num_rows > 0 &&
+      compute_column_jit(
+        table, expr_linearizer, plan.literals, output_column->mutable_view(), stream)) {
+    return output_column;
+  }
+
+  evaluate_expressions(table,
+                       expr_linearizer,
+                       plan,
+                       has_nulls,
+                       mutable_table_view{{output_column->mutable_view()}},
+                       stream);
+  if (has_nulls) { output_column->set_null_count(cudf::UNKNOWN_NULL_COUNT); }
   return output_column;
 }
 
+std::unique_ptr<table> compute_columns(
+  table_view const table,
+  std::vector<std::reference_wrapper<expression const>> const& exprs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!exprs.empty(), "At least one expression is required");
+  auto const expr_linearizer = linearizer(exprs, table);
+  auto const num_literals    = cudf::size_type(expr_linearizer.literals().size());
+  auto const plan            = make_device_plan(expr_linearizer, stream, mr);
+  auto const has_nulls       = expression_has_nulls(table, plan, num_literals, stream);
+
+  // Prepare the output columns
+  auto const& output_types = expr_linearizer.root_data_types();
+  std::vector<std::unique_ptr<column>> output_columns(output_types.size());
+  std::transform(output_types.cbegin(),
+                 output_types.cend(),
+                 output_columns.begin(),
+                 [&table, has_nulls, stream, mr](data_type output_type) {
+                   return cudf::make_fixed_width_column(
+                     output_type,
+                     table.num_rows(),
+                     has_nulls ? mask_state::ALL_VALID : mask_state::UNALLOCATED,
+                     stream,
+                     mr);
+                 });
+  std::vector<mutable_column_view> output_views(output_columns.size());
+  std::transform(output_columns.cbegin(),
+                 output_columns.cend(),
+                 output_views.begin(),
+                 [](auto const& output_column) { return output_column->mutable_view(); });
+
+  evaluate_expressions(
+    table, expr_linearizer, plan, has_nulls, mutable_table_view{output_views}, stream);
+  if (has_nulls) {
+    for (auto& output_column : output_columns) {
+      output_column->set_null_count(cudf::UNKNOWN_NULL_COUNT);
+    }
+  }
+  return std::make_unique<table>(std::move(output_columns));
+}
+
+std::pair<std::unique_ptr<rmm::device_buffer>, cudf::size_type> compute_mask(
+  table_view const& table,
+  expression const& predicate,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const expr_linearizer = linearizer(predicate, table);
+  CUDF_EXPECTS(expr_linearizer.root_data_type().id() == type_id::BOOL8,
+               "The filter predicate must produce boolean values");
+  auto const table_num_rows = table.num_rows();
+  if (table_num_rows == 0) { return std::make_pair(std::make_unique<rmm::device_buffer>(), 0); }
+
+  auto const num_operators = cudf::size_type(expr_linearizer.operators().size());
+  auto const num_literals  = cudf::size_type(expr_linearizer.literals().size());
+  auto const plan          = make_device_plan(expr_linearizer, stream, mr);
+  auto const has_nulls     = expression_has_nulls(table, plan, num_literals, stream);
+  auto table_device        = table_device_view::create(table, stream);
+
+  // Configure kernel parameters, with whole warps for the bitmask words
+  auto const num_intermediates     = expr_linearizer.intermediate_count();
+  auto const shmem_size_per_thread = intermediates_shmem_size(num_intermediates, has_nulls);
+  auto constexpr MAX_BLOCK_SIZE    = 128;
+  auto const block_size = intermediates_block_size(shmem_size_per_thread, MAX_BLOCK_SIZE) /
+                          cudf::detail::warp_size * cudf::detail::warp_size;
+  CUDF_EXPECTS(block_size > 0, "The filter predicate has too many intermediate values");
+  auto const config               = cudf::detail::grid_1d{table_num_rows, block_size};
+  auto const shmem_size_per_block = shmem_size_per_thread * config.num_threads_per_block;
+
+  // Select the rows in a bitmask
+  auto selected = std::make_unique<rmm::device_buffer>(
+    cudf::detail::create_null_mask(table_num_rows, mask_state::UNINITIALIZED, stream, mr));
+  auto const d_selected = static_cast<bitmask_type*>(selected->data());
+  auto const kernel     = has_nulls ? cudf::ast::detail::filter_kernel<MAX_BLOCK_SIZE, true>
+                                    : cudf::ast::detail::filter_kernel<MAX_BLOCK_SIZE, false>;
+  kernel<<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+    *table_device,
+    plan.literals,
+    d_selected,
+    plan.data_references,
+    plan.operators,
+    plan.operator_source_indices,
+    num_operators,
+    num_intermediates);
+  CHECK_CUDA(stream.value());
+
+  auto const num_selected = cudf::detail::segmented_count_set_bits(
+    d_selected, std::vector<cudf::size_type>{0, table_num_rows}, stream)[0];
+  return std::make_pair(std::move(selected), table_num_rows - num_selected);
+}
+
+std::unique_ptr<table> filter(table_view const& table,
+                              expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  auto const selected = compute_mask(table, predicate, stream, cudf::get_current_temp_resource());
+  if (table.num_rows() == 0) { return empty_like(table); }
+
+  return cudf::detail::apply_boolean_mask(
+    table, static_cast<bitmask_type const*>(selected.first->data()), stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> compute_column(table_view const table,
@@ -176,6 +524,39 @@ std::unique_ptr<column> compute_column(table_view const table,
   return detail::compute_column(table, expr, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> compute_column(table_view const table,
+                                       expression const& expr,
+                                       evaluation_mode mode,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(table, expr, mode, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> compute_columns(
+  table_view const table,
+  std::vector<std::reference_wrapper<expression const>> const& exprs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_columns(table, exprs, rmm::cuda_stream_default, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_buffer>, cudf::size_type> compute_mask(
+  table_view const& table, expression const& predicate, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_mask(table, predicate, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> filter(table_view const& table,
+                              expression const& predicate,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::filter(table, predicate, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace ast
 
 }  // namespace cudf
@@ -30,8 +30,13 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/aliasing.hpp>
+#include <cudf/dictionary/detail/search.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/table/table_view.hpp>
@@ -43,6 +48,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <string>
+#include <vector>
 
 #include <thrust/optional.h>
 
@@ -61,9 +67,9 @@ rmm::device_buffer scalar_col_valid_mask_and(column_view const& col,
 {
   if (col.is_empty()) return rmm::device_buffer{0, stream, mr};
 
-  if (not s.is_valid()) {
+  if (not s.is_valid(stream)) {
     return cudf::detail::create_null_mask(col.size(), mask_state::ALL_NULL, stream, mr);
-  } else if (s.is_valid() and col.nullable()) {
+  } else if (col.nullable()) {
     return cudf::detail::copy_bitmask(col, stream, mr);
   } else {
     return rmm::device_buffer{0, stream, mr};
@@ -210,6 +216,43 @@ void binary_operation(mutable_column_view& out,
 }
 
 }  // namespace jit
+
+// The binary operations of fixed-width types use a compiled kernel when there is one for the
+// operand and output types, and a JIT-compiled kernel otherwise.
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream)
+{
+  if (not compiled::try_binary_operation(out, lhs, rhs, op, stream)) {
+    jit::binary_operation(out, lhs, rhs, op, stream);
+  }
+}
+
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream)
+{
+  if (not compiled::try_binary_operation(out, lhs, rhs, op, stream)) {
+    jit::binary_operation(out, lhs, rhs, op, stream);
+  }
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream)
+{
+  if (not compiled::try_binary_operation(out, lhs, rhs, op, stream)) {
+    jit::binary_operation(out, lhs, rhs, op, stream);
+  }
+}
+
 }  // namespace binops
 
 namespace detail {
@@ -299,9 +342,9 @@ std::unique_ptr<column> make_fixed_width_column_for_output(column_view const& lh
   if (binops::is_null_dependent(op)) {
     return make_fixed_width_column(output_type, rhs.size(), mask_state::ALL_VALID, stream, mr);
   } else {
-    auto new_mask = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
+    auto [new_mask, null_count] = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
     return make_fixed_width_column(
-      output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+      output_type, lhs.size(), std::move(new_mask), null_count, stream, mr);
   }
 };
 
@@ -372,6 +415,49 @@ void fixed_point_binary_operation_validation(binary_operator op,
   }
 }
 
+/**
+ * @brief Type-dispatch functor returning the `fixed_point` scalar `10^diff` with scale `-diff`
+ *
+ * Multiplying a `fixed_point` column by this scalar lowers its scale by `diff`, keeping its values.
+ */
+struct rescale_factor_fn {
+  template <typename T, std::enable_if_t<is_fixed_point<T>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(int32_t diff, rmm::cuda_stream_view stream) const
+  {
+    auto const factor = numeric::detail::ipow<typename T::rep, numeric::Radix::BASE_10>(diff);
+    return make_fixed_point_scalar<T>(factor, numeric::scale_type{-diff}, stream);
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_point<T>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(int32_t, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Unexpected DTYPE");
+  }
+};
+
+/**
+ * @brief Type-dispatch functor returning a copy of a `fixed_point` scalar whose scale is lowered
+ * by `diff`, keeping its value
+ */
+struct rescale_scalar_fn {
+  template <typename T, std::enable_if_t<is_fixed_point<T>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(scalar const& s,
+                                     int32_t diff,
+                                     rmm::cuda_stream_view stream) const
+  {
+    auto const factor = numeric::detail::ipow<typename T::rep, numeric::Radix::BASE_10>(diff);
+    auto const val    = static_cast<fixed_point_scalar<T> const&>(s).value(stream);
+    auto const scale  = numeric::scale_type{s.type().scale() - diff};
+    return make_fixed_point_scalar<T>(val * factor, scale, stream);
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_point<T>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(scalar const&, int32_t, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Unexpected DTYPE");
+  }
+};
+
 /**
  * @brief Function to compute binary operation of one `column_view` and one `scalar`
  *
@@ -405,39 +491,18 @@ std::unique_ptr<column> fixed_point_binary_operation(scalar const& lhs,
   if (lhs.type().scale() != rhs.type().scale() && is_same_scale_necessary(op)) {
     // Adjust scalar/column so they have they same scale
     if (rhs.type().scale() < lhs.type().scale()) {
-      auto const diff = lhs.type().scale() - rhs.type().scale();
-      if (lhs.type().id() == type_id::DECIMAL32) {
-        auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
-        auto const val    = static_cast<fixed_point_scalar<decimal32> const&>(lhs).value();
-        auto const scale  = scale_type{rhs.type().scale()};
-        auto const scalar = make_fixed_point_scalar<decimal32>(val * factor, scale);
-        binops::jit::binary_operation(out_view, *scalar, rhs, op, stream);
-      } else {
-        CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
-        auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
-        auto const val    = static_cast<fixed_point_scalar<decimal64> const&>(lhs).value();
-        auto const scale  = scale_type{rhs.type().scale()};
-        auto const scalar = make_fixed_point_scalar<decimal64>(val * factor, scale);
-        binops::jit::binary_operation(out_view, *scalar, rhs, op, stream);
-      }
+      auto const diff   = lhs.type().scale() - rhs.type().scale();
+      auto const scalar = type_dispatcher(lhs.type(), rescale_scalar_fn{}, lhs, diff, stream);
+      binops::binary_operation(out_view, *scalar, rhs, op, stream);
     } else {
       auto const diff   = rhs.type().scale() - lhs.type().scale();
-      auto const result = [&] {
-        if (lhs.type().id() == type_id::DECIMAL32) {
-          auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
-          auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
-          return binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
-          auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
-          auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
-          return binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
-        }
-      }();
-      binops::jit::binary_operation(out_view, lhs, result->view(), op, stream);
+      auto const factor = type_dispatcher(lhs.type(), rescale_factor_fn{}, diff, stream);
+      auto const result =
+        binary_operation(*factor, rhs, binary_operator::MUL, lhs.type(), stream, mr);
+      binops::binary_operation(out_view, lhs, result->view(), op, stream);
     }
   } else {
-    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+    binops::binary_operation(out_view, lhs, rhs, op, stream);
   }
   return output_type.scale() != scale ? cudf::cast(out_view, output_type) : std::move(out);
 }
@@ -475,39 +540,18 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
   if (lhs.type().scale() != rhs.type().scale() && is_same_scale_necessary(op)) {
     // Adjust scalar/column so they have they same scale
     if (rhs.type().scale() > lhs.type().scale()) {
-      auto const diff = rhs.type().scale() - lhs.type().scale();
-      if (rhs.type().id() == type_id::DECIMAL32) {
-        auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
-        auto const val    = static_cast<fixed_point_scalar<decimal32> const&>(rhs).value();
-        auto const scale  = scale_type{lhs.type().scale()};
-        auto const scalar = make_fixed_point_scalar<decimal32>(val * factor, scale);
-        binops::jit::binary_operation(out_view, lhs, *scalar, op, stream);
-      } else {
-        CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
-        auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
-        auto const val    = static_cast<fixed_point_scalar<decimal64> const&>(rhs).value();
-        auto const scale  = scale_type{rhs.type().scale()};
-        auto const scalar = make_fixed_point_scalar<decimal64>(val * factor, scale);
-        binops::jit::binary_operation(out_view, lhs, *scalar, op, stream);
-      }
+      auto const diff   = rhs.type().scale() - lhs.type().scale();
+      auto const scalar = type_dispatcher(rhs.type(), rescale_scalar_fn{}, rhs, diff, stream);
+      binops::binary_operation(out_view, lhs, *scalar, op, stream);
     } else {
       auto const diff   = lhs.type().scale() - rhs.type().scale();
-      auto const result = [&] {
-        if (rhs.type().id() == type_id::DECIMAL32) {
-          auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
-          auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
-          return binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
-          auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
-          auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
-          return binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
-        }
-      }();
-      binops::jit::binary_operation(out_view, result->view(), rhs, op, stream);
+      auto const factor = type_dispatcher(rhs.type(), rescale_factor_fn{}, diff, stream);
+      auto const result =
+        binary_operation(*factor, lhs, binary_operator::MUL, rhs.type(), stream, mr);
+      binops::binary_operation(out_view, result->view(), rhs, op, stream);
     }
   } else {
-    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+    binops::binary_operation(out_view, lhs, rhs, op, stream);
   }
   return output_type.scale() != scale ? cudf::cast(out_view, output_type) : std::move(out);
 }
@@ -545,41 +589,142 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
   if (lhs.type().scale() != rhs.type().scale() && is_same_scale_necessary(op)) {
     if (rhs.type().scale() < lhs.type().scale()) {
       auto const diff   = lhs.type().scale() - rhs.type().scale();
-      auto const result = [&] {
-        if (lhs.type().id() == type_id::DECIMAL32) {
-          auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
-          auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
-          return binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
-          auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
-          auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
-          return binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
-        }
-      }();
-      binops::jit::binary_operation(out_view, result->view(), rhs, op, stream);
+      auto const factor = type_dispatcher(lhs.type(), rescale_factor_fn{}, diff, stream);
+      auto const result =
+        binary_operation(*factor, lhs, binary_operator::MUL, rhs.type(), stream, mr);
+      binops::binary_operation(out_view, result->view(), rhs, op, stream);
     } else {
       auto const diff   = rhs.type().scale() - lhs.type().scale();
-      auto const result = [&] {
-        if (lhs.type().id() == type_id::DECIMAL32) {
-          auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
-          auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
-          return binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
-          auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
-          auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
-          return binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
-        }
-      }();
-      binops::jit::binary_operation(out_view, lhs, result->view(), op, stream);
+      auto const factor = type_dispatcher(lhs.type(), rescale_factor_fn{}, diff, stream);
+      auto const result =
+        binary_operation(*factor, rhs, binary_operator::MUL, lhs.type(), stream, mr);
+      binops::binary_operation(out_view, lhs, result->view(), op, stream);
     }
   } else {
-    binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+    binops::binary_operation(out_view, lhs, rhs, op, stream);
   }
   return output_type.scale() != scale ? cudf::cast(out_view, output_type) : std::move(out);
 }
 
+/**
+ * @brief Type-dispatch functor returning the value of a dictionary index scalar
+ */
+struct index_scalar_value_fn {
+  template <typename IndexType, std::enable_if_t<is_index_type<IndexType>()>* = nullptr>
+  size_type operator()(scalar const& index, rmm::cuda_stream_view stream) const
+  {
+    return static_cast<size_type>(
+      static_cast<numeric_scalar<IndexType> const&>(index).value(stream));
+  }
+
+  template <typename IndexType, std::enable_if_t<not is_index_type<IndexType>()>* = nullptr>
+  size_type operator()(scalar const&, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("indices must be an integral type");
+  }
+};
+
+/**
+ * @brief Returns the comparison giving the same result with `lhs` and `rhs` swapped
+ */
+binary_operator swap_comparison_operands(binary_operator op)
+{
+  switch (op) {
+    case binary_operator::LESS: return binary_operator::GREATER;
+    case binary_operator::GREATER: return binary_operator::LESS;
+    case binary_operator::LESS_EQUAL: return binary_operator::GREATER_EQUAL;
+    case binary_operator::GREATER_EQUAL: return binary_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+/**
+ * @brief Function to compare the keys of a dictionary column with a scalar of the keys type
+ *
+ * The keys of a dictionary are sorted, so the keys compare like their indices, and the scalar
+ * is replaced by the indices it compares with instead of decoding the dictionary.
+ *
+ * @param lhs Left-hand side dictionary `column_view` used in the binary operation
+ * @param rhs Right-hand side `scalar` used in the binary operation
+ * @param op Comparison `binary_operator` to be used to combine `lhs` and `rhs`
+ * @param output_type `data_type` of the output column
+ * @param mr Device memory resource to use for device memory allocation
+ * @param stream CUDA stream used for device memory operations
+ * @return std::unique_ptr<column> Resulting output column from the binary operation
+ */
+std::unique_ptr<column> dictionary_binary_operation(column_view const& lhs,
+                                                    scalar const& rhs,
+                                                    binary_operator op,
+                                                    data_type output_type,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_comparison_binop(op), "Unsupported dictionary binary operation");
+  if (lhs.is_empty()) { return make_empty_column(output_type); }
+
+  auto const dictionary = dictionary_column_view(lhs);
+  CUDF_EXPECTS(dictionary.keys().type() == rhs.type(), "Dictionary keys type mismatch");
+
+  // the keys less than `rhs` have the indices [0, lower), and the keys equal to it [lower, upper)
+  size_type lower = 0;
+  size_type upper = 0;
+  if (rhs.is_valid()) {
+    auto const insert_index = dictionary::detail::get_insert_index(dictionary, rhs, stream);
+    auto const index        = dictionary::detail::get_index(dictionary, rhs, stream);
+    lower = type_dispatcher(insert_index->type(), index_scalar_value_fn{}, *insert_index, stream);
+    upper = index->is_valid() ? lower + 1 : lower;
+  }
+  // a key not found is replaced by an index no row has
+  auto const equal_index = upper > lower ? lower : dictionary.keys().size();
+
+  auto const [index_op, index] = [&]() -> std::pair<binary_operator, size_type> {
+    switch (op) {
+      case binary_operator::LESS: return {binary_operator::LESS, lower};
+      case binary_operator::GREATER_EQUAL: return {binary_operator::GREATER_EQUAL, lower};
+      case binary_operator::LESS_EQUAL: return {binary_operator::LESS, upper};
+      case binary_operator::GREATER: return {binary_operator::GREATER_EQUAL, upper};
+      default: return {op, equal_index};
+    }
+  }();
+  auto const index_scalar = numeric_scalar<size_type>(index, rhs.is_valid(), stream);
+  return binary_operation(
+    dictionary.get_indices_annotated(), index_scalar, index_op, output_type, stream, mr);
+}
+
+/**
+ * @brief Function to compare the keys of two dictionary columns
+ *
+ * The keys of the dictionaries are matched first, unless they are the same already, and the
+ * keys then compare like their indices.
+ *
+ * @param lhs Left-hand side dictionary `column_view` used in the binary operation
+ * @param rhs Right-hand side dictionary `column_view` used in the binary operation
+ * @param op Comparison `binary_operator` to be used to combine `lhs` and `rhs`
+ * @param output_type `data_type` of the output column
+ * @param mr Device memory resource to use for device memory allocation
+ * @param stream CUDA stream used for device memory operations
+ * @return std::unique_ptr<column> Resulting output column from the binary operation
+ */
+std::unique_ptr<column> dictionary_binary_operation(column_view const& lhs,
+                                                    column_view const& rhs,
+                                                    binary_operator op,
+                                                    data_type output_type,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_comparison_binop(op), "Unsupported dictionary binary operation");
+  CUDF_EXPECTS(rhs.type().id() == type_id::DICTIONARY32, "Both columns must be dictionaries");
+  if (lhs.is_empty()) { return make_empty_column(output_type); }
+
+  auto const matched =
+    dictionary::detail::match_dictionaries({table_view{{lhs}}, table_view{{rhs}}}, stream);
+  auto const lhs_indices =
+    dictionary_column_view(matched.second.front().column(0)).get_indices_annotated();
+  auto const rhs_indices =
+    dictionary_column_view(matched.second.back().column(0)).get_indices_annotated();
+  return binary_operation(lhs_indices, rhs_indices, op, output_type, stream, mr);
+}
+
 std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
@@ -590,6 +735,10 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
   if (lhs.type().id() == type_id::STRING and rhs.type().id() == type_id::STRING)
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, stream, mr);
 
+  if (rhs.type().id() == type_id::DICTIONARY32)
+    return dictionary_binary_operation(
+      rhs, lhs, swap_comparison_operands(op), output_type, stream, mr);
+
   if (is_fixed_point(lhs.type()) or is_fixed_point(rhs.type()))
     return fixed_point_binary_operation(lhs, rhs, op, output_type, stream, mr);
 
@@ -603,7 +752,7 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
   if (rhs.is_empty()) return out;
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  binops::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
 }
 
@@ -617,6 +766,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.type().id() == type_id::STRING and rhs.type().id() == type_id::STRING)
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, stream, mr);
 
+  if (lhs.type().id() == type_id::DICTIONARY32)
+    return dictionary_binary_operation(lhs, rhs, op, output_type, stream, mr);
+
   if (is_fixed_point(lhs.type()) or is_fixed_point(rhs.type()))
     return fixed_point_binary_operation(lhs, rhs, op, output_type, stream, mr);
 
@@ -630,7 +782,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.is_empty()) return out;
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  binops::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
 }
 
@@ -646,6 +798,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.type().id() == type_id::STRING and rhs.type().id() == type_id::STRING)
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, stream, mr);
 
+  if (lhs.type().id() == type_id::DICTIONARY32)
+    return dictionary_binary_operation(lhs, rhs, op, output_type, stream, mr);
+
   if (is_fixed_point(lhs.type()) or is_fixed_point(rhs.type()))
     return fixed_point_binary_operation(lhs, rhs, op, output_type, stream, mr);
 
@@ -659,7 +814,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.is_empty() or rhs.is_empty()) return out;
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  binops::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
 }
 
@@ -682,9 +837,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 
   CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
 
-  auto new_mask = bitmask_and(table_view({lhs, rhs}), stream, mr);
-  auto out      = make_fixed_width_column(
-    output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+  auto [new_mask, null_count] = bitmask_and(table_view({lhs, rhs}), stream, mr);
+  auto out =
+    make_fixed_width_column(output_type, lhs.size(), std::move(new_mask), null_count, stream, mr);
 
   // Check for 0 sized data
   if (lhs.is_empty() or rhs.is_empty()) return out;
@@ -694,6 +849,130 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return out;
 }
 
+/**
+ * @brief Checks that `out` can receive the result of `op` on the operand column `col`.
+ *
+ * @param col The operand column
+ * @param op The binary operator
+ * @param out The preallocated output column
+ * @param result_has_nulls Whether the result of the operation may have nulls
+ */
+void expects_binary_operation_output(column_view const& col,
+                                     binary_operator op,
+                                     mutable_column_view const& out,
+                                     bool result_has_nulls)
+{
+  auto is_supported_type = [](data_type type) {
+    return is_fixed_width(type) and not is_fixed_point(type);
+  };
+  CUDF_EXPECTS(is_supported_type(out.type()), "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(is_supported_type(col.type()), "Invalid/Unsupported operand datatype");
+  CUDF_EXPECTS(col.size() == out.size(), "Output size must match the operand size");
+  CUDF_EXPECTS(out.nullable() or not result_has_nulls,
+               "Output must be nullable if the result has nulls");
+  // The kernels of the null-dependent operators write the null mask without the offset
+  CUDF_EXPECTS(not out.nullable() or out.offset() == 0, "A nullable output must not be sliced");
+  // The null-dependent operators read the operand masks after the output mask is initialized
+  CUDF_EXPECTS(is_elementwise_alias_safe(col, out, not binops::is_null_dependent(op)),
+               "Output overlaps an operand without viewing the same elements");
+}
+
+/**
+ * @brief Writes the null mask of the result of `op` on the operand columns `cols` into `out`.
+ *
+ * The mask is the AND of the masks of the operands, unless the scalar operand is invalid. For the
+ * null-dependent operators, it is initialized to all valid, and the kernels clear the bits of the
+ * null results.
+ *
+ * @param out The preallocated output column
+ * @param cols The operand columns
+ * @param scalar_is_valid Whether the scalar operand, if any, is valid
+ * @param op The binary operator
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void set_binary_operation_null_mask(mutable_column_view& out,
+                                    std::vector<column_view> const& cols,
+                                    bool scalar_is_valid,
+                                    binary_operator op,
+                                    rmm::cuda_stream_view stream)
+{
+  if (not out.nullable() or out.is_empty()) { return; }
+
+  auto const null_dependent = binops::is_null_dependent(op);
+  if (not null_dependent and not scalar_is_valid) {
+    cudf::detail::set_null_mask(out.null_mask(), 0, out.size(), false, stream);
+    out.set_null_count(out.size());
+    return;
+  }
+
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> begin_bits;
+  for (auto const& col : cols) {
+    if (col.nullable() and not null_dependent) {
+      masks.push_back(col.null_mask());
+      begin_bits.push_back(col.offset());
+    }
+  }
+  if (masks.empty()) {
+    cudf::detail::set_null_mask(out.null_mask(), 0, out.size(), true, stream);
+    out.set_null_count(null_dependent ? UNKNOWN_NULL_COUNT : 0);
+    return;
+  }
+
+  auto const null_count = cudf::detail::inplace_bitmask_and(
+    device_span<bitmask_type>(out.null_mask(), num_bitmask_words(out.size())),
+    masks,
+    begin_bits,
+    out.size(),
+    stream);
+  out.set_null_count(null_count);
+}
+
+void binary_operation(column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(is_fixed_width(rhs.type()) and not is_fixed_point(rhs.type()),
+               "Invalid/Unsupported rhs datatype");
+  auto const rhs_is_valid = rhs.is_valid(stream);
+  expects_binary_operation_output(lhs, op, output, lhs.has_nulls() or not rhs_is_valid);
+
+  set_binary_operation_null_mask(output, {lhs}, rhs_is_valid, op, stream);
+  if (not output.is_empty()) { binops::binary_operation(output, lhs, rhs, op, stream); }
+}
+
+void binary_operation(scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(is_fixed_width(lhs.type()) and not is_fixed_point(lhs.type()),
+               "Invalid/Unsupported lhs datatype");
+  auto const lhs_is_valid = lhs.is_valid(stream);
+  expects_binary_operation_output(rhs, op, output, rhs.has_nulls() or not lhs_is_valid);
+
+  set_binary_operation_null_mask(output, {rhs}, lhs_is_valid, op, stream);
+  if (not output.is_empty()) { binops::binary_operation(output, lhs, rhs, op, stream); }
+}
+
+void binary_operation(column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match");
+  auto const has_nulls = lhs.has_nulls() or rhs.has_nulls();
+  expects_binary_operation_output(lhs, op, output, has_nulls);
+  expects_binary_operation_output(rhs, op, output, has_nulls);
+
+  set_binary_operation_null_mask(output, {lhs, rhs}, true, op, stream);
+  if (not output.is_empty()) { binops::binary_operation(output, lhs, rhs, op, stream); }
+}
+
 }  // namespace detail
 
 int32_t binary_operation_fixed_point_scale(binary_operator op,
@@ -757,4 +1036,31 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return detail::binary_operation(lhs, rhs, ptx, output_type, rmm::cuda_stream_default, mr);
 }
 
+void binary_operation(column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::binary_operation(lhs, rhs, op, output, rmm::cuda_stream_default);
+}
+
+void binary_operation(scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::binary_operation(lhs, rhs, op, output, rmm::cuda_stream_default);
+}
+
+void binary_operation(column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::binary_operation(lhs, rhs, op, output, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
@@ -168,9 +168,9 @@ struct binary_op {
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    auto new_mask = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
-    auto out      = make_fixed_width_column(
-      out_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+    auto [new_mask, null_count] = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
+    auto out =
+      make_fixed_width_column(out_type, lhs.size(), std::move(new_mask), null_count, stream, mr);
 
     if (lhs.size() > 0) {
       auto out_view        = out->mutable_view();
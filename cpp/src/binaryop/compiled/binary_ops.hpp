@@ -123,6 +123,54 @@ std::unique_ptr<column> binary_operation(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes `out[i] = op(lhs, rhs[i])` with a compiled kernel, if `op` has one for the
+ * types of `lhs`, `rhs` and `out`.
+ *
+ * The compiled kernels support numeric and decimal operands, computed with the same conversions
+ * as the JIT kernels, and the chrono operands of the same type, of a timestamp and a duration of
+ * its resolution, and of a duration and an integer, when `out` has the result type of `op`.
+ * Decimal operands must already have the scales expected by `op`.
+ *
+ * @param out         The output column, with the size of `rhs` and the null mask of the result
+ * @param lhs         The left operand scalar
+ * @param rhs         The right operand column
+ * @param op          The binary operator
+ * @param stream      CUDA stream used for device memory operations and kernel launches.
+ * @return true if `out` was computed, false if the types have no compiled kernel
+ */
+bool try_binary_operation(mutable_column_view& out,
+                          scalar const& lhs,
+                          column_view const& rhs,
+                          binary_operator op,
+                          rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc cudf::binops::compiled::try_binary_operation(mutable_column_view&, scalar const&,
+ * column_view const&, binary_operator, rmm::cuda_stream_view)
+ *
+ * @param lhs         The left operand column
+ * @param rhs         The right operand scalar
+ */
+bool try_binary_operation(mutable_column_view& out,
+                          column_view const& lhs,
+                          scalar const& rhs,
+                          binary_operator op,
+                          rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc cudf::binops::compiled::try_binary_operation(mutable_column_view&, scalar const&,
+ * column_view const&, binary_operator, rmm::cuda_stream_view)
+ *
+ * @param lhs         The left operand column
+ * @param rhs         The right operand column
+ */
+bool try_binary_operation(mutable_column_view& out,
+                          column_view const& lhs,
+                          column_view const& rhs,
+                          binary_operator op,
+                          rmm::cuda_stream_view stream);
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_ops.hpp"
+#include "operation.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <type_traits>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+namespace {
+
+/**
+ * @brief A column or scalar operand of a binary operation.
+ *
+ * A scalar is viewed as a column of a single element. Its validity is read in device memory, so
+ * that the operation does not synchronize to read it on the host.
+ */
+struct operand {
+  column_view const view;
+  bool const is_scalar{false};
+  bool const* scalar_validity{nullptr};
+};
+
+/**
+ * @brief Device view of an `operand`.
+ */
+struct operand_device_view {
+  column_device_view const d_column;
+  bool const is_scalar;
+  bool const* scalar_validity;
+
+  __device__ size_type index(size_type i) const { return is_scalar ? 0 : i; }
+
+  __device__ bool is_valid(size_type i) const
+  {
+    return is_scalar ? *scalar_validity : d_column.is_valid(i);
+  }
+};
+
+/**
+ * @brief Type-dispatch functor returning the data of a fixed-width scalar.
+ */
+struct scalar_data_fn {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  void const* operator()(scalar const& s) const
+  {
+    return static_cast<scalar_type_t<T> const&>(s).data();
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_width<T>()>* = nullptr>
+  void const* operator()(scalar const&) const
+  {
+    CUDF_FAIL("Invalid/Unsupported scalar datatype");
+  }
+};
+
+operand make_operand(column_view const& col, rmm::cuda_stream_view) { return operand{col}; }
+
+operand make_operand(scalar const& s, rmm::cuda_stream_view)
+{
+  auto const data = type_dispatcher(s.type(), scalar_data_fn{}, s);
+  return operand{column_view{s.type(), 1, data}, true, s.validity_data()};
+}
+
+/**
+ * @brief Type-dispatch functor reading an element converted to `To`.
+ */
+template <typename To>
+struct element_cast_fn {
+  template <typename From>
+  __device__ To operator()(column_device_view const& d_column, size_type i) const
+  {
+    if constexpr ((is_numeric<From>() or is_chrono<From>()) and std::is_constructible_v<To, From>) {
+      return static_cast<To>(d_column.element<From>(i));
+    } else {
+      return To{};
+    }
+  }
+};
+
+/**
+ * @brief Type-dispatch functor writing a value converted to the type of the output element.
+ */
+template <typename From>
+struct element_store_fn {
+  template <typename To>
+  __device__ void operator()(mutable_column_device_view const& d_out,
+                             size_type i,
+                             From value) const
+  {
+    if constexpr ((is_numeric<To>() or is_chrono<To>()) and std::is_constructible_v<To, From>) {
+      d_out.element<To>(i) = static_cast<To>(value);
+    }
+  }
+};
+
+/**
+ * @brief Computes `out[i] = BinaryOperator{}(lhs[i], rhs[i])` with the operands converted to
+ * `TypeLhs` and `TypeRhs`.
+ *
+ * Decimal operands and outputs are read and written as their representation types, which the
+ * callers have already rescaled.
+ */
+template <typename BinaryOperator, typename TypeLhs, typename TypeRhs>
+struct binary_op_fn {
+  operand_device_view const lhs;
+  operand_device_view const rhs;
+  mutable_column_device_view const d_out;
+
+  __device__ void operator()(size_type i) const
+  {
+    auto const x = type_dispatcher<dispatch_storage_type>(
+      lhs.d_column.type(), element_cast_fn<TypeLhs>{}, lhs.d_column, lhs.index(i));
+    auto const y = type_dispatcher<dispatch_storage_type>(
+      rhs.d_column.type(), element_cast_fn<TypeRhs>{}, rhs.d_column, rhs.index(i));
+    using TypeResult = binary_op_result_t<BinaryOperator, TypeLhs, TypeRhs>;
+    if constexpr (is_null_dependent_op_v<BinaryOperator, TypeLhs, TypeRhs>) {
+      bool output_valid = true;
+      auto const result = BinaryOperator{}(x, y, lhs.is_valid(i), rhs.is_valid(i), output_valid);
+      type_dispatcher<dispatch_storage_type>(
+        d_out.type(), element_store_fn<TypeResult>{}, d_out, i, result);
+      if (!output_valid) { d_out.set_null(i); }
+    } else {
+      type_dispatcher<dispatch_storage_type>(
+        d_out.type(), element_store_fn<TypeResult>{}, d_out, i, BinaryOperator{}(x, y));
+    }
+  }
+};
+
+template <typename BinaryOperator, typename TypeLhs, typename TypeRhs>
+void apply_binary_op(mutable_column_view& out,
+                     operand const& lhs,
+                     operand const& rhs,
+                     rmm::cuda_stream_view stream)
+{
+  auto d_lhs = column_device_view::create(lhs.view, stream);
+  auto d_rhs = column_device_view::create(rhs.view, stream);
+  auto d_out = mutable_column_device_view::create(out, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     out.size(),
+                     binary_op_fn<BinaryOperator, TypeLhs, TypeRhs>{
+                       operand_device_view{*d_lhs, lhs.is_scalar, lhs.scalar_validity},
+                       operand_device_view{*d_rhs, rhs.is_scalar, rhs.scalar_validity},
+                       *d_out});
+}
+
+/**
+ * @brief Type-dispatch functor returning the common type of two numeric types, or `EMPTY` if
+ * either type is not numeric.
+ *
+ * Decimal types are dispatched as their representation types. There is no integer `type_id` for
+ * `__int128_t`, so `DECIMAL128` stands for it.
+ */
+struct common_type_fn {
+  template <typename TypeLhs, typename TypeRhs>
+  data_type operator()() const
+  {
+    if constexpr (is_numeric<TypeLhs>() and is_numeric<TypeRhs>()) {
+      using TypeCommon = std::common_type_t<TypeLhs, TypeRhs>;
+      if constexpr (std::is_same_v<TypeCommon, __int128_t>) {
+        return data_type{type_id::DECIMAL128};
+      } else {
+        return data_type{type_to_id<TypeCommon>()};
+      }
+    } else {
+      return data_type{type_id::EMPTY};
+    }
+  }
+};
+
+data_type common_data_type(data_type lhs, data_type rhs)
+{
+  return double_type_dispatcher<dispatch_storage_type>(lhs, rhs, common_type_fn{});
+}
+
+/**
+ * @brief Returns the type the operands are converted to before applying `op` on numeric types.
+ *
+ * This mirrors the conversions of the JIT operators, e.g. `ADD` computes in the common type of
+ * the output and operand types and `TRUE_DIV` computes in double. Returns `EMPTY` if the compiled
+ * kernels do not support `op` on the types.
+ */
+data_type numeric_operand_type(binary_operator op, data_type out, data_type lhs, data_type rhs)
+{
+  auto const empty_type   = data_type{type_id::EMPTY};
+  auto const out_type     = common_data_type(out, out);
+  auto const operand_type = common_data_type(lhs, rhs);
+  if (out_type == empty_type or operand_type == empty_type) { return empty_type; }
+  auto const is_integral = [](data_type type) { return not is_floating_point(type); };
+
+  switch (op) {
+    case binary_operator::ADD:
+    case binary_operator::SUB:
+    case binary_operator::MUL:
+    case binary_operator::DIV:
+    case binary_operator::MOD: return common_data_type(common_data_type(out_type, lhs), rhs);
+    case binary_operator::TRUE_DIV:
+    case binary_operator::FLOOR_DIV:
+    case binary_operator::POW:
+    case binary_operator::LOG_BASE:
+    case binary_operator::ATAN2: return data_type{type_id::FLOAT64};
+    case binary_operator::PYMOD:
+      if (not is_integral(out_type)) { return data_type{type_id::FLOAT64}; }
+      return is_integral(operand_type) ? common_data_type(data_type{type_id::INT32}, operand_type)
+                                       : empty_type;
+    case binary_operator::PMOD:
+    case binary_operator::EQUAL:
+    case binary_operator::NOT_EQUAL:
+    case binary_operator::LESS:
+    case binary_operator::GREATER:
+    case binary_operator::LESS_EQUAL:
+    case binary_operator::GREATER_EQUAL:
+    case binary_operator::LOGICAL_AND:
+    case binary_operator::LOGICAL_OR:
+    case binary_operator::NULL_EQUALS: return operand_type;
+    case binary_operator::BITWISE_AND:
+    case binary_operator::BITWISE_OR:
+    case binary_operator::BITWISE_XOR:
+      return is_integral(out_type) ? out_type : empty_type;
+    case binary_operator::NULL_MAX:
+    case binary_operator::NULL_MIN: return out_type;
+    case binary_operator::SHIFT_LEFT:
+    case binary_operator::SHIFT_RIGHT:
+      // the shift count does not change the type of the shifted value
+      return is_integral(operand_type)
+               ? common_data_type(data_type{type_id::INT32}, common_data_type(lhs, lhs))
+               : empty_type;
+    case binary_operator::SHIFT_RIGHT_UNSIGNED:
+      // smaller types are promoted after the unsigned conversion
+      return is_integral(operand_type) and size_of(common_data_type(lhs, lhs)) >= 4
+               ? common_data_type(lhs, lhs)
+               : empty_type;
+    default: return empty_type;
+  }
+}
+
+/**
+ * @brief Type-dispatch functor computing a binary operation on numeric types, with the operands
+ * converted to `TypeCommon`.
+ */
+template <typename BinaryOperator>
+struct numeric_binary_op_fn {
+  template <typename TypeCommon>
+  bool operator()(mutable_column_view& out,
+                  operand const& lhs,
+                  operand const& rhs,
+                  rmm::cuda_stream_view stream) const
+  {
+    if constexpr (is_numeric<TypeCommon>() and
+                  is_binary_op_supported_v<BinaryOperator, TypeCommon, TypeCommon>) {
+      apply_binary_op<BinaryOperator, TypeCommon, TypeCommon>(out, lhs, rhs, stream);
+      return true;
+    } else {
+      return false;
+    }
+  }
+};
+
+/**
+ * @brief Indicates whether the operand types are a supported chrono combination.
+ *
+ * The combinations are operands of the same type, a timestamp and a duration of its resolution,
+ * and a duration and an integer.
+ */
+template <typename TypeLhs, typename TypeRhs>
+constexpr bool is_chrono_operands()
+{
+  if constexpr (is_timestamp<TypeLhs>()) {
+    return std::is_same_v<TypeLhs, TypeRhs> or
+           std::is_same_v<typename TypeLhs::duration, TypeRhs>;
+  } else if constexpr (is_duration<TypeLhs>() and is_timestamp<TypeRhs>()) {
+    return std::is_same_v<TypeLhs, typename TypeRhs::duration>;
+  } else if constexpr (is_duration<TypeLhs>()) {
+    return std::is_same_v<TypeLhs, TypeRhs> or is_index_type<TypeRhs>();
+  } else {
+    return is_index_type<TypeLhs>() and is_duration<TypeRhs>();
+  }
+}
+
+/**
+ * @brief Type-dispatch functor computing a binary operation on chrono types.
+ *
+ * The operands are not converted and the output type must be the result type of the operator.
+ */
+template <typename BinaryOperator>
+struct chrono_binary_op_fn {
+  template <typename TypeLhs, typename TypeRhs>
+  bool operator()(mutable_column_view& out,
+                  operand const& lhs,
+                  operand const& rhs,
+                  rmm::cuda_stream_view stream) const
+  {
+    if constexpr (is_chrono_operands<TypeLhs, TypeRhs>() and
+                  is_binary_op_supported_v<BinaryOperator, TypeLhs, TypeRhs>) {
+      using TypeResult = binary_op_result_t<BinaryOperator, TypeLhs, TypeRhs>;
+      if (out.type().id() != type_to_id<TypeResult>()) { return false; }
+      apply_binary_op<BinaryOperator, TypeLhs, TypeRhs>(out, lhs, rhs, stream);
+      return true;
+    } else {
+      return false;
+    }
+  }
+};
+
+/**
+ * @brief Computes a binary operation with the compiled kernels of its operator.
+ */
+struct binary_op_dispatch_fn {
+  template <typename BinaryOperator>
+  bool operator()(mutable_column_view& out,
+                  operand const& lhs,
+                  operand const& rhs,
+                  binary_operator op,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const common_type = numeric_operand_type(op, out.type(), lhs.view.type(), rhs.view.type());
+    if (common_type.id() != type_id::EMPTY) {
+      return type_dispatcher<dispatch_storage_type>(
+        common_type, numeric_binary_op_fn<BinaryOperator>{}, out, lhs, rhs, stream);
+    }
+    if (not is_chrono(lhs.view.type()) and not is_chrono(rhs.view.type())) { return false; }
+    return double_type_dispatcher(lhs.view.type(),
+                                  rhs.view.type(),
+                                  chrono_binary_op_fn<BinaryOperator>{},
+                                  out,
+                                  lhs,
+                                  rhs,
+                                  stream);
+  }
+};
+
+/**
+ * @brief Calls `f.template operator()<BinaryOperator>(args...)` with the `ops` operator of `op`.
+ *
+ * @return false if there is no compiled operator for `op`
+ */
+template <typename Functor, typename... Ts>
+bool operator_dispatcher(binary_operator op, Functor f, Ts&&... args)
+{
+  // clang-format off
+  switch (op) {
+    case binary_operator::ADD:                  return f.template operator()<ops::Add>(std::forward<Ts>(args)...);
+    case binary_operator::SUB:                  return f.template operator()<ops::Sub>(std::forward<Ts>(args)...);
+    case binary_operator::MUL:                  return f.template operator()<ops::Mul>(std::forward<Ts>(args)...);
+    case binary_operator::DIV:                  return f.template operator()<ops::Div>(std::forward<Ts>(args)...);
+    case binary_operator::TRUE_DIV:             return f.template operator()<ops::TrueDiv>(std::forward<Ts>(args)...);
+    case binary_operator::FLOOR_DIV:            return f.template operator()<ops::FloorDiv>(std::forward<Ts>(args)...);
+    case binary_operator::MOD:                  return f.template operator()<ops::Mod>(std::forward<Ts>(args)...);
+    case binary_operator::PYMOD:                return f.template operator()<ops::PyMod>(std::forward<Ts>(args)...);
+    case binary_operator::POW:                  return f.template operator()<ops::Pow>(std::forward<Ts>(args)...);
+    case binary_operator::EQUAL:                return f.template operator()<ops::Equal>(std::forward<Ts>(args)...);
+    case binary_operator::NOT_EQUAL:            return f.template operator()<ops::NotEqual>(std::forward<Ts>(args)...);
+    case binary_operator::LESS:                 return f.template operator()<ops::Less>(std::forward<Ts>(args)...);
+    case binary_operator::GREATER:              return f.template operator()<ops::Greater>(std::forward<Ts>(args)...);
+    case binary_operator::LESS_EQUAL:           return f.template operator()<ops::LessEqual>(std::forward<Ts>(args)...);
+    case binary_operator::GREATER_EQUAL:        return f.template operator()<ops::GreaterEqual>(std::forward<Ts>(args)...);
+    case binary_operator::BITWISE_AND:          return f.template operator()<ops::BitwiseAnd>(std::forward<Ts>(args)...);
+    case binary_operator::BITWISE_OR:           return f.template operator()<ops::BitwiseOr>(std::forward<Ts>(args)...);
+    case binary_operator::BITWISE_XOR:          return f.template operator()<ops::BitwiseXor>(std::forward<Ts>(args)...);
+    case binary_operator::LOGICAL_AND:          return f.template operator()<ops::LogicalAnd>(std::forward<Ts>(args)...);
+    case binary_operator::LOGICAL_OR:           return f.template operator()<ops::LogicalOr>(std::forward<Ts>(args)...);
+    case binary_operator::SHIFT_LEFT:           return f.template operator()<ops::ShiftLeft>(std::forward<Ts>(args)...);
+    case binary_operator::SHIFT_RIGHT:          return f.template operator()<ops::ShiftRight>(std::forward<Ts>(args)...);
+    case binary_operator::SHIFT_RIGHT_UNSIGNED: return f.template operator()<ops::ShiftRightUnsigned>(std::forward<Ts>(args)...);
+    case binary_operator::LOG_BASE:             return f.template operator()<ops::LogBase>(std::forward<Ts>(args)...);
+    case binary_operator::ATAN2:                return f.template operator()<ops::ATan2>(std::forward<Ts>(args)...);
+    case binary_operator::PMOD:                 return f.template operator()<ops::PMod>(std::forward<Ts>(args)...);
+    case binary_operator::NULL_EQUALS:          return f.template operator()<ops::NullEquals>(std::forward<Ts>(args)...);
+    case binary_operator::NULL_MAX:             return f.template operator()<ops::NullMax>(std::forward<Ts>(args)...);
+    case binary_operator::NULL_MIN:             return f.template operator()<ops::NullMin>(std::forward<Ts>(args)...);
+    default:                                    return false;
+  }
+  // clang-format on
+}
+
+template <typename Lhs, typename Rhs>
+bool apply_binary_operation(mutable_column_view& out,
+                            Lhs const& lhs,
+                            Rhs const& rhs,
+                            binary_operator op,
+                            rmm::cuda_stream_view stream)
+{
+  if (out.is_empty()) { return true; }
+  return operator_dispatcher(op,
+                             binary_op_dispatch_fn{},
+                             out,
+                             make_operand(lhs, stream),
+                             make_operand(rhs, stream),
+                             op,
+                             stream);
+}
+
+}  // namespace
+
+bool try_binary_operation(mutable_column_view& out,
+                          scalar const& lhs,
+                          column_view const& rhs,
+                          binary_operator op,
+                          rmm::cuda_stream_view stream)
+{
+  return apply_binary_operation(out, lhs, rhs, op, stream);
+}
+
+bool try_binary_operation(mutable_column_view& out,
+                          column_view const& lhs,
+                          scalar const& rhs,
+                          binary_operator op,
+                          rmm::cuda_stream_view stream)
+{
+  return apply_binary_operation(out, lhs, rhs, op, stream);
+}
+
+bool try_binary_operation(mutable_column_view& out,
+                          column_view const& lhs,
+                          column_view const& rhs,
+                          binary_operator op,
+                          rmm::cuda_stream_view stream)
+{
+  return apply_binary_operation(out, lhs, rhs, op, stream);
+}
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
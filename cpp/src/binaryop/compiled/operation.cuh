@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+namespace ops {
+
+// The operators compute the same expressions as the operators of `binaryop/jit/operation.hpp`.
+// Their return types are deduced from the expressions so that `std::is_invocable` tells which
+// operand types an operator supports.
+
+struct Add {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x + y)
+  {
+    return x + y;
+  }
+};
+
+struct Sub {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x - y)
+  {
+    return x - y;
+  }
+};
+
+struct Mul {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x * y)
+  {
+    return x * y;
+  }
+};
+
+struct Div {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x / y)
+  {
+    return x / y;
+  }
+};
+
+struct TrueDiv {
+  __device__ inline double operator()(double x, double y) const { return x / y; }
+};
+
+struct FloorDiv {
+  __device__ inline double operator()(double x, double y) const { return floor(x / y); }
+};
+
+struct Mod {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x % y)
+  {
+    return x % y;
+  }
+  __device__ inline float operator()(float x, float y) const { return fmodf(x, y); }
+  __device__ inline double operator()(double x, double y) const { return fmod(x, y); }
+};
+
+struct PyMod {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(((x % y) + y) % y)
+  {
+    return ((x % y) + y) % y;
+  }
+  __device__ inline double operator()(double x, double y) const
+  {
+    return fmod(fmod(x, y) + y, y);
+  }
+};
+
+struct PMod {
+  template <typename T, std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+  __device__ inline T operator()(T x, T y) const
+  {
+    auto rem = x % y;
+    if constexpr (std::is_signed_v<decltype(rem)>) {
+      if (rem < 0) rem = (rem + y) % y;
+    }
+    return rem;
+  }
+  template <typename T, std::enable_if_t<std::is_floating_point_v<T>>* = nullptr>
+  __device__ inline T operator()(T x, T y) const
+  {
+    auto rem = fmod(x, y);
+    if (rem < 0) rem = fmod(rem + y, y);
+    return rem;
+  }
+};
+
+struct Pow {
+  __device__ inline double operator()(double x, double y) const { return pow(x, y); }
+};
+
+struct LogBase {
+  __device__ inline double operator()(double x, double y) const { return log(x) / log(y); }
+};
+
+struct ATan2 {
+  __device__ inline double operator()(double x, double y) const { return atan2(x, y); }
+};
+
+struct Equal {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x == y)
+  {
+    return x == y;
+  }
+};
+
+struct NotEqual {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x != y)
+  {
+    return x != y;
+  }
+};
+
+struct Less {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x < y)
+  {
+    return x < y;
+  }
+};
+
+struct Greater {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x > y)
+  {
+    return x > y;
+  }
+};
+
+struct LessEqual {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x <= y)
+  {
+    return x <= y;
+  }
+};
+
+struct GreaterEqual {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x >= y)
+  {
+    return x >= y;
+  }
+};
+
+struct BitwiseAnd {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x & y)
+  {
+    return x & y;
+  }
+};
+
+struct BitwiseOr {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x | y)
+  {
+    return x | y;
+  }
+};
+
+struct BitwiseXor {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x ^ y)
+  {
+    return x ^ y;
+  }
+};
+
+struct LogicalAnd {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x && y)
+  {
+    return x && y;
+  }
+};
+
+struct LogicalOr {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x || y)
+  {
+    return x || y;
+  }
+};
+
+struct ShiftLeft {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x << y)
+  {
+    return x << y;
+  }
+};
+
+struct ShiftRight {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const -> decltype(x >> y)
+  {
+    return x >> y;
+  }
+};
+
+struct ShiftRightUnsigned {
+  template <typename TypeLhs,
+            typename TypeRhs,
+            std::enable_if_t<std::is_integral_v<TypeLhs> and
+                             not std::is_same_v<TypeLhs, bool>>* = nullptr>
+  __device__ inline auto operator()(TypeLhs x, TypeRhs y) const
+    -> decltype(static_cast<std::make_unsigned_t<TypeLhs>>(x) >> y)
+  {
+    return static_cast<std::make_unsigned_t<TypeLhs>>(x) >> y;
+  }
+};
+
+// The null-dependent operators also take the validity of the operands and set the validity of
+// the result.
+
+struct NullEquals {
+  template <typename TypeLhs, typename TypeRhs>
+  __device__ inline auto operator()(
+    TypeLhs x, TypeRhs y, bool lhs_valid, bool rhs_valid, bool& output_valid) const
+    -> decltype(x == y)
+  {
+    output_valid = true;
+    if (!lhs_valid && !rhs_valid) return true;
+    if (lhs_valid && rhs_valid) return x == y;
+    return false;
+  }
+};
+
+struct NullMax {
+  template <typename T>
+  __device__ inline auto operator()(
+    T x, T y, bool lhs_valid, bool rhs_valid, bool& output_valid) const
+    -> std::decay_t<decltype(x > y ? x : y)>
+  {
+    output_valid = lhs_valid || rhs_valid;
+    if (lhs_valid && rhs_valid) return x > y ? x : y;
+    return lhs_valid ? x : y;
+  }
+};
+
+struct NullMin {
+  template <typename T>
+  __device__ inline auto operator()(
+    T x, T y, bool lhs_valid, bool rhs_valid, bool& output_valid) const
+    -> std::decay_t<decltype(x < y ? x : y)>
+  {
+    output_valid = lhs_valid || rhs_valid;
+    if (lhs_valid && rhs_valid) return x < y ? x : y;
+    return lhs_valid ? x : y;
+  }
+};
+
+}  // namespace ops
+
+/**
+ * @brief Indicates whether `BinaryOperator` is a null-dependent operator of the operand types.
+ */
+template <typename BinaryOperator, typename TypeLhs, typename TypeRhs>
+constexpr bool is_null_dependent_op_v =
+  std::is_invocable_v<BinaryOperator, TypeLhs, TypeRhs, bool, bool, bool&>;
+
+/**
+ * @brief Indicates whether `BinaryOperator` supports the operand types.
+ */
+template <typename BinaryOperator, typename TypeLhs, typename TypeRhs>
+constexpr bool is_binary_op_supported_v =
+  std::is_invocable_v<BinaryOperator, TypeLhs, TypeRhs> or
+  is_null_dependent_op_v<BinaryOperator, TypeLhs, TypeRhs>;
+
+/**
+ * @brief The result type of `BinaryOperator` for the operand types.
+ */
+template <typename BinaryOperator, typename TypeLhs, typename TypeRhs, typename = void>
+struct binary_op_result {
+  using type = std::invoke_result_t<BinaryOperator, TypeLhs, TypeRhs>;
+};
+
+template <typename BinaryOperator, typename TypeLhs, typename TypeRhs>
+struct binary_op_result<
+  BinaryOperator,
+  TypeLhs,
+  TypeRhs,
+  std::enable_if_t<is_null_dependent_op_v<BinaryOperator, TypeLhs, TypeRhs>>> {
+  using type = std::invoke_result_t<BinaryOperator, TypeLhs, TypeRhs, bool, bool, bool&>;
+};
+
+template <typename BinaryOperator, typename TypeLhs, typename TypeRhs>
+using binary_op_result_t = typename binary_op_result<BinaryOperator, TypeLhs, TypeRhs>::type;
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -187,17 +187,36 @@ __global__ void count_set_bits_kernel(bitmask_type const *bitmask,
                                       size_type *global_count)
 {
   constexpr auto const word_size{detail::size_in_bits<bitmask_type>()};
+  constexpr size_type const words_per_vector{sizeof(uint4) / sizeof(bitmask_type)};
 
   auto const first_word_index{word_index(first_bit_index)};
   auto const last_word_index{word_index(last_bit_index)};
-  auto const tid         = threadIdx.x + blockIdx.x * blockDim.x;
-  auto thread_word_index = tid + first_word_index;
+  size_type const tid    = threadIdx.x + blockIdx.x * blockDim.x;
+  size_type const stride = blockDim.x * gridDim.x;
   size_type thread_count{0};
 
-  // First, just count the bits in all words
-  while (thread_word_index <= last_word_index) {
-    thread_count += __popc(bitmask[thread_word_index]);
-    thread_word_index += blockDim.x * gridDim.x;
+  // First, just count the bits in all words. The words from the first one aligned to 16 bytes are
+  // loaded as vectors of 128 bits, and the at most `2 * (words_per_vector - 1)` words before and
+  // after them one at a time.
+  auto const first_word_address    = reinterpret_cast<uintptr_t>(bitmask + first_word_index);
+  size_type const misaligned_words = (first_word_address % sizeof(uint4)) / sizeof(bitmask_type);
+  auto const first_vector_word =
+    std::min(last_word_index + 1,
+             first_word_index + (words_per_vector - misaligned_words) % words_per_vector);
+  auto const num_vectors     = (last_word_index + 1 - first_vector_word) / words_per_vector;
+  auto const end_vector_word = first_vector_word + num_vectors * words_per_vector;
+
+  auto const vectors = reinterpret_cast<uint4 const *>(bitmask + first_vector_word);
+  for (auto i = tid; i < num_vectors; i += stride) {
+    auto const vector = vectors[i];
+    thread_count += __popc(vector.x) + __popc(vector.y) + __popc(vector.z) + __popc(vector.w);
+  }
+  auto const num_head_words = first_vector_word - first_word_index;
+  auto const num_tail_words = last_word_index + 1 - end_vector_word;
+  for (auto i = tid; i < num_head_words + num_tail_words; i += stride) {
+    auto const word =
+      i < num_head_words ? first_word_index + i : end_vector_word + (i - num_head_words);
+    thread_count += __popc(bitmask[word]);
   }
 
   // Subtract any slack bits counted from the first and last word
@@ -345,6 +364,61 @@ struct to_word_index : public thrust::unary_function<size_type, size_type> {
   }
 };
 
+/**
+ * @brief Counts the set bits of every range `[indices[2 * r], indices[2 * r + 1])` of every bitmask
+ * `masks[m]`, whose bit 0 is bit `mask_offsets[m]` of the mask.
+ *
+ * Each warp counts the bits of one range of one mask at a time, the count of range `r` of mask `m`
+ * being written to `counts[m * num_ranges + r]`.
+ *
+ * @param[in] masks The bitmasks whose set bits are counted
+ * @param[in] mask_offsets The offset of each bitmask
+ * @param[in] indices The first (inclusive) and last (exclusive) bit index of each range
+ * @param[in] num_ranges The number of ranges
+ * @param[out] counts The number of set bits of each range of each bitmask
+ */
+template <size_type block_size>
+__global__ void batched_count_set_bits_kernel(device_span<bitmask_type const *const> masks,
+                                              device_span<size_type const> mask_offsets,
+                                              device_span<size_type const> indices,
+                                              size_type num_ranges,
+                                              size_type *counts)
+{
+  using WarpReduce = cub::WarpReduce<size_type>;
+  __shared__ typename WarpReduce::TempStorage temp_storage[block_size / detail::warp_size];
+
+  auto const warp_id      = threadIdx.x / detail::warp_size;
+  auto const lane         = threadIdx.x % detail::warp_size;
+  auto const num_warps    = (blockDim.x * gridDim.x) / detail::warp_size;
+  auto const num_segments = masks.size() * num_ranges;
+  std::size_t segment     = (threadIdx.x + blockIdx.x * blockDim.x) / detail::warp_size;
+
+  for (; segment < num_segments; segment += num_warps) {
+    auto const mask  = masks[segment / num_ranges];
+    auto const range = segment % num_ranges;
+    auto const begin = mask_offsets[segment / num_ranges] + indices[2 * range];
+    auto const end   = mask_offsets[segment / num_ranges] + indices[2 * range + 1];
+
+    size_type thread_count{0};
+    if (begin < end) {
+      auto const first_word = word_index(begin);
+      auto const last_word  = word_index(end - 1);
+      for (auto i = first_word + static_cast<size_type>(lane); i <= last_word;
+           i += detail::warp_size) {
+        auto word = mask[i];
+        if (i == first_word) { word &= ~set_least_significant_bits(intra_word_index(begin)); }
+        if (i == last_word and intra_word_index(end) != 0) {
+          word &= set_least_significant_bits(intra_word_index(end));
+        }
+        thread_count += __popc(word);
+      }
+    }
+
+    auto const count = WarpReduce(temp_storage[warp_id]).Sum(thread_count);
+    if (lane == 0) { counts[segment] = count; }
+  }
+}
+
 }  // namespace
 
 namespace detail {
@@ -394,14 +468,14 @@ rmm::device_buffer copy_bitmask(column_view const &view,
 }
 
 // Inplace Bitwise AND of the masks
-void inplace_bitmask_and(device_span<bitmask_type> dest_mask,
-                         host_span<bitmask_type const *> masks,
-                         host_span<size_type const> begin_bits,
-                         size_type mask_size,
-                         rmm::cuda_stream_view stream,
-                         rmm::mr::device_memory_resource *mr)
+size_type inplace_bitmask_and(device_span<bitmask_type> dest_mask,
+                              host_span<bitmask_type const *> masks,
+                              host_span<size_type const> begin_bits,
+                              size_type mask_size,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource *mr)
 {
-  inplace_bitmask_binop(
+  return inplace_bitmask_binop(
     [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
     dest_mask,
     masks,
@@ -412,11 +486,11 @@ void inplace_bitmask_and(device_span<bitmask_type> dest_mask,
 }
 
 // Bitwise AND of the masks
-rmm::device_buffer bitmask_and(host_span<bitmask_type const *> masks,
-                               host_span<size_type const> begin_bits,
-                               size_type mask_size,
-                               rmm::cuda_stream_view stream,
-                               rmm::mr::device_memory_resource *mr)
+std::pair<rmm::device_buffer, size_type> bitmask_and(host_span<bitmask_type const *> masks,
+                                                     host_span<size_type const> begin_bits,
+                                                     size_type mask_size,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource *mr)
 {
   return bitmask_binop(
     [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
@@ -590,14 +664,73 @@ std::vector<size_type> segmented_count_unset_bits(bitmask_type const *bitmask,
   return ret;
 }
 
+std::vector<size_type> batched_segmented_count_unset_bits(
+  host_span<bitmask_type const *const> masks,
+  host_span<size_type const> mask_offsets,
+  host_span<size_type const> indices,
+  rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(masks.size() == mask_offsets.size(), "Mismatch between masks and their offsets.");
+  CUDF_EXPECTS(indices.size() % 2 == 0,
+               "Array of indices needs to have an even number of elements.");
+  for (size_t i = 0; i < indices.size() / 2; i++) {
+    auto begin = indices[i * 2];
+    auto end   = indices[i * 2 + 1];
+    CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
+    CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
+  }
+
+  size_type const num_ranges = indices.size() / 2;
+  std::vector<size_type> ret(masks.size() * num_ranges, 0);
+
+  // Only the ranges of the masks that exist are counted
+  std::vector<bitmask_type const *> h_masks;
+  std::vector<size_type> h_mask_offsets;
+  for (size_t m = 0; m < masks.size(); m++) {
+    if (masks[m] != nullptr) {
+      h_masks.push_back(masks[m]);
+      h_mask_offsets.push_back(mask_offsets[m]);
+    }
+  }
+  if (h_masks.empty() or num_ranges == 0) { return ret; }
+
+  auto const d_masks        = make_device_uvector_async(h_masks, stream);
+  auto const d_mask_offsets = make_device_uvector_async(h_mask_offsets, stream);
+  auto const d_indices      = make_device_uvector_async(indices, stream);
+  rmm::device_uvector<size_type> d_counts(h_masks.size() * num_ranges, stream);
+
+  // The warps loop over the ranges, so that their number of threads fits in a `size_type`
+  constexpr size_type block_size{256};
+  constexpr std::size_t max_warps{1 << 20};
+  cudf::detail::grid_1d grid(std::min(d_counts.size(), max_warps) * detail::warp_size, block_size);
+  batched_count_set_bits_kernel<block_size>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      d_masks, d_mask_offsets, d_indices, num_ranges, d_counts.data());
+  CHECK_CUDA(stream.value());
+
+  auto const h_counts = make_std_vector_sync(d_counts, stream);
+  for (size_t m = 0, nullable = 0; m < masks.size(); m++) {
+    if (masks[m] == nullptr) { continue; }
+    for (size_type r = 0; r < num_ranges; r++) {
+      ret[m * num_ranges + r] =
+        (indices[2 * r + 1] - indices[2 * r]) - h_counts[nullable * num_ranges + r];
+    }
+    nullable++;
+  }
+
+  return ret;
+}
+
 // Returns the bitwise AND of the null masks of all columns in the table view
-rmm::device_buffer bitmask_and(table_view const &view,
-                               rmm::cuda_stream_view stream,
-                               rmm::mr::device_memory_resource *mr)
+std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const &view,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource *mr)
 {
   CUDF_FUNC_RANGE();
   rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+  if (view.num_rows() == 0 or view.num_columns() == 0) {
+    return std::make_pair(std::move(null_mask), 0);
+  }
 
   std::vector<bitmask_type const *> masks;
   std::vector<size_type> offsets;
@@ -618,17 +751,19 @@ rmm::device_buffer bitmask_and(table_view const &view,
       mr);
   }
 
-  return null_mask;
+  return std::make_pair(std::move(null_mask), 0);
 }
 
 // Returns the bitwise OR of the null masks of all columns in the table view
-rmm::device_buffer bitmask_or(table_view const &view,
-                              rmm::cuda_stream_view stream,
-                              rmm::mr::device_memory_resource *mr)
+std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const &view,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource *mr)
 {
   CUDF_FUNC_RANGE();
   rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+  if (view.num_rows() == 0 or view.num_columns() == 0) {
+    return std::make_pair(std::move(null_mask), 0);
+  }
 
   std::vector<bitmask_type const *> masks;
   std::vector<size_type> offsets;
@@ -649,7 +784,7 @@ rmm::device_buffer bitmask_or(table_view const &view,
       mr);
   }
 
-  return null_mask;
+  return std::make_pair(std::move(null_mask), 0);
 }
 }  // namespace detail
 
@@ -700,12 +835,12 @@ rmm::device_buffer copy_bitmask(column_view const &view, rmm::mr::device_memory_
 
 rmm::device_buffer bitmask_and(table_view const &view, rmm::mr::device_memory_resource *mr)
 {
-  return detail::bitmask_and(view, rmm::cuda_stream_default, mr);
+  return detail::bitmask_and(view, rmm::cuda_stream_default, mr).first;
 }
 
 rmm::device_buffer bitmask_or(table_view const &view, rmm::mr::device_memory_resource *mr)
 {
-  return detail::bitmask_or(view, rmm::cuda_stream_default, mr);
+  return detail::bitmask_or(view, rmm::cuda_stream_default, mr).first;
 }
 
 }  // namespace cudf
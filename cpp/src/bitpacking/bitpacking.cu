@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/bitpacking.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/bitpacking.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+
+bitpacked_column::bitpacked_column(data_type type,
+                                   size_type size,
+                                   int bit_width,
+                                   uint64_t reference,
+                                   uint64_t range,
+                                   rmm::device_buffer&& data,
+                                   rmm::device_buffer&& null_mask,
+                                   size_type null_count)
+  : _type{type},
+    _size{size},
+    _bit_width{bit_width},
+    _reference{reference},
+    _range{range},
+    _data{std::move(data)},
+    _null_mask{std::move(null_mask)},
+    _null_count{null_count}
+{
+  CUDF_EXPECTS(bit_width >= 0 and bit_width <= 64, "Invalid bit width");
+  CUDF_EXPECTS(_data.size() * 8 >= static_cast<std::size_t>(size) * bit_width,
+               "Packed data is too small for the number of rows");
+}
+
+namespace detail {
+namespace {
+
+constexpr int word_bits = 64;
+
+template <typename T>
+constexpr bool is_bitpackable()
+{
+  return std::is_integral<T>::value and not std::is_same<T, bool>::value;
+}
+
+/**
+ * @brief Reads the difference to the reference stored for a row.
+ */
+struct packed_row_reader {
+  uint64_t const* words;
+  int bit_width;
+
+  __device__ uint64_t operator()(size_type row) const
+  {
+    if (bit_width == 0) { return 0; }
+    auto const bit   = static_cast<int64_t>(row) * bit_width;
+    auto const word  = bit / word_bits;
+    auto const shift = static_cast<int>(bit % word_bits);
+    auto value       = words[word] >> shift;
+    // The row continues in the next word
+    if (shift + bit_width > word_bits) { value |= words[word + 1] << (word_bits - shift); }
+    return bit_width == word_bits ? value : value & ((uint64_t{1} << bit_width) - 1);
+  }
+};
+
+packed_row_reader make_reader(bitpacked_column const& input)
+{
+  return packed_row_reader{input.data(), input.bit_width()};
+}
+
+/**
+ * @brief Returns a copy of the null mask of `input`, or an empty buffer.
+ */
+rmm::device_buffer copy_null_mask(bitpacked_column const& input,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  if (not input.nullable()) { return rmm::device_buffer{0, stream, mr}; }
+  return rmm::device_buffer{
+    input.null_mask(), bitmask_allocation_size_bytes(input.size()), stream, mr};
+}
+
+struct bitpack_fn {
+  template <typename T, std::enable_if_t<is_bitpackable<T>()>* = nullptr>
+  std::unique_ptr<bitpacked_column> operator()(column_view const& input,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+  {
+    using U          = std::make_unsigned_t<T>;
+    auto const size  = input.size();
+    auto const valid = size - input.null_count();
+    auto null_mask   = copy_bitmask(input, stream, mr);
+    if (valid == 0) {
+      return std::make_unique<bitpacked_column>(input.type(),
+                                                size,
+                                                0,
+                                                0,
+                                                0,
+                                                rmm::device_buffer{0, stream, mr},
+                                                std::move(null_mask),
+                                                input.null_count());
+    }
+
+    auto const d_input = column_device_view::create(input, stream);
+    auto const minmax  = thrust::transform_reduce(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(size),
+      [d_input = *d_input] __device__(size_type row) {
+        if (d_input.is_null(row)) {
+          return thrust::make_pair(std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest());
+        }
+        auto const value = d_input.element<T>(row);
+        return thrust::make_pair(value, value);
+      },
+      thrust::make_pair(std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest()),
+      [] __device__(thrust::pair<T, T> lhs, thrust::pair<T, T> rhs) {
+        return thrust::make_pair(thrust::min(lhs.first, rhs.first),
+                                 thrust::max(lhs.second, rhs.second));
+      });
+
+    auto const reference = static_cast<uint64_t>(minmax.first);
+    auto const range =
+      static_cast<uint64_t>(static_cast<U>(static_cast<uint64_t>(minmax.second) - reference));
+
+    int bit_width = 0;
+    while (bit_width < word_bits and (range >> bit_width) != 0) {
+      ++bit_width;
+    }
+
+    auto const num_words = (static_cast<int64_t>(size) * bit_width + word_bits - 1) / word_bits;
+    rmm::device_buffer data{static_cast<std::size_t>(num_words) * sizeof(uint64_t), stream, mr};
+    if (num_words > 0) {
+      // Each word is assembled from the rows that overlap it, so that no two threads write to the
+      // same word
+      thrust::transform(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator<int64_t>(0),
+        thrust::make_counting_iterator<int64_t>(num_words),
+        static_cast<uint64_t*>(data.data()),
+        [d_input = *d_input, bit_width, reference, size] __device__(int64_t word) {
+          auto const first_bit = word * word_bits;
+          auto const end_row =
+            thrust::min<int64_t>(size, (first_bit + word_bits + bit_width - 1) / bit_width);
+          uint64_t result = 0;
+          for (auto row = first_bit / bit_width; row < end_row; ++row) {
+            auto const delta =
+              d_input.is_null(row)
+                ? uint64_t{0}
+                : static_cast<uint64_t>(
+                    static_cast<U>(static_cast<uint64_t>(d_input.element<T>(row)) - reference));
+            auto const bit = row * bit_width;
+            result |= bit >= first_bit ? delta << (bit - first_bit) : delta >> (first_bit - bit);
+          }
+          return result;
+        });
+    }
+
+    return std::make_unique<bitpacked_column>(input.type(),
+                                              size,
+                                              bit_width,
+                                              reference,
+                                              range,
+                                              std::move(data),
+                                              std::move(null_mask),
+                                              input.null_count());
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_bitpackable<T>(), std::unique_ptr<bitpacked_column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Only integer columns can be bit-packed");
+  }
+};
+
+/**
+ * @brief Writes the decoded rows given by an iterator of row indices.
+ */
+struct decode_fn {
+  template <typename T, typename RowIterator, std::enable_if_t<is_bitpackable<T>()>* = nullptr>
+  void operator()(bitpacked_column const& input,
+                  RowIterator rows,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+  {
+    using U = std::make_unsigned_t<T>;
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + output.size(),
+                      output.begin<T>(),
+                      [reader = make_reader(input), reference = input.reference()] __device__(
+                        size_type row) {
+                        return static_cast<T>(static_cast<U>(reference + reader(row)));
+                      });
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_bitpackable<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Invalid bit-packed column type");
+  }
+};
+
+template <typename T>
+CUDA_HOST_DEVICE_CALLABLE bool compare(binary_operator op, T lhs, T rhs)
+{
+  switch (op) {
+    case binary_operator::EQUAL: return lhs == rhs;
+    case binary_operator::NOT_EQUAL: return lhs != rhs;
+    case binary_operator::LESS: return lhs < rhs;
+    case binary_operator::GREATER: return lhs > rhs;
+    case binary_operator::LESS_EQUAL: return lhs <= rhs;
+    default: return lhs >= rhs;
+  }
+}
+
+struct compare_fn {
+  template <typename T, std::enable_if_t<is_bitpackable<T>()>* = nullptr>
+  void operator()(bitpacked_column const& lhs,
+                  scalar const& rhs,
+                  binary_operator op,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+  {
+    using U          = std::make_unsigned_t<T>;
+    auto const value = static_cast<numeric_scalar<T> const&>(rhs).value(stream);
+    auto const min   = static_cast<T>(static_cast<U>(lhs.reference()));
+    auto const max   = static_cast<T>(static_cast<U>(lhs.reference() + lhs.range()));
+    auto const out   = output.begin<bool>();
+
+    // Out of the range of the column, every row compares with the scalar as its minimum or its
+    // maximum does
+    if (value < min or value > max) {
+      thrust::fill(rmm::exec_policy(stream),
+                   out,
+                   out + output.size(),
+                   compare(op, value < min ? min : max, value));
+      return;
+    }
+
+    // The differences to the reference are in the order of the values they encode
+    auto const delta =
+      static_cast<uint64_t>(static_cast<U>(static_cast<uint64_t>(value) - lhs.reference()));
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(output.size()),
+                      out,
+                      [reader = make_reader(lhs), op, delta] __device__(size_type row) {
+                        return compare(op, reader(row), delta);
+                      });
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_bitpackable<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Invalid bit-packed column type");
+  }
+};
+
+struct make_integer_scalar_fn {
+  template <typename T, std::enable_if_t<is_bitpackable<T>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(uint64_t value,
+                                     bool is_valid,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return std::make_unique<numeric_scalar<T>>(static_cast<T>(value), is_valid, stream, mr);
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_bitpackable<T>(), std::unique_ptr<scalar>> operator()(Args&&...)
+  {
+    CUDF_FAIL("The reduction of a bit-packed column must be of an integer type");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<bitpacked_column> bitpack(column_view const& input,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(input.type(), bitpack_fn{}, input, stream, mr);
+}
+
+std::unique_ptr<column> decode(bitpacked_column const& input,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  auto result = make_fixed_width_column(
+    input.type(), input.size(), copy_null_mask(input, stream, mr), input.null_count(), stream, mr);
+  auto output = result->mutable_view();
+  type_dispatcher(input.type(),
+                  decode_fn{},
+                  input,
+                  thrust::make_counting_iterator<size_type>(0),
+                  output,
+                  stream);
+  return result;
+}
+
+std::unique_ptr<column> decode(bitpacked_column const& input,
+                               column_view const& gather_map,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(gather_map.type().id() == type_id::INT32, "Gather map must be of type INT32");
+  CUDF_EXPECTS(not gather_map.has_nulls(), "Gather map must not have nulls");
+
+  auto const rows = gather_map.begin<size_type>();
+  auto null_mask  = std::make_pair(rmm::device_buffer{0, stream, mr}, size_type{0});
+  if (input.nullable()) {
+    null_mask = valid_if(
+      rows,
+      rows + gather_map.size(),
+      [mask = input.null_mask()] __device__(size_type row) { return bit_is_set(mask, row); },
+      stream,
+      mr);
+  }
+  auto result = make_fixed_width_column(input.type(),
+                                        gather_map.size(),
+                                        std::move(null_mask.first),
+                                        null_mask.second,
+                                        stream,
+                                        mr);
+  auto output = result->mutable_view();
+  type_dispatcher(input.type(), decode_fn{}, input, rows, output, stream);
+  return result;
+}
+
+std::unique_ptr<scalar> reduce(bitpacked_column const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  auto const valid = input.size() - input.null_count();
+  uint64_t result  = 0;
+  switch (agg->kind) {
+    case aggregation::MIN: result = input.reference(); break;
+    case aggregation::MAX: result = input.reference() + input.range(); break;
+    case aggregation::SUM: {
+      // Null rows are stored as the reference, with a difference of 0
+      auto const deltas = thrust::transform_reduce(rmm::exec_policy(stream),
+                                                   thrust::make_counting_iterator<size_type>(0),
+                                                   thrust::make_counting_iterator(input.size()),
+                                                   make_reader(input),
+                                                   uint64_t{0},
+                                                   thrust::plus<uint64_t>{});
+      result = input.reference() * static_cast<uint64_t>(valid) + deltas;
+      break;
+    }
+    default: CUDF_FAIL("Unsupported reduction of a bit-packed column");
+  }
+  return type_dispatcher(output_dtype, make_integer_scalar_fn{}, result, valid > 0, stream, mr);
+}
+
+std::unique_ptr<column> binary_operation(bitpacked_column const& lhs,
+                                         scalar const& rhs,
+                                         binary_operator op,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(op == binary_operator::EQUAL or op == binary_operator::NOT_EQUAL or
+                 op == binary_operator::LESS or op == binary_operator::GREATER or
+                 op == binary_operator::LESS_EQUAL or op == binary_operator::GREATER_EQUAL,
+               "Unsupported operator for a bit-packed column");
+  CUDF_EXPECTS(lhs.type() == rhs.type(), "The scalar must be of the type of the column");
+
+  if (not rhs.is_valid(stream) or lhs.null_count() == lhs.size()) {
+    return make_fixed_width_column(
+      data_type{type_id::BOOL8}, lhs.size(), mask_state::ALL_NULL, stream, mr);
+  }
+  auto result = make_fixed_width_column(data_type{type_id::BOOL8},
+                                        lhs.size(),
+                                        copy_null_mask(lhs, stream, mr),
+                                        lhs.null_count(),
+                                        stream,
+                                        mr);
+  auto output = result->mutable_view();
+  type_dispatcher(lhs.type(), compare_fn{}, lhs, rhs, op, output, stream);
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<bitpacked_column> bitpack(column_view const& input,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bitpack(input, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> decode(bitpacked_column const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decode(input, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> decode(bitpacked_column const& input,
+                               column_view const& gather_map,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decode(input, gather_map, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<scalar> reduce(bitpacked_column const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(input, agg, output_dtype, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> binary_operation(bitpacked_column const& lhs,
+                                         scalar const& rhs,
+                                         binary_operator op,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::binary_operation(lhs, rhs, op, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
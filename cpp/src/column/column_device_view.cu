@@ -16,6 +16,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/device_view_storage.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -54,16 +55,14 @@ create_device_view_from_view(ColumnView const& source, rmm::cuda_stream_view str
   auto const descendant_storage_bytes = std::accumulate(
     get_extent, get_extent + num_children, std::size_t{alignof(ColumnDeviceView) - 1});
 
-  // A buffer of CPU memory is allocated to hold the ColumnDeviceView
-  // objects. Once filled, the CPU memory is copied to device memory
-  // and then set into the d_children member pointer.
-  std::vector<char> staging_buffer(descendant_storage_bytes);
-
+  // The ColumnDeviceView objects are built in pinned host memory, then copied to device memory
+  // and set into the d_children member pointer. Both memories come from the cache of descriptor
+  // storage, which is returned to the cache along with the view.
   // Each ColumnDeviceView instance may have child objects that
   // require setting some internal device pointers before being copied
   // from CPU to device.
-  rmm::device_buffer* const descendant_storage =
-    new rmm::device_buffer(descendant_storage_bytes, stream);
+  auto* const descendant_storage =
+    new detail::device_view_storage(descendant_storage_bytes, stream);
 
   auto deleter = [descendant_storage](ColumnDeviceView* v) {
     v->destroy();
@@ -71,16 +70,12 @@ create_device_view_from_view(ColumnView const& source, rmm::cuda_stream_view str
   };
 
   std::unique_ptr<ColumnDeviceView, decltype(deleter)> result{
-    new ColumnDeviceView(source, staging_buffer.data(), descendant_storage->data()), deleter};
+    new ColumnDeviceView(
+      source, descendant_storage->host_data(), descendant_storage->device_data()),
+    deleter};
 
   // copy the CPU memory with all the children into device memory
-  CUDA_TRY(cudaMemcpyAsync(descendant_storage->data(),
-                           staging_buffer.data(),
-                           descendant_storage->size(),
-                           cudaMemcpyDefault,
-                           stream.value()));
-
-  stream.synchronize();
+  descendant_storage->copy_to_device(0, descendant_storage_bytes);
 
   return result;
 }
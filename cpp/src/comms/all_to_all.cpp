@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/comms.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace cudf {
+namespace comms {
+namespace detail {
+namespace {
+
+/**
+ * @brief Sizes of a packed partition, exchanged before the partition itself.
+ */
+struct packed_sizes {
+  uint64_t metadata_size;
+  uint64_t gpu_data_size;
+};
+
+/**
+ * @brief Posts the messages to and from every other rank in a group, each rank sending first to
+ * the next ranks so that the transfers of a rank are spread over its peers.
+ *
+ * @param comm The communicator of the ranks
+ * @param post The function posting the sends and receives to and from a peer rank
+ */
+template <typename PostFunction>
+void exchange_with_peers(communicator& comm, PostFunction post)
+{
+  comm.group_start();
+  for (int i = 1; i < comm.size(); ++i) {
+    post((comm.rank() + i) % comm.size());
+  }
+  comm.group_end();
+}
+
+}  // namespace
+
+std::vector<packed_columns> all_to_all(communicator& comm,
+                                       table_view const& input,
+                                       std::vector<size_type> const& partition_offsets,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto const num_ranks = comm.size();
+  auto const rank      = comm.rank();
+  CUDF_EXPECTS(num_ranks > 0 and rank >= 0 and rank < num_ranks, "Invalid rank of communicator");
+  CUDF_EXPECTS(input.num_columns() > 0, "Table to exchange has no columns");
+  CUDF_EXPECTS(not partition_offsets.empty() or input.num_rows() == 0,
+               "Missing partition offsets of the table rows");
+  CUDF_EXPECTS(partition_offsets.empty() or
+                 partition_offsets.size() == static_cast<std::size_t>(num_ranks),
+               "Mismatch between the number of partitions and of ranks");
+
+  // The partitions are packed by splitting the table at the offsets of the partitions after the
+  // first one; an empty table has empty partitions
+  std::vector<size_type> splits(num_ranks - 1, 0);
+  if (not partition_offsets.empty()) {
+    std::copy(partition_offsets.begin() + 1, partition_offsets.end(), splits.begin());
+  }
+  auto packed = cudf::detail::contiguous_split(input, splits, stream, mr);
+
+  std::vector<packed_sizes> h_send_sizes(num_ranks);
+  std::transform(packed.begin(), packed.end(), h_send_sizes.begin(), [](auto const& partition) {
+    return packed_sizes{partition.data.metadata_->size(), partition.data.gpu_data->size()};
+  });
+
+  // The sizes of every partition are exchanged first, to allocate the receiving buffers
+  auto const sizes_bytes = num_ranks * sizeof(packed_sizes);
+  rmm::device_buffer send_sizes(sizes_bytes, stream);
+  rmm::device_buffer recv_sizes(sizes_bytes, stream);
+  CUDA_TRY(cudaMemcpyAsync(
+    send_sizes.data(), h_send_sizes.data(), sizes_bytes, cudaMemcpyHostToDevice, stream.value()));
+  exchange_with_peers(comm, [&](int peer) {
+    comm.send(static_cast<packed_sizes const*>(send_sizes.data()) + peer,
+              sizeof(packed_sizes),
+              peer,
+              stream);
+    comm.recv(
+      static_cast<packed_sizes*>(recv_sizes.data()) + peer, sizeof(packed_sizes), peer, stream);
+  });
+  std::vector<packed_sizes> h_recv_sizes(num_ranks);
+  CUDA_TRY(cudaMemcpyAsync(
+    h_recv_sizes.data(), recv_sizes.data(), sizes_bytes, cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+
+  // The host metadata of the partitions is staged in device memory, at the same offsets in the
+  // send and receive buffers of each peer
+  auto metadata_offsets = [num_ranks](std::vector<packed_sizes> const& sizes) {
+    std::vector<std::size_t> offsets(num_ranks + 1, 0);
+    std::transform_inclusive_scan(sizes.begin(),
+                                  sizes.end(),
+                                  offsets.begin() + 1,
+                                  std::plus<>{},
+                                  [](auto const& s) { return s.metadata_size; });
+    return offsets;
+  };
+  auto const send_metadata_offsets = metadata_offsets(h_send_sizes);
+  auto const recv_metadata_offsets = metadata_offsets(h_recv_sizes);
+  std::vector<uint8_t> h_send_metadata(send_metadata_offsets.back());
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    auto const& metadata = *packed[peer].data.metadata_;
+    std::copy(metadata.data(),
+              metadata.data() + metadata.size(),
+              h_send_metadata.begin() + send_metadata_offsets[peer]);
+  }
+  rmm::device_buffer send_metadata(h_send_metadata.size(), stream);
+  rmm::device_buffer recv_metadata(recv_metadata_offsets.back(), stream);
+  CUDA_TRY(cudaMemcpyAsync(send_metadata.data(),
+                           h_send_metadata.data(),
+                           h_send_metadata.size(),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+
+  // The partitions of the other ranks are received straight into the returned device buffers
+  std::vector<std::unique_ptr<rmm::device_buffer>> recv_data(num_ranks);
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    if (peer == rank) { continue; }
+    recv_data[peer] =
+      std::make_unique<rmm::device_buffer>(h_recv_sizes[peer].gpu_data_size, stream, mr);
+  }
+  exchange_with_peers(comm, [&](int peer) {
+    auto const& send_sizes = h_send_sizes[peer];
+    auto const& recv_sizes = h_recv_sizes[peer];
+    comm.send(static_cast<uint8_t const*>(send_metadata.data()) + send_metadata_offsets[peer],
+              send_sizes.metadata_size,
+              peer,
+              stream);
+    comm.recv(static_cast<uint8_t*>(recv_metadata.data()) + recv_metadata_offsets[peer],
+              recv_sizes.metadata_size,
+              peer,
+              stream);
+    // Both ranks know the sizes, so the partitions without device data are skipped on both sides
+    if (send_sizes.gpu_data_size > 0) {
+      comm.send(packed[peer].data.gpu_data->data(), send_sizes.gpu_data_size, peer, stream);
+    }
+    if (recv_sizes.gpu_data_size > 0) {
+      comm.recv(recv_data[peer]->data(), recv_sizes.gpu_data_size, peer, stream);
+    }
+  });
+  std::vector<uint8_t> h_recv_metadata(recv_metadata_offsets.back());
+  CUDA_TRY(cudaMemcpyAsync(h_recv_metadata.data(),
+                           recv_metadata.data(),
+                           h_recv_metadata.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  std::vector<packed_columns> received(num_ranks);
+  for (int peer = 0; peer < num_ranks; ++peer) {
+    if (peer == rank) {
+      received[peer] = std::move(packed[peer].data);
+      continue;
+    }
+    std::vector<uint8_t> metadata(h_recv_metadata.begin() + recv_metadata_offsets[peer],
+                                  h_recv_metadata.begin() + recv_metadata_offsets[peer + 1]);
+    received[peer] = packed_columns{
+      std::make_unique<packed_columns::metadata>(std::move(metadata)), std::move(recv_data[peer])};
+  }
+  return received;
+}
+
+}  // namespace detail
+
+std::vector<packed_columns> all_to_all(communicator& comm,
+                                       table_view const& input,
+                                       std::vector<size_type> const& partition_offsets,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::all_to_all(comm, input, partition_offsets, stream, mr);
+}
+
+}  // namespace comms
+}  // namespace cudf
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/ipc.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <arrow/c/bridge.h>
+#include <arrow/util/bit_util.h>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf {
+namespace ipc {
+namespace {
+
+/**
+ * @brief Returns whether `col` and its descendants have no offset, in which case the offsets of
+ * its strings and lists start at zero and its buffers are encoded as is.
+ */
+bool has_zero_offsets(column_view const& col)
+{
+  return col.offset() == 0 &&
+         std::all_of(col.child_begin(), col.child_end(), [](auto const& child) {
+           return has_zero_offsets(child);
+         });
+}
+
+/**
+ * @brief Builds Arrow arrays whose buffers wrap the device memory of columns, for the Arrow IPC
+ * writer to compute the metadata of the record batch from their sizes.
+ *
+ * The writer reads the first and last offsets of strings and lists arrays, so those arrays have
+ * host offsets buffers holding only these two values, which are mapped back to the device offsets
+ * when the body is copied.
+ */
+struct proxy_builder {
+  std::unordered_map<uint8_t const*, uint8_t const*> device_buffers;
+  std::vector<std::shared_ptr<arrow::Buffer>> host_offsets;
+
+  std::shared_ptr<arrow::Buffer> wrap(void const* data, int64_t size) const
+  {
+    if (data == nullptr) { return nullptr; }
+    return std::make_shared<arrow::Buffer>(static_cast<uint8_t const*>(data), size);
+  }
+
+  std::shared_ptr<arrow::Buffer> offsets(column_view const& offsets, size_type last_offset)
+  {
+    auto const num_bytes = static_cast<int64_t>(offsets.size() * sizeof(size_type));
+    auto result          = arrow::AllocateBuffer(num_bytes);
+    CUDF_EXPECTS(result.ok(), "Failed to allocate Arrow buffer for offsets");
+    std::shared_ptr<arrow::Buffer> buffer = std::move(result.ValueOrDie());
+
+    auto const host_data          = reinterpret_cast<size_type*>(buffer->mutable_data());
+    host_data[0]                  = 0;
+    host_data[offsets.size() - 1] = last_offset;
+
+    device_buffers[buffer->data()] = offsets.head<uint8_t>();
+    host_offsets.push_back(buffer);
+    return buffer;
+  }
+
+  std::shared_ptr<arrow::ArrayData> operator()(column_view const& col,
+                                               std::shared_ptr<arrow::DataType> const& type)
+  {
+    auto const mask_bytes = static_cast<int64_t>(bitmask_allocation_size_bytes(col.size()));
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers{wrap(col.null_mask(), mask_bytes)};
+    std::vector<std::shared_ptr<arrow::ArrayData>> children;
+    switch (col.type().id()) {
+      case type_id::STRING:
+        if (col.num_children() == 0) {
+          buffers.push_back(nullptr);
+          buffers.push_back(nullptr);
+        } else {
+          auto const chars = col.child(strings_column_view::chars_column_index);
+          buffers.push_back(
+            offsets(col.child(strings_column_view::offsets_column_index), chars.size()));
+          buffers.push_back(wrap(chars.head(), chars.size()));
+        }
+        break;
+      case type_id::LIST: {
+        auto const child = col.child(lists_column_view::child_column_index);
+        buffers.push_back(
+          offsets(col.child(lists_column_view::offsets_column_index), child.size()));
+        children.push_back((*this)(child, type->field(0)->type()));
+        break;
+      }
+      case type_id::STRUCT:
+        for (size_type idx = 0; idx < col.num_children(); ++idx) {
+          children.push_back((*this)(col.child(idx), type->field(idx)->type()));
+        }
+        break;
+      default:
+        buffers.push_back(wrap(col.head(), static_cast<int64_t>(col.size()) * size_of(col.type())));
+    }
+    auto data = arrow::ArrayData::Make(type, col.size(), std::move(buffers), col.null_count());
+
+    data->child_data = std::move(children);
+    return data;
+  }
+};
+
+std::shared_ptr<arrow::Schema> arrow_schema(table_view const& input,
+                                            std::vector<column_metadata> const& metadata)
+{
+  auto c_schema = to_arrow_schema(input, metadata);
+  auto result   = arrow::ImportSchema(c_schema.get());
+  CUDF_EXPECTS(result.ok(), "Failed to import the Arrow schema");
+  return result.ValueOrDie();
+}
+
+std::unique_ptr<rmm::device_buffer> encode_record_batch(table_view const& input,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  // the buffers of sliced columns are copied to be encoded as is
+  std::vector<std::unique_ptr<column>> copies;
+  std::vector<column_view> columns;
+  for (auto const& col : input) {
+    if (has_zero_offsets(col)) {
+      columns.push_back(col);
+    } else {
+      copies.push_back(std::make_unique<column>(col, stream));
+      columns.push_back(copies.back()->view());
+    }
+  }
+  auto const view   = table_view{columns};
+  auto const schema = arrow_schema(view, {});
+
+  proxy_builder proxies;
+  std::vector<std::shared_ptr<arrow::ArrayData>> arrays;
+  for (size_type idx = 0; idx < view.num_columns(); ++idx) {
+    arrays.push_back(proxies(view.column(idx), schema->field(idx)->type()));
+  }
+  auto const batch = arrow::RecordBatch::Make(schema, view.num_rows(), std::move(arrays));
+
+  arrow::ipc::IpcPayload payload;
+  CUDF_EXPECTS(
+    arrow::ipc::GetRecordBatchPayload(*batch, arrow::ipc::IpcWriteOptions::Defaults(), &payload)
+      .ok(),
+    "Failed to encode the record batch metadata");
+
+  // encapsulated message: continuation token, metadata size, padded metadata, then the body
+  constexpr int32_t prefix_size = 2 * sizeof(int32_t);
+  auto const metadata_size      = static_cast<int32_t>(payload.metadata->size());
+  auto const padded_size        = static_cast<int32_t>(
+    arrow::BitUtil::RoundUpToMultipleOf8(metadata_size + prefix_size) - prefix_size);
+  std::vector<uint8_t> header(prefix_size + padded_size, 0);
+  int32_t const prefix[2] = {-1, padded_size};
+  std::memcpy(header.data(), prefix, prefix_size);
+  std::memcpy(header.data() + prefix_size, payload.metadata->data(), metadata_size);
+
+  auto const message_size = header.size() + payload.body_length;
+  auto result             = std::make_unique<rmm::device_buffer>(message_size, stream, mr);
+  auto const d_message    = static_cast<uint8_t*>(result->data());
+  CUDA_TRY(cudaMemcpyAsync(
+    d_message, header.data(), header.size(), cudaMemcpyHostToDevice, stream.value()));
+
+  // the body buffers are copied from device memory and padded to 8 bytes
+  auto d_body = d_message + header.size();
+  for (auto const& buffer : payload.body_buffers) {
+    auto const size    = buffer ? buffer->size() : 0;
+    auto const padding = arrow::BitUtil::RoundUpToMultipleOf8(size) - size;
+    if (size > 0) {
+      auto const device_buffer = proxies.device_buffers.find(buffer->data());
+      auto const source        = device_buffer == proxies.device_buffers.end()
+                                   ? buffer->data()
+                                   : device_buffer->second;
+      CUDA_TRY(cudaMemcpyAsync(d_body, source, size, cudaMemcpyDefault, stream.value()));
+    }
+    if (padding > 0) { CUDA_TRY(cudaMemsetAsync(d_body + size, 0, padding, stream.value())); }
+    d_body += size + padding;
+  }
+  CUDF_EXPECTS(d_body == d_message + result->size(), "Inconsistent record batch body length");
+
+  // the header is in pageable host memory and the copies of the sliced columns must complete
+  stream.synchronize();
+  return result;
+}
+
+std::vector<unique_table_view_t> decode_record_batches(
+  std::shared_ptr<arrow::Schema> const& schema,
+  device_span<uint8_t const> messages,
+  rmm::cuda_stream_view stream)
+{
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  auto manager = arrow::cuda::CudaDeviceManager::Instance();
+  CUDF_EXPECTS(manager.ok(), "Failed to get the Arrow CUDA device manager");
+  auto context = manager.ValueOrDie()->GetContext(device_id);
+  CUDF_EXPECTS(context.ok(), "Failed to get the Arrow CUDA context");
+
+  auto const buffer = std::make_shared<arrow::cuda::CudaBuffer>(
+    const_cast<uint8_t*>(messages.data()), messages.size(), context.ValueOrDie());
+  arrow::cuda::CudaBufferReader reader(buffer);
+  arrow::ipc::DictionaryMemo memo;
+
+  std::vector<unique_table_view_t> results;
+  while (true) {
+    // the metadata of each message is copied to the host and its body stays on the device
+    auto message = arrow::cuda::ReadMessage(&reader, arrow::default_memory_pool());
+    CUDF_EXPECTS(message.ok(), "Failed to read an Arrow IPC message");
+    if (message.ValueOrDie() == nullptr) { break; }
+
+    auto batch = arrow::ipc::ReadRecordBatch(
+      *message.ValueOrDie(), schema, &memo, arrow::ipc::IpcReadOptions::Defaults());
+    CUDF_EXPECTS(batch.ok(), "Failed to read an Arrow IPC record batch");
+
+    ArrowDeviceArray array{};
+    ArrowSchema c_schema{};
+    CUDF_EXPECTS(arrow::ExportRecordBatch(*batch.ValueOrDie(), &array.array, &c_schema).ok(),
+                 "Failed to export the record batch");
+    array.device_id   = device_id;
+    array.device_type = ARROW_DEVICE_CUDA;
+
+    // the table_view keeps the record batch alive through the release callback of the array
+    auto view = cudf::detail::from_arrow_device(&c_schema, &array, stream);
+    c_schema.release(&c_schema);
+    results.push_back(std::move(view));
+  }
+  return results;
+}
+
+}  // namespace
+
+std::shared_ptr<arrow::Buffer> write_schema(table_view const& input,
+                                            std::vector<column_metadata> const& metadata)
+{
+  CUDF_FUNC_RANGE();
+  auto result = arrow::ipc::SerializeSchema(*arrow_schema(input, metadata));
+  CUDF_EXPECTS(result.ok(), "Failed to encode the Arrow IPC schema");
+  return result.ValueOrDie();
+}
+
+std::unique_ptr<rmm::device_buffer> write_record_batch(table_view const& input,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return encode_record_batch(input, rmm::cuda_stream_default, mr);
+}
+
+std::shared_ptr<arrow::Schema> read_schema(arrow::Buffer const& message)
+{
+  CUDF_FUNC_RANGE();
+  arrow::io::BufferReader reader(message.data(), message.size());
+  arrow::ipc::DictionaryMemo memo;
+  auto result = arrow::ipc::ReadSchema(&reader, &memo);
+  CUDF_EXPECTS(result.ok(), "Failed to read the Arrow IPC schema");
+  return result.ValueOrDie();
+}
+
+std::vector<unique_table_view_t> read_record_batches(std::shared_ptr<arrow::Schema> const& schema,
+                                                     device_span<uint8_t const> messages)
+{
+  CUDF_FUNC_RANGE();
+  return decode_record_batches(schema, messages, rmm::cuda_stream_default);
+}
+
+}  // namespace ipc
+}  // namespace cudf
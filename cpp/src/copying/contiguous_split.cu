@@ -25,12 +25,14 @@
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/iterator/discard_iterator.h>
 
+#include <cstdint>
 #include <numeric>
 
 namespace cudf {
@@ -762,13 +764,21 @@ struct size_of_helper {
 };  // anonymous namespace
 
 namespace detail {
+namespace {
 
-std::vector<packed_table> contiguous_split(cudf::table_view const& input,
+/**
+ * @brief Copies each partition of `input` to a contiguous buffer, and returns the views of the
+ * copied partitions.
+ *
+ * @param get_buffers Called with the number of bytes of each partition, returns the buffers to copy
+ * the partitions to, or no buffers to only compute the sizes
+ */
+template <typename BufferFn>
+std::vector<table_view> split_into_buffers(cudf::table_view const& input,
                                            std::vector<size_type> const& splits,
-                                           rmm::cuda_stream_view stream,
-                                           rmm::mr::device_memory_resource* mr)
+                                           BufferFn&& get_buffers,
+                                           rmm::cuda_stream_view stream)
 {
-  if (input.num_columns() == 0) { return {}; }
   if (splits.size() > 0) {
     CUDF_EXPECTS(splits.back() <= input.column(0).size(),
                  "splits can't exceed size of input columns");
@@ -789,19 +799,9 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
 
   // if inputs are empty, just return num_partitions empty tables
   if (input.column(0).size() == 0) {
-    // build the empty results
-    std::vector<packed_table> result;
-    result.reserve(num_partitions);
-    auto iter = thrust::make_counting_iterator(0);
-    std::transform(
-      iter, iter + num_partitions, std::back_inserter(result), [&input](int partition_index) {
-        return packed_table{input,
-                            packed_columns{std::make_unique<packed_columns::metadata>(pack_metadata(
-                                             input, static_cast<uint8_t const*>(nullptr), 0)),
-                                           std::make_unique<rmm::device_buffer>()}};
-      });
-
-    return result;
+    auto const dst_bufs = get_buffers(std::vector<std::size_t>(num_partitions, 0));
+    if (dst_bufs.empty()) { return {}; }
+    return std::vector<table_view>(num_partitions, input);
   }
 
   // compute # of source buffers (column data, validity, children), # of partitions
@@ -826,7 +826,7 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
     offset_stack_partition_size * num_partitions * sizeof(size_type);
   rmm::device_buffer d_indices_and_source_info(indices_size + src_buf_info_size + offset_stack_size,
                                                stream,
-                                               rmm::mr::get_current_device_resource());
+                                               cudf::get_current_temp_resource());
   size_type* d_indices         = reinterpret_cast<size_type*>(d_indices_and_source_info.data());
   src_buf_info* d_src_buf_info = reinterpret_cast<src_buf_info*>(
     reinterpret_cast<uint8_t*>(d_indices_and_source_info.data()) + indices_size);
@@ -861,7 +861,7 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
     reinterpret_cast<dst_buf_info*>(h_buf_sizes_and_dst_info.data() + buf_sizes_size);
   // device-side
   rmm::device_buffer d_buf_sizes_and_dst_info(
-    buf_sizes_size + dst_buf_info_size, stream, rmm::mr::get_current_device_resource());
+    buf_sizes_size + dst_buf_info_size, stream, cudf::get_current_temp_resource());
   std::size_t* d_buf_sizes     = reinterpret_cast<std::size_t*>(d_buf_sizes_and_dst_info.data());
   dst_buf_info* d_dst_buf_info = reinterpret_cast<dst_buf_info*>(
     static_cast<uint8_t*>(d_buf_sizes_and_dst_info.data()) + buf_sizes_size);
@@ -979,15 +979,11 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
                            stream.value()));
   stream.synchronize();
 
-  // allocate output partition buffers
-  std::vector<rmm::device_buffer> out_buffers;
-  out_buffers.reserve(num_partitions);
-  std::transform(h_buf_sizes,
-                 h_buf_sizes + num_partitions,
-                 std::back_inserter(out_buffers),
-                 [stream, mr](std::size_t bytes) {
-                   return rmm::device_buffer{bytes, stream, mr};
-                 });
+  // get the output partition buffers
+  auto const out_buffers =
+    get_buffers(std::vector<std::size_t>(h_buf_sizes, h_buf_sizes + num_partitions));
+  if (out_buffers.empty()) { return {}; }
+  CUDF_EXPECTS(out_buffers.size() == num_partitions, "Mismatch in number of partition buffers");
 
   // packed block of memory 3. pointers to source and destination buffers (and stack space on the
   // gpu for offset computation)
@@ -1002,7 +998,7 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   // device-side
   rmm::device_buffer d_src_and_dst_buffers(src_bufs_size + dst_bufs_size + offset_stack_size,
                                            stream,
-                                           rmm::mr::get_current_device_resource());
+                                           cudf::get_current_temp_resource());
   uint8_t** d_src_bufs = reinterpret_cast<uint8_t**>(d_src_and_dst_buffers.data());
   uint8_t** d_dst_bufs = reinterpret_cast<uint8_t**>(
     reinterpret_cast<uint8_t*>(d_src_and_dst_buffers.data()) + src_bufs_size);
@@ -1011,9 +1007,7 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   setup_src_buf_data(input.begin(), input.end(), h_src_bufs);
 
   // setup dst buffers
-  std::transform(out_buffers.begin(), out_buffers.end(), h_dst_bufs, [](auto& buf) {
-    return static_cast<uint8_t*>(buf.data());
-  });
+  std::copy(out_buffers.begin(), out_buffers.end(), h_dst_bufs);
 
   // HtoD src and dest buffers
   CUDA_TRY(cudaMemcpyAsync(
@@ -1033,7 +1027,7 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   stream.synchronize();
 
   // build the output.
-  std::vector<packed_table> result;
+  std::vector<table_view> result;
   result.reserve(num_partitions);
   std::vector<column_view> cols;
   cols.reserve(num_root_columns);
@@ -1042,30 +1036,131 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
     // traverse the buffers and build the columns.
     cur_dst_buf_info = build_output_columns(
       input.begin(), input.end(), cur_dst_buf_info, std::back_inserter(cols), h_dst_bufs[idx]);
+    result.emplace_back(cols);
+    cols.clear();
+  }
 
-    // pack the columns
-    cudf::table_view t{cols};
-    result.push_back(packed_table{
-      t,
-      packed_columns{
-        std::make_unique<packed_columns::metadata>(cudf::pack_metadata(
-          t, reinterpret_cast<uint8_t const*>(out_buffers[idx].data()), out_buffers[idx].size())),
-        std::make_unique<rmm::device_buffer>(std::move(out_buffers[idx]))}});
+  return result;
+}
 
-    cols.clear();
+}  // namespace
+
+std::vector<packed_table> contiguous_split(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_columns() == 0) { return {}; }
+
+  // allocate output partition buffers
+  std::vector<rmm::device_buffer> out_buffers;
+  auto const partitions = split_into_buffers(
+    input,
+    splits,
+    [&out_buffers, stream, mr](std::vector<std::size_t> const& sizes) {
+      std::vector<uint8_t*> buffers;
+      out_buffers.reserve(sizes.size());
+      for (auto const bytes : sizes) {
+        out_buffers.emplace_back(bytes, stream, mr);
+        buffers.push_back(static_cast<uint8_t*>(out_buffers.back().data()));
+      }
+      return buffers;
+    },
+    stream);
+
+  // pack the columns
+  std::vector<packed_table> result;
+  result.reserve(partitions.size());
+  for (std::size_t idx = 0; idx < partitions.size(); idx++) {
+    auto const base_ptr = static_cast<uint8_t const*>(out_buffers[idx].data());
+    result.push_back(packed_table{
+      partitions[idx],
+      packed_columns{std::make_unique<packed_columns::metadata>(
+                       cudf::pack_metadata(partitions[idx], base_ptr, out_buffers[idx].size())),
+                     std::make_unique<rmm::device_buffer>(std::move(out_buffers[idx]))}});
   }
 
   return result;
 }
 
+std::vector<std::size_t> contiguous_split_sizes(cudf::table_view const& input,
+                                                std::vector<size_type> const& splits,
+                                                rmm::cuda_stream_view stream)
+{
+  if (input.num_columns() == 0) { return {}; }
+
+  std::vector<std::size_t> result;
+  split_into_buffers(
+    input,
+    splits,
+    [&result](std::vector<std::size_t> const& sizes) {
+      result = sizes;
+      return std::vector<uint8_t*>{};
+    },
+    stream);
+  return result;
+}
+
+std::vector<packed_columns::metadata> contiguous_split_into(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  std::vector<device_span<uint8_t>> const& buffers,
+  rmm::cuda_stream_view stream)
+{
+  if (input.num_columns() == 0) { return {}; }
+  CUDF_EXPECTS(buffers.size() == splits.size() + 1, "Mismatch in number of partition buffers");
+
+  auto const partitions = split_into_buffers(
+    input,
+    splits,
+    [&buffers](std::vector<std::size_t> const& sizes) {
+      std::vector<uint8_t*> dst_bufs;
+      for (std::size_t idx = 0; idx < sizes.size(); idx++) {
+        CUDF_EXPECTS(buffers[idx].size() >= sizes[idx], "Partition buffer is too small");
+        CUDF_EXPECTS(reinterpret_cast<std::uintptr_t>(buffers[idx].data()) % split_align == 0,
+                     "Partition buffer is not aligned to 64 bytes");
+        dst_bufs.push_back(buffers[idx].data());
+      }
+      return dst_bufs;
+    },
+    stream);
+
+  std::vector<packed_columns::metadata> result;
+  result.reserve(partitions.size());
+  for (std::size_t idx = 0; idx < partitions.size(); idx++) {
+    result.push_back(
+      cudf::pack_metadata(partitions[idx], buffers[idx].data(), buffers[idx].size()));
+  }
+  return result;
+}
+
 };  // namespace detail
 
 std::vector<packed_table> contiguous_split(cudf::table_view const& input,
                                            std::vector<size_type> const& splits,
+                                           rmm::cuda_stream_view stream,
                                            rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return cudf::detail::contiguous_split(input, splits, rmm::cuda_stream_default, mr);
+  return cudf::detail::contiguous_split(input, splits, stream, mr);
+}
+
+std::vector<std::size_t> contiguous_split_sizes(cudf::table_view const& input,
+                                                std::vector<size_type> const& splits,
+                                                rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::contiguous_split_sizes(input, splits, stream);
+}
+
+std::vector<packed_columns::metadata> contiguous_split_into(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  std::vector<device_span<uint8_t>> const& buffers,
+  rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::contiguous_split_into(input, splits, buffers, stream);
 }
 
 };  // namespace cudf
@@ -19,12 +19,21 @@
 #include <cudf/detail/copy_if_else.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -219,6 +228,149 @@ std::unique_ptr<column> copy_if_else(Left const& lhs,
   }
 }
 
+// wrap up a bit-packed boolean_mask into a filter lambda
+template <typename Left, typename Right>
+std::unique_ptr<column> copy_if_else(Left const& lhs,
+                                     Right const& rhs,
+                                     bool left_nullable,
+                                     bool right_nullable,
+                                     bitmask_type const* boolean_mask,
+                                     size_type size,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(lhs.type() == rhs.type(), "Both inputs must be of the same type");
+
+  if (size == 0) { return cudf::make_empty_column(lhs.type()); }
+
+  CUDF_EXPECTS(boolean_mask != nullptr, "Boolean mask must not be null");
+  auto filter = [boolean_mask] __device__(cudf::size_type i) {
+    return bit_is_set(boolean_mask, i);
+  };
+  return cudf::type_dispatcher<dispatch_storage_type>(lhs.type(),
+                                                      copy_if_else_functor{},
+                                                      lhs,
+                                                      rhs,
+                                                      size,
+                                                      left_nullable,
+                                                      right_nullable,
+                                                      filter,
+                                                      stream,
+                                                      mr);
+}
+
+/**
+ * @brief Functor called by the `type_dispatcher` in device code to write an element of a column
+ * selected by `copy_if_else_fixed_width`.
+ */
+struct selected_element_writer {
+  template <typename T, std::enable_if_t<is_rep_layout_compatible<T>()>* = nullptr>
+  __device__ void operator()(column_device_view const& source,
+                             mutable_column_device_view& target,
+                             size_type row)
+  {
+    target.element<T>(row) = source.element<T>(row);
+  }
+
+  template <typename T, std::enable_if_t<not is_rep_layout_compatible<T>()>* = nullptr>
+  __device__ void operator()(column_device_view const&, mutable_column_device_view&, size_type)
+  {
+  }
+};
+
+constexpr int copy_if_else_block_size = 256;
+
+/**
+ * @brief Kernel selecting the rows of all the fixed-width columns of two tables at once.
+ *
+ * Every thread reads the bit of its row in the mask once and writes that row of every column, and
+ * the rows are padded to a multiple of the warp size so that every warp writes whole words of the
+ * null masks.
+ *
+ * @param lhs The columns selected where the bit of the mask is set
+ * @param rhs The columns selected where the bit of the mask is unset
+ * @param output The columns of the result, which are nullable if either of their inputs has nulls
+ * @param boolean_mask The bitmask selecting between `lhs` and `rhs`
+ * @param padded_rows The number of rows of the columns, rounded up to a multiple of the warp size
+ */
+__launch_bounds__(copy_if_else_block_size) __global__
+  void copy_if_else_fixed_width(table_device_view lhs,
+                                table_device_view rhs,
+                                mutable_table_device_view output,
+                                bitmask_type const* __restrict__ boolean_mask,
+                                size_type padded_rows)
+{
+  auto const num_rows = output.num_rows();
+  auto const lane_id  = threadIdx.x % warp_size;
+  auto const stride   = static_cast<int64_t>(blockDim.x) * gridDim.x;
+
+  for (auto idx = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x; idx < padded_rows;
+       idx += stride) {
+    auto const row      = static_cast<size_type>(idx);
+    auto const in_range = row < num_rows;
+    auto const left     = in_range and bit_is_set(boolean_mask, row);
+
+    for (size_type col = 0; col < output.num_columns(); ++col) {
+      auto const& source = left ? lhs.column(col) : rhs.column(col);
+      auto target        = output.column(col);
+      if (in_range) {
+        type_dispatcher<dispatch_storage_type>(
+          target.type(), selected_element_writer{}, source, target, row);
+      }
+      // Every thread of the warp handles the same column, whose output is nullable or not
+      if (target.nullable()) {
+        auto const word = __ballot_sync(0xffff'ffff, in_range and source.is_valid(row));
+        if (lane_id == 0) { target.set_mask_word(word_index(row), word); }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Selects the rows of fixed-width columns of two tables with a single kernel launch.
+ *
+ * @param lhs The columns selected where the bit of the mask is set
+ * @param rhs The columns selected where the bit of the mask is unset, of the types of `lhs`
+ * @param boolean_mask The bitmask selecting between `lhs` and `rhs`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns
+ * @return The selected columns
+ */
+std::vector<std::unique_ptr<column>> copy_if_else_fixed_width_impl(
+  std::vector<column_view> const& lhs,
+  std::vector<column_view> const& rhs,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = lhs.front().size();
+
+  std::vector<std::unique_ptr<column>> output(lhs.size());
+  std::vector<mutable_column_view> output_views(lhs.size());
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    auto const nullable = lhs[i].has_nulls() or rhs[i].has_nulls();
+    auto const state    = nullable ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED;
+    output[i]           = make_fixed_width_column(lhs[i].type(), num_rows, state, stream, mr);
+    output_views[i]     = output[i]->mutable_view();
+  }
+
+  auto const d_lhs    = table_device_view::create(table_view(lhs), stream);
+  auto const d_rhs    = table_device_view::create(table_view(rhs), stream);
+  auto const d_output = mutable_table_device_view::create(mutable_table_view(output_views), stream);
+
+  auto const padded_rows = util::round_up_safe(num_rows, static_cast<size_type>(warp_size));
+  auto const num_blocks =
+    util::div_rounding_up_safe(padded_rows, static_cast<size_type>(copy_if_else_block_size));
+  copy_if_else_fixed_width<<<num_blocks, copy_if_else_block_size, 0, stream.value()>>>(
+    *d_lhs, *d_rhs, *d_output, boolean_mask, padded_rows);
+
+  // The null masks were written without counting their nulls
+  for (auto& col : output) {
+    if (col->nullable()) { col->set_null_count(UNKNOWN_NULL_COUNT); }
+  }
+  return output;
+}
+
 };  // namespace
 
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
@@ -282,42 +434,206 @@ std::unique_ptr<column> copy_if_else(scalar const& lhs,
   return copy_if_else(lhs, rhs, !lhs.is_valid(), !rhs.is_valid(), boolean_mask, stream, mr);
 }
 
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* boolean_mask,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Both columns must be of the size");
+  return copy_if_else(*column_device_view::create(lhs, stream),
+                      *column_device_view::create(rhs, stream),
+                      lhs.has_nulls(),
+                      rhs.has_nulls(),
+                      boolean_mask,
+                      lhs.size(),
+                      stream,
+                      mr);
+}
+
+std::unique_ptr<column> copy_if_else(scalar const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* boolean_mask,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  return copy_if_else(lhs,
+                      *column_device_view::create(rhs, stream),
+                      !lhs.is_valid(),
+                      rhs.has_nulls(),
+                      boolean_mask,
+                      rhs.size(),
+                      stream,
+                      mr);
+}
+
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     scalar const& rhs,
+                                     bitmask_type const* boolean_mask,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  return copy_if_else(*column_device_view::create(lhs, stream),
+                      rhs,
+                      lhs.has_nulls(),
+                      !rhs.is_valid(),
+                      boolean_mask,
+                      lhs.size(),
+                      stream,
+                      mr);
+}
+
+std::unique_ptr<table> copy_if_else(table_view const& lhs,
+                                    table_view const& rhs,
+                                    bitmask_type const* boolean_mask,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(lhs.num_columns() == rhs.num_columns(),
+               "Both tables must have the same number of columns");
+  CUDF_EXPECTS(lhs.num_rows() == rhs.num_rows(), "Both tables must be of the same size");
+  CUDF_EXPECTS(
+    std::equal(lhs.begin(),
+               lhs.end(),
+               rhs.begin(),
+               [](auto const& left, auto const& right) { return left.type() == right.type(); }),
+    "Both inputs must be of the same type");
+
+  if (lhs.num_rows() == 0) { return empty_like(lhs); }
+  CUDF_EXPECTS(boolean_mask != nullptr, "Boolean mask must not be null");
+
+  // The fixed-width columns are selected together, the others one by one
+  std::vector<std::unique_ptr<column>> output(lhs.num_columns());
+  std::vector<size_type> fused_indices;
+  std::vector<column_view> fused_lhs;
+  std::vector<column_view> fused_rhs;
+  for (size_type i = 0; i < lhs.num_columns(); ++i) {
+    if (is_fixed_width(lhs.column(i).type())) {
+      fused_indices.push_back(i);
+      fused_lhs.push_back(lhs.column(i));
+      fused_rhs.push_back(rhs.column(i));
+    } else {
+      output[i] = copy_if_else(lhs.column(i), rhs.column(i), boolean_mask, stream, mr);
+    }
+  }
+
+  if (not fused_indices.empty()) {
+    auto fused = copy_if_else_fixed_width_impl(fused_lhs, fused_rhs, boolean_mask, stream, mr);
+    for (std::size_t i = 0; i < fused.size(); ++i) {
+      output[fused_indices[i]] = std::move(fused[i]);
+    }
+  }
+  return std::make_unique<table>(std::move(output));
+}
+
+std::unique_ptr<table> copy_if_else(table_view const& lhs,
+                                    table_view const& rhs,
+                                    column_view const& boolean_mask,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(boolean_mask.type() == data_type(type_id::BOOL8),
+               "Boolean mask column must be of type type_id::BOOL8");
+  CUDF_EXPECTS(boolean_mask.size() == lhs.num_rows(),
+               "Boolean mask column must be the same size as lhs and rhs tables");
+  if (boolean_mask.is_empty()) { return empty_like(lhs); }
+
+  // The mask is packed once, with its nulls as unset bits, for all the columns
+  auto const packed = detail::bools_to_mask(boolean_mask, stream);
+  return copy_if_else(
+    lhs, rhs, static_cast<bitmask_type const*>(packed.first->data()), stream, mr);
+}
+
 };  // namespace detail
 
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
                                      column_view const& rhs,
                                      column_view const& boolean_mask,
+                                     rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, rmm::cuda_stream_default, mr);
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
 }
 
 std::unique_ptr<column> copy_if_else(scalar const& lhs,
                                      column_view const& rhs,
                                      column_view const& boolean_mask,
+                                     rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, rmm::cuda_stream_default, mr);
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
 }
 
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
                                      scalar const& rhs,
                                      column_view const& boolean_mask,
+                                     rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, rmm::cuda_stream_default, mr);
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
 }
 
 std::unique_ptr<column> copy_if_else(scalar const& lhs,
                                      scalar const& rhs,
                                      column_view const& boolean_mask,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
+}
+
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* boolean_mask,
+                                     rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::copy_if_else(lhs, rhs, boolean_mask, rmm::cuda_stream_default, mr);
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
+}
+
+std::unique_ptr<column> copy_if_else(scalar const& lhs,
+                                     column_view const& rhs,
+                                     bitmask_type const* boolean_mask,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
+}
+
+std::unique_ptr<column> copy_if_else(column_view const& lhs,
+                                     scalar const& rhs,
+                                     bitmask_type const* boolean_mask,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
+}
+
+std::unique_ptr<table> copy_if_else(table_view const& lhs,
+                                    table_view const& rhs,
+                                    column_view const& boolean_mask,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
+}
+
+std::unique_ptr<table> copy_if_else(table_view const& lhs,
+                                    table_view const& rhs,
+                                    bitmask_type const* boolean_mask,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
 }
 
 }  // namespace cudf
@@ -16,14 +16,31 @@
 
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/chunked_table_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -54,11 +71,119 @@ std::unique_ptr<table> gather(table_view const& source_table,
   return gather(source_table, map_begin, map_end, bounds_policy, stream, mr);
 }
 
+std::unique_ptr<table> gather(chunked_table_view const& source_table,
+                              column_view const& gather_map,
+                              out_of_bounds_policy bounds_policy,
+                              negative_index_policy neg_indices,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
+
+  auto const num_chunks = source_table.num_chunks();
+  auto const map_size   = gather_map.size();
+  if (num_chunks == 1 or map_size == 0) {
+    return gather(source_table.chunk(0), gather_map, bounds_policy, neg_indices, stream, mr);
+  }
+
+  // Normalize the map into rows of all the chunks, the out of bounds rows replaced by `num_rows`
+  auto const num_rows       = source_table.num_rows();
+  auto const allow_negative = neg_indices == negative_index_policy::ALLOWED;
+  auto const map_begin      = indexalator_factory::make_input_iterator(gather_map);
+  rmm::device_uvector<size_type> rows(map_size, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    map_begin,
+                    map_begin + map_size,
+                    rows.begin(),
+                    [num_rows, allow_negative] __device__(size_type row) {
+                      if (allow_negative and row < 0) { row += num_rows; }
+                      return (row < 0 or row >= num_rows) ? num_rows : row;
+                    });
+
+  // Sort the rows with their positions in the map, which groups them by chunk
+  rmm::device_uvector<size_type> positions(map_size, stream);
+  thrust::sequence(rmm::exec_policy(stream), positions.begin(), positions.end());
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), rows.begin(), rows.end(), positions.begin());
+
+  // The rows of chunk `c` are in [bounds[c], bounds[c + 1]), and the out of bounds rows last
+  auto const& offsets  = source_table.chunk_offsets();
+  auto const d_offsets = make_device_uvector_async(offsets, stream);
+  rmm::device_uvector<size_type> d_bounds(offsets.size(), stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      rows.begin(),
+                      rows.end(),
+                      d_offsets.begin(),
+                      d_offsets.end(),
+                      d_bounds.begin());
+  auto const bounds = make_std_vector_sync(d_bounds, stream);
+
+  // Gather the rows of each chunk from the chunk itself
+  std::vector<std::unique_ptr<table>> pieces;
+  for (size_type c = 0; c < num_chunks; ++c) {
+    if (bounds[c] == bounds[c + 1]) { continue; }
+    auto const chunk_rows = thrust::make_transform_iterator(
+      rows.begin() + bounds[c],
+      [offset = offsets[c]] __device__(size_type row) { return row - offset; });
+    pieces.push_back(gather(source_table.chunk(c),
+                            chunk_rows,
+                            chunk_rows + (bounds[c + 1] - bounds[c]),
+                            out_of_bounds_policy::DONT_CHECK,
+                            stream));
+  }
+  if (bounds[num_chunks] < map_size) {
+    auto const out_of_bounds = thrust::make_constant_iterator(source_table.chunk(0).num_rows());
+    pieces.push_back(gather(source_table.chunk(0),
+                            out_of_bounds,
+                            out_of_bounds + (map_size - bounds[num_chunks]),
+                            bounds_policy,
+                            stream));
+  }
+  std::vector<table_view> piece_views;
+  for (auto const& piece : pieces) {
+    piece_views.push_back(piece->view());
+  }
+  auto const gathered = concatenate(piece_views, stream);
+  pieces.clear();
+
+  // Row `i` of the gathered pieces is row `positions[i]` of the result
+  rmm::device_uvector<size_type> result_rows(map_size, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(map_size),
+                  positions.begin(),
+                  result_rows.begin());
+  return gather(gathered->view(),
+                result_rows.begin(),
+                result_rows.end(),
+                out_of_bounds_policy::DONT_CHECK,
+                stream,
+                mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> gather(table_view const& source_table,
                               column_view const& gather_map,
                               out_of_bounds_policy bounds_policy,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::record_input(source_table);
+
+  auto index_policy = is_unsigned(gather_map.type()) ? detail::negative_index_policy::NOT_ALLOWED
+                                                     : detail::negative_index_policy::ALLOWED;
+
+  auto result = detail::gather(source_table, gather_map, bounds_policy, index_policy, stream, mr);
+  detail::record_output(result->view());
+  return result;
+}
+
+std::unique_ptr<table> gather(chunked_table_view const& source_table,
+                              column_view const& gather_map,
+                              out_of_bounds_policy bounds_policy,
+                              rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -66,8 +191,7 @@ std::unique_ptr<table> gather(table_view const& source_table,
   auto index_policy = is_unsigned(gather_map.type()) ? detail::negative_index_policy::NOT_ALLOWED
                                                      : detail::negative_index_policy::ALLOWED;
 
-  return detail::gather(
-    source_table, gather_map, bounds_policy, index_policy, rmm::cuda_stream_default, mr);
+  return detail::gather(source_table, gather_map, bounds_policy, index_policy, stream, mr);
 }
 
 }  // namespace cudf
@@ -182,9 +182,10 @@ std::unique_ptr<scalar> get_element(column_view const &input,
 
 std::unique_ptr<scalar> get_element(column_view const &input,
                                     size_type index,
+                                    rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource *mr)
 {
-  return detail::get_element(input, index, rmm::cuda_stream_default, mr);
+  return detail::get_element(input, index, stream, mr);
 }
 
 }  // namespace cudf
@@ -215,10 +215,12 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
 /**
  * @copydoc cudf::pack
  */
-packed_columns pack(cudf::table_view const& input, rmm::mr::device_memory_resource* mr)
+packed_columns pack(cudf::table_view const& input,
+                    rmm::cuda_stream_view stream,
+                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::pack(input, rmm::cuda_stream_default, mr);
+  return detail::pack(input, stream, mr);
 }
 
 /**
@@ -16,21 +16,179 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/table/chunked_table_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/extrema.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/random.h>
 #include <thrust/random/uniform_int_distribution.h>
+#include <thrust/random/uniform_real_distribution.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
 #include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Functor computing the key of weighted sampling without replacement of a row,
+ * `log(u) / w` for its weight `w` and a uniform random `u` in (0, 1].
+ *
+ * The rows of the largest keys are a weighted sample without replacement, the rows of weight 0
+ * having the key `-infinity`. The random number of a row only depends on the seed and on the
+ * position `offset + i` of the row, so that the keys of a table are the same when it is split in
+ * batches.
+ */
+struct sample_key_fn {
+  double const* weights;  ///< The weight of each row, or `nullptr` for weights of 1
+  int64_t seed;
+  int64_t offset;  ///< The position of the first row
+
+  __device__ double operator()(size_type i) const
+  {
+    thrust::default_random_engine rng(seed);
+    thrust::uniform_real_distribution<double> dist{0, 1};
+    rng.discard(offset + i);
+    auto const u = 1 - dist(rng);
+    auto const w = weights == nullptr ? 1.0 : weights[i];
+    return w > 0 ? log(u) / w : -std::numeric_limits<double>::infinity();
+  }
+};
+
+/**
+ * @brief Functor called by the `type_dispatcher` to convert sampling weights to `double`.
+ */
+struct sampling_weights_fn {
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  rmm::device_uvector<double> operator()(column_view const& weights, rmm::cuda_stream_view stream)
+  {
+    rmm::device_uvector<double> result(weights.size(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      weights.begin<T>(),
+                      weights.end<T>(),
+                      result.begin(),
+                      [] __device__(T w) { return static_cast<double>(w); });
+    return result;
+  }
+
+  template <typename T, std::enable_if_t<not std::is_floating_point<T>::value>* = nullptr>
+  rmm::device_uvector<double> operator()(column_view const&, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Sampling weights must be of a floating point type");
+  }
+};
+
+/**
+ * @brief Checks the weights of the rows of a table to sample and converts them to `double`.
+ */
+rmm::device_uvector<double> sampling_weights(column_view const& weights,
+                                             size_type num_rows,
+                                             rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(weights.size() == num_rows, "Mismatch between the number of weights and of rows");
+  CUDF_EXPECTS(not weights.has_nulls(), "Sampling weights must not have nulls");
+  auto result = type_dispatcher(weights.type(), sampling_weights_fn{}, weights, stream);
+  // NaN weights fail the comparison as well
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                              result.begin(),
+                              result.end(),
+                              [] __device__(double w) { return w >= 0; }),
+               "Sampling weights must be non-negative");
+  return result;
+}
+
+/**
+ * @brief Computes the keys of weighted sampling without replacement of rows whose first row is
+ * at position `offset` among all the rows sampled.
+ *
+ * @param weights The weight of each row, or `nullptr` for weights of 1
+ * @param num_rows The number of rows
+ * @param seed Seed value to initiate random number generator
+ * @param offset The position of the first row
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The key of each row
+ */
+rmm::device_uvector<double> sample_keys(double const* weights,
+                                        size_type num_rows,
+                                        int64_t seed,
+                                        int64_t offset,
+                                        rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<double> keys(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    keys.begin(),
+                    sample_key_fn{weights, seed, offset});
+  return keys;
+}
+
+/**
+ * @brief Returns the indices of the (at most) `n` largest finite keys, in decreasing order of
+ * keys, and sorts the keys in decreasing order.
+ *
+ * @param keys The keys, which are sorted in place
+ * @param n The maximum number of indices
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+rmm::device_uvector<size_type> largest_keys(rmm::device_uvector<double>& keys,
+                                            size_type n,
+                                            rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> indices(keys.size(), stream);
+  thrust::sequence(rmm::exec_policy(stream), indices.begin(), indices.end());
+  thrust::sort_by_key(rmm::exec_policy(stream),
+                      keys.begin(),
+                      keys.end(),
+                      indices.begin(),
+                      thrust::greater<double>{});
+  // The keys of the rows of weight 0 are last
+  auto const num_finite = thrust::count_if(
+    rmm::exec_policy(stream), keys.begin(), keys.end(), [] __device__(double key) {
+      return key > -std::numeric_limits<double>::infinity();
+    });
+  indices.resize(std::min<std::size_t>(n, num_finite), stream);
+  return indices;
+}
+
+/**
+ * @brief Returns a view of a gather map of indices.
+ */
+column_view gather_map_view(rmm::device_uvector<size_type> const& indices)
+{
+  return column_view(data_type{type_to_id<size_type>()}, indices.size(), indices.data());
+}
+
+}  // namespace
 
 std::unique_ptr<table> sample(table_view const& input,
                               size_type const n,
@@ -81,16 +239,186 @@ std::unique_ptr<table> sample(table_view const& input,
   }
 }
 
+std::unique_ptr<table> sample(table_view const& input,
+                              column_view const& weights,
+                              size_type const n,
+                              sample_with_replacement replacement,
+                              int64_t const seed,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(n >= 0, "expected number of samples should be non-negative");
+  auto const num_rows    = input.num_rows();
+  auto const row_weights = sampling_weights(weights, num_rows, stream);
+
+  if (n == 0) return cudf::empty_like(input);
+
+  if (replacement == sample_with_replacement::TRUE) {
+    // Every sample is the row whose range of the cumulative weights holds a uniform random number
+    rmm::device_uvector<double> cumulative(num_rows, stream);
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream), row_weights.begin(), row_weights.end(), cumulative.begin());
+    auto const total = num_rows > 0 ? cumulative.back_element(stream) : 0.0;
+    CUDF_EXPECTS(total > 0, "Sampling weights must not all be zero");
+
+    auto const random_weights = cudf::detail::make_counting_transform_iterator(
+      0, [seed, total] __device__(size_type i) {
+        thrust::default_random_engine rng(seed);
+        thrust::uniform_real_distribution<double> dist{0, total};
+        rng.discard(i);
+        return dist(rng);
+      });
+    rmm::device_uvector<size_type> gather_map(n, stream);
+    thrust::upper_bound(rmm::exec_policy(stream),
+                        cumulative.begin(),
+                        cumulative.end(),
+                        random_weights,
+                        random_weights + n,
+                        gather_map.begin());
+    // A random number rounded up to the total weight is in the range of the last row sampled
+    auto const last_row = static_cast<size_type>(
+      thrust::distance(cumulative.begin(),
+                       thrust::lower_bound(
+                         rmm::exec_policy(stream), cumulative.begin(), cumulative.end(), total)));
+    thrust::transform(rmm::exec_policy(stream),
+                      gather_map.begin(),
+                      gather_map.end(),
+                      gather_map.begin(),
+                      [last_row] __device__(size_type row) { return thrust::min(row, last_row); });
+    return detail::gather(
+      input, gather_map.begin(), gather_map.end(), out_of_bounds_policy::DONT_CHECK, stream, mr);
+  }
+
+  auto keys             = sample_keys(row_weights.data(), num_rows, seed, 0, stream);
+  auto const gather_map = largest_keys(keys, n, stream);
+  CUDF_EXPECTS(gather_map.size() == static_cast<std::size_t>(n),
+               "If n > number of rows of nonzero weight, then multiple sampling of the same row "
+               "should be allowed");
+  return detail::gather(
+    input, gather_map.begin(), gather_map.end(), out_of_bounds_policy::DONT_CHECK, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> sample(table_view const& input,
                               size_type const n,
                               sample_with_replacement replacement,
                               int64_t const seed,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::sample(input, n, replacement, seed, stream, mr);
+}
+
+std::unique_ptr<table> sample(table_view const& input,
+                              column_view const& weights,
+                              size_type const n,
+                              sample_with_replacement replacement,
+                              int64_t const seed,
+                              rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
 
-  return detail::sample(input, n, replacement, seed, rmm::cuda_stream_default, mr);
+  return detail::sample(input, weights, n, replacement, seed, stream, mr);
+}
+
+reservoir_sampler::reservoir_sampler(size_type capacity,
+                                     int64_t seed,
+                                     rmm::mr::device_memory_resource* mr)
+  : _capacity{capacity}, _seed{seed}, _mr{mr}
+{
+  CUDF_EXPECTS(capacity >= 0, "The capacity of a sample should be non-negative");
+}
+
+void reservoir_sampler::add(table_view const& batch, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  add(batch, nullptr, stream);
+}
+
+void reservoir_sampler::add(table_view const& batch,
+                            column_view const& weights,
+                            rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  add(batch, &weights, stream);
+}
+
+void reservoir_sampler::add(table_view const& batch,
+                            column_view const* weights,
+                            rmm::cuda_stream_view stream)
+{
+  auto const num_rows = batch.num_rows();
+  rmm::device_uvector<double> row_weights(0, stream);
+  if (weights != nullptr) { row_weights = detail::sampling_weights(*weights, num_rows, stream); }
+  if (_sample == nullptr) {
+    _sample = empty_like(batch);
+    _keys   = make_empty_column(data_type{type_id::FLOAT64});
+  }
+  auto const chunks = chunked_table_view({_sample->view(), batch});
+
+  auto const batch_keys = detail::sample_keys(
+    weights != nullptr ? row_weights.data() : nullptr, num_rows, _seed, _num_rows_seen, stream);
+  _num_rows_seen += num_rows;
+  if (_capacity == 0) { return; }
+
+  // The rows of the batch are candidates if their keys exceed the smallest key of a full sample,
+  // else if their weights are nonzero
+  auto const sample_size = _sample->num_rows();
+  auto const sampled_keys = _keys->view();
+  auto const threshold    = sample_size == _capacity
+                              ? detail::get_value<double>(sampled_keys, sample_size - 1, stream)
+                              : -std::numeric_limits<double>::infinity();
+  rmm::device_uvector<size_type> candidates(sample_size + num_rows, stream);
+  thrust::sequence(
+    rmm::exec_policy(stream), candidates.begin(), candidates.begin() + sample_size);
+  auto const candidates_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(sample_size),
+    thrust::make_counting_iterator<size_type>(sample_size + num_rows),
+    candidates.begin() + sample_size,
+    [keys = batch_keys.data(), sample_size, threshold] __device__(size_type i) {
+      return keys[i - sample_size] > threshold;
+    });
+  auto const num_candidates = thrust::distance(candidates.begin(), candidates_end);
+  if (num_candidates == sample_size) { return; }
+  candidates.resize(num_candidates, stream);
+
+  // The sample keeps the candidates of the largest keys
+  rmm::device_uvector<double> keys(num_candidates, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    candidates.begin(),
+                    candidates.end(),
+                    keys.begin(),
+                    [sampled_keys = sampled_keys.data<double>(),
+                     batch_keys   = batch_keys.data(),
+                     sample_size] __device__(size_type i) {
+                      return i < sample_size ? sampled_keys[i] : batch_keys[i - sample_size];
+                    });
+  auto const selected = detail::largest_keys(keys, _capacity, stream);
+  rmm::device_uvector<size_type> rows(selected.size(), stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 selected.begin(),
+                 selected.end(),
+                 candidates.begin(),
+                 rows.begin());
+  keys.resize(selected.size(), stream);
+
+  _sample = detail::gather(chunks,
+                           detail::gather_map_view(rows),
+                           out_of_bounds_policy::DONT_CHECK,
+                           detail::negative_index_policy::NOT_ALLOWED,
+                           stream,
+                           _mr);
+  auto const num_keys = keys.size();
+  _keys = std::make_unique<column>(data_type{type_id::FLOAT64}, num_keys, keys.release());
+}
+
+table_view reservoir_sampler::view() const
+{
+  return _sample != nullptr ? _sample->view() : table_view{};
 }
 }  // namespace cudf
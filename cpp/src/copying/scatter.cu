@@ -24,6 +24,7 @@
 #include <cudf/detail/scatter.cuh>
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/dictionary/detail/search.hpp>
 #include <cudf/lists/list_view.cuh>
@@ -313,55 +314,29 @@ std::unique_ptr<table> scatter(std::vector<std::reference_wrapper<const scalar>>
   return std::make_unique<table>(std::move(result));
 }
 
-std::unique_ptr<column> boolean_mask_scatter(column_view const& input,
-                                             column_view const& target,
-                                             column_view const& boolean_mask,
-                                             rmm::cuda_stream_view stream,
-                                             rmm::mr::device_memory_resource* mr)
-{
-  auto indices = cudf::make_numeric_column(
-    data_type{type_id::INT32}, target.size(), mask_state::UNALLOCATED, stream);
-  auto mutable_indices = indices->mutable_view();
-
-  thrust::sequence(rmm::exec_policy(stream),
-                   mutable_indices.begin<size_type>(),
-                   mutable_indices.end<size_type>(),
-                   0);
-
-  // The scatter map is actually a table with only one column, which is scatter map.
-  auto scatter_map =
-    detail::apply_boolean_mask(table_view{{indices->view()}}, boolean_mask, stream);
-  auto output_table = detail::scatter(table_view{{input}},
-                                      scatter_map->get_column(0).view(),
-                                      table_view{{target}},
-                                      false,
-                                      stream,
-                                      mr);
-
-  // There is only one column in output_table
-  return std::make_unique<column>(std::move(output_table->get_column(0)));
-}
-
+template <typename BooleanMask>
 std::unique_ptr<column> boolean_mask_scatter(scalar const& input,
                                              column_view const& target,
-                                             column_view const& boolean_mask,
+                                             BooleanMask const& boolean_mask,
                                              rmm::cuda_stream_view stream,
                                              rmm::mr::device_memory_resource* mr)
 {
   return detail::copy_if_else(input, target, boolean_mask, stream, mr);
 }
 
-std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
-                                            table_view const& target,
-                                            column_view const& boolean_mask,
-                                            rmm::cuda_stream_view stream,
-                                            rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Scatters the columns of `input` to the columns of `target`, with a BOOL8 column or a
+ * bitmask as the mask.
+ */
+template <typename BooleanMask>
+std::unique_ptr<table> boolean_mask_scatter_columns(table_view const& input,
+                                                    table_view const& target,
+                                                    BooleanMask const& boolean_mask,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_EXPECTS(input.num_columns() == target.num_columns(),
                "Mismatch in number of input columns and target columns");
-  CUDF_EXPECTS(boolean_mask.size() == target.num_rows(),
-               "Boolean mask size and number of target rows mismatch");
-  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be of Boolean type");
   // Count valid pair of input and columns as per type at each column index i
   CUDF_EXPECTS(
     std::all_of(thrust::counting_iterator<size_type>(0),
@@ -371,36 +346,38 @@ std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
                 }),
     "Type mismatch in input column and target column");
 
-  if (target.num_rows() != 0) {
-    std::vector<std::unique_ptr<column>> out_columns(target.num_columns());
-    std::transform(
-      input.begin(),
-      input.end(),
-      target.begin(),
-      out_columns.begin(),
-      [&boolean_mask, mr, stream](auto const& input_column, auto const& target_column) {
-        return boolean_mask_scatter(input_column, target_column, boolean_mask, stream, mr);
-      });
+  if (target.num_rows() == 0) { return empty_like(target); }
 
-    return std::make_unique<table>(std::move(out_columns));
-  } else {
-    return empty_like(target);
-  }
+  // The rows to scatter to are the same for all the columns, so the mask is applied once
+  auto indices = cudf::make_numeric_column(
+    data_type{type_id::INT32}, target.num_rows(), mask_state::UNALLOCATED, stream);
+  auto mutable_indices = indices->mutable_view();
+
+  thrust::sequence(rmm::exec_policy(stream),
+                   mutable_indices.begin<size_type>(),
+                   mutable_indices.end<size_type>(),
+                   0);
+
+  // The scatter map is actually a table with only one column, which is scatter map.
+  auto scatter_map =
+    detail::apply_boolean_mask(table_view{{indices->view()}}, boolean_mask, stream);
+  return detail::scatter(input, scatter_map->get_column(0).view(), target, false, stream, mr);
 }
 
-std::unique_ptr<table> boolean_mask_scatter(
+/**
+ * @brief Scatters the scalars of `input` to the columns of `target`, with a BOOL8 column or a
+ * bitmask as the mask.
+ */
+template <typename BooleanMask>
+std::unique_ptr<table> boolean_mask_scatter_scalars(
   std::vector<std::reference_wrapper<const scalar>> const& input,
   table_view const& target,
-  column_view const& boolean_mask,
+  BooleanMask const& boolean_mask,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_EXPECTS(static_cast<size_type>(input.size()) == target.num_columns(),
                "Mismatch in number of scalars and target columns");
-  CUDF_EXPECTS(boolean_mask.size() == target.num_rows(),
-               "Boolean mask size and number of target rows mismatch");
-  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be of Boolean type");
-
   // Count valid pair of input and columns as per type at each column/scalar index i
   CUDF_EXPECTS(
     std::all_of(thrust::counting_iterator<size_type>(0),
@@ -427,45 +404,121 @@ std::unique_ptr<table> boolean_mask_scatter(
   }
 }
 
+std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
+                                            table_view const& target,
+                                            column_view const& boolean_mask,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(boolean_mask.size() == target.num_rows(),
+               "Boolean mask size and number of target rows mismatch");
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be of Boolean type");
+  return boolean_mask_scatter_columns(input, target, boolean_mask, stream, mr);
+}
+
+std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
+                                            table_view const& target,
+                                            bitmask_type const* boolean_mask,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  return boolean_mask_scatter_columns(input, target, boolean_mask, stream, mr);
+}
+
+std::unique_ptr<table> boolean_mask_scatter(
+  std::vector<std::reference_wrapper<const scalar>> const& input,
+  table_view const& target,
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(boolean_mask.size() == target.num_rows(),
+               "Boolean mask size and number of target rows mismatch");
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be of Boolean type");
+  if (boolean_mask.is_empty()) {
+    return boolean_mask_scatter_scalars(input, target, boolean_mask, stream, mr);
+  }
+
+  // The mask is packed once, with its nulls as unset bits, instead of being read by every column
+  auto const packed = detail::bools_to_mask(boolean_mask, stream);
+  return boolean_mask_scatter_scalars(
+    input, target, static_cast<bitmask_type const*>(packed.first->data()), stream, mr);
+}
+
+std::unique_ptr<table> boolean_mask_scatter(
+  std::vector<std::reference_wrapper<const scalar>> const& input,
+  table_view const& target,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return boolean_mask_scatter_scalars(input, target, boolean_mask, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> scatter(table_view const& source,
                                column_view const& scatter_map,
                                table_view const& target,
                                bool check_bounds,
+                               rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, scatter_map, target, check_bounds, rmm::cuda_stream_default, mr);
+  return detail::scatter(source, scatter_map, target, check_bounds, stream, mr);
 }
 
 std::unique_ptr<table> scatter(std::vector<std::reference_wrapper<const scalar>> const& source,
                                column_view const& indices,
                                table_view const& target,
                                bool check_bounds,
+                               rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, indices, target, check_bounds, rmm::cuda_stream_default, mr);
+  return detail::scatter(source, indices, target, check_bounds, stream, mr);
 }
 
 std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
                                             table_view const& target,
                                             column_view const& boolean_mask,
+                                            rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::boolean_mask_scatter(input, target, boolean_mask, rmm::cuda_stream_default, mr);
+  return detail::boolean_mask_scatter(input, target, boolean_mask, stream, mr);
 }
 
 std::unique_ptr<table> boolean_mask_scatter(
   std::vector<std::reference_wrapper<const scalar>> const& input,
   table_view const& target,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::boolean_mask_scatter(input, target, boolean_mask, stream, mr);
+}
+
+std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
+                                            table_view const& target,
+                                            bitmask_type const* boolean_mask,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::boolean_mask_scatter(input, target, boolean_mask, stream, mr);
+}
+
+std::unique_ptr<table> boolean_mask_scatter(
+  std::vector<std::reference_wrapper<const scalar>> const& input,
+  table_view const& target,
+  bitmask_type const* boolean_mask,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::boolean_mask_scatter(input, target, boolean_mask, rmm::cuda_stream_default, mr);
+  return detail::boolean_mask_scatter(input, target, boolean_mask, stream, mr);
 }
 
 }  // namespace cudf
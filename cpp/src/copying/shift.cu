@@ -136,9 +136,10 @@ std::unique_ptr<column> shift(column_view const& input,
 std::unique_ptr<column> shift(column_view const& input,
                               size_type offset,
                               scalar const& fill_value,
+                              rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr)
 {
-  return detail::shift(input, offset, fill_value, rmm::cuda_stream_default, mr);
+  return detail::shift(input, offset, fill_value, stream, mr);
 }
 
 }  // namespace cudf
@@ -28,23 +28,31 @@
 
 namespace cudf {
 namespace detail {
-std::vector<column_view> slice(column_view const& input,
-                               std::vector<size_type> const& indices,
-                               rmm::cuda_stream_view stream)
+namespace {
+void validate_slice_indices(size_type num_rows, std::vector<size_type> const& indices)
 {
   CUDF_EXPECTS(indices.size() % 2 == 0, "indices size must be even");
+  for (std::size_t i = 0; i < indices.size(); i += 2) {
+    CUDF_EXPECTS(indices[i] >= 0, "Starting index cannot be negative.");
+    CUDF_EXPECTS(indices[i + 1] >= indices[i],
+                 "End index cannot be smaller than the starting index.");
+    CUDF_EXPECTS(indices[i + 1] <= num_rows, "Slice range out of bounds.");
+  }
+}
 
-  if (indices.empty()) return {};
-
-  auto null_counts = cudf::detail::segmented_count_unset_bits(input.null_mask(), indices, stream);
+/**
+ * @brief Slices `input` with the null counts of its slices, as returned by
+ * `batched_segmented_count_unset_bits`.
+ */
+std::vector<column_view> slice(column_view const& input,
+                               std::vector<size_type> const& indices,
+                               size_type const* null_counts)
+{
   auto const children = std::vector<column_view>(input.child_begin(), input.child_end());
 
   auto op = [&](auto i) {
     auto begin = indices[2 * i];
     auto end   = indices[2 * i + 1];
-    CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
-    CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
-    CUDF_EXPECTS(end <= input.size(), "Slice range out of bounds.");
     return column_view{input.type(),
                        end - begin,
                        input.head(),
@@ -56,36 +64,56 @@ std::vector<column_view> slice(column_view const& input,
   auto begin = cudf::detail::make_counting_transform_iterator(0, op);
   return std::vector<column_view>{begin, begin + indices.size() / 2};
 }
+}  // namespace
 
-}  // namespace detail
-
-std::vector<cudf::column_view> slice(cudf::column_view const& input,
-                                     std::vector<size_type> const& indices)
+std::vector<column_view> slice(column_view const& input,
+                               std::vector<size_type> const& indices,
+                               rmm::cuda_stream_view stream)
 {
-  CUDF_FUNC_RANGE();
-  return detail::slice(input, indices, rmm::cuda_stream_default);
+  validate_slice_indices(input.size(), indices);
+  if (indices.empty()) return {};
+
+  std::vector<bitmask_type const*> const masks{input.null_mask()};
+  std::vector<size_type> const offsets{input.offset()};
+  auto const null_counts =
+    cudf::detail::batched_segmented_count_unset_bits(masks, offsets, indices, stream);
+  return slice(input, indices, null_counts.data());
 }
 
-std::vector<cudf::table_view> slice(cudf::table_view const& input,
-                                    std::vector<size_type> const& indices)
+std::vector<table_view> slice(table_view const& input,
+                              std::vector<size_type> const& indices,
+                              rmm::cuda_stream_view stream)
 {
-  CUDF_FUNC_RANGE();
   CUDF_EXPECTS(indices.size() % 2 == 0, "indices size must be even");
   if (indices.empty()) { return {}; }
+  if (input.num_columns() == 0) { return std::vector<table_view>(indices.size() / 2); }
+  validate_slice_indices(input.num_rows(), indices);
+
+  // count the nulls of the slices of every column at once, rather than one launch and one
+  // synchronization per column
+  std::vector<bitmask_type const*> masks(input.num_columns());
+  std::vector<size_type> offsets(input.num_columns());
+  std::transform(
+    input.begin(), input.end(), masks.begin(), [](auto const& c) { return c.null_mask(); });
+  std::transform(
+    input.begin(), input.end(), offsets.begin(), [](auto const& c) { return c.offset(); });
+  auto const null_counts =
+    cudf::detail::batched_segmented_count_unset_bits(masks, offsets, indices, stream);
 
   // 2d arrangement of column_views that represent the outgoing table_views sliced_table[i][j]
   // where i is the i'th column of the j'th table_view
-  auto op = [&indices](auto const& c) { return cudf::slice(c, indices); };
-  auto f  = thrust::make_transform_iterator(input.begin(), op);
-
-  auto sliced_table = std::vector<std::vector<cudf::column_view>>(f, f + input.num_columns());
-  sliced_table.reserve(indices.size() + 1);
+  auto const num_output_tables = indices.size() / 2;
+  std::vector<std::vector<column_view>> sliced_table;
+  sliced_table.reserve(input.num_columns());
+  for (size_type j = 0; j < input.num_columns(); j++) {
+    sliced_table.emplace_back(
+      slice(input.column(j), indices, null_counts.data() + j * num_output_tables));
+  }
 
-  std::vector<cudf::table_view> result{};
+  std::vector<table_view> result{};
   // distribute columns into outgoing table_views
-  size_t num_output_tables = indices.size() / 2;
-  for (size_t i = 0; i < num_output_tables; i++) {
-    std::vector<cudf::column_view> table_columns;
+  for (std::size_t i = 0; i < num_output_tables; i++) {
+    std::vector<column_view> table_columns;
     for (size_type j = 0; j < input.num_columns(); j++) {
       table_columns.emplace_back(sliced_table[j][i]);
     }
@@ -93,6 +121,22 @@ std::vector<cudf::table_view> slice(cudf::table_view const& input,
   }
 
   return result;
+}
+
+}  // namespace detail
+
+std::vector<cudf::column_view> slice(cudf::column_view const& input,
+                                     std::vector<size_type> const& indices)
+{
+  CUDF_FUNC_RANGE();
+  return detail::slice(input, indices, rmm::cuda_stream_default);
+}
+
+std::vector<cudf::table_view> slice(cudf::table_view const& input,
+                                    std::vector<size_type> const& indices)
+{
+  CUDF_FUNC_RANGE();
+  return detail::slice(input, indices, rmm::cuda_stream_default);
 };
 
 }  // namespace cudf
@@ -19,9 +19,12 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
+#include <cudf/detail/datetime.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -29,20 +32,15 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <vector>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
-enum class datetime_component {
-  INVALID = 0,
-  YEAR,
-  MONTH,
-  DAY,
-  WEEKDAY,
-  HOUR,
-  MINUTE,
-  SECOND,
-};
-
 template <datetime_component Component>
 struct extract_component_operator {
   template <typename Timestamp>
@@ -182,6 +180,67 @@ std::unique_ptr<column> apply_datetime_op(column_view const& column,
   return output;
 }
 
+// Write all requested components of every row in the input column into the output columns
+struct extract_fields_functor {
+  column_view input;
+  int16_t* const* outputs;
+  datetime_component const* components;
+  size_type num_components;
+
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    auto const timestamps = input.begin<Timestamp>();
+    auto const d_outputs  = outputs;
+    auto const d_comps    = components;
+    auto const num_comps  = num_components;
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      [timestamps, d_outputs, d_comps, num_comps] __device__(size_type row) {
+        using namespace cuda::std::chrono;
+
+        // The date and the time of day are decomposed once for all components
+        auto const ts               = timestamps[row];
+        auto const days_since_epoch = floor<days>(ts);
+        auto const date             = year_month_day(days_since_epoch);
+
+        auto time_since_midnight = ts - days_since_epoch;
+        if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+        auto const hrs_  = duration_cast<hours>(time_since_midnight);
+        auto const mins_ = duration_cast<minutes>(time_since_midnight - hrs_);
+        auto const secs_ = duration_cast<seconds>(time_since_midnight - hrs_ - mins_);
+
+        for (size_type i = 0; i < num_comps; ++i) {
+          int16_t value = 0;
+          switch (d_comps[i]) {
+            case datetime_component::YEAR: value = static_cast<int>(date.year()); break;
+            case datetime_component::MONTH: value = static_cast<unsigned>(date.month()); break;
+            case datetime_component::DAY: value = static_cast<unsigned>(date.day()); break;
+            case datetime_component::WEEKDAY:
+              value = year_month_weekday(days_since_epoch).weekday().iso_encoding();
+              break;
+            case datetime_component::HOUR: value = hrs_.count(); break;
+            case datetime_component::MINUTE: value = mins_.count(); break;
+            case datetime_component::SECOND: value = secs_.count(); break;
+            default: break;
+          }
+          d_outputs[i][row] = value;
+        }
+      });
+  }
+};
+
 struct add_calendrical_months_functor {
   column_view timestamp_column;
   column_view months_column;
@@ -266,10 +325,10 @@ std::unique_ptr<column> add_calendrical_months(column_view const& timestamp_colu
   // Return an empty column if source column is empty
   if (size == 0) return make_empty_column(output_col_type);
 
-  auto output_col_mask =
+  auto [output_col_mask, null_count] =
     cudf::detail::bitmask_and(table_view({timestamp_column, months_column}), stream, mr);
   auto output = make_fixed_width_column(
-    output_col_type, size, std::move(output_col_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+    output_col_type, size, std::move(output_col_mask), null_count, stream, mr);
 
   auto launch = add_calendrical_months_functor{
     timestamp_column, months_column, static_cast<mutable_column_view>(*output)};
@@ -284,7 +343,7 @@ std::unique_ptr<column> extract_year(column_view const& column,
                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -293,7 +352,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
                                       rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -302,7 +361,7 @@ std::unique_ptr<column> extract_day(column_view const& column,
                                     rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -311,7 +370,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
                                         rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -320,7 +379,7 @@ std::unique_ptr<column> extract_hour(column_view const& column,
                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -329,7 +388,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
                                        rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -338,10 +397,45 @@ std::unique_ptr<column> extract_second(column_view const& column,
                                        rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
+std::unique_ptr<table> extract_fields(column_view const& column,
+                                      std::vector<datetime_component> const& components,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+
+  std::vector<std::unique_ptr<cudf::column>> output_columns;
+  std::vector<int16_t*> output_data;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    output_columns.push_back(make_fixed_width_column(data_type{type_id::INT16},
+                                                     column.size(),
+                                                     cudf::detail::copy_bitmask(column, stream, mr),
+                                                     column.null_count(),
+                                                     stream,
+                                                     mr));
+    output_data.push_back(output_columns.back()->mutable_view().data<int16_t>());
+  }
+  if (column.is_empty() or components.empty()) {
+    return std::make_unique<table>(std::move(output_columns));
+  }
+
+  auto const d_outputs    = cudf::detail::make_device_uvector_async(output_data, stream);
+  auto const d_components = cudf::detail::make_device_uvector_async(components, stream);
+
+  type_dispatcher(column.type(),
+                  extract_fields_functor{column,
+                                         d_outputs.data(),
+                                         d_components.data(),
+                                         static_cast<size_type>(components.size())},
+                  stream);
+
+  return std::make_unique<table>(std::move(output_columns));
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
@@ -405,6 +499,14 @@ std::unique_ptr<column> extract_second(column_view const& column,
   return detail::extract_second(column, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> extract_fields(column_view const& column,
+                                      std::vector<datetime_component> const& components,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_fields(column, components, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::mr::device_memory_resource* mr)
 {
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/orc/timezone.cuh>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/detail/datetime.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/transform.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the transition table of a timezone, built on the first call for the timezone.
+ *
+ * The tables are kept in device memory until the process exits, and are never modified once
+ * built, so that they can be read on any stream.
+ */
+io::timezone_table const& cached_timezone_table(std::string const& timezone_name,
+                                                rmm::cuda_stream_view stream)
+{
+  static std::mutex cache_mutex;
+  // Never destroyed, since the device memory resource may be destroyed first at exit
+  static auto cache = new std::map<std::string, std::unique_ptr<io::timezone_table>>();
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto table = cache->find(timezone_name);
+  if (table == cache->end()) {
+    table = cache
+              ->emplace(timezone_name,
+                        std::make_unique<io::timezone_table>(
+                          io::build_timezone_transition_table(timezone_name, stream)))
+              .first;
+  }
+  return *table->second;
+}
+
+/**
+ * @brief Returns the offset in seconds from UTC to the local time of a timezone, at a UTC time.
+ *
+ * The table of UTC is empty, and so is the table of a timezone without any offset.
+ */
+__device__ int64_t utc_offset(io::timezone_table_view const& table, int64_t utc_seconds)
+{
+  if (table.ttimes.empty()) { return 0; }
+  return io::get_gmt_offset(table.ttimes, table.offsets, utc_seconds);
+}
+
+struct convert_timezone_functor {
+  template <typename Timestamp>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_timestamp<Timestamp>() and not std::is_same_v<Timestamp, timestamp_D>;
+  }
+
+  template <typename Timestamp, std::enable_if_t<is_supported<Timestamp>()>* = nullptr>
+  void operator()(column_view const& input,
+                  mutable_column_view& output,
+                  io::timezone_table_view from_table,
+                  io::timezone_table_view to_table,
+                  rmm::cuda_stream_view stream) const
+  {
+    using Duration = typename Timestamp::duration;
+    thrust::transform(
+      rmm::exec_policy(stream),
+      input.begin<Timestamp>(),
+      input.end<Timestamp>(),
+      output.begin<Timestamp>(),
+      [from_table, to_table] __device__(Timestamp ts) {
+        using namespace cuda::std::chrono;
+        auto const local_seconds = floor<seconds>(ts).time_since_epoch().count();
+
+        // The offset at the local time taken as UTC is corrected by the offset at the time found
+        auto const utc_guess   = local_seconds - utc_offset(from_table, local_seconds);
+        auto const from_offset = utc_offset(from_table, utc_guess);
+        auto const to_offset   = utc_offset(to_table, local_seconds - from_offset);
+        return Timestamp{ts.time_since_epoch() +
+                         duration_cast<Duration>(seconds{to_offset - from_offset})};
+      });
+  }
+
+  template <typename Timestamp, std::enable_if_t<not is_supported<Timestamp>()>* = nullptr>
+  void operator()(column_view const&,
+                  mutable_column_view&,
+                  io::timezone_table_view,
+                  io::timezone_table_view,
+                  rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Column type should be a timestamp of a resolution of seconds or finer");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(timestamps.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(timestamps.type().id() != type_id::TIMESTAMP_DAYS,
+               "Column type should be a timestamp of a resolution of seconds or finer");
+
+  auto const& from_table = cached_timezone_table(from_timezone, stream);
+  auto const& to_table   = cached_timezone_table(to_timezone, stream);
+
+  if (timestamps.is_empty()) { return make_empty_column(timestamps.type()); }
+
+  auto output = make_fixed_width_column(timestamps.type(),
+                                        timestamps.size(),
+                                        cudf::detail::copy_bitmask(timestamps, stream, mr),
+                                        timestamps.null_count(),
+                                        stream,
+                                        mr);
+
+  auto output_view = output->mutable_view();
+  type_dispatcher(timestamps.type(),
+                  convert_timezone_functor{},
+                  timestamps,
+                  output_view,
+                  from_table.view(),
+                  to_table.view(),
+                  stream);
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(
+    timestamps, from_timezone, to_timezone, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace datetime
+}  // namespace cudf
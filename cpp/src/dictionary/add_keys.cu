@@ -75,6 +75,7 @@ std::unique_ptr<column> add_keys(
     table_view{{old_keys}},
     std::vector<order>{order::ASCENDING},
     std::vector<null_order>{null_order::AFTER},  // should be no nulls here
+    sorted::YES,                                 // the old keys are sorted
     stream,
     mr);
   // now create the indices column -- map old values to the new ones
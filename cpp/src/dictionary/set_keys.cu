@@ -26,11 +26,16 @@
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/equal.h>
+#include <thrust/transform.h>
 #include <algorithm>
 #include <iterator>
 
@@ -57,14 +62,17 @@ struct dispatch_compute_indices {
     auto dictionary_view = column_device_view::create(input.parent(), stream);
     auto d_dictionary    = *dictionary_view;
     auto keys_view       = column_device_view::create(input.keys(), stream);
-    auto dictionary_itr  = thrust::make_permutation_iterator(
-      keys_view->begin<Element>(),
-      thrust::make_transform_iterator(
-        thrust::make_counting_iterator<size_type>(0), [d_dictionary] __device__(size_type idx) {
-          if (d_dictionary.is_null(idx)) return 0;
-          return static_cast<size_type>(d_dictionary.element<dictionary32>(idx));
-        }));
-    auto new_keys_view = column_device_view::create(new_keys, stream);
+    auto new_keys_view   = column_device_view::create(new_keys, stream);
+
+    // only the keys are searched for, and each row takes the new index of its key
+    rmm::device_uvector<size_type> keys_map(input.keys().size(), stream);
+    thrust::lower_bound(rmm::exec_policy(stream),
+                        new_keys_view->begin<Element>(),
+                        new_keys_view->end<Element>(),
+                        keys_view->begin<Element>(),
+                        keys_view->end<Element>(),
+                        keys_map.begin(),
+                        thrust::less<Element>());
 
     // create output indices column
     auto result = make_numeric_column(get_indices_type_for_size(new_keys.size()),
@@ -74,13 +82,16 @@ struct dispatch_compute_indices {
                                       mr);
     auto result_itr =
       cudf::detail::indexalator_factory::make_output_iterator(result->mutable_view());
-    thrust::lower_bound(rmm::exec_policy(stream),
-                        new_keys_view->begin<Element>(),
-                        new_keys_view->end<Element>(),
-                        dictionary_itr,
-                        dictionary_itr + input.size(),
-                        result_itr,
-                        thrust::less<Element>());
+    auto d_keys_map = keys_map.data();
+    thrust::transform(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(input.size()),
+      result_itr,
+      [d_dictionary, d_keys_map] __device__(size_type idx) {
+        if (d_dictionary.is_null(idx)) return 0;
+        return d_keys_map[static_cast<size_type>(d_dictionary.element<dictionary32>(idx))];
+      });
     result->set_null_count(0);
     return result;
   }
@@ -99,6 +110,25 @@ struct dispatch_compute_indices {
 
 }  // namespace
 
+bool have_matching_keys(std::vector<dictionary_column_view> const& input,
+                        rmm::cuda_stream_view stream)
+{
+  auto const has_keys = [](auto const& col) { return col.parent().num_children() == 2; };
+  if (input.empty() || !std::all_of(input.begin(), input.end(), has_keys)) { return false; }
+  auto const keys = input.front().keys();
+  auto d_keys     = table_device_view::create(table_view{{keys}}, stream);
+  return std::all_of(input.begin() + 1, input.end(), [&](auto const& col) {
+    auto const other = col.keys();
+    if (other.type() != keys.type() || other.size() != keys.size()) { return false; }
+    auto d_other = table_device_view::create(table_view{{other}}, stream);
+    return thrust::equal(rmm::exec_policy(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         thrust::make_counting_iterator<size_type>(keys.size()),
+                         thrust::make_counting_iterator<size_type>(0),
+                         row_equality_comparator<false>(*d_keys, *d_other));
+  });
+}
+
 //
 std::unique_ptr<column> set_keys(
   dictionary_column_view const& dictionary_column,
@@ -157,6 +187,13 @@ std::vector<std::unique_ptr<column>> match_dictionaries(std::vector<dictionary_c
                                                         rmm::cuda_stream_view stream,
                                                         rmm::mr::device_memory_resource* mr)
 {
+  if (have_matching_keys(input, stream)) {
+    std::vector<std::unique_ptr<column>> result(input.size());
+    std::transform(input.begin(), input.end(), result.begin(), [stream, mr](auto& col) {
+      return std::make_unique<column>(col.parent(), stream, mr);
+    });
+    return result;
+  }
   std::vector<column_view> keys(input.size());
   std::transform(input.begin(), input.end(), keys.begin(), [](auto& col) { return col.keys(); });
   auto new_keys  = cudf::detail::concatenate(keys, stream);
@@ -190,6 +227,8 @@ std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_d
         tables.begin(), tables.end(), std::back_inserter(dict_views), [col_idx](auto& t) {
           return dictionary_column_view(t.column(col_idx));
         });
+      // the indices of dictionaries with the same keys already compare like their keys
+      if (have_matching_keys(dict_views, stream)) { continue; }
       // now match the keys in these dictionary columns
       auto dict_cols = dictionary::detail::match_dictionaries(dict_views, stream, mr);
       // replace the updated_columns vector entries for the set of columns at col_idx
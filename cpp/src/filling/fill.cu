@@ -36,9 +36,35 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+
 #include <memory>
 
 namespace {
+/**
+ * @brief Fills `[begin, end)` of `destination` with the value at `fill_value` in device memory.
+ *
+ * The value is read by the copy kernel rather than copied to the host, so that filling with the
+ * result of a reduction does not synchronize.
+ */
+template <typename T>
+void in_place_fill(cudf::mutable_column_view& destination,
+                   cudf::size_type begin,
+                   cudf::size_type end,
+                   T const* fill_value,
+                   bool is_valid,
+                   rmm::cuda_stream_view stream)
+{
+  cudf::detail::copy_range(
+    thrust::make_permutation_iterator(fill_value, thrust::make_constant_iterator(0)),
+    thrust::make_constant_iterator(is_valid),
+    destination,
+    begin,
+    end,
+    stream);
+}
+
 template <typename T>
 void in_place_fill(cudf::mutable_column_view& destination,
                    cudf::size_type begin,
@@ -48,14 +74,7 @@ void in_place_fill(cudf::mutable_column_view& destination,
 {
   using ScalarType = cudf::scalar_type_t<T>;
   auto p_scalar    = static_cast<ScalarType const*>(&value);
-  T fill_value     = p_scalar->value(stream);
-  bool is_valid    = p_scalar->is_valid();
-  cudf::detail::copy_range(thrust::make_constant_iterator(fill_value),
-                           thrust::make_constant_iterator(is_valid),
-                           destination,
-                           begin,
-                           end,
-                           stream);
+  in_place_fill<T>(destination, begin, end, p_scalar->data(), p_scalar->is_valid(stream), stream);
 }
 
 struct in_place_fill_range_dispatch {
@@ -74,11 +93,9 @@ struct in_place_fill_range_dispatch {
                                                                cudf::size_type end,
                                                                rmm::cuda_stream_view stream)
   {
-    auto unscaled = static_cast<cudf::fixed_point_scalar<T> const&>(value).value();
     using RepType = typename T::rep;
-    auto s        = cudf::numeric_scalar<RepType>(unscaled, value.is_valid());
-    auto view     = cudf::bit_cast(destination, s.type());
-    in_place_fill<RepType>(view, begin, end, s, stream);
+    auto unscaled = static_cast<cudf::fixed_point_scalar<T> const&>(value).data();
+    in_place_fill<RepType>(destination, begin, end, unscaled, value.is_valid(stream), stream);
   }
 
   template <typename T>
@@ -115,7 +132,7 @@ struct out_of_place_fill_range_dispatch {
     auto p_ret = std::make_unique<cudf::column>(input, stream, mr);
 
     if (end != begin) {  // otherwise no fill
-      if (!p_ret->nullable() && !value.is_valid()) {
+      if (!p_ret->nullable() && !value.is_valid(stream)) {
         p_ret->set_null_mask(
           cudf::detail::create_null_mask(p_ret->size(), cudf::mask_state::ALL_VALID, stream, mr),
           0);
@@ -175,7 +192,7 @@ std::unique_ptr<cudf::column> out_of_place_fill_range_dispatch::operator()<cudf:
   CUDF_EXPECTS(target.keys().type() == value.type(), "Data type mismatch.");
 
   // if the scalar is invalid, then just copy the column and fill the null mask
-  if (!value.is_valid()) {
+  if (!value.is_valid(stream)) {
     auto result = std::make_unique<cudf::column>(input, stream, mr);
     auto mview  = result->mutable_view();
     cudf::detail::set_null_mask(mview.null_mask(), begin, end, false, stream);
@@ -235,7 +252,7 @@ void fill_in_place(mutable_column_view& destination,
                "In-place fill does not support variable-sized types.");
   CUDF_EXPECTS((begin >= 0) && (end <= destination.size()) && (begin <= end),
                "Range is out of bounds.");
-  CUDF_EXPECTS((destination.nullable() == true) || (value.is_valid() == true),
+  CUDF_EXPECTS((destination.nullable() == true) || (value.is_valid(stream) == true),
                "destination should be nullable or value should be non-null.");
   CUDF_EXPECTS(destination.type() == value.type(), "Data type mismatch.");
 
@@ -23,6 +23,7 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/hashing.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
@@ -45,13 +46,36 @@ groupby::groupby(table_view const& keys,
                  null_policy include_null_keys,
                  sorted keys_are_sorted,
                  std::vector<order> const& column_order,
-                 std::vector<null_order> const& null_precedence)
+                 std::vector<null_order> const& null_precedence,
+                 determinism result_determinism,
+                 std::vector<case_sensitivity> const& key_case)
   : _keys{keys},
     _include_null_keys{include_null_keys},
     _keys_are_sorted{keys_are_sorted},
     _column_order{column_order},
-    _null_precedence{null_precedence}
+    _null_precedence{null_precedence},
+    _result_determinism{result_determinism},
+    _key_case{key_case}
 {
+  CUDF_EXPECTS(key_case.empty() or key_case.size() == static_cast<std::size_t>(keys.num_columns()),
+               "Mismatch between number of key columns and key_case size.");
+}
+
+groupby::groupby(table_view const& keys, device_span<size_type const> group_offsets)
+  : _keys{keys},
+    _include_null_keys{null_policy::INCLUDE},
+    _keys_are_sorted{sorted::YES},
+    _helper{std::make_unique<detail::sort::sort_groupby_helper>(
+      keys, group_offsets, rmm::cuda_stream_default)}
+{
+}
+
+groupby::groupby(table_view const& keys,
+                 column_view const& row_hashes,
+                 null_policy include_null_keys)
+  : _keys{keys}, _include_null_keys{include_null_keys}, _row_hashes{row_hashes}
+{
+  cudf::detail::expects_row_hashes(row_hashes, keys.num_rows());
 }
 
 // Select hash vs. sort groupby implementation
@@ -65,10 +89,12 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   // all the aggs that can be done by hash groupby are efficiently done by
   // sort groupby as well.
   // Only use hash groupby if the keys aren't sorted and all requests can be
-  // satisfied with a hash implementation
+  // satisfied with a hash implementation, with reproducible results if required
   if (_keys_are_sorted == sorted::NO and not _helper and
-      detail::hash::can_use_hash_groupby(_keys, requests)) {
-    return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
+      detail::hash::can_use_hash_groupby(_keys, requests, _result_determinism)) {
+    auto const row_hashes = _row_hashes.is_empty() ? nullptr : _row_hashes.data<uint32_t>();
+    return detail::hash::groupby(
+      _keys, requests, _include_null_keys, _key_case, row_hashes, stream, mr);
   } else {
     return sort_aggregate(requests, stream, mr);
   }
@@ -189,7 +215,7 @@ detail::sort::sort_groupby_helper& groupby::helper()
 {
   if (_helper) return *_helper;
   _helper = std::make_unique<detail::sort::sort_groupby_helper>(
-    _keys, _include_null_keys, _keys_are_sorted);
+    _keys, _include_null_keys, _keys_are_sorted, _key_case);
   return *_helper;
 };
 
@@ -28,24 +28,45 @@
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/replace.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/lists/detail/drop_list_duplicates.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <hash/concurrent_unordered_map.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
-
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -60,7 +81,7 @@ namespace {
  * @brief List of aggregation operations that can be computed with a hash-based
  * implementation.
  */
-constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
+constexpr std::array<aggregation::Kind, 17> hash_aggregations{aggregation::SUM,
                                                               aggregation::PRODUCT,
                                                               aggregation::MIN,
                                                               aggregation::MAX,
@@ -71,11 +92,25 @@ constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
                                                               aggregation::SUM_OF_SQUARES,
                                                               aggregation::MEAN,
                                                               aggregation::STD,
-                                                              aggregation::VARIANCE};
+                                                              aggregation::VARIANCE,
+                                                              aggregation::NUNIQUE,
+                                                              aggregation::APPROX_NUNIQUE,
+                                                              aggregation::NUNIQUE_SKETCH,
+                                                              aggregation::COLLECT_LIST,
+                                                              aggregation::COLLECT_SET};
 
 // Could be hash: SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, ANY, ALL,
 // Compound: MEAN(SUM, COUNT_VALID), VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
-// ARGMAX, ARGMIN
+// ARGMAX, ARGMIN, NUNIQUE, APPROX_NUNIQUE, NUNIQUE_SKETCH, COLLECT_LIST, COLLECT_SET(COLLECT_LIST)
+
+/// The number of slots of the shared memory hash table of every block of `compute_block_aggs`
+constexpr size_type block_aggs_table_size{4096};
+/// The largest estimated number of groups for which every block aggregates its rows privately
+constexpr size_type low_cardinality_threshold{block_aggs_table_size / 2};
+/// The number of rows of the keys whose distinct rows are counted to estimate the groups
+constexpr size_type cardinality_sample_size{16384};
+constexpr int block_aggs_block_size{256};
+constexpr size_type block_aggs_rows_per_thread{32};
 
 // TODO replace with std::find in C++20 onwards.
 template <class T, size_t N>
@@ -100,6 +135,46 @@ bool constexpr is_hash_aggregation(aggregation::Kind t)
   return array_contains(hash_aggregations, t);
 }
 
+/**
+ * @brief Indicates whether the hash-based groupby computes the same results of an aggregation
+ * of `values` from run to run.
+ *
+ * The floating-point sums and products of a group are accumulated by atomic operations in the
+ * order the threads run, and so are the squared deviations of `VARIANCE` and `STD` of all types.
+ */
+bool is_deterministic_hash_aggregation(column_view const& values, aggregation::Kind k)
+{
+  auto const values_type = cudf::is_dictionary(values.type())
+                             ? dictionary_column_view(values).keys().type()
+                             : values.type();
+  switch (k) {
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MEAN: return not cudf::is_floating_point(values_type);
+    case aggregation::VARIANCE:
+    case aggregation::STD: return false;
+    default: return true;
+  }
+}
+
+/**
+ * @brief Indicates whether an aggregation is a `COLLECT_LIST` or a `COLLECT_SET` that excludes
+ * the null values.
+ */
+bool is_collect_excluding_nulls(aggregation const& agg)
+{
+  switch (agg.kind) {
+    case aggregation::COLLECT_LIST:
+      return static_cast<cudf::detail::collect_list_aggregation const&>(agg)._null_handling ==
+             null_policy::EXCLUDE;
+    case aggregation::COLLECT_SET:
+      return static_cast<cudf::detail::collect_set_aggregation const&>(agg)._null_handling ==
+             null_policy::EXCLUDE;
+    default: return false;
+  }
+}
+
 template <typename Map>
 class hash_compound_agg_finalizer final : public cudf::detail::aggregation_finalizer {
   size_t col_idx;
@@ -265,6 +340,179 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     auto result = cudf::detail::unary_operation(variance, unary_operator::SQRT, stream, mr);
     dense_results->add_result(col_idx, agg, std::move(result));
   }
+
+  void visit(cudf::detail::nunique_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col_idx, agg)) return;
+
+    // The indices of a dictionary are equal exactly when their keys are
+    auto const values = cudf::is_dictionary(col.type())
+                          ? cudf::dictionary_column_view(col).get_indices_annotated()
+                          : col;
+
+    rmm::device_uvector<size_type> group_indices(col.size(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(col.size()),
+                      group_indices.begin(),
+                      ::cudf::detail::group_index_hash_functor<Map>{map, row_bitmask});
+
+    // Every distinct pair of a group and a value is a distinct row of this table
+    auto const pairs = table_view(
+      {column_view(data_type{type_to_id<size_type>()}, col.size(), group_indices.data()), values});
+    auto const d_pairs = table_device_view::create(pairs, stream);
+
+    size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
+    size_type constexpr unused_value{std::numeric_limits<size_type>::max()};
+    using set_type = concurrent_unordered_map<size_type,
+                                              size_type,
+                                              row_hasher<default_hash, true>,
+                                              row_equality_comparator<true>>;
+    auto set = set_type::create(compute_hash_table_size(col.size()),
+                                stream,
+                                unused_key,
+                                unused_value,
+                                row_hasher<default_hash, true>{*d_pairs},
+                                row_equality_comparator<true>{*d_pairs, *d_pairs, true},
+                                typename set_type::allocator_type());
+
+    auto nunique_result = make_numeric_column(
+      data_type{type_to_id<size_type>()}, col.size(), mask_state::UNALLOCATED, stream);
+    auto nunique_result_view = mutable_column_device_view::create(nunique_result->mutable_view());
+    thrust::fill(rmm::exec_policy(stream),
+                 nunique_result->mutable_view().begin<size_type>(),
+                 nunique_result->mutable_view().end<size_type>(),
+                 0);
+    auto values_view = column_device_view::create(values);
+
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       col.size(),
+                       ::cudf::detail::nunique_hash_functor<set_type>{
+                         *set,
+                         row_bitmask,
+                         *nunique_result_view,
+                         *values_view,
+                         group_indices.data(),
+                         agg._null_handling == null_policy::EXCLUDE});
+    sparse_results->add_result(col_idx, agg, std::move(nunique_result));
+    dense_results->add_result(col_idx, agg, to_dense_agg_result(agg));
+  }
+
+  void visit(cudf::detail::approx_nunique_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col_idx, agg)) return;
+
+    // The sketches are only allocated for the groups, so they are indexed by dense results
+    auto result = agg.kind == aggregation::NUNIQUE_SKETCH
+                    ? cudf::detail::approx_distinct_count_sketch(col,
+                                                                 dense_group_indices(),
+                                                                 map_size,
+                                                                 agg._null_handling,
+                                                                 agg._precision,
+                                                                 stream,
+                                                                 mr)
+                    : cudf::detail::approx_distinct_count(col,
+                                                          dense_group_indices(),
+                                                          map_size,
+                                                          agg._null_handling,
+                                                          agg._precision,
+                                                          stream,
+                                                          mr);
+    dense_results->add_result(col_idx, agg, std::move(result));
+  }
+
+  void visit(cudf::detail::collect_list_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col_idx, agg)) return;
+
+    auto group_indices = dense_group_indices();
+
+    // The sizes of the lists are counted first, and scanned to their offsets
+    auto offsets = make_numeric_column(
+      data_type{type_to_id<size_type>()}, map_size + 1, mask_state::UNALLOCATED, stream, mr);
+    auto d_offsets = offsets->mutable_view().template begin<size_type>();
+    thrust::fill(rmm::exec_policy(stream), d_offsets, d_offsets + map_size + 1, 0);
+    thrust::for_each(rmm::exec_policy(stream),
+                     group_indices.begin(),
+                     group_indices.end(),
+                     [d_offsets] __device__(size_type group_index) {
+                       if (group_index >= 0) { atomicAdd(d_offsets + group_index, 1); }
+                     });
+    thrust::exclusive_scan(
+      rmm::exec_policy(stream), d_offsets, d_offsets + map_size + 1, d_offsets);
+
+    // The rows are then placed by a stable sort on their group index, which keeps the rows of
+    // every group in order and moves the skipped rows, of index -1, before all groups
+    rmm::device_uvector<size_type> rows(col.size(), stream);
+    thrust::sequence(rmm::exec_policy(stream), rows.begin(), rows.end());
+    thrust::stable_sort_by_key(
+      rmm::exec_policy(stream), group_indices.begin(), group_indices.end(), rows.begin());
+    auto const num_values = cudf::detail::get_value<size_type>(offsets->view(), map_size, stream);
+
+    auto values = cudf::detail::gather(table_view({col}),
+                                       rows.end() - num_values,
+                                       rows.end(),
+                                       out_of_bounds_policy::DONT_CHECK,
+                                       stream,
+                                       mr);
+
+    dense_results->add_result(col_idx,
+                              agg,
+                              make_lists_column(map_size,
+                                                std::move(offsets),
+                                                std::move(values->release()[0]),
+                                                0,
+                                                rmm::device_buffer{0, stream, mr},
+                                                stream,
+                                                mr));
+  }
+
+  void visit(cudf::detail::collect_set_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col_idx, agg)) return;
+
+    // The duplicates of every list are dropped by a hash of the pairs of list index and value
+    auto collect_agg = make_collect_list_aggregation(agg._null_handling);
+    this->visit(*static_cast<cudf::detail::collect_list_aggregation*>(collect_agg.get()));
+    lists_column_view collect_result{dense_results->get_result(col_idx, *collect_agg)};
+
+    dense_results->add_result(
+      col_idx,
+      agg,
+      lists::detail::drop_list_duplicates(
+        collect_result, agg._nulls_equal, agg._nans_equal, stream, mr));
+  }
+
+ private:
+  /**
+   * @brief Returns the index of the dense result of the group of every row, or -1 for the rows
+   * that are skipped for their null keys.
+   */
+  rmm::device_uvector<size_type> dense_group_indices()
+  {
+    rmm::device_uvector<size_type> dense_indices(col.size(), stream);
+    thrust::scatter(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(map_size),
+                    gather_map.begin(),
+                    dense_indices.begin());
+
+    rmm::device_uvector<size_type> group_indices(col.size(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(col.size()),
+                      group_indices.begin(),
+                      ::cudf::detail::group_index_hash_functor<Map>{map, row_bitmask});
+    thrust::transform(rmm::exec_policy(stream),
+                      group_indices.begin(),
+                      group_indices.end(),
+                      group_indices.begin(),
+                      [d_dense_indices = dense_indices.data()] __device__(size_type sparse_index) {
+                        return sparse_index < 0 ? sparse_index : d_dense_indices[sparse_index];
+                      });
+    return group_indices;
+  }
 };
 
 // flatten aggs to filter in single pass aggs
@@ -319,7 +567,7 @@ void sparse_to_dense_results(table_view const& keys,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr)
 {
-  auto row_bitmask{bitmask_and(keys, stream, rmm::mr::get_current_device_resource())};
+  auto row_bitmask{bitmask_and(keys, stream, cudf::get_current_temp_resource()).first};
   bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
   bitmask_type const* row_bitmask_ptr =
     skip_key_rows_with_nulls ? static_cast<bitmask_type*>(row_bitmask.data()) : nullptr;
@@ -344,6 +592,19 @@ void sparse_to_dense_results(table_view const& keys,
   }
 }
 
+/**
+ * @brief Returns the hasher of the rows of `d_keys`, which returns the `row_hashes` if they are
+ * precomputed.
+ */
+template <bool keys_have_nulls>
+row_hasher<default_hash, keys_have_nulls> make_key_hasher(table_device_view const& d_keys,
+                                                          case_sensitivity const* key_case,
+                                                          hash_value_type const* row_hashes)
+{
+  using hasher_type = row_hasher<default_hash, keys_have_nulls>;
+  return (row_hashes != nullptr) ? hasher_type{d_keys, row_hashes} : hasher_type{d_keys, key_case};
+}
+
 /**
  * @brief Construct hash map that uses row comparator and row hasher on
  * `d_keys` table and stores indices
@@ -351,6 +612,8 @@ void sparse_to_dense_results(table_view const& keys,
 template <bool keys_have_nulls>
 auto create_hash_map(table_device_view const& d_keys,
                      null_policy include_null_keys,
+                     case_sensitivity const* key_case,
+                     hash_value_type const* row_hashes,
                      rmm::cuda_stream_view stream)
 {
   size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
@@ -365,8 +628,9 @@ auto create_hash_map(table_device_view const& d_keys,
 
   bool const null_keys_are_equal{include_null_keys == null_policy::INCLUDE};
 
-  row_hasher<default_hash, keys_have_nulls> hasher{d_keys};
-  row_equality_comparator<keys_have_nulls> rows_equal{d_keys, d_keys, null_keys_are_equal};
+  auto const hasher = make_key_hasher<keys_have_nulls>(d_keys, key_case, row_hashes);
+  row_equality_comparator<keys_have_nulls> rows_equal{
+    d_keys, d_keys, null_keys_are_equal, key_case};
 
   return map_type::create(compute_hash_table_size(d_keys.num_rows()),
                           stream,
@@ -410,6 +674,28 @@ auto create_sparse_results_table(table_view const& flattened_values,
   return sparse_table;
 }
 
+/**
+ * @brief Indicates whether `keys` has few enough distinct rows for every block to aggregate its
+ * rows into a hash table in shared memory.
+ *
+ * The distinct rows are counted on an evenly strided sample of `keys`, which has at most as many
+ * distinct rows as `keys`.
+ */
+bool is_low_cardinality(table_view const& keys, rmm::cuda_stream_view stream)
+{
+  // A single block holds all the rows, so aggregating them privately saves nothing
+  if (keys.num_rows() <= block_aggs_block_size * block_aggs_rows_per_thread) { return false; }
+
+  auto const sample_size = std::min(keys.num_rows(), cardinality_sample_size);
+  auto const stride      = keys.num_rows() / sample_size;
+  auto sample_rows       = cudf::detail::make_counting_transform_iterator(
+    0, [stride] __device__(size_type i) { return i * stride; });
+  auto const sample = cudf::detail::gather(
+    keys, sample_rows, sample_rows + sample_size, out_of_bounds_policy::DONT_CHECK, stream);
+  return cudf::detail::distinct_count(sample->view(), null_equality::EQUAL, stream) <=
+         low_cardinality_threshold;
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
@@ -422,6 +708,8 @@ void compute_single_pass_aggs(table_view const& keys,
                               cudf::detail::result_cache* sparse_results,
                               Map& map,
                               null_policy include_null_keys,
+                              case_sensitivity const* key_case,
+                              hash_value_type const* row_hashes,
                               rmm::cuda_stream_view stream)
 {
   // flatten the aggs to a table that can be operated on by aggregate_row
@@ -440,18 +728,57 @@ void compute_single_pass_aggs(table_view const& keys,
   bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
 
   auto row_bitmask =
-    skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream) : rmm::device_buffer{};
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    keys.num_rows(),
-    hash::compute_single_pass_aggs_fn<Map>{map,
-                                           keys.num_rows(),
-                                           *d_values,
-                                           *d_sparse_table,
-                                           d_aggs.data().get(),
-                                           static_cast<bitmask_type*>(row_bitmask.data()),
-                                           skip_key_rows_with_nulls});
+    skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream).first : rmm::device_buffer{};
+  if (is_low_cardinality(keys, stream)) {
+    // Few groups would contend for the same atomics of the global results, so every block
+    // aggregates its rows privately first, and the results of the blocks are merged
+    table block_table   = create_sparse_results_table(flattened_values, aggs, stream);
+    auto d_block_table  = mutable_table_device_view::create(block_table, stream);
+    auto d_block_values = table_device_view::create(block_table.view(), stream);
+    auto d_keys         = table_device_view::create(keys, stream);
+    rmm::device_uvector<size_type> representatives(keys.num_rows(), stream);
+    rmm::device_scalar<size_type> num_representatives(0, stream);
+
+    cudf::detail::grid_1d const grid(
+      keys.num_rows(), block_aggs_block_size, block_aggs_rows_per_thread);
+    hash::compute_block_aggs<block_aggs_table_size>
+      <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+        keys.num_rows(),
+        grid.num_threads_per_block * block_aggs_rows_per_thread,
+        make_key_hasher<keys_have_nulls>(*d_keys, key_case, row_hashes),
+        row_equality_comparator<keys_have_nulls>{
+          *d_keys, *d_keys, include_null_keys == null_policy::INCLUDE, key_case},
+        *d_values,
+        *d_block_table,
+        d_aggs.data().get(),
+        static_cast<bitmask_type*>(row_bitmask.data()),
+        skip_key_rows_with_nulls,
+        representatives.data(),
+        num_representatives.data());
+    CHECK_CUDA(stream.value());
+
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       num_representatives.value(stream),
+                       hash::merge_block_aggs_fn<Map>{map,
+                                                      representatives.data(),
+                                                      *d_values,
+                                                      *d_block_values,
+                                                      *d_sparse_table,
+                                                      d_aggs.data().get()});
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      keys.num_rows(),
+      hash::compute_single_pass_aggs_fn<Map>{map,
+                                             keys.num_rows(),
+                                             *d_values,
+                                             *d_sparse_table,
+                                             d_aggs.data().get(),
+                                             static_cast<bitmask_type*>(row_bitmask.data()),
+                                             skip_key_rows_with_nulls});
+  }
   // Add results back to sparse_results cache
   auto sparse_result_cols = sparse_table.release();
   for (size_t i = 0; i < aggs.size(); i++) {
@@ -514,17 +841,25 @@ std::pair<rmm::device_uvector<size_type>, size_type> extract_populated_keys(
  * requested in `requests`, we gather sparse results into a column of dense
  * results using the aforementioned index vector. Dense results are stored into
  * the in/out parameter `cache`.
+ *
+ * The strings of the columns whose `key_case` is `case_sensitivity::INSENSITIVE` are hashed and
+ * compared regardless of the case of their ASCII letters, and the keys of a group are those of
+ * its first row inserted in the hash table. If `row_hashes` is not null, the rows are not hashed
+ * and `row_hashes` holds the hash value of every row.
  */
 template <bool keys_have_nulls>
 std::unique_ptr<table> groupby_null_templated(table_view const& keys,
                                               host_span<aggregation_request const> requests,
                                               cudf::detail::result_cache* cache,
                                               null_policy include_null_keys,
+                                              case_sensitivity const* key_case,
+                                              hash_value_type const* row_hashes,
                                               rmm::cuda_stream_view stream,
                                               rmm::mr::device_memory_resource* mr)
 {
   auto d_keys = table_device_view::create(keys, stream);
-  auto map    = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, stream);
+  auto map    = create_hash_map<keys_have_nulls>(
+    *d_keys, include_null_keys, key_case, row_hashes, stream);
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash map
@@ -532,7 +867,7 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
 
   // Compute all single pass aggs first
   compute_single_pass_aggs<keys_have_nulls>(
-    keys, requests, &sparse_results, *map, include_null_keys, stream);
+    keys, requests, &sparse_results, *map, include_null_keys, key_case, row_hashes, stream);
 
   // Extract the populated indices from the hash map and create a gather map.
   // Gathering using this map from sparse results will give dense results.
@@ -573,13 +908,27 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
  * @return true A hash-based groupby should be used
  * @return false A hash-based groupby should not be used
  */
-bool can_use_hash_groupby(table_view const& keys, host_span<aggregation_request const> requests)
+bool can_use_hash_groupby(table_view const& keys,
+                          host_span<aggregation_request const> requests,
+                          determinism result_determinism)
 {
-  return std::all_of(requests.begin(), requests.end(), [](aggregation_request const& r) {
-    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [](auto const& a) {
-      return is_hash_aggregation(a->kind);
+  return std::all_of(
+    requests.begin(), requests.end(), [result_determinism](aggregation_request const& r) {
+      return std::all_of(
+        r.aggregations.begin(), r.aggregations.end(), [&r, result_determinism](auto const& a) {
+          // The distinct values are found by hashing them, which nested types don't support.
+          // Collections excluding nulls are left to the sort-based groupby, which rejects them.
+          // There are no device atomics wide enough to update decimal128 targets in place.
+          return is_hash_aggregation(a->kind) and r.values.type().id() != type_id::DECIMAL128 and
+                 not((a->kind == aggregation::NUNIQUE or
+                      a->kind == aggregation::APPROX_NUNIQUE or
+                      a->kind == aggregation::NUNIQUE_SKETCH) and
+                     is_nested(r.values.type())) and
+                 not is_collect_excluding_nulls(*a) and
+                 (result_determinism == determinism::NONDETERMINISTIC or
+                  is_deterministic_hash_aggregation(r.values, a->kind));
+        });
     });
-  });
 }
 
 // Hash-based groupby
@@ -587,18 +936,21 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   host_span<aggregation_request const> requests,
   null_policy include_null_keys,
+  std::vector<case_sensitivity> const& key_case,
+  uint32_t const* row_hashes,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   cudf::detail::result_cache cache(requests.size());
+  auto const d_key_case = cudf::detail::make_device_uvector_async(key_case, stream);
 
   std::unique_ptr<table> unique_keys;
-  if (has_nulls(keys)) {
-    unique_keys =
-      groupby_null_templated<true>(keys, requests, &cache, include_null_keys, stream, mr);
+  if (has_nested_nulls(keys)) {
+    unique_keys = groupby_null_templated<true>(
+      keys, requests, &cache, include_null_keys, d_key_case.data(), row_hashes, stream, mr);
   } else {
-    unique_keys =
-      groupby_null_templated<false>(keys, requests, &cache, include_null_keys, stream, mr);
+    unique_keys = groupby_null_templated<false>(
+      keys, requests, &cache, include_null_keys, d_key_case.data(), row_hashes, stream, mr);
   }
 
   return std::make_pair(std::move(unique_keys), extract_results(requests, cache));
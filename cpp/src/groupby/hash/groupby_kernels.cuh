@@ -22,6 +22,10 @@
 #include <cudf/utilities/bit.hpp>
 #include "multi_pass_kernels.cuh"
 
+#include <thrust/pair.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace groupby {
 namespace detail {
@@ -115,6 +119,140 @@ struct compute_single_pass_aggs_fn {
   }
 };
 
+/**
+ * @brief Computes single-pass aggregations of the rows of every block into a sparse
+ * `block_values` table, finding the groups of the rows in a hash table in shared memory.
+ *
+ * Every block aggregates a contiguous range of `rows_per_block` rows. The first row of every
+ * group of the range to be inserted into the shared memory hash table is the representative of
+ * the group, and the rows of the group are aggregated into its row of `block_values`. This way
+ * the atomic updates of a group are private to a block, and the global hash map is not used at
+ * all. The representatives are written to `representatives`, to be merged into the global
+ * results by `merge_block_aggs_fn`.
+ *
+ * If the hash table of a block is full, a row of a new group is its own representative.
+ *
+ * @tparam table_size The number of slots of the shared memory hash table
+ *
+ * @param num_rows The number of rows in input keys table
+ * @param rows_per_block The number of rows aggregated by every block
+ * @param hasher Row hasher for the input keys
+ * @param key_equal Equality comparator of the rows of the input keys
+ * @param input_values The table whose rows will be aggregated
+ * @param block_values Table that stores the results of aggregating the rows of every group of
+ * every block at the index of its representative
+ * @param aggs The set of aggregation operations to perform across the columns of the
+ * `input_values` rows
+ * @param row_bitmask Bitmask where bit `i` indicates the presence of a null value in row `i` of
+ * input keys. Only used if `skip_rows_with_nulls` is `true`
+ * @param skip_rows_with_nulls Indicates if rows in input keys containing null values should be
+ * skipped
+ * @param representatives The representatives of the groups of all blocks
+ * @param num_representatives The number of representatives
+ */
+template <size_type table_size, typename Hasher, typename KeyEqual>
+__global__ void compute_block_aggs(size_type num_rows,
+                                   size_type rows_per_block,
+                                   Hasher hasher,
+                                   KeyEqual key_equal,
+                                   table_device_view input_values,
+                                   mutable_table_device_view block_values,
+                                   aggregation::Kind const* __restrict__ aggs,
+                                   bitmask_type const* __restrict__ row_bitmask,
+                                   bool skip_rows_with_nulls,
+                                   size_type* __restrict__ representatives,
+                                   size_type* num_representatives)
+{
+  size_type constexpr empty_slot{-1};
+  __shared__ size_type slots[table_size];
+  for (size_type i = threadIdx.x; i < table_size; i += blockDim.x) { slots[i] = empty_slot; }
+  __syncthreads();
+
+  auto const begin = static_cast<int64_t>(blockIdx.x) * rows_per_block;
+  auto const end   = std::min(static_cast<int64_t>(num_rows), begin + rows_per_block);
+  for (auto i = static_cast<size_type>(begin + threadIdx.x); i < end; i += blockDim.x) {
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) { continue; }
+
+    auto representative = i;
+    auto slot           = hasher(i) % table_size;
+    for (size_type probe = 0; probe < table_size; ++probe) {
+      auto const old = atomicCAS(&slots[slot], empty_slot, i);
+      if (old == empty_slot) { break; }
+      if (key_equal(old, i)) {
+        representative = old;
+        break;
+      }
+      slot = (slot + 1) % table_size;
+    }
+    if (representative == i) { representatives[atomicAdd(num_representatives, 1)] = i; }
+
+    cudf::detail::aggregate_row<true, true>(block_values, representative, input_values, i, aggs);
+  }
+}
+
+/**
+ * @brief Merges the results of `compute_block_aggs` into a sparse `output_values` table, and
+ * populates `map` with indices of unique keys
+ *
+ * Every representative is inserted into `map`, and its results are aggregated into the row of
+ * its key. Counts are merged by adding them, sums of squares by summing them, and the indices of
+ * ARGMIN and ARGMAX are merged by aggregating the input rows they refer to again.
+ *
+ * @tparam Map The type of the hash map
+ */
+template <typename Map>
+struct merge_block_aggs_fn {
+  Map map;
+  size_type const* __restrict__ representatives;
+  table_device_view input_values;
+  table_device_view block_values;
+  mutable_table_device_view output_values;
+  aggregation::Kind const* __restrict__ aggs;
+
+  __device__ void operator()(size_type i)
+  {
+    auto const representative = representatives[i];
+    auto const target_index =
+      map.insert(thrust::make_pair(representative, representative)).first->second;
+
+    for (auto j = 0; j < output_values.num_columns(); ++j) {
+      auto const& block_column = block_values.column(j);
+      auto target_column       = output_values.column(j);
+      switch (aggs[j]) {
+        case aggregation::COUNT_VALID:
+        case aggregation::COUNT_ALL:
+          atomicAdd(&target_column.element<size_type>(target_index),
+                    block_column.element<size_type>(representative));
+          break;
+        case aggregation::ARGMIN:
+        case aggregation::ARGMAX: {
+          auto const source_index = block_column.element<size_type>(representative);
+          // The sentinel of ARGMIN and ARGMAX is the same
+          if (source_index == cudf::detail::ARGMIN_SENTINEL) { break; }
+          cudf::detail::dispatch_type_and_aggregation(
+            input_values.column(j).type(),
+            aggs[j],
+            cudf::detail::elementwise_aggregator<true, true>{},
+            target_column,
+            target_index,
+            input_values.column(j),
+            source_index);
+          break;
+        }
+        default:
+          cudf::detail::dispatch_type_and_aggregation(
+            block_column.type(),
+            aggs[j] == aggregation::SUM_OF_SQUARES ? aggregation::SUM : aggs[j],
+            cudf::detail::elementwise_aggregator<true, true>{},
+            target_column,
+            target_index,
+            block_column,
+            representative);
+      }
+    }
+  }
+};
+
 }  // namespace hash
 }  // namespace detail
 }  // namespace groupby
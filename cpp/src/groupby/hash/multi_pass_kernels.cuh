@@ -23,6 +23,7 @@
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/device_atomics.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 namespace cudf {
@@ -108,5 +109,48 @@ struct var_hash_functor {
   }
 };
 
+/**
+ * @brief Looks up the index of the sparse result of the group of every row in `map`.
+ *
+ * Rows whose bit is not set in `row_bitmask` are not in the map and get the index -1.
+ */
+template <typename Map>
+struct group_index_hash_functor {
+  Map const map;
+  bitmask_type const* __restrict__ row_bitmask;
+
+  __device__ size_type operator()(size_type source_index) const
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, source_index)) return -1;
+    return map.find(source_index)->second;
+  }
+};
+
+/**
+ * @brief Counts the distinct values of every group.
+ *
+ * `set` is keyed on rows of the pair of the group index and the value, so only the first row of
+ * every distinct pair is inserted, and increments the count of its group.
+ */
+template <typename Set>
+struct nunique_hash_functor {
+  Set set;
+  bitmask_type const* __restrict__ row_bitmask;
+  mutable_column_device_view target;
+  column_device_view source;
+  size_type const* __restrict__ group_indices;
+  bool skip_null_values;
+
+  __device__ void operator()(size_type source_index)
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, source_index)) return;
+    if (skip_null_values and source.is_null(source_index)) return;
+
+    if (set.insert(thrust::make_pair(source_index, source_index)).second) {
+      atomicAdd(&target.element<size_type>(group_indices[source_index]), size_type{1});
+    }
+  }
+};
+
 }  // namespace detail
 }  // namespace cudf
@@ -26,6 +26,8 @@
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/lists/detail/drop_list_duplicates.hpp>
@@ -275,6 +277,37 @@ void aggregrate_result_functor::operator()<aggregation::STD>(aggregation const&
   cache.add_result(col_idx, agg, std::move(result));
 };
 
+template <>
+void aggregrate_result_functor::operator()<aggregation::M2>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto mean_agg  = make_mean_aggregation();
+  auto count_agg = make_count_aggregation();
+  operator()<aggregation::MEAN>(*mean_agg);
+  operator()<aggregation::COUNT_VALID>(*count_agg);
+  column_view mean_result = cache.get_result(col_idx, *mean_agg);
+  column_view group_sizes = cache.get_result(col_idx, *count_agg);
+
+  cache.add_result(
+    col_idx,
+    agg,
+    detail::group_m2(
+      get_grouped_values(), mean_result, group_sizes, helper.group_labels(stream), stream, mr));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::MERGE_M2>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  cache.add_result(
+    col_idx,
+    agg,
+    detail::group_merge_m2(
+      get_grouped_values(), helper.group_labels(stream), helper.num_groups(stream), stream, mr));
+};
+
 template <>
 void aggregrate_result_functor::operator()<aggregation::QUANTILE>(aggregation const& agg)
 {
@@ -333,6 +366,87 @@ void aggregrate_result_functor::operator()<aggregation::NUNIQUE>(aggregation con
   cache.add_result(col_idx, agg, std::move(result));
 };
 
+template <>
+void aggregrate_result_functor::operator()<aggregation::APPROX_NUNIQUE>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto approx_nunique_agg = static_cast<cudf::detail::approx_nunique_aggregation const&>(agg);
+
+  // The values only need to be grouped, not sorted, since the group labels index the sketches
+  auto result = cudf::detail::approx_distinct_count(get_grouped_values(),
+                                                    helper.group_labels(stream),
+                                                    helper.num_groups(stream),
+                                                    approx_nunique_agg._null_handling,
+                                                    approx_nunique_agg._precision,
+                                                    stream,
+                                                    mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::NUNIQUE_SKETCH>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto sketch_agg = static_cast<cudf::detail::approx_nunique_aggregation const&>(agg);
+
+  auto result = cudf::detail::approx_distinct_count_sketch(get_grouped_values(),
+                                                           helper.group_labels(stream),
+                                                           helper.num_groups(stream),
+                                                           sketch_agg._null_handling,
+                                                           sketch_agg._precision,
+                                                           stream,
+                                                           mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::MERGE_NUNIQUE>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto result = cudf::detail::merge_approx_distinct_count(get_grouped_values(),
+                                                          helper.group_labels(stream),
+                                                          helper.num_groups(stream),
+                                                          stream,
+                                                          mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::TDIGEST>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto tdigest_agg = static_cast<cudf::detail::tdigest_aggregation const&>(agg);
+
+  auto result = cudf::detail::group_tdigest(get_sorted_values(),
+                                            helper.group_labels(stream),
+                                            helper.num_groups(stream),
+                                            tdigest_agg._max_centroids,
+                                            stream,
+                                            mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto tdigest_agg = static_cast<cudf::detail::tdigest_aggregation const&>(agg);
+
+  // The centroids of the digests of a group are sorted when they are merged
+  auto result = cudf::detail::group_merge_tdigest(get_grouped_values(),
+                                                  helper.group_labels(stream),
+                                                  helper.num_groups(stream),
+                                                  tdigest_agg._max_centroids,
+                                                  stream,
+                                                  mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
 template <>
 void aggregrate_result_functor::operator()<aggregation::NTH_ELEMENT>(aggregation const& agg)
 {
@@ -378,6 +492,24 @@ void aggregrate_result_functor::operator()<aggregation::COLLECT_LIST>(aggregatio
   cache.add_result(col_idx, agg, std::move(result));
 };
 
+template <>
+void aggregrate_result_functor::operator()<aggregation::TOP_K>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto top_k_agg = static_cast<cudf::detail::top_k_aggregation const&>(agg);
+
+  auto result = detail::group_top_k(get_grouped_values(),
+                                    helper.group_labels(stream),
+                                    helper.group_offsets(stream),
+                                    helper.num_groups(stream),
+                                    top_k_agg._k,
+                                    top_k_agg._order,
+                                    stream,
+                                    mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
 template <>
 void aggregrate_result_functor::operator()<aggregation::COLLECT_SET>(aggregation const& agg)
 {
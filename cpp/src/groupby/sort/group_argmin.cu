@@ -18,6 +18,7 @@
 
 #include <cudf/detail/gather.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -39,7 +40,7 @@ std::unique_ptr<column> group_argmin(column_view const& values,
                                  num_groups,
                                  group_labels,
                                  stream,
-                                 rmm::mr::get_current_device_resource());
+                                 cudf::get_current_temp_resource());
 
   // The functor returns the index of minimum in the sorted values.
   // We need the index of minimum in the original unsorted values.
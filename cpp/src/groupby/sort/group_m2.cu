@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_reductions.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/iterator.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/tuple.h>
+
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+template <typename ResultType, typename Iterator>
+struct m2_transform {
+  column_device_view const d_values;
+  Iterator values_iter;
+  ResultType const* d_means;
+  size_type const* d_group_labels;
+
+  __device__ ResultType operator()(size_type i)
+  {
+    if (d_values.is_null(i)) return 0.0;
+
+    auto const x     = static_cast<ResultType>(values_iter[i]);
+    auto const delta = x - d_means[d_group_labels[i]];
+    return delta * delta;
+  }
+};
+
+struct m2_functor {
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    column_view const& values,
+    column_view const& group_means,
+    column_view const& group_sizes,
+    cudf::device_span<size_type const> group_labels,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    using ResultType = cudf::detail::target_type_t<T, aggregation::Kind::M2>;
+
+    auto result = make_numeric_column(
+      data_type(type_to_id<ResultType>()), group_sizes.size(), mask_state::UNALLOCATED, stream, mr);
+
+    auto values_view = column_device_view::create(values, stream);
+    auto d_values    = *values_view;
+    auto d_means     = group_means.data<ResultType>();
+    auto d_result    = result->mutable_view().data<ResultType>();
+
+    auto reduce = [&](auto values_iter) {
+      auto m2_iter = thrust::make_transform_iterator(
+        thrust::make_counting_iterator(0),
+        m2_transform<ResultType, decltype(values_iter)>{
+          d_values, values_iter, d_means, group_labels.data()});
+      thrust::reduce_by_key(rmm::exec_policy(stream),
+                            group_labels.begin(),
+                            group_labels.end(),
+                            m2_iter,
+                            thrust::make_discard_iterator(),
+                            d_result);
+    };
+    if (!cudf::is_dictionary(values.type())) {
+      reduce(d_values.begin<T>());
+    } else {
+      reduce(cudf::dictionary::detail::make_dictionary_iterator<T>(*values_view));
+    }
+
+    // The M2 of a group without valid values is null
+    auto d_group_sizes = group_sizes.data<size_type>();
+    auto valid_mask    = cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(group_sizes.size()),
+      [d_group_sizes] __device__(size_type i) { return d_group_sizes[i] > 0; },
+      stream,
+      mr);
+    result->set_null_mask(std::move(valid_mask.first), valid_mask.second);
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    Args&&... args)
+  {
+    CUDF_FAIL("Only numeric types are supported in M2");
+  }
+};
+
+using m2_partial = thrust::tuple<size_type, double, double>;
+
+/**
+ * @brief Reads the partial result of a row of a MERGE_M2 input, a null row being empty.
+ */
+struct m2_partial_transform {
+  column_device_view const d_values;
+  size_type const* d_counts;
+  double const* d_means;
+  double const* d_m2s;
+
+  __device__ m2_partial operator()(size_type i) const
+  {
+    if (d_values.is_null(i) or d_counts[i] == 0) { return m2_partial{0, 0.0, 0.0}; }
+    return m2_partial{d_counts[i], d_means[i], d_m2s[i]};
+  }
+};
+
+/**
+ * @brief Merges two partial results with the pairwise update of Chan et al.
+ */
+struct merge_m2_partials {
+  __device__ m2_partial operator()(m2_partial const& lhs, m2_partial const& rhs) const
+  {
+    auto const lhs_count = thrust::get<0>(lhs);
+    auto const rhs_count = thrust::get<0>(rhs);
+    if (lhs_count == 0) { return rhs; }
+    if (rhs_count == 0) { return lhs; }
+
+    auto const count = lhs_count + rhs_count;
+    auto const delta = thrust::get<1>(rhs) - thrust::get<1>(lhs);
+    auto const rhs_w = static_cast<double>(rhs_count) / count;
+    return m2_partial{count,
+                      thrust::get<1>(lhs) + delta * rhs_w,
+                      thrust::get<2>(lhs) + thrust::get<2>(rhs) +
+                        delta * delta * static_cast<double>(lhs_count) * rhs_w};
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> group_m2(column_view const& values,
+                                 column_view const& group_means,
+                                 column_view const& group_sizes,
+                                 cudf::device_span<size_type const> group_labels,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  auto values_type = cudf::is_dictionary(values.type())
+                       ? dictionary_column_view(values).keys().type()
+                       : values.type();
+
+  return type_dispatcher(
+    values_type, m2_functor{}, values, group_means, group_sizes, group_labels, stream, mr);
+}
+
+std::unique_ptr<column> group_merge_m2(column_view const& values,
+                                       cudf::device_span<size_type const> group_labels,
+                                       size_type num_groups,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(values.type().id() == type_id::STRUCT && values.num_children() == 3,
+               "MERGE_M2 requires a structs column of counts, means and M2 values");
+  auto const partials = structs_column_view(values);
+  auto const counts   = partials.get_sliced_child(0);
+  auto const means    = partials.get_sliced_child(1);
+  auto const m2s      = partials.get_sliced_child(2);
+  CUDF_EXPECTS(counts.type().id() == type_to_id<size_type>() &&
+                 means.type().id() == type_id::FLOAT64 && m2s.type().id() == type_id::FLOAT64,
+               "MERGE_M2 requires INT32 counts and FLOAT64 means and M2 values");
+  CUDF_EXPECTS(!counts.has_nulls(), "The counts of MERGE_M2 partial results must not be null");
+
+  auto result_counts = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto result_means = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto result_m2s = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+
+  auto values_view  = column_device_view::create(values, stream);
+  auto partial_iter = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0),
+    m2_partial_transform{*values_view,
+                         counts.data<size_type>(),
+                         means.data<double>(),
+                         m2s.data<double>()});
+  auto d_counts = result_counts->mutable_view().data<size_type>();
+  thrust::reduce_by_key(rmm::exec_policy(stream),
+                        group_labels.begin(),
+                        group_labels.end(),
+                        partial_iter,
+                        thrust::make_discard_iterator(),
+                        thrust::make_zip_iterator(
+                          thrust::make_tuple(d_counts,
+                                             result_means->mutable_view().data<double>(),
+                                             result_m2s->mutable_view().data<double>())),
+                        thrust::equal_to<size_type>{},
+                        merge_m2_partials{});
+
+  // The mean and M2 of a group without valid values are null
+  auto const is_valid = [d_counts] __device__(size_type i) { return d_counts[i] > 0; };
+  for (auto* child : {result_means.get(), result_m2s.get()}) {
+    auto valid_mask = cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                             thrust::make_counting_iterator<size_type>(num_groups),
+                                             is_valid,
+                                             stream,
+                                             mr);
+    child->set_null_mask(std::move(valid_mask.first), valid_mask.second);
+  }
+
+  std::vector<std::unique_ptr<column>> children;
+  children.push_back(std::move(result_counts));
+  children.push_back(std::move(result_means));
+  children.push_back(std::move(result_m2s));
+  return make_structs_column(
+    num_groups, std::move(children), 0, rmm::device_buffer{0, stream, mr}, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
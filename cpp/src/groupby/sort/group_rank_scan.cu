@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_scan.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+/**
+ * @brief Functor returning the value scanned for the rank of a row: 0 for a row equal to the
+ * previous row of its group, else the rank of the row, or 1 for a dense rank.
+ */
+template <bool has_nulls>
+struct rank_value_fn {
+  row_equality_comparator<has_nulls> comparator;
+  size_type const* group_labels;
+  size_type const* group_offsets;
+  bool dense;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    auto const group_start = group_offsets[group_labels[row]];
+    auto const is_distinct = row == group_start or not comparator(row, row - 1);
+    if (not is_distinct) { return 0; }
+    return dense ? 1 : row - group_start + 1;
+  }
+};
+
+/**
+ * @brief Writes the rank of every row of the sorted groups of `order_by` with a single scan
+ * segmented by group.
+ *
+ * The rank of a row distinct from the previous one is its position in its group, and equal rows
+ * keep it as the maximum of the scan. A dense rank counts the distinct rows with a sum instead.
+ */
+template <bool has_nulls>
+void rank_scan_impl(table_device_view const& order_by,
+                    device_span<size_type const> group_labels,
+                    device_span<size_type const> group_offsets,
+                    bool dense,
+                    mutable_column_view ranks,
+                    rmm::cuda_stream_view stream)
+{
+  auto const values = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    rank_value_fn<has_nulls>{row_equality_comparator<has_nulls>{order_by, order_by, true},
+                             group_labels.data(),
+                             group_offsets.data(),
+                             dense});
+  if (dense) {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  group_labels.begin(),
+                                  group_labels.end(),
+                                  values,
+                                  ranks.begin<size_type>(),
+                                  thrust::equal_to<size_type>{},
+                                  thrust::plus<size_type>{});
+  } else {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  group_labels.begin(),
+                                  group_labels.end(),
+                                  values,
+                                  ranks.begin<size_type>(),
+                                  thrust::equal_to<size_type>{},
+                                  thrust::maximum<size_type>{});
+  }
+}
+
+std::unique_ptr<column> rank_generator(column_view const& order_by,
+                                       device_span<size_type const> group_labels,
+                                       device_span<size_type const> group_offsets,
+                                       bool dense,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(not is_dictionary(order_by.type()), "Ranks of dictionary values are not supported");
+
+  auto ranks = make_fixed_width_column(
+    data_type{type_to_id<size_type>()}, order_by.size(), mask_state::UNALLOCATED, stream, mr);
+  if (order_by.is_empty()) { return ranks; }
+
+  auto const d_order_by = table_device_view::create(table_view{{order_by}}, stream);
+  if (order_by.has_nulls()) {
+    rank_scan_impl<true>(
+      *d_order_by, group_labels, group_offsets, dense, ranks->mutable_view(), stream);
+  } else {
+    rank_scan_impl<false>(
+      *d_order_by, group_labels, group_offsets, dense, ranks->mutable_view(), stream);
+  }
+  return ranks;
+}
+
+}  // namespace
+
+std::unique_ptr<column> rank_scan(column_view const& order_by,
+                                  device_span<size_type const> group_labels,
+                                  device_span<size_type const> group_offsets,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  return rank_generator(order_by, group_labels, group_offsets, false, stream, mr);
+}
+
+std::unique_ptr<column> dense_rank_scan(column_view const& order_by,
+                                        device_span<size_type const> group_labels,
+                                        device_span<size_type const> group_offsets,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  return rank_generator(order_by, group_labels, group_offsets, true, stream, mr);
+}
+
+std::unique_ptr<column> percent_rank_scan(column_view const& order_by,
+                                          device_span<size_type const> group_labels,
+                                          device_span<size_type const> group_offsets,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const ranks = rank_generator(
+    order_by, group_labels, group_offsets, false, stream, rmm::mr::get_current_device_resource());
+
+  auto percent_ranks = make_fixed_width_column(
+    data_type{type_id::FLOAT64}, order_by.size(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(order_by.size()),
+    percent_ranks->mutable_view().begin<double>(),
+    [ranks         = ranks->view().begin<size_type>(),
+     group_labels  = group_labels.data(),
+     group_offsets = group_offsets.data()] __device__(size_type row) {
+      auto const group      = group_labels[row];
+      auto const group_size = group_offsets[group + 1] - group_offsets[group];
+      return group_size == 1 ? 0.0 : (ranks[row] - 1) / static_cast<double>(group_size - 1);
+    });
+  return percent_ranks;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -247,6 +247,60 @@ std::unique_ptr<column> group_var(column_view const& values,
                                   rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Internal API to calculate groupwise sum of squared differences from the mean (M2)
+ *
+ * @code{.pseudo}
+ * values       = [2, 1, 4, -1, -2, <NA>, 4, <NA>]
+ * group_labels = [0, 0, 0,  1,  1,    2, 2,    3]
+ * group_means  = [2.333333, -1.5, 4.0, <NA>]
+ * group_sizes  = [3, 2, 1, 0]
+ *
+ * group_m2     = [4.666666, 0.5, 0.0, <NA>]
+ * @endcode
+ *
+ * @param values Grouped values to get M2 of
+ * @param group_means Pre-calculated groupwise MEAN
+ * @param group_sizes Number of valid elements per group
+ * @param group_labels ID of group corresponding value in @p values belongs to
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_m2(column_view const& values,
+                                 column_view const& group_means,
+                                 column_view const& group_sizes,
+                                 cudf::device_span<size_type const> group_labels,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to merge groupwise partial results of M2
+ *
+ * Every row of @p values is a struct of the count, mean and M2 of a subset of the values of a
+ * group, as computed by the COUNT_VALID, MEAN and M2 aggregations. The partial results of every
+ * group are merged into those of all its values with the pairwise update of Chan et al., from
+ * which the variance of the group is `M2 / (count - ddof)`.
+ *
+ * @code{.pseudo}
+ * values       = [{2, 1.5, 0.5}, {1, 4.0, 0.0}, {2, -1.5, 0.5}, {0, <NA>, <NA>}]
+ * group_labels = [0, 0, 1, 2]
+ * num_groups   = 3
+ *
+ * group_merge_m2 = [{3, 2.333333, 4.666666}, {2, -1.5, 0.5}, {0, <NA>, <NA>}]
+ * @endcode
+ *
+ * @param values Grouped structs column of INT32 counts, FLOAT64 means and FLOAT64 M2 values
+ * @param group_labels ID of group corresponding value in @p values belongs to
+ * @param num_groups Number of groups
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_merge_m2(column_view const& values,
+                                       cudf::device_span<size_type const> group_labels,
+                                       size_type num_groups,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr);
+
 /**
  * @brief Internal API to calculate groupwise quantiles
  *
@@ -366,6 +420,39 @@ std::unique_ptr<column> group_collect(column_view const& values,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Internal API to collect the `k` largest or smallest valid values of every group into a
+ * lists column, without sorting all the values of the groups
+ *
+ * @code{.pseudo}
+ * values        = [2, 1, 4, -1, -2, <NA>, 4, <NA>]
+ * group_labels  = [0, 0, 0,  1,  1,    2, 2,    3]
+ * group_offsets = [0,        3,        5,       7, 8]
+ * num_groups    = 4
+ *
+ * group_top_k(k=2, order::DESCENDING) = [[4, 2], [-1, -2], [4], []]
+ * group_top_k(k=2, order::ASCENDING)  = [[1, 2], [-2, -1], [4], []]
+ * @endcode
+ *
+ * @param values Grouped values to select from
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of groups' starting points within @p values
+ * @param num_groups Number of groups
+ * @param k Number of values to select from every group
+ * @param column_order `order::DESCENDING` for the largest values, `order::ASCENDING` for the
+ * smallest, in that order within every list
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_top_k(column_view const& values,
+                                    cudf::device_span<size_type const> group_labels,
+                                    cudf::device_span<size_type const> group_offsets,
+                                    size_type num_groups,
+                                    size_type k,
+                                    order column_order,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr);
+
 /** @endinternal
  *
  */
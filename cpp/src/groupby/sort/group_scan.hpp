@@ -83,6 +83,56 @@ std::unique_ptr<column> max_scan(column_view const& values,
 std::unique_ptr<column> count_scan(cudf::device_span<size_type const> group_labels,
                                    rmm::cuda_stream_view stream,
                                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to calculate the rank of every value within its group, with gaps after
+ * ties
+ *
+ * @param order_by Grouped values to rank, which are sorted within every group
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of the groups in `order_by`
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Column of type INT32 of the 1-based ranks
+ */
+std::unique_ptr<column> rank_scan(column_view const& order_by,
+                                  device_span<size_type const> group_labels,
+                                  device_span<size_type const> group_offsets,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to calculate the rank of every value within its group, without gaps after
+ * ties
+ *
+ * @param order_by Grouped values to rank, which are sorted within every group
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of the groups in `order_by`
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Column of type INT32 of the 1-based dense ranks
+ */
+std::unique_ptr<column> dense_rank_scan(column_view const& order_by,
+                                        device_span<size_type const> group_labels,
+                                        device_span<size_type const> group_offsets,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to calculate the relative rank of every value within its group
+ *
+ * @param order_by Grouped values to rank, which are sorted within every group
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of the groups in `order_by`
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Column of type FLOAT64 of `(rank - 1) / (group_size - 1)`, or 0 for single rows
+ */
+std::unique_ptr<column> percent_rank_scan(column_view const& order_by,
+                                          device_span<size_type const> group_labels,
+                                          device_span<size_type const> group_offsets,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr);
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
@@ -30,11 +30,53 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/reduce.h>
 
 namespace cudf {
 namespace groupby {
 namespace detail {
+/**
+ * @brief Reduces each group of the grouped `values` into `result` with `thrust::reduce_by_key`.
+ *
+ * Used for the `fixed_point` types whose storage is too wide for the device atomics that
+ * `update_target_element` relies on. `group_labels` is sorted, so every group is one run of it.
+ */
+template <typename DeviceType, typename OpType>
+void reduce_sorted_groups(column_view const& values,
+                          cudf::device_span<size_type const> group_labels,
+                          mutable_column_view& result,
+                          rmm::cuda_stream_view stream)
+{
+  auto valuesview = column_device_view::create(values, stream);
+  auto resultview = mutable_column_device_view::create(result, stream);
+
+  auto const identity = OpType::template identity<DeviceType>();
+  auto values_it =
+    cudf::detail::make_null_replacement_iterator(*valuesview, identity, values.has_nulls());
+  thrust::reduce_by_key(rmm::exec_policy(stream),
+                        group_labels.begin(),
+                        group_labels.end(),
+                        values_it,
+                        thrust::make_discard_iterator(),
+                        result.begin<DeviceType>(),
+                        thrust::equal_to<size_type>{},
+                        OpType{});
+
+  // a group is valid as soon as one of its values is
+  if (values.has_nulls()) {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       values.size(),
+                       [d_values     = *valuesview,
+                        d_result     = *resultview,
+                        dest_indices = group_labels.data()] __device__(auto i) {
+                         if (d_values.is_valid(i)) { d_result.set_valid(dest_indices[i]); }
+                       });
+  }
+}
+
 template <aggregation::Kind K>
 struct reduce_functor {
   template <typename T>
@@ -54,12 +96,19 @@ struct reduce_functor {
   }
 
   template <typename T>
-  std::enable_if_t<is_supported<T>(), std::unique_ptr<column>> operator()(
-    column_view const& values,
-    size_type num_groups,
-    cudf::device_span<size_type const> group_labels,
-    rmm::cuda_stream_view stream,
-    rmm::mr::device_memory_resource* mr)
+  static constexpr bool is_segmented_reduction()
+  {
+    return is_fixed_point<T>() and not cudf::detail::is_atomic_fixed_point<T>() and
+           (K == aggregation::SUM or K == aggregation::MIN or K == aggregation::MAX);
+  }
+
+  template <typename T>
+  std::enable_if_t<is_supported<T>() and not is_segmented_reduction<T>(), std::unique_ptr<column>>
+  operator()(column_view const& values,
+             size_type num_groups,
+             cudf::device_span<size_type const> group_labels,
+             rmm::cuda_stream_view stream,
+             rmm::mr::device_memory_resource* mr)
   {
     using DeviceType = device_storage_type_t<T>;
     using OpType     = cudf::detail::corresponding_operator_t<K>;
@@ -109,6 +158,35 @@ struct reduce_functor {
     return result;
   }
 
+  template <typename T>
+  std::enable_if_t<is_segmented_reduction<T>(), std::unique_ptr<column>> operator()(
+    column_view const& values,
+    size_type num_groups,
+    cudf::device_span<size_type const> group_labels,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    using DeviceType = device_storage_type_t<T>;
+    using OpType     = cudf::detail::corresponding_operator_t<K>;
+    using ResultType = cudf::detail::target_type_t<T, K>;
+
+    CUDF_EXPECTS(not cudf::is_dictionary(values.type()),
+                 "Unsupported dictionary keys for this aggregation");
+
+    auto result =
+      make_fixed_width_column(data_type{type_to_id<ResultType>(), values.type().scale()},
+                              num_groups,
+                              values.has_nulls() ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
+                              stream,
+                              mr);
+
+    if (values.is_empty()) { return result; }
+
+    auto result_view = result->mutable_view();
+    reduce_sorted_groups<DeviceType, OpType>(values, group_labels, result_view, stream);
+    return result;
+  }
+
   template <typename T, typename... Args>
   std::enable_if_t<not is_supported<T>(), std::unique_ptr<column>> operator()(Args&&... args)
   {
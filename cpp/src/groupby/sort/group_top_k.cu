@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_reductions.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/swap.h>
+#include <thrust/transform_scan.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+/// Minimum number of rows of the chunks of a group whose candidates are selected by a thread
+constexpr size_type min_chunk_size = 1024;
+
+/**
+ * @brief Returns whether a value ranks before another one, the lower row breaking ties.
+ */
+template <typename T>
+struct ranks_before {
+  element_relational_comparator<false> comparator;
+  bool descending;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    auto const ordering = comparator.template operator()<T>(lhs, rhs);
+    if (ordering == weak_ordering::EQUIVALENT) { return lhs < rhs; }
+    return (ordering == weak_ordering::GREATER) == descending;
+  }
+};
+
+/**
+ * @brief Returns the range of rows of a chunk of a group.
+ */
+struct chunk_rows_fn {
+  size_type const* group_offsets;
+  size_type const* chunk_offsets;
+  size_type num_groups;
+  size_type chunk_size;
+
+  __device__ thrust::pair<size_type, size_type> operator()(size_type chunk) const
+  {
+    auto const it =
+      thrust::upper_bound(thrust::seq, chunk_offsets, chunk_offsets + num_groups + 1, chunk);
+    auto const group = static_cast<size_type>(thrust::distance(chunk_offsets, it)) - 1;
+    auto const begin = group_offsets[group] + (chunk - chunk_offsets[group]) * chunk_size;
+    return {begin, min(begin + chunk_size, group_offsets[group + 1])};
+  }
+};
+
+/**
+ * @brief Selects the `k` best valid rows of every chunk with a bounded heap.
+ *
+ * The heap of a chunk holds at most as many rows as the chunk, its root being the worst of them,
+ * so that every row is either discarded or replaces the root in `O(log k)`. Unused slots of a
+ * heap are left negative.
+ */
+template <typename T>
+struct select_candidates_fn {
+  column_device_view d_values;
+  ranks_before<T> before;
+  chunk_rows_fn chunk_rows;
+  size_type const* slot_offsets;
+  size_type* candidates;
+
+  __device__ void operator()(size_type chunk) const
+  {
+    auto const rows     = chunk_rows(chunk);
+    auto const capacity = slot_offsets[chunk + 1] - slot_offsets[chunk];
+    auto heap           = candidates + slot_offsets[chunk];
+
+    size_type count = 0;
+    for (auto row = rows.first; row < rows.second; ++row) {
+      if (d_values.is_null(row)) { continue; }
+      if (count < capacity) {
+        // Sift the new row up while its parent is better
+        auto i  = count++;
+        heap[i] = row;
+        while (i > 0 and before(heap[(i - 1) / 2], heap[i])) {
+          thrust::swap(heap[(i - 1) / 2], heap[i]);
+          i = (i - 1) / 2;
+        }
+      } else if (before(row, heap[0])) {
+        // Sift the new root down while one of its children is worse
+        heap[0] = row;
+        size_type i{0};
+        while (true) {
+          auto worst = i;
+          for (auto child = 2 * i + 1; child <= 2 * i + 2 and child < count; ++child) {
+            if (before(heap[worst], heap[child])) { worst = child; }
+          }
+          if (worst == i) { break; }
+          thrust::swap(heap[worst], heap[i]);
+          i = worst;
+        }
+      }
+    }
+  }
+};
+
+struct top_k_functor {
+  template <typename T>
+  std::enable_if_t<cudf::is_relationally_comparable<T, T>(), std::unique_ptr<column>> operator()(
+    column_view const& values,
+    cudf::device_span<size_type const> group_labels,
+    cudf::device_span<size_type const> group_offsets,
+    size_type num_groups,
+    size_type k,
+    order column_order,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    auto values_view      = column_device_view::create(values, stream);
+    auto const comparator = element_relational_comparator<false>{
+      *values_view, *values_view, null_order::AFTER};
+    auto const before     = ranks_before<T>{comparator, column_order == order::DESCENDING};
+
+    // Chunks much larger than k make the candidates a small fraction of the rows
+    auto const chunk_size = static_cast<size_type>(
+      std::min<int64_t>(std::max<int64_t>(min_chunk_size, int64_t{16} * k),
+                        std::numeric_limits<size_type>::max() / 2));
+    rmm::device_uvector<size_type> chunk_offsets(num_groups + 1, stream);
+    thrust::transform_exclusive_scan(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_groups + 1),
+      chunk_offsets.begin(),
+      [num_groups, chunk_size, d_offsets = group_offsets.data()] __device__(size_type group) {
+        if (group == num_groups) { return size_type{0}; }
+        return (d_offsets[group + 1] - d_offsets[group] + chunk_size - 1) / chunk_size;
+      },
+      size_type{0},
+      thrust::plus<size_type>{});
+    auto const num_chunks = chunk_offsets.back_element(stream);
+
+    // Every chunk keeps at most k of its rows
+    auto const chunk_rows =
+      chunk_rows_fn{group_offsets.data(), chunk_offsets.data(), num_groups, chunk_size};
+    rmm::device_uvector<size_type> slot_offsets(num_chunks + 1, stream);
+    thrust::transform_exclusive_scan(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_chunks + 1),
+      slot_offsets.begin(),
+      [chunk_rows, num_chunks, k] __device__(size_type chunk) {
+        if (chunk == num_chunks) { return size_type{0}; }
+        auto const rows = chunk_rows(chunk);
+        return min(k, rows.second - rows.first);
+      },
+      size_type{0},
+      thrust::plus<size_type>{});
+
+    rmm::device_uvector<size_type> candidates(slot_offsets.back_element(stream), stream);
+    thrust::fill(rmm::exec_policy(stream), candidates.begin(), candidates.end(), -1);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      num_chunks,
+      select_candidates_fn<T>{
+        *values_view, before, chunk_rows, slot_offsets.data(), candidates.data()});
+    auto const candidates_end = thrust::remove(
+      rmm::exec_policy(stream), candidates.begin(), candidates.end(), size_type{-1});
+    candidates.resize(thrust::distance(candidates.begin(), candidates_end), stream);
+
+    // Only the candidates of every group are sorted
+    auto d_labels = group_labels.data();
+    thrust::sort(rmm::exec_policy(stream),
+                 candidates.begin(),
+                 candidates.end(),
+                 [d_labels, before] __device__(size_type lhs, size_type rhs) {
+                   if (d_labels[lhs] != d_labels[rhs]) { return d_labels[lhs] < d_labels[rhs]; }
+                   return before(lhs, rhs);
+                 });
+
+    rmm::device_uvector<size_type> candidate_offsets(num_groups + 1, stream);
+    auto const candidate_labels = thrust::make_permutation_iterator(d_labels, candidates.begin());
+    thrust::lower_bound(rmm::exec_policy(stream),
+                        candidate_labels,
+                        candidate_labels + candidates.size(),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_groups + 1),
+                        candidate_offsets.begin());
+
+    // Keep the first k candidates of every group
+    rmm::device_uvector<size_type> selected(candidates.size(), stream);
+    auto const selected_end = thrust::copy_if(
+      rmm::exec_policy(stream),
+      candidates.begin(),
+      candidates.end(),
+      thrust::make_counting_iterator<size_type>(0),
+      selected.begin(),
+      [d_labels,
+       k,
+       d_candidates = candidates.data(),
+       d_offsets    = candidate_offsets.data()] __device__(size_type i) {
+        return i - d_offsets[d_labels[d_candidates[i]]] < k;
+      });
+    selected.resize(thrust::distance(selected.begin(), selected_end), stream);
+
+    auto offsets = make_numeric_column(
+      data_type{type_to_id<offset_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform_exclusive_scan(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_groups + 1),
+      offsets->mutable_view().begin<offset_type>(),
+      [num_groups, k, d_offsets = candidate_offsets.data()] __device__(size_type group) {
+        if (group == num_groups) { return size_type{0}; }
+        return min(k, d_offsets[group + 1] - d_offsets[group]);
+      },
+      size_type{0},
+      thrust::plus<size_type>{});
+
+    auto const gather_map = column_view(
+      data_type{type_to_id<size_type>()}, static_cast<size_type>(selected.size()), selected.data());
+    auto child = std::move(cudf::detail::gather(table_view{{values}},
+                                                gather_map,
+                                                out_of_bounds_policy::DONT_CHECK,
+                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                stream,
+                                                mr)
+                             ->release()
+                             .front());
+    return make_lists_column(num_groups,
+                             std::move(offsets),
+                             std::move(child),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!cudf::is_relationally_comparable<T, T>(), std::unique_ptr<column>> operator()(
+    Args&&... args)
+  {
+    CUDF_FAIL("TOP_K requires values of a comparable type");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> group_top_k(column_view const& values,
+                                    cudf::device_span<size_type const> group_labels,
+                                    cudf::device_span<size_type const> group_offsets,
+                                    size_type num_groups,
+                                    size_type k,
+                                    order column_order,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!cudf::is_dictionary(values.type()), "TOP_K does not support dictionary values");
+  CUDF_EXPECTS(k > 0, "TOP_K requires a positive k");
+
+  return type_dispatcher(values.type(),
+                         top_k_functor{},
+                         values,
+                         group_labels,
+                         group_offsets,
+                         num_groups,
+                         k,
+                         column_order,
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -23,13 +23,17 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
@@ -58,9 +62,13 @@ struct permuted_row_equality_comparator {
    * @param t The `table` whose rows will be compared
    * @param map The permutation map that specifies the effective ordering of
    *`t`. Must be the same size as `t.num_rows()`
+   * @param key_case Device array of the case sensitivity of every column of `t`, or `nullptr`
+   * if all columns are case-sensitive
    */
-  permuted_row_equality_comparator(cudf::table_device_view const& t, cudf::size_type const* map)
-    : _comparator(t, t, true), _map{map}
+  permuted_row_equality_comparator(cudf::table_device_view const& t,
+                                   cudf::size_type const* map,
+                                   cudf::case_sensitivity const* key_case = nullptr)
+    : _comparator(t, t, true, key_case), _map{map}
   {
   }
 
@@ -88,6 +96,27 @@ namespace cudf {
 namespace groupby {
 namespace detail {
 namespace sort {
+sort_groupby_helper::sort_groupby_helper(table_view const& keys,
+                                         device_span<size_type const> group_offsets,
+                                         rmm::cuda_stream_view stream)
+  : _keys(keys),
+    _num_keys(-1),
+    _keys_pre_sorted(sorted::YES),
+    _include_null_keys(null_policy::INCLUDE)
+{
+  CUDF_EXPECTS(not group_offsets.empty(), "Group offsets must include the end of the last group");
+  _group_offsets = std::make_unique<index_vector>(group_offsets.size(), stream);
+  thrust::copy(rmm::exec_policy(stream),
+               group_offsets.begin(),
+               group_offsets.end(),
+               _group_offsets->begin());
+  CUDF_EXPECTS(_group_offsets->element(0, stream) == 0, "The first group offset must be 0");
+
+  // Rows past the end of the last group are discarded like null keys are
+  _num_keys = _group_offsets->back_element(stream);
+  CUDF_EXPECTS(_num_keys <= keys.num_rows(), "Group offsets exceed the number of keys");
+}
+
 size_type sort_groupby_helper::num_keys(rmm::cuda_stream_view stream)
 {
   if (_num_keys > -1) return _num_keys;
@@ -134,21 +163,27 @@ column_view sort_groupby_helper::key_sort_order(rmm::cuda_stream_view stream)
       _keys,
       {},
       std::vector<null_order>(_keys.num_columns(), null_order::AFTER),
+      _key_case,
       stream,
-      rmm::mr::get_current_device_resource());
+      cudf::get_current_temp_resource());
   } else {  // Pandas style
     // Temporarily prepend the keys table with a column that indicates the
     // presence of a null value within a row. This allows moving all rows that
     // contain a null value to the end of the sorted order.
 
-    auto augmented_keys = table_view({table_view({keys_bitmask_column(stream)}), _keys});
+    auto augmented_keys     = table_view({table_view({keys_bitmask_column(stream)}), _keys});
+    auto augmented_key_case = _key_case;
+    if (not augmented_key_case.empty()) {
+      augmented_key_case.insert(augmented_key_case.begin(), case_sensitivity::SENSITIVE);
+    }
 
     _key_sorted_order = cudf::detail::stable_sorted_order(
       augmented_keys,
       {},
       std::vector<null_order>(_keys.num_columns() + 1, null_order::AFTER),
+      augmented_key_case,
       stream,
-      rmm::mr::get_current_device_resource());
+      cudf::get_current_temp_resource());
 
     // All rows with one or more null values are at the end of the resulting sorted order.
   }
@@ -165,22 +200,25 @@ sort_groupby_helper::index_vector const& sort_groupby_helper::group_offsets(
 
   auto device_input_table = table_device_view::create(_keys, stream);
   auto sorted_order       = key_sort_order(stream).data<size_type>();
+  auto const d_key_case   = cudf::detail::make_device_uvector_async(_key_case, stream);
   decltype(_group_offsets->begin()) result_end;
 
-  if (has_nulls(_keys)) {
+  if (has_nested_nulls(_keys)) {
     result_end = thrust::unique_copy(
       rmm::exec_policy(stream),
       thrust::make_counting_iterator<size_type>(0),
       thrust::make_counting_iterator<size_type>(num_keys(stream)),
       _group_offsets->begin(),
-      permuted_row_equality_comparator<true>(*device_input_table, sorted_order));
+      permuted_row_equality_comparator<true>(
+        *device_input_table, sorted_order, d_key_case.data()));
   } else {
     result_end = thrust::unique_copy(
       rmm::exec_policy(stream),
       thrust::make_counting_iterator<size_type>(0),
       thrust::make_counting_iterator<size_type>(num_keys(stream)),
       _group_offsets->begin(),
-      permuted_row_equality_comparator<false>(*device_input_table, sorted_order));
+      permuted_row_equality_comparator<false>(
+        *device_input_table, sorted_order, d_key_case.data()));
   }
 
   size_type num_groups = thrust::distance(_group_offsets->begin(), result_end);
@@ -236,7 +274,7 @@ column_view sort_groupby_helper::unsorted_keys_labels(rmm::cuda_stream_view stre
                           table_view({temp_labels->view()}),
                           false,
                           stream,
-                          rmm::mr::get_current_device_resource());
+                          cudf::get_current_temp_resource());
 
   _unsorted_keys_labels = std::move(t_unsorted_keys_labels->release()[0]);
 
@@ -247,7 +285,7 @@ column_view sort_groupby_helper::keys_bitmask_column(rmm::cuda_stream_view strea
 {
   if (_keys_bitmask_column) return _keys_bitmask_column->view();
 
-  auto row_bitmask = cudf::detail::bitmask_and(_keys, stream);
+  auto row_bitmask = cudf::detail::bitmask_and(_keys, stream).first;
 
   _keys_bitmask_column = make_numeric_column(data_type(type_id::INT8),
                                              _keys.num_rows(),
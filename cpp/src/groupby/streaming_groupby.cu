@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+/**
+ * @brief Returns the partial aggregations from which the results of an aggregation of `kind`
+ * are computed.
+ */
+std::vector<aggregation::Kind> partial_aggregations(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::SUM_OF_SQUARES: return {kind};
+    case aggregation::MEAN: return {aggregation::SUM, aggregation::COUNT_VALID};
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+      return {aggregation::SUM, aggregation::COUNT_VALID, aggregation::SUM_OF_SQUARES};
+    default: CUDF_FAIL("Unsupported aggregation for a streaming groupby");
+  }
+}
+
+/**
+ * @brief Returns the aggregation that merges partial results of `kind`.
+ */
+std::unique_ptr<aggregation> make_merge_aggregation(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::PRODUCT: return make_product_aggregation();
+    case aggregation::MIN: return make_min_aggregation();
+    case aggregation::MAX: return make_max_aggregation();
+    // Sums, counts and sums of squares are all merged by adding them
+    default: return make_sum_aggregation();
+  }
+}
+
+/**
+ * @brief Returns the aggregation that computes the partial results of `kind` of a batch.
+ */
+std::unique_ptr<aggregation> make_partial_aggregation(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::COUNT_VALID: return make_count_aggregation();
+    case aggregation::COUNT_ALL: return make_count_aggregation(null_policy::INCLUDE);
+    case aggregation::SUM_OF_SQUARES: return make_sum_of_squares_aggregation();
+    default: return make_merge_aggregation(kind);
+  }
+}
+
+/**
+ * @brief Returns the index of the partial result of `kind` in `kinds`.
+ */
+size_type partial_index(std::vector<aggregation::Kind> const& kinds, aggregation::Kind kind)
+{
+  return std::distance(kinds.begin(), std::find(kinds.begin(), kinds.end(), kind));
+}
+
+/**
+ * @brief Computes the variance of every group from its sum, count and sum of squares.
+ *
+ * The variance of a group whose count is not larger than `ddof` is null.
+ */
+std::unique_ptr<column> variance_from_partials(column_view const& sum,
+                                               column_view const& count,
+                                               column_view const& sum_of_squares,
+                                               size_type ddof,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto const double_type = data_type{type_id::FLOAT64};
+  auto const double_sum  = cudf::detail::cast(sum, double_type, stream);
+  auto const d_sum       = double_sum->view().data<double>();
+  auto const d_count     = count.data<int64_t>();
+  auto const d_squares   = sum_of_squares.data<double>();
+
+  auto result = make_numeric_column(double_type, count.size(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(count.size()),
+                    result->mutable_view().begin<double>(),
+                    [d_sum, d_count, d_squares, ddof] __device__(size_type i) {
+                      auto const n = d_count[i];
+                      if (n - ddof <= 0) { return 0.0; }
+                      return (d_squares[i] - d_sum[i] * d_sum[i] / n) / (n - ddof);
+                    });
+
+  auto valid_mask = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(count.size()),
+    [d_count, ddof] __device__(size_type i) { return d_count[i] - ddof > 0; },
+    stream,
+    mr);
+  result->set_null_mask(std::move(valid_mask.first), valid_mask.second);
+  return result;
+}
+
+}  // namespace
+
+streaming_groupby::streaming_groupby(
+  std::vector<std::vector<std::unique_ptr<aggregation>>>&& aggregations, null_policy null_handling)
+  : _aggregations{std::move(aggregations)}, _include_null_keys{null_handling}
+{
+  for (auto const& column_aggregations : _aggregations) {
+    std::vector<aggregation::Kind> kinds;
+    for (auto const& agg : column_aggregations) {
+      for (auto const kind : partial_aggregations(agg->kind)) {
+        if (std::find(kinds.begin(), kinds.end(), kind) == kinds.end()) { kinds.push_back(kind); }
+      }
+    }
+    _partial_kinds.push_back(std::move(kinds));
+  }
+}
+
+streaming_groupby::~streaming_groupby() = default;
+
+void streaming_groupby::update(table_view const& keys, table_view const& values)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(static_cast<std::size_t>(values.num_columns()) == _aggregations.size(),
+               "Number of value columns doesn't match the number of sets of aggregations");
+  CUDF_EXPECTS(keys.num_rows() == values.num_rows(),
+               "Size mismatch between request values and groupby keys.");
+
+  std::vector<data_type> key_types(keys.num_columns());
+  std::vector<data_type> value_types(values.num_columns());
+  std::transform(
+    keys.begin(), keys.end(), key_types.begin(), [](auto const& c) { return c.type(); });
+  std::transform(
+    values.begin(), values.end(), value_types.begin(), [](auto const& c) { return c.type(); });
+  if (_keys == nullptr) {
+    CUDF_EXPECTS(std::none_of(value_types.begin(),
+                              value_types.end(),
+                              [](auto const& type) { return is_dictionary(type); }),
+                 "Dictionary values are not supported by a streaming groupby");
+    _key_types   = std::move(key_types);
+    _value_types = std::move(value_types);
+  } else {
+    CUDF_EXPECTS(key_types == _key_types, "Mismatch in the key types of the batches");
+    CUDF_EXPECTS(value_types == _value_types, "Mismatch in the value types of the batches");
+  }
+
+  // Aggregate the batch
+  std::vector<aggregation_request> requests(_partial_kinds.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    requests[i].values = values.column(i);
+    for (auto const kind : _partial_kinds[i]) {
+      requests[i].aggregations.push_back(make_partial_aggregation(kind));
+    }
+  }
+  auto batch = groupby(keys, _include_null_keys).aggregate(requests);
+
+  // Counts are kept as 64-bit values, which is the type of the sum merging them
+  std::vector<std::unique_ptr<column>> batch_results;
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    for (std::size_t j = 0; j < _partial_kinds[i].size(); ++j) {
+      auto& result        = batch.second[i].results[j];
+      auto const kind     = _partial_kinds[i][j];
+      auto const is_count = kind == aggregation::COUNT_VALID or kind == aggregation::COUNT_ALL;
+      if (is_count) { result = cudf::detail::cast(result->view(), data_type{type_id::INT64}); }
+      batch_results.push_back(std::move(result));
+    }
+  }
+
+  if (_keys == nullptr) {
+    _keys            = std::move(batch.first);
+    _partial_results = std::move(batch_results);
+    return;
+  }
+
+  // Merge the results of the batch with those of the previous batches
+  auto const merged_keys = cudf::detail::concatenate(
+    std::vector<table_view>{_keys->view(), batch.first->view()}, rmm::cuda_stream_default);
+  std::vector<std::unique_ptr<column>> merged_partials;
+  std::vector<aggregation_request> merge_requests;
+  std::size_t partial = 0;
+  for (auto const& kinds : _partial_kinds) {
+    for (auto const kind : kinds) {
+      merged_partials.push_back(cudf::detail::concatenate(
+        std::vector<column_view>{_partial_results[partial]->view(), batch_results[partial]->view()},
+        rmm::cuda_stream_default));
+      merge_requests.emplace_back();
+      merge_requests.back().values = merged_partials.back()->view();
+      merge_requests.back().aggregations.push_back(make_merge_aggregation(kind));
+      ++partial;
+    }
+  }
+  auto merged = groupby(merged_keys->view(), _include_null_keys).aggregate(merge_requests);
+
+  _keys = std::move(merged.first);
+  for (std::size_t i = 0; i < _partial_results.size(); ++i) {
+    _partial_results[i] = std::move(merged.second[i].results.front());
+  }
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> streaming_groupby::finalize(
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_keys != nullptr, "No batch was aggregated by the streaming groupby");
+  auto const stream = rmm::cuda_stream_default;
+
+  std::vector<aggregation_result> results(_aggregations.size());
+  std::size_t first_partial = 0;
+  for (std::size_t i = 0; i < _aggregations.size(); ++i) {
+    auto const& kinds = _partial_kinds[i];
+    auto partial      = [&](aggregation::Kind kind) {
+      return _partial_results[first_partial + partial_index(kinds, kind)]->view();
+    };
+
+    for (auto const& agg : _aggregations[i]) {
+      auto const result_type = cudf::detail::target_type(_value_types[i], agg->kind);
+      switch (agg->kind) {
+        case aggregation::COUNT_VALID:
+        case aggregation::COUNT_ALL:
+          results[i].results.push_back(
+            cudf::detail::cast(partial(agg->kind), result_type, stream, mr));
+          break;
+        case aggregation::MEAN:
+          results[i].results.push_back(
+            cudf::detail::binary_operation(partial(aggregation::SUM),
+                                           partial(aggregation::COUNT_VALID),
+                                           binary_operator::DIV,
+                                           result_type,
+                                           stream,
+                                           mr));
+          break;
+        case aggregation::VARIANCE:
+        case aggregation::STD: {
+          auto const ddof = static_cast<cudf::detail::std_var_aggregation const&>(*agg)._ddof;
+          auto variance   = variance_from_partials(partial(aggregation::SUM),
+                                                 partial(aggregation::COUNT_VALID),
+                                                 partial(aggregation::SUM_OF_SQUARES),
+                                                 ddof,
+                                                 stream,
+                                                 mr);
+          results[i].results.push_back(
+            agg->kind == aggregation::VARIANCE
+              ? std::move(variance)
+              : cudf::detail::unary_operation(variance->view(), unary_operator::SQRT, stream, mr));
+          break;
+        }
+        default:
+          results[i].results.push_back(std::make_unique<column>(partial(agg->kind), stream, mr));
+      }
+    }
+    first_partial += kinds.size();
+  }
+
+  return std::make_pair(std::make_unique<table>(_keys->view(), stream, mr), std::move(results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
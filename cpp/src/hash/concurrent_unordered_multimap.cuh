@@ -127,6 +127,42 @@ class concurrent_unordered_multimap {
       new Self(capacity, init, hash_function, equal, allocator, stream), deleter};
   }
 
+  /**
+   * @brief Factory to construct a non-owning concurrent unordered multimap over existing storage.
+   *
+   * The storage holds the pairs of a map with the same template parameters, e.g. copied from the
+   * `data()` of a map built by another process. It is not freed when the returned map is
+   * destroyed, so it must outlive the map.
+   *
+   * @param values The storage of the map's pairs
+   * @param capacity The number of pairs in `values`
+   * @param hash_function The hash function to use for hashing keys
+   * @param equal The equality comparison function for comparing if two keys are
+   * equal
+   * @param allocator The allocator of the map; unused since the map doesn't own its storage
+   */
+  static auto create_view(value_type* values,
+                          size_type capacity,
+                          const Hasher& hash_function     = hasher(),
+                          const Equality& equal           = key_equal(),
+                          const allocator_type& allocator = allocator_type())
+  {
+    using Self = concurrent_unordered_multimap<Key,
+                                               Element,
+                                               size_type,
+                                               unused_key,
+                                               unused_element,
+                                               Hasher,
+                                               Equality,
+                                               Allocator,
+                                               count_collisions>;
+
+    auto deleter = [](Self* p) { delete p; };
+
+    return std::unique_ptr<Self, std::function<void(Self*)>>{
+      new Self(values, capacity, hash_function, equal, allocator), deleter};
+  }
+
   /**
    * @brief Frees the contents of the map and destroys the map object.
    *
@@ -211,6 +247,16 @@ class concurrent_unordered_multimap {
       m_hashtbl_values, m_hashtbl_values + m_hashtbl_size, m_hashtbl_values + m_hashtbl_size);
   }
 
+  /**
+   * @brief Returns a pointer to the storage of the map's pairs
+   */
+  __host__ __device__ value_type* data() const { return m_hashtbl_values; }
+
+  /**
+   * @brief Returns the number of pairs the map can hold
+   */
+  __host__ __device__ size_type capacity() const { return m_hashtbl_size; }
+
   __forceinline__ static constexpr __host__ __device__ key_type get_unused_key()
   {
     return unused_key;
@@ -540,6 +586,30 @@ class concurrent_unordered_multimap {
   value_type* m_hashtbl_values;
   unsigned long long m_collisions;
 
+  /**
+   * @brief Private constructor used by `create_view` factory function.
+   *
+   * @param[in] values The storage of the map's pairs
+   * @param[in] n The size of the hash table (the number of key-value pairs)
+   * @param[in] hash_function The hashing function
+   * @param[in] equal The functor for comparing if two keys are equal
+   * @param[in] a The allocator of the map
+   */
+  concurrent_unordered_multimap(value_type* values,
+                                size_type n,
+                                const Hasher& hash_function,
+                                const Equality& equal,
+                                const allocator_type& a)
+    : m_hf(hash_function),
+      m_equal(equal),
+      m_allocator(a),
+      m_hashtbl_size(n),
+      m_hashtbl_capacity(n),
+      m_hashtbl_values(values),
+      m_collisions(0)
+  {
+  }
+
   /**
    * @brief Private constructor used by `create` factory function.
    *
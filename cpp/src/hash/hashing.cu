@@ -30,6 +30,10 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tabulate.h>
+#include <thrust/tuple.h>
+
 #include <algorithm>
 
 namespace cudf {
@@ -57,6 +61,65 @@ std::vector<column_view> to_leaf_columns(IterType iter_begin, IterType iter_end)
   return leaf_columns;
 }
 
+/**
+ * @brief Hashes an element starting from the hash of the previous elements of its row, a null
+ * element leaving the hash unchanged.
+ */
+template <template <typename> class hash_function, typename hash_value_type, bool has_nulls>
+struct chained_element_hasher {
+  hash_value_type const seed;
+
+  template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+  __device__ hash_value_type operator()(column_device_view const& col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return seed; }
+    return hash_function<T>{seed}(col.element<T>(row_index));
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  __device__ hash_value_type operator()(column_device_view const& col, size_type row_index) const
+  {
+    cudf_assert(false && "Unsupported type in hash.");
+    return seed;
+  }
+};
+
+/**
+ * @brief Hashes a row by chaining the hashes of its elements from left to right.
+ */
+template <template <typename> class hash_function, typename hash_value_type, bool has_nulls>
+struct chained_row_hasher {
+  table_device_view const input;
+  hash_value_type const seed;
+
+  __device__ hash_value_type operator()(size_type row_index) const
+  {
+    auto hash = seed;
+    for (auto const& column : input) {
+      hash = cudf::type_dispatcher(
+        column.type(),
+        chained_element_hasher<hash_function, hash_value_type, has_nulls>{hash},
+        column,
+        row_index);
+    }
+    return hash;
+  }
+};
+
+/**
+ * @brief Writes the 128-bit hash of a row as a pair of its 64-bit halves.
+ */
+template <bool has_nulls>
+struct murmur_hash3_x64_128_row_fn {
+  chained_row_hasher<MurmurHash3_x64_128, hash_value_128, has_nulls> const hasher;
+
+  __device__ thrust::tuple<uint64_t, uint64_t> operator()(size_type row_index) const
+  {
+    auto const hash = hasher(row_index);
+    return thrust::make_tuple(hash.h1, hash.h2);
+  }
+};
+
 }  // namespace
 
 namespace detail {
@@ -75,6 +138,10 @@ std::unique_ptr<column> hash(table_view const& input,
       return serial_murmur_hash3_32<MurmurHash3_32>(input, seed, stream, mr);
     case (hash_id::HASH_SPARK_MURMUR3):
       return serial_murmur_hash3_32<SparkMurmurHash3_32>(input, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64): return xxhash_64(input, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3_X64_128): return murmur_hash3_x64_128(input, seed, stream, mr);
+    case (hash_id::HASH_SHA1): return sha_hash<sha1_intermediate_data>(input, stream, mr);
+    case (hash_id::HASH_SHA256): return sha_hash<sha256_intermediate_data>(input, stream, mr);
     default: return nullptr;
   }
 }
@@ -141,6 +208,60 @@ std::unique_ptr<column> md5_hash(table_view const& input,
                              mr);
 }
 
+template <typename hash_state_type>
+std::unique_ptr<column> sha_hash(table_view const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0) { return make_empty_column(data_type{type_id::STRING}); }
+
+  // Accepts string and fixed width columns, and structs columns of those
+  table_view const leaf_table(to_leaf_columns(input.begin(), input.end()));
+  CUDF_EXPECTS(std::all_of(leaf_table.begin(),
+                           leaf_table.end(),
+                           [](auto const& col) {
+                             return is_fixed_width(col.type()) ||
+                                    col.type().id() == type_id::STRING;
+                           }),
+               "SHA unsupported column type");
+
+  // Result column allocation and creation
+  constexpr auto digest_size = SHAHash<hash_state_type>::digest_size;
+  auto begin                 = thrust::make_constant_iterator(digest_size);
+  auto offsets_column =
+    cudf::strings::detail::make_offsets_child_column(begin, begin + input.num_rows(), stream, mr);
+
+  auto chars_column = strings::detail::create_chars_child_column(
+    input.num_rows(), input.num_rows() * digest_size, stream, mr);
+  auto d_chars = chars_column->mutable_view().data<char>();
+
+  auto const device_input = table_device_view::create(leaf_table, stream);
+
+  // Hash each row, hashing the bytes of its valid elements from left to right as one message
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator(0),
+                   thrust::make_counting_iterator(input.num_rows()),
+                   [d_chars, device_input = *device_input] __device__(auto row_index) {
+                     hash_state_type hash_state;
+                     SHAHash<hash_state_type> hasher;
+                     for (auto const& column : device_input) {
+                       if (column.is_valid(row_index)) {
+                         cudf::type_dispatcher(
+                           column.type(), hasher, column, row_index, &hash_state);
+                       }
+                     }
+                     hasher.finalize(&hash_state, d_chars + (row_index * digest_size));
+                   });
+
+  return make_strings_column(input.num_rows(),
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+}
+
 template <template <typename> class hash_function>
 std::unique_ptr<column> serial_murmur_hash3_32(table_view const& input,
                                                uint32_t seed,
@@ -197,6 +318,72 @@ std::unique_ptr<column> serial_murmur_hash3_32(table_view const& input,
   return output;
 }
 
+std::unique_ptr<column> xxhash_64(table_view const& input,
+                                  uint64_t seed,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::INT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  table_view const leaf_table(to_leaf_columns(input.begin(), input.end()));
+  auto const device_input = table_device_view::create(leaf_table, stream);
+  auto output_view        = output->mutable_view();
+
+  if (has_nulls(leaf_table)) {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     output_view.begin<int64_t>(),
+                     output_view.end<int64_t>(),
+                     chained_row_hasher<SparkXXHash_64, uint64_t, true>{*device_input, seed});
+  } else {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     output_view.begin<int64_t>(),
+                     output_view.end<int64_t>(),
+                     chained_row_hasher<SparkXXHash_64, uint64_t, false>{*device_input, seed});
+  }
+
+  return output;
+}
+
+std::unique_ptr<column> murmur_hash3_x64_128(table_view const& input,
+                                             uint32_t seed,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.num_rows();
+  std::vector<std::unique_ptr<column>> halves;
+  for (int i = 0; i < 2; ++i) {
+    halves.push_back(make_numeric_column(
+      data_type(type_id::UINT64), num_rows, mask_state::UNALLOCATED, stream, mr));
+  }
+
+  if (input.num_columns() > 0 && num_rows > 0) {
+    table_view const leaf_table(to_leaf_columns(input.begin(), input.end()));
+    auto const device_input = table_device_view::create(leaf_table, stream);
+    auto const d_output     = thrust::make_zip_iterator(
+      thrust::make_tuple(halves[0]->mutable_view().begin<uint64_t>(),
+                         halves[1]->mutable_view().begin<uint64_t>()));
+    auto const initial_hash = hash_value_128{seed, seed};
+
+    if (has_nulls(leaf_table)) {
+      thrust::tabulate(rmm::exec_policy(stream),
+                       d_output,
+                       d_output + num_rows,
+                       murmur_hash3_x64_128_row_fn<true>{{*device_input, initial_hash}});
+    } else {
+      thrust::tabulate(rmm::exec_policy(stream),
+                       d_output,
+                       d_output + num_rows,
+                       murmur_hash3_x64_128_row_fn<false>{{*device_input, initial_hash}});
+    }
+  }
+
+  return make_structs_column(
+    num_rows, std::move(halves), 0, rmm::device_buffer{0, stream, mr}, stream, mr);
+}
+
 std::unique_ptr<column> murmur_hash3_32(table_view const& input,
                                         cudf::host_span<uint32_t const> initial_hash,
                                         rmm::cuda_stream_view stream,
@@ -249,6 +436,15 @@ std::unique_ptr<column> murmur_hash3_32(table_view const& input,
   return output;
 }
 
+void expects_row_hashes(column_view const& row_hashes, size_type num_rows)
+{
+  auto const id = row_hashes.type().id();
+  CUDF_EXPECTS(id == type_id::INT32 or id == type_id::UINT32,
+               "Row hashes must be an INT32 or UINT32 column");
+  CUDF_EXPECTS(not row_hashes.has_nulls(), "Row hashes must not have nulls");
+  CUDF_EXPECTS(row_hashes.size() == num_rows, "Mismatch between number of rows and row hashes");
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> hash(table_view const& input,
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <hash/helper_functions.cuh>
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/uninitialized_fill.h>
+
+#include <cooperative_groups.h>
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * @brief Open addressing hash multimap probed by cooperative groups of `cg_size` threads.
+ *
+ * The keys and elements are stored in separate arrays, so that probing only loads the keys of the
+ * probed slots. A key is probed by a group of `cg_size` threads, which load a window of
+ * `cg_size` consecutive slots at once, starting from the slot of the key's hash value. Every
+ * inserted pair lies before the first empty slot of the windows of its key, so the probing of a
+ * key stops after the first window with an empty slot.
+ *
+ * Pairs can be inserted concurrently, but not concurrently with probing. Slots are never erased.
+ *
+ * @note Attempting to insert `empty_key` results in undefined behavior.
+ *
+ * @note All allocations and kernels of the constructor take place on the given stream, which is
+ * not synchronized.
+ *
+ * @tparam Key The type of the keys, which must be supported by `atomicCAS`
+ * @tparam Element The type of the elements
+ * @tparam empty_key The key of empty slots
+ * @tparam empty_element The element of empty slots
+ * @tparam cg_size The number of threads that probe a key cooperatively
+ */
+template <typename Key, typename Element, Key empty_key, Element empty_element, int cg_size>
+class static_multimap {
+  static_assert(cg_size > 0 && cg_size <= 32 && (cg_size & (cg_size - 1)) == 0,
+                "The cooperative group size must be a power of two of at most a warp");
+
+ public:
+  using key_type    = Key;
+  using mapped_type = Element;
+  using size_type   = cudf::size_type;
+
+  static constexpr int window_size = cg_size;
+
+  /**
+   * @brief Trivially copyable view of the map, passed by value to kernels
+   */
+  class device_view {
+   public:
+    device_view(key_type* keys, mapped_type* elements, size_type capacity)
+      : _keys{keys}, _elements{elements}, _capacity{capacity}
+    {
+    }
+
+    /**
+     * @brief Returns the cooperative group of the calling thread, which probes a key with the
+     * other `cg_size - 1` threads of the group.
+     */
+    static __device__ auto probing_group()
+    {
+      return cooperative_groups::tiled_partition<cg_size>(cooperative_groups::this_thread_block());
+    }
+
+    __forceinline__ static constexpr __host__ __device__ key_type get_unused_key()
+    {
+      return empty_key;
+    }
+
+    __host__ __device__ size_type capacity() const { return _capacity; }
+
+    /**
+     * @brief Returns the first slot of the first window probed for a key of hash `hash_value`.
+     */
+    template <typename hash_value_type>
+    __device__ size_type initial_window(hash_value_type hash_value) const
+    {
+      return static_cast<size_type>(hash_value % _capacity);
+    }
+
+    /**
+     * @brief Returns the first slot of the window probed after the window at `window`.
+     */
+    __device__ size_type next_window(size_type window) const
+    {
+      window += window_size;
+      return window >= _capacity ? window - _capacity : window;
+    }
+
+    /**
+     * @brief Returns the slot of the window at `window` that the thread of rank `rank` in its
+     * group probes.
+     */
+    __device__ size_type slot(size_type window, unsigned int rank) const
+    {
+      auto const s = window + static_cast<size_type>(rank);
+      return s >= _capacity ? s - _capacity : s;
+    }
+
+    /**
+     * @brief Returns the number of windows after which every slot has been probed.
+     */
+    __device__ size_type num_windows() const
+    {
+      return (_capacity + window_size - 1) / window_size;
+    }
+
+    __device__ key_type key(size_type slot) const { return _keys[slot]; }
+
+    __device__ mapped_type element(size_type slot) const { return _elements[slot]; }
+
+    /**
+     * @brief Inserts a pair with the group of threads `group`, which all pass the same pair.
+     *
+     * @param group The cooperative group of the calling thread
+     * @param key The key of the pair, whose hash value is its own value
+     * @param element The element of the pair
+     *
+     * @returns `false` if the map is full
+     */
+    template <typename group_type>
+    __device__ bool insert(group_type const& group, key_type key, mapped_type element)
+    {
+      auto const rank = group.thread_rank();
+      auto window     = initial_window(key);
+      for (size_type probed_windows = 0; probed_windows < num_windows();) {
+        auto const s = slot(window, rank);
+        // Other groups insert concurrently, so the keys must be reloaded on every attempt
+        auto const empty_slots =
+          group.ballot(*static_cast<key_type volatile*>(_keys + s) == empty_key);
+        if (empty_slots == 0) {
+          window = next_window(window);
+          ++probed_windows;
+          continue;
+        }
+
+        // The first empty slot keeps every pair of the key before the first empty slot
+        auto const leader = __ffs(empty_slots) - 1;
+        bool inserted     = false;
+        if (rank == leader) {
+          inserted = atomicCAS(_keys + s, empty_key, key) == empty_key;
+          if (inserted) { _elements[s] = element; }
+        }
+        if (group.shfl(inserted, leader)) { return true; }
+        // Another group took the slot, so the window is probed again
+      }
+      return false;
+    }
+
+   private:
+    key_type* _keys;
+    mapped_type* _elements;
+    size_type _capacity;
+  };
+
+  /**
+   * @brief Constructs a map with enough slots for `num_keys` pairs at `desired_occupancy`.
+   *
+   * @param num_keys The number of pairs to insert
+   * @param desired_occupancy The percentage of the slots to fill with `num_keys` pairs
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the map's storage
+   */
+  static_multimap(size_type num_keys,
+                  uint32_t desired_occupancy           = DEFAULT_HASH_TABLE_OCCUPANCY,
+                  rmm::cuda_stream_view stream         = rmm::cuda_stream_default,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+    : _capacity{compute_capacity(num_keys, desired_occupancy)},
+      _key_storage(_capacity, stream, mr),
+      _element_storage(_capacity, stream, mr),
+      _keys{_key_storage.data()},
+      _elements{_element_storage.data()}
+  {
+    thrust::uninitialized_fill(
+      rmm::exec_policy(stream), _key_storage.begin(), _key_storage.end(), empty_key);
+    thrust::uninitialized_fill(
+      rmm::exec_policy(stream), _element_storage.begin(), _element_storage.end(), empty_element);
+  }
+
+  /**
+   * @brief Constructs a non-owning map over the storage of a map with the same template
+   * parameters, e.g. copied from the `keys()` and `elements()` of a map built by another process.
+   *
+   * The storage must outlive the map.
+   *
+   * @param keys The keys of the map's slots
+   * @param elements The elements of the map's slots
+   * @param capacity The number of slots
+   */
+  static_multimap(key_type* keys, mapped_type* elements, size_type capacity)
+    : _capacity{capacity},
+      _key_storage(0, rmm::cuda_stream_default),
+      _element_storage(0, rmm::cuda_stream_default),
+      _keys{keys},
+      _elements{elements}
+  {
+  }
+
+  static_multimap(static_multimap const&) = delete;
+  static_multimap(static_multimap&&)      = default;
+  static_multimap& operator=(static_multimap const&) = delete;
+  static_multimap& operator=(static_multimap&&) = default;
+  ~static_multimap()                            = default;
+
+  /**
+   * @brief Returns the view of the map passed to kernels
+   */
+  device_view get_device_view() const { return device_view{_keys, _elements, _capacity}; }
+
+  /**
+   * @brief Returns the keys of the map's slots
+   */
+  key_type* keys() const { return _keys; }
+
+  /**
+   * @brief Returns the elements of the map's slots
+   */
+  mapped_type* elements() const { return _elements; }
+
+  /**
+   * @brief Returns the number of slots of the map
+   */
+  size_type capacity() const { return _capacity; }
+
+ private:
+  /**
+   * @brief Returns the number of slots of a map of `num_keys` pairs at `desired_occupancy`, which
+   * is at least a window.
+   */
+  static size_type compute_capacity(size_type num_keys, uint32_t desired_occupancy)
+  {
+    CUDF_EXPECTS(desired_occupancy > 0 && desired_occupancy <= 100,
+                 "The occupancy of a hash map must be a percentage in (0, 100]");
+    auto const capacity = std::max<size_t>(compute_hash_table_size(num_keys, desired_occupancy),
+                                           static_cast<size_t>(window_size));
+    CUDF_EXPECTS(capacity <= static_cast<size_t>(std::numeric_limits<size_type>::max()),
+                 "Hash map capacity exceeds the column size limit");
+    return static_cast<size_type>(capacity);
+  }
+
+  size_type _capacity;
+  rmm::device_uvector<key_type> _key_storage;  ///< Empty if the map doesn't own its storage
+  rmm::device_uvector<mapped_type> _element_storage;
+  key_type* _keys;
+  mapped_type* _elements;
+};
@@ -15,12 +15,19 @@
  */
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/interop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/lists/list_view.cuh>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/structs/struct_view.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <dlpack/dlpack.h>
 
@@ -126,6 +133,84 @@ struct dltensor_context {
   }
 };
 
+/**
+ * @brief Copies the element of each row and column of a table to a strided tensor.
+ *
+ * Consecutive indices are consecutive elements of the tensor when it is row-major, and of the
+ * columns otherwise.
+ */
+template <typename T, bool has_nulls>
+struct copy_to_tensor_fn {
+  table_device_view input;
+  T* tensor;
+  int64_t row_stride;
+  int64_t column_stride;
+  bool row_major;
+  T null_replacement;
+
+  __device__ void operator()(int64_t idx) const
+  {
+    auto const num_rows    = static_cast<int64_t>(input.num_rows());
+    auto const num_columns = static_cast<int64_t>(input.num_columns());
+    auto const row         = static_cast<size_type>(row_major ? idx / num_columns : idx % num_rows);
+    auto const col         = static_cast<size_type>(row_major ? idx % num_columns : idx / num_rows);
+
+    auto const& column = input.column(col);
+    tensor[row * row_stride + col * column_stride] =
+      (has_nulls && column.is_null(row)) ? null_replacement : column.element<T>(row);
+  }
+};
+
+struct copy_to_tensor_dispatch {
+  template <typename T, std::enable_if_t<is_numeric<T>()>* = nullptr>
+  void operator()(table_view const& input,
+                  void* tensor_data,
+                  int64_t row_stride,
+                  int64_t column_stride,
+                  scalar const* null_replacement,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const d_input   = table_device_view::create(input, stream);
+    auto const tensor    = static_cast<T*>(tensor_data);
+    auto const row_major = column_stride == 1 && input.num_columns() > 1;
+    auto const size      = static_cast<int64_t>(input.num_rows()) * input.num_columns();
+    if (null_replacement == nullptr) {
+      thrust::for_each_n(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator<int64_t>(0),
+        size,
+        copy_to_tensor_fn<T, false>{*d_input, tensor, row_stride, column_stride, row_major, T{}});
+    } else {
+      auto const value = static_cast<numeric_scalar<T> const*>(null_replacement)->value(stream);
+      thrust::for_each_n(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator<int64_t>(0),
+        size,
+        copy_to_tensor_fn<T, true>{*d_input, tensor, row_stride, column_stride, row_major, value});
+    }
+  }
+
+  template <typename T, typename... Args, std::enable_if_t<not is_numeric<T>()>* = nullptr>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Conversion of non-numeric types to DLPack is unsupported");
+  }
+};
+
+/**
+ * @brief Validates that the columns of `input` have the same numeric type and returns it.
+ */
+data_type common_numeric_type(table_view const& input)
+{
+  data_type const type = input.column(0).type();
+  CUDF_EXPECTS(
+    std::all_of(input.begin(), input.end(), [type](auto const& col) { return col.type() == type; }),
+    "All columns required to have same data type");
+  // Ensure that type is convertible to DLDataType
+  data_type_to_DLDataType(type);
+  return type;
+}
+
 }  // namespace
 
 namespace detail {
@@ -177,6 +262,11 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                               ? byte_width * tensor.strides[1]
                               : byte_width * num_rows;
 
+  // If the strides pointer is not null, then strides[0] is the number of elements between
+  // consecutive rows, and the rows of a row-major tensor are gathered by a strided copy
+  size_t const row_stride =
+    (nullptr != tensor.strides) ? byte_width * tensor.strides[0] : byte_width;
+
   auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
 
   // Allocate columns and copy data from tensor
@@ -184,11 +274,22 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
   for (auto& col : columns) {
     col = make_numeric_column(dtype, num_rows, mask_state::UNALLOCATED, stream, mr);
 
-    CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
-                             reinterpret_cast<void*>(tensor_data),
-                             bytes,
-                             cudaMemcpyDefault,
-                             stream.value()));
+    if (row_stride == byte_width) {
+      CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
+                               reinterpret_cast<void*>(tensor_data),
+                               bytes,
+                               cudaMemcpyDefault,
+                               stream.value()));
+    } else if (num_rows > 0) {
+      CUDA_TRY(cudaMemcpy2DAsync(col->mutable_view().head<void>(),
+                                 byte_width,
+                                 reinterpret_cast<void*>(tensor_data),
+                                 row_stride,
+                                 byte_width,
+                                 num_rows,
+                                 cudaMemcpyDefault,
+                                 stream.value()));
+    }
 
     tensor_data += col_stride;
   }
@@ -274,6 +375,64 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return managed_tensor.release();
 }
 
+void to_dlpack(table_view const& input,
+               DLManagedTensor* output,
+               scalar const* null_replacement,
+               rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(nullptr != output, "output tensor is null");
+  auto const& tensor = output->dl_tensor;
+
+  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type, "DLTensor must be GPU type");
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  CUDF_EXPECTS(tensor.ctx.device_id == device_id, "DLTensor device ID must be current device");
+
+  auto const num_rows = input.num_rows();
+  auto const num_cols = input.num_columns();
+  CUDF_EXPECTS(tensor.ndim == 2 || (tensor.ndim == 1 && num_cols == 1),
+               "DLTensor must be 2D, or 1D for a single column");
+  CUDF_EXPECTS(tensor.shape[0] == num_rows, "DLTensor first dim must be the number of rows");
+  CUDF_EXPECTS(tensor.ndim == 1 || tensor.shape[1] == num_cols,
+               "DLTensor second dim must be the number of columns");
+  if (num_rows == 0 || num_cols == 0) { return; }
+
+  data_type const type    = common_numeric_type(input);
+  DLDataType const dltype = data_type_to_DLDataType(type);
+  CUDF_EXPECTS(tensor.dtype.code == dltype.code && tensor.dtype.bits == dltype.bits &&
+                 tensor.dtype.lanes == dltype.lanes,
+               "DLTensor data type must be the type of the columns");
+
+  if (null_replacement == nullptr) {
+    CUDF_EXPECTS(
+      std::none_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); }),
+      "Input required to have null count zero");
+  } else {
+    CUDF_EXPECTS(null_replacement->type() == type,
+                 "Null replacement required to have the data type of the columns");
+    CUDF_EXPECTS(null_replacement->is_valid(stream), "Null replacement required to be valid");
+  }
+
+  // null strides are those of a compact row-major tensor
+  int64_t row_stride    = (tensor.ndim == 2) ? num_cols : 1;
+  int64_t column_stride = 1;
+  if (nullptr != tensor.strides) {
+    row_stride = tensor.strides[0];
+    if (tensor.ndim == 2) { column_stride = tensor.strides[1]; }
+  }
+
+  auto const tensor_data = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(tensor.data) +
+                                                   tensor.byte_offset);
+  type_dispatcher(type,
+                  copy_to_tensor_dispatch{},
+                  input,
+                  tensor_data,
+                  row_stride,
+                  column_stride,
+                  null_replacement,
+                  stream);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
@@ -287,4 +446,43 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resou
   return detail::to_dlpack(input, rmm::cuda_stream_default, mr);
 }
 
+DLManagedTensor* to_dlpack_view(column_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  if (input.is_empty()) { return nullptr; }
+
+  DLDataType const dltype = data_type_to_DLDataType(input.type());
+  CUDF_EXPECTS(not input.has_nulls(), "Input required to have null count zero");
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = dltype;
+  tensor.ndim      = 1;
+  tensor.shape     = context->shape;
+  tensor.shape[0]  = input.size();
+  tensor.data      = const_cast<void*>(get_column_data(input));
+
+  CUDA_TRY(cudaGetDevice(&tensor.ctx.device_id));
+  tensor.ctx.device_type = kDLGPU;
+
+  // the context owns only the shape, the column data is not freed by the deleter
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
+void to_dlpack(table_view const& input, DLManagedTensor* output)
+{
+  CUDF_FUNC_RANGE();
+  detail::to_dlpack(input, output, nullptr, rmm::cuda_stream_default);
+}
+
+void to_dlpack(table_view const& input, DLManagedTensor* output, scalar const& null_replacement)
+{
+  CUDF_FUNC_RANGE();
+  detail::to_dlpack(input, output, &null_replacement, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
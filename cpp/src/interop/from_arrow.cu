@@ -36,6 +36,8 @@
 
 #include <thrust/gather.h>
 
+#include <limits>
+
 namespace cudf {
 
 namespace detail {
@@ -75,7 +77,8 @@ data_type arrow_to_cudf_type(arrow::DataType const& arrow_type)
         default: CUDF_FAIL("Unsupported duration unit in arrow");
       }
     }
-    case arrow::Type::STRING: return data_type(type_id::STRING);
+    case arrow::Type::STRING:
+    case arrow::Type::LARGE_STRING: return data_type(type_id::STRING);
     case arrow::Type::DICTIONARY: return data_type(type_id::DICTIONARY32);
     case arrow::Type::LIST: return data_type(type_id::LIST);
     case arrow::Type::DECIMAL: {
@@ -273,14 +276,24 @@ std::unique_ptr<column> dispatch_to_cudf_column::operator()<cudf::string_view>(
   rmm::mr::device_memory_resource* mr)
 {
   if (array.length() == 0) { return cudf::strings::detail::make_empty_strings_column(stream, mr); }
-  auto str_array    = static_cast<arrow::StringArray const*>(&array);
-  auto offset_array = std::make_unique<arrow::Int32Array>(
-    str_array->value_offsets()->size() / sizeof(int32_t), str_array->value_offsets(), nullptr);
-  auto char_array = std::make_unique<arrow::Int8Array>(
-    str_array->value_data()->size(), str_array->value_data(), nullptr);
-
-  auto offsets_column = dispatch_to_cudf_column{}.operator()<int32_t>(
-    *offset_array, data_type(type_id::INT32), true, stream, mr);
+  // the offsets of large strings are 64-bit, which the strings column factory accepts
+  auto const is_large       = array.type_id() == arrow::Type::LARGE_STRING;
+  auto const& value_offsets = array.data()->buffers[1];
+  auto const& value_data    = array.data()->buffers[2];
+  CUDF_EXPECTS(value_data->size() <= std::numeric_limits<size_type>::max(),
+               "Total number of bytes in the strings exceeds size_type range");
+  auto char_array = std::make_unique<arrow::Int8Array>(value_data->size(), value_data, nullptr);
+
+  std::unique_ptr<column> offsets_column;
+  if (is_large) {
+    arrow::Int64Array offset_array(value_offsets->size() / sizeof(int64_t), value_offsets, nullptr);
+    offsets_column = dispatch_to_cudf_column{}.operator()<int64_t>(
+      offset_array, data_type(type_id::INT64), true, stream, mr);
+  } else {
+    arrow::Int32Array offset_array(value_offsets->size() / sizeof(int32_t), value_offsets, nullptr);
+    offsets_column = dispatch_to_cudf_column{}.operator()<int32_t>(
+      offset_array, data_type(type_id::INT32), true, stream, mr);
+  }
   auto chars_column = dispatch_to_cudf_column{}.operator()<int8_t>(
     *char_array, data_type(type_id::INT8), true, stream, mr);
 
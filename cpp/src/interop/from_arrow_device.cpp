@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime.h>
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the column type of an Arrow C format string.
+ */
+data_type cudf_type(std::string const& format)
+{
+  static std::unordered_map<std::string, type_id> const types{
+    {"c", type_id::INT8},
+    {"s", type_id::INT16},
+    {"i", type_id::INT32},
+    {"l", type_id::INT64},
+    {"C", type_id::UINT8},
+    {"S", type_id::UINT16},
+    {"I", type_id::UINT32},
+    {"L", type_id::UINT64},
+    {"f", type_id::FLOAT32},
+    {"g", type_id::FLOAT64},
+    {"tdD", type_id::TIMESTAMP_DAYS},
+    {"tss:", type_id::TIMESTAMP_SECONDS},
+    {"tsm:", type_id::TIMESTAMP_MILLISECONDS},
+    {"tsu:", type_id::TIMESTAMP_MICROSECONDS},
+    {"tsn:", type_id::TIMESTAMP_NANOSECONDS},
+    {"tDs", type_id::DURATION_SECONDS},
+    {"tDm", type_id::DURATION_MILLISECONDS},
+    {"tDu", type_id::DURATION_MICROSECONDS},
+    {"tDn", type_id::DURATION_NANOSECONDS},
+    {"u", type_id::STRING},
+    {"+l", type_id::LIST},
+    {"+s", type_id::STRUCT}};
+
+  auto const type = types.find(format);
+  CUDF_EXPECTS(type != types.end(),
+               "Unsupported format for zero-copy Arrow device import: " + format);
+  return data_type{type->second};
+}
+
+/**
+ * @brief Returns the null count of `array`, whose unknown null count is -1.
+ */
+size_type null_count(ArrowArray const* array)
+{
+  if (array->buffers[0] == nullptr) { return 0; }
+  return array->null_count < 0 ? UNKNOWN_NULL_COUNT : static_cast<size_type>(array->null_count);
+}
+
+/**
+ * @brief Returns a view of the `num_offsets` offsets of a strings or lists array.
+ */
+column_view offsets_view(ArrowArray const* array, size_type num_offsets)
+{
+  return column_view{data_type{type_id::INT32}, num_offsets, array->buffers[1]};
+}
+
+column_view import_column(ArrowSchema const* schema,
+                          ArrowArray const* array,
+                          rmm::cuda_stream_view stream)
+{
+  auto const type = cudf_type(schema->format);
+  CUDF_EXPECTS(schema->n_children == array->n_children,
+               "Number of children of the schema and the array doesn't match");
+  CUDF_EXPECTS(
+    array->length + array->offset <= static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+    "Array is too large for a cudf column");
+
+  auto const size   = static_cast<size_type>(array->length);
+  auto const offset = static_cast<size_type>(array->offset);
+  auto const mask   = static_cast<bitmask_type const*>(array->buffers[0]);
+  auto const nulls  = null_count(array);
+
+  std::vector<column_view> children;
+  for (int64_t idx = 0; idx < array->n_children; ++idx) {
+    children.push_back(import_column(schema->children[idx], array->children[idx], stream));
+  }
+
+  switch (type.id()) {
+    case type_id::STRING: {
+      CUDF_EXPECTS(array->n_buffers == 3, "Strings array must have 3 buffers");
+      if (size == 0 || array->buffers[1] == nullptr) {
+        return column_view{type, 0, nullptr, nullptr, 0};
+      }
+      // the size of the characters is the last offset
+      auto const num_offsets = offset + size + 1;
+      size_type num_chars    = 0;
+      CUDA_TRY(cudaMemcpyAsync(&num_chars,
+                               static_cast<size_type const*>(array->buffers[1]) + num_offsets - 1,
+                               sizeof(size_type),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      stream.synchronize();
+      auto const chars = column_view{data_type{type_id::INT8}, num_chars, array->buffers[2]};
+      return column_view{
+        type, size, nullptr, mask, nulls, offset, {offsets_view(array, num_offsets), chars}};
+    }
+    case type_id::LIST: {
+      CUDF_EXPECTS(array->n_buffers == 2 && children.size() == 1,
+                   "Lists array must have 2 buffers and 1 child");
+      auto const num_offsets = array->buffers[1] == nullptr ? 0 : offset + size + 1;
+      return column_view{
+        type, size, nullptr, mask, nulls, offset, {offsets_view(array, num_offsets), children[0]}};
+    }
+    case type_id::STRUCT:
+      CUDF_EXPECTS(array->n_buffers == 1, "Struct array must have 1 buffer");
+      return column_view{type, size, nullptr, mask, nulls, offset, children};
+    default:
+      CUDF_EXPECTS(array->n_buffers == 2, "Fixed-width array must have 2 buffers");
+      return column_view{type, size, array->buffers[1], mask, nulls, offset};
+  }
+}
+
+}  // namespace
+
+unique_table_view_t from_arrow_device(ArrowSchema const* schema,
+                                      ArrowDeviceArray* input,
+                                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(schema != nullptr && input != nullptr, "Schema and array must not be null");
+  CUDF_EXPECTS(input->array.release != nullptr, "Array was already released");
+  CUDF_EXPECTS(
+    input->device_type == ARROW_DEVICE_CUDA || input->device_type == ARROW_DEVICE_CUDA_MANAGED,
+    "Array must be in CUDA device or managed memory");
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  CUDF_EXPECTS(input->device_id == device_id, "Array must be on the current device");
+  CUDF_EXPECTS(std::string{schema->format} == "+s", "Schema must be that of a struct array");
+  CUDF_EXPECTS(schema->n_children == input->array.n_children,
+               "Number of children of the schema and the array doesn't match");
+  CUDF_EXPECTS(input->array.null_count == 0 || input->array.buffers[0] == nullptr,
+               "Struct array of the table must not have nulls");
+
+  if (input->sync_event != nullptr) {
+    CUDA_TRY(
+      cudaStreamWaitEvent(stream.value(), *static_cast<cudaEvent_t*>(input->sync_event), 0));
+  }
+
+  // the rows of the table are those of the struct array
+  auto const begin = static_cast<size_type>(input->array.offset);
+  auto const end   = begin + static_cast<size_type>(input->array.length);
+  std::vector<column_view> columns;
+  for (int64_t idx = 0; idx < input->array.n_children; ++idx) {
+    auto const col = import_column(schema->children[idx], input->array.children[idx], stream);
+    columns.push_back(begin == 0 && end == col.size() ? col : slice(col, {begin, end})[0]);
+  }
+
+  // the result owns the array, which is released with the table_view
+  auto owner           = std::make_shared<ArrowDeviceArray>(*input);
+  input->array.release = nullptr;
+
+  auto release = [owner](table_view* view) {
+    if (owner->array.release) { owner->array.release(&owner->array); }
+    delete view;
+  };
+  return unique_table_view_t{new table_view{columns}, release};
+}
+
+}  // namespace detail
+
+unique_table_view_t from_arrow_device(ArrowSchema const* schema, ArrowDeviceArray* input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_arrow_device(schema, input, rmm::cuda_stream_default);
+}
+
+}  // namespace cudf
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the Arrow C format string of a column type.
+ */
+std::string arrow_format(data_type type)
+{
+  switch (type.id()) {
+    case type_id::INT8: return "c";
+    case type_id::INT16: return "s";
+    case type_id::INT32: return "i";
+    case type_id::INT64: return "l";
+    case type_id::UINT8: return "C";
+    case type_id::UINT16: return "S";
+    case type_id::UINT32: return "I";
+    case type_id::UINT64: return "L";
+    case type_id::FLOAT32: return "f";
+    case type_id::FLOAT64: return "g";
+    case type_id::TIMESTAMP_DAYS: return "tdD";
+    case type_id::TIMESTAMP_SECONDS: return "tss:";
+    case type_id::TIMESTAMP_MILLISECONDS: return "tsm:";
+    case type_id::TIMESTAMP_MICROSECONDS: return "tsu:";
+    case type_id::TIMESTAMP_NANOSECONDS: return "tsn:";
+    case type_id::DURATION_SECONDS: return "tDs";
+    case type_id::DURATION_MILLISECONDS: return "tDm";
+    case type_id::DURATION_MICROSECONDS: return "tDu";
+    case type_id::DURATION_NANOSECONDS: return "tDn";
+    case type_id::STRING: return "u";
+    case type_id::LIST: return "+l";
+    case type_id::STRUCT: return "+s";
+    default:
+      CUDF_FAIL("Unsupported type for zero-copy Arrow device export, use cudf::to_arrow instead");
+  }
+}
+
+/**
+ * @brief Returns the columns that are the Arrow children of `col`.
+ *
+ * The offsets and characters of strings columns and the offsets of lists columns are buffers of
+ * their Arrow arrays.
+ */
+std::vector<column_view> arrow_children(column_view const& col)
+{
+  switch (col.type().id()) {
+    case type_id::LIST:
+      CUDF_EXPECTS(col.num_children() == 2, "Lists column must have offsets and child columns");
+      return {col.child(lists_column_view::child_column_index)};
+    case type_id::STRUCT: return {col.child_begin(), col.child_end()};
+    default: return {};
+  }
+}
+
+/**
+ * @brief Returns the metadata of the Arrow children of `col`.
+ *
+ * As in `to_arrow`, the metadata of a lists column holds that of its offsets and child columns.
+ */
+std::vector<column_metadata> arrow_children_metadata(column_view const& col,
+                                                     column_metadata const& metadata,
+                                                     std::size_t num_children)
+{
+  if (metadata.children_meta.empty()) { return std::vector<column_metadata>(num_children); }
+  if (col.type().id() == type_id::LIST) {
+    CUDF_EXPECTS(metadata.children_meta.size() == 2,
+                 "Lists column metadata should contain offsets and child metadata");
+    return {metadata.children_meta[lists_column_view::child_column_index]};
+  }
+  CUDF_EXPECTS(metadata.children_meta.size() == num_children,
+               "Number of field names and number of children doesn't match");
+  return metadata.children_meta;
+}
+
+/**
+ * @brief Owns the strings and the children of an exported `ArrowSchema`.
+ */
+struct exported_schema {
+  std::string format;
+  std::string name;
+  std::vector<ArrowSchema*> children;
+};
+
+void release_schema(ArrowSchema* schema)
+{
+  auto data = static_cast<exported_schema*>(schema->private_data);
+  for (auto child : data->children) {
+    if (child->release) { child->release(child); }
+    delete child;
+  }
+  delete data;
+  schema->release = nullptr;
+}
+
+/**
+ * @brief Fills `schema` with the schema of a column of type `format` with `children`.
+ */
+void make_schema(ArrowSchema* schema,
+                 std::string format,
+                 std::string name,
+                 std::vector<ArrowSchema*> children)
+{
+  auto data = new exported_schema{std::move(format), std::move(name), std::move(children)};
+
+  *schema              = ArrowSchema{};
+  schema->format       = data->format.c_str();
+  schema->name         = data->name.c_str();
+  schema->flags        = ARROW_FLAG_NULLABLE;
+  schema->n_children   = static_cast<int64_t>(data->children.size());
+  schema->children     = data->children.data();
+  schema->release      = release_schema;
+  schema->private_data = data;
+}
+
+ArrowSchema* export_schema(column_view const& col, column_metadata const& metadata)
+{
+  auto const children      = arrow_children(col);
+  auto const children_meta = arrow_children_metadata(col, metadata, children.size());
+
+  std::vector<ArrowSchema*> child_schemas;
+  for (std::size_t idx = 0; idx < children.size(); ++idx) {
+    child_schemas.push_back(export_schema(children[idx], children_meta[idx]));
+  }
+  auto schema = new ArrowSchema;
+  make_schema(schema, arrow_format(col.type()), metadata.name, std::move(child_schemas));
+  return schema;
+}
+
+/**
+ * @brief Owns the buffer pointers and the children of an exported `ArrowArray`.
+ *
+ * The array of the table additionally owns the table if it was moved to the export, and the
+ * event the consumer synchronizes on.
+ */
+struct exported_array {
+  std::vector<void const*> buffers;
+  std::vector<ArrowArray*> children;
+  std::unique_ptr<table> owner;
+  cudaEvent_t event{nullptr};
+};
+
+void release_array(ArrowArray* array)
+{
+  auto data = static_cast<exported_array*>(array->private_data);
+  for (auto child : data->children) {
+    if (child->release) { child->release(child); }
+    delete child;
+  }
+  if (data->event) { cudaEventDestroy(data->event); }
+  delete data;
+  array->release = nullptr;
+}
+
+/**
+ * @brief Fills `array` with the device buffers of a column.
+ */
+void make_array(ArrowArray* array,
+                int64_t length,
+                int64_t null_count,
+                int64_t offset,
+                std::unique_ptr<exported_array> data)
+{
+  *array              = ArrowArray{};
+  array->length       = length;
+  array->null_count   = null_count;
+  array->offset       = offset;
+  array->n_buffers    = static_cast<int64_t>(data->buffers.size());
+  array->n_children   = static_cast<int64_t>(data->children.size());
+  array->buffers      = data->buffers.data();
+  array->children     = data->children.data();
+  array->release      = release_array;
+  array->private_data = data.release();
+}
+
+ArrowArray* export_array(column_view const& col)
+{
+  auto data = std::make_unique<exported_array>();
+  data->buffers.push_back(col.null_mask());
+  switch (col.type().id()) {
+    case type_id::STRING: {
+      // an empty strings column may have no children, and then has no offsets and characters
+      if (col.num_children() == 0) {
+        data->buffers.push_back(nullptr);
+        data->buffers.push_back(nullptr);
+        break;
+      }
+      auto const offsets = col.child(strings_column_view::offsets_column_index);
+      auto const chars   = col.child(strings_column_view::chars_column_index);
+      data->buffers.push_back(offsets.head<size_type>() + offsets.offset());
+      data->buffers.push_back(chars.head<char>() + chars.offset());
+      break;
+    }
+    case type_id::LIST: {
+      auto const offsets = col.child(lists_column_view::offsets_column_index);
+      data->buffers.push_back(offsets.head<size_type>() + offsets.offset());
+      break;
+    }
+    case type_id::STRUCT: break;
+    default:
+      // validates the type
+      arrow_format(col.type());
+      data->buffers.push_back(col.head());
+  }
+  for (auto const& child : arrow_children(col)) {
+    data->children.push_back(export_array(child));
+  }
+
+  auto array = new ArrowArray;
+  make_array(array, col.size(), col.null_count(), col.offset(), std::move(data));
+  return array;
+}
+
+void delete_device_array(ArrowDeviceArray* array)
+{
+  if (array->array.release) { array->array.release(&array->array); }
+  delete array;
+}
+
+/**
+ * @brief Exports `input` as a struct array, owning `owner` if it is not null.
+ */
+unique_device_array_t export_table(std::unique_ptr<table> owner,
+                                   table_view const& input,
+                                   rmm::cuda_stream_view stream)
+{
+  auto data = std::make_unique<exported_array>();
+  data->buffers.push_back(nullptr);
+  for (auto const& col : input) {
+    data->children.push_back(export_array(col));
+  }
+  data->owner = std::move(owner);
+  CUDA_TRY(cudaEventCreateWithFlags(&data->event, cudaEventDisableTiming));
+  CUDA_TRY(cudaEventRecord(data->event, stream.value()));
+
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  auto const sync_event = static_cast<void*>(&data->event);
+
+  unique_device_array_t result{new ArrowDeviceArray{}, delete_device_array};
+  make_array(&result->array, input.num_rows(), 0, 0, std::move(data));
+  result->device_id   = device_id;
+  result->device_type = ARROW_DEVICE_CUDA;
+  result->sync_event  = sync_event;
+  return result;
+}
+
+}  // namespace
+
+unique_device_array_t to_arrow_device(table_view const& input, rmm::cuda_stream_view stream)
+{
+  return export_table(nullptr, input, stream);
+}
+
+unique_device_array_t to_arrow_device(std::unique_ptr<table>&& input,
+                                      rmm::cuda_stream_view stream)
+{
+  auto const view = input->view();
+  return export_table(std::move(input), view, stream);
+}
+
+}  // namespace detail
+
+unique_schema_t to_arrow_schema(table_view const& input,
+                                std::vector<column_metadata> const& metadata)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(metadata.empty() || metadata.size() == static_cast<std::size_t>(input.num_columns()),
+               "columns' metadata should be equal to number of columns in table");
+
+  std::vector<ArrowSchema*> children;
+  for (size_type idx = 0; idx < input.num_columns(); ++idx) {
+    auto const& col_metadata = metadata.empty() ? column_metadata{} : metadata[idx];
+    children.push_back(detail::export_schema(input.column(idx), col_metadata));
+  }
+  unique_schema_t result{new ArrowSchema{}, [](ArrowSchema* schema) {
+                           if (schema->release) { schema->release(schema); }
+                           delete schema;
+                         }};
+  detail::make_schema(result.get(), "+s", "", std::move(children));
+  return result;
+}
+
+unique_device_array_t to_arrow_device(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(input, rmm::cuda_stream_default);
+}
+
+unique_device_array_t to_arrow_device(std::unique_ptr<table>&& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(std::move(input), rmm::cuda_stream_default);
+}
+
+}  // namespace cudf
@@ -22,6 +22,8 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/pinned_host_pool.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/table/table.hpp>
@@ -32,6 +34,11 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <limits>
+
 using cudf::device_span;
 
 namespace cudf {
@@ -61,6 +68,18 @@ type_id to_type_id(const avro::schema_entry *col)
   }
 }
 
+/**
+ * @brief Returns whether two Avro schemas describe the same columns
+ */
+bool is_same_schema(std::vector<schema_entry> const &lhs, std::vector<schema_entry> const &rhs)
+{
+  return std::equal(
+    lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](auto const &l, auto const &r) {
+      return l.kind == r.kind && l.parent_idx == r.parent_idx &&
+             l.num_children == r.num_children && l.name == r.name && l.symbols == r.symbols;
+    });
+}
+
 }  // namespace
 
 /**
@@ -69,19 +88,72 @@ type_id to_type_id(const avro::schema_entry *col)
  */
 class metadata : public file_metadata {
  public:
-  explicit metadata(datasource *const src) : source(src) {}
+  explicit metadata(std::vector<std::unique_ptr<datasource>> const &sources) : sources(sources) {}
 
   /**
    * @brief Initializes the parser and filters down to a subset of rows
    *
+   * The sources are read in parallel and treated as a single dataset: the selected rows may span
+   * several sources, whose blocks are listed in source order. All sources must have the same
+   * schema and codec. The offsets of the selected blocks refer to the source data in
+   * `source_data`, and `block_source` holds the source index of each block.
+   *
    * @param[in,out] row_start Starting row of the selection
    * @param[in,out] row_count Total number of rows selected
    */
   void init_and_select_rows(int &row_start, int &row_count)
   {
-    const auto buffer = source->host_read(0, source->size());
-    avro::container pod(buffer->data(), buffer->size());
-    CUDF_EXPECTS(pod.parse(this, row_count, row_start), "Cannot parse metadata");
+    read_sources();
+
+    auto const first_row = static_cast<size_t>(std::max(row_start, 0));
+    auto const max_rows =
+      (row_count < 0) ? std::numeric_limits<size_t>::max() : static_cast<size_t>(row_count);
+    size_t row      = 0;  // First row of the current block, over all sources
+    size_t sel_row  = 0;  // First row of the first selected block
+    bool is_all_set = false;
+    std::vector<block_desc_s> selected_blocks;
+    for (size_t src_idx = 0; src_idx < source_data.size() && !is_all_set; ++src_idx) {
+      auto const &buffer = source_data[src_idx];
+      file_metadata file_md;
+      avro::container pod(buffer->data(), buffer->size());
+      CUDF_EXPECTS(pod.parse(&file_md), "Cannot parse metadata");
+      if (src_idx == 0) {
+        static_cast<file_metadata &>(*this) = file_md;
+      } else {
+        CUDF_EXPECTS(is_same_schema(schema, file_md.schema) && codec == file_md.codec,
+                     "All sources must have the same schema and codec");
+      }
+
+      for (auto const &blk : file_md.block_list) {
+        if (row + blk.num_rows <= first_row) {
+          row += blk.num_rows;
+          continue;
+        }
+        if (selected_blocks.empty()) {
+          sel_row   = row;
+          skip_rows = static_cast<uint32_t>(first_row - row);
+        }
+        if (row - sel_row > skip_rows && row - sel_row - skip_rows >= max_rows) {
+          is_all_set = true;
+          break;
+        }
+        // Block rows are numbered from the first selected block, including the skipped rows
+        selected_blocks.emplace_back(
+          blk.offset, blk.size, static_cast<uint32_t>(row - sel_row), blk.num_rows);
+        block_source.push_back(src_idx);
+        row += blk.num_rows;
+      }
+    }
+
+    block_list      = std::move(selected_blocks);
+    max_block_size  = 0;
+    total_data_size = 0;
+    for (auto const &blk : block_list) {
+      max_block_size = std::max(max_block_size, blk.size);
+      total_data_size += blk.size;
+    }
+    if (block_list.empty()) { skip_rows = 0; }
+    num_rows  = block_list.empty() ? 0 : std::min(max_rows, row - sel_row - skip_rows);
     row_start = skip_rows;
     row_count = num_rows;
   }
@@ -134,11 +206,40 @@ class metadata : public file_metadata {
     return selection;
   }
 
+  std::vector<std::unique_ptr<datasource::buffer>> source_data;  ///< Contents of each source
+  std::vector<size_t> block_source;  ///< Index of the source of each block in `block_list`
+
  private:
-  datasource *const source;
+  /**
+   * @brief Reads the contents of all sources to host memory.
+   *
+   * Sources are read concurrently, as datasets are often split into many small files and reading
+   * them one at a time leaves the reads latency-bound.
+   */
+  void read_sources()
+  {
+    constexpr size_t max_concurrent_reads = 8;
+
+    source_data.resize(sources.size());
+    if (sources.size() == 1) {
+      source_data[0] = sources[0]->host_read(0, sources[0]->size());
+      return;
+    }
+    thread_pool pool(std::min(sources.size(), max_concurrent_reads));
+    std::vector<std::future<std::unique_ptr<datasource::buffer>>> reads;
+    for (auto const &source : sources) {
+      reads.emplace_back(
+        pool.submit([src = source.get()]() { return src->host_read(0, src->size()); }));
+    }
+    // Waits for all reads; rethrows the first failure
+    for (size_t i = 0; i < reads.size(); ++i) { source_data[i] = reads[i].get(); }
+  }
+
+  std::vector<std::unique_ptr<datasource>> const &sources;
 };
 
 rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_block_data,
+                                                 uint8_t const *h_comp_block_data,
                                                  rmm::cuda_stream_view stream)
 {
   size_t uncompressed_data_size = 0;
@@ -153,8 +254,7 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
   } else if (_metadata->codec == "snappy") {
     // Extract the uncompressed length from the snappy stream
     for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-      const auto buffer  = _source->host_read(_metadata->block_list[i].offset, 4);
-      const uint8_t *blk = buffer->data();
+      const uint8_t *blk = h_comp_block_data + _metadata->block_list[i].offset;
       uint32_t blk_len   = blk[0];
       if (blk_len > 0x7f) {
         blk_len = (blk_len & 0x7f) | (blk[1] << 7);
@@ -332,13 +432,14 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
   }
 }
 
-reader::impl::impl(std::unique_ptr<datasource> source,
+reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
                    avro_reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : _mr(mr), _source(std::move(source)), _columns(options.get_columns())
+  : _mr(mr), _sources(std::move(sources)), _columns(options.get_columns())
 {
+  CUDF_EXPECTS(!_sources.empty(), "No sources to read from");
   // Open the source Avro dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  _metadata = std::make_unique<metadata>(_sources);
 }
 
 table_with_metadata reader::impl::read(avro_reader_options const &options,
@@ -368,28 +469,46 @@ table_with_metadata reader::impl::read(avro_reader_options const &options,
 
     if (_metadata->total_data_size > 0) {
       rmm::device_buffer block_data;
-      if (_source->is_device_read_preferred(_metadata->total_data_size)) {
-        block_data      = rmm::device_buffer{_metadata->total_data_size, stream};
-        auto read_bytes = _source->device_read(_metadata->block_list[0].offset,
-                                               _metadata->total_data_size,
-                                               static_cast<uint8_t *>(block_data.data()),
-                                               stream);
+      pinned_buffer<uint8_t> h_block_data;
+      uint8_t const *h_comp_block_data = nullptr;
+      auto const &first_blk            = _metadata->block_list.front();
+      auto const &last_blk             = _metadata->block_list.back();
+      auto const block_range_size      = last_blk.offset + last_blk.size - first_blk.offset;
+      if (_sources.size() == 1 && _sources[0]->is_device_read_preferred(block_range_size)) {
+        // Read the range of the selected blocks directly to device memory; the host copy of the
+        // source is only needed for the snappy block lengths
+        block_data      = rmm::device_buffer{block_range_size, stream};
+        auto read_bytes = _sources[0]->device_read(first_blk.offset,
+                                                   block_range_size,
+                                                   static_cast<uint8_t *>(block_data.data()),
+                                                   stream);
         block_data.resize(read_bytes);
+        h_comp_block_data  = _metadata->source_data[0]->data() + first_blk.offset;
+        auto const dst_ofs = first_blk.offset;
+        for (auto &blk : _metadata->block_list) { blk.offset -= dst_ofs; }
       } else {
-        const auto buffer =
-          _source->host_read(_metadata->block_list[0].offset, _metadata->total_data_size);
-        block_data = rmm::device_buffer{buffer->data(), buffer->size(), stream};
+        // Gather the selected blocks of all sources, so that the blocks are copied, decompressed
+        // and decoded with a single transfer and kernel launch each, regardless of the number of
+        // sources
+        h_block_data = make_pinned_buffer<uint8_t>(_metadata->total_data_size);
+        for (size_t i = 0, pos = 0; i < _metadata->block_list.size(); i++) {
+          auto &blk         = _metadata->block_list[i];
+          auto const &input = _metadata->source_data[_metadata->block_source[i]];
+          std::memcpy(h_block_data.get() + pos, input->data() + blk.offset, blk.size);
+          blk.offset = pos;
+          pos += blk.size;
+        }
+        block_data = rmm::device_buffer{h_block_data.get(), _metadata->total_data_size, stream};
+        h_comp_block_data = h_block_data.get();
       }
 
       if (_metadata->codec != "" && _metadata->codec != "null") {
-        auto decomp_block_data = decompress_data(block_data, stream);
+        auto decomp_block_data = decompress_data(block_data, h_comp_block_data, stream);
         block_data             = std::move(decomp_block_data);
-      } else {
-        auto dst_ofs = _metadata->block_list[0].offset;
-        for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-          _metadata->block_list[i].offset -= dst_ofs;
-        }
       }
+      // The pinned buffer is released on scope exit, so the copy from it must be complete
+      stream.synchronize();
+      _metadata->source_data.clear();
 
       size_t total_dictionary_entries = 0;
       size_t dictionary_data_size     = 0;
@@ -475,8 +594,7 @@ reader::reader(std::vector<std::string> const &filepaths,
                avro_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(datasource::create(filepaths[0]), options, mr);
+  _impl = std::make_unique<impl>(datasource::create(filepaths), options, mr);
 }
 
 // Forward to implementation
@@ -484,8 +602,7 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                avro_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(std::move(sources[0]), options, mr);
+  _impl = std::make_unique<impl>(std::move(sources), options, mr);
 }
 
 // Destructor within this translation unit
@@ -54,13 +54,13 @@ class metadata;
 class reader::impl {
  public:
   /**
-   * @brief Constructor from a dataset source with reader options.
+   * @brief Constructor from an array of dataset sources with reader options.
    *
-   * @param source Dataset source
+   * @param sources Dataset sources, read as a single dataset with a common schema
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
-  explicit impl(std::unique_ptr<datasource> source,
+  explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
                 avro_reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -79,11 +79,13 @@ class reader::impl {
    * @brief Decompresses the block data.
    *
    * @param comp_block_data Compressed block data
+   * @param h_comp_block_data Host copy of the compressed block data
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return Device buffer to decompressed block data
    */
   rmm::device_buffer decompress_data(const rmm::device_buffer &comp_block_data,
+                                     uint8_t const *h_comp_block_data,
                                      rmm::cuda_stream_view stream);
 
   /**
@@ -105,7 +107,7 @@ class reader::impl {
 
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
-  std::unique_ptr<datasource> _source;
+  std::vector<std::unique_ptr<datasource>> _sources;
   std::unique_ptr<metadata> _metadata;
 
   std::vector<std::string> _columns;
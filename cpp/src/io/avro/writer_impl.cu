@@ -0,0 +1,558 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cu
+ * @brief cuDF-IO Avro writer class implementation
+ */
+
+#include "writer_impl.hpp"
+
+#include <io/comp/gpuinflate.h>
+#include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/pinned_host_pool.hpp>
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/transform.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <future>
+#include <random>
+#include <thread>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace avro {
+
+namespace {
+
+// Encoding of the rows is split into chunks of at most this many rows, to bound the device memory
+// used by the encoded rows
+constexpr size_type rows_per_encode = 1 << 20;
+
+// The CRC32 of a snappy block is computed in segments of this size, combined on the host
+constexpr size_t crc_segment_size = 4096;
+
+/**
+ * @brief Encoding of the values of a column
+ */
+struct column_encoding {
+  type_kind_e kind;
+  int32_t multiplier;  ///< Scale of the integer values, 1000 for seconds written as milliseconds
+};
+
+column_encoding get_encoding(data_type type)
+{
+  switch (type.id()) {
+    case type_id::BOOL8: return {type_boolean, 1};
+    case type_id::INT8:
+    case type_id::INT16:
+    case type_id::INT32:
+    case type_id::UINT8:
+    case type_id::UINT16:
+    case type_id::TIMESTAMP_DAYS: return {type_int, 1};
+    case type_id::INT64:
+    case type_id::UINT32:
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::TIMESTAMP_NANOSECONDS: return {type_long, 1};
+    case type_id::TIMESTAMP_SECONDS: return {type_long, 1000};
+    case type_id::FLOAT32: return {type_float, 1};
+    case type_id::FLOAT64: return {type_double, 1};
+    case type_id::STRING: return {type_string, 1};
+    default: CUDF_FAIL("Unsupported column type for Avro.");
+  }
+}
+
+/**
+ * @brief Returns the schema of the values of a column
+ */
+std::string get_value_schema(data_type type)
+{
+  auto const logical_schema = [](char const* base, char const* logical) {
+    return std::string{"{\"type\":\""} + base + "\",\"logicalType\":\"" + logical + "\"}";
+  };
+  switch (type.id()) {
+    case type_id::TIMESTAMP_DAYS: return logical_schema("int", "date");
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::TIMESTAMP_MILLISECONDS: return logical_schema("long", "timestamp-millis");
+    case type_id::TIMESTAMP_MICROSECONDS: return logical_schema("long", "timestamp-micros");
+    case type_id::TIMESTAMP_NANOSECONDS: return logical_schema("long", "timestamp-nanos");
+    default: break;
+  }
+  switch (get_encoding(type).kind) {
+    case type_boolean: return "\"boolean\"";
+    case type_int: return "\"int\"";
+    case type_long: return "\"long\"";
+    case type_float: return "\"float\"";
+    case type_double: return "\"double\"";
+    default: return "\"string\"";
+  }
+}
+
+/**
+ * @brief Returns a name as a quoted and escaped JSON string
+ */
+std::string to_json_string(std::string const& name)
+{
+  constexpr char const hex_digits[] = "0123456789abcdef";
+  std::string str{"\""};
+  for (auto const chr : name) {
+    auto const byte = static_cast<unsigned char>(chr);
+    if (byte == '\"' || byte == '\\') {
+      str += '\\';
+      str += chr;
+    } else if (byte < 0x20) {
+      str += "\\u00";
+      str += hex_digits[byte >> 4];
+      str += hex_digits[byte & 0xf];
+    } else {
+      str += chr;
+    }
+  }
+  return str + "\"";
+}
+
+std::string get_codec_name(compression_type compression)
+{
+  switch (compression) {
+    case compression_type::NONE: return "null";
+    case compression_type::SNAPPY: return "snappy";
+    case compression_type::GZIP: return "deflate";
+    default: CUDF_FAIL("Unsupported compression type for Avro.");
+  }
+}
+
+/**
+ * @brief Appends a `long` to a host buffer, zigzag-encoded as a variable length integer
+ */
+void append_long(std::vector<uint8_t>& buffer, int64_t value)
+{
+  auto zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  for (; zigzag >= 0x80; zigzag >>= 7) {
+    buffer.push_back(static_cast<uint8_t>(zigzag | 0x80));
+  }
+  buffer.push_back(static_cast<uint8_t>(zigzag));
+}
+
+/**
+ * @brief Appends `string` or `bytes`, as their length followed by their data
+ */
+void append_string(std::vector<uint8_t>& buffer, std::string const& str)
+{
+  append_long(buffer, str.size());
+  buffer.insert(buffer.end(), str.begin(), str.end());
+}
+
+/**
+ * @brief Returns the value of a row of an integer or timestamp column, as ticks for timestamps
+ */
+__device__ int64_t get_integer(column_device_view const& col, size_type row)
+{
+  switch (col.type().id()) {
+    case type_id::INT8: return col.element<int8_t>(row);
+    case type_id::INT16: return col.element<int16_t>(row);
+    case type_id::INT32: return col.element<int32_t>(row);
+    case type_id::INT64: return col.element<int64_t>(row);
+    case type_id::UINT8: return col.element<uint8_t>(row);
+    case type_id::UINT16: return col.element<uint16_t>(row);
+    case type_id::UINT32: return col.element<uint32_t>(row);
+    case type_id::TIMESTAMP_DAYS: return col.element<timestamp_D>(row).time_since_epoch().count();
+    case type_id::TIMESTAMP_SECONDS:
+      return col.element<timestamp_s>(row).time_since_epoch().count();
+    case type_id::TIMESTAMP_MILLISECONDS:
+      return col.element<timestamp_ms>(row).time_since_epoch().count();
+    case type_id::TIMESTAMP_MICROSECONDS:
+      return col.element<timestamp_us>(row).time_since_epoch().count();
+    case type_id::TIMESTAMP_NANOSECONDS:
+      return col.element<timestamp_ns>(row).time_since_epoch().count();
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Functor to encode each row in the Avro binary encoding.
+ *
+ * The values of a row are written one after the other, each nullable value preceded by its union
+ * branch: 0 for `null`, or 1 for the value.
+ */
+struct encode_rows_fn {
+  table_device_view const d_table;
+  column_encoding const* d_encodings;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void write_bytes(char const* data, size_type size, char*& d_buffer, offset_type& bytes)
+  {
+    if (d_buffer) { d_buffer = cudf::strings::detail::copy_and_increment(d_buffer, data, size); }
+    bytes += size;
+  }
+
+  __device__ void write_long(int64_t value, char*& d_buffer, offset_type& bytes)
+  {
+    auto zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    for (; zigzag >= 0x80; zigzag >>= 7) {
+      char const byte = static_cast<char>(zigzag | 0x80);
+      write_bytes(&byte, 1, d_buffer, bytes);
+    }
+    char const byte = static_cast<char>(zigzag);
+    write_bytes(&byte, 1, d_buffer, bytes);
+  }
+
+  __device__ void operator()(size_type row)
+  {
+    char* d_buffer    = d_chars ? d_chars + d_offsets[row] : nullptr;
+    offset_type bytes = 0;
+
+    for (size_type col = 0; col < d_table.num_columns(); ++col) {
+      auto const d_column = d_table.column(col);
+      if (d_column.nullable()) {
+        auto const is_null = d_column.is_null(row);
+        write_long(is_null ? 0 : 1, d_buffer, bytes);
+        if (is_null) { continue; }
+      }
+      auto const encoding = d_encodings[col];
+      switch (encoding.kind) {
+        case type_boolean: {
+          char const byte = d_column.element<bool>(row) ? 1 : 0;
+          write_bytes(&byte, 1, d_buffer, bytes);
+          break;
+        }
+        case type_int:
+        case type_long:
+          write_long(get_integer(d_column, row) * encoding.multiplier, d_buffer, bytes);
+          break;
+        // The device is little-endian, like the Avro encoding of floating-point values
+        case type_float: {
+          auto const value = d_column.element<float>(row);
+          write_bytes(reinterpret_cast<char const*>(&value), sizeof(value), d_buffer, bytes);
+          break;
+        }
+        case type_double: {
+          auto const value = d_column.element<double>(row);
+          write_bytes(reinterpret_cast<char const*>(&value), sizeof(value), d_buffer, bytes);
+          break;
+        }
+        case type_string: {
+          auto const d_str = d_column.element<string_view>(row);
+          write_long(d_str.size_bytes(), d_buffer, bytes);
+          write_bytes(d_str.data(), d_str.size_bytes(), d_buffer, bytes);
+          break;
+        }
+        default: break;
+      }
+    }
+
+    if (!d_chars) d_offsets[row] = bytes;
+  }
+};
+
+struct crc_segment {
+  uint8_t const* data;
+  uint32_t size;
+};
+
+/**
+ * @brief Computes the CRC32 of a segment, bit by bit; the segments are small enough for the
+ * segments of all the blocks to be computed concurrently
+ */
+struct segment_crc_fn {
+  __device__ uint32_t operator()(crc_segment const& segment) const
+  {
+    uint32_t crc = 0xffffffffu;
+    for (uint32_t i = 0; i < segment.size; ++i) {
+      crc ^= segment.data[i];
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u)));
+      }
+    }
+    return ~crc;
+  }
+};
+
+/**
+ * @brief Compresses a block with raw DEFLATE, which the `deflate` codec uses
+ */
+std::vector<uint8_t> deflate_block(uint8_t const* data, size_t size)
+{
+  z_stream strm{};
+  CUDF_EXPECTS(
+    deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK,
+    "Cannot initialize deflate compression");
+  std::vector<uint8_t> compressed(deflateBound(&strm, size));
+  strm.next_in   = const_cast<Bytef*>(data);
+  strm.avail_in  = size;
+  strm.next_out  = compressed.data();
+  strm.avail_out = compressed.size();
+  auto const result = deflate(&strm, Z_FINISH);
+  deflateEnd(&strm);
+  CUDF_EXPECTS(result == Z_STREAM_END, "Deflate compression failed");
+  compressed.resize(strm.total_out);
+  return compressed;
+}
+
+pinned_buffer<uint8_t> copy_to_host(uint8_t const* d_data,
+                                    size_t size,
+                                    rmm::cuda_stream_view stream)
+{
+  auto h_data = make_pinned_buffer<uint8_t>(size);
+  CUDA_TRY(cudaMemcpyAsync(h_data.get(), d_data, size, cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+  return h_data;
+}
+
+}  // unnamed namespace
+
+// Forward to implementation
+writer::writer(std::unique_ptr<data_sink> sink,
+               avro_writer_options const& options,
+               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(std::move(sink), options, mr))
+{
+}
+
+// Destructor within this translation unit
+writer::~writer() = default;
+
+writer::impl::impl(std::unique_ptr<data_sink> sink,
+                   avro_writer_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : out_sink_(std::move(sink)), mr_(mr), options_(options)
+{
+  std::mt19937_64 engine{std::random_device{}()};
+  std::generate(sync_marker_.begin(), sync_marker_.end(), [&]() {
+    return static_cast<uint8_t>(engine());
+  });
+}
+
+void writer::impl::write_header(std::string const& schema, std::string const& codec)
+{
+  std::vector<uint8_t> header{'O', 'b', 'j', 1};
+  // File metadata, as a map of two entries
+  append_long(header, 2);
+  append_string(header, "avro.schema");
+  append_string(header, schema);
+  append_string(header, "avro.codec");
+  append_string(header, codec);
+  append_long(header, 0);
+  header.insert(header.end(), sync_marker_.begin(), sync_marker_.end());
+  out_sink_->host_write(header.data(), header.size());
+}
+
+void writer::impl::write_block(
+  size_type num_rows, uint8_t const* data, size_t size, uint8_t const* suffix, size_t suffix_size)
+{
+  std::vector<uint8_t> block_header;
+  append_long(block_header, num_rows);
+  append_long(block_header, size + suffix_size);
+  out_sink_->host_write(block_header.data(), block_header.size());
+  out_sink_->host_write(data, size);
+  if (suffix_size != 0) { out_sink_->host_write(suffix, suffix_size); }
+  out_sink_->host_write(sync_marker_.data(), sync_marker_.size());
+}
+
+void writer::impl::write_blocks(uint8_t const* d_data,
+                                std::vector<data_block> const& blocks,
+                                rmm::cuda_stream_view stream)
+{
+  auto const total_size = blocks.back().offset + blocks.back().size;
+  switch (options_.get_compression()) {
+    case compression_type::NONE: {
+      auto const h_data = copy_to_host(d_data, total_size, stream);
+      for (auto const& block : blocks) {
+        write_block(block.num_rows, h_data.get() + block.offset, block.size);
+      }
+      break;
+    }
+    case compression_type::GZIP: {
+      // There is no device DEFLATE compressor, so the blocks are compressed by host threads
+      auto const h_data      = copy_to_host(d_data, total_size, stream);
+      auto const num_threads = std::max(1u, std::thread::hardware_concurrency());
+      thread_pool pool(std::min<size_t>(num_threads, blocks.size()));
+      std::vector<std::future<std::vector<uint8_t>>> compressed;
+      for (auto const& block : blocks) {
+        compressed.push_back(pool.submit([data = h_data.get() + block.offset, size = block.size]() {
+          return deflate_block(data, size);
+        }));
+      }
+      for (size_t i = 0; i < blocks.size(); ++i) {
+        auto const block_data = compressed[i].get();
+        write_block(blocks[i].num_rows, block_data.data(), block_data.size());
+      }
+      break;
+    }
+    case compression_type::SNAPPY: {
+      // Each block is compressed by a thread block, and followed by the big-endian CRC32 of its
+      // uncompressed data
+      std::vector<size_t> comp_offsets;
+      std::vector<crc_segment> h_segments;
+      size_t comp_size = 0;
+      for (auto const& block : blocks) {
+        comp_offsets.push_back(comp_size);
+        comp_size += 32 + block.size + block.size / 6;
+        for (size_t pos = 0; pos < block.size; pos += crc_segment_size) {
+          auto const segment_size = std::min(crc_segment_size, block.size - pos);
+          h_segments.push_back({d_data + block.offset + pos, static_cast<uint32_t>(segment_size)});
+        }
+      }
+      comp_offsets.push_back(comp_size);
+
+      rmm::device_buffer comp_data(comp_size, stream);
+      hostdevice_vector<gpu_inflate_input_s> comp_in(blocks.size(), stream);
+      hostdevice_vector<gpu_inflate_status_s> comp_out(blocks.size(), stream);
+      for (size_t i = 0; i < blocks.size(); ++i) {
+        comp_in[i].srcDevice = d_data + blocks[i].offset;
+        comp_in[i].srcSize   = blocks[i].size;
+        comp_in[i].dstDevice = static_cast<uint8_t*>(comp_data.data()) + comp_offsets[i];
+        comp_in[i].dstSize   = comp_offsets[i + 1] - comp_offsets[i];
+        comp_out[i].status   = -1000;
+      }
+      comp_in.host_to_device(stream);
+      comp_out.host_to_device(stream);
+      CUDA_TRY(gpu_snap(
+        comp_in.device_ptr(), comp_out.device_ptr(), static_cast<int>(blocks.size()), stream));
+
+      auto const d_segments = cudf::detail::make_device_uvector_async(h_segments, stream);
+      rmm::device_uvector<uint32_t> d_crcs(h_segments.size(), stream);
+      thrust::transform(rmm::exec_policy(stream),
+                        d_segments.begin(),
+                        d_segments.end(),
+                        d_crcs.begin(),
+                        segment_crc_fn{});
+      std::vector<uint32_t> h_crcs(h_segments.size());
+      CUDA_TRY(cudaMemcpyAsync(h_crcs.data(),
+                               d_crcs.data(),
+                               h_crcs.size() * sizeof(uint32_t),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      comp_out.device_to_host(stream);
+      auto const h_comp_data =
+        copy_to_host(static_cast<uint8_t const*>(comp_data.data()), comp_size, stream);
+
+      size_t segment = 0;
+      for (size_t i = 0; i < blocks.size(); ++i) {
+        CUDF_EXPECTS(comp_out[i].status == 0, "Snappy compression failed");
+        uLong crc = crc32(0, nullptr, 0);
+        for (size_t pos = 0; pos < blocks[i].size; pos += crc_segment_size, ++segment) {
+          auto const segment_size = std::min(crc_segment_size, blocks[i].size - pos);
+          crc                     = crc32_combine(crc, h_crcs[segment], segment_size);
+        }
+        uint8_t const crc_bytes[4] = {static_cast<uint8_t>(crc >> 24),
+                                      static_cast<uint8_t>(crc >> 16),
+                                      static_cast<uint8_t>(crc >> 8),
+                                      static_cast<uint8_t>(crc)};
+        write_block(blocks[i].num_rows,
+                    h_comp_data.get() + comp_offsets[i],
+                    comp_out[i].bytes_written,
+                    crc_bytes,
+                    sizeof(crc_bytes));
+      }
+      break;
+    }
+    default: CUDF_FAIL("Unsupported compression type for Avro.");
+  }
+}
+
+void writer::impl::write(table_view const& table,
+                         table_metadata const* metadata,
+                         rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(table.num_columns() > 0, "Empty table.");
+  CUDF_EXPECTS(options_.get_block_size() > 0, "The block size must be positive.");
+  auto const has_names = metadata != nullptr && !metadata->column_names.empty();
+  if (has_names) {
+    CUDF_EXPECTS(metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
+                 "Mismatch between number of column names and table columns.");
+  }
+
+  std::vector<column_encoding> h_encodings;
+  std::string schema =
+    "{\"type\":\"record\",\"name\":" + to_json_string(options_.get_record_name()) + ",\"fields\":[";
+  for (size_type col = 0; col < table.num_columns(); ++col) {
+    auto const& column = table.column(col);
+    h_encodings.push_back(get_encoding(column.type()));
+    auto const name         = has_names ? metadata->column_names[col] : "_" + std::to_string(col);
+    auto const value_schema = get_value_schema(column.type());
+    schema += (col == 0) ? "{\"name\":" : ",{\"name\":";
+    schema += to_json_string(name) + ",\"type\":";
+    schema += column.nullable() ? "[\"null\"," + value_schema + "]}" : value_schema + "}";
+  }
+  schema += "]}";
+  write_header(schema, get_codec_name(options_.get_compression()));
+
+  auto const d_encodings = cudf::detail::make_device_uvector_async(h_encodings, stream);
+
+  std::vector<size_type> splits;
+  for (auto row = rows_per_encode; row < table.num_rows(); row += rows_per_encode) {
+    splits.push_back(row);
+  }
+  for (auto const& chunk : cudf::split(table, splits)) {
+    auto const num_rows = chunk.num_rows();
+    if (num_rows == 0) { continue; }
+
+    auto const d_chunk = table_device_view::create(chunk, stream);
+    encode_rows_fn fn{*d_chunk, d_encodings.data()};
+    auto children = cudf::strings::detail::make_strings_children(fn, num_rows, stream);
+
+    // A block ends with the first row that makes its size reach the target size
+    std::vector<size_type> h_offsets(num_rows + 1);
+    CUDA_TRY(cudaMemcpyAsync(h_offsets.data(),
+                             children.first->view().data<size_type>(),
+                             h_offsets.size() * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
+    std::vector<data_block> blocks;
+    for (size_type row = 0; row < num_rows;) {
+      auto const first_row = row;
+      auto const block_end = h_offsets[first_row] + options_.get_block_size();
+      while (row < num_rows && static_cast<size_t>(h_offsets[row]) < block_end) {
+        ++row;
+      }
+      blocks.push_back({row - first_row,
+                        static_cast<size_t>(h_offsets[first_row]),
+                        static_cast<size_t>(h_offsets[row] - h_offsets[first_row])});
+    }
+    write_blocks(children.second->view().data<uint8_t>(), blocks, stream);
+  }
+  out_sink_->flush();
+}
+
+void writer::write(table_view const& table,
+                   table_metadata const* metadata,
+                   rmm::cuda_stream_view stream)
+{
+  _impl->write(table, metadata, stream);
+}
+
+}  // namespace avro
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "avro_common.h"
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/detail/avro.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace avro {
+
+using namespace cudf::io::avro;
+using namespace cudf::io;
+
+/**
+ * @brief Location of a data block within the encoded rows of a chunk
+ */
+struct data_block {
+  size_type num_rows;
+  size_t offset;  ///< Offset of the first encoded byte of the block
+  size_t size;    ///< Uncompressed size of the block
+};
+
+/**
+ * @brief Implementation for the Avro writer
+ */
+class writer::impl {
+ public:
+  /**
+   * @brief Constructor with writer options.
+   *
+   * @param sink Output sink
+   * @param options Settings for controlling behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  impl(std::unique_ptr<data_sink> sink,
+       avro_writer_options const& options,
+       rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Writes a table as an Avro object container file.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write(table_view const& table,
+             table_metadata const* metadata = nullptr,
+             rmm::cuda_stream_view stream   = rmm::cuda_stream_default);
+
+ private:
+  /**
+   * @brief Writes the file header: the magic, the schema and codec metadata, and the sync marker.
+   */
+  void write_header(std::string const& schema, std::string const& codec);
+
+  /**
+   * @brief Compresses the data blocks of a chunk of encoded rows, and writes them to the sink.
+   *
+   * @param d_data Encoded rows of the chunk, in device memory
+   * @param blocks Data blocks of the chunk
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write_blocks(uint8_t const* d_data,
+                    std::vector<data_block> const& blocks,
+                    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Writes a data block: its number of rows and size, its data and the sync marker.
+   */
+  void write_block(size_type num_rows,
+                   uint8_t const* data,
+                   size_t size,
+                   uint8_t const* suffix = nullptr,
+                   size_t suffix_size    = 0);
+
+  std::unique_ptr<data_sink> out_sink_;
+  rmm::mr::device_memory_resource* mr_ = nullptr;
+  avro_writer_options const options_;
+  std::array<uint8_t, 16> sync_marker_;
+};
+
+}  // namespace avro
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -115,6 +115,56 @@ cudaError_t gpu_debrotli(gpu_inflate_input_s *inputs,
                          int count                    = 1,
                          rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Interface for decompressing LZ4-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] hadoop_framing Whether chunks may be a sequence of blocks prefixed with their
+ * big-endian uncompressed and compressed sizes (Hadoop codec); chunks that aren't valid
+ * Hadoop-framed data are decoded as a single raw block, default false
+ * @param[in] stream CUDA stream to use, default 0
+ */
+cudaError_t gpu_unlz4(gpu_inflate_input_s *inputs,
+                      gpu_inflate_status_s *outputs,
+                      int count                    = 1,
+                      bool hadoop_framing          = false,
+                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Computes the size of temporary memory for ZSTD decompression
+ *
+ * @param[in] max_num_inputs The maximum number of compressed input chunks
+ *
+ * @return The size in bytes of required temporary memory
+ */
+size_t get_gpu_unzstd_scratch_size(int max_num_inputs = 0);
+
+/**
+ * @brief Interface for decompressing ZSTD-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk. Each chunk
+ * may contain several concatenated frames; dictionaries are not supported.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] scratch Temporary memory for intermediate work
+ * @param[in] scratch_size Size in bytes of the temporary memory
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ */
+cudaError_t gpu_unzstd(gpu_inflate_input_s *inputs,
+                       gpu_inflate_status_s *outputs,
+                       void *scratch,
+                       size_t scratch_size,
+                       int count                    = 1,
+                       rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @brief Interface for compressing data with Snappy
  *
@@ -131,5 +181,24 @@ cudaError_t gpu_snap(gpu_inflate_input_s *inputs,
                      int count                    = 1,
                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Interface for compressing data with LZ4
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] hadoop_framing Whether to prefix each compressed block with its big-endian
+ * uncompressed and compressed sizes (Hadoop codec), default false
+ * @param[in] stream CUDA stream to use, default 0
+ */
+cudaError_t gpu_lz4(gpu_inflate_input_s *inputs,
+                    gpu_inflate_status_s *outputs,
+                    int count                    = 1,
+                    bool hadoop_framing          = false,
+                    rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace io
 }  // namespace cudf
@@ -22,6 +22,8 @@
 
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 using cudf::host_span;
 
 namespace cudf {
@@ -40,9 +42,20 @@ enum {
   IO_UNCOMP_STREAM_TYPE_ZSTD    = 10,
 };
 
-std::vector<char> io_uncompress_single_h2d(void const* src, size_t src_size, int stream_type);
+std::vector<char> io_uncompress_single_h2d(void const* src,
+                                           size_t src_size,
+                                           int stream_type,
+                                           rmm::cuda_stream_view stream);
 
-std::vector<char> get_uncompressed_data(host_span<char const> data, std::string const& compression);
+/**
+ * @brief Uncompresses a gzip/zip/bzip2/xz file stored in host memory.
+ *
+ * All the members of a gzip file are uncompressed. The members of a BGZF (blocked gzip) file are
+ * uncompressed in parallel, on the GPU for large files and on CPU threads otherwise.
+ */
+std::vector<char> get_uncompressed_data(host_span<char const> data,
+                                        std::string const& compression,
+                                        rmm::cuda_stream_view stream);
 
 class HostDecompressor {
  public:
@@ -14,16 +14,27 @@
  * limitations under the License.
  */
 
+#include "gpuinflate.h"
 #include "io_uncomp.h"
-#include "unbz2.h"  // bz2 uncompress
+#include "unbz2.h"   // bz2 uncompress
+#include "unzstd.h"  // zstd uncompress
+
+#include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/device_buffer.hpp>
+
 #include <cuda_runtime.h>
 
 #include <string.h>  // memset
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 #include <zlib.h>  // uncompress
 
 using cudf::host_span;
@@ -239,46 +250,228 @@ int cpu_inflate(uint8_t *uncomp_data, size_t *destLen, const uint8_t *comp_data,
 }
 
 /**
- * @Brief Uncompresses a raw DEFLATE stream to a char vector.
+ * @Brief Uncompresses a raw DEFLATE stream to a char vector, after its first `dst_ofs` bytes.
  * The vector will be grown to match the uncompressed size
  * Optimized for the case where the initial size is the uncompressed
- * size truncated to 32-bit, and grows the buffer in 1GB increments.
+ * size truncated to 32-bit, and grows the buffer by doubling, in at most 1GB increments.
  *
- * @param dst[out] Destination vector
+ * @param dst[in,out] Destination vector
+ * @param dst_ofs[in] Offset in the vector of the uncompressed data
  * @param comp_data[in] Raw compressed data
  * @param comp_len[in] Compressed data size
+ * @param comp_used[out] Size of the DEFLATE stream, which may be followed by other data
  */
-int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t comp_len)
+int cpu_inflate_vector(std::vector<char> &dst,
+                       size_t dst_ofs,
+                       const uint8_t *comp_data,
+                       size_t comp_len,
+                       size_t *comp_used = nullptr)
 {
   int zerr;
   z_stream strm;
 
+  if (dst.size() < dst_ofs) { dst.resize(dst_ofs); }
   memset(&strm, 0, sizeof(strm));
   strm.next_in   = const_cast<Bytef *>(reinterpret_cast<Bytef const *>(comp_data));
   strm.avail_in  = comp_len;
   strm.total_in  = 0;
-  strm.next_out  = reinterpret_cast<uint8_t *>(dst.data());
-  strm.avail_out = dst.size();
+  strm.next_out  = reinterpret_cast<uint8_t *>(dst.data()) + dst_ofs;
+  strm.avail_out = dst.size() - dst_ofs;
   strm.total_out = 0;
   zerr           = inflateInit2(&strm, -15);  // -15 for raw data without GZIP headers
   if (zerr != 0) {
-    dst.resize(0);
+    dst.resize(dst_ofs);
     return zerr;
   }
   do {
     if (strm.avail_out == 0) {
-      dst.resize(strm.total_out + (1 << 30));
-      strm.avail_out = dst.size() - strm.total_out;
-      strm.next_out  = reinterpret_cast<uint8_t *>(dst.data()) + strm.total_out;
+      dst.resize(dst.size() + std::min<size_t>(std::max<size_t>(dst.size(), 1 << 20), 1 << 30));
+      strm.avail_out = dst.size() - dst_ofs - strm.total_out;
+      strm.next_out  = reinterpret_cast<uint8_t *>(dst.data()) + dst_ofs + strm.total_out;
     }
     zerr = inflate(&strm, Z_SYNC_FLUSH);
   } while ((zerr == Z_BUF_ERROR || zerr == Z_OK) && strm.avail_out == 0 &&
-           strm.total_out == dst.size());
-  dst.resize(strm.total_out);
+           dst_ofs + strm.total_out == dst.size());
+  dst.resize(dst_ofs + strm.total_out);
+  if (comp_used != nullptr) { *comp_used = strm.total_in; }
   inflateEnd(&strm);
   return (zerr == Z_STREAM_END) ? Z_OK : zerr;
 }
 
+namespace {
+
+// BGZF files that uncompress to at least this size are uncompressed on the GPU
+constexpr size_t gpu_inflate_min_size = 16 << 20;
+
+/**
+ * @brief Compressed data of a member of a gzip file
+ */
+struct gz_member_s {
+  const uint8_t *comp_data;
+  size_t comp_len;
+  size_t uncomp_len;
+};
+
+/**
+ * @brief Returns the size of a BGZF (blocked gzip) member, which is recorded in the `BC` extra
+ * subfield of its header, or zero if the header has no such subfield
+ */
+size_t bgzf_member_size(gz_archive_s const &gz)
+{
+  // Each subfield has a 2-byte identifier and a 2-byte data length, followed by the data
+  for (size_t pos = 0; pos + 4 <= gz.xlen;) {
+    auto const subfield = gz.fxtra + pos;
+    size_t const len    = subfield[2] | (subfield[3] << 8);
+    if (subfield[0] == 'B' && subfield[1] == 'C' && len == 2 && pos + 6 <= gz.xlen) {
+      return (subfield[4] | (subfield[5] << 8)) + 1;
+    }
+    pos += 4 + len;
+  }
+  return 0;
+}
+
+/**
+ * @brief Splits a BGZF file into its members, which are independent gzip streams of at most 64KB
+ *
+ * @return The members, or an empty vector if the data is not a complete BGZF file
+ */
+std::vector<gz_member_s> split_bgzf_members(const uint8_t *raw, size_t len)
+{
+  std::vector<gz_member_s> members;
+  for (size_t pos = 0; pos < len;) {
+    gz_archive_s gz;
+    // Only the header is parsed from the remaining data, as the member size is in the header
+    if (!ParseGZArchive(&gz, raw + pos, len - pos)) { return {}; }
+    auto const member_size = bgzf_member_size(gz);
+    if (member_size == 0 || member_size > len - pos ||
+        !ParseGZArchive(&gz, raw + pos, member_size)) {
+      return {};
+    }
+    members.push_back({gz.comp_data, gz.comp_len, gz.isize});
+    pos += member_size;
+  }
+  return members;
+}
+
+/**
+ * @brief Uncompresses the members of a BGZF file in parallel
+ *
+ * Large files are uncompressed on the GPU, and the members that the GPU fails to uncompress are
+ * uncompressed on CPU threads, like all the members of smaller files.
+ */
+std::vector<char> inflate_bgzf_members(std::vector<gz_member_s> const &members,
+                                       const uint8_t *raw,
+                                       size_t len,
+                                       rmm::cuda_stream_view stream)
+{
+  std::vector<size_t> offsets(members.size() + 1, 0);
+  std::vector<size_t> pending;
+  for (size_t i = 0; i < members.size(); ++i) {
+    offsets[i + 1] = offsets[i] + members[i].uncomp_len;
+    // Empty members, such as the end-of-file marker, have no data to uncompress
+    if (members[i].uncomp_len != 0) { pending.push_back(i); }
+  }
+  std::vector<char> dst(offsets.back());
+
+  if (dst.size() >= gpu_inflate_min_size) {
+    rmm::device_buffer d_raw(raw, len, stream);
+    rmm::device_buffer d_dst(dst.size(), stream);
+    hostdevice_vector<gpu_inflate_input_s> inflate_in(pending.size(), stream);
+    hostdevice_vector<gpu_inflate_status_s> inflate_out(pending.size(), stream);
+    for (size_t i = 0; i < pending.size(); ++i) {
+      auto const &member = members[pending[i]];
+      inflate_in[i].srcDevice =
+        static_cast<const uint8_t *>(d_raw.data()) + (member.comp_data - raw);
+      inflate_in[i].srcSize   = member.comp_len;
+      inflate_in[i].dstDevice = static_cast<uint8_t *>(d_dst.data()) + offsets[pending[i]];
+      inflate_in[i].dstSize   = member.uncomp_len;
+
+      inflate_out[i].bytes_written = 0;
+      inflate_out[i].status        = static_cast<uint32_t>(-1000);
+      inflate_out[i].reserved      = 0;
+    }
+    inflate_in.host_to_device(stream);
+    inflate_out.host_to_device(stream);
+    CUDA_TRY(gpuinflate(inflate_in.device_ptr(),
+                        inflate_out.device_ptr(),
+                        static_cast<int>(pending.size()),
+                        0,
+                        stream));
+    inflate_out.device_to_host(stream);
+    CUDA_TRY(cudaMemcpyAsync(
+      dst.data(), d_dst.data(), dst.size(), cudaMemcpyDeviceToHost, stream.value()));
+    stream.synchronize();
+
+    std::vector<size_t> failed;
+    for (size_t i = 0; i < pending.size(); ++i) {
+      if (inflate_out[i].status != 0 ||
+          inflate_out[i].bytes_written != members[pending[i]].uncomp_len) {
+        failed.push_back(pending[i]);
+      }
+    }
+    pending = std::move(failed);
+  }
+  if (pending.empty()) { return dst; }
+
+  auto inflate_member = [&](size_t i) {
+    size_t dst_len = members[i].uncomp_len;
+    auto const err = cpu_inflate(reinterpret_cast<uint8_t *>(dst.data()) + offsets[i],
+                                 &dst_len,
+                                 members[i].comp_data,
+                                 members[i].comp_len);
+    CUDF_EXPECTS(err == 0 && dst_len == members[i].uncomp_len, "Decompression: error in stream");
+  };
+  auto const num_threads = std::min<size_t>(
+    std::max<size_t>(std::thread::hardware_concurrency(), 1), pending.size());
+  if (num_threads == 1) {
+    for (auto i : pending) { inflate_member(i); }
+    return dst;
+  }
+
+  // Each thread uncompresses a contiguous range of members
+  detail::thread_pool pool(num_threads);
+  std::vector<std::future<void>> tasks;
+  auto const members_per_task = (pending.size() + num_threads - 1) / num_threads;
+  for (size_t begin = 0; begin < pending.size(); begin += members_per_task) {
+    auto const end = std::min(begin + members_per_task, pending.size());
+    tasks.push_back(pool.submit([&, begin, end]() {
+      for (auto i = begin; i < end; ++i) { inflate_member(pending[i]); }
+    }));
+  }
+  for (auto &task : tasks) { task.wait(); }
+  for (auto &task : tasks) { task.get(); }
+  return dst;
+}
+
+/**
+ * @brief Uncompresses the members of a gzip file one after the other
+ *
+ * The members must be uncompressed in order, as the end of a member is only found by
+ * uncompressing it. Trailing data that does not start a member is ignored, as gzip does.
+ *
+ * @param raw Gzip file
+ * @param len Size of the file
+ * @param uncomp_len Estimated uncompressed size
+ */
+std::vector<char> inflate_gz_members(const uint8_t *raw, size_t len, size_t uncomp_len)
+{
+  std::vector<char> dst(uncomp_len);
+  size_t dst_ofs = 0;
+  for (size_t pos = 0; pos + 1 < len && raw[pos] == 0x1f && raw[pos + 1] == 0x8b;) {
+    gz_archive_s gz;
+    CUDF_EXPECTS(ParseGZArchive(&gz, raw + pos, len - pos), "Decompression: error in stream");
+    size_t comp_used = 0;
+    CUDF_EXPECTS(cpu_inflate_vector(dst, dst_ofs, gz.comp_data, gz.comp_len, &comp_used) == 0,
+                 "Decompression: error in stream");
+    dst_ofs = dst.size();
+    // The member ends with the CRC32 and the size of its uncompressed data
+    pos = (gz.comp_data - raw) + comp_used + 8;
+  }
+  return dst;
+}
+
+}  // namespace
+
 /**
  * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
  *
@@ -288,10 +481,14 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
  * @param src[in] Pointer to the compressed data in system memory
  * @param src_size[in] The size of the compressed data, in bytes
  * @param stream_type[in] Type of compression of the input data
+ * @param stream[in] CUDA stream used to uncompress large BGZF files on the GPU
  *
  * @return Vector containing the uncompressed output
  */
-std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int stream_type)
+std::vector<char> io_uncompress_single_h2d(const void *src,
+                                           size_t src_size,
+                                           int stream_type,
+                                           rmm::cuda_stream_view stream)
 {
   const uint8_t *raw       = static_cast<const uint8_t *>(src);
   const uint8_t *comp_data = nullptr;
@@ -375,10 +572,16 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
                                        // ~4:1 compression for initial size
   }
 
-  if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP || stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
+  if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP) {
+    // The members of BGZF files can be located without uncompressing them
+    auto const members = split_bgzf_members(raw, src_size);
+    if (!members.empty()) { return inflate_bgzf_members(members, raw, src_size, stream); }
+    return inflate_gz_members(raw, src_size, uncomp_len);
+  }
+  if (stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
     // INFLATE
     std::vector<char> dst(uncomp_len);
-    CUDF_EXPECTS(cpu_inflate_vector(dst, comp_data, comp_len) == 0,
+    CUDF_EXPECTS(cpu_inflate_vector(dst, 0, comp_data, comp_len) == 0,
                  "Decompression: error in stream");
     return dst;
   }
@@ -416,11 +619,13 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
  *
  * @param[in] h_data Pointer to the csv data in host memory
  * @param[in] compression String describing the compression type
+ * @param[in] stream CUDA stream used to uncompress large BGZF files on the GPU
  *
  * @return Vector containing the output uncompressed data
  */
 std::vector<char> get_uncompressed_data(host_span<char const> const data,
-                                        std::string const &compression)
+                                        std::string const &compression,
+                                        rmm::cuda_stream_view stream)
 {
   int comp_type = IO_UNCOMP_STREAM_TYPE_INFER;
   if (compression == "gzip")
@@ -432,7 +637,7 @@ std::vector<char> get_uncompressed_data(host_span<char const> const data,
   else if (compression == "xz")
     comp_type = IO_UNCOMP_STREAM_TYPE_XZ;
 
-  return io_uncompress_single_h2d(data.data(), data.size(), comp_type);
+  return io_uncompress_single_h2d(data.data(), data.size(), comp_type, stream);
 }
 
 /**
@@ -557,6 +762,66 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/**
+ * @Brief LZ4 host decompressor class (raw blocks, without frame headers)
+ */
+class HostDecompressor_LZ4 : public HostDecompressor {
+ public:
+  HostDecompressor_LZ4() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    auto read_length = [&](size_t &pos, size_t &len) {
+      uint32_t b;
+      do {
+        if (pos >= srcLen) { return false; }
+        b = srcBytes[pos++];
+        len += b;
+      } while (b == 255);
+      return true;
+    };
+    if (!dstBytes || srcLen < 1) { return 0; }
+    size_t ip = 0, op = 0;
+    while (true) {
+      if (ip >= srcLen) { return 0; }
+      uint32_t const token = srcBytes[ip++];
+      size_t literal_len   = token >> 4;
+      if (literal_len == 15 && !read_length(ip, literal_len)) { return 0; }
+      if (literal_len > srcLen - ip || literal_len > dstLen - op) { return 0; }
+      memcpy(dstBytes + op, srcBytes + ip, literal_len);
+      ip += literal_len;
+      op += literal_len;
+      // The last sequence has no match
+      if (ip == srcLen) { return op; }
+      if (ip + 2 > srcLen) { return 0; }
+      size_t const offset = srcBytes[ip] | (srcBytes[ip + 1] << 8);
+      ip += 2;
+      size_t match_len = token & 0xf;
+      if (match_len == 15 && !read_length(ip, match_len)) { return 0; }
+      match_len += 4;
+      if (offset == 0 || offset > op || match_len > dstLen - op) { return 0; }
+      for (size_t i = 0; i < match_len; i++, op++) { dstBytes[op] = dstBytes[op - offset]; }
+    }
+  }
+};
+
+/**
+ * @Brief ZSTD host decompressor class
+ */
+class HostDecompressor_ZSTD : public HostDecompressor {
+ public:
+  HostDecompressor_ZSTD() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    return cpu_unzstd(srcBytes, srcLen, dstBytes, dstLen);
+  }
+};
+
 /**
  * @Brief CPU decompression class
  *
@@ -570,6 +835,8 @@ std::unique_ptr<HostDecompressor> HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: return std::make_unique<HostDecompressor_ZLIB>(true);
     case IO_UNCOMP_STREAM_TYPE_INFLATE: return std::make_unique<HostDecompressor_ZLIB>(false);
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: return std::make_unique<HostDecompressor_SNAPPY>();
+    case IO_UNCOMP_STREAM_TYPE_LZ4: return std::make_unique<HostDecompressor_LZ4>();
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: return std::make_unique<HostDecompressor_ZSTD>();
   }
   CUDF_FAIL("Unsupported compression type");
 }
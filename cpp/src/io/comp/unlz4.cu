@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpuinflate.h"
+
+#include <io/utilities/block_utils.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+constexpr int lz4_warps_per_block = 4;
+
+/**
+ * @brief Reads a variable-length extension of a 4-bit token length field
+ *
+ * @return false if the input ends before the length does
+ */
+static inline __device__ bool read_length_bytes(const uint8_t *src,
+                                                uint32_t src_len,
+                                                uint32_t &pos,
+                                                uint32_t &len)
+{
+  uint32_t b;
+  do {
+    if (pos >= src_len) { return false; }
+    b = src[pos++];
+    len += b;
+  } while (b == 255);
+  return true;
+}
+
+/**
+ * @brief Decodes one LZ4 block with a warp
+ *
+ * All threads of the warp parse the (broadcast) sequence headers and copy the sequence bytes
+ * cooperatively.
+ *
+ * @return Number of bytes written, or -1 if the block is invalid or doesn't fit in `dst`
+ */
+static __device__ int64_t lz4_decode_block(
+  const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len, uint32_t t)
+{
+  uint32_t ip = 0;
+  uint32_t op = 0;
+  while (true) {
+    if (ip >= src_len) { return -1; }
+    uint32_t const token = src[ip++];
+    uint32_t literal_len = token >> 4;
+    if (literal_len == 15 && !read_length_bytes(src, src_len, ip, literal_len)) { return -1; }
+    if (literal_len > src_len - ip || literal_len > dst_len - op) { return -1; }
+    for (uint32_t i = t; i < literal_len; i += 32) { dst[op + i] = src[ip + i]; }
+    ip += literal_len;
+    op += literal_len;
+    // The last sequence of a block has no match
+    if (ip == src_len) { break; }
+
+    if (ip + 2 > src_len) { return -1; }
+    uint32_t const offset = src[ip] | (src[ip + 1] << 8);
+    ip += 2;
+    uint32_t match_len = token & 0xf;
+    if (match_len == 15 && !read_length_bytes(src, src_len, ip, match_len)) { return -1; }
+    match_len += 4;
+    if (offset == 0 || offset > op || match_len > dst_len - op) { return -1; }
+    // Copy in steps of at most `offset` bytes so that overlapping matches read completed bytes
+    uint32_t const step = min(offset, 32);
+    __syncwarp();
+    for (uint32_t i = 0; i < match_len; i += step) {
+      if (t < step && i + t < match_len) { dst[op + i + t] = dst[op + i + t - offset]; }
+      __syncwarp();
+    }
+    op += match_len;
+  }
+  return op;
+}
+
+/**
+ * @brief Decodes a sequence of Hadoop-framed LZ4 blocks
+ *
+ * Each block is prefixed with its big-endian uncompressed and compressed sizes.
+ *
+ * @return Number of bytes written, or -1 if the input is not valid Hadoop-framed data
+ */
+static __device__ int64_t lz4_decode_hadoop(
+  const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len, uint32_t t)
+{
+  auto read_be32 = [](const uint8_t *p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+  };
+  uint32_t ip = 0;
+  uint32_t op = 0;
+  while (ip < src_len) {
+    if (src_len - ip < 8) { return -1; }
+    uint32_t const uncomp_len = read_be32(src + ip);
+    uint32_t const comp_len   = read_be32(src + ip + 4);
+    ip += 8;
+    if (comp_len > src_len - ip || uncomp_len > dst_len - op) { return -1; }
+    if (lz4_decode_block(src + ip, comp_len, dst + op, uncomp_len, t) != uncomp_len) {
+      return -1;
+    }
+    ip += comp_len;
+    op += uncomp_len;
+  }
+  return op;
+}
+
+/**
+ * @brief LZ4 decompression kernel
+ * See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Decompression status per block
+ * @param[in] count Number of blocks to decompress
+ * @param[in] hadoop_framing Whether the input may use Hadoop framing
+ */
+extern "C" __global__ void __launch_bounds__(32 * lz4_warps_per_block)
+  unlz4_kernel(gpu_inflate_input_s *inputs,
+               gpu_inflate_status_s *outputs,
+               int count,
+               bool hadoop_framing)
+{
+  int const strm_id = blockIdx.x * lz4_warps_per_block + (threadIdx.x / 32);
+  uint32_t const t  = threadIdx.x & 0x1f;
+  if (strm_id >= count) { return; }
+
+  auto const src     = static_cast<const uint8_t *>(inputs[strm_id].srcDevice);
+  auto const src_len = static_cast<uint32_t>(inputs[strm_id].srcSize);
+  auto const dst     = static_cast<uint8_t *>(inputs[strm_id].dstDevice);
+  auto const dst_len = static_cast<uint32_t>(inputs[strm_id].dstSize);
+  int64_t written    = -1;
+  if (hadoop_framing) { written = lz4_decode_hadoop(src, src_len, dst, dst_len, t); }
+  // Some writers use the Hadoop codec name for unframed blocks, so fall back to a single block
+  if (written < 0) { written = lz4_decode_block(src, src_len, dst, dst_len, t); }
+  if (t == 0) {
+    outputs[strm_id].bytes_written = (written < 0) ? 0 : written;
+    outputs[strm_id].status        = (written < 0) ? 1 : 0;
+    outputs[strm_id].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_unlz4(gpu_inflate_input_s *inputs,
+                               gpu_inflate_status_s *outputs,
+                               int count,
+                               bool hadoop_framing,
+                               rmm::cuda_stream_view stream)
+{
+  uint32_t count32 = (count > 0) ? count : 0;
+  dim3 dim_block(32 * lz4_warps_per_block, 1);  // 1 warp per stream
+  dim3 dim_grid((count32 + lz4_warps_per_block - 1) / lz4_warps_per_block, 1);
+  if (count32 > 0) {
+    unlz4_kernel<<<dim_grid, dim_block, 0, stream.value()>>>(
+      inputs, outputs, count32, hadoop_framing);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,891 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file unzstd.cu
+ *
+ * ZSTD decompression for GPU and CPU
+ *
+ * Zstandard Compression and the application/zstd Media Type
+ * https://tools.ietf.org/html/rfc8878
+ *
+ * The decoder is written once as host/device code: the GPU entry point decodes one input per
+ * thread, and the CPU entry point is used for the small metadata blocks that are decompressed on
+ * the host (ORC file footers, for example). Each decoder needs a `zstd_state_s` for its entropy
+ * tables; decoded Huffman literals are staged at the end of the destination buffer rather than in
+ * a separate 128KB buffer, so the per-input scratch memory stays small.
+ */
+
+#include "gpuinflate.h"
+#include "unzstd.h"
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace {
+constexpr uint32_t zstd_magic_number       = 0xFD2FB528;
+constexpr uint32_t zstd_skippable_magic    = 0x184D2A50;  // low 4 bits are user-defined
+constexpr uint32_t zstd_max_block_size     = 128 * 1024;
+constexpr uint32_t zstd_max_ll_log         = 9;
+constexpr uint32_t zstd_max_of_log         = 8;
+constexpr uint32_t zstd_max_ml_log         = 9;
+constexpr uint32_t zstd_max_weight_log     = 6;
+constexpr uint32_t zstd_max_huffman_log    = 11;
+constexpr uint32_t zstd_max_ll_code        = 35;
+constexpr uint32_t zstd_max_of_code        = 31;
+constexpr uint32_t zstd_max_ml_code        = 52;
+constexpr uint32_t zstd_max_fse_symbols    = 256;
+constexpr int zstd_block_size              = 128;   // threads per block (one input per thread)
+constexpr int zstd_max_concurrent_decoders = 2048;  // bounds the scratch memory size
+
+enum seq_table_kind { LITERAL_LENGTHS = 0, OFFSETS = 1, MATCH_LENGTHS = 2 };
+
+enum literals_block_type { RAW_LITERALS = 0, RLE_LITERALS, COMPRESSED_LITERALS, TREELESS_LITERALS };
+
+enum block_type { RAW_BLOCK = 0, RLE_BLOCK, COMPRESSED_BLOCK, RESERVED_BLOCK };
+
+enum symbol_compression_mode { PREDEFINED_MODE = 0, RLE_MODE, FSE_COMPRESSED_MODE, REPEAT_MODE };
+
+/**
+ * @brief FSE decoding table entry
+ */
+struct fse_entry_s {
+  uint16_t new_state;  // baseline of the next state
+  uint8_t symbol;      // decoded symbol
+  uint8_t num_bits;    // number of bits to read for the next state
+};
+
+/**
+ * @brief Huffman decoding table entry
+ */
+struct huffman_entry_s {
+  uint8_t symbol;
+  uint8_t num_bits;
+};
+
+/**
+ * @brief Decoder state for one ZSTD input
+ *
+ * The sequence and Huffman tables are kept across the blocks of a frame, since blocks can reuse
+ * the tables of the previous block (Repeat_Mode and Treeless_Literals_Block).
+ */
+struct zstd_state_s {
+  fse_entry_s seq_tables[3][1 << zstd_max_ll_log];  // indexed by `seq_table_kind`
+  huffman_entry_s huffman_table[1 << zstd_max_huffman_log];
+  fse_entry_s weight_table[1 << zstd_max_weight_log];
+  int16_t norm[zstd_max_fse_symbols];  // normalized counts of the FSE table being built
+  uint16_t symbol_next[zstd_max_fse_symbols];
+  uint8_t weights[zstd_max_fse_symbols];  // Huffman weights of the table being built
+  uint32_t seq_log[3];                    // accuracy log of each sequence table
+  uint32_t huffman_log;                   // 0 if there is no Huffman table yet
+  uint32_t rep[3];                        // repeat offsets
+  bool seq_valid[3];                      // whether each sequence table can be repeated
+};
+
+CUDA_HOST_DEVICE_CALLABLE uint32_t highbit32(uint32_t v)
+{
+  uint32_t n = 0;
+  while (v >>= 1) { n++; }
+  return n;
+}
+
+/**
+ * @brief Returns `n` bits (n <= 32) starting at bit `pos` of a little-endian byte buffer
+ *
+ * Bits before the start or past the end of the buffer read as zero.
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t get_bits(const uint8_t *base,
+                                            int64_t len,
+                                            int64_t pos,
+                                            uint32_t n)
+{
+  if (n == 0) { return 0; }
+  int64_t const first = (pos >= 0) ? (pos >> 3) : -((7 - pos) >> 3);
+  uint64_t v          = 0;
+  for (int i = 0; i < 6; i++) {
+    int64_t const idx = first + i;
+    if (idx >= 0 && idx < len) { v |= static_cast<uint64_t>(base[idx]) << (8 * i); }
+  }
+  return static_cast<uint32_t>((v >> (pos - first * 8)) & ((1ull << n) - 1));
+}
+
+/**
+ * @brief Reads a bitstream from the first byte forwards (FSE table descriptions)
+ */
+struct forward_bit_reader {
+  const uint8_t *base;
+  int64_t len;
+  int64_t pos;
+
+  CUDA_HOST_DEVICE_CALLABLE uint32_t peek(uint32_t n) const { return get_bits(base, len, pos, n); }
+  CUDA_HOST_DEVICE_CALLABLE uint32_t read(uint32_t n)
+  {
+    auto const v = peek(n);
+    pos += n;
+    return v;
+  }
+};
+
+/**
+ * @brief Reads a bitstream from the last byte backwards (Huffman and FSE encoded streams)
+ *
+ * The highest set bit of the last byte marks the start of the stream. `pos` becomes negative if
+ * more bits are read than the stream contains.
+ */
+struct backward_bit_reader {
+  const uint8_t *base;
+  int64_t len;
+  int64_t pos;
+
+  CUDA_HOST_DEVICE_CALLABLE bool init(const uint8_t *src, int64_t size)
+  {
+    base = src;
+    len  = size;
+    if (size <= 0 || src[size - 1] == 0) { return false; }
+    pos = (size - 1) * 8 + highbit32(src[size - 1]);
+    return true;
+  }
+  CUDA_HOST_DEVICE_CALLABLE uint32_t peek(uint32_t n) const
+  {
+    return get_bits(base, len, pos - n, n);
+  }
+  CUDA_HOST_DEVICE_CALLABLE uint32_t read(uint32_t n)
+  {
+    pos -= n;
+    return get_bits(base, len, pos, n);
+  }
+};
+
+/**
+ * @brief Decodes an FSE table description into `s->norm`
+ *
+ * @return Number of bytes consumed, or 0 if the description is invalid
+ */
+CUDA_HOST_DEVICE_CALLABLE size_t decode_fse_description(zstd_state_s *s,
+                                                        const uint8_t *src,
+                                                        size_t len,
+                                                        uint32_t max_log,
+                                                        uint32_t max_symbol,
+                                                        uint32_t *num_symbols,
+                                                        uint32_t *log)
+{
+  if (len < 1) { return 0; }
+  forward_bit_reader bits{src, static_cast<int64_t>(len), 0};
+  uint32_t const accuracy_log = bits.read(4) + 5;
+  if (accuracy_log > max_log) { return 0; }
+  int32_t remaining = (1 << accuracy_log) + 1;
+  int32_t threshold = 1 << accuracy_log;
+  uint32_t nbits    = accuracy_log + 1;
+  uint32_t symbol   = 0;
+  while (remaining > 1 && symbol <= max_symbol) {
+    int32_t const max = (2 * threshold - 1) - remaining;
+    auto const v      = static_cast<int32_t>(bits.peek(nbits));
+    int32_t count;
+    if ((v & (threshold - 1)) < max) {
+      count = v & (threshold - 1);
+      bits.pos += nbits - 1;
+    } else {
+      count = v & (2 * threshold - 1);
+      if (count >= threshold) { count -= max; }
+      bits.pos += nbits;
+    }
+    count--;  // -1 is a "less than 1" probability and takes one slot
+    remaining -= (count < 0) ? -count : count;
+    s->norm[symbol++] = count;
+    if (count == 0) {
+      uint32_t repeat;
+      do {
+        repeat = bits.read(2);
+        if (symbol + repeat > max_symbol + 1) { return 0; }
+        for (uint32_t i = 0; i < repeat; i++) { s->norm[symbol++] = 0; }
+      } while (repeat == 3);
+    }
+    while (remaining < threshold) {
+      nbits--;
+      threshold >>= 1;
+    }
+    if (bits.pos > bits.len * 8) { return 0; }
+  }
+  if (remaining != 1) { return 0; }
+  *num_symbols = symbol;
+  *log         = accuracy_log;
+  return static_cast<size_t>((bits.pos + 7) >> 3);
+}
+
+/**
+ * @brief Builds an FSE decoding table from the normalized counts in `s->norm`
+ *
+ * @return false if the counts are inconsistent
+ */
+CUDA_HOST_DEVICE_CALLABLE bool build_fse_table(zstd_state_s *s,
+                                               fse_entry_s *table,
+                                               uint32_t num_symbols,
+                                               uint32_t log)
+{
+  uint32_t const table_size = 1 << log;
+  uint32_t high_threshold   = table_size - 1;
+  for (uint32_t sym = 0; sym < num_symbols; sym++) {
+    if (s->norm[sym] == -1) {
+      table[high_threshold--].symbol = static_cast<uint8_t>(sym);
+      s->symbol_next[sym]            = 1;
+    } else {
+      s->symbol_next[sym] = s->norm[sym];
+    }
+  }
+  uint32_t const step = (table_size >> 1) + (table_size >> 3) + 3;
+  uint32_t position   = 0;
+  for (uint32_t sym = 0; sym < num_symbols; sym++) {
+    for (int32_t i = 0; i < s->norm[sym]; i++) {
+      table[position].symbol = static_cast<uint8_t>(sym);
+      do {
+        position = (position + step) & (table_size - 1);
+      } while (position > high_threshold);
+    }
+  }
+  if (position != 0) { return false; }
+  for (uint32_t u = 0; u < table_size; u++) {
+    uint32_t const next  = s->symbol_next[table[u].symbol]++;
+    uint32_t const nbits = log - highbit32(next);
+    table[u].num_bits    = static_cast<uint8_t>(nbits);
+    table[u].new_state   = static_cast<uint16_t>((next << nbits) - table_size);
+  }
+  return true;
+}
+
+/**
+ * @brief Decodes a Huffman tree description and builds `s->huffman_table`
+ *
+ * @return Number of bytes consumed, or 0 if the description is invalid
+ */
+CUDA_HOST_DEVICE_CALLABLE size_t decode_huffman_table(zstd_state_s *s,
+                                                      const uint8_t *src,
+                                                      size_t len)
+{
+  if (len < 1) { return 0; }
+  uint32_t const header = src[0];
+  uint32_t num_weights  = 0;
+  size_t consumed;
+  if (header >= 128) {
+    // Weights are stored directly as 4-bit values
+    num_weights = header - 127;
+    consumed    = 1 + (num_weights + 1) / 2;
+    if (consumed > len) { return 0; }
+    for (uint32_t i = 0; i < num_weights; i++) {
+      auto const b  = src[1 + i / 2];
+      s->weights[i] = (i & 1) ? (b & 0xf) : (b >> 4);
+    }
+  } else {
+    // Weights are FSE-compressed with two interleaved states
+    consumed = 1 + header;
+    if (consumed > len) { return 0; }
+    uint32_t num_symbols, log;
+    auto const desc_size = decode_fse_description(
+      s, src + 1, header, zstd_max_weight_log, zstd_max_fse_symbols - 1, &num_symbols, &log);
+    if (desc_size == 0 || desc_size >= header) { return 0; }
+    if (!build_fse_table(s, s->weight_table, num_symbols, log)) { return 0; }
+    backward_bit_reader bits;
+    if (!bits.init(src + 1 + desc_size, header - desc_size)) { return 0; }
+    uint32_t state1 = bits.read(log);
+    uint32_t state2 = bits.read(log);
+    auto const *t   = s->weight_table;
+    while (true) {
+      if (num_weights + 2 > zstd_max_fse_symbols - 1) { return 0; }
+      s->weights[num_weights++] = t[state1].symbol;
+      state1                    = t[state1].new_state + bits.read(t[state1].num_bits);
+      if (bits.pos < 0) {
+        s->weights[num_weights++] = t[state2].symbol;
+        break;
+      }
+      s->weights[num_weights++] = t[state2].symbol;
+      state2                    = t[state2].new_state + bits.read(t[state2].num_bits);
+      if (bits.pos < 0) {
+        s->weights[num_weights++] = t[state1].symbol;
+        break;
+      }
+    }
+  }
+
+  // The weight of the last symbol is implied by the others: the total must be a power of 2
+  uint32_t total = 0;
+  for (uint32_t i = 0; i < num_weights; i++) {
+    if (s->weights[i] > zstd_max_huffman_log) { return 0; }
+    if (s->weights[i] > 0) { total += (1 << s->weights[i]) >> 1; }
+  }
+  if (total == 0) { return 0; }
+  uint32_t const max_bits = highbit32(total) + 1;
+  if (max_bits > zstd_max_huffman_log) { return 0; }
+  uint32_t const rest = (1 << max_bits) - total;
+  if (rest & (rest - 1)) { return 0; }
+  s->weights[num_weights++] = static_cast<uint8_t>(highbit32(rest) + 1);
+
+  // Symbols with the lowest weight (longest codes) come first, in symbol order within a weight
+  uint32_t rank_start[zstd_max_huffman_log + 2] = {0};
+  for (uint32_t i = 0; i < num_weights; i++) { rank_start[s->weights[i]]++; }
+  uint32_t next_start = 0;
+  for (uint32_t w = 1; w <= max_bits; w++) {
+    uint32_t const current = next_start;
+    next_start += rank_start[w] << (w - 1);
+    rank_start[w] = current;
+  }
+  for (uint32_t sym = 0; sym < num_weights; sym++) {
+    uint32_t const w = s->weights[sym];
+    if (w == 0) { continue; }
+    uint32_t const length = (1 << w) >> 1;
+    huffman_entry_s const entry{static_cast<uint8_t>(sym), static_cast<uint8_t>(max_bits + 1 - w)};
+    for (uint32_t u = rank_start[w]; u < rank_start[w] + length; u++) {
+      s->huffman_table[u] = entry;
+    }
+    rank_start[w] += length;
+  }
+  s->huffman_log = max_bits;
+  return consumed;
+}
+
+/**
+ * @brief Decodes one Huffman-coded literals stream of `count` symbols
+ */
+CUDA_HOST_DEVICE_CALLABLE bool decode_huffman_stream(zstd_state_s const *s,
+                                                     const uint8_t *src,
+                                                     size_t len,
+                                                     uint8_t *out,
+                                                     size_t count)
+{
+  backward_bit_reader bits;
+  if (!bits.init(src, len)) { return false; }
+  auto const log = s->huffman_log;
+  for (size_t i = 0; i < count; i++) {
+    auto const &entry = s->huffman_table[bits.peek(log)];
+    out[i]            = entry.symbol;
+    bits.pos -= entry.num_bits;
+  }
+  return bits.pos == 0;
+}
+
+/**
+ * @brief Decodes the literals section of a compressed block
+ *
+ * Raw literals are used in place; RLE and Huffman-coded literals are written to the end of the
+ * destination buffer, which sequence execution only reaches once all literals have been copied.
+ *
+ * @return Number of bytes consumed, or 0 if the section is invalid
+ */
+CUDA_HOST_DEVICE_CALLABLE size_t decode_literals(zstd_state_s *s,
+                                                 const uint8_t *src,
+                                                 size_t len,
+                                                 uint8_t *out,
+                                                 uint8_t *out_end,
+                                                 const uint8_t **literals,
+                                                 size_t *num_literals)
+{
+  if (len < 1) { return 0; }
+  uint32_t const type        = src[0] & 3;
+  uint32_t const size_format = (src[0] >> 2) & 3;
+  if (type == RAW_LITERALS || type == RLE_LITERALS) {
+    size_t header_size;
+    size_t regenerated_size;
+    switch (size_format) {
+      case 1:
+        header_size      = 2;
+        regenerated_size = (len < 2) ? 0 : (src[0] >> 4) + (src[1] << 4);
+        break;
+      case 3:
+        header_size      = 3;
+        regenerated_size = (len < 3) ? 0 : (src[0] >> 4) + (src[1] << 4) + (src[2] << 12);
+        break;
+      default: header_size = 1; regenerated_size = src[0] >> 3; break;
+    }
+    if (header_size > len || regenerated_size > static_cast<size_t>(out_end - out)) { return 0; }
+    *num_literals = regenerated_size;
+    if (type == RAW_LITERALS) {
+      if (header_size + regenerated_size > len) { return 0; }
+      *literals = src + header_size;
+      return header_size + regenerated_size;
+    }
+    if (header_size + 1 > len) { return 0; }
+    auto const dst = out_end - regenerated_size;
+    for (size_t i = 0; i < regenerated_size; i++) { dst[i] = src[header_size]; }
+    *literals = dst;
+    return header_size + 1;
+  }
+
+  size_t const header_size = (size_format < 2) ? 3 : size_format + 2;
+  if (header_size > len) { return 0; }
+  uint64_t v = 0;
+  for (size_t i = 0; i < header_size; i++) { v |= static_cast<uint64_t>(src[i]) << (8 * i); }
+  size_t regenerated_size;
+  size_t compressed_size;
+  switch (size_format) {
+    case 2:
+      regenerated_size = (v >> 4) & 0x3fff;
+      compressed_size  = (v >> 18) & 0x3fff;
+      break;
+    case 3:
+      regenerated_size = (v >> 4) & 0x3ffff;
+      compressed_size  = (v >> 22) & 0x3ffff;
+      break;
+    default:
+      regenerated_size = (v >> 4) & 0x3ff;
+      compressed_size  = (v >> 14) & 0x3ff;
+      break;
+  }
+  if (header_size + compressed_size > len || regenerated_size > zstd_max_block_size ||
+      regenerated_size > static_cast<size_t>(out_end - out)) {
+    return 0;
+  }
+  const uint8_t *cur = src + header_size;
+  size_t remaining   = compressed_size;
+  if (type == COMPRESSED_LITERALS) {
+    auto const table_size = decode_huffman_table(s, cur, remaining);
+    if (table_size == 0 || table_size > remaining) { return 0; }
+    cur += table_size;
+    remaining -= table_size;
+  } else if (s->huffman_log == 0) {
+    return 0;
+  }
+  auto const dst = out_end - regenerated_size;
+  if (size_format == 0) {
+    if (!decode_huffman_stream(s, cur, remaining, dst, regenerated_size)) { return 0; }
+  } else {
+    if (remaining < 6) { return 0; }
+    size_t const segment_size = (regenerated_size + 3) / 4;
+    if (3 * segment_size > regenerated_size) { return 0; }
+    size_t stream_sizes[4];
+    size_t jump_total = 0;
+    for (int i = 0; i < 3; i++) {
+      stream_sizes[i] = cur[2 * i] | (cur[2 * i + 1] << 8);
+      jump_total += stream_sizes[i];
+    }
+    if (jump_total + 6 > remaining) { return 0; }
+    stream_sizes[3] = remaining - 6 - jump_total;
+    cur += 6;
+    for (int i = 0; i < 4; i++) {
+      size_t const count = (i < 3) ? segment_size : regenerated_size - 3 * segment_size;
+      if (!decode_huffman_stream(s, cur, stream_sizes[i], dst + i * segment_size, count)) {
+        return 0;
+      }
+      cur += stream_sizes[i];
+    }
+  }
+  *literals     = dst;
+  *num_literals = regenerated_size;
+  return header_size + compressed_size;
+}
+
+/**
+ * @brief Sets up the decoding table of one sequence symbol type
+ *
+ * @return Number of bytes consumed, or -1 if the table description is invalid
+ */
+CUDA_HOST_DEVICE_CALLABLE int64_t setup_sequence_table(
+  zstd_state_s *s, seq_table_kind kind, uint32_t mode, const uint8_t *src, size_t len)
+{
+  uint32_t const max_log    = (kind == LITERAL_LENGTHS) ? zstd_max_ll_log
+                              : (kind == OFFSETS)       ? zstd_max_of_log
+                                                        : zstd_max_ml_log;
+  uint32_t const max_symbol = (kind == LITERAL_LENGTHS) ? zstd_max_ll_code
+                              : (kind == OFFSETS)       ? zstd_max_of_code
+                                                        : zstd_max_ml_code;
+  auto const table     = s->seq_tables[kind];
+  int64_t consumed     = 0;
+  uint32_t num_symbols = 0;
+  uint32_t log         = 0;
+  switch (mode) {
+    case PREDEFINED_MODE: {
+      // Default distributions (RFC 8878, section 3.1.1.3.2.2)
+      const int16_t ll_default[] = {4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2,
+                                    2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1, -1, -1, -1, -1};
+      const int16_t of_default[] = {1, 1, 1, 1, 1, 1, 2, 2, 2, 1,  1,  1,  1,  1, 1,
+                                    1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+      const int16_t ml_default[] = {1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,  1,  1,  1,
+                                    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  1,  1,  1,
+                                    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1};
+      const int16_t *norm = (kind == LITERAL_LENGTHS) ? ll_default
+                            : (kind == OFFSETS)       ? of_default
+                                                      : ml_default;
+      num_symbols         = (kind == LITERAL_LENGTHS) ? 36 : (kind == OFFSETS) ? 29 : 53;
+      log                 = (kind == OFFSETS) ? 5 : 6;
+      for (uint32_t i = 0; i < num_symbols; i++) { s->norm[i] = norm[i]; }
+      if (!build_fse_table(s, table, num_symbols, log)) { return -1; }
+      break;
+    }
+    case RLE_MODE:
+      if (len < 1 || src[0] > max_symbol) { return -1; }
+      table[0] = fse_entry_s{0, src[0], 0};
+      consumed = 1;
+      break;
+    case FSE_COMPRESSED_MODE: {
+      auto const desc_size =
+        decode_fse_description(s, src, len, max_log, max_symbol, &num_symbols, &log);
+      if (desc_size == 0 || desc_size > len) { return -1; }
+      if (!build_fse_table(s, table, num_symbols, log)) { return -1; }
+      consumed = desc_size;
+      break;
+    }
+    default:
+      if (!s->seq_valid[kind]) { return -1; }
+      return 0;
+  }
+  s->seq_log[kind]   = log;
+  s->seq_valid[kind] = true;
+  return consumed;
+}
+
+CUDA_HOST_DEVICE_CALLABLE uint32_t literal_length_base(uint32_t code)
+{
+  if (code < 16) { return code; }
+  if (code < 20) { return 16 + 2 * (code - 16); }
+  if (code < 22) { return 24 + 4 * (code - 20); }
+  if (code < 24) { return 32 + 8 * (code - 22); }
+  if (code == 24) { return 48; }
+  return 1 << (code - 19);
+}
+
+CUDA_HOST_DEVICE_CALLABLE uint32_t literal_length_bits(uint32_t code)
+{
+  if (code < 16) { return 0; }
+  if (code < 20) { return 1; }
+  if (code < 22) { return 2; }
+  if (code < 24) { return 3; }
+  if (code == 24) { return 4; }
+  return code - 19;
+}
+
+CUDA_HOST_DEVICE_CALLABLE uint32_t match_length_base(uint32_t code)
+{
+  if (code < 32) { return code + 3; }
+  if (code < 36) { return 35 + 2 * (code - 32); }
+  if (code < 38) { return 43 + 4 * (code - 36); }
+  if (code < 40) { return 51 + 8 * (code - 38); }
+  if (code < 42) { return 67 + 16 * (code - 40); }
+  if (code == 42) { return 99; }
+  return (1 << (code - 36)) + 3;
+}
+
+CUDA_HOST_DEVICE_CALLABLE uint32_t match_length_bits(uint32_t code)
+{
+  if (code < 32) { return 0; }
+  if (code < 36) { return 1; }
+  if (code < 38) { return 2; }
+  if (code < 40) { return 3; }
+  if (code < 42) { return 4; }
+  if (code == 42) { return 5; }
+  return code - 36;
+}
+
+/**
+ * @brief Decodes and executes the sequences section of a compressed block
+ *
+ * @return Number of bytes written at `out`, or -1 if the section is invalid
+ */
+CUDA_HOST_DEVICE_CALLABLE int64_t decode_sequences(zstd_state_s *s,
+                                                   const uint8_t *src,
+                                                   size_t len,
+                                                   const uint8_t *literals,
+                                                   size_t num_literals,
+                                                   uint8_t *out_base,
+                                                   uint8_t *out,
+                                                   uint8_t *out_end)
+{
+  if (len < 1) { return -1; }
+  uint32_t num_sequences = src[0];
+  size_t pos             = 1;
+  if (num_sequences >= 128) {
+    if (num_sequences < 255) {
+      if (len < 2) { return -1; }
+      num_sequences = ((num_sequences - 128) << 8) + src[1];
+      pos           = 2;
+    } else {
+      if (len < 3) { return -1; }
+      num_sequences = src[1] + (src[2] << 8) + 0x7f00;
+      pos           = 3;
+    }
+  }
+
+  uint8_t *dst       = out;
+  size_t lit_pos     = 0;
+  auto copy_literals = [&](size_t count) {
+    for (size_t i = 0; i < count; i++) { dst[i] = literals[lit_pos + i]; }
+    dst += count;
+    lit_pos += count;
+  };
+
+  if (num_sequences > 0) {
+    if (pos >= len) { return -1; }
+    uint32_t const modes = src[pos++];
+    if (modes & 3) { return -1; }
+    uint32_t const table_modes[3] = {modes >> 6, (modes >> 4) & 3, (modes >> 2) & 3};
+    for (int kind = LITERAL_LENGTHS; kind <= MATCH_LENGTHS; kind++) {
+      auto const table_size = setup_sequence_table(
+        s, static_cast<seq_table_kind>(kind), table_modes[kind], src + pos, len - pos);
+      if (table_size < 0) { return -1; }
+      pos += table_size;
+    }
+
+    backward_bit_reader bits;
+    if (!bits.init(src + pos, static_cast<int64_t>(len - pos))) { return -1; }
+    auto const *ll_table = s->seq_tables[LITERAL_LENGTHS];
+    auto const *of_table = s->seq_tables[OFFSETS];
+    auto const *ml_table = s->seq_tables[MATCH_LENGTHS];
+    uint32_t ll_state    = bits.read(s->seq_log[LITERAL_LENGTHS]);
+    uint32_t of_state    = bits.read(s->seq_log[OFFSETS]);
+    uint32_t ml_state    = bits.read(s->seq_log[MATCH_LENGTHS]);
+    for (uint32_t i = 0; i < num_sequences; i++) {
+      uint32_t const ll_code = ll_table[ll_state].symbol;
+      uint32_t const of_code = of_table[of_state].symbol;
+      uint32_t const ml_code = ml_table[ml_state].symbol;
+      if (ll_code > zstd_max_ll_code || ml_code > zstd_max_ml_code) { return -1; }
+      // Extra bits are read in offset, match length, literal length order
+      uint32_t const offset_value = (1u << of_code) + bits.read(of_code);
+      size_t const match_length =
+        match_length_base(ml_code) + bits.read(match_length_bits(ml_code));
+      size_t const literal_length =
+        literal_length_base(ll_code) + bits.read(literal_length_bits(ll_code));
+      if (i + 1 < num_sequences) {
+        ll_state = ll_table[ll_state].new_state + bits.read(ll_table[ll_state].num_bits);
+        ml_state = ml_table[ml_state].new_state + bits.read(ml_table[ml_state].num_bits);
+        of_state = of_table[of_state].new_state + bits.read(of_table[of_state].num_bits);
+      }
+      if (bits.pos < 0) { return -1; }
+
+      size_t offset;
+      if (offset_value > 3) {
+        offset    = offset_value - 3;
+        s->rep[2] = s->rep[1];
+        s->rep[1] = s->rep[0];
+        s->rep[0] = static_cast<uint32_t>(offset);
+      } else {
+        // A literal length of zero shifts the repeat offset codes by one
+        uint32_t const idx = offset_value - 1 + (literal_length == 0 ? 1 : 0);
+        if (idx == 0) {
+          offset = s->rep[0];
+        } else {
+          offset = (idx == 3) ? s->rep[0] - 1 : s->rep[idx];
+          if (idx > 1) { s->rep[2] = s->rep[1]; }
+          s->rep[1] = s->rep[0];
+          s->rep[0] = static_cast<uint32_t>(offset);
+        }
+      }
+
+      // The remaining literals must still fit after the match; this also guarantees that
+      // writes never overtake literals staged at the end of the destination buffer
+      if (literal_length > num_literals - lit_pos ||
+          static_cast<size_t>(out_end - dst) <
+            literal_length + match_length + (num_literals - lit_pos - literal_length)) {
+        return -1;
+      }
+      copy_literals(literal_length);
+      if (offset == 0 || offset > static_cast<size_t>(dst - out_base)) { return -1; }
+      for (size_t k = 0; k < match_length; k++) { dst[k] = dst[k - offset]; }
+      dst += match_length;
+    }
+    if (bits.pos != 0) { return -1; }
+  }
+  copy_literals(num_literals - lit_pos);
+  return dst - out;
+}
+
+/**
+ * @brief Decodes one ZSTD frame (or skips one skippable frame)
+ *
+ * @return Number of bytes written at `out`, or -1 if the frame is invalid
+ */
+CUDA_HOST_DEVICE_CALLABLE int64_t decode_frame(zstd_state_s *s,
+                                               const uint8_t *src,
+                                               size_t len,
+                                               size_t *consumed,
+                                               uint8_t *out_base,
+                                               uint8_t *out,
+                                               uint8_t *out_end)
+{
+  if (len < 8) { return -1; }
+  uint32_t const magic =
+    src[0] | (src[1] << 8) | (src[2] << 16) | (static_cast<uint32_t>(src[3]) << 24);
+  if ((magic & ~0xfu) == zstd_skippable_magic) {
+    uint32_t const frame_size =
+      src[4] | (src[5] << 8) | (src[6] << 16) | (static_cast<uint32_t>(src[7]) << 24);
+    if (frame_size > len - 8) { return -1; }
+    *consumed = 8 + frame_size;
+    return 0;
+  }
+  if (magic != zstd_magic_number) { return -1; }
+
+  uint32_t const descriptor = src[4];
+  if (descriptor & 0x08) { return -1; }  // reserved bit
+  uint32_t const fcs_flag     = descriptor >> 6;
+  bool const single_segment   = (descriptor >> 5) & 1;
+  bool const has_checksum     = (descriptor >> 2) & 1;
+  uint32_t const dict_id_size = (descriptor & 3) == 3 ? 4 : (descriptor & 3);
+  uint32_t const fcs_size     = (fcs_flag == 0) ? (single_segment ? 1 : 0) : (1 << fcs_flag);
+  size_t pos                  = 5 + (single_segment ? 0 : 1);
+  if (pos + dict_id_size + fcs_size > len) { return -1; }
+  for (uint32_t i = 0; i < dict_id_size; i++) {
+    if (src[pos + i] != 0) { return -1; }  // dictionaries are not supported
+  }
+  pos += dict_id_size + fcs_size;
+
+  s->rep[0]      = 1;
+  s->rep[1]      = 4;
+  s->rep[2]      = 8;
+  s->huffman_log = 0;
+  for (int i = 0; i < 3; i++) { s->seq_valid[i] = false; }
+
+  uint8_t *dst = out;
+  bool last_block;
+  do {
+    if (pos + 3 > len) { return -1; }
+    uint32_t const header = src[pos] | (src[pos + 1] << 8) | (src[pos + 2] << 16);
+    last_block            = header & 1;
+    uint32_t const type   = (header >> 1) & 3;
+    size_t const size     = header >> 3;
+    pos += 3;
+    switch (type) {
+      case RAW_BLOCK:
+        if (size > len - pos || size > static_cast<size_t>(out_end - dst)) { return -1; }
+        for (size_t i = 0; i < size; i++) { dst[i] = src[pos + i]; }
+        dst += size;
+        pos += size;
+        break;
+      case RLE_BLOCK:
+        if (pos + 1 > len || size > static_cast<size_t>(out_end - dst)) { return -1; }
+        for (size_t i = 0; i < size; i++) { dst[i] = src[pos]; }
+        dst += size;
+        pos += 1;
+        break;
+      case COMPRESSED_BLOCK: {
+        if (size > len - pos || size > zstd_max_block_size) { return -1; }
+        const uint8_t *literals = nullptr;
+        size_t num_literals     = 0;
+        auto const literals_size =
+          decode_literals(s, src + pos, size, dst, out_end, &literals, &num_literals);
+        if (literals_size == 0) { return -1; }
+        auto const written = decode_sequences(s,
+                                              src + pos + literals_size,
+                                              size - literals_size,
+                                              literals,
+                                              num_literals,
+                                              out_base,
+                                              dst,
+                                              out_end);
+        if (written < 0) { return -1; }
+        dst += written;
+        pos += size;
+        break;
+      }
+      default: return -1;
+    }
+  } while (!last_block);
+  if (has_checksum) {
+    // The content checksum is not verified
+    if (pos + 4 > len) { return -1; }
+    pos += 4;
+  }
+  *consumed = pos;
+  return dst - out;
+}
+
+/**
+ * @brief Decompresses a sequence of ZSTD frames
+ *
+ * @return Number of bytes written, or -1 if the input is invalid
+ */
+CUDA_HOST_DEVICE_CALLABLE int64_t zstd_decompress(
+  zstd_state_s *s, const uint8_t *src, size_t src_size, uint8_t *dst, size_t dst_size)
+{
+  size_t pos         = 0;
+  uint8_t *out       = dst;
+  uint8_t *const end = dst + dst_size;
+  while (pos < src_size) {
+    size_t consumed    = 0;
+    auto const written = decode_frame(s, src + pos, src_size - pos, &consumed, out, out, end);
+    if (written < 0) { return -1; }
+    out += written;
+    pos += consumed;
+  }
+  return out - dst;
+}
+
+/**
+ * @brief ZSTD decompression kernel
+ *
+ * Each thread decodes inputs `slot, slot + num_slots, ...` with its own decoder state.
+ *
+ * @param[in] inputs Source and destination information per block
+ * @param[out] outputs Decompression status per block
+ * @param[in] states Decoder states, one per slot
+ * @param[in] num_slots Number of decoder states
+ * @param[in] count Number of blocks to decompress
+ */
+__global__ void __launch_bounds__(zstd_block_size) unzstd_kernel(gpu_inflate_input_s *inputs,
+                                                                 gpu_inflate_status_s *outputs,
+                                                                 zstd_state_s *states,
+                                                                 int num_slots,
+                                                                 int count)
+{
+  int const slot = blockIdx.x * zstd_block_size + threadIdx.x;
+  if (slot >= num_slots) { return; }
+  for (int i = slot; i < count; i += num_slots) {
+    auto const written = zstd_decompress(&states[slot],
+                                         static_cast<const uint8_t *>(inputs[i].srcDevice),
+                                         inputs[i].srcSize,
+                                         static_cast<uint8_t *>(inputs[i].dstDevice),
+                                         inputs[i].dstSize);
+    outputs[i].bytes_written = (written < 0) ? 0 : written;
+    outputs[i].status        = (written < 0) ? 1 : 0;
+    outputs[i].reserved      = 0;
+  }
+}
+
+}  // namespace
+
+size_t __host__ get_gpu_unzstd_scratch_size(int max_num_inputs)
+{
+  auto const num_slots = std::min(std::max(max_num_inputs, 1), zstd_max_concurrent_decoders);
+  return num_slots * sizeof(zstd_state_s);
+}
+
+cudaError_t __host__ gpu_unzstd(gpu_inflate_input_s *inputs,
+                                gpu_inflate_status_s *outputs,
+                                void *scratch,
+                                size_t scratch_size,
+                                int count,
+                                rmm::cuda_stream_view stream)
+{
+  if (count <= 0) { return cudaSuccess; }
+  int const num_slots = std::min<size_t>(scratch_size / sizeof(zstd_state_s), count);
+  if (num_slots == 0) { return cudaErrorLaunchOutOfResources; }
+  dim3 dim_block(zstd_block_size, 1);
+  dim3 dim_grid((num_slots + zstd_block_size - 1) / zstd_block_size, 1);
+  unzstd_kernel<<<dim_grid, dim_block, 0, stream.value()>>>(
+    inputs, outputs, static_cast<zstd_state_s *>(scratch), num_slots, count);
+  return cudaSuccess;
+}
+
+size_t cpu_unzstd(const uint8_t *src, size_t src_size, uint8_t *dst, size_t dst_size)
+{
+  if (!dst || !src) { return 0; }
+  auto state         = std::make_unique<zstd_state_s>();
+  auto const written = zstd_decompress(state.get(), src, src_size, dst, dst_size);
+  return (written < 0) ? 0 : static_cast<size_t>(written);
+}
+
+}  // namespace io
+}  // namespace cudf
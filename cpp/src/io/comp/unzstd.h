@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Decompresses one or more concatenated ZSTD frames on the host
+ *
+ * Uses the same decoder as `gpu_unzstd`; dictionaries are not supported.
+ *
+ * @param[in] src Compressed data
+ * @param[in] src_size Size in bytes of the compressed data
+ * @param[out] dst Destination buffer for the uncompressed data
+ * @param[in] dst_size Size in bytes of the destination buffer
+ *
+ * @return Number of bytes written to `dst`, or 0 if the input is invalid or doesn't fit
+ */
+size_t cpu_unzstd(const uint8_t *src, size_t src_size, uint8_t *dst, size_t dst_size);
+
+}  // namespace io
+}  // namespace cudf
@@ -23,6 +23,7 @@
 
 #include <io/comp/io_uncomp.h>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/pinned_host_pool.hpp>
 #include <io/utilities/type_conversion.cuh>
 
 #include <cudf/detail/utilities/cuda.cuh>
@@ -32,11 +33,14 @@
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <algorithm>
+#include <array>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <tuple>
 #include <unordered_map>
@@ -195,10 +199,11 @@ void erase_except_last(C &container, rmm::cuda_stream_view stream)
 }
 
 std::pair<rmm::device_uvector<char>, reader::impl::selected_rows_offsets>
-reader::impl::select_data_and_row_offsets(rmm::cuda_stream_view stream)
+reader::impl::select_data_and_row_offsets(size_t range_offset,
+                                          size_t range_size,
+                                          thrust::optional<csv_parser_state> range_start_state,
+                                          rmm::cuda_stream_view stream)
 {
-  auto range_offset  = opts_.get_byte_range_offset();
-  auto range_size    = opts_.get_byte_range_size();
   auto skip_rows     = opts_.get_skiprows();
   auto skip_end_rows = opts_.get_skipfooter();
   auto num_rows      = opts_.get_nrows();
@@ -207,23 +212,16 @@ reader::impl::select_data_and_row_offsets(rmm::cuda_stream_view stream)
     CUDF_EXPECTS(compression_type_ == "none",
                  "Reading compressed data using `byte range` is unsupported");
   }
-  size_t map_range_size = 0;
-  if (range_size != 0) {
-    const auto num_columns = std::max(opts_.get_names().size(), opts_.get_dtypes().size());
-    map_range_size         = range_size + calculateMaxRowSize(num_columns);
-  }
-
-  // Support delayed opening of the file if using memory mapping datasource
-  // This allows only mapping of a subset of the file if using byte range
-  if (source_ == nullptr) {
-    assert(!filepath_.empty());
-    source_ = datasource::create(filepath_, range_offset, map_range_size);
-  }
+  auto const map_range_size = get_map_range_size(range_size);
+  open_source(map_range_size);
+  // Chunks are read through the prefetching source, so that the next chunk is read in the
+  // background
+  auto *const source = (prefetch_source_ != nullptr) ? prefetch_source_.get() : source_.get();
 
   // Transfer source data to GPU
   if (!source_->is_empty()) {
     auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
-    auto buffer    = source_->host_read(range_offset, data_size);
+    auto buffer    = source->host_read(range_offset, data_size);
 
     auto h_data = host_span<char const>(  //
       reinterpret_cast<const char *>(buffer->data()),
@@ -232,24 +230,34 @@ reader::impl::select_data_and_row_offsets(rmm::cuda_stream_view stream)
     std::vector<char> h_uncomp_data_owner;
 
     if (compression_type_ != "none") {
-      h_uncomp_data_owner = get_uncompressed_data(h_data, compression_type_);
+      h_uncomp_data_owner = get_uncompressed_data(h_data, compression_type_, stream);
       h_data              = h_uncomp_data_owner;
     }
     // None of the parameters for row selection is used, we are parsing the entire file
     const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
                                  skip_end_rows <= 0 && num_rows == -1;
 
-    // With byte range, find the start of the first data row
-    size_t const data_start_offset = (range_offset != 0) ? find_first_row_start(h_data) : 0;
+    // With byte range, rows start after the first character (the previous range reads the row
+    // that starts at the offset). Whether the terminators are within quotes depends on the parser
+    // state at that point, which is provided, inferred from the data on request, or NONE
+    size_t const data_start_offset = (range_offset != 0) ? 1 : 0;
+    auto const start_state = [&] {
+      if (range_offset == 0) { return csv_parser_state::NONE; }
+      if (range_start_state.has_value()) { return range_start_state.value(); }
+      return opts_.is_enabled_infer_byte_range_start_state() ? infer_byte_range_start_state(h_data)
+                                                             : csv_parser_state::NONE;
+    }();
 
     // TODO: Allow parsing the header outside the mapped range
-    CUDF_EXPECTS((range_offset == 0 || opts_.get_header() < 0),
+    // The chunked reader only parses the header in the first chunk
+    CUDF_EXPECTS((opts_.get_byte_range_offset() == 0 || opts_.get_header() < 0),
                  "byte_range offset with header not supported");
 
     // Gather row offsets
     auto data_row_offsets =
       load_data_and_gather_row_offsets(h_data,
                                        data_start_offset,
+                                       start_state,
                                        (range_size) ? range_size : h_data.size(),
                                        (skip_rows > 0) ? skip_rows : 0,
                                        num_rows,
@@ -267,13 +275,27 @@ reader::impl::select_data_and_row_offsets(rmm::cuda_stream_view stream)
 
 table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
 {
-  auto const data_row_offsets = select_data_and_row_offsets(stream);
+  auto const data_row_offsets = select_data_and_row_offsets(opts_.get_byte_range_offset(),
+                                                            opts_.get_byte_range_size(),
+                                                            opts_.get_byte_range_start_state(),
+                                                            stream);
   auto const &data            = data_row_offsets.first;
   auto const &row_offsets     = data_row_offsets.second;
 
   // Exclude the end-of-data row from number of rows with actual data
   num_records_ = std::max(row_offsets.size(), 1ul) - 1;
 
+  setup_columns();
+
+  // Return empty table rather than exception if nothing to load
+  if (num_active_cols_ == 0) { return {std::make_unique<table>(), {}}; }
+
+  auto const column_types = gather_column_types(data, row_offsets, stream);
+  return decode_table(data, row_offsets, column_types, stream);
+}
+
+void reader::impl::setup_columns()
+{
   // Check if the user gave us a list of column names
   if (not opts_.get_names().empty()) {
     column_flags_.resize(opts_.get_names().size(), column_parse::enabled);
@@ -347,12 +369,15 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
     }
   }
 
-  // Return empty table rather than exception if nothing to load
-  if (num_active_cols_ == 0) { return {std::make_unique<table>(), {}}; }
+}
 
-  auto metadata     = table_metadata{};
-  auto out_columns  = std::vector<std::unique_ptr<cudf::column>>();
-  auto column_types = gather_column_types(data, row_offsets, stream);
+table_with_metadata reader::impl::decode_table(device_span<char const> data,
+                                               device_span<uint64_t const> row_offsets,
+                                               host_span<data_type const> column_types,
+                                               rmm::cuda_stream_view stream)
+{
+  auto metadata    = table_metadata{};
+  auto out_columns = std::vector<std::unique_ptr<cudf::column>>();
 
   out_columns.reserve(column_types.size());
 
@@ -390,18 +415,286 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
 }
 
-size_t reader::impl::find_first_row_start(host_span<char const> data)
+size_t reader::impl::get_map_range_size(size_t range_size) const
+{
+  if (range_size == 0) { return 0; }
+  const auto num_columns = std::max(opts_.get_names().size(), opts_.get_dtypes().size());
+  return range_size + calculateMaxRowSize(num_columns);
+}
+
+void reader::impl::setup_chunking(size_t chunk_read_limit)
 {
-  // For now, look for the first terminator (assume the first terminator isn't within a quote)
-  // TODO: Attempt to infer this from the data
-  size_t pos = 0;
-  while (pos < data.size() && data[pos] != opts.terminator) { ++pos; }
-  return std::min(pos + 1, data.size());
+  CUDF_EXPECTS(opts_.get_byte_range_offset() == 0 && opts_.get_byte_range_size() == 0,
+               "The chunked reader does not support byte ranges");
+  CUDF_EXPECTS(
+    opts_.get_skiprows() <= 0 && opts_.get_skipfooter() <= 0 && opts_.get_nrows() == -1,
+    "The chunked reader does not support skipping rows or limiting the number of rows");
+  CUDF_EXPECTS(compression_type_ == "none", "The chunked reader does not support compression");
+
+  chunk_read_limit_ = chunk_read_limit;
+  open_source(0);
+  if (chunk_read_limit_ != 0) {
+    prefetch_source_ = std::make_unique<async_prefetch_datasource>(source_.get());
+  }
+}
+
+bool reader::impl::has_next() const
+{
+  // A byte range reads the rows that start after its offset
+  return is_first_chunk_ || chunk_offset_ + 1 < source_->size();
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+
+  auto const range_offset = chunk_offset_;
+  chunk_offset_ = (chunk_read_limit_ != 0) ? range_offset + chunk_read_limit_ : source_->size();
+
+  // Read the input of this chunk and the next one in the background; the current chunk is
+  // already being read unless this is the first one
+  if (prefetch_source_ != nullptr) {
+    auto const map_range_size = get_map_range_size(chunk_read_limit_);
+    std::vector<async_prefetch_datasource::byte_range> ranges{{range_offset, map_range_size}};
+    if (chunk_offset_ < source_->size()) { ranges.push_back({chunk_offset_, map_range_size}); }
+    prefetch_source_->prefetch(ranges, stream);
+  }
+
+  auto const data_row_offsets =
+    select_data_and_row_offsets(range_offset, chunk_read_limit_, chunk_start_state_, stream);
+  auto const &data        = data_row_offsets.first;
+  auto const &row_offsets = data_row_offsets.second;
+  chunk_start_state_      = range_end_state_;
+
+  // Exclude the end-of-data row from number of rows with actual data
+  num_records_ = std::max(row_offsets.size(), 1ul) - 1;
+
+  // Later chunks are decoded with the schema of the first chunk
+  if (is_first_chunk_) {
+    is_first_chunk_ = false;
+    setup_columns();
+    if (num_active_cols_ != 0) {
+      chunk_column_types_ = gather_column_types(data, row_offsets, stream);
+    }
+  }
+
+  if (num_active_cols_ == 0) { return {std::make_unique<table>(), {}}; }
+  return decode_table(data, row_offsets, chunk_column_types_, stream);
+}
+
+void reader::impl::open_source(size_t map_range_size)
+{
+  // Support delayed opening of the file if using memory mapping datasource
+  // This allows only mapping of a subset of the file if using byte range
+  if (source_ == nullptr) {
+    assert(!filepath_.empty());
+    source_ = datasource::create(filepath_, opts_.get_byte_range_offset(), map_range_size);
+  }
+}
+
+using cudf::io::csv::gpu::ROW_CTX_COMMENT;
+using cudf::io::csv::gpu::ROW_CTX_EOF;
+using cudf::io::csv::gpu::ROW_CTX_NONE;
+using cudf::io::csv::gpu::ROW_CTX_QUOTE;
+
+/**
+ * @brief Returns the number of fields of the first complete records of the data, parsed from the
+ * given parser state.
+ *
+ * Mirrors the row parser state machine of `gather_row_offsets`. Comment and blank records are
+ * skipped. A stray quote (a quote that neither opens nor closes a field) is not expected from the
+ * correct state, so a record with a stray quote is returned with zero fields; so is the partial
+ * record before the first record start if it has a stray quote, and a quote left open at the end
+ * of the data.
+ *
+ * @param data Input data; parsing starts after the first character
+ * @param is_data_end Whether the data ends at the end of the input, completing the last record
+ * @param start_state Parser state after the first character
+ * @param opts Parsing options
+ * @param max_records Maximum number of records to parse
+ *
+ * @return Number of fields of each parsed record
+ */
+std::vector<int> gather_record_field_counts(host_span<char const> data,
+                                            bool is_data_end,
+                                            uint32_t start_state,
+                                            parse_options const &opts,
+                                            size_t max_records)
+{
+  std::vector<int> field_counts;
+  auto state           = start_state;
+  bool in_record       = false;  // Whether a record started within the data
+  bool skip_record     = false;  // Whether the current record is a comment or blank line
+  bool has_stray_quote = false;
+  int num_fields       = 0;
+  for (size_t pos = 1; pos < data.size() && field_counts.size() < max_records; ++pos) {
+    auto const c      = data[pos];
+    auto const c_prev = data[pos - 1];
+    if (c_prev == opts.terminator && state != ROW_CTX_QUOTE) {
+      if ((in_record && !skip_record) || (!in_record && has_stray_quote)) {
+        field_counts.push_back(has_stray_quote ? 0 : num_fields);
+      }
+      in_record       = true;
+      skip_record     = (c == opts.comment || c == opts.terminator || c == '\r');
+      has_stray_quote = false;
+      num_fields      = 1;
+      state           = (c == opts.comment)     ? ROW_CTX_COMMENT
+                        : (c == opts.quotechar) ? ROW_CTX_QUOTE
+                                                : ROW_CTX_NONE;
+    } else if (c_prev == opts.terminator) {
+      state = (c == opts.quotechar) ? ROW_CTX_NONE : ROW_CTX_QUOTE;
+    } else if (c == opts.quotechar && state != ROW_CTX_COMMENT) {
+      auto const is_opening = (c_prev == opts.delimiter || c_prev == opts.quotechar);
+      has_stray_quote |= (state == ROW_CTX_NONE && !is_opening);
+      state = (state == ROW_CTX_NONE && is_opening) ? ROW_CTX_QUOTE : ROW_CTX_NONE;
+    } else if (c == opts.delimiter && state == ROW_CTX_NONE) {
+      ++num_fields;
+    }
+  }
+  if (is_data_end && field_counts.size() < max_records) {
+    if (state == ROW_CTX_QUOTE) {
+      field_counts.push_back(0);
+    } else if ((in_record && !skip_record) || (!in_record && has_stray_quote)) {
+      field_counts.push_back(has_stray_quote ? 0 : num_fields);
+    }
+  }
+  return field_counts;
+}
+
+csv_parser_state reader::impl::infer_byte_range_start_state(host_span<char const> data)
+{
+  // Only the first records are parsed, within a bounded window
+  constexpr size_t max_records = 64;
+  constexpr size_t window_size = 1024 * 1024;
+  auto const window            = data.subspan(0, std::min(window_size, data.size()));
+  auto const is_data_end =
+    window.size() == data.size() && opts_.get_byte_range_offset() + data.size() == source_->size();
+
+  std::vector<uint32_t> candidates{ROW_CTX_NONE};
+  if (opts.quotechar != '\0') { candidates.push_back(ROW_CTX_QUOTE); }
+  if (opts.comment != '\0') { candidates.push_back(ROW_CTX_COMMENT); }
+  if (candidates.size() == 1) { return csv_parser_state::NONE; }
+
+  std::vector<std::vector<int>> field_counts;
+  for (auto const state : candidates) {
+    field_counts.push_back(
+      gather_record_field_counts(window, is_data_end, state, opts, max_records));
+  }
+
+  // Without names or types, expect the field count that is the most common across all states
+  auto expected_fields =
+    static_cast<int>(std::max(opts_.get_names().size(), opts_.get_dtypes().size()));
+  if (expected_fields == 0) {
+    std::unordered_map<int, int> frequency;
+    int max_frequency = 0;
+    for (auto const &counts : field_counts) {
+      for (auto const count : counts) {
+        if (count == 0) { continue; }
+        auto const f = ++frequency[count];
+        if (f > max_frequency) {
+          max_frequency   = f;
+          expected_fields = count;
+        }
+      }
+    }
+  }
+
+  // Candidates are in order of preference, so only a strictly better score selects a later one
+  size_t best_candidate = 0;
+  int best_score        = std::numeric_limits<int>::min();
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    auto const score = std::accumulate(
+      field_counts[i].cbegin(), field_counts[i].cend(), 0, [&](int score, int count) {
+        return score + ((count == expected_fields) ? 1 : -1);
+      });
+    if (score > best_score) {
+      best_score     = score;
+      best_candidate = i;
+    }
+  }
+  return static_cast<csv_parser_state>(candidates[best_candidate]);
+}
+
+csv_byte_range_summary reader::impl::summarize_byte_range(rmm::cuda_stream_view stream)
+{
+  auto const range_offset = opts_.get_byte_range_offset();
+  auto const range_size   = opts_.get_byte_range_size();
+  CUDF_EXPECTS(compression_type_ == "none",
+               "Summarizing compressed data using `byte range` is unsupported");
+
+  // The range reads the row that starts right after its last character
+  size_t const map_range_size = (range_size != 0) ? range_size + 1 : 0;
+  open_source(map_range_size);
+
+  // Rows start after the first character, except at the start of the data
+  uint32_t const range_begin = (range_offset != 0) ? 1 : 0;
+  std::array<uint64_t, 3> ctx{ROW_CTX_NONE, ROW_CTX_QUOTE, ROW_CTX_COMMENT};
+
+  if (!source_->is_empty() && range_offset < source_->size()) {
+    auto const available = source_->size() - range_offset;
+    auto const buffer =
+      source_->host_read(range_offset, (range_size != 0) ? std::min(map_range_size, available)
+                                                         : available);
+    auto const h_data =
+      host_span<char const>(reinterpret_cast<const char *>(buffer->data()), buffer->size());
+    // Unless the range reaches the end of the data, pretend that more data follows so that the
+    // row parser doesn't add the end-of-data row
+    auto const data_size = h_data.size() + (range_offset + h_data.size() < source_->size());
+
+    constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
+    hostdevice_vector<uint64_t> row_ctx(
+      std::max<size_t>((max_chunk_bytes / cudf::io::csv::gpu::rowofs_block_bytes) + 1, 2));
+    rmm::device_uvector<char> d_data(std::min(max_chunk_bytes + 1, h_data.size()), stream);
+    for (size_t pos = range_begin; pos < h_data.size(); pos += max_chunk_bytes) {
+      // Keep one character of history for the row parser
+      auto const buffer_pos = pos - std::min(pos, sizeof(char));
+      auto const chunk_size = std::min(max_chunk_bytes, h_data.size() - pos);
+      auto const chunk_data = device_span<char const>(d_data.data(), pos + chunk_size - buffer_pos);
+      copy_host_to_device(d_data.data(), h_data.data() + buffer_pos, chunk_data.size(), stream);
+
+      uint32_t const num_blocks = cudf::io::csv::gpu::gather_row_offsets(opts.view(),
+                                                                         row_ctx.device_ptr(),
+                                                                         device_span<uint64_t>(),
+                                                                         chunk_data,
+                                                                         chunk_size,
+                                                                         pos,
+                                                                         buffer_pos,
+                                                                         data_size,
+                                                                         range_begin,
+                                                                         data_size,
+                                                                         0,
+                                                                         stream);
+      CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
+                               row_ctx.device_ptr(),
+                               num_blocks * sizeof(uint64_t),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      stream.synchronize();
+
+      // Follow every start state through the character blocks
+      for (uint32_t i = 0; i < num_blocks; i++) {
+        for (auto &state_ctx : ctx) {
+          state_ctx = cudf::io::csv::gpu::select_row_context(state_ctx, row_ctx[i]);
+        }
+      }
+    }
+  }
+
+  csv_byte_range_summary summary;
+  for (size_t state = 0; state < ctx.size(); ++state) {
+    auto const end_state = static_cast<uint32_t>(ctx[state] & 3);
+    // The end-of-data row only marks the end of the last record
+    summary.num_records[state] = (ctx[state] >> 2) - (end_state == ROW_CTX_EOF);
+    summary.end_state[state] =
+      static_cast<csv_parser_state>((end_state == ROW_CTX_EOF) ? ROW_CTX_NONE : end_state);
+  }
+  return summary;
 }
 
 std::pair<rmm::device_uvector<char>, reader::impl::selected_rows_offsets>
 reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
                                                size_t range_begin,
+                                               csv_parser_state range_begin_state,
                                                size_t range_end,
                                                size_t skip_rows,
                                                int64_t num_rows,
@@ -415,8 +708,10 @@ reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
   hostdevice_vector<uint64_t> row_ctx(max_blocks);
   size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), data.size());
   size_t pos         = std::min(range_begin, data.size());
-  size_t header_rows = (opts_.get_header() >= 0) ? opts_.get_header() + 1 : 0;
-  uint64_t ctx       = 0;
+  // Only the range at the start of the data contains the header
+  size_t header_rows = (opts_.get_header() >= 0 && range_begin == 0) ? opts_.get_header() + 1 : 0;
+  uint64_t ctx       = static_cast<uint64_t>(range_begin_state);
+  range_end_state_   = csv_parser_state::NONE;
 
   // For compatibility with the previous parser, a row is considered in-range if the
   // previous row terminator is within the given range
@@ -429,15 +724,16 @@ reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
   rmm::device_uvector<uint64_t> all_row_offsets{0, stream};
   do {
     size_t target_pos = std::min(pos + max_chunk_bytes, data.size());
+    // End a batch at the range end, where the parser state is the start state of the next range
+    if (pos < range_end && target_pos > range_end) { target_pos = range_end; }
     size_t chunk_size = target_pos - pos;
 
     auto const previous_data_size = d_data.size();
     d_data.resize(target_pos - buffer_pos, stream);
-    CUDA_TRY(cudaMemcpyAsync(d_data.begin() + previous_data_size,
-                             data.begin() + buffer_pos + previous_data_size,
-                             target_pos - buffer_pos - previous_data_size,
-                             cudaMemcpyDefault,
-                             stream.value()));
+    copy_host_to_device(d_data.begin() + previous_data_size,
+                        data.begin() + buffer_pos + previous_data_size,
+                        target_pos - buffer_pos - previous_data_size,
+                        stream);
 
     // Pass 1: Count the potential number of rows in each character block for each
     // possible parser state at the beginning of the block.
@@ -468,6 +764,9 @@ reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
       row_ctx[i]        = ctx;
       ctx               = ctx_next;
     }
+    if (target_pos == range_end && range_end < data.size()) {
+      range_end_state_ = static_cast<csv_parser_state>(ctx & 3);
+    }
     size_t total_rows = ctx >> 2;
     if (total_rows > skip_rows) {
       // At least one row in range in this batch
@@ -702,7 +1001,7 @@ std::vector<column_buffer> reader::impl::decode_data(device_span<char const> dat
                       num_records_,
                       true,
                       stream,
-                      is_final_allocation ? mr_ : rmm::mr::get_current_device_resource());
+                      is_final_allocation ? mr_ : cudf::get_current_temp_resource());
 
       out_buffer.name         = col_names_[col];
       out_buffer.null_count() = UNKNOWN_NULL_COUNT;
@@ -868,6 +1167,44 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read(rmm::cuda_stream_view stream) { return _impl->read(stream); }
 
+// Forward to implementation
+csv_byte_range_summary reader::summarize_byte_range(rmm::cuda_stream_view stream)
+{
+  return _impl->summarize_byte_range(stream);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(size_t chunk_read_limit,
+                               std::vector<std::string> const &filepaths,
+                               csv_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+  : reader(filepaths, options, mr)
+{
+  _impl->setup_chunking(chunk_read_limit);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+                               csv_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+  : reader(std::move(sources), options, mr)
+{
+  _impl->setup_chunking(chunk_read_limit);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
+}
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
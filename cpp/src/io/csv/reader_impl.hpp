@@ -22,6 +22,7 @@
 #include <cudf/detail/utilities/trie.cuh>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/prefetch_datasource.hpp>
 
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
@@ -90,6 +91,37 @@ class reader::impl {
    */
   table_with_metadata read(rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Computes the end states and record counts of the byte range for every start state.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The summary of the byte range
+   */
+  csv_byte_range_summary summarize_byte_range(rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Prepares the reader to read the input in a series of byte ranges.
+   *
+   * @param chunk_read_limit Number of input bytes to read per chunk; 0 reads the whole input as a
+   * single chunk
+   */
+  void setup_chunking(size_t chunk_read_limit);
+
+  /**
+   * @brief Returns true if there are more chunks to be read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk, with the column names and types of the first chunk.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Offsets of CSV rows in device memory, accessed through a shrinkable span.
@@ -127,21 +159,60 @@ class reader::impl {
   /**
    * @brief Selectively loads data on the GPU and gathers offsets of rows to read.
    *
-   * Selection is based on read options.
+   * Selection is based on the given byte range and the row selection options. Sets the parser
+   * state at the end of the byte range.
    *
+   * @param range_offset Byte range offset
+   * @param range_size Byte range size; 0 selects the input up to the end
+   * @param range_start_state Parser state at the byte range offset; NONE or inferred if not set
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
   std::pair<rmm::device_uvector<char>, reader::impl::selected_rows_offsets>
-  select_data_and_row_offsets(rmm::cuda_stream_view stream);
+  select_data_and_row_offsets(size_t range_offset,
+                              size_t range_size,
+                              thrust::optional<csv_parser_state> range_start_state,
+                              rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the number of bytes to read for a byte range, including the bytes past the
+   * range needed to complete its last row.
+   *
+   * @param range_size Byte range size; 0 selects the input up to the end
+   *
+   * @return Number of bytes to read; 0 reads the input up to the end
+   */
+  size_t get_map_range_size(size_t range_size) const;
+
+  /**
+   * @brief Sets the column names and parsing flags from the options and the header.
+   */
+  void setup_columns();
+
+  /**
+   * @brief Converts the selected rows to a table.
+   *
+   * @param data Input data in device memory
+   * @param row_offsets Offsets of the rows within the data, including the end of the last row
+   * @param column_types Column types
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata decode_table(device_span<char const> data,
+                                   device_span<uint64_t const> row_offsets,
+                                   host_span<data_type const> column_types,
+                                   rmm::cuda_stream_view stream);
 
   /**
    * @brief Finds row positions in the specified input data, and loads the selected data onto GPU.
    *
    * This function scans the input data to record the row offsets (relative to the start of the
-   * input data). A row is actually the data/offset between two termination symbols.
+   * input data). A row is actually the data/offset between two termination symbols. Also records
+   * the parser state at `range_end`, which is the start state of a byte range that follows.
    *
    * @param data Uncompressed input data in host memory
    * @param range_begin Only include rows starting after this position
+   * @param range_begin_state Parser state at `range_begin`
    * @param range_end Only include rows starting before this position
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read; -1: all remaining data
@@ -152,6 +223,7 @@ class reader::impl {
   std::pair<rmm::device_uvector<char>, reader::impl::selected_rows_offsets>
   load_data_and_gather_row_offsets(host_span<char const> data,
                                    size_t range_begin,
+                                   csv_parser_state range_begin_state,
                                    size_t range_end,
                                    size_t skip_rows,
                                    int64_t num_rows,
@@ -159,13 +231,26 @@ class reader::impl {
                                    rmm::cuda_stream_view stream);
 
   /**
-   * @brief Find the start position of the first data row
+   * @brief Infers the parser state after the first character of a byte range.
+   *
+   * Each possible state is tried on the first records of the data, and the state under which the
+   * records have the most consistent number of fields is selected; ties select the state outside
+   * of quotes and comments. Unlike states computed with `summarize_byte_range`, the result is a
+   * heuristic.
    *
-   * @param h_data Uncompressed input data in host memory
+   * @param data Uncompressed input data in host memory, starting at the byte range offset
    *
-   * @return Byte position of the first row
+   * @return The inferred parser state
    */
-  size_t find_first_row_start(host_span<char const> data);
+  csv_parser_state infer_byte_range_start_state(host_span<char const> data);
+
+  /**
+   * @brief Creates the datasource if it was not provided at construction.
+   *
+   * @param map_range_size Number of bytes to map from the byte range offset; zero maps the whole
+   * file
+   */
+  void open_source(size_t map_range_size);
 
   /**
    * @brief Returns a detected or parsed list of column dtypes.
@@ -209,6 +294,15 @@ class reader::impl {
   // Intermediate data
   std::vector<std::string> col_names_;
   std::vector<char> header_;
+  csv_parser_state range_end_state_ = csv_parser_state::NONE;  // Parser state at the range end
+
+  // Chunked reading state
+  size_t chunk_read_limit_            = 0;  // Input bytes per chunk; 0 reads a single chunk
+  size_t chunk_offset_                = 0;  // Byte range offset of the next chunk
+  csv_parser_state chunk_start_state_ = csv_parser_state::NONE;
+  bool is_first_chunk_                = true;
+  std::vector<data_type> chunk_column_types_;  // Column types of the first chunk
+  std::unique_ptr<async_prefetch_datasource> prefetch_source_;
 };
 
 }  // namespace csv
@@ -21,7 +21,11 @@
 
 #include "writer_impl.hpp"
 
+#include <io/utilities/pinned_host_pool.hpp>
+#include <io/utilities/thread_pool.hpp>
+
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/null_mask.hpp>
@@ -29,6 +33,7 @@
 #include <cudf/strings/detail/combine.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.cuh>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -39,6 +44,8 @@
 #include <thrust/scan.h>
 
 #include <algorithm>
+#include <array>
+#include <future>
 #include <sstream>
 
 namespace cudf {
@@ -293,49 +300,50 @@ void writer::impl::write_chunked(strings_column_view const& str_column_view,
                                  const table_metadata* metadata,
                                  rmm::cuda_stream_view stream)
 {
-  // algorithm outline:
-  //
-  //  for_each(strings_column.begin(), strings_column.end(),
-  //           [sink = out_sink_](auto str_row) mutable {
-  //               auto host_buffer = str_row.host_buffer();
-  //               sink->host_write(host_buffer_.data(), host_buffer_.size());
-  //           });//or...sink->device_write(device_buffer,...);
-  //
-  // added line_terminator functionality
-  //
-
   CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
 
-  cudf::string_scalar newline{options_.get_line_terminator()};
-  auto p_str_col_w_nl =
-    cudf::strings::detail::join_strings(str_column_view, newline, string_scalar("", false), stream);
-  strings_column_view strings_column{p_str_col_w_nl->view()};
-
-  auto total_num_bytes      = strings_column.chars_size();
-  char const* ptr_all_bytes = strings_column.chars().data<char>();
+  // The rows already end with the line terminator, so the characters are the output as is
+  auto const total_num_bytes = static_cast<size_t>(str_column_view.chars_size());
+  char const* ptr_all_bytes  = str_column_view.chars().data<char>();
 
   if (out_sink_->is_device_write_preferred(total_num_bytes)) {
     // Direct write from device memory
     out_sink_->device_write(ptr_all_bytes, total_num_bytes, stream);
-  } else {
-    // copy the bytes to host to write them out
-    thrust::host_vector<char> h_bytes(total_num_bytes);
-    CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
-                             ptr_all_bytes,
-                             total_num_bytes * sizeof(char),
-                             cudaMemcpyDeviceToHost,
-                             stream.value()));
     stream.synchronize();
-
-    out_sink_->host_write(h_bytes.data(), total_num_bytes);
+    return;
   }
 
-  // Needs newline at the end, to separate from next chunk
-  if (out_sink_->is_device_write_preferred(newline.size())) {
-    out_sink_->device_write(newline.data(), newline.size(), stream);
-  } else {
-    out_sink_->host_write(options_.get_line_terminator().data(),
-                          options_.get_line_terminator().size());
+  // copy the bytes to host to write them out, one slice at a time through two pinned buffers;
+  // the next slice is copied while the current one is written
+  constexpr size_t max_slice_size = 16 << 20;
+  auto const slice_size = std::min<size_t>(total_num_bytes, max_slice_size);
+  auto const num_slices = (total_num_bytes + slice_size - 1) / slice_size;
+  auto const h_bytes    = make_pinned_buffer<char>(2 * slice_size);
+  std::array<cudaEvent_t, 2> slice_copied;
+  for (auto& event : slice_copied) {
+    CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  }
+  auto const slice_bytes = [&](size_t slice) {
+    return std::min(slice_size, total_num_bytes - slice * slice_size);
+  };
+  auto const copy_slice = [&](size_t slice) {
+    CUDA_TRY(cudaMemcpyAsync(h_bytes.get() + (slice % 2) * slice_size,
+                             ptr_all_bytes + slice * slice_size,
+                             slice_bytes(slice),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    CUDA_TRY(cudaEventRecord(slice_copied[slice % 2], stream.value()));
+  };
+
+  copy_slice(0);
+  for (size_t slice = 0; slice < num_slices; ++slice) {
+    // The other buffer was written out in the previous iteration
+    if (slice + 1 < num_slices) { copy_slice(slice + 1); }
+    CUDA_TRY(cudaEventSynchronize(slice_copied[slice % 2]));
+    out_sink_->host_write(h_bytes.get() + (slice % 2) * slice_size, slice_bytes(slice));
+  }
+  for (auto event : slice_copied) {
+    CUDA_TRY(cudaEventDestroy(event));
   }
 }
 
@@ -380,9 +388,14 @@ void writer::impl::write(table_view const& table,
       vector_views = cudf::split(table, splits);
     }
 
-    // convert each chunk to CSV:
+    // convert each chunk to CSV; a chunk is written to the sink in the background while the next
+    // one is converted, so at most two converted chunks are in device memory at the same time:
     //
-    column_to_strings_fn converter{options_, stream, rmm::mr::get_current_device_resource()};
+    column_to_strings_fn converter{options_, stream, cudf::get_current_temp_resource()};
+    thread_pool sink_writer(1);
+    std::future<void> pending_write;
+    int device_id;
+    CUDA_TRY(cudaGetDevice(&device_id));
     for (auto&& sub_view : vector_views) {
       // Skip if the table has no rows
       if (sub_view.num_rows() == 0) continue;
@@ -397,6 +410,17 @@ void writer::impl::write(table_view const& table,
                        return cudf::type_dispatcher(current_col.type(), converter, current_col);
                      });
 
+      // append the line terminator to the last column, so that the concatenated rows are the
+      // output as is, without joining them into another copy:
+      //
+      auto const terminators = make_column_from_scalar(
+        string_scalar{options_.get_line_terminator()}, sub_view.num_rows(), stream);
+      str_column_vec.back() = cudf::strings::detail::concatenate(
+        table_view{{str_column_vec.back()->view(), terminators->view()}},
+        string_scalar{""},
+        options_.get_na_rep(),
+        stream);
+
       // create string table view from str_column_vec:
       //
       auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
@@ -408,9 +432,18 @@ void writer::impl::write(table_view const& table,
       std::string delimiter_str{options_.get_inter_column_delimiter()};
       auto str_concat_col = cudf::strings::detail::concatenate(
         str_table_view, delimiter_str, options_.get_na_rep(), stream);
-
-      write_chunked(str_concat_col->view(), metadata, stream);
+      str_table_ptr.reset();
+
+      // the chunk is written on a separate stream, so it must be complete before it's handed off
+      stream.synchronize();
+      if (pending_write.valid()) { pending_write.get(); }
+      pending_write =
+        sink_writer.submit([this, metadata, device_id, str_col = std::move(str_concat_col)]() {
+          CUDA_TRY(cudaSetDevice(device_id));
+          write_chunked(str_col->view(), metadata, write_stream_);
+        });
     }
+    if (pending_write.valid()) { pending_write.get(); }
   }
 
   // finalize (no-op, for now, but offers a hook for future extensions):
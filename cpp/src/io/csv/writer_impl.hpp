@@ -28,6 +28,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/cuda_stream.hpp>
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
@@ -83,7 +84,12 @@ class writer::impl {
   /**
    * @brief Write dataset to CSV format without header.
    *
-   * @param strings_column Subset of columns converted to string to be written.
+   * Data that is not written from device memory is copied to the host through two pinned buffers,
+   * so that the copy of a slice overlaps the write of the previous one. Returns once the data is
+   * written.
+   *
+   * @param strings_column Subset of rows converted to strings, each ending with the line
+   * terminator, to be written.
    * @param metadata The metadata associated with the table
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
@@ -109,6 +115,7 @@ class writer::impl {
   std::unique_ptr<data_sink> out_sink_;
   rmm::mr::device_memory_resource* mr_ = nullptr;
   csv_writer_options const options_;
+  rmm::cuda_stream write_stream_;  // Copies and writes of the formatted rows, apart from formatting
 };
 
 std::unique_ptr<column> pandas_format_durations(
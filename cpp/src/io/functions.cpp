@@ -30,11 +30,27 @@
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 namespace cudf {
 namespace io {
+// Returns builder for avro_writer_options
+avro_writer_options_builder avro_writer_options::builder(sink_info const& sink,
+                                                         table_view const& table)
+{
+  return avro_writer_options_builder{sink, table};
+}
+
+// Returns builder for json_writer_options
+json_writer_options_builder json_writer_options::builder(sink_info const& sink,
+                                                         table_view const& table)
+{
+  return json_writer_options_builder{sink, table};
+}
+
 // Returns builder for csv_reader_options
 csv_reader_options_builder csv_reader_options::builder(source_info const& src)
 {
@@ -105,7 +121,26 @@ chunked_parquet_writer_options_builder chunked_parquet_writer_options::builder(
   return chunked_parquet_writer_options_builder(sink);
 }
 
+// Returns builder for parquet_dataset_writer_options
+parquet_dataset_writer_options_builder parquet_dataset_writer_options::builder(
+  std::string const& base_path,
+  table_view const& table,
+  std::vector<size_type> const& partition_cols)
+{
+  return parquet_dataset_writer_options_builder{base_path, table, partition_cols};
+}
+
 namespace {
+std::vector<std::unique_ptr<datasource>> make_datasources(source_info const& src_info)
+{
+  switch (src_info.type) {
+    case io_type::FILEPATH: return cudf::io::datasource::create(src_info.filepaths);
+    case io_type::HOST_BUFFER: return cudf::io::datasource::create(src_info.buffers);
+    case io_type::USER_IMPLEMENTED: return cudf::io::datasource::create(src_info.user_sources);
+    default: CUDF_FAIL("Unsupported source type");
+  }
+}
+
 template <typename reader, typename reader_options>
 std::unique_ptr<reader> make_reader(source_info const& src_info,
                                     reader_options const& options,
@@ -115,16 +150,13 @@ std::unique_ptr<reader> make_reader(source_info const& src_info,
     return std::make_unique<reader>(src_info.filepaths, options, mr);
   }
 
-  std::vector<std::unique_ptr<datasource>> datasources;
-  if (src_info.type == io_type::HOST_BUFFER) {
-    datasources = cudf::io::datasource::create(src_info.buffers);
-  } else if (src_info.type == io_type::USER_IMPLEMENTED) {
-    datasources = cudf::io::datasource::create(src_info.user_sources);
-  } else {
-    CUDF_FAIL("Unsupported source type");
-  }
+  return std::make_unique<reader>(make_datasources(src_info), options, mr);
+}
 
-  return std::make_unique<reader>(std::move(datasources), options, mr);
+// Returns the paths of the sources whose metadata can be cached
+std::vector<std::string> get_cacheable_filepaths(source_info const& src_info)
+{
+  return (src_info.type == io_type::FILEPATH) ? src_info.filepaths : std::vector<std::string>{};
 }
 
 template <typename writer, typename... Ts>
@@ -159,6 +191,17 @@ table_with_metadata read_avro(avro_reader_options const& opts, rmm::mr::device_m
   return reader->read(opts);
 }
 
+// Freeform API wraps the detail writer class API
+void write_avro(avro_writer_options const& options, rmm::mr::device_memory_resource* mr)
+{
+  namespace avro = cudf::io::detail::avro;
+
+  CUDF_FUNC_RANGE();
+  auto writer = make_writer<avro::writer>(options.get_sink(), options, mr);
+
+  writer->write(options.get_table(), options.get_metadata());
+}
+
 table_with_metadata read_json(json_reader_options const& opts, rmm::mr::device_memory_resource* mr)
 {
   namespace json = cudf::io::detail::json;
@@ -168,6 +211,64 @@ table_with_metadata read_json(json_reader_options const& opts, rmm::mr::device_m
   return reader->read(opts);
 }
 
+// Freeform API wraps the detail writer class API
+void write_json(json_writer_options const& options, rmm::mr::device_memory_resource* mr)
+{
+  namespace json = cudf::io::detail::json;
+
+  CUDF_FUNC_RANGE();
+  auto writer = make_writer<json::writer>(options.get_sink(), options, mr);
+
+  writer->write(options.get_table(), options.get_metadata());
+}
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::chunked_json_reader
+ */
+chunked_json_reader::chunked_json_reader(std::size_t chunk_read_limit,
+                                         json_reader_options const& options,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  namespace json = cudf::io::detail::json;
+
+  auto const& src_info = options.get_source();
+  if (src_info.type == io_type::FILEPATH) {
+    reader =
+      std::make_unique<json::chunked_reader>(chunk_read_limit, src_info.filepaths, options, mr);
+    return;
+  }
+
+  std::vector<std::unique_ptr<datasource>> datasources;
+  if (src_info.type == io_type::HOST_BUFFER) {
+    datasources = cudf::io::datasource::create(src_info.buffers);
+  } else if (src_info.type == io_type::USER_IMPLEMENTED) {
+    datasources = cudf::io::datasource::create(src_info.user_sources);
+  } else {
+    CUDF_FAIL("Unsupported source type");
+  }
+  reader = std::make_unique<json::chunked_reader>(
+    chunk_read_limit, std::move(datasources), options, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::~chunked_json_reader
+ */
+chunked_json_reader::~chunked_json_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::has_next
+ */
+bool chunked_json_reader::has_next() const { return reader->has_next(); }
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::read_chunk
+ */
+table_with_metadata chunked_json_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  return reader->read_chunk();
+}
+
 table_with_metadata read_csv(csv_reader_options const& options, rmm::mr::device_memory_resource* mr)
 {
   namespace csv = cudf::io::detail::csv;
@@ -178,6 +279,78 @@ table_with_metadata read_csv(csv_reader_options const& options, rmm::mr::device_
   return reader->read();
 }
 
+csv_byte_range_summary summarize_csv_byte_range(csv_reader_options const& options)
+{
+  namespace csv = cudf::io::detail::csv;
+
+  CUDF_FUNC_RANGE();
+  auto reader =
+    make_reader<csv::reader>(options.get_source(), options, cudf::get_current_temp_resource());
+
+  return reader->summarize_byte_range();
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::chunked_csv_reader
+ */
+chunked_csv_reader::chunked_csv_reader(std::size_t chunk_read_limit,
+                                       csv_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  namespace csv = cudf::io::detail::csv;
+
+  auto const& src_info = options.get_source();
+  if (src_info.type == io_type::FILEPATH) {
+    reader =
+      std::make_unique<csv::chunked_reader>(chunk_read_limit, src_info.filepaths, options, mr);
+    return;
+  }
+
+  std::vector<std::unique_ptr<datasource>> datasources;
+  if (src_info.type == io_type::HOST_BUFFER) {
+    datasources = cudf::io::datasource::create(src_info.buffers);
+  } else if (src_info.type == io_type::USER_IMPLEMENTED) {
+    datasources = cudf::io::datasource::create(src_info.user_sources);
+  } else {
+    CUDF_FAIL("Unsupported source type");
+  }
+  reader = std::make_unique<csv::chunked_reader>(
+    chunk_read_limit, std::move(datasources), options, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::~chunked_csv_reader
+ */
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::has_next
+ */
+bool chunked_csv_reader::has_next() const { return reader->has_next(); }
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::read_chunk
+ */
+table_with_metadata chunked_csv_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  return reader->read_chunk();
+}
+
+std::vector<csv_byte_range_start> resolve_csv_byte_range_starts(
+  std::vector<csv_byte_range_summary> const& summaries)
+{
+  std::vector<csv_byte_range_start> starts;
+  starts.reserve(summaries.size());
+  csv_byte_range_start start{csv_parser_state::NONE, 0};
+  for (auto const& summary : summaries) {
+    starts.push_back(start);
+    auto const state = static_cast<size_t>(start.parser_state);
+    start            = {summary.end_state[state], start.first_record + summary.num_records[state]};
+  }
+  return starts;
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resource* mr)
 {
@@ -233,6 +406,27 @@ raw_orc_statistics read_raw_orc_statistics(source_info const& src_info)
   return result;
 }
 
+orc_metadata read_orc_metadata(source_info const& src_info, std::shared_ptr<metadata_cache> cache)
+{
+  CUDF_FUNC_RANGE();
+  auto const datasources = make_datasources(src_info);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  auto const filepaths = get_cacheable_filepaths(src_info);
+
+  orc::metadata metadata(
+    datasources[0].get(), cache.get(), filepaths.empty() ? std::string{} : filepaths[0]);
+
+  orc_metadata result;
+  result.num_rows = metadata.get_total_rows();
+  for (auto const& stripe : metadata.ff.stripes) {
+    result.stripe_num_rows.push_back(stripe.numberOfRows);
+  }
+  for (auto i = 0; i < metadata.get_num_columns(); i++) {
+    result.column_names.push_back(metadata.get_column_name(i));
+  }
+  return result;
+}
+
 column_statistics::column_statistics(cudf::io::orc::column_statistics&& cs)
 {
   _number_of_values = std::move(cs.number_of_values);
@@ -350,6 +544,51 @@ table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t chunk_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto const& src_info = options.get_source();
+  if (src_info.type == io_type::FILEPATH) {
+    reader = std::make_unique<detail_orc::chunked_reader>(
+      chunk_read_limit, src_info.filepaths, options, mr);
+    return;
+  }
+
+  std::vector<std::unique_ptr<datasource>> datasources;
+  if (src_info.type == io_type::HOST_BUFFER) {
+    datasources = cudf::io::datasource::create(src_info.buffers);
+  } else if (src_info.type == io_type::USER_IMPLEMENTED) {
+    datasources = cudf::io::datasource::create(src_info.user_sources);
+  } else {
+    CUDF_FAIL("Unsupported source type");
+  }
+  reader = std::make_unique<detail_orc::chunked_reader>(
+    chunk_read_limit, std::move(datasources), options, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::~chunked_orc_reader
+ */
+chunked_orc_reader::~chunked_orc_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::has_next
+ */
+bool chunked_orc_reader::has_next() const { return reader->has_next(); }
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::read_chunk
+ */
+table_with_metadata chunked_orc_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -409,6 +648,70 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+memory_estimate estimate_parquet_read_memory(parquet_reader_options const& options)
+{
+  CUDF_FUNC_RANGE();
+  auto reader = make_reader<detail_parquet::reader>(
+    options.get_source(), options, cudf::get_current_temp_resource());
+
+  return reader->estimate_memory(options);
+}
+
+parquet_metadata read_parquet_metadata(source_info const& src_info,
+                                       std::shared_ptr<metadata_cache> cache)
+{
+  CUDF_FUNC_RANGE();
+  auto const datasources = make_datasources(src_info);
+
+  return detail_parquet::read_metadata(
+    datasources, get_cacheable_filepaths(src_info), cache.get());
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::chunked_parquet_reader
+ */
+chunked_parquet_reader::chunked_parquet_reader(std::size_t chunk_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto const& src_info = options.get_source();
+  if (src_info.type == io_type::FILEPATH) {
+    reader = std::make_unique<detail_parquet::chunked_reader>(
+      chunk_read_limit, src_info.filepaths, options, mr);
+    return;
+  }
+
+  std::vector<std::unique_ptr<datasource>> datasources;
+  if (src_info.type == io_type::HOST_BUFFER) {
+    datasources = cudf::io::datasource::create(src_info.buffers);
+  } else if (src_info.type == io_type::USER_IMPLEMENTED) {
+    datasources = cudf::io::datasource::create(src_info.user_sources);
+  } else {
+    CUDF_FAIL("Unsupported source type");
+  }
+  reader = std::make_unique<detail_parquet::chunked_reader>(
+    chunk_read_limit, std::move(datasources), options, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::~chunked_parquet_reader
+ */
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::has_next
+ */
+bool chunked_parquet_reader::has_next() const { return reader->has_next(); }
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+ */
+table_with_metadata chunked_parquet_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::merge_rowgroup_metadata
  */
@@ -419,6 +722,13 @@ std::unique_ptr<std::vector<uint8_t>> merge_rowgroup_metadata(
   return detail_parquet::writer::merge_rowgroup_metadata(metadata_list);
 }
 
+std::vector<std::string> write_parquet_dataset(parquet_dataset_writer_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail_parquet::write_dataset(options, mr, rmm::cuda_stream_default);
+}
+
 table_input_metadata::table_input_metadata(table_view const& table,
                                            std::map<std::string, std::string> user_data)
   : user_data{std::move(user_data)}
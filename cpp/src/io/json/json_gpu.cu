@@ -32,6 +32,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/device_vector.hpp>
 #include <rmm/exec_policy.hpp>
 
@@ -59,8 +60,11 @@ namespace {
 __device__ std::pair<char const *, char const *> limit_range_to_brackets(char const *begin,
                                                                          char const *end)
 {
-  auto const data_begin = thrust::next(thrust::find_if(
-    thrust::seq, begin, end, [] __device__(auto c) { return c == '[' || c == '{'; }));
+  auto const open_bracket = thrust::find_if(
+    thrust::seq, begin, end, [] __device__(auto c) { return c == '[' || c == '{'; });
+  // Empty rows, e.g. nested values that are null, have no data
+  if (open_bracket == end) return {end, end};
+  auto const data_begin = thrust::next(open_bracket);
   auto const data_end   = thrust::next(thrust::find_if(thrust::seq,
                                                      thrust::make_reverse_iterator(end),
                                                      thrust::make_reverse_iterator(data_begin),
@@ -399,6 +403,57 @@ __device__ __inline__ bool is_like_float(
   return true;
 }
 
+/**
+ * @brief Returns the end of the field that starts at `begin`.
+ *
+ * Unlike `seek_field_end`, delimiters within nested objects and arrays don't end the field, so
+ * a nested value is returned as a single field.
+ *
+ * @param[in] begin Pointer to the first character of the field
+ * @param[in] end Pointer to the first character after the parsing range
+ * @param[in] opts The global parsing behavior options
+ *
+ * @return Pointer to the delimiter after the field, or `end`
+ */
+__device__ char const *seek_json_field_end(char const *begin,
+                                           char const *end,
+                                           parse_options_view const &opts)
+{
+  bool quotation   = false;
+  bool escape_next = false;
+  int depth        = 0;
+  auto current     = begin;
+  for (; current < end; ++current) {
+    if (escape_next) {
+      escape_next = false;
+    } else if (*current == '\\') {
+      escape_next = true;
+    } else if (*current == opts.quotechar) {
+      quotation = !quotation;
+    } else if (!quotation) {
+      if (*current == '{' || *current == '[') {
+        ++depth;
+      } else if (*current == '}' || *current == ']') {
+        --depth;
+      } else if (depth <= 0 && (*current == opts.delimiter || *current == opts.terminator)) {
+        break;
+      }
+    }
+  }
+  return current;
+}
+
+/**
+ * @brief Returns whether the text of the values of the given type is kept as is in the output.
+ *
+ * Nested values are stored as text and parsed into child columns after the top-level pass.
+ */
+__device__ bool is_stored_as_text(data_type type)
+{
+  return type.id() == type_id::STRING || type.id() == type_id::STRUCT ||
+         type.id() == type_id::LIST;
+}
+
 /**
  * @brief Contains information on a JSON file field.
  */
@@ -417,7 +472,7 @@ struct field_descriptor {
  * @param[in] field_idx Index of the current field in the input row
  * @param[in] col_map Pointer to the (column name hash -> solumn index) map in device memory.
  * nullptr is passed when the input file does not consist of objects.
- * @return Descriptor of the parsed field
+ * @return Descriptor of the parsed field; the column is negative if the key is not in the map
  */
 __device__ field_descriptor next_field_descriptor(const char *begin,
                                                   const char *end,
@@ -428,19 +483,19 @@ __device__ field_descriptor next_field_descriptor(const char *begin,
   auto const desc_pre_trim =
     col_map == nullptr
       // No key - column and begin are trivial
-      ? field_descriptor{field_idx, begin, cudf::io::gpu::seek_field_end(begin, end, opts, true)}
+      ? field_descriptor{field_idx, begin, seek_json_field_end(begin, end, opts)}
       : [&]() {
           auto const key_range = get_next_key(begin, end, opts.quotechar);
           auto const key_hash  = MurmurHash3_32<cudf::string_view>{}(
             cudf::string_view(key_range.first, key_range.second - key_range.first));
           auto const hash_col = col_map->find(key_hash);
-          // Fall back to field index if not found (parsing error)
-          auto const column = (hash_col != col_map->end()) ? (*hash_col).second : field_idx;
+          // Keys that are not in the map, e.g. keys that only appear after the first chunk of a
+          // chunked read, are skipped
+          auto const column = (hash_col != col_map->end()) ? (*hash_col).second : -1;
 
           // Skip the colon between the key and the value
           auto const value_begin = thrust::find(thrust::seq, key_range.second, end, ':') + 1;
-          return field_descriptor{
-            column, value_begin, cudf::io::gpu::seek_field_end(value_begin, end, opts, true)};
+          return field_descriptor{column, value_begin, seek_json_field_end(value_begin, end, opts)};
         }();
 
   // Modify start & end to ignore whitespace and quotechars
@@ -471,6 +526,57 @@ __device__ std::pair<char const *, char const *> get_row_data_range(
   return limit_range_to_brackets(row_begin, row_end);
 }
 
+/**
+ * @brief Converts the text of a field and stores it in the output column.
+ *
+ * Strings and nested values are stored as (pointer, length) pairs into the input data.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] value_begin Pointer to the first character of the value
+ * @param[in] value_end Pointer to the first character after the value
+ * @param[in] type The data type of the output column
+ * @param[out] output The output column data
+ * @param[out] valid The bitmap indicating whether the column fields are valid
+ * @param[out] num_valid The number of valid fields in the column
+ * @param[in] row Index of the output row
+ */
+__device__ void convert_field(parse_options_view const &opts,
+                              char const *value_begin,
+                              char const *value_end,
+                              data_type type,
+                              void *output,
+                              bitmask_type *valid,
+                              cudf::size_type *num_valid,
+                              cudf::size_type row)
+{
+  auto const value_len = static_cast<size_t>(std::max(value_end - value_begin, 0L));
+
+  // Empty fields are not legal values
+  if (!serialized_trie_contains(opts.trie_na, {value_begin, value_len})) {
+    // Type dispatcher does not handle strings
+    if (is_stored_as_text(type)) {
+      auto str_list        = static_cast<string_index_pair *>(output);
+      str_list[row].first  = value_begin;
+      str_list[row].second = value_len;
+
+      // set the valid bitmap - all bits were set to 0 to start
+      set_bit(valid, row);
+      atomicAdd(num_valid, 1);
+    } else {
+      if (cudf::type_dispatcher(
+            type, ConvertFunctor{}, value_begin, value_end, output, row, opts)) {
+        // set the valid bitmap - all bits were set to 0 to start
+        set_bit(valid, row);
+        atomicAdd(num_valid, 1);
+      }
+    }
+  } else if (is_stored_as_text(type)) {
+    auto str_list        = static_cast<string_index_pair *>(output);
+    str_list[row].first  = nullptr;
+    str_list[row].second = 0;
+  }
+}
+
 /**
  * @brief CUDA kernel that parses and converts plain text data into cuDF column data.
  *
@@ -500,44 +606,130 @@ __global__ void convert_data_to_columns_kernel(parse_options_view opts,
 
   auto const row_data_range = get_row_data_range(data, row_offsets, rec_id);
 
+  // Object rows may contain keys that don't map to a column, so all of their fields are parsed
   auto current = row_data_range.first;
   for (size_type input_field_index = 0;
-       input_field_index < column_types.size() && current < row_data_range.second;
+       (col_map != nullptr || input_field_index < column_types.size()) &&
+       current < row_data_range.second;
        input_field_index++) {
     auto const desc =
       next_field_descriptor(current, row_data_range.second, opts, input_field_index, col_map);
-    auto const value_len = static_cast<size_t>(std::max(desc.value_end - desc.value_begin, 0L));
-
     current = desc.value_end + 1;
+    if (desc.column < 0) { continue; }
+
+    convert_field(opts,
+                  desc.value_begin,
+                  desc.value_end,
+                  column_types[desc.column],
+                  output_columns[desc.column],
+                  valid_fields[desc.column],
+                  &num_valid_fields[desc.column],
+                  rec_id);
+  }
+}
 
-    // Empty fields are not legal values
-    if (!serialized_trie_contains(opts.trie_na, {desc.value_begin, value_len})) {
-      // Type dispatcher does not handle strings
-      if (column_types[desc.column].id() == type_id::STRING) {
-        auto str_list           = static_cast<string_index_pair *>(output_columns[desc.column]);
-        str_list[rec_id].first  = desc.value_begin;
-        str_list[rec_id].second = value_len;
+/**
+ * @brief Updates the type histogram of a column with the type of a valid field.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] value_begin Pointer to the first character of the value, excluding quotes
+ * @param[in] value_end Pointer to the first character after the value, excluding quotes
+ * @param[in] is_quoted Whether the value is enclosed in quotes
+ * @param[in,out] histogram The type histogram of the column
+ */
+__device__ void update_type_histogram(parse_options_view const &opts,
+                                      char const *value_begin,
+                                      char const *value_end,
+                                      bool is_quoted,
+                                      cudf::io::column_type_histogram &histogram)
+{
+  auto const value_len = static_cast<size_t>(std::max(value_end - value_begin, 0L));
 
-        // set the valid bitmap - all bits were set to 0 to start
-        set_bit(valid_fields[desc.column], rec_id);
-        atomicAdd(&num_valid_fields[desc.column], 1);
+  // Don't need counts to detect strings, any field in quotes is deduced to be a string
+  if (is_quoted) {
+    atomicAdd(&histogram.string_count, 1);
+    return;
+  }
+  // Nested values are parsed after the top-level pass
+  if (*value_begin == '{') {
+    atomicAdd(&histogram.struct_count, 1);
+    return;
+  }
+  if (*value_begin == '[') {
+    atomicAdd(&histogram.list_count, 1);
+    return;
+  }
+
+  int digit_count    = 0;
+  int decimal_count  = 0;
+  int slash_count    = 0;
+  int dash_count     = 0;
+  int plus_count     = 0;
+  int colon_count    = 0;
+  int exponent_count = 0;
+  int other_count    = 0;
+
+  const bool maybe_hex =
+    ((value_len > 2 && *value_begin == '0' && *(value_begin + 1) == 'x') ||
+     (value_len > 3 && *value_begin == '-' && *(value_begin + 1) == '0' &&
+      *(value_begin + 2) == 'x'));
+  for (auto pos = value_begin; pos < value_end; ++pos) {
+    if (is_digit(*pos, maybe_hex)) {
+      digit_count++;
+      continue;
+    }
+    // Looking for unique characters that will help identify column types
+    switch (*pos) {
+      case '.': decimal_count++; break;
+      case '-': dash_count++; break;
+      case '+': plus_count++; break;
+      case '/': slash_count++; break;
+      case ':': colon_count++; break;
+      case 'e':
+      case 'E':
+        if (!maybe_hex && pos > value_begin && pos < value_end - 1) exponent_count++;
+        break;
+      default: other_count++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  int int_req_number_cnt = value_len;
+  // Off by one if they start with a minus sign
+  if ((*value_begin == '-' || *value_begin == '+') && value_len > 1) { --int_req_number_cnt; }
+  // Off by one if they are a hexadecimal number
+  if (maybe_hex) { --int_req_number_cnt; }
+  if (serialized_trie_contains(opts.trie_true, {value_begin, value_len}) ||
+      serialized_trie_contains(opts.trie_false, {value_begin, value_len})) {
+    atomicAdd(&histogram.bool_count, 1);
+  } else if (digit_count == int_req_number_cnt) {
+    bool is_negative       = (*value_begin == '-');
+    char const *data_begin = value_begin + (is_negative || (*value_begin == '+'));
+    cudf::size_type *ptr   = cudf::io::gpu::infer_integral_field_counter(
+      data_begin, data_begin + digit_count, is_negative, histogram);
+    atomicAdd(ptr, 1);
+  } else if (is_like_float(
+               value_len, digit_count, decimal_count, dash_count + plus_count, exponent_count)) {
+    atomicAdd(&histogram.float_count, 1);
+  }
+  // A date-time field cannot have more than 3 non-special characters
+  // A number field cannot have more than one decimal point
+  else if (other_count > 3 || decimal_count > 1) {
+    atomicAdd(&histogram.string_count, 1);
+  } else {
+    // A date field can have either one or two '-' or '\'; A legal combination will only have one
+    // of them To simplify the process of auto column detection, we are not covering all the
+    // date-time formation permutations
+    if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
+        (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
+      if (colon_count <= 2) {
+        atomicAdd(&histogram.datetime_count, 1);
       } else {
-        if (cudf::type_dispatcher(column_types[desc.column],
-                                  ConvertFunctor{},
-                                  desc.value_begin,
-                                  desc.value_end,
-                                  output_columns[desc.column],
-                                  rec_id,
-                                  opts)) {
-          // set the valid bitmap - all bits were set to 0 to start
-          set_bit(valid_fields[desc.column], rec_id);
-          atomicAdd(&num_valid_fields[desc.column], 1);
-        }
+        atomicAdd(&histogram.string_count, 1);
       }
-    } else if (column_types[desc.column].id() == type_id::STRING) {
-      auto str_list           = static_cast<string_index_pair *>(output_columns[desc.column]);
-      str_list[rec_id].first  = nullptr;
-      str_list[rec_id].second = 0;
+    } else {
+      // Default field type is string
+      atomicAdd(&histogram.string_count, 1);
     }
   }
 }
@@ -573,7 +765,7 @@ __global__ void detect_data_types_kernel(
 
   size_type input_field_index = 0;
   for (auto current = row_data_range.first;
-       input_field_index < num_columns && current < row_data_range.second;
+       (are_rows_objects || input_field_index < num_columns) && current < row_data_range.second;
        input_field_index++) {
     auto const desc =
       next_field_descriptor(current, row_data_range.second, opts, input_field_index, col_map);
@@ -581,6 +773,7 @@ __global__ void detect_data_types_kernel(
 
     // Advance to the next field; +1 to skip the delimiter
     current = desc.value_end + 1;
+    if (desc.column < 0) { continue; }
 
     // Checking if the field is empty/valid
     if (serialized_trie_contains(opts.trie_na, {desc.value_begin, value_len})) {
@@ -592,86 +785,10 @@ __global__ void detect_data_types_kernel(
       // here for every valid field.
       atomicAdd(&column_infos[desc.column].null_count, -1);
     }
-    // Don't need counts to detect strings, any field in quotes is deduced to be a string
-    if (*(desc.value_begin - 1) == opts.quotechar && *desc.value_end == opts.quotechar) {
-      atomicAdd(&column_infos[desc.column].string_count, 1);
-      continue;
-    }
-
-    int digit_count    = 0;
-    int decimal_count  = 0;
-    int slash_count    = 0;
-    int dash_count     = 0;
-    int plus_count     = 0;
-    int colon_count    = 0;
-    int exponent_count = 0;
-    int other_count    = 0;
-
-    const bool maybe_hex =
-      ((value_len > 2 && *desc.value_begin == '0' && *(desc.value_begin + 1) == 'x') ||
-       (value_len > 3 && *desc.value_begin == '-' && *(desc.value_begin + 1) == '0' &&
-        *(desc.value_begin + 2) == 'x'));
-    for (auto pos = desc.value_begin; pos < desc.value_end; ++pos) {
-      if (is_digit(*pos, maybe_hex)) {
-        digit_count++;
-        continue;
-      }
-      // Looking for unique characters that will help identify column types
-      switch (*pos) {
-        case '.': decimal_count++; break;
-        case '-': dash_count++; break;
-        case '+': plus_count++; break;
-        case '/': slash_count++; break;
-        case ':': colon_count++; break;
-        case 'e':
-        case 'E':
-          if (!maybe_hex && pos > desc.value_begin && pos < desc.value_end - 1) exponent_count++;
-          break;
-        default: other_count++; break;
-      }
-    }
-
-    // Integers have to have the length of the string
-    int int_req_number_cnt = value_len;
-    // Off by one if they start with a minus sign
-    if ((*desc.value_begin == '-' || *desc.value_begin == '+') && value_len > 1) {
-      --int_req_number_cnt;
-    }
-    // Off by one if they are a hexadecimal number
-    if (maybe_hex) { --int_req_number_cnt; }
-    if (serialized_trie_contains(opts.trie_true, {desc.value_begin, value_len}) ||
-        serialized_trie_contains(opts.trie_false, {desc.value_begin, value_len})) {
-      atomicAdd(&column_infos[desc.column].bool_count, 1);
-    } else if (digit_count == int_req_number_cnt) {
-      bool is_negative       = (*desc.value_begin == '-');
-      char const *data_begin = desc.value_begin + (is_negative || (*desc.value_begin == '+'));
-      cudf::size_type *ptr   = cudf::io::gpu::infer_integral_field_counter(
-        data_begin, data_begin + digit_count, is_negative, column_infos[desc.column]);
-      atomicAdd(ptr, 1);
-    } else if (is_like_float(
-                 value_len, digit_count, decimal_count, dash_count + plus_count, exponent_count)) {
-      atomicAdd(&column_infos[desc.column].float_count, 1);
-    }
-    // A date-time field cannot have more than 3 non-special characters
-    // A number field cannot have more than one decimal point
-    else if (other_count > 3 || decimal_count > 1) {
-      atomicAdd(&column_infos[desc.column].string_count, 1);
-    } else {
-      // A date field can have either one or two '-' or '\'; A legal combination will only have one
-      // of them To simplify the process of auto column detection, we are not covering all the
-      // date-time formation permutations
-      if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
-          (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
-        if (colon_count <= 2) {
-          atomicAdd(&column_infos[desc.column].datetime_count, 1);
-        } else {
-          atomicAdd(&column_infos[desc.column].string_count, 1);
-        }
-      } else {
-        // Default field type is string
-        atomicAdd(&column_infos[desc.column].string_count, 1);
-      }
-    }
+    auto const is_quoted =
+      *(desc.value_begin - 1) == opts.quotechar && *desc.value_end == opts.quotechar;
+    update_type_histogram(
+      opts, desc.value_begin, desc.value_end, is_quoted, column_infos[desc.column]);
   }
   if (!are_rows_objects) {
     // For array rows, mark missing fields as null
@@ -704,7 +821,7 @@ __device__ key_value_range get_next_key_value_range(char const *begin,
   if (colon == end) return {end, end, end};
 
   // Field value (including delimiters)
-  auto const value_end = cudf::io::gpu::seek_field_end(colon + 1, end, opts, true);
+  auto const value_end = seek_json_field_end(colon + 1, end, opts);
   return {key_range.first, key_range.second, colon + 1, value_end};
 }
 
@@ -745,6 +862,148 @@ __global__ void collect_keys_info_kernel(parse_options_view const options,
   }
 }
 
+/**
+ * @brief Returns the range of the list elements in a given row, excluding the brackets and the
+ * surrounding whitespace.
+ */
+__device__ std::pair<char const *, char const *> get_list_elements_range(
+  device_span<char const> const data, device_span<uint64_t const> const row_offsets, size_type row)
+{
+  auto const row_data_range = get_row_data_range(data, row_offsets, row);
+  return trim_whitespaces_quotes(row_data_range.first, row_data_range.second);
+}
+
+/**
+ * @brief CUDA kernel that counts the elements of each list in the input.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] row_offsets The offset of each list in the input
+ * @param[out] element_counts The number of elements of each list
+ */
+__global__ void count_list_elements_kernel(parse_options_view const opts,
+                                           device_span<char const> const data,
+                                           device_span<uint64_t const> const row_offsets,
+                                           device_span<size_type> const element_counts)
+{
+  auto const rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= row_offsets.size()) return;
+
+  auto const range = get_list_elements_range(data, row_offsets, rec_id);
+  size_type count  = 0;
+  for (auto current = range.first; current < range.second; ++count) {
+    current = seek_json_field_end(current, range.second, opts) + 1;
+  }
+  element_counts[rec_id] = count;
+}
+
+/**
+ * @brief CUDA kernel that stores the text of the elements of each list in the input.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] row_offsets The offset of each list in the input
+ * @param[in] element_offsets The index of the first element of each list in the output
+ * @param[out] elements The text of each element, excluding the surrounding whitespace
+ */
+__global__ void collect_list_elements_kernel(parse_options_view const opts,
+                                             device_span<char const> const data,
+                                             device_span<uint64_t const> const row_offsets,
+                                             device_span<size_type const> const element_offsets,
+                                             device_span<string_index_pair> const elements)
+{
+  auto const rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= row_offsets.size()) return;
+
+  auto const range = get_list_elements_range(data, row_offsets, rec_id);
+  auto element_idx = element_offsets[rec_id];
+  for (auto current = range.first; current < range.second;) {
+    auto const field_end    = seek_json_field_end(current, range.second, opts);
+    auto const element      = trim_whitespaces_quotes(current, field_end);
+    elements[element_idx++] = {element.first, element.second - element.first};
+    current                 = field_end + 1;
+  }
+}
+
+/**
+ * @brief Returns the range of a standalone value in the input, excluding the surrounding
+ * whitespace and quotes.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] value_offsets The offset of each value in the input
+ * @param[in] idx Index of the value
+ * @param[out] is_quoted Whether the value is enclosed in quotes
+ */
+__device__ std::pair<char const *, char const *> get_value_range(
+  parse_options_view const &opts,
+  device_span<char const> const data,
+  device_span<uint64_t const> const value_offsets,
+  size_type idx,
+  bool &is_quoted)
+{
+  auto const begin = data.begin() + value_offsets[idx];
+  auto const end =
+    data.begin() + ((idx < value_offsets.size() - 1) ? value_offsets[idx + 1] : data.size());
+  auto const trimmed = trim_whitespaces_quotes(begin, end, opts.quotechar);
+  is_quoted = trimmed.first > begin && *(trimmed.first - 1) == opts.quotechar &&
+              trimmed.second < end && *trimmed.second == opts.quotechar;
+  return trimmed;
+}
+
+/**
+ * @brief CUDA kernel that determines the type histogram of a set of standalone values.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] value_offsets The offset of each value in the input
+ * @param[out] histogram The count for each data type
+ */
+__global__ void detect_value_types_kernel(parse_options_view const opts,
+                                          device_span<char const> const data,
+                                          device_span<uint64_t const> const value_offsets,
+                                          cudf::io::column_type_histogram *histogram)
+{
+  auto const idx = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (idx >= value_offsets.size()) return;
+
+  bool is_quoted;
+  auto const value     = get_value_range(opts, data, value_offsets, idx, is_quoted);
+  auto const value_len = static_cast<size_t>(std::max(value.second - value.first, 0L));
+  if (serialized_trie_contains(opts.trie_na, {value.first, value_len})) {
+    atomicAdd(&histogram->null_count, 1);
+    return;
+  }
+  update_type_histogram(opts, value.first, value.second, is_quoted, *histogram);
+}
+
+/**
+ * @brief CUDA kernel that converts a set of standalone values into cuDF column data.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] value_offsets The offset of each value in the input
+ * @param[in] type The data type of the output column
+ * @param[out] output The output column data
+ * @param[out] valid The bitmap indicating whether the column fields are valid
+ * @param[out] num_valid The number of valid fields in the column
+ */
+__global__ void convert_values_kernel(parse_options_view const opts,
+                                      device_span<char const> const data,
+                                      device_span<uint64_t const> const value_offsets,
+                                      data_type type,
+                                      void *output,
+                                      bitmask_type *valid,
+                                      cudf::size_type *num_valid)
+{
+  auto const idx = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (idx >= value_offsets.size()) return;
+
+  bool is_quoted;
+  auto const value = get_value_range(opts, data, value_offsets, idx, is_quoted);
+  convert_field(opts, value.first, value.second, type, output, valid, num_valid, idx);
+}
+
 }  // namespace
 
 /**
@@ -762,6 +1021,7 @@ void convert_json_to_columns(parse_options_view const &opts,
 {
   int block_size;
   int min_grid_size;
+  if (row_offsets.empty()) return;
   CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
     &min_grid_size, &block_size, convert_data_to_columns_kernel));
 
@@ -803,6 +1063,8 @@ std::vector<cudf::io::column_type_histogram> detect_data_types(
       [num_records = row_offsets.size()] __device__(auto &info) { info.null_count = num_records; });
   }
 
+  if (row_offsets.empty()) { return std::vector<cudf::io::column_type_histogram>(num_columns); }
+
   // Calculate actual block count to use based on records count
   const int grid_size = (row_offsets.size() + block_size - 1) / block_size;
 
@@ -828,6 +1090,7 @@ void collect_keys_info(parse_options_view const &options,
                        thrust::optional<mutable_table_device_view> keys_info,
                        rmm::cuda_stream_view stream)
 {
+  if (row_offsets.empty()) return;
   int block_size;
   int min_grid_size;
   CUDA_TRY(
@@ -842,6 +1105,104 @@ void collect_keys_info(parse_options_view const &options,
   CUDA_TRY(cudaGetLastError());
 }
 
+/**
+ * @copydoc cudf::io::json::gpu::count_list_elements
+ */
+void count_list_elements(parse_options_view const &options,
+                         device_span<char const> const data,
+                         device_span<uint64_t const> const row_offsets,
+                         device_span<size_type> const element_counts,
+                         rmm::cuda_stream_view stream)
+{
+  if (row_offsets.empty()) return;
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, count_list_elements_kernel));
+
+  const int grid_size = (row_offsets.size() + block_size - 1) / block_size;
+
+  count_list_elements_kernel<<<grid_size, block_size, 0, stream.value()>>>(
+    options, data, row_offsets, element_counts);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::collect_list_elements
+ */
+void collect_list_elements(parse_options_view const &options,
+                           device_span<char const> const data,
+                           device_span<uint64_t const> const row_offsets,
+                           device_span<size_type const> const element_offsets,
+                           device_span<string_index_pair> const elements,
+                           rmm::cuda_stream_view stream)
+{
+  if (row_offsets.empty()) return;
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(
+    cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, collect_list_elements_kernel));
+
+  const int grid_size = (row_offsets.size() + block_size - 1) / block_size;
+
+  collect_list_elements_kernel<<<grid_size, block_size, 0, stream.value()>>>(
+    options, data, row_offsets, element_offsets, elements);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::detect_value_types
+ */
+cudf::io::column_type_histogram detect_value_types(parse_options_view const &options,
+                                                   device_span<char const> const data,
+                                                   device_span<uint64_t const> const value_offsets,
+                                                   rmm::cuda_stream_view stream)
+{
+  rmm::device_scalar<cudf::io::column_type_histogram> d_histogram(
+    cudf::io::column_type_histogram{}, stream);
+  if (!value_offsets.empty()) {
+    int block_size;
+    int min_grid_size;
+    CUDA_TRY(
+      cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, detect_value_types_kernel));
+
+    const int grid_size = (value_offsets.size() + block_size - 1) / block_size;
+
+    detect_value_types_kernel<<<grid_size, block_size, 0, stream.value()>>>(
+      options, data, value_offsets, d_histogram.data());
+
+    CUDA_TRY(cudaGetLastError());
+  }
+  return d_histogram.value(stream);
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::convert_values
+ */
+void convert_values(parse_options_view const &options,
+                    device_span<char const> const data,
+                    device_span<uint64_t const> const value_offsets,
+                    data_type type,
+                    void *output,
+                    bitmask_type *valid,
+                    cudf::size_type *num_valid,
+                    rmm::cuda_stream_view stream)
+{
+  if (value_offsets.empty()) return;
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, convert_values_kernel));
+
+  const int grid_size = (value_offsets.size() + block_size - 1) / block_size;
+
+  convert_values_kernel<<<grid_size, block_size, 0, stream.value()>>>(
+    options, data, value_offsets, type, output, valid, num_valid);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
@@ -100,6 +100,74 @@ void collect_keys_info(parse_options_view const &options,
                        thrust::optional<mutable_table_device_view> keys_info,
                        rmm::cuda_stream_view stream);
 
+/**
+ * @brief Counts the elements of each JSON array in the input.
+ *
+ * @param[in] options A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] row_offsets The offset of each array in the input
+ * @param[out] element_counts The number of elements of each array
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void count_list_elements(parse_options_view const &options,
+                         device_span<char const> data,
+                         device_span<uint64_t const> row_offsets,
+                         device_span<size_type> element_counts,
+                         rmm::cuda_stream_view stream);
+
+/**
+ * @brief Collects the text of the elements of each JSON array in the input.
+ *
+ * @param[in] options A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] row_offsets The offset of each array in the input
+ * @param[in] element_offsets The index of the first element of each array in the output
+ * @param[out] elements The text of each element, excluding the surrounding whitespace
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void collect_list_elements(parse_options_view const &options,
+                           device_span<char const> data,
+                           device_span<uint64_t const> row_offsets,
+                           device_span<size_type const> element_offsets,
+                           device_span<string_index_pair> elements,
+                           rmm::cuda_stream_view stream);
+
+/**
+ * @brief Determines the type histogram of a set of standalone JSON values, e.g. array elements.
+ *
+ * @param[in] options A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] value_offsets The offset of each value in the input
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns The count for each data type
+ */
+cudf::io::column_type_histogram detect_value_types(parse_options_view const &options,
+                                                   device_span<char const> data,
+                                                   device_span<uint64_t const> value_offsets,
+                                                   rmm::cuda_stream_view stream);
+
+/**
+ * @brief Converts a set of standalone JSON values into raw cuDF column data.
+ *
+ * @param[in] options A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] value_offsets The offset of each value in the input
+ * @param[in] type The data type of the output column
+ * @param[out] output The output column data
+ * @param[out] valid The bitmap indicating whether the column fields are valid
+ * @param[out] num_valid The number of valid fields in the column
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void convert_values(parse_options_view const &options,
+                    device_span<char const> data,
+                    device_span<uint64_t const> value_offsets,
+                    data_type type,
+                    void *output,
+                    bitmask_type *valid,
+                    cudf::size_type *num_valid,
+                    rmm::cuda_stream_view stream);
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
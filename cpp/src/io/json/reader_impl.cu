@@ -23,17 +23,21 @@
 
 #include <io/comp/io_uncomp.h>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/pinned_host_pool.hpp>
 #include <io/utilities/type_conversion.cuh>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/strings/detail/replace.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_scalar.hpp>
@@ -202,6 +206,35 @@ auto sort_keys_info_by_offset(std::unique_ptr<table> info)
   return sort_by_key(info->view(), table_view({agg_offset_col_view}));
 }
 
+/**
+ * @brief Extract the keys of the JSON objects in the given rows.
+ *
+ * @param[in] opts Parsing options
+ * @param[in] data Input JSON device data
+ * @param[in] row_offsets Device array of row start locations in the input buffer
+ * @param[in] h_data Host copy of the input data
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Names of the keys, in order of first occurrence, and a map that maps their hash values
+ * to column indices; the map is null if there are no keys
+ */
+std::pair<std::vector<std::string>, col_map_ptr_type> get_object_keys_hashes(
+  parse_options_view const &opts,
+  device_span<char const> const data,
+  device_span<uint64_t const> const row_offsets,
+  char const *h_data,
+  rmm::cuda_stream_view stream)
+{
+  auto info = create_json_keys_info_table(opts, data, row_offsets, stream);
+  if (info->num_rows() == 0) { return {}; }
+
+  auto aggregated_info = aggregate_keys_info(std::move(info));
+  auto sorted_info     = sort_keys_info_by_offset(std::move(aggregated_info));
+
+  return {create_key_strings(h_data, sorted_info->view(), stream),
+          create_col_names_hash_map(sorted_info->get_column(2).view(), stream)};
+}
+
 /**
  * @brief Extract JSON object keys from a JSON file.
  *
@@ -212,17 +245,313 @@ auto sort_keys_info_by_offset(std::unique_ptr<table> info)
 std::pair<std::vector<std::string>, col_map_ptr_type> reader::impl::get_json_object_keys_hashes(
   rmm::cuda_stream_view stream)
 {
-  auto info = create_json_keys_info_table(
+  return get_object_keys_hashes(
     opts_.view(),
     device_span<char const>(static_cast<char const *>(data_.data()), data_.size()),
     rec_starts_,
+    uncomp_data_,
     stream);
+}
 
-  auto aggregated_info = aggregate_keys_info(std::move(info));
-  auto sorted_info     = sort_keys_info_by_offset(std::move(aggregated_info));
+/**
+ * @brief Infers the type of a column from the histogram of its values.
+ *
+ * @param[in] cinfo Type histogram of the column
+ * @param[in] num_rows Number of rows in the column
+ *
+ * @return The inferred type
+ */
+type_id infer_type_id(cudf::io::column_type_histogram const &cinfo, size_t num_rows)
+{
+  auto int_count_total =
+    cinfo.big_int_count + cinfo.negative_small_int_count + cinfo.positive_small_int_count;
+  auto const valid_count = static_cast<int>(num_rows) - cinfo.null_count;
+  if (cinfo.null_count == static_cast<int>(num_rows)) {
+    // Entire column is NULL; allocate the smallest amount of memory
+    return type_id::INT8;
+  } else if (cinfo.struct_count == valid_count) {
+    return type_id::STRUCT;
+  } else if (cinfo.list_count == valid_count) {
+    return type_id::LIST;
+  } else if (cinfo.string_count > 0 || cinfo.struct_count > 0 || cinfo.list_count > 0) {
+    // Nested values mixed with other values are returned as text
+    return type_id::STRING;
+  } else if (cinfo.datetime_count > 0) {
+    return type_id::TIMESTAMP_MILLISECONDS;
+  } else if (cinfo.float_count > 0 || (int_count_total > 0 && cinfo.null_count > 0)) {
+    return type_id::FLOAT64;
+  } else if (cinfo.big_int_count == 0 && int_count_total != 0) {
+    return type_id::INT64;
+  } else if (cinfo.big_int_count != 0 && cinfo.negative_small_int_count != 0) {
+    return type_id::STRING;
+  } else if (cinfo.big_int_count != 0) {
+    return type_id::UINT64;
+  } else if (cinfo.bool_count > 0) {
+    return type_id::BOOL8;
+  } else {
+    CUDF_FAIL("Data type detection failed.\n");
+  }
+}
 
-  return {create_key_strings(uncomp_data_, sorted_info->view(), stream),
-          create_col_names_hash_map(sorted_info->get_column(2).view(), stream)};
+/**
+ * @brief Removes the escape characters of '\"', '\\' and of the control characters.
+ */
+std::unique_ptr<column> remove_escape_characters(column_view const &strings,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource *mr)
+{
+  auto target_chars   = std::vector<char>{'\\', '"', '\\', '\\', '\\', 't', '\\', 'r', '\\', 'b'};
+  auto target_offsets = std::vector<size_type>{0, 2, 4, 6, 8, 10};
+
+  auto repl_chars   = std::vector<char>{'"', '\\', '\t', '\r', '\b'};
+  auto repl_offsets = std::vector<size_type>{0, 1, 2, 3, 4, 5};
+
+  auto target = make_strings_column(cudf::detail::make_device_uvector_async(target_chars, stream),
+                                    cudf::detail::make_device_uvector_async(target_offsets, stream),
+                                    {},
+                                    0,
+                                    stream);
+  auto repl   = make_strings_column(cudf::detail::make_device_uvector_async(repl_chars, stream),
+                                  cudf::detail::make_device_uvector_async(repl_offsets, stream),
+                                  {},
+                                  0,
+                                  stream);
+
+  auto result = cudf::strings::detail::replace(strings, target->view(), repl->view(), stream, mr);
+  // This is to ensure the stream-ordered make_stream_column calls above complete before
+  // the temporary std::vectors are destroyed on exit from this function.
+  stream.synchronize();
+  return result;
+}
+
+/**
+ * @brief Returns the characters of a strings column and the offset of each string, to be parsed
+ * as rows of JSON text.
+ */
+std::pair<device_span<char const>, rmm::device_uvector<uint64_t>> get_text_rows(
+  strings_column_view const &values, rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<uint64_t> row_offsets(values.size(), stream);
+  if (values.size() == 0) { return {device_span<char const>{}, std::move(row_offsets)}; }
+
+  auto const offsets = values.offsets().begin<size_type>() + values.offset();
+  thrust::copy(rmm::exec_policy(stream), offsets, offsets + values.size(), row_offsets.begin());
+  return {device_span<char const>(values.chars().data<char>(), values.chars_size()),
+          std::move(row_offsets)};
+}
+
+std::unique_ptr<column> nested_from_json(parse_options_view const &opts,
+                                         strings_column_view const &values,
+                                         data_type type,
+                                         column_name_info &schema,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource *mr);
+
+/**
+ * @brief Parses rows of JSON text into columns of the given types.
+ *
+ * Nested values are first stored as text, which is then parsed into the child columns.
+ *
+ * @param[in] opts Parsing options
+ * @param[in] data Input JSON device data
+ * @param[in] row_offsets Device array of row start locations in the input buffer
+ * @param[in] dtypes Type of each column
+ * @param[in] col_map Pointer to the (key hash -> column index) map in device memory; nullptr if
+ * the rows are not objects
+ * @param[in,out] schema Name information of each column, to which the names of the children of
+ * nested columns are added
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned columns
+ *
+ * @return The parsed columns
+ */
+std::vector<std::unique_ptr<column>> convert_rows_to_columns(
+  parse_options_view const &opts,
+  device_span<char const> const data,
+  device_span<uint64_t const> const row_offsets,
+  host_span<data_type const> dtypes,
+  col_map_type *col_map,
+  std::vector<column_name_info> &schema,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource *mr)
+{
+  const auto num_columns = dtypes.size();
+  const auto num_records = row_offsets.size();
+
+  // alloc output buffers; nested values are stored as text
+  std::vector<column_buffer> out_buffers;
+  for (size_t col = 0; col < num_columns; ++col) {
+    auto const buffer_type = is_nested(dtypes[col]) ? data_type{type_id::STRING} : dtypes[col];
+    out_buffers.emplace_back(buffer_type, num_records, true, stream, mr);
+  }
+
+  thrust::host_vector<data_type> h_dtypes(num_columns);
+  thrust::host_vector<void *> h_data(num_columns);
+  thrust::host_vector<bitmask_type *> h_valid(num_columns);
+
+  for (size_t i = 0; i < num_columns; ++i) {
+    h_dtypes[i] = dtypes[i];
+    h_data[i]   = out_buffers[i].data();
+    h_valid[i]  = out_buffers[i].null_mask();
+  }
+
+  rmm::device_vector<data_type> d_dtypes           = h_dtypes;
+  rmm::device_vector<void *> d_data                = h_data;
+  rmm::device_vector<cudf::bitmask_type *> d_valid = h_valid;
+  rmm::device_vector<cudf::size_type> d_valid_counts(num_columns, 0);
+
+  cudf::io::json::gpu::convert_json_to_columns(
+    opts, data, row_offsets, d_dtypes, col_map, d_data, d_valid, d_valid_counts, stream);
+
+  stream.synchronize();
+
+  thrust::host_vector<cudf::size_type> h_valid_counts = d_valid_counts;
+  std::vector<std::unique_ptr<column>> out_columns;
+  for (size_t i = 0; i < num_columns; ++i) {
+    out_buffers[i].null_count() = num_records - h_valid_counts[i];
+
+    auto out_column = make_column(out_buffers[i], nullptr, stream, mr);
+    if (is_nested(dtypes[i])) {
+      out_columns.emplace_back(nested_from_json(
+        opts, strings_column_view(out_column->view()), dtypes[i], schema[i], stream, mr));
+    } else if (out_column->type().id() == type_id::STRING) {
+      // Need to remove escape character in case of '\"' and '\\'
+      out_columns.emplace_back(remove_escape_characters(out_column->view(), stream, mr));
+    } else {
+      out_columns.emplace_back(std::move(out_column));
+    }
+  }
+  return out_columns;
+}
+
+/**
+ * @brief Parses standalone JSON values, e.g. array elements, into a column of the inferred type.
+ */
+std::unique_ptr<column> values_from_json(parse_options_view const &opts,
+                                         strings_column_view const &values,
+                                         column_name_info &schema,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  auto const num_values = values.size();
+  auto const text       = get_text_rows(values, stream);
+  auto const type       = data_type{
+    infer_type_id(cudf::io::json::gpu::detect_value_types(opts, text.first, text.second, stream),
+                  num_values)};
+  if (is_nested(type)) { return nested_from_json(opts, values, type, schema, stream, mr); }
+
+  column_buffer out_buffer(type, num_values, true, stream, mr);
+  rmm::device_scalar<cudf::size_type> num_valid(0, stream);
+  cudf::io::json::gpu::convert_values(opts,
+                                      text.first,
+                                      text.second,
+                                      type,
+                                      out_buffer.data(),
+                                      out_buffer.null_mask(),
+                                      num_valid.data(),
+                                      stream);
+  out_buffer.null_count() = num_values - num_valid.value(stream);
+
+  auto out_column = make_column(out_buffer, nullptr, stream, mr);
+  if (type.id() == type_id::STRING) {
+    return remove_escape_characters(out_column->view(), stream, mr);
+  }
+  return out_column;
+}
+
+/**
+ * @brief Parses the text of JSON objects or arrays into a STRUCT or LIST column.
+ *
+ * Null and missing values are null in the output. The keys of the objects, and the type of the
+ * children, are inferred from the values.
+ *
+ * @param[in] opts Parsing options
+ * @param[in] values Text of the nested values
+ * @param[in] type STRUCT or LIST
+ * @param[in,out] schema Name information of the column, to which the names of the children are
+ * added
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned column
+ *
+ * @return The nested column
+ */
+std::unique_ptr<column> nested_from_json(parse_options_view const &opts,
+                                         strings_column_view const &values,
+                                         data_type type,
+                                         column_name_info &schema,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  auto const num_rows = values.size();
+  auto const text     = get_text_rows(values, stream);
+  auto const &data    = text.first;
+  auto const &offsets = text.second;
+
+  if (type.id() == type_id::STRUCT) {
+    // The values are parsed as object rows; each key becomes a child column
+    std::vector<std::unique_ptr<column>> children;
+    if (num_rows != 0) {
+      std::vector<char> h_data(data.size());
+      CUDA_TRY(cudaMemcpyAsync(
+        h_data.data(), data.data(), data.size(), cudaMemcpyDeviceToHost, stream.value()));
+      stream.synchronize();
+
+      auto const keys = get_object_keys_hashes(opts, data, offsets, h_data.data(), stream);
+      if (!keys.first.empty()) {
+        rmm::device_scalar<col_map_type> d_key_map(*keys.second, stream);
+        auto const h_column_infos = cudf::io::json::gpu::detect_data_types(
+          opts, data, offsets, true, keys.first.size(), d_key_map.data(), stream);
+
+        std::vector<data_type> dtypes;
+        std::transform(h_column_infos.cbegin(),
+                       h_column_infos.cend(),
+                       std::back_inserter(dtypes),
+                       [&](auto const &cinfo) {
+                         return data_type{infer_type_id(cinfo, num_rows)};
+                       });
+        std::transform(keys.first.cbegin(),
+                       keys.first.cend(),
+                       std::back_inserter(schema.children),
+                       [](auto const &name) { return column_name_info{name}; });
+        children = convert_rows_to_columns(
+          opts, data, offsets, dtypes, d_key_map.data(), schema.children, stream, mr);
+      }
+    }
+    return make_structs_column(num_rows,
+                               std::move(children),
+                               values.null_count(),
+                               cudf::detail::copy_bitmask(values.parent(), stream, mr),
+                               stream,
+                               mr);
+  }
+
+  CUDF_EXPECTS(type.id() == type_id::LIST, "Unsupported nested type");
+  // The values are parsed as array rows; the elements of all lists form the child column
+  auto list_offsets =
+    cudf::detail::make_zeroed_device_uvector_async<size_type>(num_rows + 1, stream, mr);
+  cudf::io::json::gpu::count_list_elements(
+    opts, data, offsets, device_span<size_type>(list_offsets.data(), num_rows), stream);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), list_offsets.begin(), list_offsets.end(), list_offsets.begin());
+
+  rmm::device_uvector<string_index_pair> elements(list_offsets.back_element(stream), stream);
+  cudf::io::json::gpu::collect_list_elements(opts, data, offsets, list_offsets, elements, stream);
+  auto const element_values = make_strings_column(elements, stream);
+
+  schema.children.emplace_back("offsets");
+  schema.children.emplace_back("element");
+  auto child = values_from_json(
+    opts, strings_column_view(element_values->view()), schema.children.back(), stream, mr);
+
+  auto offsets_column =
+    std::make_unique<column>(data_type{type_id::INT32}, num_rows + 1, list_offsets.release());
+  return make_lists_column(num_rows,
+                           std::move(offsets_column),
+                           std::move(child),
+                           values.null_count(),
+                           cudf::detail::copy_bitmask(values.parent(), stream, mr),
+                           stream,
+                           mr);
 }
 
 /**
@@ -235,10 +564,7 @@ std::pair<std::vector<std::string>, col_map_ptr_type> reader::impl::get_json_obj
  */
 void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
 {
-  size_t map_range_size = 0;
-  if (range_size != 0) {
-    map_range_size = range_size + calculate_max_row_size(options_.get_dtypes().size());
-  }
+  auto const map_range_size = get_map_range_size(range_size);
 
   // Support delayed opening of the file if using memory mapping datasource
   // This allows only mapping of a subset of the file if using byte range
@@ -246,10 +572,13 @@ void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
     assert(!filepath_.empty());
     source_ = datasource::create(filepath_, range_offset, map_range_size);
   }
+  // Chunks are read through the prefetching source, so that the next chunk is read in the
+  // background
+  auto *const source = (prefetch_source_ != nullptr) ? prefetch_source_.get() : source_.get();
 
   if (!source_->is_empty()) {
     auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
-    buffer_        = source_->host_read(range_offset, data_size);
+    buffer_        = source->host_read(range_offset, data_size);
   }
 
   byte_range_offset_ = range_offset;
@@ -257,6 +586,12 @@ void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
   load_whole_file_   = byte_range_offset_ == 0 && byte_range_size_ == 0;
 }
 
+size_t reader::impl::get_map_range_size(size_t range_size) const
+{
+  if (range_size == 0) { return 0; }
+  return range_size + calculate_max_row_size(options_.get_dtypes().size());
+}
+
 /**
  * @brief Decompress the input data, if needed
  *
@@ -278,12 +613,16 @@ void reader::impl::decompress_input(rmm::cuda_stream_view stream)
       host_span<char const>(                     //
         reinterpret_cast<const char *>(buffer_->data()),
         buffer_->size()),
-      compression_type);
+      compression_type,
+      stream);
 
     uncomp_data_ = uncomp_data_owner_.data();
     uncomp_size_ = uncomp_data_owner_.size();
   }
-  if (load_whole_file_) data_ = rmm::device_buffer(uncomp_data_, uncomp_size_, stream);
+  if (load_whole_file_) {
+    data_ = rmm::device_buffer(uncomp_size_, stream);
+    copy_host_to_device(data_.data(), uncomp_data_, uncomp_size_, stream);
+  }
 }
 
 /**
@@ -373,17 +712,16 @@ void reader::impl::upload_data_to_device(rmm::cuda_stream_view stream)
     thrust::host_vector<uint64_t> h_rec_starts = rec_starts_;
 
     if (byte_range_size_ != 0) {
-      auto it = h_rec_starts.end() - 1;
-      while (it >= h_rec_starts.begin() && *it > byte_range_size_) {
-        end_offset = *it;
-        --it;
-      }
-      h_rec_starts.erase(it + 1, h_rec_starts.end());
+      auto const range_end =
+        std::upper_bound(h_rec_starts.begin(), h_rec_starts.end(), byte_range_size_);
+      if (range_end != h_rec_starts.end()) { end_offset = *range_end; }
+      h_rec_starts.erase(range_end, h_rec_starts.end());
     }
 
     // Resize to exclude rows outside of the range
     // Adjust row start positions to account for the data subcopy
-    start_offset = h_rec_starts.front();
+    // A range can contain no row starts if a single row spans it
+    start_offset = h_rec_starts.empty() ? end_offset : h_rec_starts.front();
     rec_starts_.resize(h_rec_starts.size());
     thrust::transform(rmm::exec_policy(stream),
                       rec_starts_.begin(),
@@ -398,7 +736,8 @@ void reader::impl::upload_data_to_device(rmm::cuda_stream_view stream)
                "Error finding the record within the specified byte range.\n");
 
   // Upload the raw data that is within the rows of interest
-  data_ = rmm::device_buffer(uncomp_data_ + start_offset, bytes_to_upload, stream);
+  data_ = rmm::device_buffer(bytes_to_upload, stream);
+  copy_host_to_device(data_.data(), uncomp_data_ + start_offset, bytes_to_upload, stream);
 }
 
 /**
@@ -441,7 +780,7 @@ void reader::impl::set_column_names(rmm::cuda_stream_view stream)
     // use keys as column names if input rows are objects
     auto keys_desc         = get_json_object_keys_hashes(stream);
     metadata_.column_names = keys_desc.first;
-    set_column_map(std::move(keys_desc.second));
+    if (keys_desc.second != nullptr) { set_column_map(std::move(keys_desc.second)); }
   } else {
     int cols_found = 0;
     bool quotation = false;
@@ -519,35 +858,12 @@ void reader::impl::set_data_types(rmm::cuda_stream_view stream)
       get_column_map_device_ptr(),
       stream);
 
-    auto get_type_id = [&](auto const &cinfo) {
-      auto int_count_total =
-        cinfo.big_int_count + cinfo.negative_small_int_count + cinfo.positive_small_int_count;
-      if (cinfo.null_count == static_cast<int>(rec_starts_.size())) {
-        // Entire column is NULL; allocate the smallest amount of memory
-        return type_id::INT8;
-      } else if (cinfo.string_count > 0) {
-        return type_id::STRING;
-      } else if (cinfo.datetime_count > 0) {
-        return type_id::TIMESTAMP_MILLISECONDS;
-      } else if (cinfo.float_count > 0 || (int_count_total > 0 && cinfo.null_count > 0)) {
-        return type_id::FLOAT64;
-      } else if (cinfo.big_int_count == 0 && int_count_total != 0) {
-        return type_id::INT64;
-      } else if (cinfo.big_int_count != 0 && cinfo.negative_small_int_count != 0) {
-        return type_id::STRING;
-      } else if (cinfo.big_int_count != 0) {
-        return type_id::UINT64;
-      } else if (cinfo.bool_count > 0) {
-        return type_id::BOOL8;
-      } else {
-        CUDF_FAIL("Data type detection failed.\n");
-      }
-    };
-
     std::transform(std::cbegin(h_column_infos),
                    std::cend(h_column_infos),
                    std::back_inserter(dtypes_),
-                   [&](auto const &cinfo) { return data_type{get_type_id(cinfo)}; });
+                   [&](auto const &cinfo) {
+                     return data_type{infer_type_id(cinfo, rec_starts_.size())};
+                   });
   }
 }  // namespace json
 
@@ -560,82 +876,34 @@ void reader::impl::set_data_types(rmm::cuda_stream_view stream)
  */
 table_with_metadata reader::impl::convert_data_to_table(rmm::cuda_stream_view stream)
 {
-  const auto num_columns = dtypes_.size();
-  const auto num_records = rec_starts_.size();
-
-  // alloc output buffers.
-  std::vector<column_buffer> out_buffers;
-  for (size_t col = 0; col < num_columns; ++col) {
-    out_buffers.emplace_back(dtypes_[col], num_records, true, stream, mr_);
-  }
-
-  thrust::host_vector<data_type> h_dtypes(num_columns);
-  thrust::host_vector<void *> h_data(num_columns);
-  thrust::host_vector<bitmask_type *> h_valid(num_columns);
+  auto metadata = metadata_;
+  std::transform(metadata.column_names.cbegin(),
+                 metadata.column_names.cend(),
+                 std::back_inserter(metadata.schema_info),
+                 [](auto const &name) { return column_name_info{name}; });
 
-  for (size_t i = 0; i < num_columns; ++i) {
-    h_dtypes[i] = dtypes_[i];
-    h_data[i]   = out_buffers[i].data();
-    h_valid[i]  = out_buffers[i].null_mask();
-  }
-
-  rmm::device_vector<data_type> d_dtypes           = h_dtypes;
-  rmm::device_vector<void *> d_data                = h_data;
-  rmm::device_vector<cudf::bitmask_type *> d_valid = h_valid;
-  rmm::device_vector<cudf::size_type> d_valid_counts(num_columns, 0);
-
-  cudf::io::json::gpu::convert_json_to_columns(
+  auto out_columns = convert_rows_to_columns(
     opts_.view(),
     device_span<char const>(static_cast<char const *>(data_.data()), data_.size()),
     rec_starts_,
-    d_dtypes,
+    dtypes_,
     get_column_map_device_ptr(),
-    d_data,
-    d_valid,
-    d_valid_counts,
-    stream);
-
-  stream.synchronize();
-
-  // postprocess columns
-  auto target_chars   = std::vector<char>{'\\', '"', '\\', '\\', '\\', 't', '\\', 'r', '\\', 'b'};
-  auto target_offsets = std::vector<size_type>{0, 2, 4, 6, 8, 10};
+    metadata.schema_info,
+    stream,
+    mr_);
 
-  auto repl_chars   = std::vector<char>{'"', '\\', '\t', '\r', '\b'};
-  auto repl_offsets = std::vector<size_type>{0, 1, 2, 3, 4, 5};
+  CUDF_EXPECTS(!out_columns.empty(), "No columns created from json input");
 
-  auto target = make_strings_column(cudf::detail::make_device_uvector_async(target_chars, stream),
-                                    cudf::detail::make_device_uvector_async(target_offsets, stream),
-                                    {},
-                                    0,
-                                    stream);
-  auto repl   = make_strings_column(cudf::detail::make_device_uvector_async(repl_chars, stream),
-                                  cudf::detail::make_device_uvector_async(repl_offsets, stream),
-                                  {},
-                                  0,
-                                  stream);
+  return table_with_metadata{std::make_unique<table>(std::move(out_columns)), metadata};
+}
 
-  thrust::host_vector<cudf::size_type> h_valid_counts = d_valid_counts;
+table_with_metadata reader::impl::make_empty_table() const
+{
   std::vector<std::unique_ptr<column>> out_columns;
-  for (size_t i = 0; i < num_columns; ++i) {
-    out_buffers[i].null_count() = num_records - h_valid_counts[i];
-
-    auto out_column = make_column(out_buffers[i], nullptr, stream, mr_);
-    if (out_column->type().id() == type_id::STRING) {
-      // Need to remove escape character in case of '\"' and '\\'
-      out_columns.emplace_back(cudf::strings::detail::replace(
-        out_column->view(), target->view(), repl->view(), stream, mr_));
-    } else {
-      out_columns.emplace_back(std::move(out_column));
-    }
-  }
-
-  // This is to ensure the stream-ordered make_stream_column calls above complete before
-  // the temporary std::vectors are destroyed on exit from this function.
-  stream.synchronize();
-
-  CUDF_EXPECTS(!out_columns.empty(), "No columns created from json input");
-
+  std::transform(dtypes_.cbegin(),
+                 dtypes_.cend(),
+                 std::back_inserter(out_columns),
+                 [](auto const &dtype) { return make_empty_column(dtype); });
   return table_with_metadata{std::make_unique<table>(std::move(out_columns)), metadata_};
 }
 
@@ -691,6 +959,75 @@ table_with_metadata reader::impl::read(json_reader_options const &options,
   return convert_data_to_table(stream);
 }
 
+void reader::impl::setup_chunking(size_t chunk_read_limit)
+{
+  CUDF_EXPECTS(options_.get_byte_range_offset() == 0 && options_.get_byte_range_size() == 0,
+               "The chunked reader does not support byte ranges");
+  auto const compression_type =
+    infer_compression_type(options_.get_compression(),
+                           filepath_,
+                           {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
+  CUDF_EXPECTS(compression_type == "none", "The chunked reader does not support compression");
+
+  chunk_read_limit_ = chunk_read_limit;
+  if (source_ == nullptr) {
+    assert(!filepath_.empty());
+    source_ = datasource::create(filepath_, 0, 0);
+  }
+  if (chunk_read_limit_ != 0) {
+    prefetch_source_ = std::make_unique<async_prefetch_datasource>(source_.get());
+  }
+}
+
+bool reader::impl::has_next() const
+{
+  // A byte range reads the rows that start after its offset
+  return is_first_chunk_ || chunk_offset_ + 1 < source_->size();
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+
+  auto const range_offset = chunk_offset_;
+  chunk_offset_ = (chunk_read_limit_ != 0) ? range_offset + chunk_read_limit_ : source_->size();
+
+  // Read the input of this chunk and the next one in the background; the current chunk is
+  // already being read unless this is the first one
+  if (prefetch_source_ != nullptr) {
+    auto const map_range_size = get_map_range_size(chunk_read_limit_);
+    std::vector<async_prefetch_datasource::byte_range> ranges{{range_offset, map_range_size}};
+    if (chunk_offset_ < source_->size()) { ranges.push_back({chunk_offset_, map_range_size}); }
+    prefetch_source_->prefetch(ranges, stream);
+  }
+
+  ingest_raw_input(range_offset, chunk_read_limit_);
+  CUDF_EXPECTS(buffer_ != nullptr, "Ingest failed: input data is null.\n");
+
+  decompress_input(stream);
+  CUDF_EXPECTS(uncomp_data_ != nullptr, "Ingest failed: uncompressed input data is null.\n");
+  CUDF_EXPECTS(uncomp_size_ != 0, "Ingest failed: uncompressed input data has zero size.\n");
+
+  set_record_starts(stream);
+  upload_data_to_device(stream);
+
+  // Later chunks are decoded with the column names, key map and types of the first chunk, which
+  // skips the key collection and type inference passes
+  if (is_first_chunk_) {
+    is_first_chunk_ = false;
+    CUDF_EXPECTS(!rec_starts_.empty(), "Error enumerating records.\n");
+
+    set_column_names(stream);
+    CUDF_EXPECTS(!metadata_.column_names.empty(), "Error determining column names.\n");
+
+    set_data_types(stream);
+    CUDF_EXPECTS(!dtypes_.empty(), "Error in data type detection.\n");
+  }
+
+  if (rec_starts_.empty()) { return make_empty_table(); }
+  return convert_data_to_table(stream);
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                json_reader_options const &options,
@@ -719,6 +1056,38 @@ table_with_metadata reader::read(json_reader_options const &options, rmm::cuda_s
 {
   return table_with_metadata{_impl->read(options, stream)};
 }
+
+// Forward to implementation
+chunked_reader::chunked_reader(size_t chunk_read_limit,
+                               std::vector<std::string> const &filepaths,
+                               json_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+  : reader(filepaths, options, mr)
+{
+  _impl->setup_chunking(chunk_read_limit);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+                               json_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+  : reader(std::move(sources), options, mr)
+{
+  _impl->setup_chunking(chunk_read_limit);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
+}
 }  // namespace json
 }  // namespace detail
 }  // namespace io
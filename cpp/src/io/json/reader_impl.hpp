@@ -25,6 +25,7 @@
 #include "json_gpu.h"
 
 #include <io/utilities/column_buffer.hpp>
+#include <io/utilities/prefetch_datasource.hpp>
 
 #include <hash/concurrent_unordered_map.cuh>
 
@@ -76,6 +77,11 @@ class reader::impl {
   table_metadata metadata_;
   std::vector<data_type> dtypes_;
 
+  size_t chunk_read_limit_ = 0;  // Input bytes per chunk; 0 reads a single chunk
+  size_t chunk_offset_     = 0;  // Byte range offset of the next chunk
+  bool is_first_chunk_     = true;
+  std::unique_ptr<async_prefetch_datasource> prefetch_source_;
+
   // the map is only used for files with rows in object format; initialize to a dummy value so the
   // map object can be passed to the kernel in any case
   col_map_ptr_type key_to_col_idx_map_;
@@ -114,6 +120,12 @@ class reader::impl {
    */
   void ingest_raw_input(size_t range_offset, size_t range_size);
 
+  /**
+   * @brief Returns the number of bytes to read for a byte range, including the padding for the
+   * last row; returns `0` for all remaining data.
+   */
+  size_t get_map_range_size(size_t range_size) const;
+
   /**
    * @brief Extract the JSON objects keys from the input file with object rows.
    *
@@ -174,6 +186,11 @@ class reader::impl {
    */
   table_with_metadata convert_data_to_table(rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Returns a table of empty columns of the data types in dtypes_
+   */
+  table_with_metadata make_empty_table() const;
+
  public:
   /**
    * @brief Constructor from a dataset source with reader options.
@@ -192,6 +209,28 @@ class reader::impl {
    * @return Table and its metadata
    */
   table_with_metadata read(json_reader_options const &options, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Sets up reading the input in chunks of `chunk_read_limit` bytes.
+   *
+   * @param chunk_read_limit Number of input bytes to read per chunk; 0 reads the whole input as a
+   * single chunk
+   */
+  void setup_chunking(size_t chunk_read_limit);
+
+  /**
+   * @brief Returns true if there are more chunks to be read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk, with the column names, key map and types of the first chunk.
+   *
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Table and its metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
 };
 
 }  // namespace json
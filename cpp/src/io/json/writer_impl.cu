@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cu
+ * @brief cuDF-IO JSON Lines writer class implementation
+ */
+
+#include "writer_impl.hpp"
+
+#include <io/utilities/pinned_host_pool.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/converters.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+namespace {
+
+constexpr char const hex_digits[] = "0123456789abcdef";
+
+/**
+ * @brief Functor to quote the strings of a column and to escape their characters for JSON.
+ *
+ * Quotes and backslashes are escaped with a backslash, and control characters with their short
+ * escape sequence or as `\u00XX`. Other characters, including multi-byte UTF-8 characters, are
+ * copied as is.
+ */
+struct escape_json_fn {
+  column_device_view const d_column;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void write_byte(char byte, char*& d_buffer, offset_type& bytes)
+  {
+    if (d_buffer) { *d_buffer++ = byte; }
+    ++bytes;
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_column.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    auto const d_str  = d_column.element<string_view>(idx);
+    char* d_buffer    = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    offset_type bytes = 0;
+
+    write_byte('\"', d_buffer, bytes);
+    for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+      auto const byte = static_cast<unsigned char>(d_str.data()[i]);
+      if (byte == '\"' || byte == '\\') {
+        write_byte('\\', d_buffer, bytes);
+        write_byte(byte, d_buffer, bytes);
+      } else if (byte < 0x20) {
+        write_byte('\\', d_buffer, bytes);
+        switch (byte) {
+          case '\b': write_byte('b', d_buffer, bytes); break;
+          case '\f': write_byte('f', d_buffer, bytes); break;
+          case '\n': write_byte('n', d_buffer, bytes); break;
+          case '\r': write_byte('r', d_buffer, bytes); break;
+          case '\t': write_byte('t', d_buffer, bytes); break;
+          default:
+            write_byte('u', d_buffer, bytes);
+            write_byte('0', d_buffer, bytes);
+            write_byte('0', d_buffer, bytes);
+            write_byte(hex_digits[byte >> 4], d_buffer, bytes);
+            write_byte(hex_digits[byte & 0xf], d_buffer, bytes);
+        }
+      } else {
+        write_byte(byte, d_buffer, bytes);
+      }
+    }
+    write_byte('\"', d_buffer, bytes);
+
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+/**
+ * @brief Returns whether a row holds a finite floating-point value; NaN and infinity have no JSON
+ * representation.
+ */
+template <typename T>
+struct is_finite_fn {
+  column_device_view const d_column;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    return d_column.is_valid(idx) && isfinite(d_column.element<T>(idx));
+  }
+};
+
+/**
+ * @brief Converts a column to the JSON values of its rows, null for the rows written as `null`.
+ */
+struct column_to_json_fn {
+  template <typename column_type>
+  constexpr static bool is_not_handled(void)
+  {
+    return not((std::is_same<column_type, cudf::string_view>::value) ||
+               (std::is_integral<column_type>::value) ||
+               (std::is_floating_point<column_type>::value) ||
+               (cudf::is_timestamp<column_type>()) || (cudf::is_duration<column_type>()));
+  }
+
+  column_to_json_fn(rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
+    : stream_(stream), mr_(mr)
+  {
+  }
+
+  // Quotes and escapes the strings of a strings column
+  std::unique_ptr<column> escape(column_view const& column_v) const
+  {
+    auto d_column = column_device_view::create(column_v, stream_);
+    escape_json_fn fn{*d_column};
+    auto children = cudf::strings::detail::make_strings_children(fn, column_v.size(), stream_, mr_);
+
+    return make_strings_column(column_v.size(),
+                               std::move(children.first),
+                               std::move(children.second),
+                               column_v.null_count(),
+                               cudf::detail::copy_bitmask(column_v, stream_, mr_),
+                               stream_,
+                               mr_);
+  }
+
+  // bools:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_same<column_type, bool>::value, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_booleans(column,
+                                                string_scalar{"true", true, stream_},
+                                                string_scalar{"false", true, stream_},
+                                                stream_,
+                                                mr_);
+  }
+
+  // strings:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_same<column_type, cudf::string_view>::value, std::unique_ptr<column>>
+  operator()(column_view const& column) const
+  {
+    return escape(column);
+  }
+
+  // ints:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_integral<column_type>::value && !std::is_same<column_type, bool>::value,
+                   std::unique_ptr<column>>
+  operator()(column_view const& column) const
+  {
+    return cudf::strings::detail::from_integers(column, stream_, mr_);
+  }
+
+  // floats, with NaN and infinity written as null:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_floating_point<column_type>::value, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    auto d_column     = column_device_view::create(column, stream_);
+    auto const finite = cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                               thrust::make_counting_iterator(column.size()),
+                                               is_finite_fn<column_type>{*d_column},
+                                               stream_);
+    column_view const finite_values{column.type(),
+                                    column.size(),
+                                    column.data<column_type>(),
+                                    static_cast<bitmask_type const*>(finite.first.data()),
+                                    finite.second};
+    return cudf::strings::detail::from_floats(finite_values, stream_, mr_);
+  }
+
+  // timestamps, as quoted ISO 8601 strings:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_timestamp<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    std::string const format = [&]() {
+      if (std::is_same<cudf::timestamp_s, column_type>::value) {
+        return std::string{"%Y-%m-%dT%H:%M:%SZ"};
+      } else if (std::is_same<cudf::timestamp_ms, column_type>::value) {
+        return std::string{"%Y-%m-%dT%H:%M:%S.%3fZ"};
+      } else if (std::is_same<cudf::timestamp_us, column_type>::value) {
+        return std::string{"%Y-%m-%dT%H:%M:%S.%6fZ"};
+      } else if (std::is_same<cudf::timestamp_ns, column_type>::value) {
+        return std::string{"%Y-%m-%dT%H:%M:%S.%9fZ"};
+      } else {
+        return std::string{"%Y-%m-%d"};
+      }
+    }();
+    auto const strings = cudf::strings::detail::from_timestamps(
+      column, format, stream_, cudf::get_current_temp_resource());
+    return escape(strings->view());
+  }
+
+  // durations, as their number of ticks:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_duration<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    column_view const ticks{data_type{type_to_id<typename column_type::rep>()},
+                            column.size(),
+                            column.head(),
+                            column.null_mask(),
+                            column.null_count(),
+                            column.offset()};
+    return cudf::strings::detail::from_integers(ticks, stream_, mr_);
+  }
+
+  // unsupported type of column:
+  //
+  template <typename column_type>
+  std::enable_if_t<is_not_handled<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    CUDF_FAIL("Unsupported column type for JSON.");
+  }
+
+ private:
+  rmm::cuda_stream_view stream_;
+  rmm::mr::device_memory_resource* mr_;
+};
+
+/**
+ * @brief Functor to assemble the JSON object of each row from the values of its columns.
+ *
+ * A row is written as `{"name0":value0,"name1":value1}` followed by a new line. The null values
+ * are written as `null`, or omitted along with their name.
+ */
+struct json_rows_fn {
+  table_device_view const d_values;           // JSON values, null for the null fields
+  device_span<char const> const d_key_chars;  // column names, quoted and followed by a colon
+  device_span<size_type const> const d_key_offsets;
+  bool const include_nulls;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void write(char const* data, size_type size, char*& d_buffer, offset_type& bytes)
+  {
+    if (d_buffer) { d_buffer = cudf::strings::detail::copy_and_increment(d_buffer, data, size); }
+    bytes += size;
+  }
+
+  __device__ void operator()(size_type row)
+  {
+    char* d_buffer    = d_chars ? d_chars + d_offsets[row] : nullptr;
+    offset_type bytes = 0;
+
+    write("{", 1, d_buffer, bytes);
+    bool is_first = true;
+    for (size_type col = 0; col < d_values.num_columns(); ++col) {
+      auto const d_column = d_values.column(col);
+      auto const is_null  = d_column.is_null(row);
+      if (is_null && !include_nulls) { continue; }
+      if (!is_first) { write(",", 1, d_buffer, bytes); }
+      is_first = false;
+
+      write(d_key_chars.data() + d_key_offsets[col],
+            d_key_offsets[col + 1] - d_key_offsets[col],
+            d_buffer,
+            bytes);
+      if (is_null) {
+        write("null", 4, d_buffer, bytes);
+      } else {
+        auto const d_str = d_column.element<string_view>(row);
+        write(d_str.data(), d_str.size_bytes(), d_buffer, bytes);
+      }
+    }
+    write("}\n", 2, d_buffer, bytes);
+
+    if (!d_chars) d_offsets[row] = bytes;
+  }
+};
+
+/**
+ * @brief Returns a column name as a quoted and escaped JSON string.
+ */
+std::string to_json_key(std::string const& name)
+{
+  std::string key{"\""};
+  for (auto const chr : name) {
+    auto const byte = static_cast<unsigned char>(chr);
+    if (byte == '\"' || byte == '\\') {
+      key += '\\';
+      key += chr;
+    } else if (byte < 0x20) {
+      key += "\\u00";
+      key += hex_digits[byte >> 4];
+      key += hex_digits[byte & 0xf];
+    } else {
+      key += chr;
+    }
+  }
+  return key + "\":";
+}
+
+}  // unnamed namespace
+
+// Forward to implementation
+writer::writer(std::unique_ptr<data_sink> sink,
+               json_writer_options const& options,
+               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(std::move(sink), options, mr))
+{
+}
+
+// Destructor within this translation unit
+writer::~writer() = default;
+
+writer::impl::impl(std::unique_ptr<data_sink> sink,
+                   json_writer_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : out_sink_(std::move(sink)), mr_(mr), options_(options)
+{
+}
+
+void writer::impl::write_rows(strings_column_view const& rows, rmm::cuda_stream_view stream)
+{
+  auto const num_bytes = static_cast<size_t>(rows.chars_size());
+  auto const d_bytes   = rows.chars().data<char>();
+
+  if (out_sink_->is_device_write_preferred(num_bytes)) {
+    out_sink_->device_write(d_bytes, num_bytes, stream);
+    stream.synchronize();
+    return;
+  }
+
+  auto const h_bytes = make_pinned_buffer<char>(num_bytes);
+  CUDA_TRY(
+    cudaMemcpyAsync(h_bytes.get(), d_bytes, num_bytes, cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+  out_sink_->host_write(h_bytes.get(), num_bytes);
+}
+
+void writer::impl::write(table_view const& table,
+                         table_metadata const* metadata,
+                         rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(table.num_columns() > 0, "Empty table.");
+  auto const has_names = metadata != nullptr && !metadata->column_names.empty();
+  if (has_names) {
+    CUDF_EXPECTS(metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
+                 "Mismatch between number of column names and table columns.");
+  }
+
+  // The keys of all the columns are copied to the device once, as a single buffer of characters
+  std::vector<char> h_key_chars;
+  std::vector<size_type> h_key_offsets{0};
+  for (size_type col = 0; col < table.num_columns(); ++col) {
+    auto const key = to_json_key(has_names ? metadata->column_names[col] : std::to_string(col));
+    h_key_chars.insert(h_key_chars.end(), key.begin(), key.end());
+    h_key_offsets.push_back(h_key_chars.size());
+  }
+  auto const d_key_chars   = cudf::detail::make_device_uvector_async(h_key_chars, stream);
+  auto const d_key_offsets = cudf::detail::make_device_uvector_async(h_key_offsets, stream);
+
+  // Rows are converted and written in chunks, to bound the memory used by the formatted rows
+  auto const rows_per_chunk = std::max<size_type>(options_.get_rows_per_chunk(), 1);
+  std::vector<size_type> splits;
+  for (auto row = rows_per_chunk; row < table.num_rows(); row += rows_per_chunk) {
+    splits.push_back(row);
+  }
+
+  column_to_json_fn const converter{stream, cudf::get_current_temp_resource()};
+  for (auto const& chunk : cudf::split(table, splits)) {
+    if (chunk.num_rows() == 0) { continue; }
+
+    std::vector<std::unique_ptr<column>> values;
+    std::transform(
+      chunk.begin(), chunk.end(), std::back_inserter(values), [&](column_view const& col) {
+        return cudf::type_dispatcher(col.type(), converter, col);
+      });
+    cudf::table const values_table{std::move(values)};
+    auto const d_values     = table_device_view::create(values_table.view(), stream);
+
+    json_rows_fn fn{*d_values, d_key_chars, d_key_offsets, options_.is_enabled_include_nulls()};
+    auto children = cudf::strings::detail::make_strings_children(fn, chunk.num_rows(), stream);
+    auto const rows = make_strings_column(chunk.num_rows(),
+                                          std::move(children.first),
+                                          std::move(children.second),
+                                          0,
+                                          rmm::device_buffer{},
+                                          stream);
+    write_rows(rows->view(), stream);
+  }
+  out_sink_->flush();
+}
+
+void writer::write(table_view const& table,
+                   table_metadata const* metadata,
+                   rmm::cuda_stream_view stream)
+{
+  _impl->write(table, metadata, stream);
+}
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
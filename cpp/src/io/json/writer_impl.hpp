@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/detail/json.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+/**
+ * @brief Implementation for the JSON Lines writer
+ */
+class writer::impl {
+ public:
+  /**
+   * @brief Constructor with writer options.
+   *
+   * @param sink Output sink
+   * @param options Settings for controlling behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  impl(std::unique_ptr<data_sink> sink,
+       json_writer_options const& options,
+       rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Writes a table as JSON Lines, one chunk of rows at a time.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write(table_view const& table,
+             table_metadata const* metadata = nullptr,
+             rmm::cuda_stream_view stream   = rmm::cuda_stream_default);
+
+ private:
+  /**
+   * @brief Writes the characters of formatted rows, each ending with a new line, to the sink.
+   *
+   * @param rows The formatted rows
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write_rows(strings_column_view const& rows, rmm::cuda_stream_view stream);
+
+  std::unique_ptr<data_sink> out_sink_;
+  rmm::mr::device_memory_resource* mr_ = nullptr;
+  json_writer_options const options_;
+};
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -17,6 +17,7 @@
 #include "orc_common.h"
 #include "orc_gpu.h"
 
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <io/utilities/block_utils.cuh>
 
@@ -111,10 +112,65 @@ static __device__ void LoadNonNullIndices(volatile dictinit_state_s *s,
   }
 }
 
+/**
+ * @brief Add the hashes of the strings of each rowgroup to the sketch of its column
+ *
+ * @param[in,out] sketches CardinalitySketch device array [column]
+ * @param[in] view Table device view representing input table
+ * @param[in] str_col_ids List of columns that are strings type
+ * @param[in] row_index_stride Rowgroup size in rows
+ */
+// blockDim {block_size,1,1}
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  gpuUpdateCardinalitySketches(CardinalitySketch *sketches,
+                               const table_device_view view,
+                               size_type const *str_col_ids,
+                               size_t row_index_stride)
+{
+  __shared__ uint32_t registers[cardinality_sketch_size];
+  using block_reduce = cub::BlockReduce<uint64_t, block_size>;
+  __shared__ typename block_reduce::TempStorage reduce_storage;
+
+  uint32_t col_id                  = blockIdx.x;
+  uint32_t group_id                = blockIdx.y;
+  int t                            = threadIdx.x;
+  column_device_view const &column = view.column(str_col_ids[col_id]);
+
+  for (uint32_t i = t; i < cardinality_sketch_size; i += block_size) {
+    registers[i] = 0;
+  }
+  __syncthreads();
+  auto const start_row = group_id * row_index_stride;
+  auto const end_row   = min(start_row + row_index_stride, static_cast<size_t>(column.size()));
+  uint64_t char_count  = 0;
+  for (auto row = start_row + t; row < end_row; row += block_size) {
+    if (column.is_valid(row)) {
+      auto const value = column.element<string_view>(row);
+      auto const hash  = cudf::detail::MurmurHash3_32<string_view>{}(value);
+      // The top bits select the register, which keeps the rank of the first set bit of the rest
+      uint32_t const rest = hash << cardinality_sketch_bits;
+      uint32_t const rank = (rest == 0) ? 33 - cardinality_sketch_bits : __clz(rest) + 1;
+      atomicMax(&registers[hash >> (32 - cardinality_sketch_bits)], rank);
+      char_count += value.size_bytes();
+    }
+  }
+  char_count = block_reduce(reduce_storage).Sum(char_count);
+  __syncthreads();
+  for (uint32_t i = t; i < cardinality_sketch_size; i += block_size) {
+    if (registers[i] != 0) { atomicMax(&sketches[col_id].registers[i], registers[i]); }
+  }
+  if (t == 0) {
+    atomicAdd(reinterpret_cast<unsigned long long *>(&sketches[col_id].char_count),
+              static_cast<unsigned long long>(char_count));
+  }
+}
+
 /**
  * @brief Gather all non-NULL string rows and compute total character data size
  *
  * @param[in] chunks DictionaryChunk device array [rowgroup][column]
+ * @param[in] dict_enabled Whether to build the dictionary of each string column
  * @param[in] num_columns Number of string columns
  */
 // blockDim {block_size,1,1}
@@ -126,6 +182,7 @@ __global__ void __launch_bounds__(block_size, 2)
                            uint32_t *dict_index,
                            size_t row_index_stride,
                            size_type *str_col_ids,
+                           bool const *dict_enabled,
                            uint32_t num_columns)
 {
   __shared__ __align__(16) dictinit_state_s state_g;
@@ -160,6 +217,35 @@ __global__ void __launch_bounds__(block_size, 2)
     if (i + t < sizeof(s->map) / sizeof(uint32_t)) s->map.u32[i + t] = 0;
   }
   __syncthreads();
+  if (!dict_enabled[col_id]) {
+    // Direct encoding only needs the number and the size of the strings
+    uint32_t num_strings = 0;
+    uint32_t char_count  = 0;
+    for (uint32_t i = t; i < s->chunk.num_rows; i += block_size) {
+      auto const row = s->chunk.start_row + i;
+      if (s->chunk.leaf_column->is_valid(row)) {
+        num_strings += 1;
+        char_count += s->chunk.leaf_column->element<string_view>(row).size_bytes();
+      }
+    }
+    num_strings = block_reduce(temp_storage.reduce_storage).Sum(num_strings);
+    __syncthreads();
+    char_count = block_reduce(temp_storage.reduce_storage).Sum(char_count);
+    if (!t) {
+      auto &chunk             = chunks[group_id * num_columns + col_id];
+      chunk.num_strings       = num_strings;
+      chunk.string_char_count = char_count;
+      chunk.num_dict_strings  = num_strings;
+      chunk.dict_char_count   = char_count;
+      chunk.leaf_column       = s->chunk.leaf_column;
+
+      chunk.dict_data  = s->chunk.dict_data;
+      chunk.dict_index = s->chunk.dict_index;
+      chunk.start_row  = s->chunk.start_row;
+      chunk.num_rows   = s->chunk.num_rows;
+    }
+    return;
+  }
   // First, take care of NULLs, and count how many strings we have (TODO: bypass this step when
   // there are no nulls)
   LoadNonNullIndices<block_size>(s, t, temp_storage.scan_storage);
@@ -424,6 +510,24 @@ __global__ void __launch_bounds__(block_size)
   }
 }
 
+/**
+ * @copydoc cudf::io::orc::gpu::UpdateCardinalitySketches
+ */
+void UpdateCardinalitySketches(CardinalitySketch *sketches,
+                               const table_device_view &view,
+                               size_type const *str_col_ids,
+                               uint32_t num_columns,
+                               uint32_t num_rowgroups,
+                               size_t row_index_stride,
+                               rmm::cuda_stream_view stream)
+{
+  static constexpr int block_size = 512;
+  dim3 dim_block(block_size, 1);
+  dim3 dim_grid(num_columns, num_rowgroups);
+  gpuUpdateCardinalitySketches<block_size>
+    <<<dim_grid, dim_block, 0, stream.value()>>>(sketches, view, str_col_ids, row_index_stride);
+}
+
 /**
  * @copydoc cudf::io::orc::gpu::InitDictionaryIndices
  */
@@ -433,6 +537,7 @@ void InitDictionaryIndices(const table_device_view &view,
                            uint32_t *dict_index,
                            size_t row_index_stride,
                            size_type *str_col_ids,
+                           bool const *dict_enabled,
                            uint32_t num_columns,
                            uint32_t num_rowgroups,
                            rmm::cuda_stream_view stream)
@@ -441,7 +546,7 @@ void InitDictionaryIndices(const table_device_view &view,
   dim3 dim_block(block_size, 1);
   dim3 dim_grid(num_columns, num_rowgroups);
   gpuInitDictionaryIndices<block_size><<<dim_grid, dim_block, 0, stream.value()>>>(
-    chunks, view, dict_data, dict_index, row_index_stride, str_col_ids, num_columns);
+    chunks, view, dict_data, dict_index, row_index_stride, str_col_ids, dict_enabled, num_columns);
 }
 
 /**
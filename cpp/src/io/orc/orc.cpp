@@ -19,6 +19,8 @@
 #include "orc_field_reader.hpp"
 #include "orc_field_writer.hpp"
 
+#include <io/utilities/metadata_cache.hpp>
+
 namespace cudf {
 namespace io {
 namespace orc {
@@ -435,8 +437,20 @@ const uint8_t *OrcDecompressor::Decompress(const uint8_t *srcBytes, size_t srcLe
   return m_buf.data();
 }
 
-metadata::metadata(datasource *const src) : source(src)
+namespace {
+
+/**
+ * @brief The parsed sections of the tail of a file, which are cached across reads
+ */
+struct file_tail {
+  PostScript ps;
+  FileFooter ff;
+  Metadata md;
+};
+
+file_tail read_file_tail(datasource *const source)
 {
+  file_tail tail;
   const auto len         = source->size();
   const auto max_ps_size = std::min(len, static_cast<size_t>(256));
 
@@ -444,26 +458,41 @@ metadata::metadata(datasource *const src) : source(src)
   auto buffer            = source->host_read(len - max_ps_size, max_ps_size);
   const size_t ps_length = buffer->data()[max_ps_size - 1];
   const uint8_t *ps_data = &buffer->data()[max_ps_size - ps_length - 1];
-  ProtobufReader(ps_data, ps_length).read(ps);
-  CUDF_EXPECTS(ps.footerLength + ps_length < len, "Invalid footer length");
+  ProtobufReader(ps_data, ps_length).read(tail.ps);
+  CUDF_EXPECTS(tail.ps.footerLength + ps_length < len, "Invalid footer length");
 
-  // If compression is used, the rest of the metadata is compressed
-  // If no compressed is used, the decompressor is simply a pass-through
-  decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
+  OrcDecompressor decompressor(tail.ps.compression, tail.ps.compressionBlockSize);
 
   // Read compressed filefooter section
-  buffer           = source->host_read(len - ps_length - 1 - ps.footerLength, ps.footerLength);
+  buffer = source->host_read(len - ps_length - 1 - tail.ps.footerLength, tail.ps.footerLength);
   size_t ff_length = 0;
-  auto ff_data     = decompressor->Decompress(buffer->data(), ps.footerLength, &ff_length);
-  ProtobufReader(ff_data, ff_length).read(ff);
-  CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
+  auto ff_data     = decompressor.Decompress(buffer->data(), tail.ps.footerLength, &ff_length);
+  ProtobufReader(ff_data, ff_length).read(tail.ff);
+  CUDF_EXPECTS(tail.ff.types.size() > 0, "No columns found");
 
   // Read compressed metadata section
-  buffer =
-    source->host_read(len - ps_length - 1 - ps.footerLength - ps.metadataLength, ps.metadataLength);
+  buffer = source->host_read(len - ps_length - 1 - tail.ps.footerLength - tail.ps.metadataLength,
+                             tail.ps.metadataLength);
   size_t md_length = 0;
-  auto md_data     = decompressor->Decompress(buffer->data(), ps.metadataLength, &md_length);
-  orc::ProtobufReader(md_data, md_length).read(md);
+  auto md_data     = decompressor.Decompress(buffer->data(), tail.ps.metadataLength, &md_length);
+  orc::ProtobufReader(md_data, md_length).read(tail.md);
+  return tail;
+}
+
+}  // namespace
+
+metadata::metadata(datasource *const src, metadata_cache *cache, std::string const &filepath)
+  : source(src)
+{
+  auto const tail = cudf::io::detail::get_cached_metadata<file_tail>(
+    cache, filepath, "orc", [&]() { return read_file_tail(source); });
+  ps = tail->ps;
+  ff = tail->ff;
+  md = tail->md;
+
+  // If compression is used, the rest of the metadata is compressed
+  // If no compressed is used, the decompressor is simply a pass-through
+  decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
 }
 
 std::vector<metadata::OrcStripeInfo> metadata::select_stripes(const std::vector<size_type> &stripes,
@@ -20,6 +20,7 @@
 
 #include <io/comp/io_uncomp.h>
 #include <cudf/io/datasource.hpp>
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/io/orc_metadata.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -564,7 +565,16 @@ class metadata {
   using OrcStripeInfo = std::pair<const StripeInformation *, const StripeFooter *>;
 
  public:
-  explicit metadata(datasource *const src);
+  /**
+   * @brief Reads the postscript, footer and metadata sections of a file
+   *
+   * @param src Source of the file
+   * @param cache Cache of the parsed sections, consulted if the file path is known; may be null
+   * @param filepath Path of the file; empty if the source is not a file
+   */
+  explicit metadata(datasource *const src,
+                    metadata_cache *cache       = nullptr,
+                    std::string const &filepath = {});
 
   /**
    * @brief Filters and reads the info of only a selection of stripes
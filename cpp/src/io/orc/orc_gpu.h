@@ -183,6 +183,17 @@ struct StripeDictionary {
   column_device_view *leaf_column;  //!< Pointer to string column
 };
 
+constexpr int cardinality_sketch_bits      = 12;
+constexpr uint32_t cardinality_sketch_size = 1 << cardinality_sketch_bits;
+
+/**
+ * @brief HyperLogLog sketch of the distinct strings of a column
+ */
+struct CardinalitySketch {
+  uint32_t registers[cardinality_sketch_size];  // max rank of the hashes in each bucket
+  uint64_t char_count;                          // total size of the non-null strings
+};
+
 /**
  * @brief Launches kernel for parsing the compressed stripe data
  *
@@ -350,15 +361,37 @@ void CompressOrcDataStreams(uint8_t *compressed_data,
                             gpu_inflate_status_s *comp_out,
                             rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Launches kernel for estimating the number of distinct strings of each string column
+ *
+ * @param[in,out] sketches CardinalitySketch device array [column], zero-initialized
+ * @param[in] view table device view representing input table
+ * @param[in] str_col_ids List of columns that are strings type
+ * @param[in] num_columns Number of string columns
+ * @param[in] num_rowgroups Number of row groups
+ * @param[in] row_index_stride Rowgroup size in rows
+ * @param[in] stream CUDA stream to use, default `rmm::cuda_stream_default`
+ */
+void UpdateCardinalitySketches(CardinalitySketch *sketches,
+                               const table_device_view &view,
+                               size_type const *str_col_ids,
+                               uint32_t num_columns,
+                               uint32_t num_rowgroups,
+                               size_t row_index_stride,
+                               rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for initializing dictionary chunks
  *
+ * The chunks of the columns that are not dictionary-encoded only hold the string counts and sizes.
+ *
  * @param[in] view table device view representing input table
  * @param[in,out] chunks DictionaryChunk device array [rowgroup][column]
  * @param[in] dict_data dictionary data (index of non-null rows)
  * @param[in] dict_index row indices of corresponding string (row from dictionary index)
  * @param[in] row_index_stride Rowgroup size in rows
  * @param[in] str_col_ids List of columns that are strings type
+ * @param[in] dict_enabled Whether to build the dictionary of each string column
  * @param[in] num_columns Number of columns
  * @param[in] num_rowgroups Number of row groups
  * @param[in] stream CUDA stream to use, default `rmm::cuda_stream_default`
@@ -369,6 +402,7 @@ void InitDictionaryIndices(const table_device_view &view,
                            uint32_t *dict_index,
                            size_t row_index_stride,
                            size_type *str_col_ids,
+                           bool const *dict_enabled,
                            uint32_t num_columns,
                            uint32_t num_rowgroups,
                            rmm::cuda_stream_view stream);
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file predicate_pushdown.cu
+ * @brief cuDF-IO ORC stripe pruning using stripe-level column statistics
+ */
+
+#include "predicate_pushdown.hpp"
+
+#include <io/utilities/statistics_filter.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace orc {
+namespace {
+
+/**
+ * @brief Representation type used to store statistics values of type `T`
+ */
+template <typename T, typename Enable = void>
+struct stats_rep {
+  using type = T;
+};
+
+template <typename T>
+struct stats_rep<T, std::enable_if_t<cudf::is_chrono<T>()>> {
+  using type = typename T::rep;
+};
+
+template <typename T>
+constexpr bool is_stats_supported()
+{
+  return (cudf::is_numeric<T>() && !std::is_same<T, bool>::value) ||
+         std::is_same<T, timestamp_D>::value || std::is_same<T, timestamp_ms>::value;
+}
+
+template <typename T>
+bool read_minmax(minmax_statistics<T> const *stats, T &min_value, T &max_value)
+{
+  if (stats == nullptr || !stats->has_minimum() || !stats->has_maximum()) { return false; }
+  min_value = *stats->minimum();
+  max_value = *stats->maximum();
+  // NaN bounds can't be used for comparisons
+  return min_value == min_value && max_value == max_value;
+}
+
+/**
+ * @brief Reads the stripe minimum and maximum of an integral column
+ */
+template <typename T, std::enable_if_t<std::is_integral<T>::value> * = nullptr>
+bool get_minmax(cudf::io::orc::column_statistics const &stats, T &min_value, T &max_value)
+{
+  int64_t min_stat;
+  int64_t max_stat;
+  if (!read_minmax<int64_t>(stats.int_stats.get(), min_stat, max_stat)) { return false; }
+  min_value = static_cast<T>(min_stat);
+  max_value = static_cast<T>(max_stat);
+  return true;
+}
+
+/**
+ * @brief Reads the stripe minimum and maximum of a floating-point column
+ */
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value> * = nullptr>
+bool get_minmax(cudf::io::orc::column_statistics const &stats, T &min_value, T &max_value)
+{
+  double min_stat;
+  double max_stat;
+  if (!read_minmax<double>(stats.double_stats.get(), min_stat, max_stat)) { return false; }
+  min_value = static_cast<T>(min_stat);
+  max_value = static_cast<T>(max_stat);
+  return true;
+}
+
+/**
+ * @brief Reads the stripe minimum and maximum of a date column, as counts of `T::duration`
+ */
+template <typename T, std::enable_if_t<cudf::is_timestamp<T>()> * = nullptr>
+bool get_minmax(cudf::io::orc::column_statistics const &stats,
+                typename T::rep &min_value,
+                typename T::rep &max_value)
+{
+  int32_t min_days;
+  int32_t max_days;
+  if (!read_minmax<int32_t>(stats.date_stats.get(), min_days, max_days)) { return false; }
+  using cuda::std::chrono::duration_cast;
+  min_value = duration_cast<typename T::duration>(duration_D{min_days}).count();
+  max_value = duration_cast<typename T::duration>(duration_D{max_days}).count();
+  return true;
+}
+
+/**
+ * @brief Functor to build the columns of per-stripe minimum and maximum values
+ *
+ * Stripes without usable statistics get the full range of the type, so they can never be rejected
+ * by the filter.
+ */
+struct minmax_columns_fn {
+  template <typename T, std::enable_if_t<is_stats_supported<T>()> * = nullptr>
+  minmax_columns operator()(statistics_column const &col,
+                            size_type num_stripes,
+                            rmm::cuda_stream_view stream)
+  {
+    using rep_type = typename stats_rep<T>::type;
+    std::vector<rep_type> mins(num_stripes, std::numeric_limits<rep_type>::lowest());
+    std::vector<rep_type> maxs(num_stripes, std::numeric_limits<rep_type>::max());
+    for (size_type stripe = 0; stripe < num_stripes; ++stripe) {
+      rep_type min_value;
+      rep_type max_value;
+      if (get_minmax<T>(col.stats[stripe], min_value, max_value)) {
+        mins[stripe] = min_value;
+        maxs[stripe] = max_value;
+      }
+    }
+    return make_minmax_columns(col.type, mins, maxs, stream);
+  }
+
+  template <typename T, std::enable_if_t<!is_stats_supported<T>()> * = nullptr>
+  minmax_columns operator()(statistics_column const &, size_type, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Unsupported statistics column type");
+  }
+};
+
+}  // namespace
+
+std::vector<bool> evaluate_statistics_filter(ast::expression const &filter,
+                                             std::vector<statistics_column> const &columns,
+                                             size_type num_stripes,
+                                             rmm::cuda_stream_view stream)
+{
+  std::vector<data_type> column_types;
+  std::transform(columns.cbegin(),
+                 columns.cend(),
+                 std::back_inserter(column_types),
+                 [](auto const &col) { return col.type; });
+  auto get_minmax = [&](size_type col_idx) {
+    return type_dispatcher(
+      columns[col_idx].type, minmax_columns_fn{}, columns[col_idx], num_stripes, stream);
+  };
+  return cudf::io::detail::evaluate_statistics_filter(
+    filter, column_types, num_stripes, get_minmax, stream);
+}
+
+}  // namespace orc
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
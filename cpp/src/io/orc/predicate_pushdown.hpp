@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file predicate_pushdown.hpp
+ * @brief cuDF-IO ORC stripe pruning using stripe-level column statistics
+ */
+
+#pragma once
+
+#include "orc.h"
+
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace orc {
+using namespace cudf::io::orc;
+
+/**
+ * @brief Statistics of one output column over a set of stripes
+ */
+struct statistics_column {
+  data_type type{type_id::EMPTY};  // output column type; EMPTY if statistics can't be used
+  std::vector<cudf::io::orc::column_statistics> stats;  // decoded statistics, one per stripe
+};
+
+/**
+ * @brief Evaluates a filter expression against per-stripe column statistics
+ *
+ * Integer, floating-point and date statistics are converted to the output column type and the
+ * filter is evaluated with `cudf::io::detail::evaluate_statistics_filter`, so a stripe is only
+ * rejected when no row in it can match.
+ *
+ * @param filter Filter expression; column references index into `columns`
+ * @param columns Statistics for each output column
+ * @param num_stripes Number of stripes described by each element of `columns`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return For each stripe, whether it may contain rows that satisfy the filter
+ */
+std::vector<bool> evaluate_statistics_filter(ast::expression const &filter,
+                                             std::vector<statistics_column> const &columns,
+                                             size_type num_stripes,
+                                             rmm::cuda_stream_view stream);
+
+}  // namespace orc
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
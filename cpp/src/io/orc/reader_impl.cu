@@ -20,9 +20,11 @@
  */
 
 #include "reader_impl.hpp"
+#include "predicate_pushdown.hpp"
 #include "timezone.cuh"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/prefetch_datasource.hpp>
 #include "orc.h"
 
 #include <cudf/table/table.hpp>
@@ -289,6 +291,21 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
       case orc::SNAPPY:
         CUDA_TRY(gpu_unsnap(inflate_in.data(), inflate_out.data(), num_compressed_blocks, stream));
         break;
+      case orc::LZ4:
+        CUDA_TRY(
+          gpu_unlz4(inflate_in.data(), inflate_out.data(), num_compressed_blocks, false, stream));
+        break;
+      case orc::ZSTD: {
+        rmm::device_buffer unzstd_scratch(get_gpu_unzstd_scratch_size(num_compressed_blocks),
+                                          stream);
+        CUDA_TRY(gpu_unzstd(inflate_in.data(),
+                            inflate_out.data(),
+                            unzstd_scratch.data(),
+                            unzstd_scratch.size(),
+                            num_compressed_blocks,
+                            stream));
+        break;
+      }
       default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
     }
   }
@@ -383,12 +400,14 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
 }
 
 reader::impl::impl(std::unique_ptr<datasource> source,
+                   std::string const &filepath,
                    orc_reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr), _source(std::move(source))
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<cudf::io::orc::metadata>(_source.get());
+  // Open and parse the source dataset metadata, unless it is cached
+  _metadata = std::make_unique<cudf::io::orc::metadata>(
+    _source.get(), options.get_metadata_cache().get(), filepath);
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.get_columns(), _has_timestamp_column);
@@ -403,6 +422,8 @@ reader::impl::impl(std::unique_ptr<datasource> source,
 
   // Enable or disable the conversion to numpy-compatible dtypes
   _use_np_dtypes = options.is_enabled_use_np_dtypes();
+
+  _filter = options.get_filter();
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -410,14 +431,186 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                        const std::vector<size_type> &stripes,
                                        rmm::cuda_stream_view stream)
 {
-  std::vector<std::unique_ptr<column>> out_columns;
-  table_metadata out_metadata;
-
   // There are no columns in table
-  if (_selected_columns.size() == 0) return {std::make_unique<table>(), std::move(out_metadata)};
+  if (_selected_columns.size() == 0) return {std::make_unique<table>(), table_metadata{}};
 
   // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata->select_stripes(stripes, skip_rows, num_rows);
+  auto selected_stripes = _metadata->select_stripes(stripes, skip_rows, num_rows);
+  filter_stripes(selected_stripes, skip_rows, num_rows, stream);
+
+  return read_stripes(selected_stripes, skip_rows, num_rows, stream);
+}
+
+void reader::impl::filter_stripes(std::vector<OrcStripeInfo> &stripes,
+                                  size_type &skip_rows,
+                                  size_type &num_rows,
+                                  rmm::cuda_stream_view stream)
+{
+  if (!_filter.has_value() || stripes.empty()) { return; }
+
+  // Gather the stripe statistics of the selected columns. Statistics are only used for the types
+  // whose values can be converted exactly to the output column type.
+  auto const num_stripes = static_cast<size_type>(stripes.size());
+  std::vector<statistics_column> stats_columns(_selected_columns.size());
+  for (size_t col_idx = 0; col_idx < _selected_columns.size(); ++col_idx) {
+    auto const orc_col = _selected_columns[col_idx];
+    auto const &schema = _metadata->ff.types[orc_col];
+    switch (schema.kind) {
+      case orc::BYTE:
+      case orc::SHORT:
+      case orc::INT:
+      case orc::LONG:
+      case orc::FLOAT:
+      case orc::DOUBLE:
+      case orc::DATE: break;
+      default: continue;
+    }
+
+    auto &stats_col = stats_columns[col_idx];
+    stats_col.type  = data_type{to_type_id(schema, _use_np_dtypes, _timestamp_type.id())};
+    stats_col.stats.resize(num_stripes);
+    for (size_type i = 0; i < num_stripes; ++i) {
+      auto const stripe_idx = static_cast<size_t>(stripes[i].first - _metadata->ff.stripes.data());
+      if (stripe_idx >= _metadata->md.stripeStats.size()) { continue; }
+      auto const &col_stats = _metadata->md.stripeStats[stripe_idx].colStats;
+      if (static_cast<size_t>(orc_col) < col_stats.size() && !col_stats[orc_col].empty()) {
+        ProtobufReader(col_stats[orc_col].data(), col_stats[orc_col].size())
+          .read(stats_col.stats[i]);
+      }
+    }
+  }
+
+  auto const keep =
+    evaluate_statistics_filter(_filter->get(), stats_columns, num_stripes, stream);
+
+  // Only the first and last stripes of the selection can be partially selected, so the selected
+  // rows of the remaining stripes stay contiguous
+  auto const end_row = static_cast<size_t>(skip_rows) + num_rows;
+  std::vector<OrcStripeInfo> filtered;
+  size_t stripe_start   = 0;
+  size_t filtered_start = 0;
+  size_t filtered_begin = 0;
+  size_t filtered_end   = 0;
+  for (size_type i = 0; i < num_stripes; ++i) {
+    auto const stripe_rows = stripes[i].first->numberOfRows;
+    if (keep[i]) {
+      auto const begin = std::max<size_t>(stripe_start, skip_rows);
+      auto const end   = std::max(begin, std::min<size_t>(stripe_start + stripe_rows, end_row));
+      if (filtered.empty()) { filtered_begin = filtered_start + (begin - stripe_start); }
+      filtered_end = filtered_start + (end - stripe_start);
+      filtered.push_back(stripes[i]);
+      filtered_start += stripe_rows;
+    }
+    stripe_start += stripe_rows;
+  }
+
+  stripes   = std::move(filtered);
+  skip_rows = static_cast<size_type>(filtered_begin);
+  num_rows  = static_cast<size_type>(filtered_end - filtered_begin);
+}
+
+size_t reader::impl::estimate_stripe_output_size(OrcStripeInfo const &stripe) const
+{
+  size_t size = 0;
+  for (auto const col : _selected_columns) {
+    auto const col_type =
+      to_type_id(_metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id());
+    // Null mask, assuming the column is nullable
+    size += (stripe.first->numberOfRows + 7) / 8;
+    if (col_type == type_id::STRING) {
+      // Offsets, plus the string data that is in the stripe, before any decompression
+      size += stripe.first->numberOfRows * sizeof(size_type);
+      for (auto const &strm : stripe.second->streams) {
+        if (strm.column_id == static_cast<uint32_t>(col) &&
+            (strm.kind == orc::DATA || strm.kind == orc::DICTIONARY_DATA)) {
+          size += strm.length;
+        }
+      }
+    } else if (col_type != type_id::EMPTY) {
+      size += stripe.first->numberOfRows * cudf::size_of(data_type{col_type});
+    }
+  }
+  return size;
+}
+
+void reader::impl::setup_chunking(size_t chunk_read_limit,
+                                  size_type skip_rows,
+                                  size_type num_rows,
+                                  const std::vector<size_type> &stripes,
+                                  rmm::cuda_stream_view stream)
+{
+  _chunked_stripes = _selected_columns.empty()
+                       ? std::vector<OrcStripeInfo>{}
+                       : _metadata->select_stripes(stripes, skip_rows, num_rows);
+  filter_stripes(_chunked_stripes, skip_rows, num_rows, stream);
+  _chunk_read_info.clear();
+  _current_chunk = 0;
+
+  // Always return at least one (possibly empty) table
+  if (_chunked_stripes.empty() || num_rows <= 0) {
+    _chunk_read_info.push_back({0, _chunked_stripes.size(), skip_rows, num_rows});
+    return;
+  }
+
+  // Greedily group consecutive stripes while the estimated output stays within the limit
+  size_t first_stripe   = 0;
+  size_t chunk_size     = 0;
+  size_t remaining_rows = num_rows;
+  auto add_chunk        = [&](size_t end_stripe) {
+    size_t stripe_rows = 0;
+    for (auto i = first_stripe; i < end_stripe; ++i) {
+      stripe_rows += _chunked_stripes[i].first->numberOfRows;
+    }
+    auto const chunk_skip = (first_stripe == 0) ? static_cast<size_t>(skip_rows) : 0;
+    auto const chunk_rows = std::min(remaining_rows, stripe_rows - chunk_skip);
+    _chunk_read_info.push_back({first_stripe,
+                                end_stripe - first_stripe,
+                                static_cast<size_type>(chunk_skip),
+                                static_cast<size_type>(chunk_rows)});
+    remaining_rows -= chunk_rows;
+  };
+  for (size_t i = 0; i < _chunked_stripes.size(); ++i) {
+    auto const stripe_size = estimate_stripe_output_size(_chunked_stripes[i]);
+    if (chunk_read_limit > 0 && i > first_stripe && chunk_size + stripe_size > chunk_read_limit) {
+      add_chunk(i);
+      first_stripe = i;
+      chunk_size   = 0;
+    }
+    chunk_size += stripe_size;
+  }
+  add_chunk(_chunked_stripes.size());
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  auto const &chunk = _chunk_read_info[_current_chunk++];
+
+  if (_selected_columns.size() == 0) return {std::make_unique<table>(), table_metadata{}};
+
+  auto const first = _chunked_stripes.cbegin() + chunk.first_stripe;
+  std::vector<OrcStripeInfo> const selected_stripes(first, first + chunk.num_stripes);
+  return read_stripes(selected_stripes, chunk.skip_rows, chunk.num_rows, stream);
+}
+
+timezone_table_view reader::impl::get_timezone_table(std::string const &timezone,
+                                                     rmm::cuda_stream_view stream)
+{
+  if (_tz_table == nullptr) {
+    _tz_table =
+      std::make_unique<timezone_table>(build_timezone_transition_table(timezone, stream));
+  }
+  return _tz_table->view();
+}
+
+table_with_metadata reader::impl::read_stripes(
+  std::vector<OrcStripeInfo> const &selected_stripes,
+  size_type skip_rows,
+  size_type num_rows,
+  rmm::cuda_stream_view stream)
+{
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata out_metadata;
 
   // Association between each ORC column and its cudf::column
   std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
@@ -469,6 +662,14 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> stripe_data;
 
+    // Stream reads of all stripes, so that they can be fetched concurrently
+    struct stream_read {
+      size_t offset;
+      size_t length;
+      uint8_t *dst;
+    };
+    std::vector<stream_read> stream_reads;
+
     size_t stripe_start_row = 0;
     size_t num_dict_entries = 0;
     size_t num_rowgroups    = 0;
@@ -504,16 +705,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           len += stream_info[stream_count].length;
           stream_count++;
         }
-        if (_source->is_device_read_preferred(len)) {
-          CUDF_EXPECTS(_source->device_read(offset, len, d_dst, stream) == len,
-                       "Unexpected discrepancy in bytes read.");
-        } else {
-          const auto buffer = _source->host_read(offset, len);
-          CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
-          CUDA_TRY(
-            cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
-          stream.synchronize();
-        }
+        stream_reads.push_back({offset, len, d_dst});
       }
 
       // Update chunks to reference streams pointers
@@ -542,6 +734,29 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       }
     }
 
+    // Read the streams of all stripes, with the reads fetched concurrently in the background
+    if (!stream_reads.empty()) {
+      async_prefetch_datasource source(_source.get());
+      std::vector<async_prefetch_datasource::byte_range> ranges;
+      for (auto const &read : stream_reads) {
+        ranges.push_back({read.offset, read.length});
+      }
+      source.prefetch(ranges, stream);
+      for (auto const &read : stream_reads) {
+        if (source.is_device_read_preferred(read.length)) {
+          CUDF_EXPECTS(
+            source.device_read(read.offset, read.length, read.dst, stream) == read.length,
+            "Unexpected discrepancy in bytes read.");
+        } else {
+          const auto buffer = source.host_read(read.offset, read.length);
+          CUDF_EXPECTS(buffer->size() == read.length, "Unexpected discrepancy in bytes read.");
+          CUDA_TRY(cudaMemcpyAsync(
+            read.dst, buffer->data(), read.length, cudaMemcpyHostToDevice, stream.value()));
+          stream.synchronize();
+        }
+      }
+    }
+
     // Process dataset chunk pages into output columns
     if (stripe_data.size() != 0) {
       // Setup row group descriptors if using indexes
@@ -574,8 +789,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       // Setup table for converting timestamp columns from local to UTC time
       auto const tz_table =
         _has_timestamp_column
-          ? build_timezone_transition_table(selected_stripes[0].second->writerTimezone, stream)
-          : timezone_table{};
+          ? get_timezone_table(selected_stripes[0].second->writerTimezone, stream)
+          : timezone_table_view{};
 
       std::vector<column_buffer> out_buffers;
       for (size_t i = 0; i < column_types.size(); ++i) {
@@ -593,7 +808,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                          num_dict_entries,
                          skip_rows,
                          num_rows,
-                         tz_table.view(),
+                         tz_table,
                          row_groups,
                          _metadata->get_row_index_stride(),
                          out_buffers,
@@ -624,7 +839,7 @@ reader::reader(std::vector<std::string> const &filepaths,
                rmm::mr::device_memory_resource *mr)
 {
   CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(datasource::create(filepaths[0]), options, mr);
+  _impl = std::make_unique<impl>(datasource::create(filepaths[0]), filepaths[0], options, mr);
 }
 
 // Forward to implementation
@@ -633,7 +848,7 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                rmm::mr::device_memory_resource *mr)
 {
   CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(std::move(sources[0]), options, mr);
+  _impl = std::make_unique<impl>(std::move(sources[0]), std::string{}, options, mr);
 }
 
 // Destructor within this translation unit
@@ -645,6 +860,46 @@ table_with_metadata reader::read(orc_reader_options const &options, rmm::cuda_st
   return _impl->read(
     options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
 }
+
+// Forward to implementation
+chunked_reader::chunked_reader(size_t chunk_read_limit,
+                               std::vector<std::string> const &filepaths,
+                               orc_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+  : reader(filepaths, options, mr)
+{
+  _impl->setup_chunking(chunk_read_limit,
+                        options.get_skip_rows(),
+                        options.get_num_rows(),
+                        options.get_stripes(),
+                        rmm::cuda_stream_default);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+                               orc_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+  : reader(std::move(sources), options, mr)
+{
+  _impl->setup_chunking(chunk_read_limit,
+                        options.get_skip_rows(),
+                        options.get_num_rows(),
+                        options.get_stripes(),
+                        rmm::cuda_stream_default);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
+}
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
@@ -28,6 +28,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -46,6 +47,18 @@ namespace {
 struct orc_stream_info;
 }
 
+using OrcStripeInfo = cudf::io::orc::metadata::OrcStripeInfo;
+
+/**
+ * @brief Describes the range of selected stripes and rows decoded by one chunked read
+ */
+struct chunk_read_info {
+  size_t first_stripe;  // index into the list of selected stripes
+  size_t num_stripes;   // number of selected stripes in this chunk
+  size_type skip_rows;  // rows to skip from the start of the chunk's first stripe
+  size_type num_rows;   // number of rows in the chunk
+};
+
 /**
  * @brief Implementation for ORC reader
  */
@@ -55,10 +68,13 @@ class reader::impl {
    * @brief Constructor from a dataset source with reader options.
    *
    * @param source Dataset source
+   * @param filepath Path of the source, used to look up its metadata in the metadata cache; empty
+   * if the source is not a file
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
   explicit impl(std::unique_ptr<datasource> source,
+                std::string const &filepath,
                 orc_reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -77,7 +93,91 @@ class reader::impl {
                            const std::vector<size_type> &stripes,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Splits the selected stripes into chunks whose estimated output size fits within the
+   * given limit, for use with `read_chunk()`
+   *
+   * Stripes are never split, so a chunk always holds at least one stripe even if that stripe
+   * alone exceeds the limit.
+   *
+   * @param chunk_read_limit Limit on the estimated output size of each chunk, in bytes; 0 means
+   * the whole selection is returned as a single chunk
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param stripes Indices of individual stripes to load if non-empty
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void setup_chunking(size_t chunk_read_limit,
+                      size_type skip_rows,
+                      size_type num_rows,
+                      const std::vector<size_type> &stripes,
+                      rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns true if there is at least one more chunk to be returned by `read_chunk()`
+   */
+  bool has_next() const { return _current_chunk < _chunk_read_info.size(); }
+
+  /**
+   * @brief Reads the next chunk set up by `setup_chunking()`
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
+  /**
+   * @brief Reads the given stripes and returns a set of columns
+   *
+   * @param selected_stripes Stripes to read, with their parsed footers
+   * @param skip_rows Number of rows to skip from the start of the first stripe
+   * @param num_rows Number of rows to read
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_stripes(std::vector<OrcStripeInfo> const &selected_stripes,
+                                   size_type skip_rows,
+                                   size_type num_rows,
+                                   rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Removes the stripes that the filter proves to contain no matching rows
+   *
+   * The row range is adjusted to cover the same rows of the remaining stripes.
+   *
+   * @param[in,out] stripes Selected stripes
+   * @param[in,out] skip_rows Number of rows to skip from the start of the first stripe
+   * @param[in,out] num_rows Number of rows to read
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void filter_stripes(std::vector<OrcStripeInfo> &stripes,
+                      size_type &skip_rows,
+                      size_type &num_rows,
+                      rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the estimated size of the selected columns of a stripe once decoded
+   *
+   * @param stripe Stripe information, with its parsed footer
+   *
+   * @return The estimated output size in bytes
+   */
+  size_t estimate_stripe_output_size(OrcStripeInfo const &stripe) const;
+
+  /**
+   * @brief Returns the table to convert timestamps to UTC, building it on first use
+   *
+   * @param timezone Name of the writer's timezone
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return View of the transition table
+   */
+  timezone_table_view get_timezone_table(std::string const &timezone,
+                                         rmm::cuda_stream_view stream);
+
   /**
    * @brief Decompresses the stripe data, at stream granularity
    *
@@ -134,6 +234,17 @@ class reader::impl {
   bool _use_np_dtypes        = true;
   bool _has_timestamp_column = false;
   data_type _timestamp_type{type_id::EMPTY};
+
+  // filter used to skip stripes
+  thrust::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // Kept across reads since all stripes of a file share the writer's timezone
+  std::unique_ptr<timezone_table> _tz_table;
+
+  // state for chunked reads
+  std::vector<OrcStripeInfo> _chunked_stripes;
+  std::vector<chunk_read_info> _chunk_read_info;
+  size_t _current_chunk = 0;
 };
 
 }  // namespace orc
@@ -1236,7 +1236,11 @@ void CompressOrcDataStreams(uint8_t *compressed_data,
   dim3 dim_grid(strm_desc.size().first, strm_desc.size().second);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream.value()>>>(
     strm_desc, enc_streams, comp_in, comp_out, compressed_data, comp_blk_size);
-  if (compression == SNAPPY) { gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); }
+  if (compression == SNAPPY) {
+    gpu_snap(comp_in, comp_out, num_compressed_blocks, stream);
+  } else if (compression == LZ4) {
+    gpu_lz4(comp_in, comp_out, num_compressed_blocks, false, stream);
+  }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream.value()>>>(
     strm_desc, comp_in, comp_out, compressed_data, comp_blk_size);
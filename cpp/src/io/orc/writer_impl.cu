@@ -32,6 +32,7 @@
 #include <rmm/device_uvector.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <numeric>
 #include <utility>
@@ -51,12 +52,6 @@ struct row_group_index_info {
 };
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to ORC compression
  */
@@ -65,6 +60,7 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
@@ -255,10 +251,76 @@ std::vector<stripe_rowgroups> writer::impl::gather_stripe_info(
   return infos;
 }
 
+namespace {
+
+/**
+ * @brief Returns the number of distinct strings estimated from a HyperLogLog sketch
+ */
+double estimate_cardinality(gpu::CardinalitySketch const &sketch)
+{
+  constexpr auto num_registers = static_cast<double>(gpu::cardinality_sketch_size);
+  constexpr auto hash_range    = 4294967296.0;
+
+  double inverse_sum = 0;
+  size_t num_zeros   = 0;
+  for (auto const rank : sketch.registers) {
+    inverse_sum += std::ldexp(1.0, -static_cast<int>(rank));
+    num_zeros += (rank == 0);
+  }
+  auto const alpha    = 0.7213 / (1 + 1.079 / num_registers);
+  auto const estimate = alpha * num_registers * num_registers / inverse_sum;
+  // Small and large cardinalities are corrected for the empty registers and the hash collisions
+  if (estimate <= 2.5 * num_registers && num_zeros != 0) {
+    return num_registers * std::log(num_registers / num_zeros);
+  }
+  if (estimate > hash_range / 30) { return -hash_range * std::log(1 - estimate / hash_range); }
+  return estimate;
+}
+
+}  // namespace
+
+void writer::impl::select_dictionary_columns(const table_device_view &view,
+                                             orc_column_view const *columns,
+                                             std::vector<int> const &str_col_ids,
+                                             device_span<size_type> d_str_col_ids,
+                                             size_t num_rowgroups,
+                                             hostdevice_vector<bool> *dict_enabled)
+{
+  if (!enable_dictionary_) {
+    std::fill(dict_enabled->host_ptr(), dict_enabled->host_ptr() + dict_enabled->size(), false);
+    dict_enabled->host_to_device(stream);
+    return;
+  }
+
+  hostdevice_vector<gpu::CardinalitySketch> sketches(str_col_ids.size(), stream);
+  CUDA_TRY(cudaMemsetAsync(sketches.device_ptr(), 0, sketches.memory_size(), stream.value()));
+  gpu::UpdateCardinalitySketches(sketches.device_ptr(),
+                                 view,
+                                 d_str_col_ids.data(),
+                                 d_str_col_ids.size(),
+                                 num_rowgroups,
+                                 row_index_stride_,
+                                 stream);
+  sketches.device_to_host(stream, true);
+
+  // Relative standard error of the estimates
+  auto const estimate_error = 1.04 / std::sqrt(static_cast<double>(gpu::cardinality_sketch_size));
+  for (size_t i = 0; i < str_col_ids.size(); ++i) {
+    auto const &column     = columns[str_col_ids[i]];
+    auto const valid_count = static_cast<double>(column.data_count() - column.null_count());
+    auto const avg_length  = (valid_count != 0) ? sketches[i].char_count / valid_count : 0.0;
+    auto const cardinality = estimate_cardinality(sketches[i]) * (1 - estimate_error);
+    // The dictionary holds every distinct string, plus at least a byte of index per string
+    (*dict_enabled)[i] = cardinality * (avg_length + 1) < valid_count * avg_length;
+  }
+  dict_enabled->host_to_device(stream);
+}
+
 void writer::impl::init_dictionaries(const table_device_view &view,
                                      orc_column_view *columns,
                                      std::vector<int> const &str_col_ids,
                                      device_span<size_type> d_str_col_ids,
+                                     hostdevice_vector<bool> const &dict_enabled,
                                      uint32_t *dict_data,
                                      uint32_t *dict_index,
                                      hostdevice_vector<gpu::DictionaryChunk> *dict)
@@ -278,6 +340,7 @@ void writer::impl::init_dictionaries(const table_device_view &view,
                              dict_index,
                              row_index_stride_,
                              d_str_col_ids.data(),
+                             dict_enabled.device_ptr(),
                              d_str_col_ids.size(),
                              num_rowgroups,
                              stream);
@@ -287,6 +350,7 @@ void writer::impl::init_dictionaries(const table_device_view &view,
 void writer::impl::build_dictionaries(orc_column_view *columns,
                                       std::vector<int> const &str_col_ids,
                                       host_span<stripe_rowgroups const> stripe_bounds,
+                                      host_span<bool const> dict_enabled,
                                       hostdevice_vector<gpu::DictionaryChunk> const &dict,
                                       uint32_t *dict_index,
                                       hostdevice_vector<gpu::StripeDictionary> &stripe_dict)
@@ -298,8 +362,9 @@ void writer::impl::build_dictionaries(orc_column_view *columns,
     str_column.attach_stripe_dict(stripe_dict.host_ptr(), stripe_dict.device_ptr());
 
     for (auto const &stripe : stripe_bounds) {
-      auto &sd           = stripe_dict[stripe.id * str_col_ids.size() + col_idx];
-      sd.dict_data       = str_column.host_dict_chunk(stripe.first)->dict_data;
+      auto &sd     = stripe_dict[stripe.id * str_col_ids.size() + col_idx];
+      sd.dict_data = dict_enabled[col_idx] ? str_column.host_dict_chunk(stripe.first)->dict_data
+                                           : nullptr;
       sd.dict_index      = dict_index + col_idx * str_column.data_count();  // Indexed by abs row
       sd.column_id       = str_col_ids[col_idx];
       sd.start_chunk     = stripe.first;
@@ -313,7 +378,7 @@ void writer::impl::build_dictionaries(orc_column_view *columns,
       sd.leaf_column = dict[col_idx].leaf_column;
     }
 
-    if (enable_dictionary_) {
+    if (dict_enabled[col_idx]) {
       struct string_column_cost {
         size_t direct     = 0;
         size_t dictionary = 0;
@@ -842,7 +907,8 @@ void writer::impl::write_index_stream(int32_t stripe_id,
                                       host_span<gpu_inflate_status_s const> comp_out,
                                       StripeInformation *stripe,
                                       orc_streams *streams,
-                                      ProtobufWriter *pbw)
+                                      ProtobufWriter *pbw,
+                                      async_sink_writer *sink_writer)
 {
   row_group_index_info present;
   row_group_index_info data;
@@ -916,16 +982,16 @@ void writer::impl::write_index_stream(int32_t stripe_id,
     buffer_[1]             = static_cast<uint8_t>(uncomp_ix_len >> 8);
     buffer_[2]             = static_cast<uint8_t>(uncomp_ix_len >> 16);
   }
-  out_sink_->host_write(buffer_.data(), buffer_.size());
   stripe->indexLength += buffer_.size();
+  sink_writer->host_write(std::vector<uint8_t>(buffer_));
 }
 
 void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
                                      gpu::encoder_chunk_streams const &enc_stream,
                                      uint8_t const *compressed_data,
-                                     uint8_t *stream_out,
                                      StripeInformation *stripe,
-                                     orc_streams *streams)
+                                     orc_streams *streams,
+                                     async_sink_writer *sink_writer)
 {
   const auto length                                        = strm_desc.stream_size;
   (*streams)[enc_stream.ids[strm_desc.stream_type]].length = length;
@@ -934,15 +1000,7 @@ void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
   const auto *stream_in = (compression_kind_ == NONE) ? enc_stream.data_ptrs[strm_desc.stream_type]
                                                       : (compressed_data + strm_desc.bfr_offset);
 
-  if (out_sink_->is_device_write_preferred(length)) {
-    out_sink_->device_write(stream_in, length, stream);
-  } else {
-    CUDA_TRY(
-      cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream.value()));
-    stream.synchronize();
-
-    out_sink_->host_write(stream_out, length);
-  }
+  sink_writer->device_write(stream_in, length, stream);
   stripe->dataLength += length;
 }
 
@@ -1062,11 +1120,19 @@ void writer::impl::write(table_view const &table)
   const auto num_rowgroups   = div_by_rowgroups<size_t>(num_rows);
   const auto num_dict_chunks = num_rowgroups * str_col_ids.size();
   hostdevice_vector<gpu::DictionaryChunk> dict(num_dict_chunks, stream);
+  hostdevice_vector<bool> dict_enabled(str_col_ids.size(), stream);
   if (!str_col_ids.empty()) {
+    select_dictionary_columns(*device_columns,
+                              orc_columns.data(),
+                              str_col_ids,
+                              string_column_ids,
+                              num_rowgroups,
+                              &dict_enabled);
     init_dictionaries(*device_columns,
                       orc_columns.data(),
                       str_col_ids,
                       string_column_ids,
+                      dict_enabled,
                       dict_data.data(),
                       dict_index.data(),
                       &dict);
@@ -1079,8 +1145,13 @@ void writer::impl::write(table_view const &table)
   const auto num_stripe_dict = stripe_bounds.size() * str_col_ids.size();
   hostdevice_vector<gpu::StripeDictionary> stripe_dict(num_stripe_dict, stream);
   if (!str_col_ids.empty()) {
-    build_dictionaries(
-      orc_columns.data(), str_col_ids, stripe_bounds, dict, dict_index.data(), stripe_dict);
+    build_dictionaries(orc_columns.data(),
+                       str_col_ids,
+                       stripe_bounds,
+                       dict_enabled,
+                       dict,
+                       dict_index.data(),
+                       stripe_dict);
   }
 
   auto streams  = create_streams(orc_columns, stripe_bounds);
@@ -1104,43 +1175,23 @@ void writer::impl::write(table_view const &table)
     column_stats = gather_statistic_blobs(*device_columns, orc_columns, stripe_bounds);
   }
 
-  // Allocate intermediate output stream buffer
+  // Compute the offsets of the compressed data streams
   size_t compressed_bfr_size   = 0;
   size_t num_compressed_blocks = 0;
-  auto stream_output           = [&]() {
-    size_t max_stream_size = 0;
-    bool all_device_write  = true;
-
+  if (compression_kind_ != NONE) {
     for (size_t stripe_id = 0; stripe_id < stripe_bounds.size(); stripe_id++) {
-      for (size_t i = 0; i < num_data_streams; i++) {  // TODO range for (at least)
+      for (size_t i = 0; i < num_data_streams; i++) {
         gpu::StripeStream *ss = &strm_descs[stripe_id][i];
-        if (!out_sink_->is_device_write_preferred(ss->stream_size)) { all_device_write = false; }
-        size_t stream_size = ss->stream_size;
-        if (compression_kind_ != NONE) {
-          ss->first_block = num_compressed_blocks;
-          ss->bfr_offset  = compressed_bfr_size;
-
-          auto num_blocks = std::max<uint32_t>(
-            (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
-          stream_size += num_blocks * 3;
-          num_compressed_blocks += num_blocks;
-          compressed_bfr_size += stream_size;
-        }
-        max_stream_size = std::max(max_stream_size, stream_size);
-      }
-    }
+        ss->first_block       = num_compressed_blocks;
+        ss->bfr_offset        = compressed_bfr_size;
 
-    if (all_device_write) {
-      return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
-    } else {
-      return pinned_buffer<uint8_t>{[](size_t size) {
-                                      uint8_t *ptr = nullptr;
-                                      CUDA_TRY(cudaMallocHost(&ptr, size));
-                                      return ptr;
-                                    }(max_stream_size),
-                                    cudaFreeHost};
+        auto num_blocks = std::max<uint32_t>(
+          (ss->stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
+        num_compressed_blocks += num_blocks;
+        compressed_bfr_size += ss->stream_size + num_blocks * 3;
+      }
     }
-  }();
+  }
 
   // Compress the data streams
   rmm::device_buffer compressed_data(compressed_bfr_size, stream);
@@ -1163,12 +1214,13 @@ void writer::impl::write(table_view const &table)
 
   ProtobufWriter pbw_(&buffer_);
 
-  // Write stripes
+  // Write stripes; the sink writes overlap the staging copies and the encoding of the next stripes
+  async_sink_writer sink_writer(out_sink_.get());
   for (size_t stripe_id = 0; stripe_id < stripes.size(); ++stripe_id) {
     auto const &rowgroup_range = stripe_bounds[stripe_id];
     auto &stripe               = stripes[stripe_id];
 
-    stripe.offset = out_sink_->bytes_written();
+    stripe.offset = sink_writer.bytes_written();
 
     // Column (skippable) index streams appear at the start of the stripe
     for (size_type stream_id = 0; stream_id <= num_columns; ++stream_id) {
@@ -1181,7 +1233,8 @@ void writer::impl::write(table_view const &table)
                          comp_out,
                          &stripe,
                          &streams,
-                         &pbw_);
+                         &pbw_,
+                         &sink_writer);
     }
 
     // Column data consisting one or more separate streams
@@ -1189,9 +1242,9 @@ void writer::impl::write(table_view const &table)
       write_data_stream(strm_desc,
                         enc_data.streams[strm_desc.column_id][rowgroup_range.first],
                         static_cast<uint8_t *>(compressed_data.data()),
-                        stream_output.get(),
                         &stripe,
-                        &streams);
+                        &streams,
+                        &sink_writer);
     }
 
     // Write stripefooter consisting of stream information
@@ -1215,8 +1268,9 @@ void writer::impl::write(table_view const &table)
       buffer_[1]             = static_cast<uint8_t>(uncomp_sf_len >> 8);
       buffer_[2]             = static_cast<uint8_t>(uncomp_sf_len >> 16);
     }
-    out_sink_->host_write(buffer_.data(), buffer_.size());
+    sink_writer.host_write(std::vector<uint8_t>(buffer_));
   }
+  sink_writer.wait();
 
   if (column_stats.size() != 0) {
     // File-level statistics
@@ -19,6 +19,7 @@
 #include "orc.h"
 #include "orc_gpu.h"
 
+#include <io/utilities/async_sink_writer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
@@ -183,6 +184,27 @@ class writer::impl {
   void close();
 
  private:
+  /**
+   * @brief Selects the string columns to dictionary-encode from an estimate of the number of
+   * distinct strings in each column.
+   *
+   * Dictionary encoding is skipped for the columns in which most strings are distinct, as their
+   * dictionary would not reduce the output size.
+   *
+   * @param view Table device view representing input table
+   * @param columns List of columns
+   * @param str_col_ids List of columns that are strings type
+   * @param d_str_col_ids List of columns that are strings type in device memory
+   * @param num_rowgroups Number of row groups
+   * @param dict_enabled Whether to build the dictionary of each string column
+   */
+  void select_dictionary_columns(const table_device_view& view,
+                                 orc_column_view const* columns,
+                                 std::vector<int> const& str_col_ids,
+                                 device_span<size_type> d_str_col_ids,
+                                 size_t num_rowgroups,
+                                 hostdevice_vector<bool>* dict_enabled);
+
   /**
    * @brief Builds up column dictionaries indices
    *
@@ -190,6 +212,7 @@ class writer::impl {
    * @param columns List of columns
    * @param str_col_ids List of columns that are strings type
    * @param d_str_col_ids List of columns that are strings type in device memory
+   * @param dict_enabled Whether to build the dictionary of each string column
    * @param dict_data Dictionary data memory
    * @param dict_index Dictionary index memory
    * @param dict List of dictionary chunks
@@ -198,6 +221,7 @@ class writer::impl {
                          orc_column_view* columns,
                          std::vector<int> const& str_col_ids,
                          device_span<size_type> d_str_col_ids,
+                         hostdevice_vector<bool> const& dict_enabled,
                          uint32_t* dict_data,
                          uint32_t* dict_index,
                          hostdevice_vector<gpu::DictionaryChunk>* dict);
@@ -208,6 +232,7 @@ class writer::impl {
    * @param columns List of columns
    * @param str_col_ids List of columns that are strings type
    * @param stripe_bounds List of stripe boundaries
+   * @param dict_enabled Whether to build the dictionary of each string column
    * @param dict List of dictionary chunks
    * @param dict_index List of dictionary indices
    * @param stripe_dict List of stripe dictionaries
@@ -215,6 +240,7 @@ class writer::impl {
   void build_dictionaries(orc_column_view* columns,
                           std::vector<int> const& str_col_ids,
                           host_span<stripe_rowgroups const> stripe_bounds,
+                          host_span<bool const> dict_enabled,
                           hostdevice_vector<gpu::DictionaryChunk> const& dict,
                           uint32_t* dict_index,
                           hostdevice_vector<gpu::StripeDictionary>& stripe_dict);
@@ -306,6 +332,7 @@ class writer::impl {
    * @param[in,out] stripe Stream's parent stripe
    * @param[in,out] streams List of all streams
    * @param[in,out] pbw Protobuf writer
+   * @param[in,out] sink_writer Writer of the stripes to the sink
    */
   void write_index_stream(int32_t stripe_id,
                           int32_t stream_id,
@@ -316,7 +343,8 @@ class writer::impl {
                           host_span<gpu_inflate_status_s const> comp_out,
                           StripeInformation* stripe,
                           orc_streams* streams,
-                          ProtobufWriter* pbw);
+                          ProtobufWriter* pbw,
+                          async_sink_writer* sink_writer);
 
   /**
    * @brief Write the specified column's data streams
@@ -324,16 +352,16 @@ class writer::impl {
    * @param[in] strm_desc Stream's descriptor
    * @param[in] enc_stream Chunk's streams
    * @param[in] compressed_data Compressed stream data
-   * @param[in,out] stream_out Temporary host output buffer
    * @param[in,out] stripe Stream's parent stripe
    * @param[in,out] streams List of all streams
+   * @param[in,out] sink_writer Writer of the stripes to the sink
    */
   void write_data_stream(gpu::StripeStream const& strm_desc,
                          gpu::encoder_chunk_streams const& enc_stream,
                          uint8_t const* compressed_data,
-                         uint8_t* stream_out,
                          StripeInformation* stripe,
-                         orc_streams* streams);
+                         orc_streams* streams,
+                         async_sink_writer* sink_writer);
 
   /**
    * @brief Insert 3-byte uncompressed block headers in a byte vector
@@ -117,6 +117,52 @@ size_t CompactProtocolWriter::write(const ColumnChunkMetaData &s)
   if (s.index_page_offset != 0) { c.field_int(10, s.index_page_offset); }
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   if (s.statistics_blob.size() != 0) { c.field_struct_blob(12, s.statistics_blob); }
+  if (s.bloom_filter_length != 0) {
+    c.field_int(14, s.bloom_filter_offset);
+    c.field_int(15, s.bloom_filter_length);
+  }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const PageLocation &p)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, p.offset);
+  c.field_int(2, p.compressed_page_size);
+  c.field_int(3, p.first_row_index);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const OffsetIndex &o)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_struct_list(1, o.page_locations);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const ColumnIndex &ci)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_bool_list(1, ci.null_pages);
+  c.field_binary_list(2, ci.min_values);
+  c.field_binary_list(3, ci.max_values);
+  c.field_int(4, static_cast<int32_t>(ci.boundary_order));
+  if (ci.null_counts.size() != 0) { c.field_int_list(5, ci.null_counts); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHeader &b)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, b.num_bytes);
+  // Algorithm, hash and compression: unions holding their first (empty) member
+  for (int field = 2; field <= 4; field++) {
+    c.put_field_header(field, c.current_field(), ST_FLD_STRUCT);
+    c.put_field_header(1, 0, ST_FLD_STRUCT);
+    c.put_byte(0);  // member struct end
+    c.put_byte(0);  // union struct end
+    c.set_current_field(field);
+  }
   return c.value();
 }
 
@@ -212,6 +258,37 @@ inline void CompactProtocolFieldWriter::field_struct_blob(int field,
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_bool_list(int field, const std::vector<bool> &val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (bool v : val) { put_byte(v ? ST_FLD_TRUE : ST_FLD_FALSE); }
+  current_field_value = field;
+}
+
+inline void CompactProtocolFieldWriter::field_int_list(int field, const std::vector<int64_t> &val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_I64));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto v : val) { put_int(v); }
+  current_field_value = field;
+}
+
+inline void CompactProtocolFieldWriter::field_binary_list(
+  int field, const std::vector<std::vector<uint8_t>> &val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_BINARY));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto &v : val) {
+    put_uint(v.size());
+    put_byte(v.data(), (uint32_t)v.size());
+  }
+  current_field_value = field;
+}
+
 inline void CompactProtocolFieldWriter::field_string(int field, const std::string &val)
 {
   put_field_header(field, current_field_value, ST_FLD_BINARY);
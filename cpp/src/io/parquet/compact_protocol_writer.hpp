@@ -44,6 +44,10 @@ class CompactProtocolWriter {
   size_t write(const KeyValue &);
   size_t write(const ColumnChunk &);
   size_t write(const ColumnChunkMetaData &);
+  size_t write(const PageLocation &);
+  size_t write(const OffsetIndex &);
+  size_t write(const ColumnIndex &);
+  size_t write(const BloomFilterHeader &);
 
  protected:
   std::vector<uint8_t> &m_buf;
@@ -88,6 +92,12 @@ class CompactProtocolFieldWriter {
 
   inline void field_struct_blob(int field, const std::vector<uint8_t> &val);
 
+  inline void field_bool_list(int field, const std::vector<bool> &val);
+
+  inline void field_int_list(int field, const std::vector<int64_t> &val);
+
+  inline void field_binary_list(int field, const std::vector<std::vector<uint8_t>> &val);
+
   inline void field_string(int field, const std::string &val);
 
   inline void field_string_list(int field, const std::vector<std::string> &val);
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file dataset_writer.cpp
+ * @brief cuDF-IO writer of Hive-partitioned Parquet datasets
+ */
+
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/detail/parquet.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/converters.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream.hpp>
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <iterator>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+namespace {
+
+// Name of the partition of the rows whose partition value is null
+constexpr char const *hive_null_partition = "__HIVE_DEFAULT_PARTITION__";
+
+bool is_supported_partition_type(data_type type)
+{
+  return type.id() == type_id::STRING || type.id() == type_id::BOOL8 || is_integral(type) ||
+         is_floating_point(type);
+}
+
+/**
+ * @brief Percent-encodes the characters that Hive escapes in partition names and values
+ */
+std::string escape_path_name(std::string const &name)
+{
+  constexpr char const *escaped_chars = "\"#%'*/:=?\\\x7f{[]^";
+  std::string escaped;
+  for (unsigned char const c : name) {
+    if (c < 0x20 || std::strchr(escaped_chars, c) != nullptr) {
+      char encoded[4];
+      std::snprintf(encoded, sizeof(encoded), "%%%02X", c);
+      escaped += encoded;
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+/**
+ * @brief Converts the values of a partition column to strings
+ */
+std::unique_ptr<column> partition_values_to_strings(column_view const &values,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource *mr)
+{
+  if (values.type().id() == type_id::STRING) {
+    return std::make_unique<column>(values, stream, mr);
+  }
+  if (values.type().id() == type_id::BOOL8) {
+    return cudf::strings::detail::from_booleans(values,
+                                                string_scalar("true", true, stream),
+                                                string_scalar("false", true, stream),
+                                                stream,
+                                                mr);
+  }
+  if (is_integral(values.type())) {
+    return cudf::strings::detail::from_integers(values, stream, mr);
+  }
+  return cudf::strings::detail::from_floats(values, stream, mr);
+}
+
+/**
+ * @brief Copies the strings of a column to the host, replacing the nulls and the empty strings
+ * with the name of the null partition, as Hive does
+ */
+std::vector<std::string> partition_values_to_host(strings_column_view const &strings,
+                                                  rmm::cuda_stream_view stream)
+{
+  auto const offsets = cudf::detail::make_std_vector_sync(
+    device_span<size_type const>(strings.offsets().data<size_type>() + strings.offset(),
+                                 strings.size() + 1),
+    stream);
+  auto const chars = cudf::detail::make_std_vector_sync(
+    device_span<char const>(strings.chars().data<char>(), strings.chars_size()), stream);
+  auto const null_mask =
+    strings.nullable()
+      ? cudf::detail::make_std_vector_sync(
+          device_span<bitmask_type const>(strings.null_mask(),
+                                          num_bitmask_words(strings.offset() + strings.size())),
+          stream)
+      : std::vector<bitmask_type>{};
+
+  std::vector<std::string> values(strings.size());
+  for (size_type i = 0; i < strings.size(); ++i) {
+    auto const is_null = !null_mask.empty() && !bit_is_set(null_mask.data(), strings.offset() + i);
+    if (is_null || offsets[i] == offsets[i + 1]) {
+      values[i] = hive_null_partition;
+    } else {
+      values[i] =
+        escape_path_name(std::string(chars.data() + offsets[i], chars.data() + offsets[i + 1]));
+    }
+  }
+  return values;
+}
+
+/**
+ * @brief Creates a directory and its missing parents, like `mkdir -p`
+ */
+void create_directories(std::string const &path)
+{
+  for (auto pos = path.find('/', 1);; pos = path.find('/', pos + 1)) {
+    auto const dir = path.substr(0, pos);
+    CUDF_EXPECTS(mkdir(dir.c_str(), 0755) == 0 || errno == EEXIST,
+                 "Cannot create directory " + dir);
+    if (pos == std::string::npos) { break; }
+  }
+}
+
+/**
+ * @brief Rows of the grouped table that are written to a file
+ */
+struct file_info {
+  std::string path;  ///< Path relative to the base path
+  size_type begin;
+  size_type end;
+};
+
+}  // namespace
+
+std::vector<std::string> write_dataset(parquet_dataset_writer_options const &options,
+                                       rmm::mr::device_memory_resource *mr,
+                                       rmm::cuda_stream_view stream)
+{
+  auto const &table          = options.get_table();
+  auto const &partition_cols = options.get_partition_cols();
+  auto const *metadata       = options.get_metadata();
+  CUDF_EXPECTS(!partition_cols.empty(), "At least one partition column is required");
+  CUDF_EXPECTS(metadata == nullptr ||
+                 metadata->column_metadata.size() == static_cast<size_t>(table.num_columns()),
+               "Mismatch between the number of columns and the metadata");
+
+  std::vector<bool> is_partition_col(table.num_columns(), false);
+  for (auto const col : partition_cols) {
+    CUDF_EXPECTS(col >= 0 && col < table.num_columns(), "Invalid partition column index");
+    CUDF_EXPECTS(is_supported_partition_type(table.column(col).type()),
+                 "Unsupported partition column type");
+    is_partition_col[col] = true;
+  }
+  std::vector<size_type> value_cols;
+  for (size_type col = 0; col < table.num_columns(); ++col) {
+    if (!is_partition_col[col]) { value_cols.push_back(col); }
+  }
+  CUDF_EXPECTS(!value_cols.empty(), "All the columns are partition columns");
+
+  // The files hold the metadata of the columns that are not partition columns
+  std::unique_ptr<table_input_metadata> file_metadata;
+  if (metadata != nullptr) {
+    file_metadata            = std::make_unique<table_input_metadata>();
+    file_metadata->user_data = metadata->user_data;
+    for (auto const col : value_cols) {
+      file_metadata->column_metadata.push_back(metadata->column_metadata[col]);
+    }
+  }
+
+  if (table.num_rows() == 0) { return {}; }
+
+  // Group the rows by their partition values, keeping the null values as their own partitions
+  cudf::groupby::groupby grouper(table.select(partition_cols), null_policy::INCLUDE);
+  auto const groups    = grouper.get_groups(table.select(value_cols), mr);
+  auto const num_parts = static_cast<size_type>(groups.offsets.size()) - 1;
+
+  // Name the directory of each partition from the keys of its first row
+  auto const first_rows = cudf::detail::make_device_uvector_async(
+    host_span<size_type const>(groups.offsets.data(), num_parts), stream);
+  auto const part_keys = cudf::detail::gather(
+    groups.keys->view(),
+    column_view(data_type{type_id::INT32}, num_parts, first_rows.data()),
+    out_of_bounds_policy::DONT_CHECK,
+    cudf::detail::negative_index_policy::NOT_ALLOWED,
+    stream);
+  std::vector<std::string> part_dirs(num_parts);
+  for (size_t i = 0; i < partition_cols.size(); ++i) {
+    auto const col  = partition_cols[i];
+    auto const name = (metadata != nullptr && !metadata->column_metadata[col].get_name().empty())
+                        ? metadata->column_metadata[col].get_name()
+                        : "col" + std::to_string(col);
+
+    auto const strings = partition_values_to_strings(part_keys->get_column(i).view(), stream, mr);
+    auto const values  = partition_values_to_host(strings_column_view(strings->view()), stream);
+    for (size_type part = 0; part < num_parts; ++part) {
+      part_dirs[part] += (i == 0 ? "" : "/") + escape_path_name(name) + "=" + values[part];
+    }
+  }
+
+  // Roll the rows of each partition over files of at most `max_rows_per_file` rows
+  auto const &base_path = options.get_base_path();
+  auto const max_rows   = options.get_max_rows_per_file();
+  std::vector<file_info> files;
+  for (size_type part = 0; part < num_parts; ++part) {
+    create_directories(base_path + "/" + part_dirs[part]);
+    auto const part_end = groups.offsets[part + 1];
+    for (auto begin = groups.offsets[part]; begin < part_end;) {
+      auto const end = begin + std::min(max_rows, part_end - begin);
+      char name[32];
+      std::snprintf(name, sizeof(name), "part-%05d.parquet", static_cast<int>(files.size()));
+      files.push_back({part_dirs[part] + "/" + name, begin, end});
+      begin = end;
+    }
+  }
+
+  // The grouped rows must be complete before the files are encoded on their own streams
+  stream.synchronize();
+
+  auto const encode_file = [&](file_info const &file) {
+    rmm::cuda_stream file_stream;
+    auto const path = base_path + "/" + file.path;
+    auto const rows = cudf::slice(groups.values->view(), {file.begin, file.end})[0];
+    parquet_writer_options file_options =
+      parquet_writer_options::builder(sink_info{path}, rows)
+        .compression(options.get_compression())
+        .stats_level(options.get_stats_level())
+        .int96_timestamps(options.is_enabled_int96_timestamps())
+        .metadata(file_metadata.get());
+    writer file_writer(
+      data_sink::create(path), file_options, SingleWriteMode::YES, mr, file_stream.view());
+    file_writer.write(rows);
+    file_writer.close();
+    file_stream.synchronize();
+  };
+
+  auto const max_threads = static_cast<size_t>(options.get_max_concurrent_files());
+  thread_pool pool(std::min(files.size(), max_threads));
+  std::vector<std::future<void>> writes;
+  for (auto const &file : files) {
+    writes.push_back(pool.submit([&encode_file, &file]() { encode_file(file); }));
+  }
+  // Rethrow the first error, once all the files are written
+  for (auto &write : writes) { write.wait(); }
+  for (auto &write : writes) { write.get(); }
+
+  std::vector<std::string> paths;
+  std::transform(files.cbegin(), files.cend(), std::back_inserter(paths), [](auto const &file) {
+    return file.path;
+  });
+  return paths;
+}
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -194,10 +194,16 @@ __device__ uint32_t InitLevelSection(page_state_s *s,
     s->initial_rle_value[lvl] = 0;
     s->lvl_start[lvl]         = cur;
   } else if (encoding == Encoding::RLE) {
-    if (cur + 4 < end) {
+    // V2 levels have their length in the page header instead of a 4-byte prefix
+    bool const is_v2 = s->page.flags & PAGEINFO_FLAGS_V2;
+    if (cur + (is_v2 ? 0 : 4) < end) {
       uint32_t run;
-      len = 4 + (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
-      cur += 4;
+      if (is_v2) {
+        len = lvl == level_type::DEFINITION ? s->page.def_lvl_bytes : s->page.rep_lvl_bytes;
+      } else {
+        len = 4 + (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
+        cur += 4;
+      }
       run                     = get_vlq32(cur, end);
       s->initial_rle_run[lvl] = run;
       if (!(run & 1)) {
@@ -509,13 +515,20 @@ __device__ void gpuInitStringDescriptors(volatile page_state_s *s, int target_po
  *
  * @param[in,out] s Page state input/output
  * @param[in] src_pos Source position
- * @param[in] dstv Pointer to row output data (string descriptor or 32-bit hash)
+ * @param[in] dstv Pointer to row output data (string descriptor, 32-bit hash or dictionary index)
  */
 inline __device__ void gpuOutputString(volatile page_state_s *s, int src_pos, void *dstv)
 {
   const char *ptr = NULL;
   size_t len      = 0;
 
+  if (s->col.output_dict_index) {
+    // Output the index of the entry among the dictionary entries of all the chunks of the column
+    uint32_t dict_idx = (s->dict_bits > 0) ? s->dict_idx[src_pos & (non_zero_buffer_size - 1)] : 0;
+    *static_cast<uint32_t *>(dstv) = s->col.dict_key_offset + dict_idx;
+    return;
+  }
+
   if (s->dict_base) {
     // String dictionary
     uint32_t dict_pos = (s->dict_bits > 0) ? s->dict_idx[src_pos & (non_zero_buffer_size - 1)] *
@@ -1691,6 +1704,8 @@ extern "C" __global__ void __launch_bounds__(block_size)
   int t                 = threadIdx.x;
   int out_thread0;
 
+  // pages whose rows are all filtered out are not decoded
+  if (pages[page_idx].flags & PAGEINFO_FLAGS_SKIP) { return; }
   if (!setupLocalPageInfo(s, &pages[page_idx], chunks, min_row, num_rows, num_chunks)) { return; }
 
   if (s->dict_base) {
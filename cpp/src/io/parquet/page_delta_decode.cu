@@ -0,0 +1,559 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "parquet_gpu.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+namespace {
+
+constexpr int block_size      = 128;
+constexpr int pages_per_block = block_size / 32;  // one warp per page
+
+/**
+ * @brief Returns whether a page uses one of the DELTA_* encodings
+ */
+inline __host__ __device__ bool is_delta_page(PageInfo const &page)
+{
+  return !(page.flags & PAGEINFO_FLAGS_DICTIONARY) &&
+         (page.encoding == Encoding::DELTA_BINARY_PACKED ||
+          page.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY ||
+          page.encoding == Encoding::DELTA_BYTE_ARRAY);
+}
+
+/**
+ * @brief Read a 64-bit unsigned LEB128 integer
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit value read
+ */
+inline __device__ uint64_t get_uleb64(uint8_t const *&cur, uint8_t const *end)
+{
+  uint64_t v = 0;
+  for (uint32_t shift = 0; cur < end && shift < 64; shift += 7) {
+    auto const c = *cur++;
+    v |= static_cast<uint64_t>(c & 0x7f) << shift;
+    if (!(c & 0x80)) { break; }
+  }
+  return v;
+}
+
+/**
+ * @brief Read a 64-bit zigzag-encoded signed integer
+ *
+ * The value is returned as unsigned, since the delta arithmetic relies on wraparound.
+ */
+inline __device__ uint64_t get_zigzag64(uint8_t const *&cur, uint8_t const *end)
+{
+  auto const u = get_uleb64(cur, end);
+  return (u >> 1) ^ (~(u & 1) + 1);
+}
+
+/**
+ * @brief Unpacks the `idx`-th `bit_width`-bit value of a little-endian bit-packed run
+ */
+inline __device__ uint64_t unpack_bits(uint8_t const *data,
+                                       uint8_t const *end,
+                                       uint32_t idx,
+                                       uint32_t bit_width)
+{
+  if (bit_width == 0) { return 0; }
+  uint64_t const bit_pos = static_cast<uint64_t>(idx) * bit_width;
+  uint32_t const shift   = bit_pos & 7;
+  uint8_t const *p       = data + (bit_pos >> 3);
+  uint32_t const nbytes  = (shift + bit_width + 7) >> 3;
+  uint64_t v             = 0;
+  for (uint32_t i = 0; i < min(nbytes, 8u); i++) {
+    if (p + i < end) { v |= static_cast<uint64_t>(p[i]) << (8 * i); }
+  }
+  v >>= shift;
+  // A 64-bit value that is not byte-aligned spans 9 bytes
+  if (nbytes > 8 && p + 8 < end) { v |= static_cast<uint64_t>(p[8]) << (64 - shift); }
+  return (bit_width < 64) ? v & ((1ull << bit_width) - 1) : v;
+}
+
+/**
+ * @brief Inclusive prefix sum across the lanes of a warp
+ */
+template <typename T>
+inline __device__ T warp_inclusive_sum(T v, uint32_t t)
+{
+  for (uint32_t delta = 1; delta < 32; delta *= 2) {
+    T const other = __shfl_up_sync(~0, v, delta);
+    if (t >= delta) { v += other; }
+  }
+  return v;
+}
+
+/**
+ * @brief Decoder for a DELTA_BINARY_PACKED stream, run by all the lanes of a warp
+ *
+ * Values are decoded in batches of up to 32 values, one per lane: the first batch holds the first
+ * value of the stream, and each following batch holds 32 values of a miniblock. The lanes unpack
+ * the deltas of a batch in parallel, and a warp-wide inclusive scan adds them to the last value
+ * of the previous batch. The decoder state is the same in all the lanes.
+ *
+ * Values are returned as 64-bit unsigned integers; for INT32 streams only the low 32 bits are
+ * meaningful, as the writer computes the deltas with 32-bit wraparound.
+ */
+struct delta_binary_decoder {
+  uint8_t const *cur;         // start of the current miniblock, or of the next block
+  uint8_t const *end;         // end of the page
+  uint8_t const *bit_widths;  // bit widths of the miniblocks of the current block
+  uint32_t mini_block_size;   // number of values in a miniblock
+  uint32_t num_mini_blocks;   // number of miniblocks in a block
+  uint32_t num_values;        // number of values in the stream
+  uint32_t value_idx;         // index of the first value of the next batch
+  uint32_t mini_block_idx;    // index of the current miniblock in its block
+  uint32_t mini_block_pos;    // number of values already decoded from the current miniblock
+  uint32_t bit_width;         // bit width of the current miniblock
+  uint64_t min_delta;         // minimum delta of the current block
+  uint64_t last_value;        // last value of the previous batch
+  bool error;
+
+  /**
+   * @brief Parses the header of the stream starting at `start`
+   */
+  inline __device__ void init(uint8_t const *start, uint8_t const *page_end)
+  {
+    cur                   = start;
+    end                   = page_end;
+    auto const block_size = get_uleb64(cur, end);
+    auto const mini_count = get_uleb64(cur, end);
+    auto const count      = get_uleb64(cur, end);
+    last_value            = get_zigzag64(cur, end);
+
+    error = cur > end || block_size == 0 || block_size % 128 != 0 || block_size >= (1u << 31) ||
+            mini_count == 0 || block_size % mini_count != 0 ||
+            (block_size / mini_count) % 32 != 0 || count >= (1u << 31);
+    mini_block_size = error ? 0 : block_size / mini_count;
+    num_mini_blocks = error ? 0 : mini_count;
+    num_values      = error ? 0 : count;
+    value_idx       = 0;
+    mini_block_idx  = num_mini_blocks;
+    mini_block_pos  = 0;
+    bit_width       = 0;
+    min_delta       = 0;
+    bit_widths      = nullptr;
+  }
+
+  /**
+   * @brief Decodes the next batch of values
+   *
+   * @param[in] t Lane index
+   * @param[out] value Value decoded by this lane, valid if `t` is less than the returned count
+   *
+   * @return Number of values in the batch; zero at the end of the stream or on error
+   */
+  inline __device__ uint32_t next_batch(uint32_t t, uint64_t &value)
+  {
+    if (error || value_idx >= num_values) { return 0; }
+    if (value_idx == 0) {
+      value     = last_value;
+      value_idx = 1;
+      return 1;
+    }
+    if (mini_block_pos == mini_block_size) {
+      cur += (static_cast<size_t>(mini_block_size) * bit_width) >> 3;
+      mini_block_pos = 0;
+      mini_block_idx++;
+    }
+    if (mini_block_idx == num_mini_blocks) {
+      min_delta  = get_zigzag64(cur, end);
+      bit_widths = cur;
+      cur += num_mini_blocks;
+      mini_block_idx = 0;
+      if (cur > end) {
+        error = true;
+        return 0;
+      }
+    }
+    bit_width = bit_widths[mini_block_idx];
+    if (bit_width > 64) {
+      error = true;
+      return 0;
+    }
+
+    auto const delta =
+      warp_inclusive_sum(min_delta + unpack_bits(cur, end, mini_block_pos + t, bit_width), t);
+    value      = last_value + delta;
+    last_value = shuffle(value, 31);
+    mini_block_pos += 32;
+
+    auto const count = min(32u, num_values - value_idx);
+    value_idx += count;
+    return count;
+  }
+
+  /**
+   * @brief Returns the end of the stream, once all the values have been decoded
+   */
+  inline __device__ uint8_t const *stream_end() const
+  {
+    // Miniblocks are padded to a whole number of values; unused miniblocks are omitted
+    return (mini_block_pos != 0)
+             ? cur + ((static_cast<size_t>(mini_block_size) * bit_width) >> 3)
+             : cur;
+  }
+};
+
+/**
+ * @brief Returns the position of the values of a data page, after the levels
+ *
+ * @return Start of the values, or nullptr if the levels are malformed
+ */
+inline __device__ uint8_t const *skip_levels(PageInfo const &page, ColumnChunkDesc const &chunk)
+{
+  uint8_t const *cur       = page.page_data;
+  uint8_t const *const end = cur + page.uncompressed_page_size;
+  if (page.flags & PAGEINFO_FLAGS_V2) {
+    cur += page.rep_lvl_bytes + page.def_lvl_bytes;
+    return (cur <= end) ? cur : nullptr;
+  }
+  for (int i = 0; i < level_type::NUM_LEVEL_TYPES; i++) {
+    // Repetition levels come first
+    auto const lvl        = (i == 0) ? level_type::REPETITION : level_type::DEFINITION;
+    auto const level_bits = chunk.level_bits[lvl];
+    auto const encoding   = (lvl == level_type::DEFINITION) ? page.definition_level_encoding
+                                                            : page.repetition_level_encoding;
+    if (level_bits == 0) { continue; }
+    if (encoding == Encoding::RLE) {
+      if (cur + 4 > end) { return nullptr; }
+      cur += 4 + (cur[0] | (cur[1] << 8) | (cur[2] << 16) | (static_cast<uint32_t>(cur[3]) << 24));
+    } else if (encoding == Encoding::BIT_PACKED) {
+      cur += (page.num_input_values * level_bits + 7) >> 3;
+    } else {
+      return nullptr;
+    }
+  }
+  return (cur <= end) ? cur : nullptr;
+}
+
+/**
+ * @brief Returns the end of a DELTA_BINARY_PACKED stream, or nullptr if it is malformed
+ */
+inline __device__ uint8_t const *skip_delta_binary(delta_binary_decoder dec, uint32_t t)
+{
+  uint64_t v;
+  while (dec.next_batch(t, v) != 0) {}
+  return dec.error ? nullptr : dec.stream_end();
+}
+
+/**
+ * @brief Locates the streams of a DELTA_LENGTH_BYTE_ARRAY or DELTA_BYTE_ARRAY page
+ *
+ * @param[in] values Start of the values of the page
+ * @param[in] end End of the page
+ * @param[in] encoding Encoding of the page
+ * @param[in] t Lane index
+ * @param[out] prefixes Decoder of the prefix lengths (DELTA_BYTE_ARRAY only)
+ * @param[out] suffixes Decoder of the suffix lengths, or of the lengths for
+ * DELTA_LENGTH_BYTE_ARRAY
+ *
+ * @return Start of the suffix bytes, or nullptr if the page is malformed
+ */
+inline __device__ uint8_t const *init_string_streams(uint8_t const *values,
+                                                     uint8_t const *end,
+                                                     Encoding encoding,
+                                                     uint32_t t,
+                                                     delta_binary_decoder &prefixes,
+                                                     delta_binary_decoder &suffixes)
+{
+  uint8_t const *suffix_lengths = values;
+  if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    prefixes.init(values, end);
+    suffix_lengths = skip_delta_binary(prefixes, t);
+    if (suffix_lengths == nullptr) { return nullptr; }
+  }
+  suffixes.init(suffix_lengths, end);
+  if (encoding == Encoding::DELTA_BYTE_ARRAY && prefixes.num_values != suffixes.num_values) {
+    return nullptr;
+  }
+  return skip_delta_binary(suffixes, t);
+}
+
+/**
+ * @brief Returns the size of a delta page transcoded to the PLAIN encoding
+ *
+ * All the lengths are validated here, so that the transcoding itself needs no bounds checks.
+ *
+ * @return Size in bytes, levels included, or -1 if the page can't be transcoded
+ */
+__device__ int64_t transcoded_page_size(PageInfo const &page,
+                                        ColumnChunkDesc const &chunk,
+                                        uint32_t t)
+{
+  auto const end    = page.page_data + page.uncompressed_page_size;
+  auto const values = skip_levels(page, chunk);
+  if (values == nullptr) { return -1; }
+  int64_t const lvl_bytes = values - page.page_data;
+  auto const type         = chunk.data_type & 7;
+
+  if (page.encoding == Encoding::DELTA_BINARY_PACKED) {
+    if (type != INT32 && type != INT64) { return -1; }
+    delta_binary_decoder dec;
+    dec.init(values, end);
+    if (dec.error) { return -1; }
+    return lvl_bytes + static_cast<int64_t>(dec.num_values) * ((type == INT64) ? 8 : 4);
+  }
+
+  if (type != BYTE_ARRAY &&
+      !(type == FIXED_LEN_BYTE_ARRAY && page.encoding == Encoding::DELTA_BYTE_ARRAY)) {
+    return -1;
+  }
+  bool const is_prefixed = (page.encoding == Encoding::DELTA_BYTE_ARRAY);
+  delta_binary_decoder prefixes, suffixes;
+  auto const suffix_data = init_string_streams(values, end, page.encoding, t, prefixes, suffixes);
+  if (suffix_data == nullptr) { return -1; }
+
+  // Each prefix must fit in the previous string, and fixed-length values must have the right size
+  int64_t const fixed_len = (type == FIXED_LEN_BYTE_ARRAY) ? (chunk.data_type >> 3) : -1;
+  int64_t total_len       = 0;
+  int64_t suffix_len      = 0;
+  int64_t prev_len        = 0;
+  uint64_t p = 0, s;
+  while (auto const count = suffixes.next_batch(t, s)) {
+    if (is_prefixed && prefixes.next_batch(t, p) != count) { return -1; }
+    int64_t const prefix = (t < count) ? static_cast<int32_t>(p) : 0;
+    int64_t const suffix = (t < count) ? static_cast<int32_t>(s) : 0;
+    int64_t const len    = prefix + suffix;
+    int64_t prev         = __shfl_up_sync(~0, len, 1);
+    if (t == 0) { prev = prev_len; }
+    bool const is_valid_len = t >= count || fixed_len < 0 || len == fixed_len;
+    if (ballot(prefix < 0 || suffix < 0 || prefix > prev || !is_valid_len)) { return -1; }
+    prev_len = shuffle(len, count - 1);
+    total_len += shuffle(warp_inclusive_sum(len, t), 31);
+    suffix_len += shuffle(warp_inclusive_sum(suffix, t), 31);
+  }
+  if (suffixes.error || suffix_len > end - suffix_data) { return -1; }
+  int64_t const len_bytes = (type == BYTE_ARRAY) ? 4 : 0;
+  return lvl_bytes + len_bytes * suffixes.num_values + total_len;
+}
+
+/**
+ * @brief Writes a batch of strings in the PLAIN layout, one string per lane
+ *
+ * Each string is the first `prefix_len` bytes of the previous string followed by `suffix_len`
+ * bytes of the suffix data. The lanes copy the bytes of one string at a time.
+ *
+ * @param[in,out] out Output position, updated past the batch
+ * @param[in,out] suffix Suffix data position, updated past the batch
+ * @param[in,out] prev Previous string, updated to the last string of the batch
+ * @param[in] count Number of strings in the batch
+ * @param[in] prefix_len Prefix length of the string of this lane
+ * @param[in] suffix_len Suffix length of the string of this lane
+ * @param[in] len_bytes Size of the length written ahead of each string (4, or 0 for fixed-length
+ * values)
+ * @param[in] t Lane index
+ */
+inline __device__ void write_string_batch(uint8_t *&out,
+                                          uint8_t const *&suffix,
+                                          uint8_t const *&prev,
+                                          uint32_t count,
+                                          uint32_t prefix_len,
+                                          uint32_t suffix_len,
+                                          uint32_t len_bytes,
+                                          uint32_t t)
+{
+  if (t >= count) { prefix_len = suffix_len = 0; }
+  uint32_t const out_len    = (t < count) ? prefix_len + suffix_len + len_bytes : 0;
+  uint32_t const len        = prefix_len + suffix_len;
+  uint64_t const out_end    = warp_inclusive_sum<uint64_t>(out_len, t);
+  uint64_t const suffix_end = warp_inclusive_sum<uint64_t>(suffix_len, t);
+  uint64_t const out_pos    = out_end - out_len;
+  uint64_t const suffix_pos = suffix_end - suffix_len;
+
+  for (uint32_t i = 0; i < count; i++) {
+    auto const str_len    = shuffle(len, i);
+    auto const str_prefix = shuffle(prefix_len, i);
+    auto const dst        = out + shuffle(out_pos, i);
+    auto const src        = suffix + shuffle(suffix_pos, i);
+    if (t < len_bytes) { dst[t] = static_cast<uint8_t>(str_len >> (8 * t)); }
+    auto const str = dst + len_bytes;
+    for (uint32_t j = t; j < str_prefix; j += 32) {
+      str[j] = prev[j];
+    }
+    for (uint32_t j = t; j < str_len - str_prefix; j += 32) {
+      str[str_prefix + j] = src[j];
+    }
+    // The next string may copy its prefix from this one
+    __syncwarp();
+    prev = str;
+  }
+  out += shuffle(out_end, 31);
+  suffix += shuffle(suffix_end, 31);
+}
+
+/**
+ * @brief Kernel for computing the size of the delta pages once transcoded to PLAIN
+ *
+ * @param[in] pages List of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_pages Number of pages
+ * @param[out] page_sizes Transcoded size of each page, or -1 for pages that are not transcoded
+ */
+// blockDim {128,1,1}
+__global__ void __launch_bounds__(block_size) gpuComputeDeltaPageSizes(
+  PageInfo const *pages, ColumnChunkDesc const *chunks, int32_t num_pages, int64_t *page_sizes)
+{
+  uint32_t const t   = threadIdx.x % 32;
+  int const page_idx = blockIdx.x * pages_per_block + threadIdx.x / 32;
+  if (page_idx >= num_pages) { return; }
+
+  auto const &page = pages[page_idx];
+  auto const size  = is_delta_page(page) && page.uncompressed_page_size > 0
+                       ? transcoded_page_size(page, chunks[page.chunk_idx], t)
+                       : -1;
+  if (t == 0) { page_sizes[page_idx] = (size <= INT32_MAX) ? size : -1; }
+}
+
+/**
+ * @brief Kernel for transcoding the delta pages to PLAIN
+ *
+ * Each page is decoded by one warp. The levels are copied as they are, followed by the values in
+ * the PLAIN layout; the page is then updated to point to the transcoded data.
+ *
+ * @param[in,out] pages List of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_pages Number of pages
+ * @param[in] page_sizes Transcoded size of each page, or -1 for pages that are not transcoded
+ * @param[in] page_offsets Offset of each transcoded page in the output
+ * @param[out] out_data Output buffer for the transcoded pages
+ */
+// blockDim {128,1,1}
+__global__ void __launch_bounds__(block_size) gpuDecodeDeltaPages(PageInfo *pages,
+                                                                  ColumnChunkDesc const *chunks,
+                                                                  int32_t num_pages,
+                                                                  int64_t const *page_sizes,
+                                                                  size_t const *page_offsets,
+                                                                  uint8_t *out_data)
+{
+  uint32_t const t   = threadIdx.x % 32;
+  int const page_idx = blockIdx.x * pages_per_block + threadIdx.x / 32;
+  if (page_idx >= num_pages || page_sizes[page_idx] < 0) { return; }
+
+  auto const page   = pages[page_idx];
+  auto const &chunk = chunks[page.chunk_idx];
+  auto const end    = page.page_data + page.uncompressed_page_size;
+  auto const values = skip_levels(page, chunk);
+  auto const type   = chunk.data_type & 7;
+  auto const out    = out_data + page_offsets[page_idx];
+
+  auto const lvl_bytes = static_cast<uint32_t>(values - page.page_data);
+  for (uint32_t i = t; i < lvl_bytes; i += 32) {
+    out[i] = page.page_data[i];
+  }
+
+  if (page.encoding == Encoding::DELTA_BINARY_PACKED) {
+    uint32_t const width = (type == INT64) ? 8 : 4;
+    delta_binary_decoder dec;
+    dec.init(values, end);
+    uint64_t v;
+    while (auto const count = dec.next_batch(t, v)) {
+      if (t < count) {
+        auto const dst = out + lvl_bytes + static_cast<size_t>(dec.value_idx - count + t) * width;
+        for (uint32_t i = 0; i < width; i++) {
+          dst[i] = static_cast<uint8_t>(v >> (8 * i));
+        }
+      }
+    }
+  } else {
+    bool const is_prefixed = (page.encoding == Encoding::DELTA_BYTE_ARRAY);
+    delta_binary_decoder prefixes, suffixes;
+    auto suffix_data = init_string_streams(values, end, page.encoding, t, prefixes, suffixes);
+
+    uint8_t *dst             = out + lvl_bytes;
+    uint8_t const *prev      = dst;
+    uint32_t const len_bytes = (type == BYTE_ARRAY) ? 4 : 0;
+    uint64_t p = 0, s;
+    while (auto const count = suffixes.next_batch(t, s)) {
+      if (is_prefixed) { prefixes.next_batch(t, p); }
+      write_string_batch(dst, suffix_data, prev, count, p, s, len_bytes, t);
+    }
+  }
+
+  __syncwarp();
+  if (t == 0) {
+    pages[page_idx].page_data              = out;
+    pages[page_idx].uncompressed_page_size = static_cast<int32_t>(page_sizes[page_idx]);
+    pages[page_idx].encoding               = Encoding::PLAIN;
+  }
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::io::parquet::gpu::DecodeDeltaPages
+ */
+rmm::device_buffer DecodeDeltaPages(hostdevice_vector<PageInfo> &pages,
+                                    hostdevice_vector<ColumnChunkDesc> const &chunks,
+                                    rmm::cuda_stream_view stream)
+{
+  auto const num_pages = static_cast<int32_t>(pages.size());
+  if (std::none_of(pages.host_ptr(), pages.host_ptr() + num_pages, is_delta_page)) {
+    return rmm::device_buffer{};
+  }
+
+  dim3 dim_block(block_size, 1);
+  dim3 dim_grid((num_pages + pages_per_block - 1) / pages_per_block, 1);
+
+  rmm::device_uvector<int64_t> page_sizes(num_pages, stream);
+  gpuComputeDeltaPageSizes<<<dim_grid, dim_block, 0, stream.value()>>>(
+    pages.device_ptr(), chunks.device_ptr(), num_pages, page_sizes.data());
+
+  rmm::device_uvector<size_t> page_offsets(num_pages + 1, stream);
+  auto size_input = thrust::make_transform_iterator(
+    page_sizes.begin(),
+    [] __device__(int64_t size) { return static_cast<size_t>(size > 0 ? size : 0); });
+  CUDA_TRY(cudaMemsetAsync(page_offsets.data(), 0, sizeof(size_t), stream.value()));
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), size_input, size_input + num_pages, page_offsets.begin() + 1);
+
+  rmm::device_buffer delta_page_data(page_offsets.element(num_pages, stream), stream);
+  gpuDecodeDeltaPages<<<dim_grid, dim_block, 0, stream.value()>>>(
+    pages.device_ptr(),
+    chunks.device_ptr(),
+    num_pages,
+    page_sizes.data(),
+    page_offsets.data(),
+    static_cast<uint8_t *>(delta_page_data.data()));
+
+  // The transcoded pages must be visible to the host, which later updates the page nesting info
+  pages.device_to_host(stream, true);
+
+  return delta_page_data;
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -35,6 +35,9 @@ struct dict_state_s {
   uint32_t dictionary_size;     //!< Total dictionary size in bytes
   uint32_t num_dict_entries;    //!< Dictionary entries in current fragment to add
   uint32_t frag_dict_size;
+  size_t plain_size;            //!< Plain encoded size of the dictionary fragments
+  size_t num_dict_values;       //!< Number of non-null values in the dictionary fragments
+  bool is_dict_smaller;         //!< Whether the dictionary encoding is smaller than plain
   EncColumnChunk ck;
   parquet_column_device_view col;
   PageFragment frag;
@@ -174,6 +177,8 @@ __global__ void __launch_bounds__(block_size, 1)
     s->cur_fragment          = s->ck.fragments;
     s->total_dict_entries    = 0;
     s->dictionary_size       = 0;
+    s->plain_size            = 0;
+    s->num_dict_values       = 0;
     s->ck.num_dict_fragments = 0;
   }
   dtype     = s->col.physical_type;
@@ -301,13 +306,31 @@ __global__ void __launch_bounds__(block_size, 1)
       if (frag_dict_size != s->frag.dict_data_size) { s->frag.dict_data_size = frag_dict_size; }
       s->total_dict_entries += num_dict_entries;
       s->dictionary_size += frag_dict_size;
+      s->plain_size += s->frag.fragment_data_size;
+      s->num_dict_values += s->frag.non_nulls;
       s->row_cnt += s->frag.num_rows;
       s->cur_fragment++;
       s->ck.num_dict_fragments++;
     }
     __syncthreads();
   }
+  // Now that the chunk cardinality is known, keep the dictionary only if the dictionary page and
+  // the indices are smaller than the plain encoding of the same values
+  if (!t) {
+    auto const dict_encoded_size =
+      s->dictionary_size + GetDictIndexSize(s->num_dict_values, s->total_dict_entries);
+    s->is_dict_smaller = s->ck.num_dict_fragments != 0 && dict_encoded_size < s->plain_size;
+  }
   __syncthreads();
+  if (!s->is_dict_smaller && !s->ck.is_dict_forced) {
+    if (!t) {
+      chunks[blockIdx.x].has_dictionary     = 0;
+      chunks[blockIdx.x].num_dict_fragments = 0;
+      chunks[blockIdx.x].dictionary_size    = 0;
+      chunks[blockIdx.x].total_dict_entries = 0;
+    }
+    return;
+  }
   GenerateDictionaryIndices<block_size>(s, t);
   if (!t) {
     chunks[blockIdx.x].num_dict_fragments = s->ck.num_dict_fragments;
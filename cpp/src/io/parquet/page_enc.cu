@@ -18,6 +18,7 @@
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -503,29 +504,21 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
       max_page_size = (values_in_page * 2 >= ck_g.num_values)
                         ? 256 * 1024
                         : (values_in_page * 3 >= ck_g.num_values) ? 384 * 1024 : 512 * 1024;
+      // The levels are encoded in the page along with the data. Nested columns with many empty or
+      // null lists have more levels than leaf values, so the pages are limited by both sizes, and
+      // are not left to grow into a few large pages encoded by a few blocks.
+      uint32_t const level_size =
+        GetMaxLevelSize(col_g.num_def_level_bits(), values_in_page + frag_g.num_values) +
+        GetMaxLevelSize(col_g.num_rep_level_bits(), values_in_page + frag_g.num_values);
       if (num_rows >= ck_g.num_rows ||
           (values_in_page > 0 &&
-           (page_size + fragment_data_size > max_page_size ||
+           (page_size + fragment_data_size + level_size > max_page_size ||
             (ck_g.has_dictionary && fragments_in_chunk == ck_g.num_dict_fragments)))) {
         uint32_t dict_bits_plus1;
 
         if (ck_g.has_dictionary && page_start < ck_g.num_dict_fragments) {
-          uint32_t dict_bits;
-          if (num_dict_entries <= 2) {
-            dict_bits = 1;
-          } else if (num_dict_entries <= 4) {
-            dict_bits = 2;
-          } else if (num_dict_entries <= 16) {
-            dict_bits = 4;
-          } else if (num_dict_entries <= 256) {
-            dict_bits = 8;
-          } else if (num_dict_entries <= 4096) {
-            dict_bits = 12;
-          } else {
-            dict_bits = 16;
-          }
-          page_size       = 1 + 5 + ((values_in_page * dict_bits + 7) >> 3) + (values_in_page >> 8);
-          dict_bits_plus1 = dict_bits + 1;
+          page_size       = GetDictIndexSize(values_in_page, num_dict_entries);
+          dict_bits_plus1 = GetDictIndexBits(num_dict_entries) + 1;
         } else {
           dict_bits_plus1 = 0;
         }
@@ -551,19 +544,9 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
           page_g.num_rows         = rows_in_page;
           page_g.num_leaf_values  = leaf_values_in_page;
           page_g.num_values       = values_in_page;
-          uint32_t def_level_bits = col_g.num_def_level_bits();
-          uint32_t rep_level_bits = col_g.num_rep_level_bits();
-          // Run length = 4, max(rle/bitpack header) = 5, add one byte per 256 values for overhead
-          // TODO (dm): Improve readability of these calculations.
-          uint32_t def_level_size =
-            (def_level_bits != 0)
-              ? 4 + 5 + ((def_level_bits * page_g.num_values + 7) >> 3) + (page_g.num_values >> 8)
-              : 0;
-          uint32_t rep_level_size =
-            (rep_level_bits != 0)
-              ? 4 + 5 + ((rep_level_bits * page_g.num_values + 7) >> 3) + (page_g.num_values >> 8)
-              : 0;
-          page_g.max_data_size = page_size + def_level_size + rep_level_size;
+          uint32_t def_level_size = GetMaxLevelSize(col_g.num_def_level_bits(), page_g.num_values);
+          uint32_t rep_level_size = GetMaxLevelSize(col_g.num_rep_level_bits(), page_g.num_values);
+          page_g.max_data_size    = page_size + def_level_size + rep_level_size;
 
           pagestats_g.start_chunk = ck_g.first_fragment + page_start;
           pagestats_g.num_chunks  = page_g.num_fragments;
@@ -1563,6 +1546,82 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
   if (t == 0) pages[start_page + blockIdx.x] = page_g;
 }
 
+// blockDim(128, 1, 1)
+__global__ void __launch_bounds__(128) gpuEncodePageStatistics(const EncPage *pages,
+                                                               const EncColumnChunk *chunks,
+                                                               uint32_t num_pages,
+                                                               const statistics_chunk *page_stats,
+                                                               const size_t *stats_offsets,
+                                                               uint8_t *stats_data,
+                                                               uint32_t *stats_sizes)
+{
+  uint32_t page_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  float fp_scratch[2];
+
+  if (page_idx >= num_pages) { return; }
+  const EncPage *page = &pages[page_idx];
+  uint32_t stats_size = 0;
+  if (page->page_type != PageType::DICTIONARY_PAGE) {
+    uint8_t *stats_start = stats_data + stats_offsets[page_idx];
+    uint8_t *stats_end   = EncodeStatistics(
+      stats_start, &page_stats[page_idx], chunks[page->chunk_id].col_desc, fp_scratch);
+    stats_size = static_cast<uint32_t>(stats_end - stats_start);
+  }
+  stats_sizes[page_idx] = stats_size;
+}
+
+// blockDim(128, 1, 1), gridDim(num_chunks, blocks_per_chunk, 1)
+__global__ void __launch_bounds__(128) gpuBuildBloomFilters(const EncColumnChunk *chunks)
+{
+  const EncColumnChunk *ck = &chunks[blockIdx.x];
+  uint32_t *bitset         = ck->bloom_filter;
+  if (bitset == nullptr) { return; }
+  const parquet_column_device_view *col = ck->col_desc;
+  column_device_view *leaf              = col->leaf_column;
+  uint32_t const num_blocks             = ck->bloom_filter_size / bloom_filter_block_size;
+  uint32_t const dtype_len_in           = GetDtypeLogicalLen(leaf);
+
+  for (uint32_t i = blockIdx.y * blockDim.x + threadIdx.x; i < ck->num_rows;
+       i += gridDim.y * blockDim.x) {
+    uint32_t const row = ck->start_row + i;
+    if (!leaf->is_valid(row)) { continue; }
+    // Hash the plain encoding of the value, as written by gpuEncodePages
+    uint64_t hash;
+    switch (col->physical_type) {
+      case INT32:
+      case FLOAT: {
+        int32_t v;
+        if (dtype_len_in == 4)
+          v = leaf->element<int32_t>(row);
+        else if (dtype_len_in == 2)
+          v = leaf->element<int16_t>(row);
+        else
+          v = leaf->element<int8_t>(row);
+        hash = XXHash_64<int32_t>{}(v);
+      } break;
+      case INT64: {
+        int64_t v        = leaf->element<int64_t>(row);
+        int32_t ts_scale = col->ts_scale;
+        if (ts_scale != 0) {
+          if (ts_scale < 0) {
+            v /= -ts_scale;
+          } else {
+            v *= ts_scale;
+          }
+        }
+        hash = XXHash_64<int64_t>{}(v);
+      } break;
+      case DOUBLE: hash = XXHash_64<double>{}(leaf->element<double>(row)); break;
+      case BYTE_ARRAY: hash = XXHash_64<string_view>{}(leaf->element<string_view>(row)); break;
+      default: return;
+    }
+    uint32_t *block = bitset + BloomFilterBlock(hash, num_blocks) * bloom_filter_block_words;
+    for (uint32_t w = 0; w < bloom_filter_block_words; w++) {
+      atomicOr(&block[w], BloomFilterMask(hash, w));
+    }
+  }
+}
+
 // blockDim(1024, 1, 1)
 __global__ void __launch_bounds__(1024) gpuGatherPages(EncColumnChunk *chunks, const EncPage *pages)
 {
@@ -1823,7 +1882,7 @@ dremel_data get_dremel_data(column_view h_col,
     }
   }
 
-  std::unique_ptr<rmm::device_buffer> device_view_owners;
+  std::unique_ptr<cudf::detail::device_view_storage> device_view_owners;
   column_device_view *d_nesting_levels;
   std::tie(device_view_owners, d_nesting_levels) =
     contiguous_copy_column_device_views<column_device_view>(nesting_levels, stream);
@@ -2223,6 +2282,51 @@ void EncodePageHeaders(EncPage *pages,
     pages, chunks, comp_out, page_stats, chunk_stats, start_page);
 }
 
+/**
+ * @brief Launches kernel to encode the statistics of each page as a Thrift Statistics struct, for
+ * the page-level column indexes
+ *
+ * @param[in] pages Device array of EncPages
+ * @param[in] chunks Column chunks
+ * @param[in] num_pages Number of pages
+ * @param[in] page_stats Page-level statistics
+ * @param[in] stats_offsets Offset of the encoded statistics of each page in `stats_data`
+ * @param[out] stats_data Encoded statistics of all pages
+ * @param[out] stats_sizes Size of the encoded statistics of each page
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void EncodePageStatistics(const EncPage *pages,
+                          const EncColumnChunk *chunks,
+                          uint32_t num_pages,
+                          const statistics_chunk *page_stats,
+                          const size_t *stats_offsets,
+                          uint8_t *stats_data,
+                          uint32_t *stats_sizes,
+                          rmm::cuda_stream_view stream)
+{
+  constexpr uint32_t block_size = 128;
+  uint32_t const num_blocks     = (num_pages + block_size - 1) / block_size;
+  gpuEncodePageStatistics<<<num_blocks, block_size, 0, stream.value()>>>(
+    pages, chunks, num_pages, page_stats, stats_offsets, stats_data, stats_sizes);
+}
+
+/**
+ * @brief Launches kernel to fill the bloom filters of the column chunks that have one
+ *
+ * @param[in] chunks Column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void BuildBloomFilters(const EncColumnChunk *chunks,
+                       uint32_t num_chunks,
+                       rmm::cuda_stream_view stream)
+{
+  // Chunks are at most a few million rows, so a few thousand threads per chunk are enough
+  constexpr uint32_t blocks_per_chunk = 32;
+  dim3 dim_grid(num_chunks, blocks_per_chunk);
+  gpuBuildBloomFilters<<<dim_grid, 128, 0, stream.value()>>>(chunks);
+}
+
 /**
  * @brief Launches kernel to gather pages to a single contiguous block per chunk
  *
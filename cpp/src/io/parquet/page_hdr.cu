@@ -50,6 +50,7 @@ struct byte_stream_s {
   const uint8_t *base;
   // Parsed symbols
   PageType page_type;
+  bool is_compressed;
   PageInfo page;
   ColumnChunkDesc ck;
 };
@@ -172,6 +173,25 @@ struct ParquetFieldInt32 {
   }
 };
 
+/**
+ * @brief Functor to set value to bool read from byte stream
+ *
+ * @return True if field type is not bool
+ */
+struct ParquetFieldBool {
+  int field;
+  bool &val;
+
+  __device__ ParquetFieldBool(int f, bool &v) : field(f), val(v) {}
+
+  inline __device__ bool operator()(byte_stream_s *bs, int field_type)
+  {
+    // Compact protocol booleans are stored in the field type
+    val = (field_type == ST_FLD_TRUE);
+    return (field_type != ST_FLD_TRUE && field_type != ST_FLD_FALSE);
+  }
+};
+
 /**
  * @brief Functor to set value to enum read from byte stream
  *
@@ -309,8 +329,9 @@ struct gpuParseDataPageHeaderV2 {
     auto op = thrust::make_tuple(ParquetFieldInt32(1, bs->page.num_input_values),
                                  ParquetFieldInt32(3, bs->page.num_rows),
                                  ParquetFieldEnum<Encoding>(4, bs->page.encoding),
-                                 ParquetFieldEnum<Encoding>(5, bs->page.definition_level_encoding),
-                                 ParquetFieldEnum<Encoding>(6, bs->page.repetition_level_encoding));
+                                 ParquetFieldInt32(5, bs->page.def_lvl_bytes),
+                                 ParquetFieldInt32(6, bs->page.rep_lvl_bytes),
+                                 ParquetFieldBool(7, bs->is_compressed));
     return parse_header(op, bs);
   }
 };
@@ -381,7 +402,10 @@ extern "C" __global__ void __launch_bounds__(128)
         // they will be recomputed in the preprocess step by examining repetition and
         // definition levels
         bs->page.chunk_row += bs->page.num_rows;
-        bs->page.num_rows = 0;
+        bs->page.num_rows      = 0;
+        bs->page.def_lvl_bytes = 0;
+        bs->page.rep_lvl_bytes = 0;
+        bs->is_compressed      = true;
         if (parse_page_header(bs) && bs->page.compressed_page_size >= 0) {
           switch (bs->page_type) {
             case PageType::DATA_PAGE:
@@ -393,6 +417,13 @@ extern "C" __global__ void __launch_bounds__(128)
               index_out = num_dict_pages + data_page_count;
               data_page_count++;
               bs->page.flags = 0;
+              if (bs->page_type == PageType::DATA_PAGE_V2) {
+                // V2 levels are always RLE encoded
+                bs->page.definition_level_encoding = Encoding::RLE;
+                bs->page.repetition_level_encoding = Encoding::RLE;
+                bs->page.flags =
+                  PAGEINFO_FLAGS_V2 | (bs->is_compressed ? 0 : PAGEINFO_FLAGS_UNCOMPRESSED);
+              }
               values_found += bs->page.num_input_values;
               break;
             case PageType::DICTIONARY_PAGE:
@@ -225,6 +225,22 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;  // Byte offset from the beginning of file to the bloom filter
+  int32_t bloom_filter_length = 0;  // Size of the bloom filter, including its header
+};
+
+/**
+ * @brief Thrift-derived struct describing column chunk statistics
+ *
+ * Values are stored in the plain encoding of the column's physical type.
+ */
+struct Statistics {
+  std::vector<uint8_t> max;        // deprecated max value, signed comparison order
+  std::vector<uint8_t> min;        // deprecated min value, signed comparison order
+  int64_t null_count     = -1;     // count of null values in the column
+  int64_t distinct_count = -1;     // count of distinct values occurring
+  std::vector<uint8_t> max_value;  // max value for the column, determined by its ColumnOrder
+  std::vector<uint8_t> min_value;  // min value for the column, determined by its ColumnOrder
 };
 
 /**
@@ -321,6 +337,50 @@ struct PageHeader {
   DictionaryPageHeader dictionary_page_header;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page in the file
+ */
+struct PageLocation {
+  int64_t offset               = 0;  // Byte offset of the page (header included) in the file
+  int32_t compressed_page_size = 0;  // Page size in bytes, header included
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the page locations of a column chunk
+ *
+ * Data pages are listed in the order they appear in the column chunk; dictionary pages are not
+ * included.
+ */
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing the page-level statistics of a column chunk
+ *
+ * Each list has one entry per data page, in the same order as the pages of the OffsetIndex. The
+ * min/max values of pages that only contain nulls are empty.
+ */
+struct ColumnIndex {
+  std::vector<bool> null_pages;                  // True for pages that only contain nulls
+  std::vector<std::vector<uint8_t>> min_values;  // Encoded min value of each page
+  std::vector<std::vector<uint8_t>> max_values;  // Encoded max value of each page
+  BoundaryOrder boundary_order = UNORDERED;      // Ordering of the min/max values across pages
+  std::vector<int64_t> null_counts;              // Number of nulls of each page
+};
+
+/**
+ * @brief Thrift-derived struct describing the header of a column chunk bloom filter
+ *
+ * The header is followed by the bitset. The algorithm, hash and compression of the filter are
+ * unions whose only members are the split-block algorithm, xxHash64 and no compression, so they
+ * are implied.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset in bytes
+};
+
 /**
  * @brief Count the number of leading zeros in an unsigned integer
  */
@@ -427,6 +487,11 @@ class CompactProtocolReader {
   bool read(DataPageHeader *d);
   bool read(DictionaryPageHeader *d);
   bool read(KeyValue *k);
+  bool read(Statistics *s);
+  bool read(PageLocation *p);
+  bool read(OffsetIndex *o);
+  bool read(ColumnIndex *c);
+  bool read(BloomFilterHeader *b);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -464,6 +529,10 @@ class CompactProtocolReader {
   friend class ParquetFieldEnumListFunctor;
   friend class ParquetFieldStringList;
   friend class ParquetFieldStructBlob;
+  friend class ParquetFieldBinary;
+  friend class ParquetFieldBoolList;
+  friend class ParquetFieldInt64List;
+  friend class ParquetFieldBinaryList;
 };
 
 /**
@@ -487,6 +556,33 @@ class ParquetFieldBool {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of bools from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldBoolList {
+  int field_val;
+  std::vector<bool> &val;
+
+ public:
+  ParquetFieldBoolList(int f, std::vector<bool> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    uint8_t el_type;
+    int32_t n = cpr->get_listh(&el_type);
+    if (el_type != ST_FLD_TRUE && el_type != ST_FLD_FALSE) return true;
+    val.resize(n);
+    // List elements are encoded as one byte each, ST_FLD_TRUE for true
+    for (int32_t i = 0; i < n; i++) { val[i] = (cpr->getb() == ST_FLD_TRUE); }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to set value to 8 bit integer read from CompactProtocolReader
  *
@@ -550,6 +646,32 @@ class ParquetFieldInt64 {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of 64 bit integers from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldInt64List {
+  int field_val;
+  std::vector<int64_t> &val;
+
+ public:
+  ParquetFieldInt64List(int f, std::vector<int64_t> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    uint8_t el_type;
+    int32_t n = cpr->get_listh(&el_type);
+    if (el_type < ST_FLD_I16 || el_type > ST_FLD_I64) return true;
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) { val[i] = cpr->get_i64(); }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a vector of structures from CompactProtocolReader
  *
@@ -618,6 +740,67 @@ class ParquetFieldString {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a binary field from CompactProtocolReader
+ *
+ * @return True if field type mismatches or if size of binary exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinary {
+  int field_val;
+  std::vector<uint8_t> &val;
+
+ public:
+  ParquetFieldBinary(int f, std::vector<uint8_t> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_BINARY) return true;
+    uint32_t n = cpr->get_u32();
+    if (n <= (size_t)(cpr->m_end - cpr->m_cur)) {
+      val.assign(cpr->m_cur, cpr->m_cur + n);
+      cpr->m_cur += n;
+      return false;
+    } else {
+      return true;
+    }
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of binary fields from CompactProtocolReader
+ *
+ * @return True if field types mismatch or if the size of a binary exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinaryList {
+  int field_val;
+  std::vector<std::vector<uint8_t>> &val;
+
+ public:
+  ParquetFieldBinaryList(int f, std::vector<std::vector<uint8_t>> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    uint8_t el_type;
+    int32_t n = cpr->get_listh(&el_type);
+    if (el_type != ST_FLD_BINARY) return true;
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      uint32_t l = cpr->get_u32();
+      if (l > (size_t)(cpr->m_end - cpr->m_cur)) return true;
+      val[i].assign(cpr->m_cur, cpr->m_cur + l);
+      cpr->m_cur += l;
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a structure from CompactProtocolReader
  *
@@ -28,6 +28,7 @@
 #include <cudf/types.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
@@ -59,7 +60,10 @@ namespace gpu {
  * @brief Enums for the flags in the page header
  */
 enum {
-  PAGEINFO_FLAGS_DICTIONARY = (1 << 0),  // Indicates a dictionary page
+  PAGEINFO_FLAGS_DICTIONARY   = (1 << 0),  // Indicates a dictionary page
+  PAGEINFO_FLAGS_V2           = (1 << 1),  // Indicates a V2 data page
+  PAGEINFO_FLAGS_UNCOMPRESSED = (1 << 2),  // Indicates a V2 data page with uncompressed values
+  PAGEINFO_FLAGS_SKIP         = (1 << 3),  // Indicates a data page not to be decoded
 };
 
 /**
@@ -122,6 +126,9 @@ struct PageInfo {
   Encoding encoding;       // Encoding for data or dictionary page
   Encoding definition_level_encoding;  // Encoding used for definition levels (data page)
   Encoding repetition_level_encoding;  // Encoding used for repetition levels (data page)
+  // V2 data pages store the levels uncompressed and without a length prefix, ahead of the values
+  int32_t def_lvl_bytes;  // size of the definition levels in bytes (V2 data page)
+  int32_t rep_lvl_bytes;  // size of the repetition levels in bytes (V2 data page)
 
   // for nested types, we run a preprocess step in order to determine output
   // column sizes. Because of this, we can jump directly to the position in the
@@ -184,6 +191,8 @@ struct ColumnChunkDesc {
       converted_type(converted_type_),
       decimal_scale(decimal_scale_),
       ts_clock_rate(ts_clock_rate_),
+      dict_key_offset(0),
+      output_dict_index(false),
       src_col_index(src_col_index_),
       src_col_schema(src_col_schema_)
   {
@@ -212,6 +221,8 @@ struct ColumnChunkDesc {
   int8_t converted_type;                      // converted type enum
   int8_t decimal_scale;                       // decimal scale pow(10, -decimal_scale)
   int32_t ts_clock_rate;  // output timestamp clock frequency (0=default, 1000=ms, 1000000000=ns)
+  uint32_t dict_key_offset;  // position of the first dictionary entry among all the column keys
+  bool output_dict_index;    // whether strings are output as dictionary indices rather than values
 
   int32_t src_col_index;   // my input column index
   int32_t src_col_schema;  // my schema index in the file
@@ -296,6 +307,39 @@ inline uint32_t __device__ GetDtypeLogicalLen(column_device_view *col)
   }
 }
 
+/**
+ * @brief Return the bit width of the dictionary indices of a page, given the number of entries in
+ * the dictionary
+ */
+inline uint32_t __device__ __host__ GetDictIndexBits(uint32_t num_dict_entries)
+{
+  if (num_dict_entries <= 2) { return 1; }
+  if (num_dict_entries <= 4) { return 2; }
+  if (num_dict_entries <= 16) { return 4; }
+  if (num_dict_entries <= 256) { return 8; }
+  if (num_dict_entries <= 4096) { return 12; }
+  return 16;
+}
+
+/**
+ * @brief Return the estimated size of the RLE/bit-packed dictionary indices of `num_values`
+ * values
+ */
+inline size_t __device__ __host__ GetDictIndexSize(size_t num_values, uint32_t num_dict_entries)
+{
+  return 1 + 5 + ((num_values * GetDictIndexBits(num_dict_entries) + 7) >> 3) + (num_values >> 8);
+}
+
+/**
+ * @brief Return the worst-case size of the RLE/bit-packed repetition or definition levels of
+ * `num_values` values, including their run length
+ */
+inline uint32_t __device__ __host__ GetMaxLevelSize(uint32_t level_bits, uint32_t num_values)
+{
+  // Run length = 4, max(rle/bitpack header) = 5, add one byte per 256 values for overhead
+  return (level_bits != 0) ? 4 + 5 + ((level_bits * num_values + 7) >> 3) + (num_values >> 8) : 0;
+}
+
 /**
  * @brief Return worst-case compressed size of compressed data given the uncompressed size
  */
@@ -325,12 +369,87 @@ struct EncColumnChunk {
   uint32_t dictionary_id;   //!< Dictionary id for this chunk
   uint8_t is_compressed;    //!< Nonzero if the chunk uses compression
   uint8_t has_dictionary;   //!< Nonzero if the chunk uses dictionary encoding
+  uint8_t is_dict_forced;   //!< Nonzero if the dictionary is kept even when it's not smaller
   uint16_t num_dict_fragments;  //!< Number of fragments using dictionary
   uint32_t dictionary_size;     //!< Size of dictionary
   uint32_t total_dict_entries;  //!< Total number of entries in dictionary
   uint32_t ck_stat_size;        //!< Size of chunk-level statistics (included in 1st page header)
+  uint32_t *bloom_filter;       //!< Bloom filter bitset, nullptr if the chunk has none
+  uint32_t bloom_filter_size;   //!< Size of the bloom filter bitset in bytes
 };
 
+/// Size of a split-block bloom filter block: eight 32-bit words, with one bit set per value
+constexpr uint32_t bloom_filter_block_words = 8;
+constexpr uint32_t bloom_filter_block_size  = bloom_filter_block_words * sizeof(uint32_t);
+constexpr size_t bloom_filter_max_size      = 128 * 1024 * 1024;
+
+/**
+ * @brief Return the block of a split-block bloom filter that holds the bits of a value
+ *
+ * @param hash xxHash64 of the plain-encoded value
+ * @param num_blocks Number of blocks in the bloom filter
+ */
+inline __device__ __host__ uint32_t BloomFilterBlock(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Return the bit of a value in a word of its split-block bloom filter block
+ *
+ * @param hash xxHash64 of the plain-encoded value
+ * @param word Index of the word in the block
+ */
+inline __device__ __host__ uint32_t BloomFilterMask(uint64_t hash, uint32_t word)
+{
+  constexpr uint32_t salt[bloom_filter_block_words] = {0x47b6137bU,
+                                                       0x44974d91U,
+                                                       0x8824ad5bU,
+                                                       0xa2b7289dU,
+                                                       0x705495c7U,
+                                                       0x2df1424bU,
+                                                       0x9efc4947U,
+                                                       0x5c6bfb31U};
+  return 1u << ((static_cast<uint32_t>(hash) * salt[word]) >> 27);
+}
+
+/**
+ * @brief Return whether a split-block bloom filter may contain a value
+ *
+ * @param bitset Bloom filter bitset
+ * @param num_blocks Number of blocks in the bloom filter
+ * @param hash xxHash64 of the plain-encoded value
+ */
+inline __device__ __host__ bool BloomFilterContains(uint32_t const *bitset,
+                                                    uint32_t num_blocks,
+                                                    uint64_t hash)
+{
+  auto const block = bitset + BloomFilterBlock(hash, num_blocks) * bloom_filter_block_words;
+  for (uint32_t w = 0; w < bloom_filter_block_words; w++) {
+    if ((block[w] & BloomFilterMask(hash, w)) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Return the bloom filter size in bytes for a 1% false positive rate
+ *
+ * The size is a power of two, between one block and `bloom_filter_max_size`.
+ *
+ * @param num_distinct Number of distinct values, or an upper bound of it
+ */
+inline size_t GetBloomFilterSize(size_t num_distinct)
+{
+  // Split-block filters need -8 / ln(1 - fpp^(1/8)) bits per value, ~9.7 for 1%
+  constexpr double bits_per_value = 9.7;
+  auto const min_size = static_cast<size_t>(num_distinct * bits_per_value / 8);
+  size_t size         = bloom_filter_block_size;
+  while (size < min_size && size < bloom_filter_max_size) {
+    size *= 2;
+  }
+  return size;
+}
+
 /**
  * @brief Launches kernel for parsing the page headers in the column chunks
  *
@@ -380,6 +499,24 @@ void PreprocessColumnData(hostdevice_vector<PageInfo> &pages,
                           rmm::cuda_stream_view stream,
                           rmm::mr::device_memory_resource *mr);
 
+/**
+ * @brief Transcodes the data pages that use the DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY or
+ * DELTA_BYTE_ARRAY encodings to the PLAIN encoding
+ *
+ * The transcoded pages, levels included, are written to the returned buffer, and the pages are
+ * updated to point to it, so that they are preprocessed and decoded like any other PLAIN page.
+ * Pages that fail to transcode are left unchanged.
+ *
+ * @param[in,out] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return Device buffer holding the transcoded pages
+ */
+rmm::device_buffer DecodeDeltaPages(hostdevice_vector<PageInfo> &pages,
+                                    hostdevice_vector<ColumnChunkDesc> const &chunks,
+                                    rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for reading the column data stored in the pages
  *
@@ -551,6 +688,44 @@ void EncodePageHeaders(EncPage *pages,
                        const statistics_chunk *chunk_stats  = nullptr,
                        rmm::cuda_stream_view stream         = rmm::cuda_stream_default);
 
+/**
+ * @brief Launches kernel to encode the statistics of each page as a Thrift Statistics struct, for
+ * the page-level column indexes
+ *
+ * Dictionary pages have no statistics and are encoded as an empty blob.
+ *
+ * @param[in] pages Device array of EncPages
+ * @param[in] chunks Column chunks
+ * @param[in] num_pages Number of pages
+ * @param[in] page_stats Page-level statistics
+ * @param[in] stats_offsets Offset of the encoded statistics of each page in `stats_data`; at most
+ * `max_hdr_size` bytes are written per page
+ * @param[out] stats_data Encoded statistics of all pages
+ * @param[out] stats_sizes Size of the encoded statistics of each page
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void EncodePageStatistics(const EncPage *pages,
+                          const EncColumnChunk *chunks,
+                          uint32_t num_pages,
+                          const statistics_chunk *page_stats,
+                          const size_t *stats_offsets,
+                          uint8_t *stats_data,
+                          uint32_t *stats_sizes,
+                          rmm::cuda_stream_view stream);
+
+/**
+ * @brief Launches kernel to fill the bloom filters of the column chunks that have one
+ *
+ * The bloom filters must be zero-initialized. Only non-nested columns are supported.
+ *
+ * @param[in] chunks Column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void BuildBloomFilters(const EncColumnChunk *chunks,
+                       uint32_t num_chunks,
+                       rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel to gather pages to a single contiguous block per chunk
  *
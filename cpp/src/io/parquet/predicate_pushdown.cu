@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file predicate_pushdown.cu
+ * @brief cuDF-IO Parquet row group pruning using column chunk statistics and bloom filters
+ */
+
+#include "parquet_gpu.hpp"
+#include "predicate_pushdown.hpp"
+
+#include <io/utilities/statistics_filter.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <utility>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+namespace {
+
+/**
+ * @brief Representation type used to store statistics values of type `T`
+ */
+template <typename T, typename Enable = void>
+struct stats_rep {
+  using type = T;
+};
+
+template <typename T>
+struct stats_rep<T, std::enable_if_t<cudf::is_chrono<T>()>> {
+  using type = typename T::rep;
+};
+
+template <typename T>
+constexpr bool is_stats_supported()
+{
+  return (cudf::is_numeric<T>() && !std::is_same<T, bool>::value) || cudf::is_chrono<T>();
+}
+
+/**
+ * @brief Decodes a plain-encoded value of physical type `Source`
+ *
+ * @return false if the encoded value doesn't have the expected size
+ */
+template <typename Source, typename Rep>
+bool decode_as(std::vector<uint8_t> const &bytes, Rep &value)
+{
+  if (bytes.size() != sizeof(Source)) { return false; }
+  Source v;
+  std::memcpy(&v, bytes.data(), sizeof(Source));
+  value = static_cast<Rep>(v);
+  // NaN bounds can't be used for comparisons
+  return value == value;
+}
+
+template <typename Rep>
+bool decode_value(std::vector<uint8_t> const &bytes, Type physical_type, Rep &value)
+{
+  switch (physical_type) {
+    case INT32: return decode_as<int32_t>(bytes, value);
+    case INT64: return decode_as<int64_t>(bytes, value);
+    case FLOAT: return decode_as<float>(bytes, value);
+    case DOUBLE: return decode_as<double>(bytes, value);
+    default: return false;
+  }
+}
+
+/**
+ * @brief Functor to build the columns of per-row-group minimum and maximum values
+ *
+ * Row groups without usable statistics get the full range of the type, so they can never be
+ * rejected by the filter.
+ */
+struct minmax_columns_fn {
+  template <typename T, std::enable_if_t<is_stats_supported<T>()> * = nullptr>
+  minmax_columns operator()(statistics_column const &col,
+                            size_type num_row_groups,
+                            rmm::cuda_stream_view stream)
+  {
+    using rep_type = typename stats_rep<T>::type;
+    std::vector<rep_type> mins(num_row_groups, std::numeric_limits<rep_type>::lowest());
+    std::vector<rep_type> maxs(num_row_groups, std::numeric_limits<rep_type>::max());
+    for (size_type rg = 0; rg < num_row_groups; ++rg) {
+      if (!col.has_stats[rg]) { continue; }
+      auto const &stats = col.stats[rg];
+      rep_type min_value;
+      rep_type max_value;
+      if (decode_value(stats.min_value, col.physical_type, min_value) &&
+          decode_value(stats.max_value, col.physical_type, max_value)) {
+        mins[rg] = min_value;
+        maxs[rg] = max_value;
+      }
+    }
+
+    return make_minmax_columns(col.type, mins, maxs, stream);
+  }
+
+  template <typename T, std::enable_if_t<!is_stats_supported<T>()> * = nullptr>
+  minmax_columns operator()(statistics_column const &, size_type, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Unsupported statistics column type");
+  }
+};
+
+/**
+ * @brief Returns the column and literal of a comparison between a column and a literal
+ *
+ * @return The column and the literal, or nullptr if the operands are not a column of the left
+ * table and a literal
+ */
+std::pair<ast::column_reference const *, ast::literal const *> get_column_and_literal(
+  ast::detail::node const &lhs, ast::detail::node const &rhs)
+{
+  auto col = dynamic_cast<ast::column_reference const *>(&lhs);
+  auto lit = dynamic_cast<ast::literal const *>(&rhs);
+  if (col == nullptr || lit == nullptr) {
+    col = dynamic_cast<ast::column_reference const *>(&rhs);
+    lit = dynamic_cast<ast::literal const *>(&lhs);
+  }
+  if (col == nullptr || lit == nullptr || col->get_table_source() != ast::table_reference::LEFT) {
+    return {nullptr, nullptr};
+  }
+  return {col, lit};
+}
+
+void collect_equality_columns(ast::detail::node const &node, std::vector<size_type> &columns)
+{
+  auto const expr = dynamic_cast<ast::expression const *>(&node);
+  if (expr == nullptr) { return; }
+  auto const operands = expr->get_operands();
+  switch (expr->get_operator()) {
+    case ast::ast_operator::LOGICAL_AND:
+    case ast::ast_operator::LOGICAL_OR:
+      collect_equality_columns(operands[0].get(), columns);
+      collect_equality_columns(operands[1].get(), columns);
+      break;
+    case ast::ast_operator::EQUAL: {
+      auto const col = get_column_and_literal(operands[0].get(), operands[1].get()).first;
+      if (col != nullptr) { columns.push_back(col->get_column_index()); }
+    } break;
+    default: break;
+  }
+}
+
+void collect_referenced_columns(ast::detail::node const &node, std::vector<size_type> &columns)
+{
+  if (auto const col = dynamic_cast<ast::column_reference const *>(&node)) {
+    columns.push_back(col->get_column_index());
+  } else if (auto const expr = dynamic_cast<ast::expression const *>(&node)) {
+    for (auto const &operand : expr->get_operands()) {
+      collect_referenced_columns(operand.get(), columns);
+    }
+  }
+}
+
+/**
+ * @brief Bloom filters of one column in device memory
+ */
+struct device_bloom_filters {
+  rmm::device_uvector<uint32_t> bitsets;  // bitsets of all row groups
+  rmm::device_uvector<size_type> offsets;  // offset of each row group in `bitsets`, in words
+};
+
+/**
+ * @brief Functor to probe the bloom filters of a column for a literal value
+ *
+ * The value is hashed in the plain encoding of the physical type, as done by the writer.
+ */
+struct probe_bloom_filters_fn {
+  template <typename T, std::enable_if_t<is_stats_supported<T>()> * = nullptr>
+  void operator()(cudf::detail::fixed_width_scalar_device_view_base value,
+                  Type physical_type,
+                  device_bloom_filters const &filters,
+                  device_span<uint8_t> result,
+                  rmm::cuda_stream_view stream)
+  {
+    using rep_type = typename stats_rep<T>::type;
+    auto bitsets   = filters.bitsets.data();
+    auto offsets   = filters.offsets.data();
+    thrust::tabulate(
+      rmm::exec_policy(stream),
+      result.begin(),
+      result.end(),
+      [=] __device__(size_type rg) -> uint8_t {
+        auto const num_blocks = static_cast<uint32_t>(offsets[rg + 1] - offsets[rg]) /
+                                gpu::bloom_filter_block_words;
+        if (num_blocks == 0 || !value.is_valid()) { return true; }
+        auto const v = value.value<rep_type>();
+        uint64_t hash;
+        switch (physical_type) {
+          case INT32: hash = XXHash_64<int32_t>{}(static_cast<int32_t>(v)); break;
+          case INT64: hash = XXHash_64<int64_t>{}(static_cast<int64_t>(v)); break;
+          // Zeros and NaNs have several encodings, which are all equal to the value
+          case FLOAT:
+            if (v == 0 || v != v) { return true; }
+            hash = XXHash_64<float>{}(static_cast<float>(v));
+            break;
+          case DOUBLE:
+            if (v == 0 || v != v) { return true; }
+            hash = XXHash_64<double>{}(static_cast<double>(v));
+            break;
+          default: return true;
+        }
+        return gpu::BloomFilterContains(bitsets + offsets[rg], num_blocks, hash);
+      });
+  }
+
+  template <typename T, std::enable_if_t<!is_stats_supported<T>()> * = nullptr>
+  void operator()(cudf::detail::fixed_width_scalar_device_view_base,
+                  Type,
+                  device_bloom_filters const &,
+                  device_span<uint8_t>,
+                  rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Unsupported bloom filter column type");
+  }
+};
+
+/**
+ * @brief Evaluates a filter expression against the bloom filters of each row group
+ *
+ * The bloom filters of a column are copied to the device on first use.
+ */
+class bloom_filter_evaluator {
+ public:
+  bloom_filter_evaluator(std::vector<bloom_filter_column> const &columns,
+                         size_type num_row_groups,
+                         rmm::cuda_stream_view stream)
+    : _columns(columns), _num_row_groups(num_row_groups), _stream(stream)
+  {
+  }
+
+  /**
+   * @brief Evaluates a node of the filter
+   *
+   * @return For each row group, whether it may contain rows for which the node is true
+   */
+  std::vector<bool> evaluate(ast::detail::node const &node)
+  {
+    auto const expr = dynamic_cast<ast::expression const *>(&node);
+    if (expr == nullptr) { return std::vector<bool>(_num_row_groups, true); }
+
+    auto const operands = expr->get_operands();
+    switch (expr->get_operator()) {
+      case ast::ast_operator::LOGICAL_AND: {
+        auto result    = evaluate(operands[0].get());
+        auto const rhs = evaluate(operands[1].get());
+        for (size_type rg = 0; rg < _num_row_groups; ++rg) {
+          result[rg] = result[rg] && rhs[rg];
+        }
+        return result;
+      }
+      case ast::ast_operator::LOGICAL_OR: {
+        auto result    = evaluate(operands[0].get());
+        auto const rhs = evaluate(operands[1].get());
+        for (size_type rg = 0; rg < _num_row_groups; ++rg) {
+          result[rg] = result[rg] || rhs[rg];
+        }
+        return result;
+      }
+      case ast::ast_operator::EQUAL: return probe(operands[0].get(), operands[1].get());
+      default: return std::vector<bool>(_num_row_groups, true);
+    }
+  }
+
+ private:
+  std::vector<bool> probe(ast::detail::node const &lhs, ast::detail::node const &rhs)
+  {
+    auto const col_lit = get_column_and_literal(lhs, rhs);
+    auto const col     = col_lit.first;
+    auto const lit     = col_lit.second;
+    auto const col_idx = (col != nullptr) ? col->get_column_index() : -1;
+    if (col_idx < 0 || col_idx >= static_cast<size_type>(_columns.size()) ||
+        _columns[col_idx].type.id() == type_id::EMPTY ||
+        _columns[col_idx].type != lit->get_data_type()) {
+      return std::vector<bool>(_num_row_groups, true);
+    }
+
+    rmm::device_uvector<uint8_t> result(_num_row_groups, _stream);
+    type_dispatcher(_columns[col_idx].type,
+                    probe_bloom_filters_fn{},
+                    lit->get_value(),
+                    _columns[col_idx].physical_type,
+                    get_device_filters(col_idx),
+                    device_span<uint8_t>{result},
+                    _stream);
+    // BOOL8 values are copied as bytes since std::vector<bool> has no contiguous storage
+    auto const host_result = cudf::detail::make_std_vector_sync(result, _stream);
+    return std::vector<bool>(host_result.begin(), host_result.end());
+  }
+
+  device_bloom_filters const &get_device_filters(size_type col_idx)
+  {
+    auto it = _device_filters.find(col_idx);
+    if (it != _device_filters.end()) { return it->second; }
+
+    auto const &bitsets = _columns[col_idx].bitsets;
+    std::vector<size_type> offsets(_num_row_groups + 1, 0);
+    for (size_type rg = 0; rg < _num_row_groups; ++rg) {
+      offsets[rg + 1] = offsets[rg] + bitsets[rg].size() / sizeof(uint32_t);
+    }
+    std::vector<uint32_t> words(offsets.back());
+    for (size_type rg = 0; rg < _num_row_groups; ++rg) {
+      std::memcpy(words.data() + offsets[rg],
+                  bitsets[rg].data(),
+                  (offsets[rg + 1] - offsets[rg]) * sizeof(uint32_t));
+    }
+    return _device_filters
+      .emplace(col_idx,
+               device_bloom_filters{cudf::detail::make_device_uvector_sync(words, _stream),
+                                    cudf::detail::make_device_uvector_sync(offsets, _stream)})
+      .first->second;
+  }
+
+  std::vector<bloom_filter_column> const &_columns;
+  size_type const _num_row_groups;
+  rmm::cuda_stream_view _stream;
+  std::map<size_type, device_bloom_filters> _device_filters;
+};
+
+}  // namespace
+
+std::vector<bool> evaluate_statistics_filter(ast::expression const &filter,
+                                             std::vector<statistics_column> const &columns,
+                                             size_type num_row_groups,
+                                             rmm::cuda_stream_view stream)
+{
+  std::vector<data_type> column_types;
+  std::transform(columns.cbegin(),
+                 columns.cend(),
+                 std::back_inserter(column_types),
+                 [](auto const &col) { return col.type; });
+  auto get_minmax = [&](size_type col_idx) {
+    return type_dispatcher(
+      columns[col_idx].type, minmax_columns_fn{}, columns[col_idx], num_row_groups, stream);
+  };
+  return cudf::io::detail::evaluate_statistics_filter(
+    filter, column_types, num_row_groups, get_minmax, stream);
+}
+
+std::vector<size_type> get_equality_columns(ast::expression const &filter)
+{
+  std::vector<size_type> columns;
+  collect_equality_columns(filter, columns);
+  std::sort(columns.begin(), columns.end());
+  columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+  return columns;
+}
+
+std::vector<size_type> get_referenced_columns(ast::expression const &filter)
+{
+  std::vector<size_type> columns;
+  collect_referenced_columns(filter, columns);
+  std::sort(columns.begin(), columns.end());
+  columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+  return columns;
+}
+
+std::vector<bool> evaluate_bloom_filters(ast::expression const &filter,
+                                         std::vector<bloom_filter_column> const &columns,
+                                         size_type num_row_groups,
+                                         rmm::cuda_stream_view stream)
+{
+  return bloom_filter_evaluator(columns, num_row_groups, stream).evaluate(filter);
+}
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
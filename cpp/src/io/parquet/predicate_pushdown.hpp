@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file predicate_pushdown.hpp
+ * @brief cuDF-IO Parquet row group pruning using column chunk statistics and bloom filters
+ */
+
+#pragma once
+
+#include "parquet.hpp"
+
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+using namespace cudf::io::parquet;
+
+/**
+ * @brief Statistics of one output column over a set of row groups
+ */
+struct statistics_column {
+  data_type type{type_id::EMPTY};   // output column type; EMPTY if statistics can't be used
+  Type physical_type = BOOLEAN;     // physical type of the encoded statistics values
+  std::vector<Statistics> stats;    // decoded statistics, one per row group
+  std::vector<bool> has_stats;      // whether statistics were present, one per row group
+};
+
+/**
+ * @brief Bloom filters of one output column over a set of row groups
+ */
+struct bloom_filter_column {
+  data_type type{type_id::EMPTY};             // output column type; EMPTY if filters can't be used
+  Type physical_type = BOOLEAN;               // physical type of the hashed values
+  std::vector<std::vector<uint8_t>> bitsets;  // filter bitsets, one per row group; empty if none
+};
+
+/**
+ * @brief Evaluates a filter expression against per-row-group column statistics
+ *
+ * Decodes the min/max values of the columns referenced by the filter and evaluates it with
+ * `cudf::io::detail::evaluate_statistics_filter`, so a row group is only rejected when no row in
+ * it can match.
+ *
+ * @param filter Filter expression; column references index into `columns`
+ * @param columns Statistics for each output column
+ * @param num_row_groups Number of row groups described by each element of `columns`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return For each row group, whether it may contain rows that satisfy the filter
+ */
+std::vector<bool> evaluate_statistics_filter(ast::expression const &filter,
+                                             std::vector<statistics_column> const &columns,
+                                             size_type num_row_groups,
+                                             rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns the indices of the columns that the filter compares for equality with a literal
+ *
+ * Only these columns can be used by `evaluate_bloom_filters`, so their bloom filters are the only
+ * ones worth reading.
+ *
+ * @param filter Filter expression
+ */
+std::vector<size_type> get_equality_columns(ast::expression const &filter);
+
+/**
+ * @brief Returns the indices of all the columns referenced by the filter, in ascending order
+ *
+ * @param filter Filter expression
+ */
+std::vector<size_type> get_referenced_columns(ast::expression const &filter);
+
+/**
+ * @brief Evaluates a filter expression against per-row-group column bloom filters
+ *
+ * Equality comparisons between a column and a literal are rejected for the row groups whose bloom
+ * filter doesn't contain the literal; they are combined with logical AND and OR as in the filter.
+ * All other expressions, and row groups without bloom filters, are treated as possibly true.
+ *
+ * @param filter Filter expression; column references index into `columns`
+ * @param columns Bloom filters for each output column
+ * @param num_row_groups Number of row groups described by each element of `columns`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return For each row group, whether it may contain rows that satisfy the filter
+ */
+std::vector<bool> evaluate_bloom_filters(ast::expression const &filter,
+                                         std::vector<bloom_filter_column> const &columns,
+                                         size_type num_row_groups,
+                                         rmm::cuda_stream_view stream);
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
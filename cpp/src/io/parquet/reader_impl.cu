@@ -20,9 +20,24 @@
  */
 
 #include "reader_impl.hpp"
+#include "predicate_pushdown.hpp"
 
 #include <io/comp/gpuinflate.h>
-
+#include <io/utilities/io_statistics.hpp>
+#include <io/utilities/metadata_cache.hpp>
+#include <io/utilities/prefetch_datasource.hpp>
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/metrics.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -31,9 +46,18 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/device_vector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
 
 #include <algorithm>
 #include <array>
+#include <future>
+#include <mutex>
 #include <numeric>
 #include <regex>
 
@@ -230,6 +254,99 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Creates a dictionary column from the indices decoded into the dictionary entries of all
+ * the chunks of a column
+ *
+ * The chunks of different row groups have their own dictionaries, which may share entries. The
+ * entries are encoded into distinct ordered keys, and the indices are remapped to these keys.
+ *
+ * @param indices Indices into `entries`, with the nulls of the column
+ * @param entries Dictionary entries of all the chunks of the column
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return The dictionary column
+ */
+std::unique_ptr<column> make_dictionary_output(std::unique_ptr<column> indices,
+                                               std::unique_ptr<column> entries,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource *mr)
+{
+  // the indices of the encoded entries are the positions of their keys
+  auto encoded =
+    cudf::dictionary::detail::encode(entries->view(), data_type{type_id::UINT32}, stream, mr);
+  auto const key_positions = dictionary_column_view(encoded->view()).indices();
+
+  auto remapped  = make_numeric_column(
+    data_type{type_id::UINT32}, indices->size(), mask_state::UNALLOCATED, stream, mr);
+  auto d_indices = column_device_view::create(indices->view(), stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(indices->size()),
+    remapped->mutable_view().begin<uint32_t>(),
+    [d_indices = *d_indices, key_positions = key_positions.data<uint32_t>()] __device__(
+      size_type idx) {
+      return d_indices.is_valid(idx) ? key_positions[d_indices.element<uint32_t>(idx)]
+                                     : uint32_t{0};
+    });
+
+  auto const null_count = indices->null_count();
+  auto keys = std::move(encoded->release().children[dictionary_column_view::keys_column_index]);
+  return make_dictionary_column(
+    std::move(keys), std::move(remapped), std::move(*indices->release().null_mask), null_count);
+}
+
+/**
+ * @brief Finds the rows selected by the result of a filter, and the ranges of rows that hold some
+ * of them
+ *
+ * @param filter_result Boolean result of the filter; null rows are not selected
+ * @param row_ranges Ranges `[first, second)` of rows
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The indices of the selected rows, and whether each range holds some of them
+ */
+std::pair<rmm::device_uvector<size_type>, std::vector<uint8_t>> select_filtered_rows(
+  column_view const &filter_result,
+  std::vector<thrust::pair<size_type, size_type>> const &row_ranges,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows    = filter_result.size();
+  auto const d_result    = column_device_view::create(filter_result, stream);
+  auto const is_selected = cudf::detail::make_counting_transform_iterator(
+    0, [d_result = *d_result] __device__(size_type row) {
+      return static_cast<size_type>(d_result.is_valid(row) && d_result.element<bool>(row));
+    });
+
+  // number of selected rows before each row
+  rmm::device_uvector<size_type> counts(num_rows + 1, stream);
+  counts.set_element_to_zero_async(0, stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), is_selected, is_selected + num_rows, counts.begin() + 1);
+
+  rmm::device_uvector<size_type> selected_rows(counts.back_element(stream), stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  selected_rows.begin(),
+                  [counts = counts.data()] __device__(size_type row) {
+                    return counts[row + 1] > counts[row];
+                  });
+
+  auto const d_ranges = cudf::detail::make_device_uvector_async(row_ranges, stream);
+  rmm::device_uvector<uint8_t> holds_selected(row_ranges.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    d_ranges.begin(),
+                    d_ranges.end(),
+                    holds_selected.begin(),
+                    [counts = counts.data()] __device__(auto const &range) {
+                      return static_cast<uint8_t>(counts[range.second] > counts[range.first]);
+                    });
+  return {std::move(selected_rows), cudf::detail::make_std_vector_sync(holds_selected, stream)};
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string> &path_in_schema)
@@ -297,20 +414,25 @@ struct metadata : public FileMetaData {
 };
 
 class aggregate_metadata {
-  std::vector<metadata> const per_file_metadata;
+  std::vector<std::shared_ptr<metadata const>> const per_file_metadata;
   std::map<std::string, std::string> const agg_keyval_map;
   size_type const num_rows;
   size_type const num_row_groups;
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * The footers of the sources with a file path are looked up in `cache`, if any.
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources)
+  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources,
+                              std::vector<std::string> const &filepaths,
+                              metadata_cache *cache)
   {
-    std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const &source) {
-        return metadata(source.get());
-      });
+    std::vector<std::shared_ptr<metadata const>> metadatas;
+    for (size_t i = 0; i < sources.size(); ++i) {
+      auto const &filepath = (i < filepaths.size()) ? filepaths[i] : std::string{};
+      metadatas.push_back(get_cached_metadata<metadata>(
+        cache, filepath, "parquet", [&]() { return metadata(sources[i].get()); }));
+    }
     return metadatas;
   }
 
@@ -322,7 +444,7 @@ class aggregate_metadata {
     std::map<std::string, std::string> merged;
     // merge key/value maps TODO: warn/throw if there are mismatches?
     for (auto const &pfm : per_file_metadata) {
-      for (auto const &kv : pfm.key_value_metadata) { merged[kv.key] = kv.value; }
+      for (auto const &kv : pfm->key_value_metadata) { merged[kv.key] = kv.value; }
     }
     return merged;
   }
@@ -334,7 +456,7 @@ class aggregate_metadata {
   {
     return std::accumulate(
       per_file_metadata.begin(), per_file_metadata.end(), 0, [](auto &sum, auto &pfm) {
-        return sum + pfm.num_rows;
+        return sum + pfm->num_rows;
       });
   }
 
@@ -345,13 +467,15 @@ class aggregate_metadata {
   {
     return std::accumulate(
       per_file_metadata.begin(), per_file_metadata.end(), 0, [](auto &sum, auto &pfm) {
-        return sum + pfm.row_groups.size();
+        return sum + pfm->row_groups.size();
       });
   }
 
  public:
-  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources,
+                     std::vector<std::string> const &filepaths = {},
+                     metadata_cache *cache                     = nullptr)
+    : per_file_metadata(metadatas_from_sources(sources, filepaths, cache)),
       agg_keyval_map(merge_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups())
@@ -359,17 +483,17 @@ class aggregate_metadata {
     // Verify that the input files have matching numbers of columns
     size_type num_cols = -1;
     for (auto const &pfm : per_file_metadata) {
-      if (pfm.row_groups.size() != 0) {
+      if (pfm->row_groups.size() != 0) {
         if (num_cols == -1)
-          num_cols = pfm.row_groups[0].columns.size();
+          num_cols = pfm->row_groups[0].columns.size();
         else
-          CUDF_EXPECTS(num_cols == static_cast<size_type>(pfm.row_groups[0].columns.size()),
+          CUDF_EXPECTS(num_cols == static_cast<size_type>(pfm->row_groups[0].columns.size()),
                        "All sources must have the same number of columns");
       }
     }
     // Verify that the input files have matching schemas
     for (auto const &pfm : per_file_metadata) {
-      CUDF_EXPECTS(per_file_metadata[0].schema == pfm.schema,
+      CUDF_EXPECTS(per_file_metadata[0]->schema == pfm->schema,
                    "All sources must have the same schemas");
     }
   }
@@ -378,7 +502,7 @@ class aggregate_metadata {
   {
     CUDF_EXPECTS(src_idx >= 0 && src_idx < static_cast<size_type>(per_file_metadata.size()),
                  "invalid source index");
-    return per_file_metadata[src_idx].row_groups[row_group_index];
+    return per_file_metadata[src_idx]->row_groups[row_group_index];
   }
 
   auto const &get_column_metadata(size_type row_group_index,
@@ -386,22 +510,67 @@ class aggregate_metadata {
                                   int schema_idx) const
   {
     auto col = std::find_if(
-      per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
-      per_file_metadata[src_idx].row_groups[row_group_index].columns.end(),
+      per_file_metadata[src_idx]->row_groups[row_group_index].columns.begin(),
+      per_file_metadata[src_idx]->row_groups[row_group_index].columns.end(),
       [schema_idx](ColumnChunk const &col) { return col.schema_idx == schema_idx ? true : false; });
-    CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
+    CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx]->row_groups[row_group_index].columns),
                  "Found no metadata for schema index");
     return col->meta_data;
   }
 
+  /**
+   * @brief Estimates the decoded size of the given columns of a row group
+   *
+   * Uses the uncompressed size of the column chunks as recorded in the footer.
+   *
+   * @param rg Row group to estimate
+   * @param input_columns Input columns that will be decoded
+   *
+   * @return Estimated size of the decoded columns, in bytes
+   */
+  size_t get_row_group_output_size(row_group_info const &rg,
+                                   std::vector<input_column_info> const &input_columns) const
+  {
+    return std::accumulate(
+      input_columns.cbegin(), input_columns.cend(), size_t{0}, [&](size_t sum, auto const &col) {
+        auto const &col_meta = get_column_metadata(rg.index, rg.source_index, col.schema_idx);
+        return sum + static_cast<size_t>(col_meta.total_uncompressed_size);
+      });
+  }
+
   auto get_num_rows() const { return num_rows; }
 
   auto get_num_row_groups() const { return num_row_groups; }
 
-  auto const &get_schema(int schema_idx) const { return per_file_metadata[0].schema[schema_idx]; }
+  auto const &get_schema(int schema_idx) const { return per_file_metadata[0]->schema[schema_idx]; }
 
   auto const &get_key_value_metadata() const { return agg_keyval_map; }
 
+  /**
+   * @brief Returns the number of rows of each row group, in the order of the sources
+   */
+  std::vector<size_type> get_row_group_num_rows() const
+  {
+    std::vector<size_type> rg_num_rows;
+    for (auto const &pfm : per_file_metadata) {
+      for (auto const &rg : pfm->row_groups) { rg_num_rows.push_back(rg.num_rows); }
+    }
+    return rg_num_rows;
+  }
+
+  /**
+   * @brief Returns the names of the top-level columns
+   */
+  std::vector<std::string> get_column_names() const
+  {
+    std::vector<std::string> names;
+    auto const &schema = per_file_metadata[0]->schema;
+    for (size_t schema_idx = 1; schema_idx < schema.size(); schema_idx++) {
+      if (schema[schema_idx].parent_idx == 0) { names.push_back(schema[schema_idx].name); }
+    }
+    return names;
+  }
+
   /**
    * @brief Gets the concrete nesting depth of output cudf columns
    *
@@ -416,8 +585,8 @@ class aggregate_metadata {
 
     // walk upwards, skipping repeated fields
     while (schema_index > 0) {
-      if (!pfm.schema[schema_index].is_stub()) { depth++; }
-      schema_index = pfm.schema[schema_index].parent_idx;
+      if (!pfm->schema[schema_index].is_stub()) { depth++; }
+      schema_index = pfm->schema[schema_index].parent_idx;
     }
     return depth;
   }
@@ -480,16 +649,6 @@ class aggregate_metadata {
     }
   }
 
-  struct row_group_info {
-    size_type const index;
-    size_t const start_row;  // TODO source index
-    size_type const source_index;
-    row_group_info(size_type index, size_t start_row, size_type source_index)
-      : index(index), start_row(start_row), source_index(source_index)
-    {
-    }
-  };
-
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
@@ -513,7 +672,7 @@ class aggregate_metadata {
         for (auto const &rowgroup_idx : row_groups[src_idx]) {
           CUDF_EXPECTS(
             rowgroup_idx >= 0 &&
-              rowgroup_idx < static_cast<size_type>(per_file_metadata[src_idx].row_groups.size()),
+              rowgroup_idx < static_cast<size_type>(per_file_metadata[src_idx]->row_groups.size()),
             "Invalid rowgroup index");
           selection.emplace_back(rowgroup_idx, row_count, src_idx);
           row_count += get_row_group(rowgroup_idx, src_idx).num_rows;
@@ -534,7 +693,7 @@ class aggregate_metadata {
     std::vector<row_group_info> selection;
     size_type count = 0;
     for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
-      for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx].row_groups.size(); ++rg_idx) {
+      for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx]->row_groups.size(); ++rg_idx) {
         auto const chunk_start_row = count;
         count += get_row_group(rg_idx, src_idx).num_rows;
         if (count > row_start || count == 0) {
@@ -658,8 +817,8 @@ class aggregate_metadata {
     std::vector<int> output_column_schemas;
     if (use_names.empty()) {
       // walk the schema and choose all top level columns
-      for (size_t schema_idx = 1; schema_idx < pfm.schema.size(); schema_idx++) {
-        auto const &schema = pfm.schema[schema_idx];
+      for (size_t schema_idx = 1; schema_idx < pfm->schema.size(); schema_idx++) {
+        auto const &schema = pfm->schema[schema_idx];
         if (schema.parent_idx == 0) { output_column_schemas.push_back(schema_idx); }
       }
     } else {
@@ -667,8 +826,8 @@ class aggregate_metadata {
       std::vector<std::string> local_use_names = use_names;
       if (include_index) { add_pandas_index_names(local_use_names); }
       for (const auto &use_name : local_use_names) {
-        for (size_t schema_idx = 1; schema_idx < pfm.schema.size(); schema_idx++) {
-          auto const &schema = pfm.schema[schema_idx];
+        for (size_t schema_idx = 1; schema_idx < pfm->schema.size(); schema_idx++) {
+          auto const &schema = pfm->schema[schema_idx];
           // We select only top level columns by name. Selecting nested columns by name is not
           // supported. Top level columns are identified by their parent being the root (idx == 0)
           if (use_name == schema.name and schema.parent_idx == 0) {
@@ -828,9 +987,17 @@ void reader::impl::read_column_chunks(
   size_t end_chunk,
   const std::vector<size_t> &column_chunk_offsets,
   std::vector<size_type> const &chunk_source_map,
+  std::vector<std::mutex> &source_mutexes,
   rmm::cuda_stream_view stream)
 {
-  // Transfer chunk data, coalescing adjacent chunks
+  // Coalesce adjacent chunks into reads, grouped by source
+  struct chunk_range {
+    size_t offset;
+    size_t size;
+    size_t begin_chunk;
+    size_t end_chunk;
+  };
+  std::vector<std::vector<chunk_range>> source_reads(_sources.size());
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
     const size_t io_offset   = column_chunk_offsets[chunk];
     size_t io_size           = chunks[chunk].compressed_size;
@@ -840,7 +1007,8 @@ void reader::impl::read_column_chunks(
       const size_t next_offset = column_chunk_offsets[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+          chunk_source_map[next_chunk] != chunk_source_map[chunk]) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
@@ -850,25 +1018,152 @@ void reader::impl::read_column_chunks(
       next_chunk++;
     }
     if (io_size != 0) {
-      auto &source = _sources[chunk_source_map[chunk]];
-      if (source->is_device_read_preferred(io_size)) {
-        page_data[chunk] = source->device_read(io_offset, io_size, stream);
+      source_reads[chunk_source_map[chunk]].push_back({io_offset, io_size, chunk, next_chunk});
+    }
+    chunk = next_chunk;
+  }
+
+  // Within a source, all reads are submitted upfront to a prefetching decorator, which fetches
+  // them concurrently if the source supports it
+  for (size_t src_idx = 0; src_idx < source_reads.size(); ++src_idx) {
+    if (source_reads[src_idx].empty()) { continue; }
+    // Other batches of the same source may be read concurrently; the lock is declared before the
+    // decorator so that its prefetches are complete when the source is released
+    std::unique_lock<std::mutex> source_lock(source_mutexes[src_idx], std::defer_lock);
+    if (not _sources[src_idx]->supports_concurrent_reads()) { source_lock.lock(); }
+    async_prefetch_datasource source(_sources[src_idx].get());
+    std::vector<async_prefetch_datasource::byte_range> ranges;
+    for (auto const &read : source_reads[src_idx]) {
+      ranges.push_back({read.offset, read.size});
+    }
+    source.prefetch(ranges, stream);
+
+    for (auto const &read : source_reads[src_idx]) {
+      auto &buffer = page_data[read.begin_chunk];
+      if (source.is_device_read_preferred(read.size)) {
+        buffer = source.device_read(read.offset, read.size, stream);
       } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), stream));
+        auto const host_buffer = source.host_read(read.offset, read.size);
+        buffer                 = datasource::buffer::create(
+          rmm::device_buffer(host_buffer->data(), host_buffer->size(), stream));
+        // Prefetched data is in pinned memory, so the copy must complete before it's released
+        stream.synchronize();
       }
-      auto d_compdata = page_data[chunk]->data();
-      do {
+      auto d_compdata = buffer->data();
+      for (size_t chunk = read.begin_chunk; chunk < read.end_chunk; ++chunk) {
         chunks[chunk].compressed_data = d_compdata;
         d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
-    } else {
-      chunk = next_chunk;
+      }
     }
   }
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::read_and_decompress_chunks
+ */
+void reader::impl::read_and_decompress_chunks(
+  std::vector<std::unique_ptr<datasource::buffer>> &page_data,
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  hostdevice_vector<gpu::PageInfo> &pages,
+  std::vector<rmm::device_buffer> &decomp_page_data,
+  std::vector<size_t> const &batch_offsets,
+  std::vector<size_t> const &column_chunk_offsets,
+  std::vector<size_type> const &chunk_source_map,
+  io_statistics *stats,
+  rmm::cuda_stream_view stream)
+{
+  constexpr size_t max_concurrent_reads = 8;
+
+  auto const num_batches = batch_offsets.size() - 1;
+  if (num_batches == 0) { return; }
+
+  // The batches are read in order on a bounded pool, ahead of their decompression. Declared
+  // after the buffers and mutexes the tasks use, so that all tasks are complete when they are
+  // destroyed.
+  std::vector<std::mutex> source_mutexes(_sources.size());
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  thread_pool pool(std::min(num_batches, max_concurrent_reads));
+  std::vector<std::future<void>> reads;
+  for (size_t b = 0; b < num_batches; ++b) {
+    reads.emplace_back(pool.submit([&, b]() {
+      CUDA_TRY(cudaSetDevice(device_id));
+      read_column_chunks(page_data,
+                         chunks,
+                         batch_offsets[b],
+                         batch_offsets[b + 1],
+                         column_chunk_offsets,
+                         chunk_source_map,
+                         source_mutexes,
+                         stream);
+    }));
+  }
+
+  // Decodes the page headers and decompresses the pages of each batch as soon as it is read,
+  // while the following batches are still being read
+  std::vector<hostdevice_vector<gpu::PageInfo>> batch_pages(num_batches);
+  size_t total_pages = 0;
+  for (size_t b = 0; b < num_batches; ++b) {
+    auto const begin_chunk = batch_offsets[b];
+    auto const end_chunk   = batch_offsets[b + 1];
+    time_phase(stats, io_phase::READ, stream, [&]() { reads[b].get(); });
+
+    hostdevice_vector<gpu::ColumnChunkDesc> batch_chunks(0, end_chunk - begin_chunk, stream);
+    for (size_t c = begin_chunk; c < end_chunk; ++c) { batch_chunks.insert(chunks[c]); }
+    auto const num_pages = count_page_headers(batch_chunks, stream);
+    if (num_pages == 0) { continue; }
+    batch_pages[b] = hostdevice_vector<gpu::PageInfo>(num_pages, num_pages, stream);
+    decode_page_headers(batch_chunks, batch_pages[b], stream);
+
+    size_t compressed_size   = 0;
+    size_t decompressed_size = 0;
+    for (size_t c = 0, page_count = 0; c < batch_chunks.size(); ++c) {
+      auto const &chunk = batch_chunks[c];
+      if (chunk.codec != parquet::Compression::UNCOMPRESSED) {
+        compressed_size += chunk.compressed_size;
+        for (int k = 0; k < chunk.max_num_pages; ++k) {
+          decompressed_size += batch_pages[b][page_count + k].uncompressed_page_size;
+        }
+      }
+      page_count += chunk.max_num_pages;
+    }
+    if (compressed_size > 0) {
+      decomp_page_data.emplace_back(time_phase(stats, io_phase::DECOMPRESS, stream, [&]() {
+        return decompress_page_data(batch_chunks, batch_pages[b], stream);
+      }));
+      add_phase_bytes(stats, io_phase::DECOMPRESS, compressed_size, decompressed_size);
+      // The decompression is complete, so the compressed data can be freed
+      for (size_t c = begin_chunk; c < end_chunk; ++c) {
+        if (chunks[c].codec != parquet::Compression::UNCOMPRESSED) { page_data[c].reset(); }
+      }
+    }
+
+    for (size_t c = begin_chunk; c < end_chunk; ++c) {
+      chunks[c].num_data_pages = batch_chunks[c - begin_chunk].num_data_pages;
+      chunks[c].num_dict_pages = batch_chunks[c - begin_chunk].num_dict_pages;
+    }
+    total_pages += num_pages;
+  }
+  if (total_pages == 0) { return; }
+
+  // Gather the pages of all batches, in chunk order, for the decoding of the whole table
+  pages = hostdevice_vector<gpu::PageInfo>(total_pages, total_pages, stream);
+  for (size_t b = 0, page_count = 0; b < num_batches; ++b) {
+    for (size_t p = 0; p < batch_pages[b].size(); ++p) {
+      pages[page_count + p] = batch_pages[b][p];
+      pages[page_count + p].chunk_idx += static_cast<int32_t>(batch_offsets[b]);
+    }
+    page_count += batch_pages[b].size();
+  }
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    chunks[c].max_num_pages = chunks[c].num_data_pages + chunks[c].num_dict_pages;
+    chunks[c].page_info     = pages.device_ptr(page_count);
+    page_count += chunks[c].max_num_pages;
+  }
+  chunks.host_to_device(stream);
+  pages.host_to_device(stream);
+}
+
 /**
  * @copydoc cudf::io::detail::parquet::count_page_headers
  */
@@ -926,15 +1221,20 @@ rmm::device_buffer reader::impl::decompress_page_data(
     }
   };
 
-  // Brotli scratch memory for decompressing
+  // Brotli and ZSTD scratch memory for decompressing
   rmm::device_buffer debrotli_scratch;
+  rmm::device_buffer unzstd_scratch;
 
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
-                                                                std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+  std::array<std::pair<parquet::Compression, size_t>, 6> codecs{
+    std::make_pair(parquet::GZIP, 0),
+    std::make_pair(parquet::SNAPPY, 0),
+    std::make_pair(parquet::BROTLI, 0),
+    std::make_pair(parquet::ZSTD, 0),
+    std::make_pair(parquet::LZ4, 0),
+    std::make_pair(parquet::LZ4_RAW, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
@@ -945,6 +1245,9 @@ rmm::device_buffer reader::impl::decompress_page_data(
     if (codec.first == parquet::BROTLI && codec.second > 0) {
       debrotli_scratch.resize(get_gpu_debrotli_scratch_size(codec.second), stream);
     }
+    if (codec.first == parquet::ZSTD && codec.second > 0) {
+      unzstd_scratch.resize(get_gpu_unzstd_scratch_size(codec.second), stream);
+    }
   }
 
   // Dispatch batches of pages to decompress for each codec
@@ -959,20 +1262,32 @@ rmm::device_buffer reader::impl::decompress_page_data(
       int32_t start_pos = argc;
 
       for_each_codec_page(codec.first, [&](size_t page) {
-        auto dst_base              = static_cast<uint8_t *>(decomp_pages.data());
-        inflate_in[argc].srcDevice = pages[page].page_data;
-        inflate_in[argc].srcSize   = pages[page].compressed_page_size;
-        inflate_in[argc].dstDevice = dst_base + decomp_offset;
-        inflate_in[argc].dstSize   = pages[page].uncompressed_page_size;
-
-        inflate_out[argc].bytes_written = 0;
-        inflate_out[argc].status        = static_cast<uint32_t>(-1000);
-        inflate_out[argc].reserved      = 0;
-
-        pages[page].page_data = static_cast<uint8_t *>(inflate_in[argc].dstDevice);
-        decomp_offset += inflate_in[argc].dstSize;
-        argc++;
+        auto const dst = static_cast<uint8_t *>(decomp_pages.data()) + decomp_offset;
+        auto &pg       = pages[page];
+        // V2 pages only compress the values; the levels are copied as they are
+        size_t const lvl_bytes = (pg.flags & gpu::PAGEINFO_FLAGS_UNCOMPRESSED)
+                                   ? pg.uncompressed_page_size
+                                   : pg.def_lvl_bytes + pg.rep_lvl_bytes;
+        if (lvl_bytes != 0) {
+          CUDA_TRY(cudaMemcpyAsync(
+            dst, pg.page_data, lvl_bytes, cudaMemcpyDeviceToDevice, stream.value()));
+        }
+        if (lvl_bytes < static_cast<size_t>(pg.uncompressed_page_size)) {
+          inflate_in[argc].srcDevice = pg.page_data + lvl_bytes;
+          inflate_in[argc].srcSize   = pg.compressed_page_size - lvl_bytes;
+          inflate_in[argc].dstDevice = dst + lvl_bytes;
+          inflate_in[argc].dstSize   = pg.uncompressed_page_size - lvl_bytes;
+
+          inflate_out[argc].bytes_written = 0;
+          inflate_out[argc].status        = static_cast<uint32_t>(-1000);
+          inflate_out[argc].reserved      = 0;
+          argc++;
+        }
+
+        pg.page_data = dst;
+        decomp_offset += pg.uncompressed_page_size;
       });
+      if (argc == start_pos) { continue; }
 
       CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(start_pos),
                                inflate_in.host_ptr(start_pos),
@@ -1006,6 +1321,22 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 argc - start_pos,
                                 stream));
           break;
+        case parquet::LZ4:
+        case parquet::LZ4_RAW:
+          CUDA_TRY(gpu_unlz4(inflate_in.device_ptr(start_pos),
+                             inflate_out.device_ptr(start_pos),
+                             argc - start_pos,
+                             codec.first == parquet::LZ4,
+                             stream));
+          break;
+        case parquet::ZSTD:
+          CUDA_TRY(gpu_unzstd(inflate_in.device_ptr(start_pos),
+                              inflate_out.device_ptr(start_pos),
+                              unzstd_scratch.data(),
+                              unzstd_scratch.size(),
+                              argc - start_pos,
+                              stream));
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
@@ -1024,6 +1355,60 @@ rmm::device_buffer reader::impl::decompress_page_data(
   return decomp_pages;
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::select_dictionary_columns
+ */
+void reader::impl::select_dictionary_columns(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                             hostdevice_vector<gpu::PageInfo> const &pages)
+{
+  _dictionary_columns.assign(_input_columns.size(), false);
+  _dictionary_keys.clear();
+  _dictionary_keys.resize(_input_columns.size());
+  if (not _output_dictionary_strings) { return; }
+
+  for (size_t i = 0; i < _input_columns.size(); ++i) {
+    auto const &input_col = _input_columns[i];
+    _dictionary_columns[i] =
+      input_col.nesting_depth() == 1 &&
+      _output_columns[input_col.nesting[0]].type.id() == type_id::STRING;
+  }
+
+  // the dictionary pages come first in each chunk, followed by its data pages
+  auto is_dictionary_encoded = [](gpu::PageInfo const &page) {
+    return page.encoding == Encoding::PLAIN_DICTIONARY ||
+           page.encoding == Encoding::RLE_DICTIONARY;
+  };
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    auto const &chunk = chunks[c];
+    if ((chunk.data_type & 0x7) != BYTE_ARRAY || chunk.num_dict_pages == 0 ||
+        !std::all_of(pages.host_ptr(page_count + chunk.num_dict_pages),
+                     pages.host_ptr(page_count + chunk.max_num_pages),
+                     is_dictionary_encoded)) {
+      _dictionary_columns[chunk.src_col_index] = false;
+    }
+    page_count += chunk.max_num_pages;
+  }
+
+  // the chunks of a column index its keys in the order of the row groups
+  std::vector<uint32_t> num_keys(_input_columns.size(), 0);
+  for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+    auto &chunk = chunks[c];
+    if (_dictionary_columns[chunk.src_col_index]) {
+      chunk.data_type         = static_cast<uint16_t>(BYTE_ARRAY | (sizeof(uint32_t) << 3));
+      chunk.output_dict_index = true;
+      chunk.dict_key_offset   = num_keys[chunk.src_col_index];
+      num_keys[chunk.src_col_index] += pages[page_count].num_input_values;
+    }
+    page_count += chunk.max_num_pages;
+  }
+
+  for (size_t i = 0; i < _input_columns.size(); ++i) {
+    if (_dictionary_columns[i]) {
+      _output_columns[_input_columns[i].nesting[0]].type = data_type{type_id::UINT32};
+    }
+  }
+}
+
 /**
  * @copydoc cudf::io::detail::parquet::allocate_nesting_info
  */
@@ -1304,6 +1689,31 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
     gpu::BuildStringDictionaryIndex(chunks.device_ptr(), chunks.size(), stream);
   }
 
+  // Gather the dictionary entries of all the chunks of each column decoded as dictionary indices,
+  // while the page data they point to is still around
+  for (size_t i = 0; i < _input_columns.size(); ++i) {
+    if (not _dictionary_columns[i]) { continue; }
+    size_t num_entries = 0;
+    for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+      if (chunks[c].src_col_index == static_cast<int32_t>(i)) {
+        num_entries += pages[page_count].num_input_values;
+      }
+      page_count += chunks[c].max_num_pages;
+    }
+    rmm::device_uvector<string_index_pair> entries(num_entries, stream);
+    for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+      if (chunks[c].src_col_index == static_cast<int32_t>(i)) {
+        CUDA_TRY(cudaMemcpyAsync(entries.data() + chunks[c].dict_key_offset,
+                                 chunks[c].str_dict_index,
+                                 pages[page_count].num_input_values * sizeof(string_index_pair),
+                                 cudaMemcpyDeviceToDevice,
+                                 stream.value()));
+      }
+      page_count += chunks[c].max_num_pages;
+    }
+    _dictionary_keys[i] = make_strings_column(entries, stream);
+  }
+
   gpu::DecodePageData(pages, chunks, total_rows, min_row, stream);
   pages.device_to_host(stream);
   page_nesting.device_to_host(stream);
@@ -1345,7 +1755,7 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   // update null counts in the final column buffers
   for (size_t idx = 0; idx < pages.size(); idx++) {
     gpu::PageInfo *pi = &pages[idx];
-    if (pi->flags & gpu::PAGEINFO_FLAGS_DICTIONARY) { continue; }
+    if (pi->flags & (gpu::PAGEINFO_FLAGS_DICTIONARY | gpu::PAGEINFO_FLAGS_SKIP)) { continue; }
     gpu::ColumnChunkDesc *col          = &chunks[pi->chunk_idx];
     input_column_info const &input_col = _input_columns[col->src_col_index];
 
@@ -1368,13 +1778,130 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   stream.synchronize();
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::decode_filtered_columns
+ */
+std::vector<std::unique_ptr<column>> reader::impl::decode_filtered_columns(
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  hostdevice_vector<gpu::PageInfo> &pages,
+  hostdevice_vector<gpu::PageNestingInfo> &page_nesting,
+  size_t min_row,
+  size_t total_rows,
+  std::vector<column_name_info> &schema_info,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_columns = _output_columns.size();
+  std::vector<bool> is_filter_column(num_columns, false);
+  for (auto const col_idx : get_referenced_columns(_filter->get())) {
+    CUDF_EXPECTS(col_idx >= 0 && static_cast<size_t>(col_idx) < num_columns,
+                 "Filter references a column that is not read");
+    is_filter_column[col_idx] = true;
+  }
+  auto is_filter_page = [&](gpu::PageInfo const &page) {
+    return is_filter_column[_input_columns[chunks[page.chunk_idx].src_col_index].nesting[0]];
+  };
+
+  // Decode the columns referenced by the filter first
+  for (size_t idx = 0; idx < pages.size(); idx++) {
+    if (not is_filter_page(pages[idx])) { pages[idx].flags |= gpu::PAGEINFO_FLAGS_SKIP; }
+  }
+  pages.host_to_device(stream);
+  decode_page_data(chunks, pages, page_nesting, min_row, total_rows, stream);
+
+  // The filter doesn't reference the columns that are not decoded yet, so they are left empty
+  std::vector<std::unique_ptr<column>> columns(num_columns);
+  std::vector<column_view> filter_views;
+  for (size_t i = 0; i < num_columns; ++i) {
+    if (is_filter_column[i]) {
+      columns[i] = make_output_column(i, &schema_info[i], stream);
+      filter_views.push_back(columns[i]->view());
+    } else {
+      filter_views.emplace_back(
+        data_type{type_id::EMPTY}, static_cast<size_type>(total_rows), nullptr);
+    }
+  }
+  auto const filter_result =
+    cudf::ast::detail::compute_column(table_view{filter_views}, _filter->get(), stream);
+  CUDF_EXPECTS(filter_result->type().id() == type_id::BOOL8,
+               "The filter must produce boolean values");
+
+  // Output rows of the data pages of the other columns. Pages of flat schemas map to the rows
+  // starting at the start of their chunk plus their chunk_row.
+  std::vector<size_t> other_pages;
+  std::vector<thrust::pair<size_type, size_type>> page_rows;
+  for (size_t idx = 0; idx < pages.size(); idx++) {
+    auto const &page = pages[idx];
+    if ((page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY) || is_filter_page(page)) { continue; }
+    auto const page_begin = chunks[page.chunk_idx].start_row + page.chunk_row;
+    auto const page_end   = page_begin + page.num_rows;
+    auto const first      = std::clamp(page_begin, min_row, min_row + total_rows) - min_row;
+    auto const last       = std::clamp(page_end, min_row, min_row + total_rows) - min_row;
+    other_pages.push_back(idx);
+    page_rows.emplace_back(static_cast<size_type>(first), static_cast<size_type>(last));
+  }
+  auto [selected_rows, holds_selected] =
+    select_filtered_rows(filter_result->view(), page_rows, stream);
+
+  // Decode the pages of the other columns holding selected rows. The output buffers of these
+  // columns are still initialized where pages are skipped: strings and null masks with nulls,
+  // and dictionary indices with zeros, so that only the selected rows need to be valid.
+  for (size_t idx = 0; idx < pages.size(); idx++) {
+    if (is_filter_page(pages[idx])) { pages[idx].flags |= gpu::PAGEINFO_FLAGS_SKIP; }
+  }
+  for (size_t p = 0; p < other_pages.size(); p++) {
+    if (holds_selected[p]) { pages[other_pages[p]].flags &= ~gpu::PAGEINFO_FLAGS_SKIP; }
+  }
+  pages.host_to_device(stream);
+  for (size_t i = 0; i < _input_columns.size(); ++i) {
+    auto &out_buf = _output_columns[_input_columns[i].nesting[0]];
+    if (_dictionary_columns[i] && not is_filter_column[_input_columns[i].nesting[0]]) {
+      CUDA_TRY(cudaMemsetAsync(out_buf.data(), 0, out_buf.data_size(), stream.value()));
+    }
+  }
+  decode_page_data(chunks, pages, page_nesting, min_row, total_rows, stream);
+
+  std::vector<column_view> views(num_columns);
+  for (size_t i = 0; i < num_columns; ++i) {
+    if (not is_filter_column[i]) { columns[i] = make_output_column(i, &schema_info[i], stream); }
+    views[i] = columns[i]->view();
+  }
+  auto const gather_map = column_view{
+    data_type{type_id::INT32}, static_cast<size_type>(selected_rows.size()), selected_rows.data()};
+  return cudf::detail::gather(table_view{views},
+                              gather_map,
+                              out_of_bounds_policy::DONT_CHECK,
+                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              _mr)
+    ->release();
+}
+
+/**
+ * @copydoc cudf::io::detail::parquet::make_output_column
+ */
+std::unique_ptr<column> reader::impl::make_output_column(size_t idx,
+                                                         column_name_info *schema_info,
+                                                         rmm::cuda_stream_view stream)
+{
+  auto out_column = make_column(_output_columns[idx], schema_info, stream, _mr);
+  for (size_t i = 0; i < _input_columns.size(); ++i) {
+    if (_dictionary_columns[i] && static_cast<size_t>(_input_columns[i].nesting[0]) == idx) {
+      return make_dictionary_output(
+        std::move(out_column), std::move(_dictionary_keys[i]), stream, _mr);
+    }
+  }
+  return out_column;
+}
+
 reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                   std::vector<std::string> const &filepaths,
                    parquet_reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr), _sources(std::move(sources))
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_metadata>(_sources);
+  // Open and parse the source dataset metadata, unless it is cached
+  _metadata =
+    std::make_unique<aggregate_metadata>(_sources, filepaths, options.get_metadata_cache().get());
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -1383,13 +1910,28 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
 
   _strict_decimal_types = options.is_enabled_strict_decimal_types();
 
+  _io_statistics = options.is_enabled_io_statistics();
+
+  _filter      = options.get_filter();
+  _filter_rows = options.is_enabled_filter_rows();
+
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
 
+  // Dictionary-encoded strings may be returned as dictionary columns
+  _output_dictionary_strings = options.is_enabled_output_dictionary_strings();
+
   // Select only columns required by the options
+  _use_names           = options.get_columns();
+  _use_pandas_metadata = options.is_enabled_use_pandas_metadata();
+  select_columns();
+}
+
+void reader::impl::select_columns()
+{
   std::tie(_input_columns, _output_columns, _output_column_schemas) =
-    _metadata->select_columns(options.get_columns(),
-                              options.is_enabled_use_pandas_metadata(),
+    _metadata->select_columns(_use_names,
+                              _use_pandas_metadata,
                               _strings_to_categorical,
                               _timestamp_type.id(),
                               _strict_decimal_types);
@@ -1401,10 +1943,235 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                        rmm::cuda_stream_view stream)
 {
   // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  auto selected_row_groups = _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  filter_row_groups(selected_row_groups, skip_rows, num_rows, stream);
+
+  return read_row_groups(selected_row_groups, skip_rows, num_rows, stream);
+}
+
+memory_estimate reader::impl::estimate_memory(
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const &row_group_list,
+  rmm::cuda_stream_view stream)
+{
+  auto selected_row_groups = _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  filter_row_groups(selected_row_groups, skip_rows, num_rows, stream);
+
+  memory_estimate result;
+  for (auto const &col : _input_columns) {
+    auto const &schema = _metadata->get_schema(col.schema_idx);
+    auto const type    = data_type{
+      to_type_id(schema, _strings_to_categorical, _timestamp_type.id(), _strict_decimal_types)};
+    auto const value_size = is_fixed_width(type) ? size_of(type) : 0;
+    auto const depth      = col.nesting_depth();
+
+    // the data, null mask and offsets allocations of every nesting level are aligned to 256 bytes
+    result.output_bytes += depth * 3 * 256;
+    for (auto const &rg : selected_row_groups) {
+      auto const &col_meta =
+        _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
+      auto const compressed_size   = static_cast<size_t>(col_meta.total_compressed_size);
+      auto const uncompressed_size = static_cast<size_t>(col_meta.total_uncompressed_size);
+      auto const num_values        = static_cast<size_t>(col_meta.num_values);
+
+      // the column chunks are read to the device, then their pages are decompressed
+      result.temporary_bytes += compressed_size;
+      if (col_meta.codec != Compression::UNCOMPRESSED) {
+        result.temporary_bytes += uncompressed_size;
+      }
+
+      // decoded fixed-width values may be wider than encoded ones, and every nesting level has an
+      // offset and a null mask bit per value at most
+      result.output_bytes += std::max(uncompressed_size, num_values * value_size) +
+                             num_values * depth * (sizeof(size_type) + 1);
+    }
+  }
+  return result;
+}
+
+void reader::impl::filter_row_groups(std::vector<row_group_info> &row_groups,
+                                     size_type &skip_rows,
+                                     size_type &num_rows,
+                                     rmm::cuda_stream_view stream)
+{
+  if (!_filter.has_value() || row_groups.empty()) { return; }
+
+  // Gather the statistics of the flat output columns for each selected row group. Statistics are
+  // stored in the physical type, so they are only used where no conversion is applied on read.
+  auto const num_row_groups = static_cast<size_type>(row_groups.size());
+  std::vector<statistics_column> stats_columns(_output_columns.size());
+  for (size_t col_idx = 0; col_idx < _output_columns.size(); ++col_idx) {
+    auto const schema_idx = _output_column_schemas[col_idx];
+    auto const &schema    = _metadata->get_schema(schema_idx);
+    auto const type       = _output_columns[col_idx].type;
+    auto const physical   = schema.type;
+    bool const is_flat    = schema.num_children == 0 && schema.max_repetition_level == 0;
+    bool const is_decimal =
+      schema.converted_type == parquet::DECIMAL || schema.logical_type.isset.DECIMAL;
+    bool const is_physical_supported = physical == parquet::INT32 || physical == parquet::INT64 ||
+                                       physical == parquet::FLOAT || physical == parquet::DOUBLE;
+    bool const is_type_supported     = is_chrono(type)
+                                     ? _timestamp_type.id() == type_id::EMPTY
+                                     : is_numeric(type) && type.id() != type_id::BOOL8;
+    if (!is_flat || is_decimal || !is_physical_supported || !is_type_supported) { continue; }
+
+    auto &stats_col         = stats_columns[col_idx];
+    stats_col.type          = type;
+    stats_col.physical_type = physical;
+    stats_col.stats.resize(num_row_groups);
+    stats_col.has_stats.resize(num_row_groups, false);
+    for (size_type rg = 0; rg < num_row_groups; ++rg) {
+      auto const &blob =
+        _metadata
+          ->get_column_metadata(row_groups[rg].index, row_groups[rg].source_index, schema_idx)
+          .statistics_blob;
+      if (!blob.empty()) {
+        CompactProtocolReader cp(blob.data(), blob.size());
+        stats_col.has_stats[rg] = cp.read(&stats_col.stats[rg]);
+      }
+    }
+  }
+
+  auto keep = evaluate_statistics_filter(_filter->get(), stats_columns, num_row_groups, stream);
+
+  // Probe the bloom filters of the columns compared for equality, in the row groups the
+  // statistics couldn't reject. Values are hashed in the physical type, so the same conversions
+  // as with statistics are excluded, as well as the 8 and 16-bit unsigned types the writer
+  // sign-extends.
+  std::vector<bloom_filter_column> bloom_columns(_output_columns.size());
+  bool has_bloom_filters = false;
+  for (auto const col_idx : get_equality_columns(_filter->get())) {
+    if (col_idx < 0 || col_idx >= static_cast<size_type>(_output_columns.size()) ||
+        stats_columns[col_idx].type.id() == type_id::EMPTY) {
+      continue;
+    }
+    auto const type = stats_columns[col_idx].type;
+    if (type.id() == type_id::UINT8 || type.id() == type_id::UINT16) { continue; }
+
+    auto const schema_idx   = _output_column_schemas[col_idx];
+    auto &bloom_col         = bloom_columns[col_idx];
+    bloom_col.type          = type;
+    bloom_col.physical_type = stats_columns[col_idx].physical_type;
+    bloom_col.bitsets.resize(num_row_groups);
+    for (size_type rg = 0; rg < num_row_groups; ++rg) {
+      if (!keep[rg]) { continue; }
+      auto const &info = row_groups[rg];
+      auto const &meta = _metadata->get_column_metadata(info.index, info.source_index, schema_idx);
+      if (meta.bloom_filter_length <= 0) { continue; }
+      auto const buffer =
+        _sources[info.source_index]->host_read(meta.bloom_filter_offset, meta.bloom_filter_length);
+      BloomFilterHeader header;
+      CompactProtocolReader cp(buffer->data(), buffer->size());
+      if (!cp.read(&header) || header.num_bytes <= 0 ||
+          static_cast<uint32_t>(header.num_bytes) % gpu::bloom_filter_block_size != 0 ||
+          static_cast<size_t>(cp.bytecount() + header.num_bytes) > buffer->size()) {
+        continue;
+      }
+      auto const bitset = buffer->data() + cp.bytecount();
+      bloom_col.bitsets[rg].assign(bitset, bitset + header.num_bytes);
+      has_bloom_filters = true;
+    }
+  }
+  if (has_bloom_filters) {
+    auto const bloom_keep =
+      evaluate_bloom_filters(_filter->get(), bloom_columns, num_row_groups, stream);
+    for (size_type rg = 0; rg < num_row_groups; ++rg) {
+      keep[rg] = keep[rg] && bloom_keep[rg];
+    }
+  }
+
+  // Renumber the remaining row groups. Only the first and last row groups of the selection can
+  // be partially selected, so the selected rows of the remaining row groups stay contiguous.
+  auto const end_row = static_cast<size_t>(skip_rows) + num_rows;
+  std::vector<row_group_info> filtered;
+  size_t start_row      = 0;
+  size_t filtered_begin = 0;
+  size_t filtered_end   = 0;
+  for (size_type rg = 0; rg < num_row_groups; ++rg) {
+    if (!keep[rg]) { continue; }
+    auto const &info    = row_groups[rg];
+    auto const rg_rows  = _metadata->get_row_group(info.index, info.source_index).num_rows;
+    auto const rg_begin = std::max<size_t>(info.start_row, skip_rows);
+    auto const rg_end   = std::max(rg_begin, std::min<size_t>(info.start_row + rg_rows, end_row));
+    if (filtered.empty()) { filtered_begin = start_row + (rg_begin - info.start_row); }
+    filtered_end = start_row + (rg_end - info.start_row);
+    filtered.emplace_back(info.index, start_row, info.source_index);
+    start_row += rg_rows;
+  }
+
+  row_groups = std::move(filtered);
+  skip_rows  = static_cast<size_type>(filtered_begin);
+  num_rows   = static_cast<size_type>(filtered_end - filtered_begin);
+}
+
+void reader::impl::setup_chunking(size_t chunk_read_limit,
+                                  size_type skip_rows,
+                                  size_type num_rows,
+                                  std::vector<std::vector<size_type>> const &row_group_list,
+                                  rmm::cuda_stream_view stream)
+{
+  _chunked_row_groups = _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  filter_row_groups(_chunked_row_groups, skip_rows, num_rows, stream);
+  _chunk_read_info.clear();
+  _current_chunk = 0;
+
+  // Always return at least one (possibly empty) table
+  auto const end_row = static_cast<size_t>(skip_rows) + num_rows;
+  if (_chunked_row_groups.empty() || num_rows == 0) {
+    _chunk_read_info.push_back({0, _chunked_row_groups.size(), skip_rows, num_rows});
+    return;
+  }
+
+  // Greedily group consecutive row groups while the estimated output stays within the limit
+  size_t first_rg   = 0;
+  size_t chunk_size = 0;
+  auto add_chunk    = [&](size_t end_rg) {
+    auto const &last_rg   = _chunked_row_groups[end_rg - 1];
+    auto const last_rows  = _metadata->get_row_group(last_rg.index, last_rg.source_index).num_rows;
+    auto const chunk_skip = std::max<size_t>(skip_rows, _chunked_row_groups[first_rg].start_row);
+    auto const chunk_end  = std::min<size_t>(end_row, last_rg.start_row + last_rows);
+    _chunk_read_info.push_back({first_rg,
+                                end_rg - first_rg,
+                                static_cast<size_type>(chunk_skip),
+                                static_cast<size_type>(chunk_end - chunk_skip)});
+  };
+  for (size_t rg = 0; rg < _chunked_row_groups.size(); ++rg) {
+    auto const rg_size =
+      _metadata->get_row_group_output_size(_chunked_row_groups[rg], _input_columns);
+    if (chunk_read_limit > 0 && rg > first_rg && chunk_size + rg_size > chunk_read_limit) {
+      add_chunk(rg);
+      first_rg   = rg;
+      chunk_size = 0;
+    }
+    chunk_size += rg_size;
+  }
+  add_chunk(_chunked_row_groups.size());
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  auto const &chunk = _chunk_read_info[_current_chunk];
 
+  // Output buffers of the previous chunk have been released to its columns
+  if (_current_chunk > 0) { select_columns(); }
+  _current_chunk++;
+
+  auto const first = _chunked_row_groups.cbegin() + chunk.first_row_group;
+  std::vector<row_group_info> const row_groups(first, first + chunk.num_row_groups);
+  return read_row_groups(row_groups, chunk.skip_rows, chunk.num_rows, stream);
+}
+
+table_with_metadata reader::impl::read_row_groups(
+  std::vector<row_group_info> const &selected_row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  rmm::cuda_stream_view stream)
+{
   table_metadata out_metadata;
+  io_statistics statistics{};
+  auto const stats = _io_statistics ? &statistics : nullptr;
 
   // output cudf columns as determined by the top level schema
   std::vector<std::unique_ptr<column>> out_columns;
@@ -1428,15 +2195,26 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // if there are lists present, we need to preprocess
     bool has_lists = false;
 
+    // Chunks of consecutive row groups from the same source are read and decompressed in
+    // batches of about `pipeline_batch_size` compressed bytes
+    constexpr size_t pipeline_batch_size = 64 * 1024 * 1024;
+    std::vector<size_t> batch_offsets{0};
+    size_t batch_size = 0;
+
     // Initialize column chunk information
-    size_t total_decompressed_size = 0;
-    auto remaining_rows            = num_rows;
+    size_t total_compressed_size = 0;
+    auto remaining_rows          = num_rows;
     for (const auto &rg : selected_row_groups) {
       const auto &row_group       = _metadata->get_row_group(rg.index, rg.source_index);
       auto const row_group_start  = rg.start_row;
       auto const row_group_source = rg.source_index;
       auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
-      auto const io_chunk_idx     = chunks.size();
+      if (chunks.size() != batch_offsets.back() &&
+          (batch_size >= pipeline_batch_size ||
+           chunk_source_map[batch_offsets.back()] != row_group_source)) {
+        batch_offsets.push_back(chunks.size());
+        batch_size = 0;
+      }
 
       // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
       for (size_t i = 0; i < num_input_columns; ++i) {
@@ -1493,38 +2271,38 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         // Map each column chunk to its column index and its source index
         chunk_source_map[chunks.size() - 1] = row_group_source;
 
-        if (col_meta.codec != Compression::UNCOMPRESSED) {
-          total_decompressed_size += col_meta.total_uncompressed_size;
-        }
+        total_compressed_size += col_meta.total_compressed_size;
+        batch_size += col_meta.total_compressed_size;
       }
-      // Read compressed chunk data to device memory
-      read_column_chunks(page_data,
-                         chunks,
-                         io_chunk_idx,
-                         chunks.size(),
-                         column_chunk_offsets,
-                         chunk_source_map,
-                         stream);
-
       remaining_rows -= row_group.num_rows;
     }
     assert(remaining_rows <= 0);
+    if (chunks.size() != batch_offsets.back()) { batch_offsets.push_back(chunks.size()); }
+
+    // Read the compressed chunk data to device memory, and decode the page headers and decompress
+    // the pages while the data of the following batches is read
+    auto const decode_start = std::chrono::steady_clock::now();
+    hostdevice_vector<gpu::PageInfo> pages;
+    std::vector<rmm::device_buffer> decomp_page_data;
+    read_and_decompress_chunks(page_data,
+                               chunks,
+                               pages,
+                               decomp_page_data,
+                               batch_offsets,
+                               column_chunk_offsets,
+                               chunk_source_map,
+                               stats,
+                               stream);
+    add_phase_bytes(stats, io_phase::READ, total_compressed_size, total_compressed_size);
 
     // Process dataset chunk pages into output columns
-    const auto total_pages = count_page_headers(chunks, stream);
-    if (total_pages > 0) {
-      hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, stream);
-      rmm::device_buffer decomp_page_data;
-
-      // decoding of column/page information
-      decode_page_headers(chunks, pages, stream);
-      if (total_decompressed_size > 0) {
-        decomp_page_data = decompress_page_data(chunks, pages, stream);
-        // Free compressed data
-        for (size_t c = 0; c < chunks.size(); c++) {
-          if (chunks[c].codec != parquet::Compression::UNCOMPRESSED) { page_data[c].reset(); }
-        }
-      }
+    auto decoded_input_bytes =
+      total_compressed_size + statistics[io_phase::DECOMPRESS].output_bytes -
+      statistics[io_phase::DECOMPRESS].input_bytes;
+    if (pages.size() > 0) {
+
+      // transcode the pages using the DELTA_* encodings to PLAIN, so that they are decoded as such
+      auto const delta_page_data = gpu::DecodeDeltaPages(pages, chunks, stream);
 
       // build output column info
       // walk the schema, building out_buffers that mirror what our final cudf columns will look
@@ -1555,18 +2333,46 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       //
       // - for nested schemas, output buffer offset values per-page, per nesting-level for the
       // purposes of decoding.
+      select_dictionary_columns(chunks, pages);
       preprocess_columns(chunks, pages, skip_rows, num_rows, has_lists, stream);
 
-      // decoding of column data itself
-      decode_page_data(chunks, pages, page_nesting_info, skip_rows, num_rows, stream);
-
-      // create the final output cudf columns
-      for (size_t i = 0; i < _output_columns.size(); ++i) {
-        out_metadata.schema_info.push_back(column_name_info{""});
-        out_columns.emplace_back(
-          make_column(_output_columns[i], &out_metadata.schema_info.back(), stream, _mr));
+      // decoding of column data itself, and creation of the final output cudf columns
+      out_metadata.schema_info.resize(_output_columns.size(), column_name_info{""});
+      auto const filter_rows = _filter_rows && _filter.has_value();
+      if (filter_rows && !has_lists) {
+        out_columns = decode_filtered_columns(
+          chunks, pages, page_nesting_info, skip_rows, num_rows, out_metadata.schema_info, stream);
+      } else {
+        decode_page_data(chunks, pages, page_nesting_info, skip_rows, num_rows, stream);
+        for (size_t i = 0; i < _output_columns.size(); ++i) {
+          out_columns.emplace_back(make_output_column(i, &out_metadata.schema_info[i], stream));
+        }
+        if (filter_rows) {
+          std::vector<column_view> views(out_columns.size());
+          std::transform(out_columns.cbegin(), out_columns.cend(), views.begin(), [](auto &col) {
+            return col->view();
+          });
+          out_columns =
+            cudf::ast::detail::filter(table_view{views}, _filter->get(), stream, _mr)->release();
+        }
       }
     }
+
+    if (stats != nullptr) {
+      // the decode phase is everything apart from waiting for the reads and the decompression
+      stream.synchronize();
+      auto const decode_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now() - decode_start)
+                                 .count();
+      statistics[io_phase::DECODE].time_ns = decode_time -
+                                             statistics[io_phase::READ].time_ns -
+                                             statistics[io_phase::DECOMPRESS].time_ns;
+      auto const output_bytes = std::accumulate(
+        out_columns.begin(), out_columns.end(), size_t{0}, [](size_t bytes, auto const &col) {
+          return bytes + cudf::detail::device_buffer_bytes(col->view());
+        });
+      add_phase_bytes(stats, io_phase::DECODE, decoded_input_bytes, output_bytes);
+    }
   }
 
   // Create empty columns as needed (this can happen if we've ended up with no actual data to read)
@@ -1585,14 +2391,17 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   // Return user metadata
   out_metadata.user_data = _metadata->get_key_value_metadata();
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  table_with_metadata result{std::make_unique<table>(std::move(out_columns)),
+                             std::move(out_metadata)};
+  if (_io_statistics) { result.statistics = statistics; }
+  return result;
 }
 
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                parquet_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepaths), options, mr))
+  : _impl(std::make_unique<impl>(datasource::create(filepaths), filepaths, options, mr))
 {
 }
 
@@ -1600,7 +2409,7 @@ reader::reader(std::vector<std::string> const &filepaths,
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                parquet_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(std::move(sources), options, mr))
+  : _impl(std::make_unique<impl>(std::move(sources), std::vector<std::string>{}, options, mr))
 {
 }
 
@@ -1615,6 +2424,68 @@ table_with_metadata reader::read(parquet_reader_options const &options,
     options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), stream);
 }
 
+// Forward to implementation
+memory_estimate reader::estimate_memory(parquet_reader_options const &options,
+                                        rmm::cuda_stream_view stream)
+{
+  return _impl->estimate_memory(
+    options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), stream);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(size_t chunk_read_limit,
+                               std::vector<std::string> const &filepaths,
+                               parquet_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+  : reader(filepaths, options, mr)
+{
+  _impl->setup_chunking(chunk_read_limit,
+                        options.get_skip_rows(),
+                        options.get_num_rows(),
+                        options.get_row_groups(),
+                        rmm::cuda_stream_default);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+                               parquet_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+  : reader(std::move(sources), options, mr)
+{
+  _impl->setup_chunking(chunk_read_limit,
+                        options.get_skip_rows(),
+                        options.get_num_rows(),
+                        options.get_row_groups(),
+                        rmm::cuda_stream_default);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+parquet_metadata read_metadata(std::vector<std::unique_ptr<cudf::io::datasource>> const &sources,
+                               std::vector<std::string> const &filepaths,
+                               metadata_cache *cache)
+{
+  aggregate_metadata const md(sources, filepaths, cache);
+
+  parquet_metadata result;
+  result.num_rows           = md.get_num_rows();
+  result.row_group_num_rows = md.get_row_group_num_rows();
+  result.column_names       = md.get_column_names();
+  result.key_value_metadata = md.get_key_value_metadata();
+  return result;
+}
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
+}
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
@@ -34,6 +34,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -48,6 +49,29 @@ using namespace cudf::io;
 // Forward declarations
 class aggregate_metadata;
 
+/**
+ * @brief Describes a row group selected for reading
+ */
+struct row_group_info {
+  size_type const index;
+  size_t const start_row;  // TODO source index
+  size_type const source_index;
+  row_group_info(size_type index, size_t start_row, size_type source_index)
+    : index(index), start_row(start_row), source_index(source_index)
+  {
+  }
+};
+
+/**
+ * @brief Describes the range of selected row groups and rows decoded by one chunked read
+ */
+struct chunk_read_info {
+  size_t first_row_group;  // index into the list of selected row groups
+  size_t num_row_groups;   // number of selected row groups in this chunk
+  size_type skip_rows;     // first row of the chunk, relative to the selection
+  size_type num_rows;      // number of rows in the chunk
+};
+
 /**
  * @brief Implementation for Parquet reader
  */
@@ -57,10 +81,13 @@ class reader::impl {
    * @brief Constructor from an array of dataset sources with reader options.
    *
    * @param sources Dataset sources
+   * @param filepaths Paths of the sources, used to look up their footers in the metadata cache;
+   * empty if the sources are not files
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
   explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                std::vector<std::string> const &filepaths,
                 parquet_reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -79,15 +106,110 @@ class reader::impl {
                            std::vector<std::vector<size_type>> const &row_group_indices,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Estimates the device memory used to read an entire set or a subset of data, from the
+   * sizes and types of the selected column chunks recorded in the file footers
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Estimate of the device memory used by `read()`
+   */
+  memory_estimate estimate_memory(size_type skip_rows,
+                                  size_type num_rows,
+                                  std::vector<std::vector<size_type>> const &row_group_indices,
+                                  rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Splits the selected row groups into chunks whose estimated output size fits within
+   * the given limit, for use with `read_chunk()`
+   *
+   * Row groups are never split, so a chunk always holds at least one row group even if that
+   * row group alone exceeds the limit.
+   *
+   * @param chunk_read_limit Limit on the estimated output size of each chunk, in bytes; 0 means
+   * the whole selection is returned as a single chunk
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void setup_chunking(size_t chunk_read_limit,
+                      size_type skip_rows,
+                      size_type num_rows,
+                      std::vector<std::vector<size_type>> const &row_group_indices,
+                      rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns true if there is at least one more chunk to be returned by `read_chunk()`
+   */
+  bool has_next() const { return _current_chunk < _chunk_read_info.size(); }
+
+  /**
+   * @brief Reads the next chunk set up by `setup_chunking()`
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
+  /**
+   * @brief Decodes the given selection of row groups into a set of columns
+   *
+   * @param selected_row_groups Row groups to read
+   * @param skip_rows Number of rows to skip from the start of the selection
+   * @param num_rows Number of rows to read
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_row_groups(std::vector<row_group_info> const &selected_row_groups,
+                                      size_type skip_rows,
+                                      size_type num_rows,
+                                      rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Removes the row groups that the filter proves to contain no matching rows
+   *
+   * The remaining row groups are renumbered to start at row 0 and the row range is adjusted to
+   * cover the same rows of the remaining row groups.
+   *
+   * @param[in,out] row_groups Selected row groups
+   * @param[in,out] skip_rows Number of rows to skip from the start of the selection
+   * @param[in,out] num_rows Number of rows to read
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void filter_row_groups(std::vector<row_group_info> &row_groups,
+                         size_type &skip_rows,
+                         size_type &num_rows,
+                         rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Rebuilds the input and output column information from the file schema
+   *
+   * Output buffers are consumed when the output columns are created, so this must be called
+   * before each read of the same reader instance.
+   */
+  void select_columns();
+
   /**
    * @brief Reads compressed page data to device memory
    *
+   * Adjacent chunks from the same source are coalesced into a single read, and the reads of a
+   * source are prefetched concurrently. The mutex of a source that doesn't support concurrent
+   * reads is held while it is read, so that concurrent calls never access it at the same time.
+   *
    * @param page_data Buffers to hold compressed page data for each chunk
    * @param chunks List of column chunk descriptors
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param chunk_source_map Source index of each chunk
+   * @param source_mutexes Mutex of each source, shared by the concurrent calls
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
@@ -97,8 +219,38 @@ class reader::impl {
                           size_t end_chunk,
                           const std::vector<size_t> &column_chunk_offsets,
                           std::vector<size_type> const &chunk_source_map,
+                          std::vector<std::mutex> &source_mutexes,
                           rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Reads the column chunks and decompresses their pages, in batches of chunks from a single
+   * source.
+   *
+   * The batches are read in order on a bounded thread pool. Batches of a source that doesn't
+   * support concurrent reads are read one at a time. The page headers of each batch are
+   * decoded and its pages are decompressed as soon as it is read, while the following batches are
+   * still being read. The pages of all batches are then gathered for decoding.
+   *
+   * @param page_data Buffers to hold compressed page data for each chunk
+   * @param chunks List of column chunk descriptors
+   * @param pages Returned page information of all chunks; empty if the chunks have no pages
+   * @param decomp_page_data Returned device buffers of the decompressed page data of each batch
+   * @param batch_offsets Index of the first chunk of each batch, followed by the number of chunks
+   * @param column_chunk_offsets File offset for all chunks
+   * @param chunk_source_map Source index of each chunk
+   * @param stats Statistics to add the read and decompression times to, or null
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void read_and_decompress_chunks(std::vector<std::unique_ptr<datasource::buffer>> &page_data,
+                                  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                  hostdevice_vector<gpu::PageInfo> &pages,
+                                  std::vector<rmm::device_buffer> &decomp_page_data,
+                                  std::vector<size_t> const &batch_offsets,
+                                  std::vector<size_t> const &column_chunk_offsets,
+                                  std::vector<size_type> const &chunk_source_map,
+                                  io_statistics *stats,
+                                  rmm::cuda_stream_view stream);
+
   /**
    * @brief Returns the number of total pages from the given column chunks
    *
@@ -134,6 +286,20 @@ class reader::impl {
                                           hostdevice_vector<gpu::PageInfo> &pages,
                                           rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Selects the string columns decoded as dictionary indices instead of strings
+   *
+   * A top-level string column is selected when dictionary output is enabled and all the data
+   * pages of all its chunks are dictionary-encoded. The output buffer of each selected column holds
+   * the indices into the dictionary entries of all its chunks, and these chunks are set up to
+   * decode such indices.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   */
+  void select_dictionary_columns(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                 hostdevice_vector<gpu::PageInfo> const &pages);
+
   /**
    * @brief Allocate nesting information storage for all pages and set pointers
    *        to it.
@@ -196,6 +362,45 @@ class reader::impl {
                         size_t total_rows,
                         rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Decodes the columns referenced by the filter, evaluates it, and then decodes only the
+   * pages of the other columns that hold some of the rows it selects.
+   *
+   * Only used for schemas without lists, where the output rows of each page are known before
+   * decoding.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param page_nesting Page nesting array
+   * @param min_row Minimum number of rows from start
+   * @param total_rows Number of rows to output
+   * @param schema_info Schema information of each output column
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The output columns, holding only the rows selected by the filter
+   */
+  std::vector<std::unique_ptr<column>> decode_filtered_columns(
+    hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+    hostdevice_vector<gpu::PageInfo> &pages,
+    hostdevice_vector<gpu::PageNestingInfo> &page_nesting,
+    size_t min_row,
+    size_t total_rows,
+    std::vector<column_name_info> &schema_info,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Creates the output column of a decoded output buffer
+   *
+   * @param idx Index of the output buffer
+   * @param schema_info Schema information of the column
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The output column, a dictionary column for the strings decoded as dictionary indices
+   */
+  std::unique_ptr<column> make_output_column(size_t idx,
+                                             column_name_info *schema_info,
+                                             rmm::cuda_stream_view stream);
+
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
   std::vector<std::unique_ptr<datasource>> _sources;
@@ -208,9 +413,31 @@ class reader::impl {
   // _output_columns associated schema indices
   std::vector<int> _output_column_schemas;
 
-  bool _strings_to_categorical = false;
+  // names of the columns to read; empty is all
+  std::vector<std::string> _use_names;
+  bool _use_pandas_metadata = true;
+
+  bool _strings_to_categorical    = false;
+  bool _output_dictionary_strings = false;
   data_type _timestamp_type{type_id::EMPTY};
   bool _strict_decimal_types = false;
+
+  // whether to collect the statistics of the read phases
+  bool _io_statistics = false;
+
+  // whether each input column is decoded as dictionary indices, and the dictionary entries of all
+  // its chunks in that case
+  std::vector<bool> _dictionary_columns;
+  std::vector<std::unique_ptr<column>> _dictionary_keys;
+
+  // filter used to skip row groups, and to select the output rows if `_filter_rows` is set
+  thrust::optional<std::reference_wrapper<ast::expression const>> _filter;
+  bool _filter_rows = false;
+
+  // state for chunked reads
+  std::vector<row_group_info> _chunked_row_groups;
+  std::vector<chunk_read_info> _chunk_read_info;
+  size_t _current_chunk = 0;
 };
 
 }  // namespace parquet
@@ -22,9 +22,12 @@
 #include "writer_impl.hpp"
 
 #include <io/utilities/column_utils.cuh>
+#include <io/utilities/io_statistics.hpp>
+#include <io/utilities/pinned_host_pool.hpp>
 #include "compact_protocol_writer.hpp"
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/metrics.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
@@ -49,12 +52,6 @@ using namespace cudf::io::parquet;
 using namespace cudf::io;
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to parquet compression
  */
@@ -63,6 +60,7 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::LZ4: return parquet::Compression::LZ4;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -70,6 +68,82 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Reads a plain-encoded statistics value as type `T`
+ */
+template <typename T>
+T load_stats_value(std::vector<uint8_t> const &value)
+{
+  T v{};
+  memcpy(&v, value.data(), std::min(sizeof(T), value.size()));
+  return v;
+}
+
+/**
+ * @brief Compares two plain-encoded statistics values, in the sort order of the column
+ *
+ * @return Negative, zero or positive if `a` is less than, equal to or greater than `b`
+ */
+int compare_stats_values(std::vector<uint8_t> const &a,
+                         std::vector<uint8_t> const &b,
+                         statistics_dtype dtype,
+                         bool is_unsigned)
+{
+  auto compare = [](auto x, auto y) { return (x < y) ? -1 : (y < x) ? 1 : 0; };
+  switch (dtype) {
+    case dtype_bool:
+    case dtype_int8:
+    case dtype_int16:
+    case dtype_int32:
+    case dtype_date32:
+      return is_unsigned ? compare(load_stats_value<uint32_t>(a), load_stats_value<uint32_t>(b))
+                         : compare(load_stats_value<int32_t>(a), load_stats_value<int32_t>(b));
+    case dtype_int64:
+    case dtype_timestamp64:
+    case dtype_decimal64:
+      return is_unsigned ? compare(load_stats_value<uint64_t>(a), load_stats_value<uint64_t>(b))
+                         : compare(load_stats_value<int64_t>(a), load_stats_value<int64_t>(b));
+    case dtype_float32: return compare(load_stats_value<float>(a), load_stats_value<float>(b));
+    case dtype_float64: return compare(load_stats_value<double>(a), load_stats_value<double>(b));
+    case dtype_string: {
+      // Unsigned byte-wise comparison
+      auto const len = std::min(a.size(), b.size());
+      auto const cmp = (len != 0) ? memcmp(a.data(), b.data(), len) : 0;
+      return (cmp != 0) ? cmp : compare(a.size(), b.size());
+    }
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Finds the ordering of the page min/max values of a column index
+ *
+ * Null pages are ignored; a column index with at most one non-null page is reported as ascending.
+ */
+BoundaryOrder get_boundary_order(ColumnIndex const &column_index,
+                                 statistics_dtype dtype,
+                                 bool is_unsigned)
+{
+  // No comparison is implemented for these types
+  if (dtype == dtype_decimal128 || dtype == dtype_none) { return UNORDERED; }
+  bool ascending  = true;
+  bool descending = true;
+  int prev        = -1;
+  for (size_t p = 0; p < column_index.null_pages.size(); p++) {
+    if (column_index.null_pages[p]) { continue; }
+    if (prev >= 0) {
+      auto const cmp_min = compare_stats_values(
+        column_index.min_values[prev], column_index.min_values[p], dtype, is_unsigned);
+      auto const cmp_max = compare_stats_values(
+        column_index.max_values[prev], column_index.max_values[p], dtype, is_unsigned);
+      ascending  = ascending && cmp_min <= 0 && cmp_max <= 0;
+      descending = descending && cmp_min >= 0 && cmp_max >= 0;
+    }
+    prev = static_cast<int>(p);
+  }
+  return ascending ? ASCENDING : descending ? DESCENDING : UNORDERED;
+}
+
 }  // namespace
 
 struct linked_column_view;
@@ -517,6 +591,8 @@ struct parquet_column_view {
   bool is_list() const noexcept { return _is_list; }
 
   // Dictionary related member functions
+  column_encoding requested_encoding() const { return schema_node.col_meta.get_encoding(); }
+  bool bloom_filter_requested() const { return schema_node.col_meta.is_enabled_bloom_filter(); }
   uint32_t *get_dict_data() { return (_dict_data.size()) ? _dict_data.data() : nullptr; }
   uint32_t *get_dict_index() { return (_dict_index.size()) ? _dict_index.data() : nullptr; }
   void use_dictionary(bool use_dict) { _dictionary_used = use_dict; }
@@ -690,13 +766,24 @@ gpu::parquet_column_device_view parquet_column_view::get_device_view(rmm::cuda_s
   desc.ts_scale    = schema_node.ts_scale;
 
   // TODO (dm): Enable dictionary for list and struct after refactor
-  if (physical_type() != BOOLEAN && physical_type() != UNDEFINED_TYPE &&
-      !is_nested(cudf_col.type())) {
+  bool const is_dict_supported = physical_type() != BOOLEAN &&
+                                 physical_type() != UNDEFINED_TYPE && !is_nested(cudf_col.type());
+  CUDF_EXPECTS(is_dict_supported || requested_encoding() != column_encoding::DICTIONARY,
+               "Dictionary encoding is not supported for boolean and nested columns");
+  if (is_dict_supported && requested_encoding() != column_encoding::PLAIN) {
     alloc_dictionary(_data_count, stream);
     desc.dict_index = get_dict_index();
     desc.dict_data  = get_dict_data();
   }
 
+  // The bloom filters hash the plain encoding, which is only computed for these physical types
+  bool const is_bloom_filter_supported =
+    !is_nested(cudf_col.type()) && (physical_type() == INT32 || physical_type() == INT64 ||
+                                    physical_type() == FLOAT || physical_type() == DOUBLE ||
+                                    physical_type() == BYTE_ARRAY);
+  CUDF_EXPECTS(is_bloom_filter_supported || !bloom_filter_requested(),
+               "Bloom filters are only supported for non-nested numeric and string columns");
+
   if (is_list()) {
     desc.level_offsets = _dremel_offsets.data();
     desc.rep_values    = _rep_level.data();
@@ -828,14 +915,23 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                                 const statistics_chunk *page_stats,
                                 const statistics_chunk *chunk_stats)
 {
-  gpu::EncodePages(
-    pages, chunks.device_ptr(), pages_in_batch, first_page_in_batch, comp_in, comp_out, stream);
-  switch (compression_) {
-    case parquet::Compression::SNAPPY:
-      CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
-      break;
-    default: break;
-  }
+  time_phase(io_statistics_, io_phase::ENCODE, stream, [&]() {
+    gpu::EncodePages(
+      pages, chunks.device_ptr(), pages_in_batch, first_page_in_batch, comp_in, comp_out, stream);
+  });
+  time_phase(io_statistics_, io_phase::COMPRESS, stream, [&]() {
+    switch (compression_) {
+      case parquet::Compression::SNAPPY:
+        CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
+        break;
+      case parquet::Compression::LZ4:
+        // Hadoop framing, which is what other readers expect for the LZ4 codec
+        CUDA_TRY(gpu_lz4(comp_in, comp_out, pages_in_batch, true, stream));
+        break;
+      default: break;
+    }
+  });
+  auto const encode_start = std::chrono::steady_clock::now();
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
   // chunk-level
   DecideCompression(chunks.device_ptr() + first_rowgroup * num_columns,
@@ -862,6 +958,99 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                            cudaMemcpyDeviceToHost,
                            stream.value()));
   stream.synchronize();
+  if (io_statistics_ != nullptr) {
+    // the page headers and the gathering of the pages into chunks are a part of the encoding
+    (*io_statistics_)[io_phase::ENCODE].time_ns +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                           encode_start)
+        .count();
+  }
+}
+
+void writer::impl::build_page_indexes(hostdevice_vector<gpu::EncColumnChunk> &chunks,
+                                      hostdevice_vector<gpu::parquet_column_device_view> &col_desc,
+                                      const gpu::EncPage *pages,
+                                      const statistics_chunk *page_stats,
+                                      uint32_t num_rowgroups,
+                                      uint32_t num_columns,
+                                      uint32_t num_pages,
+                                      uint32_t first_rowgroup)
+{
+  std::vector<gpu::EncPage> h_pages(num_pages);
+  std::vector<statistics_chunk> h_page_stats(num_pages);
+  CUDA_TRY(cudaMemcpyAsync(h_pages.data(),
+                           pages,
+                           num_pages * sizeof(gpu::EncPage),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  CUDA_TRY(cudaMemcpyAsync(h_page_stats.data(),
+                           page_stats,
+                           num_pages * sizeof(statistics_chunk),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  // Encode the page min/max values as in the page headers, which reserve room for them
+  hostdevice_vector<size_t> stats_offsets(num_pages, stream);
+  hostdevice_vector<uint32_t> stats_sizes(num_pages, stream);
+  size_t stats_bfr_size = 0;
+  for (uint32_t p = 0; p < num_pages; p++) {
+    stats_offsets[p] = stats_bfr_size;
+    stats_bfr_size += h_pages[p].max_hdr_size;
+  }
+  rmm::device_buffer stats_bfr(stats_bfr_size, stream);
+  stats_offsets.host_to_device(stream);
+  gpu::EncodePageStatistics(pages,
+                            chunks.device_ptr(),
+                            num_pages,
+                            page_stats,
+                            stats_offsets.device_ptr(),
+                            static_cast<uint8_t *>(stats_bfr.data()),
+                            stats_sizes.device_ptr(),
+                            stream);
+  stats_sizes.device_to_host(stream);
+  auto host_stats = make_pinned_buffer<uint8_t>(stats_bfr_size);
+  CUDA_TRY(cudaMemcpyAsync(
+    host_stats.get(), stats_bfr.data(), stats_bfr_size, cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+
+  auto const num_chunks = (first_rowgroup + num_rowgroups) * num_columns;
+  column_indexes_.resize(num_chunks);
+  offset_indexes_.resize(num_chunks);
+  for (uint32_t r = 0; r < num_rowgroups; r++) {
+    for (uint32_t i = 0; i < num_columns; i++) {
+      auto const &ck         = chunks[r * num_columns + i];
+      auto const &meta_data  = md.row_groups[first_rowgroup + r].columns[i].meta_data;
+      auto const dtype       = col_desc[i].stats_dtype;
+      auto const is_unsigned = col_desc[i].converted_type >= UINT_8 &&
+                               col_desc[i].converted_type <= UINT_64;
+      ColumnIndex column_index;
+      OffsetIndex offset_index;
+      // Data pages directly follow the dictionary page, if any
+      int64_t page_offset = meta_data.data_page_offset;
+      for (uint32_t p = ck.first_page + ck.has_dictionary; p < ck.first_page + ck.num_pages;
+           p++) {
+        auto const &page     = h_pages[p];
+        auto const page_size = page.hdr_size + page.max_data_size;
+        offset_index.page_locations.push_back(
+          {page_offset, static_cast<int32_t>(page_size), page.start_row - ck.start_row});
+        page_offset += page_size;
+
+        Statistics stats;
+        CompactProtocolReader cpr(host_stats.get() + stats_offsets[p], stats_sizes[p]);
+        CUDF_EXPECTS(cpr.read(&stats), "Failed to decode page statistics");
+        column_index.null_pages.push_back(h_page_stats[p].has_minmax == 0);
+        column_index.min_values.push_back(std::move(stats.min_value));
+        column_index.max_values.push_back(std::move(stats.max_value));
+        column_index.null_counts.push_back(h_page_stats[p].null_count);
+      }
+      column_index.boundary_order = get_boundary_order(column_index, dtype, is_unsigned);
+
+      auto const chunk_idx = (first_rowgroup + r) * num_columns + i;
+      CompactProtocolWriter(&column_indexes_[chunk_idx]).write(column_index);
+      CompactProtocolWriter(&offset_indexes_[chunk_idx]).write(offset_index);
+    }
+  }
 }
 
 writer::impl::impl(std::unique_ptr<data_sink> sink,
@@ -874,6 +1063,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
+    io_statistics_(options.get_io_statistics()),
     out_sink_(std::move(sink)),
     single_write_mode(mode == SingleWriteMode::YES)
 {
@@ -893,6 +1083,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
+    io_statistics_(options.get_io_statistics()),
     single_write_mode(mode == SingleWriteMode::YES),
     out_sink_(std::move(sink))
 {
@@ -933,6 +1124,14 @@ void writer::impl::write(table_view const &table)
     add_default_name(table_meta->column_metadata[i], "_col" + std::to_string(i));
   }
 
+  if (io_statistics_ != nullptr) {
+    auto const table_bytes = std::accumulate(
+      table.begin(), table.end(), size_t{0}, [](size_t bytes, column_view const &col) {
+        return bytes + cudf::detail::device_buffer_bytes(col);
+      });
+    add_phase_bytes(io_statistics_, io_phase::ENCODE, table_bytes, 0);
+  }
+
   auto vec         = input_table_to_linked_columns(table);
   auto schema_tree = construct_schema_tree(vec, *table_meta, single_write_mode, int96_timestamps);
   // Construct parquet_column_views from the schema tree leaf nodes.
@@ -1043,8 +1242,10 @@ void writer::impl::write(table_view const &table)
   if (stats_granularity_ != statistics_freq::STATISTICS_NONE) {
     frag_stats.resize(num_fragments * num_columns, stream);
     if (frag_stats.size() != 0) {
-      gather_fragment_statistics(
-        frag_stats.data(), fragments, col_desc, num_columns, num_fragments, fragment_size);
+      time_phase(io_statistics_, io_phase::STATISTICS, stream, [&]() {
+        gather_fragment_statistics(
+          frag_stats.data(), fragments, col_desc, num_columns, num_fragments, fragment_size);
+      });
     }
   }
   // Initialize row groups and column chunks
@@ -1081,30 +1282,33 @@ void writer::impl::write(table_view const &table)
       ck->is_compressed = 0;
       ck->dictionary_id = num_dictionaries;
       ck->ck_stat_size  = 0;
+      ck->is_dict_forced = parquet_columns[i].requested_encoding() == column_encoding::DICTIONARY;
       if (col_desc[i].dict_data) {
+        // The fragments only know their own distinct values, so the chunk cardinality is somewhere
+        // between the largest fragment cardinality and the sum of them. Only build dictionaries
+        // that can be smaller than plain encoding for the lowest cardinality; the dictionary
+        // kernel drops the ones that turn out to be larger once the exact cardinality is known.
         const gpu::PageFragment *ck_frag = &fragments[i * num_fragments + f];
         size_t plain_size                = 0;
-        size_t dict_size                 = 1;
-        uint32_t num_dict_vals           = 0;
-        for (uint32_t j = 0; j < fragments_in_chunk && num_dict_vals < 65536; j++) {
+        size_t num_values                = 0;
+        size_t min_dict_data_size        = 0;
+        uint32_t min_dict_vals           = 0;
+        for (uint32_t j = 0; j < fragments_in_chunk; j++) {
           plain_size += ck_frag[j].fragment_data_size;
-          dict_size +=
-            ck_frag[j].dict_data_size + ((num_dict_vals > 256) ? 2 : 1) * ck_frag[j].non_nulls;
-          num_dict_vals += ck_frag[j].num_dict_vals;
+          num_values += ck_frag[j].non_nulls;
+          min_dict_data_size = std::max<size_t>(min_dict_data_size, ck_frag[j].dict_data_size);
+          min_dict_vals      = std::max<uint32_t>(min_dict_vals, ck_frag[j].num_dict_vals);
         }
-        if (dict_size < plain_size) {
+        auto const min_dict_size =
+          min_dict_data_size + gpu::GetDictIndexSize(num_values, min_dict_vals);
+        if (ck->is_dict_forced || min_dict_size < plain_size) {
           parquet_columns[i].use_dictionary(true);
           dict_enable = true;
           num_dictionaries++;
         }
       }
-      ck->has_dictionary                                     = dict_enable;
-      md.row_groups[global_r].columns[i].meta_data.type      = parquet_columns[i].physical_type();
-      md.row_groups[global_r].columns[i].meta_data.encodings = {Encoding::PLAIN, Encoding::RLE};
-      if (dict_enable) {
-        md.row_groups[global_r].columns[i].meta_data.encodings.push_back(
-          Encoding::PLAIN_DICTIONARY);
-      }
+      ck->has_dictionary                                = dict_enable;
+      md.row_groups[global_r].columns[i].meta_data.type = parquet_columns[i].physical_type();
       md.row_groups[global_r].columns[i].meta_data.path_in_schema =
         parquet_columns[i].get_path_in_schema();
       md.row_groups[global_r].columns[i].meta_data.codec      = UNCOMPRESSED;
@@ -1121,6 +1325,16 @@ void writer::impl::write(table_view const &table)
   if (num_chunks != 0) {
     build_chunk_dictionaries(chunks, col_desc, num_rowgroups, num_columns, num_dictionaries);
   }
+  // Record the encodings that the chunks ended up with
+  for (uint32_t r = 0, global_r = global_rowgroup_base; r < num_rowgroups; r++, global_r++) {
+    for (int i = 0; i < num_columns; i++) {
+      auto &encodings = md.row_groups[global_r].columns[i].meta_data.encodings;
+      encodings       = {Encoding::PLAIN, Encoding::RLE};
+      if (chunks[r * num_columns + i].has_dictionary) {
+        encodings.push_back(Encoding::PLAIN_DICTIONARY);
+      }
+    }
+  }
 
   // Initialize batches of rowgroups to encode (mainly to limit peak memory usage)
   std::vector<uint32_t> batch_list;
@@ -1200,7 +1414,7 @@ void writer::impl::write(table_view const &table)
                        num_stats_bfr);
   }
 
-  pinned_buffer<uint8_t> host_bfr{nullptr, cudaFreeHost};
+  pinned_buffer<uint8_t> host_bfr{};
 
   // Encode row groups in batches
   for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
@@ -1224,11 +1438,15 @@ void writer::impl::write(table_view const &table)
       (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data() : nullptr,
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data() + num_pages
                                                                : nullptr);
+    auto const write_start = std::chrono::steady_clock::now();
     for (; r < rnext; r++, global_r++) {
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
+        add_phase_bytes(io_statistics_, io_phase::ENCODE, 0, ck->bfr_size);
+        add_phase_bytes(io_statistics_, io_phase::WRITE, ck->compressed_size, ck->compressed_size);
         uint8_t *dev_bfr;
         if (ck->is_compressed) {
+          add_phase_bytes(io_statistics_, io_phase::COMPRESS, ck->bfr_size, ck->compressed_size);
           md.row_groups[global_r].columns[i].meta_data.codec = compression_;
           dev_bfr                                            = ck->compressed_bfr;
         } else {
@@ -1250,14 +1468,7 @@ void writer::impl::write(table_view const &table)
             stream.synchronize();
           }
         } else {
-          if (!host_bfr) {
-            host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
-                                                uint8_t *ptr = nullptr;
-                                                CUDA_TRY(cudaMallocHost(&ptr, size));
-                                                return ptr;
-                                              }(max_chunk_bfr_size),
-                                              cudaFreeHost};
-          }
+          if (!host_bfr) { host_bfr = make_pinned_buffer<uint8_t>(max_chunk_bfr_size); }
           // copy the full data
           CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
                                    dev_bfr,
@@ -1283,6 +1494,85 @@ void writer::impl::write(table_view const &table)
         current_chunk_offset += ck->compressed_size;
       }
     }
+    if (io_statistics_ != nullptr) {
+      out_sink_->flush();
+      (*io_statistics_)[io_phase::WRITE].time_ns +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                             write_start)
+          .count();
+    }
+  }
+
+  if (stats_granularity_ == statistics_freq::STATISTICS_COLUMN && num_pages != 0) {
+    build_page_indexes(chunks,
+                       col_desc,
+                       pages.data(),
+                       page_stats.data(),
+                       num_rowgroups,
+                       num_columns,
+                       num_pages,
+                       global_rowgroup_base);
+  }
+
+  bool const has_bloom_filters =
+    std::any_of(parquet_columns.begin(), parquet_columns.end(), [](auto const &col) {
+      return col.bloom_filter_requested();
+    });
+  if (has_bloom_filters && num_chunks != 0) {
+    write_bloom_filters(chunks, parquet_columns, num_rowgroups, num_columns, global_rowgroup_base);
+  }
+}
+
+void writer::impl::write_bloom_filters(hostdevice_vector<gpu::EncColumnChunk> &chunks,
+                                       std::vector<parquet_column_view> const &parquet_columns,
+                                       uint32_t num_rowgroups,
+                                       uint32_t num_columns,
+                                       uint32_t first_rowgroup)
+{
+  // Size the filters for the number of distinct values, known exactly for dictionary chunks
+  auto const num_chunks = num_rowgroups * num_columns;
+  std::vector<size_t> bitset_offsets(num_chunks + 1, 0);
+  for (uint32_t c = 0; c < num_chunks; c++) {
+    auto &ck = chunks[c];
+    ck.bloom_filter_size =
+      parquet_columns[c % num_columns].bloom_filter_requested()
+        ? gpu::GetBloomFilterSize(ck.has_dictionary ? ck.total_dict_entries : ck.num_values)
+        : 0;
+    bitset_offsets[c + 1] = bitset_offsets[c] + ck.bloom_filter_size;
+  }
+  rmm::device_buffer bitsets(bitset_offsets.back(), stream);
+  CUDA_TRY(cudaMemsetAsync(bitsets.data(), 0, bitsets.size(), stream.value()));
+  for (uint32_t c = 0; c < num_chunks; c++) {
+    chunks[c].bloom_filter =
+      (chunks[c].bloom_filter_size != 0)
+        ? static_cast<uint32_t *>(bitsets.data()) + bitset_offsets[c] / sizeof(uint32_t)
+        : nullptr;
+  }
+  chunks.host_to_device(stream);
+  gpu::BuildBloomFilters(chunks.device_ptr(), num_chunks, stream);
+  auto host_bitsets = make_pinned_buffer<uint8_t>(bitsets.size());
+  CUDA_TRY(cudaMemcpyAsync(
+    host_bitsets.get(), bitsets.data(), bitsets.size(), cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+
+  // Each filter is written as its header followed by the bitset
+  std::vector<uint8_t> header;
+  CompactProtocolWriter cpw(&header);
+  for (uint32_t c = 0; c < num_chunks; c++) {
+    auto const &ck = chunks[c];
+    if (ck.bloom_filter_size == 0) { continue; }
+    BloomFilterHeader filter_header;
+    filter_header.num_bytes = ck.bloom_filter_size;
+    header.resize(0);
+    cpw.write(filter_header);
+    out_sink_->host_write(header.data(), header.size());
+    out_sink_->host_write(host_bitsets.get() + bitset_offsets[c], ck.bloom_filter_size);
+
+    auto &meta_data =
+      md.row_groups[first_rowgroup + c / num_columns].columns[c % num_columns].meta_data;
+    meta_data.bloom_filter_offset = current_chunk_offset;
+    meta_data.bloom_filter_length = static_cast<int32_t>(header.size() + ck.bloom_filter_size);
+    current_chunk_offset += meta_data.bloom_filter_length;
   }
 }
 
@@ -1291,6 +1581,32 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
 {
   if (closed) { return nullptr; }
   closed = true;
+
+  // Page indexes of all chunks are written together, so that readers can fetch them in one read
+  auto const write_page_indexes = [&](std::vector<std::vector<uint8_t>> const &indexes,
+                                      bool is_column_index) {
+    size_t chunk_idx = 0;
+    for (auto &rowgroup : md.row_groups) {
+      for (auto &col : rowgroup.columns) {
+        if (chunk_idx < indexes.size() && indexes[chunk_idx].size() != 0) {
+          auto const &index = indexes[chunk_idx];
+          out_sink_->host_write(index.data(), index.size());
+          if (is_column_index) {
+            col.column_index_offset = current_chunk_offset;
+            col.column_index_length = static_cast<int32_t>(index.size());
+          } else {
+            col.offset_index_offset = current_chunk_offset;
+            col.offset_index_length = static_cast<int32_t>(index.size());
+          }
+          current_chunk_offset += index.size();
+        }
+        chunk_idx++;
+      }
+    }
+  };
+  write_page_indexes(column_indexes_, true);
+  write_page_indexes(offset_indexes_, false);
+
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
   buffer_.resize(0);
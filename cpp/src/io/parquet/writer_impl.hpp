@@ -213,6 +213,42 @@ class writer::impl {
                     const statistics_chunk* page_stats,
                     const statistics_chunk* chunk_stats);
 
+  /**
+   * @brief Build the page-level column and offset indexes of the encoded chunks
+   *
+   * @param chunks column chunk array, after encoding
+   * @param col_desc column description array
+   * @param pages encoder pages array, after encoding
+   * @param page_stats page-level statistics
+   * @param num_rowgroups Total number of rowgroups
+   * @param num_columns Total number of columns
+   * @param num_pages Total number of pages
+   * @param first_rowgroup Index of the first rowgroup in the file metadata
+   */
+  void build_page_indexes(hostdevice_vector<gpu::EncColumnChunk>& chunks,
+                          hostdevice_vector<gpu::parquet_column_device_view>& col_desc,
+                          const gpu::EncPage* pages,
+                          const statistics_chunk* page_stats,
+                          uint32_t num_rowgroups,
+                          uint32_t num_columns,
+                          uint32_t num_pages,
+                          uint32_t first_rowgroup);
+
+  /**
+   * @brief Build the bloom filters of the encoded chunks and write them to the sink
+   *
+   * @param chunks column chunk array, after encoding
+   * @param parquet_columns columns of the table being written
+   * @param num_rowgroups Total number of rowgroups
+   * @param num_columns Total number of columns
+   * @param first_rowgroup Index of the first rowgroup in the file metadata
+   */
+  void write_bloom_filters(hostdevice_vector<gpu::EncColumnChunk>& chunks,
+                           std::vector<parquet_column_view> const& parquet_columns,
+                           uint32_t num_rowgroups,
+                           uint32_t num_columns,
+                           uint32_t first_rowgroup);
+
  private:
   // TODO : figure out if we want to keep this. It is currently unused.
   rmm::mr::device_memory_resource* _mr = nullptr;
@@ -225,6 +261,8 @@ class writer::impl {
   Compression compression_           = Compression::UNCOMPRESSED;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
   bool int96_timestamps              = false;
+  // optional statistics of the write phases, accumulated over the writes
+  io_statistics* io_statistics_ = nullptr;
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
   cudf::io::parquet::FileMetaData md;
   // optional user metadata
@@ -238,6 +276,9 @@ class writer::impl {
   bool const single_write_mode = true;
 
   std::vector<uint8_t> buffer_;
+  // Encoded column and offset indexes of each chunk of the file, written when closing the file
+  std::vector<std::vector<uint8_t>> column_indexes_;
+  std::vector<std::vector<uint8_t>> offset_indexes_;
   std::unique_ptr<data_sink> out_sink_;
 };
 
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "column_stats.h"
+
+#include <io/utilities/column_utils.cuh>
+#include <io/utilities/hostdevice_vector.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/io/statistics.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the statistics type of a column, which also selects the gather kernel
+ */
+statistics_dtype to_statistics_dtype(data_type type)
+{
+  switch (type.id()) {
+    case type_id::BOOL8: return dtype_bool;
+    case type_id::INT8: return dtype_int8;
+    case type_id::INT16: return dtype_int16;
+    case type_id::INT32: return dtype_int32;
+    case type_id::INT64: return dtype_int64;
+    case type_id::FLOAT32: return dtype_float32;
+    case type_id::FLOAT64: return dtype_float64;
+    case type_id::TIMESTAMP_DAYS: return dtype_date32;
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::TIMESTAMP_NANOSECONDS: return dtype_timestamp64;
+    case type_id::DURATION_DAYS: return dtype_date32;
+    case type_id::DURATION_SECONDS:
+    case type_id::DURATION_MILLISECONDS:
+    case type_id::DURATION_MICROSECONDS:
+    case type_id::DURATION_NANOSECONDS: return dtype_timestamp64;
+    case type_id::STRING: return dtype_string;
+    default: CUDF_FAIL("Unsupported column type for statistics");
+  }
+}
+
+/**
+ * @brief Creates the column of the minimum or maximum values of fixed-width type, stored as `T`
+ */
+template <typename T>
+std::unique_ptr<column> make_fixed_width_minmax(data_type type,
+                                                device_span<statistics_chunk const> chunks,
+                                                bool is_max,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource *mr)
+{
+  auto result = make_fixed_width_column(type, chunks.size(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    chunks.begin(),
+                    chunks.end(),
+                    result->mutable_view().data<T>(),
+                    [is_max] __device__(statistics_chunk const &ck) {
+                      auto const &value = is_max ? ck.max_value : ck.min_value;
+                      if constexpr (std::is_floating_point<T>::value) {
+                        return static_cast<T>(value.fp_val);
+                      } else {
+                        return static_cast<T>(value.i_val);
+                      }
+                    });
+  auto valid = cudf::detail::valid_if(
+    chunks.begin(),
+    chunks.end(),
+    [] __device__(statistics_chunk const &ck) { return ck.has_minmax != 0; },
+    stream,
+    mr);
+  result->set_null_mask(std::move(valid.first), valid.second);
+  return result;
+}
+
+/**
+ * @brief Creates the column of the minimum or maximum strings
+ */
+std::unique_ptr<column> make_string_minmax(device_span<statistics_chunk const> chunks,
+                                           bool is_max,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource *mr)
+{
+  rmm::device_uvector<thrust::pair<char const *, size_type>> strings(chunks.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    chunks.begin(),
+                    chunks.end(),
+                    strings.begin(),
+                    [is_max] __device__(statistics_chunk const &ck) {
+                      auto const &value = is_max ? ck.max_value : ck.min_value;
+                      return thrust::pair<char const *, size_type>{
+                        ck.has_minmax ? value.str_val.ptr : nullptr,
+                        static_cast<size_type>(value.str_val.length)};
+                    });
+  return make_strings_column(strings, stream, mr);
+}
+
+std::unique_ptr<column> make_minmax(data_type type,
+                                    device_span<statistics_chunk const> chunks,
+                                    bool is_max,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource *mr)
+{
+  switch (to_statistics_dtype(type)) {
+    case dtype_bool:
+    case dtype_int8: return make_fixed_width_minmax<int8_t>(type, chunks, is_max, stream, mr);
+    case dtype_int16: return make_fixed_width_minmax<int16_t>(type, chunks, is_max, stream, mr);
+    case dtype_int32:
+    case dtype_date32: return make_fixed_width_minmax<int32_t>(type, chunks, is_max, stream, mr);
+    case dtype_float32: return make_fixed_width_minmax<float>(type, chunks, is_max, stream, mr);
+    case dtype_float64: return make_fixed_width_minmax<double>(type, chunks, is_max, stream, mr);
+    case dtype_string: return make_string_minmax(chunks, is_max, stream, mr);
+    default: return make_fixed_width_minmax<int64_t>(type, chunks, is_max, stream, mr);
+  }
+}
+
+/**
+ * @brief Converts the statistics of a column to a table
+ */
+std::unique_ptr<table> make_statistics_table(data_type type,
+                                             device_span<statistics_chunk const> chunks,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource *mr)
+{
+  auto const num_rows   = static_cast<size_type>(chunks.size());
+  auto const count_type = data_type{type_to_id<size_type>()};
+
+  auto null_count  = make_numeric_column(count_type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto valid_count = make_numeric_column(count_type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    chunks.begin(),
+                    chunks.end(),
+                    null_count->mutable_view().begin<size_type>(),
+                    [] __device__(statistics_chunk const &ck) { return ck.null_count; });
+  thrust::transform(rmm::exec_policy(stream),
+                    chunks.begin(),
+                    chunks.end(),
+                    valid_count->mutable_view().begin<size_type>(),
+                    [] __device__(statistics_chunk const &ck) { return ck.non_nulls; });
+
+  auto const is_float = is_floating_point(type);
+  auto const sum_type = data_type{is_float ? type_id::FLOAT64 : type_id::INT64};
+
+  auto sum = make_numeric_column(sum_type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  if (is_float) {
+    thrust::transform(rmm::exec_policy(stream),
+                      chunks.begin(),
+                      chunks.end(),
+                      sum->mutable_view().begin<double>(),
+                      [] __device__(statistics_chunk const &ck) { return ck.sum.fp_val; });
+  } else {
+    thrust::transform(rmm::exec_policy(stream),
+                      chunks.begin(),
+                      chunks.end(),
+                      sum->mutable_view().begin<int64_t>(),
+                      [] __device__(statistics_chunk const &ck) { return ck.sum.i_val; });
+  }
+  auto sum_valid = cudf::detail::valid_if(
+    chunks.begin(),
+    chunks.end(),
+    [] __device__(statistics_chunk const &ck) { return ck.has_sum != 0; },
+    stream,
+    mr);
+  sum->set_null_mask(std::move(sum_valid.first), sum_valid.second);
+
+  std::vector<std::unique_ptr<column>> columns;
+  columns.push_back(std::move(null_count));
+  columns.push_back(std::move(valid_count));
+  columns.push_back(make_minmax(type, chunks, false, stream, mr));
+  columns.push_back(make_minmax(type, chunks, true, stream, mr));
+  columns.push_back(std::move(sum));
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace
+
+std::vector<column_statistics> compute_statistics(table_view const &input,
+                                                  size_type group_size,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource *mr)
+{
+  CUDF_EXPECTS(group_size > 0, "The group size must be positive");
+  auto const num_columns = static_cast<size_t>(input.num_columns());
+  auto const num_rows    = input.num_rows();
+  auto const num_groups  = (static_cast<size_t>(num_rows) + group_size - 1) / group_size;
+  auto const num_chunks  = num_groups * num_columns;
+
+  hostdevice_vector<stats_column_desc> stat_desc(num_columns, stream);
+  for (size_t col = 0; col < num_columns; ++col) {
+    auto *desc        = &stat_desc[col];
+    desc->stats_dtype = to_statistics_dtype(input.column(col).type());
+    desc->num_rows    = num_rows;
+    desc->num_values  = num_rows;
+    desc->ts_scale    = 0;
+  }
+  stat_desc.host_to_device(stream);
+
+  hostdevice_vector<statistics_group> stat_groups(num_chunks, stream);
+  hostdevice_vector<statistics_merge_group> stat_merge(num_columns, stream);
+  for (size_t col = 0; col < num_columns; ++col) {
+    for (size_t group = 0; group < num_groups; ++group) {
+      auto *grp      = &stat_groups[col * num_groups + group];
+      grp->col       = stat_desc.device_ptr(col);
+      grp->start_row = group * group_size;
+      grp->num_rows  = std::min<size_type>(group_size, num_rows - grp->start_row);
+    }
+    auto *merge        = &stat_merge[col];
+    merge->col         = stat_desc.device_ptr(col);
+    merge->start_chunk = col * num_groups;
+    merge->num_chunks  = num_groups;
+  }
+  stat_groups.host_to_device(stream);
+  stat_merge.host_to_device(stream);
+
+  auto const device_table = table_device_view::create(input, stream);
+  auto const leaf_column_views =
+    create_leaf_column_device_views<stats_column_desc>(stat_desc, *device_table, stream);
+
+  // All the chunks of all the columns are gathered at once, then merged per column
+  rmm::device_uvector<statistics_chunk> stat_chunks(num_chunks + num_columns, stream);
+  if (num_chunks != 0) {
+    GatherColumnStatistics(stat_chunks.data(), stat_groups.device_ptr(), num_chunks, stream);
+  }
+  if (num_columns != 0) {
+    MergeColumnStatistics(stat_chunks.data() + num_chunks,
+                          stat_chunks.data(),
+                          stat_merge.device_ptr(),
+                          num_columns,
+                          stream);
+  }
+
+  std::vector<column_statistics> result;
+  for (size_t col = 0; col < num_columns; ++col) {
+    auto const type = input.column(col).type();
+    auto const chunks =
+      device_span<statistics_chunk const>(stat_chunks.data() + col * num_groups, num_groups);
+    auto const total =
+      device_span<statistics_chunk const>(stat_chunks.data() + num_chunks + col, 1);
+    result.push_back({make_statistics_table(type, chunks, stream, mr),
+                      make_statistics_table(type, total, stream, mr)});
+  }
+  // The host buffers of the descriptors must outlive their copies to the device
+  stream.synchronize();
+  return result;
+}
+
+}  // namespace detail
+
+std::vector<column_statistics> compute_statistics(table_view const &table,
+                                                  size_type group_size,
+                                                  rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_statistics(table, group_size, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace io
+}  // namespace cudf
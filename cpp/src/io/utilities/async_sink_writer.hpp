@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "pinned_host_pool.hpp"
+#include "thread_pool.hpp"
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <array>
+#include <future>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Writes to a sink from a background thread, so that the host writes overlap the work that
+ * produces the next data to write
+ *
+ * The writes reach the sink in the order in which they are issued, and at most one write is in
+ * flight at a time: each call waits for the previous write before issuing its own. Device data is
+ * staged through two pinned buffers that are used in turn, so the copy of the data to one buffer
+ * overlaps the write of the other. The writer is not thread-safe, and the owner must call `wait()`
+ * before using the sink directly.
+ */
+class async_sink_writer {
+ public:
+  /**
+   * @brief Constructor for writing to `sink`, which must outlive the writer.
+   */
+  explicit async_sink_writer(data_sink *sink) : _sink(sink), _bytes_written(sink->bytes_written())
+  {
+  }
+
+  /**
+   * @brief Returns the size of the output once all the issued writes are complete.
+   */
+  size_t bytes_written() const { return _bytes_written; }
+
+  /**
+   * @brief Writes host data that is moved into the writer.
+   */
+  void host_write(std::vector<uint8_t> &&data)
+  {
+    wait();
+    _bytes_written += data.size();
+    _pending = _writer.submit(
+      [sink = _sink, data = std::move(data)]() { sink->host_write(data.data(), data.size()); });
+  }
+
+  /**
+   * @brief Writes device data, through a pinned staging buffer unless the sink prefers device
+   * writes of this size.
+   *
+   * @param gpu_data Device data to write; only needs to be valid until the call returns
+   * @param size Number of bytes to write
+   * @param stream CUDA stream to use for the copy or the device write
+   */
+  void device_write(void const *gpu_data, size_t size, rmm::cuda_stream_view stream)
+  {
+    if (size == 0) { return; }
+    if (_sink->is_device_write_preferred(size)) {
+      wait();
+      _sink->device_write(gpu_data, size, stream);
+      _bytes_written += size;
+      return;
+    }
+
+    // The last write from this buffer was complete before the other buffer was last written
+    auto const buffer_idx = _next_buffer;
+    _next_buffer ^= 1;
+    auto &buffer = _staging[buffer_idx];
+    if (_staging_size[buffer_idx] < size) {
+      buffer                    = make_pinned_buffer<uint8_t>(size);
+      _staging_size[buffer_idx] = size;
+    }
+    CUDA_TRY(cudaMemcpyAsync(buffer.get(), gpu_data, size, cudaMemcpyDeviceToHost, stream.value()));
+    stream.synchronize();
+
+    wait();
+    _bytes_written += size;
+    _pending = _writer.submit(
+      [sink = _sink, data = buffer.get(), size]() { sink->host_write(data, size); });
+  }
+
+  /**
+   * @brief Waits for the issued writes, rethrowing the error of a failed write.
+   */
+  void wait()
+  {
+    if (_pending.valid()) { _pending.get(); }
+  }
+
+ private:
+  data_sink *const _sink;
+  size_t _bytes_written;
+  std::array<pinned_buffer<uint8_t>, 2> _staging;
+  std::array<size_t, 2> _staging_size{};
+  int _next_buffer = 0;
+  std::future<void> _pending;
+  thread_pool _writer{1};  // Destroyed first, once the pending write is complete
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -33,6 +33,8 @@ struct column_type_histogram {
   cudf::size_type big_int_count;
   cudf::size_type bool_count;
   cudf::size_type null_count;
+  cudf::size_type struct_count;  ///< JSON objects nested in a field
+  cudf::size_type list_count;    ///< JSON arrays nested in a field
 };
 
 }  // namespace io
@@ -14,38 +14,111 @@
  * limitations under the License.
  */
 
-#include <fstream>
-
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 #include "file_io_utilities.hpp"
+#include "thread_pool.hpp"
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <utility>
+
 namespace cudf {
 namespace io {
+namespace {
+
+// Host writes are gathered in a ring of buffers of this size, which are written to the file in turn
+constexpr size_t write_buffer_size = 4 << 20;
+constexpr size_t num_write_buffers = 4;
+
+// Alignment of the file offset, size and address of a direct I/O write
+constexpr size_t direct_io_alignment = 4096;
+
+void write_all(int fd, uint8_t const* data, size_t size, size_t offset)
+{
+  while (size != 0) {
+    auto const count = pwrite(fd, data, size, offset);
+    CUDF_EXPECTS(count > 0, "Failed to write to the output file");
+    data += count;
+    size -= count;
+    offset += count;
+  }
+}
+
+}  // namespace
+
 /**
  * @brief Implementation class for storing data into a local file.
+ *
+ * Host writes are copied to the current buffer of a ring, and a full buffer is written to the file
+ * by a background thread while the next buffers are filled. Buffers whose file offset and size
+ * are aligned are written with direct I/O when the file system supports it. Device writes, which
+ * go through cuFile, are synchronous.
  */
 class file_sink : public data_sink {
  public:
   explicit file_sink(std::string const& filepath)
-    : _cufile_out(detail::make_cufile_output(filepath))
+    : _file(filepath, O_WRONLY | O_CREAT | O_TRUNC, 0666),
+      _cufile_out(detail::make_cufile_output(filepath))
   {
-    _output_stream.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
-    CUDF_EXPECTS(_output_stream.is_open(), "Cannot open output file");
+#ifdef O_DIRECT
+    // Left closed when the file system does not support direct I/O
+    _direct_fd = open(filepath.c_str(), O_WRONLY | O_DIRECT);
+#endif
   }
 
-  virtual ~file_sink() { flush(); }
+  virtual ~file_sink()
+  {
+    // A destructor cannot report the error of a failed write; flush() reports it
+    try {
+      flush();
+    } catch (...) {
+    }
+    if (_direct_fd != -1) { close(_direct_fd); }
+  }
 
   void host_write(void const* data, size_t size) override
   {
-    _output_stream.seekp(_bytes_written);
-    _output_stream.write(static_cast<char const*>(data), size);
-    _bytes_written += size;
+    auto src = static_cast<uint8_t const*>(data);
+    while (size != 0) {
+      auto const count = std::min(size, write_buffer_size - _buffered_size);
+      std::memcpy(current_buffer() + _buffered_size, src, count);
+      _buffered_size += count;
+      _bytes_written += count;
+      src += count;
+      size -= count;
+      if (_buffered_size == write_buffer_size) { submit_buffer(); }
+    }
   }
 
-  void flush() override { _output_stream.flush(); }
+  void flush() override
+  {
+    submit_buffer();
+    for (auto const& write : _pending) {
+      if (write.valid()) { write.wait(); }
+    }
+    for (auto& write : _pending) {
+      if (write.valid()) { std::exchange(write, {}).get(); }
+    }
+  }
+
+  std::future<void> flush_async() override
+  {
+    submit_buffer();
+    // The writer thread runs the tasks in order, so the pending writes are complete by then
+    return _writer.submit([pending = _pending]() {
+      for (auto const& write : pending) {
+        if (write.valid()) { write.get(); }
+      }
+    });
+  }
 
   size_t bytes_written() override { return _bytes_written; }
 
@@ -60,14 +133,57 @@ class file_sink : public data_sink {
   {
     if (!supports_device_write()) CUDF_FAIL("Device writes are not supported for this file.");
 
+    // The buffered host data precedes the device data in the file
+    submit_buffer();
     _cufile_out->write(gpu_data, _bytes_written, size);
     _bytes_written += size;
   }
 
  private:
-  std::ofstream _output_stream;
-  size_t _bytes_written = 0;
+  /**
+   * @brief Returns the aligned data of the current buffer, once its previous write is complete.
+   */
+  uint8_t* current_buffer()
+  {
+    auto& pending = _pending[_current];
+    if (pending.valid()) { std::exchange(pending, {}).get(); }
+
+    auto& buffer = _buffers[_current];
+    if (buffer.empty()) { buffer.resize(write_buffer_size + direct_io_alignment); }
+    auto const misalignment = reinterpret_cast<uintptr_t>(buffer.data()) % direct_io_alignment;
+    return buffer.data() + (direct_io_alignment - misalignment) % direct_io_alignment;
+  }
+
+  /**
+   * @brief Starts writing the current buffer to the file, and moves on to the next buffer.
+   */
+  void submit_buffer()
+  {
+    if (_buffered_size == 0) { return; }
+    auto const data   = current_buffer();
+    auto const size   = _buffered_size;
+    auto const offset = _bytes_written - _buffered_size;
+    _pending[_current] = _writer
+                           .submit([this, data, size, offset]() {
+                             auto const direct = _direct_fd != -1 &&
+                                                 offset % direct_io_alignment == 0 &&
+                                                 size % direct_io_alignment == 0;
+                             write_all(direct ? _direct_fd : _file.desc(), data, size, offset);
+                           })
+                           .share();
+    _buffered_size = 0;
+    _current       = (_current + 1) % num_write_buffers;
+  }
+
+  detail::file_wrapper _file;
+  int _direct_fd = -1;
   std::unique_ptr<detail::cufile_output_impl> _cufile_out;
+  size_t _bytes_written = 0;
+  std::array<std::vector<uint8_t>, num_write_buffers> _buffers;
+  std::array<std::shared_future<void>, num_write_buffers> _pending;
+  size_t _current       = 0;
+  size_t _buffered_size = 0;
+  detail::thread_pool _writer{1};  // Destroyed first, once the queued writes are complete
 };
 
 /**
@@ -138,6 +254,8 @@ class user_sink_wrapper : public data_sink {
 
   void flush() override { user_sink->flush(); }
 
+  std::future<void> flush_async() override { return user_sink->flush_async(); }
+
   size_t bytes_written() override { return user_sink->bytes_written(); }
 
  private:
@@ -22,6 +22,7 @@
 
 #include <cudf/utilities/error.hpp>
 #include "file_io_utilities.hpp"
+#include "http_source.hpp"
 
 namespace cudf {
 namespace io {
@@ -69,6 +70,9 @@ class file_source : public datasource {
 
   size_t size() const override { return _file.size(); }
 
+  // All file reads are positional, so reads from multiple threads don't interfere
+  bool supports_concurrent_reads() const override { return true; }
+
  protected:
   detail::file_wrapper _file;
 
@@ -154,24 +158,20 @@ class direct_read_source : public file_source {
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     ssize_t const read_size = std::min(size, _file.size() - offset);
 
     std::vector<uint8_t> v(read_size);
-    CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
+    CUDF_EXPECTS(pread(_file.desc(), v.data(), read_size, offset) == read_size, "read failed");
     return buffer::create(std::move(v));
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t *dst) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     auto const read_size = std::min(size, _file.size() - offset);
 
-    CUDF_EXPECTS(read(_file.desc(), dst, read_size) == static_cast<ssize_t>(read_size),
+    CUDF_EXPECTS(pread(_file.desc(), dst, read_size, offset) == static_cast<ssize_t>(read_size),
                  "read failed");
     return read_size;
   }
@@ -200,6 +200,15 @@ class user_datasource_wrapper : public datasource {
 
   bool supports_device_read() const override { return source->supports_device_read(); }
 
+  bool is_device_read_preferred(size_t size) const override
+  {
+    return source->is_device_read_preferred(size);
+  }
+
+  bool supports_concurrent_reads() const override { return source->supports_concurrent_reads(); }
+
+  size_t max_coalesced_gap() const override { return source->max_coalesced_gap(); }
+
   size_t device_read(size_t offset,
                      size_t size,
                      uint8_t *dst,
@@ -227,6 +236,7 @@ std::unique_ptr<datasource> datasource::create(const std::string &filepath,
                                                size_t offset,
                                                size_t size)
 {
+  if (detail::is_http_url(filepath)) { return detail::make_http_source(filepath); }
 #ifdef CUFILE_FOUND
   if (detail::cufile_config::instance()->is_required()) {
     // avoid mmap as GDS is expected to be used for most reads
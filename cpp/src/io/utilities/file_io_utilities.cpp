@@ -14,12 +14,15 @@
  * limitations under the License.
  */
 #include "file_io_utilities.hpp"
+#include "thread_pool.hpp"
 
 #include <rmm/device_buffer.hpp>
 
 #include <dlfcn.h>
 
 #include <fstream>
+#include <future>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -52,6 +55,18 @@ std::string getenv_or(std::string const &env_var_name, std::string const &defaul
   return (env_val == nullptr) ? default_val : std::string(env_val);
 }
 
+size_t getenv_or(std::string const &env_var_name, size_t default_val)
+{
+  auto const env_val = std::getenv(env_var_name.c_str());
+  return (env_val == nullptr) ? default_val : std::stoull(env_val);
+}
+
+size_t cufile_io_base::op_size_threshold()
+{
+  static size_t const threshold = getenv_or("LIBCUDF_CUFILE_THRESHOLD", size_t{128 << 10});
+  return threshold;
+}
+
 #ifdef CUFILE_FOUND
 
 cufile_config::cufile_config() : policy{getenv_or("LIBCUDF_CUFILE_POLICY", default_policy)}
@@ -165,6 +180,76 @@ void cufile_registered_file::register_handle()
 
 cufile_registered_file::~cufile_registered_file() { shim->handle_deregister(cf_handle); }
 
+namespace {
+
+/**
+ * @brief Returns the pool of threads that issue the cuFile calls of all inputs and outputs.
+ */
+thread_pool &cufile_thread_pool()
+{
+  static thread_pool pool(getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", size_t{16}));
+  return pool;
+}
+
+/**
+ * @brief Returns the maximum size of a single cuFile call.
+ */
+size_t cufile_slice_size()
+{
+  static size_t const slice_size = getenv_or("LIBCUDF_CUFILE_SLICE_SIZE", size_t{4 << 20});
+  CUDF_EXPECTS(slice_size > 0, "cuFile slice size must be positive");
+  return slice_size;
+}
+
+/**
+ * @brief Splits an operation on `size` bytes into slices that run concurrently on the cuFile
+ * thread pool.
+ *
+ * @param function Operation on a slice, called with the slice offset and size in bytes; returns
+ * the number of bytes processed, or -1 on error
+ * @param size Total number of bytes to process
+ *
+ * @return Futures with the number of bytes processed by each slice
+ */
+template <typename F>
+std::vector<std::future<ssize_t>> make_sliced_tasks(F function, size_t size)
+{
+  auto const slice_size = cufile_slice_size();
+
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  std::vector<std::future<ssize_t>> slice_tasks;
+  for (size_t pos = 0; pos < size; pos += slice_size) {
+    auto const current_size = std::min(slice_size, size - pos);
+    slice_tasks.push_back(cufile_thread_pool().submit([=] {
+      CUDA_TRY(cudaSetDevice(device_id));
+      return function(pos, current_size);
+    }));
+  }
+  return slice_tasks;
+}
+
+/**
+ * @brief Waits for all slices of an operation.
+ *
+ * @return Total number of bytes processed, or -1 if any slice failed
+ */
+ssize_t wait_for_slices(std::vector<std::future<ssize_t>> &slice_tasks)
+{
+  ssize_t total = 0;
+  for (auto &task : slice_tasks) {
+    auto const slice_result = task.get();
+    if (slice_result < 0 || total < 0) {
+      total = -1;
+    } else {
+      total += slice_result;
+    }
+  }
+  return total;
+}
+
+}  // namespace
+
 cufile_input_impl::cufile_input_impl(std::string const &filepath)
   : shim{cufile_shim::instance()}, cf_file(shim, filepath, O_RDONLY | O_DIRECT)
 {
@@ -175,8 +260,7 @@ std::unique_ptr<datasource::buffer> cufile_input_impl::read(size_t offset,
                                                             rmm::cuda_stream_view stream)
 {
   rmm::device_buffer out_data(size, stream);
-  CUDF_EXPECTS(shim->read(cf_file.handle(), out_data.data(), size, offset, 0) != -1,
-               "cuFile error reading from a file");
+  read(offset, size, static_cast<uint8_t *>(out_data.data()), stream);
 
   return datasource::buffer::create(std::move(out_data));
 }
@@ -186,8 +270,11 @@ size_t cufile_input_impl::read(size_t offset,
                                uint8_t *dst,
                                rmm::cuda_stream_view stream)
 {
-  CUDF_EXPECTS(shim->read(cf_file.handle(), dst, size, offset, 0) != -1,
-               "cuFile error reading from a file");
+  auto read_slice = [this, dst, offset](size_t pos, size_t slice_size) {
+    return shim->read(cf_file.handle(), dst, slice_size, offset + pos, pos);
+  };
+  auto slice_tasks = make_sliced_tasks(read_slice, size);
+  CUDF_EXPECTS(wait_for_slices(slice_tasks) != -1, "cuFile error reading from a file");
   // always read the requested size for now
   return size;
 }
@@ -199,8 +286,11 @@ cufile_output_impl::cufile_output_impl(std::string const &filepath)
 
 void cufile_output_impl::write(void const *data, size_t offset, size_t size)
 {
-  CUDF_EXPECTS(shim->write(cf_file.handle(), data, size, offset, 0) != -1,
-               "cuFile error writing to a file");
+  auto write_slice = [this, data, offset](size_t pos, size_t slice_size) {
+    return shim->write(cf_file.handle(), data, slice_size, offset + pos, pos);
+  };
+  auto slice_tasks = make_sliced_tasks(write_slice, size);
+  CUDF_EXPECTS(wait_for_slices(slice_tasks) != -1, "cuFile error writing to a file");
 }
 #endif
 
@@ -61,16 +61,17 @@ class cufile_io_base {
    * @return Whether a cuFile operation with the given size is expected to be faster than a host
    * read + H2D copy
    */
-  static bool is_cufile_io_preferred(size_t size) { return size > op_size_threshold; }
+  static bool is_cufile_io_preferred(size_t size) { return size > op_size_threshold(); }
 
  protected:
   /**
    * @brief The read/write size above which cuFile is faster then host read + copy
    *
-   * This may not be the optimal threshold for all systems. Derived `is_cufile_io_preferred`
-   * implementations can use a different logic.
+   * Set with the `LIBCUDF_CUFILE_THRESHOLD` environment variable (128KB by default), since the
+   * optimal threshold depends on the system. Derived `is_cufile_io_preferred` implementations can
+   * use a different logic.
    */
-  static constexpr size_t op_size_threshold = 128 << 10;
+  static size_t op_size_threshold();
 };
 
 /**
@@ -190,7 +191,10 @@ struct cufile_registered_file {
 /**
  * @brief Adapter for the `cuFileRead` API.
  *
- * Exposes APIs to read directly from a file into device memory.
+ * Exposes APIs to read directly from a file into device memory. Reads larger than the slice size
+ * (`LIBCUDF_CUFILE_SLICE_SIZE`, 4MB by default) are split into slices that are read concurrently
+ * by a pool of `LIBCUDF_CUFILE_THREAD_COUNT` threads (16 by default), shared by all cuFile inputs
+ * and outputs.
  */
 class cufile_input_impl final : public cufile_input {
  public:
@@ -210,7 +214,8 @@ class cufile_input_impl final : public cufile_input {
 /**
  * @brief Adapter for the `cuFileWrite` API.
  *
- * Exposes an API to write directly into a file from device memory.
+ * Exposes an API to write directly into a file from device memory. Large writes are split into
+ * slices that are written concurrently, like the reads of `cufile_input_impl`.
  */
 class cufile_output_impl final : public cufile_output {
  public:
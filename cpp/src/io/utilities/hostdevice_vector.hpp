@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "pinned_host_pool.hpp"
+
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -57,17 +59,15 @@ class hostdevice_vector {
     : num_elements(initial_size), max_elements(max_size)
   {
     if (max_elements != 0) {
-      CUDA_TRY(cudaMallocHost(&h_data, sizeof(T) * max_elements));
+      h_data = static_cast<T *>(
+        cudf::io::detail::pinned_host_pool::instance().allocate(sizeof(T) * max_elements));
       d_data.resize(sizeof(T) * max_elements, stream);
     }
   }
 
   ~hostdevice_vector()
   {
-    if (max_elements != 0) {
-      auto const free_result = cudaFreeHost(h_data);
-      assert(free_result == cudaSuccess);
-    }
+    if (max_elements != 0) { cudf::io::detail::pinned_host_pool::instance().deallocate(h_data); }
   }
 
   bool insert(const T &data)
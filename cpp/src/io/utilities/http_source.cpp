@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "http_source.hpp"
+#include "thread_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <future>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+
+constexpr char const *http_scheme  = "http://";
+constexpr char const *https_scheme = "https://";
+
+// Reads larger than this are split into parts that are requested concurrently
+constexpr size_t request_part_size = 8 << 20;
+
+// Maximum number of concurrent part requests, and of idle persistent connections
+constexpr size_t max_connections = 16;
+
+// A request costs a round trip, in which a fast connection transfers about this many bytes
+constexpr size_t coalesced_gap = 1 << 20;
+
+constexpr int socket_timeout_seconds = 60;
+constexpr size_t max_header_size     = 64 << 10;
+
+struct http_url {
+  std::string authority;  ///< Host and optional port, as sent in the `Host` header
+  std::string host;
+  std::string port;
+  std::string target;  ///< Path and query of the object
+};
+
+http_url parse_http_url(std::string const &url)
+{
+  CUDF_EXPECTS(url.rfind(http_scheme, 0) == 0, "Only plain http:// URLs are supported: " + url);
+  auto const authority_begin = std::strlen(http_scheme);
+  auto const authority_end   = url.find('/', authority_begin);
+
+  http_url parsed;
+  parsed.authority = url.substr(authority_begin, authority_end - authority_begin);
+  parsed.target    = (authority_end == std::string::npos) ? "/" : url.substr(authority_end);
+  // The port follows the last colon, unless that colon is part of an IPv6 address
+  auto const port_sep = parsed.authority.rfind(':');
+  if (port_sep != std::string::npos && parsed.authority.find(']', port_sep) == std::string::npos) {
+    parsed.host = parsed.authority.substr(0, port_sep);
+    parsed.port = parsed.authority.substr(port_sep + 1);
+  } else {
+    parsed.host = parsed.authority;
+    parsed.port = "80";
+  }
+  if (parsed.host.size() > 2 && parsed.host.front() == '[' && parsed.host.back() == ']') {
+    parsed.host = parsed.host.substr(1, parsed.host.size() - 2);
+  }
+  CUDF_EXPECTS(!parsed.host.empty() && !parsed.port.empty(), "Invalid URL: " + url);
+  return parsed;
+}
+
+/**
+ * @brief Status and headers of an HTTP response; the header names are in lower case
+ */
+struct http_response {
+  int status = 0;
+  std::map<std::string, std::string> headers;
+
+  size_t content_length() const
+  {
+    auto const it = headers.find("content-length");
+    CUDF_EXPECTS(it != headers.end(), "HTTP response without a content length");
+    return std::stoull(it->second);
+  }
+
+  bool keeps_connection() const
+  {
+    auto const it = headers.find("connection");
+    return it == headers.end() || it->second != "close";
+  }
+};
+
+/**
+ * @brief Connection to an HTTP server, which can be reused for several requests
+ */
+class connection {
+ public:
+  explicit connection(http_url const &url)
+  {
+    addrinfo hints{};
+    hints.ai_family     = AF_UNSPEC;
+    hints.ai_socktype   = SOCK_STREAM;
+    addrinfo *addresses = nullptr;
+    CUDF_EXPECTS(getaddrinfo(url.host.c_str(), url.port.c_str(), &hints, &addresses) == 0,
+                 "Cannot resolve host " + url.host);
+    for (auto address = addresses; address != nullptr && _fd < 0; address = address->ai_next) {
+      _fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+      if (_fd >= 0 && connect(_fd, address->ai_addr, address->ai_addrlen) != 0) {
+        close(_fd);
+        _fd = -1;
+      }
+    }
+    freeaddrinfo(addresses);
+    CUDF_EXPECTS(_fd >= 0, "Cannot connect to " + url.authority);
+
+    timeval timeout{socket_timeout_seconds, 0};
+    setsockopt(_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(_fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+  }
+
+  connection(connection const &) = delete;
+  connection &operator=(connection const &) = delete;
+
+  ~connection() { close(_fd); }
+
+  void send_all(std::string const &data)
+  {
+    for (size_t sent = 0; sent < data.size();) {
+      auto const count = send(_fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+      CUDF_EXPECTS(count > 0, "Failed to send the HTTP request");
+      sent += count;
+    }
+  }
+
+  http_response read_response()
+  {
+    http_response response;
+    auto const status_line = read_line();
+    auto const status_pos  = status_line.find(' ');
+    CUDF_EXPECTS(status_line.rfind("HTTP/1.", 0) == 0 && status_pos != std::string::npos,
+                 "Invalid HTTP response");
+    response.status = std::stoi(status_line.substr(status_pos + 1, 3));
+
+    for (auto line = read_line(); !line.empty(); line = read_line()) {
+      auto const sep = line.find(':');
+      if (sep == std::string::npos) { continue; }
+      auto name = line.substr(0, sep);
+      std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) {
+        return std::tolower(c);
+      });
+      auto const value_begin = line.find_first_not_of(' ', sep + 1);
+      response.headers[name] =
+        (value_begin == std::string::npos) ? std::string{} : line.substr(value_begin);
+    }
+    return response;
+  }
+
+  void read_body(uint8_t *dst, size_t size)
+  {
+    auto const buffered = std::min(size, _buffer.size());
+    std::memcpy(dst, _buffer.data(), buffered);
+    _buffer.erase(0, buffered);
+    for (size_t received = buffered; received < size;) {
+      auto const count = recv(_fd, dst + received, size - received, 0);
+      CUDF_EXPECTS(count > 0, "The HTTP response ended before its content");
+      received += count;
+    }
+  }
+
+ private:
+  std::string read_line()
+  {
+    for (auto end = _buffer.find("\r\n");; end = _buffer.find("\r\n")) {
+      if (end != std::string::npos) {
+        auto line = _buffer.substr(0, end);
+        _buffer.erase(0, end + 2);
+        return line;
+      }
+      CUDF_EXPECTS(_buffer.size() < max_header_size, "HTTP response header is too large");
+      char data[4096];
+      auto const count = recv(_fd, data, sizeof(data), 0);
+      CUDF_EXPECTS(count > 0, "Connection closed by the HTTP server");
+      _buffer.append(data, count);
+    }
+  }
+
+  int _fd = -1;
+  std::string _buffer;  ///< Received data that is not consumed yet
+};
+
+/**
+ * @brief Source that reads an object from an HTTP server with ranged `GET` requests
+ */
+class http_source : public datasource {
+ public:
+  explicit http_source(std::string const &url) : _url(parse_http_url(url))
+  {
+    // The size comes from a request of the first byte, as presigned URLs may only allow GET
+    auto request        = send_request(0, 0);
+    auto &conn          = request.first;
+    auto const response = request.second;
+    if (response.status == 206 || response.status == 416) {
+      // "bytes 0-0/<size>", or "bytes */<size>" when the object is empty
+      auto const it = response.headers.find("content-range");
+      CUDF_EXPECTS(it != response.headers.end(), "HTTP response without a content range");
+      auto const sep = it->second.rfind('/');
+      CUDF_EXPECTS(sep != std::string::npos && it->second.compare(sep + 1, 1, "*") != 0,
+                   "Unknown size of the HTTP object");
+      _size = std::stoull(it->second.substr(sep + 1));
+      std::vector<uint8_t> content(response.content_length());
+      conn->read_body(content.data(), content.size());
+      release_connection(std::move(conn), response);
+    } else {
+      CUDF_EXPECTS(response.status != 200, "The HTTP server does not support range requests");
+      CUDF_FAIL("HTTP request failed with status " + std::to_string(response.status));
+    }
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    std::vector<uint8_t> data(offset < _size ? std::min(size, _size - offset) : 0);
+    host_read(offset, data.size(), data.data());
+    return buffer::create(std::move(data));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    if (offset >= _size) { return 0; }
+    auto const read_size = std::min(size, _size - offset);
+    if (read_size <= request_part_size) {
+      read_range(offset, read_size, dst);
+      return read_size;
+    }
+
+    std::vector<std::future<void>> parts;
+    for (size_t part = 0; part < read_size; part += request_part_size) {
+      auto const part_size = std::min(request_part_size, read_size - part);
+      parts.push_back(_pool.submit([this, offset, part, part_size, dst]() {
+        read_range(offset + part, part_size, dst + part);
+      }));
+    }
+    // Rethrow the first error, once no part is writing to `dst` anymore
+    for (auto &part : parts) { part.wait(); }
+    for (auto &part : parts) { part.get(); }
+    return read_size;
+  }
+
+  // Each request uses its own connection
+  bool supports_concurrent_reads() const override { return true; }
+
+  size_t max_coalesced_gap() const override { return coalesced_gap; }
+
+  size_t size() const override { return _size; }
+
+ private:
+  void read_range(size_t offset, size_t size, uint8_t *dst)
+  {
+    auto request        = send_request(offset, offset + size - 1);
+    auto &conn          = request.first;
+    auto const response = request.second;
+    CUDF_EXPECTS(response.status == 206,
+                 "HTTP range request failed with status " + std::to_string(response.status));
+    CUDF_EXPECTS(response.content_length() == size, "Unexpected size of the HTTP response");
+    conn->read_body(dst, size);
+    release_connection(std::move(conn), response);
+  }
+
+  /**
+   * @brief Sends a request for a byte range and reads the header of the response.
+   *
+   * The request is retried once on a new connection if it fails on an idle connection, which the
+   * server may have closed in the meantime.
+   */
+  std::pair<std::unique_ptr<connection>, http_response> send_request(size_t first, size_t last)
+  {
+    auto const request = "GET " + _url.target + " HTTP/1.1\r\nHost: " + _url.authority +
+                         "\r\nRange: bytes=" + std::to_string(first) + "-" + std::to_string(last) +
+                         "\r\nConnection: keep-alive\r\n\r\n";
+    auto conn = take_connection();
+    if (conn != nullptr) {
+      try {
+        conn->send_all(request);
+        auto response = conn->read_response();
+        return {std::move(conn), std::move(response)};
+      } catch (cudf::logic_error const &) {
+        // Retried below on a new connection
+      }
+    }
+    conn = std::make_unique<connection>(_url);
+    conn->send_all(request);
+    auto response = conn->read_response();
+    return {std::move(conn), std::move(response)};
+  }
+
+  std::unique_ptr<connection> take_connection()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_idle.empty()) { return nullptr; }
+    auto conn = std::move(_idle.back());
+    _idle.pop_back();
+    return conn;
+  }
+
+  void release_connection(std::unique_ptr<connection> conn, http_response const &response)
+  {
+    if (!response.keeps_connection()) { return; }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_idle.size() < max_connections) { _idle.push_back(std::move(conn)); }
+  }
+
+  http_url const _url;
+  size_t _size = 0;
+  std::mutex _mutex;  ///< Protects `_idle`
+  std::vector<std::unique_ptr<connection>> _idle;
+  thread_pool _pool{max_connections};  ///< Declared last so that parts finish before the rest
+};
+
+}  // namespace
+
+bool is_http_url(std::string const &path)
+{
+  return path.rfind(http_scheme, 0) == 0 || path.rfind(https_scheme, 0) == 0;
+}
+
+std::unique_ptr<datasource> make_http_source(std::string const &url)
+{
+  return std::make_unique<http_source>(url);
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Returns whether a path is an HTTP URL, to be read with `make_http_source`.
+ */
+bool is_http_url(std::string const &path);
+
+/**
+ * @brief Creates a source that reads an object from an HTTP server with ranged `GET` requests.
+ *
+ * The source keeps a pool of persistent connections. Large reads are split into parts that are
+ * requested concurrently, and the source reports a large `max_coalesced_gap` so that readers merge
+ * nearby byte ranges into a single request. This suits object stores with S3-compatible HTTP
+ * endpoints, read through presigned or public URLs. Only plain `http://` URLs are supported.
+ *
+ * @throw cudf::logic_error if the URL is invalid or if the size of the object cannot be read
+ *
+ * @param url URL of the object
+ *
+ * @return The source
+ */
+std::unique_ptr<datasource> make_http_source(std::string const &url);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <chrono>
+#include <type_traits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Runs `f` as a part of `phase`, and adds its wall time to the phase in `statistics`.
+ *
+ * If `statistics` is null, only runs `f`. Otherwise `stream` is synchronized after `f`, so that the
+ * time includes the kernels launched by `f`.
+ *
+ * @param statistics Statistics to update, or null if they are not collected
+ * @param phase Phase which `f` is a part of
+ * @param stream CUDA stream on which `f` launches its kernels
+ * @param f Function to run
+ * @return The return value of `f`
+ */
+template <typename Function>
+auto time_phase(io_statistics* statistics,
+                io_phase phase,
+                rmm::cuda_stream_view stream,
+                Function&& f)
+{
+  if (statistics == nullptr) { return f(); }
+
+  auto const start = std::chrono::steady_clock::now();
+  auto add_time    = [&]() {
+    stream.synchronize();
+    (*statistics)[phase].time_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      std::chrono::steady_clock::now() - start)
+                                      .count();
+  };
+  if constexpr (std::is_void_v<std::invoke_result_t<Function>>) {
+    f();
+    add_time();
+  } else {
+    auto result = f();
+    add_time();
+    return result;
+  }
+}
+
+/**
+ * @brief Adds the bytes processed and produced by `phase` to `statistics`, if it is not null.
+ *
+ * @param statistics Statistics to update, or null if they are not collected
+ * @param phase Phase which processed the bytes
+ * @param input_bytes Number of bytes processed by the phase
+ * @param output_bytes Number of bytes produced by the phase
+ */
+inline void add_phase_bytes(io_statistics* statistics,
+                            io_phase phase,
+                            size_t input_bytes,
+                            size_t output_bytes)
+{
+  if (statistics == nullptr) { return; }
+  (*statistics)[phase].input_bytes += input_bytes;
+  (*statistics)[phase].output_bytes += output_bytes;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metadata_cache.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <sys/stat.h>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace cudf {
+namespace io {
+
+struct metadata_cache::impl {
+  using entry = std::pair<std::string, std::shared_ptr<void const>>;
+
+  explicit impl(std::size_t capacity) : capacity(capacity) {}
+
+  std::size_t const capacity;
+  std::size_t hits   = 0;
+  std::size_t misses = 0;
+  mutable std::mutex mutex;
+  std::list<entry> entries;  ///< Most recently used first
+  std::unordered_map<std::string, std::list<entry>::iterator> index;
+};
+
+metadata_cache::metadata_cache(std::size_t capacity) : _impl(std::make_unique<impl>(capacity))
+{
+  CUDF_EXPECTS(capacity > 0, "The capacity of the metadata cache must be positive");
+}
+
+metadata_cache::~metadata_cache() = default;
+
+std::size_t metadata_cache::capacity() const { return _impl->capacity; }
+
+std::size_t metadata_cache::size() const
+{
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  return _impl->entries.size();
+}
+
+std::size_t metadata_cache::hits() const
+{
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  return _impl->hits;
+}
+
+std::size_t metadata_cache::misses() const
+{
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  return _impl->misses;
+}
+
+void metadata_cache::clear()
+{
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  _impl->entries.clear();
+  _impl->index.clear();
+}
+
+std::shared_ptr<void const> metadata_cache::get_or_parse(
+  std::string const &key, std::function<std::shared_ptr<void const>()> const &parse)
+{
+  {
+    std::lock_guard<std::mutex> lock(_impl->mutex);
+    auto const it = _impl->index.find(key);
+    if (it != _impl->index.end()) {
+      _impl->entries.splice(_impl->entries.begin(), _impl->entries, it->second);
+      ++_impl->hits;
+      return it->second->second;
+    }
+    ++_impl->misses;
+  }
+
+  // Parse outside of the lock; a concurrent miss on the same key keeps the first inserted entry
+  auto parsed = parse();
+
+  std::lock_guard<std::mutex> lock(_impl->mutex);
+  auto const it = _impl->index.find(key);
+  if (it != _impl->index.end()) { return it->second->second; }
+  _impl->entries.emplace_front(key, parsed);
+  _impl->index.emplace(key, _impl->entries.begin());
+  if (_impl->entries.size() > _impl->capacity) {
+    _impl->index.erase(_impl->entries.back().first);
+    _impl->entries.pop_back();
+  }
+  return parsed;
+}
+
+namespace detail {
+
+std::string make_metadata_cache_key(std::string const &filepath, char const *format)
+{
+  struct stat st;
+  if (stat(filepath.c_str(), &st) == -1) { return {}; }
+  return std::string(format) + ':' + std::to_string(st.st_size) + ':' +
+         std::to_string(st.st_mtim.tv_sec) + '.' + std::to_string(st.st_mtim.tv_nsec) + ':' +
+         filepath;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/metadata_cache.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Returns the key of the cached metadata of a file.
+ *
+ * The key combines the format of the metadata with the path, the size and the modification time
+ * of the file.
+ *
+ * @param filepath Path of the file
+ * @param format Name of the format of the cached metadata
+ *
+ * @return The key, or an empty string if the file cannot be queried
+ */
+std::string make_metadata_cache_key(std::string const &filepath, char const *format);
+
+/**
+ * @brief Returns the metadata of a file from the cache, parsing and caching it on a miss.
+ *
+ * The metadata is parsed without caching it when `cache` is null, when there is no file path, or
+ * when the file cannot be queried.
+ *
+ * @param cache Cache to consult; may be null
+ * @param filepath Path of the file; empty if the source is not a file
+ * @param format Name of the format of the metadata, which is part of the key
+ * @param parse Function returning the parsed metadata of type `T`
+ *
+ * @return The shared, immutable metadata
+ */
+template <typename T, typename Parse>
+std::shared_ptr<T const> get_cached_metadata(metadata_cache *cache,
+                                             std::string const &filepath,
+                                             char const *format,
+                                             Parse &&parse)
+{
+  auto const key =
+    (cache != nullptr && !filepath.empty()) ? make_metadata_cache_key(filepath, format) : "";
+  if (key.empty()) { return std::make_shared<T const>(parse()); }
+  return std::static_pointer_cast<T const>(cache->get_or_parse(
+    key, [&]() { return std::shared_ptr<void const>(std::make_shared<T const>(parse())); }));
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pinned_host_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+
+constexpr size_t default_pool_size = 64 << 20;
+
+// Copies smaller than this are issued directly; the driver stages them just as well
+constexpr size_t staging_slice_size = 4 << 20;
+
+size_t get_pool_size()
+{
+  auto const env_val = std::getenv("LIBCUDF_PINNED_POOL_SIZE");
+  return (env_val == nullptr) ? default_pool_size : std::stoull(env_val);
+}
+
+size_t align_size(size_t size)
+{
+  return (size + pinned_host_pool::alignment - 1) & ~(pinned_host_pool::alignment - 1);
+}
+
+bool is_pinned(void const *ptr)
+{
+  cudaPointerAttributes attributes;
+  if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+    // Older CUDA versions report pageable memory as an error; clear it
+    cudaGetLastError();
+    return false;
+  }
+  return attributes.type == cudaMemoryTypeHost;
+}
+
+/**
+ * @brief Events recorded on a stream after the copies from the bounce buffers.
+ *
+ * On destruction, including when a copy throws, waits for the copies on the stream so that the
+ * bounce buffers are not reused while they are in flight, then destroys the events.
+ */
+class staging_events {
+ public:
+  explicit staging_events(rmm::cuda_stream_view stream) : _stream{stream} {}
+
+  staging_events(staging_events const &) = delete;
+  staging_events &operator=(staging_events const &) = delete;
+
+  ~staging_events()
+  {
+    cudaStreamSynchronize(_stream.value());
+    for (auto event : _events) {
+      if (event != nullptr) { cudaEventDestroy(event); }
+    }
+  }
+
+  /**
+   * @brief Records the event of the bounce buffer `index` on the stream.
+   */
+  void record(size_t index)
+  {
+    if (_events[index] == nullptr) {
+      CUDA_TRY(cudaEventCreateWithFlags(&_events[index], cudaEventDisableTiming));
+    }
+    CUDA_TRY(cudaEventRecord(_events[index], _stream.value()));
+  }
+
+  /**
+   * @brief Waits for the copy from the bounce buffer `index` recorded last.
+   */
+  void wait(size_t index) const { CUDA_TRY(cudaEventSynchronize(_events[index])); }
+
+ private:
+  rmm::cuda_stream_view _stream;
+  std::array<cudaEvent_t, 2> _events{};
+};
+
+}  // namespace
+
+pinned_host_pool &pinned_host_pool::instance()
+{
+  // Never destroyed, since the CUDA runtime may already be shut down at program exit
+  static auto *const pool = new pinned_host_pool(get_pool_size());
+  return *pool;
+}
+
+pinned_host_pool::pinned_host_pool(size_t size) : _size(align_size(size))
+{
+  if (_size == 0) { return; }
+  void *base = nullptr;
+  if (cudaMallocHost(&base, _size) != cudaSuccess) {
+    // Run without the pool rather than failing every reader and writer
+    cudaGetLastError();
+    _size = 0;
+    return;
+  }
+  _base = static_cast<uint8_t *>(base);
+  _free_blocks.emplace(0, _size);
+}
+
+void *pinned_host_pool::allocate(size_t size)
+{
+  auto const aligned_size = align_size(std::max<size_t>(size, 1));
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const block = std::find_if(_free_blocks.begin(), _free_blocks.end(), [&](auto const &b) {
+      return b.second >= aligned_size;
+    });
+    if (block != _free_blocks.end()) {
+      auto const offset    = block->first;
+      auto const remaining = block->second - aligned_size;
+      _free_blocks.erase(block);
+      if (remaining != 0) { _free_blocks.emplace(offset + aligned_size, remaining); }
+      _used_blocks.emplace(offset, aligned_size);
+      return _base + offset;
+    }
+  }
+
+  void *ptr = nullptr;
+  CUDA_TRY(cudaMallocHost(&ptr, size));
+  return ptr;
+}
+
+void pinned_host_pool::deallocate(void *ptr)
+{
+  if (ptr == nullptr) { return; }
+  auto const p = static_cast<uint8_t *>(ptr);
+  if (p < _base || p >= _base + _size) {
+    cudaFreeHost(ptr);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto offset     = static_cast<size_t>(p - _base);
+  auto const used = _used_blocks.find(offset);
+  CUDF_EXPECTS(used != _used_blocks.end(), "Pointer was not allocated from the pinned pool");
+  auto size = used->second;
+  _used_blocks.erase(used);
+
+  // Merge with the adjacent free blocks
+  auto next = _free_blocks.lower_bound(offset);
+  if (next != _free_blocks.end() && next->first == offset + size) {
+    size += next->second;
+    next = _free_blocks.erase(next);
+  }
+  if (next != _free_blocks.begin()) {
+    auto const prev = std::prev(next);
+    if (prev->first + prev->second == offset) {
+      offset = prev->first;
+      size += prev->second;
+      _free_blocks.erase(prev);
+    }
+  }
+  _free_blocks.emplace(offset, size);
+}
+
+void copy_host_to_device(void *dst, void const *src, size_t size, rmm::cuda_stream_view stream)
+{
+  auto const is_src_pinned = is_pinned(src);
+  if (size <= staging_slice_size || is_src_pinned) {
+    CUDA_TRY(cudaMemcpyAsync(dst, src, size, cudaMemcpyHostToDevice, stream.value()));
+    if (!is_src_pinned) { stream.synchronize(); }
+    return;
+  }
+
+  // Double buffering: fill one bounce buffer while the other one is being transferred
+  // The events are declared after the bounce buffers, so that the copies are complete when the
+  // buffers are released to the pool, even on error
+  auto staging = make_pinned_buffer<uint8_t>(2 * staging_slice_size);
+  staging_events slice_copied(stream);
+  for (size_t pos = 0, slice = 0; pos < size; pos += staging_slice_size, ++slice) {
+    auto const bounce     = staging.get() + (slice % 2) * staging_slice_size;
+    auto const slice_size = std::min(staging_slice_size, size - pos);
+    if (slice >= 2) { slice_copied.wait(slice % 2); }
+    std::memcpy(bounce, static_cast<uint8_t const *>(src) + pos, slice_size);
+    CUDA_TRY(cudaMemcpyAsync(static_cast<uint8_t *>(dst) + pos,
+                             bounce,
+                             slice_size,
+                             cudaMemcpyHostToDevice,
+                             stream.value()));
+    slice_copied.record(slice % 2);
+  }
+  // The bounce buffers are released to the pool on return
+  stream.synchronize();
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Process-wide pool of pinned host memory shared by the readers and writers
+ *
+ * The pool is a single pinned allocation, made on first use, whose size in bytes is read from the
+ * `LIBCUDF_PINNED_POOL_SIZE` environment variable (64MB by default; zero disables the pool).
+ * Requests that don't fit in the pool fall back to `cudaMallocHost`, so allocations only fail when
+ * pinned memory is exhausted. All member functions are thread-safe.
+ */
+class pinned_host_pool {
+ public:
+  /**
+   * @brief Returns the process-wide pool.
+   */
+  static pinned_host_pool &instance();
+
+  /**
+   * @brief Allocates pinned host memory.
+   *
+   * @throws cudf::logic_error if the allocation fails
+   *
+   * @param size Number of bytes to allocate
+   *
+   * @return Pointer to the allocated memory, aligned to `alignment` bytes
+   */
+  void *allocate(size_t size);
+
+  /**
+   * @brief Frees memory returned by `allocate`.
+   *
+   * @param ptr Pointer returned by `allocate`; nullptr is ignored
+   */
+  void deallocate(void *ptr);
+
+  /**
+   * @brief Returns the size of the pool in bytes.
+   */
+  size_t size() const { return _size; }
+
+  static constexpr size_t alignment = 256;
+
+ private:
+  explicit pinned_host_pool(size_t size);
+
+  uint8_t *_base = nullptr;
+  size_t _size   = 0;
+  std::mutex _mutex;
+  std::map<size_t, size_t> _free_blocks;            ///< Offset to size of the free blocks
+  std::unordered_map<size_t, size_t> _used_blocks;  ///< Offset to size of the allocated blocks
+};
+
+/**
+ * @brief Deleter that returns memory to the pinned host pool
+ */
+struct pinned_host_deleter {
+  void operator()(void *ptr) const { pinned_host_pool::instance().deallocate(ptr); }
+};
+
+/**
+ * @brief Owning pointer to an array in pinned host memory from the pool
+ */
+template <typename T>
+using pinned_buffer = std::unique_ptr<T, pinned_host_deleter>;
+
+/**
+ * @brief Allocates an uninitialized array of `count` elements from the pinned host pool.
+ */
+template <typename T>
+pinned_buffer<T> make_pinned_buffer(size_t count)
+{
+  auto const ptr = pinned_host_pool::instance().allocate(count * sizeof(T));
+  return pinned_buffer<T>{static_cast<T *>(ptr)};
+}
+
+/**
+ * @brief Copies host memory to device memory through pinned bounce buffers.
+ *
+ * Copies from pageable memory are split into slices that are staged through pinned buffers from
+ * the pool, so that the host-side copy of a slice overlaps the transfer of the previous one.
+ * Copies from pinned memory, and small copies, are issued directly. The function returns once
+ * the source memory can be reused, like `cudaMemcpy` from pageable memory.
+ *
+ * @param dst Device memory to copy to
+ * @param src Host memory to copy from
+ * @param size Number of bytes to copy
+ * @param stream CUDA stream to use
+ */
+void copy_host_to_device(void *dst, void const *src, size_t size, rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prefetch_datasource.hpp"
+#include "pinned_host_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+
+/**
+ * @brief Buffer of pinned host memory, filled by a read that may return fewer bytes than allocated
+ */
+class pinned_host_buffer : public datasource::buffer {
+ public:
+  explicit pinned_host_buffer(size_t capacity)
+    : _data(make_pinned_buffer<uint8_t>(capacity)), _size(capacity)
+  {
+  }
+
+  size_t size() const override { return _size; }
+
+  uint8_t const *data() const override { return _data.get(); }
+
+  uint8_t *mutable_data() { return _data.get(); }
+
+  void shrink(size_t size) { _size = std::min(size, _size); }
+
+ private:
+  pinned_buffer<uint8_t> _data;
+  size_t _size;
+};
+
+/**
+ * @brief Part of the data of a prefetch, which is kept alive by the part
+ */
+class slice_buffer : public datasource::buffer {
+ public:
+  slice_buffer(std::shared_future<std::unique_ptr<datasource::buffer>> data,
+               size_t offset,
+               size_t size)
+    : _data(std::move(data))
+  {
+    auto const &buffer = _data.get();
+    _offset            = std::min(offset, buffer->size());
+    _size              = std::min(size, buffer->size() - _offset);
+  }
+
+  size_t size() const override { return _size; }
+
+  uint8_t const *data() const override { return _data.get()->data() + _offset; }
+
+ private:
+  std::shared_future<std::unique_ptr<datasource::buffer>> _data;
+  size_t _offset;
+  size_t _size;
+};
+
+}  // namespace
+
+async_prefetch_datasource::async_prefetch_datasource(datasource *source, size_t num_threads)
+  : _source(source),
+    _concurrent_reads(source->supports_concurrent_reads()),
+    _pool(_concurrent_reads ? num_threads : 1)
+{
+}
+
+async_prefetch_datasource::~async_prefetch_datasource() = default;
+
+void async_prefetch_datasource::prefetch(std::vector<byte_range> const &ranges,
+                                         rmm::cuda_stream_view stream)
+{
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  auto const max_gap = _source->max_coalesced_gap();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::vector<byte_range> host_ranges;
+  for (auto const &range : ranges) {
+    if (range.size == 0 || _prefetched.count(range.offset) != 0) { continue; }
+
+    auto const is_device = _source->is_device_read_preferred(range.size);
+    if (!is_device && max_gap != 0) {
+      host_ranges.push_back(range);
+      continue;
+    }
+    _prefetched.emplace(range.offset,
+                        std::make_unique<prefetched_range>(prefetched_range{
+                          range.size, is_device, fetch(range, is_device, device_id, stream)}));
+  }
+
+  // Nearby host ranges are fetched together, and each range is served from its part of the data
+  std::sort(host_ranges.begin(), host_ranges.end(), [](auto const &lhs, auto const &rhs) {
+    return lhs.offset < rhs.offset;
+  });
+  host_ranges.erase(std::unique(host_ranges.begin(),
+                                host_ranges.end(),
+                                [](auto const &lhs, auto const &rhs) {
+                                  return lhs.offset == rhs.offset;
+                                }),
+                    host_ranges.end());
+  for (size_t begin = 0; begin < host_ranges.size();) {
+    auto const group_offset = host_ranges[begin].offset;
+    auto group_end          = group_offset + host_ranges[begin].size;
+    auto end                = begin + 1;
+    for (; end < host_ranges.size() && host_ranges[end].offset <= group_end + max_gap; ++end) {
+      group_end = std::max(group_end, host_ranges[end].offset + host_ranges[end].size);
+    }
+
+    if (end == begin + 1) {
+      _prefetched.emplace(group_offset,
+                          std::make_unique<prefetched_range>(prefetched_range{
+                            host_ranges[begin].size,
+                            false,
+                            fetch(host_ranges[begin], false, device_id, stream)}));
+    } else {
+      auto const group =
+        fetch({group_offset, group_end - group_offset}, false, device_id, stream).share();
+      for (auto i = begin; i < end; ++i) {
+        auto const &range = host_ranges[i];
+        auto slice        = std::async(std::launch::deferred,
+                                [group, offset = range.offset - group_offset, size = range.size]() {
+                                  return std::unique_ptr<datasource::buffer>{
+                                    std::make_unique<slice_buffer>(group, offset, size)};
+                                });
+        _prefetched.emplace(range.offset,
+                            std::make_unique<prefetched_range>(
+                              prefetched_range{range.size, false, std::move(slice)}));
+      }
+    }
+    begin = end;
+  }
+}
+
+std::future<std::unique_ptr<datasource::buffer>> async_prefetch_datasource::fetch(
+  byte_range range, bool is_device, int device_id, rmm::cuda_stream_view stream)
+{
+  return _pool.submit([this, range, is_device, device_id, stream]() {
+    CUDA_TRY(cudaSetDevice(device_id));
+    auto const source_lock = lock_source();
+    if (is_device) {
+      auto device_data = _source->device_read(range.offset, range.size, stream);
+      // The prefetch is complete only once the data is in device memory
+      stream.synchronize();
+      return device_data;
+    }
+    auto host_data = std::make_unique<pinned_host_buffer>(range.size);
+    host_data->shrink(_source->host_read(range.offset, range.size, host_data->mutable_data()));
+    return std::unique_ptr<datasource::buffer>{std::move(host_data)};
+  });
+}
+
+std::unique_lock<std::mutex> async_prefetch_datasource::lock_source()
+{
+  return _concurrent_reads ? std::unique_lock<std::mutex>{}
+                           : std::unique_lock<std::mutex>{_source_mutex};
+}
+
+std::unique_ptr<async_prefetch_datasource::prefetched_range> async_prefetch_datasource::take(
+  size_t offset, size_t size)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto it = _prefetched.find(offset);
+  if (it == _prefetched.end() || it->second->size != size) { return nullptr; }
+  auto range = std::move(it->second);
+  _prefetched.erase(it);
+  return range;
+}
+
+std::unique_ptr<datasource::buffer> async_prefetch_datasource::host_read(size_t offset,
+                                                                         size_t size)
+{
+  auto range = take(offset, size);
+  if (range == nullptr) {
+    auto const source_lock = lock_source();
+    return _source->host_read(offset, size);
+  }
+
+  auto data = range->data.get();
+  if (!range->is_device) { return data; }
+
+  std::vector<uint8_t> host_data(data->size());
+  CUDA_TRY(cudaMemcpy(host_data.data(), data->data(), data->size(), cudaMemcpyDeviceToHost));
+  return datasource::buffer::create(std::move(host_data));
+}
+
+size_t async_prefetch_datasource::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  auto range = take(offset, size);
+  if (range == nullptr) {
+    auto const source_lock = lock_source();
+    return _source->host_read(offset, size, dst);
+  }
+
+  auto const data = range->data.get();
+  if (range->is_device) {
+    CUDA_TRY(cudaMemcpy(dst, data->data(), data->size(), cudaMemcpyDeviceToHost));
+  } else {
+    std::memcpy(dst, data->data(), data->size());
+  }
+  return data->size();
+}
+
+std::unique_ptr<datasource::buffer> async_prefetch_datasource::device_read(
+  size_t offset, size_t size, rmm::cuda_stream_view stream)
+{
+  auto range = take(offset, size);
+  if (range == nullptr) {
+    auto const source_lock = lock_source();
+    return _source->device_read(offset, size, stream);
+  }
+
+  auto data = range->data.get();
+  if (range->is_device) { return data; }
+
+  auto device_data = rmm::device_buffer(data->data(), data->size(), stream);
+  // Keep the pinned buffer alive until the copy is complete
+  stream.synchronize();
+  return datasource::buffer::create(std::move(device_data));
+}
+
+size_t async_prefetch_datasource::device_read(size_t offset,
+                                              size_t size,
+                                              uint8_t *dst,
+                                              rmm::cuda_stream_view stream)
+{
+  auto range = take(offset, size);
+  if (range == nullptr) {
+    auto const source_lock = lock_source();
+    return _source->device_read(offset, size, dst, stream);
+  }
+
+  auto const data = range->data.get();
+  CUDA_TRY(cudaMemcpyAsync(dst, data->data(), data->size(), cudaMemcpyDefault, stream.value()));
+  // Keep the prefetched buffer alive until the copy is complete
+  stream.synchronize();
+  return data->size();
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "thread_pool.hpp"
+
+#include <cudf/io/datasource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <future>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Datasource decorator that fetches a set of byte ranges ahead of the reads
+ *
+ * Ranges passed to `prefetch` are read concurrently on a thread pool, either directly to device
+ * memory when the wrapped source prefers device reads for the range size, or into pinned host
+ * memory otherwise. A later read of exactly a prefetched range waits for the prefetch and is served
+ * from its buffer; each prefetched range is served once. All other reads are forwarded to the
+ * wrapped source.
+ *
+ * Host ranges that are separated by at most the `max_coalesced_gap` of the wrapped source are
+ * fetched with a single read, and each of them is served from its part of that read.
+ *
+ * The wrapped source is only accessed from multiple threads if it `supports_concurrent_reads`;
+ * otherwise the ranges are fetched by a single background thread and all source accesses are
+ * serialized.
+ */
+class async_prefetch_datasource : public datasource {
+ public:
+  /**
+   * @brief Byte range of the source
+   */
+  struct byte_range {
+    size_t offset;
+    size_t size;
+  };
+
+  /**
+   * @brief Constructs a decorator around a source.
+   *
+   * @param source Non-owning pointer to the source to read from; must outlive this object
+   * @param num_threads Maximum number of concurrent reads
+   */
+  explicit async_prefetch_datasource(datasource *source, size_t num_threads = 8);
+
+  /**
+   * @brief Waits for the outstanding prefetches and releases the prefetched buffers.
+   */
+  ~async_prefetch_datasource() override;
+
+  /**
+   * @brief Starts fetching the given byte ranges in the background.
+   *
+   * Ranges are submitted in order, so earlier ranges complete first when the number of ranges
+   * exceeds the number of threads. Ranges that are already prefetched are ignored.
+   *
+   * @param ranges Byte ranges to fetch
+   * @param stream CUDA stream to use for device reads
+   */
+  void prefetch(std::vector<byte_range> const &ranges, rmm::cuda_stream_view stream);
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  bool supports_device_read() const override { return _source->supports_device_read(); }
+
+  bool is_device_read_preferred(size_t size) const override
+  {
+    return _source->is_device_read_preferred(size);
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override;
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t *dst,
+                     rmm::cuda_stream_view stream) override;
+
+  size_t size() const override { return _source->size(); }
+
+ private:
+  struct prefetched_range {
+    size_t size;
+    bool is_device;  ///< Whether the buffer is in device memory
+    std::future<std::unique_ptr<buffer>> data;
+  };
+
+  /**
+   * @brief Submits the read of a range to the thread pool.
+   *
+   * @param range Byte range to read
+   * @param is_device Whether to read the range to device memory
+   * @param device_id Device of the reader, made current in the pool thread
+   * @param stream CUDA stream to use for device reads
+   */
+  std::future<std::unique_ptr<buffer>> fetch(byte_range range,
+                                             bool is_device,
+                                             int device_id,
+                                             rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Removes and returns the prefetch of the given range, if any.
+   *
+   * @return The prefetched data, or nullptr if the range was not prefetched
+   */
+  std::unique_ptr<prefetched_range> take(size_t offset, size_t size);
+
+  /**
+   * @brief Returns a lock that serializes access to the source if it doesn't support concurrent
+   * reads; otherwise returns an empty lock.
+   */
+  std::unique_lock<std::mutex> lock_source();
+
+  datasource *const _source;
+  bool const _concurrent_reads;
+  std::mutex _source_mutex;
+  std::mutex _mutex;  ///< Protects `_prefetched`
+  std::map<size_t, std::unique_ptr<prefetched_range>> _prefetched;
+  thread_pool _pool;  ///< Declared last so that tasks finish before the other members are destroyed
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file statistics_filter.cu
+ * @brief Evaluation of row filters against column min/max statistics
+ */
+
+#include "statistics_filter.hpp"
+
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <list>
+#include <map>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the operator equivalent to `op` with its operands swapped
+ */
+ast::ast_operator flip_comparison(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::LESS: return ast::ast_operator::GREATER;
+    case ast::ast_operator::GREATER: return ast::ast_operator::LESS;
+    case ast::ast_operator::LESS_EQUAL: return ast::ast_operator::GREATER_EQUAL;
+    case ast::ast_operator::GREATER_EQUAL: return ast::ast_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+/**
+ * @brief Rewrites a filter over rows into a filter over per-group min/max statistics
+ *
+ * Column `i` of the statistics table is the minimum and column `i + 1` the maximum of the
+ * `i / 2`-th entry of `used_columns()`.
+ */
+class stats_expression_converter {
+ public:
+  explicit stats_expression_converter(std::vector<data_type> const &column_types)
+    : _column_types(column_types)
+  {
+  }
+
+  /**
+   * @brief Converts a node of the filter
+   *
+   * @return The converted expression, or nullptr if the node can't be decided from statistics
+   */
+  ast::expression const *convert(ast::detail::node const &node)
+  {
+    auto const expr = dynamic_cast<ast::expression const *>(&node);
+    if (expr == nullptr) { return nullptr; }
+
+    auto const op       = expr->get_operator();
+    auto const operands = expr->get_operands();
+    switch (op) {
+      case ast::ast_operator::LOGICAL_AND: {
+        auto const lhs = convert(operands[0].get());
+        auto const rhs = convert(operands[1].get());
+        if (lhs == nullptr) { return rhs; }
+        if (rhs == nullptr) { return lhs; }
+        return &add_expression(op, *lhs, *rhs);
+      }
+      case ast::ast_operator::LOGICAL_OR: {
+        auto const lhs = convert(operands[0].get());
+        auto const rhs = convert(operands[1].get());
+        if (lhs == nullptr || rhs == nullptr) { return nullptr; }
+        return &add_expression(op, *lhs, *rhs);
+      }
+      case ast::ast_operator::EQUAL:
+      case ast::ast_operator::NOT_EQUAL:
+      case ast::ast_operator::LESS:
+      case ast::ast_operator::GREATER:
+      case ast::ast_operator::LESS_EQUAL:
+      case ast::ast_operator::GREATER_EQUAL:
+        return convert_comparison(op, operands[0].get(), operands[1].get());
+      default: return nullptr;
+    }
+  }
+
+  /**
+   * @brief Returns the indices of the columns referenced by the converted expression
+   */
+  std::vector<size_type> const &used_columns() const { return _used_columns; }
+
+ private:
+  ast::expression const *convert_comparison(ast::ast_operator op,
+                                            ast::detail::node const &lhs,
+                                            ast::detail::node const &rhs)
+  {
+    auto col = dynamic_cast<ast::column_reference const *>(&lhs);
+    auto lit = dynamic_cast<ast::literal const *>(&rhs);
+    if (col == nullptr || lit == nullptr) {
+      col = dynamic_cast<ast::column_reference const *>(&rhs);
+      lit = dynamic_cast<ast::literal const *>(&lhs);
+      op  = flip_comparison(op);
+    }
+    if (col == nullptr || lit == nullptr) { return nullptr; }
+    if (col->get_table_source() != ast::table_reference::LEFT) { return nullptr; }
+
+    auto const col_idx = col->get_column_index();
+    if (col_idx < 0 || col_idx >= static_cast<size_type>(_column_types.size())) {
+      return nullptr;
+    }
+    auto const type = _column_types[col_idx];
+    if (type.id() == type_id::EMPTY || type != lit->get_data_type()) { return nullptr; }
+
+    auto const stats_idx = get_stats_index(col_idx);
+    auto const &min_ref  = add_column_reference(stats_idx);
+    auto const &max_ref  = add_column_reference(stats_idx + 1);
+    switch (op) {
+      case ast::ast_operator::EQUAL:
+        return &add_expression(
+          ast::ast_operator::LOGICAL_AND,
+          add_expression(ast::ast_operator::LESS_EQUAL, min_ref, *lit),
+          add_expression(ast::ast_operator::GREATER_EQUAL, max_ref, *lit));
+      case ast::ast_operator::NOT_EQUAL:
+        return &add_expression(ast::ast_operator::LOGICAL_OR,
+                               add_expression(ast::ast_operator::NOT_EQUAL, min_ref, *lit),
+                               add_expression(ast::ast_operator::NOT_EQUAL, max_ref, *lit));
+      case ast::ast_operator::LESS:
+      case ast::ast_operator::LESS_EQUAL: return &add_expression(op, min_ref, *lit);
+      case ast::ast_operator::GREATER:
+      case ast::ast_operator::GREATER_EQUAL: return &add_expression(op, max_ref, *lit);
+      default: return nullptr;
+    }
+  }
+
+  size_type get_stats_index(size_type col_idx)
+  {
+    auto it = _stats_index.find(col_idx);
+    if (it == _stats_index.end()) {
+      it = _stats_index.emplace(col_idx, 2 * _used_columns.size()).first;
+      _used_columns.push_back(col_idx);
+    }
+    return it->second;
+  }
+
+  ast::column_reference const &add_column_reference(size_type index)
+  {
+    _col_refs.emplace_back(index);
+    return _col_refs.back();
+  }
+
+  ast::expression const &add_expression(ast::ast_operator op,
+                                        ast::detail::node const &lhs,
+                                        ast::detail::node const &rhs)
+  {
+    _expressions.emplace_back(op, lhs, rhs);
+    return _expressions.back();
+  }
+
+  std::vector<data_type> const &_column_types;
+  std::map<size_type, size_type> _stats_index;
+  std::vector<size_type> _used_columns;
+  // Nodes of the converted expression; lists keep references stable as nodes are added
+  std::list<ast::column_reference> _col_refs;
+  std::list<ast::expression> _expressions;
+};
+
+}  // namespace
+
+std::vector<bool> evaluate_statistics_filter(
+  ast::expression const &filter,
+  std::vector<data_type> const &column_types,
+  size_type num_groups,
+  std::function<minmax_columns(size_type)> const &get_minmax,
+  rmm::cuda_stream_view stream)
+{
+  stats_expression_converter converter(column_types);
+  auto const stats_filter = converter.convert(filter);
+  if (stats_filter == nullptr || num_groups == 0) { return std::vector<bool>(num_groups, true); }
+
+  std::vector<std::unique_ptr<column>> stats_columns;
+  for (auto const col_idx : converter.used_columns()) {
+    auto minmax = get_minmax(col_idx);
+    CUDF_EXPECTS(minmax.first->size() == num_groups && minmax.second->size() == num_groups,
+                 "Statistics columns must have one row per group");
+    stats_columns.push_back(std::move(minmax.first));
+    stats_columns.push_back(std::move(minmax.second));
+  }
+  std::vector<column_view> stats_views;
+  std::transform(stats_columns.cbegin(),
+                 stats_columns.cend(),
+                 std::back_inserter(stats_views),
+                 [](auto const &col) { return col->view(); });
+
+  auto const result = ast::detail::compute_column(table_view{stats_views}, *stats_filter, stream);
+  // BOOL8 values are copied as bytes since std::vector<bool> has no contiguous storage
+  auto const host_result = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>{result->view().data<uint8_t>(), static_cast<size_t>(num_groups)},
+    stream);
+  return std::vector<bool>(host_result.begin(), host_result.end());
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file statistics_filter.hpp
+ * @brief Evaluation of row filters against column min/max statistics
+ */
+
+#pragma once
+
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Columns of minimum and maximum values, one row per group of rows
+ */
+using minmax_columns = std::pair<std::unique_ptr<column>, std::unique_ptr<column>>;
+
+/**
+ * @brief Creates the columns of per-group minimum and maximum values
+ *
+ * @tparam T Representation type of `type`
+ *
+ * @param type Type of the created columns
+ * @param mins Minimum value of each group
+ * @param maxs Maximum value of each group
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The minimum and maximum columns
+ */
+template <typename T>
+minmax_columns make_minmax_columns(data_type type,
+                                   std::vector<T> const &mins,
+                                   std::vector<T> const &maxs,
+                                   rmm::cuda_stream_view stream)
+{
+  auto make_column = [&](std::vector<T> const &values) {
+    auto data = cudf::detail::make_device_uvector_sync(values, stream);
+    return std::make_unique<column>(type, static_cast<size_type>(values.size()), data.release());
+  };
+  return {make_column(mins), make_column(maxs)};
+}
+
+/**
+ * @brief Evaluates a filter expression against per-group column statistics
+ *
+ * Groups are row groups or stripes, depending on the format. The filter is rewritten into an
+ * expression over the min/max values of each group, e.g. `col < x` becomes `min(col) < x`, and
+ * evaluated with the AST interpreter. Comparisons the statistics can't decide (unsupported
+ * operators or column types, missing statistics) are treated as possibly true, so a group is only
+ * rejected when no row in it can match.
+ *
+ * @param filter Filter expression; column references index into `column_types`
+ * @param column_types Type of each column referenced by the filter; EMPTY if the column has no
+ * usable statistics
+ * @param num_groups Number of groups to evaluate
+ * @param get_minmax Returns the min/max columns of a column index with a non-EMPTY type; groups
+ * without statistics must be given the full range of the type
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return For each group, whether it may contain rows that satisfy the filter
+ */
+std::vector<bool> evaluate_statistics_filter(
+  ast::expression const &filter,
+  std::vector<data_type> const &column_types,
+  size_type num_groups,
+  std::function<minmax_columns(size_type)> const &get_minmax,
+  rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
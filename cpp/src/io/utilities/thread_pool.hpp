@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Fixed-size pool of threads that run tasks in submission order
+ *
+ * Tasks that have not started when the pool is destroyed are still run; the destructor returns
+ * once all submitted tasks are complete.
+ */
+class thread_pool {
+ public:
+  /**
+   * @brief Constructs a pool with `num_threads` worker threads (at least one).
+   */
+  explicit thread_pool(size_t num_threads)
+  {
+    num_threads = std::max<size_t>(num_threads, 1);
+    _workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+      _workers.emplace_back([this] { run(); });
+    }
+  }
+
+  thread_pool(thread_pool const &) = delete;
+  thread_pool &operator=(thread_pool const &) = delete;
+
+  ~thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _cv.notify_all();
+    for (auto &worker : _workers) {
+      worker.join();
+    }
+  }
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  size_t size() const { return _workers.size(); }
+
+  /**
+   * @brief Queues a task for execution.
+   *
+   * @param task Callable object with no parameters
+   *
+   * @return Future with the result of the task; exceptions thrown by the task are rethrown by
+   * `get()`
+   */
+  template <typename F>
+  auto submit(F &&task) -> std::future<std::result_of_t<F()>>
+  {
+    using result_type = std::result_of_t<F()>;
+    // std::function requires a copyable target, so the packaged task is shared
+    auto packaged = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(task));
+    auto result   = packaged->get_future();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _tasks.emplace([packaged] { (*packaged)(); });
+    }
+    _cv.notify_one();
+    return result;
+  }
+
+ private:
+  void run()
+  {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _stop || !_tasks.empty(); });
+        if (_tasks.empty()) { return; }
+        task = std::move(_tasks.front());
+        _tasks.pop();
+      }
+      task();
+    }
+  }
+
+  std::vector<std::thread> _workers;
+  std::queue<std::function<void()>> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _stop = false;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
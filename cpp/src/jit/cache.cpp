@@ -20,6 +20,10 @@
 #include <boost/filesystem.hpp>
 #include <jitify2.hpp>
 
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+
 namespace cudf {
 namespace jit {
 
@@ -102,6 +106,29 @@ std::string get_program_cache_dir()
 #endif
 }
 
+/**
+ * @brief Get the value of a numeric environment variable, or a default value if it is not set.
+ */
+std::size_t try_parse_numeric_env_var(char const* const env_name, std::size_t default_val)
+{
+  auto const value = std::getenv(env_name);
+  return value != nullptr ? std::stoull(value) : default_val;
+}
+
+/**
+ * @brief Get the program cache of a preprocessed program, creating it on first use.
+ *
+ * Each cache keeps up to `LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS` kernels in memory, 10,000 by
+ * default. The compiled kernels are also stored in the file cache directory returned by
+ * `get_cache_dir()`, so a new process loads them instead of compiling them again. The file cache
+ * keeps up to `LIBCUDF_KERNEL_CACHE_LIMIT_DISK` kernels per program, 100,000 by default, evicting
+ * the least recently used ones. Setting it to 0 disables the file cache.
+ *
+ * The files are keyed by the program source, the kernel instantiation with its types, and the
+ * compile options, and the directory is specific to the architecture of the device. A directory
+ * populated by running the expected kernels once can therefore be shipped with an application to
+ * avoid any compilation at startup.
+ */
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog)
 {
   static std::mutex caches_mutex{};
@@ -112,9 +139,19 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   auto existing_cache = caches.find(preprog.name());
 
   if (existing_cache == caches.end()) {
+    auto const kernel_limit_proc =
+      try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS", 10'000);
+    auto const kernel_limit_disk =
+      try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK", 100'000);
+
+    // jitify uses the in-memory limit for the files when the disk limit is zero, so disable
+    // the file cache by not providing its path instead
+    auto const cache_path = kernel_limit_disk == 0 ? std::string{} : get_program_cache_dir();
+
     auto res = caches.insert(
       {preprog.name(),
-       std::make_unique<jitify2::ProgramCache<>>(100, preprog, nullptr, get_program_cache_dir())});
+       std::make_unique<jitify2::ProgramCache<>>(
+         kernel_limit_proc, preprog, nullptr, cache_path, kernel_limit_disk)});
 
     existing_cache = res.first;
   }
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief The type of the difference of two `on` values, in which the tolerance is given.
+ */
+template <typename T, typename Enable = void>
+struct asof_distance {
+  using type = T;
+};
+
+template <typename T>
+struct asof_distance<T, std::enable_if_t<cudf::is_timestamp<T>()>> {
+  using type = typename T::duration;
+};
+
+template <typename T>
+constexpr bool is_supported_asof_type()
+{
+  return (cudf::is_numeric<T>() and not std::is_same<T, bool>::value) or cudf::is_chrono<T>();
+}
+
+/**
+ * @brief Matches the sorted left rows with the sorted right rows found before and after them.
+ */
+struct asof_match_fn {
+  template <typename T, CUDF_ENABLE_IF(is_supported_asof_type<T>())>
+  void operator()(table_view const& left_by,
+                  column_view const& left_on,
+                  table_view const& right_by,
+                  column_view const& right_on,
+                  size_type const* lower,
+                  size_type const* upper,
+                  asof_direction direction,
+                  scalar const& tolerance,
+                  null_equality compare_nulls,
+                  size_type const* left_order,
+                  size_type const* right_order,
+                  size_type* result,
+                  rmm::cuda_stream_view stream)
+  {
+    using distance_type = typename asof_distance<T>::type;
+
+    auto const has_tolerance = tolerance.is_valid(stream);
+    CUDF_EXPECTS(not has_tolerance or tolerance.type() == data_type{type_to_id<distance_type>()},
+                 "Mismatch between the tolerance type and the type of the on columns");
+    auto const max_distance =
+      has_tolerance
+        ? static_cast<scalar_type_t<distance_type> const&>(tolerance).value(stream)
+        : distance_type{};
+
+    auto const d_left_by  = table_device_view::create(left_by, stream);
+    auto const d_right_by = table_device_view::create(right_by, stream);
+    auto const d_left_on  = column_device_view::create(left_on, stream);
+    auto const d_right_on = column_device_view::create(right_on, stream);
+    auto const right_rows = right_on.size();
+
+    auto const by_equal = row_equality_comparator<true>(
+      *d_left_by, *d_right_by, compare_nulls == null_equality::EQUAL);
+
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      left_on.size(),
+      [left_on  = *d_left_on,
+       right_on = *d_right_on,
+       by_equal,
+       right_rows,
+       lower,
+       upper,
+       direction,
+       has_tolerance,
+       max_distance,
+       left_order,
+       right_order,
+       result] __device__(size_type row) {
+        auto const value    = left_on.element<T>(row);
+        auto const distance = [&](size_type right_row) {
+          auto const right_value = right_on.element<T>(right_row);
+          return static_cast<distance_type>(value < right_value ? right_value - value
+                                                                : value - right_value);
+        };
+        auto const matches = [&](size_type right_row) {
+          return right_row >= 0 and right_row < right_rows and right_on.is_valid(right_row) and
+                 by_equal(row, right_row) and
+                 (not has_tolerance or not(max_distance < distance(right_row)));
+        };
+
+        auto match = JoinNoneValue;
+        if (left_on.is_valid(row)) {
+          auto const backward         = upper == nullptr ? JoinNoneValue : upper[row] - 1;
+          auto const forward          = lower == nullptr ? JoinNoneValue : lower[row];
+          auto const backward_matches = direction != asof_direction::FORWARD and matches(backward);
+          auto const forward_matches  = direction != asof_direction::BACKWARD and matches(forward);
+          if (backward_matches and forward_matches) {
+            match = distance(forward) < distance(backward) ? forward : backward;
+          } else if (backward_matches) {
+            match = backward;
+          } else if (forward_matches) {
+            match = forward;
+          }
+        }
+        result[left_order[row]] = match == JoinNoneValue ? JoinNoneValue : right_order[match];
+      });
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not is_supported_asof_type<T>())>
+  void operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported type of the on columns");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(table_view const& left_by,
+                                                          column_view const& left_on,
+                                                          table_view const& right_by,
+                                                          column_view const& right_on,
+                                                          asof_direction direction,
+                                                          scalar const& tolerance,
+                                                          null_equality compare_nulls,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_by.num_columns() == right_by.num_columns(),
+               "Mismatch in number of by columns");
+  CUDF_EXPECTS(std::equal(std::cbegin(right_by),
+                          std::cend(right_by),
+                          std::cbegin(left_by),
+                          std::cend(left_by),
+                          [](const auto& r, const auto& l) { return r.type() == l.type(); }),
+               "Mismatch in by column data types");
+  CUDF_EXPECTS(left_on.type() == right_on.type(), "Mismatch in on column data types");
+  CUDF_EXPECTS(left_by.num_columns() == 0 or left_by.num_rows() == left_on.size(),
+               "Mismatch in number of left rows");
+  CUDF_EXPECTS(right_by.num_columns() == 0 or right_by.num_rows() == right_on.size(),
+               "Mismatch in number of right rows");
+
+  auto result = std::make_unique<rmm::device_uvector<size_type>>(left_on.size(), stream, mr);
+  if (left_on.is_empty()) { return result; }
+  if (right_on.is_empty()) {
+    thrust::fill(rmm::exec_policy(stream), result->begin(), result->end(), JoinNoneValue);
+    return result;
+  }
+
+  // Sorting on the by keys, then on the on values, lays out the rows of each by key in order of
+  // their on values; nulls of the on values sort last so that backward matches skip them
+  auto keys = [](table_view const& by, column_view const& on) {
+    std::vector<column_view> columns(by.begin(), by.end());
+    columns.push_back(on);
+    return table_view{columns};
+  };
+  auto const left_keys  = keys(left_by, left_on);
+  auto const right_keys = keys(right_by, right_on);
+  std::vector<order> const column_order(left_keys.num_columns(), order::ASCENDING);
+  std::vector<null_order> null_precedence(left_keys.num_columns(), null_order::BEFORE);
+  null_precedence.back() = null_order::AFTER;
+
+  auto const temp_mr = cudf::get_current_temp_resource();
+  auto const left_order =
+    detail::sorted_order(left_keys, column_order, null_precedence, stream, temp_mr);
+  auto const right_order =
+    detail::stable_sorted_order(right_keys, column_order, null_precedence, stream, temp_mr);
+  auto const sorted_left = detail::gather(left_keys,
+                                          left_order->view(),
+                                          out_of_bounds_policy::DONT_CHECK,
+                                          negative_index_policy::NOT_ALLOWED,
+                                          stream,
+                                          temp_mr);
+  auto const sorted_right = detail::gather(right_keys,
+                                           right_order->view(),
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           negative_index_policy::NOT_ALLOWED,
+                                           stream,
+                                           temp_mr);
+
+  // The right rows before and after each left row, found by merging the sorted tables
+  auto const lower =
+    direction == asof_direction::BACKWARD
+      ? nullptr
+      : detail::lower_bound(
+          *sorted_right, *sorted_left, column_order, null_precedence, sorted::YES, stream, temp_mr);
+  auto const upper =
+    direction == asof_direction::FORWARD
+      ? nullptr
+      : detail::upper_bound(
+          *sorted_right, *sorted_left, column_order, null_precedence, sorted::YES, stream, temp_mr);
+
+  std::vector<size_type> by_columns(left_by.num_columns());
+  std::iota(by_columns.begin(), by_columns.end(), 0);
+  auto const on_column = left_by.num_columns();
+  type_dispatcher(left_on.type(),
+                  asof_match_fn{},
+                  sorted_left->select(by_columns),
+                  sorted_left->get_column(on_column).view(),
+                  sorted_right->select(by_columns),
+                  sorted_right->get_column(on_column).view(),
+                  lower ? lower->view().data<size_type>() : nullptr,
+                  upper ? upper->view().data<size_type>() : nullptr,
+                  direction,
+                  tolerance,
+                  compare_nulls,
+                  left_order->view().data<size_type>(),
+                  right_order->view().data<size_type>(),
+                  result->data(),
+                  stream);
+
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(table_view const& left_by,
+                                                          column_view const& left_on,
+                                                          table_view const& right_by,
+                                                          column_view const& right_on,
+                                                          asof_direction direction,
+                                                          scalar const& tolerance,
+                                                          null_equality compare_nulls,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::asof_join(left_by,
+                           left_on,
+                           right_by,
+                           right_on,
+                           direction,
+                           tolerance,
+                           compare_nulls,
+                           stream,
+                           mr);
+}
+
+}  // namespace cudf
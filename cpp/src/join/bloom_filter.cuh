@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+
+constexpr int BLOOM_FILTER_BLOCK_WORDS          = 8;
+constexpr int DEFAULT_BLOOM_FILTER_BITS_PER_KEY = 16;
+
+/**
+ * @brief View of a blocked Bloom filter of 32-bit hash values.
+ *
+ * The filter is an array of blocks of `BLOOM_FILTER_BLOCK_WORDS` 32-bit words. A hash value
+ * selects one block, and sets or tests one bit in every word of the block, so a test loads a
+ * single 32-byte block. The bits are selected with the salts of the split block Bloom filters of
+ * Parquet.
+ *
+ * A view of no blocks is the filter of every hash value, so that probes with the filter disabled
+ * don't test anything.
+ */
+class bloom_filter_view {
+ public:
+  bloom_filter_view() = default;
+
+  /**
+   * @brief Constructs a view of the filter of `num_blocks` blocks in `words`.
+   */
+  bloom_filter_view(uint32_t* words, size_type num_blocks) : _words{words}, _num_blocks{num_blocks}
+  {
+  }
+
+  /**
+   * @brief Returns the number of blocks of a filter of `num_keys` keys.
+   */
+  static size_type num_blocks_for(size_type num_keys)
+  {
+    constexpr int64_t block_bits = BLOOM_FILTER_BLOCK_WORDS * 32;
+    auto const bits = static_cast<int64_t>(num_keys) * DEFAULT_BLOOM_FILTER_BITS_PER_KEY;
+    return static_cast<size_type>(std::max<int64_t>((bits + block_bits - 1) / block_bits, 1));
+  }
+
+  __host__ __device__ size_type num_blocks() const { return _num_blocks; }
+
+  /**
+   * @brief Returns the words of the filter, `BLOOM_FILTER_BLOCK_WORDS` per block.
+   */
+  __host__ __device__ uint32_t* data() const { return _words; }
+
+  /**
+   * @brief Adds `hash_value` to the filter.
+   */
+  __device__ void insert(uint32_t hash_value) const
+  {
+    auto const block = _words + block_offset(hash_value);
+#pragma unroll
+    for (int i = 0; i < BLOOM_FILTER_BLOCK_WORDS; ++i) {
+      atomicOr(block + i, word_mask(hash_value, i));
+    }
+  }
+
+  /**
+   * @brief Returns `false` if `hash_value` was never added to the filter.
+   */
+  __device__ bool contains(uint32_t hash_value) const
+  {
+    if (_num_blocks == 0) { return true; }
+    auto const block = _words + block_offset(hash_value);
+    bool found       = true;
+#pragma unroll
+    for (int i = 0; i < BLOOM_FILTER_BLOCK_WORDS; ++i) {
+      auto const mask = word_mask(hash_value, i);
+      found           = found && (block[i] & mask) == mask;
+    }
+    return found;
+  }
+
+ private:
+  __device__ size_type block_offset(uint32_t hash_value) const
+  {
+    return static_cast<size_type>(hash_value % static_cast<uint32_t>(_num_blocks)) *
+           BLOOM_FILTER_BLOCK_WORDS;
+  }
+
+  /**
+   * @brief Returns the bit of word `i` of a block for `hash_value`, selected by the high bits of
+   * the salted hash value, which are independent of the low bits selecting the block.
+   */
+  __device__ static uint32_t word_mask(uint32_t hash_value, int i)
+  {
+    uint32_t const salts[BLOOM_FILTER_BLOCK_WORDS] = {0x47b6137bU,
+                                                     0x44974d91U,
+                                                     0x8824ad5bU,
+                                                     0xa2b7289dU,
+                                                     0x705495c7U,
+                                                     0x2df1424bU,
+                                                     0x9efc4947U,
+                                                     0x5c6bfb31U};
+    return 1U << ((hash_value * salts[i]) >> 27);
+  }
+
+  uint32_t* _words{nullptr};
+  size_type _num_blocks{0};
+};
+
+}  // namespace detail
+}  // namespace cudf
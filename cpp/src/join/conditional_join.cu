@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/conditional_join_kernels.cuh>
+#include <join/hash_join.cuh>
+#include <join/join_common_utils.hpp>
+
+#include <cudf/ast/detail/linearizer.hpp>
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/join.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Computes the join operation between two tables on a condition and returns the output
+ * indices of the left and right tables.
+ *
+ * @param left Table of left columns to join
+ * @param right Table of right columns to join
+ * @param binary_predicate The condition on which to join
+ * @param JoinKind The type of join to be performed
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors
+ *
+ * @return Join output indices vector pair
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+get_conditional_join_indices(table_view const& left,
+                             table_view const& right,
+                             ast::expression const& binary_predicate,
+                             join_kind JoinKind,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  // Linearize the AST, which also checks that the column references and types are valid
+  auto const expr_linearizer = ast::detail::linearizer(binary_predicate, left, right);
+  CUDF_EXPECTS(expr_linearizer.root_data_type() == data_type{type_id::BOOL8},
+               "The join condition must produce a boolean output");
+
+  // Trivial left join case - exit early
+  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) {
+    return get_trivial_left_join_indices(left, stream, mr);
+  }
+  if (left.num_rows() == 0 || right.num_rows() == 0) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  auto const device_plan_data = make_device_ast_plan(expr_linearizer, stream);
+  auto const& device_plan     = device_plan_data.second;
+
+  auto left_table  = table_device_view::create(left, stream);
+  auto right_table = table_device_view::create(right, stream);
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  auto const shmem_size_per_block = join_condition_shmem_size(device_plan, block_size);
+
+  // The nested loop evaluates every pair of rows, so the output size is exact
+  int numBlocks{-1};
+  CUDA_TRY(
+    cudaOccupancyMaxActiveBlocksPerMultiprocessor(&numBlocks,
+                                                  compute_conditional_join_output_size<block_size>,
+                                                  block_size,
+                                                  shmem_size_per_block));
+  int device_id{-1};
+  CUDA_TRY(cudaGetDevice(&device_id));
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device_id));
+
+  rmm::device_scalar<int64_t> size(0, stream);
+  compute_conditional_join_output_size<block_size>
+    <<<numBlocks * num_sms, block_size, shmem_size_per_block, stream.value()>>>(
+      *left_table, *right_table, JoinKind, device_plan, size.data());
+  CHECK_CUDA(stream.value());
+
+  auto const join_size = size.value(stream);
+  CUDF_EXPECTS(join_size < static_cast<int64_t>(std::numeric_limits<cudf::size_type>::max()),
+               "Maximum join output size exceeded");
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  if (join_size == 0) { return std::make_pair(std::move(left_indices), std::move(right_indices)); }
+
+  rmm::device_scalar<size_type> write_index(0, stream);
+  detail::grid_1d config(left_table->num_rows(), block_size);
+  conditional_join<block_size, DEFAULT_JOIN_CACHE_SIZE>
+    <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+      *left_table,
+      *right_table,
+      JoinKind,
+      device_plan,
+      left_indices->data(),
+      right_indices->data(),
+      write_index.data(),
+      static_cast<cudf::size_type>(join_size));
+  CHECK_CUDA(stream.value());
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_inner_join(table_view const& left,
+                       table_view const& right,
+                       ast::expression const& binary_predicate,
+                       rmm::cuda_stream_view stream,
+                       rmm::mr::device_memory_resource* mr)
+{
+  return get_conditional_join_indices(
+    left, right, binary_predicate, join_kind::INNER_JOIN, stream, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_left_join(table_view const& left,
+                      table_view const& right,
+                      ast::expression const& binary_predicate,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  return get_conditional_join_indices(
+    left, right, binary_predicate, join_kind::LEFT_JOIN, stream, mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_inner_join(table_view const& left,
+                       table_view const& right,
+                       ast::expression const& binary_predicate,
+                       rmm::cuda_stream_view stream,
+                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::conditional_inner_join(left, right, binary_predicate, stream, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_left_join(table_view const& left,
+                      table_view const& right,
+                      ast::expression const& binary_predicate,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::conditional_left_join(left, right, binary_predicate, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <join/join_common_utils.hpp>
+#include <join/join_kernels.cuh>
+
+#include <cudf/ast/detail/linearizer.hpp>
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cub/cub.cuh>
+
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Device pointers to a linearized AST expression
+ */
+struct device_ast_plan {
+  const ast::detail::device_data_reference* data_references;
+  const cudf::detail::fixed_width_scalar_device_view_base* literals;
+  const ast::ast_operator* operators;
+  const cudf::size_type* operator_source_indices;
+  cudf::size_type num_data_references;
+  cudf::size_type num_operators;
+  cudf::size_type num_intermediates;
+};
+
+/**
+ * @brief Copies the linearized join condition to device memory.
+ *
+ * @param expr_linearizer The linearized join condition
+ * @param stream CUDA stream used for device memory operations
+ *
+ * @return The device buffer holding the condition and the device pointers into it
+ */
+inline std::pair<rmm::device_buffer, device_ast_plan> make_device_ast_plan(
+  ast::detail::linearizer const& expr_linearizer, rmm::cuda_stream_view stream)
+{
+  auto const& data_references = expr_linearizer.data_references();
+  auto const& operators       = expr_linearizer.operators();
+
+  auto plan = ast::detail::ast_plan();
+  plan.add_to_plan(data_references);
+  plan.add_to_plan(expr_linearizer.literals());
+  plan.add_to_plan(operators);
+  plan.add_to_plan(expr_linearizer.operator_source_indices());
+  auto const host_data_buffer = plan.get_host_data_buffer();
+  auto const buffer_offsets   = plan.get_offsets();
+  auto device_data_buffer =
+    rmm::device_buffer(host_data_buffer.first.get(), host_data_buffer.second, stream);
+  // The host buffer must outlive the copy
+  stream.synchronize();
+
+  auto const device_data_buffer_ptr = static_cast<const char*>(device_data_buffer.data());
+  device_ast_plan const device_plan{
+    reinterpret_cast<const ast::detail::device_data_reference*>(device_data_buffer_ptr +
+                                                                buffer_offsets[0]),
+    reinterpret_cast<const cudf::detail::fixed_width_scalar_device_view_base*>(
+      device_data_buffer_ptr + buffer_offsets[1]),
+    reinterpret_cast<const ast::ast_operator*>(device_data_buffer_ptr + buffer_offsets[2]),
+    reinterpret_cast<const cudf::size_type*>(device_data_buffer_ptr + buffer_offsets[3]),
+    static_cast<cudf::size_type>(data_references.size()),
+    static_cast<cudf::size_type>(operators.size()),
+    expr_linearizer.intermediate_count()};
+  return std::make_pair(std::move(device_data_buffer), device_plan);
+}
+
+/**
+ * @brief Returns the dynamic shared memory size per block needed to keep the intermediates of
+ * the join condition of each thread.
+ *
+ * @throw cudf::logic_error if the intermediates don't fit in shared memory
+ *
+ * @param plan The linearized join condition
+ * @param block_size The number of threads per block
+ */
+inline int join_condition_shmem_size(device_ast_plan const& plan, int block_size)
+{
+  auto const shmem_size_per_block =
+    static_cast<int>(sizeof(std::int64_t) * plan.num_intermediates * block_size);
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  int shmem_limit_per_block;
+  CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
+  // Half of the shared memory is left for the output cache of the join kernels
+  CUDF_EXPECTS(shmem_size_per_block <= shmem_limit_per_block / 2,
+               "The join condition has too many intermediate values");
+  return shmem_size_per_block;
+}
+
+/**
+ * @brief Evaluates the boolean join condition of `plan` for a pair of rows.
+ *
+ * A pair of rows for which any of the columns referenced by the condition is null doesn't satisfy
+ * the condition.
+ *
+ * @param left_table The left table
+ * @param right_table The right table
+ * @param left_row_index The row index of the left table
+ * @param right_row_index The row index of the right table
+ * @param plan The linearized join condition
+ * @param thread_intermediate_storage This thread's portion of shared memory for intermediates
+ *
+ * @return Whether the rows satisfy the condition
+ */
+__device__ __forceinline__ bool evaluate_join_condition(table_device_view const& left_table,
+                                                        table_device_view const& right_table,
+                                                        cudf::size_type left_row_index,
+                                                        cudf::size_type right_row_index,
+                                                        device_ast_plan const& plan,
+                                                        std::int64_t* thread_intermediate_storage)
+{
+  for (cudf::size_type i = 0; i < plan.num_data_references; ++i) {
+    auto const& data_reference = plan.data_references[i];
+    if (data_reference.reference_type != ast::detail::device_data_reference_type::COLUMN) {
+      continue;
+    }
+    if (data_reference.table_source == ast::table_reference::LEFT &&
+        left_table.column(data_reference.data_index).is_null(left_row_index)) {
+      return false;
+    }
+    if (data_reference.table_source == ast::table_reference::RIGHT &&
+        right_table.column(data_reference.data_index).is_null(right_row_index)) {
+      return false;
+    }
+  }
+
+  std::int64_t result = 0;
+  auto const evaluator = ast::detail::row_evaluator(
+    left_table, right_table, right_row_index, plan.literals, thread_intermediate_storage, &result);
+  ast::detail::evaluate_row_expression(evaluator,
+                                       plan.data_references,
+                                       plan.operators,
+                                       plan.operator_source_indices,
+                                       plan.num_operators,
+                                       left_row_index);
+  bool is_match;
+  memcpy(&is_match, &result, sizeof(bool));
+  return is_match;
+}
+
+/**
+ * @brief Computes the output size of joining the left table to the right table on a condition.
+ *
+ * This method uses a nested loop to iterate over the left and right tables and count the number of
+ * pairs of rows that satisfy the condition.
+ *
+ * @tparam block_size The number of threads per block for this kernel
+ *
+ * @param[in] left_table The left table
+ * @param[in] right_table The right table
+ * @param[in] JoinKind The type of join to be performed
+ * @param[in] plan The linearized join condition
+ * @param[out] output_size The resulting output size
+ */
+template <int block_size>
+__global__ void compute_conditional_join_output_size(table_device_view left_table,
+                                                     table_device_view right_table,
+                                                     join_kind JoinKind,
+                                                     device_ast_plan plan,
+                                                     int64_t* output_size)
+{
+  extern __shared__ std::int64_t intermediate_storage[];
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * plan.num_intermediates];
+
+  int64_t thread_counter{0};
+  const cudf::size_type left_start_idx = threadIdx.x + blockIdx.x * blockDim.x;
+  const cudf::size_type left_stride    = blockDim.x * gridDim.x;
+  const cudf::size_type left_num_rows  = left_table.num_rows();
+  const cudf::size_type right_num_rows = right_table.num_rows();
+
+  for (cudf::size_type left_row_index = left_start_idx; left_row_index < left_num_rows;
+       left_row_index += left_stride) {
+    bool found_match = false;
+    for (cudf::size_type right_row_index = 0; right_row_index < right_num_rows; right_row_index++) {
+      if (evaluate_join_condition(left_table,
+                                  right_table,
+                                  left_row_index,
+                                  right_row_index,
+                                  plan,
+                                  thread_intermediate_storage)) {
+        ++thread_counter;
+        found_match = true;
+      }
+    }
+    if ((JoinKind == join_kind::LEFT_JOIN) && (!found_match)) { ++thread_counter; }
+  }
+
+  using BlockReduce = cub::BlockReduce<int64_t, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  int64_t block_counter = BlockReduce(temp_storage).Sum(thread_counter);
+
+  // Add block counter to global counter
+  if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
+}
+
+/**
+ * @brief Performs a nested loop join to find all pairs of rows of the left and right tables that
+ * satisfy a condition, and generates the output for the desired Join operation.
+ *
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam output_cache_size The side of the shared memory buffer to cache join
+ * output results
+ *
+ * @param[in] left_table The left table
+ * @param[in] right_table The right table
+ * @param[in] JoinKind The type of join to be performed
+ * @param[in] plan The linearized join condition
+ * @param[out] join_output_l The left result of the join operation
+ * @param[out] join_output_r The right result of the join operation
+ * @param[in,out] current_idx A global counter used by threads to coordinate
+ * writes to the global output
+ * @param[in] max_size The maximum size of the output
+ */
+template <cudf::size_type block_size, cudf::size_type output_cache_size>
+__global__ void conditional_join(table_device_view left_table,
+                                 table_device_view right_table,
+                                 join_kind JoinKind,
+                                 device_ast_plan plan,
+                                 cudf::size_type* join_output_l,
+                                 cudf::size_type* join_output_r,
+                                 cudf::size_type* current_idx,
+                                 const cudf::size_type max_size)
+{
+  constexpr int num_warps = block_size / detail::warp_size;
+  __shared__ cudf::size_type current_idx_shared[num_warps];
+  __shared__ cudf::size_type join_shared_l[num_warps][output_cache_size];
+  __shared__ cudf::size_type join_shared_r[num_warps][output_cache_size];
+
+  extern __shared__ std::int64_t intermediate_storage[];
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * plan.num_intermediates];
+
+  const int warp_id                    = threadIdx.x / detail::warp_size;
+  const int lane_id                    = threadIdx.x % detail::warp_size;
+  const cudf::size_type left_num_rows  = left_table.num_rows();
+  const cudf::size_type right_num_rows = right_table.num_rows();
+
+  if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
+
+  __syncwarp();
+
+  cudf::size_type left_row_index = threadIdx.x + blockIdx.x * blockDim.x;
+
+  const unsigned int activemask = __ballot_sync(0xffffffff, left_row_index < left_num_rows);
+  if (left_row_index < left_num_rows) {
+    bool found_match = false;
+    for (size_type right_row_index(0); right_row_index < right_num_rows; right_row_index++) {
+      if (evaluate_join_condition(left_table,
+                                  right_table,
+                                  left_row_index,
+                                  right_row_index,
+                                  plan,
+                                  thread_intermediate_storage)) {
+        found_match = true;
+        add_pair_to_cache(left_row_index,
+                          right_row_index,
+                          current_idx_shared,
+                          warp_id,
+                          join_shared_l[warp_id],
+                          join_shared_r[warp_id]);
+      }
+
+      __syncwarp(activemask);
+      // flush output cache if next iteration does not fit
+      if (current_idx_shared[warp_id] + detail::warp_size >= output_cache_size) {
+        flush_output_cache<num_warps, output_cache_size>(activemask,
+                                                         max_size,
+                                                         warp_id,
+                                                         lane_id,
+                                                         current_idx,
+                                                         current_idx_shared,
+                                                         join_shared_l,
+                                                         join_shared_r,
+                                                         join_output_l,
+                                                         join_output_r);
+        __syncwarp(activemask);
+        if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
+        __syncwarp(activemask);
+      }
+    }
+
+    // If performing a LEFT join and no match was found, insert a Null into the output
+    if ((JoinKind == join_kind::LEFT_JOIN) && (!found_match)) {
+      add_pair_to_cache(left_row_index,
+                        static_cast<cudf::size_type>(JoinNoneValue),
+                        current_idx_shared,
+                        warp_id,
+                        join_shared_l[warp_id],
+                        join_shared_r[warp_id]);
+    }
+
+    // final flush of output cache
+    if (current_idx_shared[warp_id] > 0) {
+      flush_output_cache<num_warps, output_cache_size>(activemask,
+                                                       max_size,
+                                                       warp_id,
+                                                       lane_id,
+                                                       current_idx,
+                                                       current_idx_shared,
+                                                       join_shared_l,
+                                                       join_shared_r,
+                                                       join_output_l,
+                                                       join_output_r);
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -74,10 +74,11 @@ std::unique_ptr<cudf::table> cross_join(
 
 std::unique_ptr<cudf::table> cross_join(cudf::table_view const& left,
                                         cudf::table_view const& right,
+                                        rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::cross_join(left, right, rmm::cuda_stream_default, mr);
+  return detail::cross_join(left, right, stream, mr);
 }
 
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,19 +13,29 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/uninitialized_fill.h>
 #include <join/hash_join.cuh>
-#include <structs/utilities.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <numeric>
 
 namespace cudf {
@@ -79,7 +89,7 @@ struct valid_range {
  * and the second one contains values from 0 to right_table_row_count - 1
  * excluding those found in the right_indices column.
  *
- * @param right_indices Vector of indices
+ * @param right_indices Right indices of the left join
  * @param left_table_row_count Number of rows of left table
  * @param right_table_row_count Number of rows of right table
  * @param stream CUDA stream used for device memory operations and kernel launches.
@@ -89,7 +99,7 @@ struct valid_range {
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 get_left_join_indices_complement(
-  std::unique_ptr<rmm::device_uvector<size_type>> &right_indices,
+  device_span<size_type const> right_indices,
   size_type left_table_row_count,
   size_type right_table_row_count,
   rmm::cuda_stream_view stream,
@@ -125,9 +135,9 @@ get_left_join_indices_complement(
     // Thus specifying that those locations are valid
     thrust::scatter_if(rmm::exec_policy(stream),
                        thrust::make_constant_iterator(0),
-                       thrust::make_constant_iterator(0) + right_indices->size(),
-                       right_indices->begin(),      // Index locations
-                       right_indices->begin(),      // Stencil - Check if index location is valid
+                       thrust::make_constant_iterator(0) + right_indices.size(),
+                       right_indices.begin(),       // Index locations
+                       right_indices.begin(),       // Stencil - Check if index location is valid
                        invalid_index_map->begin(),  // Output indices
                        valid);                      // Stencil Predicate
     size_type begin_counter = static_cast<size_type>(0);
@@ -164,11 +174,15 @@ get_left_join_indices_complement(
  * @param build Table of columns used to build join hash.
  * @param compare_nulls Controls whether null join-key values should match or not.
  * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param desired_occupancy The percentage of the hash table slots filled by the `build` rows.
  *
  * @return Built hash table.
  */
-std::unique_ptr<multimap_type, std::function<void(multimap_type *)>> build_join_hash_table(
-  cudf::table_view const &build, null_equality compare_nulls, rmm::cuda_stream_view stream)
+std::unique_ptr<multimap_type> build_join_hash_table(cudf::table_view const &build,
+                                                     null_equality compare_nulls,
+                                                     rmm::cuda_stream_view stream,
+                                                     uint32_t desired_occupancy,
+                                                     hash_value_type const *build_hashes)
 {
   auto build_device_table = cudf::table_device_view::create(build, stream);
 
@@ -176,24 +190,20 @@ std::unique_ptr<multimap_type, std::function<void(multimap_type *)>> build_join_
   CUDF_EXPECTS(0 != build_device_table->num_rows(), "Build side table has no rows");
 
   size_type const build_table_num_rows{build_device_table->num_rows()};
-  size_t const hash_table_size = compute_hash_table_size(build_table_num_rows);
+  auto hash_table =
+    std::make_unique<multimap_type>(build_table_num_rows, desired_occupancy, stream);
 
-  auto hash_table = multimap_type::create(hash_table_size,
-                                          stream,
-                                          true,
-                                          multimap_type::hasher(),
-                                          multimap_type::key_equal(),
-                                          multimap_type::allocator_type());
-
-  row_hash hash_build{*build_device_table};
+  row_hash hash_build{*build_device_table, build_hashes};
   rmm::device_scalar<int> failure(0, stream);
   constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-  detail::grid_1d config(build_table_num_rows, block_size);
+  // Every row is inserted by a cooperative group of threads
+  auto const num_blocks = util::div_rounding_up_safe<int64_t>(
+    static_cast<int64_t>(build_table_num_rows) * multimap_type::window_size, block_size);
   auto const row_bitmask = (compare_nulls == null_equality::EQUAL)
                              ? rmm::device_buffer{0, stream}
-                             : cudf::detail::bitmask_and(build, stream);
-  build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-    *hash_table,
+                             : cudf::detail::bitmask_and(build, stream).first;
+  build_hash_table<<<num_blocks, block_size, 0, stream.value()>>>(
+    hash_table->get_device_view(),
     hash_build,
     build_table_num_rows,
     static_cast<bitmask_type const *>(row_bitmask.data()),
@@ -204,6 +214,84 @@ std::unique_ptr<multimap_type, std::function<void(multimap_type *)>> build_join_
   return hash_table;
 }
 
+std::unique_ptr<rmm::device_uvector<uint32_t>> build_join_bloom_filter(
+  multimap_type const &hash_table, size_type num_build_rows, rmm::cuda_stream_view stream)
+{
+  auto const num_blocks = bloom_filter_view::num_blocks_for(num_build_rows);
+  auto words =
+    std::make_unique<rmm::device_uvector<uint32_t>>(num_blocks * BLOOM_FILTER_BLOCK_WORDS, stream);
+  thrust::uninitialized_fill(rmm::exec_policy(stream), words->begin(), words->end(), 0);
+
+  // The keys of the hash table are the hash values of the build rows, null rows excluded
+  auto const map = hash_table.get_device_view();
+  bloom_filter_view const filter{words->data(), num_blocks};
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     map.capacity(),
+                     [map, filter] __device__(size_type slot) {
+                       auto const key = map.key(slot);
+                       if (key != map.get_unused_key()) { filter.insert(key); }
+                     });
+  return words;
+}
+
+/**
+ * @brief Probes the `hash_table` built from `build_table` for tuples in `probe_table`,
+ * and writes at most `max_size` output indices of `build_table` and `probe_table`.
+ *
+ * @tparam JoinKind The type of join to be performed.
+ *
+ * @param build_table Table of build side columns to join.
+ * @param probe_table Table of probe side columns to join.
+ * @param probe_hashes Precomputed hash values of the rows of `probe_table`, or `nullptr` to hash
+ * the rows.
+ * @param hash_table Hash table built from `build_table`.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param left_indices Output indices of `probe_table`.
+ * @param right_indices Output indices of `build_table`.
+ * @param max_size Number of output indices that fit in `left_indices` and `right_indices`.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The number of output indices of the join, which may exceed `max_size`.
+ */
+template <join_kind JoinKind>
+size_type probe_join_hash_table(cudf::table_device_view build_table,
+                                cudf::table_device_view probe_table,
+                                hash_value_type const *probe_hashes,
+                                multimap_type const &hash_table,
+                                bloom_filter_view filter,
+                                null_equality compare_nulls,
+                                size_type *left_indices,
+                                size_type *right_indices,
+                                size_type max_size,
+                                rmm::cuda_stream_view stream)
+{
+  rmm::device_scalar<size_type> write_index(0, stream);
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  // Every probe row is probed by a cooperative group of threads
+  auto const num_blocks = util::div_rounding_up_safe<int64_t>(
+    static_cast<int64_t>(probe_table.num_rows()) * multimap_type::window_size, block_size);
+
+  row_hash hash_probe{probe_table, probe_hashes};
+  row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
+  probe_hash_table<JoinKind, multimap_type::device_view, block_size, DEFAULT_JOIN_CACHE_SIZE>
+    <<<num_blocks, block_size, 0, stream.value()>>>(hash_table.get_device_view(),
+                                                    build_table,
+                                                    probe_table,
+                                                    hash_probe,
+                                                    equality,
+                                                    filter,
+                                                    left_indices,
+                                                    right_indices,
+                                                    write_index.data(),
+                                                    max_size);
+
+  CHECK_CUDA(stream.value());
+
+  return write_index.value(stream);
+}
+
 /**
  * @brief Probes the `hash_table` built from `build_table` for tuples in `probe_table`,
  * and returns the output indices of `build_table` and `probe_table` as a combined table.
@@ -212,6 +300,8 @@ std::unique_ptr<multimap_type, std::function<void(multimap_type *)>> build_join_
  *
  * @param build_table Table of build side columns to join.
  * @param probe_table Table of probe side columns to join.
+ * @param probe_hashes Precomputed hash values of the rows of `probe_table`, or `nullptr` to hash
+ * the rows.
  * @param hash_table Hash table built from `build_table`.
  * @param compare_nulls Controls whether null join-key values should match or not.
  * @param stream CUDA stream used for device memory operations and kernel launches.
@@ -223,13 +313,15 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 probe_join_hash_table(cudf::table_device_view build_table,
                       cudf::table_device_view probe_table,
+                      hash_value_type const *probe_hashes,
                       multimap_type const &hash_table,
+                      bloom_filter_view filter,
                       null_equality compare_nulls,
                       rmm::cuda_stream_view stream,
                       rmm::mr::device_memory_resource *mr)
 {
   size_type estimated_size = estimate_join_output_size<JoinKind, multimap_type>(
-    build_table, probe_table, hash_table, compare_nulls, stream);
+    build_table, probe_table, probe_hashes, hash_table, filter, compare_nulls, stream);
 
   // If the estimated output size is zero, return immediately
   if (estimated_size == 0) {
@@ -241,7 +333,6 @@ probe_join_hash_table(cudf::table_device_view build_table,
   // might be incorrect and we might have underestimated the number of joined elements.
   // As such we will need to de-allocate memory and re-allocate memory to ensure
   // that the final output is correct.
-  rmm::device_scalar<size_type> write_index(0, stream);
   size_type join_size{0};
 
   auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr);
@@ -252,27 +343,16 @@ probe_join_hash_table(cudf::table_device_view build_table,
     left_indices->resize(estimated_size, stream);
     right_indices->resize(estimated_size, stream);
 
-    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(probe_table.num_rows(), block_size);
-    write_index.set_value_zero(stream);
-
-    row_hash hash_probe{probe_table};
-    row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
-    probe_hash_table<JoinKind, multimap_type, block_size, DEFAULT_JOIN_CACHE_SIZE>
-      <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-        hash_table,
-        build_table,
-        probe_table,
-        hash_probe,
-        equality,
-        left_indices->data(),
-        right_indices->data(),
-        write_index.data(),
-        estimated_size);
-
-    CHECK_CUDA(stream.value());
-
-    join_size              = write_index.value(stream);
+    join_size = probe_join_hash_table<JoinKind>(build_table,
+                                                probe_table,
+                                                probe_hashes,
+                                                hash_table,
+                                                filter,
+                                                compare_nulls,
+                                                left_indices->data(),
+                                                right_indices->data(),
+                                                estimated_size,
+                                                stream);
     current_estimated_size = estimated_size;
     estimated_size *= 2;
   } while ((current_estimated_size < join_size));
@@ -293,12 +373,102 @@ std::unique_ptr<cudf::table> combine_table_pair(std::unique_ptr<cudf::table> &&l
   return std::make_unique<cudf::table>(std::move(joined_cols));
 }
 
+namespace {
+
+/**
+ * @brief Header of a serialized hash join, followed by the metadata of the packed build table
+ *
+ * The device data holds the packed build table, followed by the hash table keys at
+ * `hash_table_offset`, the hash table elements at the next aligned offset, and the words of the
+ * Bloom filter at the next aligned offset.
+ */
+struct serialized_hash_join_header {
+  uint32_t magic;                ///< Identifies the metadata of a serialized hash join
+  uint32_t version;              ///< Version of the serialized layout
+  uint64_t hash_table_offset;    ///< Offset of the hash table keys in the device data
+  uint64_t hash_table_size;      ///< Number of hash table slots; zero if the build table is empty
+  uint64_t bloom_filter_blocks;  ///< Number of Bloom filter blocks; zero if it is disabled
+};
+
+constexpr uint32_t serialized_hash_join_magic   = 0x4a485543;  // "CUHJ"
+constexpr uint32_t serialized_hash_join_version = 4;
+// Same as the alignment of device allocations, so the slots can be accessed with wide loads
+constexpr size_t serialized_hash_table_alignment = 256;
+
+/**
+ * @brief Returns the offset of the hash table elements in the device data of a serialized hash
+ * join.
+ */
+uint64_t serialized_hash_table_elements_offset(serialized_hash_join_header const &header)
+{
+  return cudf::util::round_up_safe<uint64_t>(
+    header.hash_table_offset + header.hash_table_size * sizeof(multimap_type::key_type),
+    serialized_hash_table_alignment);
+}
+
+/**
+ * @brief Returns the offset of the Bloom filter words in the device data of a serialized hash
+ * join.
+ */
+uint64_t serialized_bloom_filter_offset(serialized_hash_join_header const &header)
+{
+  return cudf::util::round_up_safe<uint64_t>(
+    serialized_hash_table_elements_offset(header) +
+      header.hash_table_size * sizeof(multimap_type::mapped_type),
+    serialized_hash_table_alignment);
+}
+
+/**
+ * @brief Checks that `probe` can be joined with `build`.
+ *
+ * @param probe Table of probe side columns to join.
+ * @param build Table of build side columns to join.
+ */
+void check_probe_table(table_view const &probe, table_view const &build)
+{
+  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+  CUDF_EXPECTS(probe.num_rows() < cudf::detail::MAX_JOIN_SIZE,
+               "Probe column size is too big for hash join");
+  CUDF_EXPECTS(build.num_columns() == probe.num_columns(),
+               "Mismatch in number of columns to be joined on");
+}
+
+/**
+ * @brief Returns whether two columns have the same type, and children of the same types.
+ */
+bool have_same_nested_types(column_view const &lhs, column_view const &rhs)
+{
+  return lhs.type() == rhs.type() and
+         std::equal(lhs.child_begin(),
+                    lhs.child_end(),
+                    rhs.child_begin(),
+                    rhs.child_end(),
+                    [](auto const &l, auto const &r) { return have_same_nested_types(l, r); });
+}
+
+/**
+ * @brief Checks that the columns of the `probe` and `build` tables have the same types, down to
+ * the children of the struct columns.
+ */
+void check_join_column_types(table_view const &probe, table_view const &build)
+{
+  CUDF_EXPECTS(std::equal(std::cbegin(build),
+                          std::cend(build),
+                          std::cbegin(probe),
+                          std::cend(probe),
+                          have_same_nested_types),
+               "Mismatch in joining column data types");
+}
+
+}  // namespace
 }  // namespace detail
 
 hash_join::hash_join_impl::~hash_join_impl() = default;
 
 hash_join::hash_join_impl::hash_join_impl(cudf::table_view const &build,
                                           null_equality compare_nulls,
+                                          hash_join_filter filter,
+                                          hash_value_type const *build_hashes,
                                           rmm::cuda_stream_view stream)
   : _hash_table(nullptr)
 {
@@ -307,88 +477,334 @@ hash_join::hash_join_impl::hash_join_impl(cudf::table_view const &build,
   CUDF_EXPECTS(build.num_rows() < cudf::detail::MAX_JOIN_SIZE,
                "Build column size is too big for hash join");
 
-  auto flattened_build = structs::detail::flatten_nested_columns(
-    build, {}, {}, structs::detail::column_nullability::FORCE);
-  _build = std::get<0>(flattened_build);
-  // need to store off the owning structures for some of the views in _build
-  _created_null_columns = std::move(std::get<3>(flattened_build));
+  // The row operators hash and compare the children of the struct columns
+  _build = build;
 
   if (0 == build.num_rows()) { return; }
 
-  _hash_table = build_join_hash_table(_build, compare_nulls, stream);
+  _hash_table = build_join_hash_table(
+    _build, compare_nulls, stream, DEFAULT_HASH_TABLE_OCCUPANCY, build_hashes);
+  if (filter == hash_join_filter::BLOOM_FILTER) {
+    _bloom_filter = cudf::detail::build_join_bloom_filter(*_hash_table, build.num_rows(), stream);
+    _bloom_filter_view = cudf::detail::bloom_filter_view{
+      _bloom_filter->data(),
+      static_cast<size_type>(_bloom_filter->size() / cudf::detail::BLOOM_FILTER_BLOCK_WORDS)};
+  }
+}
+
+cudf::detail::bloom_filter_view hash_join::hash_join_impl::bloom_filter() const
+{
+  return _bloom_filter_view;
+}
+
+hash_join::hash_join_impl::hash_join_impl(uint8_t const *metadata,
+                                          uint8_t const *gpu_data,
+                                          rmm::cuda_stream_view stream)
+  : _hash_table(nullptr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(metadata != nullptr, "Encountered invalid serialized hash join");
+  detail::serialized_hash_join_header header;
+  std::memcpy(&header, metadata, sizeof(header));
+  CUDF_EXPECTS(header.magic == detail::serialized_hash_join_magic,
+               "Encountered invalid serialized hash join");
+  CUDF_EXPECTS(header.version == detail::serialized_hash_join_version,
+               "Unsupported serialized hash join version");
+
+  _build = cudf::unpack(metadata + sizeof(header), gpu_data);
+
+  if (header.hash_table_size == 0) { return; }
+
+  // Probes don't modify the hash table, so the const device data can back it
+  auto const data     = const_cast<uint8_t *>(gpu_data);
+  auto const keys     = reinterpret_cast<cudf::detail::multimap_type::key_type *>(
+    data + header.hash_table_offset);
+  auto const elements = reinterpret_cast<cudf::detail::multimap_type::mapped_type *>(
+    data + detail::serialized_hash_table_elements_offset(header));
+  _hash_table         = std::make_unique<cudf::detail::multimap_type>(
+    keys, elements, static_cast<size_type>(header.hash_table_size));
+
+  if (header.bloom_filter_blocks != 0) {
+    _bloom_filter_view = cudf::detail::bloom_filter_view{
+      reinterpret_cast<uint32_t *>(data + detail::serialized_bloom_filter_offset(header)),
+      static_cast<size_type>(header.bloom_filter_blocks)};
+  }
+}
+
+packed_columns hash_join::hash_join_impl::pack(rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource *mr) const
+{
+  CUDF_FUNC_RANGE();
+  auto const packed_build = cudf::detail::pack(_build, stream);
+  auto const build_size   = packed_build.gpu_data->size();
+
+  detail::serialized_hash_join_header header;
+  header.magic   = detail::serialized_hash_join_magic;
+  header.version = detail::serialized_hash_join_version;
+  header.hash_table_offset =
+    cudf::util::round_up_safe(build_size, detail::serialized_hash_table_alignment);
+  header.hash_table_size     = _hash_table ? _hash_table->capacity() : 0;
+  header.bloom_filter_blocks = _bloom_filter_view.num_blocks();
+
+  auto const num_slots           = header.hash_table_size;
+  auto const keys_bytes          = num_slots * sizeof(cudf::detail::multimap_type::key_type);
+  auto const elements_bytes      = num_slots * sizeof(cudf::detail::multimap_type::mapped_type);
+  auto const elements_offset     = detail::serialized_hash_table_elements_offset(header);
+  auto const bloom_filter_bytes =
+    header.bloom_filter_blocks * cudf::detail::BLOOM_FILTER_BLOCK_WORDS * sizeof(uint32_t);
+  auto const bloom_filter_offset = detail::serialized_bloom_filter_offset(header);
+
+  auto const data_size = bloom_filter_bytes != 0 ? bloom_filter_offset + bloom_filter_bytes
+                                                 : elements_offset + elements_bytes;
+  auto gpu_data        = std::make_unique<rmm::device_buffer>(data_size, stream, mr);
+  CUDA_TRY(cudaMemcpyAsync(gpu_data->data(),
+                           packed_build.gpu_data->data(),
+                           build_size,
+                           cudaMemcpyDeviceToDevice,
+                           stream.value()));
+  if (num_slots != 0) {
+    CUDA_TRY(cudaMemcpyAsync(static_cast<uint8_t *>(gpu_data->data()) + header.hash_table_offset,
+                             _hash_table->keys(),
+                             keys_bytes,
+                             cudaMemcpyDefault,
+                             stream.value()));
+    CUDA_TRY(cudaMemcpyAsync(static_cast<uint8_t *>(gpu_data->data()) + elements_offset,
+                             _hash_table->elements(),
+                             elements_bytes,
+                             cudaMemcpyDefault,
+                             stream.value()));
+  }
+  if (bloom_filter_bytes != 0) {
+    CUDA_TRY(cudaMemcpyAsync(static_cast<uint8_t *>(gpu_data->data()) + bloom_filter_offset,
+                             _bloom_filter_view.data(),
+                             bloom_filter_bytes,
+                             cudaMemcpyDefault,
+                             stream.value()));
+  }
+
+  // The packed table metadata refers to offsets in its device data, which are unchanged
+  std::vector<uint8_t> metadata(sizeof(header));
+  std::memcpy(metadata.data(), &header, sizeof(header));
+  std::copy(packed_build.metadata_->data(),
+            packed_build.metadata_->data() + packed_build.metadata_->size(),
+            std::back_inserter(metadata));
+  stream.synchronize();
+
+  return packed_columns{std::make_unique<packed_columns::metadata>(std::move(metadata)),
+                        std::move(gpu_data)};
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::inner_join(cudf::table_view const &probe,
+                                      hash_value_type const *probe_hashes,
                                       null_equality compare_nulls,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource *mr) const
 {
   CUDF_FUNC_RANGE();
-  return compute_hash_join<cudf::detail::join_kind::INNER_JOIN>(probe, compare_nulls, stream, mr);
+  return compute_hash_join<cudf::detail::join_kind::INNER_JOIN>(
+    probe, probe_hashes, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::left_join(cudf::table_view const &probe,
+                                     hash_value_type const *probe_hashes,
                                      null_equality compare_nulls,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource *mr) const
 {
   CUDF_FUNC_RANGE();
-  return compute_hash_join<cudf::detail::join_kind::LEFT_JOIN>(probe, compare_nulls, stream, mr);
+  return compute_hash_join<cudf::detail::join_kind::LEFT_JOIN>(
+    probe, probe_hashes, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::full_join(cudf::table_view const &probe,
+                                     hash_value_type const *probe_hashes,
                                      null_equality compare_nulls,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource *mr) const
 {
   CUDF_FUNC_RANGE();
-  return compute_hash_join<cudf::detail::join_kind::FULL_JOIN>(probe, compare_nulls, stream, mr);
+  return compute_hash_join<cudf::detail::join_kind::FULL_JOIN>(
+    probe, probe_hashes, compare_nulls, stream, mr);
+}
+
+std::size_t hash_join::hash_join_impl::inner_join(cudf::table_view const &probe,
+                                                  device_span<size_type> left_indices,
+                                                  device_span<size_type> right_indices,
+                                                  null_equality compare_nulls,
+                                                  rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_join<cudf::detail::join_kind::INNER_JOIN>(
+    probe, left_indices, right_indices, compare_nulls, stream);
+}
+
+std::size_t hash_join::hash_join_impl::left_join(cudf::table_view const &probe,
+                                                 device_span<size_type> left_indices,
+                                                 device_span<size_type> right_indices,
+                                                 null_equality compare_nulls,
+                                                 rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_join<cudf::detail::join_kind::LEFT_JOIN>(
+    probe, left_indices, right_indices, compare_nulls, stream);
+}
+
+std::size_t hash_join::hash_join_impl::full_join(cudf::table_view const &probe,
+                                                 device_span<size_type> left_indices,
+                                                 device_span<size_type> right_indices,
+                                                 null_equality compare_nulls,
+                                                 rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_join<cudf::detail::join_kind::FULL_JOIN>(
+    probe, left_indices, right_indices, compare_nulls, stream);
+}
+
+std::size_t hash_join::hash_join_impl::inner_join_size(cudf::table_view const &probe,
+                                                       null_equality compare_nulls,
+                                                       rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_join_size<cudf::detail::join_kind::INNER_JOIN>(probe, compare_nulls, stream);
+}
+
+std::size_t hash_join::hash_join_impl::left_join_size(cudf::table_view const &probe,
+                                                      null_equality compare_nulls,
+                                                      rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_join_size<cudf::detail::join_kind::LEFT_JOIN>(probe, compare_nulls, stream);
+}
+
+std::size_t hash_join::hash_join_impl::full_join_size(cudf::table_view const &probe,
+                                                      null_equality compare_nulls,
+                                                      rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_join_size<cudf::detail::join_kind::FULL_JOIN>(probe, compare_nulls, stream);
+}
+
+rmm::device_uvector<int64_t> hash_join::hash_join_impl::inner_join_row_offsets(
+  cudf::table_view const &probe, null_equality compare_nulls, rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  detail::check_probe_table(probe, _build);
+
+  // No probe row matches a build row
+  if (is_trivial_join(probe, _build, cudf::detail::join_kind::INNER_JOIN)) {
+    rmm::device_uvector<int64_t> offsets(probe.num_rows() + 1, stream);
+    thrust::uninitialized_fill(rmm::exec_policy(stream), offsets.begin(), offsets.end(), 0);
+    return offsets;
+  }
+
+  detail::check_join_column_types(probe, _build);
+
+  CUDF_EXPECTS(_hash_table, "Hash table of hash join is null.");
+
+  auto build_table = cudf::table_device_view::create(_build, stream);
+  auto probe_table = cudf::table_device_view::create(probe, stream);
+  return cudf::detail::compute_join_output_row_offsets(
+    *build_table, *probe_table, *_hash_table, bloom_filter(), compare_nulls, stream);
 }
 
 template <cudf::detail::join_kind JoinKind>
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::compute_hash_join(cudf::table_view const &probe,
+                                             hash_value_type const *probe_hashes,
                                              null_equality compare_nulls,
                                              rmm::cuda_stream_view stream,
                                              rmm::mr::device_memory_resource *mr) const
 {
-  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
-  CUDF_EXPECTS(probe.num_rows() < cudf::detail::MAX_JOIN_SIZE,
-               "Probe column size is too big for hash join");
-
-  auto flattened_probe = structs::detail::flatten_nested_columns(
-    probe, {}, {}, structs::detail::column_nullability::FORCE);
-  auto const flattened_probe_table = std::get<0>(flattened_probe);
-
-  CUDF_EXPECTS(_build.num_columns() == flattened_probe_table.num_columns(),
-               "Mismatch in number of columns to be joined on");
+  detail::check_probe_table(probe, _build);
 
-  if (is_trivial_join(flattened_probe_table, _build, JoinKind)) {
+  if (is_trivial_join(probe, _build, JoinKind)) {
     return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
                           std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
   }
 
-  CUDF_EXPECTS(std::equal(std::cbegin(_build),
-                          std::cend(_build),
-                          std::cbegin(flattened_probe_table),
-                          std::cend(flattened_probe_table),
-                          [](const auto &b, const auto &p) { return b.type() == p.type(); }),
-               "Mismatch in joining column data types");
+  detail::check_join_column_types(probe, _build);
 
-  return probe_join_indices<JoinKind>(flattened_probe_table, compare_nulls, stream, mr);
+  return probe_join_indices<JoinKind>(probe, probe_hashes, compare_nulls, stream, mr);
+}
+
+template <cudf::detail::join_kind JoinKind>
+std::size_t hash_join::hash_join_impl::compute_hash_join(cudf::table_view const &probe,
+                                                         device_span<size_type> left_indices,
+                                                         device_span<size_type> right_indices,
+                                                         null_equality compare_nulls,
+                                                         rmm::cuda_stream_view stream) const
+{
+  CUDF_EXPECTS(left_indices.size() == right_indices.size(),
+               "Mismatch in sizes of the hash join output buffers");
+
+  detail::check_probe_table(probe, _build);
+
+  if (is_trivial_join(probe, _build, JoinKind)) { return 0; }
+
+  detail::check_join_column_types(probe, _build);
+
+  return probe_join_indices<JoinKind>(
+    probe, left_indices, right_indices, compare_nulls, stream);
+}
+
+template <cudf::detail::join_kind JoinKind>
+std::size_t hash_join::hash_join_impl::compute_join_size(cudf::table_view const &probe,
+                                                         null_equality compare_nulls,
+                                                         rmm::cuda_stream_view stream) const
+{
+  detail::check_probe_table(probe, _build);
+
+  if (is_trivial_join(probe, _build, JoinKind)) { return 0; }
+
+  detail::check_join_column_types(probe, _build);
+
+  // Trivial left join case: every probe row is output once
+  if (!_hash_table && JoinKind != cudf::detail::join_kind::INNER_JOIN) {
+    return probe.num_rows();
+  }
+
+  CUDF_EXPECTS(_hash_table, "Hash table of hash join is null.");
+
+  auto build_table = cudf::table_device_view::create(_build, stream);
+  auto probe_table = cudf::table_device_view::create(probe, stream);
+
+  constexpr cudf::detail::join_kind ProbeJoinKind = (JoinKind == cudf::detail::join_kind::FULL_JOIN)
+                                                      ? cudf::detail::join_kind::LEFT_JOIN
+                                                      : JoinKind;
+  if (JoinKind != cudf::detail::join_kind::FULL_JOIN) {
+    return cudf::detail::compute_join_output_size_exact<ProbeJoinKind>(
+      *build_table, *probe_table, *_hash_table, bloom_filter(), compare_nulls, nullptr, stream);
+  }
+
+  // A full join additionally outputs each build row that matches no probe row
+  rmm::device_uvector<bool> matched_build_rows(_build.num_rows(), stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), matched_build_rows.begin(), matched_build_rows.end(), false);
+  auto const left_join_size =
+    cudf::detail::compute_join_output_size_exact<ProbeJoinKind>(*build_table,
+                                                                *probe_table,
+                                                                *_hash_table,
+                                                                bloom_filter(),
+                                                                compare_nulls,
+                                                                matched_build_rows.data(),
+                                                                stream);
+  auto const unmatched_build_rows = thrust::count(
+    rmm::exec_policy(stream), matched_build_rows.begin(), matched_build_rows.end(), false);
+  return left_join_size + unmatched_build_rows;
 }
 
 template <cudf::detail::join_kind JoinKind>
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::probe_join_indices(cudf::table_view const &probe,
+                                              hash_value_type const *probe_hashes,
                                               null_equality compare_nulls,
                                               rmm::cuda_stream_view stream,
                                               rmm::mr::device_memory_resource *mr) const
@@ -406,15 +822,82 @@ hash_join::hash_join_impl::probe_join_indices(cudf::table_view const &probe,
   constexpr cudf::detail::join_kind ProbeJoinKind = (JoinKind == cudf::detail::join_kind::FULL_JOIN)
                                                       ? cudf::detail::join_kind::LEFT_JOIN
                                                       : JoinKind;
-  auto join_indices = cudf::detail::probe_join_hash_table<ProbeJoinKind>(
-    *build_table, *probe_table, *_hash_table, compare_nulls, stream, mr);
+  auto join_indices = cudf::detail::probe_join_hash_table<ProbeJoinKind>(*build_table,
+                                                                        *probe_table,
+                                                                        probe_hashes,
+                                                                        *_hash_table,
+                                                                        bloom_filter(),
+                                                                        compare_nulls,
+                                                                        stream,
+                                                                        mr);
 
   if (JoinKind == cudf::detail::join_kind::FULL_JOIN) {
     auto complement_indices = detail::get_left_join_indices_complement(
-      join_indices.second, probe.num_rows(), _build.num_rows(), stream, mr);
+      *join_indices.second, probe.num_rows(), _build.num_rows(), stream, mr);
     join_indices = detail::concatenate_vector_pairs(join_indices, complement_indices, stream);
   }
   return join_indices;
 }
 
+template <cudf::detail::join_kind JoinKind>
+std::size_t hash_join::hash_join_impl::probe_join_indices(cudf::table_view const &probe,
+                                                          device_span<size_type> left_indices,
+                                                          device_span<size_type> right_indices,
+                                                          null_equality compare_nulls,
+                                                          rmm::cuda_stream_view stream) const
+{
+  // Trivial left join case - exit early
+  if (!_hash_table && JoinKind != cudf::detail::join_kind::INNER_JOIN) {
+    auto const join_size = static_cast<std::size_t>(probe.num_rows());
+    CUDF_EXPECTS(join_size <= left_indices.size(), "Hash join output buffers are too small");
+    thrust::sequence(
+      rmm::exec_policy(stream), left_indices.begin(), left_indices.begin() + join_size, 0);
+    thrust::fill(rmm::exec_policy(stream),
+                 right_indices.begin(),
+                 right_indices.begin() + join_size,
+                 cudf::detail::JoinNoneValue);
+    return join_size;
+  }
+
+  CUDF_EXPECTS(_hash_table, "Hash table of hash join is null.");
+
+  auto build_table = cudf::table_device_view::create(_build, stream);
+  auto probe_table = cudf::table_device_view::create(probe, stream);
+
+  constexpr cudf::detail::join_kind ProbeJoinKind = (JoinKind == cudf::detail::join_kind::FULL_JOIN)
+                                                      ? cudf::detail::join_kind::LEFT_JOIN
+                                                      : JoinKind;
+  auto const max_size = static_cast<size_type>(
+    std::min<std::size_t>(left_indices.size(), std::numeric_limits<size_type>::max()));
+  std::size_t const join_size =
+    cudf::detail::probe_join_hash_table<ProbeJoinKind>(*build_table,
+                                                       *probe_table,
+                                                       nullptr,
+                                                       *_hash_table,
+                                                       bloom_filter(),
+                                                       compare_nulls,
+                                                       left_indices.data(),
+                                                       right_indices.data(),
+                                                       max_size,
+                                                       stream);
+  CUDF_EXPECTS(join_size <= left_indices.size(), "Hash join output buffers are too small");
+
+  if (JoinKind != cudf::detail::join_kind::FULL_JOIN) { return join_size; }
+
+  auto const complement_indices = detail::get_left_join_indices_complement(
+    right_indices.first(join_size), probe.num_rows(), _build.num_rows(), stream);
+  auto const complement_size = complement_indices.first->size();
+  CUDF_EXPECTS(join_size + complement_size <= left_indices.size(),
+               "Hash join output buffers are too small");
+  thrust::copy(rmm::exec_policy(stream),
+               complement_indices.first->begin(),
+               complement_indices.first->end(),
+               left_indices.begin() + join_size);
+  thrust::copy(rmm::exec_policy(stream),
+               complement_indices.second->begin(),
+               complement_indices.second->end(),
+               right_indices.begin() + join_size);
+  return join_size + complement_size;
+}
+
 }  // namespace cudf
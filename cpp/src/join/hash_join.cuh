@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
+#include <join/bloom_filter.cuh>
 #include <join/join_common_utils.hpp>
 #include <join/join_kernels.cuh>
 
@@ -26,12 +27,15 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/scan.h>
 #include <thrust/sequence.h>
+#include <thrust/uninitialized_fill.h>
 
 #include <limits>
 
@@ -54,8 +58,11 @@ namespace detail {
  *
  * @param build_table The right hand table
  * @param probe_table The left hand table
+ * @param probe_hashes Precomputed hash values of the rows of `probe_table`, or `nullptr` to hash
+ * the rows
  * @param hash_table A hash table built on the build table that maps the index
  * of every row to the hash value of that row.
+ * @param filter Bloom filter of the hash values of the build table rows, which may have no blocks
  * @param compare_nulls Controls whether null join-key values should match or not.
  * @param stream CUDA stream used for device memory operations and kernel launches
  *
@@ -64,7 +71,9 @@ namespace detail {
 template <join_kind JoinKind, typename multimap_type>
 size_type estimate_join_output_size(table_device_view build_table,
                                     table_device_view probe_table,
+                                    hash_value_type const* probe_hashes,
                                     multimap_type const& hash_table,
+                                    bloom_filter_view filter,
                                     null_equality compare_nulls,
                                     rmm::cuda_stream_view stream)
 {
@@ -109,7 +118,10 @@ size_type estimate_join_output_size(table_device_view build_table,
   int numBlocks{-1};
 
   CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-    &numBlocks, compute_join_output_size<JoinKind, multimap_type, block_size>, block_size, 0));
+    &numBlocks,
+    compute_join_output_size<JoinKind, typename multimap_type::device_view, block_size>,
+    block_size,
+    0));
 
   int dev_id{-1};
   CUDA_TRY(cudaGetDevice(&dev_id));
@@ -125,16 +137,17 @@ size_type estimate_join_output_size(table_device_view build_table,
 
     size_estimate.set_value_zero(stream);
 
-    row_hash hash_probe{probe_table};
+    row_hash hash_probe{probe_table, probe_hashes};
     row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
     // Probe the hash table without actually building the output to simply
     // find what the size of the output will be.
-    compute_join_output_size<JoinKind, multimap_type, block_size>
-      <<<numBlocks * num_sms, block_size, 0, stream.value()>>>(hash_table,
+    compute_join_output_size<JoinKind, typename multimap_type::device_view, block_size>
+      <<<numBlocks * num_sms, block_size, 0, stream.value()>>>(hash_table.get_device_view(),
                                                                build_table,
                                                                probe_table,
                                                                hash_probe,
                                                                equality,
+                                                               filter,
                                                                sample_probe_num_rows,
                                                                size_estimate.data());
     CHECK_CUDA(stream.value());
@@ -173,6 +186,137 @@ size_type estimate_join_output_size(table_device_view build_table,
   return static_cast<cudf::size_type>(h_size_estimate);
 }
 
+/**
+ * @brief Computes the exact size of the join output produced when joining two tables together.
+ *
+ * Unlike `estimate_join_output_size`, every row of the probe table is probed.
+ *
+ * @throw cudf::logic_error if the size overflows cudf::size_type
+ *
+ * @tparam JoinKind The type of join to be performed, INNER_JOIN or LEFT_JOIN
+ * @tparam multimap_type The type of the hash table
+ *
+ * @param build_table The right hand table
+ * @param probe_table The left hand table
+ * @param hash_table A hash table built on the build table that maps the index
+ * of every row to the hash value of that row.
+ * @param filter Bloom filter of the hash values of the build table rows, which may have no blocks
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param matched_build_rows If not null, flags of the build table rows, which are set for the rows
+ * that match any probe row
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The size of the output of the join operation
+ */
+template <join_kind JoinKind, typename multimap_type>
+std::size_t compute_join_output_size_exact(table_device_view build_table,
+                                           table_device_view probe_table,
+                                           multimap_type const& hash_table,
+                                           bloom_filter_view filter,
+                                           null_equality compare_nulls,
+                                           bool* matched_build_rows,
+                                           rmm::cuda_stream_view stream)
+{
+  using size_counter_type = int64_t;  // use 64-bit size so we can detect overflow
+
+  rmm::device_scalar<size_counter_type> size(0, stream);
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  int numBlocks{-1};
+
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &numBlocks,
+    compute_join_output_size<JoinKind, typename multimap_type::device_view, block_size>,
+    block_size,
+    0));
+
+  int dev_id{-1};
+  CUDA_TRY(cudaGetDevice(&dev_id));
+
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
+
+  row_hash hash_probe{probe_table};
+  row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
+  compute_join_output_size<JoinKind, typename multimap_type::device_view, block_size>
+    <<<numBlocks * num_sms, block_size, 0, stream.value()>>>(hash_table.get_device_view(),
+                                                             build_table,
+                                                             probe_table,
+                                                             hash_probe,
+                                                             equality,
+                                                             filter,
+                                                             probe_table.num_rows(),
+                                                             size.data(),
+                                                             matched_build_rows);
+  CHECK_CUDA(stream.value());
+
+  auto const h_size = size.value(stream);
+  CUDF_EXPECTS(h_size < static_cast<size_counter_type>(std::numeric_limits<cudf::size_type>::max()),
+               "Maximum join output size exceeded");
+  return static_cast<std::size_t>(h_size);
+}
+
+/**
+ * @brief Computes the offsets of the inner join output rows of every probe row, when joining two
+ * tables together.
+ *
+ * The output rows of probe row `i` are the rows `[offsets[i], offsets[i + 1])` of the join output,
+ * so the last offset is the size of the join output.
+ *
+ * @tparam multimap_type The type of the hash table
+ *
+ * @param build_table The right hand table
+ * @param probe_table The left hand table
+ * @param hash_table A hash table built on the build table that maps the index
+ * of every row to the hash value of that row.
+ * @param filter Bloom filter of the hash values of the build table rows, which may have no blocks
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The `probe_table.num_rows() + 1` offsets of the output rows of the probe rows
+ */
+template <typename multimap_type>
+rmm::device_uvector<int64_t> compute_join_output_row_offsets(table_device_view build_table,
+                                                             table_device_view probe_table,
+                                                             multimap_type const& hash_table,
+                                                             bloom_filter_view filter,
+                                                             null_equality compare_nulls,
+                                                             rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<int64_t> offsets(probe_table.num_rows() + 1, stream);
+  thrust::uninitialized_fill(rmm::exec_policy(stream), offsets.begin(), offsets.end(), 0);
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  int numBlocks{-1};
+
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &numBlocks, compute_join_output_row_sizes<typename multimap_type::device_view>, block_size, 0));
+
+  int dev_id{-1};
+  CUDA_TRY(cudaGetDevice(&dev_id));
+
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
+
+  // The sizes are added after the first offset, so their inclusive scan gives the offsets
+  row_hash hash_probe{probe_table};
+  row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
+  compute_join_output_row_sizes<typename multimap_type::device_view>
+    <<<numBlocks * num_sms, block_size, 0, stream.value()>>>(hash_table.get_device_view(),
+                                                             build_table,
+                                                             probe_table,
+                                                             hash_probe,
+                                                             equality,
+                                                             filter,
+                                                             probe_table.num_rows(),
+                                                             offsets.data() + 1);
+  CHECK_CUDA(stream.value());
+
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+  return offsets;
+}
+
 /**
  * @brief Computes the trivial left join operation for the case when the
  * right table is empty. In this case all the valid indices of the left table
@@ -207,6 +351,41 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> get_empty_joined_table
 std::unique_ptr<cudf::table> combine_table_pair(std::unique_ptr<cudf::table>&& left,
                                                 std::unique_ptr<cudf::table>&& right);
 
+/**
+ * @brief Builds the hash table based on the given `build` table.
+ *
+ * @throw cudf::logic_error if the number of columns in `build` table is 0.
+ * @throw cudf::logic_error if the number of rows in `build` table is 0.
+ * @throw cudf::logic_error if insertion to the hash table fails.
+ *
+ * @param build Table of columns used to build join hash.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param desired_occupancy The percentage of the hash table slots filled by the `build` rows.
+ * @param build_hashes Precomputed hash values of the rows of `build`, or `nullptr` to hash the
+ * rows.
+ *
+ * @return Built hash table.
+ */
+std::unique_ptr<multimap_type> build_join_hash_table(
+  cudf::table_view const& build,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
+  uint32_t desired_occupancy          = DEFAULT_HASH_TABLE_OCCUPANCY,
+  hash_value_type const* build_hashes = nullptr);
+
+/**
+ * @brief Builds the Bloom filter of the keys of `hash_table`, the hash values of its build rows.
+ *
+ * @param hash_table Hash table built by `build_join_hash_table`.
+ * @param num_build_rows The number of rows of the build table of `hash_table`.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The words of the blocks of the Bloom filter.
+ */
+std::unique_ptr<rmm::device_uvector<uint32_t>> build_join_bloom_filter(
+  multimap_type const& hash_table, size_type num_build_rows, rmm::cuda_stream_view stream);
+
 }  // namespace detail
 
 struct hash_join::hash_join_impl {
@@ -220,9 +399,9 @@ struct hash_join::hash_join_impl {
 
  private:
   cudf::table_view _build;
-  std::vector<std::unique_ptr<cudf::column>> _created_null_columns;
-  std::unique_ptr<cudf::detail::multimap_type, std::function<void(cudf::detail::multimap_type*)>>
-    _hash_table;
+  std::unique_ptr<cudf::detail::multimap_type> _hash_table;
+  std::unique_ptr<rmm::device_uvector<uint32_t>> _bloom_filter;  ///< Null unless built here
+  cudf::detail::bloom_filter_view _bloom_filter_view;  ///< No blocks if the filter is disabled
 
  public:
   /**
@@ -233,14 +412,33 @@ struct hash_join::hash_join_impl {
    *
    * @param build The build table, from which the hash table is built.
    * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param filter The filter of probe rows tested before probing the hash table.
+   * @param build_hashes Precomputed hash values of the rows of `build`, or `nullptr` to hash the
+   * rows.
    */
   hash_join_impl(cudf::table_view const& build,
                  null_equality compare_nulls,
-                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+                 hash_join_filter filter,
+                 hash_value_type const* build_hashes = nullptr,
+                 rmm::cuda_stream_view stream        = rmm::cuda_stream_default);
+
+  /**
+   * @brief Constructor that refers to the build table and hash table serialized by `pack`
+   *
+   * @throw cudf::logic_error if `metadata` is not the metadata of a serialized hash join.
+   *
+   * @param metadata The host-side metadata buffer of the serialized hash join
+   * @param gpu_data The device-side buffer of the serialized hash join
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  hash_join_impl(uint8_t const* metadata, uint8_t const* gpu_data, rmm::cuda_stream_view stream);
+
+  packed_columns pack(rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const;
 
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   inner_join(cudf::table_view const& probe,
+             hash_value_type const* probe_hashes,
              null_equality compare_nulls,
              rmm::cuda_stream_view stream,
              rmm::mr::device_memory_resource* mr) const;
@@ -248,6 +446,7 @@ struct hash_join::hash_join_impl {
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   left_join(cudf::table_view const& probe,
+            hash_value_type const* probe_hashes,
             null_equality compare_nulls,
             rmm::cuda_stream_view stream,
             rmm::mr::device_memory_resource* mr) const;
@@ -255,19 +454,95 @@ struct hash_join::hash_join_impl {
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   full_join(cudf::table_view const& probe,
+            hash_value_type const* probe_hashes,
             null_equality compare_nulls,
             rmm::cuda_stream_view stream,
             rmm::mr::device_memory_resource* mr) const;
 
+  std::size_t inner_join(cudf::table_view const& probe,
+                         device_span<size_type> left_indices,
+                         device_span<size_type> right_indices,
+                         null_equality compare_nulls,
+                         rmm::cuda_stream_view stream) const;
+
+  std::size_t left_join(cudf::table_view const& probe,
+                        device_span<size_type> left_indices,
+                        device_span<size_type> right_indices,
+                        null_equality compare_nulls,
+                        rmm::cuda_stream_view stream) const;
+
+  std::size_t full_join(cudf::table_view const& probe,
+                        device_span<size_type> left_indices,
+                        device_span<size_type> right_indices,
+                        null_equality compare_nulls,
+                        rmm::cuda_stream_view stream) const;
+
+  std::size_t inner_join_size(cudf::table_view const& probe,
+                              null_equality compare_nulls,
+                              rmm::cuda_stream_view stream) const;
+
+  std::size_t left_join_size(cudf::table_view const& probe,
+                             null_equality compare_nulls,
+                             rmm::cuda_stream_view stream) const;
+
+  std::size_t full_join_size(cudf::table_view const& probe,
+                             null_equality compare_nulls,
+                             rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Computes the offsets of the inner join output rows of every row of `probe`.
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The `probe.num_rows() + 1` offsets of the inner join output rows of the probe rows,
+   * whose last one is the inner join size.
+   */
+  rmm::device_uvector<int64_t> inner_join_row_offsets(cudf::table_view const& probe,
+                                                      null_equality compare_nulls,
+                                                      rmm::cuda_stream_view stream) const;
+
  private:
   template <cudf::detail::join_kind JoinKind>
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   compute_hash_join(cudf::table_view const& probe,
+                    hash_value_type const* probe_hashes,
                     null_equality compare_nulls,
                     rmm::cuda_stream_view stream,
                     rmm::mr::device_memory_resource* mr) const;
 
+  template <cudf::detail::join_kind JoinKind>
+  std::size_t compute_hash_join(cudf::table_view const& probe,
+                                device_span<size_type> left_indices,
+                                device_span<size_type> right_indices,
+                                null_equality compare_nulls,
+                                rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Computes the exact number of rows of the join output, by probing the `_hash_table`
+   * built from `_build` for tuples in `probe` without writing the output indices.
+   *
+   * @tparam JoinKind The type of join to be performed.
+   *
+   * @param probe Table of probe side columns to join.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The number of rows of the join output.
+   */
+  template <cudf::detail::join_kind JoinKind>
+  std::size_t compute_join_size(cudf::table_view const& probe,
+                                null_equality compare_nulls,
+                                rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Returns the view of the Bloom filter, built or deserialized, which has no blocks if the
+   * filter is disabled.
+   */
+  cudf::detail::bloom_filter_view bloom_filter() const;
+
   /**
    * @brief Probes the `_hash_table` built from `_build` for tuples in `probe_table`,
    * and returns the output indices of `build_table` and `probe_table` as a combined table,
@@ -278,6 +553,8 @@ struct hash_join::hash_join_impl {
    * @tparam JoinKind The type of join to be performed.
    *
    * @param probe_table Table of probe side columns to join.
+   * @param probe_hashes Precomputed hash values of the rows of `probe`, or `nullptr` to hash the
+   * rows.
    * @param compare_nulls Controls whether null join-key values should match or not.
    * @param stream CUDA stream used for device memory operations and kernel launches.
    * @param mr Device memory resource used to allocate the returned vectors.
@@ -288,9 +565,34 @@ struct hash_join::hash_join_impl {
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   probe_join_indices(cudf::table_view const& probe,
+                     hash_value_type const* probe_hashes,
                      null_equality compare_nulls,
                      rmm::cuda_stream_view stream,
                      rmm::mr::device_memory_resource* mr) const;
+
+  /**
+   * @brief Probes the `_hash_table` built from `_build` for tuples in `probe_table`,
+   * and writes the output indices of `build_table` and `probe_table` to the given buffers.
+   *
+   * @throw cudf::logic_error if hash table is null.
+   * @throw cudf::logic_error if the buffers are too small for the output indices.
+   *
+   * @tparam JoinKind The type of join to be performed.
+   *
+   * @param probe_table Table of probe side columns to join.
+   * @param left_indices Buffer for the output indices of `probe_table`.
+   * @param right_indices Buffer for the output indices of `_build`.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The number of output indices written to each buffer.
+   */
+  template <cudf::detail::join_kind JoinKind>
+  std::size_t probe_join_indices(cudf::table_view const& probe,
+                                 device_span<size_type> left_indices,
+                                 device_span<size_type> right_indices,
+                                 null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream) const;
 };
 
 }  // namespace cudf
@@ -16,12 +16,22 @@
 #include <join/hash_join.cuh>
 #include <join/join_common_utils.hpp>
 
+#include <cudf/copying.hpp>
+#include <cudf/detail/hashing.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
 
 namespace cudf {
 namespace detail {
@@ -39,7 +49,7 @@ inner_join(table_view const& left_input,
   auto matched = cudf::dictionary::detail::match_dictionaries(
     {left_input, right_input},
     stream,
-    rmm::mr::get_current_device_resource());  // temporary objects returned
+    cudf::get_current_temp_resource());  // temporary objects returned
 
   // now rebuild the table views with the updated ones
   auto const left  = matched.second.front();
@@ -71,13 +81,14 @@ std::unique_ptr<table> inner_join(table_view const& left_input,
   auto matched = cudf::dictionary::detail::match_dictionaries(
     {left_input.select(left_on), right_input.select(right_on)},
     stream,
-    rmm::mr::get_current_device_resource());  // temporary objects returned
+    cudf::get_current_temp_resource());  // temporary objects returned
 
   // now rebuild the table views with the updated ones
   auto const left  = scatter_columns(matched.second.front(), left_on, left_input);
   auto const right = scatter_columns(matched.second.back(), right_on, right_input);
 
-  auto join_indices = inner_join(left.select(left_on), right.select(right_on), compare_nulls, mr);
+  auto join_indices =
+    inner_join(left.select(left_on), right.select(right_on), compare_nulls, stream, mr);
   std::unique_ptr<table> left_result  = detail::gather(left,
                                                       join_indices.first->begin(),
                                                       join_indices.first->end(),
@@ -106,7 +117,7 @@ left_join(table_view const& left_input,
   auto matched = cudf::dictionary::detail::match_dictionaries(
     {left_input, right_input},  // these should match
     stream,
-    rmm::mr::get_current_device_resource());  // temporary objects returned
+    cudf::get_current_temp_resource());  // temporary objects returned
   // now rebuild the table views with the updated ones
   table_view const left  = matched.second.front();
   table_view const right = matched.second.back();
@@ -128,7 +139,7 @@ std::unique_ptr<table> left_join(table_view const& left_input,
   auto matched = cudf::dictionary::detail::match_dictionaries(
     {left_input.select(left_on), right_input.select(right_on)},  // these should match
     stream,
-    rmm::mr::get_current_device_resource());  // temporary objects returned
+    cudf::get_current_temp_resource());  // temporary objects returned
   // now rebuild the table views with the updated ones
   table_view const left  = scatter_columns(matched.second.front(), left_on, left_input);
   table_view const right = scatter_columns(matched.second.back(), right_on, right_input);
@@ -169,7 +180,7 @@ full_join(table_view const& left_input,
   auto matched = cudf::dictionary::detail::match_dictionaries(
     {left_input, right_input},  // these should match
     stream,
-    rmm::mr::get_current_device_resource());  // temporary objects returned
+    cudf::get_current_temp_resource());  // temporary objects returned
   // now rebuild the table views with the updated ones
   table_view const left  = matched.second.front();
   table_view const right = matched.second.back();
@@ -191,7 +202,7 @@ std::unique_ptr<table> full_join(table_view const& left_input,
   auto matched = cudf::dictionary::detail::match_dictionaries(
     {left_input.select(left_on), right_input.select(right_on)},  // these should match
     stream,
-    rmm::mr::get_current_device_resource());  // temporary objects returned
+    cudf::get_current_temp_resource());  // temporary objects returned
   // now rebuild the table views with the updated ones
   table_view const left  = scatter_columns(matched.second.front(), left_on, left_input);
   table_view const right = scatter_columns(matched.second.back(), right_on, right_input);
@@ -223,13 +234,54 @@ std::unique_ptr<table> full_join(table_view const& left_input,
 
 hash_join::~hash_join() = default;
 
+hash_join::hash_join(hash_join&&) = default;
+
+hash_join& hash_join::operator=(hash_join&&) = default;
+
+hash_join::hash_join(cudf::table_view const& build,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream)
+  : hash_join(build, compare_nulls, hash_join_filter::NONE, stream)
+{
+}
+
+hash_join::hash_join(cudf::table_view const& build,
+                     null_equality compare_nulls,
+                     hash_join_filter filter,
+                     rmm::cuda_stream_view stream)
+  : impl{std::make_unique<const hash_join::hash_join_impl>(
+      build, compare_nulls, filter, nullptr, stream)}
+{
+}
+
 hash_join::hash_join(cudf::table_view const& build,
+                     column_view const& build_hashes,
                      null_equality compare_nulls,
                      rmm::cuda_stream_view stream)
-  : impl{std::make_unique<const hash_join::hash_join_impl>(build, compare_nulls, stream)}
+{
+  cudf::detail::expects_row_hashes(build_hashes, build.num_rows());
+  impl = std::make_unique<const hash_join::hash_join_impl>(
+    build, compare_nulls, hash_join_filter::NONE, build_hashes.data<hash_value_type>(), stream);
+}
+
+hash_join::hash_join(packed_columns const& packed, rmm::cuda_stream_view stream)
+  : hash_join(packed.metadata_->data(),
+              static_cast<uint8_t const*>(packed.gpu_data->data()),
+              stream)
+{
+}
+
+hash_join::hash_join(uint8_t const* metadata, uint8_t const* gpu_data, rmm::cuda_stream_view stream)
+  : impl{std::make_unique<const hash_join::hash_join_impl>(metadata, gpu_data, stream)}
 {
 }
 
+packed_columns hash_join::pack(rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr) const
+{
+  return impl->pack(stream, mr);
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::inner_join(cudf::table_view const& probe,
@@ -237,7 +289,7 @@ hash_join::inner_join(cudf::table_view const& probe,
                       rmm::cuda_stream_view stream,
                       rmm::mr::device_memory_resource* mr) const
 {
-  return impl->inner_join(probe, compare_nulls, stream, mr);
+  return impl->inner_join(probe, nullptr, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -247,7 +299,7 @@ hash_join::left_join(cudf::table_view const& probe,
                      rmm::cuda_stream_view stream,
                      rmm::mr::device_memory_resource* mr) const
 {
-  return impl->left_join(probe, compare_nulls, stream, mr);
+  return impl->left_join(probe, nullptr, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -257,7 +309,165 @@ hash_join::full_join(cudf::table_view const& probe,
                      rmm::cuda_stream_view stream,
                      rmm::mr::device_memory_resource* mr) const
 {
-  return impl->full_join(probe, compare_nulls, stream, mr);
+  return impl->full_join(probe, nullptr, compare_nulls, stream, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join::inner_join(cudf::table_view const& probe,
+                      column_view const& probe_hashes,
+                      null_equality compare_nulls,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr) const
+{
+  cudf::detail::expects_row_hashes(probe_hashes, probe.num_rows());
+  return impl->inner_join(
+    probe, probe_hashes.data<hash_value_type>(), compare_nulls, stream, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join::left_join(cudf::table_view const& probe,
+                     column_view const& probe_hashes,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr) const
+{
+  cudf::detail::expects_row_hashes(probe_hashes, probe.num_rows());
+  return impl->left_join(
+    probe, probe_hashes.data<hash_value_type>(), compare_nulls, stream, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join::full_join(cudf::table_view const& probe,
+                     column_view const& probe_hashes,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr) const
+{
+  cudf::detail::expects_row_hashes(probe_hashes, probe.num_rows());
+  return impl->full_join(
+    probe, probe_hashes.data<hash_value_type>(), compare_nulls, stream, mr);
+}
+
+std::size_t hash_join::inner_join(cudf::table_view const& probe,
+                                  device_span<size_type> left_indices,
+                                  device_span<size_type> right_indices,
+                                  null_equality compare_nulls,
+                                  rmm::cuda_stream_view stream) const
+{
+  return impl->inner_join(probe, left_indices, right_indices, compare_nulls, stream);
+}
+
+std::size_t hash_join::left_join(cudf::table_view const& probe,
+                                 device_span<size_type> left_indices,
+                                 device_span<size_type> right_indices,
+                                 null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream) const
+{
+  return impl->left_join(probe, left_indices, right_indices, compare_nulls, stream);
+}
+
+std::size_t hash_join::full_join(cudf::table_view const& probe,
+                                 device_span<size_type> left_indices,
+                                 device_span<size_type> right_indices,
+                                 null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream) const
+{
+  return impl->full_join(probe, left_indices, right_indices, compare_nulls, stream);
+}
+
+std::size_t hash_join::inner_join_size(cudf::table_view const& probe,
+                                       null_equality compare_nulls,
+                                       rmm::cuda_stream_view stream) const
+{
+  return impl->inner_join_size(probe, compare_nulls, stream);
+}
+
+std::size_t hash_join::left_join_size(cudf::table_view const& probe,
+                                      null_equality compare_nulls,
+                                      rmm::cuda_stream_view stream) const
+{
+  return impl->left_join_size(probe, compare_nulls, stream);
+}
+
+std::size_t hash_join::full_join_size(cudf::table_view const& probe,
+                                      null_equality compare_nulls,
+                                      rmm::cuda_stream_view stream) const
+{
+  return impl->full_join_size(probe, compare_nulls, stream);
+}
+
+hash_join::chunked_inner_join hash_join::inner_join_chunked(cudf::table_view const& probe,
+                                                           std::size_t max_rows,
+                                                           null_equality compare_nulls,
+                                                           rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(max_rows > 0, "Chunks of a join must have at least one row");
+  return chunked_inner_join(*this, probe, max_rows, compare_nulls, stream);
+}
+
+hash_join::chunked_inner_join::chunked_inner_join(hash_join const& join,
+                                                  cudf::table_view const& probe,
+                                                  std::size_t max_rows,
+                                                  null_equality compare_nulls,
+                                                  rmm::cuda_stream_view stream)
+  : _join{&join},
+    _probe{probe},
+    _max_rows{std::min<std::size_t>(max_rows, std::numeric_limits<size_type>::max())},
+    _compare_nulls{compare_nulls},
+    _stream{stream},
+    _row_offsets{join.impl->inner_join_row_offsets(probe, compare_nulls, stream)},
+    _size{_row_offsets.back_element(stream)}
+{
+}
+
+bool hash_join::chunked_inner_join::has_next() const { return _next_offset < _size; }
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join::chunked_inner_join::next(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(has_next(), "No chunk of the join remains");
+
+  // The chunk ends before the first probe row whose output rows don't all fit in it
+  auto const max_end_offset = _next_offset + static_cast<int64_t>(_max_rows);
+  auto const end_offset_it  = thrust::upper_bound(rmm::exec_policy(_stream),
+                                                  _row_offsets.begin() + _next_row + 1,
+                                                  _row_offsets.end(),
+                                                  max_end_offset);
+  auto end_row = static_cast<size_type>(thrust::distance(_row_offsets.begin(), end_offset_it)) - 1;
+  // A probe row with more output rows than a chunk is returned in a chunk of its own
+  if (end_row == _next_row) { ++end_row; }
+
+  auto const end_offset = _row_offsets.element(end_row, _stream);
+  auto const chunk_size = static_cast<std::size_t>(end_offset - _next_offset);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(chunk_size, _stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(chunk_size, _stream, mr);
+
+  auto const chunk_probe = cudf::slice(_probe, {_next_row, end_row}).front();
+  _join->impl->inner_join(chunk_probe,
+                          device_span<size_type>{*left_indices},
+                          device_span<size_type>{*right_indices},
+                          _compare_nulls,
+                          _stream);
+
+  // The indices of the chunk's probe rows are offset to the rows of the whole probe table
+  thrust::transform(rmm::exec_policy(_stream),
+                    left_indices->begin(),
+                    left_indices->end(),
+                    left_indices->begin(),
+                    [first_row = _next_row] __device__(size_type index) {
+                      return index + first_row;
+                    });
+
+  _next_row    = end_row;
+  _next_offset = end_offset;
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
 }
 
 // external APIs
@@ -267,10 +477,11 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 inner_join(table_view const& left,
            table_view const& right,
            null_equality compare_nulls,
+           rmm::cuda_stream_view stream,
            rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::inner_join(left, right, compare_nulls, rmm::cuda_stream_default, mr);
+  return detail::inner_join(left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<table> inner_join(table_view const& left,
@@ -278,11 +489,11 @@ std::unique_ptr<table> inner_join(table_view const& left,
                                   std::vector<size_type> const& left_on,
                                   std::vector<size_type> const& right_on,
                                   null_equality compare_nulls,
+                                  rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::inner_join(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+  return detail::inner_join(left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -290,10 +501,11 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 left_join(table_view const& left,
           table_view const& right,
           null_equality compare_nulls,
+          rmm::cuda_stream_view stream,
           rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::left_join(left, right, compare_nulls, rmm::cuda_stream_default, mr);
+  return detail::left_join(left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<table> left_join(table_view const& left,
@@ -301,11 +513,11 @@ std::unique_ptr<table> left_join(table_view const& left,
                                  std::vector<size_type> const& left_on,
                                  std::vector<size_type> const& right_on,
                                  null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::left_join(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+  return detail::left_join(left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -313,10 +525,11 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
 full_join(table_view const& left,
           table_view const& right,
           null_equality compare_nulls,
+          rmm::cuda_stream_view stream,
           rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::full_join(left, right, compare_nulls, rmm::cuda_stream_default, mr);
+  return detail::full_join(left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<table> full_join(table_view const& left,
@@ -324,11 +537,11 @@ std::unique_ptr<table> full_join(table_view const& left,
                                  std::vector<size_type> const& left_on,
                                  std::vector<size_type> const& right_on,
                                  null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::full_join(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+  return detail::full_join(left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 }  // namespace cudf
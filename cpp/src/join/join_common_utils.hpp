@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,7 +21,7 @@
 
 #include <rmm/device_uvector.hpp>
 
-#include <hash/concurrent_unordered_multimap.cuh>
+#include <hash/static_multimap.cuh>
 
 #include <limits>
 
@@ -31,20 +31,17 @@ constexpr size_type MAX_JOIN_SIZE{std::numeric_limits<size_type>::max()};
 
 constexpr int DEFAULT_JOIN_BLOCK_SIZE = 128;
 constexpr int DEFAULT_JOIN_CACHE_SIZE = 128;
+constexpr int DEFAULT_JOIN_CG_SIZE    = 4;
 constexpr size_type JoinNoneValue     = std::numeric_limits<size_type>::min();
 
 using VectorPair = std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
                              std::unique_ptr<rmm::device_uvector<size_type>>>;
 
-using multimap_type =
-  concurrent_unordered_multimap<hash_value_type,
-                                size_type,
-                                size_t,
-                                std::numeric_limits<hash_value_type>::max(),
-                                std::numeric_limits<size_type>::max(),
-                                default_hash<hash_value_type>,
-                                equal_to<hash_value_type>,
-                                default_allocator<thrust::pair<hash_value_type, size_type>>>;
+using multimap_type = static_multimap<hash_value_type,
+                                     size_type,
+                                     std::numeric_limits<hash_value_type>::max(),
+                                     std::numeric_limits<size_type>::max(),
+                                     DEFAULT_JOIN_CG_SIZE>;
 
 using row_hash = cudf::row_hasher<default_hash>;
 
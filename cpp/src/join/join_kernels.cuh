@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/table/table_device_view.cuh>
 
+#include "bloom_filter.cuh"
 #include "join_common_utils.hpp"
 
 namespace cudf {
@@ -67,7 +68,9 @@ constexpr auto remap_sentinel_hash(H hash, S sentinel)
  * @brief Builds a hash table from a row hasher that maps the hash
  * values of each row to its respective row index.
  *
- * @tparam multimap_type The type of the hash table
+ * Every row is inserted by a cooperative group of `multimap_type::window_size` threads.
+ *
+ * @tparam multimap_type The type of the device view of the hash table
  *
  * @param[in,out] multi_map The hash table to be built to insert rows into
  * @param[in] hash_build Row hasher for the build table
@@ -83,7 +86,8 @@ __global__ void build_hash_table(multimap_type multi_map,
                                  bitmask_type const* row_bitmask,
                                  int* error)
 {
-  cudf::size_type i = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const group  = multimap_type::probing_group();
+  cudf::size_type i = (threadIdx.x + blockIdx.x * blockDim.x) / group.size();
 
   while (i < build_table_num_rows) {
     if (!row_bitmask || cudf::bit_is_set(row_bitmask, i)) {
@@ -93,22 +97,61 @@ __global__ void build_hash_table(multimap_type multi_map,
       // Insert the (row hash value, row index) into the map
       // using the row hash value to determine the location in the
       // hash map where the new pair should be inserted
-      auto const insert_location =
-        multi_map.insert(thrust::make_pair(row_hash_value, i), true, row_hash_value);
+      auto const inserted = multi_map.insert(group, row_hash_value, i);
 
       // If the insert failed, set the error code accordingly
-      if (multi_map.end() == insert_location) { *error = 1; }
+      if (!inserted && group.thread_rank() == 0) { *error = 1; }
     }
-    i += blockDim.x * gridDim.x;
+    i += (blockDim.x * gridDim.x) / group.size();
   }
 }
 
+/**
+ * @brief Probes the window of the hash table slots at `window` for the probe row
+ * `probe_row_index`, with each thread of the cooperative group of the row probing one slot.
+ *
+ * @tparam multimap_type The type of the device view of the hash table
+ * @tparam group_type The type of the cooperative group of the row
+ * @tparam hash_value_type The type of the hash values of the rows
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] group The cooperative group probing the row
+ * @param[in] window The first slot of the probed window
+ * @param[in] probe_row_index The index of the probe row
+ * @param[in] probe_row_hash_value The hash value of the probe row
+ * @param[in] check_row_equality The row equality comparator
+ * @param[out] build_row_index The index of the matching build row of the thread's slot if any
+ * @param[out] is_empty Whether the thread's slot is empty
+ *
+ * @returns Whether the thread's slot matches the probe row
+ */
+template <typename multimap_type, typename group_type, typename hash_value_type>
+__device__ bool probe_window(multimap_type const& multi_map,
+                             group_type const& group,
+                             cudf::size_type window,
+                             cudf::size_type probe_row_index,
+                             hash_value_type probe_row_hash_value,
+                             row_equality const& check_row_equality,
+                             cudf::size_type& build_row_index,
+                             bool& is_empty)
+{
+  auto const slot = multi_map.slot(window, group.thread_rank());
+  auto const key  = multi_map.key(slot);
+  is_empty        = multi_map.get_unused_key() == key;
+  // First check that the hash values of the two rows match, and only then that the rows are equal
+  if (key != probe_row_hash_value) { return false; }
+  build_row_index = multi_map.element(slot);
+  return check_row_equality(probe_row_index, build_row_index);
+}
+
 /**
  * @brief Computes the output size of joining the probe table to the build table
  * by probing the hash map with the probe table and counting the number of matches.
  *
+ * Every probe row is probed by a cooperative group of `multimap_type::window_size` threads.
+ *
  * @tparam JoinKind The type of join to be performed
- * @tparam multimap_type The datatype of the hash table
+ * @tparam multimap_type The type of the device view of the hash table
  * @tparam block_size The number of threads per block for this kernel
  *
  * @param[in] multi_map The hash table built on the build table
@@ -116,8 +159,12 @@ __global__ void build_hash_table(multimap_type multi_map,
  * @param[in] probe_table The probe table
  * @param[in] hash_probe Row hasher for the probe table
  * @param[in] check_row_equality The row equality comparator
+ * @param[in] filter The Bloom filter of the build rows' hash values, which rejects probe rows
+ * before the hash table is probed
  * @param[in] probe_table_num_rows The number of rows in the probe table
  * @param[out] output_size The resulting output size
+ * @param[out] matched_build_rows If not null, the flags of the build rows to set when they match
+ * a probe row
  */
 template <join_kind JoinKind,
           typename multimap_type,
@@ -128,8 +175,10 @@ __global__ void compute_join_output_size(multimap_type multi_map,
                                          table_device_view probe_table,
                                          row_hash hash_probe,
                                          row_equality check_row_equality,
+                                         bloom_filter_view filter,
                                          const cudf::size_type probe_table_num_rows,
-                                         estimate_size_type* output_size)
+                                         estimate_size_type* output_size,
+                                         bool* matched_build_rows = nullptr)
 {
   // This kernel probes multiple elements in the probe_table and store the number of matches found
   // inside a register. A block reduction is used at the end to calculate the matches per thread
@@ -138,10 +187,11 @@ __global__ void compute_join_output_size(multimap_type multi_map,
   // counter.
 
   cudf::size_type thread_counter{0};
-  const cudf::size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
-  const cudf::size_type stride    = blockDim.x * gridDim.x;
+  auto const group                = multimap_type::probing_group();
+  const cudf::size_type start_idx = (threadIdx.x + blockIdx.x * blockDim.x) / group.size();
+  const cudf::size_type stride    = (blockDim.x * gridDim.x) / group.size();
   const auto unused_key           = multi_map.get_unused_key();
-  const auto end                  = multi_map.end();
+  const auto num_windows          = multi_map.num_windows();
 
   for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
        probe_row_index += stride) {
@@ -149,47 +199,34 @@ __global__ void compute_join_output_size(multimap_type multi_map,
     // hash value to determine the location where to search for the row in the hash map
     auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
 
-    auto found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
-
-    // for left-joins we always need to add an output
-    bool running     = (JoinKind == join_kind::LEFT_JOIN) || (end != found);
-    bool found_match = false;
-
-    while (running) {
-      // TODO Simplify this logic...
-
-      // Left joins always have an entry in the output
-      if (JoinKind == join_kind::LEFT_JOIN && (end == found)) {
-        running = false;
-      }
-      // Stop searching after encountering an empty hash table entry
-      else if (unused_key == found->first) {
-        running = false;
-      }
-      // First check that the hash values of the two rows match
-      else if (found->first == probe_row_hash_value) {
-        // If the hash values are equal, check that the rows are equal
-        if (check_row_equality(probe_row_index, found->second)) {
-          // If the rows are equal, then we have found a true match
-          found_match = true;
-          ++thread_counter;
-        }
-        // Continue searching for matching rows until you hit an empty hash map entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
-      } else {
-        // Continue searching for matching rows until you hit an empty hash table entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
+    auto window = multi_map.initial_window(probe_row_hash_value);
+    // Rows rejected by the filter match no build row, so the hash table isn't probed
+    auto const windows_to_probe = filter.contains(probe_row_hash_value) ? num_windows : 0;
+    bool found_match            = false;
+    // Stop searching after the first window with an empty hash table entry
+    for (cudf::size_type probed_windows = 0; probed_windows < windows_to_probe; ++probed_windows) {
+      cudf::size_type build_row_index{};
+      bool is_empty{};
+      auto const is_match = probe_window(multi_map,
+                                         group,
+                                         window,
+                                         probe_row_index,
+                                         probe_row_hash_value,
+                                         check_row_equality,
+                                         build_row_index,
+                                         is_empty);
+      if (is_match) {
+        ++thread_counter;
+        if (matched_build_rows != nullptr) { matched_build_rows[build_row_index] = true; }
       }
+      found_match = group.any(is_match) || found_match;
+      if (group.any(is_empty)) { break; }
+      window = multi_map.next_window(window);
+    }
 
-      if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match)) { ++thread_counter; }
+    // Left joins always have an entry in the output
+    if ((JoinKind == join_kind::LEFT_JOIN) && !found_match && group.thread_rank() == 0) {
+      ++thread_counter;
     }
   }
 
@@ -201,6 +238,73 @@ __global__ void compute_join_output_size(multimap_type multi_map,
   if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
 }
 
+/**
+ * @brief Computes the number of output rows of every probe row of the inner join of the probe
+ * table to the build table, by probing the hash map with the probe table and counting the matches
+ * of each row.
+ *
+ * Every probe row is probed by a cooperative group of `multimap_type::window_size` threads.
+ *
+ * @tparam multimap_type The type of the device view of the hash table
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] build_table The build table
+ * @param[in] probe_table The probe table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality The row equality comparator
+ * @param[in] filter The Bloom filter of the build rows' hash values, which rejects probe rows
+ * before the hash table is probed
+ * @param[in] probe_table_num_rows The number of rows in the probe table
+ * @param[in,out] row_sizes The zero-initialized output sizes of the probe rows, to which the
+ * number of matches of every row is added
+ */
+template <typename multimap_type>
+__global__ void compute_join_output_row_sizes(multimap_type multi_map,
+                                              table_device_view build_table,
+                                              table_device_view probe_table,
+                                              row_hash hash_probe,
+                                              row_equality check_row_equality,
+                                              bloom_filter_view filter,
+                                              const cudf::size_type probe_table_num_rows,
+                                              int64_t* row_sizes)
+{
+  auto const group                = multimap_type::probing_group();
+  const cudf::size_type start_idx = (threadIdx.x + blockIdx.x * blockDim.x) / group.size();
+  const cudf::size_type stride    = (blockDim.x * gridDim.x) / group.size();
+  const auto unused_key           = multi_map.get_unused_key();
+  const auto num_windows          = multi_map.num_windows();
+
+  for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
+
+    auto window = multi_map.initial_window(probe_row_hash_value);
+    // Rows rejected by the filter match no build row, so the hash table isn't probed
+    auto const windows_to_probe = filter.contains(probe_row_hash_value) ? num_windows : 0;
+    int64_t row_counter{0};
+    // Stop searching after the first window with an empty hash table entry
+    for (cudf::size_type probed_windows = 0; probed_windows < windows_to_probe; ++probed_windows) {
+      cudf::size_type build_row_index{};
+      bool is_empty{};
+      if (probe_window(multi_map,
+                       group,
+                       window,
+                       probe_row_index,
+                       probe_row_hash_value,
+                       check_row_equality,
+                       build_row_index,
+                       is_empty)) {
+        ++row_counter;
+      }
+      if (group.any(is_empty)) { break; }
+      window = multi_map.next_window(window);
+    }
+
+    // Every thread of the group counts the matches of its slots
+    if (row_counter > 0) { atomicAdd(row_sizes + probe_row_index, row_counter); }
+  }
+}
+
 /**
  * @brief Computes the output size of joining the left table to the right table.
  *
@@ -283,8 +387,12 @@ __device__ void flush_output_cache(const unsigned int activemask,
  * between the probe and hash table and generate the output for the desired
  * Join operation.
  *
+ * Every probe row is probed by a cooperative group of `multimap_type::window_size` threads, so the
+ * kernel must be launched with `multimap_type::window_size` threads per probe row. Every thread
+ * adds at most one pair to the output cache of its warp per window.
+ *
  * @tparam JoinKind The type of join to be performed
- * @tparam multimap_type The type of the hash table
+ * @tparam multimap_type The type of the device view of the hash table
  * @tparam block_size The number of threads per block for this kernel
  * @tparam output_cache_size The side of the shared memory buffer to cache join output results
  *
@@ -293,6 +401,8 @@ __device__ void flush_output_cache(const unsigned int activemask,
  * @param[in] probe_table The probe table
  * @param[in] hash_probe Row hasher for the probe table
  * @param[in] check_row_equality The row equality comparator
+ * @param[in] filter The Bloom filter of the build rows' hash values, which rejects probe rows
+ * before the hash table is probed
  * @param[out] join_output_l The left result of the join operation
  * @param[out] join_output_r The right result of the join operation
  * @param[in,out] current_idx A global counter used by threads to coordinate writes to the global
@@ -308,6 +418,7 @@ __global__ void probe_hash_table(multimap_type multi_map,
                                  table_device_view probe_table,
                                  row_hash hash_probe,
                                  row_equality check_row_equality,
+                                 bloom_filter_view filter,
                                  size_type* join_output_l,
                                  size_type* join_output_r,
                                  cudf::size_type* current_idx,
@@ -326,65 +437,64 @@ __global__ void probe_hash_table(multimap_type multi_map,
 
   __syncwarp();
 
-  size_type probe_row_index = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const group          = multimap_type::probing_group();
+  size_type probe_row_index = (threadIdx.x + blockIdx.x * blockDim.x) / group.size();
 
   const unsigned int activemask = __ballot_sync(0xffffffff, probe_row_index < probe_table_num_rows);
   if (probe_row_index < probe_table_num_rows) {
-    const auto unused_key = multi_map.get_unused_key();
-    const auto end        = multi_map.end();
+    const auto unused_key  = multi_map.get_unused_key();
+    const auto num_windows = multi_map.num_windows();
 
     // Search the hash map for the hash value of the probe row using the row's
     // hash value to determine the location where to search for the row in the hash map
     auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
 
-    auto found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
-
-    bool running = (JoinKind == join_kind::LEFT_JOIN) ||
-                   (end != found);  // for left-joins we always need to add an output
+    auto window = multi_map.initial_window(probe_row_hash_value);
+    cudf::size_type probed_windows{0};
+    // Rows rejected by the filter match no build row, so the hash table isn't probed
+    bool running     = filter.contains(probe_row_hash_value);
     bool found_match = false;
+
+    // If performing a LEFT join and the row was rejected, insert a Null into the output, which
+    // fits in the empty output cache
+    if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && group.thread_rank() == 0) {
+      add_pair_to_cache(probe_row_index,
+                        static_cast<size_type>(JoinNoneValue),
+                        current_idx_shared,
+                        warp_id,
+                        join_shared_l[warp_id],
+                        join_shared_r[warp_id]);
+    }
+
     while (__any_sync(activemask, running)) {
       if (running) {
-        // TODO Simplify this logic...
-
-        // Left joins always have an entry in the output
-        if ((JoinKind == join_kind::LEFT_JOIN) && (end == found)) {
-          running = false;
-        }
-        // Stop searching after encountering an empty hash table entry
-        else if (unused_key == found->first) {
-          running = false;
-        }
-        // First check that the hash values of the two rows match
-        else if (found->first == probe_row_hash_value) {
-          // If the hash values are equal, check that the rows are equal
-          // TODO : REMOVE : if(row_equal{probe_table, build_table}(probe_row_index, found->second))
-          if (check_row_equality(probe_row_index, found->second)) {
-            // If the rows are equal, then we have found a true match
-            found_match = true;
-            add_pair_to_cache(probe_row_index,
-                              found->second,
-                              current_idx_shared,
-                              warp_id,
-                              join_shared_l[warp_id],
-                              join_shared_r[warp_id]);
-          }
-          // Continue searching for matching rows until you hit an empty hash map entry
-          ++found;
-          // If you hit the end of the hash map, wrap around to the beginning
-          if (end == found) found = multi_map.begin();
-          // Next entry is empty, stop searching
-          if (unused_key == found->first) running = false;
-        } else {
-          // Continue searching for matching rows until you hit an empty hash table entry
-          ++found;
-          // If you hit the end of the hash map, wrap around to the beginning
-          if (end == found) found = multi_map.begin();
-          // Next entry is empty, stop searching
-          if (unused_key == found->first) running = false;
+        cudf::size_type build_row_index{};
+        bool is_empty{};
+        auto const is_match = probe_window(multi_map,
+                                           group,
+                                           window,
+                                           probe_row_index,
+                                           probe_row_hash_value,
+                                           check_row_equality,
+                                           build_row_index,
+                                           is_empty);
+        if (is_match) {
+          add_pair_to_cache(probe_row_index,
+                            build_row_index,
+                            current_idx_shared,
+                            warp_id,
+                            join_shared_l[warp_id],
+                            join_shared_r[warp_id]);
         }
+        found_match = group.any(is_match) || found_match;
+
+        // Stop searching after the first window with an empty hash table entry
+        window  = multi_map.next_window(window);
+        running = !group.any(is_empty) && (++probed_windows < num_windows);
 
         // If performing a LEFT join and no match was found, insert a Null into the output
-        if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match)) {
+        if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match) &&
+            group.thread_rank() == 0) {
           add_pair_to_cache(probe_row_index,
                             static_cast<size_type>(JoinNoneValue),
                             current_idx_shared,
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/conditional_join_kernels.cuh>
+#include <join/hash_join.cuh>
+#include <join/join_common_utils.hpp>
+#include <join/mixed_join_kernels.cuh>
+
+#include <cudf/ast/detail/linearizer.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Computes the join operation between two tables on equal keys and a condition, and
+ * returns the output indices of the left and right tables.
+ *
+ * The hash table is built on `right_equality` and probed with `left_equality`. The condition is
+ * evaluated on each pair of rows with equal keys as it is found, so the result of the equality
+ * join is never materialized.
+ *
+ * @param left_equality The left table used for the equality join
+ * @param right_equality The right table used for the equality join
+ * @param left_conditional The left table used for the conditional join
+ * @param right_conditional The right table used for the conditional join
+ * @param binary_predicate The condition on which to join
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param JoinKind The type of join to be performed
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors
+ *
+ * @return Join output indices vector pair
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+get_mixed_join_indices(table_view const& left_equality,
+                       table_view const& right_equality,
+                       table_view const& left_conditional,
+                       table_view const& right_conditional,
+                       ast::expression const& binary_predicate,
+                       null_equality compare_nulls,
+                       join_kind JoinKind,
+                       rmm::cuda_stream_view stream,
+                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_conditional.num_rows() == left_equality.num_rows(),
+               "The left conditional and equality tables must have the same number of rows");
+  CUDF_EXPECTS(right_conditional.num_rows() == right_equality.num_rows(),
+               "The right conditional and equality tables must have the same number of rows");
+  CUDF_EXPECTS(0 != left_equality.num_columns(), "Left equality table is empty");
+  CUDF_EXPECTS(std::equal(std::cbegin(right_equality),
+                          std::cend(right_equality),
+                          std::cbegin(left_equality),
+                          std::cend(left_equality),
+                          [](const auto& r, const auto& l) { return r.type() == l.type(); }),
+               "Mismatch in joining column data types");
+
+  // Linearize the AST, which also checks that the column references and types are valid
+  auto const expr_linearizer =
+    ast::detail::linearizer(binary_predicate, left_conditional, right_conditional);
+  CUDF_EXPECTS(expr_linearizer.root_data_type() == data_type{type_id::BOOL8},
+               "The join condition must produce a boolean output");
+
+  // Trivial left join case - exit early
+  if ((JoinKind == join_kind::LEFT_JOIN) && (right_equality.num_rows() == 0)) {
+    return get_trivial_left_join_indices(left_equality, stream, mr);
+  }
+  if (left_equality.num_rows() == 0 || right_equality.num_rows() == 0) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  auto const hash_table       = build_join_hash_table(right_equality, compare_nulls, stream);
+  auto const device_plan_data = make_device_ast_plan(expr_linearizer, stream);
+  auto const& device_plan     = device_plan_data.second;
+
+  auto left_equality_table     = table_device_view::create(left_equality, stream);
+  auto right_equality_table    = table_device_view::create(right_equality, stream);
+  auto left_conditional_table  = table_device_view::create(left_conditional, stream);
+  auto right_conditional_table = table_device_view::create(right_conditional, stream);
+
+  row_hash hash_probe{*left_equality_table};
+  row_equality equality{
+    *left_equality_table, *right_equality_table, compare_nulls == null_equality::EQUAL};
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  auto const shmem_size_per_block = join_condition_shmem_size(device_plan, block_size);
+
+  // Only the candidates with equal keys are evaluated, so the output size is computed exactly
+  int numBlocks{-1};
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &numBlocks,
+    compute_mixed_join_output_size<multimap_type::device_view, block_size>,
+    block_size,
+    shmem_size_per_block));
+  int device_id{-1};
+  CUDA_TRY(cudaGetDevice(&device_id));
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device_id));
+
+  rmm::device_scalar<int64_t> size(0, stream);
+  compute_mixed_join_output_size<multimap_type::device_view, block_size>
+    <<<numBlocks * num_sms, block_size, shmem_size_per_block, stream.value()>>>(
+      hash_table->get_device_view(),
+      *left_equality_table,
+      *right_equality_table,
+      *left_conditional_table,
+      *right_conditional_table,
+      hash_probe,
+      equality,
+      JoinKind,
+      device_plan,
+      size.data());
+  CHECK_CUDA(stream.value());
+
+  auto const join_size = size.value(stream);
+  CUDF_EXPECTS(join_size < static_cast<int64_t>(std::numeric_limits<cudf::size_type>::max()),
+               "Maximum join output size exceeded");
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  if (join_size == 0) { return std::make_pair(std::move(left_indices), std::move(right_indices)); }
+
+  rmm::device_scalar<size_type> write_index(0, stream);
+  // Every probe row is probed by a cooperative group of threads
+  auto const num_blocks = util::div_rounding_up_safe<int64_t>(
+    static_cast<int64_t>(left_equality_table->num_rows()) * multimap_type::window_size,
+    block_size);
+  mixed_join<multimap_type::device_view, block_size, DEFAULT_JOIN_CACHE_SIZE>
+    <<<num_blocks, block_size, shmem_size_per_block, stream.value()>>>(
+      hash_table->get_device_view(),
+      *left_equality_table,
+      *right_equality_table,
+      *left_conditional_table,
+      *right_conditional_table,
+      hash_probe,
+      equality,
+      JoinKind,
+      device_plan,
+      left_indices->data(),
+      right_indices->data(),
+      write_index.data(),
+      static_cast<cudf::size_type>(join_size));
+  CHECK_CUDA(stream.value());
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_inner_join(table_view const& left_equality,
+                 table_view const& right_equality,
+                 table_view const& left_conditional,
+                 table_view const& right_conditional,
+                 ast::expression const& binary_predicate,
+                 null_equality compare_nulls,
+                 rmm::cuda_stream_view stream,
+                 rmm::mr::device_memory_resource* mr)
+{
+  return get_mixed_join_indices(left_equality,
+                                right_equality,
+                                left_conditional,
+                                right_conditional,
+                                binary_predicate,
+                                compare_nulls,
+                                join_kind::INNER_JOIN,
+                                stream,
+                                mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_left_join(table_view const& left_equality,
+                table_view const& right_equality,
+                table_view const& left_conditional,
+                table_view const& right_conditional,
+                ast::expression const& binary_predicate,
+                null_equality compare_nulls,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr)
+{
+  return get_mixed_join_indices(left_equality,
+                                right_equality,
+                                left_conditional,
+                                right_conditional,
+                                binary_predicate,
+                                compare_nulls,
+                                join_kind::LEFT_JOIN,
+                                stream,
+                                mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_inner_join(table_view const& left_equality,
+                 table_view const& right_equality,
+                 table_view const& left_conditional,
+                 table_view const& right_conditional,
+                 ast::expression const& binary_predicate,
+                 null_equality compare_nulls,
+                 rmm::cuda_stream_view stream,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::mixed_inner_join(left_equality,
+                                  right_equality,
+                                  left_conditional,
+                                  right_conditional,
+                                  binary_predicate,
+                                  compare_nulls,
+                                  stream,
+                                  mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_left_join(table_view const& left_equality,
+                table_view const& right_equality,
+                table_view const& left_conditional,
+                table_view const& right_conditional,
+                ast::expression const& binary_predicate,
+                null_equality compare_nulls,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::mixed_left_join(left_equality,
+                                 right_equality,
+                                 left_conditional,
+                                 right_conditional,
+                                 binary_predicate,
+                                 compare_nulls,
+                                 stream,
+                                 mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <join/conditional_join_kernels.cuh>
+#include <join/join_common_utils.hpp>
+#include <join/join_kernels.cuh>
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/table/table_device_view.cuh>
+
+#include <cub/cub.cuh>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Computes the output size of a mixed join by probing the hash map built on the right
+ * equality table, and evaluating the condition on every pair of rows with equal keys.
+ *
+ * Every probe row is probed by a cooperative group of `multimap_type::window_size` threads.
+ *
+ * @tparam multimap_type The type of the device view of the hash table
+ * @tparam block_size The number of threads per block for this kernel
+ *
+ * @param[in] multi_map The hash table built on the right equality table
+ * @param[in] left_equality The left table of equality keys, the probe table
+ * @param[in] right_equality The right table of equality keys, the build table
+ * @param[in] left_conditional The left table of columns referenced by the condition
+ * @param[in] right_conditional The right table of columns referenced by the condition
+ * @param[in] hash_probe Row hasher for the left equality table
+ * @param[in] check_row_equality The equality comparator of left and right equality keys
+ * @param[in] JoinKind The type of join to be performed
+ * @param[in] plan The linearized join condition
+ * @param[out] output_size The resulting output size
+ */
+template <typename multimap_type, int block_size>
+__global__ void compute_mixed_join_output_size(multimap_type multi_map,
+                                               table_device_view left_equality,
+                                               table_device_view right_equality,
+                                               table_device_view left_conditional,
+                                               table_device_view right_conditional,
+                                               row_hash hash_probe,
+                                               row_equality check_row_equality,
+                                               join_kind JoinKind,
+                                               device_ast_plan plan,
+                                               int64_t* output_size)
+{
+  extern __shared__ std::int64_t intermediate_storage[];
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * plan.num_intermediates];
+
+  int64_t thread_counter{0};
+  auto const group                     = multimap_type::probing_group();
+  const cudf::size_type start_idx      = (threadIdx.x + blockIdx.x * blockDim.x) / group.size();
+  const cudf::size_type stride         = (blockDim.x * gridDim.x) / group.size();
+  const cudf::size_type probe_num_rows = left_equality.num_rows();
+  const auto unused_key                = multi_map.get_unused_key();
+  const auto num_windows               = multi_map.num_windows();
+
+  for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_num_rows;
+       probe_row_index += stride) {
+    auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
+
+    auto window      = multi_map.initial_window(probe_row_hash_value);
+    bool found_match = false;
+
+    // Every candidate with equal keys is checked against the condition until an empty entry
+    for (cudf::size_type probed_windows = 0; probed_windows < num_windows; ++probed_windows) {
+      cudf::size_type build_row_index{};
+      bool is_empty{};
+      auto const is_match = probe_window(multi_map,
+                                         group,
+                                         window,
+                                         probe_row_index,
+                                         probe_row_hash_value,
+                                         check_row_equality,
+                                         build_row_index,
+                                         is_empty) &&
+                            evaluate_join_condition(left_conditional,
+                                                    right_conditional,
+                                                    probe_row_index,
+                                                    build_row_index,
+                                                    plan,
+                                                    thread_intermediate_storage);
+      if (is_match) { ++thread_counter; }
+      found_match = group.any(is_match) || found_match;
+      if (group.any(is_empty)) { break; }
+      window = multi_map.next_window(window);
+    }
+    if ((JoinKind == join_kind::LEFT_JOIN) && !found_match && group.thread_rank() == 0) {
+      ++thread_counter;
+    }
+  }
+
+  using BlockReduce = cub::BlockReduce<int64_t, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  int64_t block_counter = BlockReduce(temp_storage).Sum(thread_counter);
+
+  // Add block counter to global counter
+  if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
+}
+
+/**
+ * @brief Probes the hash map built on the right equality table with the left equality table, and
+ * generates the output for the desired Join operation from the pairs of rows with equal keys that
+ * satisfy the condition.
+ *
+ * Every probe row is probed by a cooperative group of `multimap_type::window_size` threads, so the
+ * kernel must be launched with `multimap_type::window_size` threads per probe row.
+ *
+ * @tparam multimap_type The type of the device view of the hash table
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam output_cache_size The side of the shared memory buffer to cache join output results
+ *
+ * @param[in] multi_map The hash table built on the right equality table
+ * @param[in] left_equality The left table of equality keys, the probe table
+ * @param[in] right_equality The right table of equality keys, the build table
+ * @param[in] left_conditional The left table of columns referenced by the condition
+ * @param[in] right_conditional The right table of columns referenced by the condition
+ * @param[in] hash_probe Row hasher for the left equality table
+ * @param[in] check_row_equality The equality comparator of left and right equality keys
+ * @param[in] JoinKind The type of join to be performed
+ * @param[in] plan The linearized join condition
+ * @param[out] join_output_l The left result of the join operation
+ * @param[out] join_output_r The right result of the join operation
+ * @param[in,out] current_idx A global counter used by threads to coordinate writes to the global
+ * output
+ * @param[in] max_size The maximum size of the output
+ */
+template <typename multimap_type, cudf::size_type block_size, cudf::size_type output_cache_size>
+__global__ void mixed_join(multimap_type multi_map,
+                           table_device_view left_equality,
+                           table_device_view right_equality,
+                           table_device_view left_conditional,
+                           table_device_view right_conditional,
+                           row_hash hash_probe,
+                           row_equality check_row_equality,
+                           join_kind JoinKind,
+                           device_ast_plan plan,
+                           cudf::size_type* join_output_l,
+                           cudf::size_type* join_output_r,
+                           cudf::size_type* current_idx,
+                           const cudf::size_type max_size)
+{
+  constexpr int num_warps = block_size / detail::warp_size;
+  __shared__ cudf::size_type current_idx_shared[num_warps];
+  __shared__ cudf::size_type join_shared_l[num_warps][output_cache_size];
+  __shared__ cudf::size_type join_shared_r[num_warps][output_cache_size];
+
+  extern __shared__ std::int64_t intermediate_storage[];
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * plan.num_intermediates];
+
+  const int warp_id                    = threadIdx.x / detail::warp_size;
+  const int lane_id                    = threadIdx.x % detail::warp_size;
+  const cudf::size_type probe_num_rows = left_equality.num_rows();
+
+  if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
+
+  __syncwarp();
+
+  auto const group                = multimap_type::probing_group();
+  cudf::size_type probe_row_index = (threadIdx.x + blockIdx.x * blockDim.x) / group.size();
+
+  const unsigned int activemask = __ballot_sync(0xffffffff, probe_row_index < probe_num_rows);
+  if (probe_row_index < probe_num_rows) {
+    const auto unused_key  = multi_map.get_unused_key();
+    const auto num_windows = multi_map.num_windows();
+
+    auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
+
+    auto window = multi_map.initial_window(probe_row_hash_value);
+    cudf::size_type probed_windows{0};
+    bool running     = true;
+    bool found_match = false;
+    while (__any_sync(activemask, running)) {
+      if (running) {
+        cudf::size_type build_row_index{};
+        bool is_empty{};
+        auto const is_match = probe_window(multi_map,
+                                           group,
+                                           window,
+                                           probe_row_index,
+                                           probe_row_hash_value,
+                                           check_row_equality,
+                                           build_row_index,
+                                           is_empty) &&
+                              evaluate_join_condition(left_conditional,
+                                                      right_conditional,
+                                                      probe_row_index,
+                                                      build_row_index,
+                                                      plan,
+                                                      thread_intermediate_storage);
+        if (is_match) {
+          add_pair_to_cache(probe_row_index,
+                            build_row_index,
+                            current_idx_shared,
+                            warp_id,
+                            join_shared_l[warp_id],
+                            join_shared_r[warp_id]);
+        }
+        found_match = group.any(is_match) || found_match;
+
+        // Stop searching after the first window with an empty hash table entry
+        window  = multi_map.next_window(window);
+        running = !group.any(is_empty) && (++probed_windows < num_windows);
+
+        // If performing a LEFT join and no match was found, insert a Null into the output
+        if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match) &&
+            group.thread_rank() == 0) {
+          add_pair_to_cache(probe_row_index,
+                            static_cast<cudf::size_type>(JoinNoneValue),
+                            current_idx_shared,
+                            warp_id,
+                            join_shared_l[warp_id],
+                            join_shared_r[warp_id]);
+        }
+      }
+
+      __syncwarp(activemask);
+      // flush output cache if next iteration does not fit
+      if (current_idx_shared[warp_id] + detail::warp_size >= output_cache_size) {
+        flush_output_cache<num_warps, output_cache_size>(activemask,
+                                                         max_size,
+                                                         warp_id,
+                                                         lane_id,
+                                                         current_idx,
+                                                         current_idx_shared,
+                                                         join_shared_l,
+                                                         join_shared_r,
+                                                         join_output_l,
+                                                         join_output_r);
+        __syncwarp(activemask);
+        if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
+        __syncwarp(activemask);
+      }
+    }
+
+    // final flush of output cache
+    if (current_idx_shared[warp_id] > 0) {
+      flush_output_cache<num_warps, output_cache_size>(activemask,
+                                                       max_size,
+                                                       warp_id,
+                                                       lane_id,
+                                                       current_idx,
+                                                       current_idx_shared,
+                                                       join_shared_l,
+                                                       join_shared_r,
+                                                       join_output_l,
+                                                       join_output_r);
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
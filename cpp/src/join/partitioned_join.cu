@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <numeric>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// The hash join hashes the keys with the default seed. Partitioning with the same hash function
+// and seed would leave the keys of a partition in a fraction of the slots of its hash table.
+constexpr uint32_t partition_hash_seed = 0x9e3779b9;
+
+using join_indices = std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                               std::unique_ptr<rmm::device_uvector<size_type>>>;
+
+/**
+ * @brief The join keys of one side of a partitioned join, hash partitioned together with the
+ * indices of their rows.
+ *
+ * The partitions are kept in device memory, or copied to host memory and copied back to device
+ * memory one at a time when `spill_to_host` is true.
+ */
+class join_partitions {
+ public:
+  join_partitions(table_view const& keys,
+                  size_type num_partitions,
+                  bool spill_to_host,
+                  rmm::cuda_stream_view stream)
+  {
+    auto row_indices = make_numeric_column(
+      data_type{type_to_id<size_type>()}, keys.num_rows(), mask_state::UNALLOCATED, stream);
+    thrust::sequence(rmm::exec_policy(stream),
+                     row_indices->mutable_view().begin<size_type>(),
+                     row_indices->mutable_view().end<size_type>(),
+                     0);
+
+    std::vector<column_view> columns(keys.begin(), keys.end());
+    columns.push_back(row_indices->view());
+    std::vector<size_type> columns_to_hash(keys.num_columns());
+    std::iota(columns_to_hash.begin(), columns_to_hash.end(), 0);
+
+    auto partitioned = hash_partition(table_view{columns},
+                                      columns_to_hash,
+                                      num_partitions,
+                                      hash_id::HASH_MURMUR3,
+                                      partition_hash_seed,
+                                      stream);
+    _partitioned = std::move(partitioned.first);
+    _offsets     = std::move(partitioned.second);
+    // An empty table has no offsets
+    _offsets.resize(num_partitions, 0);
+    _offsets.push_back(_partitioned->num_rows());
+
+    if (!spill_to_host) { return; }
+
+    for (size_type p = 0; p < num_partitions; ++p) {
+      auto const packed = cudf::detail::pack(partition_view(p), stream);
+      _spilled_metadata.emplace_back(packed.metadata_->data(),
+                                     packed.metadata_->data() + packed.metadata_->size());
+      _spilled_data.emplace_back(packed.gpu_data->size());
+      CUDA_TRY(cudaMemcpyAsync(_spilled_data.back().data(),
+                               packed.gpu_data->data(),
+                               packed.gpu_data->size(),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      stream.synchronize();
+    }
+    _partitioned.reset();
+  }
+
+  /**
+   * @brief Returns the join keys of partition `p`, followed by the column of their row indices.
+   *
+   * The result of a previous call is invalidated when the partitions are spilled to host memory.
+   */
+  table_view get(size_type p, rmm::cuda_stream_view stream)
+  {
+    if (_partitioned) { return partition_view(p); }
+
+    auto const& data = _spilled_data[p];
+    _current_data    = rmm::device_buffer(data.data(), data.size(), stream);
+    return cudf::unpack(_spilled_metadata[p].data(),
+                        static_cast<uint8_t const*>(_current_data.data()));
+  }
+
+ private:
+  table_view partition_view(size_type p) const
+  {
+    return cudf::slice(_partitioned->view(), {_offsets[p], _offsets[p + 1]}).front();
+  }
+
+  std::unique_ptr<table> _partitioned;
+  std::vector<size_type> _offsets;  ///< Offsets of the partitions, followed by the number of rows
+  std::vector<std::vector<uint8_t>> _spilled_metadata;  ///< Packed metadata of each partition
+  std::vector<std::vector<uint8_t>> _spilled_data;      ///< Packed data of each partition
+  rmm::device_buffer _current_data;  ///< Device copy of the data of the spilled partition in use
+};
+
+/**
+ * @brief Maps the indices of a row within its partition to the index of the row in its table,
+ * preserving JoinNoneValue.
+ */
+struct to_table_index {
+  size_type const* row_indices;
+
+  __device__ size_type operator()(size_type index) const
+  {
+    return index == JoinNoneValue ? index : row_indices[index];
+  }
+};
+
+/**
+ * @brief Joins each pair of corresponding partitions of `left_keys` and `right_keys` with
+ * `join_partition` and combines the results.
+ *
+ * @param join_partition Function that returns the join indices of the left and right keys of a
+ * partition
+ */
+template <typename JoinPartition>
+join_indices partitioned_join(table_view const& left_keys,
+                              table_view const& right_keys,
+                              size_type num_partitions,
+                              bool spill_to_host,
+                              JoinPartition join_partition,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  // Make sure any dictionary columns have matched key sets, so that they hash the same way.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {left_keys, right_keys},
+    stream,
+    cudf::get_current_temp_resource());  // temporary objects returned
+
+  auto const num_keys = left_keys.num_columns();
+  std::vector<size_type> key_columns(num_keys);
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+
+  join_partitions left_partitions(matched.second.front(), num_partitions, spill_to_host, stream);
+  join_partitions right_partitions(matched.second.back(), num_partitions, spill_to_host, stream);
+
+  std::vector<join_indices> partition_results;
+  std::size_t join_size = 0;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const left  = left_partitions.get(p, stream);
+    auto const right = right_partitions.get(p, stream);
+
+    auto result = join_partition(left.select(key_columns), right.select(key_columns));
+
+    auto const left_rows  = left.column(num_keys).data<size_type>();
+    auto const right_rows = right.column(num_keys).data<size_type>();
+    thrust::transform(rmm::exec_policy(stream),
+                      result.first->begin(),
+                      result.first->end(),
+                      result.first->begin(),
+                      to_table_index{left_rows});
+    thrust::transform(rmm::exec_policy(stream),
+                      result.second->begin(),
+                      result.second->end(),
+                      result.second->begin(),
+                      to_table_index{right_rows});
+    join_size += result.first->size();
+    partition_results.push_back(std::move(result));
+  }
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  std::size_t offset = 0;
+  for (auto const& result : partition_results) {
+    thrust::copy(rmm::exec_policy(stream),
+                 result.first->begin(),
+                 result.first->end(),
+                 left_indices->begin() + offset);
+    thrust::copy(rmm::exec_policy(stream),
+                 result.second->begin(),
+                 result.second->end(),
+                 right_indices->begin() + offset);
+    offset += result.first->size();
+  }
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace
+
+join_indices partitioned_inner_join(table_view const& left_keys,
+                                    table_view const& right_keys,
+                                    size_type num_partitions,
+                                    null_equality compare_nulls,
+                                    bool spill_to_host,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto join_partition = [&](table_view const& left, table_view const& right) {
+    // Build the hash table from the smaller side, as in `inner_join`
+    if (right.num_rows() > left.num_rows()) {
+      cudf::hash_join hash_join(left, compare_nulls, stream);
+      auto result = hash_join.inner_join(right, compare_nulls, stream);
+      return std::make_pair(std::move(result.second), std::move(result.first));
+    }
+    cudf::hash_join hash_join(right, compare_nulls, stream);
+    return hash_join.inner_join(left, compare_nulls, stream);
+  };
+  return partitioned_join(
+    left_keys, right_keys, num_partitions, spill_to_host, join_partition, stream, mr);
+}
+
+join_indices partitioned_left_join(table_view const& left_keys,
+                                   table_view const& right_keys,
+                                   size_type num_partitions,
+                                   null_equality compare_nulls,
+                                   bool spill_to_host,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  auto join_partition = [&](table_view const& left, table_view const& right) {
+    cudf::hash_join hash_join(right, compare_nulls, stream);
+    return hash_join.left_join(left, compare_nulls, stream);
+  };
+  return partitioned_join(
+    left_keys, right_keys, num_partitions, spill_to_host, join_partition, stream, mr);
+}
+
+join_indices partitioned_full_join(table_view const& left_keys,
+                                   table_view const& right_keys,
+                                   size_type num_partitions,
+                                   null_equality compare_nulls,
+                                   bool spill_to_host,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  auto join_partition = [&](table_view const& left, table_view const& right) {
+    cudf::hash_join hash_join(right, compare_nulls, stream);
+    return hash_join.full_join(left, compare_nulls, stream);
+  };
+  return partitioned_join(
+    left_keys, right_keys, num_partitions, spill_to_host, join_partition, stream, mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(table_view const& left_keys,
+                       table_view const& right_keys,
+                       size_type num_partitions,
+                       null_equality compare_nulls,
+                       bool spill_to_host,
+                       rmm::cuda_stream_view stream,
+                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_inner_join(left_keys,
+                                        right_keys,
+                                        num_partitions,
+                                        compare_nulls,
+                                        spill_to_host,
+                                        stream,
+                                        mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_left_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      size_type num_partitions,
+                      null_equality compare_nulls,
+                      bool spill_to_host,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_left_join(left_keys,
+                                       right_keys,
+                                       num_partitions,
+                                       compare_nulls,
+                                       spill_to_host,
+                                       stream,
+                                       mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_full_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      size_type num_partitions,
+                      null_equality compare_nulls,
+                      bool spill_to_host,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_full_join(left_keys,
+                                       right_keys,
+                                       num_partitions,
+                                       compare_nulls,
+                                       spill_to_host,
+                                       stream,
+                                       mr);
+}
+
+}  // namespace cudf
@@ -16,7 +16,6 @@
 
 #include <hash/concurrent_unordered_map.cuh>
 #include <join/join_common_utils.hpp>
-#include <structs/utilities.hpp>
 
 #include <thrust/distance.h>
 
@@ -24,17 +23,158 @@
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/join.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 namespace cudf {
+
+/**
+ * @brief Hash set of the rows of the build table of a semi or anti join.
+ */
+struct hash_semi_join::hash_semi_join_impl {
+ public:
+  hash_semi_join_impl()                           = delete;
+  hash_semi_join_impl(hash_semi_join_impl const&) = delete;
+  hash_semi_join_impl(hash_semi_join_impl&&)      = delete;
+  hash_semi_join_impl& operator=(hash_semi_join_impl const&) = delete;
+  hash_semi_join_impl& operator=(hash_semi_join_impl&&) = delete;
+
+  /**
+   * @brief Inserts all the rows of `build` into the hash set.
+   *
+   * @throw cudf::logic_error if the number of columns in `build` table is 0.
+   *
+   * @param build The build table
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param key_case The case sensitivity of every column, or empty for all case-sensitive
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_semi_join_impl(cudf::table_view const& build,
+                      null_equality compare_nulls,
+                      std::vector<case_sensitivity> const& key_case,
+                      rmm::cuda_stream_view stream)
+    : _build(build),
+      _compare_nulls(compare_nulls),
+      _key_case(cudf::detail::make_device_uvector_async(key_case, stream))
+  {
+    CUDF_EXPECTS(0 != build.num_columns(), "Right table is empty");
+    CUDF_EXPECTS(
+      key_case.empty() or key_case.size() == static_cast<std::size_t>(build.num_columns()),
+      "Mismatch between number of columns and key_case size.");
+
+    if (0 == build.num_rows()) { return; }
+
+    // the row operators hash and compare the children of the struct columns
+    _build_device_view = table_device_view::create(build, stream);
+
+    size_t const hash_table_size = cudf::detail::compute_hash_table_size(build.num_rows());
+    cudf::detail::row_hash hash_build{*_build_device_view, _key_case.data()};
+    cudf::detail::row_equality equality_build{*_build_device_view,
+                                              *_build_device_view,
+                                              compare_nulls == null_equality::EQUAL,
+                                              _key_case.data()};
+
+    _hash_table = hash_table_type::create(hash_table_size,
+                                          stream,
+                                          std::numeric_limits<bool>::max(),
+                                          std::numeric_limits<cudf::size_type>::max(),
+                                          hash_build,
+                                          equality_build);
+    auto hash_table = *_hash_table;
+
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       build.num_rows(),
+                       [hash_table] __device__(size_type idx) mutable {
+                         hash_table.insert(thrust::make_pair(idx, true));
+                       });
+  }
+
+  /**
+   * @brief Returns the row indices of `probe` whose rows are (for a semi join) or are not (for an
+   * anti join) in the hash set.
+   *
+   * @tparam JoinKind Indicates whether to do LEFT_SEMI_JOIN or LEFT_ANTI_JOIN
+   *
+   * @param probe The probe table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector
+   *
+   * @return The row indices of `probe` in the result of the join
+   */
+  template <cudf::detail::join_kind JoinKind>
+  std::unique_ptr<rmm::device_uvector<cudf::size_type>> probe_semi_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    CUDF_EXPECTS(0 != probe.num_columns(), "Left table is empty");
+
+    if (cudf::detail::is_trivial_join(probe, _build, JoinKind)) {
+      return std::make_unique<rmm::device_uvector<cudf::size_type>>(0, stream, mr);
+    }
+    if ((cudf::detail::join_kind::LEFT_ANTI_JOIN == JoinKind) && (0 == _build.num_rows())) {
+      auto result =
+        std::make_unique<rmm::device_uvector<cudf::size_type>>(probe.num_rows(), stream, mr);
+      thrust::sequence(thrust::cuda::par.on(stream.value()), result->begin(), result->end());
+      return result;
+    }
+
+    auto const probe_num_rows = probe.num_rows();
+
+    auto probe_rows_d = table_device_view::create(probe, stream);
+    cudf::detail::row_hash hash_probe{*probe_rows_d, _key_case.data()};
+    cudf::detail::row_equality equality_probe{*probe_rows_d,
+                                              *_build_device_view,
+                                              _compare_nulls == null_equality::EQUAL,
+                                              _key_case.data()};
+
+    // For semi join we want contains to be true, for anti join we want contains to be false
+    bool join_type_boolean = (JoinKind == cudf::detail::join_kind::LEFT_SEMI_JOIN);
+
+    auto gather_map =
+      std::make_unique<rmm::device_uvector<cudf::size_type>>(probe_num_rows, stream, mr);
+
+    auto const hash_table = *_hash_table;
+    // gather_map_end will be the end of valid data in gather_map
+    auto gather_map_end = thrust::copy_if(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(probe_num_rows),
+      gather_map->begin(),
+      [hash_table, join_type_boolean, hash_probe, equality_probe] __device__(size_type idx) {
+        auto pos = hash_table.find(idx, hash_probe, equality_probe);
+        return (pos != hash_table.end()) == join_type_boolean;
+      });
+
+    auto join_size = thrust::distance(gather_map->begin(), gather_map_end);
+    gather_map->resize(join_size, stream);
+    return gather_map;
+  }
+
+ private:
+  // Only care about existence, so we'll use an unordered map (other joins need a multimap)
+  using hash_table_type = concurrent_unordered_map<cudf::size_type,
+                                                   bool,
+                                                   cudf::detail::row_hash,
+                                                   cudf::detail::row_equality>;
+
+  cudf::table_view _build;
+  null_equality _compare_nulls;
+  rmm::device_uvector<case_sensitivity> _key_case;
+  std::unique_ptr<table_device_view, std::function<void(table_device_view*)>> _build_device_view;
+  std::unique_ptr<hash_table_type, std::function<void(hash_table_type*)>> _hash_table;
+};
+
 namespace detail {
 
 template <join_kind JoinKind>
@@ -46,84 +186,10 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
-  CUDF_EXPECTS(0 != right_keys.num_columns(), "Right table is empty");
 
-  if (is_trivial_join(left_keys, right_keys, JoinKind)) {
-    return std::make_unique<rmm::device_uvector<cudf::size_type>>(0, stream, mr);
-  }
-  if ((join_kind::LEFT_ANTI_JOIN == JoinKind) && (0 == right_keys.num_rows())) {
-    auto result =
-      std::make_unique<rmm::device_uvector<cudf::size_type>>(left_keys.num_rows(), stream, mr);
-    thrust::sequence(thrust::cuda::par.on(stream.value()), result->begin(), result->end());
-    return result;
-  }
-
-  auto const left_num_rows  = left_keys.num_rows();
-  auto const right_num_rows = right_keys.num_rows();
-
-  // flatten structs for the right and left and use that for the hash table
-  auto right_flattened_tables = structs::detail::flatten_nested_columns(
-    right_keys, {}, {}, structs::detail::column_nullability::FORCE);
-  auto left_flattened_tables = structs::detail::flatten_nested_columns(
-    left_keys, {}, {}, structs::detail::column_nullability::FORCE);
-
-  auto right_flattened_keys = std::get<0>(right_flattened_tables);
-  auto left_flattened_keys  = std::get<0>(left_flattened_tables);
-
-  // Only care about existence, so we'll use an unordered map (other joins need a multimap)
-  using hash_table_type = concurrent_unordered_map<cudf::size_type, bool, row_hash, row_equality>;
-
-  // Create hash table containing all keys found in right table
-  auto right_rows_d            = table_device_view::create(right_flattened_keys, stream);
-  size_t const hash_table_size = compute_hash_table_size(right_num_rows);
-  row_hash hash_build{*right_rows_d};
-  row_equality equality_build{*right_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
-
-  // Going to join it with left table
-  auto left_rows_d = table_device_view::create(left_flattened_keys, stream);
-  row_hash hash_probe{*left_rows_d};
-  row_equality equality_probe{*left_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
-
-  auto hash_table_ptr = hash_table_type::create(hash_table_size,
-                                                stream,
-                                                std::numeric_limits<bool>::max(),
-                                                std::numeric_limits<cudf::size_type>::max(),
-                                                hash_build,
-                                                equality_build);
-  auto hash_table     = *hash_table_ptr;
-
-  thrust::for_each_n(rmm::exec_policy(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     right_num_rows,
-                     [hash_table] __device__(size_type idx) mutable {
-                       hash_table.insert(thrust::make_pair(idx, true));
-                     });
-
-  //
-  // Now we have a hash table, we need to iterate over the rows of the left table
-  // and check to see if they are contained in the hash table
-  //
-
-  // For semi join we want contains to be true, for anti join we want contains to be false
-  bool join_type_boolean = (JoinKind == join_kind::LEFT_SEMI_JOIN);
-
-  auto gather_map =
-    std::make_unique<rmm::device_uvector<cudf::size_type>>(left_num_rows, stream, mr);
-
-  // gather_map_end will be the end of valid data in gather_map
-  auto gather_map_end = thrust::copy_if(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(left_num_rows),
-    gather_map->begin(),
-    [hash_table, join_type_boolean, hash_probe, equality_probe] __device__(size_type idx) {
-      auto pos = hash_table.find(idx, hash_probe, equality_probe);
-      return (pos != hash_table.end()) == join_type_boolean;
-    });
-
-  auto join_size = thrust::distance(gather_map->begin(), gather_map_end);
-  gather_map->resize(join_size, stream);
-  return gather_map;
+  auto const semi_join = hash_semi_join(right_keys, compare_nulls, stream);
+  return (JoinKind == join_kind::LEFT_SEMI_JOIN) ? semi_join.left_semi_join(left_keys, stream, mr)
+                                                 : semi_join.left_anti_join(left_keys, stream, mr);
 }
 
 /**
@@ -187,7 +253,7 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
   auto matched = cudf::dictionary::detail::match_dictionaries(
     {left.select(left_on), right.select(right_on)},
     stream,
-    rmm::mr::get_current_device_resource());  // temporary objects returned
+    cudf::get_current_temp_resource());  // temporary objects returned
 
   auto const left_selected  = matched.second.front();
   auto const right_selected = matched.second.back();
@@ -211,22 +277,24 @@ std::unique_ptr<cudf::table> left_semi_join(cudf::table_view const& left,
                                             std::vector<cudf::size_type> const& left_on,
                                             std::vector<cudf::size_type> const& right_on,
                                             null_equality compare_nulls,
+                                            rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join<detail::join_kind::LEFT_SEMI_JOIN>(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+    left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
   null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join<detail::join_kind::LEFT_SEMI_JOIN>(
-    left, right, compare_nulls, rmm::cuda_stream_default, mr);
+    left, right, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
@@ -234,22 +302,63 @@ std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
                                             std::vector<cudf::size_type> const& left_on,
                                             std::vector<cudf::size_type> const& right_on,
                                             null_equality compare_nulls,
+                                            rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join<detail::join_kind::LEFT_ANTI_JOIN>(
-    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default, mr);
+    left, right, left_on, right_on, compare_nulls, stream, mr);
 }
 
 std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_anti_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
   null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join<detail::join_kind::LEFT_ANTI_JOIN>(
-    left, right, compare_nulls, rmm::cuda_stream_default, mr);
+    left, right, compare_nulls, stream, mr);
+}
+
+hash_semi_join::~hash_semi_join() = default;
+
+hash_semi_join::hash_semi_join(hash_semi_join&&) = default;
+
+hash_semi_join& hash_semi_join::operator=(hash_semi_join&&) = default;
+
+hash_semi_join::hash_semi_join(cudf::table_view const& build,
+                               null_equality compare_nulls,
+                               rmm::cuda_stream_view stream)
+  : impl{std::make_unique<const hash_semi_join::hash_semi_join_impl>(
+      build, compare_nulls, std::vector<case_sensitivity>{}, stream)}
+{
+}
+
+hash_semi_join::hash_semi_join(cudf::table_view const& build,
+                               null_equality compare_nulls,
+                               std::vector<case_sensitivity> const& key_case,
+                               rmm::cuda_stream_view stream)
+  : impl{std::make_unique<const hash_semi_join::hash_semi_join_impl>(
+      build, compare_nulls, key_case, stream)}
+{
+}
+
+std::unique_ptr<rmm::device_uvector<cudf::size_type>> hash_semi_join::left_semi_join(
+  cudf::table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr) const
+{
+  return impl->probe_semi_join<cudf::detail::join_kind::LEFT_SEMI_JOIN>(probe, stream, mr);
+}
+
+std::unique_ptr<rmm::device_uvector<cudf::size_type>> hash_semi_join::left_anti_join(
+  cudf::table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr) const
+{
+  return impl->probe_semi_join<cudf::detail::join_kind::LEFT_ANTI_JOIN>(probe, stream, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/join_common_utils.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using join_indices = std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                               std::unique_ptr<rmm::device_uvector<size_type>>>;
+
+/**
+ * @brief Returns the distinct keys that make up at least `heavy_hitter_threshold` of a sample of
+ * `right_keys`.
+ *
+ * Keys with nulls are never heavy hitters if nulls are unequal, since they don't match anything.
+ */
+std::unique_ptr<table> find_heavy_hitters(table_view const& right_keys,
+                                          null_equality compare_nulls,
+                                          double heavy_hitter_threshold,
+                                          size_type sample_size,
+                                          rmm::cuda_stream_view stream)
+{
+  auto const num_samples = std::min(sample_size, right_keys.num_rows());
+  auto const sample =
+    detail::sample(right_keys, num_samples, sample_with_replacement::FALSE, 0, stream);
+
+  auto const include_null_keys =
+    compare_nulls == null_equality::EQUAL ? null_policy::INCLUDE : null_policy::EXCLUDE;
+  groupby::groupby sample_groups(sample->view(), include_null_keys);
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = sample->get_column(0).view();
+  requests[0].aggregations.push_back(make_count_aggregation(null_policy::INCLUDE));
+  auto const groups = sample_groups.aggregate(requests);
+
+  // A key seen once in the sample is not distinguishable from the other keys
+  auto const min_count = std::max(
+    size_type{2}, static_cast<size_type>(std::ceil(heavy_hitter_threshold * num_samples)));
+  auto const counts = groups.second.front().results.front()->view().data<size_type>();
+  rmm::device_uvector<size_type> heavy_groups(groups.first->num_rows(), stream);
+  auto const heavy_groups_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(groups.first->num_rows()),
+                    heavy_groups.begin(),
+                    [counts, min_count] __device__(size_type group) {
+                      return counts[group] >= min_count;
+                    });
+  return detail::gather(groups.first->view(),
+                        heavy_groups.begin(),
+                        heavy_groups_end,
+                        out_of_bounds_policy::DONT_CHECK,
+                        stream);
+}
+
+/**
+ * @brief Returns the index of the heavy hitter key of every row of `keys`, or JoinNoneValue for
+ * the rows that are not heavy hitters.
+ */
+rmm::device_uvector<size_type> heavy_hitter_indices(hash_join const& heavy_hitters,
+                                                    table_view const& keys,
+                                                    null_equality compare_nulls,
+                                                    rmm::cuda_stream_view stream)
+{
+  // The heavy hitter keys are distinct, so every row has exactly one entry in the left join
+  auto const matches = heavy_hitters.left_join(keys, compare_nulls, stream);
+  rmm::device_uvector<size_type> indices(keys.num_rows(), stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  matches.second->begin(),
+                  matches.second->end(),
+                  matches.first->begin(),
+                  indices.begin());
+  return indices;
+}
+
+/**
+ * @brief Returns the indices of the rows whose heavy hitter index is JoinNoneValue.
+ */
+rmm::device_uvector<size_type> light_rows(rmm::device_uvector<size_type> const& heavy_indices,
+                                          rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> rows(heavy_indices.size(), stream);
+  auto const d_heavy_indices = heavy_indices.data();
+  auto const rows_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(heavy_indices.size()),
+                    rows.begin(),
+                    [d_heavy_indices] __device__(size_type row) {
+                      return d_heavy_indices[row] == JoinNoneValue;
+                    });
+  rows.resize(thrust::distance(rows.begin(), rows_end), stream);
+  return rows;
+}
+
+/**
+ * @brief Maps the indices of a row within the light rows to the index of the row in its table,
+ * preserving JoinNoneValue.
+ */
+struct to_table_index {
+  size_type const* row_indices;
+
+  __device__ size_type operator()(size_type index) const
+  {
+    return index == JoinNoneValue ? index : row_indices[index];
+  }
+};
+
+/**
+ * @brief Joins the keys with a heavy hitter set aside from the other keys.
+ *
+ * The rows whose keys are not heavy hitters are joined by `join_light_rows` through the hash
+ * join. Since all rows with the same heavy hitter key match each other, the rows of each heavy
+ * hitter key are joined with an expansion of the cross product of their rows in both tables,
+ * which spreads the output evenly over the threads instead of probing long hash chains.
+ *
+ * @param join_light_rows Function that returns the join indices of the left and right keys
+ * without heavy hitters, allocated with the given memory resource
+ */
+template <typename JoinLightRows>
+join_indices skewed_join(table_view const& left_keys,
+                         table_view const& right_keys,
+                         null_equality compare_nulls,
+                         double heavy_hitter_threshold,
+                         size_type sample_size,
+                         JoinLightRows join_light_rows,
+                         rmm::cuda_stream_view stream,
+                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(heavy_hitter_threshold > 0 && heavy_hitter_threshold <= 1,
+               "Heavy hitter threshold must be in (0, 1]");
+  CUDF_EXPECTS(sample_size > 0, "Sample size must be positive");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  // Make sure any dictionary columns have matched key sets, so that they hash the same way.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {left_keys, right_keys},
+    stream,
+    cudf::get_current_temp_resource());  // temporary objects returned
+  auto const left  = matched.second.front();
+  auto const right = matched.second.back();
+
+  auto const heavy_keys =
+    right.num_rows() == 0
+      ? std::make_unique<table>(right, stream)
+      : find_heavy_hitters(right, compare_nulls, heavy_hitter_threshold, sample_size, stream);
+  if (heavy_keys->num_rows() == 0) { return join_light_rows(left, right, mr); }
+
+  cudf::hash_join heavy_hitters(heavy_keys->view(), compare_nulls, stream);
+  auto const left_heavy_indices = heavy_hitter_indices(heavy_hitters, left, compare_nulls, stream);
+  auto const right_heavy_indices =
+    heavy_hitter_indices(heavy_hitters, right, compare_nulls, stream);
+
+  // Join the light rows through the hash join
+  auto const left_light_rows  = light_rows(left_heavy_indices, stream);
+  auto const right_light_rows = light_rows(right_heavy_indices, stream);
+
+  auto const left_light = detail::gather(
+    left, left_light_rows.begin(), left_light_rows.end(), out_of_bounds_policy::DONT_CHECK, stream);
+  auto const right_light = detail::gather(right,
+                                          right_light_rows.begin(),
+                                          right_light_rows.end(),
+                                          out_of_bounds_policy::DONT_CHECK,
+                                          stream);
+
+  auto const light_result = join_light_rows(
+    left_light->view(), right_light->view(), cudf::get_current_temp_resource());
+
+  // Group the heavy rows of the right table by heavy hitter key
+  auto const num_heavy_keys = heavy_keys->num_rows();
+  rmm::device_uvector<size_type> right_heavy_rows(right.num_rows(), stream);
+  rmm::device_uvector<size_type> right_heavy_keys(right.num_rows(), stream);
+  auto const is_heavy = [] __device__(size_type index) { return index != JoinNoneValue; };
+  auto const right_heavy_end = thrust::copy_if(rmm::exec_policy(stream),
+                                               thrust::make_counting_iterator<size_type>(0),
+                                               thrust::make_counting_iterator(right.num_rows()),
+                                               right_heavy_indices.begin(),
+                                               right_heavy_rows.begin(),
+                                               is_heavy);
+  right_heavy_rows.resize(thrust::distance(right_heavy_rows.begin(), right_heavy_end), stream);
+  right_heavy_keys.resize(right_heavy_rows.size(), stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  right_heavy_indices.begin(),
+                  right_heavy_indices.end(),
+                  right_heavy_keys.begin(),
+                  is_heavy);
+  thrust::stable_sort_by_key(rmm::exec_policy(stream),
+                             right_heavy_keys.begin(),
+                             right_heavy_keys.end(),
+                             right_heavy_rows.begin());
+  rmm::device_uvector<size_type> key_offsets(num_heavy_keys + 1, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      right_heavy_keys.begin(),
+                      right_heavy_keys.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_heavy_keys + 1),
+                      key_offsets.begin());
+
+  // Every heavy row of the left table matches all the right rows of its key
+  rmm::device_uvector<size_type> left_heavy_rows(left.num_rows(), stream);
+  auto const left_heavy_end = thrust::copy_if(rmm::exec_policy(stream),
+                                              thrust::make_counting_iterator<size_type>(0),
+                                              thrust::make_counting_iterator(left.num_rows()),
+                                              left_heavy_indices.begin(),
+                                              left_heavy_rows.begin(),
+                                              is_heavy);
+  left_heavy_rows.resize(thrust::distance(left_heavy_rows.begin(), left_heavy_end), stream);
+
+  auto const d_left_heavy_indices = left_heavy_indices.data();
+  auto const d_key_offsets        = key_offsets.data();
+
+  auto const output_size = [d_left_heavy_indices, d_key_offsets] __device__(size_type row) {
+    auto const key = d_left_heavy_indices[row];
+    return static_cast<std::int64_t>(d_key_offsets[key + 1] - d_key_offsets[key]);
+  };
+  rmm::device_uvector<std::int64_t> heavy_output_ends(left_heavy_rows.size(), stream);
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   left_heavy_rows.begin(),
+                                   left_heavy_rows.end(),
+                                   heavy_output_ends.begin(),
+                                   output_size,
+                                   thrust::plus<std::int64_t>{});
+  auto const heavy_size =
+    heavy_output_ends.is_empty() ? std::int64_t{0} : heavy_output_ends.back_element(stream);
+  auto const light_size = static_cast<std::int64_t>(light_result.first->size());
+  CUDF_EXPECTS(light_size + heavy_size < std::numeric_limits<size_type>::max(),
+               "Maximum join output size exceeded");
+
+  auto left_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(light_size + heavy_size, stream, mr);
+  auto right_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(light_size + heavy_size, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    light_result.first->begin(),
+                    light_result.first->end(),
+                    left_indices->begin(),
+                    to_table_index{left_light_rows.data()});
+  thrust::transform(rmm::exec_policy(stream),
+                    light_result.second->begin(),
+                    light_result.second->end(),
+                    right_indices->begin(),
+                    to_table_index{right_light_rows.data()});
+  if (heavy_size == 0) { return std::make_pair(std::move(left_indices), std::move(right_indices)); }
+
+  // Expand the cross products of the heavy rows: the left row of an output row is the first
+  // heavy row whose output ends past it, and the right row is at the same position in its key
+  auto const heavy_left_out = left_indices->begin() + light_size;
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      heavy_output_ends.begin(),
+                      heavy_output_ends.end(),
+                      thrust::make_counting_iterator<std::int64_t>(0),
+                      thrust::make_counting_iterator<std::int64_t>(heavy_size),
+                      heavy_left_out);
+  auto const d_left_heavy_rows   = left_heavy_rows.data();
+  auto const d_right_heavy_rows  = right_heavy_rows.data();
+  auto const d_heavy_output_ends = heavy_output_ends.data();
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(heavy_size),
+    heavy_left_out,
+    right_indices->begin() + light_size,
+    [output_size,
+     d_left_heavy_rows,
+     d_right_heavy_rows,
+     d_heavy_output_ends,
+     d_key_offsets,
+     d_left_heavy_indices] __device__(size_type i, size_type heavy_row) {
+      auto const row          = d_left_heavy_rows[heavy_row];
+      auto const output_begin = d_heavy_output_ends[heavy_row] - output_size(row);
+      auto const key_begin    = d_key_offsets[d_left_heavy_indices[row]];
+      return d_right_heavy_rows[key_begin + (i - output_begin)];
+    });
+  thrust::transform(rmm::exec_policy(stream),
+                    heavy_left_out,
+                    left_indices->end(),
+                    heavy_left_out,
+                    [d_left_heavy_rows] __device__(size_type heavy_row) {
+                      return d_left_heavy_rows[heavy_row];
+                    });
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace
+
+join_indices skewed_inner_join(table_view const& left_keys,
+                               table_view const& right_keys,
+                               null_equality compare_nulls,
+                               double heavy_hitter_threshold,
+                               size_type sample_size,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  auto join_light_rows = [&](table_view const& left,
+                             table_view const& right,
+                             rmm::mr::device_memory_resource* light_mr) {
+    cudf::hash_join hash_join(right, compare_nulls, stream);
+    return hash_join.inner_join(left, compare_nulls, stream, light_mr);
+  };
+  return skewed_join(left_keys,
+                     right_keys,
+                     compare_nulls,
+                     heavy_hitter_threshold,
+                     sample_size,
+                     join_light_rows,
+                     stream,
+                     mr);
+}
+
+join_indices skewed_left_join(table_view const& left_keys,
+                              table_view const& right_keys,
+                              null_equality compare_nulls,
+                              double heavy_hitter_threshold,
+                              size_type sample_size,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  // The heavy rows of the left table always have a match, since their keys are in the right table
+  auto join_light_rows = [&](table_view const& left,
+                             table_view const& right,
+                             rmm::mr::device_memory_resource* light_mr) {
+    cudf::hash_join hash_join(right, compare_nulls, stream);
+    return hash_join.left_join(left, compare_nulls, stream, light_mr);
+  };
+  return skewed_join(left_keys,
+                     right_keys,
+                     compare_nulls,
+                     heavy_hitter_threshold,
+                     sample_size,
+                     join_light_rows,
+                     stream,
+                     mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+skewed_inner_join(table_view const& left_keys,
+                  table_view const& right_keys,
+                  null_equality compare_nulls,
+                  double heavy_hitter_threshold,
+                  size_type sample_size,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::skewed_inner_join(left_keys,
+                                   right_keys,
+                                   compare_nulls,
+                                   heavy_hitter_threshold,
+                                   sample_size,
+                                   stream,
+                                   mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+skewed_left_join(table_view const& left_keys,
+                 table_view const& right_keys,
+                 null_equality compare_nulls,
+                 double heavy_hitter_threshold,
+                 size_type sample_size,
+                 rmm::cuda_stream_view stream,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::skewed_left_join(left_keys,
+                                  right_keys,
+                                  compare_nulls,
+                                  heavy_hitter_threshold,
+                                  sample_size,
+                                  stream,
+                                  mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/hash_join.cuh>
+#include <join/join_common_utils.hpp>
+
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Computes the join of two tables sorted on their keys, without building a hash table.
+ *
+ * The range of equal keys in `right` of every row of `left` is found with `lower_bound` and
+ * `upper_bound`. The output ranges of the left rows are the scan of the sizes of their ranges,
+ * and each output row is mapped back to its left row with a binary search of the ranges. The
+ * output is ordered by left row index, then by right row index.
+ *
+ * @param left The left table, sorted on its keys
+ * @param right The right table, sorted on its keys
+ * @param column_order The sort order of the key columns of both tables
+ * @param null_precedence The order of the nulls in the key columns of both tables
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param JoinKind The type of join to be performed
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors
+ *
+ * @return Join output indices vector pair
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+get_sort_merge_join_indices(table_view const& left,
+                            table_view const& right,
+                            std::vector<order> const& column_order,
+                            std::vector<null_order> const& null_precedence,
+                            null_equality compare_nulls,
+                            join_kind JoinKind,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(std::equal(std::cbegin(right),
+                          std::cend(right),
+                          std::cbegin(left),
+                          std::cend(left),
+                          [](const auto& r, const auto& l) { return r.type() == l.type(); }),
+               "Mismatch in joining column data types");
+
+  // Trivial left join case - exit early
+  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) {
+    return get_trivial_left_join_indices(left, stream, mr);
+  }
+  if (left.num_rows() == 0 || right.num_rows() == 0) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  auto const lower =
+    detail::lower_bound(right, left, column_order, null_precedence, sorted::YES, stream);
+  auto const upper =
+    detail::upper_bound(right, left, column_order, null_precedence, sorted::YES, stream);
+
+  // Rows with a null key don't match anything if nulls are unequal
+  auto const row_bitmask = (compare_nulls == null_equality::UNEQUAL && has_nulls(left))
+                             ? cudf::detail::bitmask_and(left, stream).first
+                             : rmm::device_buffer{0, stream};
+
+  auto const d_lower = lower->view().data<size_type>();
+  auto const d_upper = upper->view().data<size_type>();
+  auto const d_mask  = static_cast<bitmask_type const*>(row_bitmask.data());
+
+  auto const num_matches = [d_lower, d_upper, d_mask] __device__(size_type row) {
+    return (d_mask == nullptr || bit_is_set(d_mask, row)) ? d_upper[row] - d_lower[row] : 0;
+  };
+  auto const is_left_join = JoinKind == join_kind::LEFT_JOIN;
+  auto const output_size  = [num_matches, is_left_join] __device__(size_type row) {
+    auto const matches = num_matches(row);
+    return (is_left_join && matches == 0) ? 1 : matches;
+  };
+  auto const output_sizes = cudf::detail::make_counting_transform_iterator(0, output_size);
+
+  auto const join_size = thrust::reduce(rmm::exec_policy(stream),
+                                        output_sizes,
+                                        output_sizes + left.num_rows(),
+                                        std::int64_t{0},
+                                        thrust::plus<std::int64_t>{});
+  CUDF_EXPECTS(join_size < static_cast<std::int64_t>(std::numeric_limits<size_type>::max()),
+               "Maximum join output size exceeded");
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  if (join_size == 0) { return std::make_pair(std::move(left_indices), std::move(right_indices)); }
+
+  rmm::device_uvector<size_type> output_ends(left.num_rows(), stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), output_sizes, output_sizes + left.num_rows(), output_ends.begin());
+
+  // The left row of an output row is the first row whose output ends past it
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      output_ends.begin(),
+                      output_ends.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(join_size),
+                      left_indices->begin());
+  auto const d_output_ends = output_ends.data();
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(join_size),
+    left_indices->begin(),
+    right_indices->begin(),
+    [num_matches, output_size, d_lower, d_output_ends] __device__(size_type i, size_type row) {
+      auto const output_begin = d_output_ends[row] - output_size(row);
+      return num_matches(row) == 0 ? JoinNoneValue : d_lower[row] + (i - output_begin);
+    });
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence,
+                      null_equality compare_nulls,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  return get_sort_merge_join_indices(left_keys,
+                                     right_keys,
+                                     column_order,
+                                     null_precedence,
+                                     compare_nulls,
+                                     join_kind::INNER_JOIN,
+                                     stream,
+                                     mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(table_view const& left_keys,
+                     table_view const& right_keys,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr)
+{
+  return get_sort_merge_join_indices(left_keys,
+                                     right_keys,
+                                     column_order,
+                                     null_precedence,
+                                     compare_nulls,
+                                     join_kind::LEFT_JOIN,
+                                     stream,
+                                     mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence,
+                      null_equality compare_nulls,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_inner_join(left_keys,
+                                       right_keys,
+                                       column_order,
+                                       null_precedence,
+                                       compare_nulls,
+                                       stream,
+                                       mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(table_view const& left_keys,
+                     table_view const& right_keys,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_left_join(left_keys,
+                                      right_keys,
+                                      column_order,
+                                      null_precedence,
+                                      compare_nulls,
+                                      stream,
+                                      mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,411 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/histogram.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/labeling/histogram.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Largest number of bins counted in shared memory by each thread block
+constexpr size_type max_shared_memory_bins{4096};
+constexpr size_type histogram_block_size{256};
+constexpr size_type histogram_rows_per_thread{8};
+
+/*
+ * Finds the bin of a value among `num_bins` bins of the same width between `lower` and `upper`,
+ * or returns -1 for values outside of the bins. The bin is computed from the value.
+ */
+struct uniform_bin_finder {
+  double lower;
+  double upper;
+  double bins_per_unit;
+  size_type num_bins;
+
+  template <typename T>
+  __device__ size_type operator()(T const value) const
+  {
+    auto const v = static_cast<double>(value);
+    // The negated comparison also excludes NaN
+    if (not(v >= lower and v <= upper)) { return -1; }
+    return min(static_cast<size_type>((v - lower) * bins_per_unit), num_bins - 1);
+  }
+};
+
+/*
+ * Finds the bin of a value among the bins delimited by `edges`, or returns -1 for values outside
+ * of the bins. The bin is found by a binary search in the edges.
+ */
+template <typename T>
+struct edges_bin_finder {
+  column_device_view edges;
+
+  __device__ size_type operator()(T const value) const
+  {
+    auto const num_bins = edges.size() - 1;
+    // The last bin includes its upper edge
+    if (value == edges.element<T>(num_bins)) { return num_bins - 1; }
+
+    auto const begin = edges.begin<T>();
+    auto const bound = thrust::upper_bound(thrust::seq, begin, edges.end<T>(), value);
+    auto const bin   = static_cast<size_type>(thrust::distance(begin, bound)) - 1;
+    return bin < num_bins ? bin : -1;
+  }
+};
+
+/*
+ * Counts the rows of `input` of each bin in shared memory, then adds the counts of the block to
+ * `counts`.
+ */
+template <typename T, bool has_nulls, typename BinFinder>
+__global__ void shared_memory_histogram_kernel(column_device_view input,
+                                               BinFinder find_bin,
+                                               size_type num_bins,
+                                               int64_t* counts)
+{
+  extern __shared__ size_type block_counts[];
+  for (size_type bin = threadIdx.x; bin < num_bins; bin += blockDim.x) { block_counts[bin] = 0; }
+  __syncthreads();
+
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < input.size();
+       row += blockDim.x * gridDim.x) {
+    if (has_nulls and input.is_null_nocheck(row)) { continue; }
+    auto const bin = find_bin(input.element<T>(row));
+    if (bin >= 0) { atomicAdd(block_counts + bin, size_type{1}); }
+  }
+  __syncthreads();
+
+  for (size_type bin = threadIdx.x; bin < num_bins; bin += blockDim.x) {
+    if (block_counts[bin] > 0) { atomicAdd(counts + bin, static_cast<int64_t>(block_counts[bin])); }
+  }
+}
+
+/*
+ * Counts the rows of `input` of each bin of each group, in `counts` of `num_groups * num_bins`
+ * elements, group by group. `labels` holds the group of each row, or is `nullptr` for a single
+ * group.
+ */
+template <typename T, typename BinFinder>
+std::unique_ptr<column> count_bins(column_view const& input,
+                                   BinFinder find_bin,
+                                   size_type num_bins,
+                                   size_type const* labels,
+                                   size_type num_groups,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(static_cast<int64_t>(num_groups) * num_bins <= std::numeric_limits<size_type>::max(),
+               "Number of counts exceeds the column size limit");
+
+  auto counts = make_numeric_column(
+    data_type{type_id::INT64}, num_groups * num_bins, mask_state::UNALLOCATED, stream, mr);
+  auto const d_counts = counts->mutable_view().data<int64_t>();
+  thrust::fill(rmm::exec_policy(stream), d_counts, d_counts + counts->size(), int64_t{0});
+  if (input.is_empty()) { return counts; }
+
+  auto const d_input = column_device_view::create(input, stream);
+  if (labels == nullptr and num_bins <= max_shared_memory_bins) {
+    auto const grid        = grid_1d{input.size(), histogram_block_size, histogram_rows_per_thread};
+    auto const shared_size = num_bins * sizeof(size_type);
+    if (input.has_nulls()) {
+      shared_memory_histogram_kernel<T, true>
+        <<<grid.num_blocks, grid.num_threads_per_block, shared_size, stream.value()>>>(
+          *d_input, find_bin, num_bins, d_counts);
+    } else {
+      shared_memory_histogram_kernel<T, false>
+        <<<grid.num_blocks, grid.num_threads_per_block, shared_size, stream.value()>>>(
+          *d_input, find_bin, num_bins, d_counts);
+    }
+    CHECK_CUDA(stream.value());
+    return counts;
+  }
+
+  // Too many bins of a block for shared memory, so the rows are counted in global memory
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     input.size(),
+                     [input = *d_input, find_bin, num_bins, labels, d_counts] __device__(
+                       size_type row) {
+                       if (input.is_null(row)) { return; }
+                       auto const bin = find_bin(input.element<T>(row));
+                       if (bin < 0) { return; }
+                       auto const group = labels == nullptr ? 0 : labels[row];
+                       atomicAdd(d_counts + group * num_bins + bin, int64_t{1});
+                     });
+  return counts;
+}
+
+struct uniform_histogram_dispatcher {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_numeric<T>() and not std::is_same_v<T, bool>;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_supported<T>(), std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Type not supported for cudf::histogram with uniform bins");
+  }
+
+  template <typename T>
+  std::enable_if_t<is_supported<T>(), std::unique_ptr<column>> operator()(
+    column_view const& input,
+    double lower,
+    double upper,
+    size_type num_bins,
+    size_type const* labels,
+    size_type num_groups,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    auto const find_bin = uniform_bin_finder{lower, upper, num_bins / (upper - lower), num_bins};
+    return count_bins<T>(input, find_bin, num_bins, labels, num_groups, stream, mr);
+  }
+};
+
+struct edges_histogram_dispatcher {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_relationally_comparable<T, T>() && cudf::is_equality_comparable<T, T>();
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_supported<T>(), std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Type not supported for cudf::histogram");
+  }
+
+  template <typename T>
+  std::enable_if_t<is_supported<T>(), std::unique_ptr<column>> operator()(
+    column_view const& input,
+    column_view const& edges,
+    size_type const* labels,
+    size_type num_groups,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    auto const d_edges  = column_device_view::create(edges, stream);
+    auto const find_bin = edges_bin_finder<T>{*d_edges};
+    return count_bins<T>(input, find_bin, edges.size() - 1, labels, num_groups, stream, mr);
+  }
+};
+
+void expects_uniform_bins(double lower, double upper, size_type num_bins)
+{
+  CUDF_EXPECTS(num_bins > 0, "The number of bins must be positive.");
+  CUDF_EXPECTS(lower < upper, "The lower edge of the bins must be less than the upper edge.");
+}
+
+void expects_edges(column_view const& input, column_view const& edges)
+{
+  CUDF_EXPECTS(input.type() == edges.type(),
+               "The input and edge columns must have the same types.");
+  CUDF_EXPECTS(edges.size() >= 2, "The edge column must have at least two elements.");
+  CUDF_EXPECTS(!edges.has_nulls(), "The edge column cannot contain nulls.");
+}
+
+/*
+ * Labels each row of `keys` with its group among the unique rows of `keys`, and calls
+ * `histogram` with the labels and the number of groups to count the bins of every group.
+ */
+template <typename Histogram>
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> histogram_by_group(
+  table_view const& keys,
+  column_view const& input,
+  size_type num_bins,
+  Histogram histogram,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(keys.num_rows() == input.size(),
+               "The keys and input must have the same number of rows.");
+
+  auto helper = groupby::detail::sort::sort_groupby_helper(keys, null_policy::INCLUDE);
+
+  auto const num_groups = helper.num_groups(stream);
+
+  // The group of every row, in the order of the input
+  auto const sort_order = helper.key_sort_order(stream);
+  auto const& labels    = helper.group_labels(stream);
+  rmm::device_uvector<size_type> row_labels(input.size(), stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  labels.begin(),
+                  labels.end(),
+                  sort_order.begin<size_type>(),
+                  row_labels.begin());
+
+  auto counts = histogram(row_labels.data(), num_groups);
+
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_groups + 1),
+                    offsets->mutable_view().begin<size_type>(),
+                    [num_bins] __device__(size_type group) { return group * num_bins; });
+
+  return std::make_pair(
+    helper.unique_keys(stream, mr),
+    make_lists_column(
+      num_groups, std::move(offsets), std::move(counts), 0, rmm::device_buffer{}, stream, mr));
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  double lower,
+                                  double upper,
+                                  size_type num_bins,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  expects_uniform_bins(lower, upper, num_bins);
+  return type_dispatcher(input.type(),
+                         uniform_histogram_dispatcher{},
+                         input,
+                         lower,
+                         upper,
+                         num_bins,
+                         nullptr,
+                         1,
+                         stream,
+                         mr);
+}
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& edges,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  expects_edges(input, edges);
+  return type_dispatcher<dispatch_storage_type>(
+    input.type(), edges_histogram_dispatcher{}, input, edges, nullptr, 1, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> grouped_histogram(
+  table_view const& keys,
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  expects_uniform_bins(lower, upper, num_bins);
+  auto histogram = [&](size_type const* labels, size_type num_groups) {
+    return type_dispatcher(input.type(),
+                           uniform_histogram_dispatcher{},
+                           input,
+                           lower,
+                           upper,
+                           num_bins,
+                           labels,
+                           num_groups,
+                           stream,
+                           mr);
+  };
+  return histogram_by_group(keys, input, num_bins, histogram, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> grouped_histogram(
+  table_view const& keys,
+  column_view const& input,
+  column_view const& edges,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  expects_edges(input, edges);
+  auto histogram = [&](size_type const* labels, size_type num_groups) {
+    return type_dispatcher<dispatch_storage_type>(
+      input.type(), edges_histogram_dispatcher{}, input, edges, labels, num_groups, stream, mr);
+  };
+  return histogram_by_group(keys, input, edges.size() - 1, histogram, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  double lower,
+                                  double upper,
+                                  size_type num_bins,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::histogram(input, lower, upper, num_bins, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& edges,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::histogram(input, edges, rmm::cuda_stream_default, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> grouped_histogram(
+  table_view const& keys,
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::grouped_histogram(
+    keys, input, lower, upper, num_bins, rmm::cuda_stream_default, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> grouped_histogram(
+  table_view const& keys,
+  column_view const& input,
+  column_view const& edges,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::grouped_histogram(keys, input, edges, rmm::cuda_stream_default, mr);
+}
+}  // namespace cudf
@@ -14,12 +14,18 @@
  * limitations under the License.
  */
 
+#include <thrust/binary_search.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/partition.h>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/lists/contains.hpp>
+#include <cudf/lists/detail/set_operations.hpp>
 #include <cudf/lists/list_device_view.cuh>
 #include <cudf/lists/lists_column_device_view.cuh>
 #include <cudf/lists/lists_column_view.hpp>
@@ -46,11 +52,102 @@ auto get_search_keys_device_iterable_view(cudf::scalar const& search_key, rmm::c
   return &search_key;
 }
 
+/**
+ * @brief The order of the entries within each list row.
+ */
+struct list_search_order {
+  bool is_sorted{false};  ///< Whether each list row is sorted, so that it is binary searched
+  order column_order{order::ASCENDING};
+  null_order null_precedence{null_order::AFTER};
+};
+
+/**
+ * @brief What the lookup writes for each list row.
+ */
+enum class lookup_result : bool {
+  CONTAINS,  ///< Whether the row contains the search key
+  INDEX_OF   ///< The position of the first entry equal to the search key in the row, or -1
+};
+
+/**
+ * @brief Returns the position of the first entry of `list` which is equal to `search_key`, or -1
+ * if there is none.
+ *
+ * A sorted row is binary searched between its nulls, which are all at one of its ends.
+ *
+ * @tparam ElementType The device storage type of the entries
+ * @param list The list row to search
+ * @param search_key The value to search for
+ * @param search_order The order of the entries of the row
+ * @param[out] list_has_nulls Set to whether the row has null entries
+ */
+template <typename ElementType>
+__device__ size_type find_in_list(list_device_view const& list,
+                                  ElementType const& search_key,
+                                  list_search_order const& search_order,
+                                  bool& list_has_nulls)
+{
+  if (not search_order.is_sorted) {
+    auto const found = thrust::find_if(thrust::seq,
+                                       list.pair_rep_begin<ElementType>(),
+                                       list.pair_rep_end<ElementType>(),
+                                       [search_key] __device__(auto element_and_validity) {
+                                         return element_and_validity.second &&
+                                                cudf::equality_compare(element_and_validity.first,
+                                                                       search_key);
+                                       });
+    list_has_nulls = thrust::any_of(thrust::seq,
+                                    thrust::make_counting_iterator(size_type{0}),
+                                    thrust::make_counting_iterator(list.size()),
+                                    [&list] __device__(auto const& i) { return list.is_null(i); });
+    return found == list.pair_rep_end<ElementType>()
+             ? -1
+             : static_cast<size_type>(found - list.pair_rep_begin<ElementType>());
+  }
+
+  auto const begin       = thrust::make_counting_iterator(size_type{0});
+  auto const end         = thrust::make_counting_iterator(list.size());
+  bool const nulls_first = search_order.null_precedence == null_order::BEFORE;
+  auto const valid_begin = nulls_first ? thrust::partition_point(thrust::seq,
+                                                                 begin,
+                                                                 end,
+                                                                 [&list] __device__(size_type i) {
+                                                                   return list.is_null(i);
+                                                                 })
+                                       : begin;
+  auto const valid_end = nulls_first ? end
+                                     : thrust::partition_point(thrust::seq,
+                                                               begin,
+                                                               end,
+                                                               [&list] __device__(size_type i) {
+                                                                 return not list.is_null(i);
+                                                               });
+  list_has_nulls = valid_end - valid_begin != list.size();
+
+  bool const ascending = search_order.column_order == order::ASCENDING;
+  auto const found     = thrust::lower_bound(
+    thrust::seq,
+    valid_begin,
+    valid_end,
+    search_key,
+    [&list, ascending] __device__(size_type i, ElementType const& key) {
+      auto const ordering = cudf::relational_compare(list.element<ElementType>(i), key);
+      return ascending ? ordering == weak_ordering::LESS : ordering == weak_ordering::GREATER;
+    });
+  return found != valid_end and
+             cudf::equality_compare(list.element<ElementType>(*found), search_key)
+           ? *found
+           : -1;
+}
+
 /**
  * @brief Functor to search each list row for the specified search keys.
  */
 template <bool search_keys_have_nulls>
 struct lookup_functor {
+  list_search_order search_order{};
+  lookup_result result{lookup_result::CONTAINS};
+
   template <typename ElementType>
   struct is_supported {
     static constexpr bool value =
@@ -71,7 +168,10 @@ struct lookup_functor {
                                                                rmm::cuda_stream_view stream,
                                                                rmm::mr::device_memory_resource* mr)
   {
-    if (!search_keys_have_nulls && !input_lists.has_nulls() && !input_lists.child().has_nulls()) {
+    // The null entries of the lists only make the result of contains() null
+    auto const entries_have_nulls =
+      result == lookup_result::CONTAINS && input_lists.child().has_nulls();
+    if (!search_keys_have_nulls && !input_lists.has_nulls() && !entries_have_nulls) {
       return {rmm::device_buffer{0, stream, mr}, size_type{0}};
     } else {
       return cudf::detail::valid_if(result_validity.begin<bool>(),
@@ -82,10 +182,14 @@ struct lookup_functor {
     }
   }
 
-  template <typename ElementType, typename SearchKeyPairIter>
+  /**
+   * @brief Writes the result of the lookup in each list row, which is the position of the search
+   * key if `ResultType` is `size_type`, or whether the row contains it if `ResultType` is `bool`.
+   */
+  template <typename ElementType, typename ResultType, typename SearchKeyPairIter>
   void search_each_list_row(cudf::detail::lists_column_device_view const& d_lists,
                             SearchKeyPairIter search_key_pair_iter,
-                            cudf::mutable_column_device_view mutable_ret_bools,
+                            cudf::mutable_column_device_view mutable_ret_values,
                             cudf::mutable_column_device_view mutable_ret_validity,
                             rmm::cuda_stream_view stream,
                             rmm::mr::device_memory_resource* mr)
@@ -96,39 +200,39 @@ struct lookup_functor {
       thrust::make_counting_iterator(d_lists.size()),
       [d_lists,
        search_key_pair_iter,
-       d_bools    = mutable_ret_bools.data<bool>(),
-       d_validity = mutable_ret_validity.data<bool>()] __device__(auto row_index) {
+       search_order = search_order,
+       d_values     = mutable_ret_values.data<ResultType>(),
+       d_validity   = mutable_ret_validity.data<bool>()] __device__(auto row_index) {
+        constexpr bool is_contains = std::is_same<ResultType, bool>::value;
+        auto const not_found       = is_contains ? ResultType{0} : static_cast<ResultType>(-1);
+
         auto search_key_and_validity    = search_key_pair_iter[row_index];
         auto const& search_key_is_valid = search_key_and_validity.second;
 
         if (search_keys_have_nulls && !search_key_is_valid) {
-          d_bools[row_index]    = false;
+          d_values[row_index]   = not_found;
           d_validity[row_index] = false;
           return;
         }
 
         auto list = cudf::list_device_view(d_lists, row_index);
         if (list.is_null()) {
-          d_bools[row_index]    = false;
+          d_values[row_index]   = not_found;
           d_validity[row_index] = false;
           return;
         }
 
-        auto search_key = search_key_and_validity.first;
-        d_bools[row_index] =
-          thrust::find_if(thrust::seq,
-                          list.pair_rep_begin<ElementType>(),
-                          list.pair_rep_end<ElementType>(),
-                          [search_key] __device__(auto element_and_validity) {
-                            return element_and_validity.second &&
-                                   cudf::equality_compare(element_and_validity.first, search_key);
-                          }) != list.pair_rep_end<ElementType>();
-        d_validity[row_index] =
-          d_bools[row_index] ||
-          thrust::none_of(thrust::seq,
-                          thrust::make_counting_iterator(size_type{0}),
-                          thrust::make_counting_iterator(list.size()),
-                          [&list] __device__(auto const& i) { return list.is_null(i); });
+        auto search_key     = search_key_and_validity.first;
+        bool list_has_nulls = false;
+        auto const position =
+          find_in_list<decltype(search_key)>(list, search_key, search_order, list_has_nulls);
+        if constexpr (is_contains) {
+          d_values[row_index]   = position >= 0;
+          d_validity[row_index] = position >= 0 || !list_has_nulls;
+        } else {
+          d_values[row_index]   = position;
+          d_validity[row_index] = true;
+        }
       });
   }
 
@@ -150,8 +254,10 @@ struct lookup_functor {
 
     auto constexpr search_key_is_scalar = std::is_same<SearchKeyType, cudf::scalar>::value;
 
+    auto const result_type = result == lookup_result::CONTAINS ? data_type{type_id::BOOL8}
+                                                               : data_type{type_to_id<size_type>()};
     if (search_keys_have_nulls && search_key_is_scalar) {
-      return make_fixed_width_column(data_type(type_id::BOOL8),
+      return make_fixed_width_column(result_type,
                                      lists.size(),
                                      cudf::create_null_mask(lists.size(), mask_state::ALL_NULL, mr),
                                      lists.size(),
@@ -167,26 +273,31 @@ struct lookup_functor {
 
     auto result_validity = make_fixed_width_column(
       data_type{type_id::BOOL8}, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
-    auto result_bools = make_fixed_width_column(
-      data_type{type_id::BOOL8}, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
-    auto mutable_result_bools =
-      mutable_column_device_view::create(result_bools->mutable_view(), stream);
+    auto result_values = make_fixed_width_column(
+      result_type, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
+    auto mutable_result_values =
+      mutable_column_device_view::create(result_values->mutable_view(), stream);
     auto mutable_result_validity =
       mutable_column_device_view::create(result_validity->mutable_view(), stream);
     auto search_key_iter =
       cudf::detail::make_pair_rep_iterator<ElementType, search_keys_have_nulls>(*d_skeys);
 
-    search_each_list_row<ElementType>(
-      d_lists, search_key_iter, *mutable_result_bools, *mutable_result_validity, stream, mr);
+    if (result == lookup_result::CONTAINS) {
+      search_each_list_row<ElementType, bool>(
+        d_lists, search_key_iter, *mutable_result_values, *mutable_result_validity, stream, mr);
+    } else {
+      search_each_list_row<ElementType, size_type>(
+        d_lists, search_key_iter, *mutable_result_values, *mutable_result_validity, stream, mr);
+    }
 
     rmm::device_buffer null_mask;
     size_type num_nulls;
 
     std::tie(null_mask, num_nulls) =
       construct_null_mask(lists, result_validity->view(), stream, mr);
-    result_bools->set_null_mask(std::move(null_mask), num_nulls);
+    result_values->set_null_mask(std::move(null_mask), num_nulls);
 
-    return result_bools;
+    return result_values;
   }
 };
 
@@ -221,6 +332,125 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                search_keys.type(), lookup_functor<false>{}, lists, search_keys, stream, mr);
 }
 
+std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  auto const search_order = list_search_order{true, column_order, null_precedence};
+  return search_key.is_valid(stream)
+           ? cudf::type_dispatcher(search_key.type(),
+                                   lookup_functor<false>{search_order},
+                                   lists,
+                                   search_key,
+                                   stream,
+                                   mr)
+           : cudf::type_dispatcher(search_key.type(),
+                                   lookup_functor<true>{search_order},
+                                   lists,
+                                   search_key,
+                                   stream,
+                                   mr);
+}
+
+std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(search_keys.size() == lists.size(),
+               "Number of search keys must match list column size.");
+
+  auto const search_order = list_search_order{true, column_order, null_precedence};
+  return search_keys.has_nulls()
+           ? cudf::type_dispatcher(search_keys.type(),
+                                   lookup_functor<true>{search_order},
+                                   lists,
+                                   search_keys,
+                                   stream,
+                                   mr)
+           : cudf::type_dispatcher(search_keys.type(),
+                                   lookup_functor<false>{search_order},
+                                   lists,
+                                   search_keys,
+                                   stream,
+                                   mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  auto const result = lookup_result::INDEX_OF;
+  return search_key.is_valid(stream)
+           ? cudf::type_dispatcher(
+               search_key.type(), lookup_functor<false>{{}, result}, lists, search_key, stream, mr)
+           : cudf::type_dispatcher(
+               search_key.type(), lookup_functor<true>{{}, result}, lists, search_key, stream, mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(search_keys.size() == lists.size(),
+               "Number of search keys must match list column size.");
+
+  auto const result = lookup_result::INDEX_OF;
+  return search_keys.has_nulls()
+           ? cudf::type_dispatcher(search_keys.type(),
+                                   lookup_functor<true>{{}, result},
+                                   lists,
+                                   search_keys,
+                                   stream,
+                                   mr)
+           : cudf::type_dispatcher(search_keys.type(),
+                                   lookup_functor<false>{{}, result},
+                                   lists,
+                                   search_keys,
+                                   stream,
+                                   mr);
+}
+
+std::unique_ptr<column> contains_any(cudf::lists_column_view const& lists,
+                                     cudf::lists_column_view const& search_keys,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(search_keys.size() == lists.size(),
+               "Number of search keys must match list column size.");
+  CUDF_EXPECTS(!cudf::is_nested(lists.child().type()),
+               "Nested types not supported in lists::contains_any()");
+  CUDF_EXPECTS(lists.child().type() == search_keys.child().type(),
+               "Type/Scale of search keys does not match list column element type.");
+
+  // The search keys found in each row are those of the intersection of the rows, which hashes
+  // the entries of the long rows
+  auto const found = intersect_distinct(
+    lists, search_keys, null_equality::UNEQUAL, nan_equality::ALL_EQUAL, stream);
+  auto const found_lists = lists_column_view(found->view());
+
+  auto result = make_fixed_width_column(data_type{type_id::BOOL8},
+                                        lists.size(),
+                                        cudf::detail::copy_bitmask(found->view(), stream, mr),
+                                        found->null_count(),
+                                        stream,
+                                        mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    found_lists.offsets_begin(),
+                    found_lists.offsets_end() - 1,
+                    found_lists.offsets_begin() + 1,
+                    result->mutable_view().begin<bool>(),
+                    [] __device__(auto begin, auto end) { return end > begin; });
+  return result;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
@@ -239,5 +469,51 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
   return detail::contains(lists, search_keys, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains(
+    lists, search_key, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains(
+    lists, search_keys, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(lists, search_key, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(lists, search_keys, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> contains_any(cudf::lists_column_view const& lists,
+                                     cudf::lists_column_view const& search_keys,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_any(lists, search_keys, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace lists
 }  // namespace cudf
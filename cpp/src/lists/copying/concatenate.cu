@@ -21,13 +21,23 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
-#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table_device_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
+
 #include <memory>
+#include <tuple>
+#include <vector>
 
 namespace cudf {
 namespace lists {
@@ -36,50 +46,57 @@ namespace detail {
 namespace {
 
 /**
- * @brief Merges the offsets child columns of multiple list columns into one.
+ * @brief Merges the offsets child columns of multiple list columns into one, with a single
+ * kernel.
  *
  * Since offsets are all relative to the start of their respective column,
  * all offsets are shifted to account for the new starting position
  *
- * @param[in] columns               Vector of lists columns to concatenate
- * @param[in] total_list_count      Total number of lists contained in the columns
+ * @param[in] d_columns             Device views of the lists columns to concatenate
+ * @param[in] list_offsets          The offset of the first list of each column in the output,
+ * followed by the total number of lists
+ * @param[in] child_offsets         The offset of the first child row of each column in the output
+ * child, followed by the total number of child rows
  * @param[in] stream                CUDA stream used for device memory operations
  * and kernel launches.
  * @param[in] mr                    Device memory resource used to allocate the
  * returned column's device memory.
  */
-std::unique_ptr<column> merge_offsets(host_span<lists_column_view const> columns,
-                                      size_type total_list_count,
+std::unique_ptr<column> merge_offsets(column_device_view const* d_columns,
+                                      std::vector<size_type> const& list_offsets,
+                                      std::vector<size_type> const& child_offsets,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr)
 {
+  auto const num_columns      = static_cast<size_type>(list_offsets.size() - 1);
+  auto const total_list_count = list_offsets.back();
+
   // outgoing offsets
   auto merged_offsets = cudf::make_fixed_width_column(
     data_type{type_id::INT32}, total_list_count + 1, mask_state::UNALLOCATED, stream, mr);
-  mutable_column_device_view d_merged_offsets(*merged_offsets, 0, 0);
 
-  // merge offsets
-  // TODO : this could probably be done as a single gpu operation if done as a kernel.
-  size_type shift = 0;
-  size_type count = 0;
-  std::for_each(columns.begin(), columns.end(), [&](lists_column_view const& c) {
-    if (c.size() > 0) {
-      // handle sliced columns
-      int const local_shift =
-        shift -
-        (c.offset() > 0 ? cudf::detail::get_value<size_type>(c.offsets(), c.offset(), stream) : 0);
-      column_device_view offsets(c.offsets(), nullptr, nullptr);
-      thrust::transform(
-        rmm::exec_policy(stream),
-        offsets.begin<size_type>() + c.offset(),
-        offsets.begin<size_type>() + c.offset() + c.size() + 1,
-        d_merged_offsets.begin<size_type>() + count,
-        [local_shift] __device__(size_type offset) { return offset + local_shift; });
-
-      shift += c.get_sliced_child(stream).size();
-      count += c.size();
-    }
-  });
+  auto const d_list_offsets  = cudf::detail::make_device_uvector_async(list_offsets, stream);
+  auto const d_child_offsets = cudf::detail::make_device_uvector_async(child_offsets, stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(total_list_count + 1),
+    merged_offsets->mutable_view().begin<size_type>(),
+    [d_columns,
+     list_offsets  = d_list_offsets.data(),
+     child_offsets = d_child_offsets.data(),
+     num_columns,
+     total_list_count] __device__(size_type i) {
+      if (i == total_list_count) { return child_offsets[num_columns]; }
+      // The last column starting at or before `i` is the non-empty column of list `i`
+      auto const index = static_cast<size_type>(
+        thrust::upper_bound(thrust::seq, list_offsets, list_offsets + num_columns, i) -
+        list_offsets - 1);
+      auto const& col     = d_columns[index];
+      auto const* offsets = col.child(lists_column_view::offsets_column_index).data<size_type>() +
+                            col.offset();
+      return offsets[i - list_offsets[index]] - offsets[0] + child_offsets[index];
+    });
 
   return merged_offsets;
 }
@@ -101,21 +118,54 @@ std::unique_ptr<column> concatenate(
       return lists_column_view(c);
     });
 
+  // The bounds of the rows of the children of all the columns are copied to the host at once,
+  // instead of one column at a time to slice their children
+  std::unique_ptr<cudf::detail::device_view_storage> device_view_owners;
+  column_device_view* d_columns;
+  std::tie(device_view_owners, d_columns) =
+    contiguous_copy_column_device_views<column_device_view>(columns, stream);
+  rmm::device_uvector<size_type> d_child_bounds(2 * columns.size(), stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), d_child_bounds.begin(), d_child_bounds.end(), 0);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     columns.size(),
+                     [d_columns, bounds = d_child_bounds.data()] __device__(size_type i) {
+                       auto const& col = d_columns[i];
+                       if (col.size() == 0) { return; }
+                       auto const* offsets =
+                         col.child(lists_column_view::offsets_column_index).data<size_type>();
+                       bounds[2 * i]     = offsets[col.offset()];
+                       bounds[2 * i + 1] = offsets[col.offset() + col.size()];
+                     });
+  auto const child_bounds = cudf::detail::make_std_vector_sync(d_child_bounds, stream);
+
   // concatenate children. also prep data needed for offset merging
   std::vector<column_view> children;
   children.reserve(columns.size());
-  size_type total_list_count = 0;
-  std::for_each(lists_columns.begin(),
-                lists_columns.end(),
-                [&total_list_count, &children, stream](lists_column_view const& l) {
-                  // count total # of lists
-                  total_list_count += l.size();
-                  children.push_back(l.get_sliced_child(stream));
-                });
-  auto data = cudf::detail::concatenate(children, stream, mr);
+  std::vector<size_type> list_offsets(columns.size() + 1, 0);
+  std::vector<size_type> child_offsets(columns.size() + 1, 0);
+  for (std::size_t i = 0; i < lists_columns.size(); ++i) {
+    auto const& l = lists_columns[i];
+    // count total # of lists
+    list_offsets[i + 1] = list_offsets[i] + l.size();
+    if (l.size() > 0) {
+      auto const child_begin = child_bounds[2 * i];
+      auto const child_end   = child_bounds[2 * i + 1];
+      children.push_back(child_begin == 0 and child_end == l.child().size()
+                           ? l.child()
+                           : cudf::slice(l.child(), {child_begin, child_end}).front());
+    } else {
+      // An empty column has no child rows, whatever its offsets
+      children.push_back(cudf::slice(l.child(), {0, 0}).front());
+    }
+    child_offsets[i + 1] = child_offsets[i] + children.back().size();
+  }
+  auto const total_list_count = list_offsets.back();
+  auto data                   = cudf::detail::concatenate(children, stream, mr);
 
   // merge offsets
-  auto offsets = merge_offsets(lists_columns, total_list_count, stream, mr);
+  auto offsets = merge_offsets(d_columns, list_offsets, child_offsets, stream, mr);
 
   // if any of the input columns have nulls, construct the output mask
   bool const has_nulls =
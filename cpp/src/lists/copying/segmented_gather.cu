@@ -73,13 +73,14 @@ std::unique_ptr<column> segmented_gather(lists_column_view const& value_column,
 
   // Create list offsets from gather_map.
   auto output_offset = cudf::allocate_like(
-    gather_map.offsets(), gather_map.size() + 1, mask_allocation_policy::RETAIN, mr);
+    gather_map.offsets(), gather_map.size() + 1, mask_allocation_policy::RETAIN, stream, mr);
   auto output_offset_view = output_offset->mutable_view();
   cudf::copy_range_in_place(gather_map.offsets(),
                             output_offset_view,
                             gather_map.offset(),
                             gather_map.offset() + output_offset_view.size(),
-                            0);
+                            0,
+                            stream);
   // Assemble list column & return
   auto null_mask       = cudf::detail::copy_bitmask(value_column.parent(), stream, mr);
   size_type null_count = value_column.null_count();
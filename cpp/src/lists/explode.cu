@@ -29,10 +29,13 @@
 #include <thrust/binary_search.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/optional.h>
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -43,40 +46,92 @@ constexpr size_type InvalidIndex = -1;
 
 namespace {
 
+/**
+ * @brief Checks that the columns to explode are distinct lists columns whose lists have the same
+ * sizes in each row.
+ */
+void check_explode_columns(table_view const& input_table,
+                           std::vector<size_type> const& explode_column_indices,
+                           rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not explode_column_indices.empty(), "No column to explode");
+  for (auto const idx : explode_column_indices) {
+    CUDF_EXPECTS(input_table.column(idx).type().id() == type_id::LIST,
+                 "Unsupported non-list column");
+  }
+  auto sorted_indices = explode_column_indices;
+  std::sort(sorted_indices.begin(), sorted_indices.end());
+  CUDF_EXPECTS(std::adjacent_find(sorted_indices.begin(), sorted_indices.end()) ==
+                 sorted_indices.end(),
+               "Columns cannot be exploded more than once");
+
+  lists_column_view const first{input_table.column(explode_column_indices.front())};
+  for (auto idx = explode_column_indices.begin() + 1; idx != explode_column_indices.end(); ++idx) {
+    lists_column_view const other{input_table.column(*idx)};
+    CUDF_EXPECTS(
+      thrust::all_of(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     thrust::make_counting_iterator(first.size()),
+                     [first_offsets = first.offsets_begin(),
+                      other_offsets = other.offsets_begin()] __device__(size_type i) {
+                       return first_offsets[i + 1] - first_offsets[i] ==
+                              other_offsets[i + 1] - other_offsets[i];
+                     }),
+      "Exploded columns must have lists of the same sizes");
+  }
+}
+
 std::unique_ptr<table> build_table(
   table_view const& input_table,
-  size_type const explode_column_idx,
-  column_view const& sliced_child,
+  std::vector<size_type> const& explode_column_indices,
+  std::vector<column_view> const& sliced_children,
   cudf::device_span<size_type const> gather_map,
   thrust::optional<cudf::device_span<size_type const>> explode_col_gather_map,
   thrust::optional<rmm::device_uvector<size_type>> position_array,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
-  auto select_iter = thrust::make_transform_iterator(
-    thrust::make_counting_iterator(0),
-    [explode_column_idx](size_type i) { return i >= explode_column_idx ? i + 1 : i; });
-
-  auto gathered_table =
-    detail::gather(input_table.select(select_iter, select_iter + input_table.num_columns() - 1),
-                   gather_map.begin(),
-                   gather_map.end(),
-                   cudf::out_of_bounds_policy::DONT_CHECK,
-                   stream,
-                   mr);
-
-  std::vector<std::unique_ptr<column>> columns = gathered_table.release()->release();
-
-  columns.insert(columns.begin() + explode_column_idx,
-                 explode_col_gather_map
-                   ? std::move(detail::gather(table_view({sliced_child}),
-                                              explode_col_gather_map->begin(),
-                                              explode_col_gather_map->end(),
-                                              cudf::out_of_bounds_policy::NULLIFY,
-                                              stream,
-                                              mr)
-                                 ->release()[0])
-                   : std::make_unique<column>(sliced_child, stream, mr));
+  auto const is_exploded = [&explode_column_indices](size_type i) {
+    return std::find(explode_column_indices.begin(), explode_column_indices.end(), i);
+  };
+
+  // The columns which are not exploded are all gathered at once
+  std::vector<size_type> other_columns;
+  for (size_type i = 0; i < input_table.num_columns(); ++i) {
+    if (is_exploded(i) == explode_column_indices.end()) { other_columns.push_back(i); }
+  }
+  auto gathered_columns = detail::gather(input_table.select(other_columns),
+                                         gather_map.begin(),
+                                         gather_map.end(),
+                                         cudf::out_of_bounds_policy::DONT_CHECK,
+                                         stream,
+                                         mr)
+                            ->release();
+
+  // and so are the children of the exploded columns, which all have the same shape
+  std::vector<std::unique_ptr<column>> exploded_columns;
+  if (explode_col_gather_map) {
+    exploded_columns = detail::gather(table_view(sliced_children),
+                                      explode_col_gather_map->begin(),
+                                      explode_col_gather_map->end(),
+                                      cudf::out_of_bounds_policy::NULLIFY,
+                                      stream,
+                                      mr)
+                         ->release();
+  } else {
+    for (auto const& child : sliced_children) {
+      exploded_columns.push_back(std::make_unique<column>(child, stream, mr));
+    }
+  }
+
+  std::vector<std::unique_ptr<column>> columns;
+  auto next_gathered = gathered_columns.begin();
+  for (size_type i = 0; i < input_table.num_columns(); ++i) {
+    auto const exploded = is_exploded(i);
+    columns.push_back(exploded == explode_column_indices.end()
+                        ? std::move(*next_gathered++)
+                        : std::move(exploded_columns[exploded - explode_column_indices.begin()]));
+  }
 
   if (position_array) {
     size_type position_size = position_array->size();
@@ -90,7 +145,10 @@ std::unique_ptr<table> build_table(
                                            : std::pair<rmm::device_buffer, size_type>{
                                                rmm::device_buffer(0, stream), size_type{0}};
 
-    columns.insert(columns.begin() + explode_column_idx,
+    // the position column goes before the first exploded column
+    auto const position_idx =
+      *std::min_element(explode_column_indices.begin(), explode_column_indices.end());
+    columns.insert(columns.begin() + position_idx,
                    std::make_unique<column>(data_type(type_to_id<size_type>()),
                                             position_size,
                                             position_array->release(),
@@ -100,16 +158,31 @@ std::unique_ptr<table> build_table(
 
   return std::make_unique<table>(std::move(columns));
 }
+
+/**
+ * @brief Returns the children of the exploded columns, sliced to the rows of the table.
+ */
+std::vector<column_view> get_sliced_children(table_view const& input_table,
+                                             std::vector<size_type> const& explode_column_indices,
+                                             rmm::cuda_stream_view stream)
+{
+  std::vector<column_view> children;
+  for (auto const idx : explode_column_indices) {
+    children.push_back(lists_column_view{input_table.column(idx)}.get_sliced_child(stream));
+  }
+  return children;
+}
 }  // namespace
 
 std::unique_ptr<table> explode(table_view const& input_table,
-                               size_type const explode_column_idx,
+                               std::vector<size_type> const& explode_column_indices,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
-  lists_column_view explode_col{input_table.column(explode_column_idx)};
-  auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
+  // The exploded columns have the same shape, so that the first one gives the gather maps
+  lists_column_view explode_col{input_table.column(explode_column_indices.front())};
+  auto const children = get_sliced_children(input_table, explode_column_indices, stream);
+  rmm::device_uvector<size_type> gather_map(children.front().size(), stream);
 
   // Sliced columns may require rebasing of the offsets.
   auto offsets = explode_col.offsets_begin();
@@ -129,8 +202,8 @@ std::unique_ptr<table> explode(table_view const& input_table,
                       gather_map.begin());
 
   return build_table(input_table,
-                     explode_column_idx,
-                     sliced_child,
+                     explode_column_indices,
+                     children,
                      gather_map,
                      thrust::nullopt,
                      thrust::nullopt,
@@ -139,13 +212,13 @@ std::unique_ptr<table> explode(table_view const& input_table,
 }
 
 std::unique_ptr<table> explode_position(table_view const& input_table,
-                                        size_type const explode_column_idx,
+                                        std::vector<size_type> const& explode_column_indices,
                                         rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr)
 {
-  lists_column_view explode_col{input_table.column(explode_column_idx)};
-  auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
+  lists_column_view explode_col{input_table.column(explode_column_indices.front())};
+  auto const children = get_sliced_children(input_table, explode_column_indices, stream);
+  rmm::device_uvector<size_type> gather_map(children.front().size(), stream);
 
   // Sliced columns may require rebasing of the offsets.
   auto offsets = explode_col.offsets_begin();
@@ -154,7 +227,7 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
     offsets + 1, [offsets] __device__(auto i) { return (i - offsets[0]) - 1; });
   auto counting_iter = thrust::make_counting_iterator(0);
 
-  rmm::device_uvector<size_type> pos(sliced_child.size(), stream, mr);
+  rmm::device_uvector<size_type> pos(gather_map.size(), stream, mr);
 
   // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
   // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
@@ -176,8 +249,8 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
     });
 
   return build_table(input_table,
-                     explode_column_idx,
-                     sliced_child,
+                     explode_column_indices,
+                     children,
                      gather_map,
                      thrust::nullopt,
                      std::move(pos),
@@ -186,15 +259,16 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
 }
 
 std::unique_ptr<table> explode_outer(table_view const& input_table,
-                                     size_type const explode_column_idx,
+                                     std::vector<size_type> const& explode_column_indices,
                                      bool include_position,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
-  lists_column_view explode_col{input_table.column(explode_column_idx)};
-  auto sliced_child  = explode_col.get_sliced_child(stream);
-  auto counting_iter = thrust::make_counting_iterator(0);
-  auto offsets       = explode_col.offsets_begin();
+  lists_column_view explode_col{input_table.column(explode_column_indices.front())};
+  auto const children     = get_sliced_children(input_table, explode_column_indices, stream);
+  auto const sliced_child = children.front();
+  auto counting_iter      = thrust::make_counting_iterator(0);
+  auto offsets            = explode_col.offsets_begin();
 
   // number of nulls or empty lists found so far in the explode column
   rmm::device_uvector<size_type> null_or_empty_offset(explode_col.size(), stream);
@@ -214,8 +288,9 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
   if (null_or_empty_count == 0) {
     // performance penalty to run the below loop if there are no nulls or empty lists.
     // run simple explode instead
-    return include_position ? explode_position(input_table, explode_column_idx, stream, mr)
-                            : explode(input_table, explode_column_idx, stream, mr);
+    return include_position
+             ? explode_position(input_table, explode_column_indices, stream, mr)
+             : explode(input_table, explode_column_indices, stream, mr);
   }
 
   auto gather_map_size = sliced_child.size() + null_or_empty_count;
@@ -271,8 +346,8 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
 
   return build_table(
     input_table,
-    explode_column_idx,
-    sliced_child,
+    explode_column_indices,
+    children,
     gather_map,
     explode_col_gather_map,
     include_position ? std::move(pos) : thrust::optional<rmm::device_uvector<size_type>>{},
@@ -292,7 +367,7 @@ std::unique_ptr<table> explode(table_view const& input_table,
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(input_table.column(explode_column_idx).type().id() == type_id::LIST,
                "Unsupported non-list column");
-  return detail::explode(input_table, explode_column_idx, rmm::cuda_stream_default, mr);
+  return detail::explode(input_table, {explode_column_idx}, rmm::cuda_stream_default, mr);
 }
 
 /**
@@ -305,7 +380,8 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(input_table.column(explode_column_idx).type().id() == type_id::LIST,
                "Unsupported non-list column");
-  return detail::explode_position(input_table, explode_column_idx, rmm::cuda_stream_default, mr);
+  return detail::explode_position(
+    input_table, {explode_column_idx}, rmm::cuda_stream_default, mr);
 }
 
 /**
@@ -319,7 +395,7 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
   CUDF_EXPECTS(input_table.column(explode_column_idx).type().id() == type_id::LIST,
                "Unsupported non-list column");
   return detail::explode_outer(
-    input_table, explode_column_idx, false, rmm::cuda_stream_default, mr);
+    input_table, {explode_column_idx}, false, rmm::cuda_stream_default, mr);
 }
 
 /**
@@ -333,7 +409,61 @@ std::unique_ptr<table> explode_outer_position(table_view const& input_table,
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(input_table.column(explode_column_idx).type().id() == type_id::LIST,
                "Unsupported non-list column");
-  return detail::explode_outer(input_table, explode_column_idx, true, rmm::cuda_stream_default, mr);
+  return detail::explode_outer(
+    input_table, {explode_column_idx}, true, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc cudf::explode(input_table,explode_column_indices,rmm::mr::device_memory_resource)
+ */
+std::unique_ptr<table> explode(table_view const& input_table,
+                               std::vector<size_type> const& explode_column_indices,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::check_explode_columns(input_table, explode_column_indices, rmm::cuda_stream_default);
+  return detail::explode(input_table, explode_column_indices, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc
+ * cudf::explode_position(input_table,explode_column_indices,rmm::mr::device_memory_resource)
+ */
+std::unique_ptr<table> explode_position(table_view const& input_table,
+                                        std::vector<size_type> const& explode_column_indices,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::check_explode_columns(input_table, explode_column_indices, rmm::cuda_stream_default);
+  return detail::explode_position(
+    input_table, explode_column_indices, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc cudf::explode_outer(input_table,explode_column_indices,rmm::mr::device_memory_resource)
+ */
+std::unique_ptr<table> explode_outer(table_view const& input_table,
+                                     std::vector<size_type> const& explode_column_indices,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::check_explode_columns(input_table, explode_column_indices, rmm::cuda_stream_default);
+  return detail::explode_outer(
+    input_table, explode_column_indices, false, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc
+ * cudf::explode_outer_position(input_table,explode_column_indices,rmm::mr::device_memory_resource)
+ */
+std::unique_ptr<table> explode_outer_position(table_view const& input_table,
+                                              std::vector<size_type> const& explode_column_indices,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::check_explode_columns(input_table, explode_column_indices, rmm::cuda_stream_default);
+  return detail::explode_outer(
+    input_table, explode_column_indices, true, rmm::cuda_stream_default, mr);
 }
 
 }  // namespace cudf
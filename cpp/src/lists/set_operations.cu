@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+#include <lists/set_operations_impl.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/detail/set_operations.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+namespace {
+
+// The entries of the lists of at most this size are searched by scanning the lists, which is
+// cheaper than hashing them
+constexpr size_type max_scanned_list_size = 32;
+
+/**
+ * @brief Compares two entries of a column for equality, with the null and NaN equality of the set
+ * operations.
+ *
+ * A floating-point `-0.0` is equal to `0.0`.
+ */
+struct entry_comparator {
+  column_device_view entries;
+  bool nulls_equal;
+  bool nans_equal;
+
+  template <typename T,
+            CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>() and
+                           cudf::is_equality_comparable<T, T>())>
+  __device__ bool operator()(size_type lhs, size_type rhs) const noexcept
+  {
+    bool const lhs_is_null{entries.is_null(lhs)};
+    bool const rhs_is_null{entries.is_null(rhs)};
+    if (lhs_is_null or rhs_is_null) { return lhs_is_null and rhs_is_null and nulls_equal; }
+
+    auto const lhs_value = entries.element<T>(lhs);
+    auto const rhs_value = entries.element<T>(rhs);
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(lhs_value) and std::isnan(rhs_value)) { return nans_equal; }
+    }
+    return lhs_value == rhs_value;
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>() or
+                           not cudf::is_equality_comparable<T, T>())>
+  __device__ bool operator()(size_type, size_type) const noexcept
+  {
+    cudf_assert(false && "Attempted to compare list entries of an uncomparable type.");
+    return false;
+  }
+
+  __device__ bool equal(size_type lhs, size_type rhs) const noexcept
+  {
+    return cudf::type_dispatcher(entries.type(), *this, lhs, rhs);
+  }
+};
+
+/**
+ * @brief Hashes an entry together with the row of the list that holds it, so that one hash set
+ * holds the entries of all the lists of a column.
+ */
+struct entry_hasher {
+  column_device_view entries;
+  size_type const* entry_rows;
+
+  __device__ hash_value_type operator()(size_type entry) const noexcept
+  {
+    // The hash of the floating-point values is the same for `-0.0` and `0.0`, and for all NaNs
+    auto const value_hash = cudf::type_dispatcher(
+      entries.type(), element_hasher<MurmurHash3_32, true>{}, entries, entry);
+    auto const row_hash = MurmurHash3_32<size_type>{}(entry_rows[entry]);
+    return MurmurHash3_32<hash_value_type>{}.hash_combine(row_hash, value_hash);
+  }
+};
+
+/**
+ * @brief Compares two entries for equality, where the entries of different rows are never equal.
+ */
+struct entry_row_comparator {
+  entry_comparator compare;
+  size_type const* entry_rows;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const noexcept
+  {
+    return entry_rows[lhs] == entry_rows[rhs] and compare.equal(lhs, rhs);
+  }
+};
+
+// Maps each distinct entry of the long lists to the first entry of its value in its list
+using entry_set_type =
+  concurrent_unordered_map<size_type, size_type, entry_hasher, entry_row_comparator>;
+
+/**
+ * @brief Device view on the entries of the lists of one input of a set operation.
+ *
+ * A short list is searched by scanning its entries, and a long list through a hash set of the
+ * entries of all the long lists.
+ */
+struct list_entry_set {
+  entry_comparator compare;
+  offset_type const* offsets;  ///< The range of the entries of each row in the entries column
+  entry_set_type set;
+
+  __device__ bool is_scanned(size_type row) const noexcept
+  {
+    return offsets[row + 1] - offsets[row] <= max_scanned_list_size;
+  }
+
+  /**
+   * @brief Returns whether any entry in [`begin`, `end`) is equal to `entry`.
+   */
+  __device__ bool scan(offset_type begin, offset_type end, size_type entry) const noexcept
+  {
+    for (auto i = begin; i < end; ++i) {
+      if (compare.equal(i, entry)) { return true; }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Inserts an entry of a long list into the hash set, keeping the smallest of the equal
+   * entries of its list.
+   */
+  __device__ void insert(size_type entry) noexcept
+  {
+    auto const result = set.insert(thrust::make_pair(entry, entry));
+    if (not result.second) { atomicMin(&(*result.first).second, entry); }
+  }
+
+  /**
+   * @brief Returns whether `entry` is the first entry of its value in the list of `row`.
+   *
+   * The entries of the long lists must all have been inserted.
+   */
+  __device__ bool is_first(size_type row, size_type entry) const noexcept
+  {
+    if (is_scanned(row)) { return not scan(offsets[row], entry, entry); }
+    return (*set.find(entry)).second == entry;
+  }
+
+  /**
+   * @brief Returns whether the list of `row` holds an entry equal to `entry`, which may be an
+   * entry of the other input.
+   *
+   * The entries of the long lists must all have been inserted.
+   */
+  __device__ bool contains(size_type row, size_type entry) const noexcept
+  {
+    if (is_scanned(row)) { return scan(offsets[row], offsets[row + 1], entry); }
+    return set.find(entry) != set.end();
+  }
+};
+
+/**
+ * @brief The entries of the lists of one input of a set operation, and the hash set of the
+ * entries of its long lists.
+ */
+class list_entries {
+ public:
+  /**
+   * @brief Creates an empty hash set for the entries of the long lists of `lists`.
+   *
+   * @param lists The lists column
+   * @param first_entry The index of the first entry of `lists` in the entries column
+   * @param num_entries The number of entries of `lists`
+   * @param entries The entries of all the inputs
+   * @param entry_rows The row of each entry of `entries`
+   * @param compare Compares the entries
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  list_entries(lists_column_view const& lists,
+               size_type first_entry,
+               size_type num_entries,
+               column_device_view const& entries,
+               size_type const* entry_rows,
+               entry_comparator compare,
+               rmm::cuda_stream_view stream)
+    : _compare{compare},
+      _first_entry{first_entry},
+      _num_entries{num_entries},
+      _offsets(lists.size() + 1, stream)
+  {
+    // The offsets of the lists in the entries column
+    thrust::transform(rmm::exec_policy(stream),
+                      lists.offsets_begin(),
+                      lists.offsets_end(),
+                      _offsets.begin(),
+                      [first = lists.offsets_begin(), first_entry] __device__(auto offset) {
+                        return offset - *first + first_entry;
+                      });
+
+    auto const d_offsets     = _offsets.data();
+    auto const num_set_items = thrust::transform_reduce(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(lists.size()),
+      [d_offsets] __device__(size_type row) {
+        auto const size = d_offsets[row + 1] - d_offsets[row];
+        return size > max_scanned_list_size ? size : 0;
+      },
+      size_type{0},
+      thrust::plus<size_type>{});
+
+    _set = entry_set_type::create(compute_hash_table_size(std::max(num_set_items, 1)),
+                                  stream,
+                                  std::numeric_limits<size_type>::max(),
+                                  std::numeric_limits<size_type>::max(),
+                                  entry_hasher{entries, entry_rows},
+                                  entry_row_comparator{compare, entry_rows});
+  }
+
+  /**
+   * @brief Writes the row of each entry of these lists into `entry_rows`.
+   */
+  void find_entry_rows(size_type* entry_rows, rmm::cuda_stream_view stream) const
+  {
+    thrust::upper_bound(rmm::exec_policy(stream),
+                        _offsets.begin(),
+                        _offsets.end(),
+                        thrust::make_counting_iterator<size_type>(_first_entry),
+                        thrust::make_counting_iterator<size_type>(_first_entry + _num_entries),
+                        entry_rows + _first_entry);
+    thrust::transform(rmm::exec_policy(stream),
+                      entry_rows + _first_entry,
+                      entry_rows + _first_entry + _num_entries,
+                      entry_rows + _first_entry,
+                      [] __device__(size_type upper_bound) { return upper_bound - 1; });
+  }
+
+  /**
+   * @brief Inserts the entries of the long lists into the hash set, which must be done before
+   * the entries are searched.
+   */
+  void insert_long_lists(size_type const* entry_rows, rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(_first_entry),
+                     thrust::make_counting_iterator<size_type>(_first_entry + _num_entries),
+                     [entry_set = view(), entry_rows] __device__(size_type entry) mutable {
+                       auto const row = entry_rows[entry];
+                       if (not entry_set.is_scanned(row)) { entry_set.insert(entry); }
+                     });
+  }
+
+  list_entry_set view() const { return list_entry_set{_compare, _offsets.data(), *_set}; }
+
+  offset_type const* offsets() const noexcept { return _offsets.data(); }
+  size_type first_entry() const noexcept { return _first_entry; }
+  size_type num_entries() const noexcept { return _num_entries; }
+
+ private:
+  entry_comparator _compare;
+  size_type _first_entry;
+  size_type _num_entries;
+  rmm::device_uvector<offset_type> _offsets;
+  std::unique_ptr<entry_set_type, std::function<void(entry_set_type*)>> _set;
+};
+
+/**
+ * @brief Flags the entries of `lists` which are kept in the output.
+ *
+ * An entry is kept if it is the first of its value in its list, and if `filter` is true for it.
+ * The long lists of `lists` must have been inserted into its hash set.
+ *
+ * @param lists The entries to flag
+ * @param entry_rows The row of each entry
+ * @param null_mask The null mask of the output rows, whose entries are not kept; or nullptr
+ * @param keep The flags of all the entries, of which those of `lists` are written
+ * @param filter The device functor returning whether an entry of a row may be kept
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <typename Filter>
+void flag_kept_entries(list_entries const& lists,
+                       size_type const* entry_rows,
+                       bitmask_type const* null_mask,
+                       size_type* keep,
+                       Filter filter,
+                       rmm::cuda_stream_view stream)
+{
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(lists.first_entry()),
+    thrust::make_counting_iterator<size_type>(lists.first_entry() + lists.num_entries()),
+    keep + lists.first_entry(),
+    [entry_set = lists.view(), entry_rows, null_mask, filter] __device__(size_type entry) {
+      auto const row = entry_rows[entry];
+      if (null_mask != nullptr and not bit_is_set(null_mask, row)) { return 0; }
+      return entry_set.is_first(row, entry) and filter(row, entry) ? 1 : 0;
+    });
+}
+
+/**
+ * @brief Builds the lists of the kept entries of the rows of `lhs`, each followed by the kept
+ * entries of the same row of `rhs` if any.
+ */
+std::unique_ptr<column> gather_kept_entries(column_view const& entries,
+                                            size_type num_rows,
+                                            list_entries const& lhs,
+                                            list_entries const* rhs,
+                                            size_type const* entry_rows,
+                                            rmm::device_uvector<size_type> const& keep,
+                                            rmm::device_buffer&& null_mask,
+                                            size_type null_count,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  // ranks[i] is the number of kept entries before the entry i
+  auto const num_entries = static_cast<size_type>(keep.size());
+  rmm::device_uvector<size_type> ranks(num_entries + 1, stream);
+  CUDA_TRY(cudaMemsetAsync(ranks.data(), 0, sizeof(size_type), stream.value()));
+  thrust::inclusive_scan(rmm::exec_policy(stream), keep.begin(), keep.end(), ranks.begin() + 1);
+
+  auto const d_ranks       = ranks.data();
+  auto const lhs_offsets   = lhs.offsets();
+  auto const rhs_offsets   = rhs != nullptr ? rhs->offsets() : nullptr;
+  auto const num_lhs_kept  = [d_ranks, lhs_offsets] __device__(size_type row) {
+    return d_ranks[lhs_offsets[row + 1]] - d_ranks[lhs_offsets[row]];
+  };
+  auto const num_rhs_kept = [d_ranks, rhs_offsets] __device__(size_type row) {
+    return rhs_offsets == nullptr ? 0 : d_ranks[rhs_offsets[row + 1]] - d_ranks[rhs_offsets[row]];
+  };
+
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<offset_type>()}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets = offsets->mutable_view().data<offset_type>();
+  CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(offset_type), stream.value()));
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    d_offsets + 1,
+    [num_lhs_kept, num_rhs_kept] __device__(size_type row) {
+      return num_lhs_kept(row) + num_rhs_kept(row);
+    },
+    thrust::plus<offset_type>{});
+
+  // Each kept entry is gathered at its rank among the kept entries of its list
+  rmm::device_uvector<size_type> gather_map(ranks.element(num_entries, stream), stream);
+  thrust::for_each(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_entries),
+    [d_keep       = keep.data(),
+     d_ranks,
+     d_offsets,
+     lhs_offsets,
+     rhs_offsets,
+     num_lhs_kept,
+     entry_rows,
+     first_rhs    = lhs.num_entries(),
+     d_gather_map = gather_map.data()] __device__(size_type entry) {
+      if (d_keep[entry] == 0) { return; }
+      auto const row      = entry_rows[entry];
+      auto const position = entry < first_rhs
+                              ? d_offsets[row] + d_ranks[entry] - d_ranks[lhs_offsets[row]]
+                              : d_offsets[row] + num_lhs_kept(row) + d_ranks[entry] -
+                                  d_ranks[rhs_offsets[row]];
+      d_gather_map[position] = entry;
+    });
+
+  auto child = std::move(cudf::detail::gather(table_view{{entries}},
+                                              gather_map.begin(),
+                                              gather_map.end(),
+                                              out_of_bounds_policy::DONT_CHECK,
+                                              stream,
+                                              mr)
+                           ->release()
+                           .front());
+
+  return make_lists_column(num_rows,
+                           std::move(offsets),
+                           std::move(child),
+                           null_count,
+                           std::move(null_mask),
+                           stream,
+                           mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> set_operation(lists_column_view const& lhs,
+                                      lists_column_view const& rhs,
+                                      set_operation_kind kind,
+                                      null_equality nulls_equal,
+                                      nan_equality nans_equal,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  bool const is_distinct = kind == set_operation_kind::DISTINCT;
+  if (not is_distinct) {
+    CUDF_EXPECTS(lhs.size() == rhs.size(), "The lists columns must have the same size.");
+    CUDF_EXPECTS(lhs.child().type() == rhs.child().type(),
+                 "The lists columns must have entries of the same type.");
+  }
+  CUDF_EXPECTS(not cudf::is_nested(lhs.child().type()),
+               "Nested types are not supported in the set operations of lists.");
+  if (lhs.is_empty()) { return empty_like(lhs.parent()); }
+
+  // The entries of `lhs`, followed by those of `rhs` if it is used
+  auto const lhs_entries = lhs.get_sliced_child(stream);
+  auto const concatenated =
+    is_distinct ? nullptr
+                : cudf::detail::concatenate(
+                    std::vector<column_view>{lhs_entries, rhs.get_sliced_child(stream)}, stream);
+  auto const entries   = is_distinct ? lhs_entries : concatenated->view();
+  auto const d_entries = column_device_view::create(entries, stream);
+
+  // The null mask of the output rows, whose entries are dropped
+  auto [null_mask, null_count] =
+    is_distinct ? std::make_pair(cudf::detail::copy_bitmask(lhs.parent(), stream, mr),
+                                 lhs.null_count())
+                : cudf::detail::bitmask_and(table_view{{lhs.parent(), rhs.parent()}}, stream, mr);
+  auto const d_null_mask =
+    null_count == 0 ? nullptr : static_cast<bitmask_type const*>(null_mask.data());
+
+  rmm::device_uvector<size_type> entry_rows(entries.size(), stream);
+  auto const compare = entry_comparator{
+    *d_entries, nulls_equal == null_equality::EQUAL, nans_equal == nan_equality::ALL_EQUAL};
+  auto const lhs_set =
+    list_entries(lhs, 0, lhs_entries.size(), *d_entries, entry_rows.data(), compare, stream);
+  auto const rhs_set = is_distinct ? nullptr
+                                   : std::make_unique<list_entries>(rhs,
+                                                                    lhs_entries.size(),
+                                                                    entries.size() -
+                                                                      lhs_entries.size(),
+                                                                    *d_entries,
+                                                                    entry_rows.data(),
+                                                                    compare,
+                                                                    stream);
+  lhs_set.find_entry_rows(entry_rows.data(), stream);
+  if (rhs_set) { rhs_set->find_entry_rows(entry_rows.data(), stream); }
+  lhs_set.insert_long_lists(entry_rows.data(), stream);
+  if (rhs_set) { rhs_set->insert_long_lists(entry_rows.data(), stream); }
+
+  rmm::device_uvector<size_type> keep(entries.size(), stream);
+  auto const d_rows = entry_rows.data();
+  auto const any    = [] __device__(size_type, size_type) { return true; };
+  switch (kind) {
+    case set_operation_kind::DISTINCT:
+      flag_kept_entries(lhs_set, d_rows, d_null_mask, keep.data(), any, stream);
+      break;
+    case set_operation_kind::INTERSECT:
+    case set_operation_kind::DIFFERENCE: {
+      bool const is_intersect = kind == set_operation_kind::INTERSECT;
+      flag_kept_entries(lhs_set,
+                        d_rows,
+                        d_null_mask,
+                        keep.data(),
+                        [rhs_view = rhs_set->view(), is_intersect] __device__(
+                          size_type row, size_type entry) {
+                          return rhs_view.contains(row, entry) == is_intersect;
+                        },
+                        stream);
+      break;
+    }
+    case set_operation_kind::UNION:
+      flag_kept_entries(lhs_set, d_rows, d_null_mask, keep.data(), any, stream);
+      flag_kept_entries(*rhs_set,
+                        d_rows,
+                        d_null_mask,
+                        keep.data(),
+                        [lhs_view = lhs_set.view()] __device__(size_type row, size_type entry) {
+                          return not lhs_view.contains(row, entry);
+                        },
+                        stream);
+      break;
+  }
+
+  // Only the union outputs entries of `rhs`
+  return gather_kept_entries(entries,
+                             lhs.size(),
+                             lhs_set,
+                             kind == set_operation_kind::UNION ? rhs_set.get() : nullptr,
+                             d_rows,
+                             keep,
+                             std::move(null_mask),
+                             null_count,
+                             stream,
+                             mr);
+}
+
+std::unique_ptr<column> intersect_distinct(lists_column_view const& lhs,
+                                           lists_column_view const& rhs,
+                                           null_equality nulls_equal,
+                                           nan_equality nans_equal,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  return set_operation(
+    lhs, rhs, set_operation_kind::INTERSECT, nulls_equal, nans_equal, stream, mr);
+}
+
+std::unique_ptr<column> union_distinct(lists_column_view const& lhs,
+                                       lists_column_view const& rhs,
+                                       null_equality nulls_equal,
+                                       nan_equality nans_equal,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  return set_operation(lhs, rhs, set_operation_kind::UNION, nulls_equal, nans_equal, stream, mr);
+}
+
+std::unique_ptr<column> difference_distinct(lists_column_view const& lhs,
+                                            lists_column_view const& rhs,
+                                            null_equality nulls_equal,
+                                            nan_equality nans_equal,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  return set_operation(
+    lhs, rhs, set_operation_kind::DIFFERENCE, nulls_equal, nans_equal, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> intersect_distinct(lists_column_view const& lhs,
+                                           lists_column_view const& rhs,
+                                           null_equality nulls_equal,
+                                           nan_equality nans_equal,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::intersect_distinct(
+    lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> union_distinct(lists_column_view const& lhs,
+                                       lists_column_view const& rhs,
+                                       null_equality nulls_equal,
+                                       nan_equality nans_equal,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::union_distinct(lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> difference_distinct(lists_column_view const& lhs,
+                                            lists_column_view const& rhs,
+                                            null_equality nulls_equal,
+                                            nan_equality nans_equal,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::difference_distinct(
+    lhs, rhs, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
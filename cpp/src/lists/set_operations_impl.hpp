@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/stream_compaction.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+
+/**
+ * @brief The operations applied by `set_operation` to the lists of each row.
+ */
+enum class set_operation_kind {
+  DISTINCT,    ///< The distinct entries of `lhs`
+  INTERSECT,   ///< The distinct entries of `lhs` which are in `rhs`
+  UNION,       ///< The distinct entries of `lhs` and `rhs`
+  DIFFERENCE   ///< The distinct entries of `lhs` which are not in `rhs`
+};
+
+/**
+ * @brief Applies a set operation to the lists of each row of `lhs` and `rhs`, finding the equal
+ * entries by hashing them instead of sorting the lists.
+ *
+ * The lists of at most a few entries are searched by scanning them. The entries of the longer
+ * lists are inserted into a hash set keyed on both the row and the value of each entry.
+ *
+ * For `DISTINCT`, `rhs` is ignored and the output rows have the nulls of `lhs`. For the other
+ * operations, an output row is null if the row of either input is null. The null output rows are
+ * empty.
+ *
+ * @throw cudf::logic_error if the entries are of a nested type.
+ * @throw cudf::logic_error if `lhs` and `rhs` have different sizes or entry types.
+ *
+ * @param lhs         The first lists column
+ * @param rhs         The second lists column
+ * @param kind        The operation to apply
+ * @param nulls_equal Flag to specify whether null entries should be considered equal
+ * @param nans_equal  Flag to specify whether NaN entries should be considered as equal value
+ * @param stream      CUDA stream used for device memory operations and kernel launches
+ * @param mr          Device resource used to allocate memory
+ * @return A lists column of the distinct entries resulting from the operation on each row
+ */
+std::unique_ptr<column> set_operation(lists_column_view const& lhs,
+                                      lists_column_view const& rhs,
+                                      set_operation_kind kind,
+                                      null_equality nulls_equal,
+                                      nan_equality nans_equal,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace lists
+}  // namespace cudf
@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -25,17 +27,24 @@
 #include <cudf/strings/detail/merge.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/pair.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/swap.h>
+#include <thrust/transform.h>
 
-#include <queue>
+#include <algorithm>
 #include <vector>
 #include "cudf/utilities/traits.hpp"
 
@@ -220,6 +229,247 @@ index_vector generate_merged_indices(table_view const& left_table,
   return merged_indices;
 }
 
+/**
+ * @brief The minimum number of rows of an input table between two consecutive splitters of the
+ * k-way merge.
+ */
+constexpr size_type MIN_SPLITTER_STRIDE{256};
+
+/**
+ * @brief Orders the rows of the concatenation of sorted tables, breaking ties by row index.
+ *
+ * Rows of equal keys are thus ordered by input table, then by row within their table, which
+ * makes the order strict and the k-way merge stable.
+ *
+ * @tparam has_nulls Indicates the potential for null values in the keys
+ */
+template <bool has_nulls>
+struct merged_row_order {
+  row_lexicographic_comparator<has_nulls> comparator;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const noexcept
+  {
+    if (comparator(lhs, rhs)) { return true; }
+    return lhs < rhs and not comparator(rhs, lhs);
+  }
+};
+
+/**
+ * @brief Merges the rows of a bucket of the k-way merge.
+ *
+ * The rows of a bucket are a splitter and the rows ordered after it and before the next splitter.
+ * They come from a contiguous range of each input table, of at most the splitter stride rows,
+ * and go to a contiguous range of the output. A thread merges them with a binary heap of the next
+ * row of each table.
+ *
+ * @tparam RowOrder Strict order of the rows of the concatenated tables
+ */
+template <typename RowOrder>
+struct bucket_merger {
+  RowOrder before;
+  size_type const* offsets;         ///< Rows of the tables in the concatenation, of size k + 1
+  size_type num_tables;             ///< The number of tables k
+  size_type num_buckets;            ///< The number of buckets, one per splitter
+  size_type const* bounds;          ///< Rows of each table before each splitter, splitter-major
+  size_type const* splitter_order;  ///< The splitters, in merged order
+  size_type const* bucket_begin;    ///< The output position of each splitter, in merged order
+  size_type* cursors;               ///< Scratch of k rows per bucket
+  size_type* heaps;                 ///< Scratch of k tables per bucket
+  size_type* gather_map;            ///< The merged rows of the concatenation
+
+  /**
+   * @brief Returns the row of `table` that begins the bucket after `bucket`.
+   */
+  __device__ size_type end_row(size_type bucket, size_type table) const noexcept
+  {
+    if (bucket + 1 == num_buckets) { return offsets[table + 1]; }
+    return offsets[table] + bounds[splitter_order[bucket + 1] * num_tables + table];
+  }
+
+  __device__ void sift_down(size_type const* cursor, size_type* heap, size_type size) const
+  {
+    size_type parent = 0;
+    while (2 * parent + 1 < size) {
+      auto child = 2 * parent + 1;
+      if (child + 1 < size and before(cursor[heap[child + 1]], cursor[heap[child]])) { ++child; }
+      if (not before(cursor[heap[child]], cursor[heap[parent]])) { return; }
+      thrust::swap(heap[parent], heap[child]);
+      parent = child;
+    }
+  }
+
+  __device__ void operator()(size_type bucket) const
+  {
+    auto const begin  = bounds + splitter_order[bucket] * num_tables;
+    auto const cursor = cursors + bucket * num_tables;
+    auto const heap   = heaps + bucket * num_tables;
+
+    // Build the heap of the tables with rows in the bucket, inserting them one by one
+    size_type size = 0;
+    for (size_type table = 0; table < num_tables; ++table) {
+      cursor[table] = offsets[table] + begin[table];
+      if (cursor[table] == end_row(bucket, table)) { continue; }
+      auto child  = size++;
+      heap[child] = table;
+      while (child > 0 and before(cursor[heap[child]], cursor[heap[(child - 1) / 2]])) {
+        thrust::swap(heap[child], heap[(child - 1) / 2]);
+        child = (child - 1) / 2;
+      }
+    }
+
+    auto output = gather_map + bucket_begin[bucket];
+    while (size > 0) {
+      auto const table = heap[0];
+      *output++        = cursor[table]++;
+      if (cursor[table] == end_row(bucket, table)) { heap[0] = heap[--size]; }
+      sift_down(cursor, heap, size);
+    }
+  }
+};
+
+/**
+ * @brief Merges the concatenation of sorted tables, given its strict row order and splitters.
+ *
+ * @param before Strict order of the rows of the concatenated tables
+ * @param offsets The first row of each table, followed by the number of rows
+ * @param splitters The rows splitting the output into buckets
+ * @param[out] merged_indices The rows, in merged order
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename RowOrder>
+void merge_buckets(RowOrder before,
+                   device_span<size_type const> offsets,
+                   device_span<size_type const> splitters,
+                   device_span<size_type> merged_indices,
+                   rmm::cuda_stream_view stream)
+{
+  auto const num_tables    = static_cast<size_type>(offsets.size()) - 1;
+  auto const num_splitters = static_cast<size_type>(splitters.size());
+  auto const temp_mr       = cudf::get_current_temp_resource();
+
+  rmm::device_uvector<size_type> bounds(num_splitters * num_tables, stream, temp_mr);
+  rmm::device_uvector<size_type> splitter_order(num_splitters, stream, temp_mr);
+  rmm::device_uvector<size_type> bucket_begin(num_splitters, stream, temp_mr);
+  rmm::device_uvector<size_type> cursors(num_splitters * num_tables, stream, temp_mr);
+  rmm::device_uvector<size_type> heaps(num_splitters * num_tables, stream, temp_mr);
+
+  // The rows of each table ordered before each splitter
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_splitters * num_tables),
+                    bounds.begin(),
+                    [before,
+                     num_tables,
+                     splitters = splitters.data(),
+                     offsets   = offsets.data()] __device__(size_type idx) {
+                      auto const splitter = splitters[idx / num_tables];
+                      auto const table    = idx % num_tables;
+                      auto first          = offsets[table];
+                      auto last           = offsets[table + 1];
+                      while (first < last) {
+                        auto const mid = first + (last - first) / 2;
+                        if (before(mid, splitter)) {
+                          first = mid + 1;
+                        } else {
+                          last = mid;
+                        }
+                      }
+                      return first - offsets[table];
+                    });
+
+  // The output position of each splitter is the number of rows ordered before it
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_splitters),
+                    bucket_begin.begin(),
+                    [num_tables, bounds = bounds.data()] __device__(size_type splitter) {
+                      auto const begin = bounds + splitter * num_tables;
+                      return thrust::reduce(thrust::seq, begin, begin + num_tables);
+                    });
+  thrust::sequence(rmm::exec_policy(stream), splitter_order.begin(), splitter_order.end());
+  thrust::sort_by_key(
+    rmm::exec_policy(stream), bucket_begin.begin(), bucket_begin.end(), splitter_order.begin());
+
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_splitters,
+                     bucket_merger<RowOrder>{before,
+                                             offsets.data(),
+                                             num_tables,
+                                             num_splitters,
+                                             bounds.data(),
+                                             splitter_order.data(),
+                                             bucket_begin.data(),
+                                             cursors.data(),
+                                             heaps.data(),
+                                             merged_indices.data()});
+}
+
+/**
+ * @brief Generates the merged order of the rows of the concatenation of more than two sorted
+ * tables, in one pass.
+ *
+ * Every `stride`-th row of each table is a splitter. The position of a splitter in the output is
+ * the number of rows of all tables ordered before it, which a binary search in each table gives.
+ * Sorting the splitters by their positions splits the output into one bucket per splitter, and
+ * the rows of each bucket are merged by a thread, independently of the other buckets. The first
+ * row of each table is a splitter, so the first output row begins a bucket.
+ *
+ * @param keys The key columns of the concatenated tables
+ * @param offsets The first row of each table in `keys`, followed by the number of rows of `keys`;
+ * all tables must be non-empty
+ * @param column_order Sort order types of the key columns
+ * @param null_precedence Array indicating the order of nulls with respect to non-nulls for the
+ * key columns
+ * @param nullable Flag indicating if the keys have nulls
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The rows of `keys`, in merged order
+ */
+rmm::device_uvector<size_type> generate_k_way_merged_indices(
+  table_view const& keys,
+  std::vector<size_type> const& offsets,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  bool nullable,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_tables = static_cast<size_type>(offsets.size()) - 1;
+  auto const stride     = std::max(MIN_SPLITTER_STRIDE, 8 * num_tables);
+
+  std::vector<size_type> splitters;
+  for (size_type table = 0; table < num_tables; ++table) {
+    for (auto row = offsets[table]; row < offsets[table + 1]; row += stride) {
+      splitters.push_back(row);
+    }
+  }
+
+  auto const temp_mr     = cudf::get_current_temp_resource();
+  auto const d_splitters = cudf::detail::make_device_uvector_async(splitters, stream, temp_mr);
+  auto const d_offsets   = cudf::detail::make_device_uvector_async(offsets, stream, temp_mr);
+  auto const d_column_order =
+    cudf::detail::make_device_uvector_async(column_order, stream, temp_mr);
+  auto const d_keys = table_device_view::create(keys, stream);
+
+  rmm::device_uvector<size_type> merged_indices(keys.num_rows(), stream);
+
+  if (nullable) {
+    auto const d_null_precedence =
+      cudf::detail::make_device_uvector_async(null_precedence, stream, temp_mr);
+    auto const before = merged_row_order<true>{row_lexicographic_comparator<true>(
+      *d_keys, *d_keys, d_column_order.data(), d_null_precedence.data())};
+    merge_buckets(before, d_offsets, d_splitters, merged_indices, stream);
+  } else {
+    auto const before = merged_row_order<false>{
+      row_lexicographic_comparator<false>(*d_keys, *d_keys, d_column_order.data())};
+    merge_buckets(before, d_offsets, d_splitters, merged_indices, stream);
+  }
+
+  CHECK_CUDA(stream.value());
+
+  return merged_indices;
+}
+
 }  // namespace
 
 /**
@@ -391,28 +641,37 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
-struct merge_queue_item {
-  table_view view;
-  table_ptr_type table;
-  // Priority is a separate member to ensure that moving from an object
-  // does not change its priority (which would ruin the queue invariant)
-  cudf::size_type priority = 0;
-
-  merge_queue_item(table_view const& view, table_ptr_type&& table)
-    : view{view}, table{std::move(table)}, priority{-view.num_rows()}
-  {
+/**
+ * @brief Merges more than two sorted tables in one pass.
+ *
+ * The tables are concatenated, the merged order of the rows of the concatenation is generated by
+ * `generate_k_way_merged_indices()`, and the rows are gathered in that order. Rows of equal keys
+ * are ordered by input table.
+ */
+table_ptr_type k_way_merge(std::vector<table_view> const& tables,
+                           std::vector<cudf::size_type> const& key_cols,
+                           std::vector<cudf::order> const& column_order,
+                           std::vector<cudf::null_order> const& null_precedence,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  std::vector<size_type> offsets{0};
+  for (auto const& tbl : tables) {
+    offsets.push_back(offsets.back() + tbl.num_rows());
   }
 
-  bool operator<(merge_queue_item const& other) const { return priority < other.priority; }
-};
+  auto const concatenated = detail::concatenate(tables, stream, cudf::get_current_temp_resource());
+  auto const keys         = concatenated->view().select(key_cols);
 
-// Helper function to ensure that moving out of the priority_queue is "atomic"
-template <typename T>
-T top_and_pop(std::priority_queue<T>& q)
-{
-  auto moved = std::move(const_cast<T&>(q.top()));
-  q.pop();
-  return moved;
+  auto const merged_indices = generate_k_way_merged_indices(
+    keys, offsets, column_order, null_precedence, cudf::has_nulls(keys), stream);
+
+  return detail::gather(concatenated->view(),
+                        merged_indices.begin(),
+                        merged_indices.end(),
+                        out_of_bounds_policy::DONT_CHECK,
+                        stream,
+                        mr);
 }
 
 }  // namespace
@@ -448,44 +707,29 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   // This utility will ensure all corresponding dictionary columns have matching keys.
   // It will return any new dictionary columns created as well as updated table_views.
   auto matched = cudf::dictionary::detail::match_dictionaries(
-    tables_to_merge, stream, rmm::mr::get_current_device_resource());
+    tables_to_merge, stream, cudf::get_current_temp_resource());
   auto merge_tables = matched.second;
 
-  // A queue of (table view, table) pairs
-  std::priority_queue<merge_queue_item> merge_queue;
-  // The table pointer is null if we do not own the table (input tables)
-  std::for_each(merge_tables.begin(), merge_tables.end(), [&](auto const& table) {
-    if (table.num_rows() > 0) merge_queue.emplace(table, table_ptr_type());
-  });
+  std::vector<table_view> non_empty_tables;
+  std::copy_if(merge_tables.begin(),
+               merge_tables.end(),
+               std::back_inserter(non_empty_tables),
+               [](auto const& tbl) { return tbl.num_rows() > 0; });
 
-  // If there is only one non-empty table_view, return its copy
-  if (merge_queue.size() == 1) { return std::make_unique<cudf::table>(merge_queue.top().view); }
   // No inputs have rows, return a table with same columns as the first one
-  if (merge_queue.empty()) { return empty_like(first_table); }
-
-  // Pick the two smallest tables and merge them
-  // Until there is only one table left in the queue
-  while (merge_queue.size() > 1) {
-    // To delete the intermediate table at the end of the block
-    auto const left_table = top_and_pop(merge_queue);
-    // Deallocated at the end of the block
-    auto const right_table = top_and_pop(merge_queue);
-
-    // Only use mr for the output table
-    auto const& new_tbl_mr = merge_queue.empty() ? mr : rmm::mr::get_current_device_resource();
-    auto merged_table      = merge(left_table.view,
-                              right_table.view,
-                              key_cols,
-                              column_order,
-                              null_precedence,
-                              stream,
-                              new_tbl_mr);
-
-    auto const merged_table_view = merged_table->view();
-    merge_queue.emplace(merged_table_view, std::move(merged_table));
+  if (non_empty_tables.empty()) { return empty_like(first_table); }
+  // If there is only one non-empty table_view, return its copy
+  if (non_empty_tables.size() == 1) { return std::make_unique<cudf::table>(non_empty_tables[0]); }
+  if (non_empty_tables.size() == 2) {
+    return merge(non_empty_tables[0],
+                 non_empty_tables[1],
+                 key_cols,
+                 column_order,
+                 null_precedence,
+                 stream,
+                 mr);
   }
-
-  return std::move(top_and_pop(merge_queue).table);
+  return k_way_merge(non_empty_tables, key_cols, column_order, null_precedence, stream, mr);
 }
 
 }  // namespace detail
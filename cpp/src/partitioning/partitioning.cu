@@ -17,20 +17,36 @@
 #include <cub/cub.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/hashing.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.cuh>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
@@ -39,9 +55,12 @@ constexpr size_type OPTIMIZED_ROWS_PER_THREAD                = 8;
 constexpr size_type ELEMENTS_PER_THREAD                      = 2;
 constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
 
-// Launch configuration for fallback hash partition
-constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
-constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
+// Above the threshold, the rows are partitioned in two levels: first into coarse partitions of
+// up to THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL partitions each, then within each coarse
+// partition, one tile of TWO_LEVEL_TILE_ROWS rows per thread block
+constexpr size_type TWO_LEVEL_TILE_ROWS = OPTIMIZED_BLOCK_SIZE * OPTIMIZED_ROWS_PER_THREAD;
+constexpr size_type MAX_HASH_PARTITIONS =
+  THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL * THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL;
 
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
@@ -88,6 +107,18 @@ class bitwise_partitioner {
   const size_type mask;
 };
 
+/**
+ * @brief Functor returning precomputed hash values of the rows instead of hashing them.
+ */
+struct precomputed_row_hasher {
+  hash_value_type const* row_hashes;
+
+  __device__ hash_value_type operator()(size_type row_index) const
+  {
+    return row_hashes[row_index];
+  }
+};
+
 /**
  * @brief Computes which partition each row of a device_table will belong to
  based on hashing each row, and applying a partition function to the hash value.
@@ -171,58 +202,138 @@ __global__ void compute_row_partition_numbers(row_hasher_t the_hasher,
 }
 
 /**
- * @brief  Given an array of partition numbers, computes the final output
- location for each element in the output such that all rows with the same
- partition are contiguous in memory.
+ * @brief Reads the partition number of each row, so that `compute_row_partition_numbers` groups
+ * rows by a partitioning of their partition numbers.
+ */
+struct partition_number_reader {
+  size_type const* row_partition_numbers;
+
+  __device__ hash_value_type operator()(size_type row) const
+  {
+    return static_cast<hash_value_type>(row_partition_numbers[row]);
+  }
+};
+
+/**
+ * @brief Functor to map the partition number of a row to its coarse partition, when the rows are
+ * partitioned in two levels.
+ */
+class coarse_partitioner {
+ public:
+  coarse_partitioner(size_type partitions_per_coarse) : divisor{partitions_per_coarse} {}
+
+  __device__ size_type operator()(hash_value_type partition_number) const
+  {
+    return static_cast<size_type>(partition_number) / divisor;
+  }
+
+ private:
+  const size_type divisor;
+};
+
+/**
+ * @brief Computes the partition number of each row from the hash value of the row.
+ */
+template <class row_hasher_t, typename partitioner_type>
+struct row_partition_number_fn {
+  row_hasher_t the_hasher;
+  partitioner_type the_partitioner;
+
+  __device__ size_type operator()(size_type row) const { return the_partitioner(the_hasher(row)); }
+};
+
+/**
+ * @brief A tile of the rows of a coarse partition, partitioned by one thread block in the second
+ * level of the two-level partitioning.
  *
- * @param row_partition_numbers The array that records the partition number for
- each row
- * @param num_rows The number of rows
- * @param num_partitions THe number of partitions
- * @param[out] block_partition_offsets Array that holds the offset of each
- partition for each thread block,
- * i.e., { {block0 partition0 offset, block1 partition0 offset, ...},
-         {block0 partition1 offset, block1 partition1 offset, ...},
-         ...
-         {block0 partition(num_partitions-1) offset, block1
- partition(num_partitions -1) offset, ...} }
+ * The sizes of the partitions of all tiles are laid out by coarse partition, then by partition,
+ * then by tile, so that their exclusive scan is the output location of the rows of each partition
+ * of each tile.
+ */
+struct partition_tile {
+  size_type begin;   ///< Position of the first row of the tile, in the coarse partitioned order
+  size_type end;     ///< Position past the last row of the tile
+  size_type slot;    ///< Index of the size of the first partition of the tile
+  size_type stride;  ///< Distance between the sizes of consecutive partitions of the tile
+};
+
+/**
+ * @brief Computes the size of each partition of each tile, and the offset of each row in its
+ * partition of its tile.
+ *
+ * @param tiles The tiles, one for each thread block
+ * @param coarse_gather_map The rows, grouped by coarse partition
+ * @param row_partition_numbers The partition of each row
+ * @param partitions_per_coarse The number of partitions of each coarse partition
+ * @param[out] row_partition_offset The offset of each row in its partition of its tile, indexed by
+ * position in `coarse_gather_map`
+ * @param[out] tile_partition_sizes The size of each partition of each tile, laid out as described
+ * by `partition_tile`
  */
-__global__ void compute_row_output_locations(size_type* __restrict__ row_partition_numbers,
-                                             const size_type num_rows,
-                                             const size_type num_partitions,
-                                             size_type* __restrict__ block_partition_offsets)
+__global__ void compute_tile_partition_sizes(partition_tile const* __restrict__ tiles,
+                                             size_type const* __restrict__ coarse_gather_map,
+                                             size_type const* __restrict__ row_partition_numbers,
+                                             const size_type partitions_per_coarse,
+                                             size_type* __restrict__ row_partition_offset,
+                                             size_type* __restrict__ tile_partition_sizes)
 {
-  // Shared array that holds the offset of this blocks partitions in
-  // global memory
-  extern __shared__ size_type shared_partition_offsets[];
+  extern __shared__ size_type shared_partition_sizes[];
 
-  // Initialize array of this blocks offsets from global array
-  size_type partition_number = threadIdx.x;
-  while (partition_number < num_partitions) {
-    shared_partition_offsets[partition_number] =
-      block_partition_offsets[partition_number * gridDim.x + blockIdx.x];
-    partition_number += blockDim.x;
+  auto const tile = tiles[blockIdx.x];
+
+  for (size_type p = threadIdx.x; p < partitions_per_coarse; p += blockDim.x) {
+    shared_partition_sizes[p] = 0;
   }
+
   __syncthreads();
 
-  size_type row_number = threadIdx.x + blockIdx.x * blockDim.x;
+  for (size_type i = tile.begin + threadIdx.x; i < tile.end; i += blockDim.x) {
+    auto const partition = row_partition_numbers[coarse_gather_map[i]] % partitions_per_coarse;
+    row_partition_offset[i] = atomicAdd(&(shared_partition_sizes[partition]), size_type(1));
+  }
 
-  // Get each row's partition number, and get it's output location by
-  // incrementing block's offset counter for that partition number
-  // and store the row's output location in-place
-  while (row_number < num_rows) {
-    // Get partition number of this row
-    const size_type partition_number = row_partition_numbers[row_number];
+  __syncthreads();
+
+  for (size_type p = threadIdx.x; p < partitions_per_coarse; p += blockDim.x) {
+    tile_partition_sizes[tile.slot + p * tile.stride] = shared_partition_sizes[p];
+  }
+}
+
+/**
+ * @brief Writes each row of each tile to its output location in the gather map of the
+ * partitioned table.
+ *
+ * @param tiles The tiles, one for each thread block
+ * @param coarse_gather_map The rows, grouped by coarse partition
+ * @param row_partition_numbers The partition of each row
+ * @param partitions_per_coarse The number of partitions of each coarse partition
+ * @param row_partition_offset The offset of each row in its partition of its tile
+ * @param scanned_tile_partition_sizes The exclusive scan of the sizes of the partitions of the
+ * tiles
+ * @param[out] gather_map The rows, grouped by partition
+ */
+__global__ void scatter_tile_partitions(partition_tile const* __restrict__ tiles,
+                                        size_type const* __restrict__ coarse_gather_map,
+                                        size_type const* __restrict__ row_partition_numbers,
+                                        const size_type partitions_per_coarse,
+                                        size_type const* __restrict__ row_partition_offset,
+                                        size_type const* __restrict__ scanned_tile_partition_sizes,
+                                        size_type* __restrict__ gather_map)
+{
+  extern __shared__ size_type shared_partition_offsets[];
+
+  auto const tile = tiles[blockIdx.x];
 
-    // Get output location based on partition number by incrementing the
-    // corresponding partition offset for this block
-    const size_type row_output_location =
-      atomicAdd(&(shared_partition_offsets[partition_number]), size_type(1));
+  for (size_type p = threadIdx.x; p < partitions_per_coarse; p += blockDim.x) {
+    shared_partition_offsets[p] = scanned_tile_partition_sizes[tile.slot + p * tile.stride];
+  }
 
-    // Store the row's output location in-place
-    row_partition_numbers[row_number] = row_output_location;
+  __syncthreads();
 
-    row_number += blockDim.x * gridDim.x;
+  for (size_type i = tile.begin + threadIdx.x; i < tile.end; i += blockDim.x) {
+    auto const row       = coarse_gather_map[i];
+    auto const partition = row_partition_numbers[row] % partitions_per_coarse;
+    gather_map[shared_partition_offsets[partition] + row_partition_offset[i]] = row;
   }
 }
 
@@ -444,23 +555,35 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
-// NOTE hash_has_nulls must be true if table_to_hash has nulls
-template <template <typename> class hash_function, bool hash_has_nulls>
-std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
-  table_view const& input,
-  table_view const& table_to_hash,
-  size_type num_partitions,
-  uint32_t seed,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr)
-{
-  auto const num_rows = table_to_hash.num_rows();
+/**
+ * @brief The partition of each row of a table.
+ *
+ * Up to `THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL` partitions, the rows are partitioned by
+ * `compute_row_partition_numbers` with a launch configuration that suits `copy_block_partitions`.
+ * Above it, the rows are partitioned in two levels straight into `gather_map`.
+ */
+struct row_partitions {
+  bool use_optimization;  ///< Whether the launch configuration suits `copy_block_partitions`
+  size_type grid_size;
+  rmm::device_uvector<size_type> row_partition_numbers;
+  rmm::device_uvector<size_type> row_partition_offset;
+  rmm::device_uvector<size_type> block_partition_sizes;
+  rmm::device_uvector<size_type> scanned_block_partition_sizes;
+  // The offset of each partition, copied asynchronously to the host
+  std::vector<size_type> partition_offsets;
+  // The rows grouped by partition, if they were partitioned in two levels
+  rmm::device_uvector<size_type> gather_map;
+};
 
-  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
-  auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
-  auto const rows_per_thread =
-    use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
-  auto const rows_per_block = block_size * rows_per_thread;
+template <class row_hasher_t, typename partitioner_type>
+row_partitions compute_block_row_partitions(row_hasher_t const& hasher,
+                                            size_type num_rows,
+                                            size_type num_partitions,
+                                            partitioner_type const& partitioner,
+                                            rmm::cuda_stream_view stream)
+{
+  auto const block_size     = OPTIMIZED_BLOCK_SIZE;
+  auto const rows_per_block = block_size * OPTIMIZED_ROWS_PER_THREAD;
 
   // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
   auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
@@ -486,52 +609,21 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   auto row_partition_offset =
     cudf::detail::make_zeroed_device_uvector_async<size_type>(num_rows, stream);
 
-  auto const device_input = table_device_view::create(table_to_hash, stream);
-  auto const hasher       = row_hasher<hash_function, hash_has_nulls>(*device_input, seed);
-
-  // If the number of partitions is a power of two, we can compute the partition
-  // number of each row more efficiently with bitwise operations
-  if (is_power_two(num_partitions)) {
-    // Determines how the mapping between hash value and partition number is
-    // computed
-    using partitioner_type = bitwise_partitioner<hash_value_type>;
-
-    // Computes which partition each row belongs to by hashing the row and
-    // performing a partitioning operator on the hash value. Also computes the
-    // number of rows in each partition both for each thread block as well as
-    // across all blocks
-    compute_row_partition_numbers<<<grid_size,
-                                    block_size,
-                                    num_partitions * sizeof(size_type),
-                                    stream.value()>>>(hasher,
-                                                      num_rows,
-                                                      num_partitions,
-                                                      partitioner_type(num_partitions),
-                                                      row_partition_numbers.data(),
-                                                      row_partition_offset.data(),
-                                                      block_partition_sizes.data(),
-                                                      global_partition_sizes.data());
-  } else {
-    // Determines how the mapping between hash value and partition number is
-    // computed
-    using partitioner_type = modulo_partitioner<hash_value_type>;
-
-    // Computes which partition each row belongs to by hashing the row and
-    // performing a partitioning operator on the hash value. Also computes the
-    // number of rows in each partition both for each thread block as well as
-    // across all blocks
-    compute_row_partition_numbers<<<grid_size,
-                                    block_size,
-                                    num_partitions * sizeof(size_type),
-                                    stream.value()>>>(hasher,
-                                                      num_rows,
-                                                      num_partitions,
-                                                      partitioner_type(num_partitions),
-                                                      row_partition_numbers.data(),
-                                                      row_partition_offset.data(),
-                                                      block_partition_sizes.data(),
-                                                      global_partition_sizes.data());
-  }
+  // Computes which partition each row belongs to by hashing the row and
+  // performing a partitioning operator on the hash value. Also computes the
+  // number of rows in each partition both for each thread block as well as
+  // across all blocks
+  compute_row_partition_numbers<<<grid_size,
+                                  block_size,
+                                  num_partitions * sizeof(size_type),
+                                  stream.value()>>>(hasher,
+                                                    num_rows,
+                                                    num_partitions,
+                                                    partitioner,
+                                                    row_partition_numbers.data(),
+                                                    row_partition_offset.data(),
+                                                    block_partition_sizes.data(),
+                                                    global_partition_sizes.data());
 
   // Compute exclusive scan of all blocks' partition sizes in-place to determine
   // the starting point for each blocks portion of each partition in the output
@@ -550,13 +642,205 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
 
   // Copy the result of the exclusive scan to the output offsets array
   // to indicate the starting point for each partition in the output
-  auto const partition_offsets =
-    cudf::detail::make_std_vector_async(global_partition_sizes, stream);
+  auto partition_offsets = cudf::detail::make_std_vector_async(global_partition_sizes, stream);
+
+  return row_partitions{true,
+                        grid_size,
+                        std::move(row_partition_numbers),
+                        std::move(row_partition_offset),
+                        std::move(block_partition_sizes),
+                        std::move(scanned_block_partition_sizes),
+                        std::move(partition_offsets),
+                        rmm::device_uvector<size_type>(0, stream)};
+}
+
+/**
+ * @brief Partitions the rows in two levels, for more partitions than the shared memory histogram
+ * of `compute_row_partition_numbers` can hold.
+ *
+ * The rows are first grouped into coarse partitions of consecutive partitions, with the
+ * block-wise histograms of `compute_block_row_partitions`. Each coarse partition is then cut into
+ * tiles of `TWO_LEVEL_TILE_ROWS` rows, which are partitioned by one thread block each with a
+ * shared memory histogram of the partitions of their coarse partition. Both levels thus keep
+ * their histograms in shared memory, and the per-block sizes are of `partitions_per_coarse`
+ * partitions rather than `num_partitions`.
+ */
+template <class row_hasher_t, typename partitioner_type>
+row_partitions compute_two_level_row_partitions(row_hasher_t const& hasher,
+                                                size_type num_rows,
+                                                size_type num_partitions,
+                                                partitioner_type const& partitioner,
+                                                rmm::cuda_stream_view stream)
+{
+  // Spread the partitions evenly over the fewest coarse partitions
+  auto const partitions_per_coarse = util::div_rounding_up_safe(
+    num_partitions,
+    util::div_rounding_up_safe(num_partitions, THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL));
+  auto const num_coarse = util::div_rounding_up_safe(num_partitions, partitions_per_coarse);
+
+  auto row_partition_numbers = rmm::device_uvector<size_type>(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    row_partition_numbers.begin(),
+                    row_partition_number_fn<row_hasher_t, partitioner_type>{hasher, partitioner});
+
+  // First level: group the rows by coarse partition
+  auto coarse = compute_block_row_partitions(partition_number_reader{row_partition_numbers.data()},
+                                             num_rows,
+                                             num_coarse,
+                                             coarse_partitioner{partitions_per_coarse},
+                                             stream);
+  auto const coarse_gather_map = compute_gather_map(num_rows,
+                                                    num_coarse,
+                                                    coarse.row_partition_numbers.data(),
+                                                    coarse.row_partition_offset.data(),
+                                                    coarse.block_partition_sizes.data(),
+                                                    coarse.scanned_block_partition_sizes.data(),
+                                                    coarse.grid_size,
+                                                    stream);
+  stream.synchronize();  // Async D2H copy of the coarse partition offsets must finish
+
+  // Second level: cut each coarse partition into tiles
+  std::vector<partition_tile> tiles;
+  size_type num_tile_partitions = 0;
+  auto const& coarse_offsets    = coarse.partition_offsets;
+  for (size_type c = 0; c < num_coarse; ++c) {
+    auto const begin     = coarse_offsets[c];
+    auto const end       = c + 1 < num_coarse ? coarse_offsets[c + 1] : num_rows;
+    auto const num_tiles = util::div_rounding_up_safe(end - begin, TWO_LEVEL_TILE_ROWS);
+    for (size_type t = 0; t < num_tiles; ++t) {
+      tiles.push_back(partition_tile{begin + t * TWO_LEVEL_TILE_ROWS,
+                                     begin + std::min(end - begin, (t + 1) * TWO_LEVEL_TILE_ROWS),
+                                     num_tile_partitions + t,
+                                     num_tiles});
+    }
+    num_tile_partitions += num_tiles * partitions_per_coarse;
+  }
+  auto const d_tiles   = cudf::detail::make_device_uvector_async(tiles, stream);
+  auto const num_tiles = static_cast<size_type>(tiles.size());
+  auto const smem      = partitions_per_coarse * sizeof(size_type);
+
+  // The offsets of the rows in their coarse partition are no longer needed
+  auto& row_partition_offset = coarse.row_partition_offset;
+  auto tile_partition_sizes  = rmm::device_uvector<size_type>(num_tile_partitions, stream);
+  compute_tile_partition_sizes<<<num_tiles, OPTIMIZED_BLOCK_SIZE, smem, stream.value()>>>(
+    d_tiles.data(),
+    coarse_gather_map.data(),
+    row_partition_numbers.data(),
+    partitions_per_coarse,
+    row_partition_offset.data(),
+    tile_partition_sizes.data());
+
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         tile_partition_sizes.begin(),
+                         tile_partition_sizes.end(),
+                         tile_partition_sizes.begin());
+
+  auto gather_map = rmm::device_uvector<size_type>(num_rows, stream);
+  scatter_tile_partitions<<<num_tiles, OPTIMIZED_BLOCK_SIZE, smem, stream.value()>>>(
+    d_tiles.data(),
+    coarse_gather_map.data(),
+    row_partition_numbers.data(),
+    partitions_per_coarse,
+    row_partition_offset.data(),
+    tile_partition_sizes.data(),
+    gather_map.data());
+
+  // The rows are now grouped by partition, so the offset of each partition is the first position
+  // of a row of the partition
+  auto const partitioned_numbers =
+    thrust::make_permutation_iterator(row_partition_numbers.begin(), gather_map.begin());
+  auto partition_offsets = rmm::device_uvector<size_type>(num_partitions, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      partitioned_numbers,
+                      partitioned_numbers + num_rows,
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_partitions),
+                      partition_offsets.begin());
+
+  return row_partitions{false,
+                        0,
+                        std::move(row_partition_numbers),
+                        rmm::device_uvector<size_type>(0, stream),
+                        rmm::device_uvector<size_type>(0, stream),
+                        rmm::device_uvector<size_type>(0, stream),
+                        cudf::detail::make_std_vector_async(partition_offsets, stream),
+                        std::move(gather_map)};
+}
+
+template <class row_hasher_t, typename partitioner_type>
+row_partitions partition_hashed_rows(row_hasher_t const& hasher,
+                                     size_type num_rows,
+                                     size_type num_partitions,
+                                     partitioner_type const& partitioner,
+                                     rmm::cuda_stream_view stream)
+{
+  if (num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL) {
+    return compute_block_row_partitions(hasher, num_rows, num_partitions, partitioner, stream);
+  }
+  return compute_two_level_row_partitions(hasher, num_rows, num_partitions, partitioner, stream);
+}
+
+template <class row_hasher_t>
+row_partitions compute_row_partitions(row_hasher_t const& hasher,
+                                      size_type num_rows,
+                                      size_type num_partitions,
+                                      rmm::cuda_stream_view stream)
+{
+  // If the number of partitions is a power of two, we can compute the partition
+  // number of each row more efficiently with bitwise operations
+  if (is_power_two(num_partitions)) {
+    return partition_hashed_rows(hasher,
+                                 num_rows,
+                                 num_partitions,
+                                 bitwise_partitioner<hash_value_type>(num_partitions),
+                                 stream);
+  }
+  return partition_hashed_rows(
+    hasher, num_rows, num_partitions, modulo_partitioner<hash_value_type>(num_partitions), stream);
+}
+
+// NOTE hash_has_nulls must be true if table_to_hash has nulls
+template <template <typename> class hash_function, bool hash_has_nulls>
+row_partitions compute_row_partitions(table_view const& table_to_hash,
+                                      size_type num_partitions,
+                                      uint32_t seed,
+                                      rmm::cuda_stream_view stream)
+{
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  return compute_row_partitions(row_hasher<hash_function, hash_has_nulls>(*device_input, seed),
+                                table_to_hash.num_rows(),
+                                num_partitions,
+                                stream);
+}
+
+/**
+ * @brief Returns the rows of `input` grouped by partition, and the offsets of the partitions.
+ *
+ * @param input The table to partition
+ * @param partitions The partitions of the rows of `input`
+ * @param num_partitions The number of partitions
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> partition_table(
+  table_view const& input,
+  row_partitions partitions,
+  size_type num_partitions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows  = input.num_rows();
+  auto const grid_size                = partitions.grid_size;
+  auto& row_partition_numbers         = partitions.row_partition_numbers;
+  auto& row_partition_offset          = partitions.row_partition_offset;
+  auto& block_partition_sizes         = partitions.block_partition_sizes;
+  auto& scanned_block_partition_sizes = partitions.scanned_block_partition_sizes;
+  auto& partition_offsets             = partitions.partition_offsets;
 
   // When the number of partitions is less than a threshold, we can apply an
   // optimization using shared memory to copy values to the output buffer.
-  // Otherwise, fallback to using scatter.
-  if (use_optimization) {
+  // Otherwise, gather the rows in the order of the two-level partitioning.
+  if (partitions.use_optimization) {
     std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
 
     // Copy input to output by partition per column
@@ -594,25 +878,245 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
     return std::make_pair(std::make_unique<table>(std::move(output_cols)),
                           std::move(partition_offsets));
   } else {
-    // Compute a scatter map from input to output such that the output rows are
-    // sorted by partition number
-    auto row_output_locations{row_partition_numbers.data()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data()};
-    compute_row_output_locations<<<grid_size,
-                                   block_size,
-                                   num_partitions * sizeof(size_type),
-                                   stream.value()>>>(
-      row_output_locations, num_rows, num_partitions, scanned_block_partition_sizes_ptr);
-
-    // Use the resulting scatter map to materialize the output
-    auto output = detail::scatter(
-      input, row_partition_numbers.begin(), row_partition_numbers.end(), input, false, stream, mr);
+    auto output = detail::gather(input,
+                                 partitions.gather_map.begin(),
+                                 partitions.gather_map.end(),
+                                 out_of_bounds_policy::DONT_CHECK,
+                                 stream,
+                                 mr);
 
     stream.synchronize();  // Async D2H copy must finish before returning host vec
     return std::make_pair(std::move(output), std::move(partition_offsets));
   }
 }
 
+/**
+ * @brief Returns the gather map of the partitioned table, whose rows are grouped by partition.
+ */
+rmm::device_uvector<size_type> compute_partition_gather_map(row_partitions& partitions,
+                                                            size_type num_rows,
+                                                            size_type num_partitions,
+                                                            rmm::cuda_stream_view stream)
+{
+  if (partitions.use_optimization) {
+    return compute_gather_map(num_rows,
+                              num_partitions,
+                              partitions.row_partition_numbers.data(),
+                              partitions.row_partition_offset.data(),
+                              partitions.block_partition_sizes.data(),
+                              partitions.scanned_block_partition_sizes.data(),
+                              partitions.grid_size,
+                              stream);
+  }
+  return std::move(partitions.gather_map);
+}
+
+/**
+ * @brief Returns the partition of an element, such as a row of the partitioned table, given the
+ * offset of the first element of each partition.
+ */
+struct partition_of_fn {
+  size_type const* partition_offsets;
+  size_type num_partitions;
+
+  __device__ size_type operator()(size_type index) const
+  {
+    auto const end = partition_offsets + num_partitions;
+    auto const it  = thrust::upper_bound(thrust::seq, partition_offsets, end, index);
+    return static_cast<size_type>(thrust::distance(partition_offsets, it)) - 1;
+  }
+};
+
+/**
+ * @brief Gathers the data of a fixed-width column straight into the buffer of each partition.
+ */
+struct gather_into_partitions_fn {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  size_type const* gather_map,
+                  partition_of_fn partition_of_row,
+                  uint8_t* const* partition_data,
+                  rmm::cuda_stream_view stream)
+  {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       input.size(),
+                       [d_input = input.data<T>(),
+                        gather_map,
+                        partition_of_row,
+                        partition_data] __device__(size_type row) {
+                         auto const partition = partition_of_row(row);
+                         auto const output    = reinterpret_cast<T*>(partition_data[partition]);
+                         output[row - partition_of_row.partition_offsets[partition]] =
+                           d_input[gather_map[row]];
+                       });
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const&,
+                  size_type const*,
+                  partition_of_fn,
+                  uint8_t* const*,
+                  rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Only fixed-width columns are gathered into partition buffers");
+  }
+};
+
+/**
+ * @brief Gathers the null mask of a column straight into the buffer of each partition, and
+ * counts the valid rows of each partition.
+ *
+ * @param row_offsets The offset of the first row of each partition, with the number of rows at
+ * the end
+ * @param word_offsets The offset of the first bitmask word of each partition, with the number of
+ * words at the end
+ */
+void gather_bitmask_into_partitions(column_view const& input,
+                                    size_type const* gather_map,
+                                    rmm::device_uvector<size_type> const& row_offsets,
+                                    rmm::device_uvector<size_type> const& word_offsets,
+                                    bitmask_type* const* partition_masks,
+                                    size_type* valid_counts,
+                                    rmm::cuda_stream_view stream)
+{
+  auto const num_partitions = static_cast<size_type>(word_offsets.size()) - 1;
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    word_offsets.back_element(stream),
+    [d_input           = input.null_mask(),
+     offset            = input.offset(),
+     gather_map,
+     d_row_offsets     = row_offsets.data(),
+     partition_of_word = partition_of_fn{word_offsets.data(), num_partitions},
+     partition_masks,
+     valid_counts] __device__(size_type word_index) {
+      constexpr size_type word_size{detail::size_in_bits<bitmask_type>()};
+      auto const partition = partition_of_word(word_index);
+      auto const word      = word_index - partition_of_word.partition_offsets[partition];
+      auto const begin     = d_row_offsets[partition] + word * word_size;
+      auto const num_bits  = thrust::min(word_size, d_row_offsets[partition + 1] - begin);
+      bitmask_type mask    = 0;
+      for (size_type bit = 0; bit < num_bits; ++bit) {
+        if (bit_is_set(d_input, offset + gather_map[begin + bit])) {
+          mask |= bitmask_type{1} << bit;
+        }
+      }
+      partition_masks[partition][word] = mask;
+      atomicAdd(&valid_counts[partition], __popc(mask));
+    });
+}
+
+/**
+ * @brief Partitions the rows of a table of fixed-width columns, and gathers them straight into a
+ * contiguous buffer for each partition with the layout of `contiguous_split`.
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::vector<packed_table> hash_partition_and_pack_table(table_view const& input,
+                                                        table_view const& table_to_hash,
+                                                        size_type num_partitions,
+                                                        uint32_t seed,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows    = input.num_rows();
+  auto const num_columns = input.num_columns();
+  auto partitions        = compute_row_partitions<hash_function, hash_has_nulls>(
+    table_to_hash, num_partitions, seed, stream);
+  auto const gather_map =
+    compute_partition_gather_map(partitions, num_rows, num_partitions, stream);
+  stream.synchronize();  // Async D2H copy of the partition offsets must finish
+
+  // Lay out every partition like `contiguous_split`: the null mask, if any, then the data of each
+  // column, each aligned to 64 bytes
+  auto row_offsets = std::move(partitions.partition_offsets);
+  row_offsets.push_back(num_rows);
+  std::vector<size_type> word_offsets{0};
+  std::vector<rmm::device_buffer> buffers;
+  buffers.reserve(num_partitions);
+  std::vector<uint8_t*> partition_data(num_partitions * num_columns, nullptr);
+  std::vector<bitmask_type*> partition_masks(num_partitions * num_columns, nullptr);
+  for (size_type partition = 0; partition < num_partitions; ++partition) {
+    auto const partition_rows = row_offsets[partition + 1] - row_offsets[partition];
+    word_offsets.push_back(word_offsets.back() + num_bitmask_words(partition_rows));
+
+    std::vector<std::size_t> column_offsets;
+    std::size_t size = 0;
+    for (auto const& col : input) {
+      if (col.nullable()) {
+        column_offsets.push_back(size);
+        size += bitmask_allocation_size_bytes(partition_rows);
+      }
+      column_offsets.push_back(size);
+      size += util::round_up_safe(partition_rows * size_of(col.type()), std::size_t{64});
+    }
+    buffers.emplace_back(size, stream, mr);
+    if (partition_rows == 0) { continue; }
+
+    auto const base = static_cast<uint8_t*>(buffers.back().data());
+    auto offset     = column_offsets.begin();
+    for (size_type c = 0; c < num_columns; ++c) {
+      if (input.column(c).nullable()) {
+        partition_masks[c * num_partitions + partition] =
+          reinterpret_cast<bitmask_type*>(base + *offset++);
+      }
+      partition_data[c * num_partitions + partition] = base + *offset++;
+    }
+  }
+
+  auto const d_row_offsets     = detail::make_device_uvector_async(row_offsets, stream);
+  auto const d_word_offsets    = detail::make_device_uvector_async(word_offsets, stream);
+  auto const d_partition_data  = detail::make_device_uvector_async(partition_data, stream);
+  auto const d_partition_masks = detail::make_device_uvector_async(partition_masks, stream);
+  auto d_valid_counts =
+    detail::make_zeroed_device_uvector_async<size_type>(num_partitions * num_columns, stream);
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const& col = input.column(c);
+    type_dispatcher<dispatch_storage_type>(col.type(),
+                                           gather_into_partitions_fn{},
+                                           col,
+                                           gather_map.data(),
+                                           partition_of_fn{d_row_offsets.data(), num_partitions},
+                                           d_partition_data.data() + c * num_partitions,
+                                           stream);
+    if (col.nullable()) {
+      gather_bitmask_into_partitions(col,
+                                     gather_map.data(),
+                                     d_row_offsets,
+                                     d_word_offsets,
+                                     d_partition_masks.data() + c * num_partitions,
+                                     d_valid_counts.data() + c * num_partitions,
+                                     stream);
+    }
+  }
+  auto const valid_counts = detail::make_std_vector_sync(d_valid_counts, stream);
+
+  std::vector<packed_table> result;
+  result.reserve(num_partitions);
+  for (size_type partition = 0; partition < num_partitions; ++partition) {
+    auto const partition_rows = row_offsets[partition + 1] - row_offsets[partition];
+    std::vector<column_view> columns;
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const index      = c * num_partitions + partition;
+      auto const null_count = input.column(c).nullable() ? partition_rows - valid_counts[index] : 0;
+      columns.emplace_back(input.column(c).type(),
+                           partition_rows,
+                           partition_data[index],
+                           partition_masks[index],
+                           null_count);
+    }
+    table_view const partition_table{columns};
+    auto& buffer = buffers[partition];
+    result.push_back(packed_table{
+      partition_table,
+      packed_columns{std::make_unique<packed_columns::metadata>(pack_metadata(
+                       partition_table, static_cast<uint8_t const*>(buffer.data()), buffer.size())),
+                     std::make_unique<rmm::device_buffer>(std::move(buffer))}});
+  }
+  return result;
+}
+
 struct dispatch_map_type {
   /**
    * @brief Partitions the table `t` according to the `partition_map`.
@@ -711,6 +1215,36 @@ struct dispatch_map_type {
     CUDF_FAIL("Unexpected, non-integral partition map.");
   }
 };
+
+// Number of sampled rows per partition from which range_partition picks its splitters
+constexpr size_type RANGE_PARTITION_SAMPLES_PER_PARTITION = 32;
+
+/**
+ * @brief Maps the `i`th of `num_samples` sampled rows to evenly spaced rows of the table.
+ */
+struct sample_row_fn {
+  size_type num_rows;
+  size_type num_samples;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return static_cast<size_type>((static_cast<int64_t>(i) * num_rows) / num_samples);
+  }
+};
+
+/**
+ * @brief Maps the splitter ending the `i`th of `num_partitions` partitions to its position in the
+ * sorted sample.
+ */
+struct splitter_row_fn {
+  size_type num_samples;
+  size_type num_partitions;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return static_cast<size_type>((static_cast<int64_t>(i + 1) * num_samples) / num_partitions);
+  }
+};
 }  // namespace
 
 namespace detail {
@@ -724,6 +1258,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
+  CUDF_EXPECTS(num_partitions <= MAX_HASH_PARTITIONS, "Too many partitions");
   auto table_to_hash = input.select(columns_to_hash);
 
   // Return empty result if there are no partitions or nothing to hash
@@ -731,11 +1266,71 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
     return std::make_pair(empty_like(input), std::vector<size_type>{});
   }
 
+  auto partitions = has_nulls(table_to_hash)
+                      ? compute_row_partitions<hash_function, true>(
+                          table_to_hash, num_partitions, seed, stream)
+                      : compute_row_partitions<hash_function, false>(
+                          table_to_hash, num_partitions, seed, stream);
+  return partition_table(input, std::move(partitions), num_partitions, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions <= MAX_HASH_PARTITIONS, "Too many partitions");
+  cudf::detail::expects_row_hashes(row_hashes, input.num_rows());
+
+  // Return empty result if there are no partitions or nothing to partition
+  if (num_partitions <= 0 || input.num_rows() == 0) {
+    return std::make_pair(empty_like(input), std::vector<size_type>{});
+  }
+
+  auto const hasher = precomputed_row_hasher{row_hashes.data<hash_value_type>()};
+  auto partitions   = compute_row_partitions(hasher, input.num_rows(), num_partitions, stream);
+  return partition_table(input, std::move(partitions), num_partitions, stream, mr);
+}
+
+template <template <typename> class hash_function>
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions <= MAX_HASH_PARTITIONS, "Too many partitions");
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || table_to_hash.num_columns() == 0) { return {}; }
+
+  if (input.num_rows() == 0) {
+    return detail::contiguous_split(
+      input, std::vector<size_type>(num_partitions - 1, 0), stream, mr);
+  }
+
+  auto const all_fixed_width = std::all_of(
+    input.begin(), input.end(), [](auto const& col) { return is_fixed_width(col.type()); });
+  if (not all_fixed_width) {
+    // Other columns are partitioned first and then split
+    auto const partitioned = hash_partition<hash_function>(
+      input, columns_to_hash, num_partitions, seed, stream, cudf::get_current_temp_resource());
+    auto const& offsets = partitioned.second;
+    return detail::contiguous_split(partitioned.first->view(),
+                                    std::vector<size_type>(offsets.begin() + 1, offsets.end()),
+                                    stream,
+                                    mr);
+  }
+
   if (has_nulls(table_to_hash)) {
-    return hash_partition_table<hash_function, true>(
+    return hash_partition_and_pack_table<hash_function, true>(
       input, table_to_hash, num_partitions, seed, stream, mr);
   } else {
-    return hash_partition_table<hash_function, false>(
+    return hash_partition_and_pack_table<hash_function, false>(
       input, table_to_hash, num_partitions, seed, stream, mr);
   }
 }
@@ -759,6 +1354,68 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return cudf::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, stream, mr);
 }
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  size_type num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == key_columns.size(),
+               "Mismatch between number of key columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == key_columns.size(),
+               "Mismatch between number of key columns and null_precedence size.");
+
+  if (num_partitions <= 0 or input.num_rows() == 0) {
+    return std::make_pair(empty_like(input), std::vector<size_type>{});
+  }
+  if (key_columns.empty() or num_partitions == 1) {
+    // All the rows are in the first partition
+    std::vector<size_type> offsets(num_partitions + 1, input.num_rows());
+    offsets.front() = 0;
+    return std::make_pair(std::make_unique<table>(input, stream, mr), std::move(offsets));
+  }
+
+  // lower_bound requires the order of every key column
+  auto const orders =
+    column_order.empty() ? std::vector<order>(key_columns.size(), order::ASCENDING) : column_order;
+  auto const nulls = null_precedence.empty()
+                       ? std::vector<null_order>(key_columns.size(), null_order::BEFORE)
+                       : null_precedence;
+
+  auto const keys        = input.select(key_columns);
+  auto const num_rows    = input.num_rows();
+  auto const num_samples = static_cast<size_type>(std::min<int64_t>(
+    num_rows, static_cast<int64_t>(num_partitions) * RANGE_PARTITION_SAMPLES_PER_PARTITION));
+
+  // Sample evenly spaced rows, and pick the splitters at evenly spaced positions of the sorted
+  // sample
+  auto const sample_map =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    sample_row_fn{num_rows, num_samples});
+  auto const sample = detail::gather(
+    keys, sample_map, sample_map + num_samples, out_of_bounds_policy::DONT_CHECK, stream);
+  auto const sample_order = detail::sorted_order(sample->view(), orders, nulls, stream);
+  auto const splitter_map = thrust::make_permutation_iterator(
+    sample_order->view().begin<size_type>(),
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    splitter_row_fn{num_samples, num_partitions}));
+  auto const splitters = detail::gather(sample->view(),
+                                        splitter_map,
+                                        splitter_map + (num_partitions - 1),
+                                        out_of_bounds_policy::DONT_CHECK,
+                                        stream);
+
+  // A row belongs to the partition of the first splitter that is not less than the row, so that
+  // equal rows are in the same partition
+  auto const partition_map =
+    detail::lower_bound(splitters->view(), keys, orders, nulls, sorted::NO, stream);
+
+  return detail::partition(input, partition_map->view(), num_partitions, stream, mr);
+}
 }  // namespace detail
 
 // Partition based on hash values
@@ -788,6 +1445,44 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   }
 }
 
+// Partition based on precomputed hash values
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::local::hash_partition(input, row_hashes, num_partitions, stream, mr);
+}
+
+// Partition based on hash values, into packed partitions
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  hash_id hash_function,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  switch (hash_function) {
+    case (hash_id::HASH_IDENTITY):
+      for (const size_type& column_id : columns_to_hash) {
+        if (!is_numeric(input.column(column_id).type()))
+          CUDF_FAIL("IdentityHash does not support this data type");
+      }
+      return detail::local::hash_partition_and_pack<IdentityHash>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3):
+      return detail::local::hash_partition_and_pack<MurmurHash3_32>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    default: CUDF_FAIL("Unsupported hash function in hash_partition_and_pack");
+  }
+}
+
 // Partition based on an explicit partition map
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
@@ -799,4 +1494,23 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return detail::partition(t, partition_map, num_partitions, rmm::cuda_stream_default, mr);
 }
 
+// Partition based on sampled ranges of the keys
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  size_type num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(input,
+                                 key_columns,
+                                 num_partitions,
+                                 column_order,
+                                 null_precedence,
+                                 rmm::cuda_stream_default,
+                                 mr);
+}
+
 }  // namespace cudf
@@ -17,19 +17,27 @@
 #include <quantiles/quantiles_util.hpp>
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/iterator.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -67,7 +75,7 @@ struct quantile_functor {
 
     if (output->size() == 0) { return output; }
 
-    if (input.is_empty()) {
+    if (input.is_empty() or size == 0) {
       auto mask = cudf::detail::create_null_mask(output->size(), mask_state::ALL_NULL, stream, mr);
       output->set_null_mask(std::move(mask), output->size());
       return output;
@@ -171,8 +179,152 @@ std::unique_ptr<column> quantile(column_view const& input,
   }
 }
 
+namespace {
+
+/**
+ * @brief Computes the quantiles of the `size` valid values of `input` ordered by
+ * `ordered_indices`.
+ */
+template <typename SortMapIterator>
+std::unique_ptr<column> valid_quantile(column_view const& input,
+                                       SortMapIterator ordered_indices,
+                                       size_type size,
+                                       std::vector<double> const& q,
+                                       interpolation interp,
+                                       bool exact,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  return exact ? quantile<true>(input, ordered_indices, size, q, interp, exact, stream, mr)
+               : quantile<false>(input, ordered_indices, size, q, interp, exact, stream, mr);
+}
+
+/**
+ * @brief Indicates whether the columns of a type are sorted together by concatenating them.
+ */
+bool is_sorted_together(data_type type)
+{
+  return is_fixed_width(type) and not is_dictionary(type) and
+         (is_numeric(type) or is_fixed_point(type));
+}
+
+}  // namespace
+
+std::unique_ptr<table> quantile(table_view const& input,
+                                std::vector<double> const& q,
+                                interpolation interp,
+                                cudf::sorted is_input_sorted,
+                                std::vector<null_order> const& null_precedence,
+                                bool exact,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(null_precedence.empty() or
+                 null_precedence.size() == static_cast<std::size_t>(input.num_columns()),
+               "Mismatch between number of columns and null_precedence size.");
+
+  std::vector<std::unique_ptr<column>> results(input.num_columns());
+  auto const num_rows = input.num_rows();
+
+  // the valid values of a sorted column are a range of its rows
+  if (is_input_sorted == sorted::YES) {
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      auto const col = input.column(i);
+      auto const nulls_after =
+        not null_precedence.empty() and null_precedence[i] == null_order::AFTER;
+      auto const first_valid = nulls_after ? 0 : col.null_count();
+
+      results[i] = valid_quantile(col,
+                                  thrust::make_counting_iterator<size_type>(first_valid),
+                                  col.size() - col.null_count(),
+                                  q,
+                                  interp,
+                                  exact,
+                                  stream,
+                                  mr);
+    }
+    return std::make_unique<table>(std::move(results));
+  }
+
+  // The columns of the same numeric or decimal type are concatenated and sorted together, as
+  // many as fit in one column, every column being a segment whose nulls are sorted last
+  std::map<std::pair<type_id, int32_t>, std::vector<size_type>> columns_by_type;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const type = input.column(i).type();
+    if (is_sorted_together(type)) {
+      columns_by_type[{type.id(), type.scale()}].push_back(i);
+    } else {
+      auto const col          = input.column(i);
+      auto const sorted_order = detail::sorted_order(
+        table_view{{col}}, {}, {null_order::AFTER}, stream, cudf::get_current_temp_resource());
+      results[i] = valid_quantile(col,
+                                  sorted_order->view().begin<size_type>(),
+                                  col.size() - col.null_count(),
+                                  q,
+                                  interp,
+                                  exact,
+                                  stream,
+                                  mr);
+    }
+  }
+
+  auto const max_columns_per_sort = static_cast<std::size_t>(
+    std::max(size_type{1}, std::numeric_limits<size_type>::max() / std::max(num_rows, 1)));
+  for (auto const& type_columns : columns_by_type) {
+    auto const& indices = type_columns.second;
+    for (std::size_t begin = 0; begin < indices.size(); begin += max_columns_per_sort) {
+      auto const end = std::min(indices.size(), begin + max_columns_per_sort);
+      std::vector<column_view> columns;
+      std::vector<size_type> h_offsets{0};
+      for (auto idx = begin; idx < end; ++idx) {
+        columns.push_back(input.column(indices[idx]));
+        h_offsets.push_back(h_offsets.back() + num_rows);
+      }
+      auto const values    = concatenate(columns, stream);
+      auto const d_offsets = make_device_uvector_async(h_offsets, stream);
+      auto const offsets   = column_view(data_type{type_to_id<size_type>()},
+                                       static_cast<size_type>(d_offsets.size()),
+                                       d_offsets.data());
+
+      auto const sorted_order = segmented_sorted_order(table_view{{values->view()}},
+                                                       offsets,
+                                                       {order::ASCENDING},
+                                                       {null_order::AFTER},
+                                                       stream,
+                                                       cudf::get_current_temp_resource());
+      for (auto idx = begin; idx < end; ++idx) {
+        auto const col = input.column(indices[idx]);
+
+        results[indices[idx]] =
+          valid_quantile(values->view(),
+                         sorted_order->view().begin<size_type>() + h_offsets[idx - begin],
+                         col.size() - col.null_count(),
+                         q,
+                         interp,
+                         exact,
+                         stream,
+                         mr);
+      }
+    }
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
 }  // namespace detail
 
+std::unique_ptr<table> quantile(table_view const& input,
+                                std::vector<double> const& q,
+                                interpolation interp,
+                                cudf::sorted is_input_sorted,
+                                std::vector<null_order> const& null_precedence,
+                                bool exact,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::quantile(
+    input, q, interp, is_input_sorted, null_precedence, exact, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> quantile(column_view const& input,
                                  std::vector<double> const& q,
                                  interpolation interp,
@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+#include <thrust/tuple.h>
+
+#include <cmath>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the index of the centroid of a digest that an element is merged into.
+ *
+ * The first and last elements of a group make centroids of their own, so that a digest holds the
+ * minimum and maximum of its values. The other elements are bucketed by the `k1` scale function
+ * of the quantile of their cumulative weight, `asin(2q - 1)`, whose steep slope at the tails
+ * makes the centroids there smaller than the ones near the median.
+ */
+struct centroid_index_fn {
+  size_type const* labels;
+  size_type const* group_offsets;
+  double const* cumulative_weights;
+  double const* weights;
+  int num_buckets;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    auto const group = labels[i];
+    auto const first = group_offsets[group];
+    auto const last  = group_offsets[group + 1] - 1;
+    if (i == first) { return 0; }
+    if (i == last) { return num_buckets + 1; }
+
+    auto const total  = cumulative_weights[last] + weights[last];
+    auto const q      = cumulative_weights[i] / total;
+    auto const bucket = static_cast<int>((asin(2.0 * q - 1.0) / M_PI + 0.5) * num_buckets);
+    return 1 + min(bucket, num_buckets - 1);
+  }
+};
+
+using weighted_mean = thrust::tuple<double, double>;
+
+/**
+ * @brief Adds the weighted sums and the weights of the elements of a centroid.
+ */
+struct add_weighted_means {
+  __device__ weighted_mean operator()(weighted_mean const& lhs, weighted_mean const& rhs) const
+  {
+    return weighted_mean{thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                         thrust::get<1>(lhs) + thrust::get<1>(rhs)};
+  }
+};
+
+/**
+ * @brief Merges the weighted elements of every group into the centroids of a t-digest.
+ *
+ * @param labels The group of every element, sorted
+ * @param means The value of every element, sorted within every group
+ * @param weights The weight of every element
+ * @return Lists column of `num_groups` digests
+ */
+std::unique_ptr<column> compress_centroids(device_span<size_type const> labels,
+                                           device_span<double const> means,
+                                           device_span<double const> weights,
+                                           size_type num_groups,
+                                           int max_centroids,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto const num_elements = static_cast<size_type>(labels.size());
+
+  rmm::device_uvector<size_type> group_offsets(num_groups + 1, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      labels.begin(),
+                      labels.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_groups + 1),
+                      group_offsets.begin());
+
+  rmm::device_uvector<double> cumulative_weights(num_elements, stream);
+  thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                labels.begin(),
+                                labels.end(),
+                                weights.begin(),
+                                cumulative_weights.begin());
+
+  // The minimum and maximum take two of the centroids
+  auto const centroid_index =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    centroid_index_fn{labels.data(),
+                                                      group_offsets.data(),
+                                                      cumulative_weights.data(),
+                                                      weights.data(),
+                                                      max_centroids - 2});
+  auto const weighted_means = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [means = means.data(), weights = weights.data()] __device__(size_type i) {
+      return weighted_mean{means[i] * weights[i], weights[i]};
+    });
+
+  rmm::device_uvector<size_type> centroid_labels(num_elements, stream);
+  rmm::device_uvector<double> weighted_sums(num_elements, stream);
+  rmm::device_uvector<double> centroid_weights(num_elements, stream);
+  auto const ends = thrust::reduce_by_key(
+    rmm::exec_policy(stream),
+    thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), centroid_index)),
+    thrust::make_zip_iterator(thrust::make_tuple(labels.end(), centroid_index + num_elements)),
+    weighted_means,
+    thrust::make_zip_iterator(
+      thrust::make_tuple(centroid_labels.begin(), thrust::make_discard_iterator())),
+    thrust::make_zip_iterator(thrust::make_tuple(weighted_sums.begin(), centroid_weights.begin())),
+    thrust::equal_to<thrust::tuple<size_type, size_type>>{},
+    add_weighted_means{});
+  auto const num_centroids = static_cast<size_type>(
+    thrust::distance(weighted_sums.begin(), thrust::get<0>(ends.second.get_iterator_tuple())));
+
+  auto result_means = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_centroids, mask_state::UNALLOCATED, stream, mr);
+  auto result_weights = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_centroids, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    weighted_sums.begin(),
+                    weighted_sums.begin() + num_centroids,
+                    centroid_weights.begin(),
+                    result_means->mutable_view().begin<double>(),
+                    thrust::divides<double>{});
+  thrust::copy(rmm::exec_policy(stream),
+               centroid_weights.begin(),
+               centroid_weights.begin() + num_centroids,
+               result_weights->mutable_view().begin<double>());
+
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<offset_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      centroid_labels.begin(),
+                      centroid_labels.begin() + num_centroids,
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_groups + 1),
+                      offsets->mutable_view().begin<offset_type>());
+
+  std::vector<std::unique_ptr<column>> children;
+  children.push_back(std::move(result_means));
+  children.push_back(std::move(result_weights));
+  auto centroids = make_structs_column(
+    num_centroids, std::move(children), 0, rmm::device_buffer{0, stream, mr}, stream, mr);
+  return make_lists_column(num_groups,
+                           std::move(offsets),
+                           std::move(centroids),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+struct tdigest_functor {
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    column_view const& values,
+    device_span<size_type const> group_labels,
+    size_type num_groups,
+    int max_centroids,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    auto values_view = column_device_view::create(values, stream);
+    auto d_values    = *values_view;
+
+    // The digests summarize the valid values only
+    rmm::device_uvector<size_type> rows(values.size(), stream);
+    auto const rows_end = thrust::copy_if(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(values.size()),
+      rows.begin(),
+      [d_values] __device__(size_type i) { return d_values.is_valid(i); });
+    rows.resize(thrust::distance(rows.begin(), rows_end), stream);
+
+    rmm::device_uvector<size_type> labels(rows.size(), stream);
+    rmm::device_uvector<double> means(rows.size(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      rows.begin(),
+                      rows.end(),
+                      thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), means.begin())),
+                      [d_values, d_labels = group_labels.data()] __device__(size_type row) {
+                        return thrust::make_tuple(d_labels != nullptr ? d_labels[row] : 0,
+                                                  static_cast<double>(d_values.element<T>(row)));
+                      });
+    rmm::device_uvector<double> weights(rows.size(), stream);
+    thrust::fill(rmm::exec_policy(stream), weights.begin(), weights.end(), 1.0);
+
+    return compress_centroids(labels, means, weights, num_groups, max_centroids, stream, mr);
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    Args&&... args)
+  {
+    CUDF_FAIL("Only numeric types are supported in TDIGEST");
+  }
+};
+
+/**
+ * @brief Returns the row of a lists column holding an element of its child column.
+ */
+struct element_row_fn {
+  offset_type const* offsets;
+  size_type num_rows;
+
+  __device__ size_type operator()(size_type element) const
+  {
+    auto const it =
+      thrust::upper_bound(thrust::seq, offsets, offsets + num_rows + 1, offsets[0] + element);
+    return static_cast<size_type>(thrust::distance(offsets, it)) - 1;
+  }
+};
+
+/**
+ * @brief Returns the means and weights of the centroids of a column of digests.
+ */
+std::pair<column_view, column_view> centroids_of(lists_column_view const& digests,
+                                                 rmm::cuda_stream_view stream)
+{
+  auto const centroids = digests.get_sliced_child(stream);
+  CUDF_EXPECTS(centroids.type().id() == type_id::STRUCT && centroids.num_children() == 2,
+               "A t-digest must be a list of structs of means and weights");
+  auto const means   = structs_column_view(centroids).get_sliced_child(0);
+  auto const weights = structs_column_view(centroids).get_sliced_child(1);
+  CUDF_EXPECTS(
+    means.type().id() == type_id::FLOAT64 && weights.type().id() == type_id::FLOAT64,
+    "The means and weights of the centroids of a t-digest must be FLOAT64 values");
+  return {means, weights};
+}
+
+}  // namespace
+
+std::unique_ptr<column> group_tdigest(column_view const& values,
+                                      device_span<size_type const> group_labels,
+                                      size_type num_groups,
+                                      int max_centroids,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(group_labels.empty() || group_labels.size() == static_cast<size_t>(values.size()),
+               "The number of group labels must match the number of values");
+
+  return type_dispatcher(values.type(),
+                         tdigest_functor{},
+                         values,
+                         group_labels,
+                         num_groups,
+                         max_centroids,
+                         stream,
+                         mr);
+}
+
+std::unique_ptr<column> group_merge_tdigest(column_view const& digests,
+                                            device_span<size_type const> group_labels,
+                                            size_type num_groups,
+                                            int max_centroids,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(digests.type().id() == type_id::LIST, "MERGE_TDIGEST requires a lists column");
+  CUDF_EXPECTS(group_labels.empty() || group_labels.size() == static_cast<size_t>(digests.size()),
+               "The number of group labels must match the number of digests");
+  if (digests.size() == 0) {
+    return compress_centroids({}, {}, {}, num_groups, max_centroids, stream, mr);
+  }
+
+  auto const input              = lists_column_view(digests);
+  auto const centroids          = centroids_of(input, stream);
+  auto const num_input_elements = centroids.first.size();
+
+  // The centroids of null digests are ignored
+  auto digests_view = column_device_view::create(digests, stream);
+  auto const row_of = element_row_fn{input.offsets_begin(), digests.size()};
+  rmm::device_uvector<size_type> elements(num_input_elements, stream);
+  auto const elements_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_input_elements),
+    elements.begin(),
+    [d_digests = *digests_view, row_of] __device__(size_type i) {
+      return d_digests.is_valid(row_of(i));
+    });
+  elements.resize(thrust::distance(elements.begin(), elements_end), stream);
+
+  rmm::device_uvector<size_type> labels(elements.size(), stream);
+  rmm::device_uvector<double> means(elements.size(), stream);
+  rmm::device_uvector<double> weights(elements.size(), stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    elements.begin(),
+    elements.end(),
+    thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), means.begin(), weights.begin())),
+    [row_of,
+     d_labels  = group_labels.data(),
+     d_means   = centroids.first.data<double>(),
+     d_weights = centroids.second.data<double>()] __device__(size_type i) {
+      return thrust::make_tuple(
+        d_labels != nullptr ? d_labels[row_of(i)] : 0, d_means[i], d_weights[i]);
+    });
+
+  // The centroids of the digests of a group are merged in the order of their means
+  thrust::sort_by_key(rmm::exec_policy(stream),
+                      thrust::make_zip_iterator(thrust::make_tuple(labels.begin(), means.begin())),
+                      thrust::make_zip_iterator(thrust::make_tuple(labels.end(), means.end())),
+                      weights.begin());
+
+  return compress_centroids(labels, means, weights, num_groups, max_centroids, stream, mr);
+}
+
+std::unique_ptr<column> percentile_approx(lists_column_view const& input,
+                                          column_view const& percentiles,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(percentiles.type().id() == type_id::FLOAT64 && !percentiles.has_nulls(),
+               "percentile_approx requires FLOAT64 percentiles without nulls");
+  if (input.size() == 0) { return make_empty_column(data_type{type_id::LIST}); }
+
+  auto const centroids       = centroids_of(input, stream);
+  auto const num_rows        = input.size();
+  auto const num_percentiles = percentiles.size();
+  auto const row_of          = element_row_fn{input.offsets_begin(), num_rows};
+
+  // The cumulative weight of the centroids of every digest
+  auto const num_elements = centroids.first.size();
+  rmm::device_uvector<double> cumulative_weights(num_elements, stream);
+  thrust::inclusive_scan_by_key(
+    rmm::exec_policy(stream),
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), row_of),
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(num_elements),
+                                    row_of),
+    centroids.second.begin<double>(),
+    cumulative_weights.begin());
+
+  auto input_view = column_device_view::create(input.parent(), stream);
+  auto d_input    = *input_view;
+  auto is_valid   = [d_input, offsets = input.offsets_begin()] __device__(size_type row) {
+    return d_input.is_valid(row) && offsets[row + 1] > offsets[row];
+  };
+
+  // Null and empty digests make null lists without estimates
+  rmm::device_uvector<size_type> valid_rows(num_rows, stream);
+  auto const valid_rows_end = thrust::copy_if(rmm::exec_policy(stream),
+                                              thrust::make_counting_iterator<size_type>(0),
+                                              thrust::make_counting_iterator<size_type>(num_rows),
+                                              valid_rows.begin(),
+                                              is_valid);
+  auto const num_estimates =
+    static_cast<size_type>(thrust::distance(valid_rows.begin(), valid_rows_end)) * num_percentiles;
+
+  auto result = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_estimates, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_estimates),
+    result->mutable_view().begin<double>(),
+    [num_percentiles,
+     d_valid_rows  = valid_rows.data(),
+     offsets       = input.offsets_begin(),
+     d_percentiles = percentiles.data<double>(),
+     d_means       = centroids.first.data<double>(),
+     d_weights     = centroids.second.data<double>(),
+     d_cumulative  = cumulative_weights.data()] __device__(size_type i) {
+      auto const row = d_valid_rows[i / num_percentiles];
+
+      // Every centroid is centered on the cumulative weight of the middle of its values
+      auto const begin  = offsets[row] - offsets[0];
+      auto const end    = offsets[row + 1] - offsets[0];
+      auto const center = [&](size_type c) { return d_cumulative[c] - d_weights[c] / 2; };
+      auto const p      = min(max(d_percentiles[i % num_percentiles], 0.0), 1.0);
+      auto const target = p * d_cumulative[end - 1];
+
+      // Find the first centroid centered after the target
+      auto lo = begin;
+      auto hi = end;
+      while (lo < hi) {
+        auto const mid = lo + (hi - lo) / 2;
+        if (center(mid) <= target) {
+          lo = mid + 1;
+        } else {
+          hi = mid;
+        }
+      }
+      if (lo == begin) { return d_means[begin]; }
+      if (lo == end) { return d_means[end - 1]; }
+
+      auto const t = (target - center(lo - 1)) / (center(lo) - center(lo - 1));
+      return d_means[lo - 1] + t * (d_means[lo] - d_means[lo - 1]);
+    });
+
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<offset_type>()}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows + 1),
+    offsets->mutable_view().begin<offset_type>(),
+    [is_valid, num_rows, num_percentiles] __device__(size_type row) {
+      return row < num_rows && is_valid(row) ? num_percentiles : 0;
+    },
+    0,
+    thrust::plus<offset_type>{});
+
+  auto valid_mask = cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                           thrust::make_counting_iterator<size_type>(num_rows),
+                                           is_valid,
+                                           stream,
+                                           mr);
+  return make_lists_column(num_rows,
+                           std::move(offsets),
+                           std::move(result),
+                           valid_mask.second,
+                           std::move(valid_mask.first),
+                           stream,
+                           mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> percentile_approx(lists_column_view const& input,
+                                          column_view const& percentiles,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::percentile_approx(input, percentiles, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
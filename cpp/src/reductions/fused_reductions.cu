@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <type_traits>
+
+namespace cudf {
+namespace reduction {
+namespace {
+
+/**
+ * @brief Statistics of the valid elements of a column, from which all fused reductions are
+ * computed.
+ *
+ * Integral sums are accumulated in 64-bit integers and the other sums in double precision.
+ */
+template <typename T>
+struct column_statistics {
+  using sum_type = std::conditional_t<std::is_integral<T>::value, int64_t, double>;
+
+  size_type count{0};
+  T min{DeviceMin::identity<T>()};
+  T max{DeviceMax::identity<T>()};
+  sum_type sum{0};
+  sum_type sum_of_squares{0};
+  double mean_sum{0};
+  double mean_sum_of_squares{0};
+  bool any{false};
+  bool all{true};
+};
+
+/**
+ * @brief Computes the statistics of a single row, which are those of no elements if the row is
+ * null.
+ */
+template <typename T, bool has_nulls>
+struct row_statistics {
+  column_device_view d_col;
+
+  __device__ column_statistics<T> operator()(size_type i) const
+  {
+    column_statistics<T> result{};
+    if (has_nulls && d_col.is_null_nocheck(i)) { return result; }
+
+    using sum_type  = typename column_statistics<T>::sum_type;
+    T const element = d_col.element<T>(i);
+
+    result.count               = 1;
+    result.min                 = element;
+    result.max                 = element;
+    result.sum                 = static_cast<sum_type>(element);
+    result.sum_of_squares      = result.sum * result.sum;
+    result.mean_sum            = static_cast<double>(element);
+    result.mean_sum_of_squares = result.mean_sum * result.mean_sum;
+    result.any                 = static_cast<bool>(element);
+    result.all                 = result.any;
+    return result;
+  }
+};
+
+/**
+ * @brief Merges the statistics of two ranges of rows.
+ */
+template <typename T>
+struct merge_statistics {
+  __device__ column_statistics<T> operator()(column_statistics<T> const& lhs,
+                                             column_statistics<T> const& rhs) const
+  {
+    column_statistics<T> result{};
+    result.count               = lhs.count + rhs.count;
+    result.min                 = DeviceMin{}(lhs.min, rhs.min);
+    result.max                 = DeviceMax{}(lhs.max, rhs.max);
+    result.sum                 = lhs.sum + rhs.sum;
+    result.sum_of_squares      = lhs.sum_of_squares + rhs.sum_of_squares;
+    result.mean_sum            = lhs.mean_sum + rhs.mean_sum;
+    result.mean_sum_of_squares = lhs.mean_sum_of_squares + rhs.mean_sum_of_squares;
+    result.any                 = lhs.any || rhs.any;
+    result.all                 = lhs.all && rhs.all;
+    return result;
+  }
+};
+
+/**
+ * @brief Type-dispatched functor creating a scalar of the dispatched numeric type from `value`.
+ */
+template <typename Source>
+struct make_numeric_scalar {
+  template <typename Target, std::enable_if_t<cudf::is_numeric<Target>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(Source value,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
+  {
+    return make_fixed_width_scalar<Target>(static_cast<Target>(value), stream, mr);
+  }
+
+  template <typename Target, std::enable_if_t<not cudf::is_numeric<Target>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(Source,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*) const
+  {
+    CUDF_FAIL("Fused reductions support only numeric output types");
+  }
+};
+
+template <typename Source>
+std::unique_ptr<scalar> numeric_scalar(Source value,
+                                       data_type output_dtype,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(output_dtype, make_numeric_scalar<Source>{}, value, stream, mr);
+}
+
+/**
+ * @brief Type-dispatched functor computing the statistics of a column in one pass, and the
+ * results of the reductions from them.
+ */
+struct fused_reduce_dispatch {
+  template <typename T,
+            std::enable_if_t<cudf::is_numeric<T>() and !cudf::is_boolean<T>()>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const& col,
+                                                  std::vector<aggregation const*> const& aggs,
+                                                  std::vector<data_type> const& output_dtypes,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr) const
+  {
+    auto const d_col = column_device_view::create(col, stream);
+    auto const stats =
+      col.has_nulls()
+        ? thrust::transform_reduce(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(col.size()),
+                                   row_statistics<T, true>{*d_col},
+                                   column_statistics<T>{},
+                                   merge_statistics<T>{})
+        : thrust::transform_reduce(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(col.size()),
+                                   row_statistics<T, false>{*d_col},
+                                   column_statistics<T>{},
+                                   merge_statistics<T>{});
+
+    std::vector<std::unique_ptr<scalar>> results;
+    for (std::size_t idx = 0; idx < aggs.size(); ++idx) {
+      auto const output_dtype = output_dtypes[idx];
+      auto result             = [&]() -> std::unique_ptr<scalar> {
+        switch (aggs[idx]->kind) {
+          case aggregation::MIN: return make_fixed_width_scalar<T>(stats.min, stream, mr);
+          case aggregation::MAX: return make_fixed_width_scalar<T>(stats.max, stream, mr);
+          case aggregation::ANY: return make_fixed_width_scalar<bool>(stats.any, stream, mr);
+          case aggregation::ALL: return make_fixed_width_scalar<bool>(stats.all, stream, mr);
+          case aggregation::SUM: return numeric_scalar(stats.sum, output_dtype, stream, mr);
+          case aggregation::SUM_OF_SQUARES:
+            return numeric_scalar(stats.sum_of_squares, output_dtype, stream, mr);
+          case aggregation::MEAN:
+            return numeric_scalar(
+              op::mean::intermediate<double>::compute_result(stats.mean_sum, stats.count, 0),
+              output_dtype,
+              stream,
+              mr);
+          case aggregation::VARIANCE: {
+            auto const ddof = static_cast<cudf::detail::var_aggregation const*>(aggs[idx])->_ddof;
+            return numeric_scalar(
+              op::variance::intermediate<double>::compute_result(
+                {stats.mean_sum, stats.mean_sum_of_squares}, stats.count, ddof),
+              output_dtype,
+              stream,
+              mr);
+          }
+          case aggregation::STD: {
+            auto const ddof = static_cast<cudf::detail::std_aggregation const*>(aggs[idx])->_ddof;
+            return numeric_scalar(
+              op::standard_deviation::intermediate<double>::compute_result(
+                {stats.mean_sum, stats.mean_sum_of_squares}, stats.count, ddof),
+              output_dtype,
+              stream,
+              mr);
+          }
+          default: CUDF_FAIL("Unsupported fused reduction operator");
+        }
+      }();
+      if (stats.count == 0) { result->set_valid(false, stream); }
+      results.push_back(std::move(result));
+    }
+    return results;
+  }
+
+  template <typename T,
+            typename... Args,
+            std::enable_if_t<not(cudf::is_numeric<T>() and !cudf::is_boolean<T>())>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Fused reductions support only non-boolean numeric input columns");
+  }
+};
+
+}  // namespace
+
+bool is_fused_reduction(data_type const input_dtype,
+                        aggregation const& agg,
+                        data_type const output_dtype)
+{
+  if (not cudf::is_numeric(input_dtype) or input_dtype.id() == type_id::BOOL8) { return false; }
+  switch (agg.kind) {
+    case aggregation::MIN:
+    case aggregation::MAX: return output_dtype == input_dtype;
+    case aggregation::ANY:
+    case aggregation::ALL: return output_dtype.id() == type_id::BOOL8;
+    case aggregation::SUM:
+    case aggregation::SUM_OF_SQUARES:
+      return cudf::is_numeric(output_dtype) and output_dtype.id() != type_id::BOOL8;
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return cudf::is_floating_point(output_dtype);
+    default: return false;
+  }
+}
+
+std::vector<std::unique_ptr<scalar>> fused_reduce(column_view const& col,
+                                                  std::vector<aggregation const*> const& aggs,
+                                                  std::vector<data_type> const& output_dtypes,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(aggs.size() == output_dtypes.size(),
+               "Each fused reduction requires an output type");
+  for (std::size_t idx = 0; idx < aggs.size(); ++idx) {
+    CUDF_EXPECTS(is_fused_reduction(col.type(), *aggs[idx], output_dtypes[idx]),
+                 "Unsupported fused reduction");
+  }
+  if (aggs.empty()) { return {}; }
+  return type_dispatcher(col.type(), fused_reduce_dispatch{}, col, aggs, output_dtypes, stream, mr);
+}
+
+}  // namespace reduction
+}  // namespace cudf
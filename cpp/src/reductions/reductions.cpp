@@ -15,18 +15,25 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/reduction_functions.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace detail {
 struct reduce_dispatch_functor {
@@ -96,6 +103,46 @@ struct reduce_dispatch_functor {
           stream,
           mr);
       } break;
+      case aggregation::APPROX_NUNIQUE: {
+        auto approx_nunique_agg = static_cast<approx_nunique_aggregation const *>(agg.get());
+        return get_element(*detail::approx_distinct_count(col,
+                                                          {},
+                                                          1,
+                                                          approx_nunique_agg->_null_handling,
+                                                          approx_nunique_agg->_precision,
+                                                          stream),
+                           0,
+                           stream,
+                           mr);
+      } break;
+      case aggregation::NUNIQUE_SKETCH: {
+        auto sketch_agg = static_cast<approx_nunique_aggregation const *>(agg.get());
+
+        auto sketch = approx_distinct_count_sketch(
+          col, {}, 1, sketch_agg->_null_handling, sketch_agg->_precision, stream);
+        return std::make_unique<list_scalar>(
+          lists_column_view(*sketch).get_sliced_child(stream), true, stream, mr);
+      } break;
+      case aggregation::MERGE_NUNIQUE: {
+        return get_element(*merge_approx_distinct_count(col, {}, 1, stream), 0, stream, mr);
+      } break;
+      case aggregation::TDIGEST: {
+        auto tdigest_agg = static_cast<tdigest_aggregation const *>(agg.get());
+
+        auto sorted =
+          sort_by_key(table_view{{col}}, table_view{{col}}, {}, {null_order::AFTER}, stream);
+        auto digest =
+          group_tdigest(sorted->get_column(0), {}, 1, tdigest_agg->_max_centroids, stream);
+        return std::make_unique<list_scalar>(
+          lists_column_view(*digest).get_sliced_child(stream), true, stream, mr);
+      } break;
+      case aggregation::MERGE_TDIGEST: {
+        auto tdigest_agg = static_cast<tdigest_aggregation const *>(agg.get());
+
+        auto digest = group_merge_tdigest(col, {}, 1, tdigest_agg->_max_centroids, stream);
+        return std::make_unique<list_scalar>(
+          lists_column_view(*digest).get_sliced_child(stream), true, stream, mr);
+      } break;
       case aggregation::NTH_ELEMENT: {
         auto nth_agg = static_cast<nth_element_aggregation const *>(agg.get());
         return reduction::nth_element(col, nth_agg->_n, nth_agg->_null_handling, stream, mr);
@@ -112,6 +159,14 @@ std::unique_ptr<scalar> reduce(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource())
 {
+  // The t-digest of no values is an empty digest, and their sketch has only empty registers,
+  // rather than a null scalar
+  if (agg->kind == aggregation::TDIGEST or agg->kind == aggregation::MERGE_TDIGEST or
+      agg->kind == aggregation::NUNIQUE_SKETCH) {
+    return aggregation_dispatcher(
+      agg->kind, reduce_dispatch_functor{col, output_dtype, stream, mr}, agg);
+  }
+
   std::unique_ptr<scalar> result = make_default_constructed_scalar(output_dtype, stream, mr);
   result->set_valid(false, stream);
 
@@ -122,12 +177,130 @@ std::unique_ptr<scalar> reduce(
     aggregation_dispatcher(agg->kind, reduce_dispatch_functor{col, output_dtype, stream, mr}, agg);
   return result;
 }
+
+/**
+ * @brief Returns the aggregation reducing the reductions by `agg` of parts of a column into the
+ * reduction of the whole column, or none if there is no such aggregation.
+ */
+std::unique_ptr<aggregation> make_combining_aggregation(aggregation const &agg)
+{
+  switch (agg.kind) {
+    case aggregation::SUM:
+    case aggregation::SUM_OF_SQUARES: return make_sum_aggregation();
+    case aggregation::PRODUCT: return make_product_aggregation();
+    case aggregation::MIN: return make_min_aggregation();
+    case aggregation::MAX: return make_max_aggregation();
+    case aggregation::ANY: return make_any_aggregation();
+    case aggregation::ALL: return make_all_aggregation();
+    default: return nullptr;
+  }
+}
+
+std::unique_ptr<scalar> reduce(
+  chunked_column_view const &col,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource())
+{
+  if (col.num_chunks() == 1) { return reduce(col.chunk(0), agg, output_dtype, stream, mr); }
+
+  auto const combining_agg = make_combining_aggregation(*agg);
+  if (not combining_agg) {
+    std::vector<column_view> chunks(col.begin(), col.end());
+    auto const concatenated = concatenate(chunks, stream);
+    return reduce(concatenated->view(), agg, output_dtype, stream, mr);
+  }
+
+  // The valid reductions of the chunks are reduced again, so that the chunks of only nulls are
+  // skipped like null elements
+  std::vector<std::unique_ptr<column>> chunk_results;
+  for (auto const &chunk : col) {
+    if (chunk.size() <= chunk.null_count()) { continue; }
+    auto const chunk_result = reduce(chunk, agg, output_dtype, stream);
+    if (chunk_result->is_valid(stream)) {
+      chunk_results.push_back(make_column_from_scalar(*chunk_result, 1, stream));
+    }
+  }
+  if (chunk_results.empty()) {
+    auto result = make_default_constructed_scalar(output_dtype, stream, mr);
+    result->set_valid(false, stream);
+    return result;
+  }
+  std::vector<column_view> chunk_result_views;
+  for (auto const &chunk_result : chunk_results) {
+    chunk_result_views.push_back(chunk_result->view());
+  }
+  auto const combined = concatenate(chunk_result_views, stream);
+  return reduce(combined->view(), combining_agg, output_dtype, stream, mr);
+}
+
+std::vector<std::unique_ptr<scalar>> reduce(
+  table_view const &table,
+  std::vector<reduction_request> const &requests,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource())
+{
+  for (auto const &request : requests) {
+    CUDF_EXPECTS(request.column_index >= 0 && request.column_index < table.num_columns(),
+                 "Reduction column index out of bounds");
+  }
+
+  std::vector<std::unique_ptr<scalar>> results(requests.size());
+
+  // the requests fused into one pass over their column, grouped by column
+  std::vector<std::vector<std::size_t>> fused_requests(table.num_columns());
+  for (std::size_t idx = 0; idx < requests.size(); ++idx) {
+    auto const &request = requests[idx];
+    auto const col      = table.column(request.column_index);
+    if (reduction::is_fused_reduction(col.type(), *request.agg, request.output_dtype)) {
+      fused_requests[request.column_index].push_back(idx);
+    } else {
+      results[idx] = reduce(col, request.agg, request.output_dtype, stream, mr);
+    }
+  }
+
+  for (size_type col_idx = 0; col_idx < table.num_columns(); ++col_idx) {
+    auto const &indices = fused_requests[col_idx];
+    if (indices.empty()) { continue; }
+    std::vector<aggregation const *> aggs;
+    std::vector<data_type> output_dtypes;
+    for (auto const idx : indices) {
+      aggs.push_back(requests[idx].agg.get());
+      output_dtypes.push_back(requests[idx].output_dtype);
+    }
+    auto col_results =
+      reduction::fused_reduce(table.column(col_idx), aggs, output_dtypes, stream, mr);
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+      results[indices[i]] = std::move(col_results[i]);
+    }
+  }
+  return results;
+}
 }  // namespace detail
 
+std::vector<std::unique_ptr<scalar>> reduce(table_view const &table,
+                                            std::vector<reduction_request> const &requests,
+                                            rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(table, requests, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<scalar> reduce(column_view const &col,
                                std::unique_ptr<aggregation> const &agg,
                                data_type output_dtype,
                                rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::record_input(col);
+  return detail::reduce(col, agg, output_dtype, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<scalar> reduce(chunked_column_view const &col,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr)
 {
   CUDF_FUNC_RANGE();
   return detail::reduce(col, agg, output_dtype, rmm::cuda_stream_default, mr);
@@ -22,8 +22,12 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/reduction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -31,8 +35,65 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <map>
+#include <vector>
+
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Computes the null mask of a scan including the nulls, whose rows are null from the
+ * first row whose scanned rows include a null value.
+ *
+ * The scanned rows of a row are the rows up to and including it for an inclusive scan, and the
+ * rows before it for an exclusive scan.
+ */
+rmm::device_buffer mask_scan(const column_view& input_view,
+                             scan_type inclusive,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  rmm::device_buffer mask =
+    detail::create_null_mask(input_view.size(), mask_state::UNINITIALIZED, stream, mr);
+  auto d_input = column_device_view::create(input_view, stream);
+  auto v       = detail::make_validity_iterator(*d_input);
+  auto first_null_position =
+    thrust::find_if_not(
+      rmm::exec_policy(stream), v, v + input_view.size(), thrust::identity<bool>{}) -
+    v;
+  if (inclusive == scan_type::EXCLUSIVE and first_null_position < input_view.size()) {
+    ++first_null_position;
+  }
+  cudf::set_null_mask(static_cast<cudf::bitmask_type*>(mask.data()), 0, first_null_position, true);
+  cudf::set_null_mask(
+    static_cast<cudf::bitmask_type*>(mask.data()), first_null_position, input_view.size(), false);
+  return mask;
+}
+
+/**
+ * @brief Sets the null mask of the scan `output` of `input_view` according to `null_handling`.
+ */
+void set_scan_null_mask(column& output,
+                        const column_view& input_view,
+                        scan_type inclusive,
+                        null_policy null_handling,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* mr)
+{
+  if (null_handling == null_policy::EXCLUDE) {
+    output.set_null_mask(detail::copy_bitmask(input_view, stream, mr), input_view.null_count());
+  } else if (input_view.nullable()) {
+    output.set_null_mask(mask_scan(input_view, inclusive, stream, mr), cudf::UNKNOWN_NULL_COUNT);
+  }
+}
+
+}  // namespace
 
 /**
  * @brief Dispatcher for running Scan operation on input column
@@ -66,10 +127,7 @@ struct scan_dispatcher {
     const size_type size = input_view.size();
     auto output_column =
       detail::allocate_like(input_view, size, mask_allocation_policy::NEVER, stream, mr);
-    if (null_handling == null_policy::EXCLUDE) {
-      output_column->set_null_mask(detail::copy_bitmask(input_view, stream, mr),
-                                   input_view.null_count());
-    }
+    set_scan_null_mask(*output_column, input_view, scan_type::EXCLUSIVE, null_handling, stream, mr);
     mutable_column_view output = output_column->mutable_view();
     auto d_input               = column_device_view::create(input_view, stream);
 
@@ -96,25 +154,6 @@ struct scan_dispatcher {
     CUDF_FAIL("String types supports only inclusive min/max for `cudf::scan`");
   }
 
-  rmm::device_buffer mask_inclusive_scan(const column_view& input_view,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
-  {
-    rmm::device_buffer mask =
-      detail::create_null_mask(input_view.size(), mask_state::UNINITIALIZED, stream, mr);
-    auto d_input = column_device_view::create(input_view, stream);
-    auto v       = detail::make_validity_iterator(*d_input);
-    auto first_null_position =
-      thrust::find_if_not(
-        rmm::exec_policy(stream), v, v + input_view.size(), thrust::identity<bool>{}) -
-      v;
-    cudf::set_null_mask(
-      static_cast<cudf::bitmask_type*>(mask.data()), 0, first_null_position, true);
-    cudf::set_null_mask(
-      static_cast<cudf::bitmask_type*>(mask.data()), first_null_position, input_view.size(), false);
-    return mask;
-  }
-
   // for arithmetic types
   template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, T>* = nullptr>
   auto inclusive_scan(const column_view& input_view,
@@ -125,15 +164,7 @@ struct scan_dispatcher {
     const size_type size = input_view.size();
     auto output_column =
       detail::allocate_like(input_view, size, mask_allocation_policy::NEVER, stream, mr);
-    if (null_handling == null_policy::EXCLUDE) {
-      output_column->set_null_mask(detail::copy_bitmask(input_view, stream, mr),
-                                   input_view.null_count());
-    } else {
-      if (input_view.nullable()) {
-        output_column->set_null_mask(mask_inclusive_scan(input_view, stream, mr),
-                                     cudf::UNKNOWN_NULL_COUNT);
-      }
-    }
+    set_scan_null_mask(*output_column, input_view, scan_type::INCLUSIVE, null_handling, stream, mr);
 
     auto d_input               = column_device_view::create(input_view, stream);
     mutable_column_view output = output_column->mutable_view();
@@ -166,15 +197,7 @@ struct scan_dispatcher {
 
     auto output_column =
       cudf::make_strings_column(result, Op::template identity<string_view>(), stream, mr);
-    if (null_handling == null_policy::EXCLUDE) {
-      output_column->set_null_mask(detail::copy_bitmask(input_view, stream, mr),
-                                   input_view.null_count());
-    } else {
-      if (input_view.nullable()) {
-        output_column->set_null_mask(mask_inclusive_scan(input_view, stream, mr),
-                                     cudf::UNKNOWN_NULL_COUNT);
-      }
-    }
+    set_scan_null_mask(*output_column, input_view, scan_type::INCLUSIVE, null_handling, stream, mr);
     return output_column;
   }
 
@@ -260,7 +283,7 @@ std::unique_ptr<column> scan(
     case aggregation::PRODUCT:
       // a product scan on a decimal type with non-zero scale would result in each element having
       // a different scale, and because scale is stored once per column, this is not possible
-      if (is_fixed_point(input.type())) CUDF_FAIL("decimal32/64 cannot support product scan");
+      if (is_fixed_point(input.type())) CUDF_FAIL("decimal32/64/128 cannot support product scan");
       return cudf::type_dispatcher<dispatch_storage_type>(input.type(),
                                                           scan_dispatcher<cudf::DeviceProduct>(),
                                                           input,
@@ -271,6 +294,176 @@ std::unique_ptr<column> scan(
     default: CUDF_FAIL("Unsupported aggregation operator for scan");
   }
 }
+
+namespace {
+
+/**
+ * @brief Returns the row `k % num_rows` of the column `k / num_rows` of a table, or the identity
+ * of `Op` if the row is null.
+ */
+template <typename T, typename Op>
+struct table_element_fn {
+  table_device_view d_table;
+  size_type num_rows;
+
+  __device__ T operator()(int64_t k) const
+  {
+    auto const& col = d_table.column(k / num_rows);
+    auto const row  = static_cast<size_type>(k % num_rows);
+    return col.is_valid(row) ? col.element<T>(row) : Op::template identity<T>();
+  }
+};
+
+/**
+ * @brief Returns the row `k % num_rows` of the output column `k / num_rows`.
+ */
+template <typename T>
+struct output_element_fn {
+  T* const* outputs;
+  size_type num_rows;
+
+  __device__ T& operator()(int64_t k) const { return outputs[k / num_rows][k % num_rows]; }
+};
+
+/**
+ * @brief Returns the index `k / num_rows` of the column of the flattened row `k`.
+ */
+struct column_index_fn {
+  size_type num_rows;
+
+  __device__ int64_t operator()(int64_t k) const { return k / num_rows; }
+};
+
+/**
+ * @brief Dispatcher scanning several arithmetic columns of the same type with a single scan.
+ *
+ * The columns are flattened one after the other and scanned by the key of their column index,
+ * so that the scan restarts at the first row of every column.
+ */
+template <typename Op>
+struct multi_column_scan_dispatcher {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::vector<std::unique_ptr<column>> operator()(table_view const& input,
+                                                  scan_type inclusive,
+                                                  null_policy null_handling,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+  {
+    auto const num_rows = input.num_rows();
+    std::vector<std::unique_ptr<column>> results;
+    std::vector<T*> h_outputs;
+    for (auto const& col : input) {
+      results.push_back(
+        detail::allocate_like(col, num_rows, mask_allocation_policy::NEVER, stream, mr));
+      set_scan_null_mask(*results.back(), col, inclusive, null_handling, stream, mr);
+      h_outputs.push_back(results.back()->mutable_view().data<T>());
+    }
+    if (num_rows == 0) { return results; }
+
+    auto const d_outputs  = make_device_uvector_async(h_outputs, stream);
+    auto const d_table    = table_device_view::create(input, stream);
+    auto const num_values = static_cast<int64_t>(num_rows) * input.num_columns();
+    auto const keys =
+      thrust::make_transform_iterator(thrust::make_counting_iterator<int64_t>(0),
+                                      column_index_fn{num_rows});
+    auto const values = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<int64_t>(0), table_element_fn<T, Op>{*d_table, num_rows});
+    auto const output = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<int64_t>(0), output_element_fn<T>{d_outputs.data(), num_rows});
+
+    if (inclusive == scan_type::INCLUSIVE) {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                    keys,
+                                    keys + num_values,
+                                    values,
+                                    output,
+                                    thrust::equal_to<int64_t>{},
+                                    Op{});
+    } else {
+      thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                    keys,
+                                    keys + num_values,
+                                    values,
+                                    output,
+                                    Op::template identity<T>(),
+                                    thrust::equal_to<int64_t>{},
+                                    Op{});
+    }
+    CHECK_CUDA(stream.value());
+    return results;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not std::is_arithmetic<T>::value, std::vector<std::unique_ptr<column>>>
+  operator()(Args&&...)
+  {
+    CUDF_FAIL("Only arithmetic columns are scanned together");
+  }
+};
+
+template <typename Op>
+std::vector<std::unique_ptr<column>> multi_column_scan(table_view const& input,
+                                                       scan_type inclusive,
+                                                       null_policy null_handling,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  return cudf::type_dispatcher(input.column(0).type(),
+                               multi_column_scan_dispatcher<Op>{},
+                               input,
+                               inclusive,
+                               null_handling,
+                               stream,
+                               mr);
+}
+
+}  // namespace
+
+std::unique_ptr<table> scan(
+  table_view const& input,
+  std::unique_ptr<aggregation> const& agg,
+  scan_type inclusive,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const is_fused_kind = agg->kind == aggregation::SUM or agg->kind == aggregation::MIN or
+                             agg->kind == aggregation::MAX or agg->kind == aggregation::PRODUCT;
+
+  // the arithmetic columns of each type are scanned together, the other columns one at a time
+  std::vector<std::unique_ptr<column>> results(input.num_columns());
+  std::map<type_id, std::vector<size_type>> fused_columns;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col = input.column(i);
+    if (is_fused_kind and is_numeric(col.type())) {
+      fused_columns[col.type().id()].push_back(i);
+    } else {
+      results[i] = scan(col, agg, inclusive, null_handling, stream, mr);
+    }
+  }
+
+  for (auto const& fused : fused_columns) {
+    auto const& indices = fused.second;
+    auto const columns  = input.select(indices);
+    auto col_results    = [&] {
+      switch (agg->kind) {
+        case aggregation::SUM:
+          return multi_column_scan<cudf::DeviceSum>(columns, inclusive, null_handling, stream, mr);
+        case aggregation::MIN:
+          return multi_column_scan<cudf::DeviceMin>(columns, inclusive, null_handling, stream, mr);
+        case aggregation::MAX:
+          return multi_column_scan<cudf::DeviceMax>(columns, inclusive, null_handling, stream, mr);
+        default:
+          return multi_column_scan<cudf::DeviceProduct>(
+            columns, inclusive, null_handling, stream, mr);
+      }
+    }();
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+      results[indices[i]] = std::move(col_results[i]);
+    }
+  }
+  return std::make_unique<table>(std::move(results));
+}
 }  // namespace detail
 
 std::unique_ptr<column> scan(const column_view& input,
@@ -283,4 +476,14 @@ std::unique_ptr<column> scan(const column_view& input,
   return detail::scan(input, agg, inclusive, null_handling, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> scan(table_view const& input,
+                            std::unique_ptr<aggregation> const& agg,
+                            scan_type inclusive,
+                            null_policy null_handling,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::scan(input, agg, inclusive, null_handling, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/segmented_reduction_functions.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+
+std::unique_ptr<column> segmented_reduce(
+  column_view const &segmented_values,
+  device_span<size_type const> offsets,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(offsets.size() > 0, "`offsets` should have at least 1 element.");
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      return reduction::segmented_sum(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::MIN:
+      return reduction::segmented_min(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::MAX:
+      return reduction::segmented_max(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::ANY:
+      return reduction::segmented_any(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::ALL:
+      return reduction::segmented_all(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::MEAN:
+      return reduction::segmented_mean(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    default: CUDF_FAIL("Unsupported segmented reduction operator");
+  }
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_reduce(column_view const &segmented_values,
+                                         device_span<size_type const> offsets,
+                                         std::unique_ptr<aggregation> const &agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_reduce(
+    segmented_values, offsets, agg, output_dtype, null_handling, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_scan.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+namespace detail {
+
+std::unique_ptr<column> segmented_scan(
+  column_view const& segmented_values,
+  device_span<size_type const> offsets,
+  std::unique_ptr<aggregation> const& agg,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(offsets.size() > 0, "`offsets` should have at least 1 element.");
+
+  // the rows of the segment `i` are labelled `i + 1`, the label of their offsets upper bound
+  auto const num_segments = static_cast<size_type>(offsets.size()) - 1;
+  rmm::device_uvector<size_type> labels(segmented_values.size(), stream);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      offsets.begin(),
+                      offsets.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(segmented_values.size()),
+                      labels.begin());
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      return groupby::detail::sum_scan(segmented_values, num_segments, labels, stream, mr);
+    case aggregation::MIN:
+      return groupby::detail::min_scan(segmented_values, num_segments, labels, stream, mr);
+    case aggregation::MAX:
+      return groupby::detail::max_scan(segmented_values, num_segments, labels, stream, mr);
+    default: CUDF_FAIL("Unsupported segmented scan operator");
+  }
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_scan(column_view const& segmented_values,
+                                       device_span<size_type const> offsets,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_scan(segmented_values, offsets, agg, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -24,6 +24,7 @@
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/structs/struct_view.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -74,7 +75,7 @@ std::unique_ptr<scalar> simple_reduction(column_view const& col,
 /**
  * @brief Reduction for `sum`, `product`, `min` and `max` for decimal types
  *
- * @tparam DecimalXX  The `decimal32` or `decimal64` type
+ * @tparam DecimalXX  The `decimal32`, `decimal64` or `decimal128` type
  * @tparam Op         The operator of cudf::reduction::op::
  * @param col         Input column of data to reduce
 
@@ -114,8 +115,13 @@ std::unique_ptr<scalar> fixed_point_reduction(column_view const& col,
     return numeric::scale_type{col.type().scale()};
   }();
 
+  // copy the value in device memory rather than through the host, which would synchronize
   auto const val = static_cast<cudf::scalar_type_t<Type>*>(result.get());
-  return cudf::make_fixed_point_scalar<DecimalXX>(val->value(), scale);
+  rmm::device_scalar<Type> data{stream, mr};
+  CUDA_TRY(cudaMemcpyAsync(
+    data.data(), val->data(), sizeof(Type), cudaMemcpyDeviceToDevice, stream.value()));
+  return std::make_unique<cudf::fixed_point_scalar<DecimalXX>>(
+    std::move(data), scale, col.null_count() < col.size(), stream, mr);
 }
 
 /**
@@ -154,21 +160,18 @@ std::unique_ptr<scalar> dictionary_reduction(column_view const& col,
 /**
  * @brief Convert a numeric scalar to another numeric scalar.
  *
- * The input value and validity are cast to the output scalar.
+ * The input value is cast to the output scalar. The validity is set on the host, so that reading
+ * it from the output scalar does not synchronize.
  *
  * @tparam InputType The type of the input scalar to copy from
  * @tparam OutputType The output scalar type to copy to
  */
 template <typename InputType, typename OutputType>
 struct assign_scalar_fn {
-  __device__ void operator()()
-  {
-    d_output.set_value(static_cast<OutputType>(d_input.value()));
-    d_output.set_valid(d_input.is_valid());
-  }
+  __device__ void operator()() { *d_output = static_cast<OutputType>(*d_input); }
 
-  cudf::numeric_scalar_device_view<InputType> d_input;
-  cudf::numeric_scalar_device_view<OutputType> d_output;
+  InputType const* d_input;
+  OutputType* d_output;
 };
 
 /**
@@ -194,11 +197,10 @@ struct cast_numeric_scalar_fn {
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    auto d_input  = cudf::get_scalar_device_view(*input);
-    auto result   = std::make_unique<numeric_scalar<ResultType>>(ResultType{}, true, stream, mr);
-    auto d_output = cudf::get_scalar_device_view(*result);
-    cudf::detail::device_single_thread(assign_scalar_fn<InputType, ResultType>{d_input, d_output},
-                                       stream);
+    auto result = std::make_unique<numeric_scalar<ResultType>>(
+      ResultType{}, input->is_valid(stream), stream, mr);
+    cudf::detail::device_single_thread(
+      assign_scalar_fn<InputType, ResultType>{input->data(), result->data()}, stream);
     return result;
   }
 
@@ -292,7 +294,7 @@ struct same_element_type_dispatcher {
     auto index = simple::simple_reduction<ElementType, ElementType, Op>(
       dictionary_column_view(col).get_indices_annotated(),
       stream,
-      rmm::mr::get_current_device_resource());
+      cudf::get_current_temp_resource());
     return resolve_key<ElementType>(dictionary_column_view(col).keys(), *index, stream, mr);
   }
 
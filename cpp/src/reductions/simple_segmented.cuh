@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/segmented_reduction.cuh>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace reduction {
+namespace simple {
+namespace detail {
+
+/**
+ * @brief Returns 1 for the valid rows of a column and 0 for the null rows.
+ */
+struct is_valid_fn {
+  column_device_view const d_col;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    return static_cast<size_type>(d_col.is_valid(idx));
+  }
+};
+
+/**
+ * @brief Indicates whether the reduction of a segment is valid.
+ *
+ * Excluding nulls, the reduction is valid if the segment has a valid row. Including nulls, it is
+ * valid if the segment is not empty and has no null rows.
+ */
+struct is_segment_valid_fn {
+  size_type const* d_offsets;
+  size_type const* d_valid_counts;
+  null_policy null_handling;
+
+  __device__ bool operator()(size_type segment) const
+  {
+    auto const valid_count = d_valid_counts[segment];
+    return null_handling == null_policy::EXCLUDE
+             ? valid_count > 0
+             : valid_count > 0 && valid_count == d_offsets[segment + 1] - d_offsets[segment];
+  }
+};
+
+/**
+ * @brief Divides the sums of the segments by their numbers of valid rows.
+ */
+struct mean_fn {
+  size_type const* d_valid_counts;
+
+  __device__ double operator()(double sum, size_type segment) const
+  {
+    return d_valid_counts[segment] > 0 ? sum / d_valid_counts[segment] : sum;
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Counts the valid rows of each segment of a column.
+ *
+ * @param dcol Input column device view
+ * @param offsets Offsets of the segments
+ * @param stream Used for device memory operations and kernel launches.
+ * @return The number of valid rows of each segment
+ */
+inline rmm::device_uvector<size_type> segmented_valid_counts(column_device_view const& dcol,
+                                                            device_span<size_type const> offsets,
+                                                            rmm::cuda_stream_view stream)
+{
+  auto const num_segments = static_cast<size_type>(offsets.size()) - 1;
+  rmm::device_uvector<size_type> valid_counts(num_segments, stream);
+  auto const is_valid_it = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), detail::is_valid_fn{dcol});
+  reduction::detail::segmented_reduce(is_valid_it,
+                                      offsets.begin(),
+                                      offsets.end(),
+                                      valid_counts.begin(),
+                                      DeviceSum{},
+                                      size_type{0},
+                                      stream);
+  return valid_counts;
+}
+
+/**
+ * @brief Computes the null mask of the reductions of the segments of a column.
+ *
+ * @param offsets Offsets of the segments
+ * @param valid_counts The number of valid rows of each segment
+ * @param null_handling Whether the null rows are skipped or make the reduction null
+ * @param stream Used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned null mask
+ * @return The null mask and null count of the reductions
+ */
+inline std::pair<rmm::device_buffer, size_type> segmented_null_mask(
+  device_span<size_type const> offsets,
+  device_span<size_type const> valid_counts,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(static_cast<size_type>(valid_counts.size())),
+    detail::is_segment_valid_fn{offsets.data(), valid_counts.data(), null_handling},
+    stream,
+    mr);
+}
+
+/**
+ * @brief Segmented reduction for 'sum', 'min', 'max', 'any' and 'all' which directly compute
+ * the reduction of each segment by a single segmented reduction call
+ *
+ * @tparam ElementType  the input column data-type
+ * @tparam ResultType   the output data-type
+ * @tparam Op           the operator of cudf::reduction::op::
+ *
+ * @param col Input column of data to reduce
+ * @param offsets Offsets of the segments of `col`
+ * @param null_handling Whether the null rows are skipped or make the reduction null
+ * @param stream Used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Output column of the reductions of the segments
+ */
+template <typename ElementType, typename ResultType, typename Op>
+std::unique_ptr<column> simple_segmented_reduction(column_view const& col,
+                                                   device_span<size_type const> offsets,
+                                                   null_policy null_handling,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  using Type = device_storage_type_t<ResultType>;
+
+  auto dcol               = cudf::column_device_view::create(col, stream);
+  auto simple_op          = Op{};
+  auto const num_segments = static_cast<size_type>(offsets.size()) - 1;
+
+  // the decimal reductions keep the scale of the input
+  auto const result_type =
+    cudf::is_fixed_point<ResultType>() ? col.type() : data_type{type_to_id<ResultType>()};
+  auto result =
+    make_fixed_width_column(result_type, num_segments, mask_state::UNALLOCATED, stream, mr);
+  auto d_result = result->mutable_view().begin<Type>();
+
+  if (col.has_nulls()) {
+    auto f  = simple_op.template get_null_replacing_element_transformer<Type>();
+    auto it = thrust::make_transform_iterator(
+      dcol->pair_begin<device_storage_type_t<ElementType>, true>(), f);
+    reduction::detail::segmented_reduce(it,
+                                        offsets.begin(),
+                                        offsets.end(),
+                                        d_result,
+                                        simple_op.get_binary_op(),
+                                        simple_op.template get_identity<Type>(),
+                                        stream);
+  } else {
+    auto f  = simple_op.template get_element_transformer<Type>();
+    auto it = thrust::make_transform_iterator(dcol->begin<device_storage_type_t<ElementType>>(), f);
+    reduction::detail::segmented_reduce(it,
+                                        offsets.begin(),
+                                        offsets.end(),
+                                        d_result,
+                                        simple_op.get_binary_op(),
+                                        simple_op.template get_identity<Type>(),
+                                        stream);
+  }
+
+  auto const valid_counts = segmented_valid_counts(*dcol, offsets, stream);
+  auto [null_mask, null_count] =
+    segmented_null_mask(offsets, valid_counts, null_handling, stream, mr);
+  result->set_null_mask(std::move(null_mask), null_count);
+  return result;
+}
+
+/**
+ * @brief Call the segmented reduction and return a column of the type specified.
+ *
+ * This is used by operation `segmented_sum()`. It only supports numeric types. If the output
+ * type is not the same as the input type, an extra cast operation may incur.
+ *
+ * @tparam Op The reduce operation to execute on the column.
+ */
+template <typename Op>
+struct segmented_element_type_dispatcher {
+  template <typename ElementType, std::enable_if_t<cudf::is_numeric<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     device_span<size_type const> offsets,
+                                     data_type const output_type,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    if (output_type.id() == cudf::type_to_id<ElementType>()) {
+      return simple_segmented_reduction<ElementType, ElementType, Op>(
+        col, offsets, null_handling, stream, mr);
+    }
+
+    // reduce and cast to the output type
+    using ResultType = std::conditional_t<std::is_integral<ElementType>::value, int64_t, double>;
+    if (output_type.id() == cudf::type_to_id<ResultType>()) {
+      return simple_segmented_reduction<ElementType, ResultType, Op>(
+        col, offsets, null_handling, stream, mr);
+    }
+    auto const result = simple_segmented_reduction<ElementType, ResultType, Op>(
+      col, offsets, null_handling, stream, cudf::get_current_temp_resource());
+    return cudf::detail::cast(result->view(), output_type, stream, mr);
+  }
+
+  template <typename ElementType, std::enable_if_t<not cudf::is_numeric<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     device_span<size_type const>,
+                                     data_type const,
+                                     null_policy,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Segmented reduction operator not supported for this type");
+  }
+};
+
+/**
+ * @brief Call the segmented reduction and return a column of the type of the input column.
+ *
+ * This is used by operations `segmented_min()` and `segmented_max()`.
+ *
+ * @tparam Op The reduce operation to execute on the column.
+ */
+template <typename Op>
+struct segmented_same_element_type_dispatcher {
+  template <typename ElementType, std::enable_if_t<cudf::is_fixed_width<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     device_span<size_type const> offsets,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return simple_segmented_reduction<ElementType, ElementType, Op>(
+      col, offsets, null_handling, stream, mr);
+  }
+
+  template <typename ElementType,
+            std::enable_if_t<not cudf::is_fixed_width<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     device_span<size_type const>,
+                                     null_policy,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Segmented reduction operator not supported for this type");
+  }
+};
+
+/**
+ * @brief Call the segmented reduction and return a `BOOL8` column.
+ *
+ * This is used by operations `segmented_any()` and `segmented_all()`.
+ *
+ * @tparam Op The reduce operation to execute on the column.
+ */
+template <typename Op>
+struct segmented_bool_result_element_dispatcher {
+  template <typename ElementType, std::enable_if_t<cudf::is_numeric<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     device_span<size_type const> offsets,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return simple_segmented_reduction<ElementType, bool, Op>(
+      col, offsets, null_handling, stream, mr);
+  }
+
+  template <typename ElementType, std::enable_if_t<not cudf::is_numeric<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     device_span<size_type const>,
+                                     null_policy,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Segmented reduction operator not supported for this type");
+  }
+};
+
+/**
+ * @brief Call the segmented sum and divide the sums by the numbers of valid rows.
+ *
+ * This is used by operation `segmented_mean()`. It only supports numeric types and a
+ * floating-point output type.
+ */
+struct segmented_mean_dispatcher {
+  template <typename ElementType, std::enable_if_t<cudf::is_numeric<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     device_span<size_type const> offsets,
+                                     data_type const output_type,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const result_mr =
+      output_type.id() == type_id::FLOAT64 ? mr : cudf::get_current_temp_resource();
+    auto result = simple_segmented_reduction<ElementType, double, op::sum>(
+      col, offsets, null_handling, stream, result_mr);
+
+    auto const dcol         = cudf::column_device_view::create(col, stream);
+    auto const valid_counts = segmented_valid_counts(*dcol, offsets, stream);
+    auto d_result           = result->mutable_view().begin<double>();
+    thrust::transform(rmm::exec_policy(stream),
+                      d_result,
+                      d_result + result->size(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      d_result,
+                      detail::mean_fn{valid_counts.data()});
+
+    if (output_type == result->type()) { return result; }
+    return cudf::detail::cast(result->view(), output_type, stream, mr);
+  }
+
+  template <typename ElementType, std::enable_if_t<not cudf::is_numeric<ElementType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     device_span<size_type const>,
+                                     data_type const,
+                                     null_policy,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Segmented reduction operator not supported for this type");
+  }
+};
+
+}  // namespace simple
+}  // namespace reduction
+}  // namespace cudf
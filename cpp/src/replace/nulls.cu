@@ -20,12 +20,16 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/copy_range.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
+#include <cudf/detail/utilities/aliasing.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/replace.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/null_mask.hpp>
@@ -34,18 +38,32 @@
 #include <cudf/strings/detail/replace.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
 #include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 namespace {  // anonymous
 
 static constexpr int BLOCK_SIZE = 256;
@@ -305,7 +323,7 @@ struct replace_nulls_scalar_kernel_forwarder {
   {
     CUDF_EXPECTS(input.type() == replacement.type(), "Data type mismatch");
     std::unique_ptr<cudf::column> output =
-      cudf::allocate_like(input, cudf::mask_allocation_policy::NEVER, mr);
+      cudf::allocate_like(input, cudf::mask_allocation_policy::NEVER, stream, mr);
     auto output_view = output->mutable_view();
 
     using ScalarType = cudf::scalar_type_t<col_type>;
@@ -359,16 +377,16 @@ std::unique_ptr<cudf::column> replace_nulls_scalar_kernel_forwarder::operator()<
 /**
  * @brief Functor used by `inclusive_scan` to determine the index to gather from in
  *        the result column. When current row in input column is NULL, return previous
- *        accumulated index, otherwise return the current index. The second element in
- *        the return tuple is discarded.
+ *        accumulated index, otherwise return the current index. The second element of
+ *        the accumulated tuple tells whether its index is of a non-null row, which keeps
+ *        the operator associative so that it can be used by segmented scans as well.
  */
 struct replace_policy_functor {
   __device__ thrust::tuple<cudf::size_type, bool> operator()(
     thrust::tuple<cudf::size_type, bool> const& lhs,
     thrust::tuple<cudf::size_type, bool> const& rhs)
   {
-    return thrust::get<1>(rhs) ? thrust::make_tuple(thrust::get<0>(rhs), true)
-                               : thrust::make_tuple(thrust::get<0>(lhs), true);
+    return thrust::get<1>(rhs) ? rhs : lhs;
   }
 };
 
@@ -410,6 +428,284 @@ std::unique_ptr<cudf::column> replace_nulls_policy_impl(cudf::column_view const&
   return std::move(output->release()[0]);
 }
 
+/**
+ * @brief Functor called by the `type_dispatcher` to write the replaced values of `input` into a
+ * preallocated column.
+ */
+struct replace_nulls_into_forwarder {
+  template <typename col_type,
+            std::enable_if_t<cudf::is_rep_layout_compatible<col_type>()>* = nullptr>
+  void operator()(cudf::column_view const& input,
+                  cudf::column_view const& replacement,
+                  cudf::mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+  {
+    auto device_in          = cudf::column_device_view::create(input, stream);
+    auto device_replacement = cudf::column_device_view::create(replacement, stream);
+    auto values             = cudf::detail::make_counting_transform_iterator(
+      0, [in = *device_in, repl = *device_replacement] __device__(cudf::size_type i) {
+        return in.is_valid(i) ? in.element<col_type>(i) : repl.element<col_type>(i);
+      });
+    auto validity = cudf::detail::make_counting_transform_iterator(
+      0, [in = *device_in, repl = *device_replacement] __device__(cudf::size_type i) {
+        return in.is_valid(i) or repl.is_valid(i);
+      });
+    cudf::detail::copy_range(values, validity, output, 0, output.size(), stream);
+  }
+
+  template <typename col_type,
+            std::enable_if_t<cudf::is_rep_layout_compatible<col_type>()>* = nullptr>
+  void operator()(cudf::column_view const& input,
+                  cudf::scalar const& replacement,
+                  cudf::mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+  {
+    using ScalarType = cudf::scalar_type_t<col_type>;
+    auto const& s1   = static_cast<ScalarType const&>(replacement);
+    auto device_in   = cudf::column_device_view::create(input, stream);
+    auto values      = cudf::detail::make_counting_transform_iterator(
+      0, [in = *device_in, value = s1.data()] __device__(cudf::size_type i) {
+        return in.is_valid(i) ? in.element<col_type>(i) : *value;
+      });
+    cudf::detail::copy_range(
+      values, thrust::make_constant_iterator(true), output, 0, output.size(), stream);
+  }
+
+  template <typename col_type,
+            typename Replacement,
+            std::enable_if_t<not cudf::is_rep_layout_compatible<col_type>()>* = nullptr>
+  void operator()(cudf::column_view const&,
+                  Replacement const&,
+                  cudf::mutable_column_view&,
+                  rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Only fixed-width types support in-place null replacement.");
+  }
+};
+
+/**
+ * @brief Replacement of the null values of one of the columns replaced by
+ * `replace_nulls_fixed_width`.
+ */
+struct fused_replacement {
+  void const* value;                  ///< Data of the replacement scalar, or `nullptr`
+  cudf::size_type const* gather_map;  ///< Rows to gather by the replace policy, if no scalar
+};
+
+/**
+ * @brief Functor called by the `type_dispatcher` to return the data of a fixed-width scalar.
+ */
+struct scalar_data_forwarder {
+  template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  void const* operator()(cudf::scalar const& value)
+  {
+    return static_cast<cudf::scalar_type_t<T> const&>(value).data();
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_fixed_width<T>()>* = nullptr>
+  void const* operator()(cudf::scalar const&)
+  {
+    CUDF_FAIL("Only fixed-width scalars have data of their type.");
+  }
+};
+
+/**
+ * @brief Functor called by the `type_dispatcher` in device code to write an element of a column
+ * replaced by `replace_nulls_fixed_width`.
+ */
+struct replaced_element_writer {
+  template <typename T, std::enable_if_t<cudf::is_rep_layout_compatible<T>()>* = nullptr>
+  __device__ void operator()(cudf::column_device_view const& input,
+                             cudf::mutable_column_device_view& output,
+                             void const* value,
+                             cudf::size_type source,
+                             cudf::size_type row)
+  {
+    output.element<T>(row) =
+      value != nullptr ? *static_cast<T const*>(value) : input.element<T>(source);
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_rep_layout_compatible<T>()>* = nullptr>
+  __device__ void operator()(cudf::column_device_view const&,
+                             cudf::mutable_column_device_view&,
+                             void const*,
+                             cudf::size_type,
+                             cudf::size_type)
+  {
+  }
+};
+
+/**
+ * @brief Kernel replacing the null values of all the columns of a table at once.
+ *
+ * The rows of every column are padded to a multiple of the warp size, and consecutive threads
+ * handle consecutive rows of a column, so that every warp writes a whole word of the null mask of
+ * a single column.
+ *
+ * @param input The columns whose null values are replaced
+ * @param output The columns of the result, of which only those replaced by a policy are nullable
+ * @param replacements The replacement of each column
+ * @param padded_rows The number of rows of the columns, rounded up to a multiple of the warp size
+ */
+__global__ void replace_nulls_fixed_width(cudf::table_device_view input,
+                                          cudf::mutable_table_device_view output,
+                                          fused_replacement const* replacements,
+                                          cudf::size_type padded_rows)
+{
+  auto const num_rows = input.num_rows();
+  auto const lane_id  = threadIdx.x % cudf::detail::warp_size;
+  auto const total    = static_cast<int64_t>(padded_rows) * input.num_columns();
+  auto const stride   = static_cast<int64_t>(blockDim.x) * gridDim.x;
+
+  for (auto idx = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x; idx < total;
+       idx += stride) {
+    auto const col         = static_cast<cudf::size_type>(idx / padded_rows);
+    auto const row         = static_cast<cudf::size_type>(idx % padded_rows);
+    auto const& in         = input.column(col);
+    auto out               = output.column(col);
+    auto const replacement = replacements[col];
+
+    bool output_is_valid = false;
+    if (row < num_rows) {
+      auto const input_is_valid = in.is_valid_nocheck(row);
+      auto const source =
+        input_is_valid or replacement.value != nullptr ? row : replacement.gather_map[row];
+      output_is_valid = input_is_valid or in.is_valid_nocheck(source);
+      auto const value = input_is_valid ? nullptr : replacement.value;
+      cudf::type_dispatcher<cudf::dispatch_storage_type>(
+        out.type(), replaced_element_writer{}, in, out, value, source, row);
+    }
+
+    // Every thread of the warp handles the same column, whose output is nullable or not
+    if (out.nullable()) {
+      uint32_t const bitmask = __ballot_sync(0xffffffff, output_is_valid);
+      if (0 == lane_id) { out.set_mask_word(cudf::word_index(row), bitmask); }
+    }
+  }
+}
+
+/**
+ * @brief Functor computing the position, in the gather maps of the columns replaced by a policy,
+ * of the `k`-th element of their segmented scan.
+ *
+ * The gather maps of the first `num_preceding` columns are scanned from their first row, and the
+ * others from their last row.
+ */
+struct policy_scan_position {
+  cudf::size_type num_rows;
+  cudf::size_type num_preceding;
+
+  __device__ int64_t operator()(int64_t k) const
+  {
+    auto const col = k / num_rows;
+    auto const row = k % num_rows;
+    return col * num_rows + (col < num_preceding ? row : num_rows - 1 - row);
+  }
+};
+
+/**
+ * @brief Replaces the null values of fixed-width columns of a table, with their scalar or policy.
+ *
+ * The gather maps of all the columns replaced by a policy are computed by a single scan segmented
+ * by column, and all the columns are written by a single launch of `replace_nulls_fixed_width`.
+ *
+ * @param columns The columns to replace, which all have nulls
+ * @param replacements The replacement of each of `columns`, whose scalars are valid
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned columns.
+ * @return The replaced columns
+ */
+std::vector<std::unique_ptr<cudf::column>> replace_nulls_fixed_width_impl(
+  std::vector<cudf::column_view> const& columns,
+  std::vector<cudf::null_replacement> const& replacements,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = columns.front().size();
+
+  // The columns replaced by a policy are scanned with those filling forward first
+  std::vector<cudf::column_view> policy_columns;
+  std::vector<std::size_t> policy_index(columns.size());
+  for (auto const policy : {cudf::replace_policy::PRECEDING, cudf::replace_policy::FOLLOWING}) {
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+      if (replacements[i].value() == nullptr and replacements[i].policy() == policy) {
+        policy_index[i] = policy_columns.size();
+        policy_columns.push_back(columns[i]);
+      }
+    }
+  }
+  auto const num_preceding = static_cast<cudf::size_type>(
+    std::count_if(replacements.begin(), replacements.end(), [](auto const& r) {
+      return r.value() == nullptr and r.policy() == cudf::replace_policy::PRECEDING;
+    }));
+
+  auto const policy_size = static_cast<int64_t>(policy_columns.size()) * num_rows;
+  rmm::device_uvector<cudf::size_type> gather_maps(policy_size, stream);
+  if (policy_size > 0) {
+    auto const d_policy = cudf::table_device_view::create(cudf::table_view(policy_columns), stream);
+    auto const position = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<int64_t>(0), policy_scan_position{num_rows, num_preceding});
+    auto const keys = cudf::detail::make_counting_transform_iterator(
+      int64_t{0}, [num_rows] __device__(int64_t k) { return k / num_rows; });
+    auto const values = thrust::make_transform_iterator(
+      position, [d_policy = *d_policy, num_rows] __device__(int64_t p) {
+        auto const col = static_cast<cudf::size_type>(p / num_rows);
+        auto const row = static_cast<cudf::size_type>(p % num_rows);
+        return thrust::make_tuple(row, d_policy.column(col).is_valid_nocheck(row));
+      });
+    auto const gather_maps_out = thrust::make_permutation_iterator(
+      thrust::make_zip_iterator(
+        thrust::make_tuple(gather_maps.begin(), thrust::make_discard_iterator())),
+      position);
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  keys,
+                                  keys + policy_size,
+                                  values,
+                                  gather_maps_out,
+                                  thrust::equal_to<int64_t>{},
+                                  replace_policy_functor{});
+  }
+
+  std::vector<fused_replacement> h_replacements(columns.size());
+  std::vector<std::unique_ptr<cudf::column>> output(columns.size());
+  std::vector<cudf::mutable_column_view> output_views(columns.size());
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    auto const value = replacements[i].value();
+    h_replacements[i] =
+      value != nullptr
+        ? fused_replacement{cudf::type_dispatcher(value->type(), scalar_data_forwarder{}, *value),
+                            nullptr}
+        : fused_replacement{nullptr, gather_maps.data() + policy_index[i] * num_rows};
+    output[i] = cudf::detail::allocate_like(columns[i],
+                                            num_rows,
+                                            value != nullptr ? cudf::mask_allocation_policy::NEVER
+                                                             : cudf::mask_allocation_policy::ALWAYS,
+                                            stream,
+                                            mr);
+    output_views[i] = output[i]->mutable_view();
+  }
+  auto const d_replacements = cudf::detail::make_device_uvector_async(h_replacements, stream);
+
+  auto const d_input  = cudf::table_device_view::create(cudf::table_view(columns), stream);
+  auto const d_output = cudf::mutable_table_device_view::create(
+    cudf::mutable_table_view(output_views), stream);
+  auto const padded_rows =
+    cudf::util::round_up_safe(num_rows, static_cast<cudf::size_type>(cudf::detail::warp_size));
+  auto const num_blocks = static_cast<int>(
+    std::min<int64_t>(cudf::util::div_rounding_up_safe(
+                        static_cast<int64_t>(padded_rows) * static_cast<int64_t>(columns.size()),
+                        int64_t{BLOCK_SIZE}),
+                      std::numeric_limits<int32_t>::max()));
+  replace_nulls_fixed_width<<<num_blocks, BLOCK_SIZE, 0, stream.value()>>>(
+    *d_input, *d_output, d_replacements.data(), padded_rows);
+
+  // The null masks of the columns replaced by a policy were written without counting them
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    if (replacements[i].value() == nullptr) { output[i]->set_null_count(cudf::UNKNOWN_NULL_COUNT); }
+  }
+  return output;
+}
+
 }  // end anonymous namespace
 
 namespace cudf {
@@ -454,6 +750,95 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
   return replace_nulls_policy_impl(input, replace_policy, stream, mr);
 }
 
+std::unique_ptr<table> replace_nulls(table_view const& input,
+                                     std::vector<null_replacement> const& replacements,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(replacements.size() == static_cast<std::size_t>(input.num_columns()),
+               "Mismatch between the number of columns and of replacements");
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const value = replacements[i].value();
+    CUDF_EXPECTS(value == nullptr or value->type() == input.column(i).type(),
+                 "Data type mismatch");
+  }
+
+  // The fixed-width columns with nulls to replace are replaced together, the others one by one
+  std::vector<std::unique_ptr<column>> output(input.num_columns());
+  std::vector<size_type> fused_indices;
+  std::vector<column_view> fused_columns;
+  std::vector<null_replacement> fused_replacements;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col   = input.column(i);
+    auto const& repl  = replacements[i];
+    auto const value  = repl.value();
+    auto const unused = not col.has_nulls() or (value != nullptr and not value->is_valid(stream));
+    if (unused) {
+      output[i] = std::make_unique<column>(col, stream, mr);
+    } else if (not is_fixed_width(col.type())) {
+      output[i] = value != nullptr ? replace_nulls(col, *value, stream, mr)
+                                   : replace_nulls(col, repl.policy(), stream, mr);
+    } else {
+      fused_indices.push_back(i);
+      fused_columns.push_back(col);
+      fused_replacements.push_back(repl);
+    }
+  }
+
+  if (not fused_columns.empty()) {
+    auto fused = replace_nulls_fixed_width_impl(fused_columns, fused_replacements, stream, mr);
+    for (std::size_t i = 0; i < fused.size(); ++i) {
+      output[fused_indices[i]] = std::move(fused[i]);
+    }
+  }
+  return std::make_unique<table>(std::move(output));
+}
+
+void replace_nulls(cudf::column_view const& input,
+                   cudf::column_view const& replacement,
+                   cudf::mutable_column_view& output,
+                   rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(input.type() == replacement.type() and input.type() == output.type(),
+               "Data type mismatch");
+  CUDF_EXPECTS(replacement.size() == input.size() and output.size() == input.size(),
+               "Column size mismatch");
+  CUDF_EXPECTS(output.nullable() or not input.has_nulls() or not replacement.has_nulls(),
+               "Output must be nullable if the result has nulls");
+  CUDF_EXPECTS(is_fixed_width(input.type()),
+               "Only fixed-width types support in-place null replacement.");
+  CUDF_EXPECTS(
+    is_elementwise_alias_safe(input, output) and is_elementwise_alias_safe(replacement, output),
+    "Output overlaps an operand without viewing the same elements");
+
+  if (input.is_empty()) { return; }
+  cudf::type_dispatcher<dispatch_storage_type>(
+    input.type(), replace_nulls_into_forwarder{}, input, replacement, output, stream);
+}
+
+void replace_nulls(cudf::column_view const& input,
+                   cudf::scalar const& replacement,
+                   cudf::mutable_column_view& output,
+                   rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(input.type() == replacement.type() and input.type() == output.type(),
+               "Data type mismatch");
+  CUDF_EXPECTS(output.size() == input.size(), "Column size mismatch");
+  CUDF_EXPECTS(is_fixed_width(input.type()),
+               "Only fixed-width types support in-place null replacement.");
+  CUDF_EXPECTS(is_elementwise_alias_safe(input, output),
+               "Output overlaps the input without viewing the same elements");
+
+  if (input.is_empty()) { return; }
+  if (!replacement.is_valid(stream)) {
+    // The result is a copy of `input`
+    cudf::detail::copy_range_in_place(input, output, 0, input.size(), 0, stream);
+    return;
+  }
+  cudf::type_dispatcher<dispatch_storage_type>(
+    input.type(), replace_nulls_into_forwarder{}, input, replacement, output, stream);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
@@ -480,4 +865,28 @@ std::unique_ptr<cudf::column> replace_nulls(column_view const& input,
   return cudf::detail::replace_nulls(input, replace_policy, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::table> replace_nulls(table_view const& input,
+                                           std::vector<null_replacement> const& replacements,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::replace_nulls(input, replacements, rmm::cuda_stream_default, mr);
+}
+
+void replace_nulls(cudf::column_view const& input,
+                   cudf::column_view const& replacement,
+                   cudf::mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  cudf::detail::replace_nulls(input, replacement, output, rmm::cuda_stream_default);
+}
+
+void replace_nulls(cudf::column_view const& input,
+                   cudf::scalar const& replacement,
+                   cudf::mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  cudf::detail::replace_nulls(input, replacement, output, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
@@ -31,6 +31,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <hash/concurrent_unordered_map.cuh>
+
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
@@ -42,6 +44,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
@@ -53,52 +56,138 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_scalar.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 
-#include <thrust/find.h>
+#include <limits>
 
 namespace {  // anonymous
 
 static constexpr int BLOCK_SIZE = 256;
 
-// return the new_value for output column at index `idx`
-template <class T, bool replacement_has_nulls>
-__device__ auto get_new_value(cudf::size_type idx,
-                              const T* __restrict__ input_data,
-                              const T* __restrict__ values_to_replace_begin,
-                              const T* __restrict__ values_to_replace_end,
-                              const T* __restrict__ d_replacement_values,
-                              cudf::bitmask_type const* __restrict__ replacement_valid)
-{
-  auto found_ptr =
-    thrust::find(thrust::seq, values_to_replace_begin, values_to_replace_end, input_data[idx]);
-  T new_value{};
-  bool output_is_valid{true};
-
-  if (found_ptr != values_to_replace_end) {
-    auto d    = thrust::distance(values_to_replace_begin, found_ptr);
-    new_value = d_replacement_values[d];
-    if (replacement_has_nulls) { output_is_valid = cudf::bit_is_set(replacement_valid, d); }
-  } else {
-    new_value = input_data[idx];
+/**
+ * @brief Number of values to replace from which the values are looked up in a hash map instead of
+ * being compared one by one with every element.
+ */
+static constexpr cudf::size_type hash_lookup_threshold = 32;
+
+/**
+ * @brief Matcher returning the index of the first of the values to replace equal to an element of
+ * the input, or -1, by comparing the element with every value.
+ */
+template <typename T>
+struct linear_matcher {
+  cudf::column_device_view input;
+  cudf::column_device_view values_to_replace;
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    auto const value = input.element<T>(idx);
+    for (cudf::size_type i = 0; i < values_to_replace.size(); ++i) {
+      if (values_to_replace.element<T>(i) == value) { return i; }
+    }
+    return -1;
   }
-  return thrust::make_pair(new_value, output_is_valid);
-}
+};
+
+/**
+ * @brief Hash of an element of a column, equal for the elements which compare equal.
+ */
+template <typename T>
+struct element_hasher {
+  cudf::column_device_view column;
 
-__device__ int get_new_string_value(cudf::size_type idx,
-                                    cudf::column_device_view& input,
-                                    cudf::column_device_view& values_to_replace,
-                                    cudf::column_device_view& replacement_values)
+  __device__ cudf::hash_value_type operator()(cudf::size_type idx) const
+  {
+    return default_hash<T>{}(column.element<T>(idx));
+  }
+};
+
+/**
+ * @brief Equality of an element of `lhs` and of an element of `rhs`, with the `==` of the linear
+ * search so that both lookups replace the same elements.
+ */
+template <typename T>
+struct element_equality {
+  cudf::column_device_view lhs;
+  cudf::column_device_view rhs;
+
+  __device__ bool operator()(cudf::size_type lhs_idx, cudf::size_type rhs_idx) const
+  {
+    return lhs.element<T>(lhs_idx) == rhs.element<T>(rhs_idx);
+  }
+};
+
+/**
+ * @brief Matcher returning the index of the first of the values to replace equal to an element of
+ * the input, or -1, from a hash map of the values to replace.
+ */
+template <typename T>
+struct hash_matcher {
+  using map_type = concurrent_unordered_map<cudf::size_type,
+                                            cudf::size_type,
+                                            element_hasher<T>,
+                                            element_equality<T>>;
+
+  map_type map;
+  element_hasher<T> input_hasher;
+  element_equality<T> input_equality;
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    auto const found = map.find(idx, input_hasher, input_equality);
+    return found == map.end() ? -1 : found->second;
+  }
+};
+
+/**
+ * @brief Functor inserting the values to replace into a hash map, keeping the index of the first
+ * of equal values as the matching index.
+ */
+template <typename MapType>
+struct insert_values_fn {
+  MapType map;
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    auto const result = map.insert(thrust::make_pair(idx, idx));
+    atomicMin(&(result.first->second), idx);
+  }
+};
+
+/**
+ * @brief Calls `replace` with the matcher of the elements of `d_input` in `values_to_replace`.
+ *
+ * A few values to replace are compared with every element, but more are inserted into a hash map
+ * so that every element is looked up in constant time.
+ */
+template <typename T, typename ReplaceFunction>
+void with_matcher(cudf::column_device_view const& d_input,
+                  cudf::column_view const& values_to_replace,
+                  rmm::cuda_stream_view stream,
+                  ReplaceFunction replace)
 {
-  cudf::string_view input_string = input.element<cudf::string_view>(idx);
-  int match                      = -1;
-  for (int i = 0; i < values_to_replace.size(); i++) {
-    cudf::string_view value_string = values_to_replace.element<cudf::string_view>(i);
-    if (input_string == value_string) {
-      match = i;
-      break;
-    }
+  auto const d_values = cudf::column_device_view::create(values_to_replace, stream);
+  if (values_to_replace.size() < hash_lookup_threshold) {
+    replace(linear_matcher<T>{d_input, *d_values});
+    return;
   }
-  return match;
+
+  using map_type = typename hash_matcher<T>::map_type;
+  auto map       = map_type::create(compute_hash_table_size(values_to_replace.size()),
+                              stream,
+                              std::numeric_limits<cudf::size_type>::max(),
+                              std::numeric_limits<cudf::size_type>::max(),
+                              element_hasher<T>{*d_values},
+                              element_equality<T>{*d_values, *d_values});
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     values_to_replace.size(),
+                     insert_values_fn<map_type>{*map});
+  replace(
+    hash_matcher<T>{*map, element_hasher<T>{d_input}, element_equality<T>{d_input, *d_values}});
 }
 
 /**
@@ -107,16 +196,16 @@ __device__ int get_new_string_value(cudf::size_type idx,
  * It computes the output null_mask, null_count, and the offsets.
  *
  * @param input The input column to replace strings in.
- * @param values_to_replace The string values to replace.
+ * @param matcher The matcher of the input strings in the string values to replace.
  * @param replacement The replacement values.
  * @param offsets The column which will contain the offsets of the new string column
  * @param indices Temporary column used to store the replacement indices
  * @param output_valid The output null_mask
  * @param output_valid_count The output valid count
  */
-template <bool input_has_nulls, bool replacement_has_nulls>
+template <bool input_has_nulls, bool replacement_has_nulls, typename Matcher>
 __global__ void replace_strings_first_pass(cudf::column_device_view input,
-                                           cudf::column_device_view values_to_replace,
+                                           Matcher matcher,
                                            cudf::column_device_view replacement,
                                            cudf::mutable_column_device_view offsets,
                                            cudf::mutable_column_device_view indices,
@@ -137,7 +226,7 @@ __global__ void replace_strings_first_pass(cudf::column_device_view input,
     bool output_is_valid = input_is_valid;
 
     if (input_is_valid) {
-      int result               = get_new_string_value(i, input, values_to_replace, replacement);
+      int result               = matcher(i);
       cudf::string_view output = (result == -1) ? input.element<cudf::string_view>(i)
                                                 : replacement.element<cudf::string_view>(result);
       offsets.data<cudf::size_type>()[i] = output.size_bytes();
@@ -212,14 +301,15 @@ __global__ void replace_strings_second_pass(cudf::column_device_view input,
 
 /**
  * @brief Kernel that replaces elements from `output_data` given the following
- *        rule: replace all `values_to_replace[i]` in [values_to_replace_begin`,
- *        `values_to_replace_end`) present in `output_data` with `d_replacement_values[i]`.
+ *        rule: replace all `values_to_replace[i]` present in `output_data`, as found by
+ *        `matcher`, with `replacement[i]`.
  *
  * @tparam input_has_nulls `true` if output column has valid mask, `false` otherwise
  * @tparam replacement_has_nulls `true` if replacement_values column has valid mask, `false`
  * otherwise The input_has_nulls and replacement_has_nulls template parameters allows us to
  * specialize this kernel for the different scenario for performance without writing different
  * kernel.
+ * @tparam Matcher `linear_matcher` or `hash_matcher` of the element type
  *
  * @param[in] input_data Device array with the data to be modified
  * @param[in] input_valid Valid mask associated with input_data
@@ -227,19 +317,15 @@ __global__ void replace_strings_second_pass(cudf::column_device_view input,
  * @param[out] output_valid Valid mask associated with output_data
  * @param[out] output_valid_count #valid in output column
  * @param[in] nrows # rows in `output_data`
- * @param[in] values_to_replace_begin Device pointer to the beginning of the sequence
- * of old values to be replaced
- * @param[in] values_to_replace_end  Device pointer to the end of the sequence
- * of old values to be replaced
- * @param[in] d_replacement_values Device array with the new values
- * @param[in] replacement_valid Valid mask associated with d_replacement_values
+ * @param[in] matcher The matcher of the elements of input_data in the old values to be replaced
+ * @param[in] replacement The new values
  */
-template <class T, bool input_has_nulls, bool replacement_has_nulls>
+template <class T, bool input_has_nulls, bool replacement_has_nulls, typename Matcher>
 __global__ void replace_kernel(cudf::column_device_view input,
                                cudf::mutable_column_device_view output,
                                cudf::size_type* __restrict__ output_valid_count,
                                cudf::size_type nrows,
-                               cudf::column_device_view values_to_replace,
+                               Matcher matcher,
                                cudf::column_device_view replacement)
 {
   T* __restrict__ output_data = output.data<T>();
@@ -258,14 +344,15 @@ __global__ void replace_kernel(cudf::column_device_view input,
       input_is_valid  = input.is_valid_nocheck(i);
       output_is_valid = input_is_valid;
     }
-    if (input_is_valid)
-      thrust::tie(output_data[i], output_is_valid) = get_new_value<T, replacement_has_nulls>(
-        i,
-        input.data<T>(),
-        values_to_replace.data<T>(),
-        values_to_replace.data<T>() + values_to_replace.size(),
-        replacement.data<T>(),
-        replacement.null_mask());
+    if (input_is_valid) {
+      auto const match = matcher(i);
+      if (match != -1) {
+        output_data[i] = replacement.element<T>(match);
+        if (replacement_has_nulls) { output_is_valid = replacement.is_valid_nocheck(match); }
+      } else {
+        output_data[i] = input.element<T>(i);
+      }
+    }
 
     /* output valid counts calculations*/
     if (input_has_nulls or replacement_has_nulls) {
@@ -303,15 +390,6 @@ struct replace_kernel_forwarder {
     rmm::device_scalar<cudf::size_type> valid_counter(0, stream);
     cudf::size_type* valid_count = valid_counter.data();
 
-    auto replace = [&] {
-      if (input_col.has_nulls())
-        return replacement_values.has_nulls() ? replace_kernel<col_type, true, true>
-                                              : replace_kernel<col_type, true, false>;
-      else
-        return replacement_values.has_nulls() ? replace_kernel<col_type, false, true>
-                                              : replace_kernel<col_type, false, false>;
-    }();
-
     auto output = [&] {
       auto const mask_allocation_policy = input_col.has_nulls() || replacement_values.has_nulls()
                                             ? cudf::mask_allocation_policy::ALWAYS
@@ -323,17 +401,29 @@ struct replace_kernel_forwarder {
     auto output_view = output->mutable_view();
     auto grid        = cudf::detail::grid_1d{output_view.size(), BLOCK_SIZE, 1};
 
-    auto device_in                 = cudf::column_device_view::create(input_col);
-    auto device_out                = cudf::mutable_column_device_view::create(output_view);
-    auto device_values_to_replace  = cudf::column_device_view::create(values_to_replace);
-    auto device_replacement_values = cudf::column_device_view::create(replacement_values);
-
-    replace<<<grid.num_blocks, BLOCK_SIZE, 0, stream.value()>>>(*device_in,
-                                                                *device_out,
-                                                                valid_count,
-                                                                output_view.size(),
-                                                                *device_values_to_replace,
-                                                                *device_replacement_values);
+    auto device_in                 = cudf::column_device_view::create(input_col, stream);
+    auto device_out                = cudf::mutable_column_device_view::create(output_view, stream);
+    auto device_replacement_values = cudf::column_device_view::create(replacement_values, stream);
+
+    with_matcher<col_type>(*device_in, values_to_replace, stream, [&](auto matcher) {
+      using matcher_type = decltype(matcher);
+      auto replace       = [&] {
+        if (input_col.has_nulls())
+          return replacement_values.has_nulls()
+                   ? replace_kernel<col_type, true, true, matcher_type>
+                   : replace_kernel<col_type, true, false, matcher_type>;
+        else
+          return replacement_values.has_nulls()
+                   ? replace_kernel<col_type, false, true, matcher_type>
+                   : replace_kernel<col_type, false, false, matcher_type>;
+      }();
+      replace<<<grid.num_blocks, BLOCK_SIZE, 0, stream.value()>>>(*device_in,
+                                                                  *device_out,
+                                                                  valid_count,
+                                                                  output_view.size(),
+                                                                  matcher,
+                                                                  *device_replacement_values);
+    });
 
     if (output_view.nullable()) {
       output->set_null_count(output->size() - valid_counter.value(stream));
@@ -363,23 +453,6 @@ std::unique_ptr<cudf::column> replace_kernel_forwarder::operator()<cudf::string_
   rmm::device_scalar<cudf::size_type> valid_counter(0, stream);
   cudf::size_type* valid_count = valid_counter.data();
 
-  auto replace_first  = replace_strings_first_pass<true, false>;
-  auto replace_second = replace_strings_second_pass<true, false>;
-  if (input_col.has_nulls()) {
-    if (replacement_values.has_nulls()) {
-      replace_first  = replace_strings_first_pass<true, true>;
-      replace_second = replace_strings_second_pass<true, true>;
-    }
-  } else {
-    if (replacement_values.has_nulls()) {
-      replace_first  = replace_strings_first_pass<false, true>;
-      replace_second = replace_strings_second_pass<false, true>;
-    } else {
-      replace_first  = replace_strings_first_pass<false, false>;
-      replace_second = replace_strings_second_pass<false, false>;
-    }
-  }
-
   // Create new offsets column to use in kernel
   std::unique_ptr<cudf::column> sizes = cudf::make_numeric_column(
     cudf::data_type(cudf::type_id::INT32), input_col.size(), cudf::mask_state::UNALLOCATED, stream);
@@ -389,25 +462,37 @@ std::unique_ptr<cudf::column> replace_kernel_forwarder::operator()<cudf::string_
   auto sizes_view   = sizes->mutable_view();
   auto indices_view = indices->mutable_view();
 
-  auto device_in                = cudf::column_device_view::create(input_col);
-  auto device_values_to_replace = cudf::column_device_view::create(values_to_replace);
-  auto device_replacement       = cudf::column_device_view::create(replacement_values);
-  auto device_sizes             = cudf::mutable_column_device_view::create(sizes_view);
-  auto device_indices           = cudf::mutable_column_device_view::create(indices_view);
+  auto device_in          = cudf::column_device_view::create(input_col, stream);
+  auto device_replacement = cudf::column_device_view::create(replacement_values, stream);
+  auto device_sizes       = cudf::mutable_column_device_view::create(sizes_view, stream);
+  auto device_indices     = cudf::mutable_column_device_view::create(indices_view, stream);
 
   rmm::device_buffer valid_bits =
     cudf::detail::create_null_mask(input_col.size(), cudf::mask_state::UNINITIALIZED, stream, mr);
 
   // Call first pass kernel to get sizes in offsets
   cudf::detail::grid_1d grid{input_col.size(), BLOCK_SIZE, 1};
-  replace_first<<<grid.num_blocks, BLOCK_SIZE, 0, stream.value()>>>(
-    *device_in,
-    *device_values_to_replace,
-    *device_replacement,
-    *device_sizes,
-    *device_indices,
-    reinterpret_cast<cudf::bitmask_type*>(valid_bits.data()),
-    valid_count);
+  with_matcher<cudf::string_view>(*device_in, values_to_replace, stream, [&](auto matcher) {
+    using matcher_type = decltype(matcher);
+    auto replace_first = [&] {
+      if (input_col.has_nulls())
+        return replacement_values.has_nulls()
+                 ? replace_strings_first_pass<true, true, matcher_type>
+                 : replace_strings_first_pass<true, false, matcher_type>;
+      else
+        return replacement_values.has_nulls()
+                 ? replace_strings_first_pass<false, true, matcher_type>
+                 : replace_strings_first_pass<false, false, matcher_type>;
+    }();
+    replace_first<<<grid.num_blocks, BLOCK_SIZE, 0, stream.value()>>>(
+      *device_in,
+      matcher,
+      *device_replacement,
+      *device_sizes,
+      *device_indices,
+      reinterpret_cast<cudf::bitmask_type*>(valid_bits.data()),
+      valid_count);
+  });
 
   std::unique_ptr<cudf::column> offsets = cudf::strings::detail::make_offsets_child_column(
     sizes_view.begin<int32_t>(), sizes_view.end<int32_t>(), stream, mr);
@@ -424,6 +509,14 @@ std::unique_ptr<cudf::column> replace_kernel_forwarder::operator()<cudf::string_
   auto output_chars_view = output_chars->mutable_view();
   auto device_chars      = cudf::mutable_column_device_view::create(output_chars_view);
 
+  auto replace_second = [&] {
+    if (input_col.has_nulls())
+      return replacement_values.has_nulls() ? replace_strings_second_pass<true, true>
+                                            : replace_strings_second_pass<true, false>;
+    else
+      return replacement_values.has_nulls() ? replace_strings_second_pass<false, true>
+                                            : replace_strings_second_pass<false, false>;
+  }();
   replace_second<<<grid.num_blocks, BLOCK_SIZE, 0, stream.value()>>>(
     *device_in, *device_replacement, *device_offsets, *device_chars, *device_indices);
 
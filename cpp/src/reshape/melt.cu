@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+std::unique_ptr<table> melt(table_view const& id_columns,
+                            table_view const& value_columns,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(value_columns.num_columns() > 0, "Melt requires at least one value column");
+  CUDF_EXPECTS(id_columns.num_columns() == 0 or id_columns.num_rows() == value_columns.num_rows(),
+               "Id and value columns should have the same number of rows");
+
+  auto const num_rows          = value_columns.num_rows();
+  auto const num_value_columns = value_columns.num_columns();
+
+  // The ids of row `j * num_rows + i` are those of row `i`, as a tile of the id columns
+  auto output_columns = detail::tile(id_columns, num_value_columns, stream, mr)->release();
+
+  auto variables = make_numeric_column(data_type{type_to_id<size_type>()},
+                                       num_rows * num_value_columns,
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(variables->size()),
+                    variables->mutable_view().begin<size_type>(),
+                    [num_rows] __device__(size_type idx) { return idx / num_rows; });
+  output_columns.push_back(std::move(variables));
+
+  auto const values = std::vector<column_view>(value_columns.begin(), value_columns.end());
+  output_columns.push_back(detail::concatenate(values, stream, mr));
+
+  return std::make_unique<table>(std::move(output_columns));
+}
+}  // namespace detail
+
+std::unique_ptr<table> melt(table_view const& id_columns,
+                            table_view const& value_columns,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::melt(id_columns, value_columns, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> pivot(
+  table_view const& index,
+  column_view const& columns,
+  column_view const& values,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(index.num_columns() > 0, "Pivot requires at least one index column");
+  CUDF_EXPECTS(index.num_rows() == values.size() and columns.size() == values.size(),
+               "Index, columns and values should have the same number of rows");
+
+  auto index_helper  = groupby::detail::sort::sort_groupby_helper(index, null_policy::INCLUDE);
+  auto column_helper = groupby::detail::sort::sort_groupby_helper(table_view{{columns}},
+                                                                  null_policy::INCLUDE);
+
+  auto const num_index_groups  = index_helper.num_groups(stream);
+  auto const num_column_groups = column_helper.num_groups(stream);
+  CUDF_EXPECTS(static_cast<int64_t>(num_index_groups) * num_column_groups <=
+                 std::numeric_limits<size_type>::max(),
+               "Size of pivoted table exceeds the column size limit");
+
+  // The column of every row, in the order of the input
+  auto const column_order  = column_helper.key_sort_order(stream);
+  auto const& column_label = column_helper.group_labels(stream);
+  rmm::device_uvector<size_type> row_columns(values.size(), stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  column_label.begin(),
+                  column_label.end(),
+                  column_order.begin<size_type>(),
+                  row_columns.begin());
+
+  // The cells of the output, column by column, hold the row of their value, or an out of bounds
+  // row for a null
+  rmm::device_uvector<size_type> gather_map(num_index_groups * num_column_groups, stream);
+  thrust::fill(rmm::exec_policy(stream), gather_map.begin(), gather_map.end(), values.size());
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     values.size(),
+                     [index_order = index_helper.key_sort_order(stream).begin<size_type>(),
+                      index_label = index_helper.group_labels(stream).data(),
+                      row_columns = row_columns.data(),
+                      gather_map = gather_map.data(),
+                      num_index_groups] __device__(size_type idx) {
+                       auto const row = index_order[idx];
+                       gather_map[row_columns[row] * num_index_groups + index_label[idx]] = row;
+                     });
+
+  auto output_columns = index_helper.unique_keys(stream, mr)->release();
+  for (size_type col = 0; col < num_column_groups; ++col) {
+    auto const column_map = column_view(data_type{type_to_id<size_type>()},
+                                        num_index_groups,
+                                        gather_map.data() + col * num_index_groups);
+
+    auto gathered = detail::gather(table_view{{values}},
+                                   column_map,
+                                   out_of_bounds_policy::NULLIFY,
+                                   negative_index_policy::NOT_ALLOWED,
+                                   stream,
+                                   mr);
+    output_columns.push_back(std::move(gathered->release().front()));
+  }
+
+  auto column_keys = column_helper.unique_keys(stream, mr)->release();
+  return std::make_pair(std::make_unique<table>(std::move(output_columns)),
+                        std::move(column_keys.front()));
+}
+}  // namespace detail
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> pivot(
+  table_view const& index,
+  column_view const& columns,
+  column_view const& values,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::pivot(index, columns, values, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -23,6 +23,9 @@
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
 
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
 namespace cudf {
 
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
@@ -215,47 +218,118 @@ namespace {
 /**
  * @brief Add `delta` to value, and cap at numeric_limits::max(), for signed types.
  */
-template <typename T, std::enable_if_t<std::numeric_limits<T>::is_signed>* = nullptr>
+template <typename T,
+          std::enable_if_t<cuda::std::is_integral<T>::value &&
+                           cuda::std::numeric_limits<T>::is_signed>* = nullptr>
 __device__ T add_safe(T const& value, T const& delta)
 {
   // delta >= 0.
-  return (value < 0 || (std::numeric_limits<T>::max() - value) >= delta)
+  return (value < 0 || (cuda::std::numeric_limits<T>::max() - value) >= delta)
            ? (value + delta)
-           : std::numeric_limits<T>::max();
+           : cuda::std::numeric_limits<T>::max();
 }
 
 /**
  * @brief Add `delta` to value, and cap at numeric_limits::max(), for unsigned types.
  */
-template <typename T, std::enable_if_t<!std::numeric_limits<T>::is_signed>* = nullptr>
+template <typename T, std::enable_if_t<!cuda::std::numeric_limits<T>::is_signed>* = nullptr>
 __device__ T add_safe(T const& value, T const& delta)
 {
   // delta >= 0.
-  return ((std::numeric_limits<T>::max() - value) >= delta) ? (value + delta)
-                                                            : std::numeric_limits<T>::max();
+  return ((cuda::std::numeric_limits<T>::max() - value) >= delta)
+           ? (value + delta)
+           : cuda::std::numeric_limits<T>::max();
 }
 
 /**
  * @brief Subtract `delta` from value, and cap at numeric_limits::min(), for signed types.
  */
-template <typename T, std::enable_if_t<std::numeric_limits<T>::is_signed>* = nullptr>
+template <typename T,
+          std::enable_if_t<cuda::std::is_integral<T>::value &&
+                           cuda::std::numeric_limits<T>::is_signed>* = nullptr>
 __device__ T subtract_safe(T const& value, T const& delta)
 {
   // delta >= 0;
-  return (value >= 0 || (value - std::numeric_limits<T>::min()) >= delta)
+  return (value >= 0 || (value - cuda::std::numeric_limits<T>::min()) >= delta)
            ? (value - delta)
-           : std::numeric_limits<T>::min();
+           : cuda::std::numeric_limits<T>::min();
 }
 
 /**
  * @brief Subtract `delta` from value, and cap at numeric_limits::min(), for unsigned types.
  */
-template <typename T, std::enable_if_t<!std::numeric_limits<T>::is_signed>* = nullptr>
+template <typename T, std::enable_if_t<!cuda::std::numeric_limits<T>::is_signed>* = nullptr>
 __device__ T subtract_safe(T const& value, T const& delta)
 {
   // delta >= 0;
-  return ((value - std::numeric_limits<T>::min()) >= delta) ? (value - delta)
-                                                            : std::numeric_limits<T>::min();
+  return ((value - cuda::std::numeric_limits<T>::min()) >= delta)
+           ? (value - delta)
+           : cuda::std::numeric_limits<T>::min();
+}
+
+/**
+ * @brief Add `delta` to value, for floating-point types. Overflows saturate to infinity.
+ */
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+__device__ T add_safe(T const& value, T const& delta)
+{
+  return value + delta;
+}
+
+/**
+ * @brief Subtract `delta` from value, for floating-point types. Underflows saturate to -infinity.
+ */
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+__device__ T subtract_safe(T const& value, T const& delta)
+{
+  return value - delta;
+}
+
+/// The order-by column is sorted within each group, so the window of a row is a short run of
+/// rows around it. The searches below start at the current row and double their step, so each
+/// window bound takes O(log(window size)) probes of neighbouring rows rather than
+/// O(log(group size)) probes across the whole group.
+
+/**
+ * @brief Returns `thrust::lower_bound(thrust::seq, first, last, value, comp)`, searching
+ * backward from `last`.
+ */
+template <typename T, typename Comparator>
+__device__ T const* lower_bound_from_end(T const* first,
+                                         T const* last,
+                                         T const& value,
+                                         Comparator comp)
+{
+  // All rows in [high, last) compare not less than value.
+  auto high = last;
+  for (std::ptrdiff_t step = 1; high != first; step *= 2) {
+    auto const probe = (high - first) > step ? high - step : first;
+    if (comp(*probe, value)) {
+      return thrust::lower_bound(thrust::seq, probe + 1, high, value, comp);
+    }
+    high = probe;
+  }
+  return first;
+}
+
+/**
+ * @brief Returns `thrust::upper_bound(thrust::seq, first, last, value, comp)`, searching
+ * forward from `first`.
+ */
+template <typename T, typename Comparator>
+__device__ T const* upper_bound_from_begin(T const* first,
+                                           T const* last,
+                                           T const& value,
+                                           Comparator comp)
+{
+  // All rows in [first, low) compare not greater than value.
+  auto low = first;
+  for (std::ptrdiff_t step = 1; low != last; step *= 2) {
+    auto const probe = (last - low) > step ? low + step - 1 : last - 1;
+    if (comp(value, *probe)) { return thrust::upper_bound(thrust::seq, low, probe, value, comp); }
+    low = probe + 1;
+  }
+  return last;
 }
 
 /// Given a single, ungrouped order-by column, return the indices corresponding
@@ -340,10 +414,11 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
     auto group_start      = nulls_begin_idx == 0 ? nulls_end_idx : 0;
     auto lowest_in_window = subtract_safe(d_orderby[idx], preceding_window);
 
-    return ((d_orderby + idx) - thrust::lower_bound(thrust::seq,
-                                                    d_orderby + group_start,
-                                                    d_orderby + idx,
-                                                    lowest_in_window)) +
+    return ((d_orderby + idx) -
+            lower_bound_from_end(d_orderby + group_start,
+                                 d_orderby + idx,
+                                 lowest_in_window,
+                                 thrust::less<decltype(lowest_in_window)>())) +
            1;  // Add 1, for `preceding` to account for current row.
   };
 
@@ -372,8 +447,10 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
     auto group_end         = nulls_begin_idx == 0 ? num_rows : nulls_begin_idx;
     auto highest_in_window = add_safe(d_orderby[idx], following_window);
 
-    return (thrust::upper_bound(
-              thrust::seq, d_orderby + idx, d_orderby + group_end, highest_in_window) -
+    return (upper_bound_from_begin(d_orderby + idx,
+                                   d_orderby + group_end,
+                                   highest_in_window,
+                                   thrust::less<decltype(highest_in_window)>()) -
             (d_orderby + idx)) -
            1;
   };
@@ -504,10 +581,11 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
 
     auto lowest_in_window = subtract_safe(d_orderby[idx], preceding_window);
 
-    return ((d_orderby + idx) - thrust::lower_bound(thrust::seq,
-                                                    d_orderby + search_start,
-                                                    d_orderby + idx,
-                                                    lowest_in_window)) +
+    return ((d_orderby + idx) -
+            lower_bound_from_end(d_orderby + search_start,
+                                 d_orderby + idx,
+                                 lowest_in_window,
+                                 thrust::less<decltype(lowest_in_window)>())) +
            1;  // Add 1, for `preceding` to account for current row.
   };
 
@@ -547,8 +625,10 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
 
     auto highest_in_window = add_safe(d_orderby[idx], following_window);
 
-    return (thrust::upper_bound(
-              thrust::seq, d_orderby + idx, d_orderby + search_end, highest_in_window) -
+    return (upper_bound_from_begin(d_orderby + idx,
+                                   d_orderby + search_end,
+                                   highest_in_window,
+                                   thrust::less<decltype(highest_in_window)>()) -
             (d_orderby + idx)) -
            1;
   };
@@ -603,11 +683,10 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
     auto highest_in_window = add_safe(d_orderby[idx], preceding_window);
 
     return ((d_orderby + idx) -
-            thrust::lower_bound(thrust::seq,
-                                d_orderby + group_start,
-                                d_orderby + idx,
-                                highest_in_window,
-                                thrust::greater<decltype(highest_in_window)>())) +
+            lower_bound_from_end(d_orderby + group_start,
+                                 d_orderby + idx,
+                                 highest_in_window,
+                                 thrust::greater<decltype(highest_in_window)>())) +
            1;  // Add 1, for `preceding` to account for current row.
   };
 
@@ -636,11 +715,10 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
     auto group_end        = nulls_begin_idx == 0 ? num_rows : nulls_begin_idx;
     auto lowest_in_window = subtract_safe(d_orderby[idx], following_window);
 
-    return (thrust::upper_bound(thrust::seq,
-                                d_orderby + idx,
-                                d_orderby + group_end,
-                                lowest_in_window,
-                                thrust::greater<decltype(lowest_in_window)>()) -
+    return (upper_bound_from_begin(d_orderby + idx,
+                                   d_orderby + group_end,
+                                   lowest_in_window,
+                                   thrust::greater<decltype(lowest_in_window)>()) -
             (d_orderby + idx)) -
            1;
   };
@@ -701,11 +779,10 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
     auto highest_in_window = add_safe(d_orderby[idx], preceding_window);
 
     return ((d_orderby + idx) -
-            thrust::lower_bound(thrust::seq,
-                                d_orderby + search_start,
-                                d_orderby + idx,
-                                highest_in_window,
-                                thrust::greater<decltype(highest_in_window)>())) +
+            lower_bound_from_end(d_orderby + search_start,
+                                 d_orderby + idx,
+                                 highest_in_window,
+                                 thrust::greater<decltype(highest_in_window)>())) +
            1;  // Add 1, for `preceding` to account for current row.
   };
 
@@ -743,11 +820,10 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
 
     auto lowest_in_window = subtract_safe(d_orderby[idx], following_window);
 
-    return (thrust::upper_bound(thrust::seq,
-                                d_orderby + idx,
-                                d_orderby + search_end,
-                                lowest_in_window,
-                                thrust::greater<decltype(lowest_in_window)>()) -
+    return (upper_bound_from_begin(d_orderby + idx,
+                                   d_orderby + search_end,
+                                   lowest_in_window,
+                                   thrust::greater<decltype(lowest_in_window)>()) -
             (d_orderby + idx)) -
            1;
   };
@@ -776,6 +852,16 @@ std::unique_ptr<column> grouped_range_rolling_window_impl(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
+  if constexpr (cudf::is_fixed_point<OrderByT>()) {
+    // Decimal bounds are compared with the order-by values without rescaling.
+    auto const has_orderby_scale = [&orderby_column](range_window_bounds const& bounds) {
+      return bounds.is_unbounded() ||
+             bounds.range_scalar().type().scale() == orderby_column.type().scale();
+    };
+    CUDF_EXPECTS(has_orderby_scale(preceding_window) && has_orderby_scale(following_window),
+                 "Decimal range bounds must have the scale of the orderby column.");
+  }
+
   auto preceding_value = detail::range_comparable_value<OrderByT>(preceding_window);
   auto following_value = detail::range_comparable_value<OrderByT>(following_window);
 
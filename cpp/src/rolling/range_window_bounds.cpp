@@ -35,7 +35,7 @@ struct range_scalar_constructor {
   {
     CUDF_FAIL(
       "Unsupported range type. "
-      "Only Durations and non-boolean integral range types are allowed.");
+      "Only Durations, decimals and non-boolean numeric range types are allowed.");
   }
 
   template <typename T, std::enable_if_t<cudf::is_duration<T>(), void>* = nullptr>
@@ -46,12 +46,21 @@ struct range_scalar_constructor {
   }
 
   template <typename T,
-            std::enable_if_t<std::is_integral<T>::value && !cudf::is_boolean<T>(), void>* = nullptr>
+            std::enable_if_t<(std::is_integral<T>::value && !cudf::is_boolean<T>()) ||
+                               std::is_floating_point<T>::value,
+                             void>* = nullptr>
   std::unique_ptr<scalar> operator()(scalar const& range_scalar_) const
   {
     return std::make_unique<numeric_scalar<T>>(
       static_cast<numeric_scalar<T> const&>(range_scalar_));
   }
+
+  template <typename T, std::enable_if_t<cudf::is_fixed_point<T>(), void>* = nullptr>
+  std::unique_ptr<scalar> operator()(scalar const& range_scalar_) const
+  {
+    return std::make_unique<fixed_point_scalar<T>>(
+      static_cast<fixed_point_scalar<T> const&>(range_scalar_));
+  }
 };
 
 }  // namespace
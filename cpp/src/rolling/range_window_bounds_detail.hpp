@@ -18,6 +18,7 @@
 #include <cudf/rolling/range_window_bounds.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/wrappers/durations.hpp>
 
 namespace cudf {
@@ -27,7 +28,8 @@ namespace detail {
 template <typename RangeType>
 constexpr bool is_supported_range_type()
 {
-  return cudf::is_duration<RangeType>() ||
+  return cudf::is_duration<RangeType>() || cudf::is_fixed_point<RangeType>() ||
+         std::is_floating_point<RangeType>::value ||
          (std::is_integral<RangeType>::value && !cudf::is_boolean<RangeType>());
 }
 
@@ -36,18 +38,22 @@ constexpr bool is_supported_range_type()
 template <typename ColumnType>
 constexpr bool is_supported_order_by_column_type()
 {
-  return cudf::is_timestamp<ColumnType>() ||
+  return cudf::is_timestamp<ColumnType>() || cudf::is_fixed_point<ColumnType>() ||
+         std::is_floating_point<ColumnType>::value ||
          (std::is_integral<ColumnType>::value && !cudf::is_boolean<ColumnType>());
 }
 
 /// Range-comparable representation type for an orderby column type.
 /// This is the datatype used for range comparisons.
-///   1. For integral orderby column types `T`, comparisons are done as `T`.
+///   1. For integral and floating-point orderby column types `T`, comparisons are done as `T`.
 ///      E.g. `range_type_for<int32_t>` == `int32_t`.
 ///   2. For timestamp orderby columns:
 ///      a. For `TIMESTAMP_DAYS`, the range-type is `DURATION_DAYS`.
 ///         Comparisons are done in `int32_t`.
 ///      b. For all other timestamp types, comparisons are done in `int64_t`.
+///   3. For decimal orderby columns, the range-type is the same decimal type.
+///      Comparisons are done on the representation type, e.g. `int32_t` for `DECIMAL32`,
+///      so the range scalar must have the scale of the orderby column.
 template <typename ColumnType, typename = void>
 struct range_type_impl {
   using type     = void;
@@ -57,11 +63,20 @@ struct range_type_impl {
 template <typename ColumnType>
 struct range_type_impl<
   ColumnType,
-  std::enable_if_t<std::is_integral<ColumnType>::value && !cudf::is_boolean<ColumnType>(), void>> {
+  std::enable_if_t<(std::is_integral<ColumnType>::value && !cudf::is_boolean<ColumnType>()) ||
+                     std::is_floating_point<ColumnType>::value,
+                   void>> {
   using type     = ColumnType;
   using rep_type = ColumnType;
 };
 
+template <typename FixedPointType>
+struct range_type_impl<FixedPointType,
+                       std::enable_if_t<cudf::is_fixed_point<FixedPointType>(), void>> {
+  using type     = FixedPointType;
+  using rep_type = typename FixedPointType::rep;
+};
+
 template <typename TimestampType>
 struct range_type_impl<TimestampType, std::enable_if_t<cudf::is_timestamp<TimestampType>(), void>> {
   using type     = typename TimestampType::duration;
@@ -84,10 +99,11 @@ void assert_non_negative(T const& value)
   }
 }
 
-template <
-  typename RangeT,
-  typename RepT,
-  std::enable_if_t<std::is_integral<RangeT>::value && !cudf::is_boolean<RangeT>(), void>* = nullptr>
+template <typename RangeT,
+          typename RepT,
+          std::enable_if_t<(std::is_integral<RangeT>::value && !cudf::is_boolean<RangeT>()) ||
+                             std::is_floating_point<RangeT>::value,
+                           void>* = nullptr>
 RepT range_comparable_value_impl(scalar const& range_scalar, rmm::cuda_stream_view stream)
 {
   auto val = static_cast<numeric_scalar<RangeT> const&>(range_scalar).value(stream);
@@ -105,6 +121,16 @@ RepT range_comparable_value_impl(scalar const& range_scalar, rmm::cuda_stream_vi
   return val;
 }
 
+template <typename RangeT,
+          typename RepT,
+          std::enable_if_t<cudf::is_fixed_point<RangeT>(), void>* = nullptr>
+RepT range_comparable_value_impl(scalar const& range_scalar, rmm::cuda_stream_view stream)
+{
+  auto val = static_cast<fixed_point_scalar<RangeT> const&>(range_scalar).value(stream);
+  assert_non_negative(val);
+  return val;
+}
+
 }  // namespace
 
 /**
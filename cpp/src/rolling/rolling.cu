@@ -15,6 +15,10 @@
  */
 
 #include "rolling_detail.cuh"
+#include "rolling_multi_aggregation.cuh"
+
+#include <algorithm>
+#include <vector>
 
 namespace cudf {
 
@@ -33,6 +37,48 @@ std::unique_ptr<column> rolling_window(column_view const& input,
 }
 
 namespace detail {
+namespace {
+
+/**
+ * @brief Computes several aggregations over the same windows.
+ *
+ * The aggregations are computed in a single pass over the windows when
+ * `multi_aggregation::dispatch_multi_aggregation_rolling` supports them, otherwise each of them is
+ * computed by `single_rolling_window`.
+ */
+template <typename PrecedingWindowIterator,
+          typename FollowingWindowIterator,
+          typename SingleRollingWindow>
+std::vector<std::unique_ptr<column>> rolling_window_aggregations(
+  column_view const& input,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  SingleRollingWindow single_rolling_window,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (!input.is_empty() && !cudf::is_dictionary(input.type())) {
+    auto results =
+      cudf::type_dispatcher(input.type(),
+                            multi_aggregation::dispatch_multi_aggregation_rolling{},
+                            input,
+                            preceding_window_begin,
+                            following_window_begin,
+                            std::max(min_periods, 0),
+                            aggs,
+                            stream,
+                            mr);
+    if (!results.empty()) { return results; }
+  }
+
+  std::vector<std::unique_ptr<column>> results(aggs.size());
+  std::transform(aggs.begin(), aggs.end(), results.begin(), single_rolling_window);
+  return results;
+}
+
+}  // namespace
 
 // Applies a fixed-size rolling window function to the values in a column.
 std::unique_ptr<column> rolling_window(column_view const& input,
@@ -122,6 +168,81 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   }
 }
 
+// Applies several fixed-size rolling window functions to the values in a column.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(input.is_empty() || min_periods >= 0, "min_periods must be non-negative");
+
+  auto defaults =
+    cudf::is_dictionary(input.type()) ? dictionary_column_view(input).indices() : input;
+  auto const default_outputs = empty_like(defaults);
+  return rolling_window_aggregations(
+    input,
+    thrust::make_constant_iterator(preceding_window),
+    thrust::make_constant_iterator(following_window),
+    min_periods,
+    aggs,
+    [&](auto const& agg) {
+      return rolling_window(input,
+                            default_outputs->view(),
+                            preceding_window,
+                            following_window,
+                            min_periods,
+                            agg,
+                            stream,
+                            mr);
+    },
+    stream,
+    mr);
+}
+
+// Applies several variable-size rolling window functions to the values in a column.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto const single_rolling_window = [&](auto const& agg) {
+    return rolling_window(input, preceding_window, following_window, min_periods, agg, stream, mr);
+  };
+  if (preceding_window.is_empty() || following_window.is_empty() || input.is_empty()) {
+    std::vector<std::unique_ptr<column>> results(aggs.size());
+    std::transform(aggs.begin(), aggs.end(), results.begin(), single_rolling_window);
+    return results;
+  }
+
+  CUDF_EXPECTS(preceding_window.type().id() == type_id::INT32 &&
+                 following_window.type().id() == type_id::INT32,
+               "preceding_window/following_window must have type_id::INT32 type");
+
+  CUDF_EXPECTS(preceding_window.size() == input.size() && following_window.size() == input.size(),
+               "preceding_window/following_window size must match input size");
+
+  return rolling_window_aggregations(input,
+                                     preceding_window.begin<size_type>(),
+                                     following_window.begin<size_type>(),
+                                     min_periods,
+                                     aggs,
+                                     single_rolling_window,
+                                     stream,
+                                     mr);
+}
+
 }  // namespace detail
 
 // Applies a fixed-size rolling window function to the values in a column.
@@ -155,4 +276,35 @@ std::unique_ptr<column> rolling_window(column_view const& input,
     input, preceding_window, following_window, min_periods, agg, rmm::cuda_stream_default, mr);
 }
 
+// Applies several fixed-size rolling window functions to the values in a column.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  return detail::rolling_window(input,
+                                preceding_window,
+                                following_window,
+                                min_periods,
+                                aggs,
+                                rmm::cuda_stream_default,
+                                mr);
+}
+
+// Applies several variable-size rolling window functions to the values in a column.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  return detail::rolling_window(
+    input, preceding_window, following_window, min_periods, aggs, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
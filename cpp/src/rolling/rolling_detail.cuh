@@ -17,6 +17,8 @@
 #pragma once
 
 #include "rolling_detail.hpp"
+#include "rolling_large_window.cuh"
+#include "rolling_quantile.cuh"
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column_device_view.cuh>
@@ -58,6 +60,7 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <cmath>
 #include <memory>
 
 namespace cudf {
@@ -254,6 +257,55 @@ process_rolling_window(column_device_view input,
   return !is_null;
 }
 
+/**
+ * @brief VARIANCE/STD(ddof): returns the variance or the standard deviation of the valid rows
+ *        of the window, with `count - ddof` degrees of freedom.
+ *
+ * The moments are accumulated with Welford's online algorithm so that windows of large values
+ * with a small spread do not lose their precision to the cancellation of a sum of squares.
+ * The output is null if the window has fewer than `min_periods` valid rows or if it has no
+ * more valid rows than `ddof`.
+ */
+template <typename InputType,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          bool has_nulls>
+std::enable_if_t<(op == aggregation::VARIANCE || op == aggregation::STD) &&
+                   (cudf::is_numeric<InputType>()),
+                 bool> __device__
+process_rolling_window(column_device_view input,
+                       column_device_view ignored_default_outputs,
+                       mutable_column_device_view output,
+                       size_type start_index,
+                       size_type end_index,
+                       size_type current_index,
+                       size_type min_periods,
+                       agg_op device_agg_op)
+{
+  size_type count = 0;
+  OutputType mean = 0;
+  OutputType m2   = 0;
+
+  for (size_type j = start_index; j < end_index; j++) {
+    if (!has_nulls || input.is_valid(j)) {
+      auto const element = static_cast<OutputType>(input.element<InputType>(j));
+      auto const delta   = element - mean;
+      count++;
+      mean += delta / count;
+      m2 += delta * (element - mean);
+    }
+  }
+
+  bool output_is_valid = (count >= min_periods) && (count > device_agg_op.ddof);
+  if (output_is_valid) {
+    auto const variance = m2 / (count - device_agg_op.ddof);
+    output.element<OutputType>(current_index) =
+      (op == aggregation::STD) ? std::sqrt(variance) : variance;
+  }
+  return output_is_valid;
+}
+
 /**
  * @brief Only used for `string_view` type to get ARGMIN and ARGMAX, which
  *        will be used to gather MIN and MAX. And returns true if the
@@ -810,7 +862,9 @@ struct rolling_window_launcher {
             typename PrecedingWindowIterator,
             typename FollowingWindowIterator>
   std::enable_if_t<!(op == aggregation::MEAN || op == aggregation::LEAD || op == aggregation::LAG ||
-                     op == aggregation::COLLECT_LIST),
+                     op == aggregation::COLLECT_LIST || op == aggregation::VARIANCE ||
+                     op == aggregation::STD || op == aggregation::MEDIAN ||
+                     op == aggregation::QUANTILE),
                    std::unique_ptr<column>>
   operator()(column_view const& input,
              column_view const& default_outputs,
@@ -892,6 +946,94 @@ struct rolling_window_launcher {
       mr);
   }
 
+  // This variant is just to handle variance and standard deviation
+  template <aggregation::Kind op,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator>
+  std::enable_if_t<(op == aggregation::VARIANCE || op == aggregation::STD),
+                   std::unique_ptr<column>>
+  operator()(column_view const& input,
+             column_view const& default_outputs,
+             PrecedingWindowIterator preceding_window_begin,
+             FollowingWindowIterator following_window_begin,
+             size_type min_periods,
+             std::unique_ptr<aggregation> const& agg,
+             rmm::cuda_stream_view stream,
+             rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(default_outputs.is_empty(),
+                 "Only LEAD/LAG window functions support default values.");
+
+    if constexpr (cudf::detail::is_rolling_supported<InputType, cudf::DeviceStdVar, op>()) {
+      auto output = make_fixed_width_column(
+        target_type(input.type(), op), input.size(), mask_state::UNINITIALIZED, stream, mr);
+
+      cudf::mutable_column_view output_view = output->mutable_view();
+      auto valid_count =
+        kernel_launcher<InputType,
+                        cudf::DeviceStdVar,
+                        op,
+                        PrecedingWindowIterator,
+                        FollowingWindowIterator>(
+          input,
+          default_outputs,
+          output_view,
+          preceding_window_begin,
+          following_window_begin,
+          min_periods,
+          agg,
+          cudf::DeviceStdVar{static_cast<cudf::detail::std_var_aggregation*>(agg.get())->_ddof},
+          stream);
+
+      output->set_null_count(output->size() - valid_count);
+
+      return output;
+    } else {
+      CUDF_FAIL("Aggregation operator and/or input type combination is invalid");
+    }
+  }
+
+  // This variant is just to handle median and quantile
+  template <aggregation::Kind op,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator>
+  std::enable_if_t<(op == aggregation::MEDIAN || op == aggregation::QUANTILE),
+                   std::unique_ptr<column>>
+  operator()(column_view const& input,
+             column_view const& default_outputs,
+             PrecedingWindowIterator preceding_window_begin,
+             FollowingWindowIterator following_window_begin,
+             size_type min_periods,
+             std::unique_ptr<aggregation> const& agg,
+             rmm::cuda_stream_view stream,
+             rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(default_outputs.is_empty(),
+                 "Only LEAD/LAG window functions support default values.");
+
+    if constexpr (cudf::detail::is_rolling_supported<InputType, cudf::DeviceMin, op>()) {
+      auto quantile = 0.5;
+      auto interp   = interpolation::LINEAR;
+      if (op == aggregation::QUANTILE) {
+        auto const quantile_agg = static_cast<cudf::detail::quantile_aggregation*>(agg.get());
+        CUDF_EXPECTS(quantile_agg->_quantiles.size() == 1,
+                     "Rolling QUANTILE supports exactly one quantile");
+        quantile = quantile_agg->_quantiles.front();
+        interp   = quantile_agg->_interpolation;
+      }
+      return rolling_quantile<InputType>(input,
+                                         preceding_window_begin,
+                                         following_window_begin,
+                                         min_periods,
+                                         quantile,
+                                         interp,
+                                         stream,
+                                         mr);
+    } else {
+      CUDF_FAIL("Aggregation operator and/or input type combination is invalid");
+    }
+  }
+
   /**
    * @brief Creates the offsets child of the result of the `COLLECT_LIST` window aggregation
    *
@@ -1349,6 +1491,20 @@ std::unique_ptr<column> rolling_window(column_view const& input,
 
   min_periods = std::max(min_periods, 0);
 
+  // Large windows of SUM, MEAN, COUNT_VALID, MIN and MAX are aggregated in O(1) time per row
+  if (!cudf::is_dictionary(input.type())) {
+    auto output = cudf::type_dispatcher(input.type(),
+                                        large_window::dispatch_large_window_rolling{},
+                                        input,
+                                        preceding_window_begin,
+                                        following_window_begin,
+                                        min_periods,
+                                        agg->kind,
+                                        stream,
+                                        mr);
+    if (output) { return output; }
+  }
+
   auto input_col = cudf::is_dictionary(input.type())
                      ? dictionary_column_view(input).get_indices_annotated()
                      : input;
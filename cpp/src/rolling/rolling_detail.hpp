@@ -48,7 +48,12 @@ static constexpr bool is_rolling_supported()
        is_comparable_countable_op) and
       is_operation_supported;
 
-    return is_valid_numeric_agg;
+    constexpr bool is_valid_statistic_agg =
+      cudf::is_numeric<ColumnType>() and
+      ((op == aggregation::VARIANCE) or (op == aggregation::STD) or (op == aggregation::MEDIAN) or
+       (op == aggregation::QUANTILE));
+
+    return is_valid_numeric_agg or is_valid_statistic_agg;
 
   } else if (cudf::is_timestamp<ColumnType>()) {
     return (op == aggregation::MIN) or (op == aggregation::MAX) or
@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rolling_detail.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/extrema.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <memory>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace large_window {
+
+/**
+ * @brief Windows of at least this many rows are aggregated in O(1) time per row.
+ *
+ * Below it, aggregating the rows of each window directly is faster than preparing the prefix
+ * sums or range tables.
+ */
+constexpr size_type window_size_threshold = 128;
+
+/**
+ * @brief Number of rows of the blocks of the MIN/MAX range tables.
+ */
+constexpr size_type block_size = 32;
+
+/**
+ * @brief Computes the rows [start, end) of the window of a row, as `gpu_rolling` does.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+struct window_bounds_fn {
+  PrecedingWindowIterator preceding_window_begin;
+  FollowingWindowIterator following_window_begin;
+  size_type num_rows;
+
+  __device__ thrust::pair<size_type, size_type> operator()(size_type i) const
+  {
+    size_type preceding_window = preceding_window_begin[i];
+    size_type following_window = following_window_begin[i];
+    auto const start = thrust::min(num_rows, thrust::max(0, i - preceding_window + 1));
+    auto const end   = thrust::min(num_rows, thrust::max(0, i + following_window + 1));
+    return {thrust::min(start, end), thrust::max(start, end)};
+  }
+};
+
+/**
+ * @brief Returns the number of rows of the largest window.
+ */
+template <typename WindowBounds>
+size_type max_window_size(WindowBounds bounds, size_type num_rows, rmm::cuda_stream_view stream)
+{
+  return thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [bounds] __device__(size_type i) {
+      auto const window = bounds(i);
+      return window.second - window.first;
+    },
+    size_type{0},
+    thrust::maximum<size_type>{});
+}
+
+/**
+ * @brief Returns the exclusive prefix sums of `num_rows` values, with the total in the last of
+ * the `num_rows + 1` elements.
+ */
+template <typename T, typename ValueFn>
+rmm::device_uvector<T> prefix_sums(ValueFn value, size_type num_rows, rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<T> sums(num_rows + 1, stream);
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows + 1),
+    sums.begin(),
+    [value, num_rows] __device__(size_type i) { return i < num_rows ? value(i) : T{0}; },
+    T{0},
+    thrust::plus<T>{});
+  return sums;
+}
+
+/**
+ * @brief Returns the number of valid rows of the window of a row.
+ */
+template <typename WindowBounds>
+struct valid_count_fn {
+  WindowBounds bounds;
+  size_type const* valid_sums;  // Null if the input has no nulls
+
+  __device__ size_type operator()(size_type i) const
+  {
+    auto const window = bounds(i);
+    return valid_sums != nullptr ? valid_sums[window.second] - valid_sums[window.first]
+                                 : window.second - window.first;
+  }
+};
+
+/**
+ * @brief Computes SUM or MEAN of the windows from the prefix sums of the input.
+ *
+ * The sums are accumulated as unsigned integers so that they wrap around like the `int64_t` sums
+ * of the rows of each window do.
+ */
+template <typename OutputType, bool is_mean, typename WindowBounds>
+struct window_sum_fn {
+  WindowBounds bounds;
+  uint64_t const* sums;
+  valid_count_fn<WindowBounds> valid_count;
+
+  __device__ OutputType operator()(size_type i) const
+  {
+    auto const window = bounds(i);
+    auto const sum    = static_cast<int64_t>(sums[window.second] - sums[window.first]);
+    if constexpr (is_mean) {
+      return static_cast<OutputType>(sum) / valid_count(i);
+    } else {
+      return static_cast<OutputType>(sum);
+    }
+  }
+};
+
+/**
+ * @brief Computes MIN or MAX of ranges of rows in O(1) time.
+ *
+ * The rows are split in blocks of `block_size` rows. A range is the suffix of its first block,
+ * the prefix of its last block and the blocks in between, whose aggregate is looked up in a
+ * sparse table of the aggregates of the power-of-two sized ranges of blocks. Ranges within a block
+ * are aggregated row by row.
+ */
+template <typename T, typename Op>
+struct range_aggregate_fn {
+  T const* values;        // The input with nulls replaced by the identity of `Op`
+  T const* block_prefix;  // The aggregates of the rows of each block up to each row
+  T const* block_suffix;  // The aggregates of the rows of each block from each row
+  T const* block_table;   // Level `k` holds the aggregates of the ranges of 2^k blocks
+  size_type num_blocks;
+
+  __device__ T operator()(size_type start, size_type end) const
+  {
+    auto result = Op::template identity<T>();
+    if (start >= end) { return result; }
+    auto const first_block = start / block_size;
+    auto const last_block  = (end - 1) / block_size;
+    if (first_block == last_block) {
+      for (auto j = start; j < end; ++j) {
+        result = Op{}(values[j], result);
+      }
+      return result;
+    }
+    result                  = Op{}(block_suffix[start], block_prefix[end - 1]);
+    auto const inner_blocks = last_block - first_block - 1;
+    if (inner_blocks > 0) {
+      auto const level       = 31 - __clz(inner_blocks);
+      auto const level_table = block_table + level * num_blocks;
+      result =
+        Op{}(result, Op{}(level_table[first_block + 1], level_table[last_block - (1 << level)]));
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief Builds the tables of `range_aggregate_fn` and computes MIN or MAX of the windows.
+ */
+template <typename T, typename Op, typename WindowBounds>
+void window_min_max(column_device_view const& d_input,
+                    WindowBounds bounds,
+                    mutable_column_view& output,
+                    rmm::cuda_stream_view stream)
+{
+  auto const num_rows   = d_input.size();
+  auto const num_blocks = (num_rows + block_size - 1) / block_size;
+  auto const aggregate  = [] __device__(T lhs, T rhs) { return Op{}(lhs, rhs); };
+
+  rmm::device_uvector<T> values(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    values.begin(),
+                    [d_input] __device__(size_type i) {
+                      return d_input.is_valid(i) ? d_input.element<T>(i)
+                                                 : Op::template identity<T>();
+                    });
+
+  // aggregate the rows of each block forward and backward
+  auto const block_keys = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [] __device__(size_type i) { return i / block_size; });
+  rmm::device_uvector<T> block_prefix(num_rows, stream);
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                block_keys,
+                                block_keys + num_rows,
+                                values.begin(),
+                                block_prefix.begin(),
+                                thrust::equal_to<size_type>{},
+                                aggregate);
+  rmm::device_uvector<T> block_suffix(num_rows, stream);
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                thrust::make_reverse_iterator(block_keys + num_rows),
+                                thrust::make_reverse_iterator(block_keys),
+                                thrust::make_reverse_iterator(values.end()),
+                                thrust::make_reverse_iterator(block_suffix.end()),
+                                thrust::equal_to<size_type>{},
+                                aggregate);
+
+  // level 0 holds the aggregate of each block and level k combines two ranges of level k - 1
+  size_type num_levels = 1;
+  while ((size_type{1} << num_levels) <= num_blocks) {
+    ++num_levels;
+  }
+  rmm::device_uvector<T> block_table(num_levels * num_blocks, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_blocks),
+                    block_table.begin(),
+                    [d_block_prefix = block_prefix.data(), num_rows] __device__(size_type block) {
+                      return d_block_prefix[thrust::min(num_rows, (block + 1) * block_size) - 1];
+                    });
+  for (size_type level = 1; level < num_levels; ++level) {
+    auto const d_previous_level = block_table.data() + (level - 1) * num_blocks;
+    auto const half             = size_type{1} << (level - 1);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_blocks),
+                      block_table.begin() + level * num_blocks,
+                      [d_previous_level, half, num_blocks] __device__(size_type block) {
+                        return Op{}(d_previous_level[block],
+                                    d_previous_level[thrust::min(block + half, num_blocks - 1)]);
+                      });
+  }
+
+  auto const range_aggregate = range_aggregate_fn<T, Op>{
+    values.data(), block_prefix.data(), block_suffix.data(), block_table.data(), num_blocks};
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    output.begin<T>(),
+                    [bounds, range_aggregate] __device__(size_type i) {
+                      auto const window = bounds(i);
+                      return range_aggregate(window.first, window.second);
+                    });
+}
+
+/**
+ * @brief Computes SUM, MEAN, COUNT_VALID, MIN and MAX rolling aggregations of large windows.
+ *
+ * The result of each row is computed in O(1) time: SUM, MEAN and COUNT_VALID from prefix sums of
+ * the input, and MIN and MAX from the tables of `range_aggregate_fn`. The results match those of
+ * `gpu_rolling`, including the validity for `min_periods`.
+ *
+ * SUM is supported for integral types, MEAN for integral types of up to 4 bytes, whose sums are
+ * exact, and MIN and MAX for numeric and chrono types. The floating-point sums are not computed
+ * from prefix sums, whose differences would lose precision.
+ */
+struct dispatch_large_window_rolling {
+  template <typename T, aggregation::Kind kind>
+  static constexpr bool is_rolling_supported()
+  {
+    return cudf::detail::
+      is_rolling_supported<T, typename corresponding_operator<kind>::type, kind>();
+  }
+
+  template <typename T>
+  static constexpr bool is_sum_supported()
+  {
+    return std::is_integral_v<T> and is_rolling_supported<T, aggregation::SUM>();
+  }
+
+  template <typename T>
+  static constexpr bool is_mean_supported()
+  {
+    return std::is_integral_v<T> and sizeof(T) <= 4 and
+           cudf::detail::is_rolling_supported<T, DeviceSum, aggregation::MEAN>();
+  }
+
+  template <typename T>
+  static constexpr bool is_min_max_supported()
+  {
+    return (cudf::is_numeric<T>() or cudf::is_chrono<T>()) and
+           is_rolling_supported<T, aggregation::MIN>() and
+           is_rolling_supported<T, aggregation::MAX>();
+  }
+
+  template <typename T>
+  static constexpr bool is_count_supported()
+  {
+    return is_rolling_supported<T, aggregation::COUNT_VALID>();
+  }
+
+  /**
+   * @brief Returns the aggregated column, or nullptr if the aggregation of the type is not
+   * supported.
+   */
+  template <typename T, typename PrecedingWindowIterator, typename FollowingWindowIterator>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     PrecedingWindowIterator preceding_window_begin,
+                                     FollowingWindowIterator following_window_begin,
+                                     size_type min_periods,
+                                     aggregation::Kind kind,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const is_supported =
+      (kind == aggregation::SUM && is_sum_supported<T>()) ||
+      (kind == aggregation::MEAN && is_mean_supported<T>()) ||
+      ((kind == aggregation::MIN || kind == aggregation::MAX) && is_min_max_supported<T>()) ||
+      (kind == aggregation::COUNT_VALID && is_count_supported<T>() && input.has_nulls());
+    if (!is_supported) { return nullptr; }
+
+    auto const num_rows = input.size();
+    auto const bounds   = window_bounds_fn<PrecedingWindowIterator, FollowingWindowIterator>{
+      preceding_window_begin, following_window_begin, num_rows};
+    if (max_window_size(bounds, num_rows, stream) < window_size_threshold) { return nullptr; }
+
+    // the valid rows of the windows are counted from prefix sums if the input has nulls
+    auto const d_input = column_device_view::create(input, stream);
+    rmm::device_uvector<size_type> valid_sums(0, stream);
+    if (input.has_nulls()) {
+      valid_sums = prefix_sums<size_type>(
+        [d_input = *d_input] __device__(size_type i) {
+          return static_cast<size_type>(d_input.is_valid_nocheck(i));
+        },
+        num_rows,
+        stream);
+    }
+    auto const valid_count = valid_count_fn<decltype(bounds)>{
+      bounds, input.has_nulls() ? valid_sums.data() : nullptr};
+
+    auto output = make_fixed_width_column(
+      target_type(input.type(), kind), num_rows, mask_state::UNALLOCATED, stream, mr);
+    auto output_view = output->mutable_view();
+
+    if (kind == aggregation::COUNT_VALID) {
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_rows),
+                        output_view.begin<size_type>(),
+                        valid_count);
+    } else if (kind == aggregation::SUM || kind == aggregation::MEAN) {
+      if constexpr (is_sum_supported<T>()) {
+        auto const sums = prefix_sums<uint64_t>(
+          [d_input = *d_input] __device__(size_type i) {
+            return d_input.is_valid(i) ? static_cast<uint64_t>(d_input.element<T>(i))
+                                       : uint64_t{0};
+          },
+          num_rows,
+          stream);
+        if (kind == aggregation::SUM) {
+          using OutputType = target_type_t<T, aggregation::SUM>;
+          thrust::transform(
+            rmm::exec_policy(stream),
+            thrust::make_counting_iterator<size_type>(0),
+            thrust::make_counting_iterator<size_type>(num_rows),
+            output_view.begin<OutputType>(),
+            window_sum_fn<OutputType, false, decltype(bounds)>{bounds, sums.data(), valid_count});
+        } else {
+          using OutputType = target_type_t<T, aggregation::MEAN>;
+          thrust::transform(
+            rmm::exec_policy(stream),
+            thrust::make_counting_iterator<size_type>(0),
+            thrust::make_counting_iterator<size_type>(num_rows),
+            output_view.begin<OutputType>(),
+            window_sum_fn<OutputType, true, decltype(bounds)>{bounds, sums.data(), valid_count});
+        }
+      }
+    } else if constexpr (is_min_max_supported<T>()) {
+      if (kind == aggregation::MIN) {
+        window_min_max<T, DeviceMin>(*d_input, bounds, output_view, stream);
+      } else {
+        window_min_max<T, DeviceMax>(*d_input, bounds, output_view, stream);
+      }
+    }
+
+    // COUNT_VALID is valid for windows of `min_periods` rows, the others for windows of
+    // `min_periods` valid rows
+    auto const count_rows = kind == aggregation::COUNT_VALID;
+    auto [null_mask, null_count] =
+      valid_if(thrust::make_counting_iterator<size_type>(0),
+               thrust::make_counting_iterator<size_type>(num_rows),
+               [bounds, valid_count, count_rows, min_periods] __device__(size_type i) {
+                 auto const window = bounds(i);
+                 auto const count  = count_rows ? window.second - window.first : valid_count(i);
+                 return count >= min_periods;
+               },
+               stream,
+               mr);
+    output->set_null_mask(std::move(null_mask), null_count);
+    return output;
+  }
+};
+
+}  // namespace large_window
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rolling_large_window.cuh"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace multi_aggregation {
+
+/**
+ * @brief Indicates whether an aggregation is computed by the single pass over the windows.
+ */
+inline bool is_fused_aggregation(aggregation::Kind kind)
+{
+  return kind == aggregation::SUM || kind == aggregation::MIN || kind == aggregation::MAX ||
+         kind == aggregation::COUNT_VALID || kind == aggregation::COUNT_ALL ||
+         kind == aggregation::MEAN;
+}
+
+/**
+ * @brief Output buffers of the aggregations computed by `gpu_rolling_multi`.
+ *
+ * The buffer of an aggregation that was not requested is null.
+ */
+template <typename T>
+struct window_outputs {
+  using sum_type  = target_type_t<T, aggregation::SUM>;
+  using mean_type = target_type_t<T, aggregation::MEAN>;
+
+  sum_type* sum{};
+  T* min{};
+  T* max{};
+  size_type* count_valid{};
+  size_type* count_all{};
+  mean_type* mean{};
+};
+
+/**
+ * @brief Computes SUM, MIN, MAX, COUNT_VALID, COUNT_ALL and MEAN of the windows in one pass.
+ *
+ * The rows of each window are read once and the requested results are written to `outputs`.
+ * The counts are valid for windows of at least `min_periods` rows and are recorded in
+ * `rows_mask`; the other results are valid for windows of at least `min_periods` valid rows and
+ * are recorded in `valid_rows_mask`.
+ *
+ * @param input Input column device view
+ * @param bounds Computes the rows [start, end) of the window of a row
+ * @param outputs Output buffers of the requested aggregations
+ * @param min_periods Minimum number of observations in a window required for a valid result
+ * @param rows_mask Validity of the count results
+ * @param valid_rows_mask Validity of the other results
+ * @param valid_counts The number of valid count results and of valid other results
+ */
+template <typename T, int block_size, bool has_nulls, typename WindowBounds>
+__launch_bounds__(block_size) __global__
+  void gpu_rolling_multi(column_device_view input,
+                         WindowBounds bounds,
+                         window_outputs<T> outputs,
+                         size_type min_periods,
+                         bitmask_type* rows_mask,
+                         bitmask_type* valid_rows_mask,
+                         size_type* __restrict__ valid_counts)
+{
+  using sum_type  = typename window_outputs<T>::sum_type;
+  using mean_type = typename window_outputs<T>::mean_type;
+
+  size_type i      = blockIdx.x * block_size + threadIdx.x;
+  size_type stride = block_size * gridDim.x;
+
+  size_type warp_rows_count{0};
+  size_type warp_valid_rows_count{0};
+
+  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
+  while (i < input.size()) {
+    auto const window = bounds(i);
+
+    sum_type sum       = DeviceSum::identity<sum_type>();
+    mean_type mean_sum = DeviceSum::identity<mean_type>();
+    T min              = DeviceMin::identity<T>();
+    T max              = DeviceMax::identity<T>();
+    size_type count    = 0;
+    for (size_type j = window.first; j < window.second; j++) {
+      if (!has_nulls || input.is_valid_nocheck(j)) {
+        T const element = input.element<T>(j);
+        sum             = DeviceSum{}(static_cast<sum_type>(element), sum);
+        mean_sum        = DeviceSum{}(static_cast<mean_type>(element), mean_sum);
+        min             = DeviceMin{}(element, min);
+        max             = DeviceMax{}(element, max);
+        count++;
+      }
+    }
+
+    if (outputs.sum) { outputs.sum[i] = sum; }
+    if (outputs.min) { outputs.min[i] = min; }
+    if (outputs.max) { outputs.max[i] = max; }
+    if (outputs.count_valid) { outputs.count_valid[i] = count; }
+    if (outputs.count_all) { outputs.count_all[i] = window.second - window.first; }
+    if (outputs.mean) { outputs.mean[i] = mean_sum / count; }
+
+    // set the masks
+    bitmask_type const rows_word =
+      __ballot_sync(active_threads, window.second - window.first >= min_periods);
+    bitmask_type const valid_rows_word = __ballot_sync(active_threads, count >= min_periods);
+
+    // only one thread writes the masks
+    if (0 == threadIdx.x % cudf::detail::warp_size) {
+      rows_mask[cudf::word_index(i)]       = rows_word;
+      valid_rows_mask[cudf::word_index(i)] = valid_rows_word;
+      warp_rows_count += __popc(rows_word);
+      warp_valid_rows_count += __popc(valid_rows_word);
+    }
+
+    // process next element
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < input.size());
+  }
+
+  // sum the valid counts across the whole block
+  size_type const block_rows_count =
+    cudf::detail::single_lane_block_sum_reduce<block_size, 0>(warp_rows_count);
+  if (threadIdx.x == 0) { atomicAdd(valid_counts, block_rows_count); }
+  __syncthreads();
+  size_type const block_valid_rows_count =
+    cudf::detail::single_lane_block_sum_reduce<block_size, 0>(warp_valid_rows_count);
+  if (threadIdx.x == 0) { atomicAdd(valid_counts + 1, block_valid_rows_count); }
+}
+
+/**
+ * @brief Type-dispatched functor computing several aggregations over the same windows.
+ *
+ * Returns no columns if the aggregations cannot be computed in a single pass: the input must be
+ * a non-boolean numeric column, all aggregations must be SUM, MIN, MAX, COUNT_VALID, COUNT_ALL or
+ * MEAN, and the windows must be smaller than those aggregated in O(1) time per row by
+ * `large_window::dispatch_large_window_rolling`.
+ */
+struct dispatch_multi_aggregation_rolling {
+  template <typename T, typename... Args>
+  std::enable_if_t<!(cudf::is_numeric<T>() && !cudf::is_boolean<T>()),
+                   std::vector<std::unique_ptr<column>>>
+  operator()(Args&&...) const
+  {
+    return {};
+  }
+
+  template <typename T, typename PrecedingWindowIterator, typename FollowingWindowIterator>
+  std::enable_if_t<cudf::is_numeric<T>() && !cudf::is_boolean<T>(),
+                   std::vector<std::unique_ptr<column>>>
+  operator()(column_view const& input,
+             PrecedingWindowIterator preceding_window_begin,
+             FollowingWindowIterator following_window_begin,
+             size_type min_periods,
+             std::vector<std::unique_ptr<aggregation>> const& aggs,
+             rmm::cuda_stream_view stream,
+             rmm::mr::device_memory_resource* mr) const
+  {
+    auto const is_fused = std::all_of(
+      aggs.begin(), aggs.end(), [](auto const& agg) { return is_fused_aggregation(agg->kind); });
+    if (aggs.empty() || !is_fused) { return {}; }
+
+    auto const num_rows = input.size();
+    auto const bounds =
+      large_window::window_bounds_fn<PrecedingWindowIterator, FollowingWindowIterator>{
+        preceding_window_begin, following_window_begin, num_rows};
+    if (large_window::max_window_size(bounds, num_rows, stream) >=
+        large_window::window_size_threshold) {
+      return {};
+    }
+
+    // one output column per distinct aggregation
+    std::vector<std::unique_ptr<column>> results(aggs.size());
+    std::vector<size_type> first_result(aggs.size());
+    window_outputs<T> outputs{};
+    for (std::size_t idx = 0; idx < aggs.size(); ++idx) {
+      auto const kind  = aggs[idx]->kind;
+      auto const first = std::find_if(
+        aggs.begin(), aggs.end(), [kind](auto const& agg) { return agg->kind == kind; });
+      first_result[idx] = static_cast<size_type>(first - aggs.begin());
+      if (first_result[idx] != static_cast<size_type>(idx)) { continue; }
+
+      results[idx] = make_fixed_width_column(
+        target_type(input.type(), kind), num_rows, mask_state::UNALLOCATED, stream, mr);
+      auto view = results[idx]->mutable_view();
+      switch (kind) {
+        case aggregation::SUM:
+          outputs.sum = view.data<typename window_outputs<T>::sum_type>();
+          break;
+        case aggregation::MIN: outputs.min = view.data<T>(); break;
+        case aggregation::MAX: outputs.max = view.data<T>(); break;
+        case aggregation::COUNT_VALID: outputs.count_valid = view.data<size_type>(); break;
+        case aggregation::COUNT_ALL: outputs.count_all = view.data<size_type>(); break;
+        default: outputs.mean = view.data<typename window_outputs<T>::mean_type>();
+      }
+    }
+
+    auto rows_mask       = create_null_mask(num_rows, mask_state::UNINITIALIZED, stream, mr);
+    auto valid_rows_mask = create_null_mask(num_rows, mask_state::UNINITIALIZED, stream, mr);
+    auto valid_counts    = make_zeroed_device_uvector_async<size_type>(2, stream);
+
+    constexpr cudf::size_type block_size = 256;
+    cudf::detail::grid_1d grid(num_rows, block_size);
+    auto const d_input = column_device_view::create(input, stream);
+    if (input.has_nulls()) {
+      gpu_rolling_multi<T, block_size, true>
+        <<<grid.num_blocks, block_size, 0, stream.value()>>>(
+          *d_input,
+          bounds,
+          outputs,
+          min_periods,
+          static_cast<bitmask_type*>(rows_mask.data()),
+          static_cast<bitmask_type*>(valid_rows_mask.data()),
+          valid_counts.data());
+    } else {
+      gpu_rolling_multi<T, block_size, false>
+        <<<grid.num_blocks, block_size, 0, stream.value()>>>(
+          *d_input,
+          bounds,
+          outputs,
+          min_periods,
+          static_cast<bitmask_type*>(rows_mask.data()),
+          static_cast<bitmask_type*>(valid_rows_mask.data()),
+          valid_counts.data());
+    }
+    CHECK_CUDA(stream.value());
+
+    auto const h_valid_counts = make_std_vector_sync(valid_counts, stream);
+
+    // the counts share the mask of the windows rows, the others that of their valid rows
+    for (std::size_t idx = 0; idx < aggs.size(); ++idx) {
+      if (first_result[idx] != static_cast<size_type>(idx)) {
+        results[idx] = std::make_unique<column>(*results[first_result[idx]], stream, mr);
+        continue;
+      }
+      auto const counts_rows =
+        aggs[idx]->kind == aggregation::COUNT_VALID || aggs[idx]->kind == aggregation::COUNT_ALL;
+      results[idx]->set_null_mask(
+        rmm::device_buffer{counts_rows ? rows_mask : valid_rows_mask, stream, mr},
+        num_rows - h_valid_counts[counts_rows ? 0 : 1]);
+    }
+    return results;
+  }
+};
+
+}  // namespace multi_aggregation
+}  // namespace detail
+}  // namespace cudf
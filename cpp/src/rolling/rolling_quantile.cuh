@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rolling_large_window.cuh"
+
+#include <quantiles/quantiles_util.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <limits>
+#include <memory>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Computes a quantile of the valid rows of each window.
+ *
+ * The valid values of all windows are laid out as consecutive segments, one per window, and the
+ * segments are sorted together so that the quantile of a window is selected from its order
+ * statistics as `quantile()` does. The values of a row are copied into every window containing
+ * the row, so the temporary memory grows with the total size of the windows.
+ *
+ * The output is null if the window has fewer than `min_periods` valid rows or has no valid rows.
+ *
+ * @tparam InputType The numeric type of `input`
+ *
+ * @param input The input column
+ * @param preceding_window_begin Preceding window sizes of the rows
+ * @param following_window_begin Following window sizes of the rows
+ * @param min_periods Minimum number of valid rows in a window for a valid output
+ * @param quantile The quantile in [0, 1] to compute
+ * @param interp Strategy used to interpolate between the two values on either side of the
+ *               quantile
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A `FLOAT64` column of the window quantiles
+ */
+template <typename InputType, typename PrecedingWindowIterator, typename FollowingWindowIterator>
+std::unique_ptr<column> rolling_quantile(column_view const& input,
+                                         PrecedingWindowIterator preceding_window_begin,
+                                         FollowingWindowIterator following_window_begin,
+                                         size_type min_periods,
+                                         double quantile,
+                                         interpolation interp,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  using OutputType = target_type_t<InputType, aggregation::QUANTILE>;
+
+  auto const num_rows = input.size();
+  auto const bounds =
+    large_window::window_bounds_fn<PrecedingWindowIterator, FollowingWindowIterator>{
+      preceding_window_begin, following_window_begin, num_rows};
+  auto const d_input = column_device_view::create(input, stream);
+
+  // the valid rows of the input and the number of valid rows preceding each row
+  auto const valid_sums = large_window::prefix_sums<size_type>(
+    [d_input = *d_input] __device__(size_type i) {
+      return static_cast<size_type>(d_input.is_valid(i));
+    },
+    num_rows,
+    stream);
+  rmm::device_uvector<size_type> valid_rows(num_rows, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  valid_rows.begin(),
+                  [d_input = *d_input] __device__(size_type i) { return d_input.is_valid(i); });
+
+  auto const window_valid_count = [bounds, d_valid_sums = valid_sums.data()] __device__(
+                                    size_type i) {
+    auto const window = bounds(i);
+    return d_valid_sums[window.second] - d_valid_sums[window.first];
+  };
+  auto const total_size =
+    thrust::transform_reduce(rmm::exec_policy(stream),
+                             thrust::make_counting_iterator<size_type>(0),
+                             thrust::make_counting_iterator<size_type>(num_rows),
+                             [window_valid_count] __device__(size_type i) {
+                               return static_cast<std::size_t>(window_valid_count(i));
+                             },
+                             std::size_t{0},
+                             thrust::plus<std::size_t>{});
+  CUDF_EXPECTS(total_size <= static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "Total size of the windows exceeds the column size limit");
+
+  // the valid values of each window are a segment of the window values
+  auto offsets   = make_numeric_column(data_type{type_to_id<size_type>()},
+                                     num_rows + 1,
+                                     mask_state::UNALLOCATED,
+                                     stream,
+                                     cudf::get_current_temp_resource());
+  auto d_offsets = offsets->mutable_view().data<size_type>();
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows + 1),
+    d_offsets,
+    [window_valid_count, num_rows] __device__(size_type i) {
+      return i < num_rows ? window_valid_count(i) : 0;
+    },
+    size_type{0},
+    thrust::plus<size_type>{});
+
+  auto values = make_fixed_width_column(input.type(),
+                                        static_cast<size_type>(total_size),
+                                        mask_state::UNALLOCATED,
+                                        stream,
+                                        cudf::get_current_temp_resource());
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(static_cast<size_type>(total_size)),
+    values->mutable_view().begin<InputType>(),
+    [bounds,
+     d_input      = *d_input,
+     d_offsets,
+     d_valid_sums = valid_sums.data(),
+     d_valid_rows = valid_rows.data(),
+     num_rows] __device__(size_type idx) {
+      auto const window = static_cast<size_type>(
+        thrust::upper_bound(thrust::seq, d_offsets, d_offsets + num_rows + 1, idx) - d_offsets - 1);
+      auto const row =
+        d_valid_rows[d_valid_sums[bounds(window).first] + (idx - d_offsets[window])];
+      return d_input.element<InputType>(row);
+    });
+
+  // the quantiles are selected from the sorted order of each window
+  auto const sorted_order = segmented_sorted_order(table_view{{values->view()}},
+                                                   offsets->view(),
+                                                   {},
+                                                   {},
+                                                   stream,
+                                                   cudf::get_current_temp_resource());
+
+  auto output = make_fixed_width_column(
+    data_type{type_to_id<OutputType>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    output->mutable_view().begin<OutputType>(),
+                    [d_values = values->view().data<InputType>(),
+                     d_order  = sorted_order->view().data<size_type>(),
+                     d_offsets,
+                     quantile,
+                     interp] __device__(size_type i) {
+                      auto const size = d_offsets[i + 1] - d_offsets[i];
+                      if (size == 0) { return OutputType{0}; }
+                      auto const sorted_values =
+                        thrust::make_permutation_iterator(d_values, d_order + d_offsets[i]);
+                      return select_quantile_data<OutputType>(
+                        sorted_values, size, quantile, interp);
+                    });
+
+  auto [null_mask, null_count] =
+    valid_if(thrust::make_counting_iterator<size_type>(0),
+             thrust::make_counting_iterator<size_type>(num_rows),
+             [d_offsets, min_periods] __device__(size_type i) {
+               auto const size = d_offsets[i + 1] - d_offsets[i];
+               return size > 0 && size >= min_periods;
+             },
+             stream,
+             mr);
+  output->set_null_mask(std::move(null_mask), null_count);
+  return output;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,683 @@
+/*
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/row_conversion.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Size in bytes of the slot of a strings value in a row, holding the offset of its
+ * characters from the start of the row in the low 32 bits and their size in the high 32 bits.
+ */
+constexpr size_type string_slot_size = sizeof(int64_t);
+
+/**
+ * @brief Number of threads of the kernels copying the characters of strings, one warp per row.
+ */
+constexpr size_type strings_block_size = 256;
+
+/**
+ * @brief Maximum number of blocks of the kernels, which stride over the rows.
+ *
+ * The maximum number of blocks in the x dimension is 2^31 - 1, but about 600 blocks saturate the
+ * memory bandwidth of a V100, and more only add scheduling overhead.
+ */
+constexpr int max_blocks = 10240;
+
+__host__ __device__ inline int64_t align_offset(int64_t offset, std::size_t alignment)
+{
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief Byte offsets of the values of the columns in a row.
+ */
+struct row_layout {
+  std::vector<size_type> column_starts;
+  std::vector<size_type> column_sizes;
+  std::vector<size_type> string_columns;  ///< Indices of the strings columns
+  size_type validity_offset;              ///< Offset of the validity bytes
+  size_type fixed_row_size;  ///< Size of the values and validity, padded to 8 bytes
+
+  /**
+   * @brief Offset of the characters of the strings, which follow the validity bytes.
+   */
+  size_type strings_offset() const
+  {
+    return validity_offset + static_cast<size_type>((column_sizes.size() + 7) / 8);
+  }
+};
+
+/**
+ * @brief Computes the layout of the rows of columns of types `schema`.
+ *
+ * The values of fixed-width columns are aligned to their size and that of strings columns to
+ * 8 bytes, so that every value can be accessed with a single aligned load or store.
+ */
+row_layout compute_row_layout(std::vector<data_type> const& schema)
+{
+  row_layout layout;
+  int64_t at_offset = 0;
+  for (std::size_t idx = 0; idx < schema.size(); ++idx) {
+    auto const is_string = schema[idx].id() == type_id::STRING;
+    CUDF_EXPECTS(is_fixed_width(schema[idx]) || is_string,
+                 "Only fixed-width and strings columns can be converted to rows");
+    if (is_string) { layout.string_columns.push_back(static_cast<size_type>(idx)); }
+    auto const size = is_string ? string_slot_size : static_cast<size_type>(size_of(schema[idx]));
+    at_offset       = align_offset(at_offset, size);
+    layout.column_starts.push_back(static_cast<size_type>(at_offset));
+    layout.column_sizes.push_back(size);
+    at_offset += size;
+  }
+  layout.validity_offset = static_cast<size_type>(at_offset);
+  layout.fixed_row_size  = static_cast<size_type>(align_offset(layout.strings_offset(), 8));
+  return layout;
+}
+
+/**
+ * @brief Calculates the dimensions of the kernels copying the fixed-width part of rows.
+ *
+ * Each block copies a group of rows through shared memory, one row per thread in the x dimension,
+ * and the threads in the y dimension split its columns, up to 4 columns per thread beyond which
+ * performance degrades. The x dimension is a multiple of 32 so that each warp handles the rows of
+ * whole words of validity.
+ *
+ * @param[in] num_columns Number of columns of the rows
+ * @param[in] num_rows Number of rows copied
+ * @param[in] fixed_row_size Size in bytes of the fixed-width part of a row
+ * @param[out] blocks Dimensions of the grid
+ * @param[out] threads Dimensions of the blocks
+ * @return Size in bytes of the shared memory of each block
+ */
+int calc_fixed_width_kernel_dims(size_type num_columns,
+                                 size_type num_rows,
+                                 size_type fixed_row_size,
+                                 dim3& blocks,
+                                 dim3& threads)
+{
+  int const y_block_size = std::min((num_columns + 3) / 4, 32);
+  // 48KB is the default shared memory available to a block
+  int const max_shared_size = 48 * 1024;
+  int const max_block_size  = std::min(max_shared_size / fixed_row_size, 1024 / y_block_size);
+  int const block_size      = (max_block_size / warp_size) * warp_size;
+  CUDF_EXPECTS(block_size != 0, "Row size is too large to fit in shared memory");
+
+  blocks  = dim3(std::min(std::max((num_rows + block_size - 1) / block_size, 1), max_blocks));
+  threads = dim3(block_size, y_block_size);
+  return fixed_row_size * block_size;
+}
+
+/**
+ * @brief Copies an element of `size` bytes, with a single load and store for power of 2 sizes.
+ */
+__device__ inline void copy_element(int8_t* dst, int8_t const* src, size_type size)
+{
+  switch (size) {
+    case 1: *dst = *src; break;
+    case 2: *reinterpret_cast<int16_t*>(dst) = *reinterpret_cast<int16_t const*>(src); break;
+    case 4: *reinterpret_cast<int32_t*>(dst) = *reinterpret_cast<int32_t const*>(src); break;
+    case 8: *reinterpret_cast<int64_t*>(dst) = *reinterpret_cast<int64_t const*>(src); break;
+    default:
+      for (size_type b = 0; b < size; ++b) {
+        dst[b] = src[b];
+      }
+  }
+}
+
+/**
+ * @brief Copies the values and validity of columns to the fixed-width part of rows.
+ *
+ * Each group of rows is assembled in shared memory, then written out in 8-byte words so that the
+ * writes of consecutive threads to a row are coalesced.
+ *
+ * @param start_row First row of the table copied
+ * @param num_rows Number of rows copied
+ * @param num_columns Number of columns of the table
+ * @param fixed_row_size Size in bytes of the fixed-width part of a row
+ * @param column_starts Offset of the value of each column in a row
+ * @param column_sizes Size of the value of each column in a row
+ * @param input_data Values of each column, the slots of the rows for strings columns
+ * @param input Table whose validity is copied
+ * @param validity_offset Offset of the validity bytes in a row
+ * @param row_offsets Offset of each copied row in `output`, a multiple of 8
+ * @param output Bytes of the rows
+ */
+__global__ void copy_to_rows(size_type start_row,
+                             size_type num_rows,
+                             size_type num_columns,
+                             size_type fixed_row_size,
+                             size_type const* column_starts,
+                             size_type const* column_sizes,
+                             int8_t const* const* input_data,
+                             table_device_view input,
+                             size_type validity_offset,
+                             size_type const* row_offsets,
+                             int8_t* output)
+{
+  extern __shared__ int64_t shared_words[];
+
+  size_type const words_per_row  = fixed_row_size / sizeof(int64_t);
+  size_type const rows_per_group = blockDim.x;
+  size_type const num_groups     = (num_rows + rows_per_group - 1) / rows_per_group;
+  size_type const thread_index   = threadIdx.x + threadIdx.y * blockDim.x;
+  size_type const num_threads    = blockDim.x * blockDim.y;
+
+  // each thread in the x dimension assembles the same row of every group
+  auto const row_tmp      = reinterpret_cast<int8_t*>(shared_words + words_per_row * threadIdx.x);
+  auto const validity     = reinterpret_cast<uint32_t*>(row_tmp);
+  auto const output_words = reinterpret_cast<int64_t*>(output);
+
+  for (size_type group = blockIdx.x; group < num_groups; group += gridDim.x) {
+    size_type const group_start   = group * rows_per_group;
+    size_type const rows_in_group = min(rows_per_group, num_rows - group_start);
+    size_type const group_words   = rows_in_group * words_per_row;
+
+    // Step 1: assemble the rows in shared memory, with the padding and validity zeroed
+    for (size_type idx = thread_index; idx < group_words; idx += num_threads) {
+      shared_words[idx] = 0;
+    }
+    __syncthreads();
+
+    size_type const row = start_row + group_start + threadIdx.x;
+    if (threadIdx.x < rows_in_group) {
+      for (size_type col = threadIdx.y; col < num_columns; col += blockDim.y) {
+        auto const size = column_sizes[col];
+        auto const src  = input_data[col] + static_cast<int64_t>(size) * row;
+        copy_element(row_tmp + column_starts[col], src, size);
+      }
+    }
+    // the validity bits are set after the values, which may share their 32-bit word
+    __syncthreads();
+    if (threadIdx.x < rows_in_group) {
+      for (size_type col = threadIdx.y; col < num_columns; col += blockDim.y) {
+        if (input.column(col).is_valid(row)) {
+          size_type const byte = validity_offset + col / 8;
+          atomicOr_block(validity + byte / 4, 1u << ((byte % 4) * 8 + col % 8));
+        }
+      }
+    }
+    __syncthreads();
+
+    // Step 2: write the words of the rows out
+    for (size_type idx = thread_index; idx < group_words; idx += num_threads) {
+      size_type const group_row     = idx / words_per_row;
+      size_type const word          = idx % words_per_row;
+      auto const row_word           = row_offsets[group_start + group_row] / sizeof(int64_t);
+      output_words[row_word + word] = shared_words[idx];
+    }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Copies the fixed-width part of rows to the values and validity of columns.
+ *
+ * Each group of rows is read in 8-byte words into shared memory, then every thread in the x
+ * dimension copies out the values of a row, the validity being written a word at a time by warps.
+ *
+ * @param num_rows Number of rows copied
+ * @param num_columns Number of columns of the table
+ * @param fixed_row_size Size in bytes of the fixed-width part of a row
+ * @param column_starts Offset of the value of each column in a row
+ * @param column_sizes Size of the value of each column in a row
+ * @param output_data Values of each column, the slots of the rows for strings columns
+ * @param output_masks Validity of each column
+ * @param validity_offset Offset of the validity bytes in a row
+ * @param row_offsets Offset of each row in `input`, a multiple of 8
+ * @param input Bytes of the rows
+ */
+__global__ void copy_from_rows(size_type num_rows,
+                               size_type num_columns,
+                               size_type fixed_row_size,
+                               size_type const* column_starts,
+                               size_type const* column_sizes,
+                               int8_t* const* output_data,
+                               bitmask_type* const* output_masks,
+                               size_type validity_offset,
+                               size_type const* row_offsets,
+                               int8_t const* input)
+{
+  extern __shared__ int64_t shared_words[];
+
+  size_type const words_per_row  = fixed_row_size / sizeof(int64_t);
+  size_type const rows_per_group = blockDim.x;
+  size_type const num_groups     = (num_rows + rows_per_group - 1) / rows_per_group;
+  size_type const thread_index   = threadIdx.x + threadIdx.y * blockDim.x;
+  size_type const num_threads    = blockDim.x * blockDim.y;
+
+  auto const row_tmp = reinterpret_cast<int8_t const*>(shared_words + words_per_row * threadIdx.x);
+  auto const input_words = reinterpret_cast<int64_t const*>(input);
+
+  for (size_type group = blockIdx.x; group < num_groups; group += gridDim.x) {
+    size_type const group_start   = group * rows_per_group;
+    size_type const rows_in_group = min(rows_per_group, num_rows - group_start);
+    size_type const group_words   = rows_in_group * words_per_row;
+
+    // Step 1: read the words of the rows into shared memory
+    for (size_type idx = thread_index; idx < group_words; idx += num_threads) {
+      size_type const group_row = idx / words_per_row;
+      size_type const word      = idx % words_per_row;
+      auto const row_word       = row_offsets[group_start + group_row] / sizeof(int64_t);
+      shared_words[idx]         = input_words[row_word + word];
+    }
+    __syncthreads();
+
+    // Step 2: copy the values out, the group starting at a multiple of the warp size
+    size_type const row   = group_start + threadIdx.x;
+    uint32_t const active = __ballot_sync(0xffff'ffff, row < num_rows);
+    if (row < num_rows) {
+      for (size_type col = threadIdx.y; col < num_columns; col += blockDim.y) {
+        auto const size = column_sizes[col];
+        auto const dst  = output_data[col] + static_cast<int64_t>(size) * row;
+        copy_element(dst, row_tmp + column_starts[col], size);
+
+        auto const is_valid = row_tmp[validity_offset + col / 8] & (1 << (col % 8));
+        auto const bits     = __ballot_sync(active, is_valid);
+        if (row % warp_size == 0) { output_masks[col][word_index(row)] = bits; }
+      }
+    }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Copies the characters of strings to rows, one warp per row.
+ *
+ * @param start_row First row of the table copied
+ * @param num_rows Number of rows copied
+ * @param string_columns Indices of the strings columns of `input`
+ * @param num_string_columns Number of strings columns
+ * @param input Table whose strings are copied
+ * @param slots Slots of the strings in the rows, those of each strings column in turn
+ * @param row_offsets Offset of each copied row in `output`
+ * @param output Bytes of the rows
+ */
+__global__ void copy_strings_to_rows(size_type start_row,
+                                     size_type num_rows,
+                                     size_type const* string_columns,
+                                     size_type num_string_columns,
+                                     table_device_view input,
+                                     int64_t const* slots,
+                                     size_type const* row_offsets,
+                                     int8_t* output)
+{
+  size_type const lane      = threadIdx.x % warp_size;
+  size_type const warp      = (blockIdx.x * blockDim.x + threadIdx.x) / warp_size;
+  size_type const num_warps = (gridDim.x * blockDim.x) / warp_size;
+
+  for (size_type batch_row = warp; batch_row < num_rows; batch_row += num_warps) {
+    size_type const row = start_row + batch_row;
+    for (size_type idx = 0; idx < num_string_columns; ++idx) {
+      auto const slot = slots[static_cast<int64_t>(idx) * input.num_rows() + row];
+      auto const size = static_cast<size_type>(slot >> 32);
+      if (size == 0) { continue; }
+      auto const src = input.column(string_columns[idx]).element<string_view>(row).data();
+      auto const dst = output + row_offsets[batch_row] + static_cast<uint32_t>(slot);
+      for (size_type b = lane; b < size; b += warp_size) {
+        dst[b] = src[b];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Copies the characters of strings from rows, one warp per row.
+ *
+ * @param num_rows Number of rows copied
+ * @param num_string_columns Number of strings columns
+ * @param slots Slots of the strings in the rows, those of each strings column in turn
+ * @param offsets Offsets of the characters of each strings column
+ * @param chars Characters of each strings column
+ * @param row_offsets Offset of each row in `input`
+ * @param input Bytes of the rows
+ */
+__global__ void copy_strings_from_rows(size_type num_rows,
+                                       size_type num_string_columns,
+                                       int64_t const* slots,
+                                       size_type const* const* offsets,
+                                       char* const* chars,
+                                       size_type const* row_offsets,
+                                       int8_t const* input)
+{
+  size_type const lane      = threadIdx.x % warp_size;
+  size_type const warp      = (blockIdx.x * blockDim.x + threadIdx.x) / warp_size;
+  size_type const num_warps = (gridDim.x * blockDim.x) / warp_size;
+
+  for (size_type row = warp; row < num_rows; row += num_warps) {
+    for (size_type idx = 0; idx < num_string_columns; ++idx) {
+      auto const slot = slots[static_cast<int64_t>(idx) * num_rows + row];
+      auto const size = static_cast<size_type>(slot >> 32);
+      auto const src  = input + row_offsets[row] + static_cast<uint32_t>(slot);
+      auto const dst  = chars[idx] + offsets[idx][row];
+      for (size_type b = lane; b < size; b += warp_size) {
+        dst[b] = src[b];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Computes the size of a row, and the slots of its strings, whose characters follow each
+ * other after the validity bytes. The characters of a null string are empty.
+ */
+struct row_size_fn {
+  table_device_view input;
+  size_type const* string_columns;
+  size_type num_string_columns;
+  size_type strings_offset;
+  int64_t* slots;
+
+  __device__ int64_t operator()(size_type row) const
+  {
+    int64_t offset = strings_offset;
+    for (size_type idx = 0; idx < num_string_columns; ++idx) {
+      auto const col     = input.column(string_columns[idx]);
+      int64_t const size = col.is_valid(row) ? col.element<string_view>(row).size_bytes() : 0;
+
+      slots[static_cast<int64_t>(idx) * input.num_rows() + row] = (size << 32) | offset;
+      offset += size;
+    }
+    return align_offset(offset, 8);
+  }
+};
+
+int calc_strings_kernel_blocks(size_type num_rows)
+{
+  auto const warps_per_block = strings_block_size / warp_size;
+  return std::min(std::max((num_rows + warps_per_block - 1) / warps_per_block, 1), max_blocks);
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  std::vector<data_type> schema;
+  std::transform(input.begin(), input.end(), std::back_inserter(schema), [](auto const& col) {
+    return col.type();
+  });
+  CUDF_EXPECTS(input.num_columns() > 0, "Table must have at least one column");
+  auto const layout      = compute_row_layout(schema);
+  auto const num_rows    = input.num_rows();
+  auto const num_columns = input.num_columns();
+  auto const num_strings = static_cast<size_type>(layout.string_columns.size());
+
+  auto const d_column_starts  = make_device_uvector_async(layout.column_starts, stream);
+  auto const d_column_sizes   = make_device_uvector_async(layout.column_sizes, stream);
+  auto const d_string_columns = make_device_uvector_async(layout.string_columns, stream);
+  auto const d_input          = table_device_view::create(input, stream);
+
+  // the slots of the strings are computed with the sizes of the rows
+  rmm::device_uvector<int64_t> slots(static_cast<int64_t>(num_strings) * num_rows, stream);
+  rmm::device_uvector<int64_t> row_offsets(num_rows + 1, stream);
+  int64_t const zero = 0;
+  row_offsets.set_element_async(0, zero, stream);
+  auto const row_sizes = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    row_size_fn{
+      *d_input, d_string_columns.data(), num_strings, layout.strings_offset(), slots.data()});
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), row_sizes, row_sizes + num_rows, row_offsets.begin() + 1);
+
+  // the values of strings columns are their slots
+  std::vector<int8_t const*> input_data;
+  auto string_slots = slots.data();
+  for (auto const& col : input) {
+    if (col.type().id() == type_id::STRING) {
+      input_data.push_back(reinterpret_cast<int8_t const*>(string_slots));
+      string_slots += num_rows;
+    } else {
+      input_data.push_back(col.head<int8_t>() + col.offset() * size_of(col.type()));
+    }
+  }
+  auto const d_input_data = make_device_uvector_async(input_data, stream);
+
+  // each batch of rows holds less than 2GB for the offsets of its list column
+  std::vector<std::unique_ptr<column>> results;
+  for (size_type batch_start = 0; batch_start < num_rows;) {
+    auto const batch_offset = row_offsets.element(batch_start, stream);
+    auto const batch_limit  = batch_offset + std::numeric_limits<size_type>::max();
+    auto const batch_bound  = thrust::upper_bound(rmm::exec_policy(stream),
+                                                 row_offsets.begin() + batch_start + 1,
+                                                 row_offsets.end(),
+                                                 batch_limit);
+
+    auto const batch_end = static_cast<size_type>(batch_bound - row_offsets.begin() - 1);
+    CUDF_EXPECTS(batch_end > batch_start, "Row is too large to fit in a list column");
+    auto const batch_rows = batch_end - batch_start;
+    auto const batch_size = row_offsets.element(batch_end, stream) - batch_offset;
+
+    auto offsets = make_numeric_column(
+      data_type{type_id::INT32}, batch_rows + 1, mask_state::UNALLOCATED, stream, mr);
+    auto const d_offsets = offsets->mutable_view().data<size_type>();
+    thrust::transform(rmm::exec_policy(stream),
+                      row_offsets.begin() + batch_start,
+                      row_offsets.begin() + batch_end + 1,
+                      d_offsets,
+                      [batch_offset] __device__(int64_t offset) {
+                        return static_cast<size_type>(offset - batch_offset);
+                      });
+    auto data = make_numeric_column(data_type{type_id::INT8},
+                                    static_cast<size_type>(batch_size),
+                                    mask_state::UNALLOCATED,
+                                    stream,
+                                    mr);
+    auto const d_data = data->mutable_view().data<int8_t>();
+
+    dim3 blocks;
+    dim3 threads;
+    auto const shared_size =
+      calc_fixed_width_kernel_dims(num_columns, batch_rows, layout.fixed_row_size, blocks, threads);
+    copy_to_rows<<<blocks, threads, shared_size, stream.value()>>>(batch_start,
+                                                                   batch_rows,
+                                                                   num_columns,
+                                                                   layout.fixed_row_size,
+                                                                   d_column_starts.data(),
+                                                                   d_column_sizes.data(),
+                                                                   d_input_data.data(),
+                                                                   *d_input,
+                                                                   layout.validity_offset,
+                                                                   d_offsets,
+                                                                   d_data);
+    // the characters follow the validity in the last words written by copy_to_rows
+    if (num_strings > 0) {
+      copy_strings_to_rows<<<calc_strings_kernel_blocks(batch_rows),
+                             strings_block_size,
+                             0,
+                             stream.value()>>>(batch_start,
+                                               batch_rows,
+                                               d_string_columns.data(),
+                                               num_strings,
+                                               *d_input,
+                                               slots.data(),
+                                               d_offsets,
+                                               d_data);
+    }
+
+    results.push_back(make_lists_column(batch_rows,
+                                        std::move(offsets),
+                                        std::move(data),
+                                        0,
+                                        rmm::device_buffer{0, stream, mr},
+                                        stream,
+                                        mr));
+    batch_start = batch_end;
+  }
+  return results;
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto const child     = input.child();
+  auto const list_type = child.type().id();
+  CUDF_EXPECTS(list_type == type_id::INT8 || list_type == type_id::UINT8,
+               "Only a list of bytes is supported as input");
+
+  auto const layout      = compute_row_layout(schema);
+  auto const num_rows    = input.size();
+  auto const num_columns = static_cast<size_type>(schema.size());
+  auto const num_strings = static_cast<size_type>(layout.string_columns.size());
+  CUDF_EXPECTS(num_rows == 0 || num_columns > 0, "Rows must have at least one column");
+  CUDF_EXPECTS(child.size() >= static_cast<int64_t>(layout.fixed_row_size) * num_rows,
+               "The layout of the data appears to be off");
+
+  // the offsets of the rows are relative to the bytes of the parent's rows
+  auto const row_offsets = input.offsets_begin();
+  auto const row_data    = child.data<int8_t>();
+
+  rmm::device_uvector<int64_t> slots(static_cast<int64_t>(num_strings) * num_rows, stream);
+  std::vector<std::unique_ptr<column>> output_columns(num_columns);
+  std::vector<rmm::device_buffer> string_masks;
+  std::vector<int8_t*> output_data;
+  std::vector<bitmask_type*> output_masks;
+  auto string_slots = slots.data();
+  for (size_type col = 0; col < num_columns; ++col) {
+    if (schema[col].id() == type_id::STRING) {
+      string_masks.push_back(create_null_mask(num_rows, mask_state::UNINITIALIZED, stream, mr));
+      output_data.push_back(reinterpret_cast<int8_t*>(string_slots));
+      string_slots += num_rows;
+      output_masks.push_back(static_cast<bitmask_type*>(string_masks.back().data()));
+    } else {
+      output_columns[col] =
+        make_fixed_width_column(schema[col], num_rows, mask_state::UNINITIALIZED, stream, mr);
+      auto view = output_columns[col]->mutable_view();
+      output_data.push_back(view.data<int8_t>());
+      output_masks.push_back(view.null_mask());
+    }
+  }
+  if (num_rows == 0) {
+    for (size_type col = 0; col < num_columns; ++col) {
+      if (!output_columns[col]) { output_columns[col] = make_empty_column(schema[col]); }
+    }
+    return std::make_unique<table>(std::move(output_columns));
+  }
+
+  auto const d_column_starts = make_device_uvector_async(layout.column_starts, stream);
+  auto const d_column_sizes  = make_device_uvector_async(layout.column_sizes, stream);
+  auto const d_output_data   = make_device_uvector_async(output_data, stream);
+  auto const d_output_masks  = make_device_uvector_async(output_masks, stream);
+
+  dim3 blocks;
+  dim3 threads;
+  auto const shared_size =
+    calc_fixed_width_kernel_dims(num_columns, num_rows, layout.fixed_row_size, blocks, threads);
+  copy_from_rows<<<blocks, threads, shared_size, stream.value()>>>(num_rows,
+                                                                   num_columns,
+                                                                   layout.fixed_row_size,
+                                                                   d_column_starts.data(),
+                                                                   d_column_sizes.data(),
+                                                                   d_output_data.data(),
+                                                                   d_output_masks.data(),
+                                                                   layout.validity_offset,
+                                                                   row_offsets,
+                                                                   row_data);
+  if (num_strings == 0) { return std::make_unique<table>(std::move(output_columns)); }
+
+  // the offsets of the strings are the scan of the sizes in their slots
+  std::vector<std::unique_ptr<column>> offsets_columns;
+  std::vector<std::unique_ptr<column>> chars_columns;
+  std::vector<size_type const*> offsets;
+  std::vector<char*> chars;
+  for (size_type idx = 0; idx < num_strings; ++idx) {
+    auto const sizes = thrust::make_transform_iterator(
+      slots.begin() + static_cast<int64_t>(idx) * num_rows,
+      [] __device__(int64_t slot) { return static_cast<size_type>(slot >> 32); });
+    offsets_columns.push_back(
+      strings::detail::make_offsets_child_column(sizes, sizes + num_rows, stream, mr));
+    auto const num_chars = get_value<size_type>(offsets_columns.back()->view(), num_rows, stream);
+    chars_columns.push_back(
+      strings::detail::create_chars_child_column(num_rows, num_chars, stream, mr));
+    offsets.push_back(offsets_columns.back()->view().data<size_type>());
+    chars.push_back(chars_columns.back()->mutable_view().data<char>());
+  }
+  auto const d_offsets = make_device_uvector_async(offsets, stream);
+  auto const d_chars   = make_device_uvector_async(chars, stream);
+  copy_strings_from_rows<<<calc_strings_kernel_blocks(num_rows),
+                           strings_block_size,
+                           0,
+                           stream.value()>>>(num_rows,
+                                             num_strings,
+                                             slots.data(),
+                                             d_offsets.data(),
+                                             d_chars.data(),
+                                             row_offsets,
+                                             row_data);
+
+  for (size_type idx = 0; idx < num_strings; ++idx) {
+    output_columns[layout.string_columns[idx]] =
+      make_strings_column(num_rows,
+                          std::move(offsets_columns[idx]),
+                          std::move(chars_columns[idx]),
+                          UNKNOWN_NULL_COUNT,
+                          std::move(string_masks[idx]),
+                          stream,
+                          mr);
+  }
+  return std::make_unique<table>(std::move(output_columns));
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_to_rows(input, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_from_rows(input, schema, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -16,17 +16,21 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/search.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/detail/search.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/search.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
-#include <structs/utilities.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <hash/unordered_multiset.cuh>
 
@@ -35,6 +39,12 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/merge.h>
+
+#include <cmath>
+#include <memory>
+#include <type_traits>
 
 namespace cudf {
 namespace {
@@ -70,11 +80,81 @@ void launch_search(DataIterator it_data,
   }
 }
 
+struct tagged_index_fn {
+  detail::side _side;
+
+  __device__ detail::index_type operator()(size_type i) const noexcept
+  {
+    return detail::index_type{_side, i};
+  }
+};
+
+/**
+ * @brief Searches sorted values in a sorted table by merging them.
+ *
+ * The values are merged with the rows of `t`, before the equal rows of `t` to find lower bounds
+ * and after them to find upper bounds. The bound of the value of index `j` merged at position
+ * `i` is then `i - j`, the number of rows of `t` merged before it. The merge reads both tables
+ * in order, instead of a binary search of `t` per value.
+ *
+ * @tparam has_nulls Indicates the potential for null values in either table
+ * @param t The sorted table to search
+ * @param values The values to search, sorted in the order of `t`
+ * @param find_first Whether to find lower bounds rather than upper bounds
+ * @param column_order Sort order of the columns, or `nullptr` if all are ascending
+ * @param null_precedence Order of the nulls of the columns, or `nullptr` if all are BEFORE
+ * @param[out] result The bound of each value
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <bool has_nulls>
+void merge_search(table_device_view const& t,
+                  table_device_view const& values,
+                  bool find_first,
+                  order const* column_order,
+                  null_order const* null_precedence,
+                  size_type* result,
+                  rmm::cuda_stream_view stream)
+{
+  // The first range of a merge precedes the equal elements of the second one
+  auto const values_side = find_first ? detail::side::LEFT : detail::side::RIGHT;
+  auto const& lhs        = find_first ? values : t;
+  auto const& rhs        = find_first ? t : values;
+  auto const comp        = detail::row_lexicographic_tagged_comparator<has_nulls>(
+    lhs, rhs, column_order, null_precedence);
+
+  auto const lhs_begin =
+    cudf::detail::make_counting_transform_iterator(0, tagged_index_fn{detail::side::LEFT});
+  auto const rhs_begin =
+    cudf::detail::make_counting_transform_iterator(0, tagged_index_fn{detail::side::RIGHT});
+
+  auto const merged_size = t.num_rows() + values.num_rows();
+  detail::index_vector merged(merged_size, stream, cudf::get_current_temp_resource());
+  thrust::merge(rmm::exec_policy(stream),
+                lhs_begin,
+                lhs_begin + lhs.num_rows(),
+                rhs_begin,
+                rhs_begin + rhs.num_rows(),
+                merged.begin(),
+                comp);
+
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    merged_size,
+    [merged = merged.data(), values_side, result] __device__(size_type i) {
+      auto const index = merged[i];
+      if (thrust::get<0>(index) == values_side) {
+        result[thrust::get<1>(index)] = i - thrust::get<1>(index);
+      }
+    });
+}
+
 std::unique_ptr<column> search_ordered(table_view const& t,
                                        table_view const& values,
                                        bool find_first,
                                        std::vector<order> const& column_order,
                                        std::vector<null_order> const& null_precedence,
+                                       sorted values_sorted,
                                        rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
 {
@@ -100,25 +180,42 @@ std::unique_ptr<column> search_ordered(table_view const& t,
   // It will return any new dictionary columns created as well as updated table_views.
   auto const matched = dictionary::detail::match_dictionaries({t, values}, stream);
 
-  // 0-table_view, 1-column_order, 2-null_precedence, 3-validity_columns
-  auto const t_flattened =
-    structs::detail::flatten_nested_columns(matched.second.front(), column_order, null_precedence);
-  auto const values_flattened =
-    structs::detail::flatten_nested_columns(matched.second.back(), {}, {});
-
-  auto const t_d      = table_device_view::create(std::get<0>(t_flattened), stream);
-  auto const values_d = table_device_view::create(std::get<0>(values_flattened), stream);
+  auto const t_d      = table_device_view::create(matched.second.front(), stream);
+  auto const values_d = table_device_view::create(matched.second.back(), stream);
   auto const& lhs     = find_first ? *t_d : *values_d;
   auto const& rhs     = find_first ? *values_d : *t_d;
 
-  auto const& column_order_flattened    = std::get<1>(t_flattened);
-  auto const& null_precedence_flattened = std::get<2>(t_flattened);
-  auto const column_order_dv = detail::make_device_uvector_async(column_order_flattened, stream);
-  auto const null_precedence_dv =
-    detail::make_device_uvector_async(null_precedence_flattened, stream);
+  auto const column_order_dv    = detail::make_device_uvector_async(column_order, stream);
+  auto const null_precedence_dv = detail::make_device_uvector_async(null_precedence, stream);
+
+  // A merge reads every row of `t` once, and a binary search about log2 rows per value
+  auto const nullable  = has_nested_nulls(t) or has_nested_nulls(values);
+  auto const use_merge = values_sorted == sorted::YES and
+                         t.num_rows() + values.num_rows() <
+                           values.num_rows() * std::log2(static_cast<double>(t.num_rows()));
+  if (use_merge) {
+    if (nullable) {
+      merge_search<true>(*t_d,
+                         *values_d,
+                         find_first,
+                         column_order_dv.data(),
+                         null_precedence_dv.data(),
+                         result_out,
+                         stream);
+    } else {
+      merge_search<false>(*t_d,
+                          *values_d,
+                          find_first,
+                          column_order_dv.data(),
+                          null_precedence_dv.data(),
+                          result_out,
+                          stream);
+    }
+    return result;
+  }
 
   auto const count_it = thrust::make_counting_iterator<size_type>(0);
-  if (has_nulls(t) or has_nulls(values)) {
+  if (nullable) {
     auto const comp = row_lexicographic_comparator<true>(
       lhs, rhs, column_order_dv.data(), null_precedence_dv.data());
     launch_search(
@@ -207,104 +304,181 @@ bool contains(column_view const& col, scalar const& value, rmm::cuda_stream_view
   return cudf::type_dispatcher(col.type(), contains_scalar_dispatch{}, col, value, stream);
 }
 
-struct multi_contains_dispatch {
-  template <typename Element>
-  std::unique_ptr<column> operator()(column_view const& haystack,
-                                     column_view const& needles,
-                                     rmm::cuda_stream_view stream,
-                                     rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Hash set of the valid elements of a column, whose type is erased for `hash_contains`.
+ */
+class column_hash_set {
+ public:
+  virtual ~column_hash_set() = default;
+
+  /**
+   * @brief Writes to `result` whether each valid element of `haystack` is in the set.
+   *
+   * @param haystack The elements to search for, of the type of the set
+   * @param result The BOOL8 column of the size of `haystack` to write to
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  virtual void contains(column_view const& haystack,
+                        mutable_column_view& result,
+                        rmm::cuda_stream_view stream) const = 0;
+};
+
+template <typename Element>
+class typed_column_hash_set final : public column_hash_set {
+ public:
+  typed_column_hash_set(column_view const& needles, rmm::cuda_stream_view stream)
+    : _set{unordered_multiset<Element>::create(needles, stream)}
   {
-    std::unique_ptr<column> result = make_numeric_column(data_type{type_to_id<bool>()},
-                                                         haystack.size(),
-                                                         copy_bitmask(haystack),
-                                                         haystack.null_count(),
-                                                         stream,
-                                                         mr);
+  }
 
-    if (haystack.is_empty()) { return result; }
+  void contains(column_view const& haystack,
+                mutable_column_view& result,
+                rmm::cuda_stream_view stream) const override
+  {
+    auto const device_hash_set = _set.to_device();
+    auto const d_haystack_ptr  = column_device_view::create(haystack, stream);
+    auto const d_haystack      = *d_haystack_ptr;
+
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(haystack.size()),
+                      result.begin<bool>(),
+                      [device_hash_set, d_haystack] __device__(size_type index) {
+                        return d_haystack.is_valid(index) and
+                               device_hash_set.contains(d_haystack.element<Element>(index));
+                      });
+  }
+
+ private:
+  unordered_multiset<Element> _set;
+};
 
-    mutable_column_view result_view = result.get()->mutable_view();
+struct make_column_hash_set_fn {
+  template <typename Element,
+            CUDF_ENABLE_IF(not is_nested<Element>() and
+                           not std::is_same_v<Element, dictionary32>)>
+  std::unique_ptr<column_hash_set> operator()(column_view const& needles,
+                                              rmm::cuda_stream_view stream) const
+  {
+    return std::make_unique<typed_column_hash_set<Element>>(needles, stream);
+  }
 
-    if (needles.is_empty()) {
+  template <typename Element,
+            CUDF_ENABLE_IF(is_nested<Element>() or std::is_same_v<Element, dictionary32>)>
+  std::unique_ptr<column_hash_set> operator()(column_view const&, rmm::cuda_stream_view) const
+  {
+    if constexpr (std::is_same_v<Element, list_view>) {
+      CUDF_FAIL("list_view type not supported");
+    } else if constexpr (std::is_same_v<Element, struct_view>) {
+      CUDF_FAIL("struct_view type not supported");
+    } else {
+      CUDF_FAIL("dictionary needles must be decoded");
+    }
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Hash set of the valid needles, built once and probed by each haystack.
+ *
+ * The set of dictionary needles holds their decoded values, and a dictionary haystack probes its
+ * keys only, so that each distinct value is looked up once whatever the number of rows.
+ */
+struct hash_contains::hash_contains_impl {
+ public:
+  hash_contains_impl()                          = delete;
+  hash_contains_impl(hash_contains_impl const&) = delete;
+  hash_contains_impl(hash_contains_impl&&)      = delete;
+  hash_contains_impl& operator=(hash_contains_impl const&) = delete;
+  hash_contains_impl& operator=(hash_contains_impl&&) = delete;
+
+  /**
+   * @brief Inserts the valid elements of `needles` into the hash set.
+   *
+   * @param needles The values to search for
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_contains_impl(column_view const& needles, rmm::cuda_stream_view stream)
+    : _type{needles.type()}
+  {
+    auto elements = needles;
+    if (_type.id() == type_id::DICTIONARY32) {
+      _decoded = dictionary::detail::decode(dictionary_column_view(needles), stream);
+      elements = _decoded->view();
+    }
+    if (elements.size() == elements.null_count()) { return; }
+
+    _set = type_dispatcher(elements.type(), detail::make_column_hash_set_fn{}, elements, stream);
+  }
+
+  /**
+   * @brief Returns whether each element of `haystack` is in the hash set.
+   *
+   * @param haystack The values to search
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   *
+   * @return A BOOL8 column of the size and null mask of `haystack`
+   */
+  std::unique_ptr<column> contains(column_view const& haystack,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr) const
+  {
+    CUDF_EXPECTS(haystack.type() == _type, "DTYPE mismatch");
+
+    auto result = make_numeric_column(data_type{type_to_id<bool>()},
+                                      haystack.size(),
+                                      detail::copy_bitmask(haystack, stream, mr),
+                                      haystack.null_count(),
+                                      stream,
+                                      mr);
+    if (haystack.is_empty()) { return result; }
+
+    auto result_view = result->mutable_view();
+    if (not _set) {
       thrust::fill(
         rmm::exec_policy(stream), result_view.begin<bool>(), result_view.end<bool>(), false);
       return result;
     }
 
-    auto hash_set        = cudf::detail::unordered_multiset<Element>::create(needles, stream);
-    auto device_hash_set = hash_set.to_device();
-
-    auto d_haystack_ptr = column_device_view::create(haystack, stream);
-    auto d_haystack     = *d_haystack_ptr;
-
-    if (haystack.has_nulls()) {
-      thrust::transform(rmm::exec_policy(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(haystack.size()),
-                        result_view.begin<bool>(),
-                        [device_hash_set, d_haystack] __device__(size_t index) {
-                          return d_haystack.is_null_nocheck(index) ||
-                                 device_hash_set.contains(d_haystack.element<Element>(index));
-                        });
-    } else {
-      thrust::transform(rmm::exec_policy(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(haystack.size()),
-                        result_view.begin<bool>(),
-                        [device_hash_set, d_haystack] __device__(size_t index) {
-                          return device_hash_set.contains(d_haystack.element<Element>(index));
-                        });
+    if (_type.id() != type_id::DICTIONARY32) {
+      _set->contains(haystack, result_view, stream);
+      return result;
     }
 
+    // probe each key of the haystack once, then look up the result of each row by its index
+    auto const keys = dictionary_column_view(haystack).keys();
+    CUDF_EXPECTS(keys.type() == _decoded->type(), "Dictionary keys type mismatch");
+    auto keys_found = make_numeric_column(data_type{type_to_id<bool>()},
+                                          keys.size(),
+                                          mask_state::UNALLOCATED,
+                                          stream,
+                                          cudf::get_current_temp_resource());
+    auto keys_found_view = keys_found->mutable_view();
+    _set->contains(keys, keys_found_view, stream);
+
+    auto const d_haystack_ptr = column_device_view::create(haystack, stream);
+    auto const d_haystack     = *d_haystack_ptr;
+    auto const d_keys_found   = keys_found_view.data<bool>();
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(haystack.size()),
+                      result_view.begin<bool>(),
+                      [d_haystack, d_keys_found] __device__(size_type index) {
+                        return d_haystack.is_valid(index) and
+                               d_keys_found[d_haystack.element<dictionary32>(index).value()];
+                      });
     return result;
   }
-};
-
-template <>
-std::unique_ptr<column> multi_contains_dispatch::operator()<list_view>(
-  column_view const& haystack,
-  column_view const& needles,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr)
-{
-  CUDF_FAIL("list_view type not supported");
-}
 
-template <>
-std::unique_ptr<column> multi_contains_dispatch::operator()<struct_view>(
-  column_view const& haystack,
-  column_view const& needles,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr)
-{
-  CUDF_FAIL("struct_view type not supported");
-}
+ private:
+  data_type _type;                   ///< Type of the needles and of the haystacks
+  std::unique_ptr<column> _decoded;  ///< Decoded dictionary needles, which the set views
+  std::unique_ptr<detail::column_hash_set> _set;  ///< Null if there are no valid needles
+};
 
-template <>
-std::unique_ptr<column> multi_contains_dispatch::operator()<dictionary32>(
-  column_view const& haystack_in,
-  column_view const& needles_in,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr)
-{
-  dictionary_column_view const haystack(haystack_in);
-  dictionary_column_view const needles(needles_in);
-  // first combine keys so both dictionaries have the same set
-  auto haystack_matched    = dictionary::detail::add_keys(haystack, needles.keys(), stream);
-  auto const haystack_view = dictionary_column_view(haystack_matched->view());
-  auto needles_matched     = dictionary::detail::set_keys(needles, haystack_view.keys(), stream);
-  auto const needles_view  = dictionary_column_view(needles_matched->view());
-
-  // now just use the indices for the contains
-  column_view const haystack_indices = haystack_view.get_indices_annotated();
-  column_view const needles_indices  = needles_view.get_indices_annotated();
-  return cudf::type_dispatcher(haystack_indices.type(),
-                               multi_contains_dispatch{},
-                               haystack_indices,
-                               needles_indices,
-                               stream,
-                               mr);
-}
+namespace detail {
 
 std::unique_ptr<column> contains(column_view const& haystack,
                                  column_view const& needles,
@@ -313,28 +487,31 @@ std::unique_ptr<column> contains(column_view const& haystack,
 {
   CUDF_EXPECTS(haystack.type() == needles.type(), "DTYPE mismatch");
 
-  return cudf::type_dispatcher(
-    haystack.type(), multi_contains_dispatch{}, haystack, needles, stream, mr);
+  return hash_contains{needles, stream}.contains(haystack, stream, mr);
 }
 
 std::unique_ptr<column> lower_bound(table_view const& t,
                                     table_view const& values,
                                     std::vector<order> const& column_order,
                                     std::vector<null_order> const& null_precedence,
+                                    sorted values_sorted,
                                     rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr)
 {
-  return search_ordered(t, values, true, column_order, null_precedence, stream, mr);
+  return search_ordered(
+    t, values, true, column_order, null_precedence, values_sorted, stream, mr);
 }
 
 std::unique_ptr<column> upper_bound(table_view const& t,
                                     table_view const& values,
                                     std::vector<order> const& column_order,
                                     std::vector<null_order> const& null_precedence,
+                                    sorted values_sorted,
                                     rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr)
 {
-  return search_ordered(t, values, false, column_order, null_precedence, stream, mr);
+  return search_ordered(
+    t, values, false, column_order, null_precedence, values_sorted, stream, mr);
 }
 
 }  // namespace detail
@@ -345,22 +522,24 @@ std::unique_ptr<column> lower_bound(table_view const& t,
                                     table_view const& values,
                                     std::vector<order> const& column_order,
                                     std::vector<null_order> const& null_precedence,
+                                    sorted values_sorted,
                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::lower_bound(
-    t, values, column_order, null_precedence, rmm::cuda_stream_default, mr);
+    t, values, column_order, null_precedence, values_sorted, rmm::cuda_stream_default, mr);
 }
 
 std::unique_ptr<column> upper_bound(table_view const& t,
                                     table_view const& values,
                                     std::vector<order> const& column_order,
                                     std::vector<null_order> const& null_precedence,
+                                    sorted values_sorted,
                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::upper_bound(
-    t, values, column_order, null_precedence, rmm::cuda_stream_default, mr);
+    t, values, column_order, null_precedence, values_sorted, rmm::cuda_stream_default, mr);
 }
 
 bool contains(column_view const& col, scalar const& value)
@@ -377,4 +556,22 @@ std::unique_ptr<column> contains(column_view const& haystack,
   return detail::contains(haystack, needles, rmm::cuda_stream_default, mr);
 }
 
+hash_contains::~hash_contains() = default;
+
+hash_contains::hash_contains(hash_contains&&) = default;
+
+hash_contains& hash_contains::operator=(hash_contains&&) = default;
+
+hash_contains::hash_contains(column_view const& needles, rmm::cuda_stream_view stream)
+  : impl{std::make_unique<const hash_contains::hash_contains_impl>(needles, stream)}
+{
+}
+
+std::unique_ptr<column> hash_contains::contains(column_view const& haystack,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr) const
+{
+  return impl->contains(haystack, stream, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/pinned_host_pool.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/merge.hpp>
+#include <cudf/search.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief A block of a run, packed by `cudf::pack` and spilled to host memory or to a file.
+ */
+struct spilled_block {
+  std::vector<uint8_t> metadata;
+  size_t size;                                    ///< Number of bytes of the packed data
+  size_t offset;                                  ///< Offset of the packed data in the spill file
+  io::detail::pinned_buffer<uint8_t> host_data;  ///< Packed data, if not spilled to a file
+};
+
+/**
+ * @brief A sorted run, of which one block at a time is loaded on the device.
+ */
+struct sorted_run {
+  std::vector<spilled_block> blocks;
+  size_t next_block{0};                      ///< Index of the next block to load
+  std::unique_ptr<rmm::device_buffer> data;  ///< Packed data of the loaded block
+  table_view remaining;                      ///< Rows of the loaded block not returned yet
+
+  bool has_unloaded_blocks() const { return next_block < blocks.size(); }
+};
+
+size_type read_size_type(column_view const& col, size_type index)
+{
+  size_type value;
+  CUDA_TRY(
+    cudaMemcpy(&value, col.data<size_type>() + index, sizeof(value), cudaMemcpyDeviceToHost));
+  return value;
+}
+
+}  // namespace
+
+struct external_sorter::impl {
+  impl(std::vector<size_type> const& key_columns,
+       std::vector<order> const& column_order,
+       std::vector<null_order> const& null_precedence,
+       std::string const& spill_path,
+       size_type block_rows)
+    : _key_columns{key_columns},
+      _column_order{column_order},
+      _null_precedence{null_precedence},
+      _spill_path{spill_path},
+      _block_rows{block_rows}
+  {
+    CUDF_EXPECTS(not key_columns.empty(), "External sort requires key columns");
+    CUDF_EXPECTS(column_order.empty() or column_order.size() == key_columns.size(),
+                 "Mismatch between number of key columns and column order.");
+    CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == key_columns.size(),
+                 "Mismatch between number of key columns and null_precedence size.");
+    CUDF_EXPECTS(block_rows > 0, "External sort requires positive block sizes");
+    // cudf::merge requires the order of every key column
+    if (_column_order.empty()) { _column_order.assign(key_columns.size(), order::ASCENDING); }
+    if (_null_precedence.empty()) {
+      _null_precedence.assign(key_columns.size(), null_order::BEFORE);
+    }
+    if (not _spill_path.empty()) { _sink = io::data_sink::create(_spill_path); }
+  }
+
+  ~impl()
+  {
+    _source.reset();
+    if (_sink) {
+      _sink.reset();
+      std::remove(_spill_path.c_str());
+    }
+  }
+
+  void push(table_view const& input)
+  {
+    CUDF_EXPECTS(not _merging, "Tables can't be pushed once the sorted rows are returned");
+    if (input.num_rows() == 0) { return; }
+    if (_first_table) {
+      CUDF_EXPECTS(have_same_types(input, _first_table->view()), "Mismatched column types");
+    } else {
+      _first_table = empty_like(input);
+    }
+
+    auto const sorted =
+      sort_by_key(input, input.select(_key_columns), _column_order, _null_precedence);
+    sorted_run run;
+    for (size_type begin = 0; begin < sorted->num_rows(); begin += _block_rows) {
+      auto const end = std::min(begin + _block_rows, sorted->num_rows());
+      run.blocks.push_back(spill(slice(sorted->view(), {begin, end}).front()));
+    }
+    _runs.push_back(std::move(run));
+  }
+
+  std::unique_ptr<table> next_chunk(rmm::mr::device_memory_resource* mr)
+  {
+    if (not _merging) {
+      _merging = true;
+      if (_sink) {
+        _sink->flush();
+        _source = io::datasource::create(_spill_path);
+      }
+    }
+
+    for (auto& run : _runs) {
+      if (run.remaining.num_rows() > 0) { continue; }
+      if (run.has_unloaded_blocks()) {
+        load_next_block(run);
+      } else {
+        run.data.reset();
+      }
+    }
+    std::vector<sorted_run*> active_runs;
+    for (auto& run : _runs) {
+      if (run.remaining.num_rows() > 0) { active_runs.push_back(&run); }
+    }
+    if (active_runs.empty()) { return nullptr; }
+
+    // The rows of the unloaded blocks of a run follow its last loaded row, so the loaded rows up to
+    // the first of these last rows precede all the rows that are not loaded
+    std::vector<table_view> last_rows;
+    for (auto run : active_runs) {
+      if (run->has_unloaded_blocks()) { last_rows.push_back(last_key_row(run->remaining)); }
+    }
+    std::vector<table_view> pieces;
+    if (last_rows.empty()) {
+      for (auto run : active_runs) {
+        pieces.push_back(run->remaining);
+        run->remaining = slice(run->remaining, {0, 0}).front();
+      }
+    } else {
+      auto const last_rows_table = concatenate(last_rows);
+      auto const last_rows_order =
+        sorted_order(last_rows_table->view(), _column_order, _null_precedence);
+      auto const first = read_size_type(last_rows_order->view(), 0);
+      auto const bound = slice(last_rows_table->view(), {first, first + 1}).front();
+      for (auto run : active_runs) {
+        auto const ends = upper_bound(
+          run->remaining.select(_key_columns), bound, _column_order, _null_precedence);
+        auto const pieces_of_run = split(run->remaining, {read_size_type(ends->view(), 0)});
+        pieces.push_back(pieces_of_run.front());
+        run->remaining = pieces_of_run.back();
+      }
+    }
+
+    return merge(pieces, _key_columns, _column_order, _null_precedence, mr);
+  }
+
+ private:
+  table_view last_key_row(table_view const& rows) const
+  {
+    auto const last = rows.num_rows() - 1;
+    return slice(rows.select(_key_columns), {last, last + 1}).front();
+  }
+
+  spilled_block spill(table_view const& block)
+  {
+    auto const packed = pack(block);
+    auto const size   = packed.gpu_data->size();
+    spilled_block spilled{
+      std::vector<uint8_t>(packed.metadata_->data(),
+                           packed.metadata_->data() + packed.metadata_->size()),
+      size,
+      0,
+      io::detail::make_pinned_buffer<uint8_t>(size)};
+    CUDA_TRY(cudaMemcpy(
+      spilled.host_data.get(), packed.gpu_data->data(), size, cudaMemcpyDeviceToHost));
+    if (_sink) {
+      // The pinned buffer only stages the data written to the file
+      spilled.offset = _sink->bytes_written();
+      _sink->host_write(spilled.host_data.get(), size);
+      spilled.host_data.reset();
+    }
+    return spilled;
+  }
+
+  void load_next_block(sorted_run& run)
+  {
+    auto& block = run.blocks[run.next_block++];
+    if (not block.host_data) {
+      block.host_data = io::detail::make_pinned_buffer<uint8_t>(block.size);
+      CUDF_EXPECTS(
+        _source->host_read(block.offset, block.size, block.host_data.get()) == block.size,
+        "Failed to read a spilled block");
+    }
+    run.data = std::make_unique<rmm::device_buffer>(block.size, rmm::cuda_stream_default);
+    CUDA_TRY(
+      cudaMemcpy(run.data->data(), block.host_data.get(), block.size, cudaMemcpyHostToDevice));
+    run.remaining = unpack(block.metadata.data(), static_cast<uint8_t const*>(run.data->data()));
+    // A block is loaded once, so its host memory is released right away
+    block.host_data.reset();
+    block.metadata.clear();
+  }
+
+  std::vector<size_type> _key_columns;
+  std::vector<order> _column_order;
+  std::vector<null_order> _null_precedence;
+  std::string _spill_path;
+  size_type _block_rows;
+  std::unique_ptr<io::data_sink> _sink;
+  std::unique_ptr<io::datasource> _source;
+  std::unique_ptr<table> _first_table;  ///< Empty table of the columns of the pushed tables
+  std::vector<sorted_run> _runs;
+  bool _merging{false};
+};
+
+external_sorter::external_sorter(std::vector<size_type> const& key_columns,
+                                 std::vector<order> const& column_order,
+                                 std::vector<null_order> const& null_precedence,
+                                 std::string const& spill_path,
+                                 size_type block_rows)
+  : _impl{std::make_unique<impl>(
+      key_columns, column_order, null_precedence, spill_path, block_rows)}
+{
+}
+
+external_sorter::~external_sorter() = default;
+
+external_sorter::external_sorter(external_sorter&&) = default;
+
+external_sorter& external_sorter::operator=(external_sorter&&) = default;
+
+void external_sorter::push(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  _impl->push(input);
+}
+
+std::unique_ptr<table> external_sorter::next_chunk(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->next_chunk(mr);
+}
+
+}  // namespace cudf
@@ -21,7 +21,6 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
-#include <structs/utilities.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -36,14 +35,10 @@ auto is_sorted(cudf::table_view const& in,
                std::vector<null_order> const& null_precedence,
                rmm::cuda_stream_view stream)
 {
-  // 0-table_view, 1-column_order, 2-null_precedence, 3-validity_columns
-  auto flattened = structs::detail::flatten_nested_columns(in, column_order, null_precedence);
-
-  auto const d_input           = table_device_view::create(std::get<0>(flattened), stream);
-  auto const d_column_order    = make_device_uvector_async(std::get<1>(flattened), stream);
-  auto const d_null_precedence = has_nulls
-                                   ? make_device_uvector_async(std::get<2>(flattened), stream)
-                                   : rmm::device_uvector<null_order>(0, stream);
+  auto const d_input           = table_device_view::create(in, stream);
+  auto const d_column_order    = make_device_uvector_async(column_order, stream);
+  auto const d_null_precedence = has_nulls ? make_device_uvector_async(null_precedence, stream)
+                                           : rmm::device_uvector<null_order>(0, stream);
 
   auto comparator = row_lexicographic_comparator<has_nulls>(
     *d_input, *d_input, d_column_order.data(), d_null_precedence.data());
@@ -60,7 +55,8 @@ auto is_sorted(cudf::table_view const& in,
 
 bool is_sorted(cudf::table_view const& in,
                std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence)
+               std::vector<null_order> const& null_precedence,
+               rmm::cuda_stream_view stream)
 {
   CUDF_FUNC_RANGE();
   if (in.num_columns() == 0 || in.num_rows() == 0) { return true; }
@@ -76,10 +72,10 @@ bool is_sorted(cudf::table_view const& in,
       "Number of columns in the table doesn't match the vector null_precedence's size .\n");
   }
 
-  if (has_nulls(in)) {
-    return detail::is_sorted<true>(in, column_order, null_precedence, rmm::cuda_stream_default);
+  if (has_nested_nulls(in)) {
+    return detail::is_sorted<true>(in, column_order, null_precedence, stream);
   } else {
-    return detail::is_sorted<false>(in, column_order, null_precedence, rmm::cuda_stream_default);
+    return detail::is_sorted<false>(in, column_order, null_precedence, stream);
   }
 }
 
@@ -0,0 +1,430 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sort/normalized_keys.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/detail/case_folding.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// The number of bytes of a string encoded in every 8-byte key of its prefixes
+constexpr size_type string_prefix_size = 7;
+
+/**
+ * @brief The type whose values are encoded in the keys of elements of type `T`.
+ */
+template <typename T, typename Enable = void>
+struct key_source {
+  using type = T;
+};
+
+template <typename T>
+struct key_source<T, std::enable_if_t<cudf::is_chrono<T>()>> {
+  using type = typename T::rep;
+};
+
+template <typename T>
+struct key_source<T, std::enable_if_t<cudf::is_fixed_point<T>()>> {
+  using type = device_storage_type_t<T>;
+};
+
+template <typename T>
+using key_source_t = typename key_source<T>::type;
+
+/**
+ * @brief Indicates whether the values of type `T` are encoded in keys of at most 64 bits.
+ */
+template <typename T>
+constexpr bool has_fixed_width_key()
+{
+  return cudf::is_fixed_width<T>() and sizeof(key_source_t<T>) <= sizeof(uint64_t);
+}
+
+/**
+ * @brief The unsigned integer type of the keys of values of type `T`.
+ */
+template <typename T>
+using normalized_key_t = std::conditional_t<
+  sizeof(T) == 1,
+  uint8_t,
+  std::conditional_t<sizeof(T) == 2,
+                     uint16_t,
+                     std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+template <typename T>
+constexpr normalized_key_t<T> sign_bit()
+{
+  return normalized_key_t<T>{1} << (sizeof(T) * 8 - 1);
+}
+
+/**
+ * @brief Returns the key of a boolean, false preceding true.
+ */
+template <typename T, std::enable_if_t<std::is_same<T, bool>::value>* = nullptr>
+__device__ normalized_key_t<T> normalize(T value)
+{
+  return value ? 1 : 0;
+}
+
+/**
+ * @brief Returns the key of an unsigned integer, which is the integer itself.
+ */
+template <typename T,
+          std::enable_if_t<std::is_integral<T>::value and std::is_unsigned<T>::value and
+                           not std::is_same<T, bool>::value>* = nullptr>
+__device__ normalized_key_t<T> normalize(T value)
+{
+  return static_cast<normalized_key_t<T>>(value);
+}
+
+/**
+ * @brief Returns the key of a signed integer, whose flipped sign bit orders negative integers
+ * before positive ones.
+ */
+template <typename T,
+          std::enable_if_t<std::is_integral<T>::value and std::is_signed<T>::value>* = nullptr>
+__device__ normalized_key_t<T> normalize(T value)
+{
+  return static_cast<normalized_key_t<T>>(value) ^ sign_bit<T>();
+}
+
+/**
+ * @brief Returns the key of a floating point value.
+ *
+ * Negative values have all their bits flipped, so that greater magnitudes precede, and positive
+ * values only their sign bit. As in `relational_compare`, NaNs are equivalent and follow all other
+ * values, and -0.0 is equivalent to 0.0.
+ */
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+__device__ normalized_key_t<T> normalize(T value)
+{
+  if (isnan(value)) { value = std::numeric_limits<T>::quiet_NaN(); }
+  if (value == T{0}) { value = T{0}; }
+  normalized_key_t<T> bits;
+  std::memcpy(&bits, &value, sizeof(T));
+  return (bits & sign_bit<T>()) ? static_cast<normalized_key_t<T>>(~bits) : (bits | sign_bit<T>());
+}
+
+/**
+ * @brief Computes the key of the fixed-width element at every position of the indices.
+ */
+template <typename Source>
+struct fixed_width_key_fn {
+  using key_type = normalized_key_t<Source>;
+
+  column_device_view const d_column;
+  size_type const* d_indices;
+  bool descending;
+
+  __device__ key_type operator()(size_type i) const
+  {
+    auto const row = d_indices[i];
+    // Null elements are equivalent in the columns' values, and ordered by the null keys
+    if (d_column.is_null(row)) { return 0; }
+    auto const key = normalize(d_column.element<Source>(row));
+    return descending ? static_cast<key_type>(~key) : key;
+  }
+};
+
+/**
+ * @brief Computes the key of a prefix of the string at every position of the indices.
+ *
+ * The key of depth `d` holds the bytes `[7 * d, 7 * d + 7)` of the string in its upper bytes,
+ * and the number of bytes of the string from `7 * d`, up to 8, in its lowest byte. A string that
+ * ends in these bytes thus precedes the longer strings of the same bytes, as with
+ * `string_view::compare`, and only the strings of equal keys whose lowest byte is 8 are ordered by
+ * the keys of the next depth. If `fold_case`, the ASCII letters are keyed as lowercase.
+ */
+struct string_key_fn {
+  using key_type = uint64_t;
+
+  column_device_view const d_column;
+  size_type const* d_indices;
+  bool descending;
+  bool fold_case;
+  size_type depth;
+
+  __device__ key_type operator()(size_type i) const
+  {
+    auto const row = d_indices[i];
+    if (d_column.is_null(row)) { return 0; }
+    auto const d_str = d_column.element<string_view>(row);
+    auto const begin = depth * string_prefix_size;
+    auto const left  = thrust::max(size_type{0}, d_str.size_bytes() - begin);
+    auto const bytes = reinterpret_cast<unsigned char const*>(d_str.data()) + begin;
+    key_type key     = static_cast<key_type>(thrust::min(left, string_prefix_size + 1));
+    for (size_type b = 0; b < thrust::min(left, string_prefix_size); ++b) {
+      auto const byte = fold_case ? strings::detail::fold_ascii_case(bytes[b]) : bytes[b];
+      key |= static_cast<key_type>(byte) << (8 * (string_prefix_size - b));
+    }
+    return descending ? ~key : key;
+  }
+};
+
+/**
+ * @brief Indicates whether the string of a key goes on past the bytes of the key.
+ */
+__device__ bool continues_past_key(uint64_t key, bool descending)
+{
+  return ((descending ? ~key : key) & 0xff) > string_prefix_size;
+}
+
+/**
+ * @brief Computes the key of the validity of the element at every position of the indices.
+ */
+struct null_key_fn {
+  using key_type = uint8_t;
+
+  column_device_view const d_column;
+  size_type const* d_indices;
+  bool nulls_first;
+
+  __device__ key_type operator()(size_type i) const
+  {
+    return d_column.is_null(d_indices[i]) != nulls_first;
+  }
+};
+
+/**
+ * @brief Stably sorts the indices by the keys computed by `key_fn` at their positions.
+ */
+template <typename KeyFn>
+void stable_sort_by_keys(KeyFn key_fn, mutable_column_view& indices, rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<typename KeyFn::key_type> keys(indices.size(), stream);
+  thrust::tabulate(rmm::exec_policy(stream), keys.begin(), keys.end(), key_fn);
+  // The keys are unsigned integers, which thrust sorts with a radix sort
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), keys.begin(), keys.end(), indices.begin<size_type>());
+}
+
+/**
+ * @brief Finds the runs of equal keys of prefixes of strings within the current runs of ties.
+ */
+struct tied_fn {
+  uint64_t const* d_keys;
+  size_type const* d_runs;
+  size_type size;
+  bool descending;
+
+  __device__ bool same_as_previous(size_type j) const
+  {
+    return j > 0 and d_keys[j - 1] == d_keys[j] and d_runs[j - 1] == d_runs[j];
+  }
+
+  /**
+   * @brief Returns whether a position is the first of a run of equal runs and keys.
+   */
+  __device__ bool starts_run(size_type j) const { return not same_as_previous(j); }
+
+  /**
+   * @brief Returns whether the string at a position is left tied with another one, having the
+   * same run and key, and going on past the key.
+   */
+  __device__ bool is_tied(size_type j) const
+  {
+    return continues_past_key(d_keys[j], descending) and
+           (same_as_previous(j) or (j + 1 < size and same_as_previous(j + 1)));
+  }
+};
+
+/**
+ * @brief Stably sorts the indices by the strings of any size that they refer to.
+ *
+ * All the indices are first sorted by the keys of the first prefix of their strings. Then, only
+ * the runs of positions whose strings have equal prefixes and go on past them are sorted by the
+ * keys of their next prefixes, within every run, until no strings are left tied.
+ */
+void stable_sort_strings(column_device_view const& d_column,
+                         bool descending,
+                         bool fold_case,
+                         mutable_column_view& indices,
+                         rmm::cuda_stream_view stream)
+{
+  auto const d_indices = indices.data<size_type>();
+
+  // The positions of the indices left to sort, and the run of ties of every one, in order
+  rmm::device_uvector<size_type> positions(indices.size(), stream);
+  rmm::device_uvector<size_type> runs(indices.size(), stream);
+  thrust::sequence(rmm::exec_policy(stream), positions.begin(), positions.end());
+  thrust::fill(rmm::exec_policy(stream), runs.begin(), runs.end(), 0);
+
+  for (size_type depth = 0; not positions.is_empty(); ++depth) {
+    auto const num_positions = static_cast<size_type>(positions.size());
+
+    rmm::device_uvector<size_type> rows(num_positions, stream);
+    rmm::device_uvector<uint64_t> keys(num_positions, stream);
+    thrust::gather(
+      rmm::exec_policy(stream), positions.begin(), positions.end(), d_indices, rows.begin());
+    thrust::tabulate(rmm::exec_policy(stream),
+                     keys.begin(),
+                     keys.end(),
+                     string_key_fn{d_column, rows.data(), descending, fold_case, depth});
+
+    // Sorted by key within every run, the runs keeping their positions
+    auto const rows_and_runs =
+      thrust::make_zip_iterator(thrust::make_tuple(rows.begin(), runs.begin()));
+    thrust::stable_sort_by_key(rmm::exec_policy(stream), keys.begin(), keys.end(), rows_and_runs);
+    if (depth > 0) {
+      auto const keys_and_rows =
+        thrust::make_zip_iterator(thrust::make_tuple(keys.begin(), rows.begin()));
+      thrust::stable_sort_by_key(rmm::exec_policy(stream), runs.begin(), runs.end(), keys_and_rows);
+    }
+    thrust::scatter(
+      rmm::exec_policy(stream), rows.begin(), rows.end(), positions.begin(), d_indices);
+
+    // The next runs are the positions of equal runs and keys whose strings go on past the keys
+    auto const ties    = tied_fn{keys.data(), runs.data(), num_positions, descending};
+    auto const is_tied = [ties] __device__(size_type j) { return ties.is_tied(j); };
+
+    rmm::device_uvector<size_type> next_runs(num_positions, stream);
+    thrust::transform_inclusive_scan(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_positions),
+      next_runs.begin(),
+      [ties] __device__(size_type j) { return ties.starts_run(j) ? 1 : 0; },
+      thrust::plus<size_type>{});
+
+    rmm::device_uvector<size_type> tied_positions(num_positions, stream);
+    rmm::device_uvector<size_type> tied_runs(num_positions, stream);
+    auto const input =
+      thrust::make_zip_iterator(thrust::make_tuple(positions.begin(), next_runs.begin()));
+    auto const output =
+      thrust::make_zip_iterator(thrust::make_tuple(tied_positions.begin(), tied_runs.begin()));
+    auto const num_tied = thrust::distance(output,
+                                           thrust::copy_if(rmm::exec_policy(stream),
+                                                           input,
+                                                           input + num_positions,
+                                                           thrust::make_counting_iterator(0),
+                                                           output,
+                                                           is_tied));
+    tied_positions.resize(num_tied, stream);
+    tied_runs.resize(num_tied, stream);
+
+    positions = std::move(tied_positions);
+    runs      = std::move(tied_runs);
+  }
+}
+
+struct sort_column_fn {
+  template <typename T, std::enable_if_t<has_fixed_width_key<T>()>* = nullptr>
+  void operator()(column_device_view const& d_column,
+                  bool descending,
+                  bool,
+                  mutable_column_view& indices,
+                  rmm::cuda_stream_view stream) const
+  {
+    stable_sort_by_keys(
+      fixed_width_key_fn<key_source_t<T>>{d_column, indices.data<size_type>(), descending},
+      indices,
+      stream);
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, string_view>::value>* = nullptr>
+  void operator()(column_device_view const& d_column,
+                  bool descending,
+                  bool fold_case,
+                  mutable_column_view& indices,
+                  rmm::cuda_stream_view stream) const
+  {
+    stable_sort_strings(d_column, descending, fold_case, indices, stream);
+  }
+
+  template <typename T,
+            std::enable_if_t<not has_fixed_width_key<T>() and
+                             not std::is_same<T, string_view>::value>* = nullptr>
+  void operator()(column_device_view const&,
+                  bool,
+                  bool,
+                  mutable_column_view&,
+                  rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Normalized keys only support fixed-width columns of up to 8 bytes and strings");
+  }
+};
+
+}  // namespace
+
+bool can_sort_normalized_keys(table_view const& input, rmm::cuda_stream_view)
+{
+  return std::all_of(input.begin(), input.end(), [](column_view const& col) {
+    // decimal128 values cannot be encoded in a 64-bit key
+    return (cudf::is_fixed_width(col.type()) and col.type().id() != type_id::DECIMAL128) or
+           col.type().id() == type_id::STRING;
+  });
+}
+
+void sort_normalized_keys(table_view const& input,
+                          std::vector<order> const& column_order,
+                          std::vector<null_order> const& null_precedence,
+                          std::vector<case_sensitivity> const& key_case,
+                          mutable_column_view& indices,
+                          rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(indices.size() == input.num_rows(), "Mismatch between indices and table sizes");
+
+  // Least significant column first, each stable pass keeping the order of the previous passes
+  // between equivalent keys
+  for (auto c = input.num_columns() - 1; c >= 0; --c) {
+    auto const col        = input.column(c);
+    auto const descending = not column_order.empty() and column_order[c] == order::DESCENDING;
+    auto const fold_case  = not key_case.empty() and key_case[c] == case_sensitivity::INSENSITIVE;
+    auto const d_column   = column_device_view::create(col, stream);
+    type_dispatcher(
+      col.type(), sort_column_fn{}, *d_column, descending, fold_case, indices, stream);
+
+    if (col.has_nulls()) {
+      // Nulls precede the values with null_order::BEFORE, which is reversed by descending order
+      auto const before = null_precedence.empty() or null_precedence[c] == null_order::BEFORE;
+      stable_sort_by_keys(
+        null_key_fn{*d_column, indices.data<size_type>(), before != descending}, indices, stream);
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns whether the rows of `input` can be sorted by `sort_normalized_keys`.
+ *
+ * Every column must be a fixed-width column or a strings column.
+ *
+ * @param input The table to sort
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+bool can_sort_normalized_keys(table_view const& input, rmm::cuda_stream_view stream);
+
+/**
+ * @brief Stably sorts `indices` by the rows of `input` that they refer to, with a radix sort of
+ * order-preserving unsigned keys per column.
+ *
+ * The columns are sorted from the last one to the first one. The key of an element encodes its
+ * value and the column order, so that keys compare in the order of the elements. A strings column
+ * is sorted by the 8-byte keys of the first 7 bytes of its strings and of their sizes, and then
+ * only the runs of strings of equal keys that go on past them are sorted by the keys of their next
+ * 7 bytes, until no strings are left tied. The ASCII letters of the strings of a case-insensitive
+ * column are keyed as lowercase. A column with nulls is additionally sorted by a key of
+ * the nulls and the null precedence, after its values.
+ * The result is the same as a stable sort with `row_lexicographic_comparator`.
+ *
+ * @throw cudf::logic_error if `can_sort_normalized_keys(input)` is false
+ *
+ * @param input The table to sort, whose columns may be sliced
+ * @param column_order The order of every column, or empty for all ascending
+ * @param null_precedence The null order of every column, or empty for all `null_order::BEFORE`
+ * @param key_case The case sensitivity of every column, or empty for all case-sensitive
+ * @param indices The row indices to sort, which are initially a sequence from 0
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void sort_normalized_keys(table_view const& input,
+                          std::vector<order> const& column_order,
+                          std::vector<null_order> const& null_precedence,
+                          std::vector<case_sensitivity> const& key_case,
+                          mutable_column_view& indices,
+                          rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
@@ -22,9 +23,13 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/list_device_view.cuh>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
@@ -32,9 +37,19 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/extrema.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/sequence.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 
 #include <algorithm>
 #include <iterator>
@@ -65,23 +80,25 @@ rmm::device_uvector<size_type> get_segment_indices(size_type num_rows,
   return segment_ids;
 }
 
-std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
-                                               column_view const& segment_offsets,
-                                               std::vector<order> const& column_order,
-                                               std::vector<null_order> const& null_precedence,
-                                               rmm::cuda_stream_view stream,
-                                               rmm::mr::device_memory_resource* mr)
-{
-  CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
-               "segment offsets should be size_type");
-  // Get segment id of each element in all segments.
-  auto segment_ids = get_segment_indices(keys.num_rows(), segment_offsets, stream);
+namespace {
 
+/**
+ * @brief Sorts the rows of `keys` on the segment id of each row, followed by the keys.
+ *
+ * @param segment_ids The segment id of each row of `keys`
+ */
+std::unique_ptr<column> sorted_order_with_segment_ids(
+  table_view const& keys,
+  column_view const& segment_ids,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
   // insert segment id before all columns.
   std::vector<column_view> keys_with_segid;
   keys_with_segid.reserve(keys.num_columns() + 1);
-  keys_with_segid.push_back(
-    column_view(data_type(type_to_id<size_type>()), segment_ids.size(), segment_ids.data()));
+  keys_with_segid.push_back(segment_ids);
   keys_with_segid.insert(keys_with_segid.end(), keys.begin(), keys.end());
   auto segid_keys = table_view(keys_with_segid);
 
@@ -99,6 +116,349 @@ std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
   return detail::sorted_order(segid_keys, child_column_order, child_null_precedence, stream, mr);
 }
 
+// Segments of up to a warp of rows are sorted by a warp each
+constexpr size_type WARP_SEGMENT_SIZE{warp_size};
+// Segments of up to this many rows are sorted by a block each, in shared memory
+constexpr size_type BLOCK_SEGMENT_SIZE{2048};
+constexpr size_type BLOCK_SORT_THREADS{512};
+constexpr size_type WARP_SORT_THREADS{256};
+
+/**
+ * @brief Sorts each segment of up to `WARP_SEGMENT_SIZE` rows with a warp.
+ *
+ * Every lane ranks one row by comparing it to all the rows of the segment, and writes it to its
+ * rank. Rows that compare equal keep their input order.
+ */
+template <typename Comparator>
+__global__ void sort_warp_segments(Comparator less,
+                                   size_type const* boundaries,
+                                   size_type const* segments,
+                                   size_type num_segments,
+                                   size_type* sorted_indices)
+{
+  auto const warp = static_cast<size_type>((blockIdx.x * blockDim.x + threadIdx.x) / warp_size);
+  auto const lane = static_cast<size_type>(threadIdx.x % warp_size);
+  if (warp >= num_segments) { return; }
+  auto const segment = segments[warp];
+  auto const begin   = boundaries[segment];
+  auto const size    = boundaries[segment + 1] - begin;
+  if (lane >= size) { return; }
+
+  auto const row = begin + lane;
+  size_type rank = 0;
+  for (size_type i = 0; i < size; ++i) {
+    rank += i < lane ? not less(row, begin + i) : less(begin + i, row);
+  }
+  sorted_indices[begin + rank] = row;
+}
+
+/**
+ * @brief Sorts each segment of up to `BLOCK_SEGMENT_SIZE` rows with a block, by a bitonic sort of
+ * the row indices in shared memory.
+ *
+ * Ties are broken by row index, so that rows that compare equal keep their input order.
+ */
+template <typename Comparator>
+__global__ void sort_block_segments(Comparator less,
+                                    size_type const* boundaries,
+                                    size_type const* segments,
+                                    size_type* sorted_indices)
+{
+  __shared__ size_type indices[BLOCK_SEGMENT_SIZE];
+  auto const segment = segments[blockIdx.x];
+  auto const begin   = boundaries[segment];
+  auto const size    = boundaries[segment + 1] - begin;
+  auto padded_size   = WARP_SEGMENT_SIZE;
+  while (padded_size < size) {
+    padded_size *= 2;
+  }
+
+  // The padding has negative indices, ordered after all the rows
+  for (size_type i = threadIdx.x; i < padded_size; i += blockDim.x) {
+    indices[i] = i < size ? begin + i : -1;
+  }
+  __syncthreads();
+
+  auto const precedes = [less](size_type lhs, size_type rhs) {
+    if (lhs < 0 or rhs < 0) { return rhs < 0 and lhs >= 0; }
+    return less(lhs, rhs) or (not less(rhs, lhs) and lhs < rhs);
+  };
+  for (size_type width = 2; width <= padded_size; width *= 2) {
+    for (size_type stride = width / 2; stride > 0; stride /= 2) {
+      for (size_type i = threadIdx.x; i < padded_size; i += blockDim.x) {
+        auto const partner = i ^ stride;
+        if (partner > i) {
+          auto const lhs       = indices[i];
+          auto const rhs       = indices[partner];
+          bool const ascending = (i & width) == 0;
+          if (ascending ? precedes(rhs, lhs) : precedes(lhs, rhs)) {
+            indices[i]       = rhs;
+            indices[partner] = lhs;
+          }
+        }
+      }
+      __syncthreads();
+    }
+  }
+
+  for (size_type i = threadIdx.x; i < size; i += blockDim.x) {
+    sorted_indices[begin + i] = indices[i];
+  }
+}
+
+/**
+ * @brief Returns the boundaries of the segments of a table of `num_rows` rows.
+ *
+ * Segment `i` holds the rows `[boundaries[i], boundaries[i + 1])`. The rows before the first
+ * offset and after the last offset form segments of their own, like in `get_segment_indices`.
+ */
+rmm::device_uvector<size_type> get_segment_boundaries(size_type num_rows,
+                                                      column_view const& offsets,
+                                                      rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> boundaries(offsets.size() + 2, stream);
+  auto const d_offsets = offsets.begin<size_type>();
+  thrust::tabulate(rmm::exec_policy(stream),
+                   boundaries.begin(),
+                   boundaries.end(),
+                   [d_offsets, num_offsets = offsets.size(), num_rows] __device__(size_type i) {
+                     if (i == 0) { return 0; }
+                     if (i > num_offsets) { return num_rows; }
+                     return thrust::min(thrust::max(d_offsets[i - 1], 0), num_rows);
+                   });
+  return boundaries;
+}
+
+struct segment_size_fn {
+  size_type const* boundaries;
+
+  __device__ size_type operator()(size_type segment) const
+  {
+    return boundaries[segment + 1] - boundaries[segment];
+  }
+};
+
+struct segment_of_row_fn {
+  size_type const* boundaries;
+  size_type num_segments;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    auto const it = thrust::upper_bound(thrust::seq, boundaries, boundaries + num_segments, row);
+    return static_cast<size_type>(thrust::distance(boundaries, it)) - 1;
+  }
+};
+
+/**
+ * @brief Sorts the segments of up to `BLOCK_SEGMENT_SIZE` rows, by a warp or a block each.
+ */
+template <typename Comparator>
+void sort_small_segments(Comparator comparator,
+                         rmm::device_uvector<size_type> const& boundaries,
+                         mutable_column_view& sorted_indices,
+                         rmm::cuda_stream_view stream)
+{
+  auto const num_segments   = static_cast<size_type>(boundaries.size()) - 1;
+  auto const segment_size   = segment_size_fn{boundaries.data()};
+  auto const segments_begin = thrust::make_counting_iterator<size_type>(0);
+  auto const segments_end   = segments_begin + num_segments;
+  rmm::device_uvector<size_type> segments(num_segments, stream);
+
+  // Segments of a single row are already sorted
+  auto const warp_segments_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    segments_begin,
+                    segments_end,
+                    segments.begin(),
+                    [segment_size] __device__(size_type segment) {
+                      auto const size = segment_size(segment);
+                      return size > 1 and size <= WARP_SEGMENT_SIZE;
+                    });
+  auto const num_warp_segments =
+    static_cast<size_type>(thrust::distance(segments.begin(), warp_segments_end));
+  if (num_warp_segments > 0) {
+    grid_1d const grid{num_warp_segments * warp_size, WARP_SORT_THREADS};
+    sort_warp_segments<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      comparator,
+      boundaries.data(),
+      segments.data(),
+      num_warp_segments,
+      sorted_indices.begin<size_type>());
+  }
+
+  auto const block_segments_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    segments_begin,
+                    segments_end,
+                    segments.begin(),
+                    [segment_size] __device__(size_type segment) {
+                      auto const size = segment_size(segment);
+                      return size > WARP_SEGMENT_SIZE and size <= BLOCK_SEGMENT_SIZE;
+                    });
+  auto const num_block_segments =
+    static_cast<size_type>(thrust::distance(segments.begin(), block_segments_end));
+  if (num_block_segments > 0) {
+    sort_block_segments<<<num_block_segments, BLOCK_SORT_THREADS, 0, stream.value()>>>(
+      comparator, boundaries.data(), segments.data(), sorted_indices.begin<size_type>());
+  }
+}
+
+/**
+ * @brief Sorts the rows of the `num_large_rows` rows of the segments larger than
+ * `BLOCK_SEGMENT_SIZE`, by gathering them and sorting them together on their segment ids.
+ */
+void sort_large_segments(table_view const& keys,
+                         rmm::device_uvector<size_type> const& boundaries,
+                         size_type num_large_rows,
+                         std::vector<order> const& column_order,
+                         std::vector<null_order> const& null_precedence,
+                         mutable_column_view& sorted_indices,
+                         rmm::cuda_stream_view stream)
+{
+  auto const segment_size = segment_size_fn{boundaries.data()};
+  auto const segment_of_row =
+    segment_of_row_fn{boundaries.data(), static_cast<size_type>(boundaries.size()) - 1};
+
+  rmm::device_uvector<size_type> large_rows(num_large_rows, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(keys.num_rows()),
+                  large_rows.begin(),
+                  [segment_size, segment_of_row] __device__(size_type row) {
+                    return segment_size(segment_of_row(row)) > BLOCK_SEGMENT_SIZE;
+                  });
+  rmm::device_uvector<size_type> large_segment_ids(num_large_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    large_rows.begin(),
+                    large_rows.end(),
+                    large_segment_ids.begin(),
+                    segment_of_row);
+
+  auto const large_rows_view =
+    column_view(data_type{type_to_id<size_type>()}, num_large_rows, large_rows.data());
+  auto const large_keys  = detail::gather(keys,
+                                         large_rows_view,
+                                         out_of_bounds_policy::DONT_CHECK,
+                                         detail::negative_index_policy::NOT_ALLOWED,
+                                         stream);
+  auto const large_order = sorted_order_with_segment_ids(
+    large_keys->view(),
+    column_view(data_type{type_to_id<size_type>()}, num_large_rows, large_segment_ids.data()),
+    column_order,
+    null_precedence,
+    stream,
+    cudf::get_current_temp_resource());
+
+  // The segments keep their positions, so the sorted rows go back to the positions of the rows
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_large_rows,
+                     [d_large_rows  = large_rows.data(),
+                      d_large_order = large_order->view().begin<size_type>(),
+                      d_sorted      = sorted_indices.begin<size_type>()] __device__(size_type i) {
+                       d_sorted[d_large_rows[i]] = d_large_rows[d_large_order[i]];
+                     });
+}
+
+/**
+ * @brief Sorts the rows of every segment according to its size.
+ *
+ * Small segments are sorted by a warp each and medium segments by a block each. Only the rows of
+ * the segments larger than `BLOCK_SEGMENT_SIZE` are sorted together with their segment ids.
+ *
+ * @param sorted_indices The indices of the rows, which are sorted within each segment
+ */
+void sort_segments(table_view const& keys,
+                   rmm::device_uvector<size_type> const& boundaries,
+                   size_type num_large_rows,
+                   std::vector<order> const& column_order,
+                   std::vector<null_order> const& null_precedence,
+                   mutable_column_view& sorted_indices,
+                   rmm::cuda_stream_view stream)
+{
+  auto const d_keys            = table_device_view::create(keys, stream);
+  auto const d_column_order    = make_device_uvector_async(column_order, stream);
+  auto const d_null_precedence = make_device_uvector_async(null_precedence, stream);
+  if (has_nested_nulls(keys)) {
+    sort_small_segments(row_lexicographic_comparator<true>(
+                          *d_keys, *d_keys, d_column_order.data(), d_null_precedence.data()),
+                        boundaries,
+                        sorted_indices,
+                        stream);
+  } else {
+    sort_small_segments(
+      row_lexicographic_comparator<false>(*d_keys, *d_keys, d_column_order.data()),
+      boundaries,
+      sorted_indices,
+      stream);
+  }
+
+  if (num_large_rows > 0) {
+    sort_large_segments(
+      keys, boundaries, num_large_rows, column_order, null_precedence, sorted_indices, stream);
+  }
+  // protection for temporary d_column_order and d_null_precedence
+  stream.synchronize();
+}
+
+}  // namespace
+
+std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
+                                               column_view const& segment_offsets,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
+               "segment offsets should be size_type");
+  auto const num_columns = static_cast<std::size_t>(keys.num_columns());
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == num_columns,
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == num_columns,
+               "Mismatch between number of columns and null_precedence size.");
+
+  if (keys.num_rows() == 0 or keys.num_columns() == 0) {
+    return cudf::make_numeric_column(data_type(type_to_id<size_type>()), 0);
+  }
+
+  auto const boundaries = get_segment_boundaries(keys.num_rows(), segment_offsets, stream);
+  auto const num_large_rows =
+    thrust::transform_reduce(rmm::exec_policy(stream),
+                             thrust::make_counting_iterator<size_type>(0),
+                             thrust::make_counting_iterator<size_type>(boundaries.size() - 1),
+                             [d_boundaries = boundaries.data()] __device__(size_type segment) {
+                               auto const size = d_boundaries[segment + 1] - d_boundaries[segment];
+                               return size > BLOCK_SEGMENT_SIZE ? size : 0;
+                             },
+                             size_type{0},
+                             thrust::plus<size_type>{});
+
+  // Without segments small enough for a block, one sort on the segment ids is faster
+  if (num_large_rows == keys.num_rows()) {
+    // Get segment id of each element in all segments.
+    auto segment_ids = get_segment_indices(keys.num_rows(), segment_offsets, stream);
+    return sorted_order_with_segment_ids(
+      keys,
+      column_view(data_type(type_to_id<size_type>()), segment_ids.size(), segment_ids.data()),
+      column_order,
+      null_precedence,
+      stream,
+      mr);
+  }
+
+  auto sorted_indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), keys.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  auto mutable_indices_view = sorted_indices->mutable_view();
+  thrust::sequence(rmm::exec_policy(stream),
+                   mutable_indices_view.begin<size_type>(),
+                   mutable_indices_view.end<size_type>(),
+                   0);
+  sort_segments(
+    keys, boundaries, num_large_rows, column_order, null_precedence, mutable_indices_view, stream);
+  return sorted_indices;
+}
+
 std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
                                              table_view const& keys,
                                              column_view const& segment_offsets,
@@ -114,7 +474,7 @@ std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
                                              column_order,
                                              null_precedence,
                                              stream,
-                                             rmm::mr::get_current_device_resource());
+                                             cudf::get_current_temp_resource());
 
   // Gather segmented sort of child value columns`
   return detail::gather(values,
@@ -126,16 +486,29 @@ std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
 }
 }  // namespace detail
 
+std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
+                                               column_view const& segment_offsets,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_sorted_order(
+    keys, segment_offsets, column_order, null_precedence, stream, mr);
+}
+
 std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
                                              table_view const& keys,
                                              column_view const& segment_offsets,
                                              std::vector<order> const& column_order,
                                              std::vector<null_order> const& null_precedence,
+                                             rmm::cuda_stream_view stream,
                                              rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::segmented_sort_by_key(
-    values, keys, segment_offsets, column_order, null_precedence, rmm::cuda_stream_default, mr);
+    values, keys, segment_offsets, column_order, null_precedence, stream, mr);
 }
 
 }  // namespace cudf
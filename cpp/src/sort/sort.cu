@@ -17,8 +17,10 @@
 #include <cudf/column/column.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <sort/sort_impl.cuh>
 
@@ -32,7 +34,17 @@ std::unique_ptr<column> sorted_order(table_view input,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
-  return sorted_order<false>(input, column_order, null_precedence, stream, mr);
+  return sorted_order<false>(input, column_order, null_precedence, {}, stream, mr);
+}
+
+std::unique_ptr<column> sorted_order(table_view input,
+                                     std::vector<order> const& column_order,
+                                     std::vector<null_order> const& null_precedence,
+                                     std::vector<case_sensitivity> const& key_case,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  return sorted_order<false>(input, column_order, null_precedence, key_case, stream, mr);
 }
 
 std::unique_ptr<table> sort_by_key(table_view const& values,
@@ -46,7 +58,7 @@ std::unique_ptr<table> sort_by_key(table_view const& values,
                "Mismatch in number of rows for values and keys");
 
   auto sorted_order = detail::sorted_order(
-    keys, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+    keys, column_order, null_precedence, stream, cudf::get_current_temp_resource());
 
   return detail::gather(values,
                         sorted_order->view(),
@@ -104,30 +116,50 @@ std::unique_ptr<table> sort(table_view input,
 std::unique_ptr<column> sorted_order(table_view input,
                                      std::vector<order> const& column_order,
                                      std::vector<null_order> const& null_precedence,
+                                     rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::sorted_order(input, column_order, null_precedence, rmm::cuda_stream_default, mr);
+  return detail::sorted_order(input, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<column> sorted_order(table_view input,
+                                     std::vector<order> const& column_order,
+                                     std::vector<null_order> const& null_precedence,
+                                     std::vector<case_sensitivity> const& key_case,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_order(input, column_order, null_precedence, key_case, stream, mr);
 }
 
 std::unique_ptr<table> sort(table_view input,
                             std::vector<order> const& column_order,
                             std::vector<null_order> const& null_precedence,
+                            rmm::cuda_stream_view stream,
                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::sort(input, column_order, null_precedence, rmm::cuda_stream_default, mr);
+  detail::record_input(input);
+  auto result = detail::sort(input, column_order, null_precedence, stream, mr);
+  detail::record_output(result->view());
+  return result;
 }
 
 std::unique_ptr<table> sort_by_key(table_view const& values,
                                    table_view const& keys,
                                    std::vector<order> const& column_order,
                                    std::vector<null_order> const& null_precedence,
+                                   rmm::cuda_stream_view stream,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(
-    values, keys, column_order, null_precedence, rmm::cuda_stream_default, mr);
+  detail::record_input(values);
+  detail::record_input(keys);
+  auto result = detail::sort_by_key(values, keys, column_order, null_precedence, stream, mr);
+  detail::record_output(result->view());
+  return result;
 }
 
 }  // namespace cudf
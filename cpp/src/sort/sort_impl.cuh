@@ -24,7 +24,7 @@
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 
-#include <structs/utilities.hpp>
+#include <sort/normalized_keys.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -33,6 +33,8 @@
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 
@@ -82,14 +84,13 @@ std::unique_ptr<column> sorted_order(column_view const& input,
 
 /**
  * @copydoc
- * sorted_order(table_view&,std::vector<order>,std::vector<null_order>,rmm::mr::device_memory_resource*)
- *
- * @param stream CUDA stream used for device memory operations and kernel launches
+ * sorted_order(table_view&,std::vector<order>,std::vector<null_order>,std::vector<case_sensitivity>,rmm::cuda_stream_view,rmm::mr::device_memory_resource*)
  */
 template <bool stable = false>
 std::unique_ptr<column> sorted_order(table_view input,
                                      std::vector<order> const& column_order,
                                      std::vector<null_order> const& null_precedence,
+                                     std::vector<case_sensitivity> const& key_case,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
@@ -107,6 +108,14 @@ std::unique_ptr<column> sorted_order(table_view input,
                  "Mismatch between number of columns and null_precedence size.");
   }
 
+  if (not key_case.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == key_case.size(),
+                 "Mismatch between number of columns and key_case size.");
+  }
+  auto const folds_case = std::any_of(key_case.begin(), key_case.end(), [](auto sensitivity) {
+    return sensitivity == case_sensitivity::INSENSITIVE;
+  });
+
   std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
     data_type(type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
   mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
@@ -116,7 +125,8 @@ std::unique_ptr<column> sorted_order(table_view input,
                    0);
 
   // fast-path for single column sort
-  if (input.num_columns() == 1 and not cudf::is_nested(input.column(0).type())) {
+  if (input.num_columns() == 1 and not cudf::is_nested(input.column(0).type()) and
+      not folds_case) {
     auto const single_col = input.column(0);
     auto const col_order  = column_order.empty() ? order::ASCENDING : column_order.front();
     auto const null_prec  = null_precedence.empty() ? null_order::BEFORE : null_precedence.front();
@@ -124,15 +134,25 @@ std::unique_ptr<column> sorted_order(table_view input,
                   : sorted_order<false>(single_col, col_order, null_prec, stream, mr);
   }
 
-  auto flattened = structs::detail::flatten_nested_columns(input, column_order, null_precedence);
-  auto& input_flattened     = std::get<0>(flattened);
-  auto device_table         = table_device_view::create(input_flattened, stream);
-  auto const d_column_order = make_device_uvector_async(std::get<1>(flattened), stream);
+  // Radix sort of the columns' normalized keys, whose stable passes suit both sorts
+  if (can_sort_normalized_keys(input, stream)) {
+    sort_normalized_keys(
+      input, column_order, null_precedence, key_case, mutable_indices_view, stream);
+    return sorted_indices;
+  }
 
-  if (has_nulls(input_flattened)) {
-    auto const d_null_precedence = make_device_uvector_async(std::get<2>(flattened), stream);
-    auto const comparator        = row_lexicographic_comparator<true>(
-      *device_table, *device_table, d_column_order.data(), d_null_precedence.data());
+  // The row comparator compares the children of the struct columns
+  auto device_table         = table_device_view::create(input, stream);
+  auto const d_column_order = make_device_uvector_async(column_order, stream);
+  auto const d_key_case     = make_device_uvector_async(key_case, stream);
+
+  if (has_nested_nulls(input)) {
+    auto const d_null_precedence = make_device_uvector_async(null_precedence, stream);
+    auto const comparator        = row_lexicographic_comparator<true>(*device_table,
+                                                               *device_table,
+                                                               d_column_order.data(),
+                                                               d_null_precedence.data(),
+                                                               d_key_case.data());
     if (stable) {
       thrust::stable_sort(rmm::exec_policy(stream),
                           mutable_indices_view.begin<size_type>(),
@@ -144,11 +164,11 @@ std::unique_ptr<column> sorted_order(table_view input,
                    mutable_indices_view.end<size_type>(),
                    comparator);
     }
-    // protection for temporary d_column_order and d_null_precedence
+    // protection for temporary d_column_order, d_null_precedence and d_key_case
     stream.synchronize();
   } else {
-    auto const comparator =
-      row_lexicographic_comparator<false>(*device_table, *device_table, d_column_order.data());
+    auto const comparator = row_lexicographic_comparator<false>(
+      *device_table, *device_table, d_column_order.data(), nullptr, d_key_case.data());
     if (stable) {
       thrust::stable_sort(rmm::exec_policy(stream),
                           mutable_indices_view.begin<size_type>(),
@@ -160,7 +180,7 @@ std::unique_ptr<column> sorted_order(table_view input,
                    mutable_indices_view.end<size_type>(),
                    comparator);
     }
-    // protection for temporary d_column_order
+    // protection for temporary d_column_order and d_key_case
     stream.synchronize();
   }
 
@@ -31,7 +31,17 @@ std::unique_ptr<column> stable_sorted_order(table_view input,
                                             rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
-  return sorted_order<true>(input, column_order, null_precedence, stream, mr);
+  return sorted_order<true>(input, column_order, null_precedence, {}, stream, mr);
+}
+
+std::unique_ptr<column> stable_sorted_order(table_view input,
+                                            std::vector<order> const& column_order,
+                                            std::vector<null_order> const& null_precedence,
+                                            std::vector<case_sensitivity> const& key_case,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  return sorted_order<true>(input, column_order, null_precedence, key_case, stream, mr);
 }
 
 }  // namespace detail
@@ -39,10 +49,20 @@ std::unique_ptr<column> stable_sorted_order(table_view input,
 std::unique_ptr<column> stable_sorted_order(table_view input,
                                             std::vector<order> const& column_order,
                                             std::vector<null_order> const& null_precedence,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  return detail::stable_sorted_order(input, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<column> stable_sorted_order(table_view input,
+                                            std::vector<order> const& column_order,
+                                            std::vector<null_order> const& null_precedence,
+                                            std::vector<case_sensitivity> const& key_case,
+                                            rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
-  return detail::stable_sorted_order(
-    input, column_order, null_precedence, rmm::cuda_stream_default, mr);
+  return detail::stable_sorted_order(input, column_order, null_precedence, key_case, stream, mr);
 }
 
 }  // namespace cudf
@@ -100,6 +100,14 @@ std::unique_ptr<column> sorted_order<true>(column_view const& input,
   mutable_column_view indices_view = sorted_indices->mutable_view();
   thrust::sequence(
     rmm::exec_policy(stream), indices_view.begin<size_type>(), indices_view.end<size_type>(), 0);
+
+  // Strings are radix sorted by their prefixes, comparing no strings
+  if (input.type().id() == type_id::STRING) {
+    sort_normalized_keys(
+      table_view{{input}}, {column_order}, {null_precedence}, {}, indices_view, stream);
+    return sorted_indices;
+  }
+
   cudf::type_dispatcher<dispatch_storage_type>(input.type(),
                                                column_stable_sorted_order_fn{},
                                                input,
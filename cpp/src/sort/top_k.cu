@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/swap.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/// Minimum number of rows of the chunks whose candidates are selected by a thread
+constexpr size_type min_chunk_size = 1024;
+
+/**
+ * @brief Returns whether a row ranks before another one, the lower row breaking ties as in a
+ * stable sort.
+ */
+template <bool has_nulls>
+struct ranks_before {
+  row_lexicographic_comparator<has_nulls> comparator;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (comparator(lhs, rhs)) { return true; }
+    return lhs < rhs and not comparator(rhs, lhs);
+  }
+};
+
+/**
+ * @brief Selects the `k` first rows of every chunk with a bounded heap.
+ *
+ * The heap of a chunk holds at most `k` rows, its root being the last of them, so that every row
+ * is either discarded or replaces the root in `O(log k)`. Unused slots of a heap are left
+ * negative.
+ */
+template <bool has_nulls>
+struct select_candidates_fn {
+  ranks_before<has_nulls> before;
+  size_type num_rows;
+  size_type chunk_size;
+  size_type k;
+  size_type* candidates;
+
+  __device__ void operator()(size_type chunk) const
+  {
+    auto const begin = chunk * chunk_size;
+    auto const end   = begin + min(chunk_size, num_rows - begin);
+    auto heap        = candidates + static_cast<int64_t>(chunk) * k;
+
+    size_type count = 0;
+    for (auto row = begin; row < end; ++row) {
+      if (count < k) {
+        // Sift the new row up while its parent ranks after it
+        auto i  = count++;
+        heap[i] = row;
+        while (i > 0 and before(heap[(i - 1) / 2], heap[i])) {
+          thrust::swap(heap[(i - 1) / 2], heap[i]);
+          i = (i - 1) / 2;
+        }
+      } else if (before(row, heap[0])) {
+        // Sift the new root down while one of its children ranks after it
+        heap[0] = row;
+        size_type i{0};
+        while (true) {
+          auto last = i;
+          for (auto child = 2 * i + 1; child <= 2 * i + 2 and child < count; ++child) {
+            if (before(heap[last], heap[child])) { last = child; }
+          }
+          if (last == i) { break; }
+          thrust::swap(heap[last], heap[i]);
+          i = last;
+        }
+      }
+    }
+  }
+};
+
+template <bool has_nulls>
+std::unique_ptr<column> top_k_candidates(table_device_view const& d_keys,
+                                         size_type k,
+                                         order const* d_column_order,
+                                         null_order const* d_null_precedence,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = d_keys.num_rows();
+  auto const before   = ranks_before<has_nulls>{
+    row_lexicographic_comparator<has_nulls>(d_keys, d_keys, d_column_order, d_null_precedence)};
+
+  // Chunks much larger than k make the candidates a small fraction of the rows
+  auto const chunk_size = static_cast<size_type>(
+    std::min<int64_t>(std::max<int64_t>(min_chunk_size, int64_t{16} * k), num_rows));
+  auto const num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+
+  rmm::device_uvector<size_type> candidates(static_cast<size_t>(num_chunks) * k, stream);
+  thrust::fill(rmm::exec_policy(stream), candidates.begin(), candidates.end(), -1);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_chunks,
+    select_candidates_fn<has_nulls>{before, num_rows, chunk_size, k, candidates.data()});
+  auto const candidates_end = thrust::remove(
+    rmm::exec_policy(stream), candidates.begin(), candidates.end(), size_type{-1});
+  candidates.resize(thrust::distance(candidates.begin(), candidates_end), stream);
+
+  // Only the candidates are sorted, the order of ties being decided by `before`
+  thrust::sort(rmm::exec_policy(stream), candidates.begin(), candidates.end(), before);
+
+  auto const num_selected = std::min<size_type>(k, candidates.size());
+  auto result             = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_selected, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy(rmm::exec_policy(stream),
+               candidates.begin(),
+               candidates.begin() + num_selected,
+               result->mutable_view().begin<size_type>());
+  return result;
+}
+
+}  // namespace
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 0, "top_k requires a non-negative k");
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.");
+  }
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null_precedence size.");
+  }
+
+  if (k == 0 or keys.num_rows() == 0 or keys.num_columns() == 0) {
+    return make_numeric_column(data_type{type_to_id<size_type>()}, 0);
+  }
+
+  if (k >= keys.num_rows()) {
+    return detail::stable_sorted_order(keys, column_order, null_precedence, stream, mr);
+  }
+
+  // Selecting candidates doesn't pay off when k is a large fraction of the rows
+  if (int64_t{16} * k >= keys.num_rows()) {
+    auto const sorted = detail::stable_sorted_order(
+      keys, column_order, null_precedence, stream, cudf::get_current_temp_resource());
+    auto const first_k = cudf::slice(sorted->view(), {0, k}).front();
+    return std::make_unique<column>(first_k, stream, mr);
+  }
+
+  auto d_keys               = table_device_view::create(keys, stream);
+  auto const d_column_order = make_device_uvector_async(column_order, stream);
+
+  if (has_nested_nulls(keys)) {
+    auto const d_null_precedence = make_device_uvector_async(null_precedence, stream);
+    return top_k_candidates<true>(
+      *d_keys, k, d_column_order.data(), d_null_precedence.data(), stream, mr);
+  }
+  return top_k_candidates<false>(*d_keys, k, d_column_order.data(), nullptr, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(keys, k, column_order, null_precedence, stream, mr);
+}
+
+}  // namespace cudf
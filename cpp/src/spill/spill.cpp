@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/pinned_host_pool.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/spill.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <string>
+#include <tuple>
+
+namespace cudf {
+
+struct spillable_column::manager_state {
+  spill_target target;
+  std::string spill_directory;
+  std::mutex mutex;
+  std::vector<std::weak_ptr<spillable_column>> columns;
+  std::atomic<uint64_t> clock{0};      ///< Orders the accesses of the columns
+  std::atomic<uint64_t> next_file{0};  ///< Index of the next spill file
+};
+
+namespace {
+
+/**
+ * @brief A device buffer spilled to host memory or to a file.
+ */
+struct spilled_buffer {
+  size_t size;
+  size_t offset;                                 ///< Offset of the data in the spill file
+  io::detail::pinned_buffer<uint8_t> host_data;  ///< Data, if not spilled to a file
+};
+
+/**
+ * @brief The contents of a spilled column.
+ */
+struct spilled_contents {
+  data_type type;
+  size_type size;
+  size_type null_count;
+  spilled_buffer data;
+  spilled_buffer null_mask;
+  std::vector<spilled_contents> children;
+};
+
+/**
+ * @brief Copies `buffer` to the host, or through the host to `sink`, then frees it.
+ */
+spilled_buffer spill_buffer(rmm::device_buffer& buffer, io::data_sink* sink)
+{
+  spilled_buffer result{buffer.size(), 0, nullptr};
+  if (result.size > 0) {
+    result.host_data = io::detail::make_pinned_buffer<uint8_t>(result.size);
+    CUDA_TRY(
+      cudaMemcpy(result.host_data.get(), buffer.data(), result.size, cudaMemcpyDeviceToHost));
+    if (sink) {
+      // the pinned buffer only stages the data written to the file
+      result.offset = sink->bytes_written();
+      sink->host_write(result.host_data.get(), result.size);
+      result.host_data.reset();
+    }
+  }
+  buffer = rmm::device_buffer{};
+  return result;
+}
+
+/**
+ * @brief Spills the buffers of `col` one by one, each freed once copied.
+ */
+spilled_contents spill_column(std::unique_ptr<column>&& col, io::data_sink* sink)
+{
+  auto const type       = col->type();
+  auto const size       = col->size();
+  auto const null_count = col->null_count();
+  auto contents         = col->release();
+
+  auto data      = spill_buffer(*contents.data, sink);
+  auto null_mask = spill_buffer(*contents.null_mask, sink);
+  std::vector<spilled_contents> children;
+  for (auto& child : contents.children) {
+    children.push_back(spill_column(std::move(child), sink));
+  }
+  return {type, size, null_count, std::move(data), std::move(null_mask), std::move(children)};
+}
+
+rmm::device_buffer unspill_buffer(spilled_buffer& buffer, io::datasource* source)
+{
+  rmm::device_buffer result(buffer.size, rmm::cuda_stream_default);
+  if (buffer.size > 0) {
+    if (not buffer.host_data) {
+      buffer.host_data = io::detail::make_pinned_buffer<uint8_t>(buffer.size);
+      CUDF_EXPECTS(
+        source->host_read(buffer.offset, buffer.size, buffer.host_data.get()) == buffer.size,
+        "Failed to read a spilled buffer");
+    }
+    CUDA_TRY(
+      cudaMemcpy(result.data(), buffer.host_data.get(), buffer.size, cudaMemcpyHostToDevice));
+  }
+  return result;
+}
+
+/**
+ * @brief Copies the spilled buffers back to the device, leaving `spilled` intact in case of
+ * failure.
+ */
+std::unique_ptr<column> unspill_column(spilled_contents& spilled, io::datasource* source)
+{
+  auto data      = unspill_buffer(spilled.data, source);
+  auto null_mask = unspill_buffer(spilled.null_mask, source);
+  std::vector<std::unique_ptr<column>> children;
+  for (auto& child : spilled.children) {
+    children.push_back(unspill_column(child, source));
+  }
+  return std::make_unique<column>(spilled.type,
+                                  spilled.size,
+                                  std::move(data),
+                                  std::move(null_mask),
+                                  spilled.null_count,
+                                  std::move(children));
+}
+
+/**
+ * @brief Returns the number of bytes of device memory of `col` and its descendants.
+ */
+std::size_t device_size(column_view const& col)
+{
+  std::size_t size = col.nullable() ? bitmask_allocation_size_bytes(col.size()) : 0;
+  if (is_fixed_width(col.type())) {
+    size += static_cast<std::size_t>(col.size()) * size_of(col.type());
+  }
+  for (auto child = col.child_begin(); child != col.child_end(); ++child) {
+    size += device_size(*child);
+  }
+  return size;
+}
+
+/**
+ * @brief Computes the null counts of `col` and its descendants, so that spilling doesn't.
+ */
+void cache_null_counts(column& col)
+{
+  col.null_count();
+  for (size_type idx = 0; idx < col.num_children(); ++idx) {
+    cache_null_counts(col.child(idx));
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief The contents of a spilled column, and the file they were spilled to, if any.
+ */
+struct spillable_column::spilled {
+  spilled_contents contents;
+  std::string path;
+
+  ~spilled()
+  {
+    if (not path.empty()) { std::remove(path.c_str()); }
+  }
+};
+
+spillable_column::spillable_column(std::shared_ptr<manager_state> manager,
+                                   std::unique_ptr<column>&& column,
+                                   int priority)
+  : _manager{std::move(manager)},
+    _column{std::move(column)},
+    _size{device_size(_column->view())},
+    _priority{priority}
+{
+  cache_null_counts(*_column);
+  _last_access = _manager->clock++;
+}
+
+spillable_column::~spillable_column() = default;
+
+spillable_column::access_guard::access_guard(access_guard&& other) noexcept
+  : _column{other._column}, _view{other._view}
+{
+  other._column = nullptr;
+}
+
+spillable_column::access_guard::~access_guard()
+{
+  if (_column) { --_column->_num_guards; }
+}
+
+spillable_column::access_guard spillable_column::access()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  CUDF_EXPECTS(not _released, "Spillable column was released");
+  if (_spilled) { unspill_locked(); }
+  ++_num_guards;
+  _last_access = _manager->clock++;
+  return access_guard{this, _column->view()};
+}
+
+std::unique_ptr<column> spillable_column::release()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  CUDF_EXPECTS(not _released, "Spillable column was released");
+  CUDF_EXPECTS(_num_guards == 0, "Spillable column is being accessed");
+  if (_spilled) { unspill_locked(); }
+  _released = true;
+  return std::move(_column);
+}
+
+void spillable_column::spill_locked()
+{
+  std::string path;
+  std::unique_ptr<io::data_sink> sink;
+  if (_manager->target == spill_target::DISK) {
+    path = _manager->spill_directory + "/cudf-spill-" +
+           std::to_string(reinterpret_cast<std::uintptr_t>(_manager.get())) + "-" +
+           std::to_string(_manager->next_file++) + ".bin";
+    sink = io::data_sink::create(path);
+  }
+  auto contents = spill_column(std::move(_column), sink.get());
+  if (sink) { sink->flush(); }
+  _spilled_data.reset(new spilled{std::move(contents), std::move(path)});
+  _spilled = true;
+}
+
+void spillable_column::unspill_locked()
+{
+  auto const& path = _spilled_data->path;
+  auto source      = path.empty() ? nullptr : io::datasource::create(path);
+  _column          = unspill_column(_spilled_data->contents, source.get());
+  source.reset();
+  // frees the host memory or removes the file
+  _spilled_data.reset();
+  _spilled = false;
+}
+
+spillable_table::access_guard::access_guard(std::vector<spillable_column::access_guard>&& guards)
+  : _guards{std::move(guards)}
+{
+  std::vector<column_view> views;
+  for (auto const& guard : _guards) {
+    views.push_back(guard.view());
+  }
+  _view = table_view{views};
+}
+
+spillable_table::access_guard spillable_table::access()
+{
+  std::vector<spillable_column::access_guard> guards;
+  for (auto const& col : _columns) {
+    guards.push_back(col->access());
+  }
+  return access_guard{std::move(guards)};
+}
+
+std::unique_ptr<table> spillable_table::release()
+{
+  std::vector<std::unique_ptr<column>> columns;
+  for (auto const& col : _columns) {
+    columns.push_back(col->release());
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+spill_manager::spill_manager(spill_target target, std::string const& spill_directory)
+  : _state{std::make_shared<spillable_column::manager_state>()}
+{
+  CUDF_EXPECTS(target != spill_target::DISK or not spill_directory.empty(),
+               "Spilling to disk requires a spill directory");
+  _state->target          = target;
+  _state->spill_directory = spill_directory;
+}
+
+std::shared_ptr<spillable_column> spill_manager::make_spillable(std::unique_ptr<column>&& column,
+                                                                int priority)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(column != nullptr, "Spillable column can't be null");
+  std::shared_ptr<spillable_column> result{
+    new spillable_column(_state, std::move(column), priority)};
+  std::lock_guard<std::mutex> lock(_state->mutex);
+  _state->columns.push_back(result);
+  return result;
+}
+
+std::unique_ptr<spillable_table> spill_manager::make_spillable(std::unique_ptr<table>&& table,
+                                                               int priority)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(table != nullptr, "Spillable table can't be null");
+  std::vector<std::shared_ptr<spillable_column>> columns;
+  for (auto& col : table->release()) {
+    columns.push_back(make_spillable(std::move(col), priority));
+  }
+  return std::unique_ptr<spillable_table>{new spillable_table(std::move(columns))};
+}
+
+std::size_t spill_manager::spill(std::size_t bytes)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(_state->mutex);
+  auto& columns = _state->columns;
+  columns.erase(std::remove_if(columns.begin(),
+                               columns.end(),
+                               [](auto const& col) { return col.expired(); }),
+                columns.end());
+
+  std::vector<std::shared_ptr<spillable_column>> candidates;
+  for (auto const& weak_col : columns) {
+    auto col = weak_col.lock();
+    if (col and not col->_released and not col->_spilled and col->_num_guards == 0) {
+      candidates.push_back(std::move(col));
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), [](auto const& lhs, auto const& rhs) {
+    return std::make_tuple(lhs->_priority, lhs->_last_access.load()) <
+           std::make_tuple(rhs->_priority, rhs->_last_access.load());
+  });
+
+  std::size_t freed = 0;
+  for (auto const& col : candidates) {
+    if (freed >= bytes) { break; }
+    // columns locked by other threads are being accessed, released, or brought back
+    std::unique_lock<std::mutex> col_lock(col->_mutex, std::try_to_lock);
+    if (not col_lock or col->_released or col->_spilled or col->_num_guards > 0) { continue; }
+    col->spill_locked();
+    freed += col->_size;
+  }
+  return freed;
+}
+
+std::size_t spill_manager::device_size() const
+{
+  std::lock_guard<std::mutex> lock(_state->mutex);
+  std::size_t size = 0;
+  for (auto const& weak_col : _state->columns) {
+    auto const col = weak_col.lock();
+    if (col and not col->_released and not col->_spilled) { size += col->_size; }
+  }
+  return size;
+}
+
+std::size_t spill_manager::spilled_size() const
+{
+  std::lock_guard<std::mutex> lock(_state->mutex);
+  std::size_t size = 0;
+  for (auto const& weak_col : _state->columns) {
+    auto const col = weak_col.lock();
+    if (col and col->_spilled) { size += col->_size; }
+  }
+  return size;
+}
+
+void* spilling_resource_adaptor::do_allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  while (true) {
+    try {
+      return _upstream->allocate(bytes, stream);
+    } catch (std::bad_alloc const&) {
+      // retried as long as columns are spilled
+      if (_manager.spill(bytes) == 0) { throw; }
+    }
+  }
+}
+
+}  // namespace cudf
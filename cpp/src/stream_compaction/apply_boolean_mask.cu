@@ -23,6 +23,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -52,6 +53,14 @@ struct boolean_mask_filter {
   cudf::column_device_view boolean_mask;
 };
 
+// Returns true if bit i of the bitmask is set
+// This is the filter functor for apply_boolean_mask with a bit-packed mask
+struct bitmask_filter {
+  __device__ inline bool operator()(cudf::size_type i) { return cudf::bit_is_set(boolean_mask, i); }
+
+  cudf::bitmask_type const* boolean_mask;
+};
+
 }  // namespace
 
 namespace cudf {
@@ -82,6 +91,23 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   }
 }
 
+/*
+ * Filters a table_view using a bitmask as a mask.
+ *
+ * calls copy_if() with the `bitmask_filter` functor.
+ */
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          bitmask_type const* boolean_mask,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0) { return empty_like(input); }
+
+  CUDF_EXPECTS(boolean_mask != nullptr, "Mask must not be null");
+
+  return detail::copy_if(input, bitmask_filter{boolean_mask}, stream, mr);
+}
+
 }  // namespace detail
 
 /*
@@ -94,4 +120,15 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   CUDF_FUNC_RANGE();
   return detail::apply_boolean_mask(input, boolean_mask, rmm::cuda_stream_default, mr);
 }
+
+/*
+ * Filters a table_view using a bitmask as a mask.
+ */
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          bitmask_type const* boolean_mask,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_boolean_mask(input, boolean_mask, rmm::cuda_stream_default, mr);
+}
 }  // namespace cudf
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <cmath>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/// Seed of the hash making the low 32 bits of the 64-bit hash of a row
+constexpr uint32_t low_hash_seed{0x9e3779b9};
+
+/// Smallest and largest precisions of a sketch
+constexpr int32_t min_precision{4};
+constexpr int32_t max_precision{18};
+
+/**
+ * @brief Raises the register at `index` to `rank`, if it is lower.
+ *
+ * The registers are bytes packed in 32-bit words, so they are updated with a compare-and-swap of
+ * their word. Its little-endian layout makes the words an array of byte registers in memory.
+ */
+__device__ void update_register(uint32_t* registers, std::size_t index, uint32_t rank)
+{
+  auto const word  = registers + index / 4;
+  auto const shift = (index % 4) * 8;
+  uint32_t old     = *word;
+  uint32_t assumed;
+  do {
+    assumed = old;
+    if (((assumed >> shift) & 0xffu) >= rank) return;
+    old = atomicCAS(word, assumed, (assumed & ~(0xffu << shift)) | (rank << shift));
+  } while (assumed != old);
+}
+
+/**
+ * @brief Updates the HyperLogLog registers of the group of every row with the hash of its value.
+ *
+ * The 64-bit hash of a row is made of two 32-bit hashes with different seeds, which spares the
+ * estimate the correction of hash collisions at large cardinalities.
+ */
+template <bool has_nulls>
+struct update_registers_fn {
+  table_device_view keys;
+  size_type const* group_indices;
+  bool skip_nulls;
+  int32_t precision;
+  uint32_t* registers;
+
+  __device__ void operator()(size_type row_index) const
+  {
+    auto const group = group_indices == nullptr ? 0 : group_indices[row_index];
+    if (group < 0 or (skip_nulls and keys.column(0).is_null(row_index))) return;
+
+    auto const high_hash = row_hasher<default_hash, has_nulls>{keys}(row_index);
+    auto const low_hash  = row_hasher<default_hash, has_nulls>{keys, low_hash_seed}(row_index);
+    auto const hash      = (static_cast<uint64_t>(high_hash) << 32) | low_hash;
+    auto const rest      = hash << precision;
+    // The rank is the position of the first set bit in the hash bits that don't index a register
+    uint32_t const rank =
+      rest == 0 ? 64 - precision + 1 : __clzll(static_cast<long long>(rest)) + 1;
+
+    auto const index = (static_cast<std::size_t>(group) << precision) + (hash >> (64 - precision));
+    update_register(registers, index, rank);
+  }
+};
+
+/**
+ * @brief Raises the registers of the group of every sketch to the registers of the sketch.
+ */
+struct merge_registers_fn {
+  column_device_view sketches;
+  size_type const* offsets;
+  uint8_t const* sketch_registers;
+  size_type const* group_indices;
+  int32_t precision;
+  uint32_t* registers;
+
+  __device__ void operator()(std::size_t element) const
+  {
+    auto const row   = static_cast<size_type>(element >> precision);
+    auto const group = group_indices == nullptr ? 0 : group_indices[row];
+    if (group < 0 or sketches.is_null(row)) return;
+
+    auto const reg  = element & ((std::size_t{1} << precision) - 1);
+    auto const rank = sketch_registers[offsets[row] + reg];
+    if (rank != 0) {
+      update_register(registers, (static_cast<std::size_t>(group) << precision) + reg, rank);
+    }
+  }
+};
+
+using register_sums = thrust::tuple<double, size_type>;
+
+/**
+ * @brief Returns the sum of `2^-register` and the number of empty registers.
+ */
+struct register_sums_fn {
+  uint32_t const* registers;
+
+  __device__ register_sums operator()(std::size_t index) const
+  {
+    auto const rank = (registers[index / 4] >> ((index % 4) * 8)) & 0xffu;
+    return register_sums{ldexp(1.0, -static_cast<int>(rank)), rank == 0 ? 1 : 0};
+  }
+};
+
+struct add_register_sums {
+  __device__ register_sums operator()(register_sums const& lhs, register_sums const& rhs) const
+  {
+    return register_sums{thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                         thrust::get<1>(lhs) + thrust::get<1>(rhs)};
+  }
+};
+
+/**
+ * @brief Returns the HyperLogLog registers of every group of `values`, `2^precision` bytes per
+ * group packed in 32-bit words.
+ */
+rmm::device_uvector<uint32_t> build_registers(column_view const& values,
+                                              device_span<size_type const> group_indices,
+                                              size_type num_groups,
+                                              null_policy null_handling,
+                                              int32_t precision,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(precision >= min_precision and precision <= max_precision,
+               "The precision of an approximate distinct count must be in [4, 18]");
+  CUDF_EXPECTS(not is_nested(values.type()),
+               "Approximate distinct counts of nested types are not supported");
+  CUDF_EXPECTS(group_indices.empty() or group_indices.size() == std::size_t(values.size()),
+               "Mismatch between the number of group indices and of values");
+
+  // The number of registers of a group is a multiple of 4, so the words don't straddle groups
+  auto const num_registers = static_cast<std::size_t>(num_groups) << precision;
+  rmm::device_uvector<uint32_t> registers(num_registers / 4, stream, mr);
+  thrust::fill(rmm::exec_policy(stream), registers.begin(), registers.end(), 0u);
+  if (num_groups == 0) { return registers; }
+
+  // The indices of a dictionary are equal exactly when their keys are
+  auto const keys = cudf::is_dictionary(values.type())
+                      ? cudf::dictionary_column_view(values).get_indices_annotated()
+                      : values;
+
+  auto const keys_table = table_device_view::create(table_view({keys}), stream);
+  auto const skip_nulls = null_handling == null_policy::EXCLUDE;
+  auto const d_indices  = group_indices.empty() ? nullptr : group_indices.data();
+  if (keys.has_nulls()) {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       keys.size(),
+                       update_registers_fn<true>{
+                         *keys_table, d_indices, skip_nulls, precision, registers.data()});
+  } else {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       keys.size(),
+                       update_registers_fn<false>{
+                         *keys_table, d_indices, skip_nulls, precision, registers.data()});
+  }
+  return registers;
+}
+
+/**
+ * @brief Returns the INT64 column of the estimates of the distinct counts of the groups from
+ * their registers.
+ */
+std::unique_ptr<column> estimate_distinct_counts(uint32_t const* registers,
+                                                 size_type num_groups,
+                                                 int32_t precision,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  auto result = make_numeric_column(
+    data_type{type_id::INT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  if (num_groups == 0) { return result; }
+
+  // Sum the registers of every group
+  auto const num_registers = static_cast<std::size_t>(num_groups) << precision;
+  rmm::device_uvector<double> sums(num_groups, stream);
+  rmm::device_uvector<size_type> empty_registers(num_groups, stream);
+  auto const group_of_register = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<std::size_t>(0),
+    [precision] __device__(std::size_t index) { return index >> precision; });
+  thrust::reduce_by_key(
+    rmm::exec_policy(stream),
+    group_of_register,
+    group_of_register + num_registers,
+    thrust::make_transform_iterator(thrust::make_counting_iterator<std::size_t>(0),
+                                    register_sums_fn{registers}),
+    thrust::make_discard_iterator(),
+    thrust::make_zip_iterator(thrust::make_tuple(sums.begin(), empty_registers.begin())),
+    thrust::equal_to<std::size_t>{},
+    add_register_sums{});
+
+  // The raw estimate is biased for small cardinalities, which are counted linearly instead
+  auto const m     = static_cast<double>(1 << precision);
+  auto const alpha = precision == 4   ? 0.673
+                     : precision == 5 ? 0.697
+                     : precision == 6 ? 0.709
+                                      : 0.7213 / (1.0 + 1.079 / m);
+  thrust::transform(rmm::exec_policy(stream),
+                    sums.begin(),
+                    sums.end(),
+                    empty_registers.begin(),
+                    result->mutable_view().begin<int64_t>(),
+                    [m, alpha] __device__(double sum, size_type empty) {
+                      auto const estimate = alpha * m * m / sum;
+                      if (estimate <= 2.5 * m and empty > 0) { return llround(m * log(m / empty)); }
+                      return llround(estimate);
+                    });
+  return result;
+}
+
+}  // namespace
+
+std::unique_ptr<column> approx_distinct_count(column_view const& values,
+                                              device_span<size_type const> group_indices,
+                                              size_type num_groups,
+                                              null_policy null_handling,
+                                              int32_t precision,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  auto const registers = build_registers(values,
+                                         group_indices,
+                                         num_groups,
+                                         null_handling,
+                                         precision,
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+  return estimate_distinct_counts(registers.data(), num_groups, precision, stream, mr);
+}
+
+std::unique_ptr<column> approx_distinct_count_sketch(column_view const& values,
+                                                     device_span<size_type const> group_indices,
+                                                     size_type num_groups,
+                                                     null_policy null_handling,
+                                                     int32_t precision,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  auto registers = build_registers(
+    values, group_indices, num_groups, null_handling, precision, stream, mr);
+
+  // The words of the registers are the bytes of the sketches, one list of registers per group
+  auto const num_registers = static_cast<size_type>(registers.size() * 4);
+  auto child               = std::make_unique<column>(
+    data_type{type_id::UINT8}, num_registers, registers.release(), rmm::device_buffer{}, 0);
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets = offsets->mutable_view().begin<size_type>();
+  thrust::sequence(
+    rmm::exec_policy(stream), d_offsets, d_offsets + num_groups + 1, 0, size_type{1} << precision);
+  return make_lists_column(
+    num_groups, std::move(offsets), std::move(child), 0, rmm::device_buffer{}, stream, mr);
+}
+
+std::unique_ptr<column> merge_approx_distinct_count(column_view const& sketches,
+                                                    device_span<size_type const> group_indices,
+                                                    size_type num_groups,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sketches.type().id() == type_id::LIST and
+                 lists_column_view(sketches).child().type().id() == type_id::UINT8,
+               "Merging approximate distinct counts requires a lists column of UINT8 registers");
+  CUDF_EXPECTS(group_indices.empty() or group_indices.size() == std::size_t(sketches.size()),
+               "Mismatch between the number of group indices and of sketches");
+
+  // All the valid sketches have lists of the same power of 2 of registers, as they were created
+  // with the same precision. Null sketches are ignored, and the groups with no valid sketch have
+  // empty registers whatever the precision.
+  using size_range_type   = thrust::pair<size_type, size_type>;
+  auto const input        = lists_column_view(sketches);
+  auto const d_sketches   = column_device_view::create(sketches, stream);
+  auto const sketch_sizes = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_sketches = *d_sketches, offsets = input.offsets_begin()] __device__(size_type row) {
+      auto const size = offsets[row + 1] - offsets[row];
+      return d_sketches.is_valid(row)
+               ? size_range_type{size, size}
+               : size_range_type{std::numeric_limits<size_type>::max(), 0};
+    });
+  auto const size_range = thrust::reduce(
+    rmm::exec_policy(stream),
+    sketch_sizes,
+    sketch_sizes + sketches.size(),
+    size_range_type{std::numeric_limits<size_type>::max(), 0},
+    [] __device__(size_range_type const& lhs, size_range_type const& rhs) {
+      return size_range_type{thrust::min(lhs.first, rhs.first),
+                             thrust::max(lhs.second, rhs.second)};
+    });
+  auto const num_sketch_registers = size_range.second;
+  auto precision                  = min_precision;
+  if (num_sketch_registers > 0) {
+    while (precision < max_precision and (size_type{1} << precision) < num_sketch_registers) {
+      ++precision;
+    }
+    CUDF_EXPECTS(size_range.first == num_sketch_registers and
+                   (size_type{1} << precision) == num_sketch_registers,
+                 "The sketches must all have the same number of registers, a power of 2 in "
+                 "[2^4, 2^18]");
+  }
+
+  auto const num_registers = static_cast<std::size_t>(num_groups) << precision;
+  rmm::device_uvector<uint32_t> registers(num_registers / 4, stream);
+  thrust::fill(rmm::exec_policy(stream), registers.begin(), registers.end(), 0u);
+  if (num_sketch_registers > 0 and num_groups > 0) {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<std::size_t>(0),
+      static_cast<std::size_t>(sketches.size()) << precision,
+      merge_registers_fn{*d_sketches,
+                         input.offsets_begin(),
+                         input.child().begin<uint8_t>(),
+                         group_indices.empty() ? nullptr : group_indices.data(),
+                         precision,
+                         registers.data()});
+  }
+  return estimate_distinct_counts(registers.data(), num_groups, precision, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
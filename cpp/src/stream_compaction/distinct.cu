@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/concurrent_unordered_map.cuh>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <limits>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Inserts every row in the map, and records the slot of the distinct row that it is equal
+ * to.
+ *
+ * The element of a slot is the first or last of its equal rows with `KEEP_FIRST` or `KEEP_LAST`,
+ * or their number with `KEEP_NONE`.
+ */
+template <typename map_type>
+struct insert_rows_fn {
+  map_type map;
+  duplicate_keep_option keep;
+  size_type* row_slots;
+
+  __device__ void operator()(size_type row)
+  {
+    auto const initial = keep == duplicate_keep_option::KEEP_NONE ? 0 : row;
+    auto const result  = map.insert(thrust::make_pair(row, initial));
+    auto const slot    = &(*result.first);
+    row_slots[row]     = static_cast<size_type>(thrust::distance(map.data(), slot));
+    switch (keep) {
+      case duplicate_keep_option::KEEP_FIRST: atomicMin(&slot->second, row); break;
+      case duplicate_keep_option::KEEP_LAST: atomicMax(&slot->second, row); break;
+      default: atomicAdd(&slot->second, 1);
+    }
+  }
+};
+
+template <bool has_nulls>
+rmm::device_uvector<size_type> distinct_indices(table_device_view const& d_keys,
+                                                duplicate_keep_option keep,
+                                                null_equality nulls_equal,
+                                                rmm::cuda_stream_view stream)
+{
+  using hasher_type = row_hasher<default_hash, has_nulls>;
+  using equal_type  = row_equality_comparator<has_nulls>;
+  using map_type    = concurrent_unordered_map<size_type, size_type, hasher_type, equal_type>;
+
+  auto const num_rows = d_keys.num_rows();
+  auto const hasher   = hasher_type{d_keys};
+  auto const equal    = equal_type{d_keys, d_keys, nulls_equal == null_equality::EQUAL};
+  auto map            = map_type::create(compute_hash_table_size(num_rows),
+                                         stream,
+                                         std::numeric_limits<size_type>::max(),
+                                         std::numeric_limits<size_type>::max(),
+                                         hasher,
+                                         equal);
+
+  rmm::device_uvector<size_type> row_slots(num_rows, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     insert_rows_fn<map_type>{*map, keep, row_slots.data()});
+
+  // Copying the indices of the kept rows in order preserves the order of the input rows
+  rmm::device_uvector<size_type> indices(num_rows, stream);
+  auto const indices_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    indices.begin(),
+    [keep, d_map = map->data(), d_row_slots = row_slots.data()] __device__(size_type row) {
+      auto const element = d_map[d_row_slots[row]].second;
+      return keep == duplicate_keep_option::KEEP_NONE ? element == 1 : element == row;
+    });
+  indices.resize(thrust::distance(indices.begin(), indices_end), stream);
+  return indices;
+}
+
+}  // namespace
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  if (0 == input.num_rows() || 0 == input.num_columns() || 0 == keys.size()) {
+    return empty_like(input);
+  }
+
+  auto const keys_view = input.select(keys);
+  auto const d_keys    = table_device_view::create(keys_view, stream);
+
+  auto const indices = cudf::has_nested_nulls(keys_view)
+                         ? distinct_indices<true>(*d_keys, keep, nulls_equal, stream)
+                         : distinct_indices<false>(*d_keys, keep, nulls_equal, stream);
+  auto const gather_map =
+    column_view(data_type{type_id::INT32}, static_cast<size_type>(indices.size()), indices.data());
+
+  return detail::gather(input,
+                        gather_map,
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct(input, keys, keep, nulls_equal, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
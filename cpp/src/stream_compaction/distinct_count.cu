@@ -23,6 +23,7 @@
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -44,13 +45,13 @@ cudf::size_type distinct_count(table_view const& keys,
                                      std::vector<order>{},
                                      std::vector<null_order>{},
                                      stream,
-                                     rmm::mr::get_current_device_resource());
+                                     cudf::get_current_temp_resource());
 
   // count unique elements
   auto sorted_row_index   = sorted_indices->view().data<cudf::size_type>();
   auto device_input_table = cudf::table_device_view::create(keys, stream);
 
-  if (cudf::has_nulls(keys)) {
+  if (cudf::has_nested_nulls(keys)) {
     row_equality_comparator<true> comp(
       *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
     return thrust::count_if(
@@ -27,6 +27,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -143,12 +144,12 @@ column_view get_unique_ordered_indices(cudf::table_view const& keys,
     std::vector<order>{},
     std::vector<null_order>{static_cast<uint64_t>(keys.num_columns()), null_precedence},
     stream,
-    rmm::mr::get_current_device_resource());
+    cudf::get_current_temp_resource());
 
   // extract unique indices
   auto device_input_table = cudf::table_device_view::create(keys, stream);
 
-  if (cudf::has_nulls(keys)) {
+  if (cudf::has_nested_nulls(keys)) {
     auto comp = row_equality_comparator<true>(
       *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
     auto result_end = unique_copy(sorted_indices->view().begin<cudf::size_type>(),
@@ -15,12 +15,14 @@
  */
 
 #include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -53,6 +55,13 @@ struct valid_table_filter {
   cudf::table_device_view keys_device_view;
 };
 
+// Returns true if the bit of row i is set in the AND of the null masks of the key columns
+struct valid_row_filter {
+  __device__ inline bool operator()(cudf::size_type i) { return cudf::bit_is_set(row_bitmask, i); }
+
+  cudf::bitmask_type const* row_bitmask;
+};
+
 }  // namespace
 
 namespace cudf {
@@ -71,6 +80,14 @@ std::unique_ptr<table> drop_nulls(table_view const& input,
     return std::make_unique<table>(input, stream, mr);
   }
 
+  // Rows valid in every key column are those set in the AND of the null masks of the keys, which
+  // is a single pass over the masks instead of a check of every column for every row
+  if (keep_threshold == keys_view.num_columns()) {
+    auto const row_bitmask = cudf::detail::bitmask_and(keys_view, stream).first;
+    return cudf::detail::copy_if(
+      input, valid_row_filter{static_cast<bitmask_type const*>(row_bitmask.data())}, stream, mr);
+  }
+
   auto keys_device_view = cudf::table_device_view::create(keys_view, stream);
 
   return cudf::detail::copy_if(
@@ -22,6 +22,7 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
@@ -35,6 +36,8 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/scan.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -76,6 +79,26 @@ struct upper_lower_fn {
     return bytes;
   }
 
+  // compute-size / copy the bytes of the converted character
+  __device__ int32_t convert_char(char_utf8 chr, char* d_buffer)
+  {
+    uint32_t code_point = detail::utf8_to_codepoint(chr);
+
+    detail::character_flags_table_type flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
+
+    // we apply special mapping in two cases:
+    // - uncased characters with the special mapping flag, always
+    // - cased characters with the special mapping flag, when matching the input case_flag
+    //
+    if (IS_SPECIAL(flag) && ((flag & case_flag) || !IS_UPPER_OR_LOWER(flag))) {
+      return handle_special_case_bytes(code_point, d_buffer, case_flag);
+    }
+    char_utf8 new_char =
+      (flag & case_flag) ? detail::codepoint_to_utf8(d_case_table[code_point]) : chr;
+    return d_buffer ? detail::from_char_utf8(new_char, d_buffer)
+                    : detail::bytes_in_char_utf8(new_char);
+  }
+
   __device__ void operator()(size_type idx)
   {
     if (d_column.is_null(idx)) {
@@ -86,31 +109,96 @@ struct upper_lower_fn {
     int32_t bytes    = 0;
     char* d_buffer   = d_chars ? d_chars + d_offsets[idx] : nullptr;
     for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
-      uint32_t code_point = detail::utf8_to_codepoint(*itr);
-
-      detail::character_flags_table_type flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
-
-      // we apply special mapping in two cases:
-      // - uncased characters with the special mapping flag, always
-      // - cased characters with the special mapping flag, when matching the input case_flag
-      //
-      if (IS_SPECIAL(flag) && ((flag & case_flag) || !IS_UPPER_OR_LOWER(flag))) {
-        auto const new_bytes = handle_special_case_bytes(code_point, d_buffer, case_flag);
-        bytes += new_bytes;
-        if (d_buffer) d_buffer += new_bytes;
-      } else {
-        char_utf8 new_char =
-          (flag & case_flag) ? detail::codepoint_to_utf8(d_case_table[code_point]) : *itr;
-        if (!d_buffer)
-          bytes += detail::bytes_in_char_utf8(new_char);
-        else
-          d_buffer += detail::from_char_utf8(new_char, d_buffer);
-      }
+      auto const new_bytes = convert_char(*itr, d_buffer);
+      bytes += new_bytes;
+      if (d_buffer) d_buffer += new_bytes;
     }
     if (!d_buffer) d_offsets[idx] = bytes;
   }
 };
 
+constexpr int32_t case_block_size = 256;
+
+/**
+ * @brief Converts the strings using a warp per string.
+ *
+ * Each round the lanes decode the characters beginning at `warp_size` consecutive bytes of
+ * the string, and a warp scan of their converted sizes gives the output position of each.
+ *
+ * Like `upper_lower_fn`, the output size of each string is written to `d_offsets` when
+ * `d_chars` is not set, and the converted characters are written to `d_chars` otherwise.
+ *
+ * @param converter Conversion of the characters and its output arrays
+ */
+__global__ void convert_case_warp_parallel_fn(upper_lower_fn converter)
+{
+  auto const& d_column = converter.d_column;
+  auto const tid       = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  auto const str_idx   = static_cast<size_type>(tid / cudf::detail::warp_size);
+  if (str_idx >= d_column.size()) return;
+  auto const lane = static_cast<size_type>(tid % cudf::detail::warp_size);
+
+  if (d_column.is_null(str_idx)) {
+    if (!converter.d_chars && lane == 0) converter.d_offsets[str_idx] = 0;
+    return;
+  }
+  auto const d_str = d_column.element<string_view>(str_idx);
+  char* d_buffer   = converter.d_chars ? converter.d_chars + converter.d_offsets[str_idx] : nullptr;
+  int32_t bytes    = 0;  // output size of the previous rounds
+  for (size_type base = 0; base < d_str.size_bytes(); base += cudf::detail::warp_size) {
+    auto const pos = base + lane;
+    char_utf8 chr  = 0;
+    int32_t size   = 0;
+    if ((pos < d_str.size_bytes()) && is_begin_utf8_char(d_str.data()[pos])) {
+      to_char_utf8(d_str.data() + pos, chr);
+      size = converter.convert_char(chr, nullptr);
+    }
+    // inclusive scan of the sizes of the round
+    auto offset = size;
+    for (size_type delta = 1; delta < cudf::detail::warp_size; delta *= 2) {
+      auto const prev = __shfl_up_sync(0xffffffff, offset, delta);
+      if (lane >= delta) offset += prev;
+    }
+    if (d_buffer && size > 0) converter.convert_char(chr, d_buffer + bytes + offset - size);
+    bytes += __shfl_sync(0xffffffff, offset, cudf::detail::warp_size - 1);
+  }
+  if (!d_buffer && lane == 0) converter.d_offsets[str_idx] = bytes;
+}
+
+/**
+ * @brief Builds the offsets and chars children of the converted strings with
+ * `convert_case_warp_parallel_fn`, the way `make_strings_children` does with `upper_lower_fn`.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_case_children_warp_parallel(
+  upper_lower_fn converter,
+  size_type strings_count,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto offsets_column = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto offsets_view   = offsets_column->mutable_view();
+  auto d_offsets      = offsets_view.data<int32_t>();
+  converter.d_offsets = d_offsets;
+
+  constexpr size_type strings_per_block = case_block_size / cudf::detail::warp_size;
+  auto const num_blocks = (strings_count + strings_per_block - 1) / strings_per_block;
+
+  // compute the output sizes and then the offsets
+  convert_case_warp_parallel_fn<<<num_blocks, case_block_size, 0, stream.value()>>>(converter);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+
+  // build the chars column
+  auto const bytes  = cudf::detail::get_value<int32_t>(offsets_view, strings_count, stream);
+  auto chars_column = create_chars_child_column(strings_count, bytes, stream, mr);
+  if (bytes > 0) {
+    converter.d_chars = chars_column->mutable_view().data<char>();
+    convert_case_warp_parallel_fn<<<num_blocks, case_block_size, 0, stream.value()>>>(converter);
+  }
+  return std::make_pair(std::move(offsets_column), std::move(chars_column));
+}
+
 /**
  * @brief Utility method for converting upper and lower case characters
  * in a strings column.
@@ -139,7 +227,10 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
                          get_special_case_mapping_table()};
 
   // this utility calls the functor to build the offsets and chars columns
-  auto children = cudf::strings::detail::make_strings_children(functor, strings.size(), stream, mr);
+  auto children =
+    use_warp_per_string(strings, stream)
+      ? make_case_children_warp_parallel(functor, strings.size(), stream, mr)
+      : cudf::strings::detail::make_strings_children(functor, strings.size(), stream, mr);
 
   return make_strings_column(strings.size(),
                              std::move(children.first),
@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/detail/combine.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+#include <strings/convert/utilities.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/logical.h>
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief The largest number of digits after the decimal point of a floating-point element.
+ *
+ * Values scaled by up to 10^18 are rounded to 64-bit integers for the fixed notation.
+ */
+constexpr int32_t max_precision = 18;
+
+/**
+ * @brief A run of literal text or a placeholder of the format pattern.
+ */
+struct format_item {
+  size_type column;   ///< column of the placeholder, or -1 for literal text
+  size_type offset;   ///< position of the literal text in the literals buffer
+  size_type size;     ///< bytes of the literal text
+  size_type width;    ///< minimum number of characters written for the placeholder
+  int32_t precision;  ///< digits after the decimal point, or -1 for the default notation
+  bool zero_pad;      ///< whether numeric elements are padded with zeros rather than spaces
+
+  static format_item new_literal(size_type offset)
+  {
+    return format_item{-1, offset, 0, 0, -1, false};
+  }
+  static format_item new_field(size_type column, size_type width, int32_t precision, bool zeros)
+  {
+    return format_item{column, 0, 0, width, precision, zeros};
+  }
+};
+
+/**
+ * @brief Parses a non-negative decimal number of the format pattern.
+ */
+size_type parse_number(std::string const& digits)
+{
+  CUDF_EXPECTS(!digits.empty() && digits.size() < 10 &&
+                 std::all_of(digits.begin(), digits.end(), [](auto c) { return std::isdigit(c); }),
+               "Invalid placeholder in the format pattern");
+  return static_cast<size_type>(std::stoi(digits));
+}
+
+/**
+ * @brief Returns whether the elements of a column can be formatted.
+ */
+bool is_formattable(data_type type)
+{
+  return type.id() == type_id::STRING || cudf::is_integral(type) ||
+         cudf::is_floating_point(type) || cudf::is_timestamp(type);
+}
+
+/**
+ * @brief Parses the format pattern into literal text items and placeholder items.
+ *
+ * @return The items in the order of the pattern and the bytes of all the literal text items
+ */
+std::pair<std::vector<format_item>, std::vector<char>> parse_pattern(std::string const& pattern,
+                                                                     table_view const& input)
+{
+  std::vector<format_item> items;
+  std::vector<char> literals;
+
+  auto add_literal = [&](char chr) {
+    if (items.empty() || items.back().column >= 0) {
+      items.push_back(format_item::new_literal(static_cast<size_type>(literals.size())));
+    }
+    literals.push_back(chr);
+    ++items.back().size;
+  };
+
+  size_type next_column = 0;
+  for (std::size_t pos = 0; pos < pattern.size(); ++pos) {
+    auto const chr = pattern[pos];
+    if ((chr == '{' || chr == '}') && pos + 1 < pattern.size() && pattern[pos + 1] == chr) {
+      add_literal(chr);
+      ++pos;
+      continue;
+    }
+    CUDF_EXPECTS(chr != '}', "Unmatched '}' in the format pattern");
+    if (chr != '{') {
+      add_literal(chr);
+      continue;
+    }
+
+    auto const end = pattern.find('}', pos);
+    CUDF_EXPECTS(end != std::string::npos, "Unmatched '{' in the format pattern");
+    auto const field = pattern.substr(pos + 1, end - pos - 1);
+    auto const colon = std::min(field.find(':'), field.size());
+    pos              = end;
+
+    auto const index  = field.substr(0, colon);
+    auto const column = index.empty() ? next_column : parse_number(index);
+    CUDF_EXPECTS(column < input.num_columns(), "Placeholder has no column in the input table");
+    next_column = column + 1;
+
+    auto const spec      = colon < field.size() ? field.substr(colon + 1) : std::string{};
+    bool const zero_pad  = !spec.empty() && spec[0] == '0';
+    auto const point     = std::min(spec.find('.'), spec.size());
+    auto const width     = point > 0 ? parse_number(spec.substr(0, point)) : 0;
+    auto const precision = point < spec.size() ? parse_number(spec.substr(point + 1)) : -1;
+
+    auto const type = input.column(column).type();
+    CUDF_EXPECTS(is_formattable(type), "Unsupported column type in the format pattern");
+    CUDF_EXPECTS(precision < 0 || cudf::is_floating_point(type),
+                 "Precision is only supported for floating-point columns");
+    CUDF_EXPECTS(precision <= max_precision, "Precision is larger than 18");
+    items.push_back(format_item::new_field(column, width, precision, zero_pad));
+  }
+  return std::make_pair(std::move(items), std::move(literals));
+}
+
+/**
+ * @brief Copies a string into `d_buffer` if it is not null.
+ *
+ * @return The number of bytes of the string
+ */
+__device__ size_type write_string(string_view const& d_str, char* d_buffer)
+{
+  if (d_buffer) { copy_string(d_buffer, d_str); }
+  return d_str.size_bytes();
+}
+
+/**
+ * @brief Writes a non-negative integer with at least `digits` digits, padded with leading zeros,
+ * into `d_buffer` if it is not null.
+ *
+ * @return The number of bytes of the integer
+ */
+__device__ size_type write_padded_integer(int64_t value, size_type digits, char* d_buffer)
+{
+  auto const bytes = std::max(digits, count_digits(value));
+  if (d_buffer) {
+    for (auto idx = bytes; idx-- > 0; value /= 10) {
+      d_buffer[idx] = '0' + static_cast<char>(value % 10);
+    }
+  }
+  return bytes;
+}
+
+/**
+ * @brief Writes a floating-point value in fixed notation with `precision` digits after the
+ * decimal point into `d_buffer` if it is not null.
+ *
+ * Values that do not fit a 64-bit integer when scaled by 10^precision are written like
+ * `from_floats`.
+ *
+ * @return The number of bytes of the value
+ */
+__device__ size_type write_fixed(double value, int32_t precision, char* d_buffer)
+{
+  auto const scaled = std::abs(value) * exp10(static_cast<double>(precision));
+  if (!std::isfinite(value) || scaled >= 9.2e18) {
+    ftos_converter fts;
+    return d_buffer ? fts.float_to_string(value, d_buffer) : fts.compute_ftos_size(value);
+  }
+
+  uint64_t divisor = 1;
+  for (auto idx = 0; idx < precision; ++idx) {
+    divisor *= 10;
+  }
+  auto const rounded     = static_cast<uint64_t>(round(scaled));
+  auto const integer     = rounded / divisor;
+  auto const fraction    = rounded % divisor;
+  bool const is_negative = std::signbit(value) && rounded != 0;
+
+  auto const bytes = static_cast<size_type>(is_negative) + count_digits(integer) +
+                     (precision > 0 ? precision + 1 : 0);
+  if (d_buffer) {
+    if (is_negative) { *d_buffer++ = '-'; }
+    d_buffer += integer_to_string(integer, d_buffer);
+    if (precision > 0) {
+      *d_buffer++ = '.';
+      write_padded_integer(static_cast<int64_t>(fraction), precision, d_buffer);
+    }
+  }
+  return bytes;
+}
+
+/**
+ * @brief Writes a timestamp as `YYYY-MM-DD`, followed by ` hh:mm:ss` and a fraction of the
+ * second for units below days, into `d_buffer` if it is not null.
+ *
+ * @return The number of bytes of the timestamp
+ */
+template <typename Timestamp>
+__device__ size_type write_timestamp(Timestamp timestamp, char* d_buffer)
+{
+  using namespace cuda::std::chrono;
+  using period = typename Timestamp::duration::period;
+
+  auto const days_since_epoch = floor<days>(timestamp);
+  auto const ymd              = year_month_day(days_since_epoch);
+  auto const year             = static_cast<int32_t>(ymd.year());
+
+  size_type bytes = 0;
+  auto write      = [&](int64_t value, size_type digits) {
+    bytes += write_padded_integer(value, digits, d_buffer ? d_buffer + bytes : nullptr);
+  };
+  auto write_char = [&](char chr) {
+    if (d_buffer) { d_buffer[bytes] = chr; }
+    ++bytes;
+  };
+
+  if (year < 0) { write_char('-'); }
+  write(std::abs(year), 4);
+  write_char('-');
+  write(static_cast<unsigned>(ymd.month()), 2);
+  write_char('-');
+  write(static_cast<unsigned>(ymd.day()), 2);
+  if constexpr (!std::is_same_v<Timestamp, timestamp_D>) {
+    auto const time_of_day   = timestamp - days_since_epoch;
+    auto const total_seconds = duration_cast<seconds>(time_of_day).count();
+    write_char(' ');
+    write(total_seconds / 3600, 2);
+    write_char(':');
+    write((total_seconds / 60) % 60, 2);
+    write_char(':');
+    write(total_seconds % 60, 2);
+
+    constexpr size_type subsecond_digits = period::den >= 1000000000 ? 9
+                                           : period::den >= 1000000  ? 6
+                                           : period::den >= 1000     ? 3
+                                                                     : 0;
+    if constexpr (subsecond_digits > 0) {
+      write_char('.');
+      write((time_of_day % seconds(1)).count(), subsecond_digits);
+    }
+  }
+  return bytes;
+}
+
+/**
+ * @brief Writes a non-null element into `d_buffer` if it is not null.
+ *
+ * @return The number of bytes of the element
+ */
+struct element_writer_fn {
+  template <typename T>
+  __device__ size_type operator()(column_device_view const& d_column,
+                                  size_type idx,
+                                  int32_t precision,
+                                  char* d_buffer) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      return write_string(d_column.element<string_view>(idx), d_buffer);
+    } else if constexpr (std::is_same_v<T, bool>) {
+      auto const value = d_column.element<bool>(idx);
+      return write_string(value ? string_view("true", 4) : string_view("false", 5), d_buffer);
+    } else if constexpr (std::is_integral_v<T>) {
+      auto const value = d_column.element<T>(idx);
+      return d_buffer ? integer_to_string(value, d_buffer) : count_digits(value);
+    } else if constexpr (std::is_floating_point_v<T>) {
+      auto const value = static_cast<double>(d_column.element<T>(idx));
+      if (precision >= 0) { return write_fixed(value, precision, d_buffer); }
+      ftos_converter fts;
+      return d_buffer ? fts.float_to_string(value, d_buffer) : fts.compute_ftos_size(value);
+    } else if constexpr (cudf::is_timestamp<T>()) {
+      return write_timestamp(d_column.element<T>(idx), d_buffer);
+    } else {
+      cudf_assert(false && "Unsupported type in format.");
+      return 0;
+    }
+  }
+};
+
+/**
+ * @brief Formats the elements of each row following the parsed pattern.
+ *
+ * This is called once to compute the size of each output row and once to write it.
+ */
+struct format_fn {
+  table_device_view const d_table;
+  format_item const* d_items;
+  size_type num_items;
+  char const* d_literals;
+  string_scalar_device_view const d_narep;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ bool has_null_element(size_type idx) const
+  {
+    return thrust::any_of(thrust::seq, d_items, d_items + num_items, [&](auto const& item) {
+      return item.column >= 0 && d_table.column(item.column).is_null(idx);
+    });
+  }
+
+  /**
+   * @brief Writes the element of a placeholder padded to its width into `d_buffer` if it is not
+   * null.
+   *
+   * @return The number of bytes written
+   */
+  __device__ size_type write_field(format_item const& item, size_type idx, char* d_buffer) const
+  {
+    auto const& d_column = d_table.column(item.column);
+    bool const is_null   = d_column.is_null(idx);
+    auto write_element   = [&](char* d_output) {
+      return is_null ? write_string(d_narep.value(), d_output)
+                     : type_dispatcher(d_column.type(),
+                                       element_writer_fn{},
+                                       d_column,
+                                       idx,
+                                       item.precision,
+                                       d_output);
+    };
+
+    auto const bytes = write_element(nullptr);
+    bool const is_text =
+      is_null || d_column.type().id() == type_id::STRING || d_column.type().id() == type_id::BOOL8;
+
+    // strings may hold multi-byte characters, the other elements are ASCII
+    auto chars = bytes;
+    if (is_null) {
+      chars = d_narep.value().length();
+    } else if (d_column.type().id() == type_id::STRING) {
+      chars = d_column.element<string_view>(idx).length();
+    }
+
+    auto const padding = std::max(0, item.width - chars);
+    if (d_buffer) {
+      write_element(d_buffer + padding);
+      bool const zero_pad = item.zero_pad && !is_text;
+      memset(d_buffer, zero_pad ? '0' : ' ', padding);
+      // the sign of a zero-padded number goes before the zeros
+      if (zero_pad && padding > 0 && d_buffer[padding] == '-') {
+        d_buffer[padding] = '0';
+        d_buffer[0]       = '-';
+      }
+    }
+    return bytes + padding;
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    if (!d_narep.is_valid() && has_null_element(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes = 0;
+    for (auto item = d_items; item < d_items + num_items; ++item) {
+      auto const d_output = d_buffer ? d_buffer + bytes : nullptr;
+      bytes += item->column < 0
+                 ? write_string(string_view(d_literals + item->offset, item->size), d_output)
+                 : write_field(*item, idx, d_output);
+    }
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> format(std::string const& pattern,
+                               table_view const& input,
+                               string_scalar const& narep,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  auto const [items, literals] = parse_pattern(pattern, input);
+  auto const strings_count     = input.num_rows();
+  if (strings_count == 0) return detail::make_empty_strings_column(stream, mr);
+
+  auto const d_items    = cudf::detail::make_device_uvector_async(items, stream);
+  auto const d_literals = cudf::detail::make_device_uvector_async(literals, stream);
+  auto const d_narep    = get_scalar_device_view(const_cast<string_scalar&>(narep));
+  auto const d_table    = table_device_view::create(input, stream);
+
+  format_fn fn{*d_table,
+               d_items.data(),
+               static_cast<size_type>(d_items.size()),
+               d_literals.data(),
+               d_narep};
+  auto children = make_strings_children(fn, strings_count, stream, mr);
+
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    [fn] __device__(size_type idx) { return fn.d_narep.is_valid() || !fn.has_null_element(idx); },
+    stream,
+    mr);
+
+  return make_strings_column(strings_count,
+                             std::move(children.first),
+                             std::move(children.second),
+                             null_count,
+                             std::move(null_mask),
+                             stream,
+                             mr);
+}
+
+}  // namespace detail
+
+// external API
+
+std::unique_ptr<column> format(std::string const& pattern,
+                               table_view const& input,
+                               string_scalar const& narep,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::format(pattern, input, narep, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
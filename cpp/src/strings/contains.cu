@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <strings/regex/regex.cuh>
@@ -60,6 +61,10 @@ struct contains_fn {
     int32_t begin     = 0;
     int32_t end       = bmatch ? 1  // match only the beginning of the string;
                          : -1;      // this handles empty strings too
+    if (prog.has_dfa()) {
+      auto const result = prog.dfa_find(d_str);  // -1 if the string is not all ASCII
+      if (result >= 0) return static_cast<bool>(result);
+    }
     return static_cast<bool>(prog.find(idx, d_str, begin, end));
   }
 };
@@ -67,7 +72,7 @@ struct contains_fn {
 //
 std::unique_ptr<column> contains_util(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   bool beginning_only                 = false,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
@@ -76,9 +81,11 @@ std::unique_ptr<column> contains_util(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
-  auto d_prog = *prog;
+  // create the device object of the regex, with a DFA for the strings of ASCII characters
+  auto const d_flags = get_character_flags_table();
+  auto const mode    = beginning_only ? dfa_mode::MATCHES : dfa_mode::CONTAINS;
+  auto d_prog_ptr    = reprog_device::create(prog, d_flags, strings_count, stream, mode);
+  auto d_prog        = *d_prog_ptr;
 
   // create the output column
   auto results   = make_numeric_column(data_type{type_id::BOOL8},
@@ -118,20 +125,20 @@ std::unique_ptr<column> contains_util(
 
 std::unique_ptr<column> contains_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return contains_util(strings, pattern, false, stream, mr);
+  return contains_util(strings, prog, false, stream, mr);
 }
 
 std::unique_ptr<column> matches_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return contains_util(strings, pattern, true, stream, mr);
+  return contains_util(strings, prog, true, stream, mr);
 }
 
 }  // namespace detail
@@ -143,7 +150,16 @@ std::unique_ptr<column> contains_re(strings_column_view const& strings,
                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::contains_re(strings, pattern, rmm::cuda_stream_default, mr);
+  return detail::contains_re(
+    strings, *regex_program::create(pattern), rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> contains_re(strings_column_view const& strings,
+                                    regex_program const& prog,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_re(strings, prog, rmm::cuda_stream_default, mr);
 }
 
 std::unique_ptr<column> matches_re(strings_column_view const& strings,
@@ -151,7 +167,15 @@ std::unique_ptr<column> matches_re(strings_column_view const& strings,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::matches_re(strings, pattern, rmm::cuda_stream_default, mr);
+  return detail::matches_re(strings, *regex_program::create(pattern), rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> matches_re(strings_column_view const& strings,
+                                   regex_program const& prog,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::matches_re(strings, prog, rmm::cuda_stream_default, mr);
 }
 
 namespace detail {
@@ -187,7 +211,7 @@ struct count_fn {
 
 std::unique_ptr<column> count_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -195,9 +219,9 @@ std::unique_ptr<column> count_re(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
-  auto d_prog = *prog;
+  // create the device object of the compiled regex
+  auto d_prog_ptr = reprog_device::create(prog, get_character_flags_table(), strings_count, stream);
+  auto d_prog     = *d_prog_ptr;
 
   // create the output column
   auto results   = make_numeric_column(data_type{type_id::INT32},
@@ -235,14 +259,22 @@ std::unique_ptr<column> count_re(
 
 }  // namespace detail
 
-// external API
+// external APIs
 
 std::unique_ptr<column> count_re(strings_column_view const& strings,
                                  std::string const& pattern,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::count_re(strings, pattern, rmm::cuda_stream_default, mr);
+  return detail::count_re(strings, *regex_program::create(pattern), rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> count_re(strings_column_view const& strings,
+                                 regex_program const& prog,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_re(strings, prog, rmm::cuda_stream_default, mr);
 }
 
 }  // namespace strings
@@ -39,6 +39,17 @@ namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+/**
+ * @brief Indicates whether the strings conversions support the decimal type `T`.
+ *
+ * The digits are accumulated and formatted in 64-bit integers, which cannot hold a `decimal128`.
+ */
+template <typename T>
+constexpr bool is_supported_decimal_type()
+{
+  return cudf::is_fixed_point<T>() and not std::is_same<T, numeric::decimal128>::value;
+}
+
 /**
  * @brief Converts strings into an integers and records decimal places.
  *
@@ -173,7 +184,7 @@ struct string_to_decimal_check_fn {
  * @brief The dispatch function for converting strings column to fixed-point column.
  */
 struct dispatch_to_fixed_point_fn {
-  template <typename T, std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
+  template <typename T, std::enable_if_t<is_supported_decimal_type<T>()>* = nullptr>
   std::unique_ptr<column> operator()(strings_column_view const& input,
                                      data_type output_type,
                                      rmm::cuda_stream_view stream,
@@ -202,13 +213,13 @@ struct dispatch_to_fixed_point_fn {
     return results;
   }
 
-  template <typename T, std::enable_if_t<not cudf::is_fixed_point<T>()>* = nullptr>
+  template <typename T, std::enable_if_t<not is_supported_decimal_type<T>()>* = nullptr>
   std::unique_ptr<column> operator()(strings_column_view const&,
                                      data_type,
                                      rmm::cuda_stream_view,
                                      rmm::mr::device_memory_resource*) const
   {
-    CUDF_FAIL("Output for to_fixed_point must be a decimal type.");
+    CUDF_FAIL("Output for to_fixed_point must be a decimal32 or decimal64 type.");
   }
 };
 
@@ -315,7 +326,7 @@ struct decimal_to_string_fn {
  * @brief The dispatcher functor for converting fixed-point values into strings.
  */
 struct dispatch_from_fixed_point_fn {
-  template <typename T, std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
+  template <typename T, std::enable_if_t<is_supported_decimal_type<T>()>* = nullptr>
   std::unique_ptr<column> operator()(column_view const& input,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr) const
@@ -350,12 +361,12 @@ struct dispatch_from_fixed_point_fn {
                                mr);
   }
 
-  template <typename T, std::enable_if_t<not cudf::is_fixed_point<T>()>* = nullptr>
+  template <typename T, std::enable_if_t<not is_supported_decimal_type<T>()>* = nullptr>
   std::unique_ptr<column> operator()(column_view const&,
                                      rmm::cuda_stream_view,
                                      rmm::mr::device_memory_resource*) const
   {
-    CUDF_FAIL("Values for from_fixed_point function must be a decimal type.");
+    CUDF_FAIL("Values for from_fixed_point function must be a decimal32 or decimal64 type.");
   }
 };
 
@@ -384,7 +395,7 @@ namespace detail {
 namespace {
 
 struct dispatch_is_fixed_point_fn {
-  template <typename T, std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
+  template <typename T, std::enable_if_t<is_supported_decimal_type<T>()>* = nullptr>
   std::unique_ptr<column> operator()(strings_column_view const& input,
                                      data_type decimal_type,
                                      rmm::cuda_stream_view stream,
@@ -413,13 +424,13 @@ struct dispatch_is_fixed_point_fn {
     return results;
   }
 
-  template <typename T, std::enable_if_t<not cudf::is_fixed_point<T>()>* = nullptr>
+  template <typename T, std::enable_if_t<not is_supported_decimal_type<T>()>* = nullptr>
   std::unique_ptr<column> operator()(strings_column_view const&,
                                      data_type,
                                      rmm::cuda_stream_view,
                                      rmm::mr::device_memory_resource*) const
   {
-    CUDF_FAIL("is_fixed_point is expecting a decimal type");
+    CUDF_FAIL("is_fixed_point is expecting a decimal32 or decimal64 type");
   }
 };
 
@@ -48,33 +48,7 @@ template <typename IntegerType>
 struct string_to_integer_check_fn {
   __device__ bool operator()(thrust::pair<string_view, bool> const& p) const
   {
-    if (!p.second || p.first.empty()) { return false; }
-
-    auto const d_str = p.first.data();
-    if (d_str[0] == '-' && std::is_unsigned<IntegerType>::value) { return false; }
-
-    auto iter           = d_str + static_cast<int>((d_str[0] == '-' || d_str[0] == '+'));
-    auto const iter_end = d_str + p.first.size_bytes();
-    if (iter == iter_end) { return false; }
-
-    auto const sign = d_str[0] == '-' ? IntegerType{-1} : IntegerType{1};
-    auto const bound_val =
-      sign > 0 ? std::numeric_limits<IntegerType>::max() : std::numeric_limits<IntegerType>::min();
-
-    IntegerType value = 0;      // parse the string to integer and check for overflow along the way
-    while (iter != iter_end) {  // check all bytes for valid characters
-      auto const chr = *iter++;
-      // Check for valid character
-      if (chr < '0' || chr > '9') { return false; }
-
-      // Check for underflow and overflow:
-      auto const digit       = static_cast<IntegerType>(chr - '0');
-      auto const bound_check = (bound_val - sign * digit) / IntegerType{10} * sign;
-      if (value > bound_check) return false;
-      value = value * IntegerType{10} + digit;
-    }
-
-    return true;
+    return p.second && string_to_integer_checked<IntegerType>(p.first).second;
   }
 };
 
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/strings/convert/convert_numeric.hpp>
+#include <cudf/strings/detail/converters.hpp>
+#include <cudf/strings/string.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <strings/convert/utilities.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief Validates and converts a string into the output type in a single pass.
+ *
+ * The value is stored in row `idx` of `d_values`, and is 0 if the string is not valid.
+ */
+struct parse_value_fn {
+  template <typename T, std::enable_if_t<cudf::is_index_type<T>()>* = nullptr>
+  __device__ bool operator()(string_view const& d_str, void* d_values, size_type idx) const
+  {
+    auto const result              = string_to_integer_checked<T>(d_str);
+    static_cast<T*>(d_values)[idx] = result.first;
+    return result.second;
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  __device__ bool operator()(string_view const& d_str, void* d_values, size_type idx) const
+  {
+    auto const is_valid            = string::is_float(d_str);
+    static_cast<T*>(d_values)[idx] = is_valid ? static_cast<T>(stod(d_str)) : T{0};
+    return is_valid;
+  }
+
+  // the output types are checked before launching the parse
+  template <typename T,
+            std::enable_if_t<not cudf::is_index_type<T>() and
+                             not std::is_floating_point<T>::value>* = nullptr>
+  __device__ bool operator()(string_view const&, void*, size_type) const
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief Parses row `idx` of the rows of all the strings columns.
+ *
+ * The rows of column `c` are the rows `[d_offsets[c], d_offsets[c + 1])`.
+ */
+struct parse_numeric_fn {
+  column_device_view const* d_strings;
+  data_type const* d_types;
+  void* const* d_values;
+  size_type const* d_offsets;
+  size_type num_columns;
+  bool* d_valid;  // result of the parse of each row
+
+  __device__ void operator()(size_type idx) const
+  {
+    auto const col = static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, d_offsets, d_offsets + num_columns, idx) - d_offsets - 1);
+    auto const row       = idx - d_offsets[col];
+    auto const& d_column = d_strings[col];
+    // null rows are parsed as empty strings, which are never valid
+    auto const d_str = d_column.is_null(row) ? string_view{} : d_column.element<string_view>(row);
+    d_valid[idx] = type_dispatcher(d_types[col], parse_value_fn{}, d_str, d_values[col], row);
+  }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> parse_numeric(std::vector<strings_column_view> const& strings,
+                                                   std::vector<data_type> const& output_types,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(strings.size() == output_types.size(),
+               "Number of strings columns and output types must match");
+  auto const is_numeric_output = [](auto type) {
+    return is_index_type(type) or is_floating_point(type);
+  };
+  CUDF_EXPECTS(std::all_of(output_types.begin(), output_types.end(), is_numeric_output),
+               "Output types for parse_numeric must be integer or float types.");
+
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<size_type> offsets{0};
+  int64_t total_rows = 0;
+  for (std::size_t idx = 0; idx < strings.size(); ++idx) {
+    total_rows += strings[idx].size();
+    CUDF_EXPECTS(total_rows <= std::numeric_limits<size_type>::max(),
+                 "Total number of rows exceeds size_type range");
+    offsets.push_back(static_cast<size_type>(total_rows));
+    results.push_back(make_numeric_column(
+      output_types[idx], strings[idx].size(), mask_state::UNALLOCATED, stream, mr));
+  }
+  if (total_rows == 0) { return results; }
+
+  // device views of the inputs and of the outputs data
+  using column_device_view_ptr = decltype(
+    column_device_view::create(std::declval<column_view>(), std::declval<rmm::cuda_stream_view>()));
+  std::vector<column_device_view_ptr> strings_owners;
+  std::vector<column_device_view> h_strings;
+  std::vector<void*> h_values;
+  for (std::size_t idx = 0; idx < strings.size(); ++idx) {
+    strings_owners.push_back(column_device_view::create(strings[idx].parent(), stream));
+    h_strings.push_back(*strings_owners.back());
+    h_values.push_back(results[idx]->mutable_view().head());
+  }
+  auto const d_strings = cudf::detail::make_device_uvector_async(h_strings, stream);
+  auto const d_types   = cudf::detail::make_device_uvector_async(output_types, stream);
+  auto const d_values  = cudf::detail::make_device_uvector_async(h_values, stream);
+  auto const d_offsets = cudf::detail::make_device_uvector_async(offsets, stream);
+
+  // validate and convert the rows of all the columns in one pass
+  rmm::device_uvector<bool> valid(total_rows, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     total_rows,
+                     parse_numeric_fn{d_strings.data(),
+                                      d_types.data(),
+                                      d_values.data(),
+                                      d_offsets.data(),
+                                      static_cast<size_type>(strings.size()),
+                                      valid.data()});
+
+  // the failed and null rows are the nulls of the outputs
+  for (std::size_t idx = 0; idx < strings.size(); ++idx) {
+    auto mask = cudf::detail::valid_if(valid.begin() + offsets[idx],
+                                       valid.begin() + offsets[idx + 1],
+                                       thrust::identity<bool>{},
+                                       stream,
+                                       mr);
+    if (mask.second > 0) { results[idx]->set_null_mask(std::move(mask.first), mask.second); }
+  }
+  return results;
+}
+
+}  // namespace detail
+
+// external API
+std::vector<std::unique_ptr<column>> parse_numeric(std::vector<strings_column_view> const& strings,
+                                                   std::vector<data_type> const& output_types,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::parse_numeric(strings, output_types, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
@@ -18,6 +18,11 @@
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/string_view.cuh>
 
+#include <thrust/pair.h>
+
+#include <cmath>
+#include <limits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -50,6 +55,147 @@ __device__ inline int64_t string_to_integer(string_view const& d_str)
   return value * static_cast<int64_t>(sign);
 }
 
+/**
+ * @brief Converts a single string into an integer of type `IntegerType`, validating it in the
+ * same pass.
+ *
+ * The string is valid if it is a '+' or '-' (signed types only) prefix followed by at least one
+ * base-10 [0-9] character, with no other characters, and its value fits within `IntegerType`.
+ *
+ * @tparam IntegerType integer type to convert to
+ * @param d_str string to convert
+ * @return The converted value and true, or false if the string is not a valid `IntegerType`
+ */
+template <typename IntegerType>
+__device__ inline thrust::pair<IntegerType, bool> string_to_integer_checked(
+  string_view const& d_str)
+{
+  auto const invalid = thrust::make_pair(IntegerType{0}, false);
+  if (d_str.empty()) { return invalid; }
+
+  auto const data = d_str.data();
+  if (data[0] == '-' && std::is_unsigned<IntegerType>::value) { return invalid; }
+
+  auto iter           = data + static_cast<int>((data[0] == '-' || data[0] == '+'));
+  auto const iter_end = data + d_str.size_bytes();
+  if (iter == iter_end) { return invalid; }
+
+  bool const is_negative = data[0] == '-';
+
+  // accumulate towards the sign of the value so the minimum of signed types is reachable
+  IntegerType value = 0;
+  while (iter != iter_end) {  // check all bytes for valid characters
+    auto const chr = *iter++;
+    if (chr < '0' || chr > '9') { return invalid; }
+
+    // check for underflow and overflow before adding the digit
+    auto const digit = static_cast<IntegerType>(chr - '0');
+    if (is_negative) {
+      if (value < (std::numeric_limits<IntegerType>::min() + digit) / IntegerType{10}) {
+        return invalid;
+      }
+      value = value * IntegerType{10} - digit;
+    } else {
+      if (value > (std::numeric_limits<IntegerType>::max() - digit) / IntegerType{10}) {
+        return invalid;
+      }
+      value = value * IntegerType{10} + digit;
+    }
+  }
+
+  return thrust::make_pair(value, true);
+}
+
+/**
+ * @brief This function converts the given string into a
+ * floating point double value.
+ *
+ * This will also map strings containing "NaN", "Inf" and "-Inf"
+ * to the appropriate float values.
+ *
+ * This function will also handle scientific notation format.
+ */
+__device__ inline double stod(string_view const& d_str)
+{
+  const char* in_ptr = d_str.data();
+  const char* end    = in_ptr + d_str.size_bytes();
+  if (end == in_ptr) return 0.0;
+  // special strings
+  if (d_str.compare("NaN", 3) == 0) return std::numeric_limits<double>::quiet_NaN();
+  if (d_str.compare("Inf", 3) == 0) return std::numeric_limits<double>::infinity();
+  if (d_str.compare("-Inf", 4) == 0) return -std::numeric_limits<double>::infinity();
+  double sign{1.0};
+  if (*in_ptr == '-' || *in_ptr == '+') {
+    sign = (*in_ptr == '-' ? -1 : 1);
+    ++in_ptr;
+  }
+
+  // Parse and store the mantissa as much as we can,
+  // until we are about to exceed the limit of uint64_t
+  constexpr uint64_t max_holding = (std::numeric_limits<uint64_t>::max() - 9L) / 10L;
+  uint64_t digits                = 0;
+  int exp_off                    = 0;
+  bool decimal                   = false;
+  while (in_ptr < end) {
+    char ch = *in_ptr;
+    if (ch == '.') {
+      decimal = true;
+      ++in_ptr;
+      continue;
+    }
+    if (ch < '0' || ch > '9') break;
+    if (digits > max_holding)
+      exp_off += (int)!decimal;
+    else {
+      digits = (digits * 10L) + static_cast<uint64_t>(ch - '0');
+      if (digits > max_holding) {
+        digits = digits / 10L;
+        exp_off += (int)!decimal;
+      } else
+        exp_off -= (int)decimal;
+    }
+    ++in_ptr;
+  }
+  if (digits == 0) return sign * static_cast<double>(0);
+
+  // check for exponent char
+  int exp_ten  = 0;
+  int exp_sign = 1;
+  if (in_ptr < end) {
+    char ch = *in_ptr++;
+    if (ch == 'e' || ch == 'E') {
+      if (in_ptr < end) {
+        ch = *in_ptr;
+        if (ch == '-' || ch == '+') {
+          exp_sign = (ch == '-' ? -1 : 1);
+          ++in_ptr;
+        }
+        while (in_ptr < end) {
+          ch = *in_ptr++;
+          if (ch < '0' || ch > '9') break;
+          exp_ten = (exp_ten * 10) + (int)(ch - '0');
+        }
+      }
+    }
+  }
+
+  int const num_digits = static_cast<int>(log10(digits)) + 1;
+  exp_ten *= exp_sign;
+  exp_ten += exp_off;
+  exp_ten += num_digits - 1;
+  if (exp_ten > std::numeric_limits<double>::max_exponent10)
+    return sign > 0 ? std::numeric_limits<double>::infinity()
+                    : -std::numeric_limits<double>::infinity();
+  else if (exp_ten < std::numeric_limits<double>::min_exponent10)
+    return double{0};
+
+  // exp10() is faster than pow(10.0,exp_ten)
+  double const base =
+    sign * static_cast<double>(digits) * exp10(static_cast<double>(1 - num_digits));
+  double const exponent = exp10(static_cast<double>(exp_ten));
+  return base * exponent;
+}
+
 /**
  * @brief Converts an integer into string
  *
@@ -129,6 +275,226 @@ constexpr size_type count_digits(IntegerType value)
   return digits + static_cast<size_type>(is_negative);
 }
 
+/**
+ * @brief Code logic for converting float value into a string.
+ *
+ * The floating point components are dissected and used to fill an
+ * existing output char array.
+ */
+struct ftos_converter {
+  // significant digits is independent of scientific notation range
+  // digits more than this may require using long values instead of ints
+  static constexpr unsigned int significant_digits = 10;
+  // maximum power-of-10 that will fit in 32-bits
+  static constexpr unsigned int nine_digits = 1000000000;  // 1x10^9
+  // Range of numbers here is for normalizing the value.
+  // If the value is above or below the following limits, the output is converted to
+  // scientific notation in order to show (at most) the number of significant digits.
+  static constexpr double upper_limit = 1000000000;  // max is 1x10^9
+  static constexpr double lower_limit = 0.0001;      // printf uses scientific notation below this
+  // Tables for doing normalization: converting to exponent form
+  // IEEE double float has maximum exponent of 305 so these should cover everthing
+  const double upper10[9]  = {10, 100, 10000, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256};
+  const double lower10[9]  = {.1, .01, .0001, 1e-8, 1e-16, 1e-32, 1e-64, 1e-128, 1e-256};
+  const double blower10[9] = {1.0, .1, .001, 1e-7, 1e-15, 1e-31, 1e-63, 1e-127, 1e-255};
+
+  // utility for quickly converting known integer range to character array
+  __device__ char* int2str(int value, char* output)
+  {
+    if (value == 0) {
+      *output++ = '0';
+      return output;
+    }
+    char buffer[significant_digits];  // should be big-enough for significant digits
+    char* ptr = buffer;
+    while (value > 0) {
+      *ptr++ = (char)('0' + (value % 10));
+      value /= 10;
+    }
+    while (ptr != buffer) *output++ = *--ptr;  // 54321 -> 12345
+    return output;
+  }
+
+  /**
+   * @brief Dissect a float value into integer, decimal, and exponent components.
+   *
+   * @return The number of decimal places.
+   */
+  __device__ int dissect_value(double value,
+                               unsigned int& integer,
+                               unsigned int& decimal,
+                               int& exp10)
+  {
+    int decimal_places = significant_digits - 1;
+    // normalize step puts value between lower-limit and upper-limit
+    // by adjusting the exponent up or down
+    exp10 = 0;
+    if (value > upper_limit) {
+      int fx = 256;
+      for (int idx = 8; idx >= 0; --idx) {
+        if (value >= upper10[idx]) {
+          value *= lower10[idx];
+          exp10 += fx;
+        }
+        fx = fx >> 1;
+      }
+    } else if ((value > 0.0) && (value < lower_limit)) {
+      int fx = 256;
+      for (int idx = 8; idx >= 0; --idx) {
+        if (value < blower10[idx]) {
+          value *= upper10[idx];
+          exp10 -= fx;
+        }
+        fx = fx >> 1;
+      }
+    }
+    //
+    unsigned int max_digits = nine_digits;
+    integer                 = (unsigned int)value;
+    for (unsigned int i = integer; i >= 10; i /= 10) {
+      --decimal_places;
+      max_digits /= 10;
+    }
+    double remainder = (value - (double)integer) * (double)max_digits;
+    decimal          = (unsigned int)remainder;
+    remainder -= (double)decimal;
+    decimal += (unsigned int)(2.0 * remainder);
+    if (decimal >= max_digits) {
+      decimal = 0;
+      ++integer;
+      if (exp10 && (integer >= 10)) {
+        ++exp10;
+        integer = 1;
+      }
+    }
+    //
+    while ((decimal % 10) == 0 && (decimal_places > 0)) {
+      decimal /= 10;
+      --decimal_places;
+    }
+    return decimal_places;
+  }
+
+  /**
+   * @brief Main kernel method for converting float value to char output array.
+   *
+   * Output need not be more than (significant_digits + 7) bytes:
+   * 7 = 1 sign, 1 decimal point, 1 exponent ('e'), 1 exponent-sign, 3 digits for exponent
+   *
+   * @param value Float value to convert.
+   * @param output Memory to write output characters.
+   * @return Number of bytes written.
+   */
+  __device__ int float_to_string(double value, char* output)
+  {
+    // check for valid value
+    if (std::isnan(value)) {
+      memcpy(output, "NaN", 3);
+      return 3;
+    }
+    bool bneg = false;
+    if (signbit(value)) {  // handles -0.0 too
+      value = -value;
+      bneg  = true;
+    }
+    if (std::isinf(value)) {
+      if (bneg)
+        memcpy(output, "-Inf", 4);
+      else
+        memcpy(output, "Inf", 3);
+      return bneg ? 4 : 3;
+    }
+
+    // dissect value into components
+    unsigned int integer = 0, decimal = 0;
+    int exp10          = 0;
+    int decimal_places = dissect_value(value, integer, decimal, exp10);
+    //
+    // now build the string from the
+    // components: sign, integer, decimal, exp10, decimal_places
+    //
+    // sign
+    char* ptr = output;
+    if (bneg) *ptr++ = '-';
+    // integer
+    ptr = int2str(integer, ptr);
+    // decimal
+    *ptr++ = '.';
+    if (decimal_places) {
+      char buffer[10];
+      char* pb = buffer;
+      while (decimal_places--) {
+        *pb++ = (char)('0' + (decimal % 10));
+        decimal /= 10;
+      }
+      while (pb != buffer)  // reverses the digits
+        *ptr++ = *--pb;     // e.g. 54321 -> 12345
+    } else
+      *ptr++ = '0';  // always include at least .0
+    // exponent
+    if (exp10) {
+      *ptr++ = 'e';
+      if (exp10 < 0) {
+        *ptr++ = '-';
+        exp10  = -exp10;
+      } else
+        *ptr++ = '+';
+      if (exp10 < 10) *ptr++ = '0';  // extra zero-pad
+      ptr = int2str(exp10, ptr);
+    }
+    // done
+    return (int)(ptr - output);  // number of bytes written
+  }
+
+  /**
+   * @brief Compute how man bytes are needed to hold the output string.
+   *
+   * @param value Float value to convert.
+   * @return Number of bytes required.
+   */
+  __device__ int compute_ftos_size(double value)
+  {
+    if (std::isnan(value)) return 3;  // NaN
+    bool bneg = false;
+    if (signbit(value)) {  // handles -0.0 too
+      value = -value;
+      bneg  = true;
+    }
+    if (std::isinf(value)) return 3 + (int)bneg;  // Inf
+
+    // dissect float into parts
+    unsigned int integer = 0, decimal = 0;
+    int exp10          = 0;
+    int decimal_places = dissect_value(value, integer, decimal, exp10);
+    // now count up the components
+    // sign
+    int count = (int)bneg;
+    // integer
+    count += (int)(integer == 0);
+    while (integer > 0) {
+      integer /= 10;
+      ++count;
+    }  // log10(integer)
+    // decimal
+    ++count;  // decimal point
+    if (decimal_places)
+      count += decimal_places;
+    else
+      ++count;  // always include .0
+    // exponent
+    if (exp10) {
+      count += 2;  // 'e±'
+      if (exp10 < 0) exp10 = -exp10;
+      count += (int)(exp10 < 10);  // padding
+      while (exp10 > 0) {
+        exp10 /= 10;
+        ++count;
+      }  // log10(exp10)
+    }
+    return count;
+  }
+};
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -20,6 +20,7 @@
 #include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/detail/concatenate.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -31,6 +32,7 @@
 #include "thrust/iterator/transform_iterator.h"
 
 #include <thrust/binary_search.h>
+#include <thrust/extrema.h>
 #include <thrust/for_each.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
@@ -38,19 +40,6 @@
 namespace cudf {
 namespace strings {
 namespace detail {
-// Benchmark data, shared at https://github.com/rapidsai/cudf/pull/4703, shows
-// that the single kernel optimization generally performs better, but when the
-// number of chars/col is beyond a certain threshold memcpy performs better.
-// This heuristic estimates which strategy will give better performance by
-// comparing the mean chars/col with values from the above table.
-constexpr bool use_fused_kernel_heuristic(bool const has_nulls,
-                                          size_t const total_bytes,
-                                          size_t const num_columns)
-{
-  return has_nulls ? total_bytes < num_columns * 1572864  // midpoint of 1048576 and 2097152
-                   : total_bytes < num_columns * 393216;  // midpoint of 262144 and 524288
-}
-
 // Using a functor instead of a lambda as a workaround for:
 // error: The enclosing parent function ("create_strings_device_views") for an
 // extended __device__ lambda must not have deduced return type
@@ -71,7 +60,7 @@ auto create_strings_device_views(host_span<column_view const> views, rmm::cuda_s
 {
   CUDF_FUNC_RANGE();
   // Assemble contiguous array of device views
-  std::unique_ptr<rmm::device_buffer> device_view_owners;
+  std::unique_ptr<cudf::detail::device_view_storage> device_view_owners;
   column_device_view* device_views_ptr;
   std::tie(device_view_owners, device_views_ptr) =
     contiguous_copy_column_device_views<column_device_view>(views, stream);
@@ -171,35 +160,55 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
   }
 }
 
-__global__ void fused_concatenate_string_chars_kernel(column_device_view const* input_views,
-                                                      size_t const* partition_offsets,
-                                                      size_type const num_input_views,
-                                                      size_type const output_size,
-                                                      char* output_data)
+/**
+ * @brief Copies the characters of all the input strings columns into the chars of the output
+ * column with a single launch.
+ *
+ * Every block copies a tile of `bytes_per_block` consecutive output bytes, which spans the chars of
+ * one or more input columns: the block only searches the input column of its first byte, then
+ * copies the columns of the tile one after the other, its threads copying consecutive bytes. So
+ * large columns are copied by many blocks while many small columns are copied by few of them,
+ * without a launch or a synchronization per column.
+ *
+ * @param input_views The input strings columns
+ * @param partition_offsets The offset of the chars of each input column in the output chars,
+ * followed by the total number of bytes
+ * @param num_input_views The number of input columns
+ * @param bytes_per_block The number of bytes copied by each block
+ * @param output_data The output chars
+ */
+__global__ void batched_concatenate_string_chars_kernel(column_device_view const* input_views,
+                                                        size_t const* partition_offsets,
+                                                        size_type const num_input_views,
+                                                        size_t const bytes_per_block,
+                                                        char* output_data)
 {
-  size_type output_index = threadIdx.x + blockIdx.x * blockDim.x;
-
-  while (output_index < output_size) {
-    // Lookup input index by searching for output index in offsets
-    // thrust::prev isn't in CUDA 10.0, so subtracting 1 here instead
-    auto const offset_it =
-      -1 + thrust::upper_bound(
-             thrust::seq, partition_offsets, partition_offsets + num_input_views, output_index);
-    size_type const partition_index = offset_it - partition_offsets;
-
-    auto const offset_index = output_index - *offset_it;
-    auto const& input_view  = input_views[partition_index];
-
-    constexpr auto offsets_child   = strings_column_view::offsets_column_index;
-    auto const* input_offsets_data = input_view.child(offsets_child).data<int32_t>();
-
-    constexpr auto chars_child   = strings_column_view::chars_column_index;
-    auto const* input_chars_data = input_view.child(chars_child).data<char>();
-
-    auto const first_char     = input_offsets_data[input_view.offset()];
-    output_data[output_index] = input_chars_data[offset_index + first_char];
-
-    output_index += blockDim.x * gridDim.x;
+  auto const total_bytes = partition_offsets[num_input_views];
+  auto const tile_begin  = static_cast<size_t>(blockIdx.x) * bytes_per_block;
+  auto const tile_end    = thrust::min(tile_begin + bytes_per_block, total_bytes);
+  if (tile_begin >= tile_end) { return; }
+
+  // The last column starting at or before the tile is the non-empty column of its first byte
+  // thrust::prev isn't in CUDA 10.0, so subtracting 1 here instead
+  auto partition_index = static_cast<size_type>(
+    thrust::upper_bound(
+      thrust::seq, partition_offsets, partition_offsets + num_input_views, tile_begin) -
+    partition_offsets - 1);
+
+  constexpr auto offsets_child = strings_column_view::offsets_column_index;
+  constexpr auto chars_child   = strings_column_view::chars_column_index;
+  for (auto begin = tile_begin; begin < tile_end; ++partition_index) {
+    auto const end         = thrust::min(partition_offsets[partition_index + 1], tile_end);
+    auto const& input_view = input_views[partition_index];
+    if (end > begin) {
+      auto const first_char  = input_view.child(offsets_child).data<int32_t>()[input_view.offset()];
+      auto const* input_data = input_view.child(chars_child).data<char>() + first_char +
+                               (begin - partition_offsets[partition_index]);
+      for (auto i = static_cast<size_t>(threadIdx.x); i < end - begin; i += blockDim.x) {
+        output_data[begin + i] = input_data[i];
+      }
+      begin = end;
+    }
   }
 }
 
@@ -266,42 +275,16 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
     if (has_nulls) { null_count = strings_count - d_valid_count.value(stream); }
   }
 
-  if (total_bytes > 0) {
-    // Use a heuristic to guess when the fused kernel will be faster than memcpy
-    if (use_fused_kernel_heuristic(has_nulls, total_bytes, columns.size())) {
-      // Use single kernel launch to copy chars columns
-      constexpr size_type block_size{256};
-      cudf::detail::grid_1d config(total_bytes, block_size);
-      auto const kernel = fused_concatenate_string_chars_kernel;
-      kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-        d_views,
-        d_partition_offsets.data(),
-        static_cast<size_type>(columns.size()),
-        total_bytes,
-        d_new_chars);
-    } else {
-      // Memcpy each input chars column (more efficient for very large strings)
-      for (auto column = columns.begin(); column != columns.end(); ++column) {
-        size_type column_size = column->size();
-        if (column_size == 0)  // nothing to do
-          continue;            // empty column may not have children
-        size_type column_offset   = column->offset();
-        column_view offsets_child = column->child(strings_column_view::offsets_column_index);
-        column_view chars_child   = column->child(strings_column_view::chars_column_index);
-
-        auto d_offsets       = offsets_child.data<int32_t>() + column_offset;
-        int32_t bytes_offset = thrust::device_pointer_cast(d_offsets)[0];
-
-        // copy the chars column data
-        auto d_chars    = chars_child.data<char>() + bytes_offset;
-        size_type bytes = thrust::device_pointer_cast(d_offsets)[column_size] - bytes_offset;
-        CUDA_TRY(
-          cudaMemcpyAsync(d_new_chars, d_chars, bytes, cudaMemcpyDeviceToDevice, stream.value()));
-
-        // get ready for the next column
-        d_new_chars += bytes;
-      }
-    }
+  if (total_bytes > 0) {  // Copy chars columns with single kernel launch
+    constexpr size_type block_size{256};
+    constexpr size_t bytes_per_block{block_size * 16};
+    auto const num_blocks = cudf::util::div_rounding_up_safe(total_bytes, bytes_per_block);
+    batched_concatenate_string_chars_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
+      d_views,
+      d_partition_offsets.data(),
+      static_cast<size_type>(columns.size()),
+      bytes_per_block,
+      d_new_chars);
   }
 
   return make_strings_column(strings_count,
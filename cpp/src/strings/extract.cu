@@ -72,7 +72,7 @@ struct extract_fn {
 //
 std::unique_ptr<table> extract(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -80,9 +80,9 @@ std::unique_ptr<table> extract(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
 
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
-  auto d_prog = *prog;
+  // create the device object of the compiled regex
+  auto d_prog_ptr = reprog_device::create(prog, get_character_flags_table(), strings_count, stream);
+  auto d_prog     = *d_prog_ptr;
   // extract should include groups
   int groups = d_prog.group_counts();
   CUDF_EXPECTS(groups > 0, "Group indicators not found in regex pattern");
@@ -120,14 +120,22 @@ std::unique_ptr<table> extract(
 
 }  // namespace detail
 
-// external API
+// external APIs
 
 std::unique_ptr<table> extract(strings_column_view const& strings,
                                std::string const& pattern,
                                rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::extract(strings, pattern, rmm::cuda_stream_default, mr);
+  return detail::extract(strings, *regex_program::create(pattern), rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> extract(strings_column_view const& strings,
+                               regex_program const& prog,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract(strings, prog, rmm::cuda_stream_default, mr);
 }
 
 }  // namespace strings
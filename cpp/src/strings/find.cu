@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/find.hpp>
@@ -25,21 +26,111 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <strings/utilities.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/transform.h>
 
+#include <type_traits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+
+constexpr int32_t find_block_size = 256;
+
+/**
+ * @brief Locates `d_target` in each string using a warp per string.
+ *
+ * Each round the lanes compare the target at `warp_size` consecutive byte positions,
+ * from the beginning of the string or with `forward=false` from its end, and the warp stops
+ * at the round where a lane finds it.
+ *
+ * For `int32_t` results the character position of the target is written, or -1 if it is
+ * not found. For `bool` results only whether it is found is written.
+ *
+ * @tparam forward Whether the first or the last position of the target is located
+ * @tparam ResultType Either `int32_t` or `bool`
+ *
+ * @param d_strings Strings to search
+ * @param d_target Non-empty string to locate
+ * @param d_results Result of each string
+ */
+template <bool forward, typename ResultType>
+__global__ void find_warp_parallel_fn(column_device_view const d_strings,
+                                      string_view const d_target,
+                                      ResultType* d_results)
+{
+  auto const tid     = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  auto const str_idx = static_cast<size_type>(tid / cudf::detail::warp_size);
+  if (str_idx >= d_strings.size()) return;
+  auto const lane = static_cast<size_type>(tid % cudf::detail::warp_size);
+
+  ResultType const not_found = std::is_same_v<ResultType, bool> ? 0 : -1;
+  if (d_strings.is_null(str_idx)) {
+    if (lane == 0) d_results[str_idx] = not_found;
+    return;
+  }
+  auto const d_str    = d_strings.element<string_view>(str_idx);
+  auto const tgt_size = d_target.size_bytes();
+  auto const max_pos  = d_str.size_bytes() - tgt_size;  // last byte position the target fits
+
+  // the target is valid UTF-8 so a match of its bytes begins a character
+  size_type byte_pos = -1;
+  for (size_type base = 0; (base <= max_pos) && (byte_pos < 0); base += cudf::detail::warp_size) {
+    auto const pos      = forward ? base + lane : max_pos - base - lane;
+    auto const in_range = (pos >= 0) && (pos <= max_pos);
+    auto const found    = in_range && (d_target.compare(d_str.data() + pos, tgt_size) == 0);
+    auto const matches  = __ballot_sync(0xffffffff, found);
+    // the lowest lane holds the first position when moving forward and the last otherwise
+    if (matches) {
+      auto const first_lane = __ffs(matches) - 1;
+      byte_pos              = forward ? base + first_lane : max_pos - base - first_lane;
+    }
+  }
+
+  if constexpr (std::is_same_v<ResultType, bool>) {
+    if (lane == 0) d_results[str_idx] = byte_pos >= 0;
+  } else {
+    // the character position is the number of characters beginning before the byte position
+    size_type chars = 0;
+    for (auto idx = lane; idx < byte_pos; idx += cudf::detail::warp_size) {
+      chars += static_cast<size_type>(is_begin_utf8_char(d_str.data()[idx]));
+    }
+    for (auto offset = cudf::detail::warp_size / 2; offset > 0; offset /= 2) {
+      chars += __shfl_down_sync(0xffffffff, chars, offset);
+    }
+    if (lane == 0) d_results[str_idx] = byte_pos >= 0 ? chars : not_found;
+  }
+}
+
+/**
+ * @brief Launches `find_warp_parallel_fn` with a warp per string.
+ */
+template <bool forward, typename ResultType>
+void find_warp_parallel(column_device_view const& d_strings,
+                        string_view const& d_target,
+                        ResultType* d_results,
+                        rmm::cuda_stream_view stream)
+{
+  constexpr size_type strings_per_block = find_block_size / cudf::detail::warp_size;
+  auto const num_blocks = (d_strings.size() + strings_per_block - 1) / strings_per_block;
+  find_warp_parallel_fn<forward>
+    <<<num_blocks, find_block_size, 0, stream.value()>>>(d_strings, d_target, d_results);
+}
+
 /**
  * @brief Utility to return integer column indicating the position of
  * target string within each string in a strings column.
  *
  * Null string entries return corresponding null output column entries.
  *
+ * Long strings searched in whole use a warp per string, see `use_warp_per_string`.
+ *
+ * @tparam forward Whether `pfn` locates the first or the last position of the target.
  * @tparam FindFunction Returns integer character position value given a string and target.
  *
  * @param strings Strings column to search for target.
@@ -51,7 +142,7 @@ namespace {
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return New integer column with character position values.
  */
-template <typename FindFunction>
+template <bool forward, typename FindFunction>
 std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                 string_scalar const& target,
                                 size_type start,
@@ -77,19 +168,26 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<int32_t>();
-  // set the position values by evaluating the passed function
+  results->set_null_count(strings.null_count());
+  if ((start == 0) && (stop < 0) && !d_target.empty() && use_warp_per_string(strings, stream)) {
+    find_warp_parallel<forward>(d_strings, d_target, d_results, stream);
+    return results;
+  }
+  // set the position values by evaluating the passed function,
+  // where the character positions of ASCII strings are their byte positions
+  auto const is_ascii = is_all_ascii(strings, stream);
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<size_type>(0),
                     thrust::make_counting_iterator<size_type>(strings_count),
                     d_results,
-                    [d_strings, pfn, d_target, start, stop] __device__(size_type idx) {
-                      int32_t position = -1;
-                      if (!d_strings.is_null(idx))
-                        position = static_cast<int32_t>(
-                          pfn(d_strings.element<string_view>(idx), d_target, start, stop));
-                      return position;
+                    [d_strings, pfn, d_target, start, stop, is_ascii] __device__(size_type idx) {
+                      if (d_strings.is_null(idx)) return -1;
+                      auto d_str = d_strings.element<string_view>(idx);
+                      if (is_ascii) {
+                        d_str = string_view(d_str.data(), d_str.size_bytes(), d_str.size_bytes());
+                      }
+                      return static_cast<int32_t>(pfn(d_str, d_target, start, stop));
                     });
-  results->set_null_count(strings.null_count());
   return results;
 }
 
@@ -112,7 +210,7 @@ std::unique_ptr<column> find(
     return d_string.find(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, stream, mr);
+  return find_fn<true>(strings, target, start, stop, pfn, stream, mr);
 }
 
 std::unique_ptr<column> rfind(
@@ -132,7 +230,7 @@ std::unique_ptr<column> rfind(
     return d_string.rfind(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, stream, mr);
+  return find_fn<false>(strings, target, start, stop, pfn, stream, mr);
 }
 
 }  // namespace detail
@@ -172,6 +270,8 @@ namespace {
  * @param strings Column of strings to check for target.
  * @param target UTF-8 encoded string to check in strings column.
  * @param pfn Returns bool value if target is found in the given string.
+ * @param is_find Whether `pfn` returns true if target is anywhere in the string, which is then
+ *        evaluated with a warp per string for long strings, see `use_warp_per_string`.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return New BOOL column.
@@ -180,6 +280,7 @@ template <typename BoolFunction>
 std::unique_ptr<column> contains_fn(strings_column_view const& strings,
                                     string_scalar const& target,
                                     BoolFunction pfn,
+                                    bool is_find,
                                     rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr)
 {
@@ -208,6 +309,11 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<bool>();
+  results->set_null_count(strings.null_count());
+  if (is_find && use_warp_per_string(strings, stream)) {
+    find_warp_parallel<true>(d_strings, d_target, d_results, stream);
+    return results;
+  }
   // set the bool values by evaluating the passed function
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<size_type>(0),
@@ -218,7 +324,6 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
                         return bool{pfn(d_strings.element<string_view>(idx), d_target)};
                       return false;
                     });
-  results->set_null_count(strings.null_count());
   return results;
 }
 
@@ -293,7 +398,7 @@ std::unique_ptr<column> contains(
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) >= 0;
   };
-  return contains_fn(strings, target, pfn, stream, mr);
+  return contains_fn(strings, target, pfn, true, stream, mr);
 }
 
 std::unique_ptr<column> contains(
@@ -318,7 +423,7 @@ std::unique_ptr<column> starts_with(
     return (d_target.size_bytes() <= d_string.size_bytes()) &&
            (d_target.compare(d_string.data(), d_target.size_bytes()) == 0);
   };
-  return contains_fn(strings, target, pfn, stream, mr);
+  return contains_fn(strings, target, pfn, false, stream, mr);
 }
 
 std::unique_ptr<column> starts_with(
@@ -347,7 +452,7 @@ std::unique_ptr<column> ends_with(
            (d_target.compare(d_string.data() + str_size - tgt_size, tgt_size) == 0);
   };
 
-  return contains_fn(strings, target, pfn, stream, mr);
+  return contains_fn(strings, target, pfn, false, stream, mr);
 }
 
 std::unique_ptr<column> ends_with(
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,17 +16,34 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/lists/detail/drop_list_duplicates.hpp>
+#include <cudf/lists/detail/sorting.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/transform.h>
 
+#include <map>
+#include <queue>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -73,9 +90,276 @@ std::unique_ptr<column> find_multiple(
   return results;
 }
 
+namespace {
+
+/**
+ * @brief Aho-Corasick automaton of a set of keywords, as flat arrays of its nodes.
+ *
+ * The nodes are those of the trie of the keywords' bytes, with node 0 the root. The failure link
+ * of a node is the node of its longest proper suffix in the trie, and its match link the nearest
+ * node ending a keyword among itself and the nodes of its failure chain.
+ */
+struct keyword_automaton {
+  std::vector<int32_t> edge_offsets;    // edges of each node
+  std::vector<uint8_t> edge_labels;     // sorted per node
+  std::vector<int32_t> edge_targets;    // child node of each edge
+  std::vector<int32_t> fail_links;      // failure link of each node
+  std::vector<int32_t> match_links;     // match link of each node, or -1
+  std::vector<int32_t> output_offsets;  // keywords ending at each node
+  std::vector<int32_t> output_ids;      // indices of the keywords
+};
+
+/**
+ * @brief Builds the automaton of the keywords, given by their bytes and offsets.
+ */
+keyword_automaton build_keyword_automaton(std::vector<char> const& chars,
+                                          std::vector<int32_t> const& offsets)
+{
+  // build the trie
+  std::vector<std::map<uint8_t, int32_t>> children(1);
+  std::vector<std::vector<int32_t>> outputs(1);
+  for (std::size_t idx = 0; idx + 1 < offsets.size(); ++idx) {
+    int32_t node = 0;
+    for (auto pos = offsets[idx]; pos < offsets[idx + 1]; ++pos) {
+      auto const label = static_cast<uint8_t>(chars[pos]);
+      auto const found = children[node].find(label);
+      if (found != children[node].end()) {
+        node = found->second;
+        continue;
+      }
+      auto const child = static_cast<int32_t>(children.size());
+      children[node].emplace(label, child);
+      children.emplace_back();
+      outputs.emplace_back();
+      node = child;
+    }
+    outputs[node].push_back(static_cast<int32_t>(idx));
+  }
+
+  // compute the links in breadth-first order so the links of shorter nodes are known
+  auto const nodes_count = children.size();
+  keyword_automaton result;
+  result.fail_links.assign(nodes_count, 0);
+  result.match_links.assign(nodes_count, -1);
+  std::queue<int32_t> queue;
+  for (auto const& edge : children[0]) {
+    queue.push(edge.second);
+  }
+  while (not queue.empty()) {
+    auto const node = queue.front();
+    queue.pop();
+    result.match_links[node] =
+      outputs[node].empty() ? result.match_links[result.fail_links[node]] : node;
+    for (auto const& edge : children[node]) {
+      auto link = result.fail_links[node];
+      while (link > 0 && children[link].count(edge.first) == 0) {
+        link = result.fail_links[link];
+      }
+      auto const found               = children[link].find(edge.first);
+      result.fail_links[edge.second] = found != children[link].end() ? found->second : 0;
+      queue.push(edge.second);
+    }
+  }
+
+  // flatten the edges and outputs
+  result.edge_offsets.push_back(0);
+  result.output_offsets.push_back(0);
+  for (std::size_t node = 0; node < nodes_count; ++node) {
+    for (auto const& edge : children[node]) {
+      result.edge_labels.push_back(edge.first);
+      result.edge_targets.push_back(edge.second);
+    }
+    result.edge_offsets.push_back(static_cast<int32_t>(result.edge_labels.size()));
+    result.output_ids.insert(result.output_ids.end(), outputs[node].begin(), outputs[node].end());
+    result.output_offsets.push_back(static_cast<int32_t>(result.output_ids.size()));
+  }
+  return result;
+}
+
+/**
+ * @brief Device copy of a `keyword_automaton`.
+ */
+struct keyword_automaton_device {
+  int32_t const* edge_offsets;
+  uint8_t const* edge_labels;
+  int32_t const* edge_targets;
+  int32_t const* fail_links;
+  int32_t const* match_links;
+  int32_t const* output_offsets;
+  int32_t const* output_ids;
+
+  /**
+   * @brief Returns the node reached from `node` by the byte `label`.
+   */
+  __device__ int32_t next_node(int32_t node, uint8_t label) const
+  {
+    while (true) {
+      auto const begin = edge_labels + edge_offsets[node];
+      auto const end   = edge_labels + edge_offsets[node + 1];
+      auto const found = thrust::lower_bound(thrust::seq, begin, end, label);
+      if (found != end && *found == label) { return edge_targets[found - edge_labels]; }
+      if (node == 0) { return 0; }
+      node = fail_links[node];
+    }
+  }
+
+  /**
+   * @brief Calls `fn` with the index of each keyword ending at `node`.
+   */
+  template <typename Fn>
+  __device__ void for_each_keyword(int32_t node, Fn fn) const
+  {
+    for (auto match = match_links[node]; match >= 0; match = match_links[fail_links[match]]) {
+      for (auto idx = output_offsets[match]; idx < output_offsets[match + 1]; ++idx) {
+        fn(output_ids[idx]);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Finds the occurrences of the keywords in each string, in a single pass of its bytes.
+ *
+ * Only counts the occurrences when `d_offsets` is null, and writes the keyword index of each
+ * occurrence otherwise.
+ */
+struct find_keywords_fn {
+  column_device_view const d_strings;
+  keyword_automaton_device const automaton;
+  int32_t const* d_offsets{};
+  int32_t* d_ids{};
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return 0; }
+    auto const d_str = d_strings.element<string_view>(idx);
+    auto const bytes = reinterpret_cast<uint8_t const*>(d_str.data());
+    size_type count  = 0;
+    int32_t* output  = d_offsets ? d_ids + d_offsets[idx] : nullptr;
+    int32_t node     = 0;
+    for (size_type pos = 0; pos < d_str.size_bytes(); ++pos) {
+      node = automaton.next_node(node, bytes[pos]);
+      automaton.for_each_keyword(node, [&](int32_t id) {
+        if (output) { output[count] = id; }
+        ++count;
+      });
+    }
+    return count;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> find_keywords(
+  strings_column_view const& strings,
+  strings_column_view const& keywords,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(keywords.size() > 0, "Must include at least one keyword");
+  CUDF_EXPECTS(!keywords.has_nulls(), "Keywords cannot contain null strings");
+  auto const strings_count = strings.size();
+  if (strings_count == 0) {
+    auto offsets =
+      make_numeric_column(data_type{type_id::INT32}, 1, mask_state::UNALLOCATED, stream, mr);
+    CUDA_TRY(cudaMemsetAsync(
+      offsets->mutable_view().data<int32_t>(), 0, sizeof(int32_t), stream.value()));
+    return make_lists_column(0,
+                             std::move(offsets),
+                             make_empty_column(data_type{type_id::INT32}),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+  }
+
+  // build the automaton on the host from a copy of the keywords
+  auto const h_offsets = cudf::detail::make_std_vector_sync(
+    device_span<int32_t const>(keywords.offsets().data<int32_t>() + keywords.offset(),
+                               keywords.size() + 1),
+    stream);
+  auto const h_chars = cudf::detail::make_std_vector_sync(
+    device_span<char const>(keywords.chars().data<char>(), keywords.chars_size()), stream);
+  for (std::size_t idx = 0; idx + 1 < h_offsets.size(); ++idx) {
+    CUDF_EXPECTS(h_offsets[idx] < h_offsets[idx + 1], "Keywords cannot be empty strings");
+  }
+  auto const automaton = build_keyword_automaton(h_chars, h_offsets);
+
+  using cudf::detail::make_device_uvector_async;
+  auto const edge_offsets   = make_device_uvector_async(automaton.edge_offsets, stream);
+  auto const edge_labels    = make_device_uvector_async(automaton.edge_labels, stream);
+  auto const edge_targets   = make_device_uvector_async(automaton.edge_targets, stream);
+  auto const fail_links     = make_device_uvector_async(automaton.fail_links, stream);
+  auto const match_links    = make_device_uvector_async(automaton.match_links, stream);
+  auto const output_offsets = make_device_uvector_async(automaton.output_offsets, stream);
+  auto const output_ids     = make_device_uvector_async(automaton.output_ids, stream);
+  keyword_automaton_device const d_automaton{edge_offsets.data(),
+                                             edge_labels.data(),
+                                             edge_targets.data(),
+                                             fail_links.data(),
+                                             match_links.data(),
+                                             output_offsets.data(),
+                                             output_ids.data()};
+
+  auto const strings_column = column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+
+  // count the occurrences in each string, then write their keyword indices
+  auto const counts    = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), find_keywords_fn{d_strings, d_automaton});
+  auto offsets         = make_offsets_child_column(counts, counts + strings_count, stream);
+  auto const d_offsets = offsets->view().data<int32_t>();
+  auto const total     = cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+  auto ids             = make_numeric_column(
+    data_type{type_id::INT32}, total, mask_state::UNALLOCATED, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    find_keywords_fn{d_strings, d_automaton, d_offsets, ids->mutable_view().data<int32_t>()});
+  auto const occurrences =
+    make_lists_column(strings_count,
+                      std::move(offsets),
+                      std::move(ids),
+                      strings.null_count(),
+                      cudf::detail::copy_bitmask(strings.parent(), stream),
+                      stream);
+
+  // keep each keyword once per string, in ascending order
+  auto const distinct = cudf::lists::detail::drop_list_duplicates(
+    lists_column_view(occurrences->view()), null_equality::EQUAL, nan_equality::UNEQUAL, stream);
+  return cudf::lists::detail::sort_lists(
+    lists_column_view(distinct->view()), order::ASCENDING, null_order::AFTER, stream, mr);
+}
+
+std::unique_ptr<column> count_keywords(
+  strings_column_view const& strings,
+  strings_column_view const& keywords,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const found         = find_keywords(strings, keywords, stream);
+  auto const strings_count = strings.size();
+  auto results             = make_numeric_column(data_type{type_id::INT32},
+                                     strings_count,
+                                     cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+  if (strings_count == 0) { return results; }
+  auto const d_offsets = lists_column_view(found->view()).offsets_begin();
+  thrust::transform(rmm::exec_policy(stream),
+                    d_offsets,
+                    d_offsets + strings_count,
+                    d_offsets + 1,
+                    results->mutable_view().data<int32_t>(),
+                    [] __device__(auto begin, auto end) { return end - begin; });
+  return results;
+}
+
 }  // namespace detail
 
-// external API
+// external APIs
 std::unique_ptr<column> find_multiple(strings_column_view const& strings,
                                       strings_column_view const& targets,
                                       rmm::mr::device_memory_resource* mr)
@@ -84,5 +368,21 @@ std::unique_ptr<column> find_multiple(strings_column_view const& strings,
   return detail::find_multiple(strings, targets, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> find_keywords(strings_column_view const& strings,
+                                      strings_column_view const& keywords,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::find_keywords(strings, keywords, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> count_keywords(strings_column_view const& strings,
+                                       strings_column_view const& keywords,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_keywords(strings, keywords, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -114,7 +114,7 @@ struct findall_count_fn : public findall_fn<stack_size> {
 //
 std::unique_ptr<table> findall_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource(),
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default)
 {
@@ -122,8 +122,8 @@ std::unique_ptr<table> findall_re(
   auto const d_strings     = column_device_view::create(strings.parent(), stream);
 
   auto const d_flags = detail::get_character_flags_table();
-  // compile regex into device object
-  auto const d_prog      = reprog_device::create(pattern, d_flags, strings_count, stream);
+  // create the device object of the compiled regex
+  auto const d_prog      = reprog_device::create(prog, d_flags, strings_count, stream);
   auto const regex_insts = d_prog->insts_counts();
 
   rmm::device_uvector<size_type> find_counts(strings_count, stream);
@@ -196,14 +196,22 @@ std::unique_ptr<table> findall_re(
 
 }  // namespace detail
 
-// external API
+// external APIs
 
 std::unique_ptr<table> findall_re(strings_column_view const& strings,
                                   std::string const& pattern,
                                   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::findall_re(strings, pattern, mr);
+  return detail::findall_re(strings, *regex_program::create(pattern), mr);
+}
+
+std::unique_ptr<table> findall_re(strings_column_view const& strings,
+                                  regex_program const& prog,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::findall_re(strings, prog, mr);
 }
 
 }  // namespace strings
@@ -20,6 +20,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -32,8 +33,14 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
 #include <thrust/optional.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -327,6 +334,12 @@ class json_state : private parser {
     return parse_result::ERROR;
   }
 
+  // type of the current element
+  __device__ json_element_type element_type() const { return cur_el_type; }
+
+  // name of the current element, if it is a member of an object
+  __device__ string_view const& element_name() const { return cur_el_name; }
+
  private:
   // parse a value - either a string or a number/null/bool
   __device__ parse_result parse_value()
@@ -535,17 +548,15 @@ class path_state : private parser {
 };
 
 /**
- * @brief Preprocess the incoming JSONPath string on the host to generate a
- * command buffer for use by the GPU.
+ * @brief Preprocess a JSONPath string on the host to generate the operators for use by the GPU.
  *
- * @param json_path The incoming json path
- * @param stream Cuda stream to perform any gpu actions on
- * @returns A pair containing the command buffer, and maximum stack depth required.
+ * @param h_json_path The JSONPath string on the host
+ * @param d_json_path The same string on the device, which the operator names point into
+ * @returns A pair containing the operators, and maximum stack depth required.
  */
-std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_command_buffer(
-  cudf::string_scalar const& json_path, rmm::cuda_stream_view stream)
+std::pair<std::vector<path_operator>, int> build_path_operators(std::string const& h_json_path,
+                                                                char const* d_json_path)
 {
-  std::string h_json_path = json_path.to_string(stream);
   path_state p_state(h_json_path.data(), static_cast<size_type>(h_json_path.size()));
 
   std::vector<path_operator> h_operators;
@@ -561,7 +572,7 @@ std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_comma
     // convert pointer to device pointer
     if (op.name.size_bytes() > 0) {
       op.name =
-        string_view(json_path.data() + (op.name.data() - h_json_path.data()), op.name.size_bytes());
+        string_view(d_json_path + (op.name.data() - h_json_path.data()), op.name.size_bytes());
     }
     if (op.type == path_operator_type::ROOT) {
       CUDF_EXPECTS(h_operators.size() == 0, "Root operator ($) can only exist at the root");
@@ -575,6 +586,23 @@ std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_comma
     h_operators.push_back(op);
   } while (op.type != path_operator_type::END);
 
+  return {std::move(h_operators), max_stack_depth};
+}
+
+/**
+ * @brief Preprocess the incoming JSONPath string on the host to generate a
+ * command buffer for use by the GPU.
+ *
+ * @param json_path The incoming json path
+ * @param stream Cuda stream to perform any gpu actions on
+ * @returns A pair containing the command buffer, and maximum stack depth required.
+ */
+std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_command_buffer(
+  cudf::string_scalar const& json_path, rmm::cuda_stream_view stream)
+{
+  auto const [h_operators, max_stack_depth] =
+    build_path_operators(json_path.to_string(stream), json_path.data());
+
   auto const is_empty = h_operators.size() == 1 && h_operators[0].type == path_operator_type::END;
   return is_empty
            ? std::make_pair(thrust::nullopt, 0)
@@ -934,7 +962,344 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
                              mr);
 }
 
+// paths evaluated in a single pass over the json strings, one bit each in a path_mask
+using path_mask                     = uint64_t;
+constexpr int max_paths_per_pass    = 64;
+constexpr int max_shared_path_depth = 8;
+
+/**
+ * @brief Returns true if the path only selects a single element by name or index at each of at
+ * most `max_shared_path_depth` levels, which the paths evaluated in a single pass are limited to.
+ *
+ * @param operators The operators of the path, beginning with ROOT and ending with END
+ */
+bool is_shared_path(std::vector<path_operator> const& operators)
+{
+  if (operators.size() < 2 || operators.size() > max_shared_path_depth + 2) { return false; }
+  return std::all_of(operators.begin() + 1, operators.end() - 1, [](path_operator const& op) {
+    return op.type == path_operator_type::CHILD || op.type == path_operator_type::CHILD_INDEX;
+  });
+}
+
+/**
+ * @brief Output of the paths evaluated on a json string, with the sizes and validities written
+ * in the size computation step and the strings in the output step.
+ */
+struct json_paths_output {
+  size_type row;
+  size_type num_rows;
+  offset_type* const* offsets;  // offsets of each path
+  char* const* chars;           // chars of each path, nullptr in the size computation step
+  bool* validities;             // validity of each path for each row
+
+  __device__ void extract(int path, json_state j_state)
+  {
+    json_output output{0, chars != nullptr ? chars[path] + offsets[path][row] : nullptr};
+    auto const result   = j_state.extract_element(&output, false);
+    bool const is_valid = result == parse_result::SUCCESS && output.output_len.has_value();
+    if (chars == nullptr) {
+      offsets[path][row] = is_valid ? static_cast<offset_type>(output.output_len.value()) : 0;
+      validities[static_cast<std::size_t>(path) * num_rows + row] = is_valid;
+    }
+  }
+};
+
+/**
+ * @brief Evaluate several paths on a single json string, parsing each element the paths go
+ * through once.
+ *
+ * Each path is matched against the children of the elements the paths go through, in document
+ * order, and only its first matching child is selected, as `parse_json_path` does. The paths
+ * with no match produce no output.
+ *
+ * @param j_state The incoming json string and associated parser
+ * @param operators The operators of all the paths, each satisfying `is_shared_path`
+ * @param operator_offsets The offset of the operators of each path
+ * @param num_paths Number of paths, at most `max_paths_per_pass`
+ * @param output The output of the paths for the json string
+ */
+__device__ void parse_json_paths(json_state j_state,
+                                 path_operator const* operators,
+                                 size_type const* operator_offsets,
+                                 int num_paths,
+                                 json_paths_output& output)
+{
+  auto path_op = [operators, operator_offsets](int path, int depth) -> path_operator const& {
+    return operators[operator_offsets[path] + depth];
+  };
+  auto for_each_path = [](path_mask paths, auto fn) {
+    while (paths != 0) {
+      fn(__ffsll(static_cast<long long>(paths)) - 1);
+      paths &= paths - 1;
+    }
+  };
+
+  if (j_state.next_element() != parse_result::SUCCESS) { return; }
+
+  // the children of an element being matched against the operators at `depth` of the paths
+  struct context {
+    json_state j_state;  // the current child
+    path_mask paths;     // the paths without a matching child yet
+    int depth;
+    int index;  // index of the current child
+  };
+  context stack[max_shared_path_depth];
+  int stack_pos = 0;
+  // step into the children of the element for the paths whose operators at `depth` apply to it
+  auto push_children = [&](json_state const& parent, path_mask paths, int depth) {
+    for_each_path(paths, [&](int path) {
+      if (path_op(path, depth).expected_type != parent.element_type()) {
+        paths &= ~(path_mask{1} << path);
+      }
+    });
+    if (paths == 0) { return; }
+    json_state child = parent;
+    if (child.child_element(NONE) != parse_result::SUCCESS) { return; }
+    stack[stack_pos++] = context{child, paths, depth, 0};
+  };
+
+  path_mask root_paths = 0;
+  for (int path = 0; path < num_paths; ++path) {
+    if (path_op(path, 1).type == path_operator_type::END) {
+      output.extract(path, j_state);
+    } else {
+      root_paths |= path_mask{1} << path;
+    }
+  }
+  push_children(j_state, root_paths, 1);
+
+  while (stack_pos > 0) {
+    auto& ctx = stack[stack_pos - 1];
+
+    path_mask matches = 0;
+    for_each_path(ctx.paths, [&](int path) {
+      auto const& op = path_op(path, ctx.depth);
+      if (op.type == path_operator_type::CHILD ? ctx.j_state.element_name() == op.name
+                                               : ctx.index == op.index) {
+        matches |= path_mask{1} << path;
+      }
+    });
+    ctx.paths &= ~matches;
+
+    path_mask child_paths = 0;
+    for_each_path(matches, [&](int path) {
+      if (path_op(path, ctx.depth + 1).type == path_operator_type::END) {
+        output.extract(path, ctx.j_state);
+      } else {
+        child_paths |= path_mask{1} << path;
+      }
+    });
+
+    // move to the next child before stepping into the current one, skipping the current one
+    // the way the paths looking for a later child do
+    json_state const current = ctx.j_state;
+    int const depth          = ctx.depth;
+    if (ctx.paths != 0 && ctx.j_state.next_element() == parse_result::SUCCESS) {
+      ++ctx.index;
+    } else {
+      --stack_pos;
+    }
+    if (child_paths != 0) { push_children(current, child_paths, depth + 1); }
+  }
+}
+
+/**
+ * @brief Kernel for evaluating several JSONPath queries in a single pass over the strings.
+ *
+ * This kernel operates in a 2-pass way, like `get_json_object_kernel`. On the first pass, it
+ * computes the output sizes and validities of each path. On the second pass it fills in the
+ * chars of each path.
+ *
+ * @param col Device view of the incoming strings
+ * @param operators The operators of all the paths
+ * @param operator_offsets The offset of the operators of each path
+ * @param num_paths Number of paths
+ * @param output_offsets Buffers of each path used to store the string offsets of the results
+ * @param out_bufs Buffers of each path used to store the results, nullptr on the first pass
+ * @param out_validities Validity of each path for each row, written on the first pass
+ */
+__global__ void get_json_objects_kernel(column_device_view col,
+                                        path_operator const* operators,
+                                        size_type const* operator_offsets,
+                                        int num_paths,
+                                        offset_type* const* output_offsets,
+                                        char* const* out_bufs,
+                                        bool* out_validities)
+{
+  size_type tid    = threadIdx.x + (blockDim.x * blockIdx.x);
+  size_type stride = blockDim.x * gridDim.x;
+
+  while (tid < col.size()) {
+    json_paths_output output{tid, col.size(), output_offsets, out_bufs, out_validities};
+    if (out_bufs == nullptr) {
+      for (int path = 0; path < num_paths; ++path) {
+        output_offsets[path][tid]                                         = 0;
+        out_validities[static_cast<std::size_t>(path) * col.size() + tid] = false;
+      }
+    }
+    if (col.is_valid(tid)) {
+      string_view const str = col.element<string_view>(tid);
+      if (str.size_bytes() > 0) {
+        parse_json_paths(json_state(str.data(), str.size_bytes()),
+                         operators,
+                         operator_offsets,
+                         num_paths,
+                         output);
+      }
+    }
+    tid += stride;
+  }
+}
+
+/**
+ * @brief Evaluate paths satisfying `is_shared_path` in a single pass over the strings.
+ *
+ * @param col The incoming strings
+ * @param paths_operators The operators of each path, at most `max_paths_per_pass` paths
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return A strings column for each path
+ */
+std::vector<std::unique_ptr<cudf::column>> get_shared_json_objects(
+  cudf::strings_column_view const& col,
+  std::vector<std::vector<path_operator>> const& paths_operators,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_paths = static_cast<int>(paths_operators.size());
+
+  std::vector<path_operator> h_operators;
+  std::vector<size_type> h_operator_offsets;
+  for (auto const& operators : paths_operators) {
+    h_operator_offsets.push_back(static_cast<size_type>(h_operators.size()));
+    h_operators.insert(h_operators.end(), operators.begin(), operators.end());
+  }
+  auto const d_operators = cudf::detail::make_device_uvector_async(h_operators, stream);
+  auto const d_operator_offsets =
+    cudf::detail::make_device_uvector_async(h_operator_offsets, stream);
+
+  std::vector<std::unique_ptr<column>> offsets;
+  std::vector<offset_type*> h_offsets;
+  for (int path = 0; path < num_paths; ++path) {
+    offsets.push_back(cudf::make_fixed_width_column(
+      data_type{type_id::INT32}, col.size() + 1, mask_state::UNALLOCATED, stream, mr));
+    h_offsets.push_back(offsets.back()->mutable_view().head<offset_type>());
+  }
+  auto const d_offsets = cudf::detail::make_device_uvector_async(h_offsets, stream);
+  rmm::device_uvector<bool> validities(static_cast<std::size_t>(num_paths) * col.size(), stream);
+
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d const grid{col.size(), block_size};
+
+  auto cdv = column_device_view::create(col.parent(), stream);
+
+  // preprocess sizes (returned in the offsets buffers) and validities
+  get_json_objects_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+    *cdv,
+    d_operators.data(),
+    d_operator_offsets.data(),
+    num_paths,
+    d_offsets.data(),
+    nullptr,
+    validities.data());
+
+  // convert sizes to offsets and allocate the output chars
+  std::vector<std::unique_ptr<column>> chars;
+  std::vector<char*> h_chars;
+  for (int path = 0; path < num_paths; ++path) {
+    thrust::exclusive_scan(rmm::exec_policy(stream),
+                           h_offsets[path],
+                           h_offsets[path] + col.size() + 1,
+                           h_offsets[path],
+                           0);
+    size_type const output_size =
+      cudf::detail::get_value<offset_type>(offsets[path]->view(), col.size(), stream);
+    chars.push_back(cudf::make_fixed_width_column(
+      data_type{type_id::INT8}, output_size, mask_state::UNALLOCATED, stream, mr));
+    h_chars.push_back(chars.back()->mutable_view().head<char>());
+  }
+  auto const d_chars = cudf::detail::make_device_uvector_async(h_chars, stream);
+
+  // compute results
+  get_json_objects_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+    *cdv,
+    d_operators.data(),
+    d_operator_offsets.data(),
+    num_paths,
+    d_offsets.data(),
+    d_chars.data(),
+    validities.data());
+
+  std::vector<std::unique_ptr<column>> results;
+  for (int path = 0; path < num_paths; ++path) {
+    auto const path_validities  = validities.begin() + static_cast<std::size_t>(path) * col.size();
+    auto [validity, null_count] = cudf::detail::valid_if(
+      path_validities, path_validities + col.size(), thrust::identity<bool>{}, stream, mr);
+    results.push_back(make_strings_column(col.size(),
+                                          std::move(offsets[path]),
+                                          std::move(chars[path]),
+                                          null_count,
+                                          std::move(validity),
+                                          stream,
+                                          mr));
+  }
+  return results;
+}
+
 }  // namespace
+
+/**
+ * @copydoc cudf::strings::detail::get_json_objects
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_objects(
+  cudf::strings_column_view const& col,
+  std::vector<std::string> const& json_paths,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<cudf::column>> results(json_paths.size());
+  if (col.is_empty()) {
+    for (auto& result : results) {
+      result = make_empty_column(data_type{type_id::STRING});
+    }
+    return results;
+  }
+
+  // copy all the paths to the device at once for the operator names to point into
+  std::vector<char> h_all_paths;
+  std::vector<std::size_t> path_offsets;
+  for (auto const& json_path : json_paths) {
+    path_offsets.push_back(h_all_paths.size());
+    h_all_paths.insert(h_all_paths.end(), json_path.begin(), json_path.end());
+  }
+  auto const d_all_paths = cudf::detail::make_device_uvector_async(h_all_paths, stream);
+
+  // the paths selecting single elements share passes, and the others are evaluated one by one
+  std::vector<std::size_t> shared_paths;
+  std::vector<std::vector<path_operator>> shared_operators;
+  auto evaluate_shared_paths = [&] {
+    auto shared_results = get_shared_json_objects(col, shared_operators, stream, mr);
+    for (std::size_t i = 0; i < shared_paths.size(); ++i) {
+      results[shared_paths[i]] = std::move(shared_results[i]);
+    }
+    shared_paths.clear();
+    shared_operators.clear();
+  };
+  for (std::size_t i = 0; i < json_paths.size(); ++i) {
+    auto operators =
+      build_path_operators(json_paths[i], d_all_paths.data() + path_offsets[i]).first;
+    if (is_shared_path(operators)) {
+      shared_paths.push_back(i);
+      shared_operators.push_back(std::move(operators));
+      if (static_cast<int>(shared_paths.size()) == max_paths_per_pass) { evaluate_shared_paths(); }
+    } else {
+      results[i] = get_json_object(col, string_scalar(json_paths[i], true, stream), stream, mr);
+    }
+  }
+  if (!shared_paths.empty()) { evaluate_shared_paths(); }
+  return results;
+}
+
 }  // namespace detail
 
 /**
@@ -948,5 +1313,17 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
   return detail::get_json_object(col, json_path, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc cudf::strings::get_json_objects
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_objects(
+  cudf::strings_column_view const& col,
+  std::vector<std::string> const& json_paths,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_json_objects(col, json_paths, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -82,8 +82,12 @@ int32_t reprog::add_class(reclass cls)
 
 reinst& reprog::inst_at(int32_t id) { return _insts[id]; }
 
+reinst const& reprog::inst_at(int32_t id) const { return _insts[id]; }
+
 reclass& reprog::class_at(int32_t id) { return _classes[id]; }
 
+reclass const& reprog::class_at(int32_t id) const { return _classes[id]; }
+
 void reprog::set_start_inst(int32_t id) { _startinst_id = id; }
 
 int32_t reprog::get_start_inst() const { return _startinst_id; }
@@ -101,8 +101,10 @@ class reprog {
   const reinst* insts_data() const;
   int32_t insts_count() const;
   reinst& inst_at(int32_t id);
+  reinst const& inst_at(int32_t id) const;
 
   reclass& class_at(int32_t id);
+  reclass const& class_at(int32_t id) const;
   int32_t classes_count() const;
 
   const int32_t* starts_data() const;
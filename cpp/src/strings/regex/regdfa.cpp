@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <strings/char_types/is_flags.h>
+#include <strings/regex/regcomp.h>
+#include <strings/regex/regdfa.h>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief The character before the current position, which the BOL, BOW and NBOW instructions
+ * depend on.
+ */
+enum previous_char : int32_t { NO_CHAR, NEWLINE_CHAR, WORD_CHAR, OTHER_CHAR };
+
+/**
+ * @brief A set of instructions to evaluate at a position, with the character before it.
+ */
+using dfa_state = std::pair<std::vector<int32_t>, previous_char>;
+
+class dfa_builder {
+ public:
+  dfa_builder(reprog const& prog, uint8_t const* ascii_flags, bool anchored)
+    : _prog{prog}, _flags{ascii_flags}, _anchored{anchored}
+  {
+    for (int32_t const* id = prog.starts_data(); *id >= 0; ++id) {
+      _start_ids.push_back(*id);
+    }
+    for (int32_t id = 0; id < prog.insts_count(); ++id) {
+      auto const type = prog.inst_at(id).type;
+      if (type == BOL || type == BOW || type == NBOW) { _uses_previous_char = true; }
+    }
+  }
+
+  redfa build()
+  {
+    redfa dfa;
+    build_char_classes(dfa);
+
+    state_id({{}, NO_CHAR});
+    for (std::size_t state = 0; state < _states.size(); ++state) {
+      auto const current = _states[state];  // copied since the transitions add states
+      for (int32_t cls = 0; cls < dfa.classes_count; ++cls) {
+        auto const target = transition(current, _class_chars[cls]);
+        if (_states.size() > static_cast<std::size_t>(MAX_DFA_STATES)) { return redfa{}; }
+        dfa.transitions.push_back(target);
+      }
+    }
+    return dfa;
+  }
+
+ private:
+  bool is_word(char32_t ch) const { return ch != 0 && IS_ALPHANUM(_flags[ch]); }
+
+  /**
+   * @brief Mirrors `reclass_device::is_match` for the DFA_CHARS_COUNT characters.
+   */
+  bool is_class_match(reclass const& cls, char32_t ch) const
+  {
+    for (std::size_t i = 0; i + 1 < cls.literals.size(); i += 2) {
+      if (ch >= cls.literals[i] && ch <= cls.literals[i + 1]) { return true; }
+    }
+    auto const fl = _flags[ch];
+    return ((cls.builtins & 1) && ((ch == '_') || IS_ALPHANUM(fl))) ||
+           ((cls.builtins & 2) && IS_SPACE(fl)) || ((cls.builtins & 4) && IS_DIGIT(fl)) ||
+           ((cls.builtins & 8) && ((ch != '\n') && (ch != '_') && !IS_ALPHANUM(fl))) ||
+           ((cls.builtins & 16) && !IS_SPACE(fl)) ||
+           ((cls.builtins & 32) && ((ch != '\n') && !IS_DIGIT(fl)));
+  }
+
+  /**
+   * @brief Returns true if the instruction, which consumes a character, accepts `ch`.
+   */
+  bool is_match(reinst const& inst, char32_t ch)
+  {
+    switch (inst.type) {
+      case CHAR: return inst.u1.c == ch;
+      case ANY: return ch != '\n';
+      case ANYNL: return true;
+      case CCLASS: return is_class_match(_prog.class_at(inst.u1.cls_id), ch);
+      case NCCLASS: return !is_class_match(_prog.class_at(inst.u1.cls_id), ch);
+      default: return false;
+    }
+  }
+
+  /**
+   * @brief Groups the characters by their effect on the instructions, with the end of the
+   * string and the NUL character, which also ends the evaluation, in class 0.
+   */
+  void build_char_classes(redfa& dfa)
+  {
+    std::vector<int32_t> consuming_ids;
+    for (int32_t id = 0; id < _prog.insts_count(); ++id) {
+      auto const type = _prog.inst_at(id).type;
+      if (type == CHAR || type == ANY || type == ANYNL || type == CCLASS || type == NCCLASS) {
+        consuming_ids.push_back(id);
+      }
+    }
+
+    std::map<std::vector<bool>, uint8_t> classes;
+    dfa.char_classes.assign(DFA_CHARS_COUNT, 0);
+    _class_chars.assign(1, 0);
+    for (char32_t ch = 1; ch < static_cast<char32_t>(DFA_CHARS_COUNT); ++ch) {
+      std::vector<bool> signature{ch == '\n', is_word(ch)};
+      for (auto id : consuming_ids) {
+        signature.push_back(is_match(_prog.inst_at(id), ch));
+      }
+      auto const cls = classes.emplace(signature, static_cast<uint8_t>(_class_chars.size()));
+      if (cls.second) { _class_chars.push_back(ch); }
+      dfa.char_classes[ch] = cls.first->second;
+    }
+    dfa.classes_count = static_cast<int32_t>(_class_chars.size());
+  }
+
+  /**
+   * @brief Returns the consuming and END instructions reached from `ids` through the other
+   * instructions, mirroring the expansion of `reprog_device::regexec`.
+   */
+  std::vector<int32_t> expand(std::vector<int32_t> ids, previous_char prev, char32_t ch)
+  {
+    std::vector<bool> visited(_prog.insts_count(), false);
+    std::vector<int32_t> result;
+    while (not ids.empty()) {
+      auto const id = ids.back();
+      ids.pop_back();
+      if (visited[id]) { continue; }
+      visited[id]      = true;
+      auto const& inst = _prog.inst_at(id);
+      switch (inst.type) {
+        case CHAR:
+        case ANY:
+        case ANYNL:
+        case CCLASS:
+        case NCCLASS:
+        case END: result.push_back(id); break;
+        case LBRA:
+        case RBRA: ids.push_back(inst.u2.next_id); break;
+        case BOL:
+          if (prev == NO_CHAR || (inst.u1.c == '^' && prev == NEWLINE_CHAR)) {
+            ids.push_back(inst.u2.next_id);
+          }
+          break;
+        case EOL:
+          if (ch == 0 || (inst.u1.c == '$' && ch == '\n')) { ids.push_back(inst.u2.next_id); }
+          break;
+        case BOW:
+          if ((prev == WORD_CHAR) != is_word(ch)) { ids.push_back(inst.u2.next_id); }
+          break;
+        case NBOW:
+          if ((prev == WORD_CHAR) == is_word(ch)) { ids.push_back(inst.u2.next_id); }
+          break;
+        case OR:
+          ids.push_back(inst.u1.right_id);
+          ids.push_back(inst.u2.left_id);
+          break;
+        default: break;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Returns the transition of `state` with the character `ch`.
+   */
+  int16_t transition(dfa_state const& state, char32_t ch)
+  {
+    auto ids = state.first;
+    // New matches start at every position, or only at the beginning of anchored strings
+    if (not _anchored or state.second == NO_CHAR) {
+      ids.insert(ids.end(), _start_ids.begin(), _start_ids.end());
+    }
+
+    std::vector<int32_t> next_ids;
+    for (auto id : expand(std::move(ids), state.second, ch)) {
+      auto const& inst = _prog.inst_at(id);
+      if (inst.type == END) { return DFA_ACCEPT; }
+      if (ch != 0 && is_match(inst, ch)) { next_ids.push_back(inst.u2.next_id); }
+    }
+    if (ch == 0 || (_anchored && next_ids.empty())) { return DFA_REJECT; }
+
+    std::sort(next_ids.begin(), next_ids.end());
+    next_ids.erase(std::unique(next_ids.begin(), next_ids.end()), next_ids.end());
+    // The states only differ by the previous character if the instructions depend on it
+    auto prev = OTHER_CHAR;
+    if (_uses_previous_char && ch == '\n') { prev = NEWLINE_CHAR; }
+    if (_uses_previous_char && is_word(ch)) { prev = WORD_CHAR; }
+    return state_id({std::move(next_ids), prev});
+  }
+
+  int16_t state_id(dfa_state&& state)
+  {
+    auto const found = _state_ids.find(state);
+    if (found != _state_ids.end()) { return found->second; }
+    auto const id = static_cast<int16_t>(_states.size());
+    _state_ids.emplace(state, id);
+    _states.push_back(std::move(state));
+    return id;
+  }
+
+  reprog const& _prog;
+  uint8_t const* _flags;
+  bool _anchored;
+  bool _uses_previous_char{false};
+  std::vector<int32_t> _start_ids;
+  std::vector<char32_t> _class_chars;  // a character of each class
+  std::vector<dfa_state> _states;
+  std::map<dfa_state, int16_t> _state_ids;
+};
+
+}  // namespace
+
+redfa build_dfa(reprog const& prog, uint8_t const* ascii_flags, bool anchored)
+{
+  return dfa_builder{prog, ascii_flags, anchored}.build();
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
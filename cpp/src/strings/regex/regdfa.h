@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <strings/regex/regcomp.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+// Number of characters decided by a DFA; strings with other characters use the instructions
+constexpr int32_t DFA_CHARS_COUNT = 128;
+
+// Maximum number of states of a DFA, above which the instructions are used instead
+constexpr int32_t MAX_DFA_STATES = 512;
+
+// Transitions to these values end the evaluation of a string
+constexpr int16_t DFA_ACCEPT = -1;  // a match is found
+constexpr int16_t DFA_REJECT = -2;  // no match can be found
+
+/**
+ * @brief Deterministic automaton deciding if a string of ASCII characters matches a regex program.
+ *
+ * The characters with the same effect on the program share a class, and class 0 is the end of
+ * the string. Each state has a transition per class, to the next state or to `DFA_ACCEPT` or
+ * `DFA_REJECT`, and the transitions of the end of the string are never to a state.
+ */
+struct redfa {
+  std::vector<uint8_t> char_classes;  // class of each of the DFA_CHARS_COUNT characters
+  int32_t classes_count{};
+  std::vector<int16_t> transitions;  // classes_count transitions per state, from state 0
+
+  int32_t states_count() const
+  {
+    return classes_count > 0 ? static_cast<int32_t>(transitions.size()) / classes_count : 0;
+  }
+};
+
+/**
+ * @brief Builds the DFA of the subsets of the program instructions.
+ *
+ * The DFA decides whether a string contains a match of the program the way `reprog_device::find`
+ * does, or with `anchored` whether a match starts at the beginning of the string.
+ *
+ * @param prog The compiled regex program
+ * @param ascii_flags The character type flags of the DFA_CHARS_COUNT characters
+ * @param anchored Whether matches only start at the beginning of the string
+ * @return The DFA, without states if it would have more than MAX_DFA_STATES states
+ */
+redfa build_dfa(reprog const& prog, uint8_t const* ascii_flags, bool anchored);
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
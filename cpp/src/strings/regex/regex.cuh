@@ -16,11 +16,16 @@
 #pragma once
 
 #include <strings/regex/regcomp.h>
+#include <strings/regex/regdfa.h>
+
+#include <cudf/strings/regex/regex_program.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 
 #include <functional>
 #include <memory>
+#include <utility>
 
 namespace cudf {
 
@@ -33,6 +38,15 @@ struct reljunk;
 struct reinst;
 class reprog;
 
+/**
+ * @brief The search a regex program is also compiled to a DFA for.
+ */
+enum class dfa_mode : int8_t {
+  NONE,      ///< No DFA is built
+  CONTAINS,  ///< The DFA decides whether a string contains a match
+  MATCHES    ///< The DFA decides whether a match starts at the beginning of a string
+};
+
 /**
  * @brief Regex class stored on the device and executed by reprog_device.
  *
@@ -74,13 +88,50 @@ class reprog_device {
    * @param stream CUDA stream for asynchronous memory allocations. To ensure correct
    * synchronization on destruction, the same stream should be used for all operations with the
    * created objects.
+   * @param mode The search to also build a DFA for, if the pattern's DFA is small enough.
    * @return The program device object.
    */
   static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
     std::string const& pattern,
     const uint8_t* cp_flags,
     int32_t strings_count,
-    rmm::cuda_stream_view stream);
+    rmm::cuda_stream_view stream,
+    dfa_mode mode = dfa_mode::NONE);
+
+  /**
+   * @brief Create device program instance from a compiled regex program.
+   *
+   * The instructions are copied to the device at the first use of `prog` for `mode` and shared
+   * by the instances created after, so only the state data is allocated here.
+   *
+   * @param prog The compiled regex program.
+   * @param cp_flags The code-point lookup table for character types.
+   * @param strings_count Number of strings that will be evaluated.
+   * @param stream CUDA stream for asynchronous memory allocations. To ensure correct
+   * synchronization on destruction, the same stream should be used for all operations with the
+   * created objects.
+   * @param mode The search to also build a DFA for, if the pattern's DFA is small enough.
+   * @return The program device object.
+   */
+  static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
+    regex_program const& prog,
+    const uint8_t* cp_flags,
+    int32_t strings_count,
+    rmm::cuda_stream_view stream,
+    dfa_mode mode = dfa_mode::NONE);
+
+  /**
+   * @brief Copies the instructions of a host program, and its DFA if it has states, to the device.
+   *
+   * @param h_prog The host program.
+   * @param dfa The DFA of the program, or a DFA without states.
+   * @param cp_flags The code-point lookup table for character types.
+   * @param stream CUDA stream used for the device memory allocation and copy.
+   * @return The program device object, without state data, and the device memory it refers to.
+   */
+  static std::pair<std::unique_ptr<reprog_device>, std::unique_ptr<rmm::device_buffer>> upload(
+    reprog const& h_prog, redfa const& dfa, const uint8_t* cp_flags, rmm::cuda_stream_view stream);
+
   /**
    * @brief Called automatically by the unique_ptr returned from create().
    */
@@ -140,6 +191,20 @@ class reprog_device {
                                  int32_t& begin,
                                  int32_t& end);
 
+  /**
+   * @brief Returns true if the program has a DFA for the search it was created for.
+   */
+  __device__ bool has_dfa() const { return _dfa_states_count > 0; }
+
+  /**
+   * @brief Evaluates the DFA on a string of ASCII characters.
+   *
+   * @param d_str The string to search.
+   * @return 1 if a match is found, 0 if not, or -1 if the string has other characters, which the
+   * DFA doesn't decide.
+   */
+  __device__ inline int32_t dfa_find(string_view const& d_str) const;
+
   /**
    * @brief Does an extract evaluation using the compiled expression on the given string.
    *
@@ -168,6 +233,10 @@ class reprog_device {
   void* _relists_mem{};               // runtime relist memory for regexec
   u_char* _stack_mem1{};              // memory for relist object 1
   u_char* _stack_mem2{};              // memory for relist object 2
+  const uint8_t* _dfa_char_map{};     // DFA class of each ASCII character
+  const int16_t* _dfa_transitions{};  // DFA transitions of each state and class
+  int32_t _dfa_classes_count{};
+  int32_t _dfa_states_count{};
 
   /**
    * @brief Executes the regex pattern on the given string.
@@ -181,7 +250,7 @@ class reprog_device {
   __device__ inline int32_t call_regexec(
     int32_t idx, string_view const& d_str, int32_t& begin, int32_t& end, int32_t groupid = 0);
 
-  reprog_device(reprog&);  // must use create()
+  reprog_device(reprog const&);  // must use create()
 };
 
 // 10128 ≈ 1000 instructions
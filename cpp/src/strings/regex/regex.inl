@@ -380,6 +380,21 @@ __device__ inline int32_t reprog_device::find(int32_t idx,
   return rtn;
 }
 
+__device__ inline int32_t reprog_device::dfa_find(string_view const& dstr) const
+{
+  auto const bytes = reinterpret_cast<uint8_t const*>(dstr.data());
+  auto const size  = dstr.size_bytes();
+  int32_t state    = 0;
+  for (size_type idx = 0; idx <= size; ++idx) {
+    // The transitions of the end of the string, class 0, always end the evaluation
+    uint8_t const ch = idx < size ? bytes[idx] : 0;
+    if (ch >= DFA_CHARS_COUNT) { return -1; }
+    state = _dfa_transitions[state * _dfa_classes_count + _dfa_char_map[ch]];
+    if (state < 0) { return state == DFA_ACCEPT; }
+  }
+  return 0;
+}
+
 __device__ inline int32_t reprog_device::extract(
   int32_t idx, string_view const& dstr, int32_t& begin, int32_t& end, int32_t group_id)
 {
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <strings/regex/regcomp.h>
+#include <strings/regex/regdfa.h>
+#include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.h>
+
+#include <cudf/strings/regex/regex_program.hpp>
+#include <cudf/strings/string_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+// Number of compiled patterns kept by the cache
+constexpr std::size_t REGEX_CACHE_CAPACITY = 256;
+
+/**
+ * @brief Converts UTF-8 string into fixed-width 32-bit character vector.
+ *
+ * No character conversion occurs.
+ * Each UTF-8 character is promoted into a 32-bit value.
+ * The last entry in the returned vector will be a 0 value.
+ * The fixed-width vector makes it easier to compile and faster to execute.
+ *
+ * @param pattern Regular expression encoded with UTF-8.
+ * @return Fixed-width 32-bit character vector.
+ */
+std::vector<char32_t> string_to_char32_vector(std::string const& pattern)
+{
+  size_type size  = static_cast<size_type>(pattern.size());
+  size_type count = std::count_if(pattern.cbegin(), pattern.cend(), [](char ch) {
+    return is_begin_utf8_char(static_cast<uint8_t>(ch));
+  });
+  std::vector<char32_t> result(count + 1);
+  char32_t* output_ptr  = result.data();
+  const char* input_ptr = pattern.data();
+  for (size_type idx = 0; idx < size; ++idx) {
+    char_utf8 output_character = 0;
+    size_type ch_width         = to_char_utf8(input_ptr, output_character);
+    input_ptr += ch_width;
+    idx += ch_width - 1;
+    *output_ptr++ = output_character;
+  }
+  result[count] = 0;  // last entry set to 0
+  return result;
+}
+
+/**
+ * @brief Least recently used cache of compiled programs, keyed by pattern and DFA mode.
+ *
+ * Only host data is cached: the device copies belong to the `regex_program` objects, to avoid
+ * device memory outliving the RMM resources it was allocated from.
+ */
+class compiled_regex_cache {
+ public:
+  using key_type   = std::pair<std::string, dfa_mode>;
+  using value_type = std::shared_ptr<compiled_regex const>;
+
+  /**
+   * @brief Returns the cached program of `key`, or the one returned by `compile()`, which is
+   * called without holding the lock so that different patterns compile concurrently.
+   */
+  template <typename Compile>
+  value_type find_or_compile(key_type const& key, Compile compile)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (auto found = find(key)) { return found; }
+    }
+    auto compiled = compile();
+    std::lock_guard<std::mutex> lock(_mutex);
+    // another thread may have compiled the same pattern meanwhile
+    if (auto found = find(key)) { return found; }
+    _entries.emplace_front(key, compiled);
+    _index.emplace(key, _entries.begin());
+    if (_entries.size() > REGEX_CACHE_CAPACITY) {
+      _index.erase(_entries.back().first);
+      _entries.pop_back();
+    }
+    return compiled;
+  }
+
+ private:
+  using entries_type = std::list<std::pair<key_type, value_type>>;  // most recently used first
+
+  value_type find(key_type const& key)
+  {
+    auto const found = _index.find(key);
+    if (found == _index.end()) { return nullptr; }
+    _entries.splice(_entries.begin(), _entries, found->second);
+    return found->second->second;
+  }
+
+  std::mutex _mutex;
+  entries_type _entries;
+  std::map<key_type, entries_type::iterator> _index;
+};
+
+}  // namespace
+
+std::shared_ptr<compiled_regex const> compile_regex(std::string const& pattern,
+                                                    dfa_mode mode,
+                                                    uint8_t const* cp_flags,
+                                                    rmm::cuda_stream_view stream)
+{
+  static compiled_regex_cache cache;
+  return cache.find_or_compile({pattern, mode}, [&] {
+    auto result = std::make_shared<compiled_regex>();
+    if (mode == dfa_mode::NONE) {
+      std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
+      result->prog                    = reprog::create_from(pattern32.data());
+      return result;
+    }
+    // reuse the program compiled without a DFA
+    result->prog = compile_regex(pattern, dfa_mode::NONE, cp_flags, stream)->prog;
+    // build the DFA from the character types of the ASCII characters
+    std::vector<uint8_t> ascii_flags(DFA_CHARS_COUNT);
+    CUDA_TRY(cudaMemcpyAsync(ascii_flags.data(),
+                             cp_flags,
+                             ascii_flags.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
+    result->dfa = build_dfa(result->prog, ascii_flags.data(), mode == dfa_mode::MATCHES);
+    return result;
+  });
+}
+
+}  // namespace detail
+
+detail::reprog_device const& regex_program::regex_program_impl::device_program(
+  detail::dfa_mode mode, uint8_t const* cp_flags, rmm::cuda_stream_view stream)
+{
+  auto const index = static_cast<std::size_t>(mode);
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_d_progs[index]) {
+    auto const h_prog = mode == detail::dfa_mode::NONE
+                          ? compiled
+                          : detail::compile_regex(pattern, mode, cp_flags, stream);
+    std::tie(_d_progs[index], _d_buffers[index]) =
+      detail::reprog_device::upload(h_prog->prog, h_prog->dfa, cp_flags, stream);
+    // the device copy is used by later calls on any stream, and freed on the default stream
+    stream.synchronize();
+    _d_buffers[index]->set_stream(rmm::cuda_stream_default);
+  }
+  return *_d_progs[index];
+}
+
+regex_program::regex_program(std::string const& pattern)
+  : _pattern{pattern}, _impl{std::make_unique<regex_program_impl>(pattern)}
+{
+}
+
+regex_program::~regex_program() = default;
+
+std::unique_ptr<regex_program> regex_program::create(std::string const& pattern)
+{
+  return std::unique_ptr<regex_program>(new regex_program(pattern));
+}
+
+int32_t regex_program::instructions_count() const { return _impl->compiled->prog.insts_count(); }
+
+int32_t regex_program::groups_count() const { return _impl->compiled->prog.groups_count(); }
+
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <strings/regex/regcomp.h>
+#include <strings/regex/regdfa.h>
+#include <strings/regex/regex.cuh>
+
+#include <cudf/strings/regex/regex_program.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief A regex pattern compiled on the host, with its DFA for a search.
+ */
+struct compiled_regex {
+  reprog prog;
+  redfa dfa;  // without states if no DFA was built
+};
+
+/**
+ * @brief Returns the compiled program of `pattern` with the DFA for `mode`.
+ *
+ * The compiled programs of the most recently used patterns and modes are cached, so the
+ * pattern is only compiled if it is not in the cache.
+ *
+ * @throws cudf::logic_error if the pattern is invalid
+ *
+ * @param pattern The regex pattern to compile.
+ * @param mode The search to build a DFA for.
+ * @param cp_flags The code-point lookup table for character types, read to build a DFA.
+ * @param stream CUDA stream used to read the code-point table.
+ * @return The compiled program.
+ */
+std::shared_ptr<compiled_regex const> compile_regex(std::string const& pattern,
+                                                    dfa_mode mode,
+                                                    uint8_t const* cp_flags,
+                                                    rmm::cuda_stream_view stream);
+
+}  // namespace detail
+
+/**
+ * @brief The compiled data of a `regex_program`, and its device copies.
+ */
+struct regex_program::regex_program_impl {
+  explicit regex_program_impl(std::string const& pattern)
+    : pattern{pattern},
+      compiled{
+        detail::compile_regex(pattern, detail::dfa_mode::NONE, nullptr, rmm::cuda_stream_default)}
+  {
+  }
+
+  /**
+   * @brief Returns the device copy of the program with the DFA for `mode`, copying it to the
+   * device at the first call for `mode`.
+   *
+   * @param mode The search to also build a DFA for.
+   * @param cp_flags The code-point lookup table for character types.
+   * @param stream CUDA stream used for the copy, which is synchronized so that the device copy
+   * can be used on any stream after.
+   * @return The device program object, without state data.
+   */
+  detail::reprog_device const& device_program(detail::dfa_mode mode,
+                                              uint8_t const* cp_flags,
+                                              rmm::cuda_stream_view stream);
+
+  std::string const pattern;
+  std::shared_ptr<detail::compiled_regex const> const compiled;  // without a DFA
+
+ private:
+  static constexpr std::size_t modes_count = 3;  // number of dfa_mode values
+
+  std::mutex _mutex;  // guards the device copies
+  std::array<std::unique_ptr<detail::reprog_device>, modes_count> _d_progs;
+  std::array<std::unique_ptr<rmm::device_buffer>, modes_count> _d_buffers;
+};
+
+}  // namespace strings
+}  // namespace cudf
@@ -15,54 +15,26 @@
  */
 
 #include <strings/regex/regcomp.h>
+#include <strings/regex/regdfa.h>
 #include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.h>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 
-#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace strings {
 namespace detail {
-namespace {
-/**
- * @brief Converts UTF-8 string into fixed-width 32-bit character vector.
- *
- * No character conversion occurs.
- * Each UTF-8 character is promoted into a 32-bit value.
- * The last entry in the returned vector will be a 0 value.
- * The fixed-width vector makes it easier to compile and faster to execute.
- *
- * @param pattern Regular expression encoded with UTF-8.
- * @return Fixed-width 32-bit character vector.
- */
-std::vector<char32_t> string_to_char32_vector(std::string const& pattern)
-{
-  size_type size  = static_cast<size_type>(pattern.size());
-  size_type count = std::count_if(pattern.cbegin(), pattern.cend(), [](char ch) {
-    return is_begin_utf8_char(static_cast<uint8_t>(ch));
-  });
-  std::vector<char32_t> result(count + 1);
-  char32_t* output_ptr  = result.data();
-  const char* input_ptr = pattern.data();
-  for (size_type idx = 0; idx < size; ++idx) {
-    char_utf8 output_character = 0;
-    size_type ch_width         = to_char_utf8(input_ptr, output_character);
-    input_ptr += ch_width;
-    idx += ch_width - 1;
-    *output_ptr++ = output_character;
-  }
-  result[count] = 0;  // last entry set to 0
-  return result;
-}
-
-}  // namespace
 
 // Copy reprog primitive values
-reprog_device::reprog_device(reprog& prog)
+reprog_device::reprog_device(reprog const& prog)
   : _startinst_id{prog.get_start_inst()},
     _num_capturing_groups{prog.groups_count()},
     _insts_count{prog.insts_count()},
@@ -79,11 +51,48 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   std::string const& pattern,
   uint8_t const* codepoint_flags,
   int32_t strings_count,
-  rmm::cuda_stream_view stream)
+  rmm::cuda_stream_view stream,
+  dfa_mode mode)
+{
+  // the compiled program owns the device instructions used by the returned object
+  std::shared_ptr<regex_program const> prog = regex_program::create(pattern);
+  auto d_prog  = create(*prog, codepoint_flags, strings_count, stream, mode);
+  auto deleter = [prog, d_deleter = d_prog.get_deleter()](reprog_device* t) { d_deleter(t); };
+  return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog.release(),
+                                                                             deleter);
+}
+
+std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
+  regex_program const& prog,
+  uint8_t const* codepoint_flags,
+  int32_t strings_count,
+  rmm::cuda_stream_view stream,
+  dfa_mode mode)
+{
+  reprog_device* d_prog =
+    new reprog_device(prog.get_impl()->device_program(mode, codepoint_flags, stream));
+  // allocate execute memory if needed
+  rmm::device_buffer* d_relists{};
+  if (d_prog->_insts_count > MAX_STACK_INSTS) {
+    auto relist_alloc_size = relist::alloc_size(d_prog->_insts_count);
+    auto rlm_size          = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
+    d_relists              = new rmm::device_buffer(rlm_size, stream);
+    d_prog->_relists_mem   = d_relists->data();
+  }
+  //
+  auto deleter = [d_relists](reprog_device* t) {
+    t->destroy();
+    delete d_relists;
+  };
+  return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
+}
+
+std::pair<std::unique_ptr<reprog_device>, std::unique_ptr<rmm::device_buffer>>
+reprog_device::upload(reprog const& h_prog,
+                      redfa const& dfa,
+                      uint8_t const* codepoint_flags,
+                      rmm::cuda_stream_view stream)
 {
-  std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
-  // compile pattern into host object
-  reprog h_prog = reprog::create_from(pattern32.data());
   // compute size to hold all the member data
   auto insts_count   = h_prog.insts_count();
   auto classes_count = h_prog.classes_count();
@@ -97,21 +106,17 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     cudf::util::round_up_safe<size_t>(classes_count * sizeof(_classes[0]), sizeof(size_t));
   for (int32_t idx = 0; idx < classes_count; ++idx)
     classes_size += static_cast<int32_t>((h_prog.class_at(idx).literals.size()) * sizeof(char32_t));
-  size_t memsize  = insts_size + startids_size + classes_size;
-  size_t rlm_size = 0;
-  // check memory size needed for executing regex
-  if (insts_count > MAX_STACK_INSTS) {
-    auto relist_alloc_size = relist::alloc_size(insts_count);
-    rlm_size               = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
-  }
+  size_t dfa_size =
+    dfa.states_count() > 0 ? dfa.char_classes.size() + dfa.transitions.size() * sizeof(int16_t) : 0;
+  size_t memsize  = insts_size + startids_size + classes_size + dfa_size;
 
   // allocate memory to store prog data
   std::vector<u_char> h_buffer(memsize);
   u_char* h_ptr  = h_buffer.data();  // running pointer
-  auto* d_buffer = new rmm::device_buffer(memsize, stream);
+  auto d_buffer  = std::make_unique<rmm::device_buffer>(memsize, stream);
   u_char* d_ptr  = reinterpret_cast<u_char*>(d_buffer->data());  // running device pointer
   // put everything into a flat host buffer first
-  reprog_device* d_prog = new reprog_device(h_prog);
+  std::unique_ptr<reprog_device> d_prog(new reprog_device(h_prog));
   // copy the instructions array first (fixed-size structs)
   reinst* insts = reinterpret_cast<reinst*>(h_ptr);
   memcpy(insts, h_prog.insts_data(), insts_size);
@@ -132,7 +137,7 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   u_char* d_end = d_ptr + (classes_count * sizeof(reclass_device));
   // place each class and append the variable length data
   for (int32_t idx = 0; idx < classes_count; ++idx) {
-    reclass& h_class = h_prog.class_at(idx);
+    reclass const& h_class = h_prog.class_at(idx);
     reclass_device d_class;
     d_class.builtins = h_class.builtins;
     d_class.count    = h_class.literals.size() / 2;
@@ -142,28 +147,27 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     h_end += h_class.literals.size() * sizeof(char32_t);
     d_end += h_class.literals.size() * sizeof(char32_t);
   }
+  // copy the DFA last: [class of each character][transitions]
+  if (dfa_size > 0) {
+    memcpy(h_end, dfa.char_classes.data(), dfa.char_classes.size());
+    d_prog->_dfa_char_map = reinterpret_cast<uint8_t*>(d_end);
+    h_end += dfa.char_classes.size();
+    d_end += dfa.char_classes.size();
+    memcpy(h_end, dfa.transitions.data(), dfa.transitions.size() * sizeof(int16_t));
+    d_prog->_dfa_transitions   = reinterpret_cast<int16_t*>(d_end);
+    d_prog->_dfa_classes_count = dfa.classes_count;
+    d_prog->_dfa_states_count  = dfa.states_count();
+  }
   // initialize the rest of the elements
   d_prog->_insts_count     = insts_count;
   d_prog->_starts_count    = starts_count;
   d_prog->_classes_count   = classes_count;
   d_prog->_codepoint_flags = codepoint_flags;
-  // allocate execute memory if needed
-  rmm::device_buffer* d_relists{};
-  if (rlm_size > 0) {
-    d_relists            = new rmm::device_buffer(rlm_size, stream);
-    d_prog->_relists_mem = d_relists->data();
-  }
 
   // copy flat prog to device memory
   CUDA_TRY(cudaMemcpyAsync(
     d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice, stream.value()));
-  //
-  auto deleter = [d_buffer, d_relists](reprog_device* t) {
-    t->destroy();
-    delete d_buffer;
-    delete d_relists;
-  };
-  return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
+  return std::make_pair(std::move(d_prog), std::move(d_buffer));
 }
 
 void reprog_device::destroy() { delete this; }
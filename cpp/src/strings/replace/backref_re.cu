@@ -82,19 +82,19 @@ std::pair<std::string, std::vector<backref_type>> parse_backrefs(std::string con
 //
 std::unique_ptr<column> replace_with_backrefs(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   std::string const& repl,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   if (strings.is_empty()) return make_empty_strings_column(stream, mr);
 
-  CUDF_EXPECTS(!pattern.empty(), "Parameter pattern must not be empty");
+  CUDF_EXPECTS(!prog.pattern().empty(), "Parameter pattern must not be empty");
   CUDF_EXPECTS(!repl.empty(), "Parameter repl must not be empty");
 
   auto d_strings = column_device_view::create(strings.parent(), stream);
-  // compile regex into device object
-  auto d_prog = reprog_device::create(pattern, get_character_flags_table(), strings.size(), stream);
+  // create the device object of the compiled regex
+  auto d_prog = reprog_device::create(prog, get_character_flags_table(), strings.size(), stream);
   auto const regex_insts = d_prog->insts_counts();
 
   // parse the repl string for backref indicators
@@ -140,7 +140,7 @@ std::unique_ptr<column> replace_with_backrefs(
 
 }  // namespace detail
 
-// external API
+// external APIs
 
 std::unique_ptr<column> replace_with_backrefs(strings_column_view const& strings,
                                               std::string const& pattern,
@@ -148,7 +148,17 @@ std::unique_ptr<column> replace_with_backrefs(strings_column_view const& strings
                                               rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::replace_with_backrefs(strings, pattern, repl, rmm::cuda_stream_default, mr);
+  return detail::replace_with_backrefs(
+    strings, *regex_program::create(pattern), repl, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> replace_with_backrefs(strings_column_view const& strings,
+                                              regex_program const& prog,
+                                              std::string const& repl,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_with_backrefs(strings, prog, repl, rmm::cuda_stream_default, mr);
 }
 
 }  // namespace strings
@@ -104,7 +104,7 @@ struct replace_regex_fn {
 //
 std::unique_ptr<column> replace_re(
   strings_column_view const& strings,
-  std::string const& pattern,
+  regex_program const& prog,
   string_scalar const& repl           = string_scalar(""),
   size_type maxrepl                   = -1,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
@@ -118,9 +118,9 @@ std::unique_ptr<column> replace_re(
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
-  // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
-  auto d_prog = *prog;
+  // create the device object of the compiled regex
+  auto d_prog_ptr = reprog_device::create(prog, get_character_flags_table(), strings_count, stream);
+  auto d_prog     = *d_prog_ptr;
   auto regex_insts = d_prog.insts_counts();
 
   // copy null mask
@@ -161,7 +161,7 @@ std::unique_ptr<column> replace_re(
 
 }  // namespace detail
 
-// external API
+// external APIs
 
 std::unique_ptr<column> replace_re(strings_column_view const& strings,
                                    std::string const& pattern,
@@ -170,7 +170,18 @@ std::unique_ptr<column> replace_re(strings_column_view const& strings,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::replace_re(strings, pattern, repl, maxrepl, rmm::cuda_stream_default, mr);
+  return detail::replace_re(
+    strings, *regex_program::create(pattern), repl, maxrepl, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> replace_re(strings_column_view const& strings,
+                                   regex_program const& prog,
+                                   string_scalar const& repl,
+                                   size_type maxrepl,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_re(strings, prog, repl, maxrepl, rmm::cuda_stream_default, mr);
 }
 
 }  // namespace strings
@@ -25,12 +25,17 @@
 #include <cudf/strings/split/split.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/scan.h>
 #include <thrust/transform.h>
 
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -219,19 +224,24 @@ struct whitespace_token_reader_fn {
 
 }  // namespace
 
-// The output is one list item per string
+/**
+ * @brief Split each string into tokens.
+ *
+ * @param strings_count Number of strings
+ * @param counter Functor computing the number of tokens of each string
+ * @param reader Functor identifying the tokens of each string
+ * @param d_offsets Output `strings_count + 1` offsets of the tokens of each string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The tokens of all the strings
+ */
 template <typename TokenCounter, typename TokenReader>
-std::unique_ptr<column> split_record_fn(strings_column_view const& strings,
-                                        TokenCounter counter,
-                                        TokenReader reader,
-                                        rmm::cuda_stream_view stream,
-                                        rmm::mr::device_memory_resource* mr)
+rmm::device_uvector<string_index_pair> split_tokens(size_type strings_count,
+                                                    TokenCounter counter,
+                                                    TokenReader reader,
+                                                    int32_t* d_offsets,
+                                                    rmm::cuda_stream_view stream)
 {
-  // create offsets column by counting the number of tokens per string
-  auto strings_count = strings.size();
-  auto offsets       = make_numeric_column(
-    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
-  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  // compute the offsets by counting the number of tokens per string
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<size_type>(0),
                     thrust::make_counting_iterator<size_type>(strings_count),
@@ -241,13 +251,30 @@ std::unique_ptr<column> split_record_fn(strings_column_view const& strings,
     rmm::exec_policy(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
 
   // last entry is the total number of tokens to be generated
-  auto total_tokens = cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+  auto const total_tokens = cudf::detail::get_value<int32_t>(
+    column_view(data_type{type_id::INT32}, strings_count + 1, d_offsets), strings_count, stream);
   // split each string into an array of index-pair values
   rmm::device_uvector<string_index_pair> tokens(total_tokens, stream);
   reader.d_token_offsets = d_offsets;
   reader.d_tokens        = tokens.data();
   thrust::for_each_n(
     rmm::exec_policy(stream), thrust::make_counting_iterator<size_type>(0), strings_count, reader);
+  return tokens;
+}
+
+// The output is one list item per string
+template <typename TokenCounter, typename TokenReader>
+std::unique_ptr<column> split_record_fn(strings_column_view const& strings,
+                                        TokenCounter counter,
+                                        TokenReader reader,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  auto strings_count = strings.size();
+  auto offsets       = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  auto tokens    = split_tokens(strings_count, counter, reader, d_offsets, stream);
   // convert the index-pairs into one big strings column
   auto strings_output = make_strings_column(tokens.begin(), tokens.end(), stream, mr);
   // create a lists column using the offsets and the strings columns
@@ -258,13 +285,44 @@ std::unique_ptr<column> split_record_fn(strings_column_view const& strings,
                            copy_bitmask(strings.parent(), stream, mr));
 }
 
-template <Dir dir>
-std::unique_ptr<column> split_record(
-  strings_column_view const& strings,
-  string_scalar const& delimiter      = string_scalar(""),
-  size_type maxsplit                  = -1,
-  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+// The output is one row per token, along with the row of its string
+template <typename TokenCounter, typename TokenReader>
+std::unique_ptr<table> split_explode_fn(strings_column_view const& strings,
+                                        TokenCounter counter,
+                                        TokenReader reader,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  auto strings_count = strings.size();
+  rmm::device_uvector<int32_t> offsets(strings_count + 1, stream);
+  auto tokens = split_tokens(strings_count, counter, reader, offsets.data(), stream);
+
+  // the row of each token is the last string whose tokens start at or before it
+  auto const total_tokens = static_cast<size_type>(tokens.size());
+  auto rows               = make_numeric_column(
+    data_type{type_to_id<size_type>()}, total_tokens, mask_state::UNALLOCATED, stream, mr);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      offsets.begin() + 1,
+                      offsets.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(total_tokens),
+                      rows->mutable_view().data<size_type>());
+
+  std::vector<std::unique_ptr<column>> results;
+  results.push_back(std::move(rows));
+  results.push_back(make_strings_column(tokens.begin(), tokens.end(), stream, mr));
+  return std::make_unique<table>(std::move(results));
+}
+
+/**
+ * @brief Calls `split_fn` with the token counter and reader for the delimiter.
+ */
+template <Dir dir, typename SplitFn>
+auto split_with_delimiter(strings_column_view const& strings,
+                          string_scalar const& delimiter,
+                          size_type maxsplit,
+                          SplitFn split_fn,
+                          rmm::cuda_stream_view stream)
 {
   CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
 
@@ -273,21 +331,50 @@ std::unique_ptr<column> split_record(
 
   auto d_strings_column_ptr = column_device_view::create(strings.parent(), stream);
   if (delimiter.size() == 0) {
-    return split_record_fn(strings,
-                           whitespace_token_counter_fn{*d_strings_column_ptr, max_tokens},
-                           whitespace_token_reader_fn<dir>{*d_strings_column_ptr, max_tokens},
-                           stream,
-                           mr);
+    return split_fn(whitespace_token_counter_fn{*d_strings_column_ptr, max_tokens},
+                    whitespace_token_reader_fn<dir>{*d_strings_column_ptr, max_tokens});
   } else {
     string_view d_delimiter(delimiter.data(), delimiter.size());
-    return split_record_fn(strings,
-                           token_counter_fn{*d_strings_column_ptr, d_delimiter, max_tokens},
-                           token_reader_fn<dir>{*d_strings_column_ptr, d_delimiter},
-                           stream,
-                           mr);
+    return split_fn(token_counter_fn{*d_strings_column_ptr, d_delimiter, max_tokens},
+                    token_reader_fn<dir>{*d_strings_column_ptr, d_delimiter});
   }
 }
 
+template <Dir dir>
+std::unique_ptr<column> split_record(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  return split_with_delimiter<dir>(
+    strings,
+    delimiter,
+    maxsplit,
+    [&](auto counter, auto reader) {
+      return split_record_fn(strings, counter, reader, stream, mr);
+    },
+    stream);
+}
+
+std::unique_ptr<table> split_explode(
+  strings_column_view const& strings,
+  string_scalar const& delimiter      = string_scalar(""),
+  size_type maxsplit                  = -1,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  return split_with_delimiter<Dir::FORWARD>(
+    strings,
+    delimiter,
+    maxsplit,
+    [&](auto counter, auto reader) {
+      return split_explode_fn(strings, counter, reader, stream, mr);
+    },
+    stream);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -312,5 +399,14 @@ std::unique_ptr<column> rsplit_record(strings_column_view const& strings,
     strings, delimiter, maxsplit, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> split_explode(strings_column_view const& strings,
+                                     string_scalar const& delimiter,
+                                     size_type maxsplit,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_explode(strings, delimiter, maxsplit, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
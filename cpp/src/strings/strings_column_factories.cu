@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/detail/utilities.cuh>
@@ -25,6 +26,10 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/transform.h>
+
+#include <limits>
+
 namespace cudf {
 
 namespace {
@@ -125,6 +130,27 @@ std::unique_ptr<column> make_strings_column(size_type num_strings,
                "Invalid offsets column size for strings column.");
   CUDF_EXPECTS(offsets_column->null_count() == 0, "Offsets column should not contain nulls");
   CUDF_EXPECTS(chars_column->null_count() == 0, "Chars column should not contain nulls");
+  CUDF_EXPECTS(offsets_column->type().id() == type_id::INT32 ||
+                 offsets_column->type().id() == type_id::INT64,
+               "Offsets column must be INT32 or INT64");
+
+  // 64-bit offsets, such as those of Arrow large strings, are stored as 32-bit offsets
+  // since the chars column holds at most size_type bytes
+  if (offsets_column->type().id() == type_id::INT64) {
+    auto const offsets_view = offsets_column->view();
+    auto const last_offset =
+      cudf::detail::get_value<int64_t>(offsets_view, offsets_view.size() - 1, stream);
+    CUDF_EXPECTS(last_offset <= static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+                 "Total number of bytes in the strings exceeds size_type range");
+    auto narrowed = make_numeric_column(
+      data_type{type_id::INT32}, offsets_view.size(), mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      offsets_view.begin<int64_t>(),
+                      offsets_view.end<int64_t>(),
+                      narrowed->mutable_view().begin<int32_t>(),
+                      [] __device__(int64_t offset) { return static_cast<int32_t>(offset); });
+    offsets_column = std::move(narrowed);
+  }
 
   std::vector<std::unique_ptr<column>> children;
   children.emplace_back(std::move(offsets_column));
@@ -28,6 +28,9 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/substring.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <strings/utilities.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -40,12 +43,15 @@ namespace {
  *
  * This will perform a substring operation on each string
  * using the provided start, stop, and step parameters.
+ *
+ * The character positions of ASCII strings are used directly as byte positions.
  */
 struct substring_fn {
   column_device_view const d_column;
   numeric_scalar_device_view<size_type> const d_start;
   numeric_scalar_device_view<size_type> const d_stop;
   numeric_scalar_device_view<size_type> const d_step;
+  bool const is_ascii;
   int32_t* d_offsets{};
   char* d_chars{};
 
@@ -56,7 +62,7 @@ struct substring_fn {
       return;
     }
     auto const d_str  = d_column.template element<string_view>(idx);
-    auto const length = d_str.length();
+    auto const length = is_ascii ? d_str.size_bytes() : d_str.length();
     if (length == 0) {
       if (!d_chars) d_offsets[idx] = 0;
       return;
@@ -64,36 +70,46 @@ struct substring_fn {
     size_type const step = d_step.is_valid() ? d_step.value() : 1;
     auto const begin     = [&] {  // always inclusive
       // when invalid, default depends on step
-      if (!d_start.is_valid()) return (step > 0) ? d_str.begin() : (d_str.end() - 1);
+      if (!d_start.is_valid()) return (step > 0) ? 0 : (length - 1);
       // normal positive position logic
       auto start = d_start.value();
       if (start >= 0) {
-        if (start < length) return d_str.begin() + start;
-        return d_str.end() + (step < 0 ? -1 : 0);
+        if (start < length) return start;
+        return length + (step < 0 ? -1 : 0);
       }
       // handle negative position here
       auto adjust = length + start;
-      if (adjust >= 0) return d_str.begin() + adjust;
-      return d_str.begin() + (step < 0 ? -1 : 0);
+      if (adjust >= 0) return adjust;
+      return (step < 0 ? -1 : 0);
     }();
     auto const end = [&] {  // always exclusive
       // when invalid, default depends on step
-      if (!d_stop.is_valid()) return step > 0 ? d_str.end() : (d_str.begin() - 1);
+      if (!d_stop.is_valid()) return step > 0 ? length : -1;
       // normal positive position logic
       auto stop = d_stop.value();
-      if (stop >= 0) return (stop < length) ? (d_str.begin() + stop) : d_str.end();
+      if (stop >= 0) return (stop < length) ? stop : length;
       // handle negative position here
       auto adjust = length + stop;
-      return d_str.begin() + (adjust >= 0 ? adjust : -1);
+      return (adjust >= 0 ? adjust : -1);
     }();
 
     size_type bytes = 0;
     char* d_buffer  = d_chars ? d_chars + d_offsets[idx] : nullptr;
-    auto itr        = begin;
-    while (step > 0 ? itr < end : end < itr) {
-      bytes += bytes_in_char_utf8(*itr);
-      if (d_buffer) d_buffer += from_char_utf8(*itr, d_buffer);
-      itr += step;
+    if (is_ascii && step == 1) {
+      bytes = std::max(end - begin, 0);
+      if (d_buffer) memcpy(d_buffer, d_str.data() + begin, bytes);
+    } else if (is_ascii) {
+      for (auto pos = begin; step > 0 ? pos < end : end < pos; pos += step) {
+        if (d_buffer) *d_buffer++ = d_str.data()[pos];
+        ++bytes;
+      }
+    } else {
+      auto itr = d_str.begin() + begin;
+      while (step > 0 ? itr.position() < end : end < itr.position()) {
+        bytes += bytes_in_char_utf8(*itr);
+        if (d_buffer) d_buffer += from_char_utf8(*itr, d_buffer);
+        itr += step;
+      }
     }
     if (!d_chars) d_offsets[idx] = bytes;
   }
@@ -120,7 +136,10 @@ std::unique_ptr<column> slice_strings(
   auto const d_step   = get_scalar_device_view(const_cast<numeric_scalar<size_type>&>(step));
 
   auto children = make_strings_children(
-    substring_fn{*d_column, d_start, d_stop, d_step}, strings.size(), stream, mr);
+    substring_fn{*d_column, d_start, d_stop, d_step, is_all_ascii(strings, stream)},
+    strings.size(),
+    stream,
+    mr);
 
   return make_strings_column(strings.size(),
                              std::move(children.first),
@@ -152,11 +171,14 @@ namespace {
  * @brief Function logic for substring_from API.
  *
  * This both calculates the output size and executes the substring.
+ *
+ * The character positions of ASCII strings are used directly as byte positions.
  */
 struct substring_from_fn {
   column_device_view const d_column;
   cudf::detail::input_indexalator const starts;
   cudf::detail::input_indexalator const stops;
+  bool const is_ascii;
   int32_t* d_offsets{};
   char* d_chars{};
 
@@ -166,7 +188,8 @@ struct substring_from_fn {
       if (!d_chars) d_offsets[idx] = 0;
       return;
     }
-    auto const d_str  = d_column.template element<string_view>(idx);
+    auto d_str = d_column.template element<string_view>(idx);
+    if (is_ascii) d_str = string_view(d_str.data(), d_str.size_bytes(), d_str.size_bytes());
     auto const length = d_str.length();
     auto const start  = std::max(starts[idx], 0);
     if (start >= length) {
@@ -195,6 +218,7 @@ struct substring_from_fn {
  * @param null_count Number of nulls for the output column.
  * @param starts Start positions index iterator.
  * @param stops Stop positions index iterator.
+ * @param is_ascii Whether all the characters of `d_column` are ASCII.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -202,6 +226,7 @@ std::unique_ptr<column> compute_substrings_from_fn(column_device_view const& d_c
                                                    size_type null_count,
                                                    cudf::detail::input_indexalator starts,
                                                    cudf::detail::input_indexalator stops,
+                                                   bool is_ascii,
                                                    rmm::cuda_stream_view stream,
                                                    rmm::mr::device_memory_resource* mr)
 {
@@ -214,8 +239,8 @@ std::unique_ptr<column> compute_substrings_from_fn(column_device_view const& d_c
       : rmm::device_buffer(
           d_column.null_mask(), cudf::bitmask_allocation_size_bytes(strings_count), stream, mr);
 
-  auto children =
-    make_strings_children(substring_from_fn{d_column, starts, stops}, strings_count, stream, mr);
+  auto children = make_strings_children(
+    substring_from_fn{d_column, starts, stops, is_ascii}, strings_count, stream, mr);
 
   return make_strings_column(strings_count,
                              std::move(children.first),
@@ -238,6 +263,7 @@ void compute_substring_indices(column_device_view const& d_column,
                                size_type delimiter_count,
                                size_type* start_char_pos,
                                size_type* end_char_pos,
+                               bool is_ascii,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
@@ -247,7 +273,8 @@ void compute_substring_indices(column_device_view const& d_column,
     rmm::exec_policy(stream),
     thrust::make_counting_iterator<size_type>(0),
     strings_count,
-    [delim_itr, delimiter_count, start_char_pos, end_char_pos, d_column] __device__(size_type idx) {
+    [delim_itr, delimiter_count, start_char_pos, end_char_pos, d_column, is_ascii] __device__(
+      size_type idx) {
       auto const& delim_val_pair = delim_itr[idx];
       auto const& delim_val      = delim_val_pair.first;  // Don't use it yet
 
@@ -256,7 +283,10 @@ void compute_substring_indices(column_device_view const& d_column,
       // If the global delimiter or the row specific delimiter is invalid or if it is empty, row
       // value is empty.
       if (d_column.is_null(idx) || !delim_val_pair.second || delim_val.empty()) return;
-      auto const& col_val = d_column.element<string_view>(idx);
+      auto col_val = d_column.element<string_view>(idx);
+      if (is_ascii) {
+        col_val = string_view(col_val.data(), col_val.size_bytes(), col_val.size_bytes());
+      }
 
       // If the column value for the row is empty, the row value is empty.
       if (!col_val.empty()) {
@@ -316,8 +346,13 @@ std::unique_ptr<column> slice_strings(
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto starts_iter    = cudf::detail::indexalator_factory::make_input_iterator(starts_column);
   auto stops_iter     = cudf::detail::indexalator_factory::make_input_iterator(stops_column);
-  return compute_substrings_from_fn(
-    *strings_column, strings.null_count(), starts_iter, stops_iter, stream, mr);
+  return compute_substrings_from_fn(*strings_column,
+                                    strings.null_count(),
+                                    starts_iter,
+                                    stops_iter,
+                                    is_all_ascii(strings, stream),
+                                    stream,
+                                    mr);
 }
 
 template <typename DelimiterItrT>
@@ -335,23 +370,24 @@ std::unique_ptr<column> slice_strings(strings_column_view const& strings,
   auto start_chars_pos_vec = make_column_from_scalar(numeric_scalar<size_type>(0, true, stream),
                                                      strings_count,
                                                      stream,
-                                                     rmm::mr::get_current_device_resource());
+                                                     cudf::get_current_temp_resource());
   auto stop_chars_pos_vec  = make_column_from_scalar(numeric_scalar<size_type>(0, true, stream),
                                                     strings_count,
                                                     stream,
-                                                    rmm::mr::get_current_device_resource());
+                                                    cudf::get_current_temp_resource());
 
   auto start_char_pos = start_chars_pos_vec->mutable_view().data<size_type>();
   auto end_char_pos   = stop_chars_pos_vec->mutable_view().data<size_type>();
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
+  auto const is_ascii = is_all_ascii(strings, stream);
 
   // If delimiter count is 0, the output column will contain empty strings
   if (count != 0) {
     // Compute the substring indices first
     compute_substring_indices(
-      d_column, delimiter_itr, count, start_char_pos, end_char_pos, stream, mr);
+      d_column, delimiter_itr, count, start_char_pos, end_char_pos, is_ascii, stream, mr);
   }
 
   // Extract the substrings using the indices next
@@ -359,8 +395,13 @@ std::unique_ptr<column> slice_strings(strings_column_view const& strings,
     cudf::detail::indexalator_factory::make_input_iterator(start_chars_pos_vec->view());
   auto stops_iter =
     cudf::detail::indexalator_factory::make_input_iterator(stop_chars_pos_vec->view());
-  return compute_substrings_from_fn(
-    d_column, strings.null_count(), starts_iter, stops_iter, stream, mr);
+  return compute_substrings_from_fn(d_column,
+                                    strings.null_count(),
+                                    starts_iter,
+                                    stops_iter,
+                                    is_ascii,
+                                    stream,
+                                    mr);
 }
 
 }  // namespace detail
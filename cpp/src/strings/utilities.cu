@@ -28,9 +28,13 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
 
+#include <cstdint>
 #include <cstring>
 
 namespace cudf {
@@ -120,6 +124,58 @@ std::unique_ptr<column> make_empty_strings_column(rmm::cuda_stream_view stream,
                                   0);  // nulls
 }
 
+bool use_warp_per_string(strings_column_view const& strings, rmm::cuda_stream_view stream)
+{
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return false;
+  auto const offsets     = strings.offsets();
+  auto const first       = strings.offset();
+  auto const begin_bytes = cudf::detail::get_value<int32_t>(offsets, first, stream);
+  auto const end_bytes   = cudf::detail::get_value<int32_t>(offsets, first + strings_count, stream);
+  auto const total_bytes = end_bytes - begin_bytes;
+  if (total_bytes >= static_cast<int64_t>(WARP_PER_STRING_AVG_BYTES) * strings_count) return true;
+  if (total_bytes < WARP_PER_STRING_MAX_BYTES) return false;
+  // an average below the threshold may still hide a few long strings
+  auto const d_offsets = offsets.data<int32_t>() + first;
+  auto const max_bytes = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    [d_offsets] __device__(size_type idx) { return d_offsets[idx + 1] - d_offsets[idx]; },
+    0,
+    thrust::maximum<int32_t>{});
+  return max_bytes >= WARP_PER_STRING_MAX_BYTES;
+}
+
+bool is_all_ascii(strings_column_view const& strings, rmm::cuda_stream_view stream)
+{
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return true;
+  auto const offsets     = strings.offsets();
+  auto const first       = strings.offset();
+  auto const begin_bytes = cudf::detail::get_value<int32_t>(offsets, first, stream);
+  auto const end_bytes   = cudf::detail::get_value<int32_t>(offsets, first + strings_count, stream);
+  if (begin_bytes == end_bytes) return true;
+
+  // the 4-byte words are read from the word holding the first byte of the strings
+  auto const d_begin   = strings.chars().data<char>() + begin_bytes;
+  auto const head      = static_cast<int32_t>(reinterpret_cast<std::uintptr_t>(d_begin) % 4);
+  auto const d_words   = reinterpret_cast<uint32_t const*>(d_begin - head);
+  auto const bytes     = head + (end_bytes - begin_bytes);
+  auto const num_words = (bytes + 3) / 4;
+  return thrust::all_of(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_words),
+                        [d_words, head, bytes] __device__(size_type idx) {
+                          // only the high bits of the bytes of the strings are checked
+                          auto const tail = bytes - idx * 4;
+                          uint32_t mask   = 0x80808080u;
+                          if (idx == 0) mask &= 0xFFFFFFFFu << (8 * head);
+                          if (tail < 4) mask &= 0xFFFFFFFFu >> (8 * (4 - tail));
+                          return (d_words[idx] & mask) == 0;
+                        });
+}
+
 namespace {
 // The device variables are created here to avoid using a singleton that may cause issues
 // with RMM initialize/finalize. See PR #3159 for details on this approach.
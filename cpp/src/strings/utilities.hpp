@@ -15,6 +15,10 @@
  */
 #pragma once
 
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
 #include <cstdint>
 
 namespace cudf {
@@ -62,6 +66,38 @@ const character_cases_table_type* get_character_cases_table();
  */
 const struct special_case_mapping* get_special_case_mapping_table();
 
+// Average string size, in bytes, from which a warp is assigned to each string
+constexpr size_type WARP_PER_STRING_AVG_BYTES = 64;
+// Longest string size, in bytes, from which a warp is assigned to each string
+constexpr size_type WARP_PER_STRING_MAX_BYTES = 4096;
+
+/**
+ * @brief Returns true if the strings are long enough for the kernels assigning a warp to each
+ * string to be faster than those assigning a thread to each string.
+ *
+ * This is the case when the average size of the strings reaches `WARP_PER_STRING_AVG_BYTES`,
+ * or when the longest string reaches `WARP_PER_STRING_MAX_BYTES` since a few long strings keep
+ * their thread's whole warp busy.
+ *
+ * @param strings Strings column to evaluate.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return true if the warp per string kernels should be used.
+ */
+bool use_warp_per_string(strings_column_view const& strings, rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns true if all the characters of the strings are ASCII.
+ *
+ * The length of an ASCII string is its number of bytes, so the character positions of the
+ * strings can be used as byte positions, see the `string_view` constructor accepting a length.
+ * The chars bytes of the strings are checked 4 at a time.
+ *
+ * @param strings Strings column to evaluate.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return true if no byte of the strings is above 0x7F.
+ */
+bool is_all_ascii(strings_column_view const& strings, rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
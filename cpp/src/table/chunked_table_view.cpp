@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Returns the offsets of the first row of each chunk, followed by the total number of rows.
+ */
+template <typename Chunks, typename RowCount>
+std::vector<size_type> compute_chunk_offsets(Chunks const& chunks, RowCount row_count)
+{
+  std::vector<size_type> offsets{0};
+  int64_t total = 0;
+  for (auto const& chunk : chunks) {
+    total += row_count(chunk);
+    CUDF_EXPECTS(total <= std::numeric_limits<size_type>::max(),
+                 "Total number of rows exceeds size_type range");
+    offsets.push_back(static_cast<size_type>(total));
+  }
+  return offsets;
+}
+
+}  // namespace
+
+chunked_column_view::chunked_column_view(std::vector<column_view> const& chunks)
+  : _chunks{chunks}
+{
+  CUDF_EXPECTS(not _chunks.empty(), "A chunked column requires at least one chunk");
+  auto const type = _chunks.front().type();
+  CUDF_EXPECTS(std::all_of(_chunks.begin(),
+                           _chunks.end(),
+                           [type](auto const& c) { return c.type() == type; }),
+               "Type mismatch between the chunks");
+  _offsets = compute_chunk_offsets(_chunks, [](column_view const& c) { return c.size(); });
+}
+
+size_type chunked_column_view::null_count() const
+{
+  return std::accumulate(_chunks.begin(), _chunks.end(), size_type{0}, [](auto count, auto& c) {
+    return count + c.null_count();
+  });
+}
+
+chunked_table_view::chunked_table_view(std::vector<table_view> const& chunks) : _chunks{chunks}
+{
+  CUDF_EXPECTS(not _chunks.empty(), "A chunked table requires at least one chunk");
+  auto const& first = _chunks.front();
+  CUDF_EXPECTS(std::all_of(_chunks.begin(),
+                           _chunks.end(),
+                           [&first](auto const& t) { return have_same_types(t, first); }),
+               "Column type mismatch between the chunks");
+  _offsets = compute_chunk_offsets(_chunks, [](table_view const& t) { return t.num_rows(); });
+}
+
+chunked_column_view chunked_table_view::column(size_type column_index) const
+{
+  std::vector<column_view> chunks;
+  std::transform(_chunks.begin(),
+                 _chunks.end(),
+                 std::back_inserter(chunks),
+                 [column_index](auto const& t) { return t.column(column_index); });
+  return chunked_column_view(chunks);
+}
+
+}  // namespace cudf
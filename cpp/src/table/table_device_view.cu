@@ -41,7 +41,7 @@ table_device_view_base<ColumnDeviceView, HostTableView>::table_device_view_base(
   // objects and copied into device memory for the table_device_view's
   // _columns member.
   if (source_view.num_columns() > 0) {
-    std::unique_ptr<rmm::device_buffer> descendant_storage_owner;
+    std::unique_ptr<device_view_storage> descendant_storage_owner;
     std::tie(descendant_storage_owner, _columns) =
       contiguous_copy_column_device_views<ColumnDeviceView, HostTableView>(source_view, stream);
     _descendant_storage = descendant_storage_owner.release();
@@ -62,6 +62,26 @@ struct is_relationally_comparable_impl {
     return cudf::is_relationally_comparable<T, T>();
   }
 };
+
+/**
+ * @brief Returns whether the elements of both columns are relationally comparable, where a struct
+ * or list column is comparable if all of its children are.
+ */
+template <typename ColumnDeviceView>
+__device__ bool is_column_relationally_comparable(ColumnDeviceView const& lhs,
+                                                  ColumnDeviceView const& rhs)
+{
+  if (lhs.type() != rhs.type()) { return false; }
+  // the offsets child of a list column is always comparable
+  if (lhs.type().id() == type_id::STRUCT or lhs.type().id() == type_id::LIST) {
+    if (lhs.num_child_columns() != rhs.num_child_columns()) { return false; }
+    for (size_type i = 0; i < lhs.num_child_columns(); ++i) {
+      if (not is_column_relationally_comparable(lhs.child(i), rhs.child(i))) { return false; }
+    }
+    return true;
+  }
+  return type_dispatcher(lhs.type(), is_relationally_comparable_impl{});
+}
 }  // namespace
 
 template <typename TableView>
@@ -72,9 +92,7 @@ bool is_relationally_comparable(TableView const& lhs, TableView const& rhs)
                         [lhs, rhs] __device__(auto const i) {
                           // Simplified this for compile time. (Ideally use double_type_dispatcher)
                           // TODO: possible to implement without double type dispatcher.
-                          return lhs.column(i).type() == rhs.column(i).type() and
-                                 type_dispatcher(lhs.column(i).type(),
-                                                 is_relationally_comparable_impl{});
+                          return is_column_relationally_comparable(lhs.column(i), rhs.column(i));
                         });
 }
 
@@ -94,4 +94,14 @@ table_view scatter_columns(table_view const& source,
   return table_view{updated_columns};
 }
 
+bool has_nested_nulls(table_view const& input)
+{
+  return std::any_of(input.begin(), input.end(), [](column_view const& col) {
+    return col.has_nulls() or
+           std::any_of(col.child_begin(), col.child_end(), [](column_view const& child) {
+             return has_nested_nulls(table_view{{child}});
+           });
+  });
+}
+
 }  // namespace cudf
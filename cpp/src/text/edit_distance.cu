@@ -21,13 +21,24 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
@@ -137,6 +148,267 @@ struct edit_distance_matrix_levenshtein_algorithm {
   }
 };
 
+/**
+ * @brief The largest `max_distance` of the thresholded edit distance.
+ *
+ * The band of `2 * max_distance + 1` diagonals of a computation is held in a local array.
+ */
+constexpr cudf::size_type max_threshold = 127;
+
+/**
+ * @brief Compute the edit-distance between two strings up to a threshold
+ *
+ * Only the cells of the Levenshtein matrix within `max_distance` diagonals of the main one
+ * are computed since any path through the others costs more than `max_distance`. The
+ * computation also stops at the first row whose values all exceed `max_distance`.
+ *
+ * @param d_str First string
+ * @param d_tgt Second string
+ * @param max_distance Largest distance to compute, at most `max_threshold`
+ * @return Edit distance value, or `max_distance + 1` if it is larger than `max_distance`
+ */
+__device__ int32_t compute_bounded_distance(cudf::string_view const& d_str,
+                                            cudf::string_view const& d_tgt,
+                                            cudf::size_type max_distance)
+{
+  auto const str_length = d_str.length();
+  auto const tgt_length = d_tgt.length();
+  // .first is min and .second is max
+  auto const lengths  = std::minmax(str_length, tgt_length);
+  auto const exceeded = static_cast<int16_t>(max_distance + 1);
+  if (lengths.second - lengths.first > max_distance) return exceeded;
+  if (lengths.first == 0) return lengths.second;
+
+  auto itr_A = str_length < tgt_length ? d_str.begin() : d_tgt.begin();
+  auto itr_B = str_length < tgt_length ? d_tgt.begin() : d_str.begin();
+
+  // band[d] is the value of the current row at column `row + d - max_distance`
+  int16_t band[2 * max_threshold + 1];
+  auto const band_size = 2 * max_distance + 1;
+  for (cudf::size_type d = 0; d < band_size; ++d) {
+    auto const column = d - max_distance;  // the first row is the distance to the empty string
+    band[d] = (column >= 0 && column <= lengths.second) ? static_cast<int16_t>(column) : exceeded;
+  }
+
+  for (cudf::size_type row = 1; row <= lengths.first; ++row, ++itr_A) {
+    // the first column of the band moves by one character from the row after max_distance
+    if (row > max_distance + 1) ++itr_B;
+    auto itr          = itr_B;
+    auto const d_min  = std::max(0, max_distance - row);
+    auto const d_max  = std::min(band_size - 1, lengths.second - row + max_distance);
+    int16_t left      = exceeded;
+    int16_t row_value = exceeded;
+    for (cudf::size_type d = d_min; d <= d_max; ++d) {
+      int16_t value = static_cast<int16_t>(row);  // first column of the matrix
+      if (row + d > max_distance) {
+        auto const w = band[d] + static_cast<int16_t>(*itr_A != *itr);  // add 1 if different
+        auto const u = (d + 1 < band_size ? band[d + 1] : exceeded) + 1;
+        value        = static_cast<int16_t>(std::min(std::min(u, left + 1), w));
+        ++itr;
+      }
+      value     = std::min(value, exceeded);
+      band[d]   = value;
+      left      = value;
+      row_value = std::min(row_value, value);
+    }
+    // the diagonals past the last column are outside of the matrix
+    for (cudf::size_type d = d_max + 1; d < band_size; ++d) {
+      band[d] = exceeded;
+    }
+    if (row_value > max_distance) return exceeded;
+  }
+  return static_cast<int32_t>(band[lengths.second - lengths.first + max_distance]);
+}
+
+/**
+ * @brief Compute the thresholded Levenshtein distance for each string.
+ */
+struct bounded_edit_distance_fn {
+  cudf::column_device_view d_strings;  // computing these
+  cudf::column_device_view d_targets;  // against these
+  cudf::size_type max_distance;
+
+  __device__ int32_t operator()(cudf::size_type idx) const
+  {
+    auto d_str =
+      d_strings.is_null(idx) ? cudf::string_view{} : d_strings.element<cudf::string_view>(idx);
+    auto d_tgt = [&] __device__ {  // d_targets is also allowed to have only one entry
+      if (d_targets.is_null(idx)) return cudf::string_view{};
+      return d_targets.size() == 1 ? d_targets.element<cudf::string_view>(0)
+                                   : d_targets.element<cudf::string_view>(idx);
+    }();
+    return compute_bounded_distance(d_str, d_tgt, max_distance);
+  }
+};
+
+/**
+ * @brief Character ngrams of a strings column, sorted by their join keys.
+ *
+ * The join key of an ngram is its hash value followed by the number of identical ngrams
+ * before it in its string, so joining the keys of two strings matches each ngram at most
+ * as many times as it appears in both strings.
+ */
+struct sorted_ngrams {
+  rmm::device_uvector<uint64_t> keys;
+  rmm::device_uvector<cudf::size_type> rows;
+};
+
+/**
+ * @brief Returns the sorted join keys of the character ngrams of each non-null string.
+ */
+sorted_ngrams make_sorted_ngrams(cudf::column_device_view const& d_strings,
+                                 cudf::size_type width,
+                                 rmm::cuda_stream_view stream)
+{
+  auto const strings_count = d_strings.size();
+
+  // Ex. width=2: ["abab", "ab"] => ngram-counts = [3,1]; ngram-offsets = [0,3,4]
+  rmm::device_uvector<int32_t> ngram_offsets(strings_count + 1, stream);
+  auto d_ngram_offsets = ngram_offsets.data();
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+    d_ngram_offsets + 1,
+    [d_strings, width] __device__(cudf::size_type idx) {
+      if (d_strings.is_null(idx)) return 0;
+      auto const length = d_strings.element<cudf::string_view>(idx).length();
+      return length >= width ? length - width + 1 : 0;
+    },
+    thrust::plus<int32_t>());
+  int32_t const zero = 0;
+  ngram_offsets.set_element_async(0, zero, stream);
+  auto const total_ngrams = ngram_offsets.back_element(stream);
+
+  // Ex. keys = [(0,h("ab")), (0,h("ba")), (0,h("ab")), (1,h("ab"))]
+  rmm::device_uvector<uint64_t> row_keys(total_ngrams, stream);
+  rmm::device_uvector<cudf::size_type> rows(total_ngrams, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    [d_strings, width, d_ngram_offsets, d_keys = row_keys.data(), d_rows = rows.data()] __device__(
+      cudf::size_type idx) {
+      auto const count = d_ngram_offsets[idx + 1] - d_ngram_offsets[idx];
+      if (count == 0) return;
+      auto const d_str = d_strings.element<cudf::string_view>(idx);
+      auto begin       = d_str.begin();
+      auto end         = begin + width;
+      cudf::detail::MurmurHash3_32<cudf::string_view> const hasher{};
+      for (cudf::size_type ngram = 0; ngram < count; ++ngram, ++begin, ++end) {
+        auto const offset   = d_ngram_offsets[idx] + ngram;
+        auto const position = begin.byte_offset();
+        auto const hash =
+          hasher(cudf::string_view(d_str.data() + position, end.byte_offset() - position));
+        d_keys[offset] = (static_cast<uint64_t>(idx) << 32) | hash;
+        d_rows[offset] = idx;
+      }
+    });
+
+  // Ex. sorted keys = [(0,h("ab")), (0,h("ab")), (0,h("ba")), (1,h("ab"))]
+  //     => occurrences = [0, 1, 0, 0]
+  thrust::sort(rmm::exec_policy(stream), row_keys.begin(), row_keys.end());
+  rmm::device_uvector<uint32_t> occurrences(total_ngrams, stream);
+  thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                row_keys.begin(),
+                                row_keys.end(),
+                                thrust::make_constant_iterator<uint32_t>(1),
+                                occurrences.begin());
+
+  // Ex. join keys = [(h("ab"),0), (h("ab"),0), (h("ab"),1), (h("ba"),0)]; rows = [0,1,0,0]
+  rmm::device_uvector<uint64_t> keys(total_ngrams, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    row_keys.begin(),
+                    row_keys.end(),
+                    occurrences.begin(),
+                    keys.begin(),
+                    [] __device__(uint64_t row_key, uint32_t occurrence) {
+                      return (row_key << 32) | occurrence;
+                    });
+  thrust::transform(rmm::exec_policy(stream),
+                    row_keys.begin(),
+                    row_keys.end(),
+                    rows.begin(),
+                    [] __device__(uint64_t row_key) {
+                      return static_cast<cudf::size_type>(row_key >> 32);
+                    });
+  thrust::sort_by_key(rmm::exec_policy(stream), keys.begin(), keys.end(), rows.begin());
+  return sorted_ngrams{std::move(keys), std::move(rows)};
+}
+
+/**
+ * @brief Returns the number of characters of each string, or -1 for the null strings.
+ */
+rmm::device_uvector<cudf::size_type> string_lengths(cudf::column_device_view const& d_strings,
+                                                    rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<cudf::size_type> lengths(d_strings.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(d_strings.size()),
+                    lengths.begin(),
+                    [d_strings] __device__(cudf::size_type idx) {
+                      return d_strings.is_null(idx)
+                               ? -1
+                               : d_strings.element<cudf::string_view>(idx).length();
+                    });
+  return lengths;
+}
+
+/**
+ * @brief Returns the rows of the non-null strings with fewer than `short_length` characters.
+ */
+rmm::device_uvector<cudf::size_type> short_rows(cudf::size_type const* d_lengths,
+                                                cudf::size_type count,
+                                                cudf::size_type short_length,
+                                                rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<cudf::size_type> rows(count, stream);
+  auto const end = thrust::copy_if(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(count),
+                                   rows.begin(),
+                                   [d_lengths, short_length] __device__(cudf::size_type idx) {
+                                     return d_lengths[idx] >= 0 && d_lengths[idx] < short_length;
+                                   });
+  rows.resize(thrust::distance(rows.begin(), end), stream);
+  return rows;
+}
+
+/**
+ * @brief Makes the key of a pair of left and right rows.
+ */
+__device__ inline uint64_t make_pair_key(cudf::size_type left, cudf::size_type right)
+{
+  return (static_cast<uint64_t>(left) << 32) | static_cast<uint32_t>(right);
+}
+
+/**
+ * @brief Returns whether a pair of rows found by joining their ngrams can be within
+ * `max_distance` edits.
+ *
+ * Each edit changes at most `ngram_width` ngrams, so two strings within `max_distance` edits
+ * share at least `max(lengths) - ngram_width + 1 - max_distance * ngram_width` ngrams.
+ * The pairs of strings for which this bound is not positive are not handled here.
+ */
+struct join_candidate_fn {
+  cudf::size_type const* d_left_lengths;
+  cudf::size_type const* d_right_lengths;
+  cudf::size_type max_distance;
+  cudf::size_type ngram_width;
+
+  __device__ bool operator()(thrust::tuple<uint64_t, cudf::size_type> const& pair) const
+  {
+    auto const key       = thrust::get<0>(pair);
+    auto const left_len  = d_left_lengths[key >> 32];
+    auto const right_len = d_right_lengths[key & 0xffffffff];
+    auto const bound =
+      std::max(left_len, right_len) - ngram_width + 1 - max_distance * ngram_width;
+    return std::abs(left_len - right_len) <= max_distance && bound > 0 &&
+           thrust::get<1>(pair) >= bound;
+  }
+};
+
 }  // namespace
 
 /**
@@ -291,6 +563,219 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
                                  mr);
 }
 
+/**
+ * @copydoc nvtext::edit_distance(cudf::strings_column_view const&,cudf::strings_column_view
+ * const&,cudf::size_type,rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            cudf::size_type max_distance,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_distance >= 0 && max_distance <= max_threshold,
+               "max_distance must be between 0 and 127");
+  cudf::size_type strings_count = strings.size();
+  if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::INT32});
+  if (targets.size() > 1)
+    CUDF_EXPECTS(strings_count == targets.size(), "targets.size() must equal strings.size()");
+
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto targets_column = cudf::column_device_view::create(targets.parent(), stream);
+
+  // no compute buffer is needed since the band of each computation fits in local memory
+  auto results = cudf::make_fixed_width_column(cudf::data_type{cudf::type_id::INT32},
+                                               strings_count,
+                                               rmm::device_buffer{0, stream, mr},
+                                               0,
+                                               stream,
+                                               mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                    results->mutable_view().data<int32_t>(),
+                    bounded_edit_distance_fn{*strings_column, *targets_column, max_distance});
+  return results;
+}
+
+/**
+ * @copydoc nvtext::edit_distance_join
+ */
+std::unique_ptr<cudf::table> edit_distance_join(cudf::strings_column_view const& left,
+                                                cudf::strings_column_view const& right,
+                                                cudf::size_type max_distance,
+                                                cudf::size_type ngram_width,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_distance >= 0 && max_distance <= max_threshold,
+               "max_distance must be between 0 and 127");
+  CUDF_EXPECTS(ngram_width > 0, "Parameter ngram_width must be greater than 0");
+
+  auto left_column  = cudf::column_device_view::create(left.parent(), stream);
+  auto right_column = cudf::column_device_view::create(right.parent(), stream);
+  auto d_left       = *left_column;
+  auto d_right      = *right_column;
+
+  auto const left_lengths  = string_lengths(d_left, stream);
+  auto const right_lengths = string_lengths(d_right, stream);
+  auto const d_left_len    = left_lengths.data();
+  auto const d_right_len   = right_lengths.data();
+
+  // pairs with a positive bound are found by joining the ngrams of the two columns and the
+  // others, where both strings are short, are compared with each other
+  auto const short_length = ngram_width * (max_distance + 1);
+
+  // join the ngrams of the two columns: each left ngram matches the range of equal right keys
+  auto const left_ngrams  = make_sorted_ngrams(d_left, ngram_width, stream);
+  auto const right_ngrams = make_sorted_ngrams(d_right, ngram_width, stream);
+  auto const left_count   = static_cast<cudf::size_type>(left_ngrams.keys.size());
+  rmm::device_uvector<int64_t> match_offsets(left_count + 1, stream);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(left_count),
+    match_offsets.begin() + 1,
+    [d_keys      = left_ngrams.keys.data(),
+     d_right     = right_ngrams.keys.data(),
+     right_count = right_ngrams.keys.size()] __device__(cudf::size_type idx) {
+      auto const range =
+        thrust::equal_range(thrust::seq, d_right, d_right + right_count, d_keys[idx]);
+      return static_cast<int64_t>(thrust::distance(range.first, range.second));
+    },
+    thrust::plus<int64_t>());
+  match_offsets.set_element_async(0, int64_t{0}, stream);
+  auto const total_matches = match_offsets.back_element(stream);
+
+  // Ex. left ngrams of row 0 match right ngrams of rows 2, 2 and 5 => keys (0,2), (0,2), (0,5)
+  rmm::device_uvector<uint64_t> match_keys(total_matches, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<int64_t>(0),
+    total_matches,
+    [d_offsets    = match_offsets.data(),
+     offsets_end  = match_offsets.data() + left_count + 1,
+     d_keys       = left_ngrams.keys.data(),
+     d_left_rows  = left_ngrams.rows.data(),
+     d_right      = right_ngrams.keys.data(),
+     d_right_rows = right_ngrams.rows.data(),
+     right_count  = right_ngrams.keys.size(),
+     d_matches    = match_keys.data()] __device__(int64_t idx) {
+      auto const ngram = thrust::distance(
+        d_offsets, thrust::upper_bound(thrust::seq, d_offsets, offsets_end, idx) - 1);
+      auto const first =
+        thrust::lower_bound(thrust::seq, d_right, d_right + right_count, d_keys[ngram]);
+      auto const right_ngram = thrust::distance(d_right, first) + (idx - d_offsets[ngram]);
+      d_matches[idx]         = make_pair_key(d_left_rows[ngram], d_right_rows[right_ngram]);
+    });
+
+  // count the shared ngrams of each pair and keep the pairs sharing at least `bound`
+  thrust::sort(rmm::exec_policy(stream), match_keys.begin(), match_keys.end());
+  rmm::device_uvector<uint64_t> pair_keys(total_matches, stream);
+  rmm::device_uvector<cudf::size_type> shared_counts(total_matches, stream);
+  auto const pairs_end = thrust::reduce_by_key(rmm::exec_policy(stream),
+                                               match_keys.begin(),
+                                               match_keys.end(),
+                                               thrust::make_constant_iterator<cudf::size_type>(1),
+                                               pair_keys.begin(),
+                                               shared_counts.begin());
+  auto const pairs_count = thrust::distance(pair_keys.begin(), pairs_end.first);
+
+  rmm::device_uvector<uint64_t> candidates(pairs_count, stream);
+  auto const joined_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    pair_keys.begin(),
+    pair_keys.begin() + pairs_count,
+    thrust::make_zip_iterator(thrust::make_tuple(pair_keys.begin(), shared_counts.begin())),
+    candidates.begin(),
+    join_candidate_fn{d_left_len, d_right_len, max_distance, ngram_width});
+  auto const joined_count = thrust::distance(candidates.begin(), joined_end);
+
+  // the short strings may share no ngram and are paired with all the short strings of the other
+  // column; their bound is never positive so none of these pairs came from the join
+  auto const left_short  = short_rows(d_left_len, left.size(), short_length, stream);
+  auto const right_short = short_rows(d_right_len, right.size(), short_length, stream);
+  auto const short_pairs = static_cast<int64_t>(left_short.size()) * right_short.size();
+  rmm::device_uvector<uint64_t> short_candidates(short_pairs, stream);
+  auto const short_keys = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<int64_t>(0),
+    [d_left_short  = left_short.data(),
+     d_right_short = right_short.data(),
+     right_count   = static_cast<int64_t>(right_short.size())] __device__(int64_t idx) {
+      return make_pair_key(d_left_short[idx / right_count], d_right_short[idx % right_count]);
+    });
+  auto const short_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    short_keys,
+    short_keys + short_pairs,
+    short_candidates.begin(),
+    [d_left_len, d_right_len, max_distance] __device__(uint64_t key) {
+      return std::abs(d_left_len[key >> 32] - d_right_len[key & 0xffffffff]) <= max_distance;
+    });
+  auto const short_count = thrust::distance(short_candidates.begin(), short_end);
+
+  // verify every candidate and keep the pairs within max_distance in (left, right) order
+  candidates.resize(joined_count + short_count, stream);
+  thrust::copy(rmm::exec_policy(stream),
+               short_candidates.begin(),
+               short_candidates.begin() + short_count,
+               candidates.begin() + joined_count);
+  thrust::sort(rmm::exec_policy(stream), candidates.begin(), candidates.end());
+  rmm::device_uvector<int32_t> distances(candidates.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    candidates.begin(),
+                    candidates.end(),
+                    distances.begin(),
+                    [d_left, d_right, max_distance] __device__(uint64_t key) {
+                      return compute_bounded_distance(
+                        d_left.element<cudf::string_view>(key >> 32),
+                        d_right.element<cudf::string_view>(key & 0xffffffff),
+                        max_distance);
+                    });
+  auto const matches_count = static_cast<cudf::size_type>(
+    thrust::count_if(rmm::exec_policy(stream),
+                     distances.begin(),
+                     distances.end(),
+                     [max_distance] __device__(int32_t distance) {
+                       return distance <= max_distance;
+                     }));
+
+  auto make_indices = [&] {
+    return cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                     matches_count,
+                                     cudf::mask_state::UNALLOCATED,
+                                     stream,
+                                     mr);
+  };
+  auto left_indices  = make_indices();
+  auto right_indices = make_indices();
+  auto distances_col = make_indices();
+  auto const output  = thrust::make_zip_iterator(
+    thrust::make_tuple(left_indices->mutable_view().begin<int32_t>(),
+                      right_indices->mutable_view().begin<int32_t>(),
+                      distances_col->mutable_view().begin<int32_t>()));
+  auto const matches = thrust::make_transform_iterator(
+    thrust::make_zip_iterator(thrust::make_tuple(candidates.begin(), distances.begin())),
+    [] __device__(thrust::tuple<uint64_t, int32_t> const& pair) {
+      auto const key = thrust::get<0>(pair);
+      return thrust::make_tuple(static_cast<int32_t>(key >> 32),
+                                static_cast<int32_t>(key & 0xffffffff),
+                                thrust::get<1>(pair));
+    });
+  thrust::copy_if(rmm::exec_policy(stream),
+                  matches,
+                  matches + candidates.size(),
+                  distances.begin(),
+                  output,
+                  [max_distance] __device__(int32_t distance) { return distance <= max_distance; });
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(std::move(left_indices));
+  columns.push_back(std::move(right_indices));
+  columns.push_back(std::move(distances_col));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
 }  // namespace detail
 
 // external APIs
@@ -316,4 +801,31 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
   return detail::edit_distance_matrix(strings, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc nvtext::edit_distance(cudf::strings_column_view const&,cudf::strings_column_view
+ * const&,cudf::size_type,rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            cudf::size_type max_distance,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance(strings, targets, max_distance, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc nvtext::edit_distance_join
+ */
+std::unique_ptr<cudf::table> edit_distance_join(cudf::strings_column_view const& left,
+                                                cudf::strings_column_view const& right,
+                                                cudf::size_type max_distance,
+                                                cudf::size_type ngram_width,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance_join(
+    left, right, max_distance, ngram_width, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace nvtext
@@ -20,7 +20,9 @@
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -186,6 +188,35 @@ struct character_ngram_generator_fn {
   }
 };
 
+/**
+ * @brief Hashes the character ngrams of each string.
+ *
+ * The hash values of string `idx` are written to `d_hashes` starting
+ * at `d_ngram_offsets[idx]`.
+ */
+struct character_ngram_hasher_fn {
+  cudf::column_device_view const d_strings;
+  cudf::size_type ngrams;
+  uint32_t seed;
+  int32_t const* d_ngram_offsets;
+  uint32_t* d_hashes;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const d_str       = d_strings.element<cudf::string_view>(idx);
+    auto const ngram_count = d_ngram_offsets[idx + 1] - d_ngram_offsets[idx];
+    auto d_output          = d_hashes + d_ngram_offsets[idx];
+    MurmurHash3_32<cudf::string_view> const hasher(seed);
+    auto itr = d_str.begin();
+    auto end = itr + ngrams;
+    for (cudf::size_type n = 0; n < ngram_count; ++n, ++itr, ++end) {
+      auto const begin = itr.byte_offset();
+      *d_output++      = hasher(cudf::string_view(d_str.data() + begin, end.byte_offset() - begin));
+    }
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_view const& strings,
@@ -260,6 +291,67 @@ std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_vie
                                    mr);
 }
 
+std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    uint32_t seed,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+
+  auto const strings_count = strings.size();
+  if (strings_count == 0)  // if no strings, return an empty column
+    return cudf::make_empty_column(cudf::data_type{cudf::type_id::LIST});
+
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+
+  // the ngram offsets of each string are the offsets of the output lists
+  auto offsets_column = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                  strings_count + 1,
+                                                  cudf::mask_state::UNALLOCATED,
+                                                  stream,
+                                                  mr);
+  auto d_offsets      = offsets_column->mutable_view().data<int32_t>();
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
+    d_offsets,
+    [d_strings, strings_count, ngrams] __device__(auto idx) {
+      if (d_strings.is_null(idx) || (idx == strings_count)) return 0;
+      auto const length = d_strings.element<cudf::string_view>(idx).length();
+      return std::max(0, static_cast<int32_t>(length + 1 - ngrams));
+    },
+    cudf::size_type{0},
+    thrust::plus<cudf::size_type>());
+  auto const total_ngrams =
+    cudf::detail::get_value<int32_t>(offsets_column->view(), strings_count, stream);
+
+  // hash the ngrams directly from the strings
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          total_ngrams,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     character_ngram_hasher_fn{d_strings,
+                                               ngrams,
+                                               seed,
+                                               d_offsets,
+                                               hashes->mutable_view().data<uint32_t>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets_column),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_view const& strings,
@@ -270,4 +362,13 @@ std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_vie
   return detail::generate_character_ngrams(strings, ngrams, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    uint32_t seed,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_character_ngrams(strings, ngrams, seed, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace nvtext
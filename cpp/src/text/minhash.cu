@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nvtext/minhash.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform_scan.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Computes the minhash value of a string for a seed.
+ *
+ * Each thread computes the value of one seed of one string, from all the
+ * character ngrams of the string.
+ */
+struct minhash_fn {
+  cudf::column_device_view const d_strings;
+  hash_value_type const* d_seeds;
+  cudf::size_type seeds_size;
+  cudf::size_type width;
+  hash_value_type* d_hashes;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const row      = idx / seeds_size;
+    auto const seed_idx = idx % seeds_size;
+    auto const d_str =
+      d_strings.is_null(row) ? cudf::string_view{} : d_strings.element<cudf::string_view>(row);
+    MurmurHash3_32<cudf::string_view> const hasher(d_seeds[seed_idx]);
+
+    // strings shorter than width are hashed as a single ngram
+    auto const length = d_str.length();
+    if (length <= width) {
+      d_hashes[idx] = hasher(d_str);
+      return;
+    }
+
+    auto const ngrams = length - width + 1;
+    auto mh           = std::numeric_limits<hash_value_type>::max();
+    auto begin        = d_str.begin();
+    auto end          = begin + width;
+    for (cudf::size_type ngram = 0; ngram < ngrams; ++ngram, ++begin, ++end) {
+      auto const offset = begin.byte_offset();
+      cudf::string_view const d_ngram(d_str.data() + offset, end.byte_offset() - offset);
+      mh = min(mh, hasher(d_ngram));
+    }
+    d_hashes[idx] = mh;
+  }
+};
+
+/**
+ * @brief Computes the band values of a signature.
+ *
+ * Each band is hashed starting from its position, so equal values in different
+ * bands do not produce the same band value.
+ */
+struct minhash_bands_fn {
+  cudf::size_type const* d_offsets;  // of the signatures, into d_values
+  hash_value_type const* d_values;
+  cudf::size_type const* d_band_offsets;
+  cudf::size_type rows_per_band;
+  hash_value_type* d_bands;
+
+  __device__ void operator()(cudf::size_type row) const
+  {
+    auto const signature = d_values + d_offsets[row];
+    auto const bands     = d_band_offsets[row + 1] - d_band_offsets[row];
+    auto const d_output  = d_bands + d_band_offsets[row];
+    for (cudf::size_type band = 0; band < bands; ++band) {
+      auto hash = static_cast<hash_value_type>(band);
+      for (cudf::size_type idx = 0; idx < rows_per_band; ++idx) {
+        hash = MurmurHash3_32<hash_value_type>{hash}(signature[band * rows_per_band + idx]);
+      }
+      d_output[band] = hash;
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(seeds.type().id() == cudf::type_id::UINT32 && !seeds.has_nulls(),
+               "seeds must be a UINT32 column without nulls");
+  CUDF_EXPECTS(!seeds.is_empty(), "seeds must not be empty");
+  CUDF_EXPECTS(width >= 2, "width must be at least 2");
+
+  auto const strings_count = strings.size();
+  auto const seeds_size    = seeds.size();
+  CUDF_EXPECTS(static_cast<int64_t>(strings_count) * seeds_size <
+                 static_cast<int64_t>(std::numeric_limits<cudf::size_type>::max()),
+               "number of signature values exceeds the column size limit");
+
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          strings_count * seeds_size,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  auto d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count * seeds_size,
+                     minhash_fn{*d_strings,
+                                seeds.data<hash_value_type>(),
+                                seeds_size,
+                                width,
+                                hashes->mutable_view().data<hash_value_type>()});
+
+  // each row has a value per seed
+  auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           strings_count + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_offsets = offsets->mutable_view().data<cudf::size_type>();
+  thrust::sequence(
+    rmm::exec_policy(stream), d_offsets, d_offsets + strings_count + 1, 0, seeds_size);
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+std::unique_ptr<cudf::column> minhash_bands(cudf::lists_column_view const& signatures,
+                                            cudf::size_type rows_per_band,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(rows_per_band >= 1, "rows_per_band must be at least 1");
+  if (signatures.is_empty()) { return cudf::empty_like(signatures.parent()); }
+  CUDF_EXPECTS(signatures.child().type().id() == cudf::type_id::UINT32,
+               "signatures must be a lists column of UINT32 values");
+
+  auto const rows = signatures.size();
+  auto offsets    = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           rows + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_band_offsets = offsets->mutable_view().data<cudf::size_type>();
+  auto d_offsets      = signatures.offsets_begin();
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(rows + 1),
+    d_band_offsets,
+    [d_offsets, rows, rows_per_band] __device__(cudf::size_type row) {
+      return row < rows ? (d_offsets[row + 1] - d_offsets[row]) / rows_per_band : 0;
+    },
+    cudf::size_type{0},
+    thrust::plus<cudf::size_type>());
+  auto const bands_count = cudf::detail::get_value<cudf::size_type>(offsets->view(), rows, stream);
+
+  auto bands = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                         bands_count,
+                                         cudf::mask_state::UNALLOCATED,
+                                         stream,
+                                         mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     rows,
+                     minhash_bands_fn{d_offsets,
+                                      signatures.child().data<hash_value_type>(),
+                                      d_band_offsets,
+                                      rows_per_band,
+                                      bands->mutable_view().data<hash_value_type>()});
+
+  return cudf::make_lists_column(rows,
+                                 std::move(offsets),
+                                 std::move(bands),
+                                 signatures.null_count(),
+                                 cudf::detail::copy_bitmask(signatures.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, seeds, width, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<cudf::column> minhash_bands(cudf::lists_column_view const& signatures,
+                                            cudf::size_type rows_per_band,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_bands(signatures, rows_per_band, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace nvtext
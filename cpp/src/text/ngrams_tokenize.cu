@@ -22,7 +22,10 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -126,6 +129,116 @@ struct ngram_builder_fn {
   }
 };
 
+/**
+ * @brief Computes the MurmurHash3_32 hash value of a string appended piece by piece.
+ *
+ * The value is the one of `MurmurHash3_32<string_view>` for the concatenation of
+ * the pieces, so an ngram is hashed from its tokens and separators without copying them.
+ */
+struct murmur3_32_accumulator {
+  MurmurHash3_32<uint32_t> murmur{};
+  uint32_t h1;
+  uint32_t block{0};  // bytes of the current 4-byte block
+  cudf::size_type length{0};
+
+  __device__ murmur3_32_accumulator(uint32_t seed) : h1{seed} {}
+
+  __device__ uint32_t mix(uint32_t k1) const
+  {
+    k1 *= 0xcc9e2d51;
+    k1 = murmur.rotl32(k1, 15);
+    return k1 * 0x1b873593;
+  }
+
+  __device__ void append(cudf::string_view const& d_str)
+  {
+    auto const bytes = reinterpret_cast<uint8_t const*>(d_str.data());
+    for (cudf::size_type i = 0; i < d_str.size_bytes(); ++i) {
+      block |= static_cast<uint32_t>(bytes[i]) << (8 * (length & 3));
+      if ((++length & 3) == 0) {
+        h1 ^= mix(block);
+        h1    = murmur.rotl32(h1, 13);
+        h1    = h1 * 5 + 0xe6546b64;
+        block = 0;
+      }
+    }
+  }
+
+  __device__ uint32_t hash() const
+  {
+    auto const h = (length & 3) ? h1 ^ mix(block) : h1;  // the tail bytes
+    return murmur.fmix32(h ^ length);
+  }
+};
+
+/**
+ * @brief Hashes the ngrams of tokens of each string.
+ *
+ * The hash values of string `idx` are written to `d_hashes` starting
+ * at `d_ngram_offsets[idx]`.
+ */
+struct ngram_hasher_fn {
+  cudf::column_device_view const d_strings;  // strings to generate ngrams from
+  cudf::string_view const d_separator;       // separator to hash between the tokens
+  cudf::size_type ngrams;                    // ngram number to generate (2=bi-gram, 3=tri-gram)
+  uint32_t seed;                             // seed of the hash function
+  int32_t const* d_token_offsets;            // offsets for token position for each string
+  position_pair const* d_token_positions;    // token positions for each string
+  int32_t const* d_ngram_offsets;            // offsets of each string's ngram hash values
+  uint32_t* d_hashes;                        // write ngram hash values to here
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return;
+    cudf::string_view d_str = d_strings.element<cudf::string_view>(idx);
+    auto token_positions    = d_token_positions + d_token_offsets[idx];
+    auto token_count        = d_token_offsets[idx + 1] - d_token_offsets[idx];
+    auto d_output           = d_hashes + d_ngram_offsets[idx];
+    for (cudf::size_type token_index = (ngrams - 1); token_index < token_count; ++token_index) {
+      murmur3_32_accumulator hasher(seed);
+      for (cudf::size_type n = (ngrams - 1); n >= 0; --n) {
+        position_pair item = token_positions[token_index - n];
+        hasher.append(cudf::string_view(d_str.data() + item.first, item.second - item.first));
+        if (n > 0) hasher.append(d_separator);
+      }
+      *d_output++ = hasher.hash();
+    }
+  }
+};
+
+/**
+ * @brief Returns the token offsets of each string and the byte positions of the tokens.
+ *
+ * Ex. ["a bb ccc","dd e"] => token-offsets = [0,3,5];
+ *     start/end pairs: [(0,1),(2,4),(5,8), (0,2),(3,4)]
+ */
+std::pair<rmm::device_uvector<int32_t>, rmm::device_uvector<position_pair>> tokenize_positions(
+  cudf::column_device_view const& d_strings,
+  cudf::string_view const& d_delimiter,
+  rmm::cuda_stream_view stream)
+{
+  auto const strings_count = d_strings.size();
+  rmm::device_uvector<int32_t> token_offsets(strings_count + 1, stream);
+  auto d_token_offsets = token_offsets.data();
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                                   d_token_offsets + 1,
+                                   strings_tokenizer{d_strings, d_delimiter},
+                                   thrust::plus<int32_t>());
+  int32_t const zero = 0;
+  token_offsets.set_element_async(0, zero, stream);
+  auto const total_tokens = token_offsets.back_element(stream);
+
+  rmm::device_uvector<position_pair> token_positions(total_tokens, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    string_tokens_positions_fn{d_strings, d_delimiter, d_token_offsets, token_positions.data()});
+  return std::make_pair(std::move(token_offsets), std::move(token_positions));
+}
+
 }  // namespace
 
 // detail APIs
@@ -157,27 +270,12 @@ std::unique_ptr<cudf::column> ngrams_tokenize(
 
   // first, get the number of tokens per string to get the token-offsets
   // Ex. token-counts = [3,2]; token-offsets = [0,3,5]
-  rmm::device_uvector<int32_t> token_offsets(strings_count + 1, stream);
-  auto d_token_offsets = token_offsets.data();
-  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
-                                   thrust::make_counting_iterator<cudf::size_type>(0),
-                                   thrust::make_counting_iterator<cudf::size_type>(strings_count),
-                                   d_token_offsets + 1,
-                                   strings_tokenizer{d_strings, d_delimiter},
-                                   thrust::plus<int32_t>());
-  int32_t const zero = 0;
-  token_offsets.set_element_async(0, zero, stream);
-  auto const total_tokens = token_offsets.back_element(stream);  // Ex. 5 tokens
-
-  // get the token positions (in bytes) per string
+  // and the token positions (in bytes) per string
   // Ex. start/end pairs: [(0,1),(2,4),(5,8), (0,2),(3,4)]
-  rmm::device_uvector<position_pair> token_positions(total_tokens, stream);
+  auto [token_offsets, token_positions] = tokenize_positions(d_strings, d_delimiter, stream);
+  auto d_token_offsets   = token_offsets.data();
   auto d_token_positions = token_positions.data();
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator<cudf::size_type>(0),
-    strings_count,
-    string_tokens_positions_fn{d_strings, d_delimiter, d_token_offsets, d_token_positions});
+  int32_t const zero     = 0;
 
   // compute the number of ngrams per string to get the total number of ngrams to generate
   // Ex. ngram-counts = [2,1]; ngram-offsets = [0,2,3]; total = 3 bigrams
@@ -253,6 +351,78 @@ std::unique_ptr<cudf::column> ngrams_tokenize(
                              mr);
 }
 
+std::unique_ptr<cudf::column> hash_ngrams_tokenize(cudf::strings_column_view const& strings,
+                                                   cudf::size_type ngrams,
+                                                   cudf::string_scalar const& delimiter,
+                                                   cudf::string_scalar const& separator,
+                                                   uint32_t seed,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
+  CUDF_EXPECTS(separator.is_valid(), "Parameter separator must be valid");
+  cudf::string_view d_separator(separator.data(), separator.size());
+  CUDF_EXPECTS(ngrams >= 1, "Parameter ngrams should be an integer value of 1 or greater");
+
+  auto strings_count = strings.size();
+  if (strings.is_empty()) return cudf::make_empty_column(cudf::data_type{cudf::type_id::LIST});
+
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+
+  auto [token_offsets, token_positions] = tokenize_positions(d_strings, d_delimiter, stream);
+  auto d_token_offsets = token_offsets.data();
+
+  // the ngram offsets of each string are the offsets of the output lists
+  auto offsets_column = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                  strings_count + 1,
+                                                  cudf::mask_state::UNALLOCATED,
+                                                  stream,
+                                                  mr);
+  auto d_ngram_offsets = offsets_column->mutable_view().data<int32_t>();
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
+    d_ngram_offsets,
+    [d_token_offsets, strings_count, ngrams] __device__(cudf::size_type idx) {
+      if (idx == strings_count) return 0;
+      auto token_count = d_token_offsets[idx + 1] - d_token_offsets[idx];
+      return (token_count >= ngrams) ? token_count - ngrams + 1 : 0;
+    },
+    int32_t{0},
+    thrust::plus<int32_t>());
+  auto const total_ngrams =
+    cudf::detail::get_value<int32_t>(offsets_column->view(), strings_count, stream);
+
+  // hash the ngrams directly from the tokens of the strings
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          total_ngrams,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     ngram_hasher_fn{d_strings,
+                                     d_separator,
+                                     ngrams,
+                                     seed,
+                                     d_token_offsets,
+                                     token_positions.data(),
+                                     d_ngram_offsets,
+                                     hashes->mutable_view().data<uint32_t>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets_column),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -268,4 +438,16 @@ std::unique_ptr<cudf::column> ngrams_tokenize(cudf::strings_column_view const& s
     strings, ngrams, delimiter, separator, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::column> hash_ngrams_tokenize(cudf::strings_column_view const& strings,
+                                                   cudf::size_type ngrams,
+                                                   cudf::string_scalar const& delimiter,
+                                                   cudf::string_scalar const& separator,
+                                                   uint32_t seed,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_ngrams_tokenize(
+    strings, ngrams, delimiter, separator, seed, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace nvtext
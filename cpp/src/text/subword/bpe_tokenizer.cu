@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <text/subword/detail/bpe_tokenizer.hpp>
+
+#include <nvtext/bpe_tokenize.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Rank of the symbol pairs that are not in the merges table.
+ */
+constexpr int32_t no_merge = std::numeric_limits<int32_t>::max();
+
+/**
+ * @brief Returns true for the ASCII whitespace characters separating the words.
+ */
+__device__ inline bool is_whitespace(char chr)
+{
+  return chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r' || chr == '\f' || chr == '\v';
+}
+
+/**
+ * @brief Merges the symbols of each word of a string.
+ *
+ * Each byte of `d_symbol_ends` that starts a symbol holds the position of the end
+ * of that symbol, and -1 otherwise. The symbols start as the characters of the words
+ * and the adjacent pair with the lowest rank in the merges table is merged until no
+ * pair of the word is in the table. The number of final symbols of each string is
+ * written to `d_token_counts`.
+ */
+struct bpe_merge_fn {
+  char const* d_chars;
+  uint32_t const* d_offsets;
+  cudf::column_device_view const d_merge_pairs;
+  int32_t const* d_merge_ranks;
+  int32_t* d_symbol_ends;
+  uint32_t* d_token_counts;
+
+  /**
+   * @brief Compares a merges table entry with the pair of symbols `[left, right)` and
+   *        `[right, end)` separated by a space.
+   */
+  __device__ int compare_pair(cudf::string_view const& entry,
+                              int32_t left,
+                              int32_t right,
+                              int32_t end) const
+  {
+    auto const size     = end - left + 1;
+    auto const data     = reinterpret_cast<unsigned char const*>(entry.data());
+    auto const pair     = reinterpret_cast<unsigned char const*>(d_chars);
+    cudf::size_type idx = 0;
+    for (; idx < entry.size_bytes() && idx < size; ++idx) {
+      auto const pos = left + idx;
+      auto const chr = pos < right ? pair[pos] : (pos == right ? ' ' : pair[pos - 1]);
+      if (data[idx] != chr) { return static_cast<int>(data[idx]) - static_cast<int>(chr); }
+    }
+    if (idx < entry.size_bytes()) { return 1; }
+    if (idx < size) { return -1; }
+    return 0;
+  }
+
+  __device__ int32_t merge_rank(int32_t left, int32_t right, int32_t end) const
+  {
+    cudf::size_type lo = 0;
+    cudf::size_type hi = d_merge_pairs.size();
+    while (lo < hi) {
+      auto const mid   = lo + (hi - lo) / 2;
+      auto const entry = d_merge_pairs.element<cudf::string_view>(mid);
+      auto const rc    = compare_pair(entry, left, right, end);
+      if (rc == 0) { return d_merge_ranks[mid]; }
+      if (rc < 0) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return no_merge;
+  }
+
+  __device__ void merge_word(int32_t begin, int32_t end) const
+  {
+    while (true) {
+      auto best      = int32_t{-1};
+      auto best_rank = no_merge;
+      // the leftmost pair wins a tie
+      for (auto left = begin; d_symbol_ends[left] < end; left = d_symbol_ends[left]) {
+        auto const right = d_symbol_ends[left];
+        auto const rank  = merge_rank(left, right, d_symbol_ends[right]);
+        if (rank < best_rank) {
+          best      = left;
+          best_rank = rank;
+        }
+      }
+      if (best < 0) { return; }
+      auto const right     = d_symbol_ends[best];
+      d_symbol_ends[best]  = d_symbol_ends[right];
+      d_symbol_ends[right] = -1;
+    }
+  }
+
+  __device__ void operator()(uint32_t idx) const
+  {
+    auto const begin = static_cast<int32_t>(d_offsets[idx] - d_offsets[0]);
+    auto const end   = static_cast<int32_t>(d_offsets[idx + 1] - d_offsets[0]);
+
+    // the initial symbols are the characters of the words
+    for (auto pos = begin; pos < end; ++pos) {
+      auto const chr = d_chars[pos];
+      if (is_whitespace(chr) ||
+          cudf::strings::detail::bytes_in_utf8_byte(static_cast<uint8_t>(chr)) == 0) {
+        d_symbol_ends[pos] = -1;
+        continue;
+      }
+      auto next = pos + 1;
+      while (next < end &&
+             cudf::strings::detail::bytes_in_utf8_byte(static_cast<uint8_t>(d_chars[next])) == 0) {
+        ++next;
+      }
+      d_symbol_ends[pos] = next;
+    }
+
+    auto pos = begin;
+    while (pos < end) {
+      if (d_symbol_ends[pos] < 0) {
+        ++pos;
+        continue;
+      }
+      auto word_end = pos;
+      while (word_end < end && !is_whitespace(d_chars[word_end])) { ++word_end; }
+      merge_word(pos, word_end);
+      pos = word_end;
+    }
+
+    uint32_t count = 0;
+    for (auto byte = begin; byte < end; ++byte) { count += d_symbol_ends[byte] >= 0; }
+    d_token_counts[idx] = count;
+  }
+};
+
+/**
+ * @brief Writes the vocabulary ids of the final symbols of each string.
+ */
+struct bpe_token_ids_fn {
+  char const* d_chars;
+  uint32_t const* d_offsets;
+  int32_t const* d_symbol_ends;
+  cudf::column_device_view const d_tokens;
+  uint32_t const* d_token_ids;
+  uint32_t unknown_token_id;
+  uint32_t const* d_token_offsets;
+  uint32_t* d_output;
+
+  __device__ uint32_t token_id(cudf::string_view const& d_symbol) const
+  {
+    cudf::size_type lo = 0;
+    cudf::size_type hi = d_tokens.size();
+    while (lo < hi) {
+      auto const mid = lo + (hi - lo) / 2;
+      auto const rc  = d_tokens.element<cudf::string_view>(mid).compare(d_symbol);
+      if (rc == 0) { return d_token_ids[mid]; }
+      if (rc < 0) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return unknown_token_id;
+  }
+
+  __device__ void operator()(uint32_t idx) const
+  {
+    auto const begin = static_cast<int32_t>(d_offsets[idx] - d_offsets[0]);
+    auto const end   = static_cast<int32_t>(d_offsets[idx + 1] - d_offsets[0]);
+    auto d_ids       = d_output + d_token_offsets[idx];
+    for (auto pos = begin; pos < end; ++pos) {
+      auto const symbol_end = d_symbol_ends[pos];
+      if (symbol_end < 0) { continue; }
+      *d_ids++ = token_id(cudf::string_view(d_chars + pos, symbol_end - pos));
+    }
+  }
+};
+
+/**
+ * @brief Creates a strings column from host strings.
+ */
+std::unique_ptr<cudf::column> make_host_strings_column(std::vector<std::string> const& strings,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  std::vector<char> chars;
+  std::vector<cudf::size_type> offsets(1, 0);
+  for (auto const& str : strings) {
+    chars.insert(chars.end(), str.begin(), str.end());
+    offsets.push_back(static_cast<cudf::size_type>(chars.size()));
+  }
+  auto const d_chars   = cudf::detail::make_device_uvector_sync(chars, stream);
+  auto const d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream);
+  return cudf::make_strings_column(d_chars, d_offsets, {}, 0, stream, mr);
+}
+
+/**
+ * @brief Sorts the strings for searching on the device, keeping the first value of
+ *        each duplicate string.
+ *
+ * The default order of `std::string` compares the bytes as unsigned values, like
+ * `cudf::string_view::compare`.
+ */
+template <typename T>
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> make_lookup_table(
+  std::vector<std::pair<std::string, T>>& entries,
+  cudf::type_id value_type,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::stable_sort(entries.begin(), entries.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.first < rhs.first;
+  });
+  auto const same_key = [](auto const& lhs, auto const& rhs) { return lhs.first == rhs.first; };
+  entries.erase(std::unique(entries.begin(), entries.end(), same_key), entries.end());
+
+  std::vector<std::string> keys(entries.size());
+  std::vector<T> values(entries.size());
+  std::transform(entries.begin(), entries.end(), keys.begin(), [](auto const& e) {
+    return e.first;
+  });
+  std::transform(entries.begin(), entries.end(), values.begin(), [](auto const& e) {
+    return e.second;
+  });
+
+  auto d_values = cudf::detail::make_device_uvector_sync(values, stream, mr);
+  auto column   = std::make_unique<cudf::column>(
+    cudf::data_type{value_type}, static_cast<cudf::size_type>(values.size()), d_values.release());
+  return {make_host_strings_column(keys, stream, mr), std::move(column)};
+}
+
+/**
+ * @brief Reads the lines of a file without any trailing carriage return.
+ */
+std::vector<std::string> read_lines(std::string const& filename)
+{
+  std::ifstream file(filename);
+  CUDF_EXPECTS(file.good(), "Could not open " + filename);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+}  // namespace
+
+std::unique_ptr<bpe_vocabulary> load_bpe_vocabulary(std::string const& filename_merges,
+                                                    std::string const& filename_vocabulary,
+                                                    std::string const& unknown_token,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::pair<std::string, int32_t>> merges;
+  for (auto const& line : read_lines(filename_merges)) {
+    if (line.empty() || (merges.empty() && line.rfind("#version", 0) == 0)) { continue; }
+    auto const space = line.find(' ');
+    CUDF_EXPECTS(space != line.npos && space > 0 && space + 1 < line.size(),
+                 "invalid merges file format");
+    merges.emplace_back(line, static_cast<int32_t>(merges.size()));
+  }
+
+  std::vector<std::pair<std::string, uint32_t>> tokens;
+  for (auto const& line : read_lines(filename_vocabulary)) {
+    tokens.emplace_back(line, static_cast<uint32_t>(tokens.size()));
+  }
+  auto const unknown = std::find_if(tokens.begin(), tokens.end(), [&unknown_token](auto const& t) {
+    return t.first == unknown_token;
+  });
+  CUDF_EXPECTS(unknown != tokens.end(), "unknown_token not found in the vocabulary");
+
+  auto result              = std::make_unique<bpe_vocabulary>();
+  result->unknown_token_id = unknown->second;
+  std::tie(result->merge_pairs, result->merge_ranks) =
+    make_lookup_table(merges, cudf::type_id::INT32, stream, mr);
+  std::tie(result->tokens, result->token_ids) =
+    make_lookup_table(tokens, cudf::type_id::UINT32, stream, mr);
+  return result;
+}
+
+bpe_tokenizer::bpe_tokenizer(bpe_vocabulary const& vocabulary) : vocabulary(vocabulary)
+{
+  CUDF_EXPECTS(vocabulary.merge_pairs != nullptr && vocabulary.merge_ranks != nullptr &&
+                 vocabulary.tokens != nullptr && vocabulary.token_ids != nullptr,
+               "bpe vocabulary tables must not be empty");
+}
+
+uvector_pair bpe_tokenizer::tokenize(char const* d_strings,
+                                     uint32_t const* d_offsets,
+                                     uint32_t num_strings,
+                                     rmm::cuda_stream_view stream)
+{
+  uint32_t first_offset = 0;
+  uint32_t last_offset  = 0;
+  CUDA_TRY(cudaMemcpyAsync(
+    &first_offset, d_offsets, sizeof(uint32_t), cudaMemcpyDeviceToHost, stream.value()));
+  CUDA_TRY(cudaMemcpyAsync(&last_offset,
+                           d_offsets + num_strings,
+                           sizeof(uint32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+  auto const chars_size = last_offset - first_offset;
+  CUDF_EXPECTS(chars_size < static_cast<uint32_t>(std::numeric_limits<int32_t>::max()),
+               "strings are too large for the bpe tokenizer");
+
+  rmm::device_uvector<int32_t> symbol_ends(chars_size, stream);
+  auto token_offsets = std::make_unique<rmm::device_uvector<uint32_t>>(num_strings + 1, stream);
+
+  auto d_merge_pairs = cudf::column_device_view::create(vocabulary.merge_pairs->view(), stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<uint32_t>(0),
+                     num_strings,
+                     bpe_merge_fn{d_strings,
+                                  d_offsets,
+                                  *d_merge_pairs,
+                                  vocabulary.merge_ranks->view().data<int32_t>(),
+                                  symbol_ends.data(),
+                                  token_offsets->data()});
+  // convert the token counts into offsets
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         token_offsets->begin(),
+                         token_offsets->end(),
+                         token_offsets->begin());
+  auto const tokens_size = token_offsets->back_element(stream);
+
+  auto token_ids = std::make_unique<rmm::device_uvector<uint32_t>>(tokens_size, stream);
+  auto d_tokens  = cudf::column_device_view::create(vocabulary.tokens->view(), stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<uint32_t>(0),
+                     num_strings,
+                     bpe_token_ids_fn{d_strings,
+                                      d_offsets,
+                                      symbol_ends.data(),
+                                      *d_tokens,
+                                      vocabulary.token_ids->view().data<uint32_t>(),
+                                      vocabulary.unknown_token_id,
+                                      token_offsets->data(),
+                                      token_ids->data()});
+  return uvector_pair(std::move(token_ids), std::move(token_offsets));
+}
+
+}  // namespace detail
+
+std::unique_ptr<bpe_vocabulary> load_bpe_vocabulary(std::string const& filename_merges,
+                                                    std::string const& filename_vocabulary,
+                                                    std::string const& unknown_token,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::load_bpe_vocabulary(
+    filename_merges, filename_vocabulary, unknown_token, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace nvtext
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <text/subword/detail/data_normalizer.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace nvtext {
+
+struct bpe_vocabulary;
+
+namespace detail {
+
+/**
+ * @brief This splits words into the byte-pair encoding tokens of a vocabulary.
+ *
+ * The `tokenize()` function produces two device vectors `uvector_pair` like
+ * `wordpiece_tokenizer::tokenize()`. The first is the token-ids for each token
+ * identified in the input strings. The second is the offsets to identify which
+ * ids go with each string.
+ *
+ * A temporary buffer of one int32 value per input byte records the symbols of
+ * the words while they are merged.
+ */
+class bpe_tokenizer {
+ public:
+  /**
+   * @brief Creates a tokenizer for the merge-rank and vocabulary tables.
+   *
+   * @param vocabulary The tables loaded by load_bpe_vocabulary.
+   */
+  bpe_tokenizer(bpe_vocabulary const& vocabulary);
+
+  /**
+   * @brief Splits the input text into token ids.
+   *
+   * @param d_strings A vector of strings which MUST be encoded in the utf8 format.
+   * @param d_offsets A vector of byte offsets to the beginning of individual strings in
+   *        the `d_strings` parameter.
+   * @param num_strings The number of strings in `d_strings`.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return Pointer to token-ids and token-id offsets
+   */
+  uvector_pair tokenize(char const* d_strings,
+                        uint32_t const* d_offsets,
+                        uint32_t num_strings,
+                        rmm::cuda_stream_view stream);
+
+ private:
+  bpe_vocabulary const& vocabulary;
+};
+
+}  // namespace detail
+}  // namespace nvtext
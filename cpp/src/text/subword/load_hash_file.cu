@@ -29,6 +29,7 @@
 
 #include <stdint.h>
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <vector>
@@ -177,40 +178,114 @@ uint64_t str_to_uint64(std::string const& str, uint64_t line_no)
     throw;
   }
 }
-}  // namespace
+
+// Identifies the binary format of the hashed vocabulary file written by save_vocabulary_file
+constexpr char vocabulary_file_magic[8] = {'N', 'V', 'T', 'V', 'O', 'C', 'B', '1'};
 
 /**
- * @brief Loads a text file representing the hashed vocabulary into hashed_vocabulary struct.
+ * @brief The header of the binary hashed vocabulary file.
  *
- * @code{.pseudo}
- * Format of the file (ASCII text file with numbers):
- * First 3 lines have the following values:
- *  outer_hash_a
- *  outer_hash_b
- *  number-of-bins
- * The next number-of-bins lines has two values in each line separated by a space
- *  coefficient offset
- *  ...
- * Next line has the size (number of lines) of the table followed
- * by the table values -- one value per line.
- * The last three lines:
- *  unknown_token_id
- *  first_token_id
- *  separator_token_id
- * @endcode
+ * The header is followed by the `num_bins` bin coefficients, the `table_size` table values and
+ * the `num_bins` bin offsets, so that each array is aligned to its element size.
+ */
+struct vocabulary_file_header {
+  char magic[sizeof(vocabulary_file_magic)];
+  uint32_t outer_hash_a;
+  uint32_t outer_hash_b;
+  uint16_t num_bins;
+  uint16_t first_token_id;
+  uint16_t separator_token_id;
+  uint16_t unknown_token_id;
+  uint64_t table_size;
+};
+
+std::size_t bin_coefficients_offset(vocabulary_file_header const&)
+{
+  return sizeof(vocabulary_file_header);
+}
+
+std::size_t table_offset(vocabulary_file_header const& header)
+{
+  return bin_coefficients_offset(header) + header.num_bins * sizeof(uint64_t);
+}
+
+std::size_t bin_offsets_offset(vocabulary_file_header const& header)
+{
+  return table_offset(header) + header.table_size * sizeof(uint64_t);
+}
+
+std::size_t binary_vocabulary_size(vocabulary_file_header const& header)
+{
+  return bin_offsets_offset(header) + header.num_bins * sizeof(uint16_t);
+}
+
+/**
+ * @brief Creates a column of `size` elements of `type` from the host `data`.
+ */
+std::unique_ptr<cudf::column> make_vocabulary_column(cudf::type_id type,
+                                                     std::size_t size,
+                                                     void const* data,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  auto result = cudf::make_numeric_column(
+    cudf::data_type{type}, size, cudf::mask_state::UNALLOCATED, stream, mr);
+  CUDA_TRY(cudaMemcpyAsync(result->mutable_view().head(),
+                           data,
+                           size * cudf::size_of(result->type()),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  return result;
+}
+
+/**
+ * @brief Reads the binary format of the hashed vocabulary file.
  *
- * @param filename_hashed_vocabulary Path to text file containing hashed vocabulary
- * @return object containing hash table elements for the wordpiece tokenizer
+ * The file is read with a single host read and each array is copied to the device as is.
  */
-std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
-  std::string const& filename_hashed_vocabulary,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr)
+hashed_vocabulary load_binary_vocabulary(std::istream& hash_file,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
 {
+  hash_file.seekg(0, std::ios::end);
+  std::vector<char> buffer(static_cast<std::size_t>(hash_file.tellg()));
+  hash_file.seekg(0);
+  hash_file.read(buffer.data(), buffer.size());
+  CUDF_EXPECTS(hash_file.good(), "could not read hash file");
+  CUDF_EXPECTS(buffer.size() >= sizeof(vocabulary_file_header), "invalid hash file format");
+  vocabulary_file_header header;
+  std::memcpy(&header, buffer.data(), sizeof(header));
+  CUDF_EXPECTS(buffer.size() == binary_vocabulary_size(header), "invalid hash file format");
+
   hashed_vocabulary result;
-  std::ifstream hash_file(filename_hashed_vocabulary);
-  CUDF_EXPECTS(hash_file.good(), "Could not open " + filename_hashed_vocabulary);
+  result.outer_hash_a       = header.outer_hash_a;
+  result.outer_hash_b       = header.outer_hash_b;
+  result.num_bins           = header.num_bins;
+  result.first_token_id     = header.first_token_id;
+  result.separator_token_id = header.separator_token_id;
+  result.unknown_token_id   = header.unknown_token_id;
+
+  auto const data = buffer.data();
+
+  result.bin_coefficients = make_vocabulary_column(
+    cudf::type_id::UINT64, header.num_bins, data + bin_coefficients_offset(header), stream, mr);
+  result.table            = make_vocabulary_column(
+    cudf::type_id::UINT64, header.table_size, data + table_offset(header), stream, mr);
+  result.bin_offsets      = make_vocabulary_column(
+    cudf::type_id::UINT16, header.num_bins, data + bin_offsets_offset(header), stream, mr);
+  // the host buffer must outlive the copies
+  stream.synchronize();
+  return result;
+}
 
+/**
+ * @brief Parses the text format of the hashed vocabulary file.
+ */
+hashed_vocabulary load_text_vocabulary(std::istream& hash_file,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  hashed_vocabulary result;
   uint64_t line_no = 1;
   std::string line;
   std::getline(hash_file, line);
@@ -258,38 +333,62 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   result.separator_token_id = str_to_uint32(line, line_no++);
 
   // Transfer hash table to columns
-  result.table = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT64},
-                                           table.size(),
-                                           cudf::mask_state::UNALLOCATED,
-                                           stream,
-                                           mr);
-  CUDA_TRY(cudaMemcpyAsync(result.table->mutable_view().data<uint64_t>(),
-                           table.data(),
-                           table.size() * sizeof(uint64_t),
-                           cudaMemcpyHostToDevice,
-                           stream.value()));
+  result.table            = make_vocabulary_column(
+    cudf::type_id::UINT64, table.size(), table.data(), stream, mr);
+  result.bin_coefficients = make_vocabulary_column(
+    cudf::type_id::UINT64, bin_coefficients.size(), bin_coefficients.data(), stream, mr);
+  result.bin_offsets      = make_vocabulary_column(
+    cudf::type_id::UINT16, bin_offsets.size(), bin_offsets.data(), stream, mr);
+  // the host vectors must outlive the copies
+  stream.synchronize();
+  return result;
+}
 
-  result.bin_coefficients = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT64},
-                                                      bin_coefficients.size(),
-                                                      cudf::mask_state::UNALLOCATED,
-                                                      stream,
-                                                      mr);
-  CUDA_TRY(cudaMemcpyAsync(result.bin_coefficients->mutable_view().data<uint64_t>(),
-                           bin_coefficients.data(),
-                           bin_coefficients.size() * sizeof(uint64_t),
-                           cudaMemcpyHostToDevice,
-                           stream.value()));
+}  // namespace
 
-  result.bin_offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT16},
-                                                 bin_offsets.size(),
-                                                 cudf::mask_state::UNALLOCATED,
-                                                 stream,
-                                                 mr);
-  CUDA_TRY(cudaMemcpyAsync(result.bin_offsets->mutable_view().data<uint16_t>(),
-                           bin_offsets.data(),
-                           bin_offsets.size() * sizeof(uint16_t),
-                           cudaMemcpyHostToDevice,
-                           stream.value()));
+/**
+ * @brief Loads a text file representing the hashed vocabulary into hashed_vocabulary struct.
+ *
+ * @code{.pseudo}
+ * Format of the file (ASCII text file with numbers):
+ * First 3 lines have the following values:
+ *  outer_hash_a
+ *  outer_hash_b
+ *  number-of-bins
+ * The next number-of-bins lines has two values in each line separated by a space
+ *  coefficient offset
+ *  ...
+ * Next line has the size (number of lines) of the table followed
+ * by the table values -- one value per line.
+ * The last three lines:
+ *  unknown_token_id
+ *  first_token_id
+ *  separator_token_id
+ * @endcode
+ *
+ * A file written by save_vocabulary_file is recognized by its first bytes and is read with
+ * a single host read instead.
+ *
+ * @param filename_hashed_vocabulary Path to file containing hashed vocabulary
+ * @return object containing hash table elements for the wordpiece tokenizer
+ */
+std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
+  std::string const& filename_hashed_vocabulary,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::ifstream hash_file(filename_hashed_vocabulary, std::ifstream::binary);
+  CUDF_EXPECTS(hash_file.good(), "Could not open " + filename_hashed_vocabulary);
+
+  char magic[sizeof(vocabulary_file_header::magic)] = {};
+  hash_file.read(magic, sizeof(magic));
+  bool const is_binary = hash_file.gcount() == static_cast<std::streamsize>(sizeof(magic)) &&
+                         std::equal(magic, magic + sizeof(magic), vocabulary_file_magic);
+  hash_file.clear();
+  hash_file.seekg(0);
+
+  auto result = is_binary ? load_binary_vocabulary(hash_file, stream, mr)
+                          : load_text_vocabulary(hash_file, stream, mr);
 
   // this just initializes some constant tables into device memory
   // to help speed up the runtime
@@ -299,6 +398,48 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   return std::make_unique<hashed_vocabulary>(std::move(result));
 }
 
+void save_vocabulary_file(hashed_vocabulary const& vocabulary,
+                          std::string const& filename_hashed_vocabulary,
+                          rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(vocabulary.table != nullptr && vocabulary.bin_coefficients != nullptr &&
+                 vocabulary.bin_offsets != nullptr,
+               "Incomplete hashed vocabulary");
+  CUDF_EXPECTS(vocabulary.bin_coefficients->size() == vocabulary.num_bins &&
+                 vocabulary.bin_offsets->size() == vocabulary.num_bins,
+               "Number of bins does not match the bin columns");
+
+  vocabulary_file_header header{};
+  std::copy(vocabulary_file_magic, vocabulary_file_magic + sizeof(header.magic), header.magic);
+  header.outer_hash_a       = vocabulary.outer_hash_a;
+  header.outer_hash_b       = vocabulary.outer_hash_b;
+  header.num_bins           = vocabulary.num_bins;
+  header.first_token_id     = vocabulary.first_token_id;
+  header.separator_token_id = vocabulary.separator_token_id;
+  header.unknown_token_id   = vocabulary.unknown_token_id;
+  header.table_size         = vocabulary.table->size();
+
+  std::vector<char> buffer(binary_vocabulary_size(header));
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  auto const copy_to_host = [&](cudf::column const& col, std::size_t offset) {
+    auto const view = col.view();
+    CUDA_TRY(cudaMemcpyAsync(buffer.data() + offset,
+                             view.head(),
+                             view.size() * cudf::size_of(view.type()),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+  };
+  copy_to_host(*vocabulary.bin_coefficients, bin_coefficients_offset(header));
+  copy_to_host(*vocabulary.table, table_offset(header));
+  copy_to_host(*vocabulary.bin_offsets, bin_offsets_offset(header));
+  stream.synchronize();
+
+  std::ofstream hash_file(filename_hashed_vocabulary, std::ofstream::binary);
+  CUDF_EXPECTS(hash_file.good(), "Could not open " + filename_hashed_vocabulary);
+  hash_file.write(buffer.data(), buffer.size());
+  CUDF_EXPECTS(hash_file.good(), "Could not write " + filename_hashed_vocabulary);
+}
+
 }  // namespace detail
 
 std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
@@ -308,4 +449,11 @@ std::unique_ptr<hashed_vocabulary> load_vocabulary_file(
   return detail::load_vocabulary_file(filename_hashed_vocabulary, rmm::cuda_stream_default, mr);
 }
 
+void save_vocabulary_file(hashed_vocabulary const& vocabulary,
+                          std::string const& filename_hashed_vocabulary)
+{
+  CUDF_FUNC_RANGE();
+  detail::save_vocabulary_file(vocabulary, filename_hashed_vocabulary, rmm::cuda_stream_default);
+}
+
 }  // namespace nvtext
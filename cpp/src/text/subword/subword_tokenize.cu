@@ -19,8 +19,10 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/utilities/error.hpp>
+#include <nvtext/bpe_tokenize.hpp>
 #include <nvtext/detail/load_hash_file.hpp>
 #include <nvtext/subword_tokenize.hpp>
+#include <text/subword/detail/bpe_tokenizer.hpp>
 #include <text/subword/detail/wordpiece_tokenizer.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -121,17 +123,59 @@ __global__ void kernel_compute_tensor_metadata(
   }
 }
 
-}  // namespace
+/**
+ * @brief Device pointers to the token-ids, attention-mask and metadata outputs.
+ */
+struct tensor_output {
+  uint32_t* token_ids;
+  uint32_t* attention_mask;
+  uint32_t* metadata;
+};
 
-tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
-                                  hashed_vocabulary const& vocab_table,
-                                  uint32_t max_sequence_length,
-                                  uint32_t stride,
-                                  bool do_lower_case,
-                                  bool do_truncate,
-                                  uint32_t max_rows_tensor,
-                                  rmm::cuda_stream_view stream,
-                                  rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Splits the strings into the token-ids of the wordpiece tokenizer.
+ */
+struct wordpiece_tokenize_fn {
+  hashed_vocabulary const& vocab_table;
+  uint32_t max_rows_tensor;
+  uint32_t max_sequence_length;
+  uint32_t stride;
+  bool do_lower_case;
+  bool do_truncate;
+  rmm::cuda_stream_view stream;
+
+  uvector_pair operator()(char const* d_chars,
+                          uint32_t const* d_offsets,
+                          uint32_t strings_count) const
+  {
+    wordpiece_tokenizer tokenizer(vocab_table,
+                                  max_rows_tensor,
+                                  max_sequence_length,
+                                  stride,
+                                  do_truncate,
+                                  do_lower_case,
+                                  stream);
+    return tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
+  }
+};
+
+/**
+ * @brief Tokenizes the strings into the outputs returned by `get_output`.
+ *
+ * @tparam Tokenize Returns the token-ids and their per-string offsets of the given
+ *         strings characters, offsets and number of strings
+ * @tparam GetOutput Returns a `tensor_output` with room for the given number of tensor rows
+ * @return The number of tensor rows written
+ */
+template <typename Tokenize, typename GetOutput>
+uint32_t tokenize_to_tensor(cudf::strings_column_view const& strings,
+                            uint32_t max_sequence_length,
+                            uint32_t stride,
+                            bool do_truncate,
+                            uint32_t max_rows_tensor,
+                            Tokenize tokenize,
+                            GetOutput get_output,
+                            rmm::cuda_stream_view stream)
 {
   CUDF_EXPECTS(stride <= max_sequence_length,
                "stride must be less than or equal to max_sequence_length");
@@ -139,23 +183,15 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                  static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
                "max_sequence_length x max_rows_tensor is too large for cudf output column size");
   auto const strings_count = strings.size();
-  if (strings_count == 0 || strings.chars_size() == 0)
-    return tokenizer_result{0,
-                            max_sequence_length,
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
+  if (strings_count == 0 || strings.chars_size() == 0) return 0;
 
   auto const offsets   = strings.offsets();
   auto const d_offsets = offsets.data<uint32_t>() + strings.offset();
   auto const offset    = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
   auto const d_chars   = strings.chars().data<char>() + offset;
 
-  // Create tokenizer
-  wordpiece_tokenizer tokenizer(
-    vocab_table, max_rows_tensor, max_sequence_length, stride, do_truncate, do_lower_case, stream);
   // Run tokenizer
-  auto const tokens = tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
+  auto const tokens = tokenize(d_chars, d_offsets, strings_count);
   // assign output components
   uint32_t const* device_token_ids = tokens.first->data();
   uint32_t const* device_offsets   = tokens.second->data();
@@ -200,23 +236,7 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
       }
     });
 
-  // create output data columns
-  auto tensor_token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
-                                                    nrows_tensor_token_ids * max_sequence_length,
-                                                    cudf::mask_state::UNALLOCATED,
-                                                    stream,
-                                                    mr);
-  auto tensor_attention_mask =
-    cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
-                              nrows_tensor_token_ids * max_sequence_length,
-                              cudf::mask_state::UNALLOCATED,
-                              stream,
-                              mr);
-  auto tensor_metadata = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
-                                                   nrows_tensor_token_ids * 3,
-                                                   cudf::mask_state::UNALLOCATED,
-                                                   stream,
-                                                   mr);
+  auto const output = get_output(nrows_tensor_token_ids);
 
   // compute final-tensor, mask, and metadata
   constexpr int block_size = 256;
@@ -234,9 +254,53 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
     nrows_tensor_token_ids,
     stride,
     do_truncate,
-    tensor_token_ids->mutable_view().data<uint32_t>(),
-    tensor_attention_mask->mutable_view().data<uint32_t>(),
-    tensor_metadata->mutable_view().data<uint32_t>());
+    output.token_ids,
+    output.attention_mask,
+    output.metadata);
+  return nrows_tensor_token_ids;
+}
+
+/**
+ * @brief Tokenizes the strings into new token-ids, attention-mask and metadata columns.
+ *
+ * @tparam Tokenize Returns the token-ids and their per-string offsets of the given
+ *         strings characters, offsets and number of strings
+ */
+template <typename Tokenize>
+tokenizer_result tokenize_to_columns(cudf::strings_column_view const& strings,
+                                     uint32_t max_sequence_length,
+                                     uint32_t stride,
+                                     bool do_truncate,
+                                     uint32_t max_rows_tensor,
+                                     Tokenize tokenize,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  auto const make_output_column = [stream, mr](uint32_t size) {
+    return cudf::make_numeric_column(
+      cudf::data_type{cudf::type_id::UINT32}, size, cudf::mask_state::UNALLOCATED, stream, mr);
+  };
+  auto tensor_token_ids      = make_output_column(0);
+  auto tensor_attention_mask = make_output_column(0);
+  auto tensor_metadata       = make_output_column(0);
+
+  // create output data columns once the number of rows is known
+  auto const get_output = [&](uint32_t nrows_tensor_token_ids) {
+    tensor_token_ids      = make_output_column(nrows_tensor_token_ids * max_sequence_length);
+    tensor_attention_mask = make_output_column(nrows_tensor_token_ids * max_sequence_length);
+    tensor_metadata       = make_output_column(nrows_tensor_token_ids * 3);
+    return tensor_output{tensor_token_ids->mutable_view().data<uint32_t>(),
+                         tensor_attention_mask->mutable_view().data<uint32_t>(),
+                         tensor_metadata->mutable_view().data<uint32_t>()};
+  };
+  auto const nrows_tensor_token_ids = tokenize_to_tensor(strings,
+                                                         max_sequence_length,
+                                                         stride,
+                                                         do_truncate,
+                                                         max_rows_tensor,
+                                                         tokenize,
+                                                         get_output,
+                                                         stream);
 
   return tokenizer_result{nrows_tensor_token_ids,
                           max_sequence_length,
@@ -245,6 +309,88 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                           std::move(tensor_metadata)};
 }
 
+}  // namespace
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  hashed_vocabulary const& vocab_table,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  uint32_t max_rows_tensor,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  wordpiece_tokenize_fn const tokenize{
+    vocab_table, max_rows_tensor, max_sequence_length, stride, do_lower_case, do_truncate, stream};
+  return tokenize_to_columns(
+    strings, max_sequence_length, stride, do_truncate, max_rows_tensor, tokenize, stream, mr);
+}
+
+tokenizer_result bpe_tokenize(cudf::strings_column_view const& strings,
+                              bpe_vocabulary const& vocabulary,
+                              uint32_t max_sequence_length,
+                              uint32_t stride,
+                              bool do_truncate,
+                              uint32_t max_rows_tensor,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  auto const tokenize = [&vocabulary, stream](char const* d_chars,
+                                              uint32_t const* d_offsets,
+                                              uint32_t strings_count) {
+    bpe_tokenizer tokenizer(vocabulary);
+    return tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
+  };
+  return tokenize_to_columns(
+    strings, max_sequence_length, stride, do_truncate, max_rows_tensor, tokenize, stream, mr);
+}
+
+uint32_t subword_tokenize(cudf::strings_column_view const& strings,
+                          hashed_vocabulary const& vocab_table,
+                          uint32_t max_sequence_length,
+                          uint32_t stride,
+                          bool do_lower_case,
+                          bool do_truncate,
+                          cudf::mutable_column_view& tensor_token_ids,
+                          cudf::mutable_column_view& tensor_attention_mask,
+                          cudf::mutable_column_view& tensor_metadata,
+                          rmm::cuda_stream_view stream)
+{
+  auto const is_output = [](cudf::mutable_column_view const& col) {
+    return col.type().id() == cudf::type_id::UINT32 && !col.nullable();
+  };
+  CUDF_EXPECTS(is_output(tensor_token_ids) && is_output(tensor_attention_mask) &&
+                 is_output(tensor_metadata),
+               "output columns must be of type UINT32 without a null mask");
+  CUDF_EXPECTS(max_sequence_length > 0, "max_sequence_length must be greater than 0");
+  auto const max_rows_tensor =
+    static_cast<uint32_t>(tensor_token_ids.size()) / max_sequence_length;
+  CUDF_EXPECTS(static_cast<uint32_t>(tensor_attention_mask.size()) >=
+                   max_rows_tensor * max_sequence_length &&
+                 static_cast<uint32_t>(tensor_metadata.size()) >= max_rows_tensor * 3,
+               "output columns are too small for the rows of tensor_token_ids");
+
+  // the outputs are only used once the rows are known to fit
+  auto const get_output = [&](uint32_t nrows_tensor_token_ids) {
+    CUDF_EXPECTS(nrows_tensor_token_ids <= max_rows_tensor,
+                 "output columns are too small for the tokens of the strings");
+    return tensor_output{tensor_token_ids.data<uint32_t>(),
+                         tensor_attention_mask.data<uint32_t>(),
+                         tensor_metadata.data<uint32_t>()};
+  };
+  wordpiece_tokenize_fn const tokenize{
+    vocab_table, max_rows_tensor, max_sequence_length, stride, do_lower_case, do_truncate, stream};
+  return tokenize_to_tensor(strings,
+                            max_sequence_length,
+                            stride,
+                            do_truncate,
+                            max_rows_tensor,
+                            tokenize,
+                            get_output,
+                            stream);
+}
+
 }  // namespace detail
 
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
@@ -290,4 +436,46 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   mr);
 }
 
+uint32_t subword_tokenize(cudf::strings_column_view const& strings,
+                          hashed_vocabulary const& vocabulary_table,
+                          uint32_t max_sequence_length,
+                          uint32_t stride,
+                          bool do_lower_case,
+                          bool do_truncate,
+                          cudf::mutable_column_view& tensor_token_ids,
+                          cudf::mutable_column_view& tensor_attention_mask,
+                          cudf::mutable_column_view& tensor_metadata)
+{
+  CUDF_FUNC_RANGE();
+  return detail::subword_tokenize(strings,
+                                  vocabulary_table,
+                                  max_sequence_length,
+                                  stride,
+                                  do_lower_case,
+                                  do_truncate,
+                                  tensor_token_ids,
+                                  tensor_attention_mask,
+                                  tensor_metadata,
+                                  rmm::cuda_stream_default);
+}
+
+tokenizer_result bpe_tokenize(cudf::strings_column_view const& strings,
+                              bpe_vocabulary const& vocabulary,
+                              uint32_t max_sequence_length,
+                              uint32_t stride,
+                              bool do_truncate,
+                              uint32_t max_rows_tensor,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bpe_tokenize(strings,
+                              vocabulary,
+                              max_sequence_length,
+                              stride,
+                              do_truncate,
+                              max_rows_tensor,
+                              rmm::cuda_stream_default,
+                              mr);
+}
+
 }  // namespace nvtext
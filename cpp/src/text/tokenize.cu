@@ -23,6 +23,7 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <nvtext/detail/tokenize.hpp>
 #include <nvtext/tokenize.hpp>
 #include <text/utilities/tokenize_ops.cuh>
@@ -32,6 +33,7 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/copy.h>
+#include <thrust/sequence.h>
 #include <thrust/transform.h>
 
 namespace nvtext {
@@ -69,7 +71,7 @@ std::unique_ptr<cudf::column> tokenize_fn(cudf::size_type strings_count,
 {
   // get the number of tokens in each string
   auto const token_counts =
-    token_count_fn(strings_count, tokenizer, stream, rmm::mr::get_current_device_resource());
+    token_count_fn(strings_count, tokenizer, stream, cudf::get_current_temp_resource());
   auto d_token_counts = token_counts->view();
   // create token-index offsets from the counts
   rmm::device_uvector<int32_t> token_offsets(strings_count + 1, stream);
@@ -201,15 +203,20 @@ std::unique_ptr<cudf::column> character_tokenize(cudf::strings_column_view const
                                                   stream,
                                                   mr);
   auto d_new_offsets  = offsets_column->mutable_view().begin<int32_t>();
-  thrust::copy_if(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator<int32_t>(0),
-    thrust::make_counting_iterator<int32_t>(chars_bytes + 1),
-    d_new_offsets,
-    [d_chars, chars_bytes] __device__(auto idx) {
-      // this will also set the final value to the size chars_bytes
-      return idx < chars_bytes ? cudf::strings::detail::is_begin_utf8_char(d_chars[idx]) : true;
-    });
+  if (num_characters == chars_bytes) {
+    // every byte is a character when the strings are all ASCII
+    thrust::sequence(rmm::exec_policy(stream), d_new_offsets, d_new_offsets + chars_bytes + 1);
+  } else {
+    thrust::copy_if(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<int32_t>(0),
+      thrust::make_counting_iterator<int32_t>(chars_bytes + 1),
+      d_new_offsets,
+      [d_chars, chars_bytes] __device__(auto idx) {
+        // this will also set the final value to the size chars_bytes
+        return idx < chars_bytes ? cudf::strings::detail::is_begin_utf8_char(d_chars[idx]) : true;
+      });
+  }
 
   // create the output chars column -- just a copy of the input's chars column
   cudf::column_view chars_view(cudf::data_type{cudf::type_id::INT8}, chars_bytes, d_chars);
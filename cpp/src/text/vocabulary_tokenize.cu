@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nvtext/detail/tokenize.hpp>
+#include <nvtext/tokenize.hpp>
+#include <text/utilities/tokenize_ops.cuh>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform_scan.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the hash bin of a token.
+ */
+__device__ inline cudf::size_type hash_bin(cudf::string_view const& d_str,
+                                           cudf::size_type bins_count)
+{
+  return static_cast<cudf::size_type>(MurmurHash3_32<cudf::string_view>{}(d_str) %
+                                      static_cast<hash_value_type>(bins_count));
+}
+
+/**
+ * @brief Places the rows of the vocabulary into their hash bins.
+ *
+ * The first pass only counts the rows of each bin when `d_bin_rows` is null.
+ * The second pass places the rows at the bin positions computed from the counts.
+ */
+struct bin_rows_fn {
+  cudf::column_device_view const d_vocabulary;
+  cudf::size_type* d_bin_positions;
+  cudf::size_type* d_bin_rows{};
+
+  __device__ void operator()(cudf::size_type row) const
+  {
+    auto const d_str    = d_vocabulary.element<cudf::string_view>(row);
+    auto const bin      = hash_bin(d_str, 2 * d_vocabulary.size());
+    auto const position = atomicAdd(d_bin_positions + bin, cudf::size_type{1});
+    if (d_bin_rows) { d_bin_rows[position] = row; }
+  }
+};
+
+/**
+ * @brief Writes the vocabulary id of each token of a string.
+ *
+ * The rows of the vocabulary in the hash bin of a token are compared with
+ * the token and the smallest matching row is its id.
+ */
+struct vocabulary_tokenizer_fn {
+  cudf::column_device_view const d_strings;
+  cudf::string_view const d_delimiter;
+  cudf::column_device_view const d_vocabulary;
+  cudf::size_type const* d_bin_offsets;
+  cudf::size_type const* d_bin_rows;
+  cudf::size_type default_id;
+  cudf::size_type const* d_offsets;
+  cudf::size_type* d_ids;
+
+  __device__ cudf::size_type token_id(cudf::string_view const& d_token) const
+  {
+    auto const bin = hash_bin(d_token, 2 * d_vocabulary.size());
+    auto id        = std::numeric_limits<cudf::size_type>::max();
+    for (auto idx = d_bin_offsets[bin]; idx < d_bin_offsets[bin + 1]; ++idx) {
+      auto const row = d_bin_rows[idx];
+      if (row < id && d_vocabulary.element<cudf::string_view>(row) == d_token) { id = row; }
+    }
+    return id == std::numeric_limits<cudf::size_type>::max() ? default_id : id;
+  }
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return; }
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    characters_tokenizer tokenizer(d_str, d_delimiter);
+    auto d_output = d_ids + d_offsets[idx];
+    while (tokenizer.next_token()) {
+      auto const pos     = tokenizer.token_byte_positions();
+      auto const d_token = cudf::string_view(d_str.data() + pos.first, pos.second - pos.first);
+      *d_output++        = token_id(d_token);
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<tokenize_vocabulary> load_vocabulary(cudf::strings_column_view const& vocabulary,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!vocabulary.is_empty(), "vocabulary must not be empty");
+  CUDF_EXPECTS(!vocabulary.has_nulls(), "vocabulary must not have nulls");
+
+  auto result        = std::make_unique<tokenize_vocabulary>();
+  result->vocabulary = std::make_unique<cudf::column>(vocabulary.parent(), stream, mr);
+
+  auto const size       = vocabulary.size();
+  auto const bins_count = 2 * size;
+  result->bin_offsets   = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                  bins_count + 1,
+                                                  cudf::mask_state::UNALLOCATED,
+                                                  stream,
+                                                  mr);
+  result->bin_rows      = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT32}, size, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_bin_offsets = result->bin_offsets->mutable_view().data<cudf::size_type>();
+  auto d_bin_rows    = result->bin_rows->mutable_view().data<cudf::size_type>();
+  auto d_vocabulary  = cudf::column_device_view::create(result->vocabulary->view(), stream);
+
+  // count the rows of each bin
+  rmm::device_uvector<cudf::size_type> bin_positions(bins_count + 1, stream);
+  thrust::fill(rmm::exec_policy(stream), bin_positions.begin(), bin_positions.end(), 0);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     size,
+                     bin_rows_fn{*d_vocabulary, bin_positions.data()});
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), bin_positions.begin(), bin_positions.end(), d_bin_offsets);
+
+  // place the rows into their bins
+  thrust::copy(
+    rmm::exec_policy(stream), d_bin_offsets, d_bin_offsets + bins_count + 1, bin_positions.begin());
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     size,
+                     bin_rows_fn{*d_vocabulary, bin_positions.data(), d_bin_rows});
+  return result;
+}
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& strings,
+                                                       tokenize_vocabulary const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  auto const strings_count = strings.size();
+
+  // the token counts become the offsets of the output lists
+  auto const token_counts = count_tokens(strings, delimiter, stream);
+  auto const d_counts     = token_counts->view().data<cudf::size_type>();
+  auto offsets            = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           strings_count + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_offsets          = offsets->mutable_view().data<cudf::size_type>();
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
+    d_offsets,
+    [d_counts, strings_count] __device__(cudf::size_type idx) {
+      return idx < strings_count ? d_counts[idx] : 0;
+    },
+    cudf::size_type{0},
+    thrust::plus<cudf::size_type>());
+  auto const total_tokens =
+    cudf::detail::get_value<cudf::size_type>(offsets->view(), strings_count, stream);
+
+  auto ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                       total_tokens,
+                                       cudf::mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+  auto d_strings    = cudf::column_device_view::create(strings.parent(), stream);
+  auto d_vocabulary = cudf::column_device_view::create(vocabulary.vocabulary->view(), stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    vocabulary_tokenizer_fn{*d_strings,
+                            cudf::string_view(delimiter.data(), delimiter.size()),
+                            *d_vocabulary,
+                            vocabulary.bin_offsets->view().data<cudf::size_type>(),
+                            vocabulary.bin_rows->view().data<cudf::size_type>(),
+                            default_id,
+                            d_offsets,
+                            ids->mutable_view().data<cudf::size_type>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(ids),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<tokenize_vocabulary> load_vocabulary(cudf::strings_column_view const& vocabulary,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::load_vocabulary(vocabulary, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& strings,
+                                                       tokenize_vocabulary const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_with_vocabulary(
+    strings, vocabulary, delimiter, default_id, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace nvtext
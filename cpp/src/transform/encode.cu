@@ -57,6 +57,7 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<column>> encode(
                               input_table,
                               std::vector<order>(input_table.num_columns(), order::ASCENDING),
                               std::vector<null_order>(input_table.num_columns(), null_order::AFTER),
+                              sorted::NO,
                               stream,
                               mr);
 
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/helper_functions.cuh>
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/indexalator.cuh>
+#include <cudf/detail/memory_estimate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/inner_product.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// rmm aligns the size of every allocation to 256 bytes
+constexpr std::size_t allocation_alignment = 256;
+
+/**
+ * @brief Returns the bytes that the columns of `col` and its descendants use in addition to their
+ * `row_bit_count`: the alignment of their data and null mask allocations, the terminating offset of
+ * strings and lists, and the rounding of bits up to bytes.
+ */
+std::size_t column_overhead(column_view const& col)
+{
+  std::size_t overhead = 2 * allocation_alignment + sizeof(size_type) + 1;
+  for (auto child = col.child_begin(); child != col.child_end(); ++child) {
+    overhead += column_overhead(*child);
+  }
+  return overhead;
+}
+
+/**
+ * @brief Returns the number of columns of `col` and its descendants.
+ */
+std::size_t num_descendants(column_view const& col)
+{
+  return std::accumulate(col.child_begin(),
+                         col.child_end(),
+                         std::size_t{1},
+                         [](auto sum, auto const& child) { return sum + num_descendants(child); });
+}
+
+/**
+ * @brief Returns the number of times each of the `num_rows` rows of a table is gathered by
+ * `gather_map`; out-of-bounds indices are not counted.
+ */
+rmm::device_uvector<size_type> gather_counts(column_view const& gather_map,
+                                             size_type num_rows,
+                                             rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> counts(num_rows, stream);
+  thrust::fill(rmm::exec_policy(stream), counts.begin(), counts.end(), 0);
+  auto const map_begin = indexalator_factory::make_input_iterator(gather_map);
+  thrust::for_each(rmm::exec_policy(stream),
+                   map_begin,
+                   map_begin + gather_map.size(),
+                   [counts = counts.data(), num_rows] __device__(size_type idx) {
+                     if (idx < 0) { idx += num_rows; }
+                     if (idx >= 0 && idx < num_rows) { atomicAdd(counts + idx, 1); }
+                   });
+  return counts;
+}
+
+/**
+ * @brief Returns the number of bytes of the gather maps built to gather the children of the lists
+ * columns of `col`, whose rows are gathered `counts[i]` times.
+ *
+ * Gathering a lists column builds the offsets of the gathered lists and the gather map of their
+ * child rows, then gathers the child rows, each of which is gathered as many times as its list.
+ */
+std::size_t nested_gather_map_size(column_view const& col,
+                                   device_span<size_type const> counts,
+                                   rmm::cuda_stream_view stream)
+{
+  if (col.type().id() == type_id::STRUCT) {
+    structs_column_view const structs(col);
+    std::size_t size = 0;
+    for (size_type idx = 0; idx < col.num_children(); ++idx) {
+      size += nested_gather_map_size(structs.get_sliced_child(idx), counts, stream);
+    }
+    return size;
+  }
+  if (col.type().id() != type_id::LIST) { return 0; }
+
+  // the offsets of the sliced lists index the rows of the whole child
+  lists_column_view const lists(col);
+  auto const child = lists.child();
+  rmm::device_uvector<size_type> child_counts(child.size(), stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(child.size()),
+    child_counts.begin(),
+    [offsets = lists.offsets_begin(), num_rows = col.size(), counts = counts.data()] __device__(
+      size_type idx) {
+      auto const row = static_cast<size_type>(
+        thrust::upper_bound(thrust::seq, offsets, offsets + num_rows + 1, idx) - offsets - 1);
+      return (row >= 0 && row < num_rows) ? counts[row] : 0;
+    });
+
+  auto const num_lists =
+    thrust::reduce(rmm::exec_policy(stream), counts.begin(), counts.end(), int64_t{0});
+  auto const num_child_rows =
+    thrust::reduce(rmm::exec_policy(stream), child_counts.begin(), child_counts.end(), int64_t{0});
+  return static_cast<std::size_t>(num_lists + num_child_rows) * sizeof(size_type) +
+         nested_gather_map_size(child, child_counts, stream);
+}
+
+/**
+ * @brief Returns an upper bound on the bytes of the gather maps built to gather the children of
+ * the lists columns of `col`, for `num_rows` rows each having the largest lists of `col`.
+ */
+std::size_t max_nested_gather_map_size(column_view const& col,
+                                       std::size_t num_rows,
+                                       rmm::cuda_stream_view stream)
+{
+  if (col.type().id() == type_id::STRUCT) {
+    structs_column_view const structs(col);
+    std::size_t size = 0;
+    for (size_type idx = 0; idx < col.num_children(); ++idx) {
+      size += max_nested_gather_map_size(structs.get_sliced_child(idx), num_rows, stream);
+    }
+    return size;
+  }
+  if (col.type().id() != type_id::LIST || col.size() == 0) { return 0; }
+
+  lists_column_view const lists(col);
+  auto const max_list_size = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(col.size()),
+    [offsets = lists.offsets_begin()] __device__(size_type idx) {
+      return offsets[idx + 1] - offsets[idx];
+    },
+    size_type{0},
+    thrust::maximum<size_type>{});
+  auto const num_child_rows = num_rows * static_cast<std::size_t>(max_list_size);
+  return (num_rows + num_child_rows) * sizeof(size_type) +
+         max_nested_gather_map_size(lists.get_sliced_child(stream), num_child_rows, stream);
+}
+
+/**
+ * @brief Returns the largest `row_bit_count` of the rows of `input`.
+ */
+size_type max_row_bit_count(table_view const& input, rmm::cuda_stream_view stream)
+{
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return 0; }
+  auto const row_bits = detail::row_bit_count(input, stream);
+  auto const bits     = row_bits->view().begin<size_type>();
+  return thrust::reduce(rmm::exec_policy(stream),
+                        bits,
+                        bits + input.num_rows(),
+                        size_type{0},
+                        thrust::maximum<size_type>{});
+}
+
+/**
+ * @brief Returns the bytes that the columns of `input` and their descendants use in addition to
+ * their `row_bit_count`.
+ */
+std::size_t table_overhead(table_view const& input)
+{
+  return std::accumulate(input.begin(), input.end(), std::size_t{0}, [](auto sum, auto const& col) {
+    return sum + column_overhead(col);
+  });
+}
+
+/**
+ * @brief Returns the device memory of a gather of `num_rows` arbitrary rows of `input`.
+ */
+memory_estimate estimate_max_gather_memory(table_view const& input,
+                                           std::size_t num_rows,
+                                           rmm::cuda_stream_view stream)
+{
+  memory_estimate result;
+  result.output_bytes = num_rows * max_row_bit_count(input, stream) / 8 + table_overhead(input);
+  for (auto const& col : input) {
+    result.temporary_bytes += max_nested_gather_map_size(col, num_rows, stream);
+  }
+  return result;
+}
+
+}  // namespace
+
+memory_estimate estimate_gather_memory(table_view const& source_table,
+                                       column_view const& gather_map,
+                                       out_of_bounds_policy bounds_policy,
+                                       rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
+  memory_estimate result;
+  if (source_table.num_columns() == 0) { return result; }
+
+  auto const counts   = gather_counts(gather_map, source_table.num_rows(), stream);
+  auto const row_bits = detail::row_bit_count(source_table, stream);
+  auto const bits     = row_bits->view().begin<size_type>();
+  auto const num_bits = thrust::inner_product(
+    rmm::exec_policy(stream),
+    counts.begin(),
+    counts.end(),
+    bits,
+    int64_t{0},
+    thrust::plus<int64_t>{},
+    [] __device__(size_type count, size_type row_bits) {
+      return static_cast<int64_t>(count) * row_bits;
+    });
+  result.output_bytes = static_cast<std::size_t>(num_bits / 8) + table_overhead(source_table);
+
+  if (bounds_policy == out_of_bounds_policy::NULLIFY) {
+    // nullified rows have a null mask bit and an offset in every column, and no data
+    auto const num_gathered =
+      thrust::reduce(rmm::exec_policy(stream), counts.begin(), counts.end(), int64_t{0});
+    auto const num_nullified = static_cast<std::size_t>(gather_map.size() - num_gathered);
+    for (auto const& col : source_table) {
+      result.output_bytes += num_descendants(col) *
+                             (bitmask_allocation_size_bytes(gather_map.size()) +
+                              num_nullified * sizeof(size_type));
+    }
+  }
+
+  for (auto const& col : source_table) {
+    result.temporary_bytes += nested_gather_map_size(col, counts, stream);
+  }
+  return result;
+}
+
+memory_estimate estimate_sort_memory(table_view const& input, rmm::cuda_stream_view stream)
+{
+  memory_estimate result;
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return result; }
+
+  // every row is gathered once by the sorted order
+  rmm::device_uvector<size_type> sequence(input.num_rows(), stream);
+  thrust::sequence(rmm::exec_policy(stream), sequence.begin(), sequence.end());
+  auto const gather_map = column_view(data_type{type_to_id<size_type>()},
+                                      input.num_rows(),
+                                      sequence.data());
+  result = estimate_gather_memory(input, gather_map, out_of_bounds_policy::DONT_CHECK, stream);
+
+  // the sorted order, and the keys and indices of the radix sort with their double buffers
+  auto const num_rows = static_cast<std::size_t>(input.num_rows());
+  result.temporary_bytes +=
+    num_rows * sizeof(size_type) + 2 * num_rows * (sizeof(uint64_t) + sizeof(size_type));
+  return result;
+}
+
+memory_estimate estimate_inner_join_memory(table_view const& left_keys,
+                                           table_view const& right_keys,
+                                           null_equality compare_nulls,
+                                           rmm::cuda_stream_view stream)
+{
+  memory_estimate result;
+  if (is_trivial_join(left_keys, right_keys, join_kind::INNER_JOIN)) { return result; }
+
+  auto matched = cudf::dictionary::detail::match_dictionaries({left_keys, right_keys}, stream);
+  auto const left  = matched.second.front();
+  auto const right = matched.second.back();
+
+  // `inner_join` builds the hash table of the smaller table
+  auto const build = right.num_rows() > left.num_rows() ? left : right;
+  auto const probe = right.num_rows() > left.num_rows() ? right : left;
+
+  auto const capacity = std::max(compute_hash_table_size(build.num_rows()),
+                                 static_cast<std::size_t>(multimap_type::window_size));
+  result.temporary_bytes = capacity * (sizeof(hash_value_type) + sizeof(size_type));
+  if (compare_nulls == null_equality::UNEQUAL) {
+    result.temporary_bytes += bitmask_allocation_size_bytes(build.num_rows());
+  }
+
+  cudf::hash_join const join(build, compare_nulls, stream);
+  auto const join_size = join.inner_join_size(probe, compare_nulls, stream);
+  result.output_bytes  = 2 * join_size * sizeof(size_type);
+  return result;
+}
+
+memory_estimate estimate_inner_join_memory(table_view const& left,
+                                           table_view const& right,
+                                           std::vector<size_type> const& left_on,
+                                           std::vector<size_type> const& right_on,
+                                           null_equality compare_nulls,
+                                           rmm::cuda_stream_view stream)
+{
+  auto const indices = estimate_inner_join_memory(
+    left.select(left_on), right.select(right_on), compare_nulls, stream);
+  auto const join_size = indices.output_bytes / (2 * sizeof(size_type));
+
+  // the row indices are freed once both tables are gathered
+  auto const left_gather  = estimate_max_gather_memory(left, join_size, stream);
+  auto const right_gather = estimate_max_gather_memory(right, join_size, stream);
+
+  memory_estimate result;
+  result.temporary_bytes = indices.total_bytes() +
+                           std::max(left_gather.temporary_bytes, right_gather.temporary_bytes);
+  result.output_bytes = left_gather.output_bytes + right_gather.output_bytes;
+  return result;
+}
+
+}  // namespace detail
+
+memory_estimate estimate_gather_memory(table_view const& source_table,
+                                       column_view const& gather_map,
+                                       out_of_bounds_policy bounds_policy)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_gather_memory(
+    source_table, gather_map, bounds_policy, rmm::cuda_stream_default);
+}
+
+memory_estimate estimate_sort_memory(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_sort_memory(input, rmm::cuda_stream_default);
+}
+
+memory_estimate estimate_inner_join_memory(table_view const& left_keys,
+                                           table_view const& right_keys,
+                                           null_equality compare_nulls)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_inner_join_memory(
+    left_keys, right_keys, compare_nulls, rmm::cuda_stream_default);
+}
+
+memory_estimate estimate_inner_join_memory(table_view const& left,
+                                           table_view const& right,
+                                           std::vector<size_type> const& left_on,
+                                           std::vector<size_type> const& right_on,
+                                           null_equality compare_nulls)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_inner_join_memory(
+    left, right, left_on, right_on, compare_nulls, rmm::cuda_stream_default);
+}
+
+}  // namespace cudf
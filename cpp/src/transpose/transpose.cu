@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,10 +24,180 @@
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
 namespace cudf {
 namespace detail {
+namespace {
+constexpr size_type tile_size{32};
+constexpr size_type tile_block_rows{8};
+
+/**
+ * @brief Transposes the columns of a table into a single row-major column, in tiles of
+ * `tile_size` input rows by `tile_size` input columns.
+ *
+ * A tile is staged in shared memory: it is read down the input columns and written along the
+ * output rows, so that both the reads and the writes are coalesced. The validity of the elements
+ * of a tile is staged alongside, and each warp sets the bits of its output row in at most two
+ * words of the output null mask, which must be zeroed beforehand.
+ *
+ * @tparam T An unsigned integer type of the width of the elements
+ * @param input_data The data of each input column, including its offset
+ * @param input_masks The null mask of each input column, or `nullptr` if not nullable
+ * @param input_offsets The offset of each input column
+ * @param num_columns The number of input columns
+ * @param num_rows The number of input rows
+ * @param output_data The data of the output column, of `num_rows * num_columns` elements
+ * @param output_mask The null mask of the output column, or `nullptr` if not nullable
+ */
+template <typename T>
+__global__ void transpose_tiles_kernel(T const* const* input_data,
+                                       bitmask_type const* const* input_masks,
+                                       size_type const* input_offsets,
+                                       size_type num_columns,
+                                       size_type num_rows,
+                                       T* output_data,
+                                       bitmask_type* output_mask)
+{
+  // The padding column avoids shared memory bank conflicts when reading a tile transposed
+  __shared__ T tile[tile_size][tile_size + 1];
+  __shared__ bool tile_valid[tile_size][tile_size + 1];
+
+  int64_t const column_tiles = (num_columns + tile_size - 1) / tile_size;
+  int64_t const num_tiles    = column_tiles * ((num_rows + tile_size - 1) / tile_size);
+
+  for (int64_t t = blockIdx.x; t < num_tiles; t += gridDim.x) {
+    auto const first_row    = static_cast<size_type>(t / column_tiles) * tile_size;
+    auto const first_column = static_cast<size_type>(t % column_tiles) * tile_size;
+
+    for (size_type k = threadIdx.y; k < tile_size; k += tile_block_rows) {
+      size_type const row = first_row + threadIdx.x;
+      size_type const col = first_column + k;
+      if (row < num_rows && col < num_columns) {
+        tile[k][threadIdx.x] = input_data[col][row];
+        if (output_mask != nullptr) {
+          tile_valid[k][threadIdx.x] =
+            input_masks[col] == nullptr || bit_is_set(input_masks[col], input_offsets[col] + row);
+        }
+      }
+    }
+    __syncthreads();
+
+    for (size_type k = threadIdx.y; k < tile_size; k += tile_block_rows) {
+      size_type const row    = first_row + k;
+      size_type const col    = first_column + threadIdx.x;
+      bool const in_range    = row < num_rows && col < num_columns;
+      int64_t const position = static_cast<int64_t>(row) * num_columns + col;
+      if (in_range) { output_data[position] = tile[threadIdx.x][k]; }
+
+      if (output_mask != nullptr) {
+        bitmask_type const valid_bits =
+          __ballot_sync(0xffffffff, in_range && tile_valid[threadIdx.x][k]);
+        if (threadIdx.x == 0 && valid_bits != 0) {
+          // The positions of the warp are consecutive, starting at the one of its first lane
+          auto const word  = word_index(static_cast<size_type>(position));
+          auto const shift = intra_word_index(static_cast<size_type>(position));
+          atomicOr(output_mask + word, valid_bits << shift);
+          if (shift > 0) {
+            auto const carry = valid_bits >> (size_in_bits<bitmask_type>() - shift);
+            if (carry != 0) { atomicOr(output_mask + word + 1, carry); }
+          }
+        }
+      }
+    }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Transposes a table of elements of the width of `T` into a single column.
+ */
+template <typename T>
+std::unique_ptr<column> transpose_fixed_width(table_view const& input,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  auto const num_columns = input.num_columns();
+  auto const num_rows    = input.num_rows();
+
+  auto const nullable   = std::any_of(
+    input.begin(), input.end(), [](auto const& col) { return col.nullable(); });
+  auto const null_count = std::accumulate(
+    input.begin(), input.end(), size_type{0}, [](auto count, auto const& col) {
+      return count + col.null_count();
+    });
+
+  std::vector<T const*> data;
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> offsets;
+  for (auto const& col : input) {
+    data.push_back(col.data<T>());
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
+  }
+  auto const d_data    = make_device_uvector_async(data, stream);
+  auto const d_masks   = make_device_uvector_async(masks, stream);
+  auto const d_offsets = make_device_uvector_async(offsets, stream);
+
+  auto output = make_fixed_width_column(input.column(0).type(),
+                                        num_rows * num_columns,
+                                        nullable ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+
+  auto const num_tiles = static_cast<int64_t>((num_columns + tile_size - 1) / tile_size) *
+                         ((num_rows + tile_size - 1) / tile_size);
+
+  auto const num_blocks =
+    static_cast<int>(std::min<int64_t>(num_tiles, std::numeric_limits<int32_t>::max()));
+  transpose_tiles_kernel<T><<<num_blocks, dim3(tile_size, tile_block_rows), 0, stream.value()>>>(
+    d_data.data(),
+    d_masks.data(),
+    d_offsets.data(),
+    num_columns,
+    num_rows,
+    static_cast<T*>(output->mutable_view().head()),
+    nullable ? output->mutable_view().null_mask() : nullptr);
+  CHECK_CUDA(stream.value());
+
+  if (nullable) { output->set_null_count(null_count); }
+  return output;
+}
+
+/**
+ * @brief Transposes a table into a single column, with the tiled kernel for fixed-width types
+ * and by interleaving the columns otherwise.
+ */
+std::unique_ptr<column> transpose_to_column(table_view const& input,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto const dtype = input.column(0).type();
+  if (is_fixed_width(dtype)) {
+    CUDF_EXPECTS(static_cast<int64_t>(input.num_rows()) * input.num_columns() <=
+                   std::numeric_limits<size_type>::max(),
+                 "Size of transposed table exceeds the column size limit");
+    switch (size_of(dtype)) {
+      case 1: return transpose_fixed_width<uint8_t>(input, stream, mr);
+      case 2: return transpose_fixed_width<uint16_t>(input, stream, mr);
+      case 4: return transpose_fixed_width<uint32_t>(input, stream, mr);
+      case 8: return transpose_fixed_width<uint64_t>(input, stream, mr);
+      default: break;
+    }
+  }
+  return cudf::interleave_columns(input, mr);
+}
+}  // namespace
+
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::cuda_stream_view stream,
                                                          rmm::mr::device_memory_resource* mr)
@@ -44,7 +214,7 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
       input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
     "Column type mismatch");
 
-  auto output_column = cudf::interleave_columns(input, mr);
+  auto output_column = transpose_to_column(input, stream, mr);
   auto one_iter      = thrust::make_counting_iterator<size_type>(1);
   auto splits_iter   = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
@@ -16,9 +16,11 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/copy_range.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/aliasing.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -28,6 +30,8 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/iterator/transform_iterator.h>
+
 namespace cudf {
 namespace detail {
 namespace {  // anonymous namespace
@@ -160,7 +164,7 @@ struct device_cast {
  * @brief Takes a `fixed_point` column_view as @p input and returns a `fixed_point` column with new
  * @p scale
  *
- * @tparam T     Type of the `fixed_point` column_view (`decimal32` or `decimal64`)
+ * @tparam T     Type of the `fixed_point` column_view (`decimal32`, `decimal64` or `decimal128`)
  * @param input  Input `column_view`
  * @param scale  `scale` of the returned `column`
  * @param mr     Device memory resource used to allocate the returned column's device memory
@@ -182,7 +186,8 @@ std::unique_ptr<column> rescale(column_view input,
     return detail::binary_operation(input, *scalar, binary_operator::ADD, type, stream, mr);
   } else {
     auto const diff   = input.type().scale() - scale;
-    auto const scalar = make_fixed_point_scalar<T>(std::pow(10, -diff), scale_type{diff});
+    auto const factor = numeric::detail::ipow<typename T::rep, Radix::BASE_10>(-diff);
+    auto const scalar = make_fixed_point_scalar<T>(factor, scale_type{diff});
     auto const type   = cudf::data_type{cudf::type_to_id<T>(), scale};
     return detail::binary_operation(input, *scalar, binary_operator::DIV, type, stream, mr);
   }
@@ -337,9 +342,9 @@ struct dispatch_unary_cast_to {
                                      rmm::mr::device_memory_resource* mr)
   {
     if (!cudf::is_fixed_width<TargetT>())
-      CUDF_FAIL("Column type must be numeric or chrono or decimal32/64");
+      CUDF_FAIL("Column type must be numeric or chrono or decimal32/64/128");
     else if (cudf::is_fixed_point<SourceT>())
-      CUDF_FAIL("Currently only decimal32/64 to floating point/integral is supported");
+      CUDF_FAIL("Currently only decimal32/64/128 to floating point/integral is supported");
     else if (cudf::is_timestamp<SourceT>() && is_numeric<TargetT>())
       CUDF_FAIL("Timestamps can be created only from duration");
     else
@@ -365,7 +370,101 @@ struct dispatch_unary_cast_from {
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    CUDF_FAIL("Column type must be numeric or chrono or decimal32/64");
+    CUDF_FAIL("Column type must be numeric or chrono or decimal32/64/128");
+  }
+};
+template <typename _SourceT>
+struct dispatch_unary_cast_into {
+  column_view input;
+
+  dispatch_unary_cast_into(column_view inp) : input(inp) {}
+
+  template <
+    typename TargetT,
+    typename SourceT                                                                  = _SourceT,
+    typename std::enable_if_t<is_supported_non_fixed_point_cast<SourceT, TargetT>()>* = nullptr>
+  void operator()(mutable_column_view& output, rmm::cuda_stream_view stream)
+  {
+    copy_elementwise_result(
+      thrust::make_transform_iterator(input.begin<SourceT>(), unary_cast<TargetT>{}),
+      input,
+      output,
+      stream);
+  }
+
+  template <typename TargetT,
+            typename SourceT                                        = _SourceT,
+            typename std::enable_if_t<cudf::is_fixed_point<SourceT>() &&
+                                      cudf::is_numeric<TargetT>()>* = nullptr>
+  void operator()(mutable_column_view& output, rmm::cuda_stream_view stream)
+  {
+    using DeviceT    = device_storage_type_t<SourceT>;
+    auto const scale = numeric::scale_type{input.type().scale()};
+
+    copy_elementwise_result(
+      thrust::make_transform_iterator(input.begin<DeviceT>(),
+                                      fixed_point_unary_cast<SourceT, TargetT>{scale}),
+      input,
+      output,
+      stream);
+  }
+
+  template <typename TargetT,
+            typename SourceT                                            = _SourceT,
+            typename std::enable_if_t<cudf::is_numeric<SourceT>() &&
+                                      cudf::is_fixed_point<TargetT>()>* = nullptr>
+  void operator()(mutable_column_view& output, rmm::cuda_stream_view stream)
+  {
+    auto const scale = numeric::scale_type{output.type().scale()};
+
+    copy_elementwise_result(
+      thrust::make_transform_iterator(input.begin<SourceT>(),
+                                      fixed_point_unary_cast<SourceT, TargetT>{scale}),
+      input,
+      output,
+      stream);
+  }
+
+  template <typename TargetT,
+            typename SourceT                                        = _SourceT,
+            typename std::enable_if_t<cudf::is_fixed_point<SourceT>() &&
+                                      cudf::is_fixed_point<TargetT>()>* = nullptr>
+  void operator()(mutable_column_view& output, rmm::cuda_stream_view stream)
+  {
+    CUDF_FAIL("Casts between decimal32/64/128 columns cannot write into a preallocated column");
+  }
+
+  template <typename TargetT,
+            typename SourceT                                                      = _SourceT,
+            typename std::enable_if_t<not is_supported_cast<SourceT, TargetT>()>* = nullptr>
+  void operator()(mutable_column_view& output, rmm::cuda_stream_view stream)
+  {
+    if (!cudf::is_fixed_width<TargetT>())
+      CUDF_FAIL("Column type must be numeric or chrono or decimal32/64/128");
+    else if (cudf::is_fixed_point<SourceT>())
+      CUDF_FAIL("Currently only decimal32/64/128 to floating point/integral is supported");
+    else if (cudf::is_timestamp<SourceT>() && is_numeric<TargetT>())
+      CUDF_FAIL("Timestamps can be created only from duration");
+    else
+      CUDF_FAIL("Timestamps cannot be converted to numeric without converting it to a duration");
+  }
+};
+
+struct dispatch_unary_cast_into_from {
+  template <typename T, typename std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+  {
+    type_dispatcher(output.type(), dispatch_unary_cast_into<T>{input}, output, stream);
+  }
+
+  template <typename T, typename std::enable_if_t<!cudf::is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+  {
+    CUDF_FAIL("Column type must be numeric or chrono or decimal32/64/128");
   }
 };
 }  // anonymous namespace
@@ -380,6 +479,14 @@ std::unique_ptr<column> cast(column_view const& input,
   return type_dispatcher(input.type(), detail::dispatch_unary_cast_from{input}, type, stream, mr);
 }
 
+void cast(column_view const& input, mutable_column_view& output, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(is_fixed_width(output.type()), "Unary cast type must be fixed-width.");
+  expects_elementwise_output(input, output);
+
+  type_dispatcher(input.type(), detail::dispatch_unary_cast_into_from{}, input, output, stream);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> cast(column_view const& input,
@@ -390,4 +497,10 @@ std::unique_ptr<column> cast(column_view const& input,
   return detail::cast(input, type, rmm::cuda_stream_default, mr);
 }
 
+void cast(column_view const& input, mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::cast(input, output, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
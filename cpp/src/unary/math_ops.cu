@@ -16,15 +16,20 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy_range.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/aliasing.hpp>
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/detail/iterator.cuh>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
 #include <cmath>
 #include <type_traits>
 
@@ -271,7 +276,7 @@ struct fixed_point_floor {
 template <typename T>
 struct fixed_point_abs {
   T n;
-  __device__ T operator()(T data) { return std::abs(data); }
+  __device__ T operator()(T data) { return data < 0 ? -data : data; }
 };
 
 template <typename T, template <typename> typename FixedPointFunctor>
@@ -292,7 +297,8 @@ std::unique_ptr<column> unary_op_with(column_view const& input,
     input.type(), input.size(), copy_bitmask(input, stream, mr), input.null_count(), stream, mr);
 
   auto out_view = result->mutable_view();
-  Type const n  = std::pow(10, -input.type().scale());
+  Type const n  = numeric::detail::ipow<Type, numeric::Radix::BASE_10>(
+    std::max(0, -input.type().scale()));
 
   thrust::transform(rmm::exec_policy(stream),
                     input.begin<Type>(),
@@ -560,6 +566,86 @@ struct FixedPointOpDispatcher {
   }
 };
 
+/**
+ * @brief Writes `UFN{}(input[i])` into `output[i]` for the types satisfying `Supported`.
+ */
+template <typename UFN, template <typename> typename Supported>
+struct InPlaceOpDispatcher {
+  template <typename T, typename std::enable_if_t<Supported<T>::value>* = nullptr>
+  void operator()(cudf::column_view const& input,
+                  cudf::mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+  {
+    copy_elementwise_result(
+      thrust::make_transform_iterator(input.begin<T>(), UFN{}), input, output, stream);
+  }
+
+  template <typename T, typename std::enable_if_t<!Supported<T>::value>* = nullptr>
+  void operator()(cudf::column_view const& input,
+                  cudf::mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+  {
+    CUDF_FAIL("Unsupported datatype for in-place operation");
+  }
+};
+
+template <typename UFN, template <typename> typename Supported = std::is_arithmetic>
+void apply_in_place(cudf::column_view const& input,
+                    cudf::mutable_column_view& output,
+                    rmm::cuda_stream_view stream)
+{
+  cudf::type_dispatcher(input.type(), InPlaceOpDispatcher<UFN, Supported>{}, input, output, stream);
+}
+
+template <typename T, template <typename> typename FixedPointFunctor>
+void unary_op_with(column_view const& input,
+                   mutable_column_view& output,
+                   rmm::cuda_stream_view stream)
+{
+  using Type                     = device_storage_type_t<T>;
+  using FixedPointUnaryOpFunctor = FixedPointFunctor<Type>;
+
+  // When scale is >= 0 and unary_operator is CEIL or FLOOR, the values are copied
+  if (input.type().scale() >= 0 &&
+      (std::is_same<FixedPointUnaryOpFunctor, fixed_point_ceil<Type>>::value ||
+       std::is_same<FixedPointUnaryOpFunctor, fixed_point_floor<Type>>::value)) {
+    copy_elementwise_result(input.begin<Type>(), input, output, stream);
+    return;
+  }
+
+  Type const n = numeric::detail::ipow<Type, numeric::Radix::BASE_10>(
+    std::max(0, -input.type().scale()));
+  copy_elementwise_result(
+    thrust::make_transform_iterator(input.begin<Type>(), FixedPointUnaryOpFunctor{n}),
+    input,
+    output,
+    stream);
+}
+
+struct FixedPointInPlaceOpDispatcher {
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_fixed_point<T>()> operator()(Args&&... args)
+  {
+    CUDF_FAIL("FixedPointInPlaceOpDispatcher only for fixed_point");
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_fixed_point<T>()> operator()(column_view const& input,
+                                                         cudf::unary_operator op,
+                                                         mutable_column_view& output,
+                                                         rmm::cuda_stream_view stream)
+  {
+    // clang-format off
+    switch (op) {
+      case cudf::unary_operator::CEIL:  return unary_op_with<T, fixed_point_ceil>(input, output, stream);
+      case cudf::unary_operator::FLOOR: return unary_op_with<T, fixed_point_floor>(input, output, stream);
+      case cudf::unary_operator::ABS:   return unary_op_with<T, fixed_point_abs>(input, output, stream);
+      default: CUDF_FAIL("Unsupported fixed_point unary operation");
+    }
+    // clang-format on
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
@@ -644,6 +730,53 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   }
 }
 
+void unary_operation(cudf::column_view const& input,
+                     cudf::unary_operator op,
+                     cudf::mutable_column_view& output,
+                     rmm::cuda_stream_view stream)
+{
+  auto const output_type =
+    (op == cudf::unary_operator::NOT) ? data_type{type_id::BOOL8} : input.type();
+  CUDF_EXPECTS(output.type() == output_type, "Output type mismatch");
+  expects_elementwise_output(input, output);
+
+  if (cudf::is_fixed_point(input.type())) {
+    type_dispatcher(input.type(), FixedPointInPlaceOpDispatcher{}, input, op, output, stream);
+    return;
+  }
+
+  switch (op) {
+    case cudf::unary_operator::SIN: return apply_in_place<DeviceSin>(input, output, stream);
+    case cudf::unary_operator::COS: return apply_in_place<DeviceCos>(input, output, stream);
+    case cudf::unary_operator::TAN: return apply_in_place<DeviceTan>(input, output, stream);
+    case cudf::unary_operator::ARCSIN: return apply_in_place<DeviceArcSin>(input, output, stream);
+    case cudf::unary_operator::ARCCOS: return apply_in_place<DeviceArcCos>(input, output, stream);
+    case cudf::unary_operator::ARCTAN: return apply_in_place<DeviceArcTan>(input, output, stream);
+    case cudf::unary_operator::SINH: return apply_in_place<DeviceSinH>(input, output, stream);
+    case cudf::unary_operator::COSH: return apply_in_place<DeviceCosH>(input, output, stream);
+    case cudf::unary_operator::TANH: return apply_in_place<DeviceTanH>(input, output, stream);
+    case cudf::unary_operator::ARCSINH: return apply_in_place<DeviceArcSinH>(input, output, stream);
+    case cudf::unary_operator::ARCCOSH: return apply_in_place<DeviceArcCosH>(input, output, stream);
+    case cudf::unary_operator::ARCTANH: return apply_in_place<DeviceArcTanH>(input, output, stream);
+    case cudf::unary_operator::EXP: return apply_in_place<DeviceExp>(input, output, stream);
+    case cudf::unary_operator::LOG: return apply_in_place<DeviceLog>(input, output, stream);
+    case cudf::unary_operator::SQRT: return apply_in_place<DeviceSqrt>(input, output, stream);
+    case cudf::unary_operator::CBRT: return apply_in_place<DeviceCbrt>(input, output, stream);
+    case cudf::unary_operator::CEIL: return apply_in_place<DeviceCeil>(input, output, stream);
+    case cudf::unary_operator::FLOOR: return apply_in_place<DeviceFloor>(input, output, stream);
+    case cudf::unary_operator::ABS: return apply_in_place<DeviceAbs>(input, output, stream);
+    case cudf::unary_operator::RINT:
+      CUDF_EXPECTS(
+        (input.type().id() == type_id::FLOAT32) or (input.type().id() == type_id::FLOAT64),
+        "rint expects floating point values");
+      return apply_in_place<DeviceRInt>(input, output, stream);
+    case cudf::unary_operator::BIT_INVERT:
+      return apply_in_place<DeviceInvert, std::is_integral>(input, output, stream);
+    case cudf::unary_operator::NOT: return apply_in_place<DeviceNot>(input, output, stream);
+    default: CUDF_FAIL("Undefined unary operation");
+  }
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
@@ -654,4 +787,12 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   return detail::unary_operation(input, op, rmm::cuda_stream_default, mr);
 }
 
+void unary_operation(cudf::column_view const& input,
+                     cudf::unary_operator op,
+                     cudf::mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::unary_operation(input, op, output, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
@@ -18,6 +18,15 @@
 
 namespace cudf {
 
+rmm::cuda_stream_view get_default_stream()
+{
+#ifdef CUDA_API_PER_THREAD_DEFAULT_STREAM
+  return rmm::cuda_stream_per_thread;
+#else
+  return rmm::cuda_stream_default;
+#endif
+}
+
 /**
  * @brief Check if per-thread default stream is enabled.
  *
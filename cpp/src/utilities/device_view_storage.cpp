@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/device_view_storage.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+struct device_view_storage::block {
+  int device;
+  std::size_t size;
+  rmm::mr::device_memory_resource* mr;  ///< Resource of the device memory
+  void* host_data{};
+  void* device_data{};
+  cudaEvent_t released{};  ///< Recorded on the stream of the last storage when it was destroyed
+
+  block(int device_id, std::size_t block_size, rmm::cuda_stream_view stream)
+    : device{device_id}, size{block_size}, mr{rmm::mr::get_current_device_resource()}
+  {
+    CUDA_TRY(cudaMallocHost(&host_data, size));
+    try {
+      device_data = mr->allocate(size, stream);
+      CUDA_TRY(cudaEventCreateWithFlags(&released, cudaEventDisableTiming));
+    } catch (...) {
+      if (device_data != nullptr) { mr->deallocate(device_data, size, stream); }
+      cudaFreeHost(host_data);
+      throw;
+    }
+  }
+
+  block(block const&) = delete;
+  block& operator=(block const&) = delete;
+
+  /**
+   * @brief Frees the memory of the block, the device memory after the work enqueued on `stream`.
+   *
+   * The host memory is only read by copies that are waited for, so it can be freed right away.
+   */
+  void free(rmm::cuda_stream_view stream) noexcept
+  {
+    int current_device;
+    cudaGetDevice(&current_device);
+    if (current_device != device) { cudaSetDevice(device); }
+    cudaEventDestroy(released);
+    mr->deallocate(device_data, size, stream);
+    cudaFreeHost(host_data);
+    if (current_device != device) { cudaSetDevice(current_device); }
+  }
+};
+
+namespace {
+
+// Blocks are sized in powers of two, from the size of a few column descriptors
+constexpr std::size_t min_block_size = 256;
+
+// Larger blocks, needed by tables of thousands of columns, are not kept
+constexpr std::size_t max_cached_block_size = 1 << 20;
+
+// Default maximum number of bytes of the idle blocks of all devices
+constexpr std::size_t default_cache_limit = 16 << 20;
+
+std::size_t block_size_for(std::size_t size)
+{
+  std::size_t block_size = min_block_size;
+  while (block_size < size) {
+    block_size *= 2;
+  }
+  return block_size;
+}
+
+/**
+ * @brief Idle blocks, by device, memory resource and size
+ */
+class block_cache {
+ public:
+  device_view_storage::block* acquire(std::size_t size, rmm::cuda_stream_view stream)
+  {
+    int device;
+    CUDA_TRY(cudaGetDevice(&device));
+    auto const block_size = block_size_for(size);
+    if (block_size <= max_cached_block_size) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto& idle = _idle[{device, rmm::mr::get_current_device_resource(), block_size}];
+      // A block can be reused once the work that used its descriptors is done; the host memory
+      // is overwritten right away, so this holds even on the stream that released it
+      for (auto it = idle.begin(); it != idle.end(); ++it) {
+        if (cudaEventQuery((*it)->released) == cudaSuccess) {
+          auto* const reused = *it;
+          *it                = idle.back();
+          idle.pop_back();
+          _cached_bytes -= block_size;
+          return reused;
+        }
+      }
+    }
+    return new device_view_storage::block(device, block_size, stream);
+  }
+
+  void release(device_view_storage::block* block, rmm::cuda_stream_view stream)
+  {
+    if (block->size <= max_cached_block_size &&
+        cudaEventRecord(block->released, stream.value()) == cudaSuccess) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_cached_bytes + block->size <= _limit) {
+        _idle[{block->device, block->mr, block->size}].push_back(block);
+        _cached_bytes += block->size;
+        return;
+      }
+    }
+    // Not kept, so the device memory is freed once the work on the stream is done
+    block->free(stream);
+    delete block;
+  }
+
+  std::size_t set_limit(std::size_t bytes)
+  {
+    std::size_t previous;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      previous = _limit;
+      _limit   = bytes;
+    }
+    trim();
+    return previous;
+  }
+
+  void flush()
+  {
+    std::vector<device_view_storage::block*> evicted;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for (auto& entry : _idle) {
+        evicted.insert(evicted.end(), entry.second.begin(), entry.second.end());
+      }
+      _idle.clear();
+      _cached_bytes = 0;
+    }
+    free_idle(evicted);
+  }
+
+ private:
+  using key_type = std::tuple<int, rmm::mr::device_memory_resource*, std::size_t>;
+
+  /**
+   * @brief Frees idle blocks until their total size is within the limit.
+   */
+  void trim()
+  {
+    std::vector<device_view_storage::block*> evicted;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for (auto it = _idle.begin(); it != _idle.end() && _cached_bytes > _limit;) {
+        auto& idle = it->second;
+        while (not idle.empty() && _cached_bytes > _limit) {
+          _cached_bytes -= idle.back()->size;
+          evicted.push_back(idle.back());
+          idle.pop_back();
+        }
+        it = idle.empty() ? _idle.erase(it) : std::next(it);
+      }
+    }
+    free_idle(evicted);
+  }
+
+  /**
+   * @brief Frees blocks removed from the cache, once the work on their last stream is done.
+   *
+   * That stream may no longer exist, so the release event is waited for instead.
+   */
+  static void free_idle(std::vector<device_view_storage::block*> const& blocks)
+  {
+    for (auto* const block : blocks) {
+      cudaEventSynchronize(block->released);
+      block->free(rmm::cuda_stream_default);
+      delete block;
+    }
+  }
+
+  std::mutex _mutex;
+  std::map<key_type, std::vector<device_view_storage::block*>> _idle;
+  std::size_t _cached_bytes = 0;
+  std::size_t _limit        = default_cache_limit;
+};
+
+// Never destroyed, as the CUDA runtime may already be shut down when static objects are
+block_cache& get_block_cache()
+{
+  static auto* cache = new block_cache{};
+  return *cache;
+}
+
+}  // namespace
+
+device_view_storage::device_view_storage(std::size_t size, rmm::cuda_stream_view stream)
+  : _block{get_block_cache().acquire(size, stream)}, _stream{stream}
+{
+}
+
+device_view_storage::~device_view_storage() { get_block_cache().release(_block, _stream); }
+
+void* device_view_storage::host_data() const noexcept { return _block->host_data; }
+
+void* device_view_storage::device_data() const noexcept { return _block->device_data; }
+
+void device_view_storage::copy_to_device(std::size_t offset, std::size_t size) const
+{
+  CUDA_TRY(cudaMemcpyAsync(static_cast<char*>(_block->device_data) + offset,
+                           static_cast<char const*>(_block->host_data) + offset,
+                           size,
+                           cudaMemcpyHostToDevice,
+                           _stream.value()));
+  _stream.synchronize();
+}
+
+std::size_t set_device_view_storage_cache_limit(std::size_t bytes)
+{
+  return get_block_cache().set_limit(bytes);
+}
+
+void flush_device_view_storage_cache() { get_block_cache().flush(); }
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/metrics.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/metrics.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+namespace cudf {
+namespace {
+std::atomic<bool> enabled{false};
+
+std::mutex registry_mutex;
+std::map<std::string, operation_metrics> registry;
+
+/// Innermost scope of the calling thread
+thread_local detail::metrics_scope* current_scope{nullptr};
+
+/**
+ * @brief Returns the fields of `operation_metrics` with their names.
+ */
+std::vector<std::pair<char const*, std::size_t>> fields(operation_metrics const& m)
+{
+  return {{"calls", m.calls},
+          {"wall_time_ns", static_cast<std::size_t>(m.wall_time_ns)},
+          {"input_bytes", m.input_bytes},
+          {"output_bytes", m.output_bytes},
+          {"input_rows", m.input_rows},
+          {"output_rows", m.output_rows},
+          {"peak_temp_bytes", m.peak_temp_bytes}};
+}
+}  // namespace
+
+void enable_metrics(bool enable) { enabled.store(enable); }
+
+bool metrics_enabled() { return enabled.load(std::memory_order_relaxed); }
+
+std::map<std::string, operation_metrics> get_metrics()
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  return registry;
+}
+
+void reset_metrics()
+{
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  registry.clear();
+}
+
+std::string metrics_to_json()
+{
+  std::ostringstream out;
+  out << "{";
+  auto const metrics = get_metrics();
+  for (auto it = metrics.begin(); it != metrics.end(); ++it) {
+    if (it != metrics.begin()) { out << ", "; }
+    // the operation names are C++ identifiers, which need no escaping
+    out << "\"" << it->first << "\": {";
+    auto const values = fields(it->second);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      out << (i > 0 ? ", " : "") << "\"" << values[i].first << "\": " << values[i].second;
+    }
+    out << "}";
+  }
+  out << "}";
+  return out.str();
+}
+
+std::string metrics_to_prometheus()
+{
+  std::ostringstream out;
+  auto const metrics = get_metrics();
+  for (auto const& field : fields(operation_metrics{})) {
+    std::string const name{field.first};
+    auto const is_gauge = name == "peak_temp_bytes";
+    auto const metric   = "libcudf_" + name + (is_gauge ? "" : "_total");
+    out << "# TYPE " << metric << (is_gauge ? " gauge" : " counter") << "\n";
+    for (auto const& op : metrics) {
+      auto const values = fields(op.second);
+      auto const value  = std::find_if(values.begin(), values.end(), [&](auto const& v) {
+        return name == v.first;
+      });
+      out << metric << "{operation=\"" << op.first << "\"} " << value->second << "\n";
+    }
+  }
+  return out.str();
+}
+
+void metrics_resource_adaptor::update_peak(std::size_t bytes) noexcept
+{
+  auto peak = _peak.load();
+  while (peak < bytes and not _peak.compare_exchange_weak(peak, bytes)) {}
+}
+
+void* metrics_resource_adaptor::do_allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  auto ptr = _upstream->allocate(bytes, stream);
+  update_peak(_allocated.fetch_add(bytes) + bytes);
+  _num_allocations.fetch_add(1, std::memory_order_relaxed);
+  return ptr;
+}
+
+void metrics_resource_adaptor::do_deallocate(void* ptr,
+                                             std::size_t bytes,
+                                             rmm::cuda_stream_view stream)
+{
+  _upstream->deallocate(ptr, bytes, stream);
+  _allocated.fetch_sub(bytes);
+}
+
+namespace detail {
+metrics_scope::metrics_scope(char const* name) : _name{name}, _enabled{metrics_enabled()}
+{
+  // a public API calling a detail API of the same name is recorded once
+  if (_enabled and current_scope != nullptr and std::strcmp(current_scope->_name, name) == 0) {
+    _enabled = false;
+  }
+  if (not _enabled) { return; }
+  _parent       = current_scope;
+  current_scope = this;
+
+  // the peak of the adaptor restarts at the current allocation, and is restored at the end so
+  // that the enclosing scopes still see the allocations of this one
+  _mr = dynamic_cast<metrics_resource_adaptor*>(rmm::mr::get_current_device_resource());
+  if (_mr != nullptr) {
+    _allocated_at_start = _mr->allocated_bytes();
+    _peak_before_start  = _mr->reset_peak(_allocated_at_start);
+  }
+  _start = std::chrono::steady_clock::now();
+}
+
+metrics_scope::~metrics_scope()
+{
+  if (not _enabled) { return; }
+  current_scope = _parent;
+
+  _metrics.calls        = 1;
+  _metrics.wall_time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - _start)
+                            .count();
+  if (_mr != nullptr) {
+    auto const peak = _mr->peak_bytes();
+    _metrics.peak_temp_bytes =
+      peak > _allocated_at_start ? peak - _allocated_at_start : std::size_t{0};
+    _mr->update_peak(_peak_before_start);
+  }
+
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto& total = registry[_name];
+  total.calls += _metrics.calls;
+  total.wall_time_ns += _metrics.wall_time_ns;
+  total.input_bytes += _metrics.input_bytes;
+  total.output_bytes += _metrics.output_bytes;
+  total.input_rows += _metrics.input_rows;
+  total.output_rows += _metrics.output_rows;
+  total.peak_temp_bytes = std::max(total.peak_temp_bytes, _metrics.peak_temp_bytes);
+}
+
+std::size_t device_buffer_bytes(column_view const& input)
+{
+  auto const data_bytes = is_fixed_width(input.type()) ? input.size() * size_of(input.type()) : 0;
+  auto const mask_bytes = input.nullable() ? bitmask_allocation_size_bytes(input.size()) : 0;
+  return std::accumulate(input.child_begin(),
+                         input.child_end(),
+                         data_bytes + mask_bytes,
+                         [](std::size_t bytes, column_view const& child) {
+                           return bytes + device_buffer_bytes(child);
+                         });
+}
+
+namespace {
+std::size_t device_buffer_bytes(table_view const& input)
+{
+  return std::accumulate(
+    input.begin(), input.end(), std::size_t{0}, [](std::size_t bytes, column_view const& col) {
+      return bytes + device_buffer_bytes(col);
+    });
+}
+}  // namespace
+
+void record_input(column_view const& input)
+{
+  if (current_scope == nullptr) { return; }
+  current_scope->_metrics.input_bytes += device_buffer_bytes(input);
+  current_scope->_metrics.input_rows += input.size();
+}
+
+void record_input(table_view const& input)
+{
+  if (current_scope == nullptr) { return; }
+  current_scope->_metrics.input_bytes += device_buffer_bytes(input);
+  current_scope->_metrics.input_rows += input.num_rows();
+}
+
+void record_output(column_view const& output)
+{
+  if (current_scope == nullptr) { return; }
+  current_scope->_metrics.output_bytes += device_buffer_bytes(output);
+  current_scope->_metrics.output_rows += output.size();
+}
+
+void record_output(table_view const& output)
+{
+  if (current_scope == nullptr) { return; }
+  current_scope->_metrics.output_bytes += device_buffer_bytes(output);
+  current_scope->_metrics.output_rows += output.num_rows();
+}
+
+}  // namespace detail
+}  // namespace cudf
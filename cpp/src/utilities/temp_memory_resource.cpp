@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <atomic>
+
+namespace cudf {
+namespace {
+std::atomic<rmm::mr::device_memory_resource*> global_temp_resource{nullptr};
+
+/// Resource of the innermost `temp_resource_scope` of the calling thread
+thread_local rmm::mr::device_memory_resource* scoped_temp_resource{nullptr};
+}  // namespace
+
+rmm::mr::device_memory_resource* get_current_temp_resource()
+{
+  if (scoped_temp_resource != nullptr) { return scoped_temp_resource; }
+  auto* const mr = global_temp_resource.load(std::memory_order_relaxed);
+  return mr != nullptr ? mr : rmm::mr::get_current_device_resource();
+}
+
+rmm::mr::device_memory_resource* set_current_temp_resource(rmm::mr::device_memory_resource* mr)
+{
+  return global_temp_resource.exchange(mr);
+}
+
+temp_resource_scope::temp_resource_scope(rmm::mr::device_memory_resource* mr)
+  : _previous{scoped_temp_resource}
+{
+  scoped_temp_resource = mr;
+}
+
+temp_resource_scope::~temp_resource_scope() { scoped_temp_resource = _previous; }
+
+}  // namespace cudf
@@ -18,9 +18,12 @@
 #include <cudf/ast/transform.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -343,4 +346,343 @@ TEST_F(TransformTest, PyMod)
   cudf::test::expect_columns_equal(expected, result->view(), true);
 }
 
+
+TEST_F(TransformTest, JitTreeArithmetic)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto c_2   = column_wrapper<int32_t>{-3, 66, 2, -99};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto col_ref_2     = cudf::ast::column_reference(2);
+  auto literal_value = cudf::numeric_scalar<int32_t>(7);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto expression_left_subtree =
+    cudf::ast::expression(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto expression_right_subtree =
+    cudf::ast::expression(cudf::ast::ast_operator::PYMOD, col_ref_2, literal);
+  auto expression_tree = cudf::ast::expression(
+    cudf::ast::ast_operator::MUL, expression_left_subtree, expression_right_subtree);
+
+  auto expected = column_wrapper<int32_t>{52, 81, 42, 300};
+  // the first evaluations are interpreted while the kernel is compiled
+  for (int iteration = 0; iteration < 3; ++iteration) {
+    auto result =
+      cudf::ast::compute_column(table, expression_tree, cudf::ast::evaluation_mode::JIT);
+    cudf::test::expect_columns_equal(expected, result->view(), true);
+  }
+}
+
+TEST_F(TransformTest, JitUnaryOperations)
+{
+  auto c_0   = column_wrapper<float>{0.0, -2.5, 4.0};
+  auto c_1   = column_wrapper<int32_t>{-3, 2, 5};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+
+  auto expression_abs     = cudf::ast::expression(cudf::ast::ast_operator::ABS, col_ref_0);
+  auto expression_sqrt    = cudf::ast::expression(cudf::ast::ast_operator::SQRT, expression_abs);
+  auto expression_int_abs = cudf::ast::expression(cudf::ast::ast_operator::ABS, col_ref_1);
+  auto expression_true_div =
+    cudf::ast::expression(cudf::ast::ast_operator::TRUE_DIV, expression_int_abs, col_ref_1);
+
+  auto expected_sqrt     = column_wrapper<float>{0.0, std::sqrt(2.5f), 2.0};
+  auto expected_true_div = column_wrapper<double>{-1.0, 1.0, 1.0};
+  for (int iteration = 0; iteration < 3; ++iteration) {
+    auto result_sqrt =
+      cudf::ast::compute_column(table, expression_sqrt, cudf::ast::evaluation_mode::JIT);
+    cudf::test::expect_columns_equivalent(expected_sqrt, result_sqrt->view(), true);
+    auto result_true_div =
+      cudf::ast::compute_column(table, expression_true_div, cudf::ast::evaluation_mode::JIT);
+    cudf::test::expect_columns_equivalent(expected_true_div, result_true_div->view(), true);
+  }
+}
+
+TEST_F(TransformTest, JitStringComparison)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"a", "bb", "ccc", "dddd"});
+  auto c_1   = cudf::test::strings_column_wrapper({"aa", "b", "cccc", "ddd"});
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+
+  // strings are not supported by the generated code and are always interpreted
+  auto expected = column_wrapper<bool>{true, false, true, false};
+  auto result   = cudf::ast::compute_column(table, expression, cudf::ast::evaluation_mode::JIT);
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, NullPropagation)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{{10, 7, 20, 0}, {1, 1, 0, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+
+  auto expected = column_wrapper<int32_t>{{13, 0, 0, 50}, {1, 0, 0, 1}};
+  auto result   = cudf::ast::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, NullLiteral)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(41, false);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::GREATER, col_ref_0, literal);
+
+  auto result   = cudf::ast::compute_column(table, expression);
+  auto expected = column_wrapper<bool>{{false, false, false, false}, {0, 0, 0, 0}};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, NullLogicalKleene)
+{
+  auto c_0 = column_wrapper<bool>{{true, true, true, false, false, false, true, true, true},
+                                  {1, 1, 1, 1, 1, 1, 0, 0, 0}};
+  auto c_1 = column_wrapper<bool>{{true, false, true, true, false, true, true, false, true},
+                                  {1, 1, 0, 1, 1, 0, 1, 1, 0}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+
+  auto expression_and =
+    cudf::ast::expression(cudf::ast::ast_operator::NULL_LOGICAL_AND, col_ref_0, col_ref_1);
+  auto expected_and =
+    column_wrapper<bool>{{true, false, false, false, false, false, false, false, false},
+                         {1, 1, 0, 1, 1, 1, 0, 1, 0}};
+  auto result_and = cudf::ast::compute_column(table, expression_and);
+  cudf::test::expect_columns_equal(expected_and, result_and->view(), true);
+
+  auto expression_or =
+    cudf::ast::expression(cudf::ast::ast_operator::NULL_LOGICAL_OR, col_ref_0, col_ref_1);
+  auto expected_or =
+    column_wrapper<bool>{{true, true, true, true, false, false, true, false, false},
+                         {1, 1, 1, 1, 1, 0, 1, 0, 0}};
+  auto result_or = cudf::ast::compute_column(table, expression_or);
+  cudf::test::expect_columns_equal(expected_or, result_or->view(), true);
+
+  // the nulls of the operands of LOGICAL_AND propagate
+  auto expression_logical_and =
+    cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_AND, col_ref_0, col_ref_1);
+  auto expected_logical_and =
+    column_wrapper<bool>{{true, false, false, false, false, false, false, false, false},
+                         {1, 1, 0, 1, 1, 0, 0, 0, 0}};
+  auto result_logical_and = cudf::ast::compute_column(table, expression_logical_and);
+  cudf::test::expect_columns_equal(expected_logical_and, result_logical_and->view(), true);
+}
+
+TEST_F(TransformTest, IsNull)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 0}};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(10);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto expression_is_null = cudf::ast::expression(cudf::ast::ast_operator::IS_NULL, col_ref_0);
+  auto expected_is_null   = column_wrapper<bool>{false, true, false, true};
+  auto result_is_null     = cudf::ast::compute_column(table, expression_is_null);
+  cudf::test::expect_columns_equivalent(expected_is_null, result_is_null->view(), true);
+
+  // filter of the rows that are null or less than a value, in a single pass
+  auto expression_less = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, literal);
+  auto expression_filter = cudf::ast::expression(
+    cudf::ast::ast_operator::NULL_LOGICAL_OR, expression_is_null, expression_less);
+  auto expected_filter = column_wrapper<bool>{true, true, true, true};
+  auto result_filter   = cudf::ast::compute_column(table, expression_filter);
+  cudf::test::expect_columns_equivalent(expected_filter, result_filter->view(), true);
+}
+
+TEST_F(TransformTest, SharedSubexpression)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  // the sum is evaluated once and used twice
+  auto col_ref_0      = cudf::ast::column_reference(0);
+  auto col_ref_1      = cudf::ast::column_reference(1);
+  auto expression_sum = cudf::ast::expression(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto expression =
+    cudf::ast::expression(cudf::ast::ast_operator::MUL, expression_sum, expression_sum);
+
+  auto expected = column_wrapper<int32_t>{169, 729, 441, 2500};
+  auto result   = cudf::ast::compute_column(table, expression);
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, ComputeColumns)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto c_2   = column_wrapper<int32_t>{1, 2, 3, 4};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0      = cudf::ast::column_reference(0);
+  auto col_ref_1      = cudf::ast::column_reference(1);
+  auto col_ref_2      = cudf::ast::column_reference(2);
+  auto literal_value  = cudf::numeric_scalar<int32_t>(30);
+  auto literal        = cudf::ast::literal(literal_value);
+  auto expression_mul = cudf::ast::expression(cudf::ast::ast_operator::MUL, col_ref_0, col_ref_1);
+  auto expression_add =
+    cudf::ast::expression(cudf::ast::ast_operator::ADD, expression_mul, col_ref_2);
+  auto expression_greater =
+    cudf::ast::expression(cudf::ast::ast_operator::GREATER, expression_mul, literal);
+
+  auto expected_mul     = column_wrapper<int32_t>{30, 140, 20, 0};
+  auto expected_add     = column_wrapper<int32_t>{31, 142, 23, 4};
+  auto expected_greater = column_wrapper<bool>{false, true, false, false};
+  auto result           = cudf::ast::compute_columns(
+    table, {expression_mul, expression_add, expression_greater});
+  ASSERT_EQ(result->num_columns(), 3);
+  cudf::test::expect_columns_equal(expected_mul, result->get_column(0).view(), true);
+  cudf::test::expect_columns_equal(expected_add, result->get_column(1).view(), true);
+  cudf::test::expect_columns_equal(expected_greater, result->get_column(2).view(), true);
+
+  // the order of the expressions does not change their results
+  auto result_reversed = cudf::ast::compute_columns(
+    table, {expression_greater, expression_add, expression_mul, expression_mul});
+  ASSERT_EQ(result_reversed->num_columns(), 4);
+  cudf::test::expect_columns_equal(expected_greater, result_reversed->get_column(0).view(), true);
+  cudf::test::expect_columns_equal(expected_add, result_reversed->get_column(1).view(), true);
+  cudf::test::expect_columns_equal(expected_mul, result_reversed->get_column(2).view(), true);
+  cudf::test::expect_columns_equal(expected_mul, result_reversed->get_column(3).view(), true);
+
+  EXPECT_THROW(cudf::ast::compute_columns(table, {}), cudf::logic_error);
+}
+
+TEST_F(TransformTest, ComputeColumnsNulls)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 1, 0, 1}};
+  auto c_1   = column_wrapper<int32_t>{{10, 7, 20, 0}, {1, 0, 1, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0      = cudf::ast::column_reference(0);
+  auto col_ref_1      = cudf::ast::column_reference(1);
+  auto expression_sub = cudf::ast::expression(cudf::ast::ast_operator::SUB, col_ref_0, col_ref_1);
+  auto expression_is_null = cudf::ast::expression(cudf::ast::ast_operator::IS_NULL, expression_sub);
+
+  auto expected_sub     = column_wrapper<int32_t>{{-7, 0, 0, 50}, {1, 0, 0, 1}};
+  auto expected_is_null = column_wrapper<bool>{false, true, true, false};
+  auto result           = cudf::ast::compute_columns(table, {expression_sub, expression_is_null});
+  cudf::test::expect_columns_equivalent(expected_sub, result->get_column(0).view(), true);
+  cudf::test::expect_columns_equivalent(expected_is_null, result->get_column(1).view(), true);
+}
+
+TEST_F(TransformTest, Filter)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = cudf::test::strings_column_wrapper({"a", "bb", "ccc", "dddd"});
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(10);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto expression    = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, literal);
+
+  auto expected_0 = column_wrapper<int32_t>{3, 1};
+  auto expected_1 = cudf::test::strings_column_wrapper({"a", "ccc"});
+  auto result     = cudf::ast::filter(table, expression);
+  cudf::test::expect_tables_equal(cudf::table_view{{expected_0, expected_1}}, result->view());
+}
+
+TEST_F(TransformTest, FilterManyRows)
+{
+  auto elements = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto c_0      = column_wrapper<int32_t>(elements, elements + 1000);
+  auto table    = cudf::table_view{{c_0}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(3);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto expression_mod = cudf::ast::expression(cudf::ast::ast_operator::PYMOD, col_ref_0, literal);
+  auto literal_zero_value = cudf::numeric_scalar<int32_t>(0);
+  auto literal_zero       = cudf::ast::literal(literal_zero_value);
+  auto expression =
+    cudf::ast::expression(cudf::ast::ast_operator::EQUAL, expression_mod, literal_zero);
+
+  auto expected_elements =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 3 * i; });
+  auto expected = column_wrapper<int32_t>(expected_elements, expected_elements + 334);
+  auto result   = cudf::ast::filter(table, expression);
+  cudf::test::expect_tables_equal(cudf::table_view{{expected}}, result->view());
+}
+
+TEST_F(TransformTest, FilterNulls)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 1, 0, 1}};
+  auto c_1   = column_wrapper<int32_t>{{10, 7, 20, 0}, {1, 0, 1, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  // rows for which the predicate is null are not selected
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(30);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto expression    = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, literal);
+
+  auto expected_0 = column_wrapper<int32_t>{3, 20};
+  auto expected_1 = column_wrapper<int32_t>{{10, 7}, {1, 0}};
+  auto result     = cudf::ast::filter(table, expression);
+  cudf::test::expect_tables_equivalent(cudf::table_view{{expected_0, expected_1}}, result->view());
+}
+
+TEST_F(TransformTest, ComputeMask)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50, 7}, {1, 1, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0, 4};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  // rows for which the predicate is null have their bit unset
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(10);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto expression    = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, literal);
+
+  auto const mask = cudf::ast::compute_mask(table, expression);
+  EXPECT_EQ(3, mask.second);
+  auto const d_mask = static_cast<cudf::bitmask_type const*>(mask.first->data());
+
+  auto expected_0 = column_wrapper<int32_t>{3, 7};
+  auto expected_1 = column_wrapper<int32_t>{10, 4};
+  auto filtered   = cudf::apply_boolean_mask(table, d_mask);
+  cudf::test::expect_tables_equivalent(cudf::table_view{{expected_0, expected_1}},
+                                       filtered->view());
+
+  auto expected_selected = column_wrapper<int32_t>{{3, 7, 20, 0, 7}, {1, 1, 1, 1, 1}};
+  auto selected          = cudf::copy_if_else(c_0, c_1, d_mask);
+  cudf::test::expect_columns_equivalent(expected_selected, selected->view());
+}
+
+TEST_F(TransformTest, FilterNonBooleanPredicate)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  EXPECT_THROW(cudf::ast::filter(table, expression), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
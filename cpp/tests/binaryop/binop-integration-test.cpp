@@ -19,6 +19,7 @@
 
 #include <cudf/binaryop.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/types.hpp>
@@ -2668,6 +2669,195 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointBinaryOpThrows)
                cudf::logic_error);
 }
 
+struct FixedPointTest128 : public cudf::test::BaseFixture {
+};
+
+TEST_F(FixedPointTest128, FixedPointBinaryOpAddBeyond64Bits)
+{
+  using namespace numeric;
+  using RepType = __int128_t;
+
+  // 10^21 does not fit in the 64-bit representation of decimal64
+  auto const big = static_cast<RepType>(1'000'000'000'000'000'000) * 1000;
+
+  auto const lhs      = fp_wrapper<RepType>{{big, big, -big, 1}, scale_type{-2}};
+  auto const rhs      = fp_wrapper<RepType>{{big, 1, 3, 2}, scale_type{-1}};
+  auto const expected = fp_wrapper<RepType>{{big * 11, big + 10, -big + 30, 21}, scale_type{-2}};
+
+  auto const type =
+    cudf::binary_operation_fixed_point_output_type(cudf::binary_operator::ADD,
+                                                   static_cast<cudf::column_view>(lhs).type(),
+                                                   static_cast<cudf::column_view>(rhs).type());
+  EXPECT_EQ(type, (data_type{type_id::DECIMAL128, -2}));
+  auto const result = cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, type);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(FixedPointTest128, FixedPointBinaryOpMultiplyBeyond64Bits)
+{
+  using namespace numeric;
+  using RepType = __int128_t;
+
+  auto const big = static_cast<RepType>(1'000'000'000'000'000'000);
+
+  auto const lhs      = fp_wrapper<RepType>{{big, -big, 7}, {1, 1, 0}, scale_type{-1}};
+  auto const rhs      = fp_wrapper<RepType>{{1000, 3, 2}, {1, 1, 1}, scale_type{-2}};
+  auto const expected = fp_wrapper<RepType>{{big * 1000, -big * 3, 0}, {1, 1, 0}, scale_type{-3}};
+
+  auto const type =
+    cudf::binary_operation_fixed_point_output_type(cudf::binary_operator::MUL,
+                                                   static_cast<cudf::column_view>(lhs).type(),
+                                                   static_cast<cudf::column_view>(rhs).type());
+  auto const result = cudf::binary_operation(lhs, rhs, cudf::binary_operator::MUL, type);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(FixedPointTest128, FixedPointBinaryOpLessBeyond64Bits)
+{
+  using namespace numeric;
+  using RepType = __int128_t;
+
+  auto const big = static_cast<RepType>(1'000'000'000'000'000'000) * 1000;
+
+  auto const lhs      = fp_wrapper<RepType>{{big, big, -big}, scale_type{0}};
+  auto const rhs      = fp_wrapper<RepType>{{big + 1, big - 1, 0}, scale_type{0}};
+  auto const expected = wrapper<bool>{{1, 0, 1}};
+
+  auto const result =
+    cudf::binary_operation(lhs, rhs, binary_operator::LESS, cudf::data_type{type_id::BOOL8});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(BinaryOperationIntegrationTest, CompiledMixedNumericTypes)
+{
+  auto const lhs      = fixed_width_column_wrapper<int32_t>{{1, -2, 3, 4}, {1, 1, 0, 1}};
+  auto const rhs      = fixed_width_column_wrapper<double>{{0.5, 0.25, 1.0, -4.0}};
+  auto const expected = fixed_width_column_wrapper<double>{{1.5, -1.75, 0.0, 0.0}, {1, 1, 0, 1}};
+  auto const result =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, data_type{type_id::FLOAT64});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+
+  auto const expected_less = fixed_width_column_wrapper<bool>{{0, 1, 0, 0}, {1, 1, 0, 1}};
+  auto const result_less =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::LESS, data_type{type_id::BOOL8});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_less, *result_less);
+}
+
+TEST_F(BinaryOperationIntegrationTest, CompiledChronoTypes)
+{
+  auto const timestamps =
+    fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep>{{10, 20, 30}};
+  auto const durations =
+    fixed_width_column_wrapper<cudf::duration_D, cudf::duration_D::rep>{{1, -2, 3}};
+
+  auto const expected_add =
+    fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep>{{11, 18, 33}};
+  auto const result_add = cudf::binary_operation(
+    timestamps, durations, cudf::binary_operator::ADD, data_type{type_id::TIMESTAMP_DAYS});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_add, *result_add);
+
+  auto const expected_sub =
+    fixed_width_column_wrapper<cudf::duration_D, cudf::duration_D::rep>{{0, 2, -1}};
+  auto const result_sub = cudf::binary_operation(
+    *result_add, timestamps, cudf::binary_operator::SUB, data_type{type_id::DURATION_DAYS});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_sub, *result_sub);
+
+  auto const factor = cudf::numeric_scalar<int32_t>(3);
+  auto const expected_mul =
+    fixed_width_column_wrapper<cudf::duration_D, cudf::duration_D::rep>{{3, -6, 9}};
+  auto const result_mul = cudf::binary_operation(
+    durations, factor, cudf::binary_operator::MUL, data_type{type_id::DURATION_DAYS});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_mul, *result_mul);
+}
+
+TEST_F(BinaryOperationIntegrationTest, CompiledNullMax)
+{
+  auto const lhs      = fixed_width_column_wrapper<int64_t>{{1, 5, 3, 7}, {1, 1, 0, 0}};
+  auto const rhs      = fixed_width_column_wrapper<int64_t>{{4, 2, 6, 8}, {1, 0, 1, 0}};
+  auto const expected = fixed_width_column_wrapper<int64_t>{{4, 5, 6, 0}, {1, 1, 1, 0}};
+  auto const result =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::NULL_MAX, data_type{type_id::INT64});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+}
+
+struct BinaryOperationDictionaryTest : public BinaryOperationTest {
+};
+
+TEST_F(BinaryOperationDictionaryTest, CompareWithScalar)
+{
+  auto const input = strings_column_wrapper{{"fff", "aaa", "ddd", "", "bbb", "fff", "ddd", "aaa"},
+                                            {1, 1, 1, 0, 1, 1, 1, 1}};
+  auto const dictionary = cudf::dictionary::encode(input);
+
+  std::vector<cudf::binary_operator> const ops{cudf::binary_operator::EQUAL,
+                                               cudf::binary_operator::NOT_EQUAL,
+                                               cudf::binary_operator::LESS,
+                                               cudf::binary_operator::GREATER,
+                                               cudf::binary_operator::LESS_EQUAL,
+                                               cudf::binary_operator::GREATER_EQUAL,
+                                               cudf::binary_operator::NULL_EQUALS};
+  auto const bool_type = data_type{type_id::BOOL8};
+  // keys present and missing, before, between and after the dictionary keys
+  for (auto const* key : {"ddd", "ccc", "", "zzz", "aaa", "fff"}) {
+    auto const rhs = cudf::string_scalar(key);
+    for (auto op : ops) {
+      auto const expected = cudf::binary_operation(input, rhs, op, bool_type);
+      auto const result   = cudf::binary_operation(dictionary->view(), rhs, op, bool_type);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected, *result);
+      auto const expected_reversed = cudf::binary_operation(rhs, input, op, bool_type);
+      auto const result_reversed   = cudf::binary_operation(rhs, dictionary->view(), op, bool_type);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected_reversed, *result_reversed);
+    }
+  }
+
+  auto const null_rhs = cudf::string_scalar("", false);
+  for (auto op : ops) {
+    auto const expected = cudf::binary_operation(input, null_rhs, op, bool_type);
+    auto const result   = cudf::binary_operation(dictionary->view(), null_rhs, op, bool_type);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected, *result);
+  }
+
+  EXPECT_THROW(cudf::binary_operation(
+                 dictionary->view(), cudf::string_scalar("a"), cudf::binary_operator::ADD, bool_type),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::binary_operation(dictionary->view(),
+                                      cudf::numeric_scalar<int32_t>(1),
+                                      cudf::binary_operator::EQUAL,
+                                      bool_type),
+               cudf::logic_error);
+}
+
+TEST_F(BinaryOperationDictionaryTest, CompareColumns)
+{
+  auto const lhs = strings_column_wrapper{{"fff", "aaa", "ddd", "", "bbb", "eee"},
+                                          {1, 1, 1, 0, 1, 1}};
+  auto const rhs = strings_column_wrapper{{"fff", "ccc", "aaa", "ddd", "bbb", ""},
+                                          {1, 1, 1, 1, 1, 0}};
+  auto const lhs_dictionary = cudf::dictionary::encode(lhs);
+  auto const rhs_dictionary = cudf::dictionary::encode(rhs);
+
+  auto const bool_type = data_type{type_id::BOOL8};
+  for (auto op : {cudf::binary_operator::EQUAL,
+                  cudf::binary_operator::NOT_EQUAL,
+                  cudf::binary_operator::LESS,
+                  cudf::binary_operator::GREATER_EQUAL,
+                  cudf::binary_operator::NULL_EQUALS}) {
+    auto const expected = cudf::binary_operation(lhs, rhs, op, bool_type);
+    auto const result =
+      cudf::binary_operation(lhs_dictionary->view(), rhs_dictionary->view(), op, bool_type);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected, *result);
+
+    // the same keys are compared without matching them
+    auto const expected_same = cudf::binary_operation(lhs, lhs, op, bool_type);
+    auto const result_same =
+      cudf::binary_operation(lhs_dictionary->view(), lhs_dictionary->view(), op, bool_type);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected_same, *result_same);
+  }
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
@@ -192,6 +192,59 @@ TEST_F(BinaryOperationNullTest, Vector_NonNullable_Vector_NonNullable)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ADD());
 }
 
+TEST_F(BinaryOperationNullTest, Vector_Null_Vector_Null_InPlace)
+{
+  using TypeOut = int32_t;
+  using TypeLhs = int32_t;
+  using TypeRhs = int32_t;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100, mask_state::ALL_VALID);
+  auto rhs = make_random_wrapped_column<TypeRhs>(100, mask_state::ALL_NULL);
+
+  auto const expected =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, data_type(type_to_id<TypeOut>()));
+
+  cudf::column out{lhs};
+  auto output = out.mutable_view();
+  cudf::binary_operation(out.view(), rhs, cudf::binary_operator::ADD, output);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, output);
+}
+
+TEST_F(BinaryOperationNullTest, Scalar_Vector_InPlace)
+{
+  using TypeOut = int32_t;
+  using TypeLhs = int32_t;
+  using TypeRhs = int32_t;
+
+  auto lhs = make_random_wrapped_scalar<TypeLhs>();
+  auto rhs = make_random_wrapped_column<TypeRhs>(100, mask_state::ALL_VALID);
+
+  auto const expected =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::SUB, data_type(type_to_id<TypeOut>()));
+
+  cudf::column out{rhs};
+  auto output = out.mutable_view();
+  cudf::binary_operation(lhs, out.view(), cudf::binary_operator::SUB, output);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, output);
+}
+
+TEST_F(BinaryOperationNullTest, Vector_Null_Scalar_NonNullableOutput)
+{
+  using TypeOut = int32_t;
+  using TypeLhs = int32_t;
+  using TypeRhs = int32_t;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100, mask_state::ALL_NULL);
+  auto rhs = make_random_wrapped_scalar<TypeRhs>();
+  auto out = make_random_wrapped_column<TypeOut>(100, mask_state::UNALLOCATED);
+
+  auto output = cudf::mutable_column_view{out};
+  EXPECT_THROW(cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, output),
+               cudf::logic_error);
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
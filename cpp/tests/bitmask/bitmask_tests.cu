@@ -15,6 +15,7 @@
  */
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -25,6 +26,7 @@
 
 #include <thrust/device_ptr.h>
 #include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <rmm/device_buffer.hpp>
 
 struct BitmaskUtilitiesTest : public cudf::test::BaseFixture {
@@ -234,6 +236,32 @@ TEST_F(CountBitmaskTest, MultipleWordsSingleBit)
   EXPECT_THAT(counts, testing::ContainerEq(std::vector<cudf::size_type>{1, 1, 1}));
 }
 
+TEST_F(CountBitmaskTest, MultipleWordsMisalignedPointers)
+{
+  // Most words have a different number of set bits, so that a miscounted word changes the count
+  std::vector<cudf::bitmask_type> host_mask(40);
+  for (std::size_t i = 0; i < host_mask.size(); ++i) {
+    host_mask[i] = cudf::set_least_significant_bits(i % 32) | (i < 32 ? 0u : 0x80000000u);
+  }
+  thrust::device_vector<cudf::bitmask_type> mask(host_mask);
+  auto count = [&](cudf::size_type begin_word, cudf::size_type end_word) {
+    cudf::size_type expected = 0;
+    for (auto i = begin_word; i < end_word; ++i) {
+      expected += __builtin_popcount(host_mask[i]);
+    }
+    return expected;
+  };
+
+  // Ranges starting at every word offset of a 16-byte vector, with and without whole vectors
+  for (cudf::size_type first = 0; first < 4; ++first) {
+    for (cudf::size_type last : {first + 1, first + 3, first + 7, 38, 40}) {
+      EXPECT_EQ(count(first, last), cudf::count_set_bits(mask.data().get(), first * 32, last * 32));
+      EXPECT_EQ(count(first, last),
+                cudf::count_set_bits(mask.data().get() + first, 0, (last - first) * 32));
+    }
+  }
+}
+
 using CountUnsetBitsTest = CountBitmaskTest;
 
 TEST_F(CountUnsetBitsTest, SingleBitAllSet)
@@ -525,6 +553,34 @@ TEST_F(MergeBitmaskTest, TestBitmaskAnd)
     result3.data(), odd.data(), cudf::num_bitmask_words(input2.num_rows()));
 }
 
+TEST_F(MergeBitmaskTest, TestBitmaskAndNullCount)
+{
+  auto const non_multiples_of_3 =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto const odds = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  auto const data = thrust::make_counting_iterator<int32_t>(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> const col1(data, data + 100, non_multiples_of_3);
+  cudf::test::fixed_width_column_wrapper<int32_t> const col2(data, data + 100, odds);
+
+  auto const [mask, null_count] =
+    cudf::detail::bitmask_and(cudf::table_view({col1, col2}), rmm::cuda_stream_default);
+  // rows valid in both columns are the odd rows that are not multiples of 3
+  EXPECT_EQ(null_count, 100 - 33);
+  EXPECT_EQ(null_count,
+            cudf::count_unset_bits(static_cast<cudf::bitmask_type const*>(mask.data()), 0, 100));
+
+  // the slack bits of the last word of sliced columns are not counted
+  auto const sliced = cudf::slice(cudf::table_view({col1, col2}), {35, 99}).front();
+  auto const [sliced_mask, sliced_null_count] =
+    cudf::detail::bitmask_and(sliced, rmm::cuda_stream_default);
+  auto const sliced_bits = static_cast<cudf::bitmask_type const*>(sliced_mask.data());
+  EXPECT_EQ(sliced_null_count, cudf::count_unset_bits(sliced_bits, 0, 64));
+
+  auto const [or_mask, or_null_count] =
+    cudf::detail::bitmask_or(cudf::table_view({col1, col2}), rmm::cuda_stream_default);
+  EXPECT_EQ(or_null_count, 17);
+}
+
 TEST_F(MergeBitmaskTest, TestBitmaskOr)
 {
   cudf::test::fixed_width_column_wrapper<bool> const bools_col1({0, 1, 0, 1, 1}, {1, 1, 0, 0, 1});
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/bitpacking.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+#include <limits>
+#include <vector>
+
+template <typename T>
+struct BitpackingTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(BitpackingTest, cudf::test::IntegralTypesNotBool);
+
+TYPED_TEST(BitpackingTest, RoundTrip)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T> input{{10, 12, 11, 0, 17, 10, 25},
+                                                  {1, 1, 1, 0, 1, 1, 1}};
+  auto const packed = cudf::bitpack(input);
+  EXPECT_EQ(4, packed->bit_width());
+  EXPECT_EQ(1, packed->null_count());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, cudf::decode(*packed)->view());
+}
+
+TYPED_TEST(BitpackingTest, Extremes)
+{
+  using T = TypeParam;
+
+  auto const min = std::numeric_limits<T>::lowest();
+  auto const max = std::numeric_limits<T>::max();
+  cudf::test::fixed_width_column_wrapper<T> input{max, min, 0, max, 1};
+  auto const packed = cudf::bitpack(input);
+  EXPECT_EQ(static_cast<int>(sizeof(T) * 8), packed->bit_width());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, cudf::decode(*packed)->view());
+}
+
+TYPED_TEST(BitpackingTest, Gather)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T> input{{5, 6, 7, 8, 9}, {1, 0, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> gather_map{4, 1, 0, 4};
+  cudf::test::fixed_width_column_wrapper<T> expected{{9, 0, 5, 9}, {1, 0, 1, 1}};
+  auto const packed = cudf::bitpack(input);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, cudf::decode(*packed, gather_map)->view());
+}
+
+TYPED_TEST(BitpackingTest, Reductions)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T> input{{3, 9, 100, 4, 7}, {1, 1, 0, 1, 1}};
+  auto const packed = cudf::bitpack(input);
+  auto const type   = cudf::data_type{cudf::type_to_id<T>()};
+  auto const int64  = cudf::data_type{cudf::type_id::INT64};
+
+  auto const min = cudf::reduce(*packed, cudf::make_min_aggregation(), type);
+  auto const max = cudf::reduce(*packed, cudf::make_max_aggregation(), type);
+  auto const sum = cudf::reduce(*packed, cudf::make_sum_aggregation(), int64);
+  EXPECT_EQ(T{3}, static_cast<cudf::numeric_scalar<T> const&>(*min).value());
+  EXPECT_EQ(T{9}, static_cast<cudf::numeric_scalar<T> const&>(*max).value());
+  EXPECT_EQ(23, static_cast<cudf::numeric_scalar<int64_t> const&>(*sum).value());
+}
+
+TYPED_TEST(BitpackingTest, CompareWithScalar)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T> input{{20, 23, 21, 0, 27}, {1, 1, 1, 0, 1}};
+  auto const packed = cudf::bitpack(input);
+
+  auto const in_range = cudf::numeric_scalar<T>(21);
+  cudf::test::fixed_width_column_wrapper<bool> less{{1, 0, 0, 0, 0}, {1, 1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<bool> greater_equal{{0, 1, 1, 0, 1}, {1, 1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    less, cudf::binary_operation(*packed, in_range, cudf::binary_operator::LESS)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    greater_equal,
+    cudf::binary_operation(*packed, in_range, cudf::binary_operator::GREATER_EQUAL)->view());
+
+  auto const below = cudf::numeric_scalar<T>(1);
+  cudf::test::fixed_width_column_wrapper<bool> all_true{{1, 1, 1, 0, 1}, {1, 1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    all_true, cudf::binary_operation(*packed, below, cudf::binary_operator::NOT_EQUAL)->view());
+}
+
+struct BitpackingColumnTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(BitpackingColumnTest, EncodedSize)
+{
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return int64_t{1000000} + i % 16; });
+  cudf::test::fixed_width_column_wrapper<int64_t> input(values, values + 10000);
+  auto const packed = cudf::bitpack(input);
+  EXPECT_EQ(4, packed->bit_width());
+  EXPECT_EQ(10000u / 2, packed->encoded_size());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, cudf::decode(*packed)->view());
+}
+
+TEST_F(BitpackingColumnTest, AllNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 3}, {0, 0, 0}};
+  auto const packed = cudf::bitpack(input);
+  EXPECT_EQ(0, packed->bit_width());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, cudf::decode(*packed)->view());
+  auto const sum =
+    cudf::reduce(*packed, cudf::make_sum_aggregation(), cudf::data_type{cudf::type_id::INT64});
+  EXPECT_FALSE(sum->is_valid());
+}
+
+TEST_F(BitpackingColumnTest, InvalidInputs)
+{
+  cudf::test::fixed_width_column_wrapper<float> floats{1.5f, 2.5f};
+  EXPECT_THROW(cudf::bitpack(floats), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> input{1, 2, 3};
+  auto const packed = cudf::bitpack(input);
+  EXPECT_THROW(cudf::reduce(*packed,
+                            cudf::make_product_aggregation(),
+                            cudf::data_type{cudf::type_id::INT64}),
+               cudf::logic_error);
+  EXPECT_THROW(
+    cudf::binary_operation(*packed, cudf::numeric_scalar<int64_t>(1), cudf::binary_operator::LESS),
+    cudf::logic_error);
+  EXPECT_THROW(
+    cudf::binary_operation(*packed, cudf::numeric_scalar<int32_t>(1), cudf::binary_operator::ADD),
+    cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -23,10 +23,16 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/utilities/device_view_storage.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/metrics.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
 
 struct ColumnDeviceViewTest : public cudf::test::BaseFixture {
 };
@@ -65,3 +71,63 @@ TEST_F(ColumnDeviceViewTest, MismatchingType)
                             output_device_view->begin<int64_t>()),
                cudf::logic_error);
 }
+
+TEST_F(ColumnDeviceViewTest, ReusedDescriptorStorage)
+{
+  rmm::cuda_stream_view stream{};
+  // A size that device views of the other tests do not need, so that no other block is idle
+  void* first_block = nullptr;
+  {
+    cudf::detail::device_view_storage storage(300000, stream);
+    first_block = storage.device_data();
+  }
+  stream.synchronize();
+  // Once the work on the stream is done, a block of the same size is reused
+  cudf::detail::device_view_storage storage(280000, stream);
+  EXPECT_EQ(storage.device_data(), first_block);
+}
+
+TEST_F(ColumnDeviceViewTest, DescriptorStorageFromCurrentResource)
+{
+  rmm::cuda_stream_view stream{};
+  cudf::metrics_resource_adaptor mr(rmm::mr::get_current_device_resource());
+  auto const previous = rmm::mr::set_current_device_resource(&mr);
+
+  // The idle block stays allocated from the resource until the cache is flushed
+  { cudf::detail::device_view_storage storage(300000, stream); }
+  EXPECT_EQ(mr.allocated_bytes(), std::size_t{1} << 19);
+  cudf::detail::flush_device_view_storage_cache();
+  EXPECT_EQ(mr.allocated_bytes(), 0u);
+
+  // With a limit of 0, no block is kept
+  auto const previous_limit = cudf::detail::set_device_view_storage_cache_limit(0);
+  { cudf::detail::device_view_storage storage(300000, stream); }
+  EXPECT_EQ(mr.allocated_bytes(), 0u);
+  EXPECT_EQ(mr.num_allocations(), 2u);
+  cudf::detail::set_device_view_storage_cache_limit(previous_limit);
+
+  rmm::mr::set_current_device_resource(previous);
+}
+
+TEST_F(ColumnDeviceViewTest, RepeatedNestedViews)
+{
+  rmm::cuda_stream_view stream{};
+  cudf::test::strings_column_wrapper input({"a", "bb", "", "dddd"}, {1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{1, 2, 0, 4};
+  auto output = cudf::allocate_like(expected);
+  // Each view gets its own descriptors, whether or not their storage is reused
+  for (int i = 0; i < 3; ++i) {
+    auto input_device_view  = cudf::column_device_view::create(input, stream);
+    auto output_device_view = cudf::mutable_column_device_view::create(*output, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<cudf::size_type>(0),
+                      thrust::make_counting_iterator<cudf::size_type>(4),
+                      output_device_view->begin<cudf::size_type>(),
+                      [d_input = *input_device_view] __device__(cudf::size_type idx) {
+                        return d_input.is_null(idx)
+                                 ? 0
+                                 : d_input.element<cudf::string_view>(idx).size_bytes();
+                      });
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, output->view());
+  }
+}
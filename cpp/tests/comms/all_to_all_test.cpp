@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/comms.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Messages sent between the ranks of `in_process_communicator`s, in host memory.
+ */
+struct mailbox {
+  std::mutex mutex;
+  std::condition_variable arrived;
+  std::map<std::pair<int, int>, std::deque<std::vector<uint8_t>>> messages;  ///< By source, dest
+};
+
+/**
+ * @brief Communicator between host threads of the same process, each running one rank.
+ *
+ * Sends complete when they are posted, and receives wait for their message at `group_end`.
+ */
+class in_process_communicator : public cudf::comms::communicator {
+ public:
+  in_process_communicator(mailbox& box, int rank, int size) : _box{box}, _rank{rank}, _size{size}
+  {
+  }
+
+  [[nodiscard]] int rank() const override { return _rank; }
+  [[nodiscard]] int size() const override { return _size; }
+
+  void group_start() override {}
+
+  void group_end() override
+  {
+    for (auto const& posted : _posted_recvs) {
+      std::vector<uint8_t> message;
+      {
+        std::unique_lock<std::mutex> lock(_box.mutex);
+        auto& queue = _box.messages[{posted.peer, _rank}];
+        _box.arrived.wait(lock, [&queue] { return not queue.empty(); });
+        message = std::move(queue.front());
+        queue.pop_front();
+      }
+      CUDF_EXPECTS(message.size() == posted.size, "Mismatch in size of received message");
+      CUDA_TRY(cudaMemcpyAsync(posted.data,
+                               message.data(),
+                               posted.size,
+                               cudaMemcpyHostToDevice,
+                               posted.stream.value()));
+      posted.stream.synchronize();
+    }
+    _posted_recvs.clear();
+  }
+
+  void send(void const* data, std::size_t size, int peer, rmm::cuda_stream_view stream) override
+  {
+    std::vector<uint8_t> message(size);
+    CUDA_TRY(cudaMemcpyAsync(message.data(), data, size, cudaMemcpyDeviceToHost, stream.value()));
+    stream.synchronize();
+    {
+      std::lock_guard<std::mutex> lock(_box.mutex);
+      _box.messages[{_rank, peer}].push_back(std::move(message));
+    }
+    _box.arrived.notify_all();
+  }
+
+  void recv(void* data, std::size_t size, int peer, rmm::cuda_stream_view stream) override
+  {
+    _posted_recvs.push_back({data, size, peer, stream});
+  }
+
+ private:
+  struct posted_recv {
+    void* data;
+    std::size_t size;
+    int peer;
+    rmm::cuda_stream_view stream;
+  };
+
+  mailbox& _box;
+  int _rank;
+  int _size;
+  std::vector<posted_recv> _posted_recvs;
+};
+
+}  // namespace
+
+struct AllToAllTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(AllToAllTest, HashPartitions)
+{
+  constexpr int num_ranks = 3;
+
+  // Every rank hash partitions its own table, whose rows are distinct from the other ranks' rows
+  std::vector<std::unique_ptr<cudf::table>> partitioned;
+  std::vector<std::vector<cudf::size_type>> offsets;
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    auto const sequence = thrust::make_counting_iterator(rank * 100);
+    auto const valid = thrust::make_transform_iterator(sequence, [](auto i) { return i % 7 != 0; });
+    auto const strings =
+      thrust::make_transform_iterator(sequence, [](auto i) { return std::to_string(i); });
+    cudf::test::fixed_width_column_wrapper<int32_t> keys(sequence, sequence + 50, valid);
+    cudf::test::strings_column_wrapper values(strings, strings + 50);
+    auto result = cudf::hash_partition(cudf::table_view({keys, values}), {0}, num_ranks);
+    partitioned.push_back(std::move(result.first));
+    offsets.push_back(std::move(result.second));
+  }
+
+  mailbox box;
+  std::vector<std::vector<cudf::packed_columns>> received(num_ranks);
+  std::vector<std::exception_ptr> errors(num_ranks);
+  std::vector<std::thread> ranks;
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    ranks.emplace_back([&, rank] {
+      try {
+        in_process_communicator comm(box, rank, num_ranks);
+        received[rank] = cudf::comms::all_to_all(comm, partitioned[rank]->view(), offsets[rank]);
+      } catch (...) {
+        errors[rank] = std::current_exception();
+      }
+    });
+  }
+  for (auto& rank : ranks) {
+    rank.join();
+  }
+
+  // Every rank has the partition of its rank of every rank's table
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    if (errors[rank]) { std::rethrow_exception(errors[rank]); }
+    ASSERT_EQ(received[rank].size(), static_cast<std::size_t>(num_ranks));
+    for (int source = 0; source < num_ranks; ++source) {
+      auto const end = rank + 1 < num_ranks ? offsets[source][rank + 1]
+                                            : partitioned[source]->num_rows();
+      auto const expected =
+        cudf::slice(partitioned[source]->view(), {offsets[source][rank], end}).front();
+      CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, cudf::unpack(received[rank][source]));
+    }
+  }
+}
+
+TEST_F(AllToAllTest, SingleRank)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 4}, {1, 0, 1, 1});
+  auto const input = cudf::table_view({keys});
+
+  mailbox box;
+  in_process_communicator comm(box, 0, 1);
+  auto const received = cudf::comms::all_to_all(comm, input, {0});
+  ASSERT_EQ(received.size(), 1u);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, cudf::unpack(received.front()));
+
+  // An empty table has no partition offsets
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_keys{};
+  auto const empty = cudf::comms::all_to_all(comm, cudf::table_view({empty_keys}), {});
+  ASSERT_EQ(empty.size(), 1u);
+  EXPECT_EQ(cudf::unpack(empty.front()).num_rows(), 0);
+}
+
+TEST_F(AllToAllTest, InvalidInputs)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 4});
+  auto const input = cudf::table_view({keys});
+
+  // The inputs are checked before any message is sent
+  mailbox box;
+  in_process_communicator comm(box, 0, 3);
+  EXPECT_THROW(cudf::comms::all_to_all(comm, input, {0, 2}), cudf::logic_error);
+  EXPECT_THROW(cudf::comms::all_to_all(comm, input, {}), cudf::logic_error);
+  EXPECT_THROW(
+    cudf::comms::all_to_all(comm, cudf::table_view(std::vector<cudf::column_view>{}), {}),
+    cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -34,6 +34,8 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/sequence.h>
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 
 template <typename T>
@@ -188,6 +190,30 @@ TEST_F(StringColumnTest, ConcatenateTooManyColumns)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringColumnTest, ConcatenateManySlices)
+{
+  // Thousands of small slices, some empty, and a slice of many rows spanning many tiles of chars
+  cudf::size_type const num_rows = 12000;
+  auto const strings             = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 13, static_cast<char>('a' + i % 26)); });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::strings_column_wrapper input(strings, strings + num_rows, valids);
+
+  std::vector<cudf::size_type> indices;
+  cudf::size_type row = 0;
+  for (int i = 0; row < num_rows; ++i) {
+    auto const end = std::min(num_rows, row + (i == 100 ? 5000 : i % 5));
+    indices.push_back(row);
+    indices.push_back(end);
+    row = end;
+  }
+  auto const slices = cudf::slice(input, indices);
+
+  auto results = cudf::concatenate(slices);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, input);
+}
+
 struct TableTest : public cudf::test::BaseFixture {
 };
 
@@ -1134,6 +1160,35 @@ TEST_F(ListsColumnTest, SlicedColumnsWithNulls)
   }
 }
 
+TEST_F(ListsColumnTest, ManySlicedListsOfStrings)
+{
+  cudf::size_type const num_rows = 3000;
+  // List `i` has `i % 4` strings
+  auto const sizes =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 4; });
+  std::vector<cudf::size_type> h_offsets(num_rows + 1, 0);
+  std::partial_sum(sizes, sizes + num_rows, h_offsets.begin() + 1);
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 5, static_cast<char>('a' + i % 26)); });
+  cudf::test::strings_column_wrapper child(strings, strings + h_offsets.back());
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets(h_offsets.begin(),
+                                                                  h_offsets.end());
+  auto const input = cudf::make_lists_column(num_rows, offsets.release(), child.release(), 0, {});
+
+  std::vector<cudf::size_type> indices;
+  cudf::size_type row = 0;
+  for (int i = 0; row < num_rows; ++i) {
+    auto const end = std::min(num_rows, row + i % 3);
+    indices.push_back(row);
+    indices.push_back(end);
+    row = end;
+  }
+  auto const slices = cudf::slice(input->view(), indices);
+
+  auto results = cudf::concatenate(slices);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, *input);
+}
+
 TEST_F(ListsColumnTest, ListOfStructs)
 {
   using namespace cudf::test;
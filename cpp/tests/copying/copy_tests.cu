@@ -18,6 +18,7 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column.hpp>
@@ -26,6 +27,8 @@
 #include <cudf/detail/copy_if_else.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -76,7 +79,7 @@ struct copy_if_else_tiny_grid_functor {
   {
     // output
     std::unique_ptr<cudf::column> out =
-      cudf::allocate_like(lhs, lhs.size(), cudf::mask_allocation_policy::RETAIN, mr);
+      cudf::allocate_like(lhs, lhs.size(), cudf::mask_allocation_policy::RETAIN, stream, mr);
 
     // device views
     auto lhs_view = cudf::column_device_view::create(lhs);
@@ -335,6 +338,36 @@ TYPED_TEST(CopyTestNumeric, CopyIfElseTestColumnScalar)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(out->view(), expected_w);
 }
 
+TYPED_TEST(CopyTestNumeric, CopyIfElseTestBitmask)
+{
+  using T = TypeParam;
+
+  int num_els = 4;
+
+  bool mask[]   = {1, 0, 0, 1};
+  bool mask_v[] = {1, 1, 0, 1};
+  cudf::test::fixed_width_column_wrapper<bool> mask_w(mask, mask + num_els, mask_v);
+  auto const bitmask   = cudf::bools_to_mask(mask_w);
+  auto const d_bitmask = static_cast<cudf::bitmask_type const*>(bitmask.first->data());
+
+  const auto lhs = cudf::test::make_type_param_vector<T>({5, 5, 5, 5});
+  bool lhs_v[]   = {1, 1, 1, 0};
+  wrapper<T> lhs_w(lhs.begin(), lhs.end(), lhs_v);
+  const auto rhs = cudf::test::make_type_param_vector<T>({6, 6, 6, 6});
+  wrapper<T> rhs_w(rhs.begin(), rhs.end());
+  cudf::numeric_scalar<T> lhs_s(5);
+
+  const auto expected = cudf::test::make_type_param_vector<T>({5, 6, 6, 5});
+  bool expected_v[]   = {1, 1, 1, 0};
+  wrapper<T> expected_w(expected.begin(), expected.end(), expected_v);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::copy_if_else(lhs_w, rhs_w, d_bitmask)->view(), expected_w);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::copy_if_else(lhs_w, rhs_w, mask_w)->view(), expected_w);
+
+  wrapper<T> expected_scalar_w(expected.begin(), expected.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::copy_if_else(lhs_s, rhs_w, d_bitmask)->view(),
+                                 expected_scalar_w);
+}
+
 TYPED_TEST(CopyTestNumeric, CopyIfElseTestScalarScalar)
 {
   using T = TypeParam;
@@ -622,3 +655,82 @@ TYPED_TEST(FixedPointTypes, FixedPointScaleMismatch)
 
   EXPECT_THROW(cudf::copy_if_else(a, b, mask), cudf::logic_error);
 }
+
+struct TableCopyIfElseTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TableCopyIfElseTest, MixedColumns)
+{
+  using namespace numeric;
+  constexpr cudf::size_type num_rows = 70;
+
+  auto const sequence = thrust::make_counting_iterator(0);
+  auto const odd =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2 == 1; });
+  auto const thirds =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 4, static_cast<char>('a' + i % 26)); });
+  auto const reversed = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(num_rows - i); });
+
+  cudf::test::fixed_width_column_wrapper<int32_t> lhs_ints(sequence, sequence + num_rows, odd);
+  cudf::test::fixed_width_column_wrapper<int32_t> rhs_ints(sequence, sequence + num_rows);
+  cudf::test::fixed_width_column_wrapper<double> lhs_doubles(sequence, sequence + num_rows);
+  cudf::test::fixed_width_column_wrapper<double> rhs_doubles(
+    sequence, sequence + num_rows, thirds);
+  cudf::test::fixed_point_column_wrapper<int64_t> lhs_decimals(
+    sequence, sequence + num_rows, scale_type{-2});
+  cudf::test::fixed_point_column_wrapper<int64_t> rhs_decimals(
+    sequence + 1, sequence + 1 + num_rows, scale_type{-2});
+  cudf::test::strings_column_wrapper lhs_strings(strings, strings + num_rows, thirds);
+  cudf::test::strings_column_wrapper rhs_strings(reversed, reversed + num_rows);
+
+  auto const mask_values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 < 2; });
+  auto const mask_valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<bool> mask(
+    mask_values, mask_values + num_rows, mask_valids);
+
+  auto const lhs = cudf::table_view({lhs_ints, lhs_doubles, lhs_decimals, lhs_strings});
+  auto const rhs = cudf::table_view({rhs_ints, rhs_doubles, rhs_decimals, rhs_strings});
+
+  // Every column is selected as by the copy_if_else of its own columns
+  auto const result = cudf::copy_if_else(lhs, rhs, mask);
+  ASSERT_EQ(result->num_columns(), lhs.num_columns());
+  for (cudf::size_type i = 0; i < lhs.num_columns(); ++i) {
+    auto const expected = cudf::copy_if_else(lhs.column(i), rhs.column(i), mask);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->get_column(i).view());
+  }
+
+  auto const bitmask   = cudf::bools_to_mask(mask);
+  auto const d_bitmask = static_cast<cudf::bitmask_type const*>(bitmask.first->data());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), cudf::copy_if_else(lhs, rhs, d_bitmask)->view());
+}
+
+TEST_F(TableCopyIfElseTest, EmptyAndErrors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<float> floats{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<bool> mask{1, 0, 1};
+  cudf::test::fixed_width_column_wrapper<bool> short_mask{1, 0};
+
+  EXPECT_THROW(cudf::copy_if_else(cudf::table_view({ints}), cudf::table_view({floats}), mask),
+               cudf::logic_error);
+  EXPECT_THROW(
+    cudf::copy_if_else(cudf::table_view({ints}), cudf::table_view({ints, ints}), mask),
+    cudf::logic_error);
+  EXPECT_THROW(
+    cudf::copy_if_else(cudf::table_view({ints}), cudf::table_view({ints}), short_mask),
+    cudf::logic_error);
+  EXPECT_THROW(cudf::copy_if_else(cudf::table_view({ints}), cudf::table_view({ints}), ints),
+               cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_ints{};
+  cudf::test::strings_column_wrapper empty_strings{};
+  cudf::test::fixed_width_column_wrapper<bool> empty_mask{};
+  auto const empty  = cudf::table_view({empty_ints, empty_strings});
+  auto const result = cudf::copy_if_else(empty, empty, empty_mask);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(empty, result->view());
+}
@@ -20,6 +20,7 @@
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/table/chunked_table_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -30,6 +31,11 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <rmm/cuda_stream.hpp>
+
+#include <string>
+#include <vector>
+
 template <typename T>
 class GatherTest : public cudf::test::BaseFixture {
 };
@@ -246,3 +252,115 @@ TYPED_TEST(GatherTest, MultiColNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_column, result->view().column(i));
   }
 }
+
+struct GatherWideTableTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GatherWideTableTest, MatchesGatherOfEachColumn)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valid = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  cudf::test::fixed_width_column_wrapper<int8_t> int8_column(data, data + source_size);
+  cudf::test::fixed_width_column_wrapper<int16_t> int16_column(data, data + source_size, valid);
+  cudf::test::fixed_width_column_wrapper<int32_t> int32_column(data, data + source_size + 5);
+  cudf::test::fixed_width_column_wrapper<double> double_column(data, data + source_size, valid);
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>
+    timestamp_column(data, data + source_size);
+  cudf::test::fixed_width_column_wrapper<bool> bool_column(data, data + source_size, valid);
+  std::vector<std::string> strings(source_size);
+  for (cudf::size_type i = 0; i < source_size; ++i) {
+    strings[i] = std::to_string(i);
+  }
+  cudf::test::strings_column_wrapper string_column(strings.begin(), strings.end());
+
+  // A sliced column, and a column of strings between the fixed-width columns
+  auto const sliced_column = cudf::slice(int32_column, {5, source_size + 5}).front();
+  cudf::table_view source_table{{int8_column,
+                                 int16_column,
+                                 string_column,
+                                 sliced_column,
+                                 double_column,
+                                 timestamp_column,
+                                 bool_column}};
+
+  auto map_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i * 7919) % (source_size + 10) - 5; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(map_data, map_data + 800);
+
+  auto const result =
+    cudf::gather(source_table, gather_map, cudf::out_of_bounds_policy::NULLIFY);
+  for (cudf::size_type i = 0; i < source_table.num_columns(); ++i) {
+    auto const expected = cudf::gather(cudf::table_view{{source_table.column(i)}},
+                                       gather_map,
+                                       cudf::out_of_bounds_policy::NULLIFY);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->get_column(0), result->get_column(i));
+  }
+}
+
+struct GatherChunkedTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GatherChunkedTest, MatchesGatherOfConcatenatedChunks)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valid = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  cudf::test::fixed_width_column_wrapper<int32_t> int_column(data, data + source_size, valid);
+  std::vector<std::string> strings(source_size);
+  for (cudf::size_type i = 0; i < source_size; ++i) {
+    strings[i] = std::to_string(i);
+  }
+  cudf::test::strings_column_wrapper string_column(strings.begin(), strings.end());
+  cudf::table_view source_table{{int_column, string_column}};
+
+  // Chunks of different sizes, one of which is empty
+  auto const chunks = cudf::split(source_table, {100, 100, 550, 999});
+  cudf::chunked_table_view chunked_source(chunks);
+  EXPECT_EQ(chunked_source.num_chunks(), 5);
+  EXPECT_EQ(chunked_source.num_rows(), source_size);
+
+  // Rows of every chunk in an arbitrary order, and negative indices
+  auto map_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i * 7919) % source_size - (i % 5 == 0 ? source_size : 0); });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(map_data, map_data + 600);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::gather(source_table, gather_map)->view(),
+                                cudf::gather(chunked_source, gather_map)->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> nullify_map{
+    {5, -1, source_size, 998, 150, -2000, 999, 0}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    cudf::gather(source_table, nullify_map, cudf::out_of_bounds_policy::NULLIFY)->view(),
+    cudf::gather(chunked_source, nullify_map, cudf::out_of_bounds_policy::NULLIFY)->view());
+}
+
+TEST_F(GatherChunkedTest, InvalidChunks)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> int_column{{1, 2, 3}};
+  cudf::test::fixed_width_column_wrapper<float> float_column{{1, 2, 3}};
+
+  EXPECT_THROW(cudf::chunked_table_view(std::vector<cudf::table_view>{}), cudf::logic_error);
+  EXPECT_THROW(cudf::chunked_table_view({cudf::table_view{{int_column}},
+                                         cudf::table_view{{float_column}}}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::chunked_column_view({int_column, float_column}), cudf::logic_error);
+}
+
+struct GatherStreamTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GatherStreamTest, MatchesGatherOnDefaultStream)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> int_column{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper string_column{"a", "bb", "", "dddd"};
+  cudf::table_view source_table{{int_column, string_column}};
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{{3, 0, 1}};
+
+  rmm::cuda_stream stream;
+  auto const result = cudf::gather(
+    source_table, gather_map, cudf::out_of_bounds_policy::DONT_CHECK, stream.view());
+  stream.synchronize();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::gather(source_table, gather_map)->view(), result->view());
+}
@@ -27,6 +27,9 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <algorithm>
+#include <string>
+
 struct SampleTest : public cudf::test::BaseFixture {
 };
 
@@ -113,3 +116,105 @@ INSTANTIATE_TEST_CASE_P(
                     std::make_tuple(1024, cudf::sample_with_replacement::TRUE),
                     std::make_tuple(1024, cudf::sample_with_replacement::FALSE),
                     std::make_tuple(2048, cudf::sample_with_replacement::TRUE)));
+
+TEST_F(SampleTest, WeightedWithoutReplacement)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{1, 2, 3, 4, 5};
+  cudf::test::fixed_width_column_wrapper<double> weights{0.0, 1.0, 2.5, 0.0, 0.5};
+  cudf::table_view input({col1});
+
+  // Only the rows of nonzero weight can be sampled
+  auto out_table = cudf::sample(input, weights, 3, cudf::sample_with_replacement::FALSE, 7);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{2, 3, 5};
+  auto const sorted_out = cudf::sort(out_table->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected}), sorted_out->view());
+
+  EXPECT_THROW(cudf::sample(input, weights, 4, cudf::sample_with_replacement::FALSE),
+               cudf::logic_error);
+}
+
+TEST_F(SampleTest, WeightedWithReplacement)
+{
+  cudf::size_type const n_samples = 1024;
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{1, 2, 3, 4, 5};
+  cudf::test::fixed_width_column_wrapper<float> weights{0.f, 1.f, 0.f, 3.f, 0.f};
+  cudf::table_view input({col1});
+
+  auto out_table = cudf::sample(input, weights, n_samples, cudf::sample_with_replacement::TRUE);
+  EXPECT_EQ(out_table->num_rows(), n_samples);
+  auto const samples = cudf::test::to_host<int32_t>(out_table->get_column(0)).first;
+  EXPECT_TRUE(std::all_of(samples.begin(), samples.end(), [](auto s) { return s == 2 or s == 4; }));
+  // Row 4 has 3 times the weight of row 2
+  auto const num_fours = std::count(samples.begin(), samples.end(), 4);
+  EXPECT_GT(num_fours, n_samples / 2);
+  EXPECT_LT(num_fours, n_samples * 7 / 8);
+
+  auto const expected =
+    cudf::sample(input, weights, n_samples, cudf::sample_with_replacement::TRUE);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), out_table->view());
+}
+
+TEST_F(SampleTest, InvalidWeights)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{1, 2, 3};
+  cudf::table_view input({col1});
+
+  cudf::test::fixed_width_column_wrapper<double> too_few{1.0, 1.0};
+  cudf::test::fixed_width_column_wrapper<double> negative{1.0, -1.0, 1.0};
+  cudf::test::fixed_width_column_wrapper<double> with_nulls({1.0, 1.0, 1.0}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> integers{1, 1, 1};
+  cudf::test::fixed_width_column_wrapper<double> zeros{0.0, 0.0, 0.0};
+  EXPECT_THROW(cudf::sample(input, too_few, 1), cudf::logic_error);
+  EXPECT_THROW(cudf::sample(input, negative, 1), cudf::logic_error);
+  EXPECT_THROW(cudf::sample(input, with_nulls, 1), cudf::logic_error);
+  EXPECT_THROW(cudf::sample(input, integers, 1), cudf::logic_error);
+  EXPECT_THROW(cudf::sample(input, zeros, 1, cudf::sample_with_replacement::TRUE),
+               cudf::logic_error);
+}
+
+TEST_F(SampleTest, ReservoirSampler)
+{
+  cudf::size_type const num_rows = 1000;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + num_rows);
+  auto strings =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); });
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows);
+  cudf::table_view input({col1, col2});
+
+  cudf::reservoir_sampler sampler(100, 3);
+  for (cudf::size_type begin = 0; begin < num_rows; begin += 300) {
+    auto const end = std::min(begin + 300, num_rows);
+    sampler.add(cudf::slice(input, {begin, end}).front());
+  }
+  EXPECT_EQ(sampler.num_rows_seen(), num_rows);
+
+  // The sample is the weighted sample of all the rows with the same seed
+  auto const ones = cudf::detail::make_counting_transform_iterator(0, [](auto) { return 1.0; });
+  cudf::test::fixed_width_column_wrapper<double> weights(ones, ones + num_rows);
+  auto const expected = cudf::sample(input, weights, 100, cudf::sample_with_replacement::FALSE, 3);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), sampler.view());
+}
+
+TEST_F(SampleTest, ReservoirSamplerWeighted)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> batch1{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<double> weights1{1.0, 0.0, 2.0};
+  cudf::test::fixed_width_column_wrapper<int32_t> batch2{4, 5};
+  cudf::test::fixed_width_column_wrapper<double> weights2{0.0, 0.5};
+
+  cudf::reservoir_sampler sampler(4);
+  EXPECT_EQ(sampler.view().num_columns(), 0);
+  sampler.add(cudf::table_view({batch1}), weights1);
+  sampler.add(cudf::table_view({batch2}), weights2);
+
+  // Fewer rows than the capacity have nonzero weights: they are all sampled
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{1, 3, 5};
+  auto const sorted_sample = cudf::sort(sampler.view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected}), sorted_sample->view());
+
+  cudf::test::fixed_width_column_wrapper<int64_t> other_type{1, 2};
+  EXPECT_THROW(sampler.add(cudf::table_view({other_type})), cudf::logic_error);
+  EXPECT_THROW(sampler.add(cudf::table_view({batch2}), weights1), cudf::logic_error);
+  EXPECT_THROW(cudf::reservoir_sampler(-1), cudf::logic_error);
+}
@@ -17,6 +17,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/transform.hpp>
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -624,6 +625,27 @@ TYPED_TEST(BooleanMaskScatter, WithNull)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_table, got->view());
 }
 
+TYPED_TEST(BooleanMaskScatter, Bitmask)
+{
+  using T = TypeParam;
+  cudf::test::fixed_width_column_wrapper<T, int32_t> source({1, 5, 6, 8, 9}, {1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<T, int32_t> target({2, 2, 3, 4, 11, 12, 7, 7, 10, 10});
+  cudf::test::fixed_width_column_wrapper<bool> mask(
+    {true, false, false, false, true, true, false, true, true, false});
+  auto const bitmask = cudf::bools_to_mask(mask);
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> expected({1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                                              {1, 1, 1, 1, 0, 1, 1, 1, 1, 1});
+  auto source_table   = cudf::table_view({source});
+  auto target_table   = cudf::table_view({target});
+  auto expected_table = cudf::table_view({expected});
+
+  auto got = cudf::boolean_mask_scatter(
+    source_table, target_table, static_cast<cudf::bitmask_type const*>(bitmask.first->data()));
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_table, got->view());
+}
+
 class BooleanMaskScatterString : public cudf::test::BaseFixture {
 };
 
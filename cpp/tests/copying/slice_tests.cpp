@@ -29,6 +29,8 @@
 
 #include <tests/copying/slice_tests.cuh>
 
+#include <thrust/iterator/counting_iterator.h>
+
 #include <string>
 #include <vector>
 
@@ -493,3 +495,32 @@ TEST_F(SliceTableCornerCases, MiscOffset)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(col3, result_column);
 }
+
+TEST_F(SliceTableCornerCases, SlicedInputNullCounts)
+{
+  auto valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto iter   = thrust::make_counting_iterator<int32_t>(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(iter, iter + 100, valids);
+  cudf::test::fixed_width_column_wrapper<int64_t> longs(iter, iter + 100);
+  cudf::test::strings_column_wrapper strings({"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"},
+                                             {0, 1, 1, 0, 1, 1, 1, 1, 0, 0});
+  auto const strings_table = cudf::table_view{{strings}};
+
+  // the null counts of the slices of a sliced column account for its offset
+  auto const sliced = cudf::slice(ints, {33, 97})[0];
+  auto const result = cudf::slice(sliced, {0, 1, 1, 40, 31, 64, 64, 64});
+  std::vector<cudf::size_type> const expected_null_counts{1, 13, 11, 0};
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    EXPECT_EQ(result[i].null_count(), expected_null_counts[i]);
+  }
+
+  auto const table          = cudf::table_view{{sliced, cudf::slice(longs, {33, 97})[0]}};
+  auto const tables         = cudf::slice(table, {0, 1, 1, 40, 31, 64, 64, 64});
+  auto const strings_slices = cudf::slice(strings_table, {0, 4, 4, 10});
+  for (std::size_t i = 0; i < tables.size(); ++i) {
+    EXPECT_EQ(tables[i].column(0).null_count(), expected_null_counts[i]);
+    EXPECT_EQ(tables[i].column(1).null_count(), 0);
+  }
+  EXPECT_EQ(strings_slices[0].column(0).null_count(), 2);
+  EXPECT_EQ(strings_slices[1].column(0).null_count(), 2);
+}
@@ -17,7 +17,9 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/detail/utilities.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cudf_test/base_fixture.hpp>
@@ -1807,3 +1809,59 @@ TEST_F(ContiguousSplitNestedTypesTest, ListOfStruct)
     cudf::test::expect_columns_equivalent(expected[index], result[index].table.column(0));
   }
 }
+
+struct ContiguousSplitIntoTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ContiguousSplitIntoTest, CallerBuffers)
+{
+  cudf::test::fixed_width_column_wrapper<int> ints({1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                                   {1, 0, 1, 1, 0, 1, 1, 1, 0, 1});
+  cudf::test::strings_column_wrapper strings(
+    {"a", "bb", "ccc", "", "eeeee", "f", "gg", "hhh", "iiii", "j"},
+    {1, 1, 1, 0, 1, 1, 1, 1, 1, 0});
+  cudf::table_view tbl({ints, strings});
+  std::vector<cudf::size_type> splits{2, 2, 7};
+
+  // all the partitions in one allocation, at 64-byte aligned offsets
+  auto const sizes = cudf::contiguous_split_sizes(tbl, splits);
+  ASSERT_EQ(sizes.size(), splits.size() + 1);
+  std::vector<std::size_t> offsets{0};
+  for (auto const size : sizes) {
+    offsets.push_back(offsets.back() + cudf::util::round_up_safe(size, std::size_t{64}));
+  }
+  rmm::device_buffer buffer(offsets.back(), rmm::cuda_stream_default);
+  std::vector<cudf::device_span<uint8_t>> buffers;
+  for (std::size_t i = 0; i < sizes.size(); i++) {
+    buffers.emplace_back(static_cast<uint8_t*>(buffer.data()) + offsets[i], sizes[i]);
+  }
+
+  auto const metadata = cudf::contiguous_split_into(tbl, splits, buffers);
+  auto const expected = cudf::contiguous_split(tbl, splits);
+  ASSERT_EQ(metadata.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(sizes[i], expected[i].data.gpu_data->size());
+    auto const unpacked = cudf::unpack(metadata[i].data(), buffers[i].data());
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected[i].table, unpacked);
+  }
+}
+
+TEST_F(ContiguousSplitIntoTest, InvalidBuffers)
+{
+  cudf::test::fixed_width_column_wrapper<int> ints{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}};
+  cudf::table_view tbl({ints});
+  std::vector<cudf::size_type> splits{5};
+
+  auto const sizes = cudf::contiguous_split_sizes(tbl, splits);
+  rmm::device_buffer buffer(sizes[0] + sizes[1] + 64, rmm::cuda_stream_default);
+  auto const data = static_cast<uint8_t*>(buffer.data());
+  cudf::device_span<uint8_t> first(data, sizes[0]);
+  cudf::device_span<uint8_t> second(data + sizes[0] + 64, sizes[1]);
+
+  EXPECT_THROW(cudf::contiguous_split_into(tbl, splits, {first}), cudf::logic_error);
+  EXPECT_THROW(cudf::contiguous_split_into(tbl, splits, {first, {data, sizes[1] - 1}}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::contiguous_split_into(tbl, splits, {first, {data + 4, sizes[1]}}),
+               cudf::logic_error);
+  EXPECT_NO_THROW(cudf::contiguous_split_into(tbl, splits, {first, second}));
+}
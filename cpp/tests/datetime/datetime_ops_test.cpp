@@ -23,6 +23,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
@@ -264,6 +265,40 @@ TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedNullableDatetimeComponen
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_second(timestamps), expected_seconds);
 }
 
+TYPED_TEST(TypedDatetimeOpsTest, TestExtractingFields)
+{
+  using T = TypeParam;
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace cuda::std::chrono;
+
+  auto start = milliseconds(-2500000000000);  // Sat, 11 Oct 1890 19:33:20 GMT
+  auto stop_ = milliseconds(2500000000000);   // Mon, 22 Mar 2049 04:26:40 GMT
+  auto timestamps =
+    generate_timestamps<T, true>(this->size(), time_point_ms(start), time_point_ms(stop_));
+
+  auto const fields = extract_fields(timestamps,
+                                     {datetime_component::SECOND,
+                                      datetime_component::YEAR,
+                                      datetime_component::WEEKDAY,
+                                      datetime_component::HOUR,
+                                      datetime_component::DAY,
+                                      datetime_component::MINUTE,
+                                      datetime_component::MONTH,
+                                      datetime_component::YEAR});
+  ASSERT_EQ(fields->num_columns(), 8);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fields->get_column(0), *extract_second(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fields->get_column(1), *extract_year(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fields->get_column(2), *extract_weekday(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fields->get_column(3), *extract_hour(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fields->get_column(4), *extract_day(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fields->get_column(5), *extract_minute(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fields->get_column(6), *extract_month(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fields->get_column(7), *extract_year(timestamps));
+
+  EXPECT_EQ(extract_fields(timestamps, {})->num_columns(), 0);
+}
+
 TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithSeconds)
 {
   using namespace cudf::test;
@@ -533,4 +568,36 @@ TEST_F(BasicDatetimeOpsTest, TestAddMonthsWithSecondsAndNullValues)
     true);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto utc = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {
+      1609502400L,  // 2021-01-01 12:00:00 GMT
+      1625140800L,  // 2021-07-01 12:00:00 GMT
+      4118126400L,  // 2100-07-01 12:00:00 GMT - past the last transition of the table
+      -631108800L,  // 1950-01-01 12:00:00 GMT
+      0L            // null
+    },
+    {true, true, true, true, false}};
+  auto new_york = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {
+      1609484400L,  // 2021-01-01 07:00:00 EST
+      1625126400L,  // 2021-07-01 08:00:00 EDT
+      4118112000L,  // 2100-07-01 08:00:00 EDT
+      -631126800L,  // 1950-01-01 07:00:00 EST
+      0L            // null
+    },
+    {true, true, true, true, false}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(utc, "UTC", "America/New_York"), new_york);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(new_york, "America/New_York", "UTC"), utc);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(utc, "UTC", "UTC"), utc);
+
+  auto days = fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep>{18628};
+  EXPECT_THROW(convert_timezone(days, "UTC", "America/New_York"), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/dictionary/update_keys.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
@@ -74,6 +76,33 @@ TEST_F(DictionarySetKeysTest, WithNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, expected);
 }
 
+TEST_F(DictionarySetKeysTest, MatchDictionaries)
+{
+  cudf::test::strings_column_wrapper strings1{"eee", "aaa", "ddd", "bbb", "aaa"};
+  cudf::test::strings_column_wrapper strings2{"bbb", "ddd", "aaa", "eee", "eee"};
+  cudf::test::strings_column_wrapper strings3{"ccc", "aaa"};
+  auto dictionary1 = cudf::dictionary::encode(strings1);
+  auto dictionary2 = cudf::dictionary::encode(strings2);
+  auto dictionary3 = cudf::dictionary::encode(strings3);
+
+  // the same keys are left unchanged
+  auto const same = cudf::dictionary::detail::match_dictionaries(
+    {cudf::table_view{{dictionary1->view()}}, cudf::table_view{{dictionary2->view()}}});
+  EXPECT_TRUE(same.first.empty());
+  EXPECT_TRUE(cudf::dictionary::detail::have_matching_keys(
+    {cudf::dictionary_column_view(dictionary1->view()),
+     cudf::dictionary_column_view(dictionary2->view())}));
+
+  auto const matched = cudf::dictionary::detail::match_dictionaries(
+    {cudf::table_view{{dictionary1->view()}}, cudf::table_view{{dictionary3->view()}}});
+  EXPECT_EQ(matched.first.size(), 2u);
+  auto const view1 = cudf::dictionary_column_view(matched.second.front().column(0));
+  auto const view3 = cudf::dictionary_column_view(matched.second.back().column(0));
+  EXPECT_TRUE(cudf::dictionary::detail::have_matching_keys({view1, view3}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(view1), strings1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(view3), strings3);
+}
+
 TEST_F(DictionarySetKeysTest, Errors)
 {
   cudf::test::fixed_width_column_wrapper<int64_t> input{1, 2, 3};
@@ -428,6 +428,44 @@ TEST_F(FixedPointTest, OverflowDecimal64)
 #endif
 }
 
+TEST_F(FixedPointTest, Decimal128Arithmetic)
+{
+  // 10^20 does not fit in 64 bits
+  auto const big = static_cast<__int128_t>(10'000'000'000) * 10'000'000'000;
+
+  decimal128 const a{scaled_integer<__int128_t>{big + 1, scale_type{-2}}};
+  decimal128 const b{3, scale_type{0}};
+
+  auto const product = a * b;
+  EXPECT_TRUE(product.value() == 3 * (big + 1));
+  EXPECT_EQ(product.scale(), scale_type{-2});
+  auto const quotient = a / b;
+  EXPECT_TRUE(quotient.value() == (big + 1) / 3);
+  EXPECT_EQ(quotient.scale(), scale_type{-2});
+
+  EXPECT_EQ(a + b, decimal128(scaled_integer<__int128_t>{big + 301, scale_type{-2}}));
+  EXPECT_EQ(a - b, decimal128(scaled_integer<__int128_t>{big - 299, scale_type{-2}}));
+  EXPECT_TRUE(b < a);
+  EXPECT_TRUE(a.rescaled(scale_type{0}).value() == big / 100);
+  EXPECT_EQ(static_cast<int64_t>(a), 1'000'000'000'000'000'000);
+  EXPECT_DOUBLE_EQ(static_cast<double>(a), 1e18);
+}
+
+TEST_F(FixedPointTest, Decimal128ToString)
+{
+  auto const big       = static_cast<__int128_t>(10'000'000'000) * 10'000'000'000;
+  auto const to_string = [](__int128_t value, int32_t scale) {
+    return static_cast<std::string>(
+      decimal128{scaled_integer<__int128_t>{value, scale_type{scale}}});
+  };
+
+  EXPECT_EQ(to_string(big + 1, -2), "1000000000000000000.01");
+  EXPECT_EQ(to_string(-big, -25), "-0.0000100000000000000000000");
+  EXPECT_EQ(to_string(big, 2), "10000000000000000000000");
+  EXPECT_EQ(to_string(std::numeric_limits<__int128_t>::min(), 0),
+            "-170141183460469231731687303715884105728");
+}
+
 template <typename ValueType, typename Binop>
 void integer_vector_test(ValueType const initial_value,
                          int32_t const size,
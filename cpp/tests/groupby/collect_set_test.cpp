@@ -90,7 +90,7 @@ TYPED_TEST(CollectSetTypedTest, TypicalInput)
     COL_K keys{1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3};
     COL_V vals{10, 11, 10, 10, 20, 21, 21, 20, 30, 33, 32, 31};
     COL_K keys_expected{1, 2, 3};
-    LCL_V vals_expected{{10, 11}, {20, 21}, {30, 31, 32, 33}};
+    LCL_V vals_expected{{10, 11}, {20, 21}, {30, 33, 32, 31}};
     test_single_agg(keys, vals, keys_expected, vals_expected, COLLECT_SET);
   }
 
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/sorting.hpp>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_approx_nunique_test : public cudf::test::BaseFixture {
+};
+
+using K = int32_t;
+using supported_types =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+
+TYPED_TEST_CASE(groupby_approx_nunique_test, supported_types);
+
+// Small cardinalities fall into the linear counting range of the estimate and are exact
+TYPED_TEST(groupby_approx_nunique_test, basic)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::APPROX_NUNIQUE>;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  // clang-format off
+  //                                        {0, 3, 6, 1, 4, 5, 9, 2, 7, 8}
+  fixed_width_column_wrapper<K> expect_keys{1,        2,          3};
+  fixed_width_column_wrapper<R> expect_vals{3,        4,          3};
+  // clang-format on
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_approx_nunique_aggregation());
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_vals,
+                  cudf::make_approx_nunique_aggregation(),
+                  force_use_sort_impl::YES);
+}
+
+TYPED_TEST(groupby_approx_nunique_test, null_values)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::APPROX_NUNIQUE>;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4};
+  fixed_width_column_wrapper<V> vals({0, 1, 2, 3, 4, 4, 6, 7, 8, 9, 4},
+                                     {0, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0});
+
+  // clang-format off
+  //                                        {0, 3, 6, 1, 4, 4, 9, 2, 7, 8, 4}
+  fixed_width_column_wrapper<K> expect_keys{1,        2,          3,       4};
+  fixed_width_column_wrapper<R> expect_vals{2,        2,          3,       0};
+  fixed_width_column_wrapper<R> expect_null_vals{3,   3,          3,       1};
+  // clang-format on
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_approx_nunique_aggregation());
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_null_vals,
+                  cudf::make_approx_nunique_aggregation(null_policy::INCLUDE));
+}
+
+struct groupby_approx_nunique_accuracy_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_approx_nunique_accuracy_test, large_cardinality)
+{
+  // Two groups of 10000 distinct values each, every value repeated five times
+  constexpr size_type num_rows = 100000;
+  auto keys_iter = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  auto vals_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 20000; });
+  fixed_width_column_wrapper<K> keys(keys_iter, keys_iter + num_rows);
+  fixed_width_column_wrapper<int64_t> vals(vals_iter, vals_iter + num_rows);
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_approx_nunique_aggregation());
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  auto const estimates = to_host<int64_t>(*result.second[0].results[0]).first;
+  ASSERT_EQ(estimates.size(), 2u);
+  // The relative standard error with the default precision of 12 is about 1.6%
+  for (auto const estimate : estimates) {
+    EXPECT_NEAR(estimate, 10000, 500);
+  }
+}
+
+TEST_F(groupby_approx_nunique_accuracy_test, invalid_precision)
+{
+  fixed_width_column_wrapper<K> keys{1, 2};
+  fixed_width_column_wrapper<int32_t> vals{1, 2};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(
+    cudf::make_approx_nunique_aggregation(null_policy::EXCLUDE, 2));
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.aggregate(requests), cudf::logic_error);
+}
+
+struct groupby_nunique_sketch_test : public cudf::test::BaseFixture {
+};
+
+namespace {
+// Returns the keys and the result of the single aggregation of `vals` grouped by `keys`, sorted by
+// the keys
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> sorted_single_agg(
+  column_view const& keys, column_view const& vals, std::unique_ptr<aggregation>&& agg)
+{
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(std::move(agg));
+  groupby::groupby gb_obj(table_view({keys}));
+  auto result = gb_obj.aggregate(requests);
+
+  auto const sort_order = sorted_order(result.first->view());
+  auto sorted_keys      = gather(result.first->view(), *sort_order);
+  auto sorted_vals      = gather(table_view({result.second[0].results[0]->view()}), *sort_order);
+  return {std::move(sorted_keys->release()[0]), std::move(sorted_vals->release()[0])};
+}
+}  // namespace
+
+TEST_F(groupby_nunique_sketch_test, merge_partitions)
+{
+  // Two groups of 10000 distinct values each, every value repeated five times
+  constexpr size_type num_rows = 100000;
+  auto keys_iter = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  auto vals_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 20000; });
+  fixed_width_column_wrapper<K> keys(keys_iter, keys_iter + num_rows);
+  fixed_width_column_wrapper<int64_t> vals(vals_iter, vals_iter + num_rows);
+
+  auto const direct = sorted_single_agg(keys, vals, cudf::make_approx_nunique_aggregation());
+
+  // The sketches of the partitions are merged into the sketch of the whole column, so that the
+  // estimates are the same
+  std::vector<size_type> const splits{30000, 70000};
+  auto const key_parts = split(keys, splits);
+  auto const val_parts = split(vals, splits);
+  std::vector<std::unique_ptr<column>> part_keys;
+  std::vector<std::unique_ptr<column>> part_sketches;
+  for (std::size_t p = 0; p < key_parts.size(); ++p) {
+    auto part = sorted_single_agg(key_parts[p], val_parts[p], make_nunique_sketch_aggregation());
+    part_keys.push_back(std::move(part.first));
+    part_sketches.push_back(std::move(part.second));
+  }
+  auto const sketch_keys = concatenate(
+    std::vector<column_view>{part_keys[0]->view(), part_keys[1]->view(), part_keys[2]->view()});
+  auto const sketches =
+    concatenate(std::vector<column_view>{part_sketches[0]->view(), part_sketches[1]->view(),
+                                         part_sketches[2]->view()});
+
+  auto const merged = sorted_single_agg(*sketch_keys, *sketches, make_merge_nunique_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*direct.first, *merged.first);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*direct.second, *merged.second);
+
+  auto const estimates = to_host<int64_t>(*merged.second).first;
+  for (auto const estimate : estimates) {
+    EXPECT_NEAR(estimate, 10000, 500);
+  }
+}
+
+TEST_F(groupby_nunique_sketch_test, sketch_size)
+{
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto const result =
+    sorted_single_agg(keys, vals, make_nunique_sketch_aggregation(null_policy::EXCLUDE, 6));
+  EXPECT_EQ(result.second->type().id(), type_id::LIST);
+  lists_column_view const sketches(*result.second);
+  EXPECT_EQ(sketches.child().type().id(), type_id::UINT8);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sketches.offsets(),
+                                 fixed_width_column_wrapper<size_type>{0, 64, 128, 192});
+
+  // Small cardinalities are estimated exactly from the sketches
+  fixed_width_column_wrapper<int64_t> expect_vals{3, 4, 3};
+  auto const merged =
+    sorted_single_agg(*result.first, *result.second, make_merge_nunique_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_vals, *merged.second);
+}
+
+TEST_F(groupby_nunique_sketch_test, mismatched_precisions)
+{
+  fixed_width_column_wrapper<K> keys{1, 2};
+  fixed_width_column_wrapper<int32_t> vals{1, 2};
+
+  auto const sketches6 =
+    sorted_single_agg(keys, vals, make_nunique_sketch_aggregation(null_policy::EXCLUDE, 6));
+  auto const sketches8 =
+    sorted_single_agg(keys, vals, make_nunique_sketch_aggregation(null_policy::EXCLUDE, 8));
+  auto const sketch_keys =
+    concatenate(std::vector<column_view>{sketches6.first->view(), sketches8.first->view()});
+  auto const sketches =
+    concatenate(std::vector<column_view>{sketches6.second->view(), sketches8.second->view()});
+
+  EXPECT_THROW(sorted_single_agg(*sketch_keys, *sketches, make_merge_nunique_aggregation()),
+               cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
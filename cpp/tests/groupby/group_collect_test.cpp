@@ -68,6 +68,26 @@ TYPED_TEST(groupby_collect_list_test, CollectWithNulls)
   test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
 }
 
+TYPED_TEST(groupby_collect_list_test, CollectUnsortedKeysInRowOrder)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K, int32_t> keys{{2, 1, 2, 1, 3, 2, 4, 1}, {1, 1, 1, 1, 1, 1, 0, 1}};
+  fixed_width_column_wrapper<V, int32_t> values{1, 2, 3, 4, 5, 6, 7, 8};
+
+  fixed_width_column_wrapper<K, int32_t> expect_keys{1, 2, 3};
+  lists_column_wrapper<V, int32_t> expect_vals{{2, 4, 8}, {1, 3, 6}, {5}};
+
+  test_single_agg(keys, values, expect_keys, expect_vals, cudf::make_collect_list_aggregation());
+  test_single_agg(keys,
+                  values,
+                  expect_keys,
+                  expect_vals,
+                  cudf::make_collect_list_aggregation(),
+                  force_use_sort_impl::YES);
+}
+
 TYPED_TEST(groupby_collect_list_test, CollectLists)
 {
   using K = int32_t;
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_m2_test : public cudf::test::BaseFixture {
+};
+using K = int32_t;
+
+using supported_types = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(groupby_m2_test, supported_types);
+
+TYPED_TEST(groupby_m2_test, basic)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::M2>;
+
+  // clang-format off
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  //                                       {1, 1, 1,  2, 2, 2, 2,  3, 3, 3}
+  fixed_width_column_wrapper<K> expect_keys{1,        2,           3};
+  //                                       {0, 3, 6,  1, 4, 5, 9,  2, 7, 8}
+  fixed_width_column_wrapper<R> expect_vals({18.,     32.75,       62. / 3}, all_valid());
+  // clang-format on
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_m2_aggregation());
+}
+
+TYPED_TEST(groupby_m2_test, null_values)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::M2>;
+
+  // clang-format off
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4};
+  fixed_width_column_wrapper<V> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                     {0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+
+  //                                       {1, 1,     2, 2, 2,   3, 3, 3,   4}
+  fixed_width_column_wrapper<K> expect_keys{1,        2,         3,         4};
+  //                                       {3, 6,     1, 4, 9,   2, 7, 8,   -}
+  fixed_width_column_wrapper<R> expect_vals({4.5,     98. / 3,   62. / 3,   0.},
+                                            {1,       1,         1,         0});
+  // clang-format on
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_m2_aggregation());
+}
+
+struct groupby_merge_m2_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_merge_m2_test, basic)
+{
+  // Partial results of {0, 3} and {6} for key 1, {1, 4} and {5, 9} for key 2, {2, 7, 8} for key 3
+  // and no valid values for key 4
+  fixed_width_column_wrapper<K> keys{1, 2, 1, 2, 3, 4};
+  fixed_width_column_wrapper<size_type> counts{2, 2, 1, 2, 3, 0};
+  fixed_width_column_wrapper<double> means({1.5, 2.5, 6., 7., 17. / 3, 0.}, {1, 1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<double> m2s({4.5, 4.5, 0., 8., 62. / 3, 0.}, {1, 1, 1, 1, 1, 0});
+  structs_column_wrapper vals{{counts, means, m2s}};
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3, 4};
+  fixed_width_column_wrapper<size_type> expect_counts{3, 4, 3, 0};
+  fixed_width_column_wrapper<double> expect_means({3., 4.75, 17. / 3, 0.}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<double> expect_m2s({18., 32.75, 62. / 3, 0.}, {1, 1, 1, 0});
+  structs_column_wrapper expect_vals{{expect_counts, expect_means, expect_m2s}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_merge_m2_aggregation());
+}
+
+TEST_F(groupby_merge_m2_test, null_partials)
+{
+  // Null rows are partial results of no values
+  fixed_width_column_wrapper<K> keys{1, 1, 2};
+  fixed_width_column_wrapper<size_type> counts{2, 5, 1};
+  fixed_width_column_wrapper<double> means{1.5, 10., 4.};
+  fixed_width_column_wrapper<double> m2s{4.5, 1., 0.};
+  structs_column_wrapper vals{{counts, means, m2s}, {1, 0, 1}};
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2};
+  fixed_width_column_wrapper<size_type> expect_counts{2, 1};
+  fixed_width_column_wrapper<double> expect_means{1.5, 4.};
+  fixed_width_column_wrapper<double> expect_m2s{4.5, 0.};
+  structs_column_wrapper expect_vals{{expect_counts, expect_means, expect_m2s}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_merge_m2_aggregation());
+}
+
+TEST_F(groupby_merge_m2_test, invalid_input)
+{
+  fixed_width_column_wrapper<K> keys{1, 2};
+  fixed_width_column_wrapper<int64_t> counts{1, 1};
+  fixed_width_column_wrapper<double> means{1., 2.};
+  fixed_width_column_wrapper<double> m2s{0., 0.};
+  structs_column_wrapper vals{{counts, means, m2s}};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_merge_m2_aggregation());
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.aggregate(requests), cudf::logic_error);
+
+  // MERGE_M2 is only valid on structs columns
+  requests[0].values = means;
+  EXPECT_THROW(gb_obj.aggregate(requests), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
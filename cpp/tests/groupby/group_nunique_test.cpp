@@ -214,5 +214,34 @@ TYPED_TEST(groupby_nunique_test, dictionary)
     keys, vals, expect_keys, expect_vals, cudf::make_nunique_aggregation(null_policy::INCLUDE));
 }
 
+struct groupby_nunique_string_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_nunique_string_test, basic)
+{
+  using R = cudf::detail::target_type_t<cudf::string_view, aggregation::NUNIQUE>;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  strings_column_wrapper vals({"año", "bit", "₹1", "aaa", "zit", "bat", "aaa", "$1", "₹1", "wut"},
+                              {1, 1, 1, 1, 1, 0, 1, 1, 1, 1});
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<R> expect_vals{2, 3, 2};
+  fixed_width_column_wrapper<R> expect_null_vals{2, 4, 2};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_nunique_aggregation());
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_vals,
+                  cudf::make_nunique_aggregation(),
+                  force_use_sort_impl::YES);
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_null_vals,
+                  cudf::make_nunique_aggregation(null_policy::INCLUDE));
+}
+
 }  // namespace test
 }  // namespace cudf
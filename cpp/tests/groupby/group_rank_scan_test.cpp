@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+
+template <typename V>
+struct groupby_rank_scan_test : public cudf::test::BaseFixture {
+};
+
+using K               = int32_t;
+using rank_wrapper    = fixed_width_column_wrapper<size_type>;
+using percent_wrapper = fixed_width_column_wrapper<double>;
+
+using FixedWidthTypesNotBool = cudf::test::Concat<cudf::test::IntegralTypesNotBool,
+                                                  cudf::test::FloatingPointTypes,
+                                                  cudf::test::TimestampTypes>;
+TYPED_TEST_CASE(groupby_rank_scan_test, FixedWidthTypesNotBool);
+
+TYPED_TEST(groupby_rank_scan_test, basic)
+{
+  using V = TypeParam;
+
+  // clang-format off
+  fixed_width_column_wrapper<K> keys       {1, 1, 2, 1, 2, 2, 1, 2};
+  fixed_width_column_wrapper<V, int32_t> vals{3, 5, 1, 5, 1, 4, 8, 4};
+
+  fixed_width_column_wrapper<K> expect_keys{1, 1, 1, 1, 2, 2, 2, 2};
+  rank_wrapper expect_rank                 {1, 2, 2, 4, 1, 1, 3, 3};
+  rank_wrapper expect_dense_rank           {1, 2, 2, 3, 1, 1, 2, 2};
+  percent_wrapper expect_percent_rank      {0, 1. / 3, 1. / 3, 1, 0, 0, 2. / 3, 2. / 3};
+  // clang-format on
+
+  test_single_scan(keys, vals, expect_keys, expect_rank, make_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_dense_rank, make_dense_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_percent_rank, make_percent_rank_aggregation());
+}
+
+struct groupby_rank_scan_untyped_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_rank_scan_untyped_test, strings_with_nulls)
+{
+  // Nulls are equal to each other, and sorted last within their groups here
+  fixed_width_column_wrapper<K> keys{2, 1, 2, 1, 2, 1, 3};
+  strings_column_wrapper vals({"a", "b", "a", "b", "c", "", ""}, {1, 1, 1, 1, 1, 0, 1});
+
+  fixed_width_column_wrapper<K> expect_keys{1, 1, 1, 2, 2, 2, 3};
+  rank_wrapper expect_rank{1, 1, 3, 1, 1, 3, 1};
+  rank_wrapper expect_dense_rank{1, 1, 2, 1, 1, 2, 1};
+  percent_wrapper expect_percent_rank{0, 0, 1, 0, 0, 1, 0};
+
+  test_single_scan(keys, vals, expect_keys, expect_rank, make_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_dense_rank, make_dense_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_percent_rank, make_percent_rank_aggregation());
+}
+
+TEST_F(groupby_rank_scan_untyped_test, empty_cols)
+{
+  fixed_width_column_wrapper<K> keys{};
+  fixed_width_column_wrapper<int32_t> vals{};
+
+  fixed_width_column_wrapper<K> expect_keys{};
+  rank_wrapper expect_rank{};
+  percent_wrapper expect_percent_rank{};
+
+  test_single_scan(keys, vals, expect_keys, expect_rank, make_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_rank, make_dense_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_percent_rank, make_percent_rank_aggregation());
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -21,6 +21,9 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+
+#include <vector>
 
 namespace cudf {
 namespace test {
@@ -148,6 +151,35 @@ TYPED_TEST(groupby_sum_test, dictionary)
     keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation(), force_use_sort_impl::YES);
 }
 
+TYPED_TEST(groupby_sum_test, low_cardinality)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // Enough rows of few groups for the blocks to aggregate their rows privately and merge them
+  auto const num_rows = 20000;
+
+  auto keys_it  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto vals_it  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  auto valid_it = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  fixed_width_column_wrapper<K> keys(keys_it, keys_it + num_rows);
+  fixed_width_column_wrapper<V, int32_t> vals(vals_it, vals_it + num_rows, valid_it);
+
+  std::vector<int64_t> sums(3, 0);
+  for (auto i = 0; i < num_rows; ++i) {
+    if (valid_it[i]) { sums[keys_it[i]] += vals_it[i]; }
+  }
+
+  fixed_width_column_wrapper<K> expect_keys{0, 1, 2};
+  fixed_width_column_wrapper<R, int64_t> expect_vals(sums.begin(), sums.end());
+
+  auto agg = cudf::make_sum_aggregation();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_sum_aggregation();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -211,5 +243,77 @@ TYPED_TEST(FixedPointTestBothReps, GroupByHashSumDecimalAsValue)
   }
 }
 
+struct groupby_deterministic_sum_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_deterministic_sum_test, FloatingPointResultsAreReproducible)
+{
+  constexpr size_type num_rows = 100000;
+  auto const keys_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i * 7919) % 13; });
+  auto const vals_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return 1.0 / (i + 1) + (i % 3 == 0 ? 1e8 : 0.0); });
+  fixed_width_column_wrapper<K> keys(keys_iter, keys_iter + num_rows);
+  fixed_width_column_wrapper<double> vals(vals_iter, vals_iter + num_rows);
+
+  auto aggregate = [&]() {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    requests[0].aggregations.push_back(cudf::make_mean_aggregation());
+    requests[0].aggregations.push_back(cudf::make_variance_aggregation());
+    groupby::groupby gb_obj(
+      table_view({keys}), null_policy::EXCLUDE, sorted::NO, {}, {}, determinism::DETERMINISTIC);
+    return gb_obj.aggregate(requests);
+  };
+
+  auto const expected = aggregate();
+  // the sort-based implementation returns the groups in the order of their keys
+  fixed_width_column_wrapper<K> expect_keys{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), expected.first->view());
+  for (int run = 0; run < 3; ++run) {
+    auto const result = aggregate();
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.first->view(), result.first->view());
+    for (std::size_t i = 0; i < expected.second[0].results.size(); ++i) {
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected.second[0].results[i], *result.second[0].results[i]);
+    }
+  }
+}
+
+struct FixedPointTest128 : public cudf::test::BaseFixture {
+};
+
+TEST_F(FixedPointTest128, GroupBySumDecimal128AsValue)
+{
+  using namespace numeric;
+  using RepType    = __int128_t;
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<RepType>;
+  using K          = int32_t;
+
+  // 10^21 does not fit in the 64-bit representation of decimal64
+  auto const big = static_cast<RepType>(1'000'000'000'000'000'000) * 1000;
+
+  for (auto const i : {2, 0, -2}) {
+    auto const scale = scale_type{i};
+    // clang-format off
+    auto const keys  = fixed_width_column_wrapper<K>{1, 2, 3, 1, 2, 2, 1, 3, 3};
+    auto const vals  = fp_wrapper{                  {big, 1, 2, big, 4, 5, 6, 7, 8},
+                                                    {1,   1, 0, 1,   1, 1, 1, 0, 0}, scale};
+    // clang-format on
+
+    auto const expect_keys     = fixed_width_column_wrapper<K>{1, 2, 3};
+    auto const expect_vals_sum = fp_wrapper{{big * 2 + 6, 10, 0}, {1, 1, 0}, scale};
+
+    // decimal128 has no device atomics, so both paths reduce the sorted groups
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_vals_sum,
+                    cudf::make_sum_aggregation(),
+                    force_use_sort_impl::YES);
+    test_single_agg(keys, vals, expect_keys, expect_vals_sum, cudf::make_sum_aggregation());
+  }
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+namespace {
+/**
+ * @brief Makes a column of t-digests from the means and weights of their centroids.
+ */
+std::unique_ptr<column> make_digests(std::initializer_list<offset_type> offsets,
+                                     std::initializer_list<double> means,
+                                     std::initializer_list<double> weights)
+{
+  fixed_width_column_wrapper<double> means_column(means);
+  fixed_width_column_wrapper<double> weights_column(weights);
+  structs_column_wrapper centroids{{means_column, weights_column}};
+  return make_lists_column(static_cast<size_type>(offsets.size()) - 1,
+                           fixed_width_column_wrapper<offset_type>(offsets).release(),
+                           centroids.release(),
+                           0,
+                           {});
+}
+}  // namespace
+
+template <typename V>
+struct groupby_tdigest_test : public cudf::test::BaseFixture {
+};
+
+using K = int32_t;
+
+using supported_types = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(groupby_tdigest_test, supported_types);
+
+// Small groups make a centroid per value
+TYPED_TEST(groupby_tdigest_test, basic)
+{
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals{9, 1, 2, 3, 4, 5, 6, 7, 8, 0};
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  auto const expect_vals = make_digests(
+    {0, 3, 7, 10}, {3, 6, 9, 0, 1, 4, 5, 2, 7, 8}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+
+  test_single_agg(keys, vals, expect_keys, *expect_vals, cudf::make_tdigest_aggregation());
+}
+
+TYPED_TEST(groupby_tdigest_test, null_values)
+{
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4};
+  fixed_width_column_wrapper<V> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                     {0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+
+  // The digest of a group without valid values is empty
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3, 4};
+  auto const expect_vals =
+    make_digests({0, 2, 5, 8, 8}, {3, 6, 1, 4, 9, 2, 7, 8}, {1, 1, 1, 1, 1, 1, 1, 1});
+
+  test_single_agg(keys, vals, expect_keys, *expect_vals, cudf::make_tdigest_aggregation());
+}
+
+// The values between the minimum and maximum are merged into a single centroid
+TYPED_TEST(groupby_tdigest_test, compression)
+{
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K> keys{1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+  fixed_width_column_wrapper<V> vals{5, 1, 2, 8, 4, 0, 6, 7, 3, 9};
+
+  fixed_width_column_wrapper<K> expect_keys{1};
+  auto const expect_vals = make_digests({0, 3}, {0, 4.5, 9}, {1, 8, 1});
+
+  test_single_agg(keys, vals, expect_keys, *expect_vals, cudf::make_tdigest_aggregation(3));
+}
+
+struct groupby_merge_tdigest_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_merge_tdigest_test, basic)
+{
+  // Digests of {0, 3} and {6} for key 1, {1, 4} and {5, 9} for key 2, {2} and {7, 8} for key 3
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 3};
+  auto const vals = make_digests(
+    {0, 2, 4, 5, 6, 8, 10}, {0, 3, 1, 4, 2, 6, 5, 9, 7, 8}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  auto const expect_vals = make_digests(
+    {0, 3, 7, 10}, {0, 3, 6, 1, 4, 5, 9, 2, 7, 8}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+
+  test_single_agg(keys, *vals, expect_keys, *expect_vals, cudf::make_merge_tdigest_aggregation());
+}
+
+TEST_F(groupby_merge_tdigest_test, compression)
+{
+  // The merged centroids of a group are compressed again
+  fixed_width_column_wrapper<K> keys{1, 1};
+  auto const vals = make_digests({0, 3, 6}, {0, 4, 6, 1, 5, 9}, {1, 6, 1, 1, 4, 1});
+
+  fixed_width_column_wrapper<K> expect_keys{1};
+  auto const expect_vals = make_digests({0, 3}, {0, 4.25, 9}, {1, 12, 1});
+
+  test_single_agg(keys, *vals, expect_keys, *expect_vals, cudf::make_merge_tdigest_aggregation(3));
+}
+
+TEST_F(groupby_merge_tdigest_test, invalid_input)
+{
+  fixed_width_column_wrapper<K> keys{1, 2};
+  fixed_width_column_wrapper<double> vals{1., 2.};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_merge_tdigest_aggregation());
+  groupby::groupby gb_obj(table_view({keys}));
+  EXPECT_THROW(gb_obj.aggregate(requests), cudf::logic_error);
+
+  EXPECT_THROW(cudf::make_tdigest_aggregation(2), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
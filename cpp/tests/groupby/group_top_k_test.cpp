@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+
+namespace cudf {
+namespace test {
+
+template <typename V>
+struct groupby_top_k_test : public cudf::test::BaseFixture {
+};
+
+using K = int32_t;
+
+using FixedWidthTypesNotBool = cudf::test::Concat<cudf::test::IntegralTypesNotBool,
+                                                  cudf::test::FloatingPointTypes,
+                                                  cudf::test::TimestampTypes>;
+TYPED_TEST_CASE(groupby_top_k_test, FixedWidthTypesNotBool);
+
+TYPED_TEST(groupby_top_k_test, basic)
+{
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V, int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  //                                        {0, 3, 6, 1, 4, 5, 9, 2, 7, 8}
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  lists_column_wrapper<V, int32_t> expect_top{{6, 3}, {9, 5}, {8, 7}};
+  lists_column_wrapper<V, int32_t> expect_bottom{{0, 3}, {1, 4}, {2, 7}};
+
+  test_single_agg(keys, vals, expect_keys, expect_top, cudf::make_top_k_aggregation(2));
+  test_single_agg(
+    keys, vals, expect_keys, expect_bottom, cudf::make_top_k_aggregation(2, order::ASCENDING));
+}
+
+TYPED_TEST(groupby_top_k_test, null_values)
+{
+  using V   = TypeParam;
+  using LCW = lists_column_wrapper<V, int32_t>;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4};
+  fixed_width_column_wrapper<V, int32_t> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                              {0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+
+  // Groups of fewer than k valid values return all of them
+  //                                        {3, 6,  1, 4, 9,  2, 7, 8,  -}
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3, 4};
+  LCW expect_vals{{6, 3}, {9, 4, 1}, {8, 7, 2}, LCW{}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_top_k_aggregation(3));
+}
+
+struct groupby_top_k_chunks_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_top_k_chunks_test, groups_of_many_chunks)
+{
+  // Groups spanning several chunks, with their largest values in the first and last chunks
+  constexpr size_type num_rows = 10000;
+  auto keys_iter = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  auto vals_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i < 2 ? num_rows + i : num_rows - i; });
+  fixed_width_column_wrapper<K> keys(keys_iter, keys_iter + num_rows);
+  fixed_width_column_wrapper<int64_t> vals(vals_iter, vals_iter + num_rows);
+
+  fixed_width_column_wrapper<K> expect_keys{0, 1};
+  lists_column_wrapper<int64_t> expect_vals{{10000, 9998, 9996, 9994}, {10001, 9997, 9995, 9993}};
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_top_k_aggregation(4));
+
+  lists_column_wrapper<int64_t> expect_bottom{{2, 4, 6}, {1, 3, 5}};
+  test_single_agg(
+    keys, vals, expect_keys, expect_bottom, cudf::make_top_k_aggregation(3, order::ASCENDING));
+}
+
+TEST_F(groupby_top_k_chunks_test, strings)
+{
+  fixed_width_column_wrapper<K> keys{1, 2, 1, 2, 1, 1};
+  strings_column_wrapper vals{"b", "zz", "a", "y", "c", "a"};
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2};
+  lists_column_wrapper<string_view> expect_vals{{"c", "b"}, {"zz", "y"}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_top_k_aggregation(2));
+}
+
+TEST_F(groupby_top_k_chunks_test, invalid_k)
+{
+  EXPECT_THROW(cudf::make_top_k_aggregation(0), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
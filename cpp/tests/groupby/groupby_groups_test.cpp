@@ -20,7 +20,10 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 namespace cudf {
 namespace test {
@@ -89,5 +92,55 @@ TYPED_TEST(groupby_group_keys_and_values_test, some_nulls)
   test_groups(keys, expect_grouped_keys, expect_group_offsets, values, expect_grouped_values);
 }
 
+TEST_F(groupby_group_keys_test, pre_grouped_keys)
+{
+  using K = int32_t;
+
+  fixed_width_column_wrapper<K> keys{1, 1, 1, 3, 3, 2, 4};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5, 6, 7};
+  // The last row belongs to no group
+  fixed_width_column_wrapper<size_type> group_offsets{0, 3, 5, 6};
+  column_view const offsets = group_offsets;
+  groupby::groupby gb(table_view({keys}),
+                      device_span<size_type const>(offsets.data<size_type>(), offsets.size()));
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  auto const result = gb.aggregate(requests);
+
+  fixed_width_column_wrapper<K> expect_keys{1, 3, 2};
+  fixed_width_column_wrapper<int64_t> expect_sums{6, 9, 6};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_sums, *result.second[0].results[0], true);
+
+  // Scans reuse the same groups
+  requests[0].aggregations.clear();
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  auto const scan_result = gb.scan(requests);
+
+  fixed_width_column_wrapper<K> expect_grouped_keys{1, 1, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int64_t> expect_scans{1, 3, 6, 4, 9, 6};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_grouped_keys}), scan_result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_scans, *scan_result.second[0].results[0], true);
+}
+
+TEST_F(groupby_group_keys_test, invalid_group_offsets)
+{
+  using K = int32_t;
+
+  fixed_width_column_wrapper<K> keys{1, 1, 2};
+  auto make_groupby = [&](column_view const& offsets) {
+    groupby::groupby gb(table_view({keys}),
+                        device_span<size_type const>(offsets.data<size_type>(), offsets.size()));
+  };
+  fixed_width_column_wrapper<size_type> empty_offsets{};
+  fixed_width_column_wrapper<size_type> nonzero_first_offset{1, 3};
+  fixed_width_column_wrapper<size_type> out_of_bounds_offsets{0, 2, 4};
+  EXPECT_THROW(make_groupby(empty_offsets), cudf::logic_error);
+  EXPECT_THROW(make_groupby(nonzero_first_offset), cudf::logic_error);
+  EXPECT_THROW(make_groupby(out_of_bounds_offsets), cudf::logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -21,6 +21,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/hashing.hpp>
 
 namespace cudf {
 namespace test {
@@ -257,8 +258,108 @@ TEST_F(groupby_string_keys_test, basic)
   auto agg = cudf::make_sum_aggregation();
   test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
+
+TEST_F(groupby_string_keys_test, case_insensitive)
+{
+  // "Ñ" is not an ASCII letter, so "AÑO" is not in the group of "año"
+  strings_column_wrapper keys{"abc", "ABC", "año", "Año", "aBc", "AÑO", "x"};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3, 4, 5, 6, 10};
+  std::vector<case_sensitivity> const key_case{case_sensitivity::INSENSITIVE};
+
+  groupby::groupby gby{table_view{{keys}},
+                       null_policy::EXCLUDE,
+                       sorted::NO,
+                       {},
+                       {},
+                       determinism::NONDETERMINISTIC,
+                       key_case};
+
+  // The key kept for a group is any of its keys, so the results are ordered by their sums
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  auto const result = gby.aggregate(requests);
+  auto const sums   = table_view{{result.second[0].results[0]->view()}};
+  fixed_width_column_wrapper<int64_t> expect_sums{6, 7, 8, 10};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_sums, gather(sums, *sorted_order(sums))->get_column(0));
+
+  strings_column_wrapper expect_keys{"abc", "ABC", "aBc", "AÑO", "año", "Año", "x"};
+  auto const groups = gby.get_groups();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_keys, groups.keys->get_column(0));
+  EXPECT_EQ(groups.offsets, (std::vector<size_type>{0, 3, 4, 6, 7}));
+
+  CUDF_EXPECT_THROW_MESSAGE(
+    groupby::groupby(table_view{{keys}},
+                     null_policy::EXCLUDE,
+                     sorted::NO,
+                     {},
+                     {},
+                     determinism::NONDETERMINISTIC,
+                     {case_sensitivity::INSENSITIVE, case_sensitivity::INSENSITIVE}),
+    "Mismatch between number of key columns and key_case size.");
+}
+
+TEST_F(groupby_string_keys_test, precomputed_row_hashes)
+{
+  strings_column_wrapper keys({"aaa", "año", "₹1", "aaa", "año", "año", "aaa", "₹1", "₹1", "año"},
+                              {1, 1, 1, 1, 0, 1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto const row_hashes = cudf::hash(table_view{{keys}});
+
+  // The hash values of the keys computed once give the same groups as hashing them again
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  for (auto include_null_keys : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+    groupby::groupby gby{table_view{{keys}}, include_null_keys};
+    groupby::groupby hashed_gby{table_view{{keys}}, row_hashes->view(), include_null_keys};
+
+    auto const expected = gby.aggregate(requests);
+    auto const result   = hashed_gby.aggregate(requests);
+    auto const expected_table =
+      table_view{{expected.first->get_column(0), expected.second[0].results[0]->view()}};
+    auto const result_table =
+      table_view{{result.first->get_column(0), result.second[0].results[0]->view()}};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*sort(expected_table), *sort(result_table));
+  }
+
+  fixed_width_column_wrapper<int64_t> wrong_type{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  fixed_width_column_wrapper<int32_t> wrong_size{0, 1, 2};
+  fixed_width_column_wrapper<int32_t> nullable({0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                               {1, 1, 1, 1, 1, 1, 1, 1, 1, 0});
+  EXPECT_THROW(groupby::groupby(table_view{{keys}}, wrong_type), cudf::logic_error);
+  EXPECT_THROW(groupby::groupby(table_view{{keys}}, wrong_size), cudf::logic_error);
+  EXPECT_THROW(groupby::groupby(table_view{{keys}}, nullable), cudf::logic_error);
+}
+
 // clang-format on
 
+struct groupby_list_keys_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_list_keys_test, basic)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  using V   = int32_t;
+  using R   = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // clang-format off
+  LCW                           keys        { {1, 2}, {1}, {2}, {1, 2}, LCW{}, {1}, {2}, LCW{} };
+  fixed_width_column_wrapper<V> vals        {      0,   1,   2,      3,     4,   5,   6,     7 };
+
+  LCW                           expect_keys { LCW{}, {1}, {1, 2}, {2} };
+  fixed_width_column_wrapper<R> expect_vals {    11,   6,      3,   8 };
+  // clang-format on
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_vals,
+                  cudf::make_sum_aggregation(),
+                  force_use_sort_impl::YES);
+}
+
 struct groupby_dictionary_keys_test : public cudf::test::BaseFixture {
 };
 
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+using K = int32_t;
+
+struct streaming_groupby_test : public cudf::test::BaseFixture {
+};
+
+std::vector<std::unique_ptr<aggregation>> make_aggregations()
+{
+  std::vector<std::unique_ptr<aggregation>> aggregations;
+  aggregations.push_back(make_sum_aggregation());
+  aggregations.push_back(make_count_aggregation());
+  aggregations.push_back(make_count_aggregation(null_policy::INCLUDE));
+  aggregations.push_back(make_min_aggregation());
+  aggregations.push_back(make_max_aggregation());
+  aggregations.push_back(make_mean_aggregation());
+  aggregations.push_back(make_variance_aggregation());
+  aggregations.push_back(make_std_aggregation(0));
+  return aggregations;
+}
+
+// Sorts the results by the keys, since the order of the groups is arbitrary
+std::unique_ptr<table> sort_by_keys(
+  std::pair<std::unique_ptr<table>, std::vector<groupby::aggregation_result>> const& result)
+{
+  std::vector<column_view> columns{result.first->get_column(0).view()};
+  for (auto const& column : result.second.front().results) { columns.push_back(column->view()); }
+  return gather(table_view(columns), *sorted_order(result.first->view()));
+}
+
+TEST_F(streaming_groupby_test, matches_groupby_of_all_batches)
+{
+  fixed_width_column_wrapper<K> keys0({1, 2, 1, 3, 2}, {1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int32_t> vals0({1, 2, 3, 4, 5}, {1, 0, 1, 1, 1});
+  fixed_width_column_wrapper<K> keys1{2, 4, 1, 4};
+  fixed_width_column_wrapper<int32_t> vals1{6, 7, 8, 9};
+
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggregations;
+  aggregations.push_back(make_aggregations());
+  groupby::streaming_groupby streaming(std::move(aggregations));
+  streaming.update(table_view({keys0}), table_view({vals0}));
+  streaming.update(table_view({keys1}), table_view({vals1}));
+
+  auto const all_keys = concatenate(std::vector<column_view>{keys0, keys1});
+  auto const all_vals = concatenate(std::vector<column_view>{vals0, vals1});
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values       = all_vals->view();
+  requests[0].aggregations = make_aggregations();
+  groupby::groupby gb_obj(table_view({all_keys->view()}));
+
+  // The means of the groups are integers, so the variances are exact for both implementations
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sort_by_keys(streaming.finalize()),
+                                     *sort_by_keys(gb_obj.aggregate(requests)));
+
+  // More batches can be aggregated after the results are computed
+  fixed_width_column_wrapper<K> keys2{5};
+  fixed_width_column_wrapper<int32_t> vals2{10};
+  streaming.update(table_view({keys2}), table_view({vals2}));
+  EXPECT_EQ(streaming.finalize().first->num_rows(), 5);
+}
+
+TEST_F(streaming_groupby_test, invalid_input)
+{
+  std::vector<std::vector<std::unique_ptr<aggregation>>> unsupported;
+  unsupported.emplace_back();
+  unsupported.back().push_back(make_median_aggregation());
+  EXPECT_THROW(groupby::streaming_groupby(std::move(unsupported)), cudf::logic_error);
+
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggregations;
+  aggregations.push_back(make_aggregations());
+  groupby::streaming_groupby streaming(std::move(aggregations));
+  EXPECT_THROW(streaming.finalize(), cudf::logic_error);
+
+  fixed_width_column_wrapper<K> keys{1, 2};
+  fixed_width_column_wrapper<int32_t> vals{1, 2};
+  fixed_width_column_wrapper<int64_t> other_vals{1, 2};
+  EXPECT_THROW(streaming.update(table_view({keys}), table_view({vals, vals})), cudf::logic_error);
+  streaming.update(table_view({keys}), table_view({vals}));
+  EXPECT_THROW(streaming.update(table_view({keys}), table_view({other_vals})), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
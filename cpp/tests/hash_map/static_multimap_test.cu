@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/static_multimap.cuh>
+
+#include <cudf_test/base_fixture.hpp>
+
+#include <cudf/detail/utilities/cuda.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/count.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using key_type     = uint32_t;
+using element_type = cudf::size_type;
+
+/**
+ * @brief Inserts the pairs `(keys[i], i)` with a cooperative group per pair.
+ */
+template <typename map_view>
+__global__ void insert_pairs(map_view map, key_type const* keys, cudf::size_type size, int* error)
+{
+  auto const group  = map_view::probing_group();
+  cudf::size_type i = (threadIdx.x + blockIdx.x * blockDim.x) / group.size();
+  if (i < size && !map.insert(group, keys[i], i) && group.thread_rank() == 0) { *error = 1; }
+}
+
+/**
+ * @brief Counts the pairs of every key in `keys`, with a cooperative group per key, and checks
+ * that the elements of the pairs are the indices of inserted keys equal to the key.
+ */
+template <typename map_view>
+__global__ void count_pairs(map_view map,
+                            key_type const* keys,
+                            key_type const* inserted_keys,
+                            cudf::size_type size,
+                            cudf::size_type* counts,
+                            int* error)
+{
+  auto const group  = map_view::probing_group();
+  cudf::size_type i = (threadIdx.x + blockIdx.x * blockDim.x) / group.size();
+  if (i >= size) { return; }
+
+  cudf::size_type count{0};
+  auto window = map.initial_window(keys[i]);
+  for (cudf::size_type probed = 0; probed < map.num_windows(); ++probed) {
+    auto const slot = map.slot(window, group.thread_rank());
+    auto const key  = map.key(slot);
+    if (key == keys[i]) {
+      ++count;
+      if (inserted_keys[map.element(slot)] != key) { *error = 1; }
+    }
+    if (group.any(key == map.get_unused_key())) { break; }
+    window = map.next_window(window);
+  }
+  atomicAdd(counts + i, count);
+}
+
+}  // namespace
+
+template <typename T>
+struct StaticMultimapTest : public cudf::test::BaseFixture {
+};
+
+template <int cg_size>
+using cg_size_constant = std::integral_constant<int, cg_size>;
+
+using cg_sizes = ::testing::
+  Types<cg_size_constant<1>, cg_size_constant<2>, cg_size_constant<4>, cg_size_constant<8>>;
+
+TYPED_TEST_CASE(StaticMultimapTest, cg_sizes);
+
+TYPED_TEST(StaticMultimapTest, DuplicateKeys)
+{
+  using map_type = static_multimap<key_type,
+                                   element_type,
+                                   std::numeric_limits<key_type>::max(),
+                                   std::numeric_limits<element_type>::max(),
+                                   TypeParam::value>;
+  auto const stream = rmm::cuda_stream_default;
+
+  // Key k is inserted k + 1 times
+  constexpr cudf::size_type num_distinct_keys = 100;
+  std::vector<key_type> h_keys;
+  for (key_type k = 0; k < num_distinct_keys; ++k) {
+    h_keys.insert(h_keys.end(), k + 1, k);
+  }
+  auto const num_keys = static_cast<cudf::size_type>(h_keys.size());
+  rmm::device_uvector<key_type> keys(num_keys, stream);
+  CUDA_TRY(cudaMemcpy(
+    keys.data(), h_keys.data(), num_keys * sizeof(key_type), cudaMemcpyHostToDevice));
+
+  map_type map(num_keys, 50, stream);
+  EXPECT_GE(map.capacity(), 2 * num_keys);
+
+  rmm::device_scalar<int> error(0, stream);
+  constexpr int block_size = 128;
+  cudf::detail::grid_1d config(num_keys * TypeParam::value, block_size);
+  insert_pairs<<<config.num_blocks, block_size, 0, stream.value()>>>(
+    map.get_device_view(), keys.data(), num_keys, error.data());
+  EXPECT_EQ(error.value(stream), 0);
+  EXPECT_EQ(map.capacity() - num_keys,
+            thrust::count(rmm::exec_policy(stream),
+                          map.keys(),
+                          map.keys() + map.capacity(),
+                          std::numeric_limits<key_type>::max()));
+
+  // The keys from num_distinct_keys are absent
+  std::vector<key_type> h_probe_keys(2 * num_distinct_keys);
+  std::iota(h_probe_keys.begin(), h_probe_keys.end(), 0);
+  rmm::device_uvector<key_type> probe_keys(h_probe_keys.size(), stream);
+  CUDA_TRY(cudaMemcpy(probe_keys.data(),
+                      h_probe_keys.data(),
+                      h_probe_keys.size() * sizeof(key_type),
+                      cudaMemcpyHostToDevice));
+  rmm::device_uvector<cudf::size_type> counts(h_probe_keys.size(), stream);
+  CUDA_TRY(cudaMemset(counts.data(), 0, counts.size() * sizeof(cudf::size_type)));
+
+  cudf::detail::grid_1d probe_config(counts.size() * TypeParam::value, block_size);
+  count_pairs<<<probe_config.num_blocks, block_size, 0, stream.value()>>>(map.get_device_view(),
+                                                                           probe_keys.data(),
+                                                                           keys.data(),
+                                                                           counts.size(),
+                                                                           counts.data(),
+                                                                           error.data());
+  EXPECT_EQ(error.value(stream), 0);
+
+  std::vector<cudf::size_type> h_counts(counts.size());
+  CUDA_TRY(cudaMemcpy(h_counts.data(),
+                      counts.data(),
+                      counts.size() * sizeof(cudf::size_type),
+                      cudaMemcpyDeviceToHost));
+  for (cudf::size_type k = 0; k < 2 * num_distinct_keys; ++k) {
+    EXPECT_EQ(h_counts[k], k < num_distinct_keys ? k + 1 : 0) << "key " << k;
+  }
+}
+
+TYPED_TEST(StaticMultimapTest, FullMap)
+{
+  using map_type = static_multimap<key_type,
+                                   element_type,
+                                   std::numeric_limits<key_type>::max(),
+                                   std::numeric_limits<element_type>::max(),
+                                   TypeParam::value>;
+  auto const stream = rmm::cuda_stream_default;
+
+  map_type map(16, 100, stream);
+  auto const num_keys = map.capacity() + 1;
+  std::vector<key_type> h_keys(num_keys, 7);
+  rmm::device_uvector<key_type> keys(num_keys, stream);
+  CUDA_TRY(cudaMemcpy(
+    keys.data(), h_keys.data(), num_keys * sizeof(key_type), cudaMemcpyHostToDevice));
+
+  rmm::device_scalar<int> error(0, stream);
+  constexpr int block_size = 128;
+  cudf::detail::grid_1d config(num_keys * TypeParam::value, block_size);
+  insert_pairs<<<config.num_blocks, block_size, 0, stream.value()>>>(
+    map.get_device_view(), keys.data(), num_keys, error.data());
+  EXPECT_EQ(error.value(stream), 1);
+}
+
+struct StaticMultimapOccupancyTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StaticMultimapOccupancyTest, InvalidOccupancy)
+{
+  using map_type = static_multimap<key_type,
+                                   element_type,
+                                   std::numeric_limits<key_type>::max(),
+                                   std::numeric_limits<element_type>::max(),
+                                   4>;
+  EXPECT_THROW(map_type(10, 0), cudf::logic_error);
+  EXPECT_THROW(map_type(10, 101), cudf::logic_error);
+}
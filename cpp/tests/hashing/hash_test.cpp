@@ -449,6 +449,176 @@ TEST_F(SparkMurmurHash3Test, ListThrows)
     cudf::logic_error);
 }
 
+class XXHash64Test : public cudf::test::BaseFixture {
+};
+
+TEST_F(XXHash64Test, MultiValueWithSeeds)
+{
+  // The hash values are those of the reference xxHash64 implementation, which the Spark
+  // `xxhash64` function computes for strings and integers with its default seed of 42
+  fixed_width_column_wrapper<int64_t> const strings_col_result({-7444071767201028348,
+                                                                -3617261401988713833,
+                                                                8198945020833482635,
+                                                                -5346617152005100141,
+                                                                -7312730237181564987});
+  fixed_width_column_wrapper<int64_t> const ints_col_result({3614696996920510707,
+                                                             -7987742665087449293,
+                                                             8990748234399402673,
+                                                             2073849959933241805,
+                                                             1508894993788531228});
+  fixed_width_column_wrapper<int64_t> const combo_result({5333022629466737987,
+                                                          6923444916845418808,
+                                                          7316197137724241447,
+                                                          -7504934759248887292,
+                                                          2349198184878574161});
+
+  strings_column_wrapper const strings_col({"",
+                                            "The quick brown fox",
+                                            "jumps over the lazy dog.",
+                                            "All work and no play makes Jack a dull boy",
+                                            "!\"#$%&\'()*+,-./0123456789:;<=>?@[\\]^_`{|}~"});
+
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 100, -100, limits::min(), limits::max()});
+
+  std::vector<std::unique_ptr<cudf::column>> struct_field_cols;
+  struct_field_cols.emplace_back(std::make_unique<cudf::column>(strings_col));
+  struct_field_cols.emplace_back(std::make_unique<cudf::column>(ints_col));
+  structs_column_wrapper structs_col(std::move(struct_field_cols));
+
+  constexpr auto hasher   = cudf::hash_id::HASH_XXHASH64;
+  auto const strings_hash = cudf::hash(cudf::table_view({strings_col}), hasher, {}, 42);
+  auto const ints_hash    = cudf::hash(cudf::table_view({ints_col}), hasher, {}, 42);
+  auto const combo_hash   = cudf::hash(cudf::table_view({strings_col, ints_col}), hasher, {}, 42);
+  auto const structs_hash = cudf::hash(cudf::table_view({structs_col}), hasher, {}, 42);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*strings_hash, strings_col_result);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*ints_hash, ints_col_result);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*combo_hash, combo_result);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*structs_hash, combo_result);
+}
+
+TEST_F(XXHash64Test, NullsAndWidenedTypes)
+{
+  // Null elements leave the hash unchanged, so a row of nulls hashes to the seed
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 100, 7}, {1, 1, 0});
+  fixed_width_column_wrapper<int64_t> const ints_col_result(
+    {3614696996920510707, -7987742665087449293, 42});
+
+  // Bytes and shorts are hashed as ints, and all truth values alike
+  fixed_width_column_wrapper<int8_t> const bytes_col({0, 100, 7}, {1, 1, 0});
+  fixed_width_column_wrapper<int16_t> const shorts_col({0, 100, 7}, {1, 1, 0});
+  fixed_width_column_wrapper<bool> const bools_col1({0, 1, 1});
+  fixed_width_column_wrapper<bool> const bools_col2({0, 2, 255});
+
+  constexpr auto hasher  = cudf::hash_id::HASH_XXHASH64;
+  auto const ints_hash   = cudf::hash(cudf::table_view({ints_col}), hasher, {}, 42);
+  auto const bytes_hash  = cudf::hash(cudf::table_view({bytes_col}), hasher, {}, 42);
+  auto const shorts_hash = cudf::hash(cudf::table_view({shorts_col}), hasher, {}, 42);
+  auto const bools_hash1 = cudf::hash(cudf::table_view({bools_col1}), hasher, {}, 42);
+  auto const bools_hash2 = cudf::hash(cudf::table_view({bools_col2}), hasher, {}, 42);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*ints_hash, ints_col_result);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*bytes_hash, ints_col_result);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*shorts_hash, ints_col_result);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*bools_hash1, *bools_hash2);
+}
+
+TYPED_TEST(HashTestFloatTyped, XXHash64Extremes)
+{
+  using T = TypeParam;
+  T min   = std::numeric_limits<T>::min();
+  T max   = std::numeric_limits<T>::max();
+  T nan   = std::numeric_limits<T>::quiet_NaN();
+  T inf   = std::numeric_limits<T>::infinity();
+
+  fixed_width_column_wrapper<T> const col({T(0.0), T(100.0), T(-100.0), min, max, nan, inf, -inf});
+  fixed_width_column_wrapper<T> const col_neg_zero(
+    {T(-0.0), T(100.0), T(-100.0), min, max, nan, inf, -inf});
+  fixed_width_column_wrapper<T> const col_neg_nan(
+    {T(0.0), T(100.0), T(-100.0), min, max, -nan, inf, -inf});
+
+  constexpr auto hasher        = cudf::hash_id::HASH_XXHASH64;
+  auto const hash_col          = cudf::hash(cudf::table_view({col}), hasher, {}, 42);
+  auto const hash_col_neg_zero = cudf::hash(cudf::table_view({col_neg_zero}), hasher, {}, 42);
+  auto const hash_col_neg_nan  = cudf::hash(cudf::table_view({col_neg_nan}), hasher, {}, 42);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*hash_col, *hash_col_neg_zero);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*hash_col, *hash_col_neg_nan);
+}
+
+TEST_F(XXHash64Test, ListThrows)
+{
+  lists_column_wrapper<cudf::string_view> strings_list_col({{""}, {"abc"}, {"123"}});
+  EXPECT_THROW(
+    cudf::hash(cudf::table_view({strings_list_col}), cudf::hash_id::HASH_XXHASH64, {}),
+    cudf::logic_error);
+}
+
+class MurmurHash3X64128Test : public cudf::test::BaseFixture {
+};
+
+TEST_F(MurmurHash3X64128Test, MultiValueWithSeeds)
+{
+  // The hash values are those of the reference MurmurHash3_x64_128 implementation
+  fixed_width_column_wrapper<uint64_t> strings_h1({0ul,
+                                                   9630400972940003882ul,
+                                                   11224732510765974842ul,
+                                                   13322780081508519690ul,
+                                                   16931373901811523032ul});
+  fixed_width_column_wrapper<uint64_t> strings_h2({0ul,
+                                                   18295121695496442782ul,
+                                                   2267992567996693585ul,
+                                                   6552060267096971931ul,
+                                                   12541077015999008594ul});
+  structs_column_wrapper const strings_col_result{{strings_h1, strings_h2}};
+  fixed_width_column_wrapper<uint64_t> ints_h1({5111656417125064774ul,
+                                                16139712339019757208ul,
+                                                15288195652925180714ul,
+                                                16897149728552970421ul,
+                                                2623948243388061899ul});
+  fixed_width_column_wrapper<uint64_t> ints_h2({7107720512181644050ul,
+                                                4813206135331268068ul,
+                                                328158684254003924ul,
+                                                9414321833340810261ul,
+                                                3644673327321482487ul});
+  structs_column_wrapper const ints_col_result{{ints_h1, ints_h2}};
+
+  strings_column_wrapper const strings_col({"",
+                                            "The quick brown fox",
+                                            "jumps over the lazy dog.",
+                                            "All work and no play makes Jack a dull boy",
+                                            "!\"#$%&\'()*+,-./0123456789:;<=>?@[\\]^_`{|}~"});
+
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 100, -100, limits::min(), limits::max()});
+
+  constexpr auto hasher   = cudf::hash_id::HASH_MURMUR3_X64_128;
+  auto const strings_hash = cudf::hash(cudf::table_view({strings_col}), hasher, {}, 0);
+  auto const ints_hash    = cudf::hash(cudf::table_view({ints_col}), hasher, {}, 42);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*strings_hash, strings_col_result);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*ints_hash, ints_col_result);
+}
+
+TEST_F(MurmurHash3X64128Test, MultiValueNulls)
+{
+  // Nulls with different values should be equal
+  strings_column_wrapper const strings_col1({"", "The quick brown fox", "null"}, {1, 1, 0});
+  strings_column_wrapper const strings_col2({"", "The quick brown fox", "other"}, {1, 1, 0});
+  fixed_width_column_wrapper<int64_t> const ints_col1({0, 100, -100}, {1, 0, 1});
+  fixed_width_column_wrapper<int64_t> const ints_col2({0, 200, -100}, {1, 0, 1});
+
+  auto const input1 = cudf::table_view({strings_col1, ints_col1});
+  auto const input2 = cudf::table_view({strings_col2, ints_col2});
+
+  auto const output1 = cudf::hash(input1, cudf::hash_id::HASH_MURMUR3_X64_128);
+  auto const output2 = cudf::hash(input2, cudf::hash_id::HASH_MURMUR3_X64_128);
+
+  EXPECT_EQ(input1.num_rows(), output1->size());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
+}
+
 class MD5HashTest : public cudf::test::BaseFixture {
 };
 
@@ -712,4 +882,108 @@ TYPED_TEST(MD5HashTestFloatTyped, TestListExtremes)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view(), true);
 }
 
+class SHAHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SHAHashTest, MultiValue)
+{
+  // The hash values were determined by running Python's hashlib on the UTF-8 bytes of the
+  // strings, followed by the little-endian bytes of the ints for the rows of both columns
+  strings_column_wrapper const sha1_string_results({"da39a3ee5e6b4b0d3255bfef95601890afd80709",
+                                                    "c519c1a06cdbeb2bc499e22137fb48683858b345",
+                                                    "d46c8e18f994d4fc745cf10741ed4973b9f30b2a",
+                                                    "a62ca720fbab830c8890044eacbeac216f1ca2e4",
+                                                    "11e16c52273b5669a41d17ec7c187475193f88b3",
+                                                    "be7dc80d1faf74c513b4c78a0f965ce28316fd12",
+                                                    "293a341dfde90d5d0d617beef986d7f2ee39cc89"});
+  strings_column_wrapper const sha1_combo_results({"9069ca78e7450a285173431b3e52c5c25299e473",
+                                                   "25cb3f935d06b6e83f82bb630dcdc4fcacd343eb",
+                                                   "ec1e46503ff9947a57ab38b4ab9c7e3831a788d2",
+                                                   "eb63867263566d1e42bdbbe80952361260df9804",
+                                                   "1d0eb2b0531c4d32fb6a5dc43c01023b5819cc33",
+                                                   "96a961b002bd1976dc32c190ef1bb088768f38dd",
+                                                   "3104e0ce44944a14dd6c4c2294ebab566e0cd403"});
+  strings_column_wrapper const sha256_string_results(
+    {"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+     "5cac4f980fedc3d3f1f99b4be3472c9b30d56523e632d151237ec9309048bda9",
+     "2e8d405a17c169975fb39d499838ec89d244d84660ba8029bff531311fbeb676",
+     "2ce9936a4a2234bf8a76c37d92e01d549d03949792242e7f8a1ad68575e4e4a8",
+     "255fdd4d80a72f67921eb36f3e1157ea3e995068cee80e430c034e0d3692f614",
+     "ff19fd9c01235269e45d7b703b9a3f2d73cfe041287b04dd6b26b2427c3da12b",
+     "aab566629df58d77487412eb9ae921fadea0411501806d9a577d7adfcc58dd43"});
+  strings_column_wrapper const sha256_combo_results(
+    {"df3f619804a92fdb4057192dc43dd748ea778adc52bc498ce80524c014b81119",
+     "30918db843b6e591861cff38b8a04400281a0e4d63de32c10fd613b708aad1fc",
+     "5923ef90c08fd935f46e843de65030bd26e0f7584dce72fc1fb3588f1a1ace90",
+     "a82c2ae6fc9b2df0ba8dc9bac3aa7a636242fcde424aca7fbe17e3929c6c4e5d",
+     "a61fd185ddfa96be12f1113ee71dadbe683a6c5f11fa0f75025267599487e0c6",
+     "eef35d7365392c9320e9228c29bd75a3260cd88e093f8df32f12fe6292e0b2ca",
+     "2a5d26236be9ffcf2c9243e614e9fc68d5d91d0eae106cad589ee6fed5158921"});
+
+  // The last two strings fill a whole chunk and leave no room for the padding of their chunk
+  strings_column_wrapper const strings_col(
+    {"",
+     "The quick brown fox",
+     "jumps over the lazy dog.",
+     "All work and no play makes Jack a dull boy",
+     "!\"#$%&\'()*+,-./0123456789:;<=>?@[\\]^_`{|}~",
+     "A 64 character string that spans a whole SHA chunk of 512 bits!!",
+     "Sixty characters fill the chunk past the padding of a hash!!"});
+
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> const ints_col(
+    {0, 100, -100, limits::min(), limits::max(), 7, -7});
+
+  std::vector<std::unique_ptr<cudf::column>> struct_field_cols;
+  struct_field_cols.emplace_back(std::make_unique<cudf::column>(strings_col));
+  struct_field_cols.emplace_back(std::make_unique<cudf::column>(ints_col));
+  structs_column_wrapper structs_col(std::move(struct_field_cols));
+
+  auto const strings_input = cudf::table_view({strings_col});
+  auto const combo_input   = cudf::table_view({strings_col, ints_col});
+  auto const structs_input = cudf::table_view({structs_col});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::hash(strings_input, cudf::hash_id::HASH_SHA1),
+                                 sha1_string_results);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::hash(combo_input, cudf::hash_id::HASH_SHA1),
+                                 sha1_combo_results);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::hash(structs_input, cudf::hash_id::HASH_SHA1),
+                                 sha1_combo_results);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::hash(strings_input, cudf::hash_id::HASH_SHA256),
+                                 sha256_string_results);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::hash(combo_input, cudf::hash_id::HASH_SHA256),
+                                 sha256_combo_results);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::hash(structs_input, cudf::hash_id::HASH_SHA256),
+                                 sha256_combo_results);
+}
+
+TEST_F(SHAHashTest, MultiValueNulls)
+{
+  // Nulls with different values should be equal
+  strings_column_wrapper const strings_col1({"", "The quick brown fox", "null", "last"},
+                                            {1, 1, 0, 1});
+  strings_column_wrapper const strings_col2({"", "The quick brown fox", "other", "last"},
+                                            {1, 1, 0, 1});
+  fixed_width_column_wrapper<double> const doubles_col1({0.0, 1.5, -0.0, 2.0}, {1, 0, 1, 1});
+  fixed_width_column_wrapper<double> const doubles_col2({-0.0, 3.0, 0.0, 2.0}, {1, 0, 1, 1});
+
+  auto const input1 = cudf::table_view({strings_col1, doubles_col1});
+  auto const input2 = cudf::table_view({strings_col2, doubles_col2});
+
+  for (auto const hasher : {cudf::hash_id::HASH_SHA1, cudf::hash_id::HASH_SHA256}) {
+    auto const output1 = cudf::hash(input1, hasher);
+    auto const output2 = cudf::hash(input2, hasher);
+
+    EXPECT_EQ(input1.num_rows(), output1->size());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
+  }
+}
+
+TEST_F(SHAHashTest, ListThrows)
+{
+  lists_column_wrapper<int32_t> ints_list_col({{0}, {1, 2}, {3}});
+  EXPECT_THROW(cudf::hash(cudf::table_view({ints_list_col}), cudf::hash_id::HASH_SHA256),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
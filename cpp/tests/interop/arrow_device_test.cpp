@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <string>
+
+struct ArrowDeviceTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+cudf::table make_table()
+{
+  auto ints    = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4, 5}, {1, 0, 1, 1, 1});
+  auto doubles = cudf::test::fixed_width_column_wrapper<double>({0.5, 1.5, 2.5, 3.5, 4.5});
+  auto strings =
+    cudf::test::strings_column_wrapper({"Vimes", "", "Carrot", "Angua", "Nobby"}, {1, 0, 1, 1, 1});
+  auto lists =
+    cudf::test::lists_column_wrapper<int64_t>{{1, 2}, {3}, {8}, {4, 5, 6}, {7}}.release();
+  auto struct_child = cudf::test::fixed_width_column_wrapper<int16_t>({9, 8, 7, 6, 5});
+  auto structs      = cudf::test::structs_column_wrapper({struct_child}, {1, 1, 0, 1, 1});
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(ints.release());
+  columns.push_back(doubles.release());
+  columns.push_back(strings.release());
+  columns.push_back(std::move(lists));
+  columns.push_back(structs.release());
+  return cudf::table{std::move(columns)};
+}
+}  // namespace
+
+TEST_F(ArrowDeviceTest, RoundTrip)
+{
+  auto const input = make_table();
+  auto schema      = cudf::to_arrow_schema(input.view());
+  auto array       = cudf::to_arrow_device(input.view());
+
+  EXPECT_EQ(array->device_type, ARROW_DEVICE_CUDA);
+  EXPECT_NE(array->sync_event, nullptr);
+  EXPECT_EQ(array->array.length, input.num_rows());
+  EXPECT_EQ(array->array.n_children, input.num_columns());
+  EXPECT_EQ(std::string{schema->format}, "+s");
+  EXPECT_EQ(std::string{schema->children[2]->format}, "u");
+  EXPECT_EQ(std::string{schema->children[3]->format}, "+l");
+
+  // the buffers are not copied
+  EXPECT_EQ(array->array.children[1]->buffers[1], input.view().column(1).head());
+
+  auto const got = cudf::from_arrow_device(schema.get(), array.get());
+  EXPECT_EQ(array->array.release, nullptr);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input.view(), *got);
+}
+
+TEST_F(ArrowDeviceTest, SlicedTable)
+{
+  auto const input  = make_table();
+  auto const sliced = cudf::slice(input.view(), {1, 4})[0];
+  auto schema       = cudf::to_arrow_schema(sliced);
+  auto array        = cudf::to_arrow_device(sliced);
+
+  EXPECT_EQ(array->array.children[0]->offset, 1);
+
+  auto const got = cudf::from_arrow_device(schema.get(), array.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sliced, *got);
+}
+
+TEST_F(ArrowDeviceTest, OwningExport)
+{
+  auto const expected = make_table();
+  auto schema         = cudf::to_arrow_schema(expected.view());
+  auto array          = cudf::to_arrow_device(std::make_unique<cudf::table>(expected));
+
+  auto const got = cudf::from_arrow_device(schema.get(), array.get());
+  array.reset();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.view(), *got);
+}
+
+TEST_F(ArrowDeviceTest, SchemaNames)
+{
+  auto ints    = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2});
+  auto list    = cudf::test::lists_column_wrapper<int32_t>{{1}, {2, 3}};
+  auto input   = cudf::table_view{{ints, list}};
+  auto list_md = cudf::column_metadata{"b"};
+
+  list_md.children_meta = {cudf::column_metadata{"offsets"}, cudf::column_metadata{"element"}};
+
+  auto schema = cudf::to_arrow_schema(input, {cudf::column_metadata{"a"}, list_md});
+  EXPECT_EQ(std::string{schema->children[0]->name}, "a");
+  EXPECT_EQ(std::string{schema->children[1]->name}, "b");
+  EXPECT_EQ(std::string{schema->children[1]->children[0]->name}, "element");
+}
+
+TEST_F(ArrowDeviceTest, UnsupportedTypes)
+{
+  auto bools = cudf::test::fixed_width_column_wrapper<bool>({true, false});
+  auto input = cudf::table_view{{bools}};
+  EXPECT_THROW(cudf::to_arrow_schema(input), cudf::logic_error);
+  EXPECT_THROW(cudf::to_arrow_device(input), cudf::logic_error);
+
+  auto const table = make_table();
+  auto schema      = cudf::to_arrow_schema(table.view());
+  auto array       = cudf::to_arrow_device(table.view());
+
+  array->device_type = ARROW_DEVICE_CPU;
+  EXPECT_THROW(cudf::from_arrow_device(schema.get(), array.get()), cudf::logic_error);
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/ipc.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+struct ArrowIpcTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ArrowIpcTest, RoundTrip)
+{
+  auto ints    = cudf::test::fixed_width_column_wrapper<int64_t>({1, 2, 3, 4}, {1, 0, 1, 1});
+  auto strings = cudf::test::strings_column_wrapper({"Vimes", "", "Carrot", "Angua"}, {1, 0, 1, 1});
+  auto lists   = cudf::test::lists_column_wrapper<int32_t>{{1, 2}, {3}, {4, 5, 6}, {7}};
+
+  auto struct_child = cudf::test::fixed_width_column_wrapper<double>({0.5, 1.5, 2.5, 3.5});
+  auto structs      = cudf::test::structs_column_wrapper({struct_child}, {1, 1, 0, 1});
+  auto const input  = cudf::table_view{{ints, strings, lists, structs}};
+  auto const sliced = cudf::slice(input, {1, 3})[0];
+
+  auto const schema_message = cudf::ipc::write_schema(input);
+  auto const first          = cudf::ipc::write_record_batch(input);
+  auto const second         = cudf::ipc::write_record_batch(sliced);
+
+  // the messages of a stream are consecutive in device memory
+  rmm::device_buffer messages(first->size() + second->size());
+  auto const d_messages = static_cast<uint8_t*>(messages.data());
+  CUDA_TRY(cudaMemcpy(d_messages, first->data(), first->size(), cudaMemcpyDeviceToDevice));
+  CUDA_TRY(cudaMemcpy(
+    d_messages + first->size(), second->data(), second->size(), cudaMemcpyDeviceToDevice));
+
+  auto const schema = cudf::ipc::read_schema(*schema_message);
+  EXPECT_EQ(schema->num_fields(), input.num_columns());
+
+  auto const batches = cudf::ipc::read_record_batches(
+    schema, cudf::device_span<uint8_t const>(d_messages, messages.size()));
+  ASSERT_EQ(batches.size(), 2u);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, *batches[0]);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sliced, *batches[1]);
+}
+
+TEST_F(ArrowIpcTest, UnsupportedTypes)
+{
+  auto bools = cudf::test::fixed_width_column_wrapper<bool>({true, false});
+  auto input = cudf::table_view{{bools}};
+  EXPECT_THROW(cudf::ipc::write_schema(input), cudf::logic_error);
+  EXPECT_THROW(cudf::ipc::write_record_batch(input), cudf::logic_error);
+}
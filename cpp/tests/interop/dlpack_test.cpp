@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/interop.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -20,6 +21,8 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <rmm/device_uvector.hpp>
+
 #include <dlpack/dlpack.h>
 
 using namespace cudf::test;
@@ -368,3 +371,109 @@ TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
   // Verify that from_dlpack(to_dlpack(input)) == input
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
+
+TYPED_TEST(DLPackNumericTests, ToDlpackView)
+{
+  using T       = TypeParam;
+  auto const cv = cudf::test::make_type_param_vector<T>({1, 2, 3, 4, 5});
+  fixed_width_column_wrapper<T> col(cv.cbegin(), cv.cend());
+  auto const sliced = cudf::slice(col, {1, 4})[0];
+
+  unique_managed_tensor result(cudf::to_dlpack_view(sliced));
+
+  // The tensor points to the column data
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<T>(tensor.dtype);
+  EXPECT_EQ(kDLGPU, tensor.ctx.device_type);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(3, tensor.shape[0]);
+  EXPECT_EQ(sliced.data<T>(), tensor.data);
+
+  auto const round_trip = cudf::from_dlpack(result.get());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sliced, round_trip->get_column(0));
+}
+
+TYPED_TEST(DLPackNumericTests, FromDlpackRowMajorCpu)
+{
+  using T         = TypeParam;
+  auto const data = cudf::test::make_type_param_vector<T>({1, 5, 2, 6, 3, 7, 4, 8});
+
+  int64_t shape[2]   = {4, 2};
+  int64_t strides[2] = {2, 1};
+
+  DLManagedTensor tensor{};
+  tensor.dl_tensor.ctx.device_type = kDLCPU;
+  tensor.dl_tensor.dtype           = get_dtype<T>();
+  tensor.dl_tensor.ndim            = 2;
+  tensor.dl_tensor.shape           = shape;
+  tensor.dl_tensor.strides         = strides;
+
+  thrust::host_vector<T> host_vector(data.begin(), data.end());
+  tensor.dl_tensor.data = host_vector.data();
+
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<TypeParam> col2({5, 6, 7, 8});
+  cudf::table_view expected({col1, col2});
+
+  auto result = cudf::from_dlpack(&tensor);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
+}
+
+TYPED_TEST(DLPackNumericTests, ToPreallocatedDlpack)
+{
+  using T          = TypeParam;
+  auto const data1 = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
+  auto const data2 = cudf::test::make_type_param_vector<T>({5, 6, 7, 8});
+  fixed_width_column_wrapper<T> col1(data1.cbegin(), data1.cend());
+  fixed_width_column_wrapper<T> col2(data2.cbegin(), data2.cend());
+  cudf::table_view input({col1, col2});
+
+  // Row-major and column-major tensors, with the layout given by the strides
+  for (bool row_major : {true, false}) {
+    rmm::device_uvector<T> buffer(8, rmm::cuda_stream_default);
+    int64_t shape[2]   = {4, 2};
+    int64_t strides[2] = {row_major ? 2 : 1, row_major ? 1 : 4};
+
+    DLManagedTensor tensor{};
+    tensor.dl_tensor.ctx.device_type = kDLGPU;
+    tensor.dl_tensor.dtype           = get_dtype<T>();
+    tensor.dl_tensor.ndim            = 2;
+    tensor.dl_tensor.shape           = shape;
+    tensor.dl_tensor.strides         = strides;
+    tensor.dl_tensor.data            = buffer.data();
+    CUDA_TRY(cudaGetDevice(&tensor.dl_tensor.ctx.device_id));
+
+    cudf::to_dlpack(input, &tensor);
+    auto result = cudf::from_dlpack(&tensor);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(input, result->view());
+  }
+}
+
+TYPED_TEST(DLPackNumericTests, ToPreallocatedDlpackReplaceNulls)
+{
+  using T          = TypeParam;
+  auto const data  = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
+  auto const fills = cudf::test::make_type_param_vector<T>({1, 9, 3, 9});
+  fixed_width_column_wrapper<T> col(data.cbegin(), data.cend(), {1, 0, 1, 0});
+  cudf::table_view input({col});
+
+  rmm::device_uvector<T> buffer(4, rmm::cuda_stream_default);
+  int64_t shape[1] = {4};
+
+  DLManagedTensor tensor{};
+  tensor.dl_tensor.ctx.device_type = kDLGPU;
+  tensor.dl_tensor.dtype           = get_dtype<T>();
+  tensor.dl_tensor.ndim            = 1;
+  tensor.dl_tensor.shape           = shape;
+  tensor.dl_tensor.data            = buffer.data();
+  CUDA_TRY(cudaGetDevice(&tensor.dl_tensor.ctx.device_id));
+
+  EXPECT_THROW(cudf::to_dlpack(input, &tensor), cudf::logic_error);
+
+  cudf::numeric_scalar<T> null_replacement(cudf::test::make_type_param_scalar<T>(9));
+  cudf::to_dlpack(input, &tensor, null_replacement);
+
+  fixed_width_column_wrapper<T> expected(fills.cbegin(), fills.cend());
+  auto result = cudf::from_dlpack(&tensor);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->get_column(0));
+}
@@ -326,6 +326,28 @@ TEST_F(FromArrowTest, ChunkedArray)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_cudf_table->view(), got_cudf_table->view());
 }
 
+TEST_F(FromArrowTest, LargeStrings)
+{
+  std::vector<std::string> data{"fff", "aaa", "", "fff", "ccc"};
+  std::vector<uint8_t> mask{1, 1, 1, 0, 1};
+  std::shared_ptr<arrow::LargeStringArray> string_array;
+  arrow::LargeStringBuilder string_builder;
+  CUDF_EXPECTS(string_builder.AppendValues(data, mask.data()).ok(),
+               "Failed to append values to string builder");
+  CUDF_EXPECTS(string_builder.Finish(&string_array).ok(), "Failed to create arrow string array");
+
+  auto arrow_table = arrow::Table::Make(
+    arrow::schema({arrow::field("a", string_array->type())}), {string_array});
+  auto expected = cudf::test::strings_column_wrapper(data.begin(), data.end(), mask.begin());
+
+  auto got_cudf_table = cudf::from_arrow(*arrow_table);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected}), got_cudf_table->view());
+
+  auto got_sliced_table = cudf::from_arrow(*arrow_table->Slice(1, 3));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({cudf::slice(expected, {1, 4}).front()}),
+                                got_sliced_table->view());
+}
+
 struct FromArrowTestSlice
   : public FromArrowTest,
     public ::testing::WithParamInterface<std::tuple<cudf::size_type, cudf::size_type>> {
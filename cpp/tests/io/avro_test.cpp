@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/io/avro.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct AvroWriterTest : public cudf::test::BaseFixture {
+};
+
+struct AvroWriterCompressionTest
+  : public AvroWriterTest,
+    public ::testing::WithParamInterface<cudf_io::compression_type> {
+};
+
+TEST_P(AvroWriterCompressionTest, RoundTrip)
+{
+  constexpr auto num_rows = 1000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valids   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 13, 'a' + i % 26); });
+
+  fixed_width_column_wrapper<int32_t> col0(sequence, sequence + num_rows, valids);
+  auto longs = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 2 ? -1 : 1) * (int64_t{1} << (i % 63)); });
+  fixed_width_column_wrapper<int64_t> col1(longs, longs + num_rows);
+  auto doubles = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  fixed_width_column_wrapper<double> col2(doubles, doubles + num_rows);
+  strings_column_wrapper col3(strings, strings + num_rows, valids);
+  auto bools = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 == 0; });
+  fixed_width_column_wrapper<bool> col4(bools, bools + num_rows);
+  cudf::table_view const input{{col0, col1, col2, col3, col4}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"ints", "longs", "doubles", "strings", "bools"};
+  std::vector<char> out_buffer;
+  cudf_io::avro_writer_options out_options =
+    cudf_io::avro_writer_options::builder(cudf_io::sink_info(&out_buffer), input)
+      .metadata(&metadata)
+      .compression(GetParam())
+      .block_size(1024);
+  cudf_io::write_avro(out_options);
+
+  cudf_io::avro_reader_options in_options = cudf_io::avro_reader_options::builder(
+    cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+  auto const result = cudf_io::read_avro(in_options);
+
+  EXPECT_EQ(result.metadata.column_names, metadata.column_names);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.tbl->view(), input);
+}
+
+INSTANTIATE_TEST_CASE_P(AvroWriter,
+                        AvroWriterCompressionTest,
+                        ::testing::Values(cudf_io::compression_type::NONE,
+                                          cudf_io::compression_type::SNAPPY,
+                                          cudf_io::compression_type::GZIP));
+
+TEST_F(AvroWriterTest, UnsupportedCompression)
+{
+  fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+  std::vector<char> out_buffer;
+  cudf_io::avro_writer_options out_options =
+    cudf_io::avro_writer_options::builder(cudf_io::sink_info(&out_buffer), cudf::table_view{{col}})
+      .compression(cudf_io::compression_type::ZSTD);
+  EXPECT_THROW(cudf_io::write_avro(out_options), cudf::logic_error);
+}
+
+/**
+ * @brief Host source that reads to device memory when the reader prefers it
+ */
+class DeviceReadSource : public cudf_io::datasource {
+ public:
+  explicit DeviceReadSource(std::vector<char> const& data) : data(data) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    std::vector<uint8_t> out(std::min(size, data.size() - offset));
+    host_read(offset, size, out.data());
+    return buffer::create(std::move(out));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const read_size = std::min(size, data.size() - offset);
+    std::memcpy(dst, data.data() + offset, read_size);
+    return read_size;
+  }
+
+  bool supports_device_read() const override { return true; }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    ++num_device_reads;
+    auto const read_size = std::min(size, data.size() - offset);
+    CUDA_TRY(cudaMemcpyAsync(
+      dst, data.data() + offset, read_size, cudaMemcpyHostToDevice, stream.value()));
+    stream.synchronize();
+    return read_size;
+  }
+
+  size_t size() const override { return data.size(); }
+
+  std::vector<char> const& data;
+  int num_device_reads = 0;
+};
+
+struct AvroReaderTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Returns an Avro file of `table`, written in blocks of a few rows each
+   */
+  std::vector<char> write_table(cudf::table_view const& table,
+                                std::vector<std::string> const& names,
+                                cudf_io::compression_type compression)
+  {
+    cudf_io::table_metadata metadata;
+    metadata.column_names = names;
+    std::vector<char> out_buffer;
+    cudf_io::avro_writer_options out_options =
+      cudf_io::avro_writer_options::builder(cudf_io::sink_info(&out_buffer), table)
+        .metadata(&metadata)
+        .compression(compression)
+        .block_size(256);
+    cudf_io::write_avro(out_options);
+    return out_buffer;
+  }
+
+  /**
+   * @brief Returns rows `first_row` to `first_row + num_rows` of an integer and a string column
+   */
+  std::unique_ptr<cudf::table> make_table(int first_row, int num_rows)
+  {
+    auto ints = cudf::detail::make_counting_transform_iterator(first_row, [](auto i) { return i; });
+    auto valids =
+      cudf::detail::make_counting_transform_iterator(first_row, [](auto i) { return i % 5; });
+    auto strings = cudf::detail::make_counting_transform_iterator(
+      first_row, [](auto i) { return std::string(i % 11, 'a' + i % 26); });
+    fixed_width_column_wrapper<int32_t> col0(ints, ints + num_rows, valids);
+    strings_column_wrapper col1(strings, strings + num_rows, valids);
+    return std::make_unique<cudf::table>(cudf::table_view{{col0, col1}});
+  }
+};
+
+TEST_F(AvroReaderTest, MultipleSources)
+{
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<std::vector<char>> files;
+  std::vector<std::pair<int, int>> const source_rows{{0, 300}, {300, 50}, {350, 200}};
+  for (auto const& rows : source_rows) {
+    tables.push_back(make_table(rows.first, rows.second));
+    files.push_back(
+      write_table(tables.back()->view(), {"ints", "strings"}, cudf_io::compression_type::SNAPPY));
+  }
+  std::vector<cudf_io::host_buffer> buffers;
+  for (auto const& file : files) {
+    buffers.emplace_back(file.data(), file.size());
+  }
+  auto const expected = make_table(0, 550);
+
+  cudf_io::avro_reader_options in_options =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{buffers});
+  auto const result = cudf_io::read_avro(in_options);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.tbl->view(), expected->view());
+
+  // The selected rows start in a block of the first source and end in the last source
+  in_options.set_skip_rows(250);
+  in_options.set_num_rows(200);
+  auto const bounded = cudf_io::read_avro(in_options);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(bounded.tbl->view(),
+                                     cudf::slice(expected->view(), {250, 450})[0]);
+
+  // The selected rows end exactly at the boundary of the first two sources
+  in_options.set_skip_rows(100);
+  in_options.set_num_rows(200);
+  auto const up_to_boundary = cudf_io::read_avro(in_options);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(up_to_boundary.tbl->view(),
+                                     cudf::slice(expected->view(), {100, 300})[0]);
+
+  // The selected rows start exactly at the first row of the second source
+  in_options.set_skip_rows(300);
+  in_options.set_num_rows(-1);
+  auto const from_boundary = cudf_io::read_avro(in_options);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(from_boundary.tbl->view(),
+                                     cudf::slice(expected->view(), {300, 550})[0]);
+}
+
+TEST_F(AvroReaderTest, MismatchedSources)
+{
+  auto const table = make_table(0, 10);
+  auto const file =
+    write_table(table->view(), {"ints", "strings"}, cudf_io::compression_type::NONE);
+  auto const renamed =
+    write_table(table->view(), {"ints", "other"}, cudf_io::compression_type::NONE);
+  auto const snappy =
+    write_table(table->view(), {"ints", "strings"}, cudf_io::compression_type::SNAPPY);
+  fixed_width_column_wrapper<int64_t> longs{1, 2, 3};
+  auto const retyped =
+    write_table(cudf::table_view{{longs}}, {"ints"}, cudf_io::compression_type::NONE);
+
+  for (auto const* other : {&renamed, &snappy, &retyped}) {
+    std::vector<cudf_io::host_buffer> buffers{{file.data(), file.size()},
+                                              {other->data(), other->size()}};
+    cudf_io::avro_reader_options const in_options =
+      cudf_io::avro_reader_options::builder(cudf_io::source_info{buffers});
+    EXPECT_THROW(cudf_io::read_avro(in_options), cudf::logic_error);
+  }
+}
+
+TEST_F(AvroReaderTest, DeviceRead)
+{
+  auto const expected = make_table(0, 500);
+  for (auto const compression :
+       {cudf_io::compression_type::NONE, cudf_io::compression_type::SNAPPY}) {
+    auto const file = write_table(expected->view(), {"ints", "strings"}, compression);
+    DeviceReadSource source(file);
+    cudf_io::avro_reader_options const in_options =
+      cudf_io::avro_reader_options::builder(cudf_io::source_info{&source})
+        .skip_rows(100)
+        .num_rows(300);
+    auto const result = cudf_io::read_avro(in_options);
+    EXPECT_EQ(source.num_device_reads, 1);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.tbl->view(),
+                                       cudf::slice(expected->view(), {100, 400})[0]);
+  }
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -15,9 +15,11 @@
  */
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
 
 #include <cudf_test/base_fixture.hpp>
 
+#include <string>
 #include <vector>
 
 #include <rmm/device_buffer.hpp>
@@ -124,6 +126,26 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Derived fixture for ZSTD decompression
+ */
+struct ZstdDecompressTest : public DecompressTest<ZstdDecompressTest> {
+  cudaError_t dispatch()
+  {
+    rmm::device_buffer d_scratch(cudf::io::get_gpu_unzstd_scratch_size(1));
+
+    return cudf::io::gpu_unzstd(
+      d_inf_args.data().get(), d_inf_stat.data().get(), d_scratch.data(), d_scratch.size(), 1);
+  }
+};
+
+struct Lz4DecompressTest : public DecompressTest<Lz4DecompressTest> {
+  cudaError_t dispatch()
+  {
+    return cudf::io::gpu_unlz4(d_inf_args.data().get(), d_inf_stat.data().get(), 1);
+  }
+};
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -172,4 +194,142 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(ZstdDecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x24, 0x0b, 0x59, 0x00,
+                                    0x00, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77,
+                                    0x6f, 0x72, 0x6c, 0x64, 0x68, 0x69, 0x1e, 0xb2};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, RepeatedSequences)
+{
+  constexpr char uncompressed[] =
+    "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. "
+    "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. ";
+  constexpr uint8_t compressed[] = {
+    0x28, 0xb5, 0x2f, 0xfd, 0x20, 0xb4, 0xbd, 0x01, 0x00, 0xe4, 0x02, 0x54, 0x68, 0x65, 0x20, 0x71,
+    0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a,
+    0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61,
+    0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e, 0x20, 0x54, 0x01, 0x00, 0x1e, 0x40, 0x4a, 0x95, 0x01};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4DecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {
+    0xb0, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(Lz4DecompressTest, OverlappingMatch)
+{
+  constexpr char uncompressed[] =
+    "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. "
+    "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. ";
+  constexpr uint8_t compressed[] = {
+    0xff, 0x1e, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77,
+    0x6e, 0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x2e, 0x20, 0x2d,
+    0x00, 0x6f, 0x50, 0x64, 0x6f, 0x67, 0x2e, 0x20};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+/**
+ * @brief Fixture for uncompressing whole gzip files, made of members that store their data
+ */
+struct GzipFileTest : public cudf::test::BaseFixture {
+  static uint32_t crc32(std::string const& data)
+  {
+    uint32_t crc = 0xffffffffu;
+    for (unsigned char c : data) {
+      crc ^= c;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1)));
+      }
+    }
+    return ~crc;
+  }
+
+  static void append_le(std::vector<char>* out, uint32_t value, int num_bytes)
+  {
+    for (int i = 0; i < num_bytes; ++i) { out->push_back(static_cast<char>(value >> (8 * i))); }
+  }
+
+  /**
+   * @brief Appends a member with a stored DEFLATE block, and a BGZF header if `is_bgzf`
+   */
+  static void append_member(std::vector<char>* out, std::string const& data, bool is_bgzf)
+  {
+    // Header, CRC32 and size, stored block header, and the data
+    auto const member_size = 10 + (is_bgzf ? 8 : 0) + 8 + 5 + data.size();
+    append_le(out, 0x1f, 1);
+    append_le(out, 0x8b, 1);
+    append_le(out, 8, 1);
+    append_le(out, is_bgzf ? 4 : 0, 1);
+    append_le(out, 0, 4);
+    append_le(out, 0, 1);
+    append_le(out, 0xff, 1);
+    if (is_bgzf) {
+      append_le(out, 6, 2);
+      append_le(out, 'B', 1);
+      append_le(out, 'C', 1);
+      append_le(out, 2, 2);
+      append_le(out, member_size - 1, 2);
+    }
+    append_le(out, 1, 1);
+    append_le(out, data.size(), 2);
+    append_le(out, ~data.size(), 2);
+    out->insert(out->end(), data.begin(), data.end());
+    append_le(out, crc32(data), 4);
+    append_le(out, data.size(), 4);
+  }
+};
+
+TEST_F(GzipFileTest, MultipleMembers)
+{
+  std::vector<char> compressed;
+  append_member(&compressed, "hello ", false);
+  append_member(&compressed, "world", false);
+
+  auto const uncompressed =
+    cudf::io::get_uncompressed_data(compressed, "gzip", rmm::cuda_stream_default);
+  EXPECT_EQ(std::string(uncompressed.begin(), uncompressed.end()), "hello world");
+}
+
+TEST_F(GzipFileTest, BlockedGzip)
+{
+  std::vector<char> compressed;
+  std::string expected;
+  for (int i = 0; i < 1000; ++i) {
+    auto const line = std::to_string(i) + ",line" + std::to_string(i) + "\n";
+    append_member(&compressed, line, true);
+    expected += line;
+  }
+  // End-of-file marker
+  append_member(&compressed, "", true);
+
+  auto const uncompressed =
+    cudf::io::get_uncompressed_data(compressed, "gzip", rmm::cuda_stream_default);
+  EXPECT_EQ(std::string(uncompressed.begin(), uncompressed.end()), expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
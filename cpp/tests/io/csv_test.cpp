@@ -21,6 +21,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
@@ -882,6 +883,136 @@ TEST_F(CsvReaderTest, ByteRangeStrings)
   expect_column_data_equal(std::vector<std::string>{"c"}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, ByteRangeQuotedTerminators)
+{
+  std::string input;
+  for (int i = 0; i < 40; ++i) {
+    // Quoted field with a line terminator, a delimiter and escaped quotes
+    input += std::to_string(i) + ",\"note\nsecond line, \"\"x\"\"\",";
+    input += std::to_string(2 * i) + "\n";
+  }
+  auto const source = cudf_io::source_info{input.c_str(), input.size()};
+  auto options      = cudf_io::csv_reader_options::builder(source)
+                   .names({"A", "B", "C"})
+                   .dtypes({"int32", "str", "int32"})
+                   .header(-1)
+                   .build();
+  auto const expected = cudf_io::read_csv(options);
+
+  for (size_t range_size : {7, 48, 100}) {
+    std::vector<cudf_io::csv_byte_range_summary> summaries;
+    for (size_t offset = 0; offset < input.size(); offset += range_size) {
+      options.set_byte_range_offset(offset);
+      options.set_byte_range_size(range_size);
+      summaries.push_back(cudf_io::summarize_csv_byte_range(options));
+    }
+    auto const starts = cudf_io::resolve_csv_byte_range_starts(summaries);
+    ASSERT_EQ(starts.size(), summaries.size());
+    auto const& last = summaries.back();
+    EXPECT_EQ(starts.back().first_record +
+                last.num_records[static_cast<size_t>(starts.back().parser_state)],
+              40u);
+
+    // Read each range with the resolved start state, and with an inferred one
+    for (bool infer_state : {false, true}) {
+      std::vector<int32_t> values;
+      for (size_t i = 0; i < starts.size(); ++i) {
+        auto range_options = cudf_io::csv_reader_options::builder(source)
+                               .names({"A", "B", "C"})
+                               .dtypes({"int32", "str", "int32"})
+                               .header(-1)
+                               .byte_range_offset(i * range_size)
+                               .byte_range_size(range_size)
+                               .infer_byte_range_start_state(infer_state)
+                               .build();
+        if (!infer_state) { range_options.set_byte_range_start_state(starts[i].parser_state); }
+        auto const result = cudf_io::read_csv(range_options);
+        if (result.tbl->num_columns() == 0) { continue; }
+        auto const num_rows = result.tbl->num_rows();
+        if (!infer_state) {
+          auto const state = static_cast<size_t>(starts[i].parser_state);
+          EXPECT_EQ(summaries[i].num_records[state], static_cast<uint64_t>(num_rows));
+          EXPECT_EQ(starts[i].first_record, values.size());
+        }
+        auto const range_values = cudf::test::to_host<int32_t>(result.tbl->view().column(0)).first;
+        values.insert(values.end(), range_values.begin(), range_values.end());
+      }
+      expect_column_data_equal(values, expected.tbl->view().column(0));
+    }
+  }
+}
+
+TEST_F(CsvReaderTest, ByteRangeDefaultStartState)
+{
+  // The range starts within a quoted field, which is only detected when inferring the state
+  std::string const input = "1,\"a\nb,c\",2\n3,\"d\",4\n";
+  auto const source       = cudf_io::source_info{input.c_str(), input.size()};
+  auto read_range         = [&](thrust::optional<cudf_io::csv_parser_state> state) {
+    auto options = cudf_io::csv_reader_options::builder(source)
+                     .names({"A", "B", "C"})
+                     .header(-1)
+                     .byte_range_offset(4)
+                     .byte_range_size(input.size() - 4)
+                     .build();
+    if (state.has_value()) { options.set_byte_range_start_state(state.value()); }
+    return cudf_io::read_csv(options);
+  };
+
+  // Without a start state the range starts outside of quotes, as before start states existed
+  auto const by_default = read_range(thrust::nullopt);
+  auto const none       = read_range(cudf_io::csv_parser_state::NONE);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(none.tbl->view(), by_default.tbl->view());
+
+  // The inferred state is quoted, so the range's first record is the one after the quoted field
+  auto const inferred = cudf_io::read_csv(cudf_io::csv_reader_options::builder(source)
+                                            .names({"A", "B", "C"})
+                                            .header(-1)
+                                            .byte_range_offset(4)
+                                            .byte_range_size(input.size() - 4)
+                                            .infer_byte_range_start_state(true)
+                                            .build());
+  column_wrapper<int64_t> const expected_a{3};
+  cudf::test::strings_column_wrapper const expected_b{"d"};
+  column_wrapper<int64_t> const expected_c{4};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(inferred.tbl->view(),
+                                     table_view{{expected_a, expected_b, expected_c}});
+}
+
+TEST_F(CsvReaderTest, ChunkedRead)
+{
+  auto filepath = temp_env->get_temp_dir() + "ChunkedRead.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "id,text,value\n";
+    for (int i = 0; i < 100; ++i) {
+      outfile << i << ",\"line " << i << "\nnext, line\"," << i * 3 << "\n";
+    }
+  }
+  auto const options =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath}).header(0).build();
+  auto const expected = cudf_io::read_csv(options);
+
+  cudf_io::chunked_csv_reader reader(128, options);
+  std::vector<std::unique_ptr<table>> chunks;
+  while (reader.has_next()) {
+    auto chunk = reader.read_chunk();
+    ASSERT_EQ(chunk.metadata.column_names, expected.metadata.column_names);
+    chunks.push_back(std::move(chunk.tbl));
+  }
+  EXPECT_GT(chunks.size(), 10u);
+
+  std::vector<table_view> views;
+  std::transform(chunks.cbegin(), chunks.cend(), std::back_inserter(views), [](auto const& t) {
+    return t->view();
+  });
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), cudf::concatenate(views)->view());
+
+  // A limit of zero reads the whole input at once
+  cudf_io::chunked_csv_reader single_chunk_reader(0, options);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), single_chunk_reader.read_chunk().tbl->view());
+  EXPECT_FALSE(single_chunk_reader.has_next());
+}
+
 TEST_F(CsvReaderTest, BlanksAndComments)
 {
   auto filepath = temp_env->get_temp_dir() + "BlanksAndComments.csv";
@@ -1890,4 +2021,31 @@ TEST_F(CsvReaderTest, DefaultWriteChunkSize)
   }
 }
 
+TEST_F(CsvReaderTest, MultiChunkWriteWithLineTerminator)
+{
+  constexpr auto num_rows = 20;
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto first  = column_wrapper<int32_t>(values, values + num_rows);
+  auto last   = column_wrapper<int32_t>(values, values + num_rows, valids);
+
+  auto input_table = cudf::table_view{{first, last}};
+
+  std::vector<char> out_buffer;
+  cudf_io::csv_writer_options writer_options =
+    cudf_io::csv_writer_options::builder(cudf_io::sink_info(&out_buffer), input_table)
+      .include_header(false)
+      .na_rep("NA")
+      .line_terminator("\r\n")
+      .rows_per_chunk(8);
+  cudf_io::write_csv(writer_options);
+
+  // Every row, including the last row of each chunk, ends with exactly one terminator
+  std::string expected;
+  for (int i = 0; i < num_rows; ++i) {
+    expected += std::to_string(i) + "," + (i % 3 ? std::to_string(i) : "NA") + "\r\n";
+  }
+  EXPECT_EQ(expected, std::string(out_buffer.begin(), out_buffer.end()));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
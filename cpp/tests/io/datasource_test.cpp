@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <io/utilities/pinned_host_pool.hpp>
+#include <io/utilities/prefetch_datasource.hpp>
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using cudf::io::detail::async_prefetch_datasource;
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+/**
+ * @brief Host source that records the maximum number of reads in flight at the same time
+ */
+class CountingSource : public cudf::io::datasource {
+ public:
+  CountingSource(std::vector<uint8_t> data, bool concurrent)
+    : data(std::move(data)), concurrent(concurrent)
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    std::vector<uint8_t> out(std::min(size, data.size() - offset));
+    host_read(offset, size, out.data());
+    return buffer::create(std::move(out));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const in_flight = ++reads_in_flight;
+    max_reads_in_flight  = std::max(max_reads_in_flight.load(), in_flight);
+    ++num_reads;
+    // Give other reads the chance to overlap with this one
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    auto const read_size = std::min(size, data.size() - offset);
+    std::memcpy(dst, data.data() + offset, read_size);
+    --reads_in_flight;
+    return read_size;
+  }
+
+  bool supports_concurrent_reads() const override { return concurrent; }
+
+  size_t size() const override { return data.size(); }
+
+  std::vector<uint8_t> const data;
+  bool const concurrent;
+  std::atomic<int> reads_in_flight{0};
+  std::atomic<int> max_reads_in_flight{0};
+  std::atomic<int> num_reads{0};
+};
+
+struct PrefetchDatasourceTest : public cudf::test::BaseFixture {
+  std::vector<uint8_t> make_data(size_t size)
+  {
+    std::vector<uint8_t> data(size);
+    std::iota(data.begin(), data.end(), 0);
+    return data;
+  }
+};
+
+TEST_F(PrefetchDatasourceTest, PrefetchedReads)
+{
+  auto const data = make_data(1000);
+  CountingSource source(data, true);
+  async_prefetch_datasource prefetcher(&source, 4);
+
+  std::vector<async_prefetch_datasource::byte_range> ranges{{0, 100}, {100, 300}, {700, 300}};
+  prefetcher.prefetch(ranges, rmm::cuda_stream_default);
+
+  for (auto const& range : ranges) {
+    auto const buffer = prefetcher.host_read(range.offset, range.size);
+    ASSERT_EQ(buffer->size(), range.size);
+    EXPECT_TRUE(std::equal(buffer->data(), buffer->data() + range.size, &data[range.offset]));
+  }
+  EXPECT_EQ(source.num_reads, 3);
+
+  // Prefetched ranges are served once; a repeated read goes to the source
+  std::vector<uint8_t> dst(100);
+  EXPECT_EQ(prefetcher.host_read(0, 100, dst.data()), 100u);
+  EXPECT_TRUE(std::equal(dst.begin(), dst.end(), data.begin()));
+  EXPECT_EQ(source.num_reads, 4);
+}
+
+TEST_F(PrefetchDatasourceTest, PrefetchedDeviceRead)
+{
+  auto const data = make_data(256);
+  CountingSource source(data, true);
+  async_prefetch_datasource prefetcher(&source);
+  prefetcher.prefetch({{16, 128}}, rmm::cuda_stream_default);
+
+  rmm::device_buffer d_dst(128, rmm::cuda_stream_default);
+  EXPECT_EQ(prefetcher.device_read(
+              16, 128, static_cast<uint8_t*>(d_dst.data()), rmm::cuda_stream_default),
+            128u);
+
+  std::vector<uint8_t> h_dst(128);
+  CUDA_TRY(cudaMemcpy(h_dst.data(), d_dst.data(), d_dst.size(), cudaMemcpyDeviceToHost));
+  EXPECT_TRUE(std::equal(h_dst.begin(), h_dst.end(), data.begin() + 16));
+  EXPECT_EQ(source.num_reads, 1);
+}
+
+TEST_F(PrefetchDatasourceTest, NonConcurrentSource)
+{
+  auto const data = make_data(1000);
+  CountingSource source(data, false);
+  async_prefetch_datasource prefetcher(&source, 8);
+
+  std::vector<async_prefetch_datasource::byte_range> ranges;
+  for (size_t offset = 0; offset < data.size(); offset += 100) {
+    ranges.push_back({offset, 100});
+  }
+  prefetcher.prefetch(ranges, rmm::cuda_stream_default);
+  // Reads that were not prefetched must not overlap the prefetches either
+  EXPECT_EQ(prefetcher.host_read(50, 100)->size(), 100u);
+
+  for (auto const& range : ranges) {
+    EXPECT_EQ(prefetcher.host_read(range.offset, range.size)->size(), range.size);
+  }
+  EXPECT_EQ(source.max_reads_in_flight, 1);
+}
+
+class CoalescingSource : public CountingSource {
+ public:
+  using CountingSource::CountingSource;
+
+  size_t max_coalesced_gap() const override { return 64; }
+};
+
+TEST_F(PrefetchDatasourceTest, CoalescedReads)
+{
+  auto const data = make_data(1000);
+  CoalescingSource source(data, true);
+  async_prefetch_datasource prefetcher(&source);
+
+  // The first three ranges are close enough to be fetched together, the last one is not
+  std::vector<async_prefetch_datasource::byte_range> ranges{
+    {300, 100}, {0, 100}, {150, 100}, {600, 100}};
+  prefetcher.prefetch(ranges, rmm::cuda_stream_default);
+
+  for (auto const& range : ranges) {
+    auto const buffer = prefetcher.host_read(range.offset, range.size);
+    ASSERT_EQ(buffer->size(), range.size);
+    EXPECT_TRUE(std::equal(buffer->data(), buffer->data() + range.size, &data[range.offset]));
+  }
+  EXPECT_EQ(source.num_reads, 2);
+}
+
+struct FileSinkTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(FileSinkTest, BufferedWrites)
+{
+  // Spans several write buffers, with writes that cross the buffer boundaries
+  std::vector<uint8_t> data(11 << 20);
+  std::iota(data.begin(), data.end(), 0);
+  auto const filepath = temp_env->get_temp_filepath("BufferedWrites.bin");
+
+  auto sink = cudf::io::data_sink::create(filepath);
+  for (size_t offset = 0; offset < data.size(); offset += 999999) {
+    auto const size = std::min<size_t>(999999, data.size() - offset);
+    sink->host_write(data.data() + offset, size);
+  }
+  EXPECT_EQ(sink->bytes_written(), data.size());
+  sink->flush_async().get();
+
+  std::ifstream file(filepath, std::ios::binary);
+  std::vector<uint8_t> written{std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>()};
+  EXPECT_EQ(written, data);
+
+  // The sink remains usable after a flush
+  sink->host_write(data.data(), 100);
+  sink->flush();
+  EXPECT_EQ(sink->bytes_written(), data.size() + 100);
+}
+
+struct PinnedHostPoolTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PinnedHostPoolTest, ReusesFreedMemory)
+{
+  auto& pool = cudf::io::detail::pinned_host_pool::instance();
+  if (pool.size() < 3 * 1024) { GTEST_SKIP() << "Pinned pool is disabled"; }
+
+  auto first  = pool.allocate(1024);
+  auto second = pool.allocate(1000);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(first) % pool.alignment, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % pool.alignment, 0u);
+  pool.deallocate(first);
+  pool.deallocate(second);
+
+  // The freed blocks are merged, so a larger allocation fits where both were
+  auto merged = pool.allocate(2000);
+  EXPECT_EQ(merged, std::min(first, second));
+  pool.deallocate(merged);
+}
+
+TEST_F(PinnedHostPoolTest, StagedHostToDeviceCopy)
+{
+  // Large enough to be copied in multiple slices
+  std::vector<uint8_t> h_src(9 << 20);
+  std::iota(h_src.begin(), h_src.end(), 0);
+
+  rmm::device_buffer d_dst(h_src.size(), rmm::cuda_stream_default);
+  cudf::io::detail::copy_host_to_device(
+    d_dst.data(), h_src.data(), h_src.size(), rmm::cuda_stream_default);
+
+  std::vector<uint8_t> h_dst(h_src.size());
+  CUDA_TRY(cudaMemcpy(h_dst.data(), d_dst.data(), d_dst.size(), cudaMemcpyDeviceToHost));
+  EXPECT_EQ(h_src, h_dst);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -20,9 +20,11 @@
 #include <cudf_test/cudf_gtest.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/json.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -30,6 +32,7 @@
 #include <arrow/io/api.h>
 
 #include <fstream>
+#include <limits>
 #include <type_traits>
 
 #define wrapper cudf::test::fixed_width_column_wrapper
@@ -861,4 +864,134 @@ TEST_F(JsonReaderTest, ParseOutOfRangeIntegers)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(input_mixed_range_append, view.column(9));
 }
 
+TEST_F(JsonReaderTest, ChunkedRead)
+{
+  std::string data;
+  std::vector<int64_t> expected_a;
+  std::vector<double> expected_b;
+  for (int i = 0; i < 100; ++i) {
+    data += "{\"a\": " + std::to_string(i) + ", \"b\": " + std::to_string(i) + ".5";
+    // Keys that are not in the first chunk are ignored
+    if (i >= 50) { data += ", \"c\": \"extra\""; }
+    data += "}\n";
+    expected_a.push_back(i);
+    expected_b.push_back(i + 0.5);
+  }
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true);
+
+  cudf_io::chunked_json_reader reader(64, in_options);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    auto chunk = reader.read_chunk();
+    ASSERT_EQ(chunk.metadata.column_names, (std::vector<std::string>{"a", "b"}));
+    chunks.push_back(std::move(chunk.tbl));
+  }
+  EXPECT_GT(chunks.size(), 10u);
+
+  std::vector<cudf::table_view> views;
+  std::transform(chunks.cbegin(), chunks.cend(), std::back_inserter(views), [](auto const& t) {
+    return t->view();
+  });
+  auto const result = cudf::concatenate(views);
+  ASSERT_EQ(result->num_columns(), 2);
+
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(0),
+                                 int64_wrapper(expected_a.begin(), expected_a.end(), validity));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(1),
+                                 float64_wrapper(expected_b.begin(), expected_b.end(), validity));
+
+  // A limit of zero reads the whole input at once
+  cudf_io::chunked_json_reader single_chunk_reader(0, in_options);
+  EXPECT_EQ(single_chunk_reader.read_chunk().tbl->num_rows(), 100);
+  EXPECT_FALSE(single_chunk_reader.has_next());
+}
+
+TEST_F(JsonReaderTest, NestedObjectsAndLists)
+{
+  std::string const data =
+    "{\"id\": 1, \"payload\": {\"x\": 10, \"tags\": [\"a\", \"b\"]}, \"vals\": [1, 2, 3]}\n"
+    "{\"id\": 2, \"payload\": {\"x\": 20, \"tags\": []}, \"vals\": []}\n"
+    "{\"id\": 3, \"payload\": null, \"vals\": [4]}\n";
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true);
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  ASSERT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.tbl->num_rows(), 3);
+  EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"id", "payload", "vals"}));
+
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), int64_wrapper{{1, 2, 3}, validity});
+
+  auto const& payload = result.tbl->get_column(1);
+  ASSERT_EQ(payload.type().id(), cudf::type_id::STRUCT);
+  EXPECT_EQ(payload.null_count(), 1);
+  ASSERT_EQ(payload.num_children(), 2);
+  ASSERT_EQ(result.metadata.schema_info[1].children.size(), 2u);
+  EXPECT_EQ(result.metadata.schema_info[1].children[0].name, "x");
+  EXPECT_EQ(result.metadata.schema_info[1].children[1].name, "tags");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(payload.child(0), int64_wrapper{{10, 20, 0}, {1, 1, 0}});
+
+  ASSERT_EQ(payload.child(1).type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(payload.child(1).null_count(), 1);
+  auto const tags = cudf::lists_column_view(payload.child(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(tags.offsets(), int_wrapper{0, 2, 2, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(tags.child(),
+                                 cudf::test::strings_column_wrapper({"a", "b"}, {true, true}));
+
+  ASSERT_EQ(result.tbl->get_column(2).type().id(), cudf::type_id::LIST);
+  auto const vals = cudf::lists_column_view(result.tbl->get_column(2));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(vals.offsets(), int_wrapper{0, 3, 3, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(vals.child(), int64_wrapper({1, 2, 3, 4}, validity));
+}
+
+struct JsonWriterTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(JsonWriterTest, MixedTypes)
+{
+  int_wrapper col0{{1, 0, -3}, {1, 0, 1}};
+  cudf::test::strings_column_wrapper col1{"a\"b", "x\ny", "plain"};
+  float64_wrapper col2{1.5, std::numeric_limits<double>::quiet_NaN(), -0.25};
+  bool_wrapper col3{true, false, true};
+  cudf::table_view const input{{col0, col1, col2, col3}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"a", "b", "c", "d"};
+  std::vector<char> out_buffer;
+  cudf_io::json_writer_options out_options =
+    cudf_io::json_writer_options::builder(cudf_io::sink_info(&out_buffer), input)
+      .metadata(&metadata);
+  cudf_io::write_json(out_options);
+
+  std::string const expected =
+    "{\"a\":1,\"b\":\"a\\\"b\",\"c\":1.5,\"d\":true}\n"
+    "{\"a\":null,\"b\":\"x\\ny\",\"c\":null,\"d\":false}\n"
+    "{\"a\":-3,\"b\":\"plain\",\"c\":-0.25,\"d\":true}\n";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
+TEST_F(JsonWriterTest, OmittedNullsInChunks)
+{
+  int_wrapper col0{{1, 0, -3}, {1, 0, 1}};
+  cudf::test::strings_column_wrapper col1({"x", "y", ""}, {1, 1, 0});
+  cudf::table_view const input{{col0, col1}};
+
+  std::vector<char> out_buffer;
+  cudf_io::json_writer_options out_options =
+    cudf_io::json_writer_options::builder(cudf_io::sink_info(&out_buffer), input)
+      .include_nulls(false)
+      .rows_per_chunk(2);
+  cudf_io::write_json(out_options);
+
+  // Without column names, the keys are the column indices
+  std::string const expected = "{\"0\":1,\"1\":\"x\"}\n{\"1\":\"y\"}\n{\"0\":-3}\n";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,6 +21,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/linearizer.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -378,6 +379,31 @@ TEST_F(OrcWriterTest, MultiColumn)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, Lz4Compression)
+{
+  constexpr auto num_rows = 10000;
+  std::vector<const char*> days{"Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
+
+  auto int_values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto str_values =
+    cudf::detail::make_counting_transform_iterator(0, [&](auto i) { return days[i % 5]; });
+  column_wrapper<int> col0(int_values, int_values + num_rows);
+  column_wrapper<cudf::string_view> col1(str_values, str_values + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("OrcLz4Compression.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .compression(cudf_io::compression_type::LZ4);
+  cudf_io::write_orc(out_opts);
+
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).use_index(false);
+  auto result = cudf_io::read_orc(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(OrcWriterTest, MultiColumnWithNulls)
 {
   constexpr auto num_rows = 100;
@@ -508,6 +534,34 @@ TEST_F(OrcWriterTest, Strings)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, DistinctAndRepeatedStrings)
+{
+  // The distinct strings are direct-encoded without building their dictionary
+  constexpr auto num_rows = 25000;
+  std::vector<std::string> distinct(num_rows);
+  std::vector<std::string> repeated(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    distinct[i] = "distinct_value_" + std::to_string(i * 7919);
+    repeated[i] = "repeated_value_" + std::to_string(i % 7);
+  }
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  column_wrapper<cudf::string_view> col0{distinct.begin(), distinct.end(), validity};
+  column_wrapper<cudf::string_view> col1{repeated.begin(), repeated.end(), validity};
+  table_view expected({col0, col1});
+
+  auto filepath = temp_env->get_temp_filepath("OrcDistinctAndRepeatedStrings.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_orc(out_opts);
+
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_orc(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(OrcWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offseted views into existing cudf tables
@@ -814,6 +868,130 @@ TEST_F(OrcChunkedWriterTest, ReadStripes)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(OrcChunkedWriterTest, ChunkedRead)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+  auto table3 = create_random_fixed_table<int>(5, 5, true);
+
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(*table1).write(*table2).write(*table3);
+
+  auto read_chunks = [](cudf_io::chunked_orc_reader& reader) {
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+    }
+    return chunks;
+  };
+  auto to_views = [](std::vector<std::unique_ptr<cudf::table>> const& chunks) {
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) {
+      views.push_back(*chunk);
+    }
+    return views;
+  };
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+  {
+    // The limit only fits one stripe per chunk
+    cudf_io::chunked_orc_reader reader(150, read_opts);
+    auto const chunks = read_chunks(reader);
+    EXPECT_EQ(chunks.size(), 3u);
+    EXPECT_THROW(reader.read_chunk(), cudf::logic_error);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(to_views(chunks)), *full_table);
+  }
+  {
+    // No limit returns the whole file at once
+    cudf_io::chunked_orc_reader reader(0, read_opts);
+    auto const chunks = read_chunks(reader);
+    ASSERT_EQ(chunks.size(), 1u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*chunks[0], *full_table);
+  }
+  {
+    // Rows selection that starts and ends within stripes
+    read_opts.set_skip_rows(7);
+    read_opts.set_num_rows(6);
+    cudf_io::chunked_orc_reader reader(150, read_opts);
+    auto const chunks = read_chunks(reader);
+    EXPECT_EQ(chunks.size(), 2u);
+    auto const expected = cudf::slice(*full_table, {7, 13})[0];
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(to_views(chunks)), expected);
+  }
+}
+
+TEST_F(OrcChunkedWriterTest, ReadWithStatisticsFilter)
+{
+  column_wrapper<int> col0_1{{0, 1, 2, 3, 4}};
+  column_wrapper<int> col0_2{{10, 11, 12, 13, 14}};
+  column_wrapper<int> col0_3{{20, 21, 22, 23, 24}};
+  column_wrapper<double> col1_1{{5, 6, 7, 8, 9}};
+  column_wrapper<double> col1_2{{5, 6, 7, 8, 9}};
+  column_wrapper<double> col1_3{{0, 1, 2, 3, 4}};
+  table_view table1({col0_1, col1_1});
+  table_view table2({col0_2, col1_2});
+  table_view table3({col0_3, col1_3});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStatisticsFilter.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(table1).write(table2).write(table3);
+
+  // col0 >= 12 rules out the first stripe
+  cudf::numeric_scalar<int> twelve(12);
+  auto col0    = cudf::ast::column_reference(0);
+  auto lit12   = cudf::ast::literal(twelve);
+  auto col0_ge = cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, col0, lit12);
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(col0_ge);
+  auto result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl,
+                                *cudf::concatenate(std::vector<table_view>({table2, table3})));
+
+  // literal on the left side, combined with a condition on the second column
+  cudf::numeric_scalar<double> five(5);
+  auto col1    = cudf::ast::column_reference(1);
+  auto lit5    = cudf::ast::literal(five);
+  auto col1_lt = cudf::ast::expression(cudf::ast::ast_operator::GREATER, lit5, col1);
+  auto both    = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_AND, col0_ge, col1_lt);
+  read_opts.set_filter(both);
+  result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table3);
+
+  // rows 2-11 are selected, of which rows 5-11 are in the remaining stripes
+  read_opts.set_filter(col0_ge);
+  read_opts.set_skip_rows(2);
+  read_opts.set_num_rows(10);
+  result = cudf_io::read_orc(read_opts);
+  auto const remaining = cudf::concatenate(std::vector<table_view>({table2, table3}));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, cudf::slice(*remaining, {0, 7})[0]);
+  read_opts.set_skip_rows(0);
+  read_opts.set_num_rows(-1);
+
+  // conditions that can't be decided from statistics keep every stripe
+  auto sum    = cudf::ast::expression(cudf::ast::ast_operator::ADD, col0, lit12);
+  auto sum_eq = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, sum, lit12);
+  read_opts.set_filter(sum_eq);
+  result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    *result.tbl, *cudf::concatenate(std::vector<table_view>({table1, table2, table3})));
+
+  // no stripe can match
+  cudf::numeric_scalar<int> hundred(100);
+  auto lit100  = cudf::ast::literal(hundred);
+  auto col0_eq = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col0, lit100);
+  read_opts.set_filter(col0_eq);
+  result = cudf_io::read_orc(read_opts);
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+}
+
 TEST_F(OrcChunkedWriterTest, ReadStripesError)
 {
   srand(31337);
@@ -937,6 +1115,272 @@ TEST_F(OrcReaderTest, CombinedSkipRowTest)
   skip_row.test(2, 100, 110);
 }
 
+TEST_F(OrcReaderTest, MetadataCache)
+{
+  column_wrapper<int32_t> values1{1, 2, 3, 4, 5};
+  column_wrapper<int32_t> values2{6, 7, 8};
+  auto const table1   = table_view{{values1}};
+  auto const table2   = table_view{{values2}};
+  auto const expected = cudf::concatenate(std::vector<table_view>({table1, table2}));
+
+  auto filepath = temp_env->get_temp_filepath("MetadataCache.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(table1).write(table2);
+
+  // the metadata read on its own is found in the cache by the readers
+  auto cache          = std::make_shared<cudf_io::metadata_cache>();
+  auto const metadata = cudf_io::read_orc_metadata(cudf_io::source_info{filepath}, cache);
+  EXPECT_EQ(metadata.num_rows, 8u);
+  EXPECT_EQ(metadata.stripe_num_rows, (std::vector<uint32_t>{5, 3}));
+  EXPECT_EQ(cache->misses(), 1u);
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).metadata_cache(cache);
+  auto result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+  read_opts.set_stripes({1});
+  result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+  EXPECT_EQ(cache->misses(), 1u);
+  EXPECT_EQ(cache->hits(), 2u);
+}
+
+TEST_F(OrcReaderTest, ZstdCompressedRead)
+{
+  // a: LONG and b: STRING, both DIRECT, in a stripe of ZSTD compression blocks of at most 4KB.
+  // The DATA streams are compressed as ZSTD frames of several blocks: the first block of a frame
+  // has FSE-compressed sequences and 4-stream Huffman-compressed literals, and the later blocks
+  // reuse them as repeat-mode sequences and treeless literals. The DATA stream of b is made of
+  // two compression blocks, and its frames end with a content checksum. The footers are
+  // decompressed on the host.
+  const unsigned char zstd_orc[] = {
+    0x4f, 0x52, 0x43, 0x0a, 0x06, 0x00, 0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x68, 0x54, 0x14, 0x00,
+    0x26, 0x69, 0x8a, 0x2d, 0x50, 0x79, 0x31, 0x39, 0xc9, 0x8f, 0xa3, 0xa3, 0x4b, 0x5b, 0x00,
+    0x88, 0x81, 0xe8, 0x66, 0x97, 0x5b, 0xfd, 0xc9, 0xbd, 0x35, 0xdc, 0xe5, 0x11, 0x01, 0x94,
+    0x6b, 0xad, 0x88, 0x61, 0xd8, 0x89, 0x98, 0xe1, 0x66, 0xc5, 0xb0, 0xb3, 0xae, 0x41, 0xce,
+    0xc7, 0x54, 0x22, 0x01, 0x7c, 0x00, 0x7c, 0x00, 0x7f, 0x00, 0x30, 0xef, 0xdb, 0xcb, 0xa7,
+    0xdc, 0x47, 0x85, 0x8f, 0x01, 0x7d, 0x83, 0xe6, 0xc5, 0x87, 0xcb, 0x28, 0x8f, 0x79, 0xee,
+    0x6a, 0x7c, 0x75, 0x79, 0x1a, 0xf4, 0x4d, 0xc8, 0x21, 0xb5, 0x46, 0x32, 0x7a, 0x46, 0xb5,
+    0xad, 0xd7, 0xaf, 0xa5, 0xd9, 0x56, 0xab, 0xc2, 0xee, 0xa4, 0x2d, 0x81, 0x13, 0x8c, 0xc3,
+    0x7a, 0xee, 0x0c, 0x95, 0x82, 0x8b, 0x60, 0x1c, 0x88, 0x4c, 0x58, 0x60, 0xc6, 0x06, 0x1f,
+    0xc2, 0xaf, 0xa0, 0x32, 0x44, 0xce, 0xdb, 0x61, 0x84, 0x50, 0xb6, 0x44, 0xd6, 0x1d, 0x4f,
+    0xab, 0x72, 0xb3, 0x6c, 0xbf, 0x91, 0xb6, 0xc5, 0x3d, 0x93, 0xfa, 0xb8, 0x74, 0x48, 0xcc,
+    0x37, 0x19, 0x4f, 0x7d, 0xbe, 0xb2, 0xee, 0x3a, 0x3c, 0xc6, 0xb9, 0x5c, 0x72, 0xa2, 0xf2,
+    0x1b, 0xb0, 0xc7, 0x70, 0x1e, 0xf5, 0x7d, 0x4a, 0xf5, 0xed, 0xe4, 0xe1, 0x9c, 0x22, 0x3d,
+    0xab, 0x7d, 0x4c, 0x3a, 0x04, 0xe6, 0x1b, 0x8f, 0xa7, 0x40, 0x87, 0xc7, 0x37, 0x97, 0x55,
+    0x27, 0x16, 0x15, 0xdf, 0x88, 0x3d, 0xe6, 0xa3, 0xfa, 0x36, 0xf2, 0xf0, 0xed, 0xe1, 0xde,
+    0xb7, 0x96, 0x4f, 0xb5, 0xd2, 0x6f, 0xc0, 0x5e, 0x64, 0xb8, 0xbc, 0x7a, 0xbc, 0x73, 0xb7,
+    0x62, 0xf4, 0x8d, 0xc8, 0x21, 0x70, 0x23, 0x1f, 0x3d, 0x9f, 0xda, 0xa6, 0x73, 0x5b, 0x1d,
+    0x76, 0x47, 0xd4, 0x92, 0x5a, 0x62, 0x71, 0x30, 0x69, 0x0a, 0x2f, 0xc2, 0x70, 0x90, 0x9a,
+    0x34, 0x40, 0x86, 0xe0, 0x2b, 0xb0, 0x06, 0xc7, 0x89, 0x3b, 0x94, 0x60, 0xdd, 0xe1, 0xb4,
+    0xea, 0x6b, 0x56, 0xd5, 0xef, 0xa4, 0x6d, 0xb9, 0xa2, 0x43, 0x5e, 0xdf, 0x70, 0x3c, 0x95,
+    0x7d, 0x5d, 0xb9, 0x4b, 0x19, 0x39, 0x31, 0xf9, 0x8d, 0xf7, 0x31, 0x99, 0x47, 0x7f, 0x9f,
+    0x62, 0xc5, 0x1f, 0xa9, 0xd0, 0x37, 0xa0, 0x07, 0xaf, 0x5f, 0x4d, 0xb3, 0xae, 0x56, 0x83,
+    0x35, 0xd4, 0xd9, 0x33, 0x58, 0x0a, 0xad, 0xd4, 0x84, 0x03, 0x26, 0x6c, 0xe0, 0x21, 0x00,
+    0x1d, 0x2a, 0xa2, 0xd8, 0x92, 0x58, 0x77, 0x3e, 0xaa, 0x5b, 0xcf, 0xa3, 0x3e, 0x2a, 0x1d,
+    0x22, 0x93, 0x23, 0x1e, 0xc7, 0x2e, 0x93, 0x9c, 0xb8, 0xcc, 0xb0, 0xdf, 0x3a, 0x1e, 0xc6,
+    0x3d, 0xac, 0x73, 0x1f, 0x1d, 0x3e, 0x46, 0xf4, 0x8d, 0x9a, 0x17, 0x17, 0x2e, 0x9b, 0x34,
+    0xbe, 0xbe, 0x3c, 0x1d, 0xfa, 0x26, 0x75, 0x08, 0xad, 0x91, 0x8a, 0x5e, 0xbf, 0x97, 0x66,
+    0x5f, 0xad, 0x1a, 0xbb, 0x13, 0x6a, 0xc9, 0x6c, 0x3d, 0x79, 0x86, 0x4b, 0xc1, 0x25, 0x08,
+    0x07, 0x20, 0x93, 0x26, 0x30, 0xdf, 0x01, 0x87, 0x20, 0x17, 0x56, 0x06, 0xca, 0x08, 0x91,
+    0x6c, 0xc9, 0xdb, 0x9d, 0x4c, 0xab, 0xbf, 0x66, 0x59, 0x71, 0x2a, 0x77, 0x23, 0x23, 0x99,
+    0x1c, 0xd9, 0x7d, 0x5b, 0x31, 0xc2, 0x27, 0x8f, 0x75, 0xae, 0x68, 0xd1, 0xb3, 0x49, 0x33,
+    0xa4, 0x25, 0x14, 0xbd, 0x57, 0xc8, 0x9c, 0xb9, 0x09, 0xf3, 0x4d, 0xce, 0x5c, 0x91, 0xb3,
+    0xea, 0x97, 0x32, 0x7a, 0x7f, 0xbe, 0xb2, 0xe2, 0xa4, 0xe7, 0x51, 0xa0, 0x83, 0xf7, 0xad,
+    0xe6, 0x53, 0xae, 0x47, 0x83, 0x35, 0x94, 0xc7, 0x3d, 0x77, 0x2d, 0xbe, 0xb6, 0x52, 0x46,
+    0xcf, 0x6b, 0xdb, 0x76, 0xfd, 0x56, 0x8c, 0x70, 0xe2, 0x71, 0x38, 0x9d, 0x3a, 0x57, 0x64,
+    0xd6, 0xdc, 0x94, 0xc9, 0x91, 0x33, 0x3e, 0x90, 0x10, 0xcb, 0x0c, 0xdb, 0xaf, 0xa3, 0x6d,
+    0xb8, 0x9e, 0x4b, 0x30, 0x85, 0xca, 0xdd, 0x89, 0xc7, 0xb9, 0x22, 0xe7, 0x51, 0xf9, 0x53,
+    0xab, 0x6f, 0x29, 0xbd, 0xd7, 0xa3, 0xc6, 0xc7, 0x84, 0xbe, 0x31, 0x5b, 0x2f, 0xbe, 0xba,
+    0x1e, 0x51, 0xa8, 0x11, 0xd0, 0x05, 0x86, 0x09, 0x0c, 0x12, 0xc8, 0x92, 0x24, 0xea, 0xb4,
+    0x1b, 0x70, 0x76, 0x37, 0x07, 0x80, 0xe4, 0x03, 0x98, 0x92, 0xf1, 0xae, 0x57, 0x63, 0x75,
+    0x5e, 0x27, 0x3f, 0x2a, 0xe2, 0xb2, 0xe7, 0x71, 0x0b, 0xf5, 0xdc, 0x7c, 0x5e, 0xa6, 0xcf,
+    0x14, 0x38, 0x29, 0x6d, 0x5a, 0x16, 0xa9, 0x39, 0x19, 0x52, 0xc4, 0xf4, 0x72, 0x62, 0x52,
+    0x83, 0xc3, 0x83, 0x8b, 0xc7, 0x3c, 0xc8, 0x05, 0xe5, 0xb7, 0xb0, 0xf3, 0x1a, 0xc2, 0xc5,
+    0x7f, 0x52, 0xdd, 0x83, 0x4c, 0xa1, 0x76, 0x9c, 0x7f, 0xce, 0x2c, 0x37, 0x03, 0x92, 0x38,
+    0x75, 0x42, 0xa5, 0x5d, 0x05, 0xdc, 0x02, 0x00, 0xa4, 0x02, 0x9f, 0xf7, 0xdb, 0x80, 0xef,
+    0xab, 0x01, 0x9d, 0xfb, 0xd7, 0xbf, 0x3e, 0xed, 0xcb, 0x0f, 0x04, 0xd8, 0xf0, 0x2e, 0xc2,
+    0xe4, 0x88, 0xa0, 0x9c, 0x01, 0xf2, 0x94, 0xb8, 0xd0, 0x89, 0x02, 0xa2, 0xc4, 0xe8, 0x80,
+    0xf7, 0x02, 0xd2, 0xf4, 0x98, 0x80, 0x80, 0x1b, 0xa8, 0x50, 0x6e, 0xd8, 0x01, 0x20, 0x74,
+    0x4e, 0x73, 0x90, 0x64, 0xf7, 0xff, 0xff, 0xef, 0x06, 0xbc, 0xa4, 0x14, 0x51, 0x0c, 0xc9,
+    0x29, 0x92, 0x64, 0x74, 0x22, 0xf7, 0xb9, 0x3f, 0xa7, 0x35, 0x2f, 0x3f, 0xb3, 0x7a, 0xf4,
+    0xad, 0x3f, 0x77, 0x29, 0xab, 0xa9, 0xb4, 0x1e, 0x6f, 0x8d, 0x00, 0x00, 0x18, 0x01, 0x80,
+    0x98, 0x05, 0xf0, 0x22, 0x8a, 0x53, 0x29, 0xb1, 0x94, 0x4d, 0xa5, 0x22, 0xe8, 0x01, 0xbc,
+    0x06, 0x00, 0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x68, 0x64, 0x0b, 0x00, 0x06, 0x95, 0x37, 0x16,
+    0x90, 0xcd, 0x01, 0xe0, 0xb7, 0xb2, 0xb7, 0xf0, 0xb7, 0xf0, 0xb7, 0xbb, 0x33, 0x64, 0x66,
+    0x66, 0x66, 0x7a, 0xcf, 0xcc, 0x9c, 0x2c, 0x39, 0x00, 0x31, 0x00, 0x2b, 0x00, 0x02, 0x73,
+    0xdc, 0x29, 0xa8, 0x39, 0xd0, 0xd4, 0x88, 0x75, 0xaa, 0x49, 0xcc, 0x01, 0x5e, 0x39, 0x2c,
+    0x78, 0x9a, 0x2b, 0xb6, 0x1c, 0x4a, 0x2b, 0x65, 0x80, 0x9a, 0xc1, 0xaa, 0x19, 0xc1, 0xb0,
+    0xaa, 0x9c, 0x01, 0x58, 0x06, 0xa9, 0x31, 0xa9, 0x9a, 0x72, 0x24, 0xa8, 0x08, 0xa5, 0x15,
+    0xa7, 0x18, 0xa4, 0x0c, 0xc2, 0x52, 0xcc, 0x68, 0x14, 0x16, 0xe9, 0xd9, 0xc9, 0xb9, 0xa9,
+    0x99, 0x89, 0x79, 0xb9, 0xf2, 0xd1, 0xb1, 0x91, 0x71, 0x51, 0x31, 0x11, 0xf1, 0x70, 0xe1,
+    0x9f, 0x9f, 0x1a, 0x92, 0x63, 0xe9, 0x53, 0x10, 0x34, 0x1c, 0x4a, 0x84, 0xf0, 0xed, 0xa9,
+    0xe1, 0x50, 0x1c, 0x66, 0x04, 0x7a, 0x8a, 0x35, 0xac, 0xc9, 0xc3, 0x53, 0xec, 0x08, 0xbe,
+    0xfc, 0xdb, 0xbb, 0x9b, 0x7b, 0x5b, 0x3b, 0x1b, 0xfb, 0x7a, 0xf5, 0xb3, 0x73, 0x33, 0xf3,
+    0xb2, 0x72, 0x32, 0xf2, 0xf1, 0xe2, 0x5f, 0xdf, 0x5e, 0xde, 0x5d, 0xdd, 0x5c, 0xdc, 0xdb,
+    0xb5, 0xaf, 0xae, 0xad, 0xac, 0xab, 0xaa, 0xa9, 0xa8, 0xa7, 0x4b, 0x3f, 0x52, 0x63, 0x1e,
+    0x1d, 0x1b, 0x19, 0x17, 0x15, 0x13, 0x11, 0x0f, 0x17, 0xfe, 0xf9, 0xf5, 0xf1, 0xed, 0xe9,
+    0xe5, 0xe1, 0xdd, 0xad, 0x7b, 0x6f, 0x5e, 0x4d, 0xbc, 0xc5, 0xbf, 0xaf, 0x9f, 0x8f, 0x7f,
+    0xbf, 0xfe, 0xdd, 0xbd, 0x9d, 0x7d, 0x5d, 0x3d, 0x1d, 0xfd, 0x02, 0x6f, 0xa8, 0x11, 0x70,
+    0xf0, 0xfd, 0x67, 0x63, 0x0c, 0xb0, 0x28, 0x9c, 0x7c, 0x10, 0x62, 0x2e, 0xdc, 0x15, 0x02,
+    0x08, 0xed, 0x77, 0x98, 0x7e, 0x6f, 0xd0, 0xbc, 0x2c, 0x19, 0xbb, 0xc5, 0x4a, 0x89, 0x6b,
+    0x0c, 0x94, 0x8c, 0x85, 0x26, 0x14, 0xae, 0xf9, 0xbe, 0x0a, 0x8f, 0x31, 0xb9, 0xf7, 0xe0,
+    0xc3, 0x6c, 0x6f, 0x43, 0x00, 0x11, 0xf1, 0xf0, 0xfb, 0x68, 0x74, 0x97, 0xa8, 0xcc, 0x51,
+    0x4f, 0xe1, 0xba, 0xce, 0xd3, 0x68, 0xd2, 0x14, 0xc3, 0xf6, 0xe5, 0x88, 0xf3, 0xd9, 0xd4,
+    0xa6, 0x69, 0xf4, 0xa4, 0x4c, 0x7f, 0x36, 0x2d, 0xc9, 0x39, 0x69, 0xa3, 0xd0, 0xc1, 0x79,
+    0xac, 0x40, 0x3f, 0x17, 0x9d, 0x81, 0xe7, 0x81, 0xc7, 0x78, 0x79, 0x17, 0x4a, 0x6e, 0xea,
+    0x0e, 0x49, 0xb1, 0x1d, 0xf2, 0x91, 0xba, 0x39, 0xa6, 0x2b, 0xb6, 0x19, 0xdc, 0xc4, 0x25,
+    0x2d, 0x14, 0x73, 0x52, 0x53, 0x17, 0x7f, 0x16, 0xfe, 0x4b, 0xad, 0x8a, 0x67, 0x09, 0x35,
+    0xec, 0x06, 0x00, 0xd3, 0x48, 0x12, 0x6c, 0x39, 0x14, 0xd7, 0x56, 0xfe, 0x7d, 0xfd, 0x7c,
+    0xfc, 0xfb, 0xf5, 0xef, 0xee, 0xed, 0xec, 0xeb, 0xea, 0xe9, 0xe8, 0xe7, 0xcb, 0xbf, 0xbd,
+    0xbb, 0xb9, 0xb7, 0xb5, 0xb3, 0xb1, 0xaf, 0x57, 0x3f, 0x3b, 0x37, 0x33, 0x2f, 0x2b, 0x27,
+    0x23, 0x1f, 0x2f, 0xfe, 0xf5, 0xed, 0xe5, 0xdd, 0xd5, 0xcd, 0xc5, 0xbd, 0x5d, 0xfb, 0xea,
+    0xad, 0xac, 0xab, 0xaa, 0xa9, 0xa8, 0xa7, 0x4b, 0x3f, 0x3d, 0x3b, 0x39, 0x37, 0x35, 0x33,
+    0x31, 0x2f, 0x57, 0x06, 0x64, 0xa8, 0xa0, 0xe4, 0x03, 0xc0, 0x2c, 0x06, 0x2b, 0xe8, 0x12,
+    0xc8, 0xa5, 0x06, 0x2c, 0x8b, 0x91, 0xa8, 0x82, 0x48, 0x39, 0x45, 0x85, 0x74, 0x60, 0x9f,
+    0x8e, 0x10, 0xf1, 0x99, 0x28, 0x41, 0x6c, 0x1a, 0xe9, 0x31, 0xb2, 0x35, 0x12, 0x37, 0xf4,
+    0xe6, 0x87, 0x08, 0xda, 0x04, 0x14, 0xb1, 0x99, 0x31, 0xb8, 0x44, 0x63, 0xae, 0x2b, 0x63,
+    0x66, 0x7a, 0xc4, 0x78, 0x83, 0xde, 0x44, 0x27, 0x56, 0xb3, 0x88, 0xd7, 0x3c, 0x58, 0xd7,
+    0x93, 0xb8, 0x5c, 0x8b, 0x0f, 0xfc, 0x45, 0x24, 0x65, 0x6a, 0x42, 0x4c, 0x90, 0x35, 0x24,
+    0xef, 0xf9, 0xd2, 0x5d, 0x54, 0xff, 0x77, 0xd8, 0x46, 0xb2, 0x01, 0x6a, 0x4f, 0xbd, 0x35,
+    0xcf, 0x41, 0x32, 0xdf, 0x61, 0x07, 0xc0, 0x05, 0x0a, 0x66, 0xa8, 0x78, 0xab, 0xb6, 0x82,
+    0x6f, 0xf2, 0xa1, 0x6b, 0x28, 0x29, 0xe4, 0x32, 0x75, 0xec, 0x9d, 0x16, 0x58, 0xb8, 0x9c,
+    0xa6, 0x4d, 0xd1, 0xe6, 0x7e, 0xfa, 0x6c, 0x89, 0x9a, 0x8f, 0x3e, 0x02, 0x34, 0x03, 0x34,
+    0x04, 0x00, 0x58, 0x2d, 0x36, 0x39, 0x34, 0x37, 0x38, 0x38, 0x38, 0x66, 0x6f, 0x78, 0x42,
+    0xa0, 0xf0, 0xc5, 0x80, 0x24, 0xc6, 0xc5, 0x07, 0xb5, 0xc4, 0x71, 0x2f, 0x88, 0x98, 0xd2,
+    0x60, 0x0c, 0x31, 0x99, 0xd9, 0xa0, 0x7c, 0x8d, 0xa8, 0xa3, 0x25, 0xfa, 0xfa, 0x36, 0x88,
+    0x89, 0x8c, 0x30, 0xe2, 0x76, 0x43, 0x84, 0x58, 0x65, 0x2e, 0x11, 0x1f, 0x85, 0x12, 0x9d,
+    0x10, 0x26, 0x36, 0x37, 0x26, 0x44, 0x0b, 0x24, 0xea, 0x6a, 0x89, 0x26, 0x8c, 0x88, 0x13,
+    0x3a, 0x56, 0x88, 0x92, 0x59, 0x41, 0xbe, 0x5d, 0x20, 0x6d, 0x2c, 0x89, 0x12, 0x96, 0x70,
+    0xa2, 0xf2, 0x85, 0x99, 0xa8, 0x9f, 0x5d, 0x27, 0xda, 0x6f, 0x84, 0x48, 0x14, 0x31, 0x9c,
+    0x78, 0xe6, 0x09, 0x51, 0xfc, 0x6e, 0x06, 0x15, 0xa3, 0x3c, 0x04, 0x1e, 0x7e, 0x80, 0xa2,
+    0x44, 0x87, 0x9d, 0x68, 0xca, 0x25, 0x22, 0x75, 0xc2, 0x88, 0x28, 0x9a, 0x07, 0x1a, 0x4f,
+    0x01, 0xcd, 0x03, 0x00, 0x30, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x2d, 0x43, 0x70, 0x00, 0x22,
+    0x76, 0x2e, 0xc4, 0xa9, 0x1a, 0x2b, 0xed, 0x01, 0xc4, 0xe9, 0x5a, 0xf8, 0x50, 0x01, 0x2b,
+    0x40, 0xb9, 0x0b, 0x09, 0xa1, 0x88, 0x91, 0x85, 0x12, 0x4d, 0x1b, 0x0c, 0x89, 0x4a, 0x8d,
+    0x50, 0xa2, 0x79, 0xf3, 0x44, 0x24, 0x2a, 0x94, 0x78, 0xe6, 0x08, 0x4d, 0xfc, 0x6e, 0x06,
+    0x14, 0x23, 0x1e, 0xe2, 0xff, 0xd5, 0x44, 0x04, 0x47, 0x28, 0x51, 0xba, 0x21, 0x92, 0x20,
+    0x2c, 0x44, 0xc2, 0x69, 0x8f, 0x0d, 0x31, 0x99, 0x11, 0x40, 0x9c, 0x34, 0xd7, 0x88, 0x59,
+    0xa6, 0x25, 0xf1, 0xa4, 0x79, 0x43, 0x3c, 0x64, 0x04, 0x11, 0x3f, 0x4b, 0x5b, 0xe2, 0xf6,
+    0x42, 0x74, 0xac, 0xc3, 0x88, 0x25, 0x0d, 0x66, 0x62, 0x71, 0xf3, 0x8a, 0x88, 0xa8, 0xc4,
+    0xb2, 0xbf, 0x48, 0xec, 0x46, 0x94, 0x83, 0x86, 0xe0, 0xc0, 0x06, 0x00, 0x28, 0xb5, 0x2f,
+    0xfd, 0x04, 0x68, 0x6c, 0x0b, 0x00, 0xb6, 0x55, 0x39, 0x16, 0x90, 0xcd, 0x01, 0xe0, 0xb7,
+    0xe0, 0xf4, 0xf4, 0xa4, 0xa3, 0x6d, 0x77, 0x67, 0xc8, 0xcc, 0xcc, 0xcc, 0xf4, 0x9e, 0x99,
+    0x39, 0x59, 0x39, 0x00, 0x34, 0x00, 0x2d, 0x00, 0x49, 0xa6, 0x62, 0x86, 0xb0, 0x18, 0x98,
+    0x97, 0x8a, 0x91, 0x98, 0x03, 0xac, 0x54, 0x0e, 0x0b, 0x1e, 0xe6, 0x51, 0x31, 0x89, 0x81,
+    0x38, 0xaa, 0xa4, 0x41, 0x4c, 0xd1, 0xa8, 0x98, 0x22, 0x68, 0x8c, 0x8a, 0x15, 0x4d, 0xc2,
+    0x16, 0x95, 0xd3, 0x00, 0xa5, 0x49, 0xcc, 0xa2, 0xa8, 0x20, 0xa8, 0x19, 0x49, 0x74, 0x24,
+    0xaa, 0x21, 0x61, 0x08, 0xc4, 0xeb, 0xdb, 0xcb, 0xbb, 0xab, 0x9b, 0x8b, 0x7b, 0xbb, 0xf6,
+    0xd5, 0xb5, 0x95, 0x75, 0x55, 0x35, 0x15, 0xf5, 0x54, 0x31, 0x28, 0x69, 0xc2, 0xd2, 0x4f,
+    0xd5, 0x10, 0x43, 0xf1, 0xec, 0x54, 0x10, 0xe3, 0x40, 0x13, 0x33, 0x70, 0xaa, 0x66, 0x24,
+    0x0e, 0x2b, 0x82, 0x4d, 0xc5, 0x1a, 0xd6, 0x68, 0x2a, 0xa6, 0x18, 0x01, 0x77, 0xeb, 0x9a,
+    0x57, 0x13, 0x6f, 0xf1, 0xef, 0xeb, 0xe7, 0xe3, 0xdf, 0xaf, 0x7f, 0x77, 0x6f, 0x67, 0x5f,
+    0x57, 0x4f, 0x47, 0x3f, 0x5f, 0xfe, 0xed, 0xdd, 0xcd, 0xbd, 0xad, 0x9d, 0x8d, 0x7d, 0xbd,
+    0xfa, 0xd9, 0xb9, 0x99, 0x79, 0x59, 0x39, 0x19, 0xf9, 0x78, 0xf1, 0x07, 0x4e, 0x03, 0x94,
+    0x26, 0x31, 0xcb, 0xda, 0x57, 0xd7, 0x56, 0xd6, 0x55, 0xd5, 0x54, 0xd4, 0xd3, 0xa5, 0x9f,
+    0x9e, 0x9d, 0x9c, 0x9b, 0x9a, 0x99, 0x98, 0x97, 0x2b, 0x1f, 0x1d, 0x1b, 0x19, 0x17, 0x15,
+    0x13, 0x11, 0x0f, 0x17, 0xfe, 0xf9, 0xf5, 0xf1, 0xed, 0xe9, 0xe5, 0xe1, 0x05, 0x6d, 0xa8,
+    0x21, 0x18, 0x7b, 0x2b, 0xfb, 0x35, 0x06, 0xd0, 0x28, 0x94, 0x7c, 0x10, 0x62, 0x2e, 0xdc,
+    0x18, 0xf1, 0xee, 0x96, 0x24, 0x1f, 0x23, 0x97, 0x27, 0xb0, 0x60, 0x96, 0xa1, 0xc1, 0x3d,
+    0x20, 0xf2, 0x26, 0x74, 0x1c, 0x6c, 0x7a, 0xe6, 0x4c, 0x63, 0xda, 0xa9, 0x96, 0x65, 0x51,
+    0x38, 0x81, 0xd8, 0x25, 0x26, 0xf1, 0xb4, 0x30, 0xc2, 0xea, 0xd6, 0x14, 0x04, 0x52, 0x42,
+    0x2c, 0xc6, 0x98, 0x9b, 0x5c, 0x64, 0xe5, 0xca, 0x52, 0xa3, 0xd9, 0xad, 0x55, 0x74, 0xf0,
+    0x4c, 0x50, 0x68, 0x44, 0x11, 0xcf, 0xb3, 0x21, 0xb0, 0xee, 0x00, 0x51, 0xdf, 0x6b, 0xa3,
+    0x24, 0x57, 0xe6, 0xc8, 0xec, 0xf5, 0x27, 0x6a, 0xae, 0x28, 0xbd, 0x87, 0x76, 0x4a, 0x33,
+    0xc7, 0xe6, 0xe0, 0x3b, 0x3c, 0xdc, 0xb3, 0xb4, 0x9b, 0xaf, 0x45, 0x8e, 0x1b, 0x95, 0x2b,
+    0x79, 0xa4, 0xff, 0x0b, 0x8a, 0xb7, 0x4e, 0x65, 0x12, 0xc8, 0x55, 0x3c, 0x07, 0x00, 0xa2,
+    0x48, 0x11, 0x09, 0xb0, 0x79, 0xc9, 0x2e, 0x59, 0xfe, 0x92, 0x94, 0x07, 0x34, 0x79, 0x14,
+    0x34, 0x22, 0xb2, 0x90, 0xda, 0xe7, 0x75, 0x1c, 0x6d, 0x26, 0xdb, 0x62, 0x75, 0x97, 0x34,
+    0xb2, 0x68, 0xb1, 0xa8, 0xa6, 0xa4, 0x56, 0x51, 0xf5, 0xdf, 0xef, 0x79, 0xfa, 0x5c, 0xbe,
+    0xc7, 0xcb, 0xb7, 0x5d, 0xd3, 0xe4, 0xb1, 0x78, 0x0e, 0x57, 0x5f, 0xb7, 0x65, 0xa9, 0x53,
+    0xe9, 0x1a, 0x2d, 0x9e, 0x66, 0x49, 0x12, 0x87, 0xc2, 0x11, 0x02, 0x65, 0xa8, 0x90, 0xca,
+    0x0f, 0x90, 0x2a, 0x14, 0xe5, 0x3a, 0x12, 0x40, 0x90, 0x6a, 0x05, 0xac, 0x8a, 0x91, 0x40,
+    0x02, 0x12, 0x52, 0x7e, 0x14, 0xe8, 0x01, 0x22, 0xa6, 0xc2, 0x1e, 0x80, 0x11, 0x3d, 0x2f,
+    0x50, 0x41, 0x6f, 0x22, 0x8a, 0xd7, 0x1c, 0x5c, 0x5c, 0xfd, 0x1d, 0x13, 0x1d, 0x7d, 0x83,
+    0x14, 0x1f, 0x39, 0x8b, 0x82, 0x7d, 0x4a, 0x89, 0x8a, 0xfa, 0x07, 0xc1, 0xad, 0xc5, 0x88,
+    0x4e, 0x1f, 0x27, 0x99, 0xc7, 0xd3, 0xa9, 0x12, 0x89, 0x27, 0x9a, 0x83, 0x52, 0x1f, 0x61,
+    0x88, 0x96, 0x4f, 0x26, 0x10, 0xcf, 0x25, 0x5a, 0xfc, 0x0c, 0xb5, 0x89, 0xaf, 0xd8, 0x23,
+    0x50, 0xc0, 0x1d, 0x5e, 0xf8, 0x98, 0xe8, 0x0a, 0xae, 0x19, 0x3e, 0x8e, 0x63, 0xee, 0x33,
+    0xb8, 0xac, 0xde, 0x9d, 0x17, 0x1f, 0x5c, 0x3f, 0xc2, 0xf5, 0xf9, 0x6d, 0x01, 0x1d, 0xc8,
+    0x6b, 0x48, 0x1c, 0x42, 0x6f, 0x48, 0xcc, 0x42, 0x50, 0xe4, 0xb1, 0x82, 0x61, 0x1f, 0x60,
+    0x89, 0xa8, 0xdb, 0x17, 0x2a, 0x16, 0xc2, 0xf5, 0x80, 0x88, 0xb8, 0xcf, 0x07, 0x7b, 0x13,
+    0x95, 0x7c, 0x19, 0xa3, 0xa4, 0x4c, 0x04, 0x00, 0x48, 0x6f, 0x38, 0x37, 0x38, 0x38, 0x32,
+    0x34, 0x32, 0x35, 0x45, 0xa0, 0xe0, 0x39, 0x80, 0x24, 0xe6, 0x29, 0x3d, 0x21, 0xe2, 0xea,
+    0x19, 0x5f, 0x6b, 0x1e, 0xf6, 0x16, 0x3e, 0xec, 0x2d, 0x2d, 0x11, 0x59, 0xbc, 0x17, 0x44,
+    0x3a, 0x77, 0x85, 0x08, 0xe3, 0x61, 0x24, 0x72, 0xee, 0x4c, 0x88, 0x26, 0x88, 0xc8, 0xd5,
+    0x13, 0xce, 0xd5, 0x6a, 0xf7, 0x03, 0x88, 0x50, 0x31, 0x1f, 0x26, 0xf4, 0xc2, 0x4c, 0x5d,
+    0x26, 0xf6, 0x42, 0x11, 0x21, 0x0a, 0x25, 0xf6, 0xf9, 0x16, 0x89, 0x8b, 0xbc, 0xa0, 0xc4,
+    0xb0, 0x18, 0x8a, 0x67, 0xbe, 0x30, 0xc5, 0xef, 0x7e, 0x58, 0x31, 0x52, 0xfe, 0x11, 0xf9,
+    0x48, 0x72, 0x89, 0xbe, 0xbe, 0x75, 0x22, 0x02, 0x8f, 0x99, 0x38, 0xb5, 0x13, 0x7d, 0xcd,
+    0xa5, 0xc3, 0x5e, 0xa4, 0x0d, 0x46, 0xc4, 0x64, 0x06, 0x0b, 0x71, 0x16, 0x8d, 0xaf, 0x78,
+    0x24, 0xd9, 0x55, 0xe2, 0x33, 0xfd, 0x1b, 0x92, 0xb2, 0x03, 0x6d, 0x03, 0x00, 0x08, 0x69,
+    0x3b, 0xf0, 0x25, 0xc2, 0x9c, 0xd3, 0x26, 0xd1, 0xc7, 0x5f, 0x25, 0xc2, 0xf3, 0x18, 0x8a,
+    0x27, 0xbc, 0x60, 0x8a, 0x5f, 0xfb, 0xb0, 0xe2, 0x53, 0x4f, 0x52, 0xbc, 0xe9, 0x89, 0x92,
+    0x1d, 0x76, 0x22, 0xc7, 0xbb, 0x4c, 0x94, 0xee, 0x10, 0x91, 0x59, 0xa1, 0x22, 0x24, 0xf4,
+    0xfc, 0xb6, 0x88, 0x88, 0xbd, 0x20, 0xc4, 0x45, 0x5e, 0x20, 0xe2, 0x49, 0xff, 0x7e, 0x78,
+    0xd8, 0x0b, 0x20, 0xfe, 0xf9, 0x36, 0x62, 0x4d, 0x3f, 0x28, 0x31, 0xca, 0x27, 0xfe, 0xba,
+    0x6b, 0x44, 0xae, 0xd7, 0x9a, 0xc8, 0xc9, 0x43, 0x44, 0x6c, 0x05, 0x11, 0xd1, 0xfa, 0x17,
+    0xbe, 0xc3, 0x40, 0x4c, 0xcd, 0xe0, 0x0f, 0x6d, 0xb8, 0xc1, 0x43, 0xe9, 0xe6, 0x82, 0x0a,
+    0xd8, 0x01, 0xe5, 0xed, 0xb9, 0x32, 0x46, 0x01, 0x00, 0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xf0,
+    0x02, 0xcd, 0x04, 0x00, 0xd2, 0x49, 0x0f, 0x0c, 0xe0, 0x19, 0xc6, 0xa0, 0x00, 0x80, 0x02,
+    0xb7, 0xdc, 0xb2, 0x0d, 0x01, 0x9a, 0x1b, 0xe7, 0x92, 0x09, 0xd8, 0x16, 0x3f, 0x90, 0x49,
+    0x91, 0x04, 0x67, 0x4e, 0x8c, 0x66, 0xce, 0x45, 0x98, 0x03, 0x00, 0x48, 0x8a, 0x99, 0xcb,
+    0x57, 0x95, 0xd8, 0x32, 0x01, 0x00, 0xcc, 0x0a, 0x5b, 0x4f, 0x25, 0x85, 0xd5, 0xda, 0x54,
+    0x15, 0x4a, 0xba, 0x5b, 0xd3, 0xcc, 0x25, 0x8b, 0x28, 0xa0, 0x11, 0x79, 0xc1, 0x04, 0x33,
+    0xe1, 0x85, 0x85, 0xf6, 0x0d, 0xa0, 0x52, 0x24, 0x25, 0xdb, 0x33, 0x4c, 0xa6, 0x6e, 0xd9,
+    0xb3, 0x41, 0x23, 0x1a, 0xc1, 0x01, 0x68, 0xcf, 0xf3, 0x60, 0x3c, 0xc6, 0x45, 0xf6, 0xc6,
+    0xf5, 0x91, 0x40, 0x28, 0x9c, 0x94, 0xa2, 0x64, 0x53, 0x42, 0x2b, 0x9a, 0x29, 0x16, 0x23,
+    0x72, 0x92, 0xc1, 0xed, 0x58, 0x8c, 0x5a, 0xbd, 0x37, 0xf7, 0xe2, 0x2c, 0xc0, 0xe6, 0xd2,
+    0x22, 0x27, 0xb3, 0x4e, 0x55, 0x80, 0x6b, 0x7e, 0xaf, 0xdd, 0x29, 0x37, 0x0b, 0xce, 0xb5,
+    0xc9, 0xc4, 0x67, 0x48, 0xcb, 0x4e, 0x15, 0x60, 0x00, 0x00, 0x28, 0xb5, 0x2f, 0xfd, 0x20,
+    0x27, 0x39, 0x01, 0x00, 0x0a, 0x07, 0x08, 0x01, 0x10, 0x01, 0x18, 0x88, 0x06, 0x0a, 0x07,
+    0x08, 0x01, 0x10, 0x02, 0x18, 0xc4, 0x0d, 0x0a, 0x07, 0x08, 0x02, 0x10, 0x02, 0x18, 0xa6,
+    0x01, 0x12, 0x02, 0x08, 0x00, 0x12, 0x02, 0x08, 0x00, 0x12, 0x02, 0x08, 0x00, 0x6e, 0x00,
+    0x00, 0x28, 0xb5, 0x2f, 0xfd, 0x20, 0x2e, 0x71, 0x01, 0x00, 0x08, 0x03, 0x10, 0xa5, 0x15,
+    0x1a, 0x0c, 0x08, 0x03, 0x10, 0x00, 0x18, 0xf2, 0x14, 0x20, 0x33, 0x28, 0xe8, 0x07, 0x22,
+    0x0c, 0x08, 0x0c, 0x12, 0x02, 0x01, 0x02, 0x1a, 0x01, 0x61, 0x1a, 0x01, 0x62, 0x22, 0x02,
+    0x08, 0x04, 0x22, 0x02, 0x08, 0x07, 0x30, 0xe8, 0x07, 0x40, 0x00, 0x08, 0x3a, 0x10, 0x05,
+    0x18, 0x80, 0x20, 0x22, 0x02, 0x00, 0x0c, 0x28, 0x00, 0x82, 0xf4, 0x03, 0x03, 0x4f, 0x52,
+    0x43, 0x14};
+  constexpr int num_rows = 1000;
+
+  cudf_io::orc_reader_options read_opts = cudf_io::orc_reader_options::builder(
+    cudf_io::source_info{reinterpret_cast<const char*>(zstd_orc), sizeof(zstd_orc)});
+  auto result = cudf_io::read_orc(read_opts);
+  EXPECT_EQ(result.tbl->view().num_columns(), 2);
+  EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"a", "b"}));
+
+  auto a_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i % 61) * 1000 - 30000 + (i * i) % 7; });
+  column_wrapper<int64_t> a(a_data, a_data + num_rows);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(0), a);
+
+  std::vector<std::string> const words{"alpha",
+                                       "bravo",
+                                       "charlie",
+                                       "delta",
+                                       "echo",
+                                       "foxtrot",
+                                       "golf",
+                                       "hotel",
+                                       "india",
+                                       "juliett",
+                                       "kilo",
+                                       "lima",
+                                       "mike",
+                                       "november",
+                                       "oscar",
+                                       "papa"};
+  std::vector<std::string> b_data;
+  for (int i = 0; i < num_rows; ++i) {
+    b_data.push_back(words[(static_cast<uint64_t>(i) * 2654435761u >> 7) % 16] + "-" +
+                     std::to_string(i % 97));
+  }
+  column_wrapper<cudf::string_view> b(b_data.begin(), b_data.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(1), b);
+}
+
 TEST_F(OrcStatisticsTest, Basic)
 {
   auto sequence  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
@@ -14,12 +14,16 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/linearizer.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -31,9 +35,15 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <io/parquet/parquet.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <fstream>
+#include <thread>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -571,6 +581,31 @@ TEST_F(ParquetWriterTest, Strings)
   compare_metadata_equality(expected_metadata, result.metadata);
 }
 
+TEST_F(ParquetWriterTest, Lz4Compression)
+{
+  constexpr auto num_rows = 10000;
+  std::vector<const char*> days{"Monday", "Tuesday", "Wednesday", "Thursday", "Friday"};
+
+  auto int_values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto str_values =
+    cudf::detail::make_counting_transform_iterator(0, [&](auto i) { return days[i % 5]; });
+  column_wrapper<int> col0(int_values, int_values + num_rows);
+  column_wrapper<cudf::string_view> col1(str_values, str_values + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("Lz4Compression.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .compression(cudf_io::compression_type::LZ4);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(ParquetWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offseted views into existing cudf tables
@@ -1875,6 +1910,269 @@ TEST_F(ParquetChunkedWriterTest, ReadRowGroupsError)
   EXPECT_THROW(cudf_io::read_parquet(read_opts), cudf::logic_error);
 }
 
+TEST_F(ParquetChunkedWriterTest, ChunkedRead)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+  auto table3 = create_random_fixed_table<int>(5, 5, true);
+
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2).write(*table3);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+
+  // a limit smaller than any row group yields one row group per chunk
+  {
+    cudf_io::chunked_parquet_reader reader(1, read_opts);
+    std::vector<std::unique_ptr<table>> chunks;
+    while (reader.has_next()) { chunks.push_back(std::move(reader.read_chunk().tbl)); }
+    ASSERT_EQ(chunks.size(), 3u);
+
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) { views.push_back(*chunk); }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(views), *full_table);
+    EXPECT_THROW(reader.read_chunk(), cudf::logic_error);
+  }
+
+  // no limit reads everything at once
+  {
+    cudf_io::chunked_parquet_reader reader(0, read_opts);
+    ASSERT_TRUE(reader.has_next());
+    auto result = reader.read_chunk();
+    EXPECT_FALSE(reader.has_next());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
+  }
+
+  // skip/num rows are applied across chunk boundaries
+  {
+    read_opts.set_skip_rows(3);
+    read_opts.set_num_rows(9);
+    cudf_io::chunked_parquet_reader reader(1, read_opts);
+    std::vector<std::unique_ptr<table>> chunks;
+    while (reader.has_next()) { chunks.push_back(std::move(reader.read_chunk().tbl)); }
+
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) { views.push_back(*chunk); }
+    auto expected = cudf::slice(*full_table, {3, 12});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(views), expected[0]);
+  }
+}
+
+TEST_F(ParquetChunkedWriterTest, EstimateReadMemory)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+
+  auto filepath = temp_env->get_temp_filepath("EstimateReadMemory.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto const estimate = cudf_io::estimate_parquet_read_memory(read_opts);
+  EXPECT_GT(estimate.temporary_bytes, 0u);
+  EXPECT_GE(estimate.output_bytes, 5 * 10 * sizeof(int));
+
+  // only the selected row groups are read
+  read_opts.set_row_groups({{1}});
+  auto const row_group_estimate = cudf_io::estimate_parquet_read_memory(read_opts);
+  EXPECT_LT(row_group_estimate.temporary_bytes, estimate.temporary_bytes);
+  EXPECT_LT(row_group_estimate.output_bytes, estimate.output_bytes);
+  EXPECT_GE(row_group_estimate.output_bytes, 5 * 5 * sizeof(int));
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadWithStatisticsFilter)
+{
+  column_wrapper<int> col0_1{{0, 1, 2, 3, 4}};
+  column_wrapper<int> col0_2{{10, 11, 12, 13, 14}};
+  column_wrapper<int> col0_3{{20, 21, 22, 23, 24}};
+  column_wrapper<float> col1_1{{5, 6, 7, 8, 9}};
+  column_wrapper<float> col1_2{{5, 6, 7, 8, 9}};
+  column_wrapper<float> col1_3{{0, 1, 2, 3, 4}};
+  table_view table1({col0_1, col1_1});
+  table_view table2({col0_2, col1_2});
+  table_view table3({col0_3, col1_3});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStatisticsFilter.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(table1).write(table2).write(table3);
+
+  // col0 >= 12 rules out the first row group
+  cudf::numeric_scalar<int> twelve(12);
+  auto col0    = cudf::ast::column_reference(0);
+  auto lit12   = cudf::ast::literal(twelve);
+  auto col0_ge = cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, col0, lit12);
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(col0_ge);
+  auto result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl,
+                                *cudf::concatenate(std::vector<table_view>({table2, table3})));
+
+  // literal on the left side, combined with a condition on the second column
+  cudf::numeric_scalar<float> five(5);
+  auto col1    = cudf::ast::column_reference(1);
+  auto lit5    = cudf::ast::literal(five);
+  auto col1_lt = cudf::ast::expression(cudf::ast::ast_operator::GREATER, lit5, col1);
+  auto both    = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_AND, col0_ge, col1_lt);
+  read_opts.set_filter(both);
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table3);
+
+  // conditions that can't be decided from statistics keep every row group
+  auto sum    = cudf::ast::expression(cudf::ast::ast_operator::ADD, col0, lit12);
+  auto sum_eq = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, sum, lit12);
+  read_opts.set_filter(sum_eq);
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    *result.tbl, *cudf::concatenate(std::vector<table_view>({table1, table2, table3})));
+
+  // no row group can match
+  cudf::numeric_scalar<int> hundred(100);
+  auto lit100  = cudf::ast::literal(hundred);
+  auto col0_eq = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col0, lit100);
+  read_opts.set_filter(col0_eq);
+  result = cudf_io::read_parquet(read_opts);
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadWithRowFilter)
+{
+  column_wrapper<int> col0_1{{0, 1, 2, 3, 4}};
+  column_wrapper<int> col0_2{{10, 11, 12, 13, 14}};
+  column_wrapper<int> col0_3{{20, 21, 22, 23, 24}};
+  cudf::test::strings_column_wrapper col1_1({"a", "b", "c", "d", "e"}, {1, 0, 1, 1, 1});
+  cudf::test::strings_column_wrapper col1_2({"f", "g", "h", "i", "j"}, {1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper col1_3({"k", "l", "m", "n", "o"}, {1, 1, 1, 1, 0});
+  column_wrapper<float> col2_1{{5, 6, 7, 8, 9}};
+  column_wrapper<float> col2_2{{5, 6, 7, 8, 9}};
+  column_wrapper<float> col2_3{{0, 1, 2, 3, 4}};
+  table_view table1({col0_1, col1_1, col2_1});
+  table_view table2({col0_2, col1_2, col2_2});
+  table_view table3({col0_3, col1_3, col2_3});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRowFilter.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(table1).write(table2).write(table3);
+
+  // the first row group is ruled out by its statistics, and the rows of the others are filtered
+  cudf::numeric_scalar<int> twelve(12);
+  cudf::numeric_scalar<int> twenty_two(22);
+  auto col0    = cudf::ast::column_reference(0);
+  auto lit12   = cudf::ast::literal(twelve);
+  auto lit22   = cudf::ast::literal(twenty_two);
+  auto col0_ge = cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, col0, lit12);
+  auto col0_lt = cudf::ast::expression(cudf::ast::ast_operator::LESS, col0, lit22);
+  auto both    = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_AND, col0_ge, col0_lt);
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .filter(both)
+      .filter_rows(true);
+  auto result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    *result.tbl,
+    *cudf::concatenate(std::vector<table_view>(
+      {cudf::slice(table2, {2, 5})[0], cudf::slice(table3, {0, 2})[0]})));
+
+  // columns not referenced by the filter are not decoded for the row groups without selected
+  // rows, which the statistics can't rule out here
+  auto sum    = cudf::ast::expression(cudf::ast::ast_operator::ADD, col0, lit12);
+  auto sum_eq = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, sum, lit22);
+  read_opts.set_filter(sum_eq);
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, cudf::slice(table2, {0, 1})[0]);
+  read_opts.set_skip_rows(11);
+  result = cudf_io::read_parquet(read_opts);
+  EXPECT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  // the filter may reference a column that is not the first one
+  cudf::numeric_scalar<float> seven(7);
+  auto col2    = cudf::ast::column_reference(2);
+  auto lit7    = cudf::ast::literal(seven);
+  auto col2_gt = cudf::ast::expression(cudf::ast::ast_operator::GREATER, col2, lit7);
+  read_opts.set_skip_rows(0);
+  read_opts.set_filter(col2_gt);
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    *result.tbl,
+    *cudf::concatenate(std::vector<table_view>(
+      {cudf::slice(table1, {3, 5})[0], cudf::slice(table2, {3, 5})[0]})));
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadWithBloomFilter)
+{
+  namespace parquet = cudf::io::parquet;
+
+  column_wrapper<int> col0_1{{0, 2, 4, 6, 8}};
+  column_wrapper<int> col0_2{{10, 12, 14, 16, 18}};
+  column_wrapper<int> col0_3{{20, 22, 24, 26, 28}};
+  column_wrapper<double> col1_1{{0, 1, 2, 3, 4}};
+  column_wrapper<double> col1_2{{0, 1, 2, 3, 4}};
+  column_wrapper<double> col1_3{{0, 1, 2, 3, 4}};
+  table_view table1({col0_1, col1_1});
+  table_view table2({col0_2, col1_2});
+  table_view table3({col0_3, col1_3});
+
+  cudf_io::table_input_metadata metadata(table1);
+  metadata.column_metadata[0].set_bloom_filter(true);
+  std::vector<char> out_buffer;
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info(&out_buffer));
+  args.set_metadata(&metadata);
+  cudf_io::parquet_chunked_writer(args).write(table1).write(table2).write(table3);
+
+  // Only the first column has bloom filters
+  auto const data = reinterpret_cast<uint8_t const*>(out_buffer.data());
+  uint32_t footer_len;
+  std::memcpy(&footer_len, data + out_buffer.size() - 8, sizeof(footer_len));
+  parquet::FileMetaData fmd;
+  parquet::CompactProtocolReader cpr(data + out_buffer.size() - 8 - footer_len, footer_len);
+  ASSERT_TRUE(cpr.read(&fmd));
+  ASSERT_EQ(fmd.row_groups.size(), 3u);
+  for (auto const& rowgroup : fmd.row_groups) {
+    auto const& meta_data = rowgroup.columns[0].meta_data;
+    ASSERT_GT(meta_data.bloom_filter_length, 0);
+    parquet::BloomFilterHeader header;
+    cpr.init(data + meta_data.bloom_filter_offset, meta_data.bloom_filter_length);
+    ASSERT_TRUE(cpr.read(&header));
+    EXPECT_EQ(cpr.bytecount() + header.num_bytes, meta_data.bloom_filter_length);
+    EXPECT_EQ(rowgroup.columns[1].meta_data.bloom_filter_length, 0);
+  }
+
+  // 13 is within the statistics of the second row group, but not in its bloom filter
+  cudf::numeric_scalar<int> thirteen(13);
+  auto col0    = cudf::ast::column_reference(0);
+  auto lit13   = cudf::ast::literal(thirteen);
+  auto col0_eq = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col0, lit13);
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()))
+      .filter(col0_eq);
+  auto result = cudf_io::read_parquet(read_opts);
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  // equality with any of several values keeps the row groups that contain one of them
+  cudf::numeric_scalar<int> twenty_four(24);
+  auto lit24    = cudf::ast::literal(twenty_four);
+  auto col0_eq2 = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, lit24, col0);
+  auto col0_in  = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_OR, col0_eq, col0_eq2);
+  read_opts.set_filter(col0_in);
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table3);
+}
+
 TEST_F(ParquetWriterTest, DecimalWrite)
 {
   constexpr cudf::size_type num_rows = 500;
@@ -1919,6 +2217,175 @@ TEST_F(ParquetWriterTest, DecimalWrite)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table);
 }
 
+TEST_F(ParquetWriterTest, ColumnEncoding)
+{
+  constexpr cudf::size_type num_rows = 20000;
+  // Few distinct values, so the dictionary is much smaller than plain encoding
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 10); });
+  auto col0  = cudf::test::strings_column_wrapper(strings, strings + num_rows);
+  auto table = table_view({col0});
+
+  auto write_with_encoding = [&](cudf_io::column_encoding encoding) {
+    cudf_io::table_input_metadata metadata(table);
+    metadata.column_metadata[0].set_encoding(encoding);
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), table)
+        .metadata(&metadata);
+    cudf_io::write_parquet(out_opts);
+
+    cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+    auto result = cudf_io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  auto const default_size = write_with_encoding(cudf_io::column_encoding::USE_DEFAULT);
+  EXPECT_EQ(default_size, write_with_encoding(cudf_io::column_encoding::DICTIONARY));
+  EXPECT_LT(default_size, write_with_encoding(cudf_io::column_encoding::PLAIN));
+
+  // Dictionary encoding is not supported for booleans
+  auto bools = cudf::test::fixed_width_column_wrapper<bool>{true, false, true};
+  cudf_io::table_input_metadata bool_metadata(table_view{{bools}});
+  bool_metadata.column_metadata[0].set_encoding(cudf_io::column_encoding::DICTIONARY);
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options bool_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), table_view{{bools}})
+      .metadata(&bool_metadata);
+  EXPECT_THROW(cudf_io::write_parquet(bool_opts), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, PageIndexes)
+{
+  namespace parquet = cudf::io::parquet;
+
+  // Large enough for multiple pages per chunk
+  constexpr cudf::size_type num_rows = 200000;
+  auto const ascending =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return int64_t{i}; });
+  auto const descending =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return num_rows - i; });
+  column_wrapper<int64_t> col0(ascending, ascending + num_rows);
+  column_wrapper<int32_t> col1(descending, descending + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_COLUMN);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // The footer length precedes the magic number at the end of the file
+  auto const data = reinterpret_cast<uint8_t const*>(out_buffer.data());
+  uint32_t footer_len;
+  std::memcpy(&footer_len, data + out_buffer.size() - 8, sizeof(footer_len));
+  parquet::FileMetaData fmd;
+  parquet::CompactProtocolReader cpr(data + out_buffer.size() - 8 - footer_len, footer_len);
+  ASSERT_TRUE(cpr.read(&fmd));
+  ASSERT_EQ(fmd.row_groups.size(), 1u);
+
+  for (auto const& rowgroup : fmd.row_groups) {
+    for (size_t c = 0; c < rowgroup.columns.size(); c++) {
+      auto const& chunk = rowgroup.columns[c];
+      ASSERT_GT(chunk.offset_index_length, 0);
+      ASSERT_GT(chunk.column_index_length, 0);
+      parquet::OffsetIndex offset_index;
+      cpr.init(data + chunk.offset_index_offset, chunk.offset_index_length);
+      ASSERT_TRUE(cpr.read(&offset_index));
+      parquet::ColumnIndex column_index;
+      cpr.init(data + chunk.column_index_offset, chunk.column_index_length);
+      ASSERT_TRUE(cpr.read(&column_index));
+
+      auto const& pages = offset_index.page_locations;
+      ASSERT_GT(pages.size(), 1u);
+      ASSERT_EQ(column_index.null_pages.size(), pages.size());
+      ASSERT_EQ(column_index.min_values.size(), pages.size());
+      ASSERT_EQ(column_index.null_counts.size(), pages.size());
+      EXPECT_EQ(column_index.boundary_order, (c == 0) ? parquet::ASCENDING : parquet::DESCENDING);
+      EXPECT_EQ(pages[0].offset, chunk.meta_data.data_page_offset);
+
+      int64_t first_row = 0;
+      for (size_t p = 0; p < pages.size(); p++) {
+        // Each location spans the page header and the page data
+        parquet::PageHeader header;
+        cpr.init(data + pages[p].offset, pages[p].compressed_page_size);
+        ASSERT_TRUE(cpr.read(&header));
+        EXPECT_EQ(cpr.bytecount() + header.compressed_page_size, pages[p].compressed_page_size);
+        EXPECT_EQ(pages[p].first_row_index, first_row);
+
+        EXPECT_FALSE(column_index.null_pages[p]);
+        EXPECT_EQ(column_index.null_counts[p], 0);
+        if (c == 0) {
+          // The values of the ascending column are the row indices
+          int64_t min_value;
+          ASSERT_EQ(column_index.min_values[p].size(), sizeof(min_value));
+          std::memcpy(&min_value, column_index.min_values[p].data(), sizeof(min_value));
+          EXPECT_EQ(min_value, first_row);
+        }
+        first_row += header.data_page_header.num_values;
+      }
+      EXPECT_EQ(first_row, rowgroup.num_rows);
+    }
+  }
+}
+
+TEST_F(ParquetWriterTest, NestedPageSizeIncludesLevels)
+{
+  namespace parquet = cudf::io::parquet;
+
+  // Mostly empty lists have many more levels than leaf values, enough for several pages of levels
+  constexpr cudf::size_type num_rows   = 4000000;
+  constexpr cudf::size_type list_every = 1000;
+  auto const offsets_it                = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<cudf::size_type>(i / list_every); });
+  column_wrapper<cudf::size_type> offsets(offsets_it, offsets_it + num_rows + 1);
+  auto const values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> child(values, values + num_rows / list_every);
+  auto lists =
+    cudf::make_lists_column(num_rows, offsets.release(), child.release(), 0, rmm::device_buffer{});
+  auto expected = table_view{{*lists}};
+
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  auto const data = reinterpret_cast<uint8_t const*>(out_buffer.data());
+  uint32_t footer_len;
+  std::memcpy(&footer_len, data + out_buffer.size() - 8, sizeof(footer_len));
+  parquet::FileMetaData fmd;
+  parquet::CompactProtocolReader cpr(data + out_buffer.size() - 8 - footer_len, footer_len);
+  ASSERT_TRUE(cpr.read(&fmd));
+  ASSERT_EQ(fmd.row_groups.size(), 1u);
+
+  // The page headers follow each other from the first page of the chunk
+  auto const& meta_data = fmd.row_groups[0].columns[0].meta_data;
+  auto offset           = meta_data.dictionary_page_offset > 0 ? meta_data.dictionary_page_offset
+                                                               : meta_data.data_page_offset;
+  auto const chunk_end  = offset + meta_data.total_compressed_size;
+  int num_data_pages    = 0;
+  while (offset < chunk_end) {
+    parquet::PageHeader header;
+    cpr.init(data + offset, chunk_end - offset);
+    ASSERT_TRUE(cpr.read(&header));
+    if (header.type == parquet::PageType::DATA_PAGE) { ++num_data_pages; }
+    offset += cpr.bytecount() + header.compressed_page_size;
+  }
+  EXPECT_GT(num_data_pages, 1);
+}
+
 TYPED_TEST(ParquetChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -2861,4 +3328,720 @@ TEST_F(ParquetReaderTest, DecimalRead)
   }
 }
 
+TEST_F(ParquetReaderTest, DeltaEncodingRead)
+{
+  // a: INT64, DELTA_BINARY_PACKED in a V2 data page
+  // b: optional UTF8, DELTA_BYTE_ARRAY in a V2 data page with SNAPPY-compressed values
+  // c: UTF8, DELTA_LENGTH_BYTE_ARRAY in a V1 data page
+  // d: INT32, DELTA_BINARY_PACKED in a V1 data page
+  const unsigned char delta_parquet[] = {
+    0x50, 0x41, 0x52, 0x31, 0x15, 0x06, 0x15, 0x90, 0x0a, 0x15, 0x90, 0x0a, 0x5c, 0x15, 0x98,
+    0x02, 0x15, 0x00, 0x15, 0x98, 0x02, 0x15, 0x0a, 0x15, 0x00, 0x15, 0x00, 0x12, 0x00, 0x00,
+    0x80, 0x01, 0x04, 0x8c, 0x01, 0xfb, 0xb9, 0xb6, 0xc2, 0x05, 0xc5, 0xf3, 0xec, 0x84, 0x0b,
+    0x1f, 0x1f, 0x1f, 0x1f, 0xf9, 0x69, 0xa9, 0xdf, 0xfd, 0xb4, 0xd4, 0x6f, 0x7f, 0x5a, 0xea,
+    0xf7, 0x3f, 0x2d, 0xf5, 0x1b, 0xa0, 0x96, 0xfa, 0x1d, 0x50, 0x4b, 0xfd, 0x16, 0xa8, 0xa5,
+    0x7e, 0x0f, 0xd4, 0x52, 0xbf, 0x09, 0x6a, 0xa9, 0xdf, 0x05, 0xb5, 0xd4, 0x6f, 0x83, 0x5a,
+    0xea, 0xf7, 0x41, 0x2d, 0xf5, 0x0b, 0x00, 0x00, 0x00, 0x98, 0x50, 0x4b, 0xfd, 0x56, 0xa8,
+    0xa5, 0x7e, 0x2f, 0xd4, 0x52, 0xbf, 0x19, 0x6a, 0xa9, 0xdf, 0x0d, 0xb5, 0xd4, 0x6f, 0x87,
+    0x5a, 0xea, 0xf7, 0x43, 0x2d, 0xf5, 0x1b, 0xa2, 0x96, 0xfa, 0x1d, 0x51, 0x4b, 0xfd, 0x96,
+    0xa8, 0xa5, 0x7e, 0x4f, 0xd4, 0x52, 0xbf, 0x29, 0x6a, 0xa9, 0x5f, 0x0d, 0x00, 0x00, 0x40,
+    0x8b, 0x5a, 0xea, 0xf7, 0x45, 0x2d, 0xf5, 0x1b, 0xa3, 0x96, 0xfa, 0x9d, 0x51, 0x4b, 0xfd,
+    0xd6, 0xa8, 0xa5, 0x7e, 0x6f, 0xd4, 0x52, 0xbf, 0x39, 0x6a, 0xa9, 0xdf, 0x1d, 0xb5, 0xd4,
+    0x6f, 0x8f, 0x5a, 0xea, 0xf7, 0x47, 0x2d, 0xf5, 0x1b, 0xa4, 0x96, 0xfa, 0x1d, 0x52, 0x4b,
+    0xfd, 0xd2, 0x00, 0x00, 0x00, 0x8e, 0xd4, 0x52, 0xbf, 0x49, 0x6a, 0xa9, 0xdf, 0x25, 0xb5,
+    0xd4, 0x6f, 0x93, 0x5a, 0xea, 0xf7, 0x49, 0x2d, 0xf5, 0x1b, 0xa5, 0x96, 0xfa, 0x9d, 0x52,
+    0x4b, 0xfd, 0x56, 0xa9, 0xa5, 0x7e, 0xaf, 0xd4, 0x52, 0xbf, 0x59, 0x6a, 0xa9, 0xdf, 0x2d,
+    0xb5, 0xd4, 0x6f, 0x97, 0x5a, 0xea, 0xd7, 0x09, 0x00, 0x00, 0x10, 0xa6, 0x96, 0xfa, 0x1d,
+    0x53, 0x4b, 0xfd, 0x96, 0xa9, 0xa5, 0x7e, 0xcf, 0xd4, 0x52, 0xbf, 0x69, 0x6a, 0xa9, 0xdf,
+    0x35, 0xb5, 0xd4, 0x6f, 0x9b, 0x5a, 0xea, 0xf7, 0x4d, 0x2d, 0xf5, 0x1b, 0xa7, 0x96, 0xfa,
+    0x9d, 0x53, 0x4b, 0xfd, 0xd6, 0xa9, 0xa5, 0x7e, 0xef, 0xd4, 0x52, 0xbf, 0x68, 0x00, 0x00,
+    0x80, 0x3d, 0xb5, 0xd4, 0x6f, 0x9f, 0x5a, 0xea, 0xf7, 0x4f, 0x2d, 0xf5, 0x1b, 0xa8, 0x96,
+    0xfa, 0x1d, 0x54, 0x4b, 0xfd, 0x16, 0xaa, 0xa5, 0x7e, 0x0f, 0xd5, 0x52, 0xbf, 0x89, 0x6a,
+    0xa9, 0xdf, 0x45, 0xb5, 0xd4, 0x6f, 0xa3, 0x5a, 0xea, 0xf7, 0x51, 0x2d, 0xf5, 0x1b, 0xa9,
+    0x96, 0xfa, 0x15, 0x04, 0x00, 0x00, 0x54, 0xaa, 0xa5, 0x7e, 0x2f, 0xd5, 0x52, 0xbf, 0x99,
+    0x6a, 0xa9, 0xdf, 0x4d, 0xb5, 0xd4, 0x6f, 0xa7, 0x5a, 0xea, 0xf7, 0x53, 0x2d, 0xf5, 0x1b,
+    0xaa, 0x96, 0xfa, 0x1d, 0x55, 0x4b, 0xfd, 0x96, 0xaa, 0xa5, 0x7e, 0x4f, 0xd5, 0x52, 0xbf,
+    0xa9, 0x6a, 0xa9, 0xdf, 0x55, 0xb5, 0xd4, 0x2f, 0x27, 0x00, 0x00, 0xe0, 0x55, 0x2d, 0xf5,
+    0x1b, 0xab, 0x96, 0xfa, 0x9d, 0x55, 0x4b, 0xfd, 0xd6, 0xaa, 0xa5, 0x7e, 0x6f, 0xd5, 0x52,
+    0xbf, 0xb9, 0x6a, 0xa9, 0xdf, 0x5d, 0xb5, 0xd4, 0x6f, 0xaf, 0x5a, 0xea, 0xf7, 0x57, 0x2d,
+    0xf5, 0x1b, 0xac, 0x96, 0xfa, 0x1d, 0x56, 0x4b, 0xfd, 0x16, 0xab, 0xa5, 0x7e, 0x6d, 0x01,
+    0x00, 0x00, 0xc9, 0x6a, 0xa9, 0xdf, 0x65, 0xb5, 0xd4, 0x6f, 0xb3, 0x5a, 0xea, 0xf7, 0x59,
+    0x2d, 0xf5, 0x1b, 0xad, 0x96, 0xfa, 0x9d, 0x56, 0x4b, 0xfd, 0x56, 0xab, 0xa5, 0x7e, 0xaf,
+    0xd5, 0x52, 0xbf, 0xd9, 0x6a, 0xa9, 0xdf, 0x6d, 0xb5, 0xd4, 0x6f, 0xb7, 0x5a, 0xea, 0xf7,
+    0x5b, 0x2d, 0xf5, 0x0b, 0x0d, 0x00, 0x00, 0x18, 0x57, 0x4b, 0xfd, 0x96, 0xab, 0xa5, 0x7e,
+    0xcf, 0xd5, 0x52, 0xbf, 0xe9, 0x6a, 0xa9, 0xdf, 0x75, 0xb5, 0xd4, 0x6f, 0xbb, 0x5a, 0xea,
+    0xf7, 0x5d, 0x2d, 0xf5, 0x1b, 0xaf, 0x96, 0xfa, 0x9d, 0x57, 0x4b, 0xfd, 0xd6, 0xab, 0xa5,
+    0x7e, 0xef, 0xd5, 0x52, 0xbf, 0xf1, 0xef, 0xec, 0x84, 0x0b, 0x1f, 0x00, 0x00, 0x00, 0x0f,
+    0x6a, 0xa9, 0x5f, 0x00, 0x00, 0x00, 0xc0, 0x84, 0x5a, 0xea, 0xb7, 0x42, 0x2d, 0xf5, 0x7b,
+    0xa1, 0x96, 0xfa, 0xcd, 0x50, 0x4b, 0xfd, 0x6e, 0xa8, 0xa5, 0x7e, 0x3b, 0xd4, 0x52, 0xbf,
+    0x1f, 0x6a, 0xa9, 0xdf, 0x10, 0xb5, 0xd4, 0xef, 0x88, 0x5a, 0xea, 0x17, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x06, 0x15, 0xc6, 0x05, 0x15, 0xd6, 0x05, 0x5c, 0x15, 0x98, 0x02,
+    0x15, 0x28, 0x15, 0x98, 0x02, 0x15, 0x0e, 0x15, 0x26, 0x15, 0x00, 0x11, 0x00, 0x00, 0x25,
+    0xf7, 0xfb, 0xfd, 0x7e, 0xbf, 0xdf, 0xef, 0xf7, 0xfb, 0xfd, 0x7e, 0xbf, 0xdf, 0xef, 0xf7,
+    0xfb, 0xfd, 0x0e, 0xd0, 0x02, 0xec, 0x80, 0x01, 0x04, 0x78, 0x00, 0x05, 0x03, 0x03, 0x03,
+    0x03, 0x5f, 0x9a, 0x2e, 0x4d, 0x97, 0xa6, 0x4b, 0x97, 0xa6, 0x83, 0xd3, 0xa5, 0xe9, 0xd2,
+    0xa5, 0xe9, 0xd2, 0x74, 0x29, 0xbc, 0x74, 0x69, 0xba, 0x34, 0x5d, 0x9a, 0x2e, 0x5d, 0x0a,
+    0x2f, 0x4d, 0x97, 0xa6, 0x4b, 0x97, 0xa6, 0x4b, 0xd3, 0xc1, 0xe9, 0xd2, 0xa5, 0xe9, 0xd2,
+    0x14, 0x00, 0x00, 0x00, 0x80, 0x01, 0xec, 0x04, 0x78, 0x0a, 0x07, 0x03, 0x03, 0x03, 0x03,
+    0xa0, 0x65, 0xd1, 0xb2, 0x68, 0x59, 0xb4, 0x68, 0x59, 0x7c, 0x2c, 0x5a, 0x16, 0x2d, 0x5a,
+    0x16, 0x2d, 0x8b, 0xd6, 0x43, 0x8b, 0x96, 0x45, 0xcb, 0xa2, 0x65, 0xd1, 0xa2, 0xf5, 0xd0,
+    0xb2, 0x68, 0x59, 0xb4, 0x68, 0x59, 0xb4, 0x2c, 0x3e, 0x16, 0x2d, 0x5a, 0x16, 0x2d, 0x0b,
+    0x00, 0x00, 0x00, 0x76, 0x30, 0x30, 0x5f, 0xec, 0x30, 0x31, 0x32, 0x31, 0x5f, 0x31, 0x32,
+    0x32, 0x5f, 0x30, 0x31, 0x32, 0x33, 0x5f, 0x30, 0x32, 0x34, 0x5f, 0x30, 0x31, 0x32, 0x35,
+    0x5f, 0x30, 0x31, 0x36, 0x5f, 0x30, 0x31, 0x32, 0x37, 0x5f, 0x30, 0x31, 0x32, 0x38, 0x5f,
+    0x31, 0x32, 0x39, 0x5f, 0x30, 0x31, 0x32, 0x31, 0x30, 0x5f, 0x30, 0x32, 0x31, 0x5f, 0x30,
+    0x31, 0x32, 0x32, 0x5f, 0x30, 0x31, 0x33, 0x5f, 0xec, 0x30, 0x31, 0x32, 0x34, 0x5f, 0x30,
+    0x31, 0x32, 0x35, 0x5f, 0x31, 0x32, 0x36, 0x5f, 0x30, 0x31, 0x32, 0x37, 0x5f, 0x30, 0x32,
+    0x38, 0x5f, 0x30, 0x31, 0x32, 0x39, 0x5f, 0x30, 0x31, 0x32, 0x30, 0x5f, 0x30, 0x31, 0x32,
+    0x31, 0x5f, 0x30, 0x31, 0x32, 0x32, 0x5f, 0x31, 0x32, 0x33, 0x5f, 0x30, 0x31, 0x32, 0x34,
+    0x5f, 0x30, 0x32, 0x35, 0x5f, 0x30, 0x31, 0x32, 0x36, 0xec, 0x5f, 0x30, 0x31, 0x37, 0x5f,
+    0x30, 0x31, 0x32, 0x38, 0x5f, 0x30, 0x31, 0x32, 0x39, 0x5f, 0x31, 0x32, 0x33, 0x30, 0x5f,
+    0x30, 0x31, 0x32, 0x31, 0x5f, 0x30, 0x32, 0x32, 0x5f, 0x30, 0x31, 0x32, 0x33, 0x5f, 0x30,
+    0x31, 0x34, 0x5f, 0x30, 0x31, 0x32, 0x35, 0x5f, 0x30, 0x31, 0x32, 0x36, 0x5f, 0x31, 0x32,
+    0x37, 0x5f, 0x30, 0x31, 0x32, 0x38, 0x5f, 0x30, 0x32, 0x39, 0x8c, 0x5f, 0x30, 0x31, 0x32,
+    0x34, 0x30, 0x5f, 0x30, 0x31, 0x31, 0x5f, 0x30, 0x31, 0x32, 0x32, 0x5f, 0x30, 0x31, 0x32,
+    0x33, 0x5f, 0x31, 0x32, 0x34, 0x5f, 0x30, 0x31, 0x32, 0x35, 0x5f, 0x30, 0x32, 0x36, 0x5f,
+    0x30, 0x31, 0x15, 0x00, 0x15, 0x82, 0x08, 0x15, 0x82, 0x08, 0x2c, 0x15, 0x98, 0x02, 0x15,
+    0x0c, 0x15, 0x06, 0x15, 0x06, 0x00, 0x00, 0x80, 0x01, 0x04, 0x8c, 0x01, 0x02, 0x03, 0x03,
+    0x02, 0x02, 0x03, 0x1b, 0x36, 0x6c, 0xe0, 0xb0, 0x61, 0xc3, 0x86, 0x0d, 0x1b, 0x36, 0x6c,
+    0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3,
+    0x3c, 0x1b, 0x38, 0x6c, 0xd8, 0xb0, 0x61, 0xc3, 0x86, 0x0d, 0x1b, 0x36, 0x6c, 0x03, 0x02,
+    0x00, 0x00, 0x00, 0x3c, 0xcf, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0x31, 0x78,
+    0x78, 0x32, 0x33, 0x78, 0x34, 0x78, 0x78, 0x35, 0x36, 0x78, 0x37, 0x78, 0x78, 0x38, 0x39,
+    0x78, 0x31, 0x30, 0x78, 0x78, 0x31, 0x31, 0x31, 0x32, 0x78, 0x31, 0x33, 0x78, 0x78, 0x31,
+    0x34, 0x31, 0x35, 0x78, 0x31, 0x36, 0x78, 0x78, 0x31, 0x37, 0x31, 0x38, 0x78, 0x31, 0x39,
+    0x78, 0x78, 0x32, 0x30, 0x32, 0x31, 0x78, 0x32, 0x32, 0x78, 0x78, 0x32, 0x33, 0x32, 0x34,
+    0x78, 0x32, 0x35, 0x78, 0x78, 0x32, 0x36, 0x32, 0x37, 0x78, 0x32, 0x38, 0x78, 0x78, 0x32,
+    0x39, 0x33, 0x30, 0x78, 0x33, 0x31, 0x78, 0x78, 0x33, 0x32, 0x33, 0x33, 0x78, 0x33, 0x34,
+    0x78, 0x78, 0x33, 0x35, 0x33, 0x36, 0x78, 0x33, 0x37, 0x78, 0x78, 0x33, 0x38, 0x33, 0x39,
+    0x78, 0x34, 0x30, 0x78, 0x78, 0x34, 0x31, 0x34, 0x32, 0x78, 0x34, 0x33, 0x78, 0x78, 0x34,
+    0x34, 0x34, 0x35, 0x78, 0x34, 0x36, 0x78, 0x78, 0x34, 0x37, 0x34, 0x38, 0x78, 0x34, 0x39,
+    0x78, 0x78, 0x35, 0x30, 0x35, 0x31, 0x78, 0x35, 0x32, 0x78, 0x78, 0x35, 0x33, 0x35, 0x34,
+    0x78, 0x35, 0x35, 0x78, 0x78, 0x35, 0x36, 0x35, 0x37, 0x78, 0x35, 0x38, 0x78, 0x78, 0x35,
+    0x39, 0x36, 0x30, 0x78, 0x36, 0x31, 0x78, 0x78, 0x36, 0x32, 0x36, 0x33, 0x78, 0x36, 0x34,
+    0x78, 0x78, 0x36, 0x35, 0x36, 0x36, 0x78, 0x36, 0x37, 0x78, 0x78, 0x36, 0x38, 0x36, 0x39,
+    0x78, 0x37, 0x30, 0x78, 0x78, 0x37, 0x31, 0x37, 0x32, 0x78, 0x37, 0x33, 0x78, 0x78, 0x37,
+    0x34, 0x37, 0x35, 0x78, 0x37, 0x36, 0x78, 0x78, 0x37, 0x37, 0x37, 0x38, 0x78, 0x37, 0x39,
+    0x78, 0x78, 0x38, 0x30, 0x38, 0x31, 0x78, 0x38, 0x32, 0x78, 0x78, 0x38, 0x33, 0x38, 0x34,
+    0x78, 0x38, 0x35, 0x78, 0x78, 0x38, 0x36, 0x38, 0x37, 0x78, 0x38, 0x38, 0x78, 0x78, 0x38,
+    0x39, 0x39, 0x30, 0x78, 0x39, 0x31, 0x78, 0x78, 0x39, 0x32, 0x39, 0x33, 0x78, 0x39, 0x34,
+    0x78, 0x78, 0x39, 0x35, 0x39, 0x36, 0x78, 0x39, 0x37, 0x78, 0x78, 0x39, 0x38, 0x39, 0x39,
+    0x78, 0x31, 0x30, 0x30, 0x78, 0x78, 0x31, 0x30, 0x31, 0x31, 0x30, 0x32, 0x78, 0x31, 0x30,
+    0x33, 0x78, 0x78, 0x31, 0x30, 0x34, 0x31, 0x30, 0x35, 0x78, 0x31, 0x30, 0x36, 0x78, 0x78,
+    0x31, 0x30, 0x37, 0x31, 0x30, 0x38, 0x78, 0x31, 0x30, 0x39, 0x78, 0x78, 0x31, 0x31, 0x30,
+    0x31, 0x31, 0x31, 0x78, 0x31, 0x31, 0x32, 0x78, 0x78, 0x31, 0x31, 0x33, 0x31, 0x31, 0x34,
+    0x78, 0x31, 0x31, 0x35, 0x78, 0x78, 0x31, 0x31, 0x36, 0x31, 0x31, 0x37, 0x78, 0x31, 0x31,
+    0x38, 0x78, 0x78, 0x31, 0x31, 0x39, 0x31, 0x32, 0x30, 0x78, 0x31, 0x32, 0x31, 0x78, 0x78,
+    0x31, 0x32, 0x32, 0x31, 0x32, 0x33, 0x78, 0x31, 0x32, 0x34, 0x78, 0x78, 0x31, 0x32, 0x35,
+    0x31, 0x32, 0x36, 0x78, 0x31, 0x32, 0x37, 0x78, 0x78, 0x31, 0x32, 0x38, 0x31, 0x32, 0x39,
+    0x78, 0x31, 0x33, 0x30, 0x78, 0x78, 0x31, 0x33, 0x31, 0x31, 0x33, 0x32, 0x78, 0x31, 0x33,
+    0x33, 0x78, 0x78, 0x31, 0x33, 0x34, 0x31, 0x33, 0x35, 0x78, 0x31, 0x33, 0x36, 0x78, 0x78,
+    0x31, 0x33, 0x37, 0x31, 0x33, 0x38, 0x78, 0x31, 0x33, 0x39, 0x15, 0x00, 0x15, 0xb2, 0x08,
+    0x15, 0xb2, 0x08, 0x2c, 0x15, 0x98, 0x02, 0x15, 0x0a, 0x15, 0x06, 0x15, 0x06, 0x00, 0x00,
+    0x80, 0x01, 0x04, 0x8c, 0x01, 0xfe, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f,
+    0x20, 0x20, 0x20, 0x20, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x7f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0xff, 0x7f, 0x42, 0x01, 0x00, 0x80, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab,
+    0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f,
+    0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff,
+    0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff,
+    0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0x7c, 0x07, 0x00, 0x80, 0xab, 0xff, 0xff, 0x7f, 0xab,
+    0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f,
+    0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff,
+    0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff,
+    0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab,
+    0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f,
+    0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0x7c, 0x07, 0x00,
+    0x80, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff,
+    0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab,
+    0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f,
+    0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff,
+    0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff,
+    0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0x7c,
+    0x07, 0x00, 0x80, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f,
+    0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff,
+    0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff,
+    0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab,
+    0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f,
+    0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff,
+    0x7f, 0xab, 0xff, 0xff, 0x7f, 0x7c, 0x07, 0x00, 0x80, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff,
+    0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab,
+    0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f,
+    0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff,
+    0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff,
+    0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab,
+    0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0x7c, 0x07, 0x00, 0x80, 0xab, 0xff, 0xff, 0x7f,
+    0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff,
+    0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xab, 0xff,
+    0xff, 0x7f, 0xab, 0xff, 0xff, 0x7f, 0xa9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x19,
+    0x5c, 0x48, 0x06, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x15, 0x08, 0x00, 0x15, 0x04, 0x25,
+    0x00, 0x18, 0x01, 0x61, 0x00, 0x15, 0x0c, 0x25, 0x02, 0x18, 0x01, 0x62, 0x25, 0x00, 0x00,
+    0x15, 0x0c, 0x25, 0x00, 0x18, 0x01, 0x63, 0x25, 0x00, 0x00, 0x15, 0x02, 0x25, 0x00, 0x18,
+    0x01, 0x64, 0x00, 0x16, 0x98, 0x02, 0x19, 0x1c, 0x19, 0x4c, 0x26, 0x08, 0x1c, 0x15, 0x04,
+    0x19, 0x15, 0x0a, 0x19, 0x18, 0x01, 0x61, 0x15, 0x00, 0x16, 0x98, 0x02, 0x16, 0xc4, 0x0a,
+    0x16, 0xc4, 0x0a, 0x26, 0x08, 0x00, 0x00, 0x26, 0xcc, 0x0a, 0x1c, 0x15, 0x0c, 0x19, 0x25,
+    0x0e, 0x06, 0x19, 0x18, 0x01, 0x62, 0x15, 0x02, 0x16, 0x98, 0x02, 0x16, 0xfa, 0x05, 0x16,
+    0x8a, 0x06, 0x26, 0xcc, 0x0a, 0x00, 0x00, 0x26, 0xd6, 0x10, 0x1c, 0x15, 0x0c, 0x19, 0x15,
+    0x0c, 0x19, 0x18, 0x01, 0x63, 0x15, 0x00, 0x16, 0x98, 0x02, 0x16, 0xaa, 0x08, 0x16, 0xaa,
+    0x08, 0x26, 0xd6, 0x10, 0x00, 0x00, 0x26, 0x80, 0x19, 0x1c, 0x15, 0x02, 0x19, 0x15, 0x0a,
+    0x19, 0x18, 0x01, 0x64, 0x15, 0x00, 0x16, 0x98, 0x02, 0x16, 0xda, 0x08, 0x16, 0xda, 0x08,
+    0x26, 0x80, 0x19, 0x00, 0x00, 0x16, 0xc2, 0x21, 0x16, 0x98, 0x02, 0x00, 0x00, 0xb5, 0x00,
+    0x00, 0x00, 0x50, 0x41, 0x52, 0x31};
+  constexpr int num_rows = 140;
+
+  cudf_io::parquet_reader_options read_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{reinterpret_cast<const char*>(delta_parquet), sizeof(delta_parquet)});
+  auto result = cudf_io::read_parquet(read_opts);
+  EXPECT_EQ(result.tbl->view().num_columns(), 4);
+
+  auto a_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i % 13 - 6) * 123456789 + i * i; });
+  column_wrapper<int64_t> a(a_data, a_data + num_rows);
+  cudf::test::expect_columns_equal(result.tbl->view().column(0), a);
+
+  std::vector<std::string> b_data;
+  std::vector<std::string> c_data;
+  for (int i = 0; i < num_rows; ++i) {
+    b_data.push_back((i / 3 < 10 ? "v0" : "v") + std::to_string(i / 3) + "_" +
+                     std::to_string(i % 3));
+    c_data.push_back(std::string(i % 3, 'x') + std::to_string(i));
+  }
+  auto b_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 3; });
+  cudf::test::strings_column_wrapper b(b_data.begin(), b_data.end(), b_valid);
+  cudf::test::expect_columns_equal(result.tbl->view().column(1), b);
+  cudf::test::strings_column_wrapper c(c_data.begin(), c_data.end());
+  cudf::test::expect_columns_equal(result.tbl->view().column(2), c);
+
+  // The first values exercise the 32-bit wraparound of the deltas
+  auto d_data = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    int32_t const extremes[] = {std::numeric_limits<int32_t>::max(),
+                                std::numeric_limits<int32_t>::min(),
+                                0,
+                                -1};
+    return i < 8 ? extremes[i % 4] : (i * 7919) % 2001 - 1000;
+  });
+  column_wrapper<int32_t> d(d_data, d_data + num_rows);
+  cudf::test::expect_columns_equal(result.tbl->view().column(3), d);
+}
+
+TEST_F(ParquetReaderTest, ZstdCompressedRead)
+{
+  // a: INT32 and b: UTF8, both PLAIN in a V1 data page compressed as a ZSTD frame of several
+  // blocks. The first block of each frame has FSE-compressed sequences, with 4-stream
+  // Huffman-compressed literals for b, and the later blocks reuse its tables: repeat-mode
+  // sequences, and treeless literals for b. The frame of b ends with a content checksum.
+  const unsigned char zstd_parquet[] = {
+    0x50, 0x41, 0x52, 0x31, 0x15, 0x00, 0x15, 0xc0, 0x3e, 0x15, 0xb2, 0x0f, 0x2c, 0x15, 0xd0,
+    0x0f, 0x15, 0x00, 0x15, 0x06, 0x15, 0x06, 0x00, 0x00, 0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x68,
+    0xac, 0x0f, 0x00, 0xe4, 0x1a, 0x18, 0xfc, 0xff, 0xff, 0x1c, 0x22, 0x25, 0x27, 0x2b, 0x31,
+    0x34, 0x36, 0x3a, 0x40, 0x43, 0x45, 0x49, 0x4f, 0x52, 0x54, 0x58, 0x5e, 0x61, 0x63, 0x67,
+    0x6d, 0x70, 0x72, 0x76, 0x7c, 0x7f, 0x81, 0x85, 0x8b, 0x8e, 0x90, 0x94, 0x9a, 0x9d, 0x9f,
+    0xa3, 0xa9, 0xac, 0xae, 0xb2, 0xb8, 0xbb, 0xbd, 0xc1, 0xc7, 0xca, 0xcc, 0xd0, 0xd6, 0xd9,
+    0xdb, 0xdf, 0xe5, 0xe8, 0xea, 0xee, 0xf4, 0xf7, 0xf9, 0xfd, 0x03, 0xfd, 0xff, 0xff, 0x06,
+    0x08, 0x0c, 0x12, 0x15, 0x17, 0x1b, 0x21, 0x24, 0x26, 0x2a, 0x30, 0x33, 0x35, 0x39, 0x3f,
+    0x42, 0x44, 0x48, 0x4e, 0x51, 0x53, 0x57, 0x5d, 0x60, 0x62, 0x66, 0x6c, 0x6f, 0x71, 0x75,
+    0x7b, 0x7e, 0x80, 0x84, 0x8a, 0x8d, 0x8f, 0x93, 0x99, 0x9c, 0x9e, 0xa2, 0xa8, 0xab, 0xad,
+    0xb1, 0xb7, 0xba, 0xbc, 0xc0, 0xc6, 0xc9, 0xcb, 0xcf, 0xd5, 0xd8, 0xda, 0xde, 0xe4, 0xe7,
+    0xe9, 0xed, 0xf3, 0xf6, 0xf8, 0xfc, 0x02, 0xfe, 0xff, 0xff, 0x05, 0x07, 0x0b, 0x11, 0x14,
+    0x16, 0x1a, 0x20, 0x23, 0x25, 0x29, 0x2f, 0x32, 0x34, 0x38, 0x3e, 0x41, 0x43, 0x47, 0x4d,
+    0x50, 0x52, 0x56, 0x5c, 0x5f, 0x61, 0x65, 0x6b, 0x6e, 0x70, 0x74, 0x7a, 0x7d, 0x7f, 0x83,
+    0x89, 0x8c, 0x8e, 0x92, 0x98, 0x9b, 0x9d, 0xa1, 0xa7, 0xaa, 0xac, 0xb0, 0xb6, 0xb9, 0xbb,
+    0xbf, 0xc5, 0xc8, 0xca, 0xce, 0xd4, 0xd7, 0xd9, 0xdd, 0xe3, 0xe6, 0xe8, 0xec, 0xf2, 0xf5,
+    0xf7, 0xfb, 0x01, 0xff, 0xff, 0xff, 0x04, 0x06, 0x0a, 0x10, 0x13, 0x15, 0x19, 0x1f, 0x22,
+    0x24, 0x28, 0x2e, 0x31, 0x33, 0x37, 0x3d, 0x40, 0x42, 0x46, 0x4c, 0x4f, 0x51, 0x55, 0x5b,
+    0x5e, 0x60, 0x64, 0x6a, 0x6d, 0x6f, 0x73, 0x79, 0x7c, 0x7e, 0x82, 0x88, 0x8b, 0x8d, 0x91,
+    0x97, 0x9a, 0x9c, 0xa0, 0xa6, 0xa9, 0xab, 0xaf, 0xb5, 0xb8, 0xba, 0xbe, 0xc4, 0xc7, 0xc9,
+    0xcd, 0xd3, 0xd6, 0xd8, 0xdc, 0xe2, 0xe5, 0xe7, 0xeb, 0xf1, 0xf4, 0xf6, 0xfa, 0x00, 0x03,
+    0x05, 0x09, 0x0f, 0x12, 0x14, 0x18, 0x1e, 0x21, 0x23, 0x27, 0x2d, 0x30, 0x32, 0x36, 0x3c,
+    0x3f, 0x41, 0x45, 0x4b, 0x4e, 0x50, 0x54, 0x5a, 0x5d, 0x5f, 0x63, 0x69, 0x6c, 0x6e, 0x72,
+    0x78, 0x7b, 0x7d, 0x81, 0x87, 0x8a, 0x8c, 0x90, 0x96, 0x99, 0x9b, 0x9f, 0xa5, 0xa8, 0xaa,
+    0xae, 0xb4, 0xb7, 0xb9, 0xbd, 0xc3, 0xc6, 0xc8, 0xcc, 0xd2, 0xd5, 0xd7, 0xdb, 0xe1, 0xe4,
+    0xe6, 0xea, 0xf0, 0xf3, 0xf5, 0xf9, 0xff, 0x02, 0x01, 0x04, 0x08, 0x0e, 0x11, 0x13, 0x17,
+    0x1d, 0x20, 0x22, 0x26, 0x2c, 0x2f, 0x31, 0x35, 0x3b, 0x3e, 0x40, 0x44, 0x4a, 0x4d, 0x4f,
+    0x53, 0x59, 0x5c, 0x5e, 0x62, 0x68, 0x6b, 0x6d, 0x71, 0x77, 0x7a, 0x7c, 0x80, 0x86, 0x89,
+    0x8b, 0x8f, 0x95, 0x98, 0x9a, 0x9e, 0xa4, 0xa7, 0xa9, 0xad, 0xb3, 0xb6, 0xb8, 0xbc, 0xc2,
+    0xc5, 0xc7, 0xcb, 0xd1, 0xd4, 0xd6, 0xda, 0xe0, 0xe3, 0xe5, 0xe9, 0xef, 0xf2, 0xf4, 0xf8,
+    0xfe, 0x01, 0x02, 0x03, 0x07, 0x0d, 0x10, 0x12, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00,
+    0x81, 0x94, 0xa8, 0x11, 0xf0, 0xb3, 0x06, 0xe1, 0x1f, 0x11, 0x47, 0xf2, 0x01, 0x38, 0xe3,
+    0xb4, 0xd9, 0xc6, 0x56, 0xb6, 0xb3, 0xcd, 0xda, 0x3c, 0xcd, 0x6c, 0x63, 0x9b, 0xed, 0xd4,
+    0x66, 0x93, 0xaa, 0xce, 0x36, 0xb7, 0xb3, 0xcd, 0x76, 0xb6, 0x32, 0x56, 0x3b, 0xdb, 0x6c,
+    0xc5, 0x36, 0xbb, 0x19, 0xb4, 0xcb, 0xda, 0x6c, 0x63, 0x9b, 0xad, 0xd9, 0x42, 0xd5, 0x6e,
+    0xb6, 0x31, 0x9b, 0x6d, 0xae, 0x49, 0x28, 0xab, 0x2a, 0xc5, 0x0e, 0x00, 0x64, 0x19, 0x1c,
+    0x1f, 0x21, 0x25, 0x2b, 0x2e, 0x30, 0x34, 0x3a, 0x3d, 0x3f, 0x43, 0x49, 0x4c, 0x4e, 0x52,
+    0x58, 0x5b, 0x5d, 0x61, 0x67, 0x6a, 0x6c, 0x70, 0x76, 0x79, 0x7b, 0x7f, 0x85, 0x88, 0x8a,
+    0x8e, 0x94, 0x97, 0x99, 0x9d, 0xa3, 0xa6, 0xa8, 0xac, 0xb2, 0xb5, 0xb7, 0xbb, 0xc1, 0xc4,
+    0xc6, 0xca, 0xd0, 0xd3, 0xd5, 0xd9, 0xdf, 0xe2, 0xe4, 0xe8, 0xee, 0xf1, 0xf3, 0xf7, 0xfd,
+    0x00, 0x02, 0x06, 0x0c, 0x0f, 0x11, 0x15, 0x1b, 0x1e, 0x20, 0x24, 0x2a, 0x2d, 0x2f, 0x33,
+    0x39, 0x3c, 0x3e, 0x42, 0x48, 0x4b, 0x4d, 0x51, 0x57, 0x5a, 0x5c, 0x60, 0x66, 0x69, 0x6b,
+    0x6f, 0x75, 0x78, 0x7a, 0x7e, 0x84, 0x87, 0x89, 0x8d, 0x93, 0x96, 0x98, 0x9c, 0xa2, 0xa5,
+    0xa7, 0xab, 0xb1, 0xb4, 0xb6, 0xba, 0xc0, 0xc3, 0xc5, 0xc9, 0xcf, 0xd2, 0xd4, 0xd8, 0xde,
+    0xe1, 0xe3, 0xe7, 0xed, 0xf0, 0xf2, 0xf6, 0xfc, 0xff, 0x01, 0x04, 0x00, 0x00, 0x05, 0x0b,
+    0x0e, 0x10, 0x14, 0x1a, 0x1d, 0x1f, 0x23, 0x29, 0x2c, 0x2e, 0x32, 0x38, 0x3b, 0x3d, 0x41,
+    0x47, 0x4a, 0x4c, 0x50, 0x56, 0x59, 0x5b, 0x5f, 0x65, 0x68, 0x6a, 0x6e, 0x74, 0x77, 0x79,
+    0x7d, 0x83, 0x86, 0x88, 0x8c, 0x92, 0x95, 0x97, 0x9b, 0xa1, 0xa4, 0xa6, 0xaa, 0xb0, 0xb3,
+    0xb5, 0xb9, 0xbf, 0xc2, 0xc4, 0xc8, 0xce, 0xd1, 0xd3, 0xd7, 0xdd, 0xe0, 0xe2, 0xe6, 0xec,
+    0xef, 0xf1, 0xf5, 0xfb, 0xfe, 0x00, 0x04, 0x0a, 0x0d, 0x0f, 0x13, 0x19, 0x1c, 0x1e, 0x22,
+    0x28, 0x2b, 0x2d, 0x31, 0x37, 0x3a, 0x3c, 0x40, 0x46, 0x49, 0x4b, 0x4f, 0x55, 0x58, 0x5a,
+    0x5e, 0x64, 0x67, 0x69, 0x6d, 0x73, 0x76, 0x78, 0x7c, 0x82, 0x85, 0x87, 0x8b, 0x91, 0x94,
+    0x96, 0x9a, 0xa0, 0xa3, 0xa5, 0xa9, 0xaf, 0xb2, 0xb4, 0xb8, 0xbe, 0xc1, 0xc3, 0xc7, 0xcd,
+    0xd0, 0xd2, 0xd6, 0xdc, 0xdf, 0xe1, 0xe5, 0xeb, 0xee, 0xf0, 0xf4, 0xfa, 0xfd, 0xff, 0x03,
+    0x06, 0x00, 0x00, 0x09, 0x0c, 0x0e, 0x12, 0x18, 0x1b, 0x1d, 0x21, 0x27, 0x2a, 0x2c, 0x30,
+    0x36, 0x39, 0x3b, 0x3f, 0x45, 0x48, 0x4a, 0x4e, 0x54, 0x57, 0x59, 0x5d, 0x63, 0x66, 0x68,
+    0x6c, 0x72, 0x75, 0x77, 0x7b, 0x81, 0x84, 0x86, 0x8a, 0x90, 0x93, 0x95, 0x99, 0x9f, 0xa2,
+    0xa4, 0xa8, 0xae, 0xb1, 0xb3, 0xb7, 0xbd, 0xc0, 0xc2, 0xc6, 0xcc, 0xcf, 0xd1, 0xd5, 0xdb,
+    0xde, 0xe0, 0xe4, 0xea, 0xed, 0xef, 0xf3, 0xf9, 0xfc, 0xfe, 0x02, 0x07, 0x00, 0x00, 0x08,
+    0x0b, 0x0d, 0x11, 0x17, 0x1a, 0x1c, 0x20, 0x26, 0x29, 0x2b, 0x2f, 0x35, 0x38, 0x3a, 0x3e,
+    0x44, 0x47, 0x49, 0x4d, 0x53, 0x56, 0x58, 0x5c, 0x62, 0x65, 0x67, 0x6b, 0x71, 0x74, 0x76,
+    0x7a, 0x80, 0x83, 0x85, 0x89, 0x8f, 0x92, 0x94, 0x98, 0x9e, 0xa1, 0xa3, 0xa7, 0xad, 0xb0,
+    0xb2, 0xb6, 0xbc, 0xbf, 0xc1, 0xc5, 0xcb, 0xce, 0x07, 0x00, 0x00, 0xce, 0x07, 0x00, 0x00,
+    0x81, 0x82, 0xe8, 0xf1, 0xb3, 0x6f, 0x11, 0x87, 0x1f, 0xe1, 0x91, 0x1f, 0x79, 0xe4, 0x47,
+    0x85, 0xe5, 0x4b, 0x1e, 0xe9, 0x92, 0x47, 0x7e, 0x84, 0x58, 0x3e, 0xe6, 0x91, 0x2e, 0x79,
+    0xe4, 0x4b, 0x82, 0x0a, 0x55, 0x8f, 0xf6, 0xc8, 0xa3, 0x3c, 0xf2, 0x38, 0x0f, 0x0a, 0xf9,
+    0x91, 0x47, 0x76, 0xe4, 0x91, 0x1f, 0x1d, 0x54, 0x01, 0x38, 0xf2, 0x23, 0x8f, 0xf4, 0xc8,
+    0xe3, 0x5c, 0x0d, 0x23, 0x15, 0x00, 0x15, 0xde, 0xbc, 0x01, 0x15, 0xde, 0x16, 0x2c, 0x15,
+    0xd0, 0x0f, 0x15, 0x00, 0x15, 0x06, 0x15, 0x06, 0x00, 0x00, 0x28, 0xb5, 0x2f, 0xfd, 0x04,
+    0x68, 0xec, 0x0f, 0x00, 0xb6, 0x1d, 0x4d, 0x1b, 0x60, 0x6d, 0x3a, 0x8c, 0x7a, 0xeb, 0xea,
+    0x56, 0x78, 0x54, 0x33, 0x6b, 0x10, 0x04, 0x7c, 0x64, 0x93, 0xdd, 0xe4, 0x0b, 0x45, 0x11,
+    0x44, 0x91, 0x09, 0x80, 0x0c, 0x51, 0x00, 0x46, 0x00, 0x3f, 0x00, 0xca, 0x9d, 0x8a, 0x1e,
+    0x28, 0x8a, 0x3c, 0x06, 0x33, 0x0b, 0xac, 0x53, 0x0f, 0x64, 0x81, 0x06, 0x66, 0xa6, 0xbc,
+    0x82, 0x16, 0x82, 0xe3, 0x31, 0xb3, 0xe4, 0x6a, 0x59, 0x34, 0x4e, 0x2b, 0x87, 0x89, 0x1e,
+    0x84, 0x99, 0x25, 0x56, 0x0f, 0x82, 0xc0, 0x24, 0xab, 0x0a, 0x62, 0x06, 0x0b, 0x06, 0xf2,
+    0x30, 0xcc, 0x2c, 0x90, 0xea, 0x71, 0x1a, 0x85, 0x99, 0x25, 0xa8, 0x0c, 0xce, 0x73, 0x30,
+    0xb3, 0xe4, 0xd4, 0x12, 0x39, 0x4c, 0xc1, 0xcc, 0xd2, 0x52, 0x0b, 0xa2, 0xe1, 0x2c, 0x66,
+    0x96, 0x02, 0xaf, 0xae, 0xad, 0xac, 0xab, 0xaa, 0xa9, 0xa8, 0xa7, 0x4b, 0x3f, 0x3d, 0x3b,
+    0x39, 0x37, 0x35, 0x33, 0x31, 0x2f, 0x57, 0x3e, 0x3a, 0x2a, 0x8d, 0x8c, 0x8b, 0x49, 0x31,
+    0x51, 0x80, 0x98, 0x0e, 0x95, 0x85, 0xca, 0x9f, 0xe2, 0xa7, 0x18, 0x45, 0xb3, 0x30, 0xb3,
+    0xd4, 0xa7, 0xa2, 0xe8, 0x91, 0xe0, 0x4b, 0x7b, 0x8a, 0x69, 0x1c, 0x68, 0x41, 0x10, 0x02,
+    0xda, 0x58, 0x1a, 0x79, 0x09, 0x4f, 0x2d, 0x4d, 0x81, 0xd1, 0x98, 0x59, 0x77, 0xb7, 0xee,
+    0x13, 0x4f, 0x9d, 0x70, 0xb2, 0x06, 0x00, 0x24, 0x00, 0xd3, 0x25, 0x2b, 0xf1, 0xef, 0xeb,
+    0xe7, 0xe3, 0xdf, 0xaf, 0x7f, 0x77, 0x6f, 0x67, 0x5f, 0x57, 0x4f, 0x47, 0x3f, 0x5f, 0xfe,
+    0xed, 0xdd, 0xcd, 0xbd, 0xad, 0x9d, 0x8d, 0x7d, 0xbd, 0xfa, 0xd9, 0xb9, 0x99, 0x79, 0x59,
+    0x39, 0x19, 0xf9, 0x78, 0xf1, 0xaf, 0x6f, 0x2f, 0xef, 0xae, 0x6e, 0x2e, 0xee, 0xed, 0xda,
+    0xd7, 0xab, 0x9f, 0x9d, 0x9b, 0x99, 0x97, 0x95, 0x93, 0x91, 0x8f, 0x17, 0xff, 0xfa, 0xf6,
+    0xf2, 0xee, 0xea, 0xe6, 0xe2, 0xde, 0xae, 0x7d, 0x75, 0x6d, 0x65, 0x5d, 0x55, 0x4d, 0x45,
+    0x3d, 0x5d, 0xfa, 0xe9, 0xd9, 0xc9, 0xb9, 0xa9, 0x99, 0x89, 0x79, 0xb9, 0xf2, 0xd1, 0xb1,
+    0x91, 0x71, 0x51, 0x31, 0x11, 0xf1, 0x70, 0xfd, 0xf9, 0xf5, 0xf1, 0xed, 0xe9, 0xe5, 0x61,
+    0x80, 0xa1, 0xa8, 0x11, 0x20, 0xe8, 0xec, 0xb1, 0xb1, 0x67, 0xc0, 0x2a, 0x10, 0x11, 0x61,
+    0x1d, 0x20, 0x44, 0x70, 0xac, 0x95, 0x07, 0x9a, 0xd3, 0x85, 0xce, 0xd6, 0xa2, 0x1d, 0xbc,
+    0x08, 0x2d, 0xc9, 0xa8, 0xeb, 0x6b, 0x69, 0x49, 0xf0, 0x9d, 0xa5, 0x19, 0x8d, 0x02, 0x4d,
+    0x96, 0x63, 0xb0, 0xf2, 0x7f, 0x42, 0xeb, 0xd9, 0x58, 0x59, 0x3b, 0x69, 0xe8, 0x0d, 0xe4,
+    0xb8, 0xda, 0xe8, 0x21, 0x6b, 0x16, 0x58, 0x61, 0x2c, 0x8e, 0x18, 0x3e, 0xf2, 0xc3, 0xad,
+    0xc9, 0x0b, 0xf9, 0x4d, 0x42, 0xc4, 0x72, 0x64, 0xe6, 0x29, 0xab, 0xf5, 0x35, 0x5f, 0x44,
+    0x7b, 0xb4, 0x5c, 0xd0, 0x1e, 0x6e, 0x23, 0x0c, 0xd8, 0xd3, 0xbb, 0x32, 0x42, 0x77, 0x13,
+    0x23, 0x48, 0xc8, 0x5b, 0x5e, 0xb5, 0x65, 0x95, 0xf9, 0x58, 0xb8, 0x82, 0xaa, 0xd0, 0xb5,
+    0x02, 0x9e, 0x9b, 0xc5, 0xd4, 0xa2, 0x92, 0xd6, 0x87, 0x55, 0x1b, 0xa3, 0xeb, 0x02, 0x90,
+    0xce, 0x15, 0xd2, 0xcc, 0xae, 0x18, 0x63, 0x86, 0xb0, 0x92, 0xaa, 0x05, 0x56, 0xb6, 0xda,
+    0xc1, 0x0b, 0x51, 0xba, 0x52, 0xec, 0x42, 0x5a, 0xb7, 0x16, 0x32, 0xda, 0x2c, 0x3d, 0x60,
+    0x49, 0x39, 0x5f, 0x5c, 0xc7, 0x97, 0xc4, 0xea, 0x53, 0xa0, 0xaf, 0xfc, 0x26, 0x3d, 0x15,
+    0x02, 0xcc, 0x0d, 0x24, 0x2e, 0xe0, 0x0c, 0x70, 0xbe, 0x1a, 0x7d, 0x57, 0xfd, 0x16, 0x36,
+    0xee, 0x7a, 0xaa, 0x14, 0x07, 0x00, 0x23, 0x84, 0x08, 0xab, 0xaa, 0x69, 0x5f, 0xdf, 0xb5,
+    0xd5, 0x94, 0xc4, 0xbf, 0xaf, 0x9f, 0x8f, 0x7f, 0xbf, 0xfe, 0xdd, 0xbd, 0x9d, 0x7d, 0x5d,
+    0x3d, 0x1d, 0xfd, 0x7c, 0xf9, 0xb7, 0x77, 0x37, 0xf7, 0xb6, 0x76, 0x36, 0x76, 0x67, 0xa8,
+    0x60, 0xf5, 0x90, 0x26, 0xce, 0x29, 0x3d, 0x12, 0x38, 0x02, 0x8c, 0x09, 0xa0, 0x8a, 0x08,
+    0x89, 0x30, 0x44, 0x08, 0x72, 0x4a, 0x49, 0xbc, 0x72, 0x0f, 0x2d, 0xa1, 0x47, 0xdb, 0x96,
+    0x7e, 0x0d, 0xb4, 0xc5, 0x59, 0x12, 0x5b, 0xc8, 0x95, 0xa2, 0x92, 0xb1, 0x1a, 0xa4, 0x64,
+    0xbb, 0x31, 0x43, 0x3a, 0xe9, 0xac, 0x92, 0x2f, 0x96, 0x48, 0xe2, 0xf7, 0x92, 0xca, 0x29,
+    0xdf, 0x25, 0x77, 0x1e, 0xc3, 0x5e, 0xf2, 0x78, 0x4d, 0xd7, 0x2b, 0xeb, 0x25, 0x18, 0x83,
+    0x84, 0x89, 0xbd, 0xfc, 0xcb, 0x84, 0xd1, 0x98, 0x09, 0xeb, 0x05, 0x26, 0x92, 0x99, 0xbd,
+    0x44, 0xc5, 0x80, 0xa8, 0x55, 0x5f, 0x89, 0xc1, 0x52, 0x03, 0xf0, 0xa0, 0x2b, 0x49, 0x4a,
+    0x64, 0x25, 0x46, 0x09, 0x60, 0x51, 0xea, 0xa8, 0x26, 0xb2, 0x44, 0x58, 0x60, 0x53, 0x32,
+    0x57, 0x63, 0x95, 0xcc, 0x6a, 0x45, 0x4b, 0x34, 0x46, 0x18, 0xab, 0x8a, 0x95, 0xd8, 0x18,
+    0x93, 0xbb, 0x44, 0xce, 0x62, 0xac, 0x12, 0x11, 0x28, 0x23, 0xf9, 0xb2, 0x04, 0x8e, 0xe8,
+    0xe0, 0x22, 0x95, 0x08, 0xab, 0x80, 0x53, 0x62, 0x07, 0xc5, 0x42, 0xfe, 0x47, 0x53, 0x0b,
+    0xac, 0x37, 0x54, 0xae, 0x25, 0xd8, 0x6b, 0x50, 0x67, 0xa7, 0xda, 0x74, 0x48, 0xea, 0xf9,
+    0x45, 0xa2, 0xd0, 0xa2, 0xb2, 0x8e, 0x1d, 0x74, 0x05, 0x00, 0x18, 0x00, 0x07, 0x00, 0x5b,
+    0xb8, 0xf0, 0x39, 0x12, 0x38, 0x42, 0xac, 0x08, 0x78, 0x44, 0x11, 0x10, 0x22, 0x6c, 0x31,
+    0xc5, 0x14, 0x21, 0xe2, 0x23, 0xec, 0x01, 0x28, 0x21, 0x21, 0x86, 0x55, 0x22, 0xbf, 0x18,
+    0xb5, 0xc8, 0xf1, 0x92, 0x16, 0x25, 0xd6, 0x11, 0xf0, 0x93, 0x04, 0x3c, 0xfa, 0xba, 0x2a,
+    0xe7, 0xe6, 0xa8, 0x24, 0x86, 0x96, 0xec, 0x42, 0xc8, 0x12, 0xb5, 0x0c, 0x2d, 0xc1, 0x17,
+    0x55, 0x25, 0x49, 0x53, 0x4b, 0x16, 0xc3, 0x74, 0x89, 0x5e, 0x4a, 0x98, 0x38, 0x1a, 0x9b,
+    0xd3, 0xb8, 0x44, 0x18, 0xb7, 0x25, 0xe6, 0x4b, 0x05, 0x48, 0x80, 0x83, 0xae, 0x24, 0x29,
+    0xd1, 0xca, 0x80, 0x12, 0x59, 0x8c, 0xaf, 0xa4, 0xaa, 0x18, 0x4b, 0x36, 0x6b, 0x98, 0x12,
+    0x8a, 0xa5, 0x12, 0xe2, 0x62, 0xa6, 0x25, 0x70, 0xb2, 0x66, 0x92, 0x7d, 0x25, 0x68, 0x8f,
+    0xd4, 0x2e, 0xf9, 0x17, 0x55, 0x25, 0x36, 0x44, 0xef, 0xf2, 0xb2, 0x04, 0x5a, 0x40, 0x7d,
+    0xd5, 0x55, 0x62, 0x63, 0xf9, 0x52, 0x62, 0xad, 0x38, 0x8d, 0x79, 0x25, 0xcf, 0x82, 0x76,
+    0x4b, 0x04, 0x25, 0x53, 0x29, 0xac, 0x44, 0x5e, 0x38, 0x53, 0x62, 0x95, 0xac, 0x4a, 0x58,
+    0xaf, 0x53, 0x20, 0x03, 0x8c, 0x05, 0x00, 0x08, 0x00, 0x5c, 0xe8, 0x80, 0x24, 0x6e, 0x49,
+    0x20, 0x3e, 0x12, 0x38, 0xc1, 0x2b, 0x09, 0x80, 0x04, 0x21, 0x22, 0x9c, 0x08, 0x88, 0x92,
+    0x8c, 0x09, 0x24, 0x3e, 0x49, 0x1f, 0x02, 0x97, 0x38, 0xaa, 0x97, 0x57, 0x4f, 0x25, 0xe4,
+    0x41, 0x4a, 0x60, 0x65, 0xb9, 0x62, 0x43, 0x34, 0x2c, 0xe9, 0xf7, 0x12, 0x76, 0x19, 0x5d,
+    0xa2, 0xd6, 0xfe, 0x12, 0xf3, 0x7a, 0x67, 0xc9, 0xb5, 0x78, 0x89, 0x62, 0x47, 0x98, 0xcc,
+    0x8b, 0x8b, 0x4c, 0x94, 0x16, 0x0a, 0x26, 0x5c, 0x4c, 0xb6, 0x1f, 0x97, 0x04, 0x83, 0xb7,
+    0x84, 0xbe, 0x7c, 0x74, 0xe5, 0x12, 0x47, 0x70, 0xca, 0x95, 0x12, 0xed, 0xa1, 0x1c, 0x25,
+    0x25, 0x42, 0x57, 0xa2, 0x13, 0xa7, 0x0b, 0x4b, 0x08, 0xba, 0x7f, 0x4b, 0x09, 0xd1, 0xa3,
+    0x50, 0x89, 0x57, 0x2d, 0x2d, 0xf1, 0xb1, 0xbd, 0x6b, 0xfd, 0x95, 0x48, 0x36, 0xed, 0x92,
+    0x88, 0xc1, 0x91, 0x8b, 0x50, 0x09, 0xb3, 0x25, 0xdb, 0x2b, 0x8f, 0x12, 0x92, 0x25, 0x9d,
+    0xc4, 0x5d, 0x3d, 0x90, 0xe1, 0x94, 0x18, 0xd6, 0xd7, 0x2d, 0x8c, 0x49, 0x54, 0x35, 0x93,
+    0x92, 0x7a, 0x01, 0x3c, 0x09, 0x54, 0x5e, 0x94, 0x08, 0x63, 0x25, 0xf9, 0xc4, 0x12, 0xf8,
+    0x32, 0xc9, 0xab, 0xc8, 0x7c, 0x05, 0x00, 0x10, 0x0a, 0x00, 0x58, 0xf8, 0x12, 0x60, 0x10,
+    0x70, 0x90, 0x3a, 0x02, 0x9c, 0x61, 0x08, 0x20, 0xc2, 0x43, 0x14, 0x74, 0xca, 0x18, 0xe1,
+    0x23, 0xee, 0x01, 0x81, 0x36, 0x50, 0x42, 0x8f, 0x93, 0x84, 0x05, 0x07, 0xea, 0x99, 0x2b,
+    0x45, 0x25, 0x3c, 0x6e, 0x89, 0x57, 0x99, 0x2c, 0x01, 0x15, 0xda, 0x12, 0x25, 0xc2, 0x24,
+    0x62, 0xcd, 0x98, 0xf8, 0x75, 0x3c, 0x93, 0x4d, 0x23, 0xc4, 0x84, 0x8f, 0x29, 0x96, 0xf3,
+    0x92, 0x61, 0xd1, 0xe3, 0x92, 0x5e, 0x12, 0x0b, 0x8d, 0xcc, 0x96, 0x50, 0x01, 0x5d, 0xb0,
+    0x54, 0x82, 0x95, 0x93, 0x12, 0xb3, 0x9e, 0x2c, 0x91, 0x6a, 0xd2, 0x92, 0x9e, 0x85, 0x54,
+    0x09, 0xb8, 0x60, 0x2b, 0xb1, 0xd5, 0xa5, 0x4b, 0x02, 0x16, 0x10, 0x26, 0x28, 0x66, 0xe7,
+    0x2d, 0xd1, 0x25, 0x22, 0xdb, 0x63, 0x62, 0xc5, 0x4e, 0xe6, 0xca, 0x5b, 0x22, 0xb5, 0x96,
+    0xff, 0x3a, 0x56, 0x62, 0x64, 0xdd, 0xab, 0xe4, 0xac, 0x30, 0x91, 0x3d, 0x4b, 0x24, 0xeb,
+    0xd0, 0x16, 0x25, 0x25, 0xae, 0x1a, 0x61, 0xc9, 0x00, 0xa3, 0x9c, 0x4a, 0xda, 0x89, 0xd6,
+    0x95, 0x94, 0x89, 0xde, 0x25, 0x32, 0x97, 0xfa, 0xaa, 0x24, 0xf3, 0xd0, 0xcc, 0x12, 0x23,
+    0x99, 0x01, 0x35, 0x05, 0x00, 0x20, 0x6f, 0x2d, 0x09, 0x00, 0x51, 0xf8, 0x12, 0x38, 0xc2,
+    0xe9, 0x08, 0x80, 0x8e, 0x21, 0x30, 0xc2, 0x91, 0xc0, 0x18, 0x8a, 0x98, 0x31, 0xe2, 0x19,
+    0x41, 0x7b, 0x2d, 0x59, 0x56, 0x98, 0x2c, 0x61, 0x3b, 0x7a, 0x5b, 0x12, 0x0f, 0x4c, 0x34,
+    0x36, 0xbd, 0x98, 0xb0, 0x84, 0x9f, 0x89, 0xdc, 0x74, 0xb2, 0x98, 0xd0, 0x04, 0x4b, 0x1f,
+    0x57, 0xc2, 0x4b, 0x10, 0x46, 0xbb, 0xc4, 0xbd, 0x9e, 0xf9, 0xea, 0x8b, 0xaa, 0x7b, 0xac,
+    0x46, 0x25, 0xec, 0x72, 0xa6, 0x44, 0x54, 0x6f, 0x54, 0x52, 0x2c, 0xca, 0x93, 0xd0, 0xc5,
+    0x45, 0x89, 0xaf, 0x7e, 0x2b, 0x39, 0x2c, 0x96, 0x96, 0x90, 0x98, 0x9c, 0x6e, 0x91, 0x95,
+    0x88, 0xac, 0x76, 0x89, 0x8f, 0xcd, 0xac, 0xab, 0x54, 0x89, 0x6f, 0x7d, 0xf7, 0xd5, 0x47,
+    0x89, 0x02, 0x71, 0x92, 0xf8, 0x0d, 0xbd, 0x26, 0x69, 0x2a, 0xca, 0x53, 0x12, 0x44, 0x9e,
+    0xd5, 0x69, 0x92, 0xb1, 0x39, 0xe5, 0x49, 0x58, 0xdd, 0x83, 0x2a, 0x81, 0xf4, 0xb8, 0xa3,
+    0x44, 0x57, 0x63, 0x4a, 0x14, 0xb6, 0x67, 0xc9, 0x7e, 0x61, 0x29, 0x7e, 0x95, 0xd8, 0xd6,
+    0xe4, 0x14, 0xc2, 0x32, 0x09, 0x29, 0x28, 0xd8, 0xe2, 0xc5, 0x15, 0x02, 0x19, 0x3c, 0x48,
+    0x06, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x15, 0x04, 0x00, 0x15, 0x02, 0x25, 0x00, 0x18,
+    0x01, 0x61, 0x00, 0x15, 0x0c, 0x25, 0x00, 0x18, 0x01, 0x62, 0x25, 0x00, 0x00, 0x16, 0xd0,
+    0x0f, 0x19, 0x1c, 0x19, 0x2c, 0x26, 0x08, 0x1c, 0x15, 0x02, 0x19, 0x25, 0x00, 0x06, 0x19,
+    0x18, 0x01, 0x61, 0x15, 0x0c, 0x16, 0xd0, 0x0f, 0x16, 0xe8, 0x3e, 0x16, 0xda, 0x0f, 0x26,
+    0x08, 0x00, 0x00, 0x26, 0xe2, 0x0f, 0x1c, 0x15, 0x0c, 0x19, 0x25, 0x00, 0x06, 0x19, 0x18,
+    0x01, 0x62, 0x15, 0x0c, 0x16, 0xd0, 0x0f, 0x16, 0x88, 0xbd, 0x01, 0x16, 0x88, 0x17, 0x26,
+    0xe2, 0x0f, 0x00, 0x00, 0x16, 0xf0, 0xfb, 0x01, 0x16, 0xd0, 0x0f, 0x00, 0x00, 0x6c, 0x00,
+    0x00, 0x00, 0x50, 0x41, 0x52, 0x31};
+  constexpr int num_rows = 1000;
+
+  cudf_io::parquet_reader_options read_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{reinterpret_cast<const char*>(zstd_parquet), sizeof(zstd_parquet)});
+  auto result = cudf_io::read_parquet(read_opts);
+  EXPECT_EQ(result.tbl->view().num_columns(), 2);
+
+  auto a_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return 3 * i - 1000 + (i * i) % 5; });
+  column_wrapper<int32_t> a(a_data, a_data + num_rows);
+  cudf::test::expect_columns_equal(result.tbl->view().column(0), a);
+
+  std::vector<std::string> const words{"alpha",
+                                       "bravo",
+                                       "charlie",
+                                       "delta",
+                                       "echo",
+                                       "foxtrot",
+                                       "golf",
+                                       "hotel",
+                                       "india",
+                                       "juliett",
+                                       "kilo",
+                                       "lima",
+                                       "mike",
+                                       "november",
+                                       "oscar",
+                                       "papa"};
+  std::vector<std::string> b_data;
+  for (int i = 0; i < num_rows; ++i) {
+    b_data.push_back(words[(static_cast<uint64_t>(i) * 2654435761u >> 7) % 16] + "-" +
+                     std::to_string(i % 97));
+  }
+  cudf::test::strings_column_wrapper b(b_data.begin(), b_data.end());
+  cudf::test::expect_columns_equal(result.tbl->view().column(1), b);
+}
+
+TEST_F(ParquetReaderTest, IOStatistics)
+{
+  constexpr auto num_rows = 100000;
+
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<int32_t> col(values, values + num_rows);
+  auto const expected = table_view{{col}};
+
+  cudf_io::io_statistics write_stats{};
+  auto filepath = temp_env->get_temp_filepath("IOStatistics.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .compression(cudf_io::compression_type::SNAPPY)
+      .io_statistics(&write_stats);
+  cudf_io::write_parquet(out_opts);
+
+  EXPECT_EQ(write_stats[cudf_io::io_phase::ENCODE].input_bytes, num_rows * sizeof(int32_t));
+  EXPECT_GT(write_stats[cudf_io::io_phase::ENCODE].time_ns, 0);
+  EXPECT_GT(write_stats[cudf_io::io_phase::STATISTICS].time_ns, 0);
+  EXPECT_GT(write_stats[cudf_io::io_phase::WRITE].output_bytes, 0u);
+  EXPECT_GT(write_stats.compression_ratio(), 1.0);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).io_statistics(true);
+  auto const result = cudf_io::read_parquet(in_opts);
+  cudf::test::expect_tables_equal(result.tbl->view(), expected);
+
+  ASSERT_TRUE(result.statistics.has_value());
+  auto const& read_stats = *result.statistics;
+  EXPECT_EQ(read_stats[cudf_io::io_phase::READ].input_bytes,
+            write_stats[cudf_io::io_phase::WRITE].output_bytes);
+  EXPECT_EQ(read_stats[cudf_io::io_phase::DECOMPRESS].input_bytes,
+            write_stats[cudf_io::io_phase::COMPRESS].output_bytes);
+  EXPECT_GE(read_stats[cudf_io::io_phase::DECODE].output_bytes, num_rows * sizeof(int32_t));
+  EXPECT_GT(read_stats[cudf_io::io_phase::DECODE].time_ns, 0);
+  EXPECT_GT(read_stats.compression_ratio(), 1.0);
+  EXPECT_GE(read_stats.total_time_ns(), read_stats[cudf_io::io_phase::READ].time_ns);
+
+  // not collected unless requested
+  auto const plain_read = cudf_io::read_parquet(
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}));
+  EXPECT_FALSE(plain_read.statistics.has_value());
+}
+
+TEST_F(ParquetReaderTest, MultipleSourcesPipelined)
+{
+  // each batch of the read pipeline holds the row groups of a single source
+  srand(31337);
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<std::string> filepaths;
+  for (int f = 0; f < 3; ++f) {
+    tables.push_back(create_random_fixed_table<int>(4, 50, true));
+    tables.push_back(create_random_fixed_table<int>(4, 30, true));
+    filepaths.push_back(
+      temp_env->get_temp_filepath("MultipleSourcesPipelined" + std::to_string(f) + ".parquet"));
+    cudf_io::chunked_parquet_writer_options args =
+      cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepaths.back()})
+        .compression(f == 1 ? cudf_io::compression_type::NONE
+                            : cudf_io::compression_type::SNAPPY);
+    cudf_io::parquet_chunked_writer(args).write(*tables[2 * f]).write(*tables[2 * f + 1]);
+  }
+  std::vector<table_view> views;
+  for (auto const& table : tables) {
+    views.push_back(table->view());
+  }
+  auto const expected = cudf::concatenate(views);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepaths});
+  auto const result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+  // rows from the second row group of the first source to the first one of the last source
+  read_opts.set_skip_rows(60);
+  read_opts.set_num_rows(120);
+  auto const bounded = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*bounded.tbl, cudf::slice(expected->view(), {60, 180})[0]);
+}
+
+/**
+ * @brief Host buffer source that doesn't support concurrent reads, and records whether it was ever
+ * read from multiple threads at once.
+ */
+class NonReentrantSource : public cudf_io::datasource {
+ public:
+  explicit NonReentrantSource(std::vector<char>& data) : data_(data) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    read_scope scope(*this);
+    size = std::min(size, data_.size() - offset);
+    return std::make_unique<non_owning_buffer>(reinterpret_cast<uint8_t*>(data_.data()) + offset,
+                                               size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    read_scope scope(*this);
+    auto const read_size = std::min(size, data_.size() - offset);
+    std::memcpy(dst, data_.data() + offset, read_size);
+    return read_size;
+  }
+
+  size_t size() const override { return data_.size(); }
+
+  bool was_reentered() const { return reentered_; }
+
+ private:
+  struct read_scope {
+    explicit read_scope(NonReentrantSource& source) : source(source)
+    {
+      if (source.readers_.fetch_add(1) != 0) { source.reentered_ = true; }
+      // widens the window in which a concurrent read would be detected
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ~read_scope() { source.readers_.fetch_sub(1); }
+    NonReentrantSource& source;
+  };
+
+  std::vector<char>& data_;
+  std::atomic<int> readers_{0};
+  std::atomic<bool> reentered_{false};
+};
+
+TEST_F(ParquetReaderTest, NonConcurrentSourcePipelined)
+{
+  // 10 row groups of 1M rows and 8MB each, read in two pipeline batches of at least 64MB
+  constexpr cudf::size_type num_rows = 10'000'000;
+  auto values = thrust::make_counting_iterator<int64_t>(0);
+  column_wrapper<int64_t> col(values, values + num_rows);
+  auto const expected = table_view{{col}};
+
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+      .compression(cudf_io::compression_type::NONE);
+  cudf_io::write_parquet(out_opts);
+
+  NonReentrantSource source(out_buffer);
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{&source});
+  auto const result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  EXPECT_FALSE(source.was_reentered());
+}
+
+TEST_F(ParquetReaderTest, DictionaryStrings)
+{
+  // the row groups written by each call have their own dictionaries, sharing some entries
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  cudf::test::strings_column_wrapper strings1({"b", "a", "b", "c", "a", "b", "c", "a"}, validity);
+  cudf::test::strings_column_wrapper strings2({"d", "b", "d", "d", "b", "d"}, validity);
+  column_wrapper<int32_t> values1{1, 2, 3, 4, 5, 6, 7, 8};
+  column_wrapper<int32_t> values2{9, 10, 11, 12, 13, 14};
+  auto const table1     = table_view{{strings1, values1}};
+  auto const table2     = table_view{{strings2, values2}};
+  auto const full_table = cudf::concatenate(std::vector<table_view>({table1, table2}));
+
+  auto filepath = temp_env->get_temp_filepath("DictionaryStrings.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(table1).write(table2);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .output_dictionary_strings(true);
+  auto result = cudf_io::read_parquet(read_opts);
+
+  auto const dictionary = result.tbl->get_column(0).view();
+  ASSERT_EQ(dictionary.type().id(), cudf::type_id::DICTIONARY32);
+  cudf::dictionary_column_view const dictionary_view(dictionary);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(dictionary_view.keys(),
+                                 cudf::test::strings_column_wrapper{"a", "b", "c", "d"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(dictionary_view),
+                                 full_table->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1), full_table->get_column(1));
+
+  // a subset of the rows
+  read_opts.set_skip_rows(6);
+  read_opts.set_num_rows(5);
+  result = cudf_io::read_parquet(read_opts);
+  auto const expected = cudf::slice(full_table->get_column(0), {6, 11});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *cudf::dictionary::decode(cudf::dictionary_column_view(result.tbl->get_column(0))),
+    expected[0]);
+
+  // strings are returned as is by default
+  result = cudf_io::read_parquet(
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), full_table->view());
+}
+
+TEST_F(ParquetReaderTest, MetadataCache)
+{
+  column_wrapper<int32_t> values1{1, 2, 3, 4, 5};
+  column_wrapper<int32_t> values2{6, 7, 8};
+  auto const table1 = table_view{{values1}};
+  auto const table2 = table_view{{values2}};
+
+  cudf_io::table_input_metadata expected_metadata(table1);
+  expected_metadata.column_metadata[0].set_name("values");
+
+  auto filepath = temp_env->get_temp_filepath("MetadataCache.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath})
+      .metadata(&expected_metadata);
+  cudf_io::parquet_chunked_writer(args).write(table1).write(table2);
+
+  auto cache = std::make_shared<cudf_io::metadata_cache>(4);
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).metadata_cache(cache);
+
+  // the second read finds the footer in the cache
+  auto result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0),
+                                 column_wrapper<int32_t>{1, 2, 3, 4, 5, 6, 7, 8});
+  EXPECT_EQ(cache->misses(), 1u);
+  EXPECT_EQ(cache->hits(), 0u);
+  read_opts.set_row_groups({{1}});
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), values2);
+  EXPECT_EQ(cache->misses(), 1u);
+  EXPECT_EQ(cache->hits(), 1u);
+
+  // the metadata can be read on its own, from the same cache
+  auto const metadata = cudf_io::read_parquet_metadata(cudf_io::source_info{filepath}, cache);
+  EXPECT_EQ(metadata.num_rows, 8);
+  EXPECT_EQ(metadata.row_group_num_rows, (std::vector<cudf::size_type>{5, 3}));
+  EXPECT_EQ(metadata.column_names, std::vector<std::string>{"values"});
+  EXPECT_EQ(cache->hits(), 2u);
+  EXPECT_EQ(cache->size(), 1u);
+
+  // a rewritten file is parsed again
+  cudf_io::parquet_chunked_writer(args).write(table2);
+  read_opts.set_row_groups({});
+  result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), values2);
+  EXPECT_EQ(cache->misses(), 2u);
+
+  cache->clear();
+  EXPECT_EQ(cache->size(), 0u);
+}
+
+TEST_F(ParquetWriterTest, PartitionedDataset)
+{
+  cudf::test::strings_column_wrapper regions{"us", "eu", "us", "eu", "us", "us", "eu"};
+  column_wrapper<int32_t> years{{2020, 2020, 2021, 2020, 2020, 2020, 0},
+                                {true, true, true, true, true, true, false}};
+  column_wrapper<int32_t> values{0, 1, 2, 3, 4, 5, 6};
+  auto const table = table_view{{regions, years, values}};
+
+  cudf_io::table_input_metadata metadata(table);
+  metadata.column_metadata[0].set_name("region");
+  metadata.column_metadata[1].set_name("year");
+  metadata.column_metadata[2].set_name("value");
+
+  auto const base_path = temp_env->get_temp_filepath("PartitionedDataset");
+  cudf_io::parquet_dataset_writer_options options =
+    cudf_io::parquet_dataset_writer_options::builder(base_path, table, {0, 1})
+      .metadata(&metadata)
+      .max_rows_per_file(2);
+  auto const paths = cudf_io::write_parquet_dataset(options);
+
+  // the partitions are sorted, with the null values last, and split into files of 2 rows
+  std::vector<std::string> const expected_paths{
+    "region=eu/year=2020/part-00000.parquet",
+    "region=eu/year=__HIVE_DEFAULT_PARTITION__/part-00001.parquet",
+    "region=us/year=2020/part-00002.parquet",
+    "region=us/year=2020/part-00003.parquet",
+    "region=us/year=2021/part-00004.parquet"};
+  std::vector<column_wrapper<int32_t>> expected_values;
+  expected_values.emplace_back(column_wrapper<int32_t>{1, 3});
+  expected_values.emplace_back(column_wrapper<int32_t>{6});
+  expected_values.emplace_back(column_wrapper<int32_t>{0, 4});
+  expected_values.emplace_back(column_wrapper<int32_t>{5});
+  expected_values.emplace_back(column_wrapper<int32_t>{2});
+  ASSERT_EQ(paths, expected_paths);
+
+  for (size_t i = 0; i < paths.size(); ++i) {
+    auto const result = cudf_io::read_parquet(
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{base_path + "/" + paths[i]}));
+    ASSERT_EQ(result.tbl->num_columns(), 1);
+    EXPECT_EQ(result.metadata.column_names[0], "value");
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), expected_values[i]);
+  }
+
+  // a partition column must be given, and some columns must be written
+  EXPECT_THROW(cudf_io::write_parquet_dataset(
+                 cudf_io::parquet_dataset_writer_options::builder(base_path, table, {})),
+               cudf::logic_error);
+  EXPECT_THROW(cudf_io::write_parquet_dataset(
+                 cudf_io::parquet_dataset_writer_options::builder(base_path, table, {0, 1, 2})),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/io/statistics.hpp>
+#include <cudf/table/table_view.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct StatisticsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StatisticsTest, Integers)
+{
+  fixed_width_column_wrapper<int32_t> col{{1, 5, -2, 7, 0, 3, 4}, {1, 1, 1, 1, 0, 1, 1}};
+  auto const stats = cudf::io::compute_statistics(cudf::table_view{{col}}, 3);
+  ASSERT_EQ(stats.size(), 1u);
+
+  auto const& chunks = stats[0].chunks->view();
+  ASSERT_EQ(chunks.num_rows(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(chunks.column(0), fixed_width_column_wrapper<int32_t>{0, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(chunks.column(1), fixed_width_column_wrapper<int32_t>{3, 2, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(chunks.column(2), fixed_width_column_wrapper<int32_t>{-2, 3, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(chunks.column(3), fixed_width_column_wrapper<int32_t>{5, 7, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(chunks.column(4), fixed_width_column_wrapper<int64_t>{4, 10, 4});
+
+  auto const& total = stats[0].total->view();
+  ASSERT_EQ(total.num_rows(), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(total.column(0), fixed_width_column_wrapper<int32_t>{1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(total.column(1), fixed_width_column_wrapper<int32_t>{6});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(total.column(2), fixed_width_column_wrapper<int32_t>{-2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(total.column(3), fixed_width_column_wrapper<int32_t>{7});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(total.column(4), fixed_width_column_wrapper<int64_t>{18});
+}
+
+TEST_F(StatisticsTest, NullChunksAndStrings)
+{
+  fixed_width_column_wrapper<double> col0{{1.5, -2.5, 0, 0}, {1, 1, 0, 0}};
+  strings_column_wrapper col1{{"pear", "", "apple", "fig"}, {1, 0, 1, 1}};
+  auto const stats = cudf::io::compute_statistics(cudf::table_view{{col0, col1}}, 2);
+  ASSERT_EQ(stats.size(), 2u);
+
+  // The second chunk of the first column has no value, so it has no minimum, maximum or sum
+  auto const& doubles = stats[0].chunks->view();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(doubles.column(0), fixed_width_column_wrapper<int32_t>{0, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(doubles.column(2),
+                                 fixed_width_column_wrapper<double>{{-2.5, 0}, {1, 0}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(doubles.column(3),
+                                 fixed_width_column_wrapper<double>{{1.5, 0}, {1, 0}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(doubles.column(4),
+                                 fixed_width_column_wrapper<double>{{-1.0, 0}, {1, 0}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats[0].total->get_column(2),
+                                 fixed_width_column_wrapper<double>{-2.5});
+
+  auto const& strings = stats[1].chunks->view();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings.column(2), strings_column_wrapper{"pear", "apple"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings.column(3), strings_column_wrapper{"pear", "fig"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings.column(4), fixed_width_column_wrapper<int64_t>{4, 8});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats[1].total->get_column(2), strings_column_wrapper{"apple"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(stats[1].total->get_column(3), strings_column_wrapper{"pear"});
+}
+
+TEST_F(StatisticsTest, InvalidArguments)
+{
+  fixed_width_column_wrapper<uint32_t> col0{1, 2, 3};
+  EXPECT_THROW(cudf::io::compute_statistics(cudf::table_view{{col0}}), cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t> col1{1, 2, 3};
+  EXPECT_THROW(cudf::io::compute_statistics(cudf::table_view{{col1}}, 0), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
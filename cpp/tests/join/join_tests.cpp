@@ -17,8 +17,11 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/dictionary/encode.hpp>
+#include <cudf/hashing.hpp>
 #include <cudf/join.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/sorting.hpp>
@@ -33,6 +36,8 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 #include <limits>
 
 template <typename T>
@@ -806,6 +811,29 @@ TEST_F(JoinTest, InnerJoinWithStructsAndNulls)
 }
 
 // // Test to check join behaviour when join keys are null.
+TEST_F(JoinTest, InnerJoinWithLists)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW col0_0{{1, 2}, {3}, LCW{}, {1, 2}, {4, 5}};
+  column_wrapper<int32_t> col0_1{{0, 1, 2, 3, 4}};
+  LCW col1_0{{1, 2}, LCW{}, {3, 4}, {4, 5}};
+  column_wrapper<int32_t> col1_1{{10, 11, 12, 13}};
+
+  auto const t0 = cudf::table_view{{col0_0, col0_1}};
+  auto const t1 = cudf::table_view{{col1_0, col1_1}};
+
+  auto result        = cudf::inner_join(t0, t1, {0}, {0});
+  auto sorted_result = cudf::sort_by_key(result->view(), result->view().select({1}));
+
+  LCW col_gold_0{{1, 2}, LCW{}, {1, 2}, {4, 5}};
+  column_wrapper<int32_t> col_gold_1{{0, 2, 3, 4}};
+  LCW col_gold_2{{1, 2}, LCW{}, {1, 2}, {4, 5}};
+  column_wrapper<int32_t> col_gold_3{{10, 11, 10, 13}};
+  auto const gold = cudf::table_view{{col_gold_0, col_gold_1, col_gold_2, col_gold_3}};
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(gold, *sorted_result);
+}
+
 TEST_F(JoinTest, InnerJoinOnNulls)
 {
   // clang-format off
@@ -1339,6 +1367,597 @@ TEST_F(JoinTest, HashJoinSequentialProbes)
   }
 }
 
+TEST_F(JoinTest, HashJoinPackedBuildSide)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3}}.release());
+  cols1.emplace_back(strcol_wrapper{{"s1", "s0", "s1", "s2", "s1"}}.release());
+  Table t1(std::move(cols1));
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 2}}.release());
+  cols0.emplace_back(strcol_wrapper({"s1", "s1", "s0", "s4", "s0"}).release());
+  Table t0(std::move(cols0));
+
+  auto sorted_indices = [](auto const& result) {
+    auto result_table =
+      cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.first->size()),
+                                          result.first->data()},
+                        cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.second->size()),
+                                          result.second->data()}});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+
+  cudf::hash_join hash_join(t1, cudf::null_equality::EQUAL);
+  auto const expected      = sorted_indices(hash_join.inner_join(t0));
+  auto const expected_full = sorted_indices(hash_join.full_join(t0));
+
+  // The serialized hash join doesn't refer to the original build table
+  auto packed = hash_join.pack();
+  t1.release();
+  cudf::hash_join unpacked(packed);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *sorted_indices(unpacked.inner_join(t0)));
+
+  // The metadata and device data can also be given separately, e.g. when shared through IPC
+  cudf::hash_join from_pointers(packed.metadata_->data(),
+                                static_cast<uint8_t const*>(packed.gpu_data->data()));
+  auto moved = std::move(from_pointers);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *sorted_indices(moved.inner_join(t0)));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected_full, *sorted_indices(moved.full_join(t0)));
+
+  std::vector<uint8_t> not_a_hash_join(64, 0);
+  EXPECT_THROW(cudf::hash_join(not_a_hash_join.data(), nullptr), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinPackedBloomFilter)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3}}.release());
+  cols1.emplace_back(strcol_wrapper{{"s1", "s0", "s1", "s2", "s1"}}.release());
+  Table t1(std::move(cols1));
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 2}}.release());
+  cols0.emplace_back(strcol_wrapper({"s1", "s1", "s0", "s4", "s0"}).release());
+  Table t0(std::move(cols0));
+
+  auto sorted_indices = [](auto const& result) {
+    auto result_table =
+      cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.first->size()),
+                                          result.first->data()},
+                        cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.second->size()),
+                                          result.second->data()}});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+  auto host_metadata = [](cudf::packed_columns const& packed) {
+    return std::vector<uint8_t>(packed.metadata_->data(),
+                                packed.metadata_->data() + packed.metadata_->size());
+  };
+  // The filter words end the device data, and a filter holds at least one 32-byte block
+  auto host_filter_tail = [](cudf::packed_columns const& packed) {
+    std::vector<uint8_t> tail(32);
+    CUDA_TRY(cudaMemcpy(tail.data(),
+                        static_cast<uint8_t const*>(packed.gpu_data->data()) +
+                          packed.gpu_data->size() - tail.size(),
+                        tail.size(),
+                        cudaMemcpyDefault));
+    return tail;
+  };
+
+  cudf::hash_join unfiltered(t1, cudf::null_equality::EQUAL);
+  cudf::hash_join filtered(t1, cudf::null_equality::EQUAL, cudf::hash_join_filter::BLOOM_FILTER);
+  auto const expected      = sorted_indices(filtered.inner_join(t0));
+  auto const expected_left = sorted_indices(filtered.left_join(t0));
+
+  // The filter is serialized after the hash table
+  auto packed = filtered.pack();
+  EXPECT_GT(packed.gpu_data->size(), unfiltered.pack().gpu_data->size());
+  t1.release();
+
+  cudf::hash_join unpacked(packed);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *sorted_indices(unpacked.inner_join(t0)));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected_left, *sorted_indices(unpacked.left_join(t0)));
+
+  // Packing the deserialized hash join again reproduces the same filter words
+  auto repacked = unpacked.pack();
+  EXPECT_EQ(host_metadata(packed), host_metadata(repacked));
+  EXPECT_EQ(packed.gpu_data->size(), repacked.gpu_data->size());
+  EXPECT_EQ(host_filter_tail(packed), host_filter_tail(repacked));
+  EXPECT_NE(host_filter_tail(packed), std::vector<uint8_t>(32, 0));
+}
+
+TEST_F(JoinTest, HashJoinPrecomputedRowHashes)
+{
+  column_wrapper<int32_t> build_ints({2, 2, 0, 4, 3, 5}, {1, 1, 1, 1, 0, 1});
+  strcol_wrapper build_strings{{"s1", "s0", "s1", "s2", "s1", "s5"}};
+  auto const build = cudf::table_view({build_ints, build_strings});
+
+  column_wrapper<int32_t> probe_ints({3, 1, 2, 0, 2, 3}, {0, 1, 1, 1, 1, 1});
+  strcol_wrapper probe_strings({"s1", "s1", "s0", "s4", "s0", "s1"});
+  auto const probe = cudf::table_view({probe_ints, probe_strings});
+
+  auto sorted_indices = [](auto const& result) {
+    auto result_table =
+      cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.first->size()),
+                                          result.first->data()},
+                        cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.second->size()),
+                                          result.second->data()}});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+
+  // The murmur3 hash values of the rows match the ones the hash join computes, so the build and
+  // the probe can each use precomputed or computed hash values
+  auto const build_hashes = cudf::hash(build);
+  auto const probe_hashes = cudf::hash(probe);
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+  cudf::hash_join hashed_join(build, build_hashes->view(), cudf::null_equality::EQUAL);
+  for (auto const* join : {&hash_join, &hashed_join}) {
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_indices(hash_join.inner_join(probe)),
+                                       *sorted_indices(join->inner_join(probe, *probe_hashes)));
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_indices(hash_join.left_join(probe)),
+                                       *sorted_indices(join->left_join(probe, *probe_hashes)));
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_indices(hash_join.full_join(probe)),
+                                       *sorted_indices(join->full_join(probe, *probe_hashes)));
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_indices(hash_join.inner_join(probe)),
+                                     *sorted_indices(hashed_join.inner_join(probe)));
+
+  column_wrapper<int64_t> wrong_type{{0, 1, 2, 3, 4, 5}};
+  column_wrapper<int32_t> wrong_size{{0, 1, 2}};
+  EXPECT_THROW(cudf::hash_join(build, wrong_type, cudf::null_equality::EQUAL), cudf::logic_error);
+  EXPECT_THROW(cudf::hash_join(build, wrong_size, cudf::null_equality::EQUAL), cudf::logic_error);
+  EXPECT_THROW(hash_join.inner_join(probe, wrong_size), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinChunkedInnerJoin)
+{
+  column_wrapper<int32_t> build_keys{{1, 1, 1, 2, 2, 3}};
+  column_wrapper<int32_t> probe_keys{{1, 2, 3, 4, 1}};
+  auto const build = cudf::table_view({build_keys});
+  auto const probe = cudf::table_view({probe_keys});
+
+  auto as_column = [](auto const& indices) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(indices->size()),
+                             indices->data()};
+  };
+  auto sorted_indices = [](cudf::column_view const& left, cudf::column_view const& right) {
+    auto const result_table = cudf::table_view({left, right});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+  auto const result   = hash_join.inner_join(probe);
+  auto const expected = sorted_indices(as_column(result.first), as_column(result.second));
+
+  // The probe rows output 3, 2, 1, 0 and 3 rows, and a chunk keeps all the rows of a probe row
+  std::vector<std::pair<std::size_t, std::vector<std::size_t>>> const chunk_sizes{
+    {1, {3, 2, 1, 3}}, {2, {3, 2, 1, 3}}, {3, {3, 3, 3}}, {6, {6, 3}}, {100, {9}}};
+  for (auto const& [max_rows, expected_sizes] : chunk_sizes) {
+    auto chunks = hash_join.inner_join_chunked(probe, max_rows);
+    std::vector<std::pair<std::unique_ptr<rmm::device_uvector<cudf::size_type>>,
+                          std::unique_ptr<rmm::device_uvector<cudf::size_type>>>>
+      results;
+    std::vector<std::size_t> sizes;
+    std::vector<cudf::column_view> left_indices;
+    std::vector<cudf::column_view> right_indices;
+    while (chunks.has_next()) {
+      results.push_back(chunks.next());
+      sizes.push_back(results.back().first->size());
+      left_indices.push_back(as_column(results.back().first));
+      right_indices.push_back(as_column(results.back().second));
+    }
+    EXPECT_EQ(sizes, expected_sizes);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected,
+                                       *sorted_indices(cudf::concatenate(left_indices)->view(),
+                                                       cudf::concatenate(right_indices)->view()));
+    EXPECT_THROW(chunks.next(), cudf::logic_error);
+  }
+
+  column_wrapper<int32_t> unmatched_keys{{5, 6}};
+  EXPECT_FALSE(hash_join.inner_join_chunked(cudf::table_view({unmatched_keys}), 1).has_next());
+  EXPECT_THROW(hash_join.inner_join_chunked(probe, 0), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinExactSizes)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3, 5}}.release());
+  cols1.emplace_back(strcol_wrapper{{"s1", "s0", "s1", "s2", "s1", "s5"}}.release());
+  Table t1(std::move(cols1));
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 2, 3}}.release());
+  cols0.emplace_back(strcol_wrapper({"s1", "s1", "s0", "s4", "s0", "s1"}).release());
+  Table t0(std::move(cols0));
+
+  auto sorted_indices = [](cudf::column_view const& left, cudf::column_view const& right) {
+    auto const result_table = cudf::table_view({left, right});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+  auto as_column = [](auto const& indices, std::size_t size) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(size),
+                             indices.data()};
+  };
+
+  using span = cudf::device_span<cudf::size_type>;
+  cudf::hash_join hash_join(t1, cudf::null_equality::EQUAL);
+  auto check_join = [&](auto const& result, std::size_t size, auto join_to_buffers) {
+    EXPECT_EQ(result.first->size(), size);
+    auto const expected = sorted_indices(as_column(*result.first, size),
+                                         as_column(*result.second, size));
+
+    // Buffers of the exact size are filled without any retry
+    rmm::device_uvector<cudf::size_type> left_indices(size, rmm::cuda_stream_default);
+    rmm::device_uvector<cudf::size_type> right_indices(size, rmm::cuda_stream_default);
+    EXPECT_EQ(join_to_buffers(left_indices, right_indices), size);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+      *expected,
+      *sorted_indices(as_column(left_indices, size), as_column(right_indices, size)));
+
+    auto const too_small = span(left_indices).first(size - 1);
+    EXPECT_THROW(join_to_buffers(too_small, too_small), cudf::logic_error);
+  };
+
+  auto const inner_size = hash_join.inner_join_size(t0);
+  EXPECT_EQ(inner_size, 4u);
+  check_join(hash_join.inner_join(t0), inner_size, [&](span left, span right) {
+    return hash_join.inner_join(t0, left, right);
+  });
+
+  auto const left_size = hash_join.left_join_size(t0);
+  EXPECT_EQ(left_size, 6u);
+  check_join(hash_join.left_join(t0), left_size, [&](span left, span right) {
+    return hash_join.left_join(t0, left, right);
+  });
+
+  auto const full_size = hash_join.full_join_size(t0);
+  EXPECT_EQ(full_size, 10u);
+  check_join(hash_join.full_join(t0), full_size, [&](span left, span right) {
+    return hash_join.full_join(t0, left, right);
+  });
+}
+
+TEST_F(JoinTest, HashJoinBloomFilter)
+{
+  // Only every tenth probe row matches a build row, and the null rows don't match
+  auto const build_keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<int32_t>(i * 10);
+  });
+  auto const build_valid = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 7 != 0; });
+  column_wrapper<int32_t> col1_0(build_keys, build_keys + 100, build_valid);
+  column_wrapper<int32_t> col0_0(thrust::make_counting_iterator(0),
+                                 thrust::make_counting_iterator(1000));
+  auto const t1 = cudf::table_view({col1_0});
+  auto const t0 = cudf::table_view({col0_0});
+
+  auto sorted_indices = [](auto const& result) {
+    auto result_table =
+      cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.first->size()),
+                                          result.first->data()},
+                        cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.second->size()),
+                                          result.second->data()}});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    cudf::hash_join unfiltered(t1, compare_nulls);
+    cudf::hash_join filtered(t1, compare_nulls, cudf::hash_join_filter::BLOOM_FILTER);
+
+    EXPECT_EQ(filtered.inner_join_size(t0, compare_nulls),
+              unfiltered.inner_join_size(t0, compare_nulls));
+    EXPECT_EQ(filtered.left_join_size(t0, compare_nulls),
+              unfiltered.left_join_size(t0, compare_nulls));
+    EXPECT_EQ(filtered.full_join_size(t0, compare_nulls),
+              unfiltered.full_join_size(t0, compare_nulls));
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_indices(unfiltered.inner_join(t0, compare_nulls)),
+                                       *sorted_indices(filtered.inner_join(t0, compare_nulls)));
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_indices(unfiltered.left_join(t0, compare_nulls)),
+                                       *sorted_indices(filtered.left_join(t0, compare_nulls)));
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_indices(unfiltered.full_join(t0, compare_nulls)),
+                                       *sorted_indices(filtered.full_join(t0, compare_nulls)));
+  }
+}
+
+TEST_F(JoinTest, PartitionedJoin)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2, 3, 7, 5}, {1, 1, 1, 1, 1, 1, 0, 1}};
+  strcol_wrapper col0_1({"s1", "s1", "s0", "s4", "s0", "s1", "s7", "s5"});
+  column_wrapper<int32_t> col1_0{{2, 2, 0, 4, 3, 5, 7}, {1, 1, 1, 1, 1, 1, 0}};
+  strcol_wrapper col1_1({"s1", "s0", "s1", "s2", "s1", "s5", "s7"});
+  auto const t0 = cudf::table_view({col0_0, col0_1});
+  auto const t1 = cudf::table_view({col1_0, col1_1});
+
+  auto sorted_indices = [](auto const& result) {
+    auto result_table =
+      cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.first->size()),
+                                          result.first->data()},
+                        cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.second->size()),
+                                          result.second->data()}});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    for (auto const spill_to_host : {false, true}) {
+      for (auto const num_partitions : {1, 3, 16}) {
+        CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+          *sorted_indices(cudf::inner_join(t0, t1, compare_nulls)),
+          *sorted_indices(
+            cudf::partitioned_inner_join(t0, t1, num_partitions, compare_nulls, spill_to_host)));
+        CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+          *sorted_indices(cudf::left_join(t0, t1, compare_nulls)),
+          *sorted_indices(
+            cudf::partitioned_left_join(t0, t1, num_partitions, compare_nulls, spill_to_host)));
+        CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+          *sorted_indices(cudf::full_join(t0, t1, compare_nulls)),
+          *sorted_indices(
+            cudf::partitioned_full_join(t0, t1, num_partitions, compare_nulls, spill_to_host)));
+      }
+    }
+  }
+
+  EXPECT_THROW(cudf::partitioned_inner_join(t0, t1, 0), cudf::logic_error);
+}
+
+TEST_F(JoinTest, SortMergeJoin)
+{
+  column_wrapper<int32_t> col0_0{{0, 0, 1, 1, 2}, {0, 1, 1, 1, 1}};
+  strcol_wrapper col0_1({"", "s0", "s1", "s1", "s2"}, {0, 1, 1, 1, 1});
+  column_wrapper<int32_t> col1_0{{0, 1, 1, 2, 3}, {0, 1, 1, 1, 1}};
+  strcol_wrapper col1_1({"", "s1", "s1", "s2", "s3"}, {0, 1, 1, 1, 1});
+  auto const t0 = cudf::table_view({col0_0, col0_1});
+  auto const t1 = cudf::table_view({col1_0, col1_1});
+
+  // The result is in the sort order of the keys
+  auto expect_indices = [](auto const& result, auto const& expected_l, auto const& expected_r) {
+    auto const size = static_cast<cudf::size_type>(result.first->size());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::column_view(cudf::data_type{cudf::type_id::INT32}, size, result.first->data()),
+      expected_l);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::column_view(cudf::data_type{cudf::type_id::INT32}, size, result.second->data()),
+      expected_r);
+  };
+
+  expect_indices(cudf::sort_merge_inner_join(t0, t1),
+                 column_wrapper<int32_t>{0, 2, 2, 3, 3, 4},
+                 column_wrapper<int32_t>{0, 1, 2, 1, 2, 3});
+  expect_indices(cudf::sort_merge_inner_join(t0, t1, {}, {}, cudf::null_equality::UNEQUAL),
+                 column_wrapper<int32_t>{2, 2, 3, 3, 4},
+                 column_wrapper<int32_t>{1, 2, 1, 2, 3});
+  expect_indices(cudf::sort_merge_left_join(t0, t1, {}, {}, cudf::null_equality::UNEQUAL),
+                 column_wrapper<int32_t>{0, 1, 2, 2, 3, 3, 4},
+                 column_wrapper<int32_t>{NoneValue, NoneValue, 1, 2, 1, 2, 3});
+
+  // Descending keys with nulls last
+  column_wrapper<int32_t> col2_0{{3, 1, 1, 0}, {1, 1, 1, 0}};
+  column_wrapper<int32_t> col3_0{{2, 1, 0}, {1, 1, 0}};
+  auto const t2 = cudf::table_view({col2_0});
+  auto const t3 = cudf::table_view({col3_0});
+  expect_indices(
+    cudf::sort_merge_left_join(t2, t3, {cudf::order::DESCENDING}, {cudf::null_order::BEFORE}),
+    column_wrapper<int32_t>{0, 1, 2, 3},
+    column_wrapper<int32_t>{NoneValue, 1, 1, 2});
+
+  EXPECT_THROW(cudf::sort_merge_inner_join(t0, t3), cudf::logic_error);
+}
+
+TEST_F(JoinTest, AsofJoin)
+{
+  strcol_wrapper left_by_0({"A", "A", "B", "B", "A", "B", ""}, {1, 1, 1, 1, 1, 1, 0});
+  column_wrapper<int32_t> left_on{{1, 5, 2, 9, 3, 4, 4}, {1, 1, 1, 1, 0, 1, 1}};
+  strcol_wrapper right_by_0({"A", "B", "A", "B", "B", ""}, {1, 1, 1, 1, 1, 0});
+  column_wrapper<int32_t> right_on{{2, 3, 4, 8, 3, 4}, {1, 1, 1, 1, 0, 1}};
+  auto const left_by  = cudf::table_view({left_by_0});
+  auto const right_by = cudf::table_view({right_by_0});
+
+  auto const no_tolerance = cudf::numeric_scalar<int32_t>(0, false);
+  auto const tolerance    = cudf::numeric_scalar<int32_t>(1);
+
+  auto expect_indices = [](auto const& result, auto const& expected) {
+    auto const size = static_cast<cudf::size_type>(result->size());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::column_view(cudf::data_type{cudf::type_id::INT32}, size, result->data()), expected);
+  };
+
+  // A null on value matches nothing; null by keys match each other unless nulls are unequal
+  auto const backward = cudf::asof_direction::BACKWARD;
+  auto const forward  = cudf::asof_direction::FORWARD;
+  expect_indices(cudf::asof_join(left_by, left_on, right_by, right_on, backward, no_tolerance),
+                 column_wrapper<int32_t>{NoneValue, 2, NoneValue, 3, NoneValue, 1, 5});
+  expect_indices(cudf::asof_join(left_by, left_on, right_by, right_on, forward, no_tolerance),
+                 column_wrapper<int32_t>{0, NoneValue, 1, NoneValue, NoneValue, 3, 5});
+  expect_indices(cudf::asof_join(left_by,
+                                 left_on,
+                                 right_by,
+                                 right_on,
+                                 cudf::asof_direction::NEAREST,
+                                 tolerance,
+                                 cudf::null_equality::UNEQUAL),
+                 column_wrapper<int32_t>{0, 2, 1, 3, NoneValue, 1, NoneValue});
+
+  column_wrapper<int64_t> wrong_type{1, 2, 3, 4, 5, 6};
+  EXPECT_THROW(cudf::asof_join(left_by, left_on, right_by, wrong_type, backward, tolerance),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::asof_join(
+                 left_by, left_on, right_by, right_on, backward, cudf::numeric_scalar<int64_t>(1)),
+               cudf::logic_error);
+}
+
+TEST_F(JoinTest, AsofJoinTimestamps)
+{
+  using cudf::timestamp_s;
+  using duration = cudf::duration_s;
+
+  // Equal right on values: the backward match is the last one, the forward match the first one
+  column_wrapper<timestamp_s, timestamp_s::rep> left_on{10, 20, 30, 12};
+  column_wrapper<timestamp_s, timestamp_s::rep> right_on{29, 8, 12, 12};
+  auto const tolerance = cudf::duration_scalar<duration>(5, true);
+  auto const no_keys   = cudf::table_view{};
+
+  auto const result_backward = cudf::asof_join(
+    no_keys, left_on, no_keys, right_on, cudf::asof_direction::BACKWARD, tolerance);
+  auto const result_forward = cudf::asof_join(
+    no_keys, left_on, no_keys, right_on, cudf::asof_direction::FORWARD, tolerance);
+
+  auto const size = cudf::column_view(left_on).size();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::column_view(cudf::data_type{cudf::type_id::INT32}, size, result_backward->data()),
+    column_wrapper<int32_t>{1, NoneValue, 0, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::column_view(cudf::data_type{cudf::type_id::INT32}, size, result_forward->data()),
+    column_wrapper<int32_t>{2, NoneValue, NoneValue, 2});
+}
+
+TEST_F(JoinTest, SkewedJoin)
+{
+  // The key 1 makes up a third of the right rows, so it is a heavy hitter
+  column_wrapper<int32_t> col0_0{{1, 0, 1, 2, 4, 1, 3, 0}, {1, 1, 1, 1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> col1_0{{1, 2, 1, 3, 0, 1, 5, 0, 6}, {1, 1, 1, 1, 1, 1, 1, 0, 1}};
+  auto const t0 = cudf::table_view({col0_0});
+  auto const t1 = cudf::table_view({col1_0});
+
+  auto sorted_indices = [](auto const& result) {
+    auto result_table =
+      cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.first->size()),
+                                          result.first->data()},
+                        cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.second->size()),
+                                          result.second->data()}});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+      *sorted_indices(cudf::skewed_inner_join(t0, t1, compare_nulls, 0.3)),
+      *sorted_indices(cudf::inner_join(t0, t1, compare_nulls)));
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+      *sorted_indices(cudf::skewed_left_join(t0, t1, compare_nulls, 0.3)),
+      *sorted_indices(cudf::left_join(t0, t1, compare_nulls)));
+  }
+
+  // Without heavy hitters, every row goes through the hash join
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+    *sorted_indices(cudf::skewed_inner_join(t0, t1, cudf::null_equality::EQUAL, 1.0)),
+    *sorted_indices(cudf::inner_join(t0, t1)));
+
+  EXPECT_THROW(cudf::skewed_inner_join(t0, t1, cudf::null_equality::EQUAL, 0.0), cudf::logic_error);
+  EXPECT_THROW(cudf::skewed_left_join(t0, t1, cudf::null_equality::EQUAL, 0.3, 0),
+               cudf::logic_error);
+}
+
+TEST_F(JoinTest, ConditionalJoin)
+{
+  column_wrapper<int32_t> col0_0{{0, 1, 2, 3}, {1, 1, 1, 0}};
+  column_wrapper<int32_t> col1_0{{1, 2, 5}, {1, 1, 0}};
+  auto const t0 = cudf::table_view({col0_0});
+  auto const t1 = cudf::table_view({col1_0});
+
+  auto sorted_indices = [](auto const& result) {
+    auto result_table =
+      cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.first->size()),
+                                          result.first->data()},
+                        cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.second->size()),
+                                          result.second->data()}});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+
+  auto const left_ref  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto const right_ref = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const predicate = cudf::ast::expression(cudf::ast::ast_operator::LESS, left_ref, right_ref);
+
+  // Pairs with a null on either side never match
+  column_wrapper<int32_t> inner_l{0, 0, 1};
+  column_wrapper<int32_t> inner_r{0, 1, 1};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+    *sorted_indices(cudf::conditional_inner_join(t0, t1, predicate)),
+    cudf::table_view({inner_l, inner_r}));
+
+  column_wrapper<int32_t> left_l{0, 0, 1, 2, 3};
+  column_wrapper<int32_t> left_r{0, 1, 1, NoneValue, NoneValue};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+    *sorted_indices(cudf::conditional_left_join(t0, t1, predicate)),
+    cudf::table_view({left_l, left_r}));
+
+  auto const empty_right = cudf::empty_like(t1);
+  EXPECT_EQ(cudf::conditional_inner_join(t0, *empty_right, predicate).first->size(), 0u);
+  EXPECT_EQ(cudf::conditional_left_join(t0, *empty_right, predicate).first->size(), 4u);
+
+  auto const sum = cudf::ast::expression(cudf::ast::ast_operator::ADD, left_ref, right_ref);
+  EXPECT_THROW(cudf::conditional_inner_join(t0, t1, sum), cudf::logic_error);
+}
+
+TEST_F(JoinTest, MixedJoin)
+{
+  column_wrapper<int32_t> left_key{0, 1, 1, 2, 3, 1};
+  column_wrapper<int32_t> left_ts{{5, 5, 15, 7, 1, 0}, {1, 1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> right_key{1, 1, 2, 4};
+  column_wrapper<int32_t> right_start{0, 10, 8, 0};
+  column_wrapper<int32_t> right_end{10, 20, 9, 100};
+  auto const left_equality     = cudf::table_view({left_key});
+  auto const right_equality    = cudf::table_view({right_key});
+  auto const left_conditional  = cudf::table_view({left_ts});
+  auto const right_conditional = cudf::table_view({right_start, right_end});
+
+  auto sorted_indices = [](auto const& result) {
+    auto result_table =
+      cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.first->size()),
+                                          result.first->data()},
+                        cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.second->size()),
+                                          result.second->data()}});
+    return cudf::gather(result_table, *cudf::sorted_order(result_table));
+  };
+
+  // left.key == right.key AND left.ts BETWEEN right.start AND right.end
+  auto const ts    = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto const start = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const end   = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+
+  auto const after_start = cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, ts, start);
+  auto const before_end  = cudf::ast::expression(cudf::ast::ast_operator::LESS_EQUAL, ts, end);
+  auto const predicate =
+    cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_AND, after_start, before_end);
+
+  column_wrapper<int32_t> inner_l{1, 2};
+  column_wrapper<int32_t> inner_r{0, 1};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+    *sorted_indices(cudf::mixed_inner_join(
+      left_equality, right_equality, left_conditional, right_conditional, predicate)),
+    cudf::table_view({inner_l, inner_r}));
+
+  column_wrapper<int32_t> left_l{0, 1, 2, 3, 4, 5};
+  column_wrapper<int32_t> left_r{NoneValue, 0, 1, NoneValue, NoneValue, NoneValue};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+    *sorted_indices(cudf::mixed_left_join(
+      left_equality, right_equality, left_conditional, right_conditional, predicate)),
+    cudf::table_view({left_l, left_r}));
+
+  auto const sum = cudf::ast::expression(cudf::ast::ast_operator::ADD, ts, start);
+  EXPECT_THROW(
+    cudf::mixed_inner_join(left_equality, right_equality, left_conditional, right_conditional, sum),
+    cudf::logic_error);
+  EXPECT_THROW(
+    cudf::mixed_inner_join(left_equality, right_equality, right_conditional, left_conditional, sum),
+    cudf::logic_error);
+}
+
 struct JoinDictionaryTest : public cudf::test::BaseFixture {
 };
 
@@ -107,3 +107,95 @@ TEST_F(JoinTest, SemiJoinWithStructsAndNulls)
   auto sorted_gold     = cudf::gather(gold.view(), *gold_sort_order);
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
+
+TEST_F(JoinTest, HashSemiJoinReuse)
+{
+  column_wrapper<int32_t> build_0{{2, 2, 0, 4, 3}, {1, 1, 1, 1, 0}};
+  strcol_wrapper build_1({"s1", "s1", "s1", "s2", "s1"});
+  auto const build = cudf::table_view({build_0, build_1});
+
+  column_wrapper<int32_t> probe0_0{{3, 2, 2, 0, 4}, {0, 1, 1, 1, 1}};
+  strcol_wrapper probe0_1({"s1", "s1", "s0", "s1", "s2"});
+  column_wrapper<int32_t> probe1_0{{0, 1, 4, 2}};
+  strcol_wrapper probe1_1({"s1", "s1", "s1", "s1"});
+  auto const probe0 = cudf::table_view({probe0_0, probe0_1});
+  auto const probe1 = cudf::table_view({probe1_0, probe1_1});
+
+  auto to_column = [](auto const& indices) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(indices->size()),
+                             indices->data()};
+  };
+  auto sorted = [](cudf::column_view const& indices) {
+    auto const indices_table = cudf::table_view({indices});
+    return cudf::gather(indices_table, *cudf::sorted_order(indices_table));
+  };
+
+  // One hash set is probed by several tables
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    cudf::hash_semi_join semi_join(build, compare_nulls);
+    for (auto const& probe : {probe0, probe1}) {
+      CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+        *sorted(to_column(semi_join.left_semi_join(probe))),
+        *sorted(to_column(cudf::left_semi_join(probe, build, compare_nulls))));
+      CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+        *sorted(to_column(semi_join.left_anti_join(probe))),
+        *sorted(to_column(cudf::left_anti_join(probe, build, compare_nulls))));
+    }
+  }
+
+  // The null row of the probe table matches the null row of the build table
+  cudf::hash_semi_join semi_join(build);
+  column_wrapper<int32_t> expected{0, 1, 3, 4};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(to_column(semi_join.left_semi_join(probe0))),
+                                     cudf::table_view({expected}));
+
+  auto const empty_build = cudf::empty_like(build);
+  cudf::hash_semi_join empty_semi_join(*empty_build);
+  EXPECT_EQ(empty_semi_join.left_semi_join(probe0)->size(), 0u);
+  EXPECT_EQ(empty_semi_join.left_anti_join(probe0)->size(), 5u);
+}
+
+TEST_F(JoinTest, HashSemiJoinCaseInsensitive)
+{
+  strcol_wrapper build_0({"Apple", "BANANA", "cherry"});
+  column_wrapper<int32_t> build_1{{1, 2, 3}};
+  auto const build = cudf::table_view({build_0, build_1});
+
+  strcol_wrapper probe_0({"apple", "Banana", "CHERRY", "banana", "Apple", "cherries"});
+  column_wrapper<int32_t> probe_1{{1, 2, 4, 2, 1, 3}};
+  auto const probe = cudf::table_view({probe_0, probe_1});
+
+  auto to_column = [](auto const& indices) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(indices->size()),
+                             indices->data()};
+  };
+  auto sorted = [](cudf::column_view const& indices) {
+    auto const indices_table = cudf::table_view({indices});
+    return cudf::gather(indices_table, *cudf::sorted_order(indices_table));
+  };
+
+  cudf::hash_semi_join semi_join(
+    build,
+    cudf::null_equality::EQUAL,
+    {cudf::case_sensitivity::INSENSITIVE, cudf::case_sensitivity::SENSITIVE});
+  column_wrapper<int32_t> expected_semi{0, 1, 3, 4};
+  column_wrapper<int32_t> expected_anti{2, 5};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(to_column(semi_join.left_semi_join(probe))),
+                                     cudf::table_view({expected_semi}));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(to_column(semi_join.left_anti_join(probe))),
+                                     cudf::table_view({expected_anti}));
+
+  // Without folding only the rows with the same bytes match
+  cudf::hash_semi_join sensitive_semi_join(build);
+  column_wrapper<int32_t> expected_sensitive{4};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(
+    *sorted(to_column(sensitive_semi_join.left_semi_join(probe))),
+    cudf::table_view({expected_sensitive}));
+
+  EXPECT_THROW(cudf::hash_semi_join(build,
+                                    cudf::null_equality::EQUAL,
+                                    {cudf::case_sensitivity::INSENSITIVE}),
+               cudf::logic_error);
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/labeling/histogram.hpp>
+#include <cudf/types.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <limits>
+
+namespace {
+
+template <typename T>
+using fwc_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+using counts_wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+using NumericTypesNotBool =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+
+struct HistogramErrorTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(HistogramErrorTest, InvalidInputs)
+{
+  fwc_wrapper<double> input{0, 1, 2};
+  fwc_wrapper<float> float_edges{0, 1, 2};
+  fwc_wrapper<double> one_edge{0};
+  fwc_wrapper<double> null_edges{{0, 1, 2}, {1, 0, 1}};
+  fwc_wrapper<bool> booleans{true, false};
+
+  EXPECT_THROW(cudf::histogram(input, 0.0, 1.0, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::histogram(input, 1.0, 1.0, 4), cudf::logic_error);
+  EXPECT_THROW(cudf::histogram(booleans, 0.0, 1.0, 4), cudf::logic_error);
+  EXPECT_THROW(cudf::histogram(input, float_edges), cudf::logic_error);
+  EXPECT_THROW(cudf::histogram(input, one_edge), cudf::logic_error);
+  EXPECT_THROW(cudf::histogram(input, null_edges), cudf::logic_error);
+
+  fwc_wrapper<int32_t> keys{1, 2};
+  EXPECT_THROW(cudf::grouped_histogram(cudf::table_view{{keys}}, input, 0.0, 1.0, 4),
+               cudf::logic_error);
+}
+
+template <typename T>
+struct HistogramTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(HistogramTest, NumericTypesNotBool);
+
+TYPED_TEST(HistogramTest, UniformBins)
+{
+  using T = TypeParam;
+
+  // Bins [0, 2), [2, 4), [4, 6), [6, 8), [8, 10]
+  fwc_wrapper<T> input{{0, 1, 2, 9, 10, 11, 5, 5, 7, 3}, {1, 1, 1, 1, 1, 1, 1, 0, 1, 1}};
+  counts_wrapper expected{2, 2, 1, 1, 2};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *cudf::histogram(input, 0.0, 10.0, 5));
+}
+
+TYPED_TEST(HistogramTest, EdgeBins)
+{
+  using T = TypeParam;
+
+  // Bins [1, 3), [3, 4), [4, 10]
+  fwc_wrapper<T> edges{1, 3, 4, 10};
+  fwc_wrapper<T> input{{0, 1, 2, 3, 4, 10, 11, 5, 6}, {1, 1, 1, 1, 1, 1, 1, 1, 0}};
+  counts_wrapper expected{2, 1, 3};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *cudf::histogram(input, edges));
+}
+
+TYPED_TEST(HistogramTest, GroupedBins)
+{
+  using T = TypeParam;
+
+  cudf::test::strings_column_wrapper keys({"b", "a", "b", "a", "b", "c"});
+  fwc_wrapper<T> input{1, 6, 2, 7, 9, 3};
+  fwc_wrapper<T> edges{0, 5, 10};
+
+  cudf::test::strings_column_wrapper expected_keys({"a", "b", "c"});
+  cudf::test::lists_column_wrapper<int64_t> expected_counts{{0, 2}, {2, 1}, {1, 0}};
+
+  auto const uniform = cudf::grouped_histogram(cudf::table_view{{keys}}, input, 0.0, 10.0, 2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_keys}}, uniform.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_counts, *uniform.second);
+
+  auto const explicit_edges = cudf::grouped_histogram(cudf::table_view{{keys}}, input, edges);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_keys}}, explicit_edges.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_counts, *explicit_edges.second);
+}
+
+struct HistogramColumnTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(HistogramColumnTest, NaNs)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  fwc_wrapper<double> input{0.5, nan, 1.5, nan, 1.0};
+  fwc_wrapper<double> edges{0.0, 1.0, 2.0};
+  counts_wrapper expected{1, 2};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *cudf::histogram(input, 0.0, 2.0, 2));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *cudf::histogram(input, edges));
+}
+
+TEST_F(HistogramColumnTest, ManyBins)
+{
+  // More bins than a thread block counts in shared memory
+  auto const num_bins = 10000;
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10000; });
+  fwc_wrapper<int32_t> input(values, values + 30000);
+  auto counts = cudf::detail::make_counting_transform_iterator(0, [](auto) { return 3; });
+  counts_wrapper expected(counts, counts + num_bins);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *cudf::histogram(input, 0.0, 10000.0, num_bins));
+}
+
+TEST_F(HistogramColumnTest, Strings)
+{
+  cudf::test::strings_column_wrapper input({"apple", "kiwi", "banana", "cherry", "zucchini"});
+  cudf::test::strings_column_wrapper edges({"a", "c", "z"});
+  counts_wrapper expected{2, 2};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *cudf::histogram(input, edges));
+}
+
+}  // anonymous namespace
@@ -24,6 +24,7 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 namespace cudf {
@@ -711,6 +712,106 @@ TYPED_TEST(TypedContainsDecimalsTest, ListContainsVector)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
 }
 
+TYPED_TEST(TypedContainsTest, SortedListContainsVector)
+{
+  using T   = TypeParam;
+  using LCW = lists_column_wrapper<T, int32_t>;
+
+  // The rows are sorted ascending with the nulls last, and are binary searched
+  auto const nulls_last = iterator_with_null_at(std::vector<size_type>{3, 4});
+
+  auto search_space = LCW{{LCW{0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                           LCW{{1, 1, 3, 0, 0}, nulls_last},
+                           LCW{},
+                           LCW{2, 4},
+                           LCW{5}},
+                          iterator_with_null_at(4)}
+                        .release();
+  auto search_keys =
+    fixed_width_column_wrapper<T, int32_t>{{9, 2, 1, 3, 5}, iterator_with_null_at(3)};
+
+  auto actual_result =
+    lists::contains(search_space->view(), search_keys, order::ASCENDING, null_order::AFTER);
+  auto expected_result = fixed_width_column_wrapper<bool>{
+    {1, 0, 0, 0, 0}, iterator_with_null_at(std::vector<size_type>{1, 3, 4})};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+
+  // The same rows, sorted descending with the nulls first
+  auto const nulls_first = iterator_with_null_at(std::vector<size_type>{0, 1});
+
+  auto descending = LCW{{LCW{9, 8, 7, 6, 5, 4, 3, 2, 1, 0},
+                         LCW{{0, 0, 3, 1, 1}, nulls_first},
+                         LCW{},
+                         LCW{4, 2},
+                         LCW{5}},
+                        iterator_with_null_at(4)}
+                      .release();
+  actual_result =
+    lists::contains(descending->view(), search_keys, order::DESCENDING, null_order::BEFORE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+
+  auto search_key_one = create_scalar_search_key<T>(1);
+  actual_result =
+    lists::contains(descending->view(), *search_key_one, order::DESCENDING, null_order::BEFORE);
+  expected_result = fixed_width_column_wrapper<bool>{{1, 1, 0, 0, 0}, iterator_with_null_at(4)};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
+TYPED_TEST(TypedContainsTest, ListIndexOf)
+{
+  using T   = TypeParam;
+  using LCW = lists_column_wrapper<T, int32_t>;
+
+  auto search_space =
+    LCW{{LCW{1, 2, 3, 2}, LCW{}, LCW{2}, LCW{{4, 0, 2}, iterator_with_null_at(1)}, LCW{5, 2}},
+        iterator_with_null_at(2)}
+      .release();
+
+  auto search_key_two  = create_scalar_search_key<T>(2);
+  auto actual_result   = lists::index_of(search_space->view(), *search_key_two);
+  auto expected_result =
+    fixed_width_column_wrapper<size_type>{{1, -1, 0, 2, 1}, iterator_with_null_at(2)};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+
+  auto search_keys =
+    fixed_width_column_wrapper<T, int32_t>{{3, 1, 2, 4, 0}, iterator_with_null_at(4)};
+  actual_result    = lists::index_of(search_space->view(), search_keys);
+  expected_result  = fixed_width_column_wrapper<size_type>{
+    {2, -1, 0, 0, 0}, iterator_with_null_at(std::vector<size_type>{2, 4})};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
+TYPED_TEST(TypedContainsTest, ListContainsAny)
+{
+  using T   = TypeParam;
+  using LCW = lists_column_wrapper<T, int32_t>;
+
+  // A row of more than 32 entries, whose entries are hashed
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 50); });
+
+  auto search_space = LCW{{LCW{1, 2, 3},
+                           LCW{4, 5},
+                           LCW{1},
+                           LCW{6},
+                           LCW(values, values + 100),
+                           LCW{{1, 0}, iterator_with_null_at(1)}},
+                          iterator_with_null_at(2)}
+                        .release();
+  auto search_keys = LCW{LCW{7, 3},
+                         LCW{6},
+                         LCW{1},
+                         LCW{},
+                         LCW{60, 49},
+                         LCW{{0, 2}, iterator_with_null_at(0)}}
+                       .release();
+
+  auto actual_result = lists::contains_any(search_space->view(), search_keys->view());
+  auto expected_result =
+    fixed_width_column_wrapper<bool>{{1, 0, 0, 0, 1, 0}, iterator_with_null_at(2)};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
 }  // namespace test
 
 }  // namespace cudf
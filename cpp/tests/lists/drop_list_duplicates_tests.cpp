@@ -19,6 +19,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/lists/drop_list_duplicates.hpp>
+#include <cudf/lists/sorting.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <algorithm>
@@ -40,8 +41,11 @@ void test_once(cudf::column_view const& input,
                LCW const& expected,
                cudf::null_equality nulls_equal = cudf::null_equality::EQUAL)
 {
-  auto const results =
+  auto const distinct =
     cudf::lists::drop_list_duplicates(cudf::lists_column_view{input}, nulls_equal);
+  // The expected entries are sorted, nulls last
+  auto const results = cudf::lists::sort_lists(
+    cudf::lists_column_view{distinct->view()}, cudf::order::ASCENDING, cudf::null_order::AFTER);
   if (cudf::is_floating_point(input.type())) {
     CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
   } else {
@@ -252,3 +256,29 @@ TYPED_TEST(DropListDuplicatesTypedTest, WithNullInputTests)
              cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i < 5; })},
     cudf::null_equality::UNEQUAL);
 }
+
+TYPED_TEST(DropListDuplicatesTypedTest, LongListInputTests)
+{
+  // The entries of the lists with more than 32 entries are hashed instead of scanned
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<TypeParam>(9 - i % 10); });
+  test_once(LIST_COL{LIST_COL{1, 1, 2},
+                     LIST_COL(values, values + 100),
+                     LIST_COL{},
+                     LIST_COL(values, values + 10)},
+            LIST_COL{LIST_COL{1, 2},
+                     LIST_COL{0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                     LIST_COL{},
+                     LIST_COL{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}});
+}
+
+TYPED_TEST(DropListDuplicatesTypedTest, InputOrderTests)
+{
+  // The first occurrence of each entry is kept, in the input order
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<TypeParam>(9 - i % 10); });
+  auto const input    = LIST_COL{LIST_COL{3, 1, 3, 2, 1}, LIST_COL(values, values + 100)};
+  auto const expected = LIST_COL{LIST_COL{3, 1, 2}, LIST_COL{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}};
+  auto const results  = cudf::lists::drop_list_duplicates(cudf::lists_column_view{input});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+}
@@ -1183,3 +1183,76 @@ TEST_F(ExplodeOuterTest, SlicedList)
   auto pos_ret = cudf::explode_outer_position(sliced_t[0], 0);
   CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
 }
+
+TEST_F(ExplodeTest, MultipleColumns)
+{
+  //    a          b                  c              d
+  //    100       [1, 2, 7]           string0       [10, 20, 70]
+  //    200       [5, 6]              string1       [50, 60]
+  //    300       [0, 3]              string2       [0, 30]
+
+  FCW a{100, 200, 300};
+  LCW b{LCW{1, 2, 7}, LCW{5, 6}, LCW{0, 3}};
+  strings_column_wrapper c{"string0", "string1", "string2"};
+  LCW d{LCW{10, 20, 70}, LCW{50, 60}, LCW{0, 30}};
+
+  FCW expected_a{100, 100, 100, 200, 200, 300, 300};
+  FCW expected_b{1, 2, 7, 5, 6, 0, 3};
+  strings_column_wrapper expected_c{
+    "string0", "string0", "string0", "string1", "string1", "string2", "string2"};
+  FCW expected_d{10, 20, 70, 50, 60, 0, 30};
+
+  cudf::table_view t({a, b, c, d});
+  cudf::table_view expected({expected_a, expected_b, expected_c, expected_d});
+
+  auto ret = cudf::explode(t, std::vector<cudf::size_type>{3, 1});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(ret->view(), expected);
+
+  FCW expected_pos_col{0, 1, 2, 0, 1, 0, 1};
+  cudf::table_view pos_expected(
+    {expected_a, expected_pos_col, expected_b, expected_c, expected_d});
+
+  auto pos_ret = cudf::explode_position(t, std::vector<cudf::size_type>{1, 3});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
+
+  // The exploded columns must be distinct lists columns with lists of the same sizes
+  LCW e{LCW{1}, LCW{5, 6}, LCW{0, 3}};
+  cudf::table_view mismatched({a, b, e});
+  EXPECT_THROW(cudf::explode(mismatched, std::vector<cudf::size_type>{1, 2}), cudf::logic_error);
+  EXPECT_THROW(cudf::explode(t, std::vector<cudf::size_type>{1, 1}), cudf::logic_error);
+  EXPECT_THROW(cudf::explode(t, std::vector<cudf::size_type>{1, 2}), cudf::logic_error);
+  EXPECT_THROW(cudf::explode(t, std::vector<cudf::size_type>{}), cudf::logic_error);
+}
+
+TEST_F(ExplodeOuterTest, MultipleColumns)
+{
+  //    a          b                  c              d
+  //    100       [1, 2]              string0       [10, 20]
+  //    200       []                  string1       []
+  //    300       [3]                 string2       [30]
+
+  FCW a{100, 200, 300};
+  LCW b{LCW{1, 2}, LCW{}, LCW{3}};
+  strings_column_wrapper c{"string0", "string1", "string2"};
+  LCW d{LCW{10, 20}, LCW{}, LCW{30}};
+
+  auto valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+
+  FCW expected_a{100, 100, 200, 300};
+  FCW expected_b({1, 2, 0, 3}, valids);
+  strings_column_wrapper expected_c{"string0", "string0", "string1", "string2"};
+  FCW expected_d({10, 20, 0, 30}, valids);
+
+  cudf::table_view t({a, b, c, d});
+  cudf::table_view expected({expected_a, expected_b, expected_c, expected_d});
+
+  auto ret = cudf::explode_outer(t, std::vector<cudf::size_type>{1, 3});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(ret->view(), expected);
+
+  FCW expected_pos_col({0, 1, 0, 0}, valids);
+  cudf::table_view pos_expected(
+    {expected_a, expected_pos_col, expected_b, expected_c, expected_d});
+
+  auto pos_ret = cudf::explode_outer_position(t, std::vector<cudf::size_type>{1, 3});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/lists/set_operations.hpp>
+
+#include <limits>
+#include <vector>
+
+using float_type = double;
+
+using LIST_COL_FLT = cudf::test::lists_column_wrapper<float_type>;
+using LIST_COL_STR = cudf::test::lists_column_wrapper<cudf::string_view>;
+
+auto constexpr NaN = std::numeric_limits<float_type>::quiet_NaN();
+
+struct SetOperationsTest : public cudf::test::BaseFixture {
+};
+
+template <typename T>
+struct SetOperationsTypedTest : public cudf::test::BaseFixture {
+};
+#define LIST_COL cudf::test::lists_column_wrapper<TypeParam, int32_t>
+
+using TypesForTest =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+TYPED_TEST_CASE(SetOperationsTypedTest, TypesForTest);
+
+TYPED_TEST(SetOperationsTypedTest, InvalidInputTests)
+{
+  auto const lhs    = LIST_COL{{1, 2}, {3}};
+  auto const rhs    = LIST_COL{{1, 2}};
+  auto const nested = LIST_COL{LIST_COL{{1, 2}, {3}}};
+  auto const other  = LIST_COL_STR{{"a"}, {"b"}};
+
+  // The inputs must have the same size and entry type
+  EXPECT_THROW(cudf::lists::intersect_distinct(cudf::lists_column_view{lhs},
+                                               cudf::lists_column_view{rhs}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::lists::union_distinct(cudf::lists_column_view{lhs},
+                                           cudf::lists_column_view{other}),
+               cudf::logic_error);
+
+  // Lists of nested types are not supported
+  EXPECT_THROW(cudf::lists::difference_distinct(cudf::lists_column_view{nested},
+                                                cudf::lists_column_view{nested}),
+               cudf::logic_error);
+}
+
+TYPED_TEST(SetOperationsTypedTest, TrivialInputTests)
+{
+  auto const lhs = LIST_COL{{}, {1}, {}};
+  auto const rhs = LIST_COL{{1}, {}, {}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::intersect_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL{{}, {}, {}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::union_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL{{1}, {1}, {}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::difference_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL{{}, {1}, {}});
+}
+
+TYPED_TEST(SetOperationsTypedTest, NonNullInputTests)
+{
+  auto const lhs = LIST_COL{{1, 2, 2, 3}, {4, 5}, {4, 1, 4}, {}};
+  auto const rhs = LIST_COL{{3, 2, 6}, {6}, {1, 1}, {1}};
+
+  // The entries of each output list are in the order of their first occurrence, lhs first
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::intersect_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL{{2, 3}, {}, {1}, {}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::union_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL{{1, 2, 3, 6}, {4, 5, 6}, {4, 1}, {1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::difference_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL{{1}, {4, 5}, {4}, {}});
+
+  // Sliced inputs
+  auto const lhs_sliced = cudf::slice(lhs, {1, 3})[0];
+  auto const rhs_sliced = cudf::slice(rhs, {2, 4})[0];
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*cudf::lists::union_distinct(
+                                        cudf::lists_column_view{lhs_sliced},
+                                        cudf::lists_column_view{rhs_sliced}),
+                                      LIST_COL{{4, 5, 1}, {4, 1}});
+}
+
+TYPED_TEST(SetOperationsTypedTest, LongListInputTests)
+{
+  // The entries of the lists with more than 32 entries are hashed instead of scanned
+  auto const make_list = [](std::vector<int32_t> const& values) {
+    return LIST_COL(values.begin(), values.end());
+  };
+  std::vector<int32_t> evens, odds;
+  for (int32_t i = 0; i < 100; ++i) {
+    evens.push_back((2 * i) % 40);
+    odds.push_back((2 * i + 1) % 40);
+  }
+  auto const distinct_evens = std::vector<int32_t>(evens.begin(), evens.begin() + 20);
+  auto const distinct_odds  = std::vector<int32_t>(odds.begin(), odds.begin() + 20);
+
+  auto const lhs = LIST_COL{make_list(evens), LIST_COL{0, 1, 2}, LIST_COL{0, 1}};
+  auto const rhs = LIST_COL{LIST_COL{2, 3, 4, 2},
+                            make_list(std::vector<int32_t>(evens.begin(), evens.begin() + 60)),
+                            make_list(std::vector<int32_t>(odds.begin(), odds.begin() + 60))};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::intersect_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL{LIST_COL{2, 4}, LIST_COL{0, 2}, LIST_COL{1}});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::difference_distinct(cudf::lists_column_view{rhs}, cudf::lists_column_view{lhs}),
+    LIST_COL{LIST_COL{3},
+             make_list(std::vector<int32_t>(distinct_evens.begin() + 2, distinct_evens.end())),
+             make_list(std::vector<int32_t>(distinct_odds.begin() + 1, distinct_odds.end()))});
+
+  auto union_0 = distinct_evens;
+  union_0.push_back(3);
+  auto union_1 = std::vector<int32_t>{0, 1, 2};
+  union_1.insert(union_1.end(), distinct_evens.begin() + 2, distinct_evens.end());
+  auto union_2 = std::vector<int32_t>{0, 1};
+  union_2.insert(union_2.end(), distinct_odds.begin() + 1, distinct_odds.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::union_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL{make_list(union_0), make_list(union_1), make_list(union_2)});
+}
+
+TEST_F(SetOperationsTest, NullAndNaNInputTests)
+{
+  auto constexpr null    = float_type{0};
+  auto const null_at_2_4 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i != 2 && i != 4; });
+  auto const null_at_2_3 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i != 2 && i != 3; });
+
+  // The output row is null if the row of either input is null
+  auto const lhs = LIST_COL_FLT{
+    {LIST_COL_FLT{{1, NaN, null, 2, null}, null_at_2_4}, LIST_COL_FLT{3, 3}, LIST_COL_FLT{4}},
+    cudf::test::iterator_with_null_at(2)};
+  auto const rhs = LIST_COL_FLT{LIST_COL_FLT{{null, NaN, 2}, cudf::test::iterator_with_null_at(0)},
+                                LIST_COL_FLT{3},
+                                LIST_COL_FLT{4}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::intersect_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL_FLT{{LIST_COL_FLT{{null, 2}, cudf::test::iterator_with_null_at(0)},
+                  LIST_COL_FLT{3},
+                  LIST_COL_FLT{}},
+                 cudf::test::iterator_with_null_at(2)});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::intersect_distinct(cudf::lists_column_view{lhs},
+                                     cudf::lists_column_view{rhs},
+                                     cudf::null_equality::EQUAL,
+                                     cudf::nan_equality::ALL_EQUAL),
+    LIST_COL_FLT{{LIST_COL_FLT{{NaN, null, 2}, cudf::test::iterator_with_null_at(1)},
+                  LIST_COL_FLT{3},
+                  LIST_COL_FLT{}},
+                 cudf::test::iterator_with_null_at(2)});
+
+  // NaNs are unequal by default
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::union_distinct(cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}),
+    LIST_COL_FLT{{LIST_COL_FLT{{1, NaN, null, 2, NaN}, cudf::test::iterator_with_null_at(2)},
+                  LIST_COL_FLT{3},
+                  LIST_COL_FLT{}},
+                 cudf::test::iterator_with_null_at(2)});
+
+  // Unequal nulls are all kept
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *cudf::lists::difference_distinct(
+      cudf::lists_column_view{lhs}, cudf::lists_column_view{rhs}, cudf::null_equality::UNEQUAL),
+    LIST_COL_FLT{{LIST_COL_FLT{{1, NaN, null, null}, null_at_2_3}, LIST_COL_FLT{}, LIST_COL_FLT{}},
+                 cudf::test::iterator_with_null_at(2)});
+}
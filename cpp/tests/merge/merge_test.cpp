@@ -15,6 +15,8 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/merge.hpp>
 #include <cudf/sorting.hpp>
@@ -30,6 +32,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <string>
 #include <vector>
 
 template <typename T>
@@ -727,6 +730,71 @@ TEST_F(MergeTest, KeysWithNulls)
     }
 }
 
+TEST_F(MergeTest, ThreeTablesTiesInTableOrder)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1{0, 1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> values1{4, 5, 6, 7};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys2{1, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> values2{8, 9};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys3{2, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> values3{10, 11};
+
+  auto result = cudf::merge({cudf::table_view{{keys1, values1}},
+                             cudf::table_view{{keys2, values2}},
+                             cudf::table_view{{keys3, values3}}},
+                            {0},
+                            {cudf::order::ASCENDING});
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_keys{0, 1, 1, 2, 2, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_values{4, 5, 8, 6, 9, 10, 7, 11};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_keys, expected_values}),
+                                result->view());
+}
+
+TEST_F(MergeTest, ManyTables)
+{
+  // Tables of different sizes, some larger than the distance between two splitters
+  constexpr cudf::size_type num_tables = 64;
+  std::vector<cudf::test::fixed_width_column_wrapper<int32_t>> keys;
+  std::vector<cudf::test::strings_column_wrapper> values;
+  keys.reserve(num_tables);
+  values.reserve(num_tables);
+  for (cudf::size_type t = 0; t < num_tables; ++t) {
+    auto const num_rows = (t * 97) % 1300;
+    auto key_iter       = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return (row * 5 + t) / 3; });
+    auto valid_iter = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return (row + t) % 11 != 0; });
+    auto value_iter = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return std::to_string(t) + ":" + std::to_string(row); });
+    keys.emplace_back(key_iter, key_iter + num_rows, valid_iter);
+    values.emplace_back(value_iter, value_iter + num_rows);
+  }
+
+  for (auto const np : {cudf::null_order::BEFORE, cudf::null_order::AFTER}) {
+    std::vector<cudf::null_order> null_precedence{np};
+    std::vector<cudf::table_view> tables;
+    std::vector<std::unique_ptr<cudf::table>> sorted_tables;
+    for (cudf::size_type t = 0; t < num_tables; ++t) {
+      auto const table = cudf::table_view{{keys[t], values[t]}};
+      auto const order = cudf::stable_sorted_order(
+        cudf::table_view{{keys[t]}}, {cudf::order::ASCENDING}, null_precedence);
+      auto sorted = cudf::gather(table, *order);
+      tables.push_back(sorted->view());
+      sorted_tables.push_back(std::move(sorted));
+    }
+
+    auto const result = cudf::merge(tables, {0}, {cudf::order::ASCENDING}, null_precedence);
+
+    // Rows of equal keys are merged in table order, as by a stable sort of the concatenation
+    auto const all_rows = cudf::concatenate(tables);
+    auto const order    = cudf::stable_sorted_order(
+      all_rows->view().select({0}), {cudf::order::ASCENDING}, null_precedence);
+    auto const expected = cudf::gather(all_rows->view(), *order);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+  }
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
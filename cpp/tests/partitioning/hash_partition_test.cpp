@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/sorting.hpp>
@@ -181,6 +182,30 @@ TEST_F(HashPartition, ColumnsToHash)
                                  second_result->get_column(0).view());
 }
 
+TEST_F(HashPartition, PrecomputedRowHashes)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 4, 5, 6, 7, 8}, {1, 1, 0, 1, 1, 1, 1, 1});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"});
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  auto const input      = cudf::table_view({keys, strings, floats});
+  auto const row_hashes = cudf::hash(input.select({0, 1}));
+
+  // The murmur3 hash values of the rows partition them like hashing their columns
+  for (int num_partitions : {1, 3, 64}) {
+    auto const expected = cudf::hash_partition(input, {0, 1}, num_partitions);
+    auto const result   = cudf::hash_partition(input, row_hashes->view(), num_partitions);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.first->view(), result.first->view());
+    EXPECT_EQ(expected.second, result.second);
+  }
+
+  fixed_width_column_wrapper<int64_t> wrong_type({1, 2, 3, 4, 5, 6, 7, 8});
+  fixed_width_column_wrapper<int32_t> wrong_size({1, 2, 3});
+  fixed_width_column_wrapper<int32_t> nullable({1, 2, 3, 4, 5, 6, 7, 8}, {1, 1, 1, 1, 1, 1, 1, 0});
+  EXPECT_THROW(cudf::hash_partition(input, wrong_type, 3), cudf::logic_error);
+  EXPECT_THROW(cudf::hash_partition(input, wrong_size, 3), cudf::logic_error);
+  EXPECT_THROW(cudf::hash_partition(input, nullable, 3), cudf::logic_error);
+}
+
 TEST_F(HashPartition, IdentityHashFailure)
 {
   fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
@@ -354,6 +379,54 @@ TYPED_TEST(HashPartitionFixedWidth, HasNulls)
   run_fixed_width_test<TypeParam>(10, 1000, 10, cudf::hash_id::HASH_IDENTITY, true);
 }
 
+TEST_F(HashPartition, ManyPartitions)
+{
+  run_fixed_width_test<int32_t>(2, 20000, 3000, cudf::hash_id::HASH_MURMUR3);
+  run_fixed_width_test<int32_t>(2, 20000, 4096, cudf::hash_id::HASH_MURMUR3, true);
+  run_fixed_width_test<int64_t>(1, 50000, 20000, cudf::hash_id::HASH_IDENTITY);
+}
+
+TEST_F(HashPartition, TwoLevelMatchesSingleLevel)
+{
+  constexpr cudf::size_type num_rows = 20000;
+  auto const sequence                = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> keys(sequence, sequence + num_rows);
+  fixed_width_column_wrapper<int32_t> row_ids(sequence, sequence + num_rows);
+  auto const input = cudf::table_view({keys, row_ids});
+
+  // The partition of each input row, found from the row ids of the partitioned table
+  auto const partition_of_rows = [&](int num_partitions) {
+    auto const result = cudf::hash_partition(input, {0}, num_partitions);
+    auto offsets      = result.second;
+    EXPECT_EQ(static_cast<std::size_t>(num_partitions), offsets.size());
+    offsets.push_back(num_rows);
+    auto const ids = cudf::test::to_host<int32_t>(result.first->get_column(1)).first;
+    std::vector<int> partitions(num_rows);
+    for (int p = 0; p < num_partitions; ++p) {
+      for (auto i = offsets[p]; i < offsets[p + 1]; ++i) {
+        partitions[ids[i]] = p;
+      }
+    }
+    return partitions;
+  };
+
+  // With a power of two of partitions, a row of partition p of 4096 is in partition p % 1024 of
+  // 1024
+  auto const single_level = partition_of_rows(1024);
+  auto const two_level    = partition_of_rows(4096);
+  for (cudf::size_type row = 0; row < num_rows; ++row) {
+    EXPECT_EQ(single_level[row], two_level[row] % 1024);
+  }
+}
+
+TEST_F(HashPartition, TooManyPartitions)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3});
+  auto const input = cudf::table_view({keys});
+
+  EXPECT_THROW(cudf::hash_partition(input, {0}, 1024 * 1024 + 1), cudf::logic_error);
+}
+
 TEST_F(HashPartition, FixedPointColumnsToHash)
 {
   fixed_width_column_wrapper<int32_t> to_hash({1});
@@ -377,4 +450,60 @@ TEST_F(HashPartition, FixedPointColumnsToHash)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(first_result->get_column(1).view(), first_input.column(1));
 }
 
+void expect_packed_partitions_equal(cudf::table_view const& input,
+                                    std::vector<cudf::size_type> const& columns_to_hash,
+                                    int num_partitions)
+{
+  auto const [partitioned, offsets] =
+    cudf::hash_partition(input, columns_to_hash, num_partitions);
+  auto const expected = cudf::split(
+    partitioned->view(), std::vector<cudf::size_type>(offsets.begin() + 1, offsets.end()));
+
+  auto const packed = cudf::hash_partition_and_pack(input, columns_to_hash, num_partitions);
+  ASSERT_EQ(packed.size(), expected.size());
+  for (std::size_t i = 0; i < packed.size(); ++i) {
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected[i], packed[i].table);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected[i], cudf::unpack(packed[i].data));
+  }
+}
+
+TEST_F(HashPartition, PackFixedWidth)
+{
+  constexpr cudf::size_type num_rows = 5000;
+  auto const sequence                = thrust::make_counting_iterator(0);
+  auto const valid = thrust::make_transform_iterator(sequence, [](auto i) { return i % 7 != 0; });
+  fixed_width_column_wrapper<int32_t> keys(sequence, sequence + num_rows);
+  fixed_width_column_wrapper<double> doubles(sequence, sequence + num_rows, valid);
+  fixed_width_column_wrapper<int8_t> bytes(sequence, sequence + num_rows);
+  auto const input = cudf::table_view({keys, doubles, bytes});
+
+  // Partitions gathered with copy_block_partitions, or in two levels
+  for (int num_partitions : {1, 7, 64, 2000}) {
+    expect_packed_partitions_equal(input, {0}, num_partitions);
+  }
+  expect_packed_partitions_equal(input, {1, 2}, 5);
+}
+
+TEST_F(HashPartition, PackStrings)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 4, 5, 6, 7, 8}, {1, 1, 0, 1, 1, 1, 0, 1});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"});
+  auto const input = cudf::table_view({keys, strings});
+
+  expect_packed_partitions_equal(input, {0}, 3);
+}
+
+TEST_F(HashPartition, PackEmpty)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  auto const input = cudf::table_view({keys});
+
+  auto const packed = cudf::hash_partition_and_pack(input, {0}, 3);
+  ASSERT_EQ(packed.size(), 3u);
+  for (auto const& partition : packed) {
+    EXPECT_EQ(partition.table.num_rows(), 0);
+  }
+  EXPECT_TRUE(cudf::hash_partition_and_pack(input, {0}, 0).empty());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
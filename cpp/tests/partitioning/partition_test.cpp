@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/table.hpp>
@@ -24,6 +25,13 @@
 
 #include "cudf/sorting.hpp"
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
 template <typename T>
 class PartitionTest : public cudf::test::BaseFixture {
   using value_type = cudf::test::GetType<T, 0>;
@@ -280,3 +288,90 @@ TYPED_TEST(PartitionTestFixedPoint, Partition2)
 
   run_partition_test(cudf::table_view{{input}}, map, 3, cudf::table_view{{expected}}, offsets);
 }
+
+struct RangePartitionTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Checks that the partitions of `input`, each sorted, are the sorted `input`.
+   */
+  void expect_range_partitioned(cudf::table_view const& input,
+                                std::vector<cudf::size_type> const& key_columns,
+                                cudf::size_type num_partitions,
+                                std::vector<cudf::order> const& column_order,
+                                std::vector<cudf::null_order> const& null_precedence)
+  {
+    auto const result   = cudf::range_partition(
+      input, key_columns, num_partitions, column_order, null_precedence);
+    auto const& offsets = result.second;
+    ASSERT_EQ(offsets.size(), static_cast<std::size_t>(num_partitions + 1));
+    EXPECT_EQ(offsets.front(), 0);
+    EXPECT_EQ(offsets.back(), input.num_rows());
+
+    std::vector<std::unique_ptr<cudf::table>> sorted_partitions;
+    std::vector<cudf::table_view> views;
+    for (cudf::size_type i = 0; i < num_partitions; ++i) {
+      auto const partition =
+        cudf::slice(result.first->view(), {offsets[i], offsets[i + 1]}).front();
+      sorted_partitions.push_back(cudf::sort_by_key(
+        partition, partition.select(key_columns), column_order, null_precedence));
+      views.push_back(sorted_partitions.back()->view());
+    }
+    auto const expected =
+      cudf::sort_by_key(input, input.select(key_columns), column_order, null_precedence);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), cudf::concatenate(views)->view());
+  }
+};
+
+TEST_F(RangePartitionTest, MultiColumnKeys)
+{
+  constexpr cudf::size_type num_rows = 5000;
+  auto const rows                    = thrust::make_counting_iterator<cudf::size_type>(0);
+  auto const ints  = thrust::make_transform_iterator(rows, [](auto i) { return (i * 7919) % 500; });
+  auto const valid = thrust::make_transform_iterator(rows, [](auto i) { return i % 11 != 0; });
+  fixed_width_column_wrapper<int32_t> col1(ints, ints + num_rows, valid);
+
+  std::vector<std::string> strings(num_rows);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    strings[i] = "s" + std::to_string(i % 37);
+  }
+  strings_column_wrapper col2(strings.begin(), strings.end());
+  fixed_width_column_wrapper<int32_t> payload(rows, rows + num_rows);
+  cudf::table_view input{{col1, col2, payload}};
+
+  for (cudf::size_type num_partitions : {1, 2, 7, 64}) {
+    expect_range_partitioned(input, {0, 1}, num_partitions, {}, {});
+    expect_range_partitioned(input,
+                             {1, 0},
+                             num_partitions,
+                             {cudf::order::DESCENDING, cudf::order::ASCENDING},
+                             {cudf::null_order::AFTER, cudf::null_order::AFTER});
+  }
+}
+
+TEST_F(RangePartitionTest, EqualKeysInOnePartition)
+{
+  fixed_width_column_wrapper<int32_t> keys{{3, 3, 3, 3, 3, 3, 3, 3}};
+  fixed_width_column_wrapper<int32_t> payload{{0, 1, 2, 3, 4, 5, 6, 7}};
+  cudf::table_view input{{keys, payload}};
+
+  // More partitions than rows
+  auto const result   = cudf::range_partition(input, {0}, 10);
+  auto const& offsets = result.second;
+  ASSERT_EQ(offsets.size(), 11u);
+  EXPECT_EQ(std::count(offsets.begin(), offsets.end(), 0) +
+              std::count(offsets.begin(), offsets.end(), input.num_rows()),
+            11);
+  expect_range_partitioned(input, {0}, 10, {}, {});
+}
+
+TEST_F(RangePartitionTest, EmptyAndInvalid)
+{
+  fixed_width_column_wrapper<int32_t> empty_col{};
+  auto const result = cudf::range_partition(cudf::table_view{{empty_col}}, {0}, 4);
+  EXPECT_TRUE(result.second.empty());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(empty_col, result.first->get_column(0));
+
+  fixed_width_column_wrapper<int32_t> col{{3, 1, 2}};
+  EXPECT_THROW(cudf::range_partition(
+                 cudf::table_view{{col}}, {0}, 2, {cudf::order::ASCENDING, cudf::order::ASCENDING}),
+               cudf::logic_error);
+}
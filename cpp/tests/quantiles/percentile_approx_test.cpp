@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/quantiles.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+namespace {
+/**
+ * @brief Computes the t-digests of the values of every key with a groupby.
+ */
+std::unique_ptr<column> tdigests_of(column_view const& keys,
+                                    column_view const& values,
+                                    int max_centroids = 1000)
+{
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(make_tdigest_aggregation(max_centroids));
+  groupby::groupby gb_obj(table_view({keys}), null_policy::EXCLUDE, sorted::YES);
+  return std::move(gb_obj.aggregate(requests).second[0].results[0]);
+}
+}  // namespace
+
+struct PercentileApproxTest : public BaseFixture {
+};
+
+TEST_F(PercentileApproxTest, Basic)
+{
+  fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  fixed_width_column_wrapper<int32_t> values{3, 1, 10, 4, 5, 9, 2, 6, 8, 7};
+  auto const digests = tdigests_of(keys, values);
+
+  fixed_width_column_wrapper<double> percentiles{0, 0.25, 0.5, 0.9, 1};
+  auto const result = percentile_approx(lists_column_view(*digests), percentiles);
+
+  lists_column_wrapper<double> expected{{1, 3, 5.5, 9.5, 10}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
+}
+
+TEST_F(PercentileApproxTest, EmptyAndNullDigests)
+{
+  fixed_width_column_wrapper<double> means{1, 2, 3};
+  fixed_width_column_wrapper<double> weights{1, 1, 1};
+  structs_column_wrapper centroids{{means, weights}};
+  fixed_width_column_wrapper<offset_type> offsets{0, 3, 3, 3};
+  auto const digests = make_lists_column(3,
+                                         offsets.release(),
+                                         centroids.release(),
+                                         1,
+                                         create_null_mask(3, mask_state::ALL_VALID));
+  set_null_mask(digests->mutable_view().null_mask(), 2, 3, false);
+
+  fixed_width_column_wrapper<double> percentiles{0.5};
+  auto const result = percentile_approx(lists_column_view(*digests), percentiles);
+
+  std::vector<bool> validity{1, 0, 0};
+  lists_column_wrapper<double> expected({{2}, {}, {}}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
+}
+
+TEST_F(PercentileApproxTest, Accuracy)
+{
+  // Two groups of 50000 evenly spread values
+  constexpr size_type num_rows = 100000;
+  auto keys_iter = detail::make_counting_transform_iterator(0, [](auto i) { return i / 50000; });
+  auto vals_iter = detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<double>((i * 7919) % 50000); });
+  fixed_width_column_wrapper<int32_t> keys(keys_iter, keys_iter + num_rows);
+  fixed_width_column_wrapper<double> values(vals_iter, vals_iter + num_rows);
+  auto const digests = tdigests_of(keys, values);
+
+  std::vector<double> const p{0.001, 0.01, 0.5, 0.99, 0.999};
+  fixed_width_column_wrapper<double> percentiles(p.begin(), p.end());
+  auto const result = percentile_approx(lists_column_view(*digests), percentiles);
+
+  auto const estimates =
+    to_host<double>(lists_column_view(*result).get_sliced_child(rmm::cuda_stream_default)).first;
+  ASSERT_EQ(estimates.size(), 2 * p.size());
+  for (size_t i = 0; i < estimates.size(); ++i) {
+    EXPECT_NEAR(estimates[i], p[i % p.size()] * 49999, 50);
+  }
+}
+
+TEST_F(PercentileApproxTest, MergedDigests)
+{
+  // The digests of two halves of the values merge into the digest of all of them
+  fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+  fixed_width_column_wrapper<int32_t> values{3, 1, 10, 4, 5, 9, 2, 6, 8, 7};
+  auto const partial_digests = tdigests_of(keys, values);
+
+  fixed_width_column_wrapper<int32_t> merge_keys{0, 0};
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = *partial_digests;
+  requests[0].aggregations.push_back(make_merge_tdigest_aggregation());
+  groupby::groupby gb_obj(table_view({merge_keys}));
+  auto const merged = std::move(gb_obj.aggregate(requests).second[0].results[0]);
+
+  fixed_width_column_wrapper<double> percentiles{0, 0.5, 1};
+  auto const result = percentile_approx(lists_column_view(*merged), percentiles);
+
+  lists_column_wrapper<double> expected{{1, 5.5, 10}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
+}
+
+TEST_F(PercentileApproxTest, Reduction)
+{
+  fixed_width_column_wrapper<int32_t> values({3, 1, 10, 4, 5}, {1, 1, 1, 0, 1});
+
+  auto const digest = reduce(values, make_tdigest_aggregation(3), data_type{type_id::LIST});
+  ASSERT_TRUE(digest->is_valid());
+
+  fixed_width_column_wrapper<double> expect_means{1, 4, 10};
+  fixed_width_column_wrapper<double> expect_weights{1, 2, 1};
+  structs_column_wrapper expect_centroids{{expect_means, expect_weights}};
+  auto const centroids = static_cast<list_scalar const*>(digest.get())->view();
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(centroids, expect_centroids);
+}
+
+TEST_F(PercentileApproxTest, InvalidInput)
+{
+  fixed_width_column_wrapper<int32_t> keys{0, 0};
+  fixed_width_column_wrapper<int32_t> values{1, 2};
+  auto const digests = tdigests_of(keys, values);
+
+  fixed_width_column_wrapper<float> float_percentiles{0.5};
+  EXPECT_THROW(percentile_approx(lists_column_view(*digests), float_percentiles),
+               cudf::logic_error);
+
+  lists_column_wrapper<double> not_digests{{1, 2}};
+  fixed_width_column_wrapper<double> percentiles{0.5};
+  EXPECT_THROW(percentile_approx(lists_column_view(not_digests), percentiles), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -14,8 +14,11 @@
  * limitations under the License.
  */
 
+#include <cudf/copying.hpp>
 #include <cudf/quantiles.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -470,6 +473,57 @@ TEST_F(QuantileDictionaryTest, TestValid)
                                       fixed_width_column_wrapper<double>{3.5, 5.5, 7.5});
 };
 
+struct QuantileTableTest : public BaseFixture {
+};
+
+TEST_F(QuantileTableTest, MatchesQuantilesOfColumns)
+{
+  fixed_width_column_wrapper<int32_t> ints0({7, 3, 0, 9, 1, 4}, {1, 1, 0, 1, 1, 1});
+  fixed_width_column_wrapper<double> doubles({2.5, -1.0, 8.0, 0.5, 3.0, 6.0});
+  fixed_width_column_wrapper<int32_t> ints1({5, 2, 8, 1, 0, 6});
+  fixed_width_column_wrapper<int32_t> nulls({1, 2, 3, 4, 5, 6}, {0, 0, 0, 0, 0, 0});
+  dictionary_column_wrapper<int32_t> dictionary({4, 2, 8, 6, 2, 1});
+  cudf::table_view const input({ints0, doubles, ints1, nulls, dictionary});
+  std::vector<double> const q{0, 0.1, 0.25, 0.5, 0.9, 1};
+
+  for (auto const interp : {cudf::interpolation::LINEAR, cudf::interpolation::NEAREST}) {
+    for (auto const exact : {true, false}) {
+      auto const result = cudf::quantile(input, q, interp, cudf::sorted::NO, {}, exact);
+      ASSERT_EQ(input.num_columns(), result->num_columns());
+      for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+        auto const col = input.column(i);
+        auto const sorted_order =
+          cudf::sorted_order(cudf::table_view{{col}}, {}, {null_order::AFTER});
+        auto const valid_order =
+          cudf::slice(sorted_order->view(), {0, col.size() - col.null_count()})[0];
+        auto const expected = cudf::quantile(col, q, interp, valid_order, exact);
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->get_column(i).view());
+      }
+    }
+  }
+}
+
+TEST_F(QuantileTableTest, SortedInput)
+{
+  fixed_width_column_wrapper<int32_t> nulls_before({0, 0, 1, 2, 3, 4}, {0, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> nulls_after({1, 2, 3, 4, 0, 0}, {1, 1, 1, 1, 0, 0});
+  cudf::table_view const input({nulls_before, nulls_after});
+
+  auto const result = cudf::quantile(input,
+                                     {0, 0.5, 1},
+                                     cudf::interpolation::LINEAR,
+                                     cudf::sorted::YES,
+                                     {null_order::BEFORE, null_order::AFTER});
+  fixed_width_column_wrapper<double> expected0{1, 2.5, 4};
+  fixed_width_column_wrapper<double> expected1{1, 2.5, 4};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected0, result->get_column(0).view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected1, result->get_column(1).view());
+
+  EXPECT_THROW(cudf::quantile(
+                 input, {0.5}, cudf::interpolation::LINEAR, cudf::sorted::YES, {null_order::AFTER}),
+               cudf::logic_error);
+}
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
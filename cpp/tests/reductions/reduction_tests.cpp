@@ -15,15 +15,22 @@
  */
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/dictionary/encode.hpp>
+#include <cudf/filling.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/reduction.hpp>
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
@@ -31,6 +38,8 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <iostream>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 using aggregation = cudf::aggregation;
@@ -1023,6 +1032,73 @@ TYPED_TEST(ReductionTest, UniqueCount)
                        cudf::make_nunique_aggregation(cudf::null_policy::EXCLUDE));
 }
 
+TYPED_TEST(ReductionTest, ApproxUniqueCount)
+{
+  using T = TypeParam;
+  std::vector<int> int_values({1, -3, 1, 2, 0, 2, -4, 45});  // 6 unique values
+  std::vector<bool> host_bools({1, 1, 1, 0, 1, 1, 1, 1});
+  std::vector<T> v = convert_values<T>(int_values);
+
+  auto const output_dtype = cudf::data_type{cudf::type_id::INT64};
+
+  // small cardinalities are estimated exactly
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  int64_t expected_value = std::is_same<T, bool>::value ? 2 : 6;
+  this->reduction_test(col,
+                       expected_value,
+                       true,
+                       cudf::make_approx_nunique_aggregation(cudf::null_policy::EXCLUDE),
+                       output_dtype);
+
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  int64_t expected_null_value0                        = std::is_same<T, bool>::value ? 3 : 7;
+  int64_t expected_null_value1                        = std::is_same<T, bool>::value ? 2 : 6;
+  this->reduction_test(col_nulls,
+                       expected_null_value0,
+                       true,
+                       cudf::make_approx_nunique_aggregation(cudf::null_policy::INCLUDE),
+                       output_dtype);
+  this->reduction_test(col_nulls,
+                       expected_null_value1,
+                       true,
+                       cudf::make_approx_nunique_aggregation(cudf::null_policy::EXCLUDE),
+                       output_dtype);
+}
+
+struct ReductionNuniqueSketchTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReductionNuniqueSketchTest, MergeSketches)
+{
+  // 10000 distinct values, every value repeated three times
+  constexpr cudf::size_type num_rows = 30000;
+  auto vals_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10000; });
+  cudf::test::fixed_width_column_wrapper<int64_t> vals(vals_iter, vals_iter + num_rows);
+  auto const list_dtype   = cudf::data_type{cudf::type_id::LIST};
+  auto const output_dtype = cudf::data_type{cudf::type_id::INT64};
+
+  auto const direct = cudf::reduce(vals, cudf::make_approx_nunique_aggregation(), output_dtype);
+
+  // the sketches of the halves of the column are merged into the sketch of the whole column
+  auto const halves = cudf::split(vals, {12345});
+  std::vector<std::unique_ptr<cudf::column>> sketches;
+  for (auto const& half : halves) {
+    auto const sketch = cudf::reduce(half, cudf::make_nunique_sketch_aggregation(), list_dtype);
+    EXPECT_EQ(static_cast<cudf::list_scalar const*>(sketch.get())->view().size(), 1 << 12);
+    sketches.push_back(cudf::make_column_from_scalar(*sketch, 1));
+  }
+  auto const merged_sketches =
+    cudf::concatenate(std::vector<cudf::column_view>{sketches[0]->view(), sketches[1]->view()});
+  auto const merged =
+    cudf::reduce(*merged_sketches, cudf::make_merge_nunique_aggregation(), output_dtype);
+
+  using ScalarType         = cudf::scalar_type_t<int64_t>;
+  auto const direct_value = static_cast<ScalarType const*>(direct.get())->value();
+  EXPECT_EQ(direct_value, static_cast<ScalarType const*>(merged.get())->value());
+  EXPECT_NEAR(direct_value, 10000, 500);
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -1387,6 +1463,37 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointReductionNthElement)
   }
 }
 
+struct FixedPointTest128 : public cudf::test::BaseFixture {
+};
+
+TEST_F(FixedPointTest128, FixedPointReductionSumMinMaxBeyond64Bits)
+{
+  using namespace numeric;
+  using RepType    = __int128_t;
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<RepType>;
+
+  // 10^21 does not fit in the 64-bit representation of decimal64
+  auto const big = static_cast<RepType>(1'000'000'000'000'000'000) * 1000;
+
+  for (auto const i : {0, -1, -2, -3}) {
+    auto const scale    = scale_type{i};
+    auto const column   = fp_wrapper{{big, -big, 3, big * 7, 0}, {1, 1, 1, 1, 0}, scale};
+    auto const out_type = static_cast<cudf::column_view>(column).type();
+    EXPECT_EQ(out_type, (cudf::data_type{cudf::type_id::DECIMAL128, i}));
+
+    auto const sum = cudf::reduce(column, cudf::make_sum_aggregation(), out_type);
+    auto const min = cudf::reduce(column, cudf::make_min_aggregation(), out_type);
+    auto const max = cudf::reduce(column, cudf::make_max_aggregation(), out_type);
+
+    EXPECT_EQ(static_cast<cudf::scalar_type_t<decimal128> *>(sum.get())->fixed_point_value(),
+              (decimal128{scaled_integer<RepType>{big * 7 + 3, scale}}));
+    EXPECT_EQ(static_cast<cudf::scalar_type_t<decimal128> *>(min.get())->fixed_point_value(),
+              (decimal128{scaled_integer<RepType>{-big, scale}}));
+    EXPECT_EQ(static_cast<cudf::scalar_type_t<decimal128> *>(max.get())->fixed_point_value(),
+              (decimal128{scaled_integer<RepType>{big * 7, scale}}));
+  }
+}
+
 TYPED_TEST(ReductionTest, NthElement)
 {
   using T = TypeParam;
@@ -1851,4 +1958,233 @@ TYPED_TEST(DictionaryReductionTest, Quantile)
                        output_type);
 }
 
+struct ChunkedReductionTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Checks that reducing the chunks of `col` split at `splits` matches reducing `col`.
+   */
+  template <typename T>
+  void expect_chunked_reduce_equal(cudf::column_view const &col,
+                                   std::vector<cudf::size_type> const &splits,
+                                   std::unique_ptr<aggregation> const &agg,
+                                   cudf::data_type output_type)
+  {
+    cudf::chunked_column_view chunked_col(cudf::split(col, splits));
+    auto const expected = cudf::reduce(col, agg, output_type);
+    auto const result   = cudf::reduce(chunked_col, agg, output_type);
+    ASSERT_EQ(expected->is_valid(), result->is_valid());
+    if (not expected->is_valid()) { return; }
+    using ScalarType = cudf::scalar_type_t<T>;
+    EXPECT_EQ(static_cast<ScalarType *>(expected.get())->value(),
+              static_cast<ScalarType *>(result.get())->value());
+  }
+};
+
+TEST_F(ChunkedReductionTest, MatchesReductionOfConcatenatedChunks)
+{
+  auto const int64_type  = cudf::data_type(cudf::type_id::INT64);
+  auto const double_type = cudf::data_type(cudf::type_id::FLOAT64);
+  auto const bool_type   = cudf::data_type(cudf::type_id::BOOL8);
+
+  // The second chunk only has nulls and the third is empty
+  cudf::test::fixed_width_column_wrapper<int32_t> col({3, 7, 0, 0, 2, 9, -4, 1, 5, 6},
+                                                      {1, 1, 0, 0, 1, 1, 1, 1, 1, 1});
+  std::vector<cudf::size_type> const splits{2, 4, 4, 7};
+  expect_chunked_reduce_equal<int64_t>(col, splits, cudf::make_sum_aggregation(), int64_type);
+  expect_chunked_reduce_equal<int64_t>(col, splits, cudf::make_product_aggregation(), int64_type);
+  expect_chunked_reduce_equal<int64_t>(
+    col, splits, cudf::make_sum_of_squares_aggregation(), int64_type);
+  expect_chunked_reduce_equal<int32_t>(
+    col, splits, cudf::make_min_aggregation(), cudf::data_type(cudf::type_id::INT32));
+  expect_chunked_reduce_equal<int32_t>(
+    col, splits, cudf::make_max_aggregation(), cudf::data_type(cudf::type_id::INT32));
+  expect_chunked_reduce_equal<bool>(col, splits, cudf::make_any_aggregation(), bool_type);
+  expect_chunked_reduce_equal<bool>(col, splits, cudf::make_all_aggregation(), bool_type);
+  // Aggregations reducing the concatenated chunks
+  expect_chunked_reduce_equal<double>(col, splits, cudf::make_mean_aggregation(), double_type);
+  expect_chunked_reduce_equal<double>(col, splits, cudf::make_variance_aggregation(), double_type);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> null_col({1, 2, 3, 4}, {0, 0, 0, 0});
+  expect_chunked_reduce_equal<int64_t>(null_col, {2}, cudf::make_sum_aggregation(), int64_type);
+}
+
+TEST_F(ChunkedReductionTest, Strings)
+{
+  cudf::test::strings_column_wrapper col({"one", "two", "three", "four", "five"},
+                                         {1, 1, 0, 1, 1});
+  cudf::chunked_column_view chunked_col(cudf::split(col, {2, 3}));
+  auto const string_type = cudf::data_type(cudf::type_id::STRING);
+
+  auto result = cudf::reduce(chunked_col, cudf::make_min_aggregation(), string_type);
+  EXPECT_EQ(static_cast<cudf::string_scalar *>(result.get())->to_string(), "five");
+  result = cudf::reduce(chunked_col, cudf::make_max_aggregation(), string_type);
+  EXPECT_EQ(static_cast<cudf::string_scalar *>(result.get())->to_string(), "two");
+}
+
+struct TableReductionTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Checks that the result of the request `idx` of a table reduction is the one of
+   * reducing its column alone.
+   */
+  template <typename T>
+  void expect_request_result_equal(cudf::table_view const &table,
+                                   std::vector<cudf::reduction_request> const &requests,
+                                   std::vector<std::unique_ptr<cudf::scalar>> const &results,
+                                   std::size_t idx)
+  {
+    auto const &request = requests[idx];
+    auto const expected =
+      cudf::reduce(table.column(request.column_index), request.agg, request.output_dtype);
+    ASSERT_EQ(expected->type(), results[idx]->type());
+    ASSERT_EQ(expected->is_valid(), results[idx]->is_valid());
+    if (not expected->is_valid()) { return; }
+    using ScalarType          = cudf::scalar_type_t<T>;
+    auto const expected_value = static_cast<ScalarType *>(expected.get())->value();
+    auto const result_value   = static_cast<ScalarType *>(results[idx].get())->value();
+    if constexpr (std::is_floating_point<T>::value) {
+      EXPECT_DOUBLE_EQ(expected_value, result_value);
+    } else {
+      EXPECT_EQ(expected_value, result_value);
+    }
+  }
+};
+
+TEST_F(TableReductionTest, MatchesReductionsOfColumns)
+{
+  auto const int32_type  = cudf::data_type(cudf::type_id::INT32);
+  auto const int64_type  = cudf::data_type(cudf::type_id::INT64);
+  auto const double_type = cudf::data_type(cudf::type_id::FLOAT64);
+  auto const bool_type   = cudf::data_type(cudf::type_id::BOOL8);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({3, 7, 0, 0, 2, 9, -4, 1},
+                                                       {1, 1, 0, 1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles(
+    {1.5, -2.0, 4.25, 0.5, 8.0, 3.0, 2.5, 6.0});
+  cudf::test::strings_column_wrapper strings(
+    {"one", "two", "three", "four", "five", "six", "seven", "eight"});
+  cudf::table_view const table({ints, doubles, strings});
+
+  std::vector<cudf::reduction_request> requests;
+  requests.push_back({0, cudf::make_sum_aggregation(), int64_type});
+  requests.push_back({1, cudf::make_max_aggregation(), double_type});
+  requests.push_back({0, cudf::make_min_aggregation(), int32_type});
+  requests.push_back({0, cudf::make_max_aggregation(), int32_type});
+  requests.push_back({0, cudf::make_any_aggregation(), bool_type});
+  requests.push_back({0, cudf::make_all_aggregation(), bool_type});
+  requests.push_back({0, cudf::make_sum_of_squares_aggregation(), int64_type});
+  requests.push_back({0, cudf::make_mean_aggregation(), double_type});
+  requests.push_back({0, cudf::make_variance_aggregation(1), double_type});
+  requests.push_back({0, cudf::make_std_aggregation(0), double_type});
+  requests.push_back({1, cudf::make_sum_aggregation(), double_type});
+  requests.push_back({1, cudf::make_sum_of_squares_aggregation(), double_type});
+  requests.push_back({1, cudf::make_min_aggregation(), double_type});
+  // requests reduced one at a time
+  requests.push_back({0, cudf::make_product_aggregation(), int64_type});
+  requests.push_back({1, cudf::make_median_aggregation(), double_type});
+
+  auto const results = cudf::reduce(table, requests);
+  ASSERT_EQ(requests.size(), results.size());
+  expect_request_result_equal<int64_t>(table, requests, results, 0);
+  expect_request_result_equal<double>(table, requests, results, 1);
+  expect_request_result_equal<int32_t>(table, requests, results, 2);
+  expect_request_result_equal<int32_t>(table, requests, results, 3);
+  expect_request_result_equal<bool>(table, requests, results, 4);
+  expect_request_result_equal<bool>(table, requests, results, 5);
+  expect_request_result_equal<int64_t>(table, requests, results, 6);
+  for (std::size_t idx = 7; idx < 13; ++idx) {
+    expect_request_result_equal<double>(table, requests, results, idx);
+  }
+  expect_request_result_equal<int64_t>(table, requests, results, 13);
+  expect_request_result_equal<double>(table, requests, results, 14);
+
+  std::vector<cudf::reduction_request> string_requests;
+  string_requests.push_back(
+    {2, cudf::make_min_aggregation(), cudf::data_type(cudf::type_id::STRING)});
+  auto const string_results = cudf::reduce(table, string_requests);
+  EXPECT_EQ(static_cast<cudf::string_scalar *>(string_results[0].get())->to_string(), "eight");
+}
+
+TEST_F(TableReductionTest, NullAndEmptyColumns)
+{
+  cudf::test::fixed_width_column_wrapper<float> nulls({1, 2, 3}, {0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<float> empty{};
+  auto const nulls_table = cudf::table_view({nulls});
+  auto const empty_table = cudf::table_view({empty});
+
+  for (auto const &table : {nulls_table, empty_table}) {
+    std::vector<cudf::reduction_request> requests;
+    requests.push_back({0, cudf::make_sum_aggregation(), cudf::data_type(cudf::type_id::FLOAT64)});
+    requests.push_back({0, cudf::make_min_aggregation(), cudf::data_type(cudf::type_id::FLOAT32)});
+    requests.push_back({0, cudf::make_mean_aggregation(), cudf::data_type(cudf::type_id::FLOAT32)});
+    requests.push_back({0, cudf::make_all_aggregation(), cudf::data_type(cudf::type_id::BOOL8)});
+    auto const results = cudf::reduce(table, requests);
+    ASSERT_EQ(requests.size(), results.size());
+    for (auto const &result : results) {
+      EXPECT_FALSE(result->is_valid());
+    }
+  }
+}
+
+TEST_F(TableReductionTest, ErrorHandling)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3});
+  cudf::table_view const table({col});
+  auto const int64_type = cudf::data_type(cudf::type_id::INT64);
+
+  std::vector<cudf::reduction_request> requests;
+  requests.push_back({1, cudf::make_sum_aggregation(), int64_type});
+  EXPECT_THROW(cudf::reduce(table, requests), cudf::logic_error);
+
+  requests.clear();
+  requests.push_back({0, cudf::make_sum_aggregation(), int64_type});
+  requests.push_back({0, cudf::make_max_aggregation(), int64_type});
+  EXPECT_THROW(cudf::reduce(table, requests), cudf::logic_error);
+}
+
+struct ReductionResultTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReductionResultTest, NormalizeWithReductionResults)
+{
+  auto const float64 = cudf::data_type{cudf::type_id::FLOAT64};
+  cudf::test::fixed_width_column_wrapper<double> col{2, 4, 6, 8};
+
+  // the reduction results are consumed on the device, their validity being known on the host
+  auto const mean = cudf::reduce(col, cudf::make_mean_aggregation(), float64);
+  EXPECT_TRUE(mean->is_valid());
+
+  auto const centered = cudf::binary_operation(col, *mean, cudf::binary_operator::SUB, float64);
+  auto const result =
+    cudf::binary_operation(centered->view(), *mean, cudf::binary_operator::DIV, float64);
+  cudf::test::fixed_width_column_wrapper<double> expected{
+    -3.0 / 5.0, -1.0 / 5.0, 1.0 / 5.0, 3.0 / 5.0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+
+  auto const filled = cudf::fill(col, 1, 3, *mean);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::fixed_width_column_wrapper<double>{2, 5, 5, 8},
+                                 *filled);
+
+  // the cast of the result to another type keeps the validity on the host
+  auto const sum =
+    cudf::reduce(col, cudf::make_sum_aggregation(), cudf::data_type{cudf::type_id::INT64});
+  EXPECT_TRUE(sum->is_valid());
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int64_t>*>(sum.get())->value(), 20);
+}
+
+TEST_F(ReductionResultTest, NullReductionResult)
+{
+  auto const float64 = cudf::data_type{cudf::type_id::FLOAT64};
+  cudf::test::fixed_width_column_wrapper<double> nulls({2, 4, 6}, {0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<double> col{1, 2, 3};
+
+  auto const mean = cudf::reduce(nulls, cudf::make_mean_aggregation(), float64);
+  EXPECT_FALSE(mean->is_valid());
+
+  auto const result = cudf::binary_operation(col, *mean, cudf::binary_operator::SUB, float64);
+  EXPECT_EQ(result->null_count(), 3);
+
+  auto const filled = cudf::fill(col, 0, 2, *mean);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<double>({1, 2, 3}, {0, 0, 1}), *filled);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -27,8 +27,13 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/reduction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+
+#include <rmm/device_uvector.hpp>
 using aggregation = cudf::aggregation;
 using cudf::column_view;
 using cudf::null_policy;
@@ -595,3 +600,106 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointScanMax)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_nulls->view(), with_nulls);
   }
 }
+
+TYPED_TEST(ScanTest, ExclusiveIncludeNulls)
+{
+  auto const v = cudf::test::make_type_param_vector<TypeParam>({1, 2, 3, 4, 5});
+  auto const b = std::vector<bool>{1, 1, 0, 1, 1};
+  cudf::test::fixed_width_column_wrapper<TypeParam> const col_in(v.begin(), v.end(), b.begin());
+
+  // the exclusive scan of a row only includes the null rows before it
+  auto const out_v = cudf::test::make_type_param_vector<TypeParam>({0, 1, 3, 3, 7});
+  auto const out_b = std::vector<bool>{1, 1, 1, 0, 0};
+  cudf::test::fixed_width_column_wrapper<TypeParam> const expected(
+    out_v.begin(), out_v.end(), out_b.begin());
+
+  auto const col_out =
+    cudf::scan(col_in, cudf::make_sum_aggregation(), scan_type::EXCLUSIVE, null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, col_out->view());
+}
+
+struct TableScanTest : public cudf::test::BaseFixture {
+  void expect_scans_equal(cudf::table_view const& input,
+                          std::unique_ptr<aggregation> const& agg,
+                          scan_type inclusive,
+                          null_policy null_handling)
+  {
+    auto const result = cudf::scan(input, agg, inclusive, null_handling);
+    ASSERT_EQ(input.num_columns(), result->num_columns());
+    for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+      auto const expected = cudf::scan(input.column(i), agg, inclusive, null_handling);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result->get_column(i).view());
+    }
+  }
+};
+
+TEST_F(TableScanTest, MatchesScansOfColumns)
+{
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<int32_t>;
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints0({3, 7, 0, 2, 9, -4}, {1, 1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles({1.5, -2.0, 4.25, 0.5, 8.0, 3.0});
+  cudf::test::fixed_width_column_wrapper<int32_t> ints1({-1, 5, 6, 0, 2, 8});
+  auto const decimals = fp_wrapper({1, 2, 3, 4, 5, 6}, {1, 1, 1, 0, 1, 1}, numeric::scale_type{-1});
+  cudf::table_view const input({ints0, doubles, ints1, decimals});
+
+  for (auto const inclusive : {scan_type::INCLUSIVE, scan_type::EXCLUSIVE}) {
+    for (auto const null_handling : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+      expect_scans_equal(input, cudf::make_sum_aggregation(), inclusive, null_handling);
+      expect_scans_equal(input, cudf::make_min_aggregation(), inclusive, null_handling);
+      expect_scans_equal(input, cudf::make_max_aggregation(), inclusive, null_handling);
+    }
+  }
+  cudf::table_view const arithmetic({ints0, doubles, ints1});
+  expect_scans_equal(
+    arithmetic, cudf::make_product_aggregation(), scan_type::INCLUSIVE, null_policy::EXCLUDE);
+}
+
+TEST_F(TableScanTest, Empty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{};
+  cudf::test::fixed_width_column_wrapper<float> floats{};
+  cudf::table_view const input({ints, floats});
+  expect_scans_equal(
+    input, cudf::make_sum_aggregation(), scan_type::INCLUSIVE, null_policy::EXCLUDE);
+  expect_scans_equal(
+    input, cudf::make_sum_aggregation(), scan_type::EXCLUSIVE, null_policy::INCLUDE);
+}
+
+struct SegmentedScanTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedScanTest, SumMinMax)
+{
+  // the second segment is empty
+  cudf::test::fixed_width_column_wrapper<int32_t> const input({1, 2, 3, 4, 5, 6, 7},
+                                                              {1, 1, 1, 0, 1, 1, 1});
+  auto const offsets =
+    cudf::detail::make_device_uvector_sync(std::vector<cudf::size_type>{0, 2, 2, 5, 7});
+
+  cudf::test::fixed_width_column_wrapper<int64_t> const expected_sum({1, 3, 3, 0, 8, 6, 13},
+                                                                     {1, 1, 1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> const expected_min({1, 1, 3, 0, 3, 6, 6},
+                                                                     {1, 1, 1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> const expected_max({1, 2, 3, 0, 5, 6, 7},
+                                                                     {1, 1, 1, 0, 1, 1, 1});
+
+  auto result = cudf::segmented_scan(input, offsets, cudf::make_sum_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sum, result->view());
+  result = cudf::segmented_scan(input, offsets, cudf::make_min_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_min, result->view());
+  result = cudf::segmented_scan(input, offsets, cudf::make_max_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_max, result->view());
+}
+
+TEST_F(SegmentedScanTest, ErrorHandling)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const input({1, 2, 3});
+  auto const empty_offsets = rmm::device_uvector<cudf::size_type>(0, rmm::cuda_stream_default);
+  EXPECT_THROW(cudf::segmented_scan(input, empty_offsets, cudf::make_sum_aggregation()),
+               cudf::logic_error);
+
+  auto const offsets = cudf::detail::make_device_uvector_sync(std::vector<cudf::size_type>{0, 3});
+  EXPECT_THROW(cudf::segmented_scan(input, offsets, cudf::make_product_aggregation()),
+               cudf::logic_error);
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <vector>
+
+using cudf::size_type;
+using cudf::test::fixed_width_column_wrapper;
+
+template <typename T>
+struct SegmentedReductionTest : public cudf::test::BaseFixture {
+  // segments: {1, 2, 3}, {1, null, 3}, {}, {1, null}, {null}, {9}
+  static fixed_width_column_wrapper<T> input()
+  {
+    return fixed_width_column_wrapper<T>({1, 2, 3, 1, 0, 3, 1, 0, 0, 9},
+                                         {1, 1, 1, 1, 0, 1, 1, 0, 0, 1});
+  }
+
+  static rmm::device_uvector<size_type> offsets()
+  {
+    return cudf::detail::make_device_uvector_sync(std::vector<size_type>{0, 3, 6, 6, 8, 9, 10});
+  }
+};
+
+using SegmentedReductionTypes =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+
+TYPED_TEST_CASE(SegmentedReductionTest, SegmentedReductionTypes);
+
+TYPED_TEST(SegmentedReductionTest, SumMinMaxExcludeNulls)
+{
+  using T = TypeParam;
+
+  auto const input   = this->input();
+  auto const offsets = this->offsets();
+  auto const dtype   = cudf::data_type{cudf::type_to_id<T>()};
+
+  fixed_width_column_wrapper<T> expected_sum({6, 4, 0, 1, 0, 9}, {1, 1, 0, 1, 0, 1});
+  fixed_width_column_wrapper<T> expected_min({1, 1, 0, 1, 0, 9}, {1, 1, 0, 1, 0, 1});
+  fixed_width_column_wrapper<T> expected_max({3, 3, 0, 1, 0, 9}, {1, 1, 0, 1, 0, 1});
+
+  auto const sum = cudf::segmented_reduce(
+    input, offsets, cudf::make_sum_aggregation(), dtype, cudf::null_policy::EXCLUDE);
+  auto const min = cudf::segmented_reduce(
+    input, offsets, cudf::make_min_aggregation(), dtype, cudf::null_policy::EXCLUDE);
+  auto const max = cudf::segmented_reduce(
+    input, offsets, cudf::make_max_aggregation(), dtype, cudf::null_policy::EXCLUDE);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sum, sum->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_min, min->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_max, max->view());
+}
+
+TYPED_TEST(SegmentedReductionTest, SumMinMaxIncludeNulls)
+{
+  using T = TypeParam;
+
+  auto const input   = this->input();
+  auto const offsets = this->offsets();
+  auto const dtype   = cudf::data_type{cudf::type_to_id<T>()};
+
+  fixed_width_column_wrapper<T> expected_sum({6, 0, 0, 0, 0, 9}, {1, 0, 0, 0, 0, 1});
+  fixed_width_column_wrapper<T> expected_min({1, 0, 0, 0, 0, 9}, {1, 0, 0, 0, 0, 1});
+  fixed_width_column_wrapper<T> expected_max({3, 0, 0, 0, 0, 9}, {1, 0, 0, 0, 0, 1});
+
+  auto const sum = cudf::segmented_reduce(
+    input, offsets, cudf::make_sum_aggregation(), dtype, cudf::null_policy::INCLUDE);
+  auto const min = cudf::segmented_reduce(
+    input, offsets, cudf::make_min_aggregation(), dtype, cudf::null_policy::INCLUDE);
+  auto const max = cudf::segmented_reduce(
+    input, offsets, cudf::make_max_aggregation(), dtype, cudf::null_policy::INCLUDE);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sum, sum->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_min, min->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_max, max->view());
+}
+
+TYPED_TEST(SegmentedReductionTest, SumMean)
+{
+  using T = TypeParam;
+
+  auto const input   = this->input();
+  auto const offsets = this->offsets();
+
+  fixed_width_column_wrapper<double> expected_sum({6, 4, 0, 1, 0, 9}, {1, 1, 0, 1, 0, 1});
+  fixed_width_column_wrapper<double> expected_mean({2, 2, 0, 1, 0, 9}, {1, 1, 0, 1, 0, 1});
+
+  auto const sum  = cudf::segmented_reduce(input,
+                                          offsets,
+                                          cudf::make_sum_aggregation(),
+                                          cudf::data_type{cudf::type_id::FLOAT64},
+                                          cudf::null_policy::EXCLUDE);
+  auto const mean = cudf::segmented_reduce(input,
+                                           offsets,
+                                           cudf::make_mean_aggregation(),
+                                           cudf::data_type{cudf::type_id::FLOAT64},
+                                           cudf::null_policy::EXCLUDE);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sum, sum->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_mean, mean->view());
+}
+
+TYPED_TEST(SegmentedReductionTest, AnyAll)
+{
+  using T = TypeParam;
+
+  // segments: {0, 0, 1}, {1, 1, null}, {0, 0}
+  fixed_width_column_wrapper<T> input({0, 0, 1, 1, 1, 0, 0, 0}, {1, 1, 1, 1, 1, 0, 1, 1});
+  auto const offsets = cudf::detail::make_device_uvector_sync(std::vector<size_type>{0, 3, 6, 8});
+  auto const dtype   = cudf::data_type{cudf::type_id::BOOL8};
+
+  fixed_width_column_wrapper<bool> expected_any({true, true, false});
+  fixed_width_column_wrapper<bool> expected_all({false, true, false});
+  fixed_width_column_wrapper<bool> expected_any_include_nulls({true, false, false}, {1, 0, 1});
+
+  auto const any = cudf::segmented_reduce(
+    input, offsets, cudf::make_any_aggregation(), dtype, cudf::null_policy::EXCLUDE);
+  auto const all = cudf::segmented_reduce(
+    input, offsets, cudf::make_all_aggregation(), dtype, cudf::null_policy::EXCLUDE);
+  auto const any_include_nulls = cudf::segmented_reduce(
+    input, offsets, cudf::make_any_aggregation(), dtype, cudf::null_policy::INCLUDE);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_any, any->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_all, all->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_any_include_nulls, any_include_nulls->view());
+}
+
+struct SegmentedReductionTestUntyped : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedReductionTestUntyped, ListRows)
+{
+  cudf::test::lists_column_wrapper<int32_t> input{{1, 2, 3}, {}, {4, 5}, {6}};
+  auto const lists = cudf::lists_column_view(input);
+  auto const offsets =
+    cudf::device_span<size_type const>(lists.offsets().data<size_type>(), lists.size() + 1);
+
+  fixed_width_column_wrapper<int64_t> expected({6, 0, 9, 6}, {1, 0, 1, 1});
+
+  auto const sum = cudf::segmented_reduce(lists.child(),
+                                          offsets,
+                                          cudf::make_sum_aggregation(),
+                                          cudf::data_type{cudf::type_id::INT64},
+                                          cudf::null_policy::EXCLUDE);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, sum->view());
+}
+
+TEST_F(SegmentedReductionTestUntyped, DecimalMinMax)
+{
+  using RepType = int32_t;
+  cudf::test::fixed_point_column_wrapper<RepType> input(
+    {15, 12, 31, 40, 0}, {1, 1, 1, 1, 0}, numeric::scale_type{-1});
+  auto const offsets = cudf::detail::make_device_uvector_sync(std::vector<size_type>{0, 2, 4, 5});
+  auto const dtype   = cudf::data_type{cudf::type_id::DECIMAL32, -1};
+
+  cudf::test::fixed_point_column_wrapper<RepType> expected_min(
+    {12, 31, 0}, {1, 1, 0}, numeric::scale_type{-1});
+  cudf::test::fixed_point_column_wrapper<RepType> expected_max(
+    {15, 40, 0}, {1, 1, 0}, numeric::scale_type{-1});
+
+  auto const min = cudf::segmented_reduce(
+    input, offsets, cudf::make_min_aggregation(), dtype, cudf::null_policy::EXCLUDE);
+  auto const max = cudf::segmented_reduce(
+    input, offsets, cudf::make_max_aggregation(), dtype, cudf::null_policy::EXCLUDE);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_min, min->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_max, max->view());
+}
+
+TEST_F(SegmentedReductionTestUntyped, Errors)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 2, 3});
+  auto const offsets = cudf::detail::make_device_uvector_sync(std::vector<size_type>{0, 1, 3});
+  auto const dtype   = cudf::data_type{cudf::type_id::INT32};
+
+  EXPECT_THROW(cudf::segmented_reduce(input,
+                                      cudf::device_span<size_type const>{},
+                                      cudf::make_sum_aggregation(),
+                                      dtype,
+                                      cudf::null_policy::EXCLUDE),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::segmented_reduce(input,
+                                      offsets,
+                                      cudf::make_product_aggregation(),
+                                      dtype,
+                                      cudf::null_policy::EXCLUDE),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::segmented_reduce(
+                 input, offsets, cudf::make_mean_aggregation(), dtype, cudf::null_policy::EXCLUDE),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::segmented_reduce(input,
+                                      offsets,
+                                      cudf::make_min_aggregation(),
+                                      cudf::data_type{cudf::type_id::INT64},
+                                      cudf::null_policy::EXCLUDE),
+               cudf::logic_error);
+}
@@ -26,6 +26,8 @@
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -33,6 +35,12 @@
 #include <cudf_test/cudf_gtest.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <string>
+#include <vector>
+
 struct ReplaceErrorTest : public cudf::test::BaseFixture {
 };
 
@@ -358,6 +366,65 @@ TYPED_TEST(ReplaceNullsTest, LargeScaleScalar)
                                   expectedColumn.begin(), expectedColumn.end()));
 }
 
+TYPED_TEST(ReplaceNullsTest, ReplaceColumnInPlace)
+{
+  using T = TypeParam;
+
+  auto input_column   = cudf::test::make_type_param_vector<T>({7, 5, 6, 3, 1, 2, 8, 4});
+  auto replace_column = cudf::test::make_type_param_vector<T>({4, 5, 6, 7, 8, 9, 0, 1});
+  auto result_column  = cudf::test::make_type_param_vector<T>({4, 5, 6, 3, 1, 2, 0, 4});
+
+  std::vector<cudf::valid_type> input_valid{0, 0, 1, 1, 1, 1, 0, 1};
+  std::vector<cudf::valid_type> replace_valid{1, 0, 1, 1, 1, 1, 1, 1};
+  std::vector<cudf::valid_type> result_valid{1, 0, 1, 1, 1, 1, 1, 1};
+
+  cudf::column input{cudf::test::fixed_width_column_wrapper<T>(
+    input_column.begin(), input_column.end(), input_valid.begin())};
+  cudf::test::fixed_width_column_wrapper<T> replacement(
+    replace_column.begin(), replace_column.end(), replace_valid.begin());
+  cudf::test::fixed_width_column_wrapper<T> expected(
+    result_column.begin(), result_column.end(), result_valid.begin());
+
+  auto output = input.mutable_view();
+  ASSERT_NO_THROW(cudf::replace_nulls(input.view(), replacement, output));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, output);
+}
+
+TYPED_TEST(ReplaceNullsTest, ReplaceScalarInPlace)
+{
+  using T = TypeParam;
+
+  auto input_column  = cudf::test::make_type_param_vector<T>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  auto result_column = cudf::test::make_type_param_vector<T>({1, 1, 1, 1, 1, 5, 6, 7, 8, 9});
+  std::vector<cudf::valid_type> input_valid{0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+  cudf::numeric_scalar<T> replacement(1);
+
+  cudf::column input{cudf::test::fixed_width_column_wrapper<T>(
+    input_column.begin(), input_column.end(), input_valid.begin())};
+  cudf::test::fixed_width_column_wrapper<T> expected(result_column.begin(), result_column.end());
+
+  auto output = input.mutable_view();
+  ASSERT_NO_THROW(cudf::replace_nulls(input.view(), replacement, output));
+  EXPECT_EQ(0, output.null_count());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, output);
+}
+
+TYPED_TEST(ReplaceNullsTest, ReplaceInPlaceNonNullableOutput)
+{
+  using T = TypeParam;
+
+  auto input_column = cudf::test::make_type_param_vector<T>({0, 1, 2, 3});
+  std::vector<cudf::valid_type> input_valid{0, 1, 0, 1};
+  cudf::test::fixed_width_column_wrapper<T> input(
+    input_column.begin(), input_column.end(), input_valid.begin());
+  cudf::test::fixed_width_column_wrapper<T> replacement(
+    input_column.begin(), input_column.end(), input_valid.begin());
+  cudf::test::fixed_width_column_wrapper<T> out(input_column.begin(), input_column.end());
+
+  auto output = cudf::mutable_column_view{out};
+  EXPECT_THROW(cudf::replace_nulls(input, replacement, output), cudf::logic_error);
+}
+
 template <typename T>
 struct ReplaceNullsPolicyTest : public cudf::test::BaseFixture {
 };
@@ -717,4 +784,92 @@ TEST_F(ReplaceNullsPolicyDictionaryTest, FollowingFillTrailingNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected->view());
 }
 
+struct ReplaceNullsTableTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReplaceNullsTableTest, MixedReplacements)
+{
+  // Sizes which are not a multiple of the warp size leave part of the last mask word unused
+  constexpr cudf::size_type num_rows = 100;
+  auto const sequence                = thrust::make_counting_iterator(0);
+  auto const every_third = thrust::make_transform_iterator(sequence, [](auto i) { return i % 3; });
+  auto const leading_nulls =
+    thrust::make_transform_iterator(sequence, [](auto i) { return i > 40 and i % 5 == 0; });
+  auto const trailing_nulls =
+    thrust::make_transform_iterator(sequence, [](auto i) { return i < 60 and i % 4 == 0; });
+  auto const strings =
+    thrust::make_transform_iterator(sequence, [](auto i) { return std::to_string(i); });
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(
+    sequence, sequence + num_rows, every_third);
+  cudf::test::fixed_width_column_wrapper<double> preceding(
+    sequence, sequence + num_rows, leading_nulls);
+  cudf::test::fixed_width_column_wrapper<int16_t> following(
+    sequence, sequence + num_rows, trailing_nulls);
+  cudf::test::fixed_width_column_wrapper<bool> bools(
+    every_third, every_third + num_rows, leading_nulls);
+  cudf::test::fixed_width_column_wrapper<int64_t> no_nulls(sequence, sequence + num_rows);
+  cudf::test::fixed_width_column_wrapper<float> invalid_scalar(
+    sequence, sequence + num_rows, every_third);
+  cudf::test::strings_column_wrapper words(strings, strings + num_rows, every_third);
+  auto const input = cudf::table_view(
+    {ints, preceding, following, bools, no_nulls, invalid_scalar, words, preceding});
+
+  cudf::numeric_scalar<int32_t> const int_value(-1);
+  cudf::numeric_scalar<int64_t> const long_value(-1);
+  cudf::numeric_scalar<float> const float_value(0, false);
+  cudf::string_scalar const word("null");
+  std::vector<cudf::null_replacement> const replacements{int_value,
+                                                         cudf::replace_policy::PRECEDING,
+                                                         cudf::replace_policy::FOLLOWING,
+                                                         cudf::replace_policy::FOLLOWING,
+                                                         long_value,
+                                                         float_value,
+                                                         word,
+                                                         cudf::replace_policy::FOLLOWING};
+
+  auto const result = cudf::replace_nulls(input, replacements);
+  ASSERT_EQ(result->num_columns(), input.num_columns());
+
+  // Every column is replaced as if it were replaced on its own
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& replacement = replacements[i];
+    auto const expected     = replacement.value() != nullptr
+                                ? cudf::replace_nulls(input.column(i), *replacement.value())
+                                : cudf::replace_nulls(input.column(i), replacement.policy());
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected, result->get_column(i));
+    EXPECT_EQ(expected->null_count(), result->get_column(i).null_count());
+  }
+}
+
+TEST_F(ReplaceNullsTableTest, FixedPoint)
+{
+  using fp     = numeric::decimal32;
+  auto const s = numeric::scale_type{0};
+  auto input_a = cudf::test::fixed_width_column_wrapper<fp>(
+    {fp{1, s}, fp{2, s}, fp{3, s}, fp{4, s}, fp{5, s}}, {1, 0, 0, 1, 0});
+  auto input_b = cudf::test::fixed_width_column_wrapper<fp>(
+    {fp{1, s}, fp{2, s}, fp{3, s}, fp{4, s}, fp{5, s}}, {0, 1, 0, 1, 0});
+  cudf::fixed_point_scalar<fp> const value{9, s};
+
+  auto const result = cudf::replace_nulls(cudf::table_view({input_a, input_b}),
+                                          {value, cudf::replace_policy::PRECEDING});
+
+  auto expect_a = cudf::test::fixed_width_column_wrapper<fp>(
+    {fp{1, s}, fp{9, s}, fp{9, s}, fp{4, s}, fp{9, s}});
+  auto expect_b = cudf::test::fixed_width_column_wrapper<fp>(
+    {fp{1, s}, fp{2, s}, fp{2, s}, fp{4, s}, fp{4, s}}, {0, 1, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_a, result->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_b, result->get_column(1));
+}
+
+TEST_F(ReplaceNullsTableTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({1, 2, 3}, {1, 0, 1});
+  auto const table = cudf::table_view({input});
+
+  EXPECT_THROW(cudf::replace_nulls(table, {}), cudf::logic_error);
+  EXPECT_THROW(cudf::replace_nulls(table, {cudf::numeric_scalar<int64_t>(0)}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
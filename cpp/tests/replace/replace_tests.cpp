@@ -287,6 +287,50 @@ TEST_F(ReplaceStringsTest, StringsLargeScale)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_wrapper);
 }
 
+TEST_F(ReplaceStringsTest, StringsManyValuesWithDuplicates)
+{
+  std::vector<std::string> input;
+  std::vector<cudf::valid_type> input_valid;
+  for (int i = 0; i < 200; ++i) {
+    input.push_back(std::to_string(i % 60));
+    input_valid.push_back(i % 7 != 0);
+  }
+  // The first of repeated values to replace is the one replacing them
+  std::vector<std::string> values_to_replace;
+  std::vector<std::string> replacement;
+  std::vector<cudf::valid_type> replacement_valid;
+  for (int i = 0; i < 64; ++i) {
+    values_to_replace.push_back(std::to_string(i % 50));
+    replacement.push_back("r" + std::to_string(i));
+    replacement_valid.push_back(i % 5 != 0);
+  }
+  std::vector<std::string> expected;
+  std::vector<cudf::valid_type> ex_valid;
+  for (int i = 0; i < 200; ++i) {
+    auto const value = i % 60;
+    if (input_valid[i] and value < 50) {
+      expected.push_back(replacement[value]);
+      ex_valid.push_back(replacement_valid[value]);
+    } else {
+      expected.push_back(input[i]);
+      ex_valid.push_back(input_valid[i]);
+    }
+  }
+
+  cudf::test::strings_column_wrapper input_wrapper{
+    input.begin(), input.end(), input_valid.begin()};
+  cudf::test::strings_column_wrapper values_to_replace_wrapper{values_to_replace.begin(),
+                                                               values_to_replace.end()};
+  cudf::test::strings_column_wrapper replacement_wrapper{
+    replacement.begin(), replacement.end(), replacement_valid.begin()};
+  cudf::test::strings_column_wrapper expected_wrapper{
+    expected.begin(), expected.end(), ex_valid.begin()};
+
+  auto const result =
+    cudf::find_and_replace_all(input_wrapper, values_to_replace_wrapper, replacement_wrapper, mr());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_wrapper);
+}
+
 //// This is the main test feature
 template <class T>
 struct ReplaceTest : cudf::test::BaseFixture {
@@ -494,6 +538,33 @@ TYPED_TEST(ReplaceTest, NullsInBoth)
                           replacement_values_valid);
 }
 
+// Testing with enough values to replace to look them up in a hash map, some of them repeated
+TYPED_TEST(ReplaceTest, ManyValuesWithDuplicates)
+{
+  using T = TypeParam;
+  std::vector<T> input_column;
+  std::vector<cudf::valid_type> input_column_valid;
+  for (int i = 0; i < 200; ++i) {
+    input_column.push_back(static_cast<T>(i % 60));
+    input_column_valid.push_back(i % 7 != 0);
+  }
+  std::vector<T> values_to_replace_column;
+  std::vector<T> replacement_values_column;
+  std::vector<cudf::valid_type> replacement_values_valid;
+  for (int i = 0; i < 64; ++i) {
+    values_to_replace_column.push_back(static_cast<T>(i % 50));
+    replacement_values_column.push_back(static_cast<T>(100 - i));
+    replacement_values_valid.push_back(i % 5 != 0);
+  }
+
+  test_replace<T>(input_column, values_to_replace_column, replacement_values_column);
+  test_replace<T>(input_column,
+                  values_to_replace_column,
+                  replacement_values_column,
+                  input_column_valid,
+                  replacement_values_valid);
+}
+
 // Test with much larger data sets
 TYPED_TEST(ReplaceTest, LargeScaleReplaceTest)
 {
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+using namespace cudf::test;
+
+template <typename T>
+struct MeltTest : public BaseFixture {
+};
+
+TYPED_TEST_CASE(MeltTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(MeltTest, IdsAndValues)
+{
+  using T = TypeParam;
+
+  strings_column_wrapper ids({"a", "b", "c"});
+  fixed_width_column_wrapper<T, int32_t> values1({1, 2, 3}, {1, 0, 1});
+  fixed_width_column_wrapper<T, int32_t> values2({4, 5, 6});
+
+  strings_column_wrapper expected_ids({"a", "b", "c", "a", "b", "c"});
+  fixed_width_column_wrapper<cudf::size_type> expected_variables({0, 0, 0, 1, 1, 1});
+  fixed_width_column_wrapper<T, int32_t> expected_values({1, 2, 3, 4, 5, 6}, {1, 0, 1, 1, 1, 1});
+
+  auto const actual = cudf::melt(cudf::table_view{{ids}}, cudf::table_view{{values1, values2}});
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    cudf::table_view{{expected_ids, expected_variables, expected_values}}, actual->view());
+}
+
+TYPED_TEST(MeltTest, NoIds)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T, int32_t> values1({1, 2});
+  fixed_width_column_wrapper<T, int32_t> values2({3, 4});
+  fixed_width_column_wrapper<T, int32_t> values3({5, 6});
+
+  fixed_width_column_wrapper<cudf::size_type> expected_variables({0, 0, 1, 1, 2, 2});
+  fixed_width_column_wrapper<T, int32_t> expected_values({1, 2, 3, 4, 5, 6});
+
+  auto const actual = cudf::melt(cudf::table_view(std::vector<cudf::column_view>{}),
+                                 cudf::table_view{{values1, values2, values3}});
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_variables, expected_values}},
+                                actual->view());
+}
+
+struct MeltErrorTest : public BaseFixture {
+};
+
+TEST_F(MeltErrorTest, InvalidInputs)
+{
+  fixed_width_column_wrapper<int32_t> ids({1, 2, 3});
+  fixed_width_column_wrapper<int32_t> values({1, 2});
+  fixed_width_column_wrapper<float> other_values({1.5f, 2.5f});
+  auto const no_columns = cudf::table_view(std::vector<cudf::column_view>{});
+
+  EXPECT_THROW(cudf::melt(cudf::table_view{{ids}}, no_columns), cudf::logic_error);
+  EXPECT_THROW(cudf::melt(cudf::table_view{{ids}}, cudf::table_view{{values}}), cudf::logic_error);
+  EXPECT_THROW(cudf::melt(no_columns, cudf::table_view{{values, other_values}}),
+               cudf::logic_error);
+}
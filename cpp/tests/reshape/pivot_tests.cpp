@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+using namespace cudf::test;
+
+template <typename T>
+struct PivotTest : public BaseFixture {
+};
+
+TYPED_TEST_CASE(PivotTest, cudf::test::FixedWidthTypes);
+
+TYPED_TEST(PivotTest, MissingCells)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<int32_t> index({3, 1, 2, 1});
+  strings_column_wrapper columns({"b", "b", "a", "a"});
+  fixed_width_column_wrapper<T, int32_t> values({40, 10, 30, 20}, {1, 1, 1, 0});
+
+  fixed_width_column_wrapper<int32_t> expected_index({1, 2, 3});
+  fixed_width_column_wrapper<T, int32_t> expected_a({20, 30, 0}, {0, 1, 0});
+  fixed_width_column_wrapper<T, int32_t> expected_b({10, 0, 40}, {1, 0, 1});
+  strings_column_wrapper expected_columns({"a", "b"});
+
+  auto const actual = cudf::pivot(cudf::table_view{{index}}, columns, values);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected_index, expected_a, expected_b}},
+                                actual.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_columns, actual.second->view());
+}
+
+TYPED_TEST(PivotTest, MultiColumnIndex)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<int32_t> index1({1, 1, 2, 2, 1, 2});
+  strings_column_wrapper index2({"x", "y", "x", "x", "x", "y"});
+  fixed_width_column_wrapper<int16_t> columns({7, 7, 7, 8, 8, 8});
+  fixed_width_column_wrapper<T, int32_t> values({1, 2, 3, 4, 5, 6});
+
+  fixed_width_column_wrapper<int32_t> expected_index1({1, 1, 2, 2});
+  strings_column_wrapper expected_index2({"x", "y", "x", "y"});
+  fixed_width_column_wrapper<T, int32_t> expected_7({1, 2, 3, 0}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<T, int32_t> expected_8({5, 0, 4, 6}, {1, 0, 1, 1});
+  fixed_width_column_wrapper<int16_t> expected_columns({7, 8});
+
+  auto const actual = cudf::pivot(cudf::table_view{{index1, index2}}, columns, values);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    cudf::table_view{{expected_index1, expected_index2, expected_7, expected_8}},
+    actual.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_columns, actual.second->view());
+}
+
+struct PivotErrorTest : public BaseFixture {
+};
+
+TEST_F(PivotErrorTest, MismatchedSizes)
+{
+  fixed_width_column_wrapper<int32_t> index({1, 2, 3});
+  fixed_width_column_wrapper<int32_t> columns({1, 2});
+  fixed_width_column_wrapper<int32_t> values({1, 2, 3});
+
+  EXPECT_THROW(cudf::pivot(cudf::table_view{{index}}, columns, values), cudf::logic_error);
+  EXPECT_THROW(
+    cudf::pivot(cudf::table_view(std::vector<cudf::column_view>{}), columns, values),
+    cudf::logic_error);
+}
@@ -311,11 +311,146 @@ TYPED_TEST(TypedIntegralRangeRollingTest, OrderByDesc)
   verify_results_for_descending(exec);
 }
 
+template <typename T>
+struct TypedFloatingPointRangeRollingTest : RangeRollingTest {
+};
+
+TYPED_TEST_CASE(TypedFloatingPointRangeRollingTest, cudf::test::FloatingPointTypes);
+
+TYPED_TEST(TypedFloatingPointRangeRollingTest, OrderByASC)
+{
+  // Confirm that floating-point ranges work with floating-point orderby columns,
+  // in ascending order.
+  using namespace cudf;
+  using T = TypeParam;
+
+  // clang-format off
+  auto gby_column = int_col { 0,   0,   0,   0,   0,   1,   1,   1,   1,   1};
+  auto agg_column = int_col {{0,   8,   4,   6,   2,   9,   3,   5,   1,   7},
+                             {1,   1,   1,   1,   1,   1,   1,   1,   1,   0}};
+  auto oby_column = fwcw<T>{  0.5, 2.5, 3.0, 4.0, 4.5, 1.0, 1.0, 1.5, 2.0, 4.5};
+  // clang-format on
+
+  auto exec = window_exec(gby_column,
+                          oby_column,
+                          order::ASCENDING,
+                          agg_column,
+                          numeric_scalar<T>(1.0),   // 1.0 preceding.
+                          numeric_scalar<T>(0.5));  // 0.5 following.
+
+  verify_results_for_ascending(exec);
+}
+
+TYPED_TEST(TypedFloatingPointRangeRollingTest, OrderByDesc)
+{
+  // Confirm that floating-point ranges work with floating-point orderby columns,
+  // in descending order.
+  using namespace cudf;
+  using T = TypeParam;
+
+  // clang-format off
+  auto gby_column  = int_col { 5,   5,   5,   5,   5,   1,   1,   1,   1,   1};
+  auto agg_column  = int_col {{7,   1,   5,   3,   9,   2,   6,   4,   8,   0},
+                              {0,   1,   1,   1,   1,   1,   1,   1,   1,   1}};
+  auto oby_column  = fwcw<T>{  4.5, 2.0, 1.5, 1.0, 1.0, 4.5, 4.0, 3.0, 2.5, 0.5};
+  // clang-format on
+
+  auto exec = window_exec(gby_column,
+                          oby_column,
+                          order::DESCENDING,
+                          agg_column,
+                          numeric_scalar<T>(0.5),   // 0.5 preceding.
+                          numeric_scalar<T>(1.0));  // 1.0 following.
+
+  verify_results_for_descending(exec);
+}
+
+template <typename T>
+struct TypedFixedPointRangeRollingTest : RangeRollingTest {
+};
+
+TYPED_TEST_CASE(TypedFixedPointRangeRollingTest, cudf::test::FixedPointTypes);
+
+TYPED_TEST(TypedFixedPointRangeRollingTest, OrderByASC)
+{
+  // Confirm that decimal ranges work with decimal orderby columns of the same scale,
+  // in ascending order.
+  using namespace cudf;
+  using namespace numeric;
+  using decimalXX = TypeParam;
+  using RepType   = typename decimalXX::rep;
+
+  // clang-format off
+  auto gby_column = int_col { 0,  0,  0,  0,  0,  1,  1,  1,  1,  1};
+  auto agg_column = int_col {{0,  8,  4,  6,  2,  9,  3,  5,  1,  7},
+                             {1,  1,  1,  1,  1,  1,  1,  1,  1,  0}};
+  auto oby_column = fixed_point_column_wrapper<RepType>{
+                              {10, 50, 60, 80, 90, 20, 20, 30, 40, 90}, scale_type{-1}};
+  // clang-format on
+
+  auto exec = window_exec(gby_column,
+                          oby_column,
+                          order::ASCENDING,
+                          agg_column,
+                          fixed_point_scalar<decimalXX>(20, scale_type{-1}),   // 2.0 preceding.
+                          fixed_point_scalar<decimalXX>(10, scale_type{-1}));  // 1.0 following.
+
+  verify_results_for_ascending(exec);
+}
+
+TYPED_TEST(TypedFixedPointRangeRollingTest, OrderByDesc)
+{
+  // Confirm that decimal ranges work with decimal orderby columns of the same scale,
+  // in descending order.
+  using namespace cudf;
+  using namespace numeric;
+  using decimalXX = TypeParam;
+  using RepType   = typename decimalXX::rep;
+
+  // clang-format off
+  auto gby_column  = int_col { 5,  5,  5,  5,  5,  1,  1,  1,  1,  1};
+  auto agg_column  = int_col {{7,  1,  5,  3,  9,  2,  6,  4,  8,  0},
+                              {0,  1,  1,  1,  1,  1,  1,  1,  1,  1}};
+  auto oby_column  = fixed_point_column_wrapper<RepType>{
+                               {90, 40, 30, 20, 20, 90, 80, 60, 50, 10}, scale_type{-1}};
+  // clang-format on
+
+  auto exec = window_exec(gby_column,
+                          oby_column,
+                          order::DESCENDING,
+                          agg_column,
+                          fixed_point_scalar<decimalXX>(10, scale_type{-1}),   // 1.0 preceding.
+                          fixed_point_scalar<decimalXX>(20, scale_type{-1}));  // 2.0 following.
+
+  verify_results_for_descending(exec);
+}
+
+TYPED_TEST(TypedFixedPointRangeRollingTest, ScaleMismatch)
+{
+  using namespace cudf;
+  using namespace numeric;
+  using decimalXX = TypeParam;
+  using RepType   = typename decimalXX::rep;
+
+  auto gby_column = int_col{0, 0, 0, 0};
+  auto agg_column = int_col{0, 8, 4, 6};
+  auto oby_column = fixed_point_column_wrapper<RepType>{{10, 50, 60, 80}, scale_type{-1}};
+
+  auto exec = window_exec(gby_column,
+                          oby_column,
+                          order::ASCENDING,
+                          agg_column,
+                          fixed_point_scalar<decimalXX>(2, scale_type{0}),
+                          fixed_point_scalar<decimalXX>(1, scale_type{0}));
+
+  EXPECT_THROW(exec(make_count_aggregation()), cudf::logic_error);
+}
+
 template <typename T>
 struct TypedRangeRollingNullsTest : public RangeRollingTest {
 };
 
-using TypesUnderTest = IntegralTypesNotBool;
+using TypesUnderTest = Concat<IntegralTypesNotBool, FloatingPointTypes>;
 
 TYPED_TEST_CASE(TypedRangeRollingNullsTest, TypesUnderTest);
 
@@ -101,7 +101,7 @@ template <typename T>
 struct NumericRangeWindowBoundsTest : RangeWindowBoundsTest {
 };
 
-using TypesForTest = cudf::test::IntegralTypesNotBool;
+using TypesForTest = Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
 
 TYPED_TEST_CASE(NumericRangeWindowBoundsTest, TypesForTest);
 
@@ -124,7 +124,7 @@ TYPED_TEST(NumericRangeWindowBoundsTest, BoundsConstruction)
 
   using range_window_bounds = cudf::range_window_bounds;
 
-  static_assert(std::is_integral<range_type>::value);
+  static_assert(std::is_arithmetic<range_type>::value);
   auto range_3 = range_window_bounds::get(numeric_scalar<range_type>{3, true});
   EXPECT_FALSE(range_3.is_unbounded() &&
                "range_window_bounds constructed from scalar cannot be unbounded.");
@@ -151,5 +151,31 @@ TYPED_TEST(NumericRangeWindowBoundsTest, WrongRangeType)
                cudf::logic_error);
 }
 
+template <typename T>
+struct FixedPointRangeWindowBoundsTest : RangeWindowBoundsTest {
+};
+
+TYPED_TEST_CASE(FixedPointRangeWindowBoundsTest, cudf::test::FixedPointTypes);
+
+TYPED_TEST(FixedPointRangeWindowBoundsTest, BoundsConstruction)
+{
+  using OrderByType = TypeParam;
+  using range_type  = cudf::detail::range_type<OrderByType>;
+  using rep_type    = cudf::detail::range_rep_type<OrderByType>;
+
+  static_assert(std::is_same<range_type, OrderByType>::value);
+  static_assert(std::is_same<rep_type, typename OrderByType::rep>::value);
+
+  auto range_3 =
+    range_window_bounds::get(fixed_point_scalar<range_type>{3, numeric::scale_type{-2}});
+  EXPECT_FALSE(range_3.is_unbounded() &&
+               "range_window_bounds constructed from scalar cannot be unbounded.");
+  EXPECT_EQ(cudf::detail::range_comparable_value<OrderByType>(range_3), rep_type{3});
+
+  auto range_unbounded = range_window_bounds::unbounded(data_type{type_to_id<range_type>()});
+  EXPECT_TRUE(range_unbounded.is_unbounded() &&
+              "range_window_bounds::unbounded() must return an unbounded range.");
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -30,6 +30,8 @@
 
 #include <thrust/iterator/constant_iterator.h>
 
+#include <cmath>
+#include <memory>
 #include <vector>
 
 using cudf::bitmask_type;
@@ -744,6 +746,54 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+// random input data with nulls, static parameters, windows aggregated in O(1) time per row
+TYPED_TEST(RollingTest, RandomStaticLargeWindowWithInvalid)
+{
+  size_type num_rows = 5000;
+
+  // random input with nulls
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  std::vector<size_type> window({200});
+  size_type periods = 150;
+
+  this->run_test_col_agg(input, window, window, periods);
+}
+
+// random input data with nulls, dynamic parameters, windows aggregated in O(1) time per row
+TYPED_TEST(RollingTest, RandomDynamicLargeWindowWithInvalid)
+{
+  size_type num_rows        = 5000;
+  size_type max_window_size = 300;
+
+  // random input with nulls
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  // random parameters, with windows within a block and across many blocks
+  cudf::test::UniformRandomGenerator<size_type> window_rng(0, max_window_size);
+  auto generator = [&]() { return window_rng.generate(); };
+
+  std::vector<size_type> preceding_window(num_rows);
+  std::vector<size_type> following_window(num_rows);
+
+  std::generate(preceding_window.begin(), preceding_window.end(), generator);
+  std::generate(following_window.begin(), following_window.end(), generator);
+
+  this->run_test_col_agg(input, preceding_window, following_window, 1);
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
@@ -1049,6 +1099,132 @@ TYPED_TEST(FixedPointTests, MinMaxCountLagLeadNulls)
                cudf::logic_error);
 }
 
+class RollingStatisticsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RollingStatisticsTest, VarianceStd)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 4, 2, 8, 5, 7, 3});
+
+  fixed_width_column_wrapper<double> expected_var({4.5, 7.0 / 3, 28.0 / 3, 9.0, 7.0 / 3, 4.0, 8.0});
+  fixed_width_column_wrapper<double> expected_std({std::sqrt(4.5),
+                                                   std::sqrt(7.0 / 3),
+                                                   std::sqrt(28.0 / 3),
+                                                   3.0,
+                                                   std::sqrt(7.0 / 3),
+                                                   2.0,
+                                                   std::sqrt(8.0)});
+  fixed_width_column_wrapper<double> expected_var_ddof0(
+    {2.25, 14.0 / 9, 56.0 / 9, 6.0, 14.0 / 9, 8.0 / 3, 4.0});
+
+  auto got_var       = cudf::rolling_window(input, 2, 1, 1, cudf::make_variance_aggregation());
+  auto got_std       = cudf::rolling_window(input, 2, 1, 1, cudf::make_std_aggregation());
+  auto got_var_ddof0 = cudf::rolling_window(input, 2, 1, 1, cudf::make_variance_aggregation(0));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_var, got_var->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_std, got_std->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_var_ddof0, got_var_ddof0->view());
+}
+
+TEST_F(RollingStatisticsTest, VarianceNulls)
+{
+  fixed_width_column_wrapper<double> input({1, 4, 2, 8, 5, 7, 3}, {1, 1, 0, 1, 1, 0, 1});
+
+  // windows with a single valid row have no variance
+  fixed_width_column_wrapper<double> expected_var({4.5, 4.5, 8.0, 4.5, 4.5, 2.0, 0},
+                                                  {1, 1, 1, 1, 1, 1, 0});
+  // windows with fewer than `min_periods` valid rows are null
+  fixed_width_column_wrapper<double> expected_var_ddof0({2.25, 2.25, 4.0, 2.25, 2.25, 1.0, 0},
+                                                        {1, 1, 1, 1, 1, 1, 0});
+
+  auto got_var       = cudf::rolling_window(input, 2, 1, 1, cudf::make_variance_aggregation());
+  auto got_var_ddof0 = cudf::rolling_window(input, 2, 1, 2, cudf::make_variance_aggregation(0));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_var, got_var->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_var_ddof0, got_var_ddof0->view());
+}
+
+TEST_F(RollingStatisticsTest, VarianceLargeValues)
+{
+  // a sum of squares would cancel out the spread of values this large
+  fixed_width_column_wrapper<double> input({1e9 + 1, 1e9 + 2, 1e9 + 3, 1e9 + 4});
+  fixed_width_column_wrapper<double> expected_var({0.5, 1.0, 1.0, 0.5});
+
+  auto got_var = cudf::rolling_window(input, 2, 1, 1, cudf::make_variance_aggregation());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_var, got_var->view());
+}
+
+TEST_F(RollingStatisticsTest, MedianQuantile)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 4, 2, 8, 5, 7, 3});
+
+  fixed_width_column_wrapper<double> expected_median({2.5, 2.0, 3.0, 4.5, 6.0, 6.0, 5.0});
+  fixed_width_column_wrapper<double> expected_linear({1.75, 1.5, 1.75, 3.5, 4.25, 4.5, 4.0});
+  fixed_width_column_wrapper<double> expected_lower({1, 1, 1, 2, 2, 3, 3});
+  fixed_width_column_wrapper<double> expected_higher({4, 4, 8, 8, 8, 8, 7});
+
+  auto got_median = cudf::rolling_window(input, 3, 1, 1, cudf::make_median_aggregation());
+  auto got_linear = cudf::rolling_window(
+    input, 3, 1, 1, cudf::make_quantile_aggregation({0.25}, cudf::interpolation::LINEAR));
+  auto got_lower = cudf::rolling_window(
+    input, 3, 1, 1, cudf::make_quantile_aggregation({0.25}, cudf::interpolation::LOWER));
+  auto got_higher = cudf::rolling_window(
+    input, 3, 1, 1, cudf::make_quantile_aggregation({0.75}, cudf::interpolation::HIGHER));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_median, got_median->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_linear, got_linear->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_lower, got_lower->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_higher, got_higher->view());
+}
+
+TEST_F(RollingStatisticsTest, MedianNulls)
+{
+  fixed_width_column_wrapper<float> input({1, 4, 2, 8, 5, 7, 3}, {1, 1, 0, 1, 1, 0, 1});
+
+  fixed_width_column_wrapper<double> expected_median({2.5, 2.5, 4.0, 5.0, 6.5, 5.0, 4.0});
+  fixed_width_column_wrapper<double> expected_min_periods({0, 0, 4.0, 5.0, 0, 5.0, 0},
+                                                          {0, 0, 1, 1, 0, 1, 0});
+
+  auto got_median      = cudf::rolling_window(input, 3, 1, 1, cudf::make_median_aggregation());
+  auto got_min_periods = cudf::rolling_window(input, 3, 1, 3, cudf::make_median_aggregation());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_median, got_median->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_min_periods, got_min_periods->view());
+}
+
+TEST_F(RollingStatisticsTest, Grouped)
+{
+  fixed_width_column_wrapper<int32_t> keys({0, 0, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int64_t> input({1, 4, 2, 8, 5, 7, 3});
+  auto const grouping_keys = cudf::table_view{std::vector<cudf::column_view>{keys}};
+
+  fixed_width_column_wrapper<double> expected_var({4.5, 7.0 / 3, 2.0, 4.5, 7.0 / 3, 4.0, 8.0});
+  fixed_width_column_wrapper<double> expected_median({2.5, 2.0, 3.0, 6.5, 7.0, 5.0, 5.0});
+
+  auto got_var =
+    cudf::grouped_rolling_window(grouping_keys, input, 2, 1, 1, cudf::make_variance_aggregation());
+  auto got_median =
+    cudf::grouped_rolling_window(grouping_keys, input, 2, 1, 1, cudf::make_median_aggregation());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_var, got_var->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_median, got_median->view());
+}
+
+TEST_F(RollingStatisticsTest, Unsupported)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 4, 2, 8});
+  cudf::test::strings_column_wrapper strings({"1", "4", "2", "8"});
+
+  EXPECT_THROW(
+    cudf::rolling_window(input, 2, 1, 1, cudf::make_quantile_aggregation({0.25, 0.75})),
+    cudf::logic_error);
+  EXPECT_THROW(cudf::rolling_window(strings, 2, 1, 1, cudf::make_variance_aggregation()),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::rolling_window(strings, 2, 1, 1, cudf::make_median_aggregation()),
+               cudf::logic_error);
+}
+
 class RollingDictionaryTest : public cudf::test::BaseFixture {
 };
 
@@ -1116,4 +1292,102 @@ TEST_F(RollingDictionaryTest, LeadLag)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_lag, got_lag->view());
 }
 
+template <typename T>
+class RollingMultiAggregationTest : public cudf::test::BaseFixture {
+ protected:
+  static std::vector<std::unique_ptr<cudf::aggregation>> fused_aggregations()
+  {
+    std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+    aggs.push_back(cudf::make_sum_aggregation());
+    aggs.push_back(cudf::make_min_aggregation());
+    aggs.push_back(cudf::make_max_aggregation());
+    aggs.push_back(cudf::make_count_aggregation());
+    aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+    aggs.push_back(cudf::make_mean_aggregation());
+    return aggs;
+  }
+
+  static fixed_width_column_wrapper<T> make_input(size_type size)
+  {
+    auto values = cudf::detail::make_counting_transform_iterator(
+      0, [](auto i) { return static_cast<T>((i * 7) % 11); });
+    auto valids =
+      cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 2; });
+    return fixed_width_column_wrapper<T>(values, values + size, valids);
+  }
+
+  // the results must match those of one `rolling_window` call per aggregation
+  template <typename... WindowArgs>
+  static void verify(cudf::column_view const& input,
+                     std::vector<std::unique_ptr<cudf::aggregation>> const& aggs,
+                     WindowArgs const&... window_args)
+  {
+    auto const results = cudf::rolling_window(input, window_args..., aggs);
+    ASSERT_EQ(results.size(), aggs.size());
+    for (std::size_t idx = 0; idx < aggs.size(); ++idx) {
+      auto const expected = cudf::rolling_window(input, window_args..., aggs[idx]);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), results[idx]->view());
+    }
+  }
+};
+
+TYPED_TEST_CASE(RollingMultiAggregationTest, cudf::test::NumericTypes);
+
+TYPED_TEST(RollingMultiAggregationTest, StaticWindow)
+{
+  auto const input = this->make_input(1000);
+
+  this->verify(input, this->fused_aggregations(), 3, 2, 2);
+  this->verify(input, this->fused_aggregations(), 0, 4, 0);
+  // windows aggregated in O(1) time per row are computed one aggregation at a time
+  this->verify(input, this->fused_aggregations(), 200, 100, 1);
+}
+
+TYPED_TEST(RollingMultiAggregationTest, DynamicWindow)
+{
+  auto const input = this->make_input(1000);
+
+  auto preceding = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 6; });
+  auto following = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  fixed_width_column_wrapper<size_type> preceding_window(preceding, preceding + 1000);
+  fixed_width_column_wrapper<size_type> following_window(following, following + 1000);
+
+  this->verify(input,
+               this->fused_aggregations(),
+               cudf::column_view{preceding_window},
+               cudf::column_view{following_window},
+               2);
+}
+
+TYPED_TEST(RollingMultiAggregationTest, RepeatedAndOtherAggregations)
+{
+  auto const input = this->make_input(100);
+
+  auto repeated = this->fused_aggregations();
+  repeated.push_back(cudf::make_sum_aggregation());
+  repeated.push_back(cudf::make_count_aggregation());
+  this->verify(input, repeated, 2, 2, 1);
+
+  auto mixed = this->fused_aggregations();
+  mixed.push_back(cudf::make_row_number_aggregation());
+  this->verify(input, mixed, 2, 2, 1);
+}
+
+TEST_F(RollingErrorTest, MultiAggregationEmptyInputNegativeMinPeriods)
+{
+  fixed_width_column_wrapper<int32_t> empty_col{};
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+
+  auto const results = cudf::rolling_window(empty_col, 2, 0, 2, aggs);
+  ASSERT_EQ(results.size(), aggs.size());
+  for (auto const& result : results) {
+    EXPECT_EQ(result->size(), 0);
+  }
+
+  fixed_width_column_wrapper<int32_t> input({1, 2, 3, 4});
+  EXPECT_THROW(cudf::rolling_window(input, 2, 0, -2, aggs), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/row_conversion.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
+
+using namespace cudf::test;
+
+struct RowConversionTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::vector<cudf::data_type> schema_of(cudf::table_view const& input)
+{
+  std::vector<cudf::data_type> schema;
+  for (auto const& col : input) {
+    schema.push_back(col.type());
+  }
+  return schema;
+}
+}  // namespace
+
+TEST_F(RowConversionTest, FixedWidth)
+{
+  fixed_width_column_wrapper<int8_t> col0({1, 2, 3, 4, 5}, {1, 0, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> col1({10, 20, 30, 40, 50});
+  fixed_width_column_wrapper<double> col2({0.5, 1.5, 2.5, 3.5, 4.5}, {1, 1, 0, 1, 0});
+  fixed_width_column_wrapper<int16_t> col3({-1, -2, -3, -4, -5});
+  auto const input = cudf::table_view{{col0, col1, col2, col3}};
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+
+  // int8 at 0, int32 at 4, double at 8, int16 at 16, validity at 18, padded to 24
+  auto const view = cudf::lists_column_view{rows[0]->view()};
+  EXPECT_EQ(view.child().size(), 24 * input.num_rows());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    view.offsets(), fixed_width_column_wrapper<cudf::size_type>({0, 24, 48, 72, 96, 120}));
+
+  auto const result = cudf::convert_from_rows(view, schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+}
+
+TEST_F(RowConversionTest, Strings)
+{
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4});
+  strings_column_wrapper col1({"abc", "", "de", "Ankh-Morpork"}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<int64_t> col2({5, 6, 7, 8}, {0, 1, 1, 1});
+  strings_column_wrapper col3({"f", "ghijklmnop", "", "q"});
+  auto const input = cudf::table_view{{col0, col1, col2, col3}};
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+
+  // int32 at 0, slots at 8 and 24, int64 at 16, validity at 32, characters from 33
+  auto const view = cudf::lists_column_view{rows[0]->view()};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    view.offsets(), fixed_width_column_wrapper<cudf::size_type>({0, 40, 88, 128, 176}));
+
+  auto const result = cudf::convert_from_rows(view, schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+}
+
+TEST_F(RowConversionTest, SlicedTable)
+{
+  fixed_width_column_wrapper<int16_t> col0({1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 0});
+  strings_column_wrapper col1({"a", "bb", "ccc", "dddd", "eeeee", "ffffff"}, {0, 1, 1, 1, 0, 1});
+  auto const table  = cudf::table_view{{col0, col1}};
+  auto const sliced = cudf::slice(table, {2, 5})[0];
+
+  auto const rows = cudf::convert_to_rows(sliced);
+  ASSERT_EQ(rows.size(), 1u);
+  auto const result = cudf::convert_from_rows(cudf::lists_column_view{*rows[0]}, schema_of(sliced));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(sliced, *result);
+}
+
+TEST_F(RowConversionTest, ManyColumns)
+{
+  // more columns than threads in the y dimension of a block, and more rows than a block
+  constexpr cudf::size_type num_columns = 200;
+  constexpr cudf::size_type num_rows    = 3000;
+  std::vector<fixed_width_column_wrapper<int32_t>> columns;
+  for (cudf::size_type col = 0; col < num_columns; ++col) {
+    auto values = cudf::detail::make_counting_transform_iterator(
+      0, [col](auto row) { return row * num_columns + col; });
+    auto validity = cudf::detail::make_counting_transform_iterator(
+      0, [col](auto row) { return (row + col) % 7 != 0; });
+    columns.emplace_back(values, values + num_rows, validity);
+  }
+  std::vector<cudf::column_view> views(columns.begin(), columns.end());
+  auto const input = cudf::table_view{views};
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  auto const result = cudf::convert_from_rows(cudf::lists_column_view{*rows[0]}, schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+}
+
+TEST_F(RowConversionTest, Empty)
+{
+  fixed_width_column_wrapper<int32_t> col0({1, 2});
+  strings_column_wrapper col1({"a", "b"});
+  auto const input = cudf::slice(cudf::table_view{{col0, col1}}, {1, 1})[0];
+  EXPECT_TRUE(cudf::convert_to_rows(input).empty());
+
+  auto const rows   = cudf::convert_to_rows(cudf::table_view{{col0, col1}});
+  auto const empty  = cudf::slice(rows[0]->view(), {1, 1})[0];
+  auto const result = cudf::convert_from_rows(cudf::lists_column_view{empty}, schema_of(input));
+  EXPECT_EQ(result->num_columns(), 2);
+  EXPECT_EQ(result->num_rows(), 0);
+}
+
+TEST_F(RowConversionTest, Errors)
+{
+  lists_column_wrapper<int32_t> lists{{1, 2}, {3}};
+  EXPECT_THROW(cudf::convert_to_rows(cudf::table_view{{lists}}), cudf::logic_error);
+
+  fixed_width_column_wrapper<int64_t> col0({1, 2});
+  auto const rows = cudf::convert_to_rows(cudf::table_view{{col0}});
+  auto const view = cudf::lists_column_view{*rows[0]};
+  EXPECT_THROW(cudf::convert_from_rows(view, {cudf::data_type{cudf::type_id::LIST}}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::convert_from_rows(view,
+                                       {cudf::data_type{cudf::type_id::INT64},
+                                        cudf::data_type{cudf::type_id::INT64}}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::convert_from_rows(cudf::lists_column_view{lists},
+                                       {cudf::data_type{cudf::type_id::INT32}}),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -16,6 +16,7 @@
 
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_wrapper.hpp>
@@ -98,6 +99,20 @@ TYPED_TEST(TypedScalarTest, MoveConstructor)
   EXPECT_EQ(data_ptr, s2.data());
 }
 
+TYPED_TEST(TypedScalarTest, SetValidityInDeviceMemory)
+{
+  TypeParam value = cudf::test::make_type_param_scalar<TypeParam>(3);
+  cudf::scalar_type_t<TypeParam> s(value);
+  EXPECT_TRUE(s.is_valid());
+
+  bool const is_valid = false;
+  CUDA_TRY(cudaMemcpy(s.validity_data(), &is_valid, sizeof(bool), cudaMemcpyHostToDevice));
+  EXPECT_FALSE(s.is_valid());
+
+  s.set_valid(true);
+  EXPECT_TRUE(s.is_valid());
+}
+
 struct StringScalarTest : public cudf::test::BaseFixture {
 };
 
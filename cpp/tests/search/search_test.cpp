@@ -19,9 +19,13 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/search.hpp>
 
+#include <string>
+#include <vector>
+
 struct SearchTest : public cudf::test::BaseFixture {
 };
 
@@ -1816,6 +1820,99 @@ TEST_F(SearchTest, multi_contains_empty_input_set_string)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, hash_contains_reused)
+{
+  cudf::test::strings_column_wrapper needles({"17", "23", "", "72"}, {1, 1, 0, 1});
+  cudf::hash_contains const needles_set(needles);
+
+  cudf::test::strings_column_wrapper first({"0", "17", "", "72", "23"}, {1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<bool> first_expect{{0, 1, 0, 1, 1}, {1, 1, 0, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*needles_set.contains(first), first_expect);
+
+  cudf::test::strings_column_wrapper second({"23", "24", "1", "17"});
+  fixed_width_column_wrapper<bool> second_expect{1, 0, 0, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*needles_set.contains(second), second_expect);
+
+  fixed_width_column_wrapper<int32_t> other_type{17, 23};
+  EXPECT_THROW(needles_set.contains(other_type), cudf::logic_error);
+}
+
+TEST_F(SearchTest, hash_contains_large_haystack)
+{
+  auto const num_rows = 100000;
+  auto haystack_begin = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  fixed_width_column_wrapper<int32_t> haystack(haystack_begin, haystack_begin + num_rows);
+
+  // every third row, in the reverse order of the haystack
+  auto needles_begin = cudf::detail::make_counting_transform_iterator(
+    0, [num_rows](auto i) { return num_rows - 1 - 3 * i; });
+  fixed_width_column_wrapper<int32_t> needles(needles_begin, needles_begin + num_rows / 3);
+
+  auto expect_begin = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 3 == 0 and i > 0; });
+  fixed_width_column_wrapper<bool> expect(expect_begin, expect_begin + num_rows);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::contains(haystack, needles), expect);
+}
+
+TEST_F(SearchTest, sorted_values_with_nulls)
+{
+  auto column_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i / 3; });
+  auto column_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i >= 100; });
+  auto values_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 2 / 3 - 5; });
+  auto values_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i >= 50; });
+  fixed_width_column_wrapper<int32_t> column(column_data, column_data + 2000, column_valid);
+  fixed_width_column_wrapper<int32_t> values(values_data, values_data + 1500, values_valid);
+
+  cudf::table_view const t{{column}};
+  cudf::table_view const v{{values}};
+  std::vector<cudf::order> const column_order{cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::BEFORE};
+
+  // Merging the sorted values with the column gives the bounds of a search of each value
+  auto const expect_lower = cudf::lower_bound(t, v, column_order, null_precedence);
+  auto const expect_upper = cudf::upper_bound(t, v, column_order, null_precedence);
+  auto const lower = cudf::lower_bound(t, v, column_order, null_precedence, cudf::sorted::YES);
+  auto const upper = cudf::upper_bound(t, v, column_order, null_precedence, cudf::sorted::YES);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expect_lower, *lower);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expect_upper, *upper);
+}
+
+TEST_F(SearchTest, sorted_values_multi_column_descending)
+{
+  auto column_0_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 100 - i / 10; });
+  auto column_1_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i % 10); });
+  auto values_0_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 105 - i / 5; });
+  auto values_1_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i % 5 * 2); });
+  fixed_width_column_wrapper<int32_t> column_0(column_0_data, column_0_data + 1000);
+  cudf::test::strings_column_wrapper column_1(column_1_data, column_1_data + 1000);
+  fixed_width_column_wrapper<int32_t> values_0(values_0_data, values_0_data + 600);
+  cudf::test::strings_column_wrapper values_1(values_1_data, values_1_data + 600);
+
+  cudf::table_view const t{{column_0, column_1}};
+  cudf::table_view const v{{values_0, values_1}};
+  std::vector<cudf::order> const column_order{cudf::order::DESCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::BEFORE,
+                                                      cudf::null_order::BEFORE};
+
+  auto const expect_lower = cudf::lower_bound(t, v, column_order, null_precedence);
+  auto const expect_upper = cudf::upper_bound(t, v, column_order, null_precedence);
+  auto const lower = cudf::lower_bound(t, v, column_order, null_precedence, cudf::sorted::YES);
+  auto const upper = cudf::upper_bound(t, v, column_order, null_precedence, cudf::sorted::YES);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expect_lower, *lower);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expect_upper, *upper);
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
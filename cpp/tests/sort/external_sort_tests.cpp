@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct ExternalSortTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Pushes `input` to `sorter` in chunks of `chunk_rows` rows, and concatenates the sorted
+   * chunks returned by the sorter.
+   */
+  std::unique_ptr<cudf::table> external_sort(cudf::external_sorter& sorter,
+                                             cudf::table_view const& input,
+                                             cudf::size_type chunk_rows)
+  {
+    for (cudf::size_type begin = 0; begin < input.num_rows(); begin += chunk_rows) {
+      auto const end = std::min(begin + chunk_rows, input.num_rows());
+      sorter.push(cudf::slice(input, {begin, end}).front());
+    }
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (auto chunk = sorter.next_chunk()) {
+      chunks.push_back(std::move(chunk));
+    }
+    EXPECT_GT(chunks.size(), 1u);
+    EXPECT_EQ(sorter.next_chunk(), nullptr);
+
+    std::vector<cudf::table_view> views;
+    for (auto const& chunk : chunks) {
+      views.push_back(chunk->view());
+    }
+    return cudf::concatenate(views);
+  }
+
+  /**
+   * @brief Returns a table of distinct integer keys, some of which are null, and of strings
+   * determined by the keys, so that the sorted table is unique.
+   */
+  std::unique_ptr<cudf::table> make_input(cudf::size_type num_rows)
+  {
+    std::vector<int32_t> keys(num_rows);
+    std::vector<bool> valid(num_rows);
+    std::vector<std::string> payload(num_rows);
+    for (cudf::size_type i = 0; i < num_rows; ++i) {
+      keys[i]    = (i * 389) % num_rows;
+      valid[i]   = keys[i] % 17 != 0;
+      payload[i] = valid[i] ? "payload " + std::to_string(keys[i]) : "null";
+    }
+    cudf::test::fixed_width_column_wrapper<int32_t> key_col(
+      keys.begin(), keys.end(), valid.begin());
+    cudf::test::strings_column_wrapper payload_col(payload.begin(), payload.end());
+    return std::make_unique<cudf::table>(cudf::table_view{{payload_col, key_col}});
+  }
+};
+
+TEST_F(ExternalSortTest, HostSpill)
+{
+  auto const input = make_input(1000);
+  cudf::external_sorter sorter({1}, {}, {}, {}, 16);
+
+  auto const got = external_sort(sorter, input->view(), 250);
+  auto const expected =
+    cudf::sort_by_key(input->view(), input->view().select({1}), {cudf::order::ASCENDING});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
+TEST_F(ExternalSortTest, FileSpill)
+{
+  auto const input = make_input(1000);
+  std::vector<cudf::order> column_order{cudf::order::DESCENDING};
+  std::vector<cudf::null_order> null_precedence{cudf::null_order::AFTER};
+  cudf::external_sorter sorter(
+    {1}, column_order, null_precedence, temp_env->get_temp_filepath("ExternalSort.bin"), 10);
+
+  auto const got = external_sort(sorter, input->view(), 300);
+  auto const expected =
+    cudf::sort_by_key(input->view(), input->view().select({1}), column_order, null_precedence);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
+TEST_F(ExternalSortTest, InvalidArguments)
+{
+  EXPECT_THROW(cudf::external_sorter(std::vector<cudf::size_type>{}), cudf::logic_error);
+  EXPECT_THROW(cudf::external_sorter({0}, {cudf::order::ASCENDING, cudf::order::ASCENDING}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::external_sorter({0}, {}, {}, {}, 0), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{3, 1, 2}};
+  cudf::test::fixed_width_column_wrapper<int64_t> other_col{{3, 1, 2}};
+  cudf::external_sorter sorter({0});
+  sorter.push(cudf::table_view{{col}});
+  EXPECT_THROW(sorter.push(cudf::table_view{{other_col}}), cudf::logic_error);
+
+  EXPECT_NE(sorter.next_chunk(), nullptr);
+  EXPECT_THROW(sorter.push(cudf::table_view{{col}}), cudf::logic_error);
+}
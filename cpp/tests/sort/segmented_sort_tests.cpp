@@ -24,6 +24,7 @@
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -242,6 +243,44 @@ TEST_F(SegmentedSortInt, Sliced)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected3);
 }
 
+TEST_F(SegmentedSortInt, MixedSegmentSizes)
+{
+  // Segments sorted by a warp, by a block, and together with their segment ids
+  std::vector<size_type> segment_sizes{0, 1, 5, 32, 33, 700, 2048, 2049, 1, 5000, 17};
+  std::vector<size_type> offsets{0};
+  std::vector<int> segment_ids;
+  std::vector<int> ints;
+  std::vector<bool> valid;
+  std::vector<std::string> strings;
+  for (size_type segment = 0; segment < static_cast<size_type>(segment_sizes.size()); ++segment) {
+    for (size_type i = 0; i < segment_sizes[segment]; ++i) {
+      auto const row = static_cast<int>(ints.size());
+      segment_ids.push_back(segment);
+      ints.push_back((row * 7919) % 61);
+      valid.push_back(row % 11 != 0);
+      strings.push_back("s" + std::to_string((row * 31) % 23));
+    }
+    offsets.push_back(offsets.back() + segment_sizes[segment]);
+  }
+  column_wrapper<int> segments(offsets.begin(), offsets.end());
+  column_wrapper<int> segment_col(segment_ids.begin(), segment_ids.end());
+  column_wrapper<int> int_col(ints.begin(), ints.end(), valid.begin());
+  strings_column_wrapper string_col(strings.begin(), strings.end());
+  table_view keys{{int_col, string_col}};
+  table_view keys_with_segment_ids{{segment_col, int_col, string_col}};
+
+  std::vector<order> column_order{order::DESCENDING, order::ASCENDING};
+  for (auto null_prec : {null_order::BEFORE, null_order::AFTER}) {
+    auto const results =
+      cudf::segmented_sort_by_key(keys, keys, segments, column_order, {null_prec, null_prec});
+    auto const expected = cudf::sort_by_key(keys_with_segment_ids,
+                                            keys_with_segment_ids,
+                                            {order::ASCENDING, order::DESCENDING, order::ASCENDING},
+                                            {null_order::AFTER, null_prec, null_prec});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(results->view(), expected->view().select({1, 2}));
+  }
+}
+
 TEST_F(SegmentedSortInt, ErrorsMismatchArgSizes)
 {
   using T = int;
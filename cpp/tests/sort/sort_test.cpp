@@ -28,6 +28,10 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <string>
 #include <vector>
 
 namespace cudf {
@@ -647,6 +651,54 @@ TYPED_TEST(Sort, ZeroSizedColumns)
   run_sort_test(input, expected, column_order);
 }
 
+struct SortStructs : public BaseFixture {
+};
+
+TEST_F(SortStructs, NullsInChildren)
+{
+  // The nulls of the children are compared even where the struct rows are valid
+  fixed_width_column_wrapper<int32_t> a{{1, 0, 1, 0, 7}, {1, 0, 1, 1, 1}};
+  fixed_width_column_wrapper<int32_t> b{{2, 1, 0, 5, 7}, {1, 1, 0, 1, 1}};
+  auto struct_col = cudf::test::structs_column_wrapper{{a, b}, {1, 1, 1, 1, 0}}.release();
+  table_view input{{struct_col->view()}};
+
+  fixed_width_column_wrapper<int32_t> expected{{4, 1, 3, 2, 0}};
+  std::vector<order> column_order{order::ASCENDING};
+
+  auto got = sorted_order(input, column_order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  // Run test for sort and sort_by_key
+  run_sort_test(input, expected, column_order);
+}
+
+struct SortLists : public BaseFixture {
+};
+
+TEST_F(SortLists, Lexicographic)
+{
+  using LCW     = cudf::test::lists_column_wrapper<int32_t>;
+  auto validity = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0), [](auto i) { return i != 3; });
+  LCW col({LCW{1, 2}, LCW{1}, LCW{}, LCW{}, LCW{1, 2, 0}, LCW{0, 5}}, validity);
+  table_view input{{col}};
+
+  // A list is ordered after its prefixes
+  fixed_width_column_wrapper<int32_t> expected{{3, 2, 5, 1, 0, 4}};
+  std::vector<order> column_order{order::ASCENDING};
+
+  auto got = sorted_order(input, column_order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  // Run test for sort and sort_by_key
+  run_sort_test(input, expected, column_order);
+
+  auto const sliced = cudf::slice(input, {1, 5})[0];
+  fixed_width_column_wrapper<int32_t> expected_sliced{{2, 1, 0, 3}};
+  got = sorted_order(sliced, column_order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sliced, got->view());
+}
+
 struct SortByKey : public BaseFixture {
 };
 
@@ -665,6 +717,149 @@ TEST_F(SortByKey, ValueKeysSizeMismatch)
   EXPECT_THROW(sort_by_key(values, keys), logic_error);
 }
 
+struct SortNormalizedKeys : public BaseFixture {
+};
+
+TEST_F(SortNormalizedKeys, FloatingPoint)
+{
+  auto const inf = std::numeric_limits<double>::infinity();
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+  fixed_width_column_wrapper<double> col1{{nan, 0.0, -0.0, -inf, 1.0, -nan}};
+  fixed_width_column_wrapper<int32_t> col2{{0, 1, 0, 1, 0, 1}};
+  table_view input{{col1, col2}};
+
+  // -0.0 is equivalent to 0.0, and NaNs are equivalent and greater than all other values
+  fixed_width_column_wrapper<int32_t> expected{{3, 2, 1, 4, 0, 5}};
+  auto got = sorted_order(input);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  fixed_width_column_wrapper<int32_t> expected_descending{{5, 0, 4, 1, 2, 3}};
+  got = sorted_order(input, {order::DESCENDING, order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_descending, got->view());
+}
+
+TEST_F(SortNormalizedKeys, MatchesComparator)
+{
+  auto const nan = std::numeric_limits<float>::quiet_NaN();
+
+  fixed_width_column_wrapper<int32_t> col1({3, -1, 3, 0, -1, 3, 0, 2, -5, 3},
+                                           {1, 1, 0, 1, 1, 1, 0, 1, 1, 1});
+  fixed_width_column_wrapper<float> col2({nan, -0.0f, 1.5f, 0.0f, -2.5f, nan, 1.5f, 4.f, 0.f, 1.5f},
+                                         {1, 1, 1, 0, 1, 1, 1, 1, 0, 1});
+  strings_column_wrapper col3({"b", "", "abc", "ab", "b", "\xff", "a", "abcdefg", "", "ab"},
+                              {1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int64_t> col4{{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}};
+  // Struct columns have no normalized keys, so the rows are sorted with the comparator, in the
+  // same order since the appended column is constant
+  fixed_width_column_wrapper<int32_t> constant_child{{7, 7, 7, 7, 7, 7, 7, 7, 7, 7}};
+  auto col5 = structs_column_wrapper{{constant_child}}.release();
+
+  std::vector<std::vector<order>> column_orders{
+    {order::ASCENDING, order::ASCENDING, order::ASCENDING, order::ASCENDING},
+    {order::DESCENDING, order::ASCENDING, order::DESCENDING, order::ASCENDING},
+    {order::ASCENDING, order::DESCENDING, order::ASCENDING, order::DESCENDING}};
+  std::vector<std::vector<null_order>> null_precedences{
+    {null_order::BEFORE, null_order::BEFORE, null_order::BEFORE, null_order::BEFORE},
+    {null_order::AFTER, null_order::BEFORE, null_order::AFTER, null_order::BEFORE},
+    {null_order::BEFORE, null_order::AFTER, null_order::AFTER, null_order::AFTER}};
+
+  for (auto const& column_order : column_orders) {
+    for (auto const& null_precedence : null_precedences) {
+      auto comparator_order = column_order;
+      comparator_order.push_back(order::ASCENDING);
+      auto comparator_null_precedence = null_precedence;
+      comparator_null_precedence.push_back(null_order::BEFORE);
+
+      auto expected = stable_sorted_order(table_view{{col1, col2, col3, col4, *col5}},
+                                          comparator_order,
+                                          comparator_null_precedence);
+      auto got =
+        stable_sorted_order(table_view{{col1, col2, col3, col4}}, column_order, null_precedence);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), got->view());
+
+      got = sorted_order(table_view{{col1, col2, col3, col4}}, column_order, null_precedence);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), got->view());
+    }
+  }
+}
+
+TEST_F(SortNormalizedKeys, LongStrings)
+{
+  // Strings tied in their first prefixes of 7 bytes, ending within or at the end of prefixes
+  std::vector<std::string> const strings{"abcdefghijklmnopq",
+                                         "abcdefg",
+                                         "abcdefghijklmn",
+                                         "abcdefghijklmnop",
+                                         "abcdefgh",
+                                         "abcdefghijklmnopq",
+                                         "null",
+                                         "abcdefghijklmnoq",
+                                         "",
+                                         std::string("abcdefg\0", 8),
+                                         "abcdefghijklmn"};
+  std::vector<bool> const validity{1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1};
+  strings_column_wrapper col(strings.begin(), strings.end(), validity.begin());
+
+  for (auto const column_order : {order::ASCENDING, order::DESCENDING}) {
+    for (auto const null_precedence : {null_order::BEFORE, null_order::AFTER}) {
+      // Nulls are the smallest values with null_order::BEFORE
+      auto const descending  = column_order == order::DESCENDING;
+      auto const nulls_first = (null_precedence == null_order::BEFORE) != descending;
+
+      std::vector<int32_t> expected(strings.size());
+      std::iota(expected.begin(), expected.end(), 0);
+      std::stable_sort(expected.begin(), expected.end(), [&](auto lhs, auto rhs) {
+        if (not validity[lhs] or not validity[rhs]) {
+          return validity[lhs] != validity[rhs] and validity[lhs] != nulls_first;
+        }
+        return descending ? strings[rhs] < strings[lhs] : strings[lhs] < strings[rhs];
+      });
+      fixed_width_column_wrapper<int32_t> expected_indices(expected.begin(), expected.end());
+
+      auto got = stable_sorted_order(table_view{{col}}, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_indices, got->view());
+
+      got = sorted_order(table_view{{col}}, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_indices, got->view());
+    }
+  }
+}
+
+TEST_F(SortNormalizedKeys, CaseInsensitive)
+{
+  // Only ASCII letters are folded: "Ñ" and "ñ" stay distinct
+  strings_column_wrapper col1{"b", "A", "a", "B", "ab", "AB", "Ñ", "aC", "ñ"};
+  fixed_width_column_wrapper<int32_t> constant_child{{7, 7, 7, 7, 7, 7, 7, 7, 7}};
+  auto col2 = structs_column_wrapper{{constant_child}}.release();
+
+  std::vector<case_sensitivity> const insensitive{case_sensitivity::INSENSITIVE};
+  fixed_width_column_wrapper<int32_t> expected{{1, 2, 4, 5, 7, 0, 3, 6, 8}};
+  auto got = stable_sorted_order(table_view{{col1}}, {}, {}, insensitive);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+  got = sorted_order(table_view{{col1}}, {}, {}, insensitive);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  fixed_width_column_wrapper<int32_t> expected_descending{{8, 6, 0, 3, 7, 4, 5, 1, 2}};
+  got = stable_sorted_order(table_view{{col1}}, {order::DESCENDING}, {}, insensitive);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_descending, got->view());
+
+  // The comparator folds the strings like the normalized keys
+  got = stable_sorted_order(table_view{{col1, *col2}},
+                            {},
+                            {},
+                            {case_sensitivity::INSENSITIVE, case_sensitivity::SENSITIVE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  fixed_width_column_wrapper<int32_t> expected_sensitive{{1, 5, 3, 2, 7, 4, 0, 6, 8}};
+  got = stable_sorted_order(
+    table_view{{col1}}, {}, {}, std::vector<case_sensitivity>{case_sensitivity::SENSITIVE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sensitive, got->view());
+
+  EXPECT_THROW(sorted_order(table_view{{col1}}, {}, {}, {insensitive[0], insensitive[0]}),
+               logic_error);
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <string>
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+template <typename T>
+struct TopKTypedTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(TopKTypedTest, cudf::test::NumericTypes);
+
+TYPED_TEST(TopKTypedTest, Basic)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T> col{{5, 2, 8, 2, 9}};
+  cudf::table_view keys{{col}};
+
+  fixed_width_column_wrapper<cudf::size_type> expected_descending{{4, 2, 0}};
+  auto got = cudf::top_k(keys, 3, {cudf::order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_descending, got->view());
+
+  fixed_width_column_wrapper<cudf::size_type> expected_ascending{{1, 3, 0}};
+  got = cudf::top_k(keys, 3, {cudf::order::ASCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_ascending, got->view());
+}
+
+TYPED_TEST(TopKTypedTest, KLargerThanRows)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T> col({5, 2, 8, 2, 9}, {1, 0, 1, 1, 1});
+  cudf::table_view keys{{col}};
+
+  fixed_width_column_wrapper<cudf::size_type> expected{{1, 3, 0, 2, 4}};
+  auto got = cudf::top_k(keys, 10);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+struct TopKTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TopKTest, Empty)
+{
+  fixed_width_column_wrapper<int32_t> col{{3, 1, 2}};
+  fixed_width_column_wrapper<cudf::size_type> expected{};
+
+  auto got = cudf::top_k(cudf::table_view{{col}}, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+
+  fixed_width_column_wrapper<int32_t> empty_col{};
+  got = cudf::top_k(cudf::table_view{{empty_col}}, 5);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(TopKTest, InvalidArguments)
+{
+  fixed_width_column_wrapper<int32_t> col{{3, 1, 2}};
+  cudf::table_view keys{{col}};
+
+  EXPECT_THROW(cudf::top_k(keys, -1), cudf::logic_error);
+  EXPECT_THROW(cudf::top_k(keys, 1, {cudf::order::ASCENDING, cudf::order::ASCENDING}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::top_k(keys, 1, {}, {cudf::null_order::AFTER, cudf::null_order::AFTER}),
+               cudf::logic_error);
+}
+
+TEST_F(TopKTest, MultiColumnMatchesSortedOrder)
+{
+  // Enough rows for k to be a small fraction of them, with many ties
+  constexpr cudf::size_type num_rows = 10000;
+  auto const rows                    = thrust::make_counting_iterator<cudf::size_type>(0);
+
+  auto const ints  = thrust::make_transform_iterator(rows, [](auto i) { return (i * 7919) % 100; });
+  auto const valid = thrust::make_transform_iterator(rows, [](auto i) { return i % 13 != 0; });
+  fixed_width_column_wrapper<int32_t> col1(ints, ints + num_rows, valid);
+
+  std::vector<std::string> strings(num_rows);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    strings[i] = "s" + std::to_string((i * 31) % 47);
+  }
+  strings_column_wrapper col2(strings.begin(), strings.end());
+  cudf::table_view keys{{col1, col2}};
+
+  std::vector<cudf::order> column_order{cudf::order::DESCENDING, cudf::order::ASCENDING};
+  for (auto null_precedence : {cudf::null_order::BEFORE, cudf::null_order::AFTER}) {
+    std::vector<cudf::null_order> null_precedences{null_precedence, null_precedence};
+    auto const sorted = cudf::stable_sorted_order(keys, column_order, null_precedences);
+    for (cudf::size_type k : {1, 10, 100, 1000}) {
+      auto const expected = cudf::slice(sorted->view(), {0, k}).front();
+      auto got            = cudf::top_k(keys, k, column_order, null_precedences);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    }
+  }
+}
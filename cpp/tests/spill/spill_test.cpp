@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/spill.hpp>
+#include <cudf/table/table.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/limiting_resource_adaptor.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <new>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct SpillTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::unique_ptr<cudf::table> make_table()
+{
+  auto ints = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4, 5}, {1, 0, 1, 1, 1});
+  auto strings =
+    cudf::test::strings_column_wrapper({"Vimes", "", "Carrot", "Angua", "Nobby"}, {1, 0, 1, 1, 1});
+  auto lists =
+    cudf::test::lists_column_wrapper<int64_t>{{1, 2}, {3}, {8}, {4, 5, 6}, {7}}.release();
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(ints.release());
+  columns.push_back(strings.release());
+  columns.push_back(std::move(lists));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+}  // namespace
+
+TEST_F(SpillTest, SpillToHost)
+{
+  auto const expected = make_table();
+  cudf::spill_manager manager;
+  auto spillable  = manager.make_spillable(std::make_unique<cudf::table>(*expected));
+  auto const size = manager.device_size();
+  EXPECT_GT(size, 0u);
+
+  EXPECT_EQ(manager.spill(size), size);
+  EXPECT_EQ(manager.device_size(), 0u);
+  EXPECT_EQ(manager.spilled_size(), size);
+  for (auto const& col : spillable->columns()) {
+    EXPECT_TRUE(col->is_spilled());
+  }
+  EXPECT_EQ(manager.spill(size), 0u);
+
+  {
+    auto guard = spillable->access();
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), guard.view());
+    EXPECT_EQ(manager.device_size(), size);
+    EXPECT_EQ(manager.spilled_size(), 0u);
+  }
+  manager.spill(size);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), spillable->release()->view());
+  EXPECT_EQ(manager.device_size(), 0u);
+  EXPECT_EQ(manager.spilled_size(), 0u);
+}
+
+TEST_F(SpillTest, SpillToDisk)
+{
+  auto const expected = make_table();
+  cudf::spill_manager manager(cudf::spill_target::DISK, temp_env->get_temp_dir());
+  auto spillable = manager.make_spillable(std::make_unique<cudf::table>(*expected));
+
+  EXPECT_GT(manager.spill(manager.device_size()), 0u);
+  for (auto const& col : spillable->columns()) {
+    EXPECT_TRUE(col->is_spilled());
+  }
+  auto guard = spillable->access();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), guard.view());
+
+  EXPECT_THROW(cudf::spill_manager(cudf::spill_target::DISK), cudf::logic_error);
+}
+
+TEST_F(SpillTest, SpillOrder)
+{
+  auto col        = cudf::test::fixed_width_column_wrapper<int64_t>({1, 2, 3, 4});
+  auto a          = cudf::column(col);
+  auto b          = cudf::column(col);
+  auto c          = cudf::column(col);
+  auto const size = a.size() * sizeof(int64_t);
+
+  cudf::spill_manager manager;
+  auto high = manager.make_spillable(std::make_unique<cudf::column>(a), 1);
+  auto old  = manager.make_spillable(std::make_unique<cudf::column>(b));
+  auto lru  = manager.make_spillable(std::make_unique<cudf::column>(c));
+  old->access();
+
+  // lower priorities first, then least recently accessed
+  EXPECT_EQ(manager.spill(1), size);
+  EXPECT_TRUE(lru->is_spilled());
+  EXPECT_FALSE(old->is_spilled());
+  EXPECT_EQ(manager.spill(1), size);
+  EXPECT_TRUE(old->is_spilled());
+  EXPECT_FALSE(high->is_spilled());
+  EXPECT_EQ(manager.spill(1), size);
+  EXPECT_TRUE(high->is_spilled());
+}
+
+TEST_F(SpillTest, AccessedColumnsAreNotSpilled)
+{
+  auto col = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3}, {1, 0, 1});
+  cudf::spill_manager manager;
+  auto spillable = manager.make_spillable(col.release());
+  {
+    auto guard = spillable->access();
+    EXPECT_EQ(manager.spill(spillable->size()), 0u);
+    EXPECT_FALSE(spillable->is_spilled());
+    EXPECT_THROW(spillable->release(), cudf::logic_error);
+  }
+  EXPECT_EQ(manager.spill(spillable->size()), spillable->size());
+
+  auto const released = spillable->release();
+  EXPECT_EQ(released->null_count(), 1);
+  EXPECT_THROW(spillable->access(), cudf::logic_error);
+  EXPECT_THROW(spillable->release(), cudf::logic_error);
+  EXPECT_EQ(manager.spill(1), 0u);
+}
+
+TEST_F(SpillTest, SpillOnFailedAllocation)
+{
+  auto const size = 4096;
+  rmm::mr::limiting_resource_adaptor<rmm::mr::device_memory_resource> limited(
+    rmm::mr::get_current_device_resource(), 2 * size);
+  cudf::spill_manager manager;
+  cudf::spilling_resource_adaptor mr(&limited, manager);
+
+  auto make_column = [&]() {
+    return manager.make_spillable(cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                            size / sizeof(int32_t),
+                                                            cudf::mask_state::UNALLOCATED,
+                                                            rmm::cuda_stream_default,
+                                                            &limited));
+  };
+  auto first  = make_column();
+  auto second = make_column();
+
+  // the least recently accessed column is spilled to make room
+  auto buffer = rmm::device_buffer(size, rmm::cuda_stream_default, &mr);
+  EXPECT_TRUE(first->is_spilled());
+  EXPECT_FALSE(second->is_spilled());
+
+  auto guard = second->access();
+  EXPECT_THROW(rmm::device_buffer(size, rmm::cuda_stream_default, &mr), std::bad_alloc);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -19,6 +19,7 @@
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/types.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -67,6 +68,30 @@ TEST_F(ApplyBooleanMask, NullBooleanMask)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got->view());
 }
 
+TEST_F(ApplyBooleanMask, Bitmask)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper col2({"a", "b", "c", "d", "e", "f"});
+  cudf::table_view input{{col1, col2}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, false, true, false},
+                                                            {0, 1, 1, 1, 1, 1}};
+  auto const bitmask = cudf::bools_to_mask(boolean_mask);
+  EXPECT_EQ(4, bitmask.second);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected{{70, 2}, {0, 1}};
+  cudf::test::strings_column_wrapper col2_expected({"c", "e"});
+  cudf::table_view expected{{col1_expected, col2_expected}};
+
+  auto got = cudf::apply_boolean_mask(
+    input, static_cast<cudf::bitmask_type const*>(bitmask.first->data()));
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::apply_boolean_mask(input, boolean_mask)->view(), got->view());
+
+  auto const empty = cudf::apply_boolean_mask(cudf::empty_like(input)->view(), nullptr);
+  EXPECT_EQ(0, empty->num_rows());
+}
+
 TEST_F(ApplyBooleanMask, EmptyMask)
 {
   cudf::test::fixed_width_column_wrapper<int16_t> col1{{true, false, true, false, true, false},
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <vector>
+
+using cudf::duplicate_keep_option;
+using cudf::null_equality;
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+template <typename T>
+struct DistinctTyped : public cudf::test::BaseFixture {
+};
+
+// Booleans have too few distinct values for the keys of the test
+using DistinctTypes = cudf::test::
+  Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes, cudf::test::ChronoTypes>;
+
+TYPED_TEST_CASE(DistinctTyped, DistinctTypes);
+
+TYPED_TEST(DistinctTyped, KeepOptions)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T, int32_t> key_col{{5, 4, 3, 5, 8, 4, 5}};
+  fixed_width_column_wrapper<int32_t> val_col{{0, 1, 2, 3, 4, 5, 6}};
+  cudf::table_view input{{key_col, val_col}};
+  std::vector<cudf::size_type> keys{0};
+
+  // The kept rows are in their input order
+  fixed_width_column_wrapper<T, int32_t> exp_key_first{{5, 4, 3, 8}};
+  fixed_width_column_wrapper<int32_t> exp_val_first{{0, 1, 2, 4}};
+  auto got = cudf::distinct(input, keys, duplicate_keep_option::KEEP_FIRST);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_key_first, exp_val_first}), got->view());
+
+  fixed_width_column_wrapper<T, int32_t> exp_key_last{{3, 8, 4, 5}};
+  fixed_width_column_wrapper<int32_t> exp_val_last{{2, 4, 5, 6}};
+  got = cudf::distinct(input, keys, duplicate_keep_option::KEEP_LAST);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_key_last, exp_val_last}), got->view());
+
+  fixed_width_column_wrapper<T, int32_t> exp_key_none{{3, 8}};
+  fixed_width_column_wrapper<int32_t> exp_val_none{{2, 4}};
+  got = cudf::distinct(input, keys, duplicate_keep_option::KEEP_NONE);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_key_none, exp_val_none}), got->view());
+}
+
+struct Distinct : public cudf::test::BaseFixture {
+};
+
+TEST_F(Distinct, WithNull)
+{
+  fixed_width_column_wrapper<int32_t> key_col{{1, 0, 2, 0, 1}, {1, 0, 1, 0, 1}};
+  fixed_width_column_wrapper<int32_t> val_col{{0, 1, 2, 3, 4}};
+  cudf::table_view input{{key_col, val_col}};
+  std::vector<cudf::size_type> keys{0};
+
+  fixed_width_column_wrapper<int32_t> exp_key_equal{{1, 0, 2}, {1, 0, 1}};
+  fixed_width_column_wrapper<int32_t> exp_val_equal{{0, 1, 2}};
+  auto got = cudf::distinct(input, keys, duplicate_keep_option::KEEP_FIRST, null_equality::EQUAL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_key_equal, exp_val_equal}), got->view());
+
+  // Unequal nulls are all distinct
+  fixed_width_column_wrapper<int32_t> exp_key_unequal{{1, 0, 2, 0}, {1, 0, 1, 0}};
+  fixed_width_column_wrapper<int32_t> exp_val_unequal{{0, 1, 2, 3}};
+  got = cudf::distinct(input, keys, duplicate_keep_option::KEEP_FIRST, null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_key_unequal, exp_val_unequal}),
+                                got->view());
+
+  fixed_width_column_wrapper<int32_t> exp_key_none{{0, 2, 0}, {0, 1, 0}};
+  fixed_width_column_wrapper<int32_t> exp_val_none{{1, 2, 3}};
+  got = cudf::distinct(input, keys, duplicate_keep_option::KEEP_NONE, null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_key_none, exp_val_none}), got->view());
+}
+
+TEST_F(Distinct, StringAndIntegerKeys)
+{
+  strings_column_wrapper str_col{{"a", "b", "a", "b", "a"}};
+  fixed_width_column_wrapper<int32_t> int_col{{1, 1, 1, 2, 1}};
+  fixed_width_column_wrapper<int32_t> val_col{{0, 1, 2, 3, 4}};
+  cudf::table_view input{{str_col, int_col, val_col}};
+  std::vector<cudf::size_type> keys{0, 1};
+
+  strings_column_wrapper exp_str_first{{"a", "b", "b"}};
+  fixed_width_column_wrapper<int32_t> exp_int_first{{1, 1, 2}};
+  fixed_width_column_wrapper<int32_t> exp_val_first{{0, 1, 3}};
+  auto got = cudf::distinct(input, keys, duplicate_keep_option::KEEP_FIRST);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_str_first, exp_int_first, exp_val_first}),
+                                got->view());
+
+  strings_column_wrapper exp_str_last{{"b", "b", "a"}};
+  fixed_width_column_wrapper<int32_t> exp_int_last{{1, 2, 1}};
+  fixed_width_column_wrapper<int32_t> exp_val_last{{1, 3, 4}};
+  got = cudf::distinct(input, keys, duplicate_keep_option::KEEP_LAST);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({exp_str_last, exp_int_last, exp_val_last}),
+                                got->view());
+}
+
+TEST_F(Distinct, EmptyInputTable)
+{
+  fixed_width_column_wrapper<int32_t> col(std::initializer_list<int32_t>{});
+  cudf::table_view input{{col}};
+  std::vector<cudf::size_type> keys{0};
+
+  auto got = cudf::distinct(input, keys);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, got->view());
+}
+
+TEST_F(Distinct, EmptyKeys)
+{
+  fixed_width_column_wrapper<int32_t> col{{5, 4, 3, 5, 8, 1}};
+  fixed_width_column_wrapper<int32_t> empty_col{};
+  cudf::table_view input{{col}};
+
+  auto got = cudf::distinct(input, {});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{empty_col}}, got->view());
+}
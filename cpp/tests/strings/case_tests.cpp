@@ -23,9 +23,11 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <string>
 #include <vector>
 
 struct StringsCaseTest : public cudf::test::BaseFixture {
@@ -174,3 +176,37 @@ TEST_F(StringsCaseTest, MultiCharLower)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
+
+TEST_F(StringsCaseTest, LongStrings)
+{
+  // long enough for the strings to be converted with a warp per string
+  auto repeat = [](std::string const& str, int count) {
+    std::string result;
+    for (int i = 0; i < count; ++i) {
+      result += str;
+    }
+    return result;
+  };
+  std::string const input = "\u00c9xamples aBc \u00df \u0130 ";
+  std::vector<std::string> h_strings{repeat(input, 20), "", repeat(input, 3), input};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(), h_strings.end(), cudf::test::iterator_with_null_at(1));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  {
+    std::string const upper = "\u00c9XAMPLES ABC SS \u0130 ";
+    std::vector<std::string> h_expected{repeat(upper, 20), "", repeat(upper, 3), upper};
+    cudf::test::strings_column_wrapper expected(
+      h_expected.begin(), h_expected.end(), cudf::test::iterator_with_null_at(1));
+    auto results = cudf::strings::to_upper(strings_view);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    std::string const lower = "\u00e9xamples abc \u00df \u0069\u0307 ";
+    std::vector<std::string> h_expected{repeat(lower, 20), "", repeat(lower, 3), lower};
+    cudf::test::strings_column_wrapper expected(
+      h_expected.begin(), h_expected.end(), cudf::test::iterator_with_null_at(1));
+    auto results = cudf::strings::to_lower(strings_view);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/combine.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+struct StringsFormatTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StringsFormatTest, Placeholders)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> id{7, 42, 1000};
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep> date(
+    {18690, 18986, 0}, {1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<double> value{3.14159, -2.5, 10.0};
+  auto const input = cudf::table_view({id, date, value});
+
+  auto results = cudf::strings::format("{:04}-{}:{:.2}", input);
+  cudf::test::strings_column_wrapper expected(
+    {"0007-2021-03-04:3.14", "0042-2021-12-25:-2.50", ""}, {1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  // the null date is not used by the pattern
+  results = cudf::strings::format("{2:.1}|{0:6}", input, cudf::string_scalar("?"));
+  cudf::test::strings_column_wrapper expected_indexed({"3.1|     7", "-2.5|    42", "10.0|  1000"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_indexed);
+
+  results = cudf::strings::format("<{1:12}>", input, cudf::string_scalar("?"));
+  cudf::test::strings_column_wrapper expected_narep(
+    {"<  2021-03-04>", "<  2021-12-25>", "<           ?>"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_narep);
+}
+
+TEST_F(StringsFormatTest, StringsAndBooleans)
+{
+  cudf::test::strings_column_wrapper names({"é", "abc", "", "ééééé"});
+  cudf::test::fixed_width_column_wrapper<bool> flags{true, false, true, false};
+  auto const input = cudf::table_view({names, flags});
+
+  // widths count characters rather than bytes, and booleans are not zero-padded
+  auto results = cudf::strings::format("[{:4}] {{{:06}}}", input);
+  cudf::test::strings_column_wrapper expected(
+    {"[   é] {  true}", "[ abc] { false}", "[    ] {  true}", "[ééééé] { false}"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = cudf::strings::format("literal only", input);
+  cudf::test::strings_column_wrapper expected_literal(
+    {"literal only", "literal only", "literal only", "literal only"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_literal);
+}
+
+TEST_F(StringsFormatTest, Numbers)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> integers{-5, 12, 0, -9223372036854775807L};
+  cudf::test::fixed_width_column_wrapper<float> floats{-1.5f, 2.25f, 0.f, 100.f};
+  cudf::test::fixed_width_column_wrapper<double> doubles{1.5, -0.001, 839542223232.794248339, -4};
+  auto const input = cudf::table_view({integers, floats, doubles});
+
+  auto results = cudf::strings::format("{:05}|{:08.3}|{}", input);
+  cudf::test::strings_column_wrapper expected({"-0005|-001.500|1.5",
+                                               "00012|0002.250|-0.001",
+                                               "00000|0000.000|8.395422232e+11",
+                                               "-9223372036854775807|0100.000|-4.0"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  // values too large for the fixed notation are written like from_floats
+  results = cudf::strings::format("{2:.9}", input);
+  cudf::test::strings_column_wrapper expected_fixed(
+    {"1.500000000", "-0.001000000", "8.395422232e+11", "-4.000000000"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_fixed);
+}
+
+TEST_F(StringsFormatTest, Timestamps)
+{
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> seconds{
+    1614834367L, -1L};
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep> millis{
+    1614834367123L, -1L};
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ns, cudf::timestamp_ns::rep> nanos{
+    1614834367000000005L, 0L};
+  auto const input = cudf::table_view({seconds, millis, nanos});
+
+  auto results = cudf::strings::format("{}|{}|{}", input);
+  cudf::test::strings_column_wrapper expected(
+    {"2021-03-04 05:06:07|2021-03-04 05:06:07.123|2021-03-04 05:06:07.000000005",
+     "1969-12-31 23:59:59|1969-12-31 23:59:59.999|1970-01-01 00:00:00.000000000"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsFormatTest, EmptyInput)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> id{};
+  auto results = cudf::strings::format("id={}", cudf::table_view({id}));
+  EXPECT_EQ(results->size(), 0);
+}
+
+TEST_F(StringsFormatTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> id{1, 2};
+  cudf::test::fixed_width_column_wrapper<cudf::duration_s, cudf::duration_s::rep> duration{1, 2};
+  auto const input = cudf::table_view({id, duration});
+
+  EXPECT_THROW(cudf::strings::format("{", input), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("}", input), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("{2}", input), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("{0}{}{}", input), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("{a}", input), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("{:x}", input), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("{:.2}", input), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::format("{1}", input), cudf::logic_error);
+}
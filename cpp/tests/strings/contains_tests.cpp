@@ -16,6 +16,7 @@
 
 #include <tests/strings/utilities.h>
 #include <cudf/strings/contains.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -372,3 +373,79 @@ TEST_F(StringsContainsTests, LargeRegex)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
   }
 }
+
+TEST_F(StringsContainsTests, AsciiAndNonAsciiStrings)
+{
+  // the strings of ASCII characters are decided by a DFA and the others by the instructions
+  cudf::test::strings_column_wrapper strings(
+    {"abc def", "ABC", "x\nyz", "déf abc", "", "abcabc", "ab-c"});
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    auto results = cudf::strings::contains_re(strings_view, "^abc");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "abc$");
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 0, 1, 0, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "\\bdef");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "x\\sy");
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 1, 0, 0, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "[a-c]+-c|DEF|ABC");
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 1, 0, 0, 0, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::matches_re(strings_view, "\\w+");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 1, 1, 0, 1, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::matches_re(strings_view, "[a-z]+ \\w+$");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, RegexProgram)
+{
+  auto const prog = cudf::strings::regex_program::create("(\\d+)-(\\w+)");
+  EXPECT_EQ(prog->pattern(), "(\\d+)-(\\w+)");
+  EXPECT_EQ(prog->groups_count(), 2);
+  EXPECT_GT(prog->instructions_count(), 0);
+
+  // the program is reused by the searches of different columns
+  cudf::test::strings_column_wrapper strings1({"12-ab", "x 3-c", "", "4-", "éé 5-f"},
+                                              {1, 1, 1, 0, 1});
+  cudf::test::strings_column_wrapper strings2({"abc", "7-x 8-y"});
+  auto const view1 = cudf::strings_column_view(strings1);
+  auto const view2 = cudf::strings_column_view(strings2);
+  for (int i = 0; i < 2; ++i) {
+    auto results = cudf::strings::contains_re(view1, *prog);
+    cudf::test::fixed_width_column_wrapper<bool> expected1({1, 1, 0, 0, 1}, {1, 1, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected1);
+    results = cudf::strings::matches_re(view1, *prog);
+    cudf::test::fixed_width_column_wrapper<bool> expected2({1, 0, 0, 0, 0}, {1, 1, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected2);
+    results = cudf::strings::count_re(view2, *prog);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected3({0, 2});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected3);
+  }
+  // the string patterns give the same results
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::strings::contains_re(view1, *prog),
+                                 *cudf::strings::contains_re(view1, prog->pattern()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::strings::count_re(view2, *prog),
+                                 *cudf::strings::count_re(view2, prog->pattern()));
+
+  EXPECT_THROW(cudf::strings::regex_program::create("ab(*)"), cudf::logic_error);
+}
@@ -16,6 +16,7 @@
 
 #include <tests/strings/utilities.h>
 #include <cudf/strings/extract.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -75,6 +76,22 @@ TEST_F(StringsExtractTests, ExtractTest)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*results, expected);
 }
 
+TEST_F(StringsExtractTests, ExtractRegexProgram)
+{
+  cudf::test::strings_column_wrapper strings({"a1", "b2", "c3", ""});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto const prog = cudf::strings::regex_program::create("([ab])(\\d)");
+  auto results    = cudf::strings::extract(strings_view, *prog);
+  cudf::test::strings_column_wrapper expected1({"a", "b", "", ""}, {1, 1, 0, 0});
+  cudf::test::strings_column_wrapper expected2({"1", "2", "", ""}, {1, 1, 0, 0});
+  cudf::table_view expected({expected1, expected2});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*results, expected);
+
+  auto const no_groups = cudf::strings::regex_program::create("[ab]\\d");
+  EXPECT_THROW(cudf::strings::extract(strings_view, *no_groups), cudf::logic_error);
+}
+
 TEST_F(StringsExtractTests, ExtractDomainTest)
 {
   cudf::test::strings_column_wrapper strings({"http://www.google.com",
@@ -34,6 +34,7 @@
 #include <thrust/transform.h>
 
 #include <cstring>
+#include <string>
 #include <vector>
 
 struct StringsFactoriesTest : public cudf::test::BaseFixture {
@@ -156,6 +157,27 @@ TEST_F(StringsFactoriesTest, CreateColumnFromOffsets)
     memcmp(h_offsets.data(), h_offsets_data.data(), h_offsets.size() * sizeof(cudf::size_type)), 0);
 }
 
+TEST_F(StringsFactoriesTest, CreateColumnFromInt64Offsets)
+{
+  std::string const h_chars = "hellothéreabc";
+  std::vector<int8_t> chars(h_chars.begin(), h_chars.end());
+  cudf::test::fixed_width_column_wrapper<int64_t> offsets({0, 5, 12, 12, 15});
+  cudf::test::fixed_width_column_wrapper<int8_t> chars_column(chars.begin(), chars.end());
+  auto results = cudf::make_strings_column(
+    4, offsets.release(), chars_column.release(), 0, rmm::device_buffer{});
+
+  cudf::test::strings_column_wrapper expected({"hello", "théré", "", "abc"});
+  EXPECT_EQ(cudf::strings_column_view(results->view()).offsets().type().id(),
+            cudf::type_id::INT32);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected);
+
+  cudf::test::fixed_width_column_wrapper<int16_t> invalid_offsets({0, 5});
+  cudf::test::fixed_width_column_wrapper<int8_t> invalid_chars({1, 2, 3, 4, 5});
+  EXPECT_THROW(cudf::make_strings_column(
+                 1, invalid_offsets.release(), invalid_chars.release(), 0, rmm::device_buffer{}),
+               cudf::logic_error);
+}
+
 TEST_F(StringsFactoriesTest, CreateScalar)
 {
   std::string value = "test string";
@@ -22,7 +22,10 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 struct StringsFindMultipleTest : public cudf::test::BaseFixture {
@@ -78,3 +81,79 @@ TEST_F(StringsFindMultipleTest, ErrorTest)
   // targets cannot have nulls
   EXPECT_THROW(cudf::strings::find_multiple(strings_view, strings_view), cudf::logic_error);
 }
+
+TEST_F(StringsFindMultipleTest, FindKeywords)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"the cat", "a theme", "", "dog", "", "héhé the"}, {1, 1, 0, 1, 1, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+  // keywords may overlap, contain each other, repeat or be multi-byte characters
+  cudf::test::strings_column_wrapper keywords({"the", "cat", "he", "é", "héh", "cat"});
+  auto keywords_view = cudf::strings_column_view(keywords);
+
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW expected({LCW{0, 1, 2, 5}, LCW{0, 2}, LCW{}, LCW{}, LCW{}, LCW{0, 2, 3, 4}},
+               cudf::test::iterator_with_null_at(2));
+  auto results = cudf::strings::find_keywords(strings_view, keywords_view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_counts({4, 2, 0, 0, 0, 4},
+                                                                  {1, 1, 0, 1, 1, 1});
+  results = cudf::strings::count_keywords(strings_view, keywords_view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_counts);
+}
+
+TEST_F(StringsFindMultipleTest, CountManyKeywords)
+{
+  // small alphabet so the keywords overlap often
+  std::vector<std::string> h_strings(300);
+  for (std::size_t idx = 0; idx < h_strings.size(); ++idx) {
+    for (std::size_t pos = 0; pos < idx % 40; ++pos) {
+      h_strings[idx] += static_cast<char>('a' + (idx * 7 + pos * pos) % 3);
+    }
+  }
+  std::vector<std::string> h_keywords;
+  for (int idx = 1; idx < 100; ++idx) {
+    std::string keyword;
+    for (int value = idx; value > 0; value /= 3) {
+      keyword += static_cast<char>('a' + value % 3);
+    }
+    h_keywords.push_back(keyword);
+  }
+  std::vector<int32_t> h_expected;
+  for (auto const& str : h_strings) {
+    h_expected.push_back(std::count_if(h_keywords.begin(), h_keywords.end(), [&](auto& keyword) {
+      return str.find(keyword) != std::string::npos;
+    }));
+  }
+
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  cudf::test::strings_column_wrapper keywords(h_keywords.begin(), h_keywords.end());
+  auto results = cudf::strings::count_keywords(cudf::strings_column_view(strings),
+                                               cudf::strings_column_view(keywords));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected(h_expected.begin(), h_expected.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsFindMultipleTest, KeywordsErrorTest)
+{
+  cudf::test::strings_column_wrapper strings({"abc"});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  cudf::column_view zero_size_strings_column(
+    cudf::data_type{cudf::type_id::STRING}, 0, nullptr, nullptr, 0);
+  EXPECT_THROW(cudf::strings::find_keywords(strings_view,
+                                            cudf::strings_column_view(zero_size_strings_column)),
+               cudf::logic_error);
+  cudf::test::strings_column_wrapper null_keywords({"a", ""}, {1, 0});
+  EXPECT_THROW(cudf::strings::find_keywords(strings_view, cudf::strings_column_view(null_keywords)),
+               cudf::logic_error);
+  cudf::test::strings_column_wrapper empty_keywords({"a", ""});
+  EXPECT_THROW(
+    cudf::strings::find_keywords(strings_view, cudf::strings_column_view(empty_keywords)),
+    cudf::logic_error);
+
+  auto results = cudf::strings::find_keywords(
+    cudf::strings_column_view(zero_size_strings_column), cudf::strings_column_view(strings));
+  EXPECT_EQ(results->size(), 0);
+}
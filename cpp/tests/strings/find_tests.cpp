@@ -23,7 +23,9 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 
+#include <string>
 #include <vector>
 
 struct StringsFindTest : public cudf::test::BaseFixture {
@@ -264,6 +266,38 @@ TEST_F(StringsFindTest, AllNull)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected8);
 }
 
+TEST_F(StringsFindTest, LongStrings)
+{
+  // long enough for the strings to be searched with a warp per string
+  std::string const filler = "\u00e9" + std::string(99, '-');  // 100 characters
+  std::vector<std::string> h_strings{filler + "h\u00e9llo" + filler + "h\u00e9llo" + filler,
+                                     filler + filler,
+                                     "",
+                                     "h\u00e9llo" + filler + "h\u00e9llo",
+                                     filler + "h\u00e9"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(), h_strings.end(), cudf::test::iterator_with_null_at(2));
+  auto strings_view = cudf::strings_column_view(strings);
+  auto const target = cudf::string_scalar("h\u00e9llo");
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({100, -1, -1, 0, -1},
+                                                             {1, 1, 0, 1, 1});
+    auto results = cudf::strings::find(strings_view, target);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({205, -1, -1, 105, -1},
+                                                             {1, 1, 0, 1, 1});
+    auto results = cudf::strings::rfind(strings_view, target);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 1, 0}, {1, 1, 0, 1, 1});
+    auto results = cudf::strings::contains(strings_view, target);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsFindTest, ErrorCheck)
 {
   cudf::test::strings_column_wrapper strings({"1", "2", "3", "4", "5", "6"});
@@ -759,3 +759,61 @@ TEST_F(JsonTests, MixedOutput)
     CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
   }
 }
+
+TEST_F(JsonTests, GetJsonObjects)
+{
+  // clang-format off
+  cudf::test::strings_column_wrapper input({
+    json_string,
+    "{\"a\": {\"b\": 1, \"b\": 2}, \"c\": [\"x\", {\"d\": \"y\"}]}",
+    "{\"a\": [1, 2], \"c\": {\"d\": true}}",
+    "",
+    "{\"a\": \"b\"}",
+    "[{\"a\": 1}, {\"a\": 2}]",
+    "{\"a\": {\"b\": [}, \"c\": 5}"},
+    {1, 1, 1, 1, 0, 1, 1});
+  // clang-format on
+
+  std::vector<std::string> json_paths{"$",
+                                      "$.store.book[1].title",
+                                      "$.store.bicycle",
+                                      "$.store.book[4]",
+                                      "$.expensive",
+                                      "$.a",
+                                      "$.a.b",
+                                      "$.a[1]",
+                                      "$.c[1].d",
+                                      "$['c'].d",
+                                      "$.c.d",
+                                      "$[1].a",
+                                      "$.store.book[*].author",
+                                      "$.store.missing",
+                                      ""};
+  auto const results =
+    cudf::strings::get_json_objects(cudf::strings_column_view(input), json_paths);
+  ASSERT_EQ(results.size(), json_paths.size());
+  for (std::size_t i = 0; i < json_paths.size(); ++i) {
+    auto const expected =
+      cudf::strings::get_json_object(cudf::strings_column_view(input), json_paths[i]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results[i], *expected);
+  }
+
+  // more paths than a single pass evaluates
+  std::vector<std::string> many_paths;
+  for (int i = 0; i < 100; ++i) {
+    many_paths.push_back(i % 2 ? "$.store.book[" + std::to_string(i % 5) + "].price" : "$.a.b");
+  }
+  auto const many_results =
+    cudf::strings::get_json_objects(cudf::strings_column_view(input), many_paths);
+  for (std::size_t i = 0; i < many_paths.size(); ++i) {
+    auto const expected =
+      cudf::strings::get_json_object(cudf::strings_column_view(input), many_paths[i]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*many_results[i], *expected);
+  }
+
+  cudf::test::strings_column_wrapper empty_input{};
+  auto const empty_results =
+    cudf::strings::get_json_objects(cudf::strings_column_view(empty_input), json_paths);
+  ASSERT_EQ(empty_results.size(), json_paths.size());
+  EXPECT_EQ(empty_results.front()->size(), 0);
+}
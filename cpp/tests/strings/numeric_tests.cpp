@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/strings/convert/convert_numeric.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <limits>
+#include <vector>
+
+struct StringsParseNumericTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StringsParseNumericTest, Integers)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"123", "-128", "128", "", "+7", "1.5", "-", "-0", "abc", "99"},
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 0});
+  auto results = cudf::strings::parse_numeric({cudf::strings_column_view(strings)},
+                                              {cudf::data_type{cudf::type_id::INT8}});
+  ASSERT_EQ(results.size(), 1u);
+  cudf::test::fixed_width_column_wrapper<int8_t> expected(
+    {123, -128, 0, 0, 7, 0, 0, 0, 0, 0}, {1, 1, 0, 0, 1, 0, 0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results.front()->view(), expected);
+
+  cudf::test::strings_column_wrapper bounds(
+    {"18446744073709551615", "18446744073709551616", "-1", "0"});
+  results = cudf::strings::parse_numeric({cudf::strings_column_view(bounds)},
+                                         {cudf::data_type{cudf::type_id::UINT64}});
+  cudf::test::fixed_width_column_wrapper<uint64_t> expected_bounds(
+    {std::numeric_limits<uint64_t>::max(), 0, 0, 0}, {1, 0, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results.front()->view(), expected_bounds);
+}
+
+TEST_F(StringsParseNumericTest, MultipleColumns)
+{
+  cudf::test::strings_column_wrapper strings1({"123", "-456", "", "A", "300"});
+  cudf::test::strings_column_wrapper strings2({"1.5", "NaN", "2e3", "-", ""}, {1, 1, 1, 1, 0});
+  cudf::test::strings_column_wrapper strings3({"9223372036854775807", "-9223372036854775808"});
+  auto results = cudf::strings::parse_numeric(
+    {cudf::strings_column_view(strings1),
+     cudf::strings_column_view(strings2),
+     cudf::strings_column_view(strings3)},
+    {cudf::data_type{cudf::type_id::INT16},
+     cudf::data_type{cudf::type_id::FLOAT64},
+     cudf::data_type{cudf::type_id::INT64}});
+  ASSERT_EQ(results.size(), 3u);
+
+  cudf::test::fixed_width_column_wrapper<int16_t> expected1({123, -456, 0, 0, 300},
+                                                            {1, 1, 0, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results[0]->view(), expected1);
+  cudf::test::fixed_width_column_wrapper<double> expected2(
+    {1.5, std::numeric_limits<double>::quiet_NaN(), 2000.0, 0.0, 0.0}, {1, 1, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results[1]->view(), expected2);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected3(
+    {std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results[2]->view(), expected3);
+}
+
+TEST_F(StringsParseNumericTest, EmptyColumns)
+{
+  cudf::test::strings_column_wrapper empty;
+  cudf::test::strings_column_wrapper strings({"1", "2"});
+  auto results = cudf::strings::parse_numeric(
+    {cudf::strings_column_view(empty), cudf::strings_column_view(strings)},
+    {cudf::data_type{cudf::type_id::INT32}, cudf::data_type{cudf::type_id::FLOAT32}});
+  EXPECT_EQ(results[0]->size(), 0);
+  cudf::test::fixed_width_column_wrapper<float> expected({1.0f, 2.0f});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results[1]->view(), expected);
+
+  EXPECT_TRUE(cudf::strings::parse_numeric({}, {}).empty());
+}
+
+TEST_F(StringsParseNumericTest, Errors)
+{
+  cudf::test::strings_column_wrapper strings({"1"});
+  auto const view = cudf::strings_column_view(strings);
+  EXPECT_THROW(cudf::strings::parse_numeric({view}, {}), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::parse_numeric({view}, {cudf::data_type{cudf::type_id::BOOL8}}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::strings::parse_numeric({view}, {cudf::data_type{cudf::type_id::STRING}}),
+               cudf::logic_error);
+}
@@ -15,6 +15,7 @@
  */
 
 #include <tests/strings/utilities.h>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/replace_re.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -59,6 +60,25 @@ TEST_F(StringsReplaceTests, ReplaceRegexTest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsReplaceTests, ReplaceRegexProgram)
+{
+  cudf::test::strings_column_wrapper strings({"the cat", "a theme", "", "the the"});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto const prog = cudf::strings::regex_program::create("(\\bthe\\b)");
+  auto results    = cudf::strings::replace_re(strings_view, *prog, cudf::string_scalar("="));
+  cudf::test::strings_column_wrapper expected({"= cat", "a theme", "", "= ="});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = cudf::strings::replace_re(strings_view, *prog, cudf::string_scalar("="), 1);
+  cudf::test::strings_column_wrapper expected_max({"= cat", "a theme", "", "= the"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_max);
+
+  results = cudf::strings::replace_with_backrefs(strings_view, *prog, "[\\1]");
+  cudf::test::strings_column_wrapper expected_refs({"[the] cat", "a theme", "", "[the] [the]"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_refs);
+}
+
 TEST_F(StringsReplaceTests, ReplaceMultiRegexTest)
 {
   std::vector<const char*> h_strings{"the quick brown fox jumps over the lazy dog",
@@ -339,6 +339,43 @@ TEST_F(StringsSplitTest, SplitRecordWhitespaceWithMaxSplit)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
 }
 
+TEST_F(StringsSplitTest, SplitExplode)
+{
+  std::vector<const char*> h_strings{" Héllo thesé", nullptr, "are some  ", "tést String", ""};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto strings_view = cudf::strings_column_view(strings);
+
+  {
+    auto result = cudf::strings::split_explode(strings_view, cudf::string_scalar(" "));
+    cudf::test::fixed_width_column_wrapper<cudf::size_type> rows{0, 0, 0, 2, 2, 2, 2, 3, 3, 4};
+    cudf::test::strings_column_wrapper tokens{
+      "", "Héllo", "thesé", "are", "some", "", "", "tést", "String", ""};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result, cudf::table_view({rows, tokens}));
+  }
+  {
+    auto result = cudf::strings::split_explode(strings_view, cudf::string_scalar(" "), 1);
+    cudf::test::fixed_width_column_wrapper<cudf::size_type> rows{0, 0, 2, 2, 3, 3, 4};
+    cudf::test::strings_column_wrapper tokens{
+      "", "Héllo thesé", "are", "some  ", "tést", "String", ""};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result, cudf::table_view({rows, tokens}));
+  }
+  {
+    auto result = cudf::strings::split_explode(strings_view);
+    cudf::test::fixed_width_column_wrapper<cudf::size_type> rows{0, 0, 2, 2, 3, 3};
+    cudf::test::strings_column_wrapper tokens{"Héllo", "thesé", "are", "some", "tést", "String"};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result, cudf::table_view({rows, tokens}));
+  }
+
+  cudf::column_view zero_size_strings_column(
+    cudf::data_type{cudf::type_id::STRING}, 0, nullptr, nullptr, 0);
+  auto result = cudf::strings::split_explode(cudf::strings_column_view(zero_size_strings_column));
+  EXPECT_EQ(result->num_rows(), 0);
+  EXPECT_THROW(cudf::strings::split_explode(strings_view, cudf::string_scalar("", false)),
+               cudf::logic_error);
+}
+
 TEST_F(StringsSplitTest, RSplitRecord)
 {
   std::vector<const char*> h_strings{
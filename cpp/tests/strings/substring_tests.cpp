@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/strings/substring.hpp>
@@ -265,6 +266,30 @@ TEST_F(StringsSubstringsTest, MaxPositions)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsSubstringsTest, SlicedAsciiStrings)
+{
+  // the first and last strings share 4-byte words with the ASCII strings of the slice
+  cudf::test::strings_column_wrapper strings{"\u00e9", "abc", "defgh", "ij", "\u00e9"};
+  auto const sliced   = cudf::slice(strings, {1, 4}).front();
+  auto strings_column = cudf::strings_column_view(sliced);
+  {
+    auto results = cudf::strings::slice_strings(strings_column, 1, 3);
+    cudf::test::strings_column_wrapper expected{"bc", "ef", "j"};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::slice_strings(
+      strings_column, 0, cudf::numeric_scalar<cudf::size_type>(0, false), 2);
+    cudf::test::strings_column_wrapper expected{"ac", "dfh", "i"};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::slice_strings(strings_column, -1, -4, -1);
+    cudf::test::strings_column_wrapper expected{"cba", "hgf", "ji"};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsSubstringsTest, Error)
 {
   cudf::test::strings_column_wrapper strings{"this string intentionally left blank"};
@@ -98,3 +98,75 @@ TEST_F(TextEditDistanceTest, ErrorsTest)
     cudf::logic_error);
   EXPECT_THROW(nvtext::edit_distance_matrix(cudf::strings_column_view(strings)), cudf::logic_error);
 }
+
+TEST_F(TextEditDistanceTest, EditDistanceThreshold)
+{
+  std::vector<const char*> h_strings{"dog", nullptr, "cat", "mouse", "pup", "", "puppy", "thé"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  std::vector<const char*> h_targets{"hog", "not", "cake", "house", "fox", nullptr, "puppy", "the"};
+  cudf::test::strings_column_wrapper targets(
+    h_targets.begin(),
+    h_targets.end(),
+    thrust::make_transform_iterator(h_targets.begin(), [](auto str) { return str != nullptr; }));
+
+  auto const sv = cudf::strings_column_view(strings);
+  {
+    auto results = nvtext::edit_distance(sv, cudf::strings_column_view(targets), 2);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 3, 2, 1, 3, 0, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = nvtext::edit_distance(sv, cudf::strings_column_view(targets), 1);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 2, 2, 1, 2, 0, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::strings_column_wrapper single({"pup"});
+    auto results = nvtext::edit_distance(sv, cudf::strings_column_view(single), 0);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 1, 1, 1, 0, 1, 1, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  EXPECT_THROW(nvtext::edit_distance(sv, cudf::strings_column_view(targets), 128),
+               cudf::logic_error);
+}
+
+TEST_F(TextEditDistanceTest, EditDistanceJoin)
+{
+  std::vector<const char*> h_left{
+    "jonathan", "mary", nullptr, "christine", "ab", "abab", "thé", "", "zzzzzzzzzz"};
+  cudf::test::strings_column_wrapper left(
+    h_left.begin(),
+    h_left.end(),
+    thrust::make_transform_iterator(h_left.begin(), [](auto str) { return str != nullptr; }));
+  cudf::test::strings_column_wrapper right(
+    {"jonatan", "marie", "christina", "johnathan", "ba", "the", "a", "abba", "zzzzzzzzzy"});
+  auto const lv = cudf::strings_column_view(left);
+  auto const rv = cudf::strings_column_view(right);
+
+  using int32_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+  // the blocking finds every pair whatever the width of the ngrams
+  for (auto const width : {1, 2, 3}) {
+    auto results = nvtext::edit_distance_join(lv, rv, 1, width);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), int32_wrapper({0, 0, 3, 4, 6, 7, 8}));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), int32_wrapper({0, 3, 2, 6, 5, 6, 8}));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), int32_wrapper({1, 1, 1, 1, 1, 1, 1}));
+
+    results = nvtext::edit_distance_join(lv, rv, 2, width);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0),
+                                   int32_wrapper({0, 0, 1, 3, 4, 4, 4, 5, 5, 6, 7, 7, 8}));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1),
+                                   int32_wrapper({0, 3, 1, 2, 4, 6, 7, 4, 7, 5, 4, 6, 8}));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2),
+                                   int32_wrapper({1, 1, 2, 1, 2, 1, 2, 2, 2, 1, 2, 1, 1}));
+  }
+
+  auto results = nvtext::edit_distance_join(lv, lv, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), int32_wrapper({0, 1, 3, 4, 5, 6, 7, 8}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), int32_wrapper({0, 1, 3, 4, 5, 6, 7, 8}));
+
+  EXPECT_THROW(nvtext::edit_distance_join(lv, rv, 1, 0), cudf::logic_error);
+}
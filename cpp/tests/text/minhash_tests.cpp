@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <nvtext/minhash.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <vector>
+
+struct TextMinHashTest : public cudf::test::BaseFixture {
+};
+
+using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+
+TEST_F(TextMinHashTest, MinHash)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"this is my", "this is my favorite", "that is not flavored", "", "abc", "thé été"});
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({0, 1, 2});
+
+  auto results = nvtext::minhash(cudf::strings_column_view(strings), seeds, 4);
+
+  LCW expected({LCW{21141582u, 403093213u, 1258052021u},
+                LCW{21141582u, 330862798u, 151410168u},
+                LCW{105223959u, 62404225u, 48443392u},
+                LCW{0u, 1364076727u, 821347078u},
+                LCW{3017643002u, 2859854335u, 2529246295u},
+                LCW{1534675507u, 224572619u, 842691737u}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(TextMinHashTest, NullsAndSlices)
+{
+  cudf::test::strings_column_wrapper input({"", "this is my", "", "this is my favorite", ""},
+                                           {1, 1, 0, 1, 1});
+  auto const strings = cudf::slice(input, {1, 4}).front();
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({0});
+
+  auto results = nvtext::minhash(cudf::strings_column_view(strings), seeds, 4);
+  EXPECT_EQ(results->size(), 3);
+  EXPECT_EQ(results->null_count(), 1);
+
+  auto valid_rows = cudf::slice(results->view(), {0, 1, 2, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(valid_rows[0], LCW({LCW{21141582u}}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(valid_rows[1], LCW({LCW{21141582u}}));
+}
+
+TEST_F(TextMinHashTest, Bands)
+{
+  LCW signatures({LCW{1u, 2u, 3u, 4u, 5u}, LCW{1u, 2u, 7u, 8u, 5u}, LCW{5u, 6u}});
+  auto results = nvtext::minhash_bands(cudf::lists_column_view(signatures), 2);
+  LCW expected({LCW{1685970547u, 4069978803u}, LCW{1685970547u, 571395923u}, LCW{3932753255u}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = nvtext::minhash_bands(cudf::lists_column_view(signatures), 1);
+  EXPECT_EQ(cudf::lists_column_view(results->view()).child().size(), 12);
+}
+
+TEST_F(TextMinHashTest, EmptyAndErrors)
+{
+  cudf::test::strings_column_wrapper empty;
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({0, 1});
+  auto results = nvtext::minhash(cudf::strings_column_view(empty), seeds);
+  EXPECT_EQ(results->size(), 0);
+
+  cudf::test::strings_column_wrapper strings({"abcdef"});
+  cudf::test::fixed_width_column_wrapper<uint32_t> no_seeds;
+  cudf::test::fixed_width_column_wrapper<int32_t> int_seeds({0});
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), no_seeds), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), int_seeds), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), seeds, 1), cudf::logic_error);
+
+  LCW signatures({LCW{1u, 2u}});
+  EXPECT_THROW(nvtext::minhash_bands(cudf::lists_column_view(signatures), 0), cudf::logic_error);
+}
@@ -21,6 +21,7 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 
 #include <nvtext/generate_ngrams.hpp>
 
@@ -98,6 +99,26 @@ TEST_F(TextGenerateNgramsTest, NgramsWithNulls)
   }
 }
 
+TEST_F(TextGenerateNgramsTest, HashCharacterNgrams)
+{
+  cudf::test::strings_column_wrapper strings({"abc", "d", "", "thé"}, {1, 1, 0, 1});
+  cudf::strings_column_view strings_view(strings);
+
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  {
+    LCW expected({LCW{2613040991u, 1328615756u}, LCW{}, LCW{}, LCW{3537305573u, 3187791043u}},
+                 cudf::test::iterator_with_null_at(2));
+    auto const results = nvtext::hash_character_ngrams(strings_view);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  }
+  {
+    cudf::test::strings_column_wrapper strings{"abcdef"};
+    LCW expected({LCW{3037955123u, 1936091782u}});
+    auto const results = nvtext::hash_character_ngrams(cudf::strings_column_view(strings), 5, 7);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  }
+}
+
 TEST_F(TextGenerateNgramsTest, Empty)
 {
   cudf::column_view zero_size_strings_column(
@@ -106,6 +127,8 @@ TEST_F(TextGenerateNgramsTest, Empty)
   cudf::test::expect_strings_empty(results->view());
   results = nvtext::generate_character_ngrams(cudf::strings_column_view(zero_size_strings_column));
   cudf::test::expect_strings_empty(results->view());
+  results = nvtext::hash_character_ngrams(cudf::strings_column_view(zero_size_strings_column));
+  EXPECT_EQ(results->size(), 0);
 }
 
 TEST_F(TextGenerateNgramsTest, Errors)
@@ -115,6 +138,8 @@ TEST_F(TextGenerateNgramsTest, Errors)
   EXPECT_THROW(nvtext::generate_ngrams(cudf::strings_column_view(strings), 1), cudf::logic_error);
   EXPECT_THROW(nvtext::generate_character_ngrams(cudf::strings_column_view(strings), 1),
                cudf::logic_error);
+  EXPECT_THROW(nvtext::hash_character_ngrams(cudf::strings_column_view(strings), 1),
+               cudf::logic_error);
   // not enough strings to generate ngrams
   EXPECT_THROW(nvtext::generate_ngrams(cudf::strings_column_view(strings), 3), cudf::logic_error);
   EXPECT_THROW(nvtext::generate_character_ngrams(cudf::strings_column_view(strings), 3),
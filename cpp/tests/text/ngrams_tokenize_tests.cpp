@@ -22,6 +22,7 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 
 #include <vector>
 
@@ -106,6 +107,34 @@ TEST_F(TextNgramsTokenizeTest, TokenizeOneGram)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(TextNgramsTokenizeTest, HashNgrams)
+{
+  cudf::test::strings_column_wrapper strings({"a bb ccc", "dd", "", "  e  f g"}, {1, 1, 0, 1});
+  cudf::strings_column_view strings_view(strings);
+
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  {
+    LCW expected({LCW{3499966336u, 2960045447u}, LCW{}, LCW{}, LCW{2900042365u, 4225676008u}},
+                 cudf::test::iterator_with_null_at(2));
+    auto const results = nvtext::hash_ngrams_tokenize(strings_view);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  }
+  {
+    LCW expected({LCW{436523243u}, LCW{}, LCW{}, LCW{2542594031u}},
+                 cudf::test::iterator_with_null_at(2));
+    auto const results = nvtext::hash_ngrams_tokenize(
+      strings_view, 3, cudf::string_scalar(" "), cudf::string_scalar("_"), 7);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  }
+  {
+    cudf::test::strings_column_wrapper strings{"the quick brown fox"};
+    LCW expected({LCW{2474259257u, 1914985322u}});
+    auto const results = nvtext::hash_ngrams_tokenize(
+      cudf::strings_column_view(strings), 3, cudf::string_scalar(""), cudf::string_scalar(" "), 7);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  }
+}
+
 TEST_F(TextNgramsTokenizeTest, TokenizeEmptyTest)
 {
   auto strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
@@ -120,4 +149,5 @@ TEST_F(TextNgramsTokenizeTest, TokenizeErrorTest)
   cudf::test::strings_column_wrapper strings{"this column intentionally left blank"};
   cudf::strings_column_view strings_view(strings);
   EXPECT_THROW(nvtext::ngrams_tokenize(strings_view, 0), cudf::logic_error);
+  EXPECT_THROW(nvtext::hash_ngrams_tokenize(strings_view, 0), cudf::logic_error);
 }
@@ -16,12 +16,14 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
+#include <nvtext/bpe_tokenize.hpp>
 #include <nvtext/subword_tokenize.hpp>
 
 #include <fstream>
@@ -255,6 +257,116 @@ TEST(TextSubwordTest, TokenizeFromVocabStruct)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
 
+TEST(TextSubwordTest, SaveVocabBinaryFile)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  std::string binary_file = temp_env->get_temp_filepath("hashed_vocab.bin");
+  nvtext::save_vocabulary_file(*vocab, binary_file);
+  auto loaded = nvtext::load_vocabulary_file(binary_file);
+
+  EXPECT_EQ(vocab->first_token_id, loaded->first_token_id);
+  EXPECT_EQ(vocab->separator_token_id, loaded->separator_token_id);
+  EXPECT_EQ(vocab->unknown_token_id, loaded->unknown_token_id);
+  EXPECT_EQ(vocab->outer_hash_a, loaded->outer_hash_a);
+  EXPECT_EQ(vocab->outer_hash_b, loaded->outer_hash_b);
+  EXPECT_EQ(vocab->num_bins, loaded->num_bins);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(vocab->table->view(), loaded->table->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(vocab->bin_coefficients->view(),
+                                 loaded->bin_coefficients->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(vocab->bin_offsets->view(), loaded->bin_offsets->view());
+
+  std::vector<const char*> h_strings{"This is a test.", "This is a tést."};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  auto expected = nvtext::subword_tokenize(
+    cudf::strings_column_view{strings}, *vocab, 8, 6, true, true, MAX_ROWS_TENSOR);
+  auto result = nvtext::subword_tokenize(
+    cudf::strings_column_view{strings}, *loaded, 8, 6, true, true, MAX_ROWS_TENSOR);
+  EXPECT_EQ(expected.nrows_tensor, result.nrows_tensor);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_token_ids->view(),
+                                 result.tensor_token_ids->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_metadata->view(),
+                                 result.tensor_metadata->view());
+
+  // a truncated binary file is rejected
+  std::string truncated_file = temp_env->get_temp_filepath("truncated_vocab.bin");
+  {
+    std::ifstream input(binary_file, std::ifstream::binary);
+    std::ofstream output(truncated_file, std::ofstream::binary);
+    std::vector<char> buffer(40);
+    input.read(buffer.data(), buffer.size());
+    output.write(buffer.data(), buffer.size());
+  }
+  EXPECT_THROW(nvtext::load_vocabulary_file(truncated_file), cudf::logic_error);
+}
+
+TEST(TextSubwordTest, TokenizeIntoBuffers)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  std::vector<const char*> h_strings{"This is a test.", "This is a test. This is a tést."};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+
+  // one row per batch, reusing the same output columns
+  cudf::test::fixed_width_column_wrapper<uint32_t> token_ids({0, 0, 0, 0, 0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<uint32_t> attention_mask({0, 0, 0, 0, 0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<uint32_t> metadata({0, 0, 0});
+  cudf::mutable_column_view token_ids_view      = token_ids;
+  cudf::mutable_column_view attention_mask_view = attention_mask;
+  cudf::mutable_column_view metadata_view       = metadata;
+
+  auto batches = cudf::slice(strings, {0, 1, 1, 2});
+  auto nrows   = nvtext::subword_tokenize(cudf::strings_column_view{batches[0]},
+                                          *vocab,
+                                          8,
+                                          6,
+                                          true,  // do_lower_case
+                                          true,  // do_truncate
+                                          token_ids_view,
+                                          attention_mask_view,
+                                          metadata_view);
+  EXPECT_EQ(uint32_t{1}, nrows);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_tokens1(
+    {2023, 2003, 1037, 3231, 1012, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(token_ids_view, expected_tokens1);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_attn1({1, 1, 1, 1, 1, 0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(attention_mask_view, expected_attn1);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_metadata1({0, 0, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(metadata_view, expected_metadata1);
+
+  nrows = nvtext::subword_tokenize(cudf::strings_column_view{batches[1]},
+                                   *vocab,
+                                   8,
+                                   6,
+                                   true,  // do_lower_case
+                                   true,  // do_truncate
+                                   token_ids_view,
+                                   attention_mask_view,
+                                   metadata_view);
+  EXPECT_EQ(uint32_t{1}, nrows);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_tokens2(
+    {2023, 2003, 1037, 3231, 1012, 2023, 2003, 1037});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(token_ids_view, expected_tokens2);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_metadata2({0, 0, 7});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(metadata_view, expected_metadata2);
+
+  // both strings need more rows than the outputs hold
+  EXPECT_THROW(nvtext::subword_tokenize(cudf::strings_column_view{strings},
+                                        *vocab,
+                                        8,
+                                        6,
+                                        true,
+                                        true,
+                                        token_ids_view,
+                                        attention_mask_view,
+                                        metadata_view),
+               cudf::logic_error);
+}
+
 TEST(TextSubwordTest, LoadVocabFileErrors)
 {
   std::vector<const char*> h_strings{"This is a test.", "This is a test. This is a tést."};
@@ -374,3 +486,85 @@ TEST(TextSubwordTest, ZeroHashBinCoefficient)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(), expected_attn);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
+
+// Create fake BPE merges and vocabulary files for the tests in this source file.
+void create_bpe_files(std::string const& merges_file, std::string const& vocab_file)
+{
+  {
+    std::ofstream outfile(merges_file, std::ofstream::out);
+    outfile << "#version: 0.2\nh e\nl l\nhe ll\nhell o\no r\n";
+  }
+  std::ofstream outfile(vocab_file, std::ofstream::out);
+  outfile << "<unk>\nh\ne\nl\no\nhe\nll\nhell\nhello\nw\nor\nd\n";
+}
+
+TEST(TextSubwordTest, BPETokenize)
+{
+  std::string merges_file = temp_env->get_temp_filepath("merges.txt");
+  std::string vocab_file  = temp_env->get_temp_filepath("bpe_vocab.txt");
+  create_bpe_files(merges_file, vocab_file);
+
+  std::vector<const char*> h_strings{"hello world", "hell", "lol é"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  auto vocab = nvtext::load_bpe_vocabulary(merges_file, vocab_file);
+  EXPECT_EQ(vocab->unknown_token_id, 0u);
+
+  auto result = nvtext::bpe_tokenize(cudf::strings_column_view{strings},
+                                     *vocab,
+                                     8,
+                                     8,
+                                     false,  // do_truncate
+                                     MAX_ROWS_TENSOR);
+  EXPECT_EQ(result.nrows_tensor, 3u);
+
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_tokens(
+    {8, 9, 10, 3, 11, 0, 0, 0,
+     7, 0,  0, 0,  0, 0, 0, 0,
+     3, 4,  3, 0,  0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_attn(
+    {1, 1, 1, 1, 1, 0, 0, 0,
+     1, 0, 0, 0, 0, 0, 0, 0,
+     1, 1, 1, 1, 0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_metadata(
+    {0, 0, 4,
+     1, 0, 0,
+     2, 0, 3});
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_token_ids->view(), expected_tokens);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(), expected_attn);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
+
+  // sliced strings with truncation
+  auto sliced = cudf::slice(strings, {1, 3}).front();
+  result      = nvtext::bpe_tokenize(cudf::strings_column_view{sliced},
+                                *vocab,
+                                2,
+                                2,
+                                true,  // do_truncate
+                                MAX_ROWS_TENSOR);
+  EXPECT_EQ(result.nrows_tensor, 2u);
+
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_sliced_tokens({7, 0, 3, 4});
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_sliced_attn(  {1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_sliced_metadata({0, 0, 0, 1, 0, 1});
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_token_ids->view(), expected_sliced_tokens);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(), expected_sliced_attn);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_sliced_metadata);
+}
+
+TEST(TextSubwordTest, BPEVocabularyErrors)
+{
+  std::string merges_file = temp_env->get_temp_filepath("merges.txt");
+  std::string vocab_file  = temp_env->get_temp_filepath("bpe_vocab.txt");
+  create_bpe_files(merges_file, vocab_file);
+  EXPECT_THROW(nvtext::load_bpe_vocabulary(merges_file, vocab_file, "[UNK]"), cudf::logic_error);
+  EXPECT_THROW(nvtext::load_bpe_vocabulary(merges_file, "nosuchfile.txt"), cudf::logic_error);
+  {
+    std::ofstream outfile(merges_file, std::ofstream::out);
+    outfile << "h e\nhe\n";
+  }
+  EXPECT_THROW(nvtext::load_bpe_vocabulary(merges_file, vocab_file), cudf::logic_error);
+}
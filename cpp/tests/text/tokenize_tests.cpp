@@ -190,3 +190,44 @@ TEST_F(TextTokenizeTest, DetokenizeErrors)
   EXPECT_THROW(nvtext::detokenize(strings_view, one, cudf::string_scalar("", false)),
                cudf::logic_error);
 }
+
+TEST_F(TextTokenizeTest, TokenizeWithVocabulary)
+{
+  cudf::test::strings_column_wrapper vocabulary({"the", "fox", "jumped", "dog", "cat", "the"});
+  auto vocab = nvtext::load_vocabulary(cudf::strings_column_view(vocabulary));
+
+  std::vector<const char*> h_strings{"the fox jumped over", nullptr, "the  dog", "", "cat:the"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+  std::vector<bool> validity{true, false, true, true, true};
+
+  using LCW    = cudf::test::lists_column_wrapper<int32_t>;
+  auto results = nvtext::tokenize_with_vocabulary(strings_view, *vocab);
+  LCW expected({LCW{0, 1, 2, -1}, LCW{}, LCW{0, 3}, LCW{}, LCW{-1}}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = nvtext::tokenize_with_vocabulary(strings_view, *vocab, cudf::string_scalar(": "), 99);
+  LCW expected_delimited({LCW{0, 1, 2, 99}, LCW{}, LCW{0, 3}, LCW{}, LCW{4, 0}}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_delimited);
+
+  cudf::test::strings_column_wrapper empty;
+  results = nvtext::tokenize_with_vocabulary(cudf::strings_column_view(empty), *vocab);
+  EXPECT_EQ(results->size(), 0);
+}
+
+TEST_F(TextTokenizeTest, TokenizeWithVocabularyErrors)
+{
+  cudf::test::strings_column_wrapper empty;
+  EXPECT_THROW(nvtext::load_vocabulary(cudf::strings_column_view(empty)), cudf::logic_error);
+  cudf::test::strings_column_wrapper nulls({"the", ""}, {1, 0});
+  EXPECT_THROW(nvtext::load_vocabulary(cudf::strings_column_view(nulls)), cudf::logic_error);
+
+  cudf::test::strings_column_wrapper vocabulary({"the"});
+  auto vocab = nvtext::load_vocabulary(cudf::strings_column_view(vocabulary));
+  EXPECT_THROW(nvtext::tokenize_with_vocabulary(
+                 cudf::strings_column_view(vocabulary), *vocab, cudf::string_scalar("", false)),
+               cudf::logic_error);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/memory_estimate.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+struct MemoryEstimateTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+// the alignment of the data and null mask allocations, the terminating offset and the rounding of
+// bits, per column
+constexpr std::size_t column_overhead = 2 * 256 + sizeof(cudf::size_type) + 1;
+}  // namespace
+
+TEST_F(MemoryEstimateTest, GatherFixedWidth)
+{
+  auto const iter  = thrust::make_counting_iterator<int32_t>(0);
+  auto col         = cudf::test::fixed_width_column_wrapper<int32_t>(iter, iter + 100);
+  auto map         = cudf::test::fixed_width_column_wrapper<int32_t>({0, 5, 99, -1, 5});
+  auto const input = cudf::table_view{{col}};
+
+  auto const estimate = cudf::estimate_gather_memory(input, map);
+  EXPECT_EQ(estimate.output_bytes, 5 * sizeof(int32_t) + column_overhead);
+  EXPECT_EQ(estimate.temporary_bytes, 0u);
+  EXPECT_EQ(estimate.total_bytes(), estimate.output_bytes);
+}
+
+TEST_F(MemoryEstimateTest, GatherNullify)
+{
+  auto col         = cudf::test::strings_column_wrapper({"a", "bb", "ccc"});
+  auto map         = cudf::test::fixed_width_column_wrapper<int32_t>({2, 7, 1});
+  auto const input = cudf::table_view{{col}};
+
+  auto const checked =
+    cudf::estimate_gather_memory(input, map, cudf::out_of_bounds_policy::NULLIFY);
+  auto const unchecked = cudf::estimate_gather_memory(input, map);
+  // the nullified row has an offset and a null mask bit in every column: parent, offsets and chars
+  EXPECT_EQ(checked.output_bytes,
+            unchecked.output_bytes + 3 * (cudf::bitmask_allocation_size_bytes(3) + 4));
+}
+
+TEST_F(MemoryEstimateTest, GatherLists)
+{
+  auto col         = cudf::test::lists_column_wrapper<int64_t>{{1, 2}, {3}, {4, 5, 6}};
+  auto map         = cudf::test::fixed_width_column_wrapper<int32_t>({0, 2, 2});
+  auto const input = cudf::table_view{{col}};
+
+  auto const estimate = cudf::estimate_gather_memory(input, map);
+  // offsets of the 3 gathered lists, and the gather map of their 8 child rows
+  EXPECT_EQ(estimate.temporary_bytes, (3 + 8) * sizeof(cudf::size_type));
+  EXPECT_GE(estimate.output_bytes, 8 * sizeof(int64_t) + 3 * sizeof(cudf::size_type));
+
+  auto const sliced = cudf::slice(col, {1, 3})[0];
+  auto sliced_map   = cudf::test::fixed_width_column_wrapper<int32_t>({1});
+  auto const sliced_estimate =
+    cudf::estimate_gather_memory(cudf::table_view{{sliced}}, sliced_map);
+  EXPECT_EQ(sliced_estimate.temporary_bytes, (1 + 3) * sizeof(cudf::size_type));
+}
+
+TEST_F(MemoryEstimateTest, Sort)
+{
+  auto col         = cudf::test::fixed_width_column_wrapper<int32_t>({3, 1, 2, 0}, {1, 1, 0, 1});
+  auto const input = cudf::table_view{{col}};
+
+  auto map            = cudf::test::fixed_width_column_wrapper<int32_t>({0, 1, 2, 3});
+  auto const gather   = cudf::estimate_gather_memory(input, map);
+  auto const estimate = cudf::estimate_sort_memory(input);
+  EXPECT_EQ(estimate.output_bytes, gather.output_bytes);
+  EXPECT_GE(estimate.temporary_bytes, 4 * sizeof(cudf::size_type));
+
+  EXPECT_EQ(cudf::estimate_sort_memory(cudf::table_view{}).total_bytes(), 0u);
+}
+
+TEST_F(MemoryEstimateTest, InnerJoin)
+{
+  auto left_col  = cudf::test::fixed_width_column_wrapper<int32_t>({0, 1, 2, 2});
+  auto right_col = cudf::test::fixed_width_column_wrapper<int32_t>({2, 2, 3});
+  auto left      = cudf::table_view{{left_col}};
+  auto right     = cudf::table_view{{right_col}};
+
+  auto const indices = cudf::estimate_inner_join_memory(left, right);
+  EXPECT_EQ(indices.output_bytes, 2 * 4 * sizeof(cudf::size_type));
+  EXPECT_GT(indices.temporary_bytes, 0u);
+
+  auto const joined = cudf::estimate_inner_join_memory(left, right, {0}, {0});
+  EXPECT_EQ(joined.output_bytes, 2 * (4 * sizeof(int32_t) + column_overhead));
+  EXPECT_EQ(joined.temporary_bytes, indices.total_bytes());
+
+  auto empty = cudf::test::fixed_width_column_wrapper<int32_t>{};
+  EXPECT_EQ(cudf::estimate_inner_join_memory(left, cudf::table_view{{empty}}).total_bytes(), 0u);
+}
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/transpose.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -178,6 +179,30 @@ TYPED_TEST(TransposeTest, EmptyTable) { run_test<TypeParam>(0, 0, false); }
 
 TYPED_TEST(TransposeTest, EmptyColumns) { run_test<TypeParam>(10, 0, false); }
 
+TYPED_TEST(TransposeTest, Wide) { run_test<TypeParam>(45, 2000, false); }
+
+TYPED_TEST(TransposeTest, WideNulls) { run_test<TypeParam>(45, 2000, true); }
+
+TYPED_TEST(TransposeTest, SlicedNulls)
+{
+  using T = TypeParam;
+
+  auto const col1  = fixed_width_column_wrapper<T, int32_t>({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  auto const col2  = fixed_width_column_wrapper<T, int32_t>({6, 7, 8, 9, 10}, {1, 1, 0, 1, 1});
+  auto const col3  = fixed_width_column_wrapper<T, int32_t>({11, 12, 13, 14, 15});
+  auto const input = cudf::slice(cudf::table_view{{col1, col2, col3}}, {1, 4}).front();
+
+  auto const expected1 = fixed_width_column_wrapper<T, int32_t>({2, 7, 12}, {0, 1, 1});
+  auto const expected2 = fixed_width_column_wrapper<T, int32_t>({3, 8, 13}, {1, 0, 1});
+  auto const expected3 = fixed_width_column_wrapper<T, int32_t>({4, 9, 14}, {1, 1, 1});
+
+  auto const result = cudf::transpose(input);
+  ASSERT_EQ(result.second.num_columns(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.second.column(0), expected1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.second.column(1), expected2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.second.column(2), expected3);
+}
+
 TYPED_TEST(TransposeTest, MismatchedColumns)
 {
   fixed_width_column_wrapper<TypeParam, int32_t> col1({1, 2, 3});
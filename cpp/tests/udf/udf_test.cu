@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/udf.cuh>
+
+#include <thrust/extrema.h>
+
+#include <limits>
+
+struct fahrenheit_to_celsius {
+  __device__ double operator()(float f) const { return (f - 32.0) / 1.8; }
+};
+
+struct window_range {
+  __device__ int32_t operator()(cudf::column_device_view const& input,
+                                cudf::size_type begin,
+                                cudf::size_type end) const
+  {
+    auto min = input.element<int32_t>(begin);
+    auto max = min;
+    for (auto i = begin + 1; i < end; ++i) {
+      min = thrust::min(min, input.element<int32_t>(i));
+      max = thrust::max(max, input.element<int32_t>(i));
+    }
+    return max - min;
+  }
+};
+
+struct window_valid_count {
+  __device__ int64_t operator()(cudf::column_device_view const& input,
+                                cudf::size_type begin,
+                                cudf::size_type end) const
+  {
+    int64_t count = 0;
+    for (auto i = begin; i < end; ++i) {
+      if (input.is_valid(i)) { ++count; }
+    }
+    return count;
+  }
+};
+
+struct UdfTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(UdfTest, Transform)
+{
+  cudf::test::fixed_width_column_wrapper<float> input{{32.f, 212.f, 0.f, 50.f}, {1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<double> expected{{0., 100., 0., 10.}, {1, 1, 0, 1}};
+
+  auto const result = cudf::udf::transform<double, float>(input, fahrenheit_to_celsius{});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
+}
+
+TEST_F(UdfTest, RollingWindow)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{5, 1, 4, 9, 2, 6};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{0, 4, 4, 8, 7, 7}, {0, 1, 1, 1, 1, 1}};
+  auto const result = cudf::udf::rolling_window<int32_t, int32_t>(input, 3, 0, 2, window_range{});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> centered{{4, 4, 8, 7, 7, 4}, {1, 1, 1, 1, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    centered, cudf::udf::rolling_window<int32_t, int32_t>(input, 2, 1, 1, window_range{})->view());
+}
+
+TEST_F(UdfTest, RollingWindowCallsWithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 3, 4, 5}, {1, 0, 1, 0, 1}};
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{{1, 2, 1, 2, 1}, {1, 1, 1, 1, 1}};
+  auto const result =
+    cudf::udf::rolling_window<int64_t, int32_t>(input, 2, 1, 1, window_valid_count{});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(UdfTest, GroupedRollingWindow)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 2, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> input{5, 1, 4, 9, 2, 6};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{0, 4, 4, 0, 7, 0}, {0, 1, 1, 0, 1, 0}};
+  auto const result = cudf::udf::grouped_rolling_window<int32_t, int32_t>(
+    cudf::table_view{{keys}}, input, 3, 0, 2, window_range{});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  auto const unbounded = std::numeric_limits<cudf::size_type>::max();
+  cudf::test::fixed_width_column_wrapper<int32_t> whole_groups{4, 4, 4, 7, 7, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    whole_groups,
+    cudf::udf::grouped_rolling_window<int32_t, int32_t>(
+      cudf::table_view{{keys}}, input, unbounded, unbounded, 1, window_range{})
+      ->view());
+}
+
+TEST_F(UdfTest, InvalidInputs)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{1, 2, 3};
+  EXPECT_THROW(cudf::udf::transform<double, float>(input, fahrenheit_to_celsius{}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::udf::rolling_window<int32_t, int32_t>(input, 2, 0, 0, window_range{}),
+               cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 1};
+  EXPECT_THROW(cudf::udf::grouped_rolling_window<int32_t, int32_t>(
+                 cudf::table_view{{keys}}, input, 2, 0, 1, window_range{}),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -838,3 +838,37 @@ TYPED_TEST(FixedPointTests, FixedPointToFixedPointDifferentTypeidUpNullMask)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
 }
+
+struct CastInPlaceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(CastInPlaceTest, SameWidthInPlace)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, -2, 3, 1 << 20}, {1, 1, 0, 1}};
+  auto const expected = cudf::cast(input, cudf::data_type{cudf::type_id::FLOAT32});
+
+  cudf::column col{input};
+  auto output = cudf::bit_cast(col.mutable_view(), cudf::data_type{cudf::type_id::FLOAT32});
+  cudf::cast(col.view(), output);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, output);
+}
+
+TEST_F(CastInPlaceTest, Preallocated)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> input{{1, -2, 3, 4}, {1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<double> expected{{1, 0, 3, 4}, {1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<double> out{{0, 0, 0, 0}, {1, 1, 1, 1}};
+  auto output = cudf::mutable_column_view{out};
+  cudf::cast(input, output);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, output);
+}
+
+TEST_F(CastInPlaceTest, OverlappingOutputFail)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> input{1, 2, 3, 4};
+  cudf::column col{input};
+  // An INT32 view of the first half of the input overlaps its elements without matching them
+  auto output = cudf::mutable_column_view{
+    cudf::data_type{cudf::type_id::INT32}, col.size(), col.mutable_view().head()};
+  EXPECT_THROW(cudf::cast(col.view(), output), cudf::logic_error);
+}
@@ -441,3 +441,49 @@ TEST_F(UnaryMathOpsErrorTest, LogicalOpTypeFail)
   auto d = cudf::dictionary::encode(input);
   EXPECT_THROW(cudf::unary_operation(d->view(), cudf::unary_operator::NOT), cudf::logic_error);
 }
+
+struct UnaryMathOpsInPlaceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(UnaryMathOpsInPlaceTest, AbsInPlace)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{-1, 2, -3, 0, -5}, {1, 1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{1, 2, 3, 0, 5}, {1, 1, 0, 1, 1}};
+  cudf::column col{input};
+  auto output = col.mutable_view();
+  cudf::unary_operation(col.view(), cudf::unary_operator::ABS, output);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, col.view());
+}
+
+TEST_F(UnaryMathOpsInPlaceTest, NotIntoBool)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{0, 2, 0, 4}, {1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<bool> expected{{1, 0, 1, 0}, {1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<bool> out{{0, 0, 0, 0}, {1, 1, 1, 1}};
+  auto output = cudf::mutable_column_view{out};
+  cudf::unary_operation(input, cudf::unary_operator::NOT, output);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, output);
+}
+
+TEST_F(UnaryMathOpsInPlaceTest, InvalidOutputFail)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int64_t> wrong_type{{0, 0, 0, 0}, {1, 1, 1, 1}};
+  auto wrong_type_output = cudf::mutable_column_view{wrong_type};
+  EXPECT_THROW(cudf::unary_operation(input, cudf::unary_operator::ABS, wrong_type_output),
+               cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> non_nullable{0, 0, 0, 0};
+  auto non_nullable_output = cudf::mutable_column_view{non_nullable};
+  EXPECT_THROW(cudf::unary_operation(input, cudf::unary_operator::ABS, non_nullable_output),
+               cudf::logic_error);
+
+  // A BOOL8 view of the first bytes of the input overlaps its elements without matching them
+  cudf::column col{input};
+  auto overlapping = cudf::mutable_column_view{cudf::data_type{cudf::type_id::BOOL8},
+                                               col.size(),
+                                               col.mutable_view().head(),
+                                               col.mutable_view().null_mask()};
+  EXPECT_THROW(cudf::unary_operation(col.view(), cudf::unary_operator::NOT, overlapping),
+               cudf::logic_error);
+}
@@ -20,6 +20,16 @@
 
 #ifdef CUDA_API_PER_THREAD_DEFAULT_STREAM
 TEST(DefaultStreamTest, PtdsIsEnabled) { EXPECT_TRUE(cudf::is_ptds_enabled()); }
+
+TEST(DefaultStreamTest, DefaultStreamIsPerThread)
+{
+  EXPECT_EQ(cudf::get_default_stream().value(), rmm::cuda_stream_per_thread.value());
+}
 #else
 TEST(DefaultStreamTest, PtdsIsNotEnabled) { EXPECT_FALSE(cudf::is_ptds_enabled()); }
+
+TEST(DefaultStreamTest, DefaultStreamIsLegacy)
+{
+  EXPECT_EQ(cudf::get_default_stream().value(), rmm::cuda_stream_default.value());
+}
 #endif
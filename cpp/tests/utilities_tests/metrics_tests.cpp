@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/metrics.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+struct MetricsTest : public cudf::test::BaseFixture {
+  void SetUp() override
+  {
+    cudf::reset_metrics();
+    cudf::enable_metrics(true);
+  }
+
+  void TearDown() override
+  {
+    cudf::enable_metrics(false);
+    cudf::reset_metrics();
+  }
+};
+
+TEST_F(MetricsTest, RecordsCalls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({4, 1, 3, 2}, {1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> map{0, 2};
+  auto const input = cudf::table_view{{col}};
+
+  cudf::gather(input, map);
+  cudf::gather(input, map);
+  cudf::sort(input);
+
+  auto const metrics = cudf::get_metrics();
+  auto const& gather = metrics.at("gather");
+  EXPECT_EQ(gather.calls, 2u);
+  EXPECT_EQ(gather.input_rows, 8u);
+  EXPECT_EQ(gather.output_rows, 4u);
+  EXPECT_EQ(gather.input_bytes,
+            2 * (4 * sizeof(int32_t) + cudf::bitmask_allocation_size_bytes(4)));
+  EXPECT_GT(gather.wall_time_ns, 0);
+
+  // the detail sort is not recorded as a second call
+  EXPECT_EQ(metrics.at("sort").calls, 1u);
+  EXPECT_EQ(metrics.at("sort").output_rows, 4u);
+
+  auto const json = cudf::metrics_to_json();
+  EXPECT_NE(json.find("\"gather\": {\"calls\": 2, "), std::string::npos);
+  auto const prometheus = cudf::metrics_to_prometheus();
+  EXPECT_NE(prometheus.find("# TYPE libcudf_calls_total counter\n"), std::string::npos);
+  EXPECT_NE(prometheus.find("libcudf_calls_total{operation=\"gather\"} 2\n"), std::string::npos);
+  EXPECT_NE(prometheus.find("libcudf_input_rows_total{operation=\"gather\"} 8\n"),
+            std::string::npos);
+
+  cudf::reset_metrics();
+  EXPECT_TRUE(cudf::get_metrics().empty());
+  EXPECT_EQ(cudf::metrics_to_json(), "{}");
+}
+
+TEST_F(MetricsTest, Disabled)
+{
+  cudf::enable_metrics(false);
+  EXPECT_FALSE(cudf::metrics_enabled());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{4, 1, 3, 2};
+  cudf::sort(cudf::table_view{{col}});
+  EXPECT_TRUE(cudf::get_metrics().empty());
+}
+
+TEST_F(MetricsTest, PeakTemporaryMemory)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> col{4, 1, 3, 2, 7, 5};
+  auto const input = cudf::table_view{{col, col}};
+
+  cudf::metrics_resource_adaptor mr(rmm::mr::get_current_device_resource());
+  auto const previous = rmm::mr::set_current_device_resource(&mr);
+  {
+    auto const sorted = cudf::sort(input);
+    EXPECT_GE(mr.allocated_bytes(), 2 * 6 * sizeof(int64_t));
+    EXPECT_GE(mr.num_allocations(), 2u);
+  }
+  rmm::mr::set_current_device_resource(previous);
+
+  // the sorted order and the gathered result are allocated during the call
+  auto const sort = cudf::get_metrics().at("sort");
+  EXPECT_GE(sort.peak_temp_bytes, 6 * sizeof(cudf::size_type) + 2 * 6 * sizeof(int64_t));
+  EXPECT_GE(mr.peak_bytes(), sort.peak_temp_bytes);
+  EXPECT_EQ(mr.allocated_bytes(), 0u);
+}
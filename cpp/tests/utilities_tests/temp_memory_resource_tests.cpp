@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/metrics.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+struct TempMemoryResourceTest : public cudf::test::BaseFixture {
+  void TearDown() override { cudf::set_current_temp_resource(nullptr); }
+};
+
+TEST_F(TempMemoryResourceTest, Precedence)
+{
+  auto* const device_mr = rmm::mr::get_current_device_resource();
+  cudf::metrics_resource_adaptor global_mr{device_mr};
+  cudf::metrics_resource_adaptor scoped_mr{device_mr};
+
+  EXPECT_EQ(cudf::get_current_temp_resource(), device_mr);
+  EXPECT_EQ(cudf::set_current_temp_resource(&global_mr), nullptr);
+  EXPECT_EQ(cudf::get_current_temp_resource(), &global_mr);
+  {
+    cudf::temp_resource_scope scope{&scoped_mr};
+    EXPECT_EQ(cudf::get_current_temp_resource(), &scoped_mr);
+    {
+      cudf::temp_resource_scope inner{&global_mr};
+      EXPECT_EQ(cudf::get_current_temp_resource(), &global_mr);
+    }
+    EXPECT_EQ(cudf::get_current_temp_resource(), &scoped_mr);
+  }
+  EXPECT_EQ(cudf::get_current_temp_resource(), &global_mr);
+  EXPECT_EQ(cudf::set_current_temp_resource(nullptr), &global_mr);
+  EXPECT_EQ(cudf::get_current_temp_resource(), device_mr);
+}
+
+TEST_F(TempMemoryResourceTest, SortAllocatesTemporaries)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> values{10, 20, 30, 40};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{4, 2, 3, 1};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{40, 20, 30, 10};
+
+  cudf::metrics_resource_adaptor temp_mr{rmm::mr::get_current_device_resource()};
+  cudf::metrics_resource_adaptor result_mr{rmm::mr::get_current_device_resource()};
+  std::unique_ptr<cudf::table> result;
+  {
+    cudf::temp_resource_scope scope{&temp_mr};
+    result = cudf::sort_by_key(cudf::table_view{{values}},
+                               cudf::table_view{{keys}},
+                               {},
+                               {},
+                               cudf::get_default_stream(),
+                               &result_mr);
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), cudf::table_view{{expected}});
+
+  // The sorted order is a temporary, released once the result is gathered
+  EXPECT_GT(temp_mr.num_allocations(), 0u);
+  EXPECT_EQ(temp_mr.allocated_bytes(), 0u);
+  EXPECT_GT(result_mr.allocated_bytes(), 0u);
+}
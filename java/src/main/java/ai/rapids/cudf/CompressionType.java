@@ -44,7 +44,13 @@ public enum CompressionType {
   ZIP(6),
 
   /** XZ format using LZMA(2) algorithm */
-  XZ(7);
+  XZ(7),
+
+  /** ZSTD format using LZ77 + Huffman + finite state entropy coding */
+  ZSTD(8),
+
+  /** LZ4 format using LZ77 */
+  LZ4(9);
 
   final int nativeId;
 
@@ -26,7 +26,11 @@ public enum HashType {
   MURMUR3(1),
   HASH_MD5(2),
   HASH_SERIAL_MURMUR3(3),
-  HASH_SPARK_MURMUR3(4);
+  HASH_SPARK_MURMUR3(4),
+  HASH_XXHASH64(5),
+  HASH_MURMUR3_X64_128(6),
+  HASH_SHA1(7),
+  HASH_SHA256(8);
 
   private static final HashType[] HASH_TYPES = HashType.values();
   final int nativeId;
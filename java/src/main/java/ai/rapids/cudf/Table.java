@@ -533,6 +533,13 @@ public final class Table implements AutoCloseable {
 
   private static native long rowBitCount(long tableHandle) throws CudfException;
 
+  private static native long[] castColumns(long tableHandle, int[] types, int[] scales);
+
+  private static native long[] binaryOpColumns(long lhsTable, long rhsTable, int[] ops,
+                                               int[] types, int[] scales);
+
+  private static native long[] replaceNullsScalars(long tableHandle, long[] scalarHandles);
+
   private static native long[] explode(long tableHandle, int index);
 
   private static native long[] explodePosition(long tableHandle, int index);
@@ -1244,6 +1251,66 @@ public final class Table implements AutoCloseable {
     return new ColumnVector(interleaveColumns(this.nativeHandle));
   }
 
+  /**
+   * Cast every column of this table to a type, in a single native call. This is equivalent to
+   * calling {@link ColumnView#castTo(DType)} on each column, without the overhead of one call per
+   * column on small batches.
+   * @param types the type to cast each column to, one for every column.
+   * @return the new Table of the cast columns.
+   * @throws CudfException on any error.
+   */
+  public Table castTo(DType... types) {
+    assert types.length == getNumberOfColumns() : "A type is needed for every column";
+    int[] typeIds = new int[types.length];
+    int[] scales = new int[types.length];
+    for (int i = 0; i < types.length; i++) {
+      typeIds[i] = types[i].typeId.getNativeId();
+      scales[i] = types[i].getScale();
+    }
+    return new Table(castColumns(this.nativeHandle, typeIds, scales));
+  }
+
+  /**
+   * Apply a binary operation to every pair of columns of this table and of rhs, in a single
+   * native call. Column i of the result is column i of this table op[i] column i of rhs, as
+   * {@link ColumnView#binaryOp(BinaryOp, BinaryOperable, DType)} would compute it.
+   * @param ops the operation to apply to each pair of columns.
+   * @param rhs the right hand side columns, as many as this table has.
+   * @param outTypes the type of each output column.
+   * @return the new Table of the results.
+   * @throws CudfException on any error.
+   */
+  public Table binaryOp(BinaryOp[] ops, Table rhs, DType[] outTypes) {
+    assert rhs.getNumberOfColumns() == getNumberOfColumns() : "Mismatch in the number of columns";
+    assert ops.length == getNumberOfColumns() : "An operation is needed for every column";
+    assert outTypes.length == getNumberOfColumns() : "An output type is needed for every column";
+    int[] opIds = new int[ops.length];
+    int[] typeIds = new int[outTypes.length];
+    int[] scales = new int[outTypes.length];
+    for (int i = 0; i < ops.length; i++) {
+      opIds[i] = ops[i].nativeId;
+      typeIds[i] = outTypes[i].typeId.getNativeId();
+      scales[i] = outTypes[i].getScale();
+    }
+    return new Table(binaryOpColumns(this.nativeHandle, rhs.nativeHandle, opIds, typeIds, scales));
+  }
+
+  /**
+   * Replace the nulls of every column of this table with a scalar, in a single native call. This
+   * is equivalent to calling {@link ColumnView#replaceNulls(Scalar)} on each column.
+   * @param replacements the scalar replacing the nulls of each column, of the type of the column.
+   * @return the new Table without nulls, except for the columns replaced with a null scalar.
+   * @throws CudfException on any error.
+   */
+  public Table replaceNulls(Scalar... replacements) {
+    assert replacements.length == getNumberOfColumns() : "A replacement is needed for every column";
+    long[] scalarHandles = new long[replacements.length];
+    for (int i = 0; i < replacements.length; i++) {
+      scalarHandles[i] = replacements[i].getScalarHandle();
+    }
+    return new Table(replaceNullsScalars(this.nativeHandle, scalarHandles));
+  }
+
   /**
    * Repeat each row of this table count times.
    * @param count the number of times to repeat each row.
@@ -93,6 +93,105 @@ std::size_t calc_device_memory_size(cudf::column_view const &view) {
 
 } // anonymous namespace
 
+namespace cudf {
+namespace jni {
+
+std::unique_ptr<cudf::column> cast_to(JNIEnv *env, cudf::column_view const &column,
+                                      cudf::data_type type) {
+  std::unique_ptr<cudf::column> result;
+  if (type == column.type()) {
+    return std::make_unique<cudf::column>(column);
+  }
+  if (type.id() == cudf::type_id::STRING) {
+    switch (column.type().id()) {
+      case cudf::type_id::BOOL8:
+        result = cudf::strings::from_booleans(column);
+        break;
+      case cudf::type_id::FLOAT32:
+      case cudf::type_id::FLOAT64:
+        result = cudf::strings::from_floats(column);
+        break;
+      case cudf::type_id::INT8:
+      case cudf::type_id::UINT8:
+      case cudf::type_id::INT16:
+      case cudf::type_id::UINT16:
+      case cudf::type_id::INT32:
+      case cudf::type_id::UINT32:
+      case cudf::type_id::INT64:
+      case cudf::type_id::UINT64:
+        result = cudf::strings::from_integers(column);
+        break;
+      case cudf::type_id::DECIMAL32:
+      case cudf::type_id::DECIMAL64:
+        result = cudf::strings::from_fixed_point(column);
+        break;
+      default: throw_java_exception(env, ILLEGAL_ARG_CLASS, "Invalid data type");
+    }
+  } else if (column.type().id() == cudf::type_id::STRING) {
+    switch (type.id()) {
+      case cudf::type_id::BOOL8:
+        result = cudf::strings::to_booleans(column);
+        break;
+      case cudf::type_id::FLOAT32:
+      case cudf::type_id::FLOAT64:
+        result = cudf::strings::to_floats(column, type);
+        break;
+      case cudf::type_id::INT8:
+      case cudf::type_id::UINT8:
+      case cudf::type_id::INT16:
+      case cudf::type_id::UINT16:
+      case cudf::type_id::INT32:
+      case cudf::type_id::UINT32:
+      case cudf::type_id::INT64:
+      case cudf::type_id::UINT64:
+        result = cudf::strings::to_integers(column, type);
+        break;
+      case cudf::type_id::DECIMAL32:
+      case cudf::type_id::DECIMAL64:
+        result = cudf::strings::to_fixed_point(column, type);
+        break;
+      default: throw_java_exception(env, ILLEGAL_ARG_CLASS, "Invalid data type");
+    }
+  } else if (cudf::is_timestamp(type) && cudf::is_numeric(column.type())) {
+    // This is a temporary workaround to allow Java to cast from integral types into a timestamp
+    // without forcing an intermediate duration column to be manifested.  Ultimately this style of
+    // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
+    if (type.id() == cudf::type_id::TIMESTAMP_DAYS) {
+      if (column.type().id() != cudf::type_id::INT32) {
+        throw_java_exception(env, ILLEGAL_ARG_CLASS, "Numeric cast to TIMESTAMP_DAYS requires INT32");
+      }
+    } else {
+      if (column.type().id() != cudf::type_id::INT64) {
+        throw_java_exception(env, ILLEGAL_ARG_CLASS, "Numeric cast to non-day timestamp requires INT64");
+      }
+    }
+    cudf::data_type duration_type = cudf::jni::timestamp_to_duration(type);
+    cudf::column_view duration_view = cudf::column_view(duration_type,
+                                                        column.size(),
+                                                        column.head(),
+                                                        column.null_mask(),
+                                                        column.null_count());
+    result = cudf::cast(duration_view, type);
+  } else if (cudf::is_timestamp(column.type()) && cudf::is_numeric(type)) {
+    // This is a temporary workaround to allow Java to cast from timestamp types to integral types
+    // without forcing an intermediate duration column to be manifested.  Ultimately this style of
+    // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
+    cudf::data_type duration_type = cudf::jni::timestamp_to_duration(column.type());
+    cudf::column_view duration_view = cudf::column_view(duration_type,
+                                                        column.size(),
+                                                        column.head(),
+                                                        column.null_mask(),
+                                                        column.null_count());
+    result = cudf::cast(duration_view, type);
+  } else {
+    result = cudf::cast(column, type);
+  }
+  return result;
+}
+
+} // namespace jni
+} // namespace cudf
+
 extern "C" {
 
 JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnView_upperStrings(JNIEnv *env, jobject j_object,
@@ -709,95 +808,7 @@ JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnView_castTo(JNIEnv *env, jclas
     cudf::jni::auto_set_device(env);
     cudf::column_view *column = reinterpret_cast<cudf::column_view *>(handle);
     cudf::data_type n_data_type = cudf::jni::make_data_type(type, scale);
-    std::unique_ptr<cudf::column> result;
-    if (n_data_type == column->type()) {
-      std::unique_ptr<cudf::column> copy(new cudf::column(*column));
-      return reinterpret_cast<jlong>(copy.release());
-    }
-    if (n_data_type.id() == cudf::type_id::STRING) {
-      switch (column->type().id()) {
-        case cudf::type_id::BOOL8:
-          result = cudf::strings::from_booleans(*column);
-          break;
-        case cudf::type_id::FLOAT32:
-        case cudf::type_id::FLOAT64:
-          result = cudf::strings::from_floats(*column);
-          break;
-        case cudf::type_id::INT8:
-        case cudf::type_id::UINT8:
-        case cudf::type_id::INT16:
-        case cudf::type_id::UINT16:
-        case cudf::type_id::INT32:
-        case cudf::type_id::UINT32:
-        case cudf::type_id::INT64:
-        case cudf::type_id::UINT64:
-          result = cudf::strings::from_integers(*column);
-          break;
-        case cudf::type_id::DECIMAL32:
-        case cudf::type_id::DECIMAL64:
-          result = cudf::strings::from_fixed_point(*column);
-          break;
-        default: JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Invalid data type", 0);
-      }
-    } else if (column->type().id() == cudf::type_id::STRING) {
-      switch (n_data_type.id()) {
-        case cudf::type_id::BOOL8:
-          result = cudf::strings::to_booleans(*column);
-          break;
-        case cudf::type_id::FLOAT32:
-        case cudf::type_id::FLOAT64:
-          result = cudf::strings::to_floats(*column, n_data_type);
-          break;
-        case cudf::type_id::INT8:
-        case cudf::type_id::UINT8:
-        case cudf::type_id::INT16:
-        case cudf::type_id::UINT16:
-        case cudf::type_id::INT32:
-        case cudf::type_id::UINT32:
-        case cudf::type_id::INT64:
-        case cudf::type_id::UINT64:
-          result = cudf::strings::to_integers(*column, n_data_type);
-          break;
-        case cudf::type_id::DECIMAL32:
-        case cudf::type_id::DECIMAL64:
-          result = cudf::strings::to_fixed_point(*column, n_data_type);
-          break;
-        default: JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Invalid data type", 0);
-      }
-    } else if (cudf::is_timestamp(n_data_type) && cudf::is_numeric(column->type())) {
-      // This is a temporary workaround to allow Java to cast from integral types into a timestamp
-      // without forcing an intermediate duration column to be manifested.  Ultimately this style of
-      // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
-      if (n_data_type.id() == cudf::type_id::TIMESTAMP_DAYS) {
-        if (column->type().id() != cudf::type_id::INT32) {
-          JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Numeric cast to TIMESTAMP_DAYS requires INT32", 0);
-        }
-      } else {
-        if (column->type().id() != cudf::type_id::INT64) {
-          JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Numeric cast to non-day timestamp requires INT64", 0);
-        }
-      }
-      cudf::data_type duration_type = cudf::jni::timestamp_to_duration(n_data_type);
-      cudf::column_view duration_view = cudf::column_view(duration_type,
-                                                          column->size(),
-                                                          column->head(),
-                                                          column->null_mask(),
-                                                          column->null_count());
-      result = cudf::cast(duration_view, n_data_type);
-    } else if (cudf::is_timestamp(column->type()) && cudf::is_numeric(n_data_type)) {
-      // This is a temporary workaround to allow Java to cast from timestamp types to integral types
-      // without forcing an intermediate duration column to be manifested.  Ultimately this style of
-      // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
-      cudf::data_type duration_type = cudf::jni::timestamp_to_duration(column->type());
-      cudf::column_view duration_view = cudf::column_view(duration_type,
-                                                          column->size(),
-                                                          column->head(),
-                                                          column->null_mask(),
-                                                          column->null_count());
-      result = cudf::cast(duration_view, n_data_type);
-    } else {
-      result = cudf::cast(*column, n_data_type);
-    }
+    std::unique_ptr<cudf::column> result = cudf::jni::cast_to(env, *column, n_data_type);
     return reinterpret_cast<jlong>(result.release());
   }
   CATCH_STD(env, 0);
@@ -17,6 +17,7 @@
 #include <arrow/io/api.h>
 #include <arrow/ipc/api.h>
 #include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/filling.hpp>
 #include <cudf/groupby.hpp>
@@ -33,6 +34,7 @@
 #include <cudf/replace.hpp>
 #include <cudf/reshape.hpp>
 #include <cudf/rolling.hpp>
+#include <cudf/row_conversion.hpp>
 #include <cudf/search.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
@@ -40,9 +42,9 @@
 
 #include "cudf_jni_apis.hpp"
 #include "dtype_utils.hpp"
-#include "row_conversion.hpp"
 
 #include <algorithm>
+#include <iterator>
 
 namespace cudf {
 namespace jni {
@@ -2109,7 +2111,7 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_convertToRows(JNIEnv *env
   try {
     cudf::jni::auto_set_device(env);
     cudf::table_view *n_input_table = reinterpret_cast<cudf::table_view *>(input_table);
-    std::vector<std::unique_ptr<cudf::column>> cols = cudf::java::convert_to_rows(*n_input_table);
+    std::vector<std::unique_ptr<cudf::column>> cols = cudf::convert_to_rows(*n_input_table);
     int num_columns = cols.size();
     cudf::jni::native_jlongArray outcol_handles(env, num_columns);
     for (int i = 0; i < num_columns; i++) {
@@ -2137,7 +2139,7 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_convertFromRows(JNIEnv *e
     for (int i = 0; i < n_types.size(); i++) {
       types_vec.emplace_back(cudf::jni::make_data_type(n_types[i], n_scale[i]));
     }
-    std::unique_ptr<cudf::table> result = cudf::java::convert_from_rows(list_input, types_vec);
+    std::unique_ptr<cudf::table> result = cudf::convert_from_rows(list_input, types_vec);
     return cudf::jni::convert_table_for_return(env, result);
   }
   CATCH_STD(env, 0);
@@ -2428,6 +2430,92 @@ JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_rowBitCount(JNIEnv* env, jclas
   CATCH_STD(env, 0);
 }
 
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_castColumns(JNIEnv *env, jclass,
+                                                                   jlong j_table,
+                                                                   jintArray j_types,
+                                                                   jintArray j_scales) {
+  JNI_NULL_CHECK(env, j_table, "table is null", 0);
+  JNI_NULL_CHECK(env, j_types, "types are null", 0);
+  JNI_NULL_CHECK(env, j_scales, "scales are null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    auto input = reinterpret_cast<cudf::table_view *>(j_table);
+    cudf::jni::native_jintArray types(env, j_types);
+    cudf::jni::native_jintArray scales(env, j_scales);
+    JNI_ARG_CHECK(env, types.size() == input->num_columns() && scales.size() == types.size(),
+                  "a type is needed for every column", 0);
+
+    // All the casts are queued on the stream, without crossing JNI for each column
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    columns.reserve(input->num_columns());
+    for (int i = 0; i < input->num_columns(); ++i) {
+      columns.push_back(cudf::jni::cast_to(env, input->column(i),
+                                           cudf::jni::make_data_type(types[i], scales[i])));
+    }
+    auto result = std::make_unique<cudf::table>(std::move(columns));
+    return cudf::jni::convert_table_for_return(env, result);
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_binaryOpColumns(
+    JNIEnv *env, jclass, jlong j_lhs, jlong j_rhs, jintArray j_ops, jintArray j_types,
+    jintArray j_scales) {
+  JNI_NULL_CHECK(env, j_lhs, "lhs table is null", 0);
+  JNI_NULL_CHECK(env, j_rhs, "rhs table is null", 0);
+  JNI_NULL_CHECK(env, j_ops, "ops are null", 0);
+  JNI_NULL_CHECK(env, j_types, "types are null", 0);
+  JNI_NULL_CHECK(env, j_scales, "scales are null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    auto lhs = reinterpret_cast<cudf::table_view *>(j_lhs);
+    auto rhs = reinterpret_cast<cudf::table_view *>(j_rhs);
+    cudf::jni::native_jintArray ops(env, j_ops);
+    cudf::jni::native_jintArray types(env, j_types);
+    cudf::jni::native_jintArray scales(env, j_scales);
+    JNI_ARG_CHECK(env, rhs->num_columns() == lhs->num_columns(),
+                  "lhs and rhs must have the same number of columns", 0);
+    JNI_ARG_CHECK(env, ops.size() == lhs->num_columns() && types.size() == ops.size() &&
+                           scales.size() == ops.size(),
+                  "an op and an output type are needed for every column", 0);
+
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    columns.reserve(lhs->num_columns());
+    for (int i = 0; i < lhs->num_columns(); ++i) {
+      columns.push_back(cudf::binary_operation(lhs->column(i), rhs->column(i),
+                                               static_cast<cudf::binary_operator>(ops[i]),
+                                               cudf::jni::make_data_type(types[i], scales[i])));
+    }
+    auto result = std::make_unique<cudf::table>(std::move(columns));
+    return cudf::jni::convert_table_for_return(env, result);
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_replaceNullsScalars(JNIEnv *env, jclass,
+                                                                           jlong j_table,
+                                                                           jlongArray j_scalars) {
+  JNI_NULL_CHECK(env, j_table, "table is null", 0);
+  JNI_NULL_CHECK(env, j_scalars, "scalars are null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    auto input = reinterpret_cast<cudf::table_view *>(j_table);
+    cudf::jni::native_jpointerArray<cudf::scalar> scalars(env, j_scalars);
+    JNI_ARG_CHECK(env, scalars.size() == input->num_columns(),
+                  "a replacement is needed for every column", 0);
+
+    // The fixed-width columns are all replaced by the same kernel
+    std::vector<cudf::null_replacement> replacements;
+    replacements.reserve(scalars.size());
+    std::transform(scalars.data(), scalars.data() + scalars.size(),
+                   std::back_inserter(replacements),
+                   [](cudf::scalar const *s) { return cudf::null_replacement{*s}; });
+    std::unique_ptr<cudf::table> result = cudf::replace_nulls(*input, replacements);
+    return cudf::jni::convert_table_for_return(env, result);
+  }
+  CATCH_STD(env, 0);
+}
+
 JNIEXPORT jobjectArray JNICALL Java_ai_rapids_cudf_Table_contiguousSplitGroups(JNIEnv *env, jclass,
                                                                     jlong jinput_table,
                                                                     jintArray jkey_indices,
@@ -25,6 +25,13 @@ namespace jni {
 
 jlongArray convert_table_for_return(JNIEnv *env, std::unique_ptr<cudf::table> &table_result);
 
+/**
+ * Cast a column to a type the way ColumnView.castTo does, throwing a Java
+ * IllegalArgumentException for the casts that are not supported.
+ */
+std::unique_ptr<cudf::column> cast_to(JNIEnv *env, cudf::column_view const &column,
+                                      cudf::data_type type);
+
 //
 // ContiguousTable APIs
 //
@@ -1888,6 +1888,60 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testTableCastTo() {
+    try (Table t = new Table.TestBuilder()
+            .column(1, null, 3)
+            .column("4", "5", null)
+            .column(1.5, 2.5, 3.5)
+            .build();
+         Table expected = new Table.TestBuilder()
+            .column(1L, null, 3L)
+            .column(4, 5, null)
+            .column("1.5", "2.5", "3.5")
+            .build();
+         Table cast = t.castTo(DType.INT64, DType.INT32, DType.STRING)) {
+      assertTablesAreEqual(expected, cast);
+    }
+  }
+
+  @Test
+  void testTableBinaryOp() {
+    try (Table lhs = new Table.TestBuilder()
+            .column(1, 2, null)
+            .column(1.0, 4.0, 9.0)
+            .build();
+         Table rhs = new Table.TestBuilder()
+            .column(10, 20, 30)
+            .column(2.0, 2.0, 3.0)
+            .build();
+         Table expected = new Table.TestBuilder()
+            .column(11L, 22L, null)
+            .column(true, false, true)
+            .build();
+         Table result = lhs.binaryOp(new BinaryOp[]{BinaryOp.ADD, BinaryOp.LESS},
+             rhs, new DType[]{DType.INT64, DType.BOOL8})) {
+      assertTablesAreEqual(expected, result);
+    }
+  }
+
+  @Test
+  void testTableReplaceNulls() {
+    try (Table t = new Table.TestBuilder()
+            .column(1, null, 3)
+            .column(null, "b", null)
+            .build();
+         Scalar zero = Scalar.fromInt(0);
+         Scalar empty = Scalar.fromString("");
+         Table expected = new Table.TestBuilder()
+            .column(1, 0, 3)
+            .column("", "b", "")
+            .build();
+         Table replaced = t.replaceNulls(zero, empty)) {
+      assertTablesAreEqual(expected, replaced);
+    }
+  }
+
   @Test
   void testRepeatColumn() {
     try (Table t = new Table.TestBuilder()
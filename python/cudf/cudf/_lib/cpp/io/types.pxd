@@ -29,6 +29,8 @@ cdef extern from "cudf/io/types.hpp" \
         BROTLI "cudf::io::compression_type::BROTLI"
         ZIP "cudf::io::compression_type::ZIP"
         XZ "cudf::io::compression_type::XZ"
+        ZSTD "cudf::io::compression_type::ZSTD"
+        LZ4 "cudf::io::compression_type::LZ4"
 
     ctypedef enum io_type:
         FILEPATH "cudf::io::io_type::FILEPATH"
@@ -40,6 +42,7 @@ cdef extern from "cudf/io/types.hpp" \
         STATISTICS_NONE = 0,
         STATISTICS_ROWGROUP = 1,
         STATISTICS_PAGE = 2,
+        STATISTICS_COLUMN = 3,
 
     cdef cppclass column_name_info:
         string name